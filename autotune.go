@@ -0,0 +1,231 @@
+//go:build !vks_no_version_1_3 && !vks_no_version_1_1 && !vks_no_version_1_2
+
+package vks
+
+import (
+	"crypto/sha256"
+	"encoding/binary"
+	"fmt"
+	"os"
+	"path/filepath"
+	"time"
+)
+
+// WorkgroupSize is the local size of a compute shader along X, Y and Z.
+type WorkgroupSize [3]uint32
+
+// Invocations returns the number of invocations of a workgroup.
+func (size WorkgroupSize) Invocations() uint32 {
+	return size[0] * size[1] * size[2]
+}
+
+// WorkgroupTuneConfig describes how the workgroup size of a compute shader is
+// specialized and how a job covers its problem. The shader declares its local
+// size with specialization constants, like
+//
+//	layout(local_size_x_id = 0, local_size_y_id = 1, local_size_z_id = 2) in;
+//
+// and covers Invocations invocations per dimension, so the group count of a
+// job follows from the workgroup size.
+type WorkgroupTuneConfig struct {
+	SizeIDs     [3]uint32 // The constant IDs of the X, Y and Z local size.
+	Invocations [3]uint32 // The invocations per dimension; 0 counts as 1.
+
+	// Candidates are the workgroup sizes tried. When empty, the powers of
+	// two of 32 invocations or more allowed by the device limits are
+	// tried, with X >= Y >= Z and no dimension wider than the problem.
+	Candidates []WorkgroupSize
+
+	Runs    int    // The timed runs per candidate; 5 when zero.
+	Timeout uint64 // The timeout of every run, in nanoseconds.
+
+	// Dir, when not empty, is where tuning results are kept, keyed by the
+	// device UUID, driver version, shader and configuration.
+	Dir string
+}
+
+// WorkgroupTuning is the workgroup size chosen for a shader on a device.
+type WorkgroupTuning struct {
+	Size WorkgroupSize
+
+	// Time is the fastest dispatch of Size, measured with timestamp
+	// queries, or the fastest host latency of the job when the runner has
+	// no timestamps. It is zero for results loaded from Dir.
+	Time   time.Duration
+	Cached bool // The result was loaded from Dir.
+}
+
+// Apply sets the workgroup size specialization constants and the group count
+// of the job for size. Other specialization constants are kept.
+func (config *WorkgroupTuneConfig) Apply(job *ComputeJob, size WorkgroupSize) {
+	spec := make([]SpecializationConstant, 0, len(job.Specialization)+3)
+	for _, c := range job.Specialization {
+		if c.ID != config.SizeIDs[0] && c.ID != config.SizeIDs[1] && c.ID != config.SizeIDs[2] {
+			spec = append(spec, c)
+		}
+	}
+	for k := range size {
+		spec = append(spec, SpecializationConstant{config.SizeIDs[k], size[k]})
+		n := max(config.Invocations[k], 1)
+		job.GroupCount[k] = (n + size[k] - 1) / size[k]
+	}
+	job.Specialization = spec
+}
+
+// candidates returns the workgroup sizes to try within the device limits.
+func (config *WorkgroupTuneConfig) candidates(limits *PhysicalDeviceLimits) ([]WorkgroupSize, error) {
+	maxSize := limits.MaxComputeWorkGroupSize()
+	maxInvocations := limits.MaxComputeWorkGroupInvocations()
+	if len(config.Candidates) > 0 {
+		for _, size := range config.Candidates {
+			if !workgroupSizeFits(size, maxSize, maxInvocations) {
+				return nil, fmt.Errorf("error: workgroup size %v exceeds the device limits %v and %d invocations", size, maxSize, maxInvocations)
+			}
+		}
+		return config.Candidates, nil
+	}
+
+	// Powers of two up to the problem size, at least 1.
+	var widest [3]uint32
+	for k := range widest {
+		n := max(config.Invocations[k], 1)
+		for widest[k] = 1; widest[k] < n; widest[k] *= 2 {
+		}
+	}
+	least := min(uint32(32), maxInvocations)
+	var sizes []WorkgroupSize
+	for x := uint32(1); x <= widest[0]; x *= 2 {
+		for y := uint32(1); y <= min(x, widest[1]); y *= 2 {
+			for z := uint32(1); z <= min(y, widest[2]); z *= 2 {
+				size := WorkgroupSize{x, y, z}
+				if size.Invocations() >= least && workgroupSizeFits(size, maxSize, maxInvocations) {
+					sizes = append(sizes, size)
+				}
+			}
+		}
+	}
+	if len(sizes) == 0 {
+		// The whole problem fits a workgroup smaller than 32 invocations.
+		size := WorkgroupSize{widest[0], widest[1], widest[2]}
+		if !workgroupSizeFits(size, maxSize, maxInvocations) {
+			return nil, fmt.Errorf("error: no workgroup size fits the device limits %v and %d invocations", maxSize, maxInvocations)
+		}
+		sizes = append(sizes, size)
+	}
+	return sizes, nil
+}
+
+func workgroupSizeFits(size WorkgroupSize, maxSize []uint32, maxInvocations uint32) bool {
+	for k := range size {
+		if size[k] == 0 || size[k] > maxSize[k] {
+			return false
+		}
+	}
+	return uint64(size[0])*uint64(size[1])*uint64(size[2]) <= uint64(maxInvocations)
+}
+
+// tuningFile returns the file keeping the result of the job and configuration
+// on the device. The key covers the shader, the other specialization constants
+// and the problem size, but not the input data.
+func (config *WorkgroupTuneConfig) tuningFile(runner *ComputeRunner, caps *DeviceCapabilities, job *ComputeJob) string {
+	base := *job
+	config.Apply(&base, WorkgroupSize{1, 1, 1})
+	key, _ := runner.pipelineKey(&base)
+	hash := sha256.New()
+	hash.Write(key[:])
+	binary.Write(hash, binary.LittleEndian, config.SizeIDs)
+	binary.Write(hash, binary.LittleEndian, config.Invocations)
+	binary.Write(hash, binary.LittleEndian, config.Candidates)
+	name := fmt.Sprintf("%x-%08x-%x.tune", caps.IDProperties.DeviceUUID(), caps.Properties.DriverVersion(), hash.Sum(nil)[:8])
+	return filepath.Join(config.Dir, name)
+}
+
+// TuneWorkgroupSize picks the fastest workgroup size of the job's shader on
+// the runner's device. Every candidate is specialized with Apply, warmed up
+// with one run and timed over config.Runs runs of the job; its Input should
+// be representative of production inputs, and its Output is overwritten. The
+// pipelines of the losing candidates are destroyed; the winner stays cached
+// in the runner, so the job is ready to submit once Apply sets the returned
+// size. The runner statistics are left as they were.
+//
+// With config.Dir set, a result kept for the device, driver version, shader
+// and configuration is returned without running anything, and new results are
+// written there, so production workers start with tuned pipelines. Failing to
+// write the result is not an error.
+func TuneWorkgroupSize(runner *ComputeRunner, caps *DeviceCapabilities, job ComputeJob, config WorkgroupTuneConfig) (WorkgroupTuning, error) {
+	limits := caps.Properties.LimitsView()
+	maxSize := limits.MaxComputeWorkGroupSize()
+	maxInvocations := limits.MaxComputeWorkGroupInvocations()
+	var fn string
+	if len(config.Dir) > 0 {
+		fn = config.tuningFile(runner, caps, &job)
+		var size WorkgroupSize
+		if data, err := os.ReadFile(fn); err == nil {
+			if _, err := fmt.Sscanf(string(data), "%d %d %d", &size[0], &size[1], &size[2]); err == nil && workgroupSizeFits(size, maxSize, maxInvocations) {
+				return WorkgroupTuning{Size: size, Cached: true}, nil
+			}
+		}
+	}
+
+	sizes, err := config.candidates(limits)
+	if err != nil {
+		return WorkgroupTuning{}, err
+	}
+	if config.Runs <= 0 {
+		config.Runs = 5
+	}
+	if err := runner.Wait(config.Timeout); err != nil {
+		return WorkgroupTuning{}, err
+	}
+	saved := runner.stats
+	defer func() { runner.stats = saved }()
+
+	var best WorkgroupTuning
+	var bestJob *ComputeJob
+	jobs := make([]*ComputeJob, config.Runs)
+	for _, size := range sizes {
+		candidate := job
+		config.Apply(&candidate, size)
+		for k := range jobs {
+			jobs[k] = &candidate
+		}
+		// The warm-up run also creates the pipeline.
+		err := runner.Run(jobs[:1], config.Timeout)
+		if err == nil {
+			runner.ResetStats()
+			err = runner.Run(jobs, config.Timeout)
+		}
+		if err != nil {
+			// Jobs may still be in flight; the runner destroys the
+			// pipelines it cached.
+			return WorkgroupTuning{}, err
+		}
+		stats := runner.Stats()
+		elapsed := stats.Dispatch.Min
+		if stats.Dispatch.Count == 0 {
+			elapsed = stats.Latency.Min
+		}
+		if bestJob == nil || elapsed < best.Time {
+			if bestJob != nil {
+				runner.releasePipeline(bestJob)
+			}
+			best = WorkgroupTuning{Size: size, Time: elapsed}
+			bestJob = &candidate
+		} else {
+			runner.releasePipeline(&candidate)
+		}
+	}
+
+	if len(fn) > 0 && os.MkdirAll(config.Dir, 0755) == nil {
+		// Written to a temporary file and renamed, so concurrent workers
+		// never read a partial result.
+		if fh, err := os.CreateTemp(config.Dir, "tune-*.tmp"); err == nil {
+			defer os.Remove(fh.Name())
+			_, err := fmt.Fprintf(fh, "%d %d %d\n", best.Size[0], best.Size[1], best.Size[2])
+			if fh.Close() == nil && err == nil {
+				os.Rename(fh.Name(), fn)
+			}
+		}
+	}
+	return best, nil
+}
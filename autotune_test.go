@@ -0,0 +1,81 @@
+//go:build !vks_no_version_1_3 && !vks_no_version_1_1 && !vks_no_version_1_2
+
+package vks
+
+import (
+	"reflect"
+	"testing"
+	"unsafe"
+)
+
+// testComputeLimits returns limits with the compute workgroup size limits
+// set, as the limits have no setters.
+func testComputeLimits(maxSize WorkgroupSize, maxInvocations uint32) *PhysicalDeviceLimits {
+	var limits PhysicalDeviceLimits
+	copy(unsafe.Slice((*uint32)(unsafe.Pointer(&limits.maxComputeWorkGroupSize[0])), 3), maxSize[:])
+	*(*uint32)(unsafe.Pointer(&limits.maxComputeWorkGroupInvocations)) = maxInvocations
+	return &limits
+}
+
+func TestWorkgroupTuneCandidates(t *testing.T) {
+	limits := testComputeLimits(WorkgroupSize{1024, 1024, 64}, 256)
+	for _, c := range []struct {
+		name        string
+		invocations [3]uint32
+		limits      *PhysicalDeviceLimits
+		want        []WorkgroupSize
+	}{
+		{"1D", [3]uint32{4096, 0, 0}, limits, []WorkgroupSize{
+			{32, 1, 1}, {64, 1, 1}, {128, 1, 1}, {256, 1, 1},
+		}},
+		{"2D", [3]uint32{64, 64, 1}, limits, []WorkgroupSize{
+			{8, 4, 1}, {8, 8, 1},
+			{16, 2, 1}, {16, 4, 1}, {16, 8, 1}, {16, 16, 1},
+			{32, 1, 1}, {32, 2, 1}, {32, 4, 1}, {32, 8, 1},
+			{64, 1, 1}, {64, 2, 1}, {64, 4, 1},
+		}},
+		{"3D", [3]uint32{4, 4, 4}, limits, []WorkgroupSize{{4, 4, 2}, {4, 4, 4}}},
+		{"narrow", [3]uint32{4096, 1, 1}, testComputeLimits(WorkgroupSize{64, 64, 64}, 1024), []WorkgroupSize{
+			{32, 1, 1}, {64, 1, 1},
+		}},
+		{"few invocations", [3]uint32{4096, 1, 1}, testComputeLimits(WorkgroupSize{1024, 1024, 64}, 16), []WorkgroupSize{
+			{16, 1, 1},
+		}},
+		// Problems below 32 invocations get one workgroup covering them.
+		{"small", [3]uint32{5, 2, 1}, limits, []WorkgroupSize{{8, 2, 1}}},
+	} {
+		config := WorkgroupTuneConfig{Invocations: c.invocations}
+		got, err := config.candidates(c.limits)
+		if err != nil {
+			t.Errorf("%s: %v", c.name, err)
+		} else if !reflect.DeepEqual(got, c.want) {
+			t.Errorf("%s: candidates %v, want %v", c.name, got, c.want)
+		}
+	}
+
+	config := WorkgroupTuneConfig{Invocations: [3]uint32{5, 2, 1}}
+	if got, err := config.candidates(testComputeLimits(WorkgroupSize{4, 4, 4}, 256)); err == nil {
+		t.Errorf("candidates %v for a problem wider than the workgroup limits", got)
+	}
+	config.Candidates = []WorkgroupSize{{16, 16, 1}, {64, 1, 1}}
+	if got, err := config.candidates(limits); err != nil || !reflect.DeepEqual(got, config.Candidates) {
+		t.Errorf("candidates %v, %v, want the configured ones", got, err)
+	}
+	config.Candidates = append(config.Candidates, WorkgroupSize{32, 16, 1})
+	if got, err := config.candidates(limits); err == nil {
+		t.Errorf("candidates %v include a size over the invocation limit", got)
+	}
+}
+
+func TestWorkgroupTuneApply(t *testing.T) {
+	config := WorkgroupTuneConfig{SizeIDs: [3]uint32{0, 1, 2}, Invocations: [3]uint32{100, 10, 0}}
+	job := ComputeJob{Specialization: []SpecializationConstant{{1, 7}, {5, 9}}}
+	config.Apply(&job, WorkgroupSize{32, 4, 1})
+	if job.GroupCount != [3]uint32{4, 3, 1} {
+		t.Errorf("group count %v, want [4 3 1]", job.GroupCount)
+	}
+	want := []SpecializationConstant{{5, 9}, {0, 32}, {1, 4}, {2, 1}}
+	if !reflect.DeepEqual(job.Specialization, want) {
+		t.Errorf("specialization %v, want %v", job.Specialization, want)
+	}
+}
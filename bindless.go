@@ -0,0 +1,512 @@
+//go:build !vks_no_version_1_3 && !vks_no_version_1_1 && !vks_no_version_1_2
+
+package vks
+
+import (
+	"fmt"
+	"unsafe"
+)
+
+// BindlessClass is a class of resources of a BindlessHeap. Every class with a
+// capacity gets its own descriptor set, holding a single variable sized array
+// at binding 0.
+type BindlessClass int
+
+const (
+	BindlessSampledImages  BindlessClass = iota // VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE
+	BindlessStorageImages                       // VK_DESCRIPTOR_TYPE_STORAGE_IMAGE
+	BindlessSamplers                            // VK_DESCRIPTOR_TYPE_SAMPLER
+	BindlessStorageBuffers                      // VK_DESCRIPTOR_TYPE_STORAGE_BUFFER
+	BindlessUniformBuffers                      // VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER
+	bindlessClasses
+)
+
+var bindlessDescriptorTypes = [bindlessClasses]DescriptorType{
+	VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE,
+	VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+	VK_DESCRIPTOR_TYPE_SAMPLER,
+	VK_DESCRIPTOR_TYPE_STORAGE_BUFFER,
+	VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+}
+
+// BindlessHeapConfig configures a BindlessHeap.
+type BindlessHeapConfig struct {
+	// Capacity is the number of descriptors of every class. Classes with
+	// no capacity get no set.
+	Capacity [bindlessClasses]uint32
+
+	// Stages are the shader stages reading the heap and the push
+	// constants; VK_SHADER_STAGE_ALL when zero.
+	Stages ShaderStageFlags
+}
+
+// bindlessSlot is a released descriptor waiting for the device.
+type bindlessSlot struct {
+	class BindlessClass
+	index uint32
+}
+
+// bindlessRetired is a batch of released slots and the fence or timeline
+// value guarding their reuse.
+type bindlessRetired struct {
+	fence     Fence
+	semaphore Semaphore
+	value     uint64
+	slots     []bindlessSlot
+}
+
+// BindlessHeap is a bindless descriptor heap: one large update-after-bind
+// descriptor set per resource class, bound once per command buffer. Resources
+// are added to a class and identified by their 32 bit index in its array,
+// which draws and dispatches pass to the shaders through push constants
+// instead of binding descriptor sets.
+//
+// The shaders declare every class as an unsized array, at the set numbers
+// given by the order of the classes with a capacity, for example
+//
+//	layout(set = 0, binding = 0) uniform texture2D textures[];
+//	layout(set = 1, binding = 0) uniform sampler samplers[];
+//
+// and index it with nonuniformEXT when the index is not uniform.
+//
+// Descriptor writes are batched and applied by Flush, or EndFrame, with a
+// single UpdateDescriptorSets call. Released indices are recycled once the
+// fence or timeline value of the frame that released them is observed, so
+// the device never reads a recycled descriptor.
+//
+// The device must be created with the Vulkan 1.2 runtimeDescriptorArray,
+// descriptorBindingPartiallyBound, descriptorBindingVariableDescriptorCount,
+// descriptorBindingUpdateUnusedWhilePending and descriptorBinding*UpdateAfterBind
+// features of the classes used. A BindlessHeap is not safe for concurrent use.
+type BindlessHeap struct {
+	device   DeviceFacade
+	stages   ShaderStageFlags
+	pool     DescriptorPool
+	capacity [bindlessClasses]uint32
+	layouts  [bindlessClasses]DescriptorSetLayout
+	sets     [bindlessClasses]DescriptorSet
+
+	// Indices never handed out start at next; free holds recycled ones.
+	next [bindlessClasses]uint32
+	free [bindlessClasses][]uint32
+	live [bindlessClasses][]bool // Indices handed out and not released.
+
+	releasing []bindlessSlot
+	retired   []bindlessRetired
+
+	// Pending writes. The info pointers of writes are set by Flush, as the
+	// info slices grow.
+	writes      []WriteDescriptorSet
+	imageInfos  []DescriptorImageInfo
+	bufferInfos []DescriptorBufferInfo
+	infoIndex   []int
+}
+
+// NewBindlessHeap creates the descriptor set layouts, pool and sets of the
+// heap. caps provides the Vulkan 1.2 features and update-after-bind limits
+// the capacities are checked against.
+func NewBindlessHeap(device DeviceFacade, caps *DeviceCapabilities, config BindlessHeapConfig) (*BindlessHeap, error) {
+	if config.Stages == 0 {
+		config.Stages = ShaderStageFlags(VK_SHADER_STAGE_ALL)
+	}
+	if err := checkBindlessSupport(caps, &config); err != nil {
+		return nil, err
+	}
+	heap := &BindlessHeap{
+		device:   device,
+		stages:   config.Stages,
+		capacity: config.Capacity,
+	}
+	for class, capacity := range config.Capacity {
+		heap.live[class] = make([]bool, capacity)
+	}
+	if err := heap.createSets(); err != nil {
+		heap.Destroy()
+		return nil, err
+	}
+	return heap, nil
+}
+
+func checkBindlessSupport(caps *DeviceCapabilities, config *BindlessHeapConfig) error {
+	features := &caps.Vulkan12Features
+	if features.RuntimeDescriptorArray() == VK_FALSE ||
+		features.DescriptorBindingPartiallyBound() == VK_FALSE ||
+		features.DescriptorBindingVariableDescriptorCount() == VK_FALSE ||
+		features.DescriptorBindingUpdateUnusedWhilePending() == VK_FALSE {
+		return fmt.Errorf("error: bindless heap needs the runtime descriptor array, partially bound, variable count and update unused while pending descriptor indexing features")
+	}
+	props := &caps.Vulkan12Properties
+	limits := [bindlessClasses]uint32{
+		min(props.MaxDescriptorSetUpdateAfterBindSampledImages(), props.MaxPerStageDescriptorUpdateAfterBindSampledImages()),
+		min(props.MaxDescriptorSetUpdateAfterBindStorageImages(), props.MaxPerStageDescriptorUpdateAfterBindStorageImages()),
+		min(props.MaxDescriptorSetUpdateAfterBindSamplers(), props.MaxPerStageDescriptorUpdateAfterBindSamplers()),
+		min(props.MaxDescriptorSetUpdateAfterBindStorageBuffers(), props.MaxPerStageDescriptorUpdateAfterBindStorageBuffers()),
+		min(props.MaxDescriptorSetUpdateAfterBindUniformBuffers(), props.MaxPerStageDescriptorUpdateAfterBindUniformBuffers()),
+	}
+	// Update after bind of samplers needs no feature.
+	updateAfterBind := [bindlessClasses]Bool32{
+		features.DescriptorBindingSampledImageUpdateAfterBind(),
+		features.DescriptorBindingStorageImageUpdateAfterBind(),
+		VK_TRUE,
+		features.DescriptorBindingStorageBufferUpdateAfterBind(),
+		features.DescriptorBindingUniformBufferUpdateAfterBind(),
+	}
+	total := uint32(0)
+	for class, capacity := range config.Capacity {
+		if capacity == 0 {
+			continue
+		}
+		if updateAfterBind[class] == VK_FALSE {
+			return fmt.Errorf("error: bindless heap needs update after bind support for %v", bindlessDescriptorTypes[class])
+		}
+		if capacity > limits[class] {
+			return fmt.Errorf("error: bindless heap capacity of %d %v exceeds the device limit of %d", capacity, bindlessDescriptorTypes[class], limits[class])
+		}
+		total += capacity
+	}
+	if total == 0 {
+		return fmt.Errorf("error: bindless heap has no capacity")
+	}
+	if total > props.MaxPerStageUpdateAfterBindResources() {
+		return fmt.Errorf("error: bindless heap capacity of %d descriptors exceeds the device limit of %d per stage", total, props.MaxPerStageUpdateAfterBindResources())
+	}
+	return nil
+}
+
+func (heap *BindlessHeap) createSets() error {
+	arp := NewAutoReleaser()
+	defer arp.Release()
+
+	var sizes []DescriptorPoolSize
+	var layouts []DescriptorSetLayout
+	var counts []uint32
+	bindingFlags := []DescriptorBindingFlags{DescriptorBindingFlags(VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT |
+		VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT |
+		VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT |
+		VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT)}
+	for class, capacity := range heap.capacity {
+		if capacity == 0 {
+			continue
+		}
+		bindings := make([]DescriptorSetLayoutBinding, 1)
+		bindings[0].SetDescriptorType(bindlessDescriptorTypes[class])
+		bindings[0].SetDescriptorCount(capacity)
+		bindings[0].SetStageFlags(heap.stages)
+		flagsInfo := &DescriptorSetLayoutBindingFlagsCreateInfo{}
+		flagsInfo.SetDefaultSType()
+		flagsInfo.PinPBindingFlags(arp, bindingFlags)
+		slInfo := &DescriptorSetLayoutCreateInfo{}
+		slInfo.SetDefaultSType()
+		slInfo.PinPNext(arp, unsafe.Pointer(flagsInfo))
+		slInfo.SetFlags(DescriptorSetLayoutCreateFlags(VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT))
+		slInfo.PinPBindings(arp, bindings)
+		var layout DescriptorSetLayout
+		if err := heap.device.CreateDescriptorSetLayout(slInfo, nil, &layout).AsErr(); err != nil {
+			return err
+		}
+		heap.layouts[class] = layout
+
+		size := DescriptorPoolSize{}.
+			WithType_(bindlessDescriptorTypes[class]).
+			WithDescriptorCount(capacity)
+		sizes = append(sizes, size)
+		layouts = append(layouts, layout)
+		counts = append(counts, capacity)
+	}
+
+	dpInfo := &DescriptorPoolCreateInfo{}
+	dpInfo.SetDefaultSType()
+	dpInfo.SetFlags(DescriptorPoolCreateFlags(VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT))
+	dpInfo.SetMaxSets(uint32(len(layouts)))
+	dpInfo.PinPPoolSizes(arp, sizes)
+	var pool DescriptorPool
+	if err := heap.device.CreateDescriptorPool(dpInfo, nil, &pool).AsErr(); err != nil {
+		return err
+	}
+	heap.pool = pool
+
+	countInfo := &DescriptorSetVariableDescriptorCountAllocateInfo{}
+	countInfo.SetDefaultSType()
+	countInfo.PinPDescriptorCounts(arp, counts)
+	dsInfo := &DescriptorSetAllocateInfo{}
+	dsInfo.SetDefaultSType()
+	dsInfo.PinPNext(arp, unsafe.Pointer(countInfo))
+	dsInfo.SetDescriptorPool(heap.pool)
+	dsInfo.PinPSetLayouts(arp, layouts)
+	sets := make([]DescriptorSet, len(layouts))
+	if err := heap.device.AllocateDescriptorSets(dsInfo, sets).AsErr(); err != nil {
+		return err
+	}
+	for class, capacity := range heap.capacity {
+		if capacity > 0 {
+			heap.sets[class], sets = sets[0], sets[1:]
+		}
+	}
+	return nil
+}
+
+// SetLayouts returns the descriptor set layouts of the classes with a
+// capacity, in class order, for the pipeline layouts using the heap.
+func (heap *BindlessHeap) SetLayouts() []DescriptorSetLayout {
+	var layouts []DescriptorSetLayout
+	for class, capacity := range heap.capacity {
+		if capacity > 0 {
+			layouts = append(layouts, heap.layouts[class])
+		}
+	}
+	return layouts
+}
+
+// CreatePipelineLayout creates a pipeline layout with the sets of the heap
+// starting at set 0, and pushConstantSize bytes of push constants for the
+// heap stages. The caller destroys the layout.
+func (heap *BindlessHeap) CreatePipelineLayout(pushConstantSize uint32) (PipelineLayout, error) {
+	arp := NewAutoReleaser()
+	defer arp.Release()
+
+	plInfo := &PipelineLayoutCreateInfo{}
+	plInfo.SetDefaultSType()
+	plInfo.PinPSetLayouts(arp, heap.SetLayouts())
+	if pushConstantSize > 0 {
+		ranges := make([]PushConstantRange, 1)
+		ranges[0].SetStageFlags(heap.stages)
+		ranges[0].SetSize(pushConstantSize)
+		plInfo.PinPPushConstantRanges(arp, ranges)
+	}
+	var layout PipelineLayout
+	if err := heap.device.CreatePipelineLayout(plInfo, nil, &layout).AsErr(); err != nil {
+		return NullPipelineLayout, err
+	}
+	return layout, nil
+}
+
+// CmdBind binds the sets of the heap, starting at firstSet. Once per command
+// buffer and bind point is enough: the sets stay valid while descriptors are
+// added and released.
+func (heap *BindlessHeap) CmdBind(cmd CommandBufferFacade, bindPoint PipelineBindPoint, layout PipelineLayout, firstSet uint32) {
+	var sets [bindlessClasses]DescriptorSet
+	n := 0
+	for class, capacity := range heap.capacity {
+		if capacity > 0 {
+			sets[n] = heap.sets[class]
+			n++
+		}
+	}
+	cmd.CmdBindDescriptorSets(bindPoint, layout, firstSet, uint32(n), sets[:n], 0, nil)
+}
+
+// CmdPushIndices pushes the indices as push constants at offset, for the
+// heap stages.
+func (heap *BindlessHeap) CmdPushIndices(cmd CommandBufferFacade, layout PipelineLayout, offset uint32, indices []uint32) {
+	if len(indices) > 0 {
+		cmd.CmdPushConstants(layout, heap.stages, offset, uint32(4*len(indices)), unsafe.Pointer(&indices[0]))
+	}
+}
+
+// AddSampledImage adds a sampled image view to the heap and returns its
+// index. layout is the layout of the image when the shaders read it.
+func (heap *BindlessHeap) AddSampledImage(view ImageView, layout ImageLayout) (uint32, error) {
+	info := DescriptorImageInfo{}.
+		WithImageView(view).
+		WithImageLayout(layout)
+	return heap.addImage(BindlessSampledImages, info)
+}
+
+// AddStorageImage adds a storage image view to the heap and returns its
+// index. layout is usually VK_IMAGE_LAYOUT_GENERAL.
+func (heap *BindlessHeap) AddStorageImage(view ImageView, layout ImageLayout) (uint32, error) {
+	info := DescriptorImageInfo{}.
+		WithImageView(view).
+		WithImageLayout(layout)
+	return heap.addImage(BindlessStorageImages, info)
+}
+
+// AddSampler adds a sampler to the heap and returns its index.
+func (heap *BindlessHeap) AddSampler(sampler Sampler) (uint32, error) {
+	info := DescriptorImageInfo{}.WithSampler(sampler)
+	return heap.addImage(BindlessSamplers, info)
+}
+
+// AddStorageBuffer adds a range of a storage buffer to the heap and returns
+// its index. size may be VK_WHOLE_SIZE.
+func (heap *BindlessHeap) AddStorageBuffer(buffer Buffer, offset, size DeviceSize) (uint32, error) {
+	return heap.addBuffer(BindlessStorageBuffers, buffer, offset, size)
+}
+
+// AddUniformBuffer adds a range of a uniform buffer to the heap and returns
+// its index. size may be VK_WHOLE_SIZE.
+func (heap *BindlessHeap) AddUniformBuffer(buffer Buffer, offset, size DeviceSize) (uint32, error) {
+	return heap.addBuffer(BindlessUniformBuffers, buffer, offset, size)
+}
+
+func (heap *BindlessHeap) addImage(class BindlessClass, info DescriptorImageInfo) (uint32, error) {
+	index, err := heap.alloc(class)
+	if err != nil {
+		return 0, err
+	}
+	heap.queueWrite(class, index, len(heap.imageInfos))
+	heap.imageInfos = append(heap.imageInfos, info)
+	return index, nil
+}
+
+func (heap *BindlessHeap) addBuffer(class BindlessClass, buffer Buffer, offset, size DeviceSize) (uint32, error) {
+	index, err := heap.alloc(class)
+	if err != nil {
+		return 0, err
+	}
+	heap.queueWrite(class, index, len(heap.bufferInfos))
+	info := DescriptorBufferInfo{}.
+		WithBuffer(buffer).
+		WithOffset(offset).
+		WithRange_(size)
+	heap.bufferInfos = append(heap.bufferInfos, info)
+	return index, nil
+}
+
+func (heap *BindlessHeap) queueWrite(class BindlessClass, index uint32, info int) {
+	write := WriteDescriptorSet{}.
+		WithDefaultSType().
+		WithDstSet(heap.sets[class]).
+		WithDstArrayElement(index).
+		WithDescriptorCount(1).
+		WithDescriptorType(bindlessDescriptorTypes[class])
+	heap.writes = append(heap.writes, write)
+	heap.infoIndex = append(heap.infoIndex, info)
+}
+
+// alloc hands out a free index of the class, recycling the indices released
+// by completed frames when the free list is empty.
+func (heap *BindlessHeap) alloc(class BindlessClass) (uint32, error) {
+	if heap.capacity[class] == 0 {
+		return 0, fmt.Errorf("error: bindless heap has no %v capacity", bindlessDescriptorTypes[class])
+	}
+	if len(heap.free[class]) == 0 && heap.next[class] == heap.capacity[class] {
+		heap.recycle()
+	}
+	if n := len(heap.free[class]); n > 0 {
+		index := heap.free[class][n-1]
+		heap.free[class] = heap.free[class][:n-1]
+		heap.live[class][index] = true
+		return index, nil
+	}
+	if heap.next[class] < heap.capacity[class] {
+		index := heap.next[class]
+		heap.next[class]++
+		heap.live[class][index] = true
+		return index, nil
+	}
+	return 0, fmt.Errorf("error: bindless heap is out of %v descriptors", bindlessDescriptorTypes[class])
+}
+
+// Release returns the index of the class to the heap. The index is reused
+// once the frame submitted after the next EndFrame completes, so work already
+// recorded may keep reading it. Indices the heap did not hand out, or already
+// released, are rejected.
+func (heap *BindlessHeap) Release(class BindlessClass, index uint32) error {
+	if class < 0 || class >= bindlessClasses || index >= uint32(len(heap.live[class])) {
+		return fmt.Errorf("error: bindless heap has no index %d of class %d", index, class)
+	}
+	if !heap.live[class][index] {
+		return fmt.Errorf("error: bindless heap index %d of %v is not in use", index, bindlessDescriptorTypes[class])
+	}
+	heap.live[class][index] = false
+	heap.releasing = append(heap.releasing, bindlessSlot{class, index})
+	return nil
+}
+
+// recycle moves the slots of the completed frames, in release order, to the
+// free lists. It does not wait.
+func (heap *BindlessHeap) recycle() {
+	done := 0
+	for _, retired := range heap.retired {
+		if retired.fence != NullFence {
+			if heap.device.GetFenceStatus(retired.fence) != VK_SUCCESS {
+				break
+			}
+		} else {
+			var value uint64
+			if heap.device.GetSemaphoreCounterValue(retired.semaphore, &value) != VK_SUCCESS || value < retired.value {
+				break
+			}
+		}
+		for _, slot := range retired.slots {
+			heap.free[slot.class] = append(heap.free[slot.class], slot.index)
+		}
+		done++
+	}
+	heap.retired = append(heap.retired[:0], heap.retired[done:]...)
+}
+
+// Flush applies the pending descriptor writes with one UpdateDescriptorSets
+// call. The descriptors added since the last Flush must not be used by work
+// submitted before it.
+func (heap *BindlessHeap) Flush() {
+	if len(heap.writes) == 0 {
+		return
+	}
+	arp := NewAutoReleaser()
+	defer arp.Release()
+	for h := range heap.writes {
+		k := heap.infoIndex[h]
+		switch heap.writes[h].DescriptorType() {
+		case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
+			heap.writes[h].PinPBufferInfo(arp, heap.bufferInfos[k:k+1])
+		default:
+			heap.writes[h].PinPImageInfo(arp, heap.imageInfos[k:k+1])
+		}
+	}
+	heap.device.UpdateDescriptorSets(uint32(len(heap.writes)), heap.writes, 0, nil)
+	// cgo checks the whole backing array of the writes, so the spare
+	// capacity must not keep the pointers of this call.
+	clear(heap.writes)
+	heap.writes = heap.writes[:0]
+	heap.imageInfos = heap.imageInfos[:0]
+	heap.bufferInfos = heap.bufferInfos[:0]
+	heap.infoIndex = heap.infoIndex[:0]
+}
+
+// EndFrame flushes the pending writes and records the fence signaled when
+// the device is done with the frame; the indices released since the last
+// EndFrame are recycled once the fence is observed signaled. EndFrame must be
+// called before the frame is submitted.
+func (heap *BindlessHeap) EndFrame(fence Fence) {
+	heap.endFrame(bindlessRetired{fence: fence})
+}
+
+// EndFrameTimeline is EndFrame with a timeline semaphore value reached when
+// the device is done with the frame.
+func (heap *BindlessHeap) EndFrameTimeline(semaphore Semaphore, value uint64) {
+	heap.endFrame(bindlessRetired{semaphore: semaphore, value: value})
+}
+
+func (heap *BindlessHeap) endFrame(retired bindlessRetired) {
+	heap.Flush()
+	if len(heap.releasing) > 0 {
+		retired.slots = heap.releasing
+		heap.retired = append(heap.retired, retired)
+		heap.releasing = nil
+	}
+	heap.recycle()
+}
+
+// Destroy destroys the pool, sets and layouts of the heap. No work using the
+// heap may be pending.
+func (heap *BindlessHeap) Destroy() {
+	heap.device.DestroyDescriptorPool(heap.pool, nil)
+	for _, layout := range heap.layouts {
+		heap.device.DestroyDescriptorSetLayout(layout, nil)
+	}
+	*heap = BindlessHeap{}
+}
+
+// BufferAddress returns the device address of the buffer, for shaders
+// reading it through buffer references. The buffer must be created with
+// VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT and bound to memory allocated
+// with VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT, on a device with the
+// bufferDeviceAddress feature enabled.
+func (device DeviceFacade) BufferAddress(buffer Buffer) DeviceAddress {
+	info := BufferDeviceAddressInfo{}.
+		WithDefaultSType().
+		WithBuffer(buffer)
+	return device.GetBufferDeviceAddress(&info)
+}
@@ -0,0 +1,93 @@
+//go:build !vks_no_version_1_3 && !vks_no_version_1_1 && !vks_no_version_1_2
+
+package vks
+
+import "testing"
+
+// nullBindlessHeap creates a heap of samplers and storage buffers on the
+// null driver, which reports neither the descriptor indexing features nor
+// the limits; they are set on its capabilities.
+func nullBindlessHeap(t *testing.T, capacity uint32) *BindlessHeap {
+	pd := nullPhysicalDevice(t)
+	device := nullDeviceOf(t, pd)
+	caps := QueryDeviceCapabilities(pd)
+	features := &caps.Vulkan12Features
+	features.SetRuntimeDescriptorArray(VK_TRUE)
+	features.SetDescriptorBindingPartiallyBound(VK_TRUE)
+	features.SetDescriptorBindingVariableDescriptorCount(VK_TRUE)
+	features.SetDescriptorBindingUpdateUnusedWhilePending(VK_TRUE)
+	features.SetDescriptorBindingStorageBufferUpdateAfterBind(VK_TRUE)
+	props := &caps.Vulkan12Properties
+	props.maxDescriptorSetUpdateAfterBindSamplers = 1 << 20
+	props.maxPerStageDescriptorUpdateAfterBindSamplers = 1 << 20
+	props.maxDescriptorSetUpdateAfterBindStorageBuffers = 1 << 20
+	props.maxPerStageDescriptorUpdateAfterBindStorageBuffers = 1 << 20
+	props.maxPerStageUpdateAfterBindResources = 1 << 20
+
+	var config BindlessHeapConfig
+	config.Capacity[BindlessSamplers] = capacity
+	config.Capacity[BindlessStorageBuffers] = capacity
+	heap, err := NewBindlessHeap(device, caps, config)
+	if err != nil {
+		t.Fatal(err)
+	}
+	t.Cleanup(heap.Destroy)
+	return heap
+}
+
+func TestBindlessHeapSlots(t *testing.T) {
+	heap := nullBindlessHeap(t, 4)
+	if n := len(heap.SetLayouts()); n != 2 {
+		t.Fatalf("heap has %d set layouts, want 2", n)
+	}
+	var indices []uint32
+	for k := 0; k < 4; k++ {
+		index, err := heap.AddSampler(NullSampler)
+		if err != nil {
+			t.Fatal(err)
+		}
+		indices = append(indices, index)
+	}
+	if _, err := heap.AddSampler(NullSampler); err == nil {
+		t.Error("added a sampler beyond the capacity")
+	}
+	if _, err := heap.AddSampledImage(NullImageView, VK_IMAGE_LAYOUT_GENERAL); err == nil {
+		t.Error("added a sampled image without capacity")
+	}
+	// The classes have their own indices.
+	if index, err := heap.AddStorageBuffer(NullBuffer, 0, DeviceSize(VK_WHOLE_SIZE)); err != nil || index != 0 {
+		t.Errorf("AddStorageBuffer returned %d, %v, want 0", index, err)
+	}
+
+	if err := heap.Release(BindlessSamplers, indices[1]); err != nil {
+		t.Fatal(err)
+	}
+	for _, c := range []struct {
+		class BindlessClass
+		index uint32
+	}{
+		{BindlessSamplers, indices[1]}, // Already released.
+		{BindlessSamplers, 4},          // Out of range.
+		{BindlessStorageBuffers, 1},    // Never handed out.
+		{BindlessSampledImages, 0},     // No capacity.
+		{bindlessClasses, 0},
+		{-1, 0},
+	} {
+		if err := heap.Release(c.class, c.index); err == nil {
+			t.Errorf("released index %d of class %d", c.index, c.class)
+		}
+	}
+
+	// The index is only reused after the frame releasing it completes.
+	if _, err := heap.AddSampler(NullSampler); err == nil {
+		t.Error("reused a released index before EndFrame")
+	}
+	heap.EndFrame(NullFence)
+	index, err := heap.AddSampler(NullSampler)
+	if err != nil || index != indices[1] {
+		t.Errorf("AddSampler returned %d, %v after EndFrame, want %d", index, err, indices[1])
+	}
+	if err := heap.Release(BindlessSamplers, index); err != nil {
+		t.Errorf("releasing a reused index: %v", err)
+	}
+}
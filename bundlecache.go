@@ -0,0 +1,386 @@
+//go:build !vks_no_version_1_3 && !vks_no_version_1_1 && !vks_no_version_1_2
+
+package vks
+
+import (
+	"encoding/binary"
+	"sync"
+	"unsafe"
+)
+
+// bundleHandle is a handle referenced by a bundle. Non-dispatchable handles
+// are only unique per object type.
+type bundleHandle struct {
+	objectType ObjectType
+	handle     uint64
+}
+
+// BundleKey identifies a command bundle by the inputs of its commands: the
+// pipeline, descriptor sets, vertex and index buffers, dynamic state and
+// anything else the commands depend on. Every input is appended in order, so
+// the same inputs added in another order make another key. The handles added
+// to the key are the handles whose destruction invalidates the bundle.
+//
+// A BundleKey can be reused for another bundle after Reset, without
+// allocating.
+type BundleKey struct {
+	data    []byte
+	handles []bundleHandle
+
+	renderPass    RenderPass
+	subpass       uint32
+	framebuffer   Framebuffer
+	rendering     bool
+	colorFormats  []Format
+	depthFormat   Format
+	stencilFormat Format
+	samples       SampleCountFlagBits
+}
+
+// Input tags, so inputs of different kinds never make the same bytes.
+const (
+	bundleTagHandle byte = iota + 1
+	bundleTagRenderPass
+	bundleTagRendering
+	bundleTagVertexBuffer
+	bundleTagIndexBuffer
+	bundleTagBytes
+	bundleTagUint32
+)
+
+// Reset empties the key.
+func (key *BundleKey) Reset() *BundleKey {
+	key.data = key.data[:0]
+	key.handles = key.handles[:0]
+	key.renderPass = NullRenderPass
+	key.subpass = 0
+	key.framebuffer = NullFramebuffer
+	key.rendering = false
+	key.colorFormats = key.colorFormats[:0]
+	key.depthFormat = VK_FORMAT_UNDEFINED
+	key.stencilFormat = VK_FORMAT_UNDEFINED
+	key.samples = 0
+	return key
+}
+
+func (key *BundleKey) appendUint64(tag byte, v uint64) {
+	key.data = append(key.data, tag)
+	key.data = binary.LittleEndian.AppendUint64(key.data, v)
+}
+
+// Handle adds a handle the commands reference, like an image, a query pool or
+// an acceleration structure. Destroying the handle invalidates the bundle.
+func (key *BundleKey) Handle(objectType ObjectType, handle uint64) *BundleKey {
+	key.data = append(key.data, bundleTagHandle)
+	key.data = binary.LittleEndian.AppendUint32(key.data, uint32(objectType))
+	key.data = binary.LittleEndian.AppendUint64(key.data, handle)
+	key.handles = append(key.handles, bundleHandle{objectType, handle})
+	return key
+}
+
+// Pipeline adds a bound pipeline.
+func (key *BundleKey) Pipeline(pipeline Pipeline) *BundleKey {
+	return key.Handle(VK_OBJECT_TYPE_PIPELINE, uint64(uintptr(unsafe.Pointer(pipeline))))
+}
+
+// PipelineLayout adds the layout of bound descriptor sets or push constants.
+func (key *BundleKey) PipelineLayout(layout PipelineLayout) *BundleKey {
+	return key.Handle(VK_OBJECT_TYPE_PIPELINE_LAYOUT, uint64(uintptr(unsafe.Pointer(layout))))
+}
+
+// DescriptorSets adds bound descriptor sets and the pool they were allocated
+// from, so freeing the sets, or resetting or destroying the pool, invalidates
+// the bundle. Updating the sets does not; descriptors written after the
+// recording are only used if the layout allows updates after bind.
+func (key *BundleKey) DescriptorSets(pool DescriptorPool, firstSet uint32, sets []DescriptorSet) *BundleKey {
+	key.Handle(VK_OBJECT_TYPE_DESCRIPTOR_POOL, uint64(uintptr(unsafe.Pointer(pool))))
+	key.Uint32(firstSet)
+	for _, set := range sets {
+		key.Handle(VK_OBJECT_TYPE_DESCRIPTOR_SET, uint64(uintptr(unsafe.Pointer(set))))
+	}
+	return key
+}
+
+// VertexBuffers adds bound vertex buffers and their offsets.
+func (key *BundleKey) VertexBuffers(firstBinding uint32, buffers []Buffer, offsets []DeviceSize) *BundleKey {
+	key.Uint32(firstBinding)
+	for k, buffer := range buffers {
+		key.Handle(VK_OBJECT_TYPE_BUFFER, uint64(uintptr(unsafe.Pointer(buffer))))
+		if k < len(offsets) {
+			key.appendUint64(bundleTagVertexBuffer, uint64(offsets[k]))
+		}
+	}
+	return key
+}
+
+// IndexBuffer adds a bound index buffer.
+func (key *BundleKey) IndexBuffer(buffer Buffer, offset DeviceSize, indexType IndexType) *BundleKey {
+	key.Handle(VK_OBJECT_TYPE_BUFFER, uint64(uintptr(unsafe.Pointer(buffer))))
+	key.appendUint64(bundleTagIndexBuffer, uint64(offset)<<8|uint64(uint8(indexType)))
+	return key
+}
+
+// Bytes adds raw inputs: viewports and scissors, push constants, draw
+// parameters, or any other state the commands depend on.
+func (key *BundleKey) Bytes(data []byte) *BundleKey {
+	key.data = append(key.data, bundleTagBytes)
+	key.data = binary.LittleEndian.AppendUint32(key.data, uint32(len(data)))
+	key.data = append(key.data, data...)
+	return key
+}
+
+// Uint32 adds integer inputs, like draw counts or dynamic offsets.
+func (key *BundleKey) Uint32(values ...uint32) *BundleKey {
+	for _, v := range values {
+		key.data = append(key.data, bundleTagUint32)
+		key.data = binary.LittleEndian.AppendUint32(key.data, v)
+	}
+	return key
+}
+
+// RenderPass records the bundle for the subpass of renderPass. framebuffer is
+// optional; when set, the bundle is only valid in that framebuffer, but some
+// implementations record faster commands.
+func (key *BundleKey) RenderPass(renderPass RenderPass, subpass uint32, framebuffer Framebuffer) *BundleKey {
+	key.renderPass, key.subpass, key.framebuffer = renderPass, subpass, framebuffer
+	key.Handle(VK_OBJECT_TYPE_RENDER_PASS, uint64(uintptr(unsafe.Pointer(renderPass))))
+	if framebuffer != NullFramebuffer {
+		key.Handle(VK_OBJECT_TYPE_FRAMEBUFFER, uint64(uintptr(unsafe.Pointer(framebuffer))))
+	}
+	key.appendUint64(bundleTagRenderPass, uint64(subpass))
+	return key
+}
+
+// Rendering records the bundle for dynamic rendering instances begun with
+// VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT and the attachment
+// formats.
+func (key *BundleKey) Rendering(colorFormats []Format, depthFormat, stencilFormat Format, samples SampleCountFlagBits) *BundleKey {
+	key.rendering = true
+	key.colorFormats = append(key.colorFormats[:0], colorFormats...)
+	key.depthFormat, key.stencilFormat, key.samples = depthFormat, stencilFormat, samples
+	key.data = append(key.data, bundleTagRendering)
+	key.Uint32(uint32(depthFormat), uint32(stencilFormat), uint32(samples))
+	for _, format := range colorFormats {
+		key.Uint32(uint32(format))
+	}
+	return key
+}
+
+// bundle is a recorded secondary command buffer.
+type bundle struct {
+	key     string
+	cmd     CommandBuffer
+	handles []bundleHandle
+}
+
+// BundleCache records static command sequences once into secondary command
+// buffers and replays them with vkCmdExecuteCommands. The command buffers are
+// recorded without ONE_TIME_SUBMIT, so they can be executed in any number of
+// primary command buffers, but not twice in a pending primary command buffer,
+// as they are not SIMULTANEOUS_USE either.
+//
+// A bundle is invalidated when any handle of its key is destroyed or freed
+// through a DeviceFacade; the next Execute records it again. The command
+// buffers of invalidated bundles are reused for new bundles. Handles must not
+// be destroyed while primary command buffers executing bundles that reference
+// them are pending, as for any other command.
+//
+// Execute, Invalidate and Destroy must be called from one goroutine at a
+// time; handles can be destroyed from any goroutine.
+type BundleCache struct {
+	device DeviceFacade
+	pool   CommandPoolFacade
+	remove func()
+
+	lock     sync.Mutex
+	bundles  map[string]*bundle
+	byHandle map[bundleHandle][]*bundle
+	spare    []CommandBuffer
+}
+
+// NewBundleCache creates a bundle cache recording secondary command buffers
+// for primary command buffers of the queue family.
+func NewBundleCache(device DeviceFacade, family uint32) (*BundleCache, error) {
+	info := &CommandPoolCreateInfo{}
+	info.SetDefaultSType()
+	info.SetFlags(CommandPoolCreateFlags(VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT))
+	info.SetQueueFamilyIndex(family)
+	var pool CommandPool
+	if err := device.CreateCommandPool(info, nil, &pool).AsErr(); err != nil {
+		return nil, err
+	}
+	cache := &BundleCache{
+		device:   device,
+		pool:     device.MakeCommandPoolFacade(pool),
+		bundles:  make(map[string]*bundle),
+		byHandle: make(map[bundleHandle][]*bundle),
+	}
+	cache.remove = OnHandleDestroyed(cache.handleDestroyed)
+	return cache, nil
+}
+
+// Len returns the number of valid bundles.
+func (cache *BundleCache) Len() int {
+	cache.lock.Lock()
+	defer cache.lock.Unlock()
+	return len(cache.bundles)
+}
+
+// Execute executes the bundle of key in cmd, a primary command buffer in the
+// render pass or the dynamic rendering instance of the key. When the key has
+// no valid bundle, record is called to record the commands of the bundle in
+// a new secondary command buffer first. record must only use the inputs added
+// to the key; the commands are not recorded again when other state changes.
+func (cache *BundleCache) Execute(cmd CommandBufferFacade, key *BundleKey, record func(CommandBufferFacade)) error {
+	cache.lock.Lock()
+	b := cache.bundles[string(key.data)]
+	cache.lock.Unlock()
+	if b == nil {
+		var err error
+		if b, err = cache.record(key, record); err != nil {
+			return err
+		}
+	}
+	cmds := [1]CommandBuffer{b.cmd}
+	cmd.CmdExecuteCommands(1, cmds[:])
+	return nil
+}
+
+// record records a new bundle for the key.
+func (cache *BundleCache) record(key *BundleKey, record func(CommandBufferFacade)) (*bundle, error) {
+	cache.lock.Lock()
+	var handle CommandBuffer
+	if n := len(cache.spare); n > 0 {
+		handle = cache.spare[n-1]
+		cache.spare = cache.spare[:n-1]
+	}
+	cache.lock.Unlock()
+	if handle == nil {
+		info := &CommandBufferAllocateInfo{}
+		info.SetDefaultSType()
+		info.SetCommandPool(cache.pool.H)
+		info.SetLevel(VK_COMMAND_BUFFER_LEVEL_SECONDARY)
+		info.SetCommandBufferCount(1)
+		handles := make([]CommandBuffer, 1)
+		if err := cache.device.AllocateCommandBuffers(info, handles).AsErr(); err != nil {
+			return nil, err
+		}
+		handle = handles[0]
+	}
+
+	arp := NewAutoReleaser()
+	defer arp.Release()
+
+	inheritance := &CommandBufferInheritanceInfo{}
+	inheritance.SetDefaultSType()
+	var usage CommandBufferUsageFlags
+	if key.renderPass != NullRenderPass {
+		usage |= CommandBufferUsageFlags(VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT)
+		inheritance.SetRenderPass(key.renderPass)
+		inheritance.SetSubpass(key.subpass)
+		inheritance.SetFramebuffer(key.framebuffer)
+	} else if key.rendering {
+		usage |= CommandBufferUsageFlags(VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT)
+		rendering := &CommandBufferInheritanceRenderingInfo{}
+		rendering.SetDefaultSType()
+		rendering.PinPColorAttachmentFormats(arp, key.colorFormats)
+		rendering.SetDepthAttachmentFormat(key.depthFormat)
+		rendering.SetStencilAttachmentFormat(key.stencilFormat)
+		samples := key.samples
+		if samples == 0 {
+			samples = VK_SAMPLE_COUNT_1_BIT
+		}
+		rendering.SetRasterizationSamples(samples)
+		inheritance.PinPNext(arp, unsafe.Pointer(rendering))
+	}
+	begin := &CommandBufferBeginInfo{}
+	begin.SetDefaultSType()
+	begin.SetFlags(usage)
+	begin.PinPInheritanceInfo(arp, inheritance)
+
+	// The pool resets the command buffers of invalidated bundles on begin.
+	cmd := cache.pool.MakeCommandBufferFacade(handle)
+	if err := cmd.BeginCommandBuffer(begin).AsErr(); err != nil {
+		cache.reuse(handle)
+		return nil, err
+	}
+	record(cmd)
+	if err := cmd.EndCommandBuffer().AsErr(); err != nil {
+		cache.reuse(handle)
+		return nil, err
+	}
+
+	b := &bundle{
+		key:     string(key.data),
+		cmd:     handle,
+		handles: append([]bundleHandle(nil), key.handles...),
+	}
+	cache.lock.Lock()
+	defer cache.lock.Unlock()
+	if old := cache.bundles[b.key]; old != nil {
+		cache.invalidate(old)
+	}
+	cache.bundles[b.key] = b
+	for _, h := range b.handles {
+		cache.byHandle[h] = append(cache.byHandle[h], b)
+	}
+	return b, nil
+}
+
+func (cache *BundleCache) reuse(handle CommandBuffer) {
+	cache.lock.Lock()
+	cache.spare = append(cache.spare, handle)
+	cache.lock.Unlock()
+}
+
+// Invalidate drops the bundle of the key, so the next Execute records it
+// again. The bundle must not be pending in a primary command buffer.
+func (cache *BundleCache) Invalidate(key *BundleKey) {
+	cache.lock.Lock()
+	defer cache.lock.Unlock()
+	if b := cache.bundles[string(key.data)]; b != nil {
+		cache.invalidate(b)
+	}
+}
+
+// invalidate drops b and keeps its command buffer for new bundles. The lock
+// must be held.
+func (cache *BundleCache) invalidate(b *bundle) {
+	delete(cache.bundles, b.key)
+	for _, h := range b.handles {
+		list := cache.byHandle[h]
+		for k := range list {
+			if list[k] == b {
+				list[k] = list[len(list)-1]
+				list[len(list)-1] = nil
+				list = list[:len(list)-1]
+				break
+			}
+		}
+		if len(list) == 0 {
+			delete(cache.byHandle, h)
+		} else {
+			cache.byHandle[h] = list
+		}
+	}
+	cache.spare = append(cache.spare, b.cmd)
+}
+
+func (cache *BundleCache) handleDestroyed(objectType ObjectType, handle uint64) {
+	cache.lock.Lock()
+	defer cache.lock.Unlock()
+	h := bundleHandle{objectType, handle}
+	for len(cache.byHandle[h]) > 0 {
+		cache.invalidate(cache.byHandle[h][0])
+	}
+}
+
+// Destroy destroys the command buffers of the cache. The bundles must not be
+// pending in primary command buffers.
+func (cache *BundleCache) Destroy() {
+	cache.remove()
+	cache.device.DestroyCommandPool(cache.pool.H, nil)
+	cache.bundles = nil
+	cache.byHandle = nil
+	cache.spare = nil
+}
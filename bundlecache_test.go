@@ -0,0 +1,82 @@
+//go:build !vks_no_version_1_3 && !vks_no_version_1_1 && !vks_no_version_1_2
+
+package vks
+
+import (
+	"testing"
+	"unsafe"
+)
+
+func TestBundleCacheInvalidation(t *testing.T) {
+	device, cmd := nullCommandBuffer(t)
+	cache, err := NewBundleCache(device, 0)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer cache.Destroy()
+
+	arp := NewAutoReleaser()
+	defer arp.Release()
+	pipelines := make([]Pipeline, 2)
+	if err := device.CreateComputePipelines(NullPipelineCache, 2, make([]ComputePipelineCreateInfo, 2), nil, pipelines).AsErr(); err != nil {
+		t.Fatal(err)
+	}
+	defer device.DestroyPipeline(pipelines[1], nil)
+	var pool DescriptorPool
+	if err := device.CreateDescriptorPool(CPtr(arp, &DescriptorPoolCreateInfo{}, SetDefaultSType), nil, &pool).AsErr(); err != nil {
+		t.Fatal(err)
+	}
+	defer device.DestroyDescriptorPool(pool, nil)
+	info := CPtr(arp, &DescriptorSetAllocateInfo{}, SetDefaultSType)
+	info.SetDescriptorPool(pool)
+	info.SetDescriptorSetCount(2)
+	sets := make([]DescriptorSet, 2)
+	if err := device.AllocateDescriptorSets(info, sets).AsErr(); err != nil {
+		t.Fatal(err)
+	}
+
+	recorded := 0
+	execute := func(key *BundleKey) {
+		if err := cache.Execute(cmd, key, func(CommandBufferFacade) { recorded++ }); err != nil {
+			t.Fatal(err)
+		}
+	}
+	var first, second, third BundleKey
+	first.Pipeline(pipelines[0])
+	second.Pipeline(pipelines[1])
+	third.Handle(VK_OBJECT_TYPE_DESCRIPTOR_SET, uint64(uintptr(unsafe.Pointer(sets[1]))))
+	for k := 0; k < 3; k++ {
+		execute(&first)
+		execute(&second)
+		execute(&third)
+	}
+	if recorded != 3 || cache.Len() != 3 {
+		t.Fatalf("recorded %d bundles, %d valid, want 3 and 3", recorded, cache.Len())
+	}
+
+	device.DestroyPipeline(pipelines[0], nil)
+	if cache.Len() != 2 {
+		t.Errorf("%d valid bundles after destroying a pipeline, want 2", cache.Len())
+	}
+	execute(&first)
+	execute(&second)
+	if recorded != 4 {
+		t.Errorf("recorded %d bundles, want 4", recorded)
+	}
+
+	// Only the sets within the count are freed.
+	device.FreeDescriptorSets(pool, 1, sets)
+	if cache.Len() != 3 {
+		t.Errorf("%d valid bundles after freeing another set, want 3", cache.Len())
+	}
+	device.FreeDescriptorSets(pool, 1, sets[1:])
+	if cache.Len() != 2 {
+		t.Errorf("%d valid bundles after freeing a referenced set, want 2", cache.Len())
+	}
+
+	cache.Invalidate(&second)
+	execute(&second)
+	if recorded != 5 || cache.Len() != 2 {
+		t.Errorf("recorded %d bundles, %d valid, want 5 and 2", recorded, cache.Len())
+	}
+}
@@ -0,0 +1,420 @@
+//go:build !vks_no_version_1_3 && !vks_no_version_1_1 && !vks_no_version_1_2
+
+package vks
+
+/*
+#include "vk_wrapper.h"
+
+// Fills the format table with a single cgo call. The image limits are the ones
+// of a 2D optimally tiled image with every usage the format features allow.
+static void vksQueryFormats(vksProcAddr* addrs, VkPhysicalDevice pd, uint32_t count, const VkFormat* formats, int properties3, VkFormatProperties3* features, VkImageFormatProperties* images, VkResult* results) {
+	for (uint32_t i = 0; i < count; i++) {
+		VkFormatProperties3 props3 = { VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3 };
+		VkFormatProperties2 props2 = { VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2, properties3 ? &props3 : NULL };
+		vkGetPhysicalDeviceFormatProperties2(addrs, pd, formats[i], &props2);
+		if (!properties3) {
+			props3.linearTilingFeatures = props2.formatProperties.linearTilingFeatures;
+			props3.optimalTilingFeatures = props2.formatProperties.optimalTilingFeatures;
+			props3.bufferFeatures = props2.formatProperties.bufferFeatures;
+		}
+		props3.pNext = NULL;
+		features[i] = props3;
+
+		VkFormatFeatureFlags2 optimal = props3.optimalTilingFeatures;
+		VkImageUsageFlags usage = 0;
+		usage |= optimal & VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_BIT ? VK_IMAGE_USAGE_SAMPLED_BIT : 0;
+		usage |= optimal & VK_FORMAT_FEATURE_2_STORAGE_IMAGE_BIT ? VK_IMAGE_USAGE_STORAGE_BIT : 0;
+		usage |= optimal & VK_FORMAT_FEATURE_2_COLOR_ATTACHMENT_BIT ? VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT : 0;
+		usage |= optimal & VK_FORMAT_FEATURE_2_DEPTH_STENCIL_ATTACHMENT_BIT ? VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT : 0;
+		usage |= optimal & VK_FORMAT_FEATURE_2_TRANSFER_SRC_BIT ? VK_IMAGE_USAGE_TRANSFER_SRC_BIT : 0;
+		usage |= optimal & VK_FORMAT_FEATURE_2_TRANSFER_DST_BIT ? VK_IMAGE_USAGE_TRANSFER_DST_BIT : 0;
+		memset(&images[i], 0, sizeof(VkImageFormatProperties));
+		results[i] = VK_ERROR_FORMAT_NOT_SUPPORTED;
+		if (usage != 0) {
+			VkPhysicalDeviceImageFormatInfo2 info = { VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2, NULL, formats[i], VK_IMAGE_TYPE_2D, VK_IMAGE_TILING_OPTIMAL, usage, 0 };
+			VkImageFormatProperties2 image = { VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2 };
+			results[i] = vkGetPhysicalDeviceImageFormatProperties2(addrs, pd, &info, &image);
+			images[i] = image.imageFormatProperties;
+		}
+	}
+}
+*/
+import "C"
+import (
+	"bufio"
+	"bytes"
+	"encoding/binary"
+	"fmt"
+	"io"
+	"os"
+	"path/filepath"
+	"unsafe"
+)
+
+// FormatCapabilities are the features of a format, and the limits of a 2D
+// optimally tiled image of the format created with every usage its optimal
+// tiling features allow.
+type FormatCapabilities struct {
+	LinearTilingFeatures  FormatFeatureFlags2
+	OptimalTilingFeatures FormatFeatureFlags2
+	BufferFeatures        FormatFeatureFlags2
+	Image                 ImageFormatProperties
+	ImageSupported        bool // False when Image does not hold valid limits.
+}
+
+// formatRanges are the runs of consecutive Format values known to the
+// binding, with the Vulkan 1.x minor version that made them core. The format
+// table stores them back to back, so a Format is mapped to its entry by
+// walking this fixed list. Ranges newer than the device are not queried and
+// keep zero entries.
+var formatRanges = [...]struct {
+	first, last Format
+	minor       uint32
+}{
+	{VK_FORMAT_UNDEFINED, VK_FORMAT_ASTC_12x12_SRGB_BLOCK, 0},
+	{VK_FORMAT_G8B8G8R8_422_UNORM, VK_FORMAT_G16_B16_R16_3PLANE_444_UNORM, 1},
+	{VK_FORMAT_G8_B8R8_2PLANE_444_UNORM, VK_FORMAT_G16_B16R16_2PLANE_444_UNORM, 3},
+	{VK_FORMAT_A4R4G4B4_UNORM_PACK16, VK_FORMAT_A4B4G4R4_UNORM_PACK16, 3},
+	{VK_FORMAT_ASTC_4x4_SFLOAT_BLOCK, VK_FORMAT_ASTC_12x12_SFLOAT_BLOCK, 3},
+}
+
+func formatSlot(format Format) int {
+	base := 0
+	for _, r := range formatRanges {
+		if format >= r.first && format <= r.last {
+			return base + int(format-r.first)
+		}
+		base += int(r.last-r.first) + 1
+	}
+	return -1
+}
+
+func formatCount() int {
+	n := 0
+	for _, r := range formatRanges {
+		n += int(r.last-r.first) + 1
+	}
+	return n
+}
+
+// DeviceCapabilities is a snapshot of everything a program usually queries
+// about a physical device before picking it and creating the device. The
+// Vulkan11, Vulkan12 and Vulkan13 structs are only filled when the device
+// supports that version. The pNext members of the snapshot are always nil.
+//
+// Snapshots can be written with WriteTo and read back with
+// ReadDeviceCapabilities. LoadDeviceCapabilities uses that to cache them per
+// device and driver version.
+type DeviceCapabilities struct {
+	Properties         PhysicalDeviceProperties
+	IDProperties       PhysicalDeviceIDProperties
+	Vulkan11Properties PhysicalDeviceVulkan11Properties
+	Vulkan12Properties PhysicalDeviceVulkan12Properties
+	Vulkan13Properties PhysicalDeviceVulkan13Properties
+	Features           PhysicalDeviceFeatures
+	Vulkan11Features   PhysicalDeviceVulkan11Features
+	Vulkan12Features   PhysicalDeviceVulkan12Features
+	Vulkan13Features   PhysicalDeviceVulkan13Features
+	Memory             PhysicalDeviceMemoryProperties
+	QueueFamilies      []QueueFamilyProperties
+	formats            []FormatCapabilities
+}
+
+// QueryDeviceCapabilities queries the capabilities of the physical device.
+// The instance must have been created for Vulkan 1.1 or later.
+func QueryDeviceCapabilities(pd PhysicalDeviceFacade) *DeviceCapabilities {
+	arp := NewAutoReleaser()
+	defer arp.Release()
+
+	caps := &DeviceCapabilities{}
+	pd.GetPhysicalDeviceProperties(&caps.Properties)
+	version := ApiVersion(caps.Properties.ApiVersion())
+	atLeast := func(minor uint32) bool {
+		return version.Major() > 1 || version.Minor() >= minor
+	}
+
+	var props PhysicalDeviceProperties2
+	props.SetDefaultSType()
+	caps.IDProperties.SetDefaultSType()
+	props.PinPNext(arp, unsafe.Pointer(&caps.IDProperties))
+	if atLeast(2) {
+		caps.Vulkan11Properties.SetDefaultSType()
+		caps.Vulkan12Properties.SetDefaultSType()
+		caps.IDProperties.PinPNext(arp, unsafe.Pointer(&caps.Vulkan11Properties))
+		caps.Vulkan11Properties.PinPNext(arp, unsafe.Pointer(&caps.Vulkan12Properties))
+		if atLeast(3) {
+			caps.Vulkan13Properties.SetDefaultSType()
+			caps.Vulkan12Properties.PinPNext(arp, unsafe.Pointer(&caps.Vulkan13Properties))
+		}
+	}
+	pd.GetPhysicalDeviceProperties2(&props)
+
+	var features PhysicalDeviceFeatures2
+	features.SetDefaultSType()
+	if atLeast(2) {
+		caps.Vulkan11Features.SetDefaultSType()
+		caps.Vulkan12Features.SetDefaultSType()
+		features.PinPNext(arp, unsafe.Pointer(&caps.Vulkan11Features))
+		caps.Vulkan11Features.PinPNext(arp, unsafe.Pointer(&caps.Vulkan12Features))
+		if atLeast(3) {
+			caps.Vulkan13Features.SetDefaultSType()
+			caps.Vulkan12Features.PinPNext(arp, unsafe.Pointer(&caps.Vulkan13Features))
+		}
+	}
+	pd.GetPhysicalDeviceFeatures2(&features)
+	caps.Features = features.Features()
+
+	var memory PhysicalDeviceMemoryProperties2
+	memory.SetDefaultSType()
+	pd.GetPhysicalDeviceMemoryProperties2(&memory)
+	caps.Memory = memory.MemoryProperties()
+
+	families := pd.GetPhysicalDeviceQueueFamilyProperties2Into(nil)
+	caps.QueueFamilies = make([]QueueFamilyProperties, len(families))
+	for h := range caps.QueueFamilies {
+		caps.QueueFamilies[h] = families[h].QueueFamilyProperties()
+	}
+
+	// Only the formats core in the device version are queried; the slots
+	// of the others stay zero.
+	formats := make([]Format, 0, formatCount())
+	slots := make([]int, 0, formatCount())
+	base := 0
+	for _, r := range formatRanges {
+		for f := r.first; f <= r.last; f++ {
+			if atLeast(r.minor) {
+				formats = append(formats, f)
+				slots = append(slots, base+int(f-r.first))
+			}
+		}
+		base += int(r.last-r.first) + 1
+	}
+	n := len(formats)
+	props3 := make([]FormatProperties3, n)
+	images := make([]ImageFormatProperties, n)
+	results := make([]Result, n)
+	properties3 := C.int(0)
+	if atLeast(3) {
+		properties3 = 1
+	}
+	C.vksQueryFormats(pd.procs, C.VkPhysicalDevice(pd.H), C.uint32_t(n),
+		(*C.VkFormat)(unsafe.Pointer(&formats[0])), properties3,
+		(*C.VkFormatProperties3)(unsafe.Pointer(&props3[0])),
+		(*C.VkImageFormatProperties)(unsafe.Pointer(&images[0])),
+		(*C.VkResult)(unsafe.Pointer(&results[0])))
+	caps.formats = make([]FormatCapabilities, formatCount())
+	for h, slot := range slots {
+		caps.formats[slot] = FormatCapabilities{
+			LinearTilingFeatures:  props3[h].LinearTilingFeatures(),
+			OptimalTilingFeatures: props3[h].OptimalTilingFeatures(),
+			BufferFeatures:        props3[h].BufferFeatures(),
+			Image:                 images[h],
+			ImageSupported:        results[h] == VK_SUCCESS,
+		}
+	}
+
+	caps.clearPNext()
+	return caps
+}
+
+func (caps *DeviceCapabilities) clearPNext() {
+	caps.IDProperties.SetPNext(nil)
+	caps.Vulkan11Properties.SetPNext(nil)
+	caps.Vulkan12Properties.SetPNext(nil)
+	caps.Vulkan13Properties.SetPNext(nil)
+	caps.Vulkan11Features.SetPNext(nil)
+	caps.Vulkan12Features.SetPNext(nil)
+	caps.Vulkan13Features.SetPNext(nil)
+}
+
+// Format returns the capabilities of the format. The boolean is false for
+// formats unknown to the binding. Formats newer than the device version have
+// no features.
+func (caps *DeviceCapabilities) Format(format Format) (FormatCapabilities, bool) {
+	if slot := formatSlot(format); slot >= 0 && slot < len(caps.formats) {
+		return caps.formats[slot], true
+	}
+	return FormatCapabilities{}, false
+}
+
+// FindQueueFamily returns the index of the first queue family with all of the
+// required flags. The boolean is false when no family matches.
+func (caps *DeviceCapabilities) FindQueueFamily(required QueueFlags) (uint32, bool) {
+	for h, family := range caps.QueueFamilies {
+		if family.QueueFlags()&required == required {
+			return uint32(h), true
+		}
+	}
+	return 0, false
+}
+
+// MemoryTypeFlags returns the property flags of a memory type, for
+// CopyToMapped and CopyFromMapped. It returns 0 for unknown types.
+func (caps *DeviceCapabilities) MemoryTypeFlags(typeIndex uint32) MemoryPropertyFlags {
+	if typeIndex >= caps.Memory.MemoryTypeCount() {
+		return 0
+	}
+	return caps.Memory.MemoryTypes()[typeIndex].PropertyFlags()
+}
+
+// The snapshot file is the magic, a uint32_t version, then every struct and
+// table of DeviceCapabilities as a uint32_t element size, a uint32_t element
+// count and the raw bytes. Like capture traces, it uses the byte order and
+// struct layout of the host; a size mismatch rejects the snapshot.
+var capsMagic = []byte("VKSCAPS\x00")
+
+const capsVersion = 1
+
+var errBadCaps = fmt.Errorf("error: not a vks capabilities snapshot")
+
+// capsStructs returns the raw memory of the fixed size structs of the
+// snapshot, in file order. The tables follow them.
+func (caps *DeviceCapabilities) capsStructs() [][]byte {
+	return [][]byte{
+		rawBytes(unsafe.Slice(&caps.Properties, 1)),
+		rawBytes(unsafe.Slice(&caps.IDProperties, 1)),
+		rawBytes(unsafe.Slice(&caps.Vulkan11Properties, 1)),
+		rawBytes(unsafe.Slice(&caps.Vulkan12Properties, 1)),
+		rawBytes(unsafe.Slice(&caps.Vulkan13Properties, 1)),
+		rawBytes(unsafe.Slice(&caps.Features, 1)),
+		rawBytes(unsafe.Slice(&caps.Vulkan11Features, 1)),
+		rawBytes(unsafe.Slice(&caps.Vulkan12Features, 1)),
+		rawBytes(unsafe.Slice(&caps.Vulkan13Features, 1)),
+		rawBytes(unsafe.Slice(&caps.Memory, 1)),
+	}
+}
+
+func rawBytes[T any](s []T) []byte {
+	if len(s) == 0 {
+		return nil
+	}
+	return unsafe.Slice((*byte)(unsafe.Pointer(&s[0])), len(s)*int(unsafe.Sizeof(s[0])))
+}
+
+// WriteTo writes the snapshot to w.
+func (caps *DeviceCapabilities) WriteTo(w io.Writer) (int64, error) {
+	var buf bytes.Buffer
+	buf.Write(capsMagic)
+	binary.Write(&buf, binary.NativeEndian, uint32(capsVersion))
+	for _, section := range caps.capsStructs() {
+		binary.Write(&buf, binary.NativeEndian, [2]uint32{uint32(len(section)), 1})
+		buf.Write(section)
+	}
+	writeCapsTable(&buf, caps.QueueFamilies)
+	writeCapsTable(&buf, caps.formats)
+	return buf.WriteTo(w)
+}
+
+func writeCapsTable[T any](buf *bytes.Buffer, table []T) {
+	var zero T
+	binary.Write(buf, binary.NativeEndian, [2]uint32{uint32(unsafe.Sizeof(zero)), uint32(len(table))})
+	buf.Write(rawBytes(table))
+}
+
+// ReadDeviceCapabilities reads a snapshot written by WriteTo.
+func ReadDeviceCapabilities(r io.Reader) (*DeviceCapabilities, error) {
+	br := bufio.NewReader(r)
+	var header [12]byte
+	if _, err := io.ReadFull(br, header[:]); err != nil {
+		return nil, err
+	}
+	if !bytes.Equal(header[:8], capsMagic) || binary.NativeEndian.Uint32(header[8:]) != capsVersion {
+		return nil, errBadCaps
+	}
+
+	caps := &DeviceCapabilities{}
+	for _, section := range caps.capsStructs() {
+		var size [2]uint32
+		if err := binary.Read(br, binary.NativeEndian, &size); err != nil {
+			return nil, err
+		}
+		if size != [2]uint32{uint32(len(section)), 1} {
+			return nil, errBadCaps
+		}
+		if _, err := io.ReadFull(br, section); err != nil {
+			return nil, err
+		}
+	}
+	var err error
+	if caps.QueueFamilies, err = readCapsTable[QueueFamilyProperties](br, -1); err != nil {
+		return nil, err
+	}
+	if caps.formats, err = readCapsTable[FormatCapabilities](br, formatCount()); err != nil {
+		return nil, err
+	}
+	caps.clearPNext()
+	return caps, nil
+}
+
+// readCapsTable reads a table of the snapshot. A count of -1 accepts any
+// number of entries.
+func readCapsTable[T any](r io.Reader, count int) ([]T, error) {
+	var section [2]uint32
+	if err := binary.Read(r, binary.NativeEndian, &section); err != nil {
+		return nil, err
+	}
+	var zero T
+	if uintptr(section[0]) != unsafe.Sizeof(zero) || (count >= 0 && int(section[1]) != count) || section[1] > 1<<16 {
+		return nil, errBadCaps
+	}
+	table := make([]T, section[1])
+	if _, err := io.ReadFull(r, rawBytes(table)); err != nil {
+		return nil, err
+	}
+	return table, nil
+}
+
+// LoadDeviceCapabilities returns the capabilities of the physical device from
+// a snapshot cached in dir, keyed by the device UUID and driver version, so
+// warm starts only query the device identity. Without a usable snapshot, the
+// device is queried and the snapshot is written to dir. When writing the
+// snapshot fails, the queried capabilities are still returned, along with the
+// error.
+func LoadDeviceCapabilities(pd PhysicalDeviceFacade, dir string) (*DeviceCapabilities, error) {
+	arp := NewAutoReleaser()
+	defer arp.Release()
+
+	var id PhysicalDeviceIDProperties
+	id.SetDefaultSType()
+	var props PhysicalDeviceProperties2
+	props.SetDefaultSType()
+	props.PinPNext(arp, unsafe.Pointer(&id))
+	pd.GetPhysicalDeviceProperties2(&props)
+	driverVersion := props.PropertiesView().DriverVersion()
+	fn := filepath.Join(dir, fmt.Sprintf("%x-%08x.caps", id.DeviceUUID(), driverVersion))
+
+	if fh, err := os.Open(fn); err == nil {
+		caps, err := ReadDeviceCapabilities(fh)
+		fh.Close()
+		if err == nil && caps.Properties.DriverVersion() == driverVersion && bytes.Equal(caps.IDProperties.DeviceUUID(), id.DeviceUUID()) {
+			return caps, nil
+		}
+	}
+
+	caps := QueryDeviceCapabilities(pd)
+	if err := writeDeviceCapabilities(caps, dir, fn); err != nil {
+		return caps, fmt.Errorf("error: caching the device capabilities: %w", err)
+	}
+	return caps, nil
+}
+
+// writeDeviceCapabilities writes the snapshot to a temporary file in dir and
+// renames it to fn, so concurrent workers never read a partial snapshot.
+func writeDeviceCapabilities(caps *DeviceCapabilities, dir, fn string) error {
+	if err := os.MkdirAll(dir, 0755); err != nil {
+		return err
+	}
+	fh, err := os.CreateTemp(dir, "caps-*.tmp")
+	if err != nil {
+		return err
+	}
+	defer os.Remove(fh.Name())
+	if _, err := caps.WriteTo(fh); err != nil {
+		fh.Close()
+		return err
+	}
+	if err := fh.Close(); err != nil {
+		return err
+	}
+	return os.Rename(fh.Name(), fn)
+}
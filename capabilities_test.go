@@ -0,0 +1,127 @@
+//go:build !vks_no_version_1_3 && !vks_no_version_1_1 && !vks_no_version_1_2
+
+package vks
+
+import (
+	"bytes"
+	"os"
+	"path/filepath"
+	"reflect"
+	"testing"
+	"unsafe"
+)
+
+// testCapabilities returns a snapshot with every byte of its structs and
+// tables set, except the pNext pointers.
+func testCapabilities() *DeviceCapabilities {
+	caps := &DeviceCapabilities{
+		QueueFamilies: make([]QueueFamilyProperties, 3),
+		formats:       make([]FormatCapabilities, formatCount()),
+	}
+	pattern := func(b []byte, seed int) {
+		for k := range b {
+			b[k] = byte(seed + 7*k + 1)
+		}
+	}
+	for h, section := range caps.capsStructs() {
+		pattern(section, h)
+	}
+	pattern(rawBytes(caps.QueueFamilies), 11)
+	for k := range caps.formats {
+		caps.formats[k] = FormatCapabilities{
+			LinearTilingFeatures:  FormatFeatureFlags2(k),
+			OptimalTilingFeatures: FormatFeatureFlags2(k) << 8,
+			BufferFeatures:        FormatFeatureFlags2(k) << 16,
+			ImageSupported:        k%3 == 0,
+		}
+		pattern(rawBytes(unsafe.Slice(&caps.formats[k].Image, 1)), k)
+	}
+	caps.clearPNext()
+	return caps
+}
+
+func TestDeviceCapabilitiesRoundTrip(t *testing.T) {
+	caps := testCapabilities()
+	var buf bytes.Buffer
+	n, err := caps.WriteTo(&buf)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if n != int64(buf.Len()) {
+		t.Errorf("WriteTo returned %d bytes, wrote %d", n, buf.Len())
+	}
+	read, err := ReadDeviceCapabilities(bytes.NewReader(buf.Bytes()))
+	if err != nil {
+		t.Fatal(err)
+	}
+	want, got := caps.capsStructs(), read.capsStructs()
+	for h := range want {
+		if !bytes.Equal(got[h], want[h]) {
+			t.Errorf("struct %d of the snapshot differs", h)
+		}
+	}
+	if !reflect.DeepEqual(read.QueueFamilies, caps.QueueFamilies) {
+		t.Error("the queue families of the snapshot differ")
+	}
+	if !reflect.DeepEqual(read.formats, caps.formats) {
+		t.Error("the formats of the snapshot differ")
+	}
+	if format, ok := read.Format(VK_FORMAT_ASTC_12x12_SFLOAT_BLOCK); !ok || format != caps.formats[formatCount()-1] {
+		t.Errorf("Format returned %v, %v for the last format", format, ok)
+	}
+}
+
+func TestReadDeviceCapabilitiesRejects(t *testing.T) {
+	var buf bytes.Buffer
+	testCapabilities().WriteTo(&buf)
+	valid := buf.Bytes()
+
+	badMagic := append([]byte(nil), valid...)
+	badMagic[0] = 'X'
+	badVersion := append([]byte(nil), valid...)
+	badVersion[8]++
+	short := &DeviceCapabilities{formats: make([]FormatCapabilities, formatCount()-1)}
+	buf.Reset()
+	short.WriteTo(&buf)
+
+	for name, data := range map[string][]byte{
+		"empty":     nil,
+		"magic":     badMagic,
+		"version":   badVersion,
+		"truncated": valid[:len(valid)-1],
+		"formats":   buf.Bytes(),
+	} {
+		if caps, err := ReadDeviceCapabilities(bytes.NewReader(data)); err == nil {
+			t.Errorf("%s: read a snapshot with %d formats", name, len(caps.formats))
+		}
+	}
+}
+
+// An unwritable cache still returns the capabilities, with the error.
+func TestLoadDeviceCapabilities(t *testing.T) {
+	pd := nullPhysicalDevice(t)
+	file := filepath.Join(t.TempDir(), "file")
+	if err := os.WriteFile(file, nil, 0644); err != nil {
+		t.Fatal(err)
+	}
+	caps, err := LoadDeviceCapabilities(pd, filepath.Join(file, "caps"))
+	if err == nil || caps == nil {
+		t.Fatalf("LoadDeviceCapabilities returned %p, %v in an unwritable directory", caps, err)
+	}
+
+	dir := t.TempDir()
+	if _, err := LoadDeviceCapabilities(pd, dir); err != nil {
+		t.Fatal(err)
+	}
+	snapshots, _ := filepath.Glob(filepath.Join(dir, "*.caps"))
+	if len(snapshots) != 1 {
+		t.Fatalf("found snapshots %v, want one", snapshots)
+	}
+	cached, err := LoadDeviceCapabilities(pd, dir)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if cached.Properties.DriverVersion() != caps.Properties.DriverVersion() || len(cached.QueueFamilies) != len(caps.QueueFamilies) {
+		t.Error("the cached capabilities differ from the queried ones")
+	}
+}
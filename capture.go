@@ -0,0 +1,186 @@
+package vks
+
+//#include "vk_capture.h"
+import "C"
+import (
+	"bufio"
+	"bytes"
+	"encoding/binary"
+	"fmt"
+	"io"
+	"sync/atomic"
+	"time"
+	"unsafe"
+)
+
+// Capture records every command issued through the binding into a binary
+// trace. Commands are serialized by the C wrappers, deep copying structs,
+// arrays and pNext chains, into one of two buffers. A writer goroutine drains
+// the full buffer to the io.Writer while the other one is being filled.
+//
+// Only one capture can run at a time. The trace is only self contained if
+// capturing starts before the instance is created.
+type Capture struct {
+	w    io.Writer
+	done chan error
+}
+
+// StartCapture begins capturing commands to w. bufferSize is the size of each
+// of the two buffers; zero selects 1MB.
+func StartCapture(w io.Writer, bufferSize int) (*Capture, error) {
+	if err := Result(C.vksCaptureStart(C.size_t(bufferSize))).AsErr(); err != nil {
+		return nil, fmt.Errorf("error: a capture is already running: %w", err)
+	}
+	capture := &Capture{
+		w:    w,
+		done: make(chan error, 1),
+	}
+	go capture.write()
+	return capture, nil
+}
+
+// capturing reports if a capture is running. It reads the flag the C wrappers
+// test, without a cgo call.
+func capturing() bool {
+	return atomic.LoadInt32((*int32)(unsafe.Pointer(&C.vksCaptureActive))) != 0
+}
+
+func (capture *Capture) write() {
+	var err error
+	var data unsafe.Pointer
+	var size C.size_t
+	for C.vksCaptureNext(&data, &size) != 0 {
+		if err == nil {
+			_, err = capture.w.Write(unsafe.Slice((*byte)(data), size))
+		}
+		C.vksCaptureRelease()
+	}
+	capture.done <- err
+}
+
+// Frame marks the end of a frame in the trace. The replayer reports timings
+// per frame using these markers.
+func (capture *Capture) Frame() {
+	C.vksCaptureFrame()
+}
+
+// Stop ends the capture, waits for the writer to drain the buffers and
+// returns the first write error.
+func (capture *Capture) Stop() error {
+	C.vksCaptureStop()
+	return <-capture.done
+}
+
+// ReplayCommandStats are the timings of one command in a replayed trace. Time
+// only covers the command itself, not decoding the record.
+type ReplayCommandStats struct {
+	Name    string
+	Calls   int
+	Errors  int // Calls that returned an error result.
+	Skipped int // Records that could not be replayed.
+	Time    time.Duration
+}
+
+// ReplayStats is the result of replaying a trace.
+type ReplayStats struct {
+	Commands []ReplayCommandStats // Indexed by the command id of the trace.
+	Frames   []time.Duration      // Wall time between frame markers.
+	Total    time.Duration        // Wall time of the whole replay.
+}
+
+var errBadTrace = fmt.Errorf("error: not a vks trace")
+
+// Replay re-issues every command of the trace read from r as fast as
+// possible, mapping the captured handles to the handles created during the
+// replay. Commands are matched by name, so traces can be replayed by other
+// versions of the binding. Init must be called before Replay.
+//
+// The trace is read with the byte order of the host, and structs are copied
+// with the layout of the host.
+func Replay(r io.Reader) (*ReplayStats, error) {
+	br := bufio.NewReaderSize(r, 1<<20)
+	var header [16]byte
+	if _, err := io.ReadFull(br, header[:]); err != nil {
+		return nil, err
+	}
+	if !bytes.Equal(header[:8], []byte("VKSTRACE")) || binary.NativeEndian.Uint32(header[8:]) != C.VKS_CAPTURE_VERSION {
+		return nil, errBadTrace
+	}
+
+	local := make(map[string]uint32, C.VKS_CAPTURE_COMMAND_COUNT)
+	for h := uint32(0); h < C.VKS_CAPTURE_COMMAND_COUNT; h++ {
+		local[C.GoString(C.vksCaptureCommandName(C.uint32_t(h)))] = h
+	}
+
+	stats := &ReplayStats{
+		Commands: make([]ReplayCommandStats, binary.NativeEndian.Uint32(header[12:])),
+	}
+	ids := make([]uint32, len(stats.Commands))
+	var size [4]byte
+	for h := range stats.Commands {
+		if _, err := io.ReadFull(br, size[:]); err != nil {
+			return nil, err
+		}
+		name := make([]byte, binary.NativeEndian.Uint32(size[:]))
+		if _, err := io.ReadFull(br, name); err != nil {
+			return nil, err
+		}
+		stats.Commands[h].Name = string(name)
+		if id, ok := local[stats.Commands[h].Name]; ok {
+			ids[h] = id
+		} else {
+			ids[h] = C.VKS_CAPTURE_FRAME_MARKER
+		}
+	}
+
+	replay := C.vksReplayCreate()
+	defer C.vksReplayDestroy(replay)
+
+	var record [8]byte
+	payload := make([]byte, 4096)
+	start := time.Now()
+	frameStart := start
+	for {
+		if _, err := io.ReadFull(br, record[:]); err == io.EOF {
+			break
+		} else if err != nil {
+			return stats, err
+		}
+		command := binary.NativeEndian.Uint32(record[:4])
+		length := int(binary.NativeEndian.Uint32(record[4:]))
+		if command == C.VKS_CAPTURE_FRAME_MARKER {
+			now := time.Now()
+			stats.Frames = append(stats.Frames, now.Sub(frameStart))
+			frameStart = now
+			continue
+		} else if int(command) >= len(stats.Commands) {
+			return stats, errBadTrace
+		}
+
+		if length+1 > len(payload) {
+			payload = make([]byte, length+1)
+		}
+		if _, err := io.ReadFull(br, payload[:length]); err != nil {
+			return stats, err
+		}
+
+		entry := &stats.Commands[command]
+		if ids[command] == C.VKS_CAPTURE_FRAME_MARKER {
+			entry.Skipped++
+			continue
+		}
+		var result C.VkResult
+		var ns C.uint64_t
+		if C.vksReplayRecord(replay, C.uint32_t(ids[command]), unsafe.Pointer(&payload[0]), C.size_t(length), &result, &ns) == 0 {
+			entry.Skipped++
+			continue
+		}
+		entry.Calls++
+		entry.Time += time.Duration(ns)
+		if Result(result).IsError() {
+			entry.Errors++
+		}
+	}
+	stats.Total = time.Since(start)
+	return stats, nil
+}
@@ -0,0 +1,1133 @@
+//go:build !vks_no_version_1_3 && !vks_no_version_1_1 && !vks_no_version_1_2
+
+package vks
+
+import (
+	"crypto/sha256"
+	"encoding/binary"
+	"fmt"
+	"time"
+	"unsafe"
+)
+
+// ComputePushConstantsSize is the size of the push constant range available
+// to compute jobs; the minimum maxPushConstantsSize of the specification.
+const ComputePushConstantsSize = 128
+
+// ComputeJob describes one dispatch run by a ComputeRunner. The shader reads
+// Input from a storage buffer at set 0, binding 0 and writes Output to a
+// storage buffer at set 0, binding 1. len(Output) bytes are read back into
+// Output once the job completes.
+type ComputeJob struct {
+	SPIRV         []uint32 // The shader module code.
+	EntryPoint    string   // The shader entry point; "main" when empty.
+	PushConstants []byte   // At most ComputePushConstantsSize bytes.
+	GroupCount    [3]uint32
+	Input         []byte
+	Output        []byte
+
+	// Specialization sets specialization constants of the shader, like the
+	// workgroup size chosen by TuneWorkgroupSize. Pipelines are cached per
+	// set of values.
+	Specialization []SpecializationConstant
+
+	// Split lets a runner on a device group spread the dispatch along X
+	// over the devices of the group. The output must then be made of
+	// GroupCount[0] equal, contiguous parts, each written by the workgroups
+	// of one X index.
+	Split bool
+}
+
+// SpecializationConstant is the 32 bit value of the specialization constant
+// with the given constant ID.
+type SpecializationConstant struct {
+	ID    uint32
+	Value uint32
+}
+
+// ComputeQueue is a queue and the index of the family it was created from.
+type ComputeQueue struct {
+	Queue  QueueFacade
+	Family uint32
+}
+
+// ComputeRunnerConfig configures a ComputeRunner.
+type ComputeRunnerConfig struct {
+	Compute ComputeQueue // The queue running the dispatches.
+
+	// The queue running the uploads and readbacks. When its handle is
+	// NullQueue, the compute queue is used. A queue from a dedicated
+	// transfer family lets the copies overlap with the dispatches.
+	Transfer ComputeQueue
+
+	InFlight int        // The number of jobs in flight; 2 when zero.
+	SlotSize DeviceSize // The maximum input and output size of a job.
+
+	// PipelineCache is used to create the pipelines. It is owned by the
+	// caller and may be NullPipelineCache.
+	PipelineCache PipelineCache
+
+	// DeviceCount is the number of physical devices in the device group
+	// the device was created from; 1 when zero. With more than one, every
+	// stage is submitted once per physical device, and Split jobs are
+	// dispatched with CmdSetDeviceMask and CmdDispatchBase.
+	DeviceCount int
+
+	// Budget, when not nil, is consulted before the buffers are allocated.
+	Budget MemoryBudgeter
+}
+
+// ComputeStageStats accumulates the durations of one stage of the jobs run by
+// a ComputeRunner.
+type ComputeStageStats struct {
+	Count    int
+	Total    time.Duration
+	Min, Max time.Duration
+}
+
+// Mean returns the mean duration of the stage.
+func (stats ComputeStageStats) Mean() time.Duration {
+	if stats.Count == 0 {
+		return 0
+	}
+	return stats.Total / time.Duration(stats.Count)
+}
+
+func (stats *ComputeStageStats) add(d time.Duration) {
+	if stats.Count == 0 || d < stats.Min {
+		stats.Min = d
+	}
+	if d > stats.Max {
+		stats.Max = d
+	}
+	stats.Count++
+	stats.Total += d
+}
+
+// ComputeRunnerStats reports the throughput and per-stage latency of a
+// ComputeRunner. Upload, Dispatch and Readback are device execution times
+// measured with timestamp queries; they stay empty when the queue families do
+// not support timestamps. Latency is the host time from Submit to the runner
+// observing the job's completion.
+type ComputeRunnerStats struct {
+	Jobs     int
+	Bytes    uint64        // The input and output bytes transferred.
+	Elapsed  time.Duration // From the first Submit to the last completion.
+	Upload   ComputeStageStats
+	Dispatch ComputeStageStats
+	Readback ComputeStageStats
+	Latency  ComputeStageStats
+}
+
+// JobsPerSecond returns the number of completed jobs per second.
+func (stats ComputeRunnerStats) JobsPerSecond() float64 {
+	if stats.Elapsed <= 0 {
+		return 0
+	}
+	return float64(stats.Jobs) / stats.Elapsed.Seconds()
+}
+
+// BytesPerSecond returns the number of bytes transferred per second.
+func (stats ComputeRunnerStats) BytesPerSecond() float64 {
+	if stats.Elapsed <= 0 {
+		return 0
+	}
+	return float64(stats.Bytes) / stats.Elapsed.Seconds()
+}
+
+// The stages of a job, in execution order. Every stage has a timeline
+// semaphore reaching the job sequence number plus one when the stage of the
+// job is done, and a pair of timestamp queries per slot.
+const (
+	computeUpload = iota
+	computeDispatch
+	computeReadback
+	computeStages
+)
+
+// ComputeRunner runs compute jobs on a device with several jobs in flight.
+// Every job goes through three stages: the input is copied from host visible
+// staging memory to a device local buffer, the shader is dispatched, and the
+// output is copied to host visible memory. The stages are chained with
+// timeline semaphores instead of fence waits, so the upload of job k+1, the
+// dispatch of job k and the readback of job k-1 overlap when the transfer and
+// compute queues differ.
+//
+// The device must be created with the timelineSemaphore and synchronization2
+// features enabled. Pipelines are created on first use and cached by SPIR-V
+// and entry point.
+//
+// On a device group, the device local buffers have an instance per physical
+// device. The input is uploaded to every instance, and every physical device
+// reads back the part of the output it dispatched, into the shared host
+// memory. The stages of each physical device are chained with their own
+// timeline semaphores.
+type ComputeRunner struct {
+	device   DeviceFacade
+	compute  ComputeQueue
+	transfer ComputeQueue
+	slotSize DeviceSize
+	stride   DeviceSize
+	devices  int
+	cache    PipelineCache
+	budget   MemoryBudgeter
+
+	ring         *UploadRing
+	buffer       Buffer // Device local; an input and an output region per slot.
+	memory       DeviceMemory
+	readBuffer   Buffer // Host visible; an output region per slot.
+	readMemory   DeviceMemory
+	readMapped   []byte
+	readCoherent bool
+	readFlags    MemoryPropertyFlags
+	atomSize     DeviceSize
+
+	setLayout      DescriptorSetLayout
+	pipelineLayout PipelineLayout
+	descriptorPool DescriptorPool
+	sets           []DescriptorSet
+	pipelines      map[[sha256.Size]byte]Pipeline
+	shaders        map[string]*cachedShader // The SPIR-V of the cached pipelines.
+
+	computePool  CommandPoolFacade
+	transferPool CommandPoolFacade
+	cmds         [][computeStages]CommandBufferFacade
+
+	timelines [computeStages][]Semaphore // Per physical device.
+	submits   [computeStages]*PreparedSubmit
+
+	queryPool       QueryPool
+	timestampPeriod float64
+	timestampMask   [computeStages]uint64
+
+	// Jobs in flight, by slot. next is the sequence number of the next job,
+	// and done the number of jobs collected.
+	jobs      []*ComputeJob
+	submitted []time.Time
+	next      uint64
+	done      uint64
+	readback  bool // The readback of job next-1 is not submitted yet.
+
+	stats ComputeRunnerStats
+	start time.Time
+
+	// C memory reused for host timeline waits and non-coherent ranges.
+	waitInfo  *SemaphoreWaitInfo
+	waitSem   []Semaphore
+	waitValue []uint64
+	invalid   *MappedMemoryRange
+}
+
+// NewComputeRunner creates the buffers, pipeline layout, command buffers and
+// timeline semaphores of a runner. caps provides the memory properties,
+// limits and queue family timestamp support of the physical device.
+func NewComputeRunner(device DeviceFacade, caps *DeviceCapabilities, config ComputeRunnerConfig) (*ComputeRunner, error) {
+	if config.InFlight == 0 {
+		config.InFlight = 2
+	}
+	if config.InFlight < 1 || config.SlotSize == 0 {
+		return nil, fmt.Errorf("error: compute runner needs at least one slot of non-zero size, got %d of %d", config.InFlight, config.SlotSize)
+	}
+	if config.Transfer.Queue.H == NullQueue {
+		config.Transfer = config.Compute
+	}
+	if config.DeviceCount == 0 {
+		config.DeviceCount = 1
+	}
+	limits := caps.Properties.LimitsView()
+	runner := &ComputeRunner{
+		device:    device,
+		compute:   config.Compute,
+		transfer:  config.Transfer,
+		slotSize:  config.SlotSize,
+		devices:   config.DeviceCount,
+		cache:     config.PipelineCache,
+		budget:    config.Budget,
+		stride:    alignDeviceSize(config.SlotSize, maxDeviceSize(limits.MinStorageBufferOffsetAlignment(), 1)),
+		atomSize:  maxDeviceSize(limits.NonCoherentAtomSize(), 1),
+		pipelines: make(map[[sha256.Size]byte]Pipeline),
+		shaders:   make(map[string]*cachedShader),
+		jobs:      make([]*ComputeJob, config.InFlight),
+		submitted: make([]time.Time, config.InFlight),
+		cmds:      make([][computeStages]CommandBufferFacade, config.InFlight),
+	}
+	// Regions of the read buffer are flushed and invalidated on their own.
+	runner.stride = alignDeviceSize(runner.stride, runner.atomSize)
+
+	var err error
+	if runner.ring, err = NewUploadRing(device, &caps.Memory, *limits, config.InFlight, config.SlotSize, BufferUsageFlags(VK_BUFFER_USAGE_TRANSFER_SRC_BIT)); err != nil {
+		return nil, err
+	}
+	if err = runner.createBuffers(caps); err == nil {
+		if err = runner.createLayouts(config.InFlight); err == nil {
+			if err = runner.createCommands(config.InFlight); err == nil {
+				err = runner.createSync(caps)
+			}
+		}
+	}
+	if err != nil {
+		runner.Destroy()
+		return nil, err
+	}
+	return runner, nil
+}
+
+func (runner *ComputeRunner) createBuffers(caps *DeviceCapabilities) error {
+	arp := NewAutoReleaser()
+	defer arp.Release()
+	slots := DeviceSize(len(runner.jobs))
+
+	families := []uint32{runner.compute.Family, runner.transfer.Family}
+	bInfo := &BufferCreateInfo{}
+	bInfo.SetDefaultSType()
+	bInfo.SetSize(2 * slots * runner.stride)
+	bInfo.SetUsage(BufferUsageFlags(VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT))
+	bInfo.SetSharingMode(VK_SHARING_MODE_EXCLUSIVE)
+	if families[0] != families[1] {
+		// Shared between the families without ownership transfers.
+		bInfo.SetSharingMode(VK_SHARING_MODE_CONCURRENT)
+		bInfo.SetQueueFamilyIndexCount(2)
+		bInfo.PinPQueueFamilyIndices(arp, families)
+	}
+	deviceLocal := MemoryPropertyFlags(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
+	buffer, memory, _, err := allocateBuffer(runner.device, runner.budget, bInfo, &caps.Memory, deviceLocal, 0)
+	if err != nil {
+		return err
+	}
+	runner.buffer, runner.memory = buffer, memory
+
+	rInfo := &BufferCreateInfo{}
+	rInfo.SetDefaultSType()
+	rInfo.SetSize(slots * runner.stride)
+	rInfo.SetUsage(BufferUsageFlags(VK_BUFFER_USAGE_TRANSFER_DST_BIT))
+	rInfo.SetSharingMode(VK_SHARING_MODE_EXCLUSIVE)
+	hostVisible := MemoryPropertyFlags(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+	hostCached := MemoryPropertyFlags(VK_MEMORY_PROPERTY_HOST_CACHED_BIT)
+	buffer, memory, flags, err := allocateBuffer(runner.device, runner.budget, rInfo, &caps.Memory, hostVisible|hostCached, hostVisible)
+	if err != nil {
+		return err
+	}
+	runner.readBuffer, runner.readMemory = buffer, memory
+	runner.readCoherent = flags&MemoryPropertyFlags(VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0
+	runner.readFlags = flags
+
+	var pData unsafe.Pointer
+	if err := runner.device.MapMemory(runner.readMemory, 0, DeviceSize(VK_WHOLE_SIZE), 0, &pData).AsErr(); err != nil {
+		return err
+	}
+	runner.readMapped = unsafe.Slice((*byte)(pData), slots*runner.stride)
+	return nil
+}
+
+// MemoryBudgeter is consulted by the allocations of a ComputeRunner or an
+// OffscreenPool before they allocate device memory, so they stay within the
+// budget of every heap. MemoryBudget implements it.
+type MemoryBudgeter interface {
+	// Reserve accounts for an allocation of size bytes of the memory type,
+	// and returns false when it does not fit in the budget of the heap.
+	Reserve(typeIndex uint32, size DeviceSize) bool
+	// Commit binds a reservation to the allocated memory, or returns the
+	// reservation when memory is NullDeviceMemory.
+	Commit(memory DeviceMemory, typeIndex uint32, size DeviceSize)
+	// Release returns the reservation of memory before it is freed.
+	Release(memory DeviceMemory)
+}
+
+// allocateBuffer creates a buffer bound to its own memory. See allocateMemory
+// for the choice of the memory type.
+func allocateBuffer(device DeviceFacade, budget MemoryBudgeter, info *BufferCreateInfo, memProps *PhysicalDeviceMemoryProperties, preferred, required MemoryPropertyFlags) (Buffer, DeviceMemory, MemoryPropertyFlags, error) {
+	var buffer Buffer
+	if err := device.CreateBuffer(info, nil, &buffer).AsErr(); err != nil {
+		return NullBuffer, NullDeviceMemory, 0, err
+	}
+	var reqs MemoryRequirements
+	device.GetBufferMemoryRequirements(buffer, &reqs)
+	memory, flags, err := allocateMemory(device, budget, memProps, reqs, preferred, required)
+	if err != nil {
+		device.DestroyBuffer(buffer, nil)
+		return NullBuffer, NullDeviceMemory, 0, err
+	}
+	if err := device.BindBufferMemory(buffer, memory, 0).AsErr(); err != nil {
+		device.DestroyBuffer(buffer, nil)
+		freeMemory(device, budget, memory)
+		return NullBuffer, NullDeviceMemory, 0, err
+	}
+	return buffer, memory, flags, nil
+}
+
+// allocateMemory allocates memory for the requirements, of a type with the
+// preferred properties, or with the required ones otherwise. A required value
+// of zero makes the preferred properties mandatory. The types are tried in
+// order, skipping the ones the budget refuses and the ones out of memory, so
+// a full heap falls back to another one. It returns the properties of the
+// chosen type. budget may be nil.
+func allocateMemory(device DeviceFacade, budget MemoryBudgeter, memProps *PhysicalDeviceMemoryProperties, reqs MemoryRequirements, preferred, required MemoryPropertyFlags) (DeviceMemory, MemoryPropertyFlags, error) {
+	candidates := memoryTypeCandidates(memProps, reqs.MemoryTypeBits(), preferred, required)
+	if len(candidates) == 0 {
+		return NullDeviceMemory, 0, fmt.Errorf("error: no memory type with %v in %032b", preferred, reqs.MemoryTypeBits())
+	}
+
+	aInfo := &MemoryAllocateInfo{}
+	aInfo.SetDefaultSType()
+	aInfo.SetAllocationSize(reqs.Size())
+	err := fmt.Errorf("error: %d bytes exceed the memory budget of every type in %032b", reqs.Size(), reqs.MemoryTypeBits())
+	for _, typeIndex := range candidates {
+		if budget != nil && !budget.Reserve(typeIndex, reqs.Size()) {
+			continue
+		}
+		aInfo.SetMemoryTypeIndex(typeIndex)
+		var memory DeviceMemory
+		result := device.AllocateMemory(aInfo, nil, &memory)
+		if !result.IsSuccess() {
+			memory = NullDeviceMemory
+		}
+		if budget != nil {
+			budget.Commit(memory, typeIndex, reqs.Size())
+		}
+		if result.IsSuccess() {
+			return memory, memProps.MemoryTypes()[typeIndex].PropertyFlags(), nil
+		}
+		err = result.AsErr()
+		if result != VK_ERROR_OUT_OF_DEVICE_MEMORY && result != VK_ERROR_OUT_OF_HOST_MEMORY {
+			break
+		}
+	}
+	return NullDeviceMemory, 0, err
+}
+
+// memoryTypeCandidates returns the memory types allowed by typeBits with the
+// preferred properties, followed by the other ones with the required
+// properties.
+func memoryTypeCandidates(memProps *PhysicalDeviceMemoryProperties, typeBits uint32, preferred, required MemoryPropertyFlags) []uint32 {
+	types := memProps.MemoryTypes()
+	var candidates []uint32
+	var rest uint32
+	for h := uint32(0); h < memProps.MemoryTypeCount(); h++ {
+		if typeBits&(1<<h) == 0 {
+			continue
+		}
+		if flags := types[h].PropertyFlags(); flags&preferred == preferred {
+			candidates = append(candidates, h)
+		} else if required != 0 && flags&required == required {
+			rest |= 1 << h
+		}
+	}
+	for h := uint32(0); rest != 0; h++ {
+		if rest&(1<<h) != 0 {
+			candidates = append(candidates, h)
+			rest &^= 1 << h
+		}
+	}
+	return candidates
+}
+
+// freeMemory returns the reservation of memory to the budget and frees it.
+// budget may be nil.
+func freeMemory(device DeviceFacade, budget MemoryBudgeter, memory DeviceMemory) {
+	if budget != nil {
+		budget.Release(memory)
+	}
+	device.FreeMemory(memory, nil)
+}
+
+func (runner *ComputeRunner) createLayouts(slots int) error {
+	arp := NewAutoReleaser()
+	defer arp.Release()
+
+	bindings := make([]DescriptorSetLayoutBinding, 2)
+	for h := range bindings {
+		bindings[h].SetBinding(uint32(h))
+		bindings[h].SetDescriptorType(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER)
+		bindings[h].SetDescriptorCount(1)
+		bindings[h].SetStageFlags(ShaderStageFlags(VK_SHADER_STAGE_COMPUTE_BIT))
+	}
+	slInfo := &DescriptorSetLayoutCreateInfo{}
+	slInfo.SetDefaultSType()
+	slInfo.SetBindingCount(uint32(len(bindings)))
+	slInfo.PinPBindings(arp, bindings)
+	var setLayout DescriptorSetLayout
+	if err := runner.device.CreateDescriptorSetLayout(slInfo, nil, &setLayout).AsErr(); err != nil {
+		return err
+	}
+	runner.setLayout = setLayout
+
+	setLayouts := []DescriptorSetLayout{runner.setLayout}
+	ranges := make([]PushConstantRange, 1)
+	ranges[0].SetStageFlags(ShaderStageFlags(VK_SHADER_STAGE_COMPUTE_BIT))
+	ranges[0].SetSize(ComputePushConstantsSize)
+	plInfo := &PipelineLayoutCreateInfo{}
+	plInfo.SetDefaultSType()
+	plInfo.SetSetLayoutCount(1)
+	plInfo.PinPSetLayouts(arp, setLayouts)
+	plInfo.SetPushConstantRangeCount(1)
+	plInfo.PinPPushConstantRanges(arp, ranges)
+	var pipelineLayout PipelineLayout
+	if err := runner.device.CreatePipelineLayout(plInfo, nil, &pipelineLayout).AsErr(); err != nil {
+		return err
+	}
+	runner.pipelineLayout = pipelineLayout
+
+	sizes := make([]DescriptorPoolSize, 1)
+	sizes[0].SetType_(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER)
+	sizes[0].SetDescriptorCount(uint32(2 * slots))
+	dpInfo := &DescriptorPoolCreateInfo{}
+	dpInfo.SetDefaultSType()
+	dpInfo.SetMaxSets(uint32(slots))
+	dpInfo.SetPoolSizeCount(1)
+	dpInfo.PinPPoolSizes(arp, sizes)
+	var descriptorPool DescriptorPool
+	if err := runner.device.CreateDescriptorPool(dpInfo, nil, &descriptorPool).AsErr(); err != nil {
+		return err
+	}
+	runner.descriptorPool = descriptorPool
+
+	layouts := make([]DescriptorSetLayout, slots)
+	for h := range layouts {
+		layouts[h] = runner.setLayout
+	}
+	dsInfo := &DescriptorSetAllocateInfo{}
+	dsInfo.SetDefaultSType()
+	dsInfo.SetDescriptorPool(runner.descriptorPool)
+	dsInfo.SetDescriptorSetCount(uint32(slots))
+	dsInfo.PinPSetLayouts(arp, layouts)
+	sets := make([]DescriptorSet, slots)
+	if err := runner.device.AllocateDescriptorSets(dsInfo, sets).AsErr(); err != nil {
+		return err
+	}
+	runner.sets = sets
+
+	bufferInfos := make([]DescriptorBufferInfo, 2*slots)
+	writes := make([]WriteDescriptorSet, 2*slots)
+	for h := range writes {
+		bufferInfos[h].SetBuffer(runner.buffer)
+		bufferInfos[h].SetOffset(DeviceSize(h) * runner.stride)
+		bufferInfos[h].SetRange_(runner.slotSize)
+		writes[h].SetDefaultSType()
+		writes[h].SetDstSet(runner.sets[h/2])
+		writes[h].SetDstBinding(uint32(h % 2))
+		writes[h].SetDescriptorCount(1)
+		writes[h].SetDescriptorType(VK_DESCRIPTOR_TYPE_STORAGE_BUFFER)
+		writes[h].PinPBufferInfo(arp, bufferInfos[h:h+1])
+	}
+	runner.device.UpdateDescriptorSets(uint32(len(writes)), writes, 0, nil)
+	return nil
+}
+
+func (runner *ComputeRunner) createCommands(slots int) error {
+	var err error
+	if runner.computePool, err = runner.createCommandPool(runner.compute.Family); err != nil {
+		return err
+	}
+	runner.transferPool = runner.computePool
+	if runner.transfer.Family != runner.compute.Family {
+		if runner.transferPool, err = runner.createCommandPool(runner.transfer.Family); err != nil {
+			return err
+		}
+	}
+
+	pools := [computeStages]CommandPoolFacade{runner.transferPool, runner.computePool, runner.transferPool}
+	for stage, pool := range pools {
+		info := &CommandBufferAllocateInfo{}
+		info.SetDefaultSType()
+		info.SetCommandPool(pool.H)
+		info.SetLevel(VK_COMMAND_BUFFER_LEVEL_PRIMARY)
+		info.SetCommandBufferCount(uint32(slots))
+		handles := make([]CommandBuffer, slots)
+		if err := runner.device.AllocateCommandBuffers(info, handles).AsErr(); err != nil {
+			return err
+		}
+		for slot, handle := range handles {
+			runner.cmds[slot][stage] = pool.MakeCommandBufferFacade(handle)
+		}
+	}
+	return nil
+}
+
+func (runner *ComputeRunner) createCommandPool(family uint32) (CommandPoolFacade, error) {
+	info := &CommandPoolCreateInfo{}
+	info.SetDefaultSType()
+	info.SetFlags(CommandPoolCreateFlags(VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT))
+	info.SetQueueFamilyIndex(family)
+	var pool CommandPool
+	if err := runner.device.CreateCommandPool(info, nil, &pool).AsErr(); err != nil {
+		return CommandPoolFacade{}, err
+	}
+	return runner.device.MakeCommandPoolFacade(pool), nil
+}
+
+func (runner *ComputeRunner) createSync(caps *DeviceCapabilities) error {
+	arp := NewAutoReleaser()
+	defer arp.Release()
+
+	typeInfo := &SemaphoreTypeCreateInfo{}
+	typeInfo.SetDefaultSType()
+	typeInfo.SetSemaphoreType(VK_SEMAPHORE_TYPE_TIMELINE)
+	semInfo := &SemaphoreCreateInfo{}
+	semInfo.SetDefaultSType()
+	semInfo.PinPNext(arp, unsafe.Pointer(typeInfo))
+	for stage := range runner.timelines {
+		runner.timelines[stage] = make([]Semaphore, runner.devices)
+		for h := range runner.timelines[stage] {
+			var semaphore Semaphore
+			if err := runner.device.CreateSemaphore(semInfo, nil, &semaphore).AsErr(); err != nil {
+				return err
+			}
+			runner.timelines[stage][h] = semaphore
+		}
+	}
+
+	// Every stage waits for the previous stage of the same job, on the same
+	// physical device. The values and command buffers are patched per job.
+	stageMasks := [computeStages]PipelineStageFlags2{
+		PipelineStageFlags2(VK_PIPELINE_STAGE_2_COPY_BIT),
+		PipelineStageFlags2(VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT),
+		PipelineStageFlags2(VK_PIPELINE_STAGE_2_COPY_BIT),
+	}
+	for stage := range runner.submits {
+		infos := make([]PreparedSubmitInfo, runner.devices)
+		for h := range infos {
+			info := PreparedSubmitInfo{
+				CommandBuffers: make([]CommandBufferSubmitInfo, 1),
+				Signals:        make([]SemaphoreSubmitInfo, 1),
+			}
+			if runner.devices > 1 {
+				info.CommandBuffers[0].SetDeviceMask(1 << h)
+			}
+			info.Signals[0].SetSemaphore(runner.timelines[stage][h])
+			info.Signals[0].SetStageMask(PipelineStageFlags2(VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT))
+			info.Signals[0].SetDeviceIndex(uint32(h))
+			if stage > 0 {
+				info.Waits = make([]SemaphoreSubmitInfo, 1)
+				info.Waits[0].SetSemaphore(runner.timelines[stage-1][h])
+				info.Waits[0].SetStageMask(stageMasks[stage])
+				info.Waits[0].SetDeviceIndex(uint32(h))
+			}
+			infos[h] = info
+		}
+		runner.submits[stage] = NewPreparedSubmit(infos...)
+	}
+
+	// Timestamps are only taken when both families support them, and not
+	// on device groups, where every physical device has its own results.
+	limits := caps.Properties.LimitsView()
+	families := [computeStages]uint32{runner.transfer.Family, runner.compute.Family, runner.transfer.Family}
+	timestamps := limits.TimestampComputeAndGraphics().IsTrue() && runner.devices == 1
+	for stage, family := range families {
+		if int(family) >= len(caps.QueueFamilies) {
+			timestamps = false
+			break
+		}
+		bits := caps.QueueFamilies[family].TimestampValidBits()
+		if bits == 0 {
+			timestamps = false
+		} else if bits < 64 {
+			runner.timestampMask[stage] = 1<<bits - 1
+		} else {
+			runner.timestampMask[stage] = ^uint64(0)
+		}
+	}
+	if timestamps {
+		info := &QueryPoolCreateInfo{}
+		info.SetDefaultSType()
+		info.SetQueryType(VK_QUERY_TYPE_TIMESTAMP)
+		info.SetQueryCount(uint32(2 * computeStages * len(runner.jobs)))
+		var queryPool QueryPool
+		if err := runner.device.CreateQueryPool(info, nil, &queryPool).AsErr(); err != nil {
+			return err
+		}
+		runner.queryPool = queryPool
+		runner.timestampPeriod = float64(limits.TimestampPeriod())
+	}
+
+	runner.waitSem = unsafe.Slice((*Semaphore)(newCBlock(cULong(unsafe.Sizeof(NullSemaphore)*uintptr(runner.devices)))), runner.devices)
+	runner.waitValue = unsafe.Slice((*uint64)(newCBlock(cULong(unsafe.Sizeof(uint64(0))*uintptr(runner.devices)))), runner.devices)
+	copy(runner.waitSem, runner.timelines[computeReadback])
+	runner.waitInfo = SemaphoreWaitInfo{}.
+		WithDefaultSType().
+		WithPSemaphores(runner.waitSem).
+		WithPValues(runner.waitValue).
+		AsCPtr()
+	runner.invalid = MappedMemoryRange{}.
+		WithDefaultSType().
+		WithMemory(runner.readMemory).
+		AsCPtr()
+	return nil
+}
+
+// Submit queues the job, waiting up to timeout nanoseconds for the slot of
+// the job submitted InFlight jobs earlier. job.Output is filled by the time
+// Wait returns, and must not be accessed until then.
+func (runner *ComputeRunner) Submit(job *ComputeJob, timeout uint64) error {
+	if DeviceSize(len(job.Input)) > runner.slotSize || DeviceSize(len(job.Output)) > runner.slotSize {
+		return fmt.Errorf("error: compute job of %d input and %d output bytes exceeds the %d byte slots", len(job.Input), len(job.Output), runner.slotSize)
+	}
+	if len(job.PushConstants) > ComputePushConstantsSize {
+		return fmt.Errorf("error: compute job has %d bytes of push constants, at most %d are supported", len(job.PushConstants), ComputePushConstantsSize)
+	}
+	if job.Split && (job.GroupCount[0] == 0 || len(job.Output)%int(job.GroupCount[0]) != 0) {
+		return fmt.Errorf("error: split compute job output of %d bytes is not made of %d parts", len(job.Output), job.GroupCount[0])
+	}
+	pipeline, err := runner.pipeline(job)
+	if err != nil {
+		return err
+	}
+
+	seq := runner.next
+	slot := int(seq % uint64(len(runner.jobs)))
+	if seq >= uint64(len(runner.jobs)) {
+		if err := runner.collect(seq-uint64(len(runner.jobs)), timeout); err != nil {
+			return err
+		}
+	}
+	if runner.done == seq {
+		runner.start = time.Now()
+	}
+
+	if err := runner.ring.BeginFrame(timeout); err != nil {
+		return err
+	}
+	staging, err := runner.ring.Upload(job.Input, 4)
+	if err != nil {
+		return err
+	}
+	// The region is reused after the job is collected, so the upload of the
+	// first physical device is enough to guard it.
+	if err := runner.ring.EndFrameTimeline(runner.timelines[computeUpload][0], seq+1); err != nil {
+		return err
+	}
+
+	input := DeviceSize(2*slot) * runner.stride
+	output := input + runner.stride
+	readback := DeviceSize(slot) * runner.stride
+	cmds := &runner.cmds[slot]
+	if err := runner.record(cmds[computeUpload], slot, computeUpload, func(cmd CommandBufferFacade) {
+		if len(job.Input) > 0 {
+			regions := []BufferCopy{BufferCopy{}.WithSrcOffset(staging.Offset).WithDstOffset(input).WithSize(DeviceSize(len(job.Input)))}
+			cmd.CmdCopyBuffer(staging.Buffer, runner.buffer, 1, regions)
+		}
+	}); err != nil {
+		return err
+	}
+	if err := runner.record(cmds[computeDispatch], slot, computeDispatch, func(cmd CommandBufferFacade) {
+		cmd.CmdBindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, pipeline)
+		cmd.CmdBindDescriptorSets(VK_PIPELINE_BIND_POINT_COMPUTE, runner.pipelineLayout, 0, 1, runner.sets[slot:slot+1], 0, nil)
+		if len(job.PushConstants) > 0 {
+			cmd.CmdPushConstants(runner.pipelineLayout, ShaderStageFlags(VK_SHADER_STAGE_COMPUTE_BIT), 0, uint32(len(job.PushConstants)), unsafe.Pointer(&job.PushConstants[0]))
+		}
+		if runner.devices == 1 {
+			cmd.CmdDispatch(job.GroupCount[0], job.GroupCount[1], job.GroupCount[2])
+			return
+		}
+		for h := 0; h < runner.devices; h++ {
+			if first, last := runner.share(job, h); last > first {
+				cmd.CmdSetDeviceMask(1 << h)
+				cmd.CmdDispatchBase(first, 0, 0, last-first, job.GroupCount[1], job.GroupCount[2])
+			}
+		}
+	}); err != nil {
+		return err
+	}
+	if err := runner.record(cmds[computeReadback], slot, computeReadback, func(cmd CommandBufferFacade) {
+		for h := 0; h < runner.devices; h++ {
+			// Every physical device copies the part of the output it
+			// dispatched from its own instance of the buffer.
+			first, last := runner.outputShare(job, h)
+			if last == first {
+				continue
+			}
+			if runner.devices > 1 {
+				cmd.CmdSetDeviceMask(1 << h)
+			}
+			regions := []BufferCopy{BufferCopy{}.WithSrcOffset(output + first).WithDstOffset(readback + first).WithSize(last - first)}
+			cmd.CmdCopyBuffer(runner.buffer, runner.readBuffer, 1, regions)
+		}
+		if runner.devices > 1 {
+			cmd.CmdSetDeviceMask(1<<runner.devices - 1)
+		}
+		// Makes the copy visible to the host once the semaphore is waited.
+		barriers := []MemoryBarrier2{MemoryBarrier2{}.
+			WithDefaultSType().
+			WithSrcStageMask(PipelineStageFlags2(VK_PIPELINE_STAGE_2_COPY_BIT)).
+			WithSrcAccessMask(AccessFlags2(VK_ACCESS_2_TRANSFER_WRITE_BIT)).
+			WithDstStageMask(PipelineStageFlags2(VK_PIPELINE_STAGE_2_HOST_BIT)).
+			WithDstAccessMask(AccessFlags2(VK_ACCESS_2_HOST_READ_BIT))}
+		arp := NewAutoReleaser()
+		defer arp.Release()
+		dependency := DependencyInfo{}.WithDefaultSType()
+		dependency.PinPMemoryBarriers(arp, barriers)
+		cmd.CmdPipelineBarrier2(&dependency)
+	}); err != nil {
+		return err
+	}
+
+	// The readback of the previous job is submitted after this upload, so a
+	// shared transfer queue does not hold the upload behind a readback that
+	// waits for a dispatch.
+	if err := runner.submitStage(computeUpload, seq); err != nil {
+		return err
+	}
+	if err := runner.submitStage(computeDispatch, seq); err != nil {
+		return err
+	}
+	if err := runner.flushReadback(); err != nil {
+		return err
+	}
+	runner.jobs[slot] = job
+	runner.submitted[slot] = time.Now()
+	runner.next = seq + 1
+	runner.readback = true
+	return nil
+}
+
+// Run submits the jobs and waits for all of them to complete.
+func (runner *ComputeRunner) Run(jobs []*ComputeJob, timeout uint64) error {
+	for _, job := range jobs {
+		if err := runner.Submit(job, timeout); err != nil {
+			return err
+		}
+	}
+	return runner.Wait(timeout)
+}
+
+// Wait waits up to timeout nanoseconds for every submitted job to complete
+// and copies their outputs.
+func (runner *ComputeRunner) Wait(timeout uint64) error {
+	for runner.done < runner.next {
+		if err := runner.collect(runner.done, timeout); err != nil {
+			return err
+		}
+	}
+	return nil
+}
+
+// Completed returns the number of jobs completed and collected since the
+// runner was created. Jobs complete in submission order.
+func (runner *ComputeRunner) Completed() uint64 {
+	return runner.done
+}
+
+// Stats returns the statistics of the jobs completed since the runner was
+// created or the statistics were reset.
+func (runner *ComputeRunner) Stats() ComputeRunnerStats {
+	return runner.stats
+}
+
+// ResetStats clears the statistics.
+func (runner *ComputeRunner) ResetStats() {
+	runner.stats = ComputeRunnerStats{}
+	runner.start = time.Now()
+}
+
+// Destroy waits for the jobs in flight, then destroys the pipelines and every
+// object created by the runner. The queues are owned by the caller.
+func (runner *ComputeRunner) Destroy() {
+	runner.Wait(^uint64(0))
+	for _, pipeline := range runner.pipelines {
+		runner.device.DestroyPipeline(pipeline, nil)
+	}
+	runner.device.DestroyQueryPool(runner.queryPool, nil)
+	for stage := range runner.submits {
+		if runner.submits[stage] != nil {
+			runner.submits[stage].Free()
+		}
+		for _, semaphore := range runner.timelines[stage] {
+			runner.device.DestroySemaphore(semaphore, nil)
+		}
+	}
+	if runner.transferPool.H != runner.computePool.H {
+		runner.device.DestroyCommandPool(runner.transferPool.H, nil)
+	}
+	runner.device.DestroyCommandPool(runner.computePool.H, nil)
+	runner.device.DestroyDescriptorPool(runner.descriptorPool, nil)
+	runner.device.DestroyPipelineLayout(runner.pipelineLayout, nil)
+	runner.device.DestroyDescriptorSetLayout(runner.setLayout, nil)
+	if runner.readMapped != nil {
+		runner.device.UnmapMemory(runner.readMemory)
+		runner.readMapped = nil
+	}
+	runner.device.DestroyBuffer(runner.readBuffer, nil)
+	freeMemory(runner.device, runner.budget, runner.readMemory)
+	runner.device.DestroyBuffer(runner.buffer, nil)
+	freeMemory(runner.device, runner.budget, runner.memory)
+	if runner.ring != nil {
+		runner.ring.Destroy()
+	}
+	if runner.waitInfo != nil {
+		runner.waitInfo.Free()
+		cFreer(uintptr(unsafe.Pointer(&runner.waitSem[0]))).Free()
+		cFreer(uintptr(unsafe.Pointer(&runner.waitValue[0]))).Free()
+		runner.invalid.Free()
+	}
+	*runner = ComputeRunner{}
+}
+
+// cachedShader is the hash of the SPIR-V of cached pipelines.
+type cachedShader struct {
+	hash      [sha256.Size]byte
+	pipelines int // The cached pipelines using the shader.
+}
+
+// shaderCode returns the bytes of the job's SPIR-V.
+func shaderCode(job *ComputeJob) []byte {
+	return unsafe.Slice((*byte)(unsafe.Pointer(unsafe.SliceData(job.SPIRV))), 4*len(job.SPIRV))
+}
+
+// shaderHash returns the hash of the job's SPIR-V. The hashes of the shaders
+// of the cached pipelines are kept by content, so submitting them again only
+// costs a map lookup; the others are hashed every time.
+func (runner *ComputeRunner) shaderHash(job *ComputeJob) [sha256.Size]byte {
+	code := shaderCode(job)
+	if shader, ok := runner.shaders[string(code)]; ok {
+		return shader.hash
+	}
+	return sha256.Sum256(code)
+}
+
+// pipelineKey returns the cache key and entry point of the job's pipeline.
+func (runner *ComputeRunner) pipelineKey(job *ComputeJob) ([sha256.Size]byte, string) {
+	entry := job.EntryPoint
+	if len(entry) == 0 {
+		entry = "main"
+	}
+	code := runner.shaderHash(job)
+	hash := sha256.New()
+	hash.Write(code[:])
+	hash.Write([]byte(entry))
+	var constant [8]byte
+	for _, c := range job.Specialization {
+		binary.LittleEndian.PutUint32(constant[:4], c.ID)
+		binary.LittleEndian.PutUint32(constant[4:], c.Value)
+		hash.Write(constant[:])
+	}
+	var key [sha256.Size]byte
+	hash.Sum(key[:0])
+	return key, entry
+}
+
+// specializationInfo returns the specialization info of the constants, pinned
+// by arp.
+func specializationInfo(arp *AutoReleasePool, constants []SpecializationConstant) *SpecializationInfo {
+	n := len(constants)
+	entries := make([]SpecializationMapEntry, n)
+	data := make([]uint32, n)
+	for k, c := range constants {
+		entries[k].SetConstantID(c.ID)
+		entries[k].SetOffset(uint32(4 * k))
+		entries[k].SetSize(4)
+		data[k] = c.Value
+	}
+	spec := &SpecializationInfo{}
+	spec.SetMapEntryCount(uint32(n))
+	spec.PinPMapEntries(arp, entries)
+	spec.SetDataSize(uint64(4 * n))
+	spec.PinPData(arp, unsafe.Pointer(&data[0]))
+	return spec
+}
+
+// pipeline returns the cached pipeline of the job's shader and specialization,
+// creating it on first use.
+func (runner *ComputeRunner) pipeline(job *ComputeJob) (Pipeline, error) {
+	key, entry := runner.pipelineKey(job)
+	if pipeline, ok := runner.pipelines[key]; ok {
+		return pipeline, nil
+	}
+	if len(job.SPIRV) == 0 {
+		return NullPipeline, fmt.Errorf("error: compute job has no SPIR-V")
+	}
+
+	arp := NewAutoReleaser()
+	defer arp.Release()
+	smInfo := &ShaderModuleCreateInfo{}
+	smInfo.SetDefaultSType()
+	smInfo.SetCodeSize(uint64(4 * len(job.SPIRV)))
+	smInfo.PinPCode(arp, job.SPIRV)
+	var module ShaderModule
+	if err := runner.device.CreateShaderModule(smInfo, nil, &module).AsErr(); err != nil {
+		return NullPipeline, err
+	}
+	defer runner.device.DestroyShaderModule(module, nil)
+
+	stage := PipelineShaderStageCreateInfo{}.
+		WithDefaultSType().
+		WithStage(VK_SHADER_STAGE_COMPUTE_BIT).
+		WithModule(module).
+		WithPName(InternCStr(entry))
+	if len(job.Specialization) > 0 {
+		stage.PinPSpecializationInfo(arp, specializationInfo(arp, job.Specialization))
+	}
+	infos := make([]ComputePipelineCreateInfo, 1)
+	infos[0].SetDefaultSType()
+	infos[0].SetStage(stage)
+	infos[0].SetLayout(runner.pipelineLayout)
+	if runner.devices > 1 {
+		infos[0].SetFlags(PipelineCreateFlags(VK_PIPELINE_CREATE_DISPATCH_BASE_BIT))
+	}
+	pipelines := make([]Pipeline, 1)
+	if err := runner.device.CreateComputePipelines(runner.cache, 1, infos, nil, pipelines).AsErr(); err != nil {
+		return NullPipeline, err
+	}
+	runner.pipelines[key] = pipelines[0]
+	code := shaderCode(job)
+	shader, ok := runner.shaders[string(code)]
+	if !ok {
+		shader = &cachedShader{hash: sha256.Sum256(code)}
+		runner.shaders[string(code)] = shader
+	}
+	shader.pipelines++
+	return pipelines[0], nil
+}
+
+// releasePipeline destroys the cached pipeline of the job, if any. No job
+// using it may be in flight.
+func (runner *ComputeRunner) releasePipeline(job *ComputeJob) {
+	key, _ := runner.pipelineKey(job)
+	if pipeline, ok := runner.pipelines[key]; ok {
+		runner.device.DestroyPipeline(pipeline, nil)
+		delete(runner.pipelines, key)
+		code := shaderCode(job)
+		if shader := runner.shaders[string(code)]; shader != nil {
+			if shader.pipelines--; shader.pipelines == 0 {
+				delete(runner.shaders, string(code))
+			}
+		}
+	}
+}
+
+// record re-records the command buffer of a stage, bracketed with the stage
+// timestamps when they are supported.
+func (runner *ComputeRunner) record(cmd CommandBufferFacade, slot, stage int, commands func(CommandBufferFacade)) error {
+	if err := cmd.ResetCommandBuffer(0).AsErr(); err != nil {
+		return err
+	}
+	// On device groups, the command buffer is part of one submission per
+	// physical device.
+	usage := CommandBufferUsageFlags(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT)
+	if runner.devices > 1 {
+		usage = CommandBufferUsageFlags(VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT)
+	}
+	begin := CommandBufferBeginInfo{}.
+		WithDefaultSType().
+		WithFlags(usage)
+	if err := cmd.BeginCommandBuffer(&begin).AsErr(); err != nil {
+		return err
+	}
+	query := uint32(2 * (slot*computeStages + stage))
+	if runner.queryPool != NullQueryPool {
+		cmd.CmdResetQueryPool(runner.queryPool, query, 2)
+		cmd.CmdWriteTimestamp2(PipelineStageFlags2(VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT), runner.queryPool, query)
+	}
+	commands(cmd)
+	if runner.queryPool != NullQueryPool {
+		cmd.CmdWriteTimestamp2(PipelineStageFlags2(VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT), runner.queryPool, query+1)
+	}
+	return cmd.EndCommandBuffer().AsErr()
+}
+
+// share returns the range of X workgroups of the job dispatched by the
+// physical device at index device of the group. Jobs that are not split run
+// on the first physical device.
+func (runner *ComputeRunner) share(job *ComputeJob, device int) (uint32, uint32) {
+	switch {
+	case job.Split:
+		n, d := uint64(job.GroupCount[0]), uint64(runner.devices)
+		return uint32(n * uint64(device) / d), uint32(n * uint64(device+1) / d)
+	case device == 0:
+		return 0, job.GroupCount[0]
+	}
+	return 0, 0
+}
+
+// outputShare returns the range of output bytes written by the workgroups of
+// share.
+func (runner *ComputeRunner) outputShare(job *ComputeJob, device int) (DeviceSize, DeviceSize) {
+	size := DeviceSize(len(job.Output))
+	if !job.Split {
+		if device == 0 {
+			return 0, size
+		}
+		return 0, 0
+	}
+	first, last := runner.share(job, device)
+	part := size / DeviceSize(job.GroupCount[0])
+	return DeviceSize(first) * part, DeviceSize(last) * part
+}
+
+func (runner *ComputeRunner) submitStage(stage int, seq uint64) error {
+	slot := int(seq % uint64(len(runner.jobs)))
+	ps := runner.submits[stage]
+	for h := 0; h < runner.devices; h++ {
+		ps.SetCommandBuffer(h, 0, runner.cmds[slot][stage].H)
+		ps.SetSignalValue(h, 0, seq+1)
+		if stage > 0 {
+			ps.SetWaitValue(h, 0, seq+1)
+		}
+	}
+	queue := runner.transfer.Queue
+	if stage == computeDispatch {
+		queue = runner.compute.Queue
+	}
+	return ps.Submit(queue, NullFence).AsErr()
+}
+
+func (runner *ComputeRunner) flushReadback() error {
+	if !runner.readback {
+		return nil
+	}
+	runner.readback = false
+	return runner.submitStage(computeReadback, runner.next-1)
+}
+
+// collect waits for the readback of the job, copies its output and updates
+// the statistics. Jobs are collected in order.
+func (runner *ComputeRunner) collect(seq uint64, timeout uint64) error {
+	if seq < runner.done {
+		return nil
+	}
+	if seq+1 == runner.next {
+		if err := runner.flushReadback(); err != nil {
+			return err
+		}
+	}
+	for h := range runner.waitValue {
+		runner.waitValue[h] = seq + 1
+	}
+	if err := runner.device.WaitSemaphores(runner.waitInfo, timeout).AsErr(); err != nil {
+		return err
+	}
+
+	slot := int(seq % uint64(len(runner.jobs)))
+	job := runner.jobs[slot]
+	base := DeviceSize(slot) * runner.stride
+	if !runner.readCoherent && len(job.Output) > 0 {
+		runner.invalid.SetOffset(base)
+		runner.invalid.SetSize(alignDeviceSize(DeviceSize(len(job.Output)), runner.atomSize))
+		if err := runner.device.InvalidateMappedMemoryRanges(1, unsafe.Slice(runner.invalid, 1)).AsErr(); err != nil {
+			return err
+		}
+	}
+	CopyFromMapped(job.Output, runner.readMapped[base:base+DeviceSize(len(job.Output))], runner.readFlags)
+	runner.jobs[slot] = nil
+	runner.done = seq + 1
+
+	now := time.Now()
+	stats := &runner.stats
+	stats.Jobs++
+	stats.Bytes += uint64(len(job.Input) + len(job.Output))
+	stats.Elapsed += now.Sub(runner.start)
+	runner.start = now
+	stats.Latency.add(now.Sub(runner.submitted[slot]))
+	if runner.queryPool != NullQueryPool {
+		var ticks [2 * computeStages]uint64
+		first := uint32(2 * computeStages * slot)
+		result := runner.device.GetQueryPoolResults(runner.queryPool, first, 2*computeStages, uint64(unsafe.Sizeof(ticks)), unsafe.Pointer(&ticks), 8, QueryResultFlags(VK_QUERY_RESULT_64_BIT))
+		if result == VK_SUCCESS {
+			stages := [computeStages]*ComputeStageStats{&stats.Upload, &stats.Dispatch, &stats.Readback}
+			for stage, stageStats := range stages {
+				mask := runner.timestampMask[stage]
+				elapsed := (ticks[2*stage+1] - ticks[2*stage]) & mask
+				stageStats.add(time.Duration(float64(elapsed) * runner.timestampPeriod))
+			}
+		}
+	}
+	return nil
+}
@@ -0,0 +1,115 @@
+//go:build !vks_no_version_1_3 && !vks_no_version_1_1 && !vks_no_version_1_2
+
+package vks
+
+import "testing"
+
+// nullComputeRunner creates a runner on the queue of the null driver.
+func nullComputeRunner(t *testing.T, inFlight int) *ComputeRunner {
+	pd := nullPhysicalDevice(t)
+	device := nullDeviceOf(t, pd)
+	caps := QueryDeviceCapabilities(pd)
+	family, ok := caps.FindQueueFamily(QueueFlags(VK_QUEUE_COMPUTE_BIT))
+	if !ok {
+		t.Fatal("error: no compute queue family")
+	}
+	var queue Queue
+	device.GetDeviceQueue(family, 0, &queue)
+	runner, err := NewComputeRunner(device, caps, ComputeRunnerConfig{
+		Compute:  ComputeQueue{Queue: device.MakeQueueFacade(queue), Family: family},
+		InFlight: inFlight,
+		SlotSize: 1024,
+	})
+	if err != nil {
+		t.Fatal(err)
+	}
+	t.Cleanup(runner.Destroy)
+	return runner
+}
+
+func TestComputeRunner(t *testing.T) {
+	runner := nullComputeRunner(t, 2)
+	shaderA := []uint32{0x07230203, 0x00010000, 1}
+	shaderB := []uint32{0x07230203, 0x00010000, 2}
+	var jobs []*ComputeJob
+	for k := 0; k < 5; k++ {
+		job := &ComputeJob{
+			SPIRV:      shaderA,
+			GroupCount: [3]uint32{1, 1, 1},
+			Input:      make([]byte, 64),
+			Output:     make([]byte, 32),
+		}
+		if k%2 == 1 {
+			job.SPIRV = shaderB
+		}
+		jobs = append(jobs, job)
+	}
+	if err := runner.Run(jobs, ^uint64(0)); err != nil {
+		t.Fatal(err)
+	}
+	if n := runner.Completed(); n != 5 {
+		t.Errorf("completed %d jobs, want 5", n)
+	}
+	stats := runner.Stats()
+	if stats.Jobs != 5 || stats.Bytes != 5*96 || stats.Latency.Count != 5 {
+		t.Errorf("stats count %d jobs, %d bytes and %d latencies, want 5, %d and 5", stats.Jobs, stats.Bytes, stats.Latency.Count, 5*96)
+	}
+	if len(runner.pipelines) != 2 || len(runner.shaders) != 2 {
+		t.Errorf("cached %d pipelines of %d shaders, want 2 of 2", len(runner.pipelines), len(runner.shaders))
+	}
+
+	// Another specialization of a shader has its own pipeline.
+	special := *jobs[0]
+	special.Specialization = []SpecializationConstant{{ID: 0, Value: 64}}
+	if err := runner.Submit(&special, ^uint64(0)); err != nil {
+		t.Fatal(err)
+	}
+	// The pipelines are cached by the content of the SPIR-V, not the slice
+	// holding it.
+	shaderB[2] = 3
+	if err := runner.Submit(jobs[1], ^uint64(0)); err != nil {
+		t.Fatal(err)
+	}
+	copied := *jobs[0]
+	copied.SPIRV = append([]uint32(nil), shaderA...)
+	if err := runner.Submit(&copied, ^uint64(0)); err != nil {
+		t.Fatal(err)
+	}
+	if err := runner.Wait(^uint64(0)); err != nil {
+		t.Fatal(err)
+	}
+	if len(runner.pipelines) != 4 || len(runner.shaders) != 3 {
+		t.Errorf("cached %d pipelines of %d shaders, want 4 of 3", len(runner.pipelines), len(runner.shaders))
+	}
+
+	runner.releasePipeline(&special)
+	if len(runner.pipelines) != 3 || len(runner.shaders) != 3 {
+		t.Errorf("cached %d pipelines of %d shaders after a release, want 3 of 3", len(runner.pipelines), len(runner.shaders))
+	}
+	runner.releasePipeline(jobs[0])
+	if len(runner.pipelines) != 2 || len(runner.shaders) != 2 {
+		t.Errorf("cached %d pipelines of %d shaders after the last release of a shader, want 2 of 2", len(runner.pipelines), len(runner.shaders))
+	}
+
+	runner.ResetStats()
+	if stats := runner.Stats(); stats.Jobs != 0 || stats.Latency.Count != 0 {
+		t.Errorf("reset stats count %d jobs", stats.Jobs)
+	}
+}
+
+func TestComputeRunnerLimits(t *testing.T) {
+	runner := nullComputeRunner(t, 1)
+	for _, job := range []*ComputeJob{
+		{SPIRV: []uint32{1}, Input: make([]byte, 2048)},
+		{SPIRV: []uint32{1}, PushConstants: make([]byte, ComputePushConstantsSize+1)},
+		{SPIRV: []uint32{1}, Output: make([]byte, 10), GroupCount: [3]uint32{3, 1, 1}, Split: true},
+		{},
+	} {
+		if err := runner.Submit(job, ^uint64(0)); err == nil {
+			t.Errorf("submitted invalid job %+v", job)
+		}
+	}
+	if n := runner.Completed(); n != 0 {
+		t.Errorf("completed %d invalid jobs", n)
+	}
+}
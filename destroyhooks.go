@@ -0,0 +1,70 @@
+package vks
+
+import (
+	"sync"
+	"sync/atomic"
+)
+
+// HandleDestroyedFunc is called with the object type and handle of every
+// object destroyed or freed through a DeviceFacade or InstanceFacade.
+type HandleDestroyedFunc func(objectType ObjectType, handle uint64)
+
+type destroyHook struct {
+	id uint64
+	fn HandleDestroyedFunc
+}
+
+var (
+	// destroyHooks is nil without hooks, so the destroy commands only pay
+	// for an atomic load. Changes copy the slice under destroyHooksLock.
+	destroyHooks     atomic.Pointer[[]destroyHook]
+	destroyHooksLock sync.Mutex
+	destroyHookID    uint64
+)
+
+// OnHandleDestroyed registers fn to be called by the vkDestroy* and vkFree*
+// commands, for every handle they release, before the handle is released.
+// vkResetDescriptorPool reports the pool, as it frees every set of the pool.
+// vkDestroyDevice and vkDestroyInstance are not reported. fn may be called
+// from any goroutine issuing those commands. The returned function removes
+// the hook.
+func OnHandleDestroyed(fn HandleDestroyedFunc) (remove func()) {
+	destroyHooksLock.Lock()
+	defer destroyHooksLock.Unlock()
+	destroyHookID++
+	id := destroyHookID
+	var hooks []destroyHook
+	if current := destroyHooks.Load(); current != nil {
+		hooks = append(hooks, *current...)
+	}
+	hooks = append(hooks, destroyHook{id, fn})
+	destroyHooks.Store(&hooks)
+
+	return func() {
+		destroyHooksLock.Lock()
+		defer destroyHooksLock.Unlock()
+		current := destroyHooks.Load()
+		if current == nil {
+			return
+		}
+		var hooks []destroyHook
+		for _, hook := range *current {
+			if hook.id != id {
+				hooks = append(hooks, hook)
+			}
+		}
+		if len(hooks) == 0 {
+			destroyHooks.Store(nil)
+		} else {
+			destroyHooks.Store(&hooks)
+		}
+	}
+}
+
+func handleDestroyed(objectType ObjectType, handle uint64) {
+	if hooks := destroyHooks.Load(); hooks != nil {
+		for _, hook := range *hooks {
+			hook.fn(objectType, handle)
+		}
+	}
+}
@@ -99,6 +99,22 @@ func (device DeviceFacade) CopyFromMemory(memory DeviceMemory, offset, size Devi
 	return n, nil
 }
 
+// FindMemoryTypeIndex returns the index of the first memory type that is
+// allowed by typeBits (usually MemoryRequirements.MemoryTypeBits) and has all
+// of the required property flags. The boolean is false when nothing matches.
+func FindMemoryTypeIndex(memProps *PhysicalDeviceMemoryProperties, typeBits uint32, required MemoryPropertyFlags) (uint32, bool) {
+	types := memProps.MemoryTypes()
+	for h := uint32(0); h < memProps.MemoryTypeCount(); h++ {
+		if typeBits&(1<<h) == 0 {
+			continue
+		}
+		if types[h].PropertyFlags()&required == required {
+			return h, true
+		}
+	}
+	return 0, false
+}
+
 // Should this be under Device? seems like unions need a better solution all
 // around.
 //
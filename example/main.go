@@ -47,11 +47,10 @@ func main() {
 		log.Printf("Extension%02d %v (%v)", k, name, instExt.SpecVersion())
 	}
 
-	if result := vks.EnumerateInstanceLayerProperties(&count, nil); !result.IsSuccess() {
-		panic(result.AsErr())
-	}
-	instanceLayers := make([]vks.LayerProperties, count)
-	if result := vks.EnumerateInstanceLayerProperties(&count, instanceLayers); !result.IsSuccess() {
+	// Example of the same enumeration in a single call. The slice passed in
+	// is reused when it is large enough.
+	instanceLayers, result := vks.EnumerateInstanceLayerPropertiesInto(nil)
+	if !result.IsSuccess() {
 		panic(result.AsErr())
 	}
 	for k, instLay := range instanceLayers {
@@ -90,11 +89,8 @@ func main() {
 	instance := vks.MakeInstanceFacade(vkInstance)
 	defer instance.DestroyInstance(nil)
 
-	if result := instance.EnumeratePhysicalDevices(&count, nil); !result.IsSuccess() {
-		panic(result.AsErr())
-	}
-	phyDevs := make([]vks.PhysicalDevice, count)
-	if result := instance.EnumeratePhysicalDevices(&count, phyDevs); !result.IsSuccess() {
+	phyDevs, result := instance.EnumeratePhysicalDevicesInto(nil)
+	if !result.IsSuccess() {
 		panic(result.AsErr())
 	}
 
@@ -112,11 +108,11 @@ func main() {
 
 		phyDev.GetPhysicalDeviceProperties2(props)
 
-		name := vks.ToString(props.Properties().DeviceName())
-		apiVersion := vks.ApiVersion(props.Properties().ApiVersion())
-		devType := props.Properties().DeviceType()
-		driverVersion := vks.ApiVersion(props.Properties().DriverVersion())
-		vendorId := props.Properties().VendorID()
+		name := vks.ToString(props.PropertiesView().DeviceName())
+		apiVersion := vks.ApiVersion(props.PropertiesView().ApiVersion())
+		devType := props.PropertiesView().DeviceType()
+		driverVersion := vks.ApiVersion(props.PropertiesView().DriverVersion())
+		vendorId := props.PropertiesView().VendorID()
 		driverInfo := vks.ToString(driverProps.DriverInfo())
 		driverName := vks.ToString(driverProps.DriverName())
 
@@ -130,15 +126,15 @@ func main() {
 
 		phyDev.GetPhysicalDeviceMemoryProperties2(memProps)
 
-		log.Printf("\tmemory: typeCount %d", memProps.MemoryProperties().MemoryTypeCount())
-		for j := uint32(0); j < memProps.MemoryProperties().MemoryTypeCount(); j++ {
-			mt := memProps.MemoryProperties().MemoryTypes()[j]
+		log.Printf("\tmemory: typeCount %d", memProps.MemoryPropertiesView().MemoryTypeCount())
+		for j := uint32(0); j < memProps.MemoryPropertiesView().MemoryTypeCount(); j++ {
+			mt := memProps.MemoryPropertiesView().MemoryTypes()[j]
 			log.Printf("\t\ttypeIndex: %d; propFlags: %d; heapIndex: %d", j,
 				mt.PropertyFlags(), mt.HeapIndex())
 		}
-		log.Printf("\tmemory: heapCount %d", memProps.MemoryProperties().MemoryHeapCount())
-		for j := uint32(0); j < memProps.MemoryProperties().MemoryHeapCount(); j++ {
-			mh := memProps.MemoryProperties().MemoryHeaps()[j]
+		log.Printf("\tmemory: heapCount %d", memProps.MemoryPropertiesView().MemoryHeapCount())
+		for j := uint32(0); j < memProps.MemoryPropertiesView().MemoryHeapCount(); j++ {
+			mh := memProps.MemoryPropertiesView().MemoryHeaps()[j]
 			log.Printf("\t\theapIndex: %d; flags: %d; size: %d", j,
 				mh.Flags(), mh.Size())
 		}
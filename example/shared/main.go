@@ -0,0 +1,216 @@
+// Command shared hands a buffer and a timeline semaphore to a second process
+// over a Unix socket, without copying the buffer. Run it without arguments:
+// it starts the consumer itself. It runs on any driver with
+// VK_KHR_external_memory_fd and VK_KHR_external_semaphore_fd, like lavapipe.
+package main
+
+import (
+	"bytes"
+	"log"
+	"net"
+	"os"
+	"os/exec"
+	"syscall"
+	"unsafe"
+
+	"github.com/ibd1279/vks"
+)
+
+const bufferSize = 1 << 20
+
+func main() {
+	if ret := vks.Init(); !ret.IsSuccess() {
+		log.Fatal(ret.AsErr())
+	}
+	defer vks.Destroy()
+
+	arp := vks.NewAutoReleaser()
+	defer arp.Release()
+	appInfo := &vks.ApplicationInfo{}
+	appInfo.SetDefaultSType()
+	appInfo.SetApiVersion(uint32(vks.VK_API_VERSION_1_3))
+	instanceInfo := &vks.InstanceCreateInfo{}
+	instanceInfo.SetDefaultSType()
+	instanceInfo.PinPApplicationInfo(arp, appInfo)
+	var vkInstance vks.Instance
+	if err := vks.CreateInstance(instanceInfo, nil, &vkInstance).AsErr(); err != nil {
+		log.Fatal(err)
+	}
+	instance := vks.MakeInstanceFacade(vkInstance)
+	defer instance.DestroyInstance(nil)
+	physicals, result := instance.EnumeratePhysicalDevicesInto(nil)
+	if !result.IsSuccess() || len(physicals) == 0 {
+		log.Fatal("no physical device")
+	}
+	// Both processes must pick the same physical device.
+	pd := instance.MakePhysicalDeviceFacade(physicals[0])
+	caps := vks.QueryDeviceCapabilities(pd)
+
+	priorities := []float32{1}
+	queueInfos := make([]vks.DeviceQueueCreateInfo, 1)
+	queueInfos[0].SetDefaultSType()
+	queueInfos[0].PinPQueuePriorities(arp, priorities)
+	features12 := &vks.PhysicalDeviceVulkan12Features{}
+	features12.SetDefaultSType()
+	features12.SetTimelineSemaphore(vks.VK_TRUE)
+	deviceInfo := vks.CPtr(arp, &vks.DeviceCreateInfo{},
+		vks.SetDefaultSType,
+		vks.SetDeviceExtensions(arp, []string{
+			vks.VK_KHR_EXTERNAL_MEMORY_FD_EXTENSION_NAME,
+			vks.VK_KHR_EXTERNAL_SEMAPHORE_FD_EXTENSION_NAME,
+		}),
+	)
+	deviceInfo.PinPNext(arp, unsafe.Pointer(features12))
+	deviceInfo.PinPQueueCreateInfos(arp, queueInfos)
+	var vkDevice vks.Device
+	if err := pd.CreateDevice(deviceInfo, nil, &vkDevice).AsErr(); err != nil {
+		log.Fatal(err)
+	}
+	device := pd.MakeDeviceFacade(vkDevice)
+	defer device.DestroyDevice(nil)
+
+	if len(os.Args) > 1 {
+		consume(device, caps)
+	} else {
+		produce(device, caps)
+	}
+}
+
+func pattern() []byte {
+	data := make([]byte, bufferSize)
+	for k := range data {
+		data[k] = byte(k * 7)
+	}
+	return data
+}
+
+// wait waits on the host for the timeline to reach value. A consumer on the
+// GPU would wait in its queue submission instead.
+func wait(device vks.DeviceFacade, timeline vks.Semaphore, value uint64) {
+	arp := vks.NewAutoReleaser()
+	defer arp.Release()
+	info := &vks.SemaphoreWaitInfo{}
+	info.SetDefaultSType()
+	info.PinPSemaphores(arp, []vks.Semaphore{timeline})
+	info.PinPValues(arp, []uint64{value})
+	if err := device.WaitSemaphores(info, ^uint64(0)).AsErr(); err != nil {
+		log.Fatal(err)
+	}
+}
+
+func signal(device vks.DeviceFacade, timeline vks.Semaphore, value uint64) {
+	info := &vks.SemaphoreSignalInfo{}
+	info.SetDefaultSType()
+	info.SetSemaphore(timeline)
+	info.SetValue(value)
+	if err := device.SignalSemaphore(info).AsErr(); err != nil {
+		log.Fatal(err)
+	}
+}
+
+// produce fills a shared buffer, hands it to the consumer and signals the
+// timeline once it is written.
+func produce(device vks.DeviceFacade, caps *vks.DeviceCapabilities) {
+	fds, err := syscall.Socketpair(syscall.AF_UNIX, syscall.SOCK_STREAM|syscall.SOCK_CLOEXEC, 0)
+	if err != nil {
+		log.Fatal(err)
+	}
+	child := os.NewFile(uintptr(fds[1]), "consumer")
+	cmd := exec.Command(os.Args[0], "consumer")
+	cmd.ExtraFiles = []*os.File{child}
+	cmd.Stdout, cmd.Stderr = os.Stdout, os.Stderr
+	if err := cmd.Start(); err != nil {
+		log.Fatal(err)
+	}
+	child.Close()
+	conn := unixConn(fds[0])
+	defer conn.Close()
+
+	hostVisible := vks.MemoryPropertyFlags(vks.VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | vks.VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+	shared, err := device.CreateSharedBuffer(caps, bufferSize, vks.BufferUsageFlags(vks.VK_BUFFER_USAGE_STORAGE_BUFFER_BIT), hostVisible)
+	if err != nil {
+		log.Fatal(err)
+	}
+	defer device.DestroySharedBuffer(shared)
+	timeline, err := device.CreateSharedTimeline(0)
+	if err != nil {
+		log.Fatal(err)
+	}
+	defer device.DestroySemaphore(timeline, nil)
+
+	memoryFd, err := device.ExportMemoryFd(shared.Memory)
+	if err != nil {
+		log.Fatal(err)
+	}
+	timelineFd, err := device.ExportSemaphoreFd(timeline)
+	if err != nil {
+		log.Fatal(err)
+	}
+	err = vks.SendShared(conn, vks.SharedMessage{
+		Buffer:      shared.Info,
+		Value:       1,
+		HasMemory:   true,
+		MemoryFd:    memoryFd,
+		HasTimeline: true,
+		TimelineFd:  timelineFd,
+	})
+	syscall.Close(memoryFd)
+	syscall.Close(timelineFd)
+	if err != nil {
+		log.Fatal(err)
+	}
+
+	if _, err := device.CopyToMemoryType(shared.Memory, shared.Flags, 0, bufferSize, 0, pattern()); err != nil {
+		log.Fatal(err)
+	}
+	signal(device, timeline, 1)
+	// The consumer signals 2 once it read the buffer.
+	wait(device, timeline, 2)
+	if err := cmd.Wait(); err != nil {
+		log.Fatal(err)
+	}
+	log.Printf("producer: consumer read %d bytes", bufferSize)
+}
+
+// consume imports the buffer and the timeline, waits for the producer, and
+// checks the buffer.
+func consume(device vks.DeviceFacade, caps *vks.DeviceCapabilities) {
+	conn := unixConn(3)
+	defer conn.Close()
+	msg, err := vks.ReceiveShared(conn)
+	if err != nil {
+		log.Fatal(err)
+	}
+	timeline, err := device.ImportSharedTimeline(msg.TimelineFd)
+	if err != nil {
+		syscall.Close(msg.MemoryFd)
+		log.Fatal(err)
+	}
+	defer device.DestroySemaphore(timeline, nil)
+	shared, err := device.ImportSharedBuffer(caps, msg.Buffer, msg.MemoryFd)
+	if err != nil {
+		log.Fatal(err)
+	}
+	defer device.DestroySharedBuffer(shared)
+
+	wait(device, timeline, msg.Value)
+	data := make([]byte, bufferSize)
+	if _, err := device.CopyFromMemoryType(shared.Memory, shared.Flags, 0, bufferSize, 0, data); err != nil {
+		log.Fatal(err)
+	}
+	if !bytes.Equal(data, pattern()) {
+		log.Fatal("consumer: shared buffer differs")
+	}
+	log.Printf("consumer: shared buffer matches")
+	signal(device, timeline, msg.Value+1)
+}
+
+func unixConn(fd int) *net.UnixConn {
+	f := os.NewFile(uintptr(fd), "socket")
+	defer f.Close()
+	conn, err := net.FileConn(f)
+	if err != nil {
+		log.Fatal(err)
+	}
+	return conn.(*net.UnixConn)
+}
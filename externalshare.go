@@ -0,0 +1,376 @@
+//go:build unix && !vks_no_version_1_3 && !vks_no_version_1_1 && !vks_no_version_1_2 && !vks_no_khr_external_memory_fd && !vks_no_khr_external_semaphore_fd
+
+package vks
+
+import (
+	"bytes"
+	"encoding/binary"
+	"fmt"
+	"io"
+	"net"
+	"syscall"
+	"unsafe"
+)
+
+// SharedBufferInfo is what another process needs to import a shared buffer.
+// Memory can only be imported by a device with the same device and driver
+// UUIDs as the exporting one.
+type SharedBufferInfo struct {
+	Size            DeviceSize       // The buffer size.
+	AllocationSize  DeviceSize       // The size of the exported memory.
+	Usage           BufferUsageFlags // The buffer usage.
+	MemoryTypeIndex uint32
+	DeviceUUID      [16]byte
+	DriverUUID      [16]byte
+}
+
+// SharedBuffer is a buffer bound to dedicated memory that can be exported to,
+// or was imported from, another process as an opaque file descriptor.
+type SharedBuffer struct {
+	Buffer Buffer
+	Memory DeviceMemory
+	Flags  MemoryPropertyFlags // The properties of the memory type.
+	Info   SharedBufferInfo
+}
+
+// createSharedBuffer creates a buffer that can be bound to memory shared as an
+// opaque file descriptor.
+func (device DeviceFacade) createSharedBuffer(size DeviceSize, usage BufferUsageFlags) (Buffer, error) {
+	arp := NewAutoReleaser()
+	defer arp.Release()
+	external := &ExternalMemoryBufferCreateInfo{}
+	external.SetDefaultSType()
+	external.SetHandleTypes(ExternalMemoryHandleTypeFlags(VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT))
+	info := &BufferCreateInfo{}
+	info.SetDefaultSType()
+	info.PinPNext(arp, unsafe.Pointer(external))
+	info.SetSize(size)
+	info.SetUsage(usage)
+	info.SetSharingMode(VK_SHARING_MODE_EXCLUSIVE)
+	var buffer Buffer
+	if err := device.CreateBuffer(info, nil, &buffer).AsErr(); err != nil {
+		return NullBuffer, err
+	}
+	return buffer, nil
+}
+
+// CreateSharedBuffer creates a buffer bound to dedicated memory exportable
+// with ExportMemoryFd, of a memory type with the preferred properties when
+// possible. The device must be created with VK_KHR_external_memory_fd.
+func (device DeviceFacade) CreateSharedBuffer(caps *DeviceCapabilities, size DeviceSize, usage BufferUsageFlags, preferred MemoryPropertyFlags) (*SharedBuffer, error) {
+	buffer, err := device.createSharedBuffer(size, usage)
+	if err != nil {
+		return nil, err
+	}
+	var reqs MemoryRequirements
+	device.GetBufferMemoryRequirements(buffer, &reqs)
+	// The types with the preferred properties first, then any other.
+	candidates := memoryTypeCandidates(&caps.Memory, reqs.MemoryTypeBits(), preferred, 0)
+	for _, typeIndex := range memoryTypeCandidates(&caps.Memory, reqs.MemoryTypeBits(), 0, 0) {
+		if caps.Memory.MemoryTypes()[typeIndex].PropertyFlags()&preferred != preferred {
+			candidates = append(candidates, typeIndex)
+		}
+	}
+	if len(candidates) == 0 {
+		device.DestroyBuffer(buffer, nil)
+		return nil, fmt.Errorf("error: no memory type in %032b", reqs.MemoryTypeBits())
+	}
+
+	arp := NewAutoReleaser()
+	defer arp.Release()
+	dedicated := &MemoryDedicatedAllocateInfo{}
+	dedicated.SetDefaultSType()
+	dedicated.SetBuffer(buffer)
+	export := &ExportMemoryAllocateInfo{}
+	export.SetDefaultSType()
+	export.SetHandleTypes(ExternalMemoryHandleTypeFlags(VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT))
+	export.PinPNext(arp, unsafe.Pointer(dedicated))
+	aInfo := &MemoryAllocateInfo{}
+	aInfo.SetDefaultSType()
+	aInfo.PinPNext(arp, unsafe.Pointer(export))
+	aInfo.SetAllocationSize(reqs.Size())
+	var memory DeviceMemory
+	var typeIndex uint32
+	result := VK_ERROR_OUT_OF_DEVICE_MEMORY
+	for _, typeIndex = range candidates {
+		aInfo.SetMemoryTypeIndex(typeIndex)
+		result = device.AllocateMemory(aInfo, nil, &memory)
+		if result != VK_ERROR_OUT_OF_DEVICE_MEMORY && result != VK_ERROR_OUT_OF_HOST_MEMORY {
+			break
+		}
+	}
+	if err := result.AsErr(); err != nil {
+		device.DestroyBuffer(buffer, nil)
+		return nil, err
+	}
+	if err := device.BindBufferMemory(buffer, memory, 0).AsErr(); err != nil {
+		device.DestroyBuffer(buffer, nil)
+		device.FreeMemory(memory, nil)
+		return nil, err
+	}
+
+	shared := &SharedBuffer{
+		Buffer: buffer,
+		Memory: memory,
+		Flags:  caps.Memory.MemoryTypes()[typeIndex].PropertyFlags(),
+		Info: SharedBufferInfo{
+			Size:            size,
+			AllocationSize:  reqs.Size(),
+			Usage:           usage,
+			MemoryTypeIndex: typeIndex,
+		},
+	}
+	copy(shared.Info.DeviceUUID[:], caps.IDProperties.DeviceUUID())
+	copy(shared.Info.DriverUUID[:], caps.IDProperties.DriverUUID())
+	return shared, nil
+}
+
+// ImportSharedBuffer imports a buffer shared by another process. It takes
+// ownership of fd, which is closed when the import fails.
+func (device DeviceFacade) ImportSharedBuffer(caps *DeviceCapabilities, info SharedBufferInfo, fd int) (*SharedBuffer, error) {
+	if !bytes.Equal(info.DeviceUUID[:], caps.IDProperties.DeviceUUID()) || !bytes.Equal(info.DriverUUID[:], caps.IDProperties.DriverUUID()) {
+		syscall.Close(fd)
+		return nil, fmt.Errorf("error: shared buffer exported by another device or driver")
+	}
+	if info.MemoryTypeIndex >= caps.Memory.MemoryTypeCount() {
+		syscall.Close(fd)
+		return nil, fmt.Errorf("error: shared buffer memory type %d out of range", info.MemoryTypeIndex)
+	}
+	buffer, err := device.createSharedBuffer(info.Size, info.Usage)
+	if err != nil {
+		syscall.Close(fd)
+		return nil, err
+	}
+
+	arp := NewAutoReleaser()
+	defer arp.Release()
+	dedicated := &MemoryDedicatedAllocateInfo{}
+	dedicated.SetDefaultSType()
+	dedicated.SetBuffer(buffer)
+	imported := &ImportMemoryFdInfoKHR{}
+	imported.SetDefaultSType()
+	imported.SetHandleType(VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT)
+	imported.SetFd(int32(fd))
+	imported.PinPNext(arp, unsafe.Pointer(dedicated))
+	aInfo := &MemoryAllocateInfo{}
+	aInfo.SetDefaultSType()
+	aInfo.PinPNext(arp, unsafe.Pointer(imported))
+	aInfo.SetAllocationSize(info.AllocationSize)
+	aInfo.SetMemoryTypeIndex(info.MemoryTypeIndex)
+	var memory DeviceMemory
+	if err := device.AllocateMemory(aInfo, nil, &memory).AsErr(); err != nil {
+		device.DestroyBuffer(buffer, nil)
+		syscall.Close(fd)
+		return nil, err
+	}
+	// The driver owns fd from here.
+	if err := device.BindBufferMemory(buffer, memory, 0).AsErr(); err != nil {
+		device.DestroyBuffer(buffer, nil)
+		device.FreeMemory(memory, nil)
+		return nil, err
+	}
+	return &SharedBuffer{
+		Buffer: buffer,
+		Memory: memory,
+		Flags:  caps.Memory.MemoryTypes()[info.MemoryTypeIndex].PropertyFlags(),
+		Info:   info,
+	}, nil
+}
+
+// DestroySharedBuffer destroys the buffer and frees its memory. The memory
+// stays alive in the other processes sharing it.
+func (device DeviceFacade) DestroySharedBuffer(shared *SharedBuffer) {
+	device.DestroyBuffer(shared.Buffer, nil)
+	device.FreeMemory(shared.Memory, nil)
+}
+
+// ExportMemoryFd returns a new opaque file descriptor of memory allocated with
+// VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT export, like the memory of a
+// SharedBuffer. The caller owns the file descriptor.
+func (device DeviceFacade) ExportMemoryFd(memory DeviceMemory) (int, error) {
+	info := &MemoryGetFdInfoKHR{}
+	info.SetDefaultSType()
+	info.SetMemory(memory)
+	info.SetHandleType(VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT)
+	fd := int32(-1)
+	if err := device.GetMemoryFdKHR(info, &fd).AsErr(); err != nil {
+		return -1, err
+	}
+	return int(fd), nil
+}
+
+// CreateSharedTimeline creates a timeline semaphore exportable with
+// ExportSemaphoreFd. The device must be created with
+// VK_KHR_external_semaphore_fd and the timelineSemaphore feature.
+func (device DeviceFacade) CreateSharedTimeline(initial uint64) (Semaphore, error) {
+	arp := NewAutoReleaser()
+	defer arp.Release()
+	typeInfo := &SemaphoreTypeCreateInfo{}
+	typeInfo.SetDefaultSType()
+	typeInfo.SetSemaphoreType(VK_SEMAPHORE_TYPE_TIMELINE)
+	typeInfo.SetInitialValue(initial)
+	export := &ExportSemaphoreCreateInfo{}
+	export.SetDefaultSType()
+	export.SetHandleTypes(ExternalSemaphoreHandleTypeFlags(VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_OPAQUE_FD_BIT))
+	export.PinPNext(arp, unsafe.Pointer(typeInfo))
+	info := &SemaphoreCreateInfo{}
+	info.SetDefaultSType()
+	info.PinPNext(arp, unsafe.Pointer(export))
+	var semaphore Semaphore
+	if err := device.CreateSemaphore(info, nil, &semaphore).AsErr(); err != nil {
+		return NullSemaphore, err
+	}
+	return semaphore, nil
+}
+
+// ExportSemaphoreFd returns a new opaque file descriptor of a semaphore
+// created by CreateSharedTimeline. The caller owns the file descriptor.
+func (device DeviceFacade) ExportSemaphoreFd(semaphore Semaphore) (int, error) {
+	info := &SemaphoreGetFdInfoKHR{}
+	info.SetDefaultSType()
+	info.SetSemaphore(semaphore)
+	info.SetHandleType(VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_OPAQUE_FD_BIT)
+	fd := int32(-1)
+	if err := device.GetSemaphoreFdKHR(info, &fd).AsErr(); err != nil {
+		return -1, err
+	}
+	return int(fd), nil
+}
+
+// ImportSharedTimeline creates a timeline semaphore sharing the payload of a
+// semaphore exported by another process. Signals and waits on either side,
+// from the host or from queue submissions, apply to both. It takes ownership
+// of fd, which is closed when the import fails.
+func (device DeviceFacade) ImportSharedTimeline(fd int) (Semaphore, error) {
+	semaphore, err := device.CreateSharedTimeline(0)
+	if err != nil {
+		syscall.Close(fd)
+		return NullSemaphore, err
+	}
+	info := &ImportSemaphoreFdInfoKHR{}
+	info.SetDefaultSType()
+	info.SetSemaphore(semaphore)
+	info.SetHandleType(VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_OPAQUE_FD_BIT)
+	info.SetFd(int32(fd))
+	if err := device.ImportSemaphoreFdKHR(info).AsErr(); err != nil {
+		device.DestroySemaphore(semaphore, nil)
+		syscall.Close(fd)
+		return NullSemaphore, err
+	}
+	return semaphore, nil
+}
+
+// SharedMessage is a message of SendShared and ReceiveShared. The file
+// descriptors are only sent when HasMemory or HasTimeline is set, so a zero
+// value message, like the per frame ones, only carries Value. Received
+// messages have -1 in the absent ones.
+type SharedMessage struct {
+	Buffer      SharedBufferInfo
+	Value       uint64 // A timeline value, like the one to wait for before reading.
+	HasMemory   bool
+	MemoryFd    int
+	HasTimeline bool
+	TimelineFd  int
+}
+
+// sharedHeader is the wire format of a SharedMessage; the file descriptors
+// travel as SCM_RIGHTS ancillary data.
+type sharedHeader struct {
+	Magic  uint32
+	Fds    uint32 // Bit 0: memory, bit 1: timeline.
+	Value  uint64
+	Buffer SharedBufferInfo
+}
+
+const sharedMagic = 0x58534b56 // "VKSX"
+
+// SendShared sends the message over a Unix socket. The file descriptors are
+// duplicated into the receiving process; the caller still owns, and should
+// close, its own.
+func SendShared(conn *net.UnixConn, msg SharedMessage) error {
+	header := sharedHeader{Magic: sharedMagic, Value: msg.Value, Buffer: msg.Buffer}
+	var fds []int
+	if msg.HasMemory {
+		header.Fds |= 1
+		fds = append(fds, msg.MemoryFd)
+	}
+	if msg.HasTimeline {
+		header.Fds |= 2
+		fds = append(fds, msg.TimelineFd)
+	}
+	var buf bytes.Buffer
+	binary.Write(&buf, binary.LittleEndian, &header)
+	var oob []byte
+	if len(fds) > 0 {
+		oob = syscall.UnixRights(fds...)
+	}
+	n, _, err := conn.WriteMsgUnix(buf.Bytes(), oob, nil)
+	if err == nil && n != buf.Len() {
+		_, err = conn.Write(buf.Bytes()[n:])
+	}
+	return err
+}
+
+// ReceiveShared receives a message sent by SendShared. The caller owns the
+// file descriptors of the message; they are close-on-exec.
+func ReceiveShared(conn *net.UnixConn) (SharedMessage, error) {
+	msg := SharedMessage{MemoryFd: -1, TimelineFd: -1}
+	buf := make([]byte, binary.Size(sharedHeader{}))
+	oob := make([]byte, syscall.CmsgSpace(2*4))
+	n, oobn, _, _, err := conn.ReadMsgUnix(buf, oob)
+	if err != nil {
+		return msg, err
+	}
+	var fds []int
+	if oobn > 0 {
+		cmsgs, err := syscall.ParseSocketControlMessage(oob[:oobn])
+		if err != nil {
+			return msg, err
+		}
+		for k := range cmsgs {
+			if rights, err := syscall.ParseUnixRights(&cmsgs[k]); err == nil {
+				fds = append(fds, rights...)
+			}
+		}
+		for _, fd := range fds {
+			syscall.CloseOnExec(fd)
+		}
+	}
+	closeFds := func() {
+		for _, fd := range fds {
+			syscall.Close(fd)
+		}
+	}
+	if n == 0 {
+		closeFds()
+		return msg, io.EOF
+	}
+	if n < len(buf) {
+		if _, err := io.ReadFull(conn, buf[n:]); err != nil {
+			closeFds()
+			return msg, err
+		}
+	}
+
+	var header sharedHeader
+	binary.Read(bytes.NewReader(buf), binary.LittleEndian, &header)
+	want := 0
+	for bits := header.Fds; bits != 0; bits &= bits - 1 {
+		want++
+	}
+	if header.Magic != sharedMagic || len(fds) != want {
+		closeFds()
+		return msg, fmt.Errorf("error: malformed shared message")
+	}
+	msg.Buffer = header.Buffer
+	msg.Value = header.Value
+	if header.Fds&1 != 0 {
+		msg.HasMemory = true
+		msg.MemoryFd, fds = fds[0], fds[1:]
+	}
+	if header.Fds&2 != 0 {
+		msg.HasTimeline = true
+		msg.TimelineFd = fds[0]
+	}
+	return msg, nil
+}
@@ -0,0 +1,67 @@
+//go:build unix && !vks_no_version_1_3 && !vks_no_version_1_1 && !vks_no_version_1_2 && !vks_no_khr_external_memory_fd && !vks_no_khr_external_semaphore_fd
+
+package vks
+
+import (
+	"net"
+	"os"
+	"syscall"
+	"testing"
+)
+
+func sharedSocketPair(t *testing.T) (*net.UnixConn, *net.UnixConn) {
+	fds, err := syscall.Socketpair(syscall.AF_UNIX, syscall.SOCK_STREAM|syscall.SOCK_CLOEXEC, 0)
+	if err != nil {
+		t.Fatal(err)
+	}
+	conns := make([]*net.UnixConn, 2)
+	for k, fd := range fds {
+		f := os.NewFile(uintptr(fd), "socket")
+		conn, err := net.FileConn(f)
+		f.Close()
+		if err != nil {
+			t.Fatal(err)
+		}
+		conns[k] = conn.(*net.UnixConn)
+		t.Cleanup(func() { conn.Close() })
+	}
+	return conns[0], conns[1]
+}
+
+func TestSharedMessageFds(t *testing.T) {
+	send, receive := sharedSocketPair(t)
+	// A zero value message must not send stdin.
+	if err := SendShared(send, SharedMessage{Value: 7}); err != nil {
+		t.Fatal(err)
+	}
+	msg, err := ReceiveShared(receive)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if msg.Value != 7 || msg.HasMemory || msg.HasTimeline || msg.MemoryFd != -1 || msg.TimelineFd != -1 {
+		t.Fatalf("received %+v, want only Value 7", msg)
+	}
+
+	r, w, err := os.Pipe()
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer r.Close()
+	defer w.Close()
+	info := SharedBufferInfo{Size: 4096}
+	if err := SendShared(send, SharedMessage{Buffer: info, Value: 1, HasMemory: true, MemoryFd: int(r.Fd())}); err != nil {
+		t.Fatal(err)
+	}
+	msg, err = ReceiveShared(receive)
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer syscall.Close(msg.MemoryFd)
+	if !msg.HasMemory || msg.HasTimeline || msg.TimelineFd != -1 || msg.Buffer != info {
+		t.Fatalf("received %+v, want only the memory fd", msg)
+	}
+	flags, _, errno := syscall.Syscall(syscall.SYS_FCNTL, uintptr(msg.MemoryFd), syscall.F_GETFD, 0)
+	if errno != 0 || flags&syscall.FD_CLOEXEC == 0 {
+		t.Errorf("received fd flags %#x, want FD_CLOEXEC", flags)
+	}
+}
@@ -0,0 +1,18 @@
+package vks
+
+import (
+	"unsafe"
+
+	"github.com/ibd1279/vks/internal/trampoline"
+)
+
+// fastcallSupported reports if the Fast command methods, generated for the
+// fastcalls listed in vkxml.yml, skip cgo. Where the trampoline is not
+// available, or with the vks_no_fastcall build tag, they call the regular
+// methods instead.
+const fastcallSupported = trampoline.Supported
+
+// fastcall calls a generated vksFast_ C function with its argument struct.
+func fastcall(fn, arg unsafe.Pointer) {
+	trampoline.Call(fn, arg)
+}
@@ -0,0 +1,97 @@
+package vks
+
+import (
+	"io"
+	"reflect"
+	"runtime"
+	"testing"
+)
+
+// recordFastCalls issues every Fast command, or the cgo command it stands
+// for, with distinct arguments.
+func recordFastCalls(cmd CommandBufferFacade, pipeline Pipeline, buffer Buffer, fast bool) {
+	for k := uint32(0); k < 8; k++ {
+		if fast {
+			cmd.FastCmdBindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline)
+			cmd.FastCmdBindIndexBuffer(buffer, DeviceSize(k*64), VK_INDEX_TYPE_UINT32)
+			cmd.FastCmdDraw(k, k+1, k+2, k+3)
+			cmd.FastCmdDrawIndexed(k, k+1, k+2, -int32(k), k+4)
+			cmd.FastCmdDispatch(k, k*2, k*3)
+		} else {
+			cmd.CmdBindPipeline(VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline)
+			cmd.CmdBindIndexBuffer(buffer, DeviceSize(k*64), VK_INDEX_TYPE_UINT32)
+			cmd.CmdDraw(k, k+1, k+2, k+3)
+			cmd.CmdDrawIndexed(k, k+1, k+2, -int32(k), k+4)
+			cmd.CmdDispatch(k, k*2, k*3)
+		}
+	}
+}
+
+func TestFastCallsMatchCgo(t *testing.T) {
+	device, cmd := nullCommandBuffer(t)
+	if nullShm == nil {
+		t.Skip("the Vulkan library is not the null driver")
+	}
+	arp := NewAutoReleaser()
+	defer arp.Release()
+	info := CPtr(arp, &BufferCreateInfo{}, SetDefaultSType)
+	info.SetSize(256)
+	info.SetUsage(BufferUsageFlags(VK_BUFFER_USAGE_INDEX_BUFFER_BIT))
+	var buffer Buffer
+	if err := device.CreateBuffer(info, nil, &buffer).AsErr(); err != nil {
+		t.Fatal(err)
+	}
+	defer device.DestroyBuffer(buffer, nil)
+	pipelines := make([]Pipeline, 1)
+	if err := device.CreateComputePipelines(NullPipelineCache, 1, make([]ComputePipelineCreateInfo, 1), nil, pipelines).AsErr(); err != nil {
+		t.Fatal(err)
+	}
+	pipeline := pipelines[0]
+	defer device.DestroyPipeline(pipeline, nil)
+
+	start := nullShm.head()
+	recordFastCalls(cmd, pipeline, buffer, false)
+	cgo := nullShm.since(t, start)
+	start = nullShm.head()
+	recordFastCalls(cmd, pipeline, buffer, true)
+	fast := nullShm.since(t, start)
+	if len(cgo) != 40 {
+		t.Fatalf("recorded %d cgo calls, want 40", len(cgo))
+	}
+	if !reflect.DeepEqual(cgo, fast) {
+		t.Errorf("Fast calls reached the driver as\n%v\nwant\n%v", fast, cgo)
+	}
+}
+
+// The capture wrappers wait on the writer goroutine when both buffers are
+// full, so the Fast methods must not reach them without releasing the P.
+func TestFastCallsDuringCapture(t *testing.T) {
+	_, cmd := nullCommandBuffer(t)
+	defer runtime.GOMAXPROCS(runtime.GOMAXPROCS(1))
+	capture, err := StartCapture(io.Discard, 256)
+	if err != nil {
+		t.Fatal(err)
+	}
+	for k := 0; k < 200000; k++ {
+		cmd.FastCmdDraw(3, 1, 0, 0)
+	}
+	if err := capture.Stop(); err != nil {
+		t.Fatal(err)
+	}
+}
+
+func BenchmarkCmdDrawCgo(b *testing.B) {
+	_, cmd := nullCommandBuffer(b)
+	b.ResetTimer()
+	for k := 0; k < b.N; k++ {
+		cmd.CmdDraw(3, 1, 0, 0)
+	}
+}
+
+func BenchmarkCmdDrawFast(b *testing.B) {
+	_, cmd := nullCommandBuffer(b)
+	b.ResetTimer()
+	for k := 0; k < b.N; k++ {
+		cmd.FastCmdDraw(3, 1, 0, 0)
+	}
+}
@@ -0,0 +1,57 @@
+package vks
+
+import (
+	"testing"
+	"unsafe"
+)
+
+// The slice getters must return the array the member points to, with the
+// length the specification gives it.
+func TestSliceGetters(t *testing.T) {
+	arp := NewAutoReleaser()
+	defer arp.Release()
+
+	layer, extension := NewCStr(arp, "VK_LAYER_test"), NewCStr(arp, "VK_KHR_test")
+	var instance InstanceCreateInfo
+	instance.PinPpEnabledLayerNames(arp, []*byte{layer})
+	instance.PinPpEnabledExtensionNames(arp, []*byte{extension, layer})
+	if names := instance.PpEnabledLayerNames(); len(names) != 1 || names[0] != layer {
+		t.Errorf("PpEnabledLayerNames returned %v, want [%p]", names, layer)
+	}
+	if names := instance.PpEnabledExtensionNames(); len(names) != 2 || names[0] != extension || names[1] != layer {
+		t.Errorf("PpEnabledExtensionNames returned %v, want [%p %p]", names, extension, layer)
+	}
+	var device DeviceCreateInfo
+	if names := device.PpEnabledLayerNames(); names != nil {
+		t.Errorf("PpEnabledLayerNames returned %v without names", names)
+	}
+	device.PinPpEnabledExtensionNames(arp, []*byte{extension})
+	if names := device.PpEnabledExtensionNames(); len(names) != 1 || names[0] != extension {
+		t.Errorf("PpEnabledExtensionNames returned %v, want [%p]", names, extension)
+	}
+
+	code := []uint32{0x07230203, 0x00010000, 0, 1}
+	var module ShaderModuleCreateInfo
+	module.PinPCode(arp, code)
+	module.SetCodeSize(uint64(len(code) * 4))
+	if got := module.PCode(); len(got) != len(code) || &got[0] != &code[0] {
+		t.Errorf("PCode returned %d words at %p, want %d at %p", len(got), unsafe.SliceData(got), len(code), &code[0])
+	}
+
+	mask := []SampleMask{0xffffffff, 0xffffffff}
+	var multisample PipelineMultisampleStateCreateInfo
+	multisample.PinPSampleMask(arp, mask)
+	for _, c := range []struct {
+		samples SampleCountFlagBits
+		words   int
+	}{
+		{VK_SAMPLE_COUNT_1_BIT, 1},
+		{VK_SAMPLE_COUNT_32_BIT, 1},
+		{VK_SAMPLE_COUNT_64_BIT, 2},
+	} {
+		multisample.SetRasterizationSamples(c.samples)
+		if got := multisample.PSampleMask(); len(got) != c.words || &got[0] != &mask[0] {
+			t.Errorf("PSampleMask returned %d words for %v samples, want %d", len(got), c.samples, c.words)
+		}
+	}
+}
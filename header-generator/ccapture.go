@@ -0,0 +1,990 @@
+package main
+
+import (
+	"fmt"
+	"os"
+	"regexp"
+	"sort"
+	"strings"
+	"text/template"
+
+	strip "github.com/grokify/html-strip-tags-go"
+)
+
+// captureSkipCommands are passed straight through by the capture layer. The
+// proc address lookups happen while loading and cannot be replayed.
+var captureSkipCommands = map[string]bool{
+	"vkGetInstanceProcAddr": true,
+	"vkGetDeviceProcAddr":   true,
+}
+
+var captureCommentRegexp = regexp.MustCompile("<comment>.*?</comment>")
+var captureIdentRegexp = regexp.MustCompile("(->)?[A-Za-z_][A-Za-z0-9_]*")
+
+// CaptureCommand is the data needed to emit the capture and replay functions
+// of one command.
+type CaptureCommand struct {
+	Index      int      // Command id in the trace.
+	Name       string   // e.g. vkCreateBuffer
+	Return     string   // e.g. VkResult
+	Global     bool     // Dispatched through the global proc addresses.
+	Define     string   // Macro enabling the command's shard; empty for the core.
+	Params     []string // C parameter declarations.
+	Args       []string // Parameter names.
+	Capture    []string // Statements serializing the parameters.
+	Outputs    []string // Statements serializing the returned handles.
+	Replayable bool     // False when a parameter cannot be reconstructed.
+	Replay     []string // Statements rebuilding the parameters.
+	Remap      []string // Statements mapping the captured returned handles.
+}
+
+// CaptureStruct is the data needed to emit the deep copy functions of one
+// struct.
+type CaptureStruct struct {
+	Name    string
+	SType   string
+	Capture []string
+	Replay  []string
+}
+
+// captureTypes holds the type information of the enabled registry needed to
+// walk structs and parameters.
+type captureTypes struct {
+	categories map[string]TypeCategory
+	aliases    map[string]string
+	structs    map[string]TypeElement
+	handles    map[string]bool
+	needsFix   map[string]bool
+}
+
+func (types *captureTypes) resolve(name string) string {
+	for len(types.aliases[name]) > 0 {
+		name = types.aliases[name]
+	}
+	return name
+}
+
+// fix reports if a struct contains pointers, handles or function pointers,
+// and therefore needs more than a raw copy to be captured and replayed.
+func (types *captureTypes) fix(name string) bool {
+	name = types.resolve(name)
+	if v, ok := types.needsFix[name]; ok {
+		return v
+	}
+	tiepuh, ok := types.structs[name]
+	if !ok || tiepuh.Category != TypeCategoryStruct {
+		return false
+	}
+	types.needsFix[name] = false
+	for _, v := range tiepuh.StructMembers {
+		raw := captureCommentRegexp.ReplaceAllString(v.Raw, "")
+		memberType := types.resolve(v.Type)
+		if strings.Contains(raw, "*") ||
+			types.categories[memberType] == TypeCategoryHandle ||
+			types.categories[memberType] == TypeCategoryFuncpointer ||
+			types.fix(memberType) {
+			types.needsFix[name] = true
+			break
+		}
+	}
+	return types.needsFix[name]
+}
+
+// captureItem is a struct member or command parameter being serialized.
+type captureItem struct {
+	Access   string // e.g. p->pNext or pCreateInfo
+	Type     string // Resolved spec type.
+	Pointers int
+	Const    bool
+	Array    string // Fixed array size, if any.
+	Count    string // C expression for the element count, if known.
+	Strings  bool   // Null terminated string, or array of them.
+}
+
+// elemType is the C type used with sizeof for the elements of the item.
+func (item captureItem) elemType() string {
+	if item.Type == "void" {
+		return "uint8_t"
+	}
+	return item.Type
+}
+
+func newCaptureItem(types *captureTypes, access, specType, raw, length, altLength string, rewrite func(string) string) captureItem {
+	raw = captureCommentRegexp.ReplaceAllString(raw, "")
+	item := captureItem{
+		Access:   access,
+		Type:     types.resolve(specType),
+		Pointers: strings.Count(raw, "*"),
+		Const:    strings.Contains(raw, "const"),
+	}
+	if arraySize := arrayConstSizeRegexp.FindString(raw); len(arraySize) > 2 {
+		item.Array = strings.TrimSpace(strip.StripTags(arraySize[1 : len(arraySize)-1]))
+	}
+
+	lengths := strings.Split(length, ",")
+	first := strings.TrimSpace(lengths[0])
+	switch {
+	case first == "null-terminated":
+		item.Strings = true
+	case len(lengths) == 2 && strings.TrimSpace(lengths[1]) == "null-terminated":
+		item.Strings = true
+		item.Count = rewrite(first)
+	case strings.HasPrefix(first, "latexmath"):
+		if len(altLength) > 0 {
+			item.Count = rewrite(altLength)
+		}
+	case len(first) > 0:
+		item.Count = rewrite(strings.ReplaceAll(first, "::", "->"))
+	case item.Type != "void":
+		item.Count = "1"
+	}
+	return item
+}
+
+// captureStatements returns the statements that serialize and rebuild the
+// data an item points to. ok is false when the data cannot be rebuilt.
+func captureStatements(types *captureTypes, item captureItem, replayTarget string) (capture, replay []string, ok bool) {
+	category := types.categories[item.Type]
+	mapHandle := func(access string) string {
+		return fmt.Sprintf("%s = (%s)replay_map(r, (uint64_t)(uintptr_t)%s);", access, item.Type, access)
+	}
+
+	switch {
+	case item.Pointers == 0 && category == TypeCategoryFuncpointer:
+		replay = append(replay, fmt.Sprintf("%s = NULL;", item.Access))
+	case item.Pointers == 0 && category == TypeCategoryHandle && len(item.Array) > 0:
+		replay = append(replay, fmt.Sprintf(`for (size_t i = 0; i < %s; i++) {
+		%s
+	}`, item.Array, mapHandle(item.Access+"[i]")))
+	case item.Pointers == 0 && category == TypeCategoryHandle:
+		replay = append(replay, mapHandle(item.Access))
+	case item.Pointers == 0 && types.fix(item.Type) && len(item.Array) > 0:
+		capture = append(capture, fmt.Sprintf(`for (size_t i = 0; i < %s; i++) {
+		capture_%s(s, &%s[i]);
+	}`, item.Array, item.Type, item.Access))
+		replay = append(replay, fmt.Sprintf(`for (size_t i = 0; i < %s; i++) {
+		replay_%s(r, rd, &%s[i]);
+	}`, item.Array, item.Type, item.Access))
+	case item.Pointers == 0 && types.fix(item.Type):
+		capture = append(capture, fmt.Sprintf("capture_%s(s, &%s);", item.Type, item.Access))
+		replay = append(replay, fmt.Sprintf("replay_%s(r, rd, &%s);", item.Type, item.Access))
+	case item.Pointers == 0:
+	case item.Pointers == 1 && strings.HasSuffix(item.Access, "pNext"):
+		capture = append(capture, fmt.Sprintf("capture_next(s, %s);", item.Access))
+		replay = append(replay, fmt.Sprintf("%s = replay_next(r, rd);", replayTarget))
+	case item.Pointers == 1 && item.Strings:
+		capture = append(capture, fmt.Sprintf("capture_string(s, %s);", item.Access))
+		replay = append(replay, fmt.Sprintf("%s = replay_string(r, rd);", replayTarget))
+	case item.Pointers == 2 && item.Strings && len(item.Count) > 0:
+		capture = append(capture, fmt.Sprintf("capture_strings(s, %s, (size_t)(%s));", item.Access, item.Count))
+		replay = append(replay, fmt.Sprintf("%s = (const char* const*)replay_strings(r, rd);", replayTarget))
+	case item.Pointers == 1 && len(item.Count) > 0:
+		elem := item.elemType()
+		each := []string{}
+		eachReplay := []string{}
+		if category == TypeCategoryHandle {
+			eachReplay = append(eachReplay, mapHandle("v[i]"))
+		} else if types.fix(item.Type) {
+			each = append(each, fmt.Sprintf("capture_%s(s, &%s[i]);", item.Type, item.Access))
+			eachReplay = append(eachReplay, fmt.Sprintf("replay_%s(r, rd, &v[i]);", item.Type))
+		}
+		if len(each) > 0 {
+			capture = append(capture, fmt.Sprintf(`if (capture_pointer(s, %[1]s, (size_t)(%[2]s), sizeof(%[3]s))) {
+		for (size_t i = 0; i < (size_t)(%[2]s); i++) {
+			%[4]s
+		}
+	}`, item.Access, item.Count, elem, strings.Join(each, "\n\t\t\t")))
+		} else {
+			capture = append(capture, fmt.Sprintf("capture_pointer(s, %s, (size_t)(%s), sizeof(%s));", item.Access, item.Count, elem))
+		}
+		if len(eachReplay) > 0 {
+			replay = append(replay, fmt.Sprintf(`{
+		size_t n;
+		%[1]s* v = replay_pointer(r, rd, sizeof(%[1]s), &n);
+		for (size_t i = 0; i < n; i++) {
+			%[2]s
+		}
+		%[3]s = v;
+	}`, elem, strings.Join(eachReplay, "\n\t\t\t"), replayTarget))
+		} else {
+			replay = append(replay, fmt.Sprintf("%s = replay_pointer(r, rd, sizeof(%s), NULL);", replayTarget, elem))
+		}
+	case item.Pointers == 2 && item.Type == "void" && !item.Const && len(item.Count) == 0:
+		// Pointer returned by the command, like the ppData of vkMapMemory.
+		replay = append(replay, fmt.Sprintf("%s = replay_alloc(r, sizeof(void*));", replayTarget))
+	default:
+		// Size unknown (for example a void* without a length), so the data
+		// is not captured.
+		replay = append(replay, fmt.Sprintf("%s = NULL;", replayTarget))
+		return capture, replay, false
+	}
+	return capture, replay, true
+}
+
+// GenerateCCaptureFiles writes the capture and replay layer. Every wrapped
+// command can serialize its arguments, deep copying structs, arrays and pNext
+// chains, and the replayer rebuilds and re-issues them. It is skipped when no
+// capture name is configured.
+func GenerateCCaptureFiles(config *Config, graph RegistryGraph, shards *Shards) error {
+	if len(config.CaptureName) == 0 {
+		return nil
+	}
+	fnC := fmt.Sprintf("%s.c", config.CaptureName)
+	fnH := fmt.Sprintf("%s.h", config.CaptureName)
+
+	var err error
+	funcs := template.FuncMap{
+		"join": strings.Join,
+	}
+	tH := template.New(fnH).Funcs(funcs)
+	if tH, err = tH.Parse(cCaptureHeaderTemplate); err != nil {
+		return err
+	}
+	tC := template.New(fnC).Funcs(funcs)
+	if tC, err = tC.Parse(cCapturePrimaryTemplate); err != nil {
+		return err
+	}
+
+	types := &captureTypes{
+		categories: make(map[string]TypeCategory, 0),
+		aliases:    make(map[string]string, 0),
+		structs:    make(map[string]TypeElement, 0),
+		handles:    make(map[string]bool, 0),
+		needsFix:   make(map[string]bool, 0),
+	}
+	structNames := []string{}
+	commands := []CommandElement{}
+	store := func(path []*RegistryNode) {
+		node := path[len(path)-1]
+		if tiepuh := node.TypeElement(); tiepuh != nil {
+			if len(tiepuh.Alias) > 0 {
+				types.aliases[tiepuh.Name()] = tiepuh.Alias
+				return
+			}
+			types.categories[tiepuh.Name()] = tiepuh.Category
+			switch tiepuh.Category {
+			case TypeCategoryHandle:
+				types.handles[tiepuh.Name()] = tiepuh.TypeTag == "VK_DEFINE_HANDLE"
+			case TypeCategoryStruct, TypeCategoryUnion:
+				if _, ok := types.structs[tiepuh.Name()]; !ok {
+					structNames = append(structNames, tiepuh.Name())
+				}
+				types.structs[tiepuh.Name()] = *tiepuh
+			}
+		}
+		if command := node.CommandElement(); command != nil {
+			if len(command.Alias()) == 0 {
+				commands = append(commands, *command)
+			}
+		}
+	}
+	graph.DepthFirstSearch(config.Enabled(), store)
+
+	structs := []CaptureStruct{}
+	for _, name := range structNames {
+		tiepuh := types.structs[name]
+		if !types.fix(name) {
+			continue
+		}
+		members := make(map[string]bool, len(tiepuh.StructMembers))
+		for _, v := range tiepuh.StructMembers {
+			members[v.Name] = true
+		}
+		rewrite := func(expr string) string {
+			return captureIdentRegexp.ReplaceAllStringFunc(expr, func(ident string) string {
+				if members[ident] {
+					return "p->" + ident
+				}
+				return ident
+			})
+		}
+		entry := CaptureStruct{Name: name}
+		for _, v := range tiepuh.StructMembers {
+			if v.Name == "sType" && len(v.Values) > 0 && !strings.Contains(v.Values, ",") {
+				entry.SType = v.Values
+			}
+			access := "p->" + v.Name
+			item := newCaptureItem(types, access, v.Type, v.Raw, v.Length, v.AltLength, rewrite)
+			capture, replay, _ := captureStatements(types, item, access)
+			entry.Capture = append(entry.Capture, capture...)
+			entry.Replay = append(entry.Replay, replay...)
+		}
+		structs = append(structs, entry)
+	}
+
+	// The pNext chain can hold any struct with a single sType value. They all
+	// have a pNext member, so they all have deep copy functions.
+	chained := []CaptureStruct{}
+	for _, name := range structNames {
+		tiepuh := types.structs[name]
+		if tiepuh.Category != TypeCategoryStruct {
+			continue
+		}
+		for _, v := range tiepuh.StructMembers {
+			if v.Name == "sType" && len(v.Values) > 0 && !strings.Contains(v.Values, ",") {
+				chained = append(chained, CaptureStruct{Name: name, SType: v.Values})
+			}
+		}
+	}
+
+	data := []CaptureCommand{}
+	for _, command := range commands {
+		if captureSkipCommands[command.Name()] {
+			continue
+		}
+		ok, tmp := CommandToData(nil, command)
+		if !ok {
+			continue
+		}
+		cmd := tmp.(*struct {
+			Template string
+			Data     CommandData
+		}).Data
+		entry := CaptureCommand{
+			Index:      len(data),
+			Name:       command.Name(),
+			Return:     cmd.Return.C(),
+			Global:     config.IsGlobalProc(command.Name()),
+			Define:     shards.Named(command.Name()).Define(),
+			Replayable: true,
+		}
+
+		params := make(map[string]CommandParamElement, len(command.Params))
+		for _, v := range command.Params {
+			params[v.Name] = v
+		}
+		rewrite := func(expr string) string {
+			if v, ok := params[expr]; ok && strings.Contains(v.Raw, "*") {
+				return fmt.Sprintf("(%s != NULL ? *%s : 0)", expr, expr)
+			}
+			return expr
+		}
+		for k, v := range command.Params {
+			entry.Params = append(entry.Params, handleCArraySyntax(cmd.Parameters[k].Type, cmd.Parameters[k].Name))
+			entry.Args = append(entry.Args, v.Name)
+
+			item := newCaptureItem(types, v.Name, v.Type, v.Raw, v.Length, v.AltLength, rewrite)
+			if len(item.Array) > 0 {
+				// Array parameters decay to pointers.
+				item.Pointers, item.Count = 1, item.Array
+				item.Array = ""
+			}
+			declType := item.Type
+			if item.Pointers > 0 {
+				declType = item.Type + strings.Repeat("*", item.Pointers)
+			}
+			switch {
+			case item.Type == "VkAllocationCallbacks":
+				// Allocators are process specific, replay uses the default.
+				entry.Replay = append(entry.Replay, fmt.Sprintf("%s %s = NULL;", declType, v.Name))
+			case item.Pointers == 0:
+				entry.Capture = append(entry.Capture, fmt.Sprintf("capture_raw(s, &%[1]s, sizeof(%[1]s));", v.Name))
+				entry.Replay = append(entry.Replay, fmt.Sprintf("%[1]s %[2]s;\n\treplay_raw(rd, &%[2]s, sizeof(%[2]s));", declType, v.Name))
+				if types.categories[item.Type] == TypeCategoryHandle {
+					entry.Replay = append(entry.Replay, fmt.Sprintf("%[2]s = (%[1]s)replay_map(r, (uint64_t)(uintptr_t)%[2]s);", item.Type, v.Name))
+				}
+			case !item.Const && item.Pointers == 1 && types.categories[item.Type] == TypeCategoryHandle && len(item.Count) > 0:
+				// Handles created by the command only need room before the
+				// call. They are recorded after the call so replay can map
+				// them to the handles it creates.
+				entry.Capture = append(entry.Capture, fmt.Sprintf("capture_output(s, %s, (size_t)(%s));", v.Name, item.Count))
+				entry.Replay = append(entry.Replay, fmt.Sprintf("%[1]s %[2]s = replay_output(r, rd, sizeof(%[3]s));", declType, v.Name, item.Type))
+				entry.Outputs = append(entry.Outputs, fmt.Sprintf("capture_pointer(s, ok ? %s : NULL, (size_t)(%s), sizeof(%s));", v.Name, item.Count, item.Type))
+				entry.Remap = append(entry.Remap, fmt.Sprintf("replay_remap(r, rd, %s, sizeof(%s));", v.Name, item.Type))
+			default:
+				capture, replay, ok := captureStatements(types, item, v.Name)
+				entry.Replayable = entry.Replayable && ok
+				entry.Capture = append(entry.Capture, capture...)
+				entry.Replay = append(entry.Replay, fmt.Sprintf("%s %s = NULL;", declType, v.Name))
+				entry.Replay = append(entry.Replay, replay...)
+			}
+		}
+		data = append(data, entry)
+	}
+
+	sort.Slice(chained, func(a, b int) bool { return chained[a].Name < chained[b].Name })
+
+	values := struct {
+		Header       string
+		WrapperName  string
+		Structs      []CaptureStruct
+		Chained      []CaptureStruct
+		Data         []CaptureCommand
+		InstanceLoad string
+	}{
+		Header:       fnH,
+		WrapperName:  fmt.Sprintf("%s.h", config.OutputName),
+		Structs:      structs,
+		Chained:      chained,
+		Data:         data,
+		InstanceLoad: config.ProcLoaders["VkInstance"],
+	}
+
+	for _, out := range []struct {
+		fn string
+		t  *template.Template
+	}{{fnH, tH}, {fnC, tC}} {
+		var fh *os.File
+		fh, err = os.OpenFile(out.fn, os.O_WRONLY|os.O_TRUNC|os.O_CREATE, 0644)
+		if err != nil {
+			return err
+		}
+		err = out.t.Execute(fh, values)
+		fh.Close()
+		if err != nil {
+			return err
+		}
+	}
+
+	return nil
+}
+
+const cCaptureHeaderTemplate = `#ifndef __VKS_CAPTURE_H__
+#define __VKS_CAPTURE_H__
+#include "{{.WrapperName}}"
+
+#define VKS_CAPTURE_VERSION 1
+#define VKS_CAPTURE_COMMAND_COUNT {{len .Data}}
+#define VKS_CAPTURE_FRAME_MARKER 0xFFFFFFFFu
+
+// Non zero while a capture is running. Checked by every wrapper.
+extern int vksCaptureActive;
+
+VkResult vksCaptureStart(size_t);
+void vksCaptureFrame();
+void vksCaptureStop();
+int vksCaptureNext(const void**, size_t*);
+void vksCaptureRelease();
+const char* vksCaptureCommandName(uint32_t);
+
+typedef struct vksReplay vksReplay;
+vksReplay* vksReplayCreate();
+void vksReplayDestroy(vksReplay*);
+int vksReplayRecord(vksReplay*, uint32_t, const void*, size_t, VkResult*, uint64_t*);
+{{range .Data}}{{.Return}} vksCaptured_{{.Name}}(vksProcAddr* addrs{{range .Params}}, {{.}}{{end}});
+{{end}}
+#endif
+`
+
+const cCapturePrimaryTemplate = `// Binary capture and replay of the commands issued through the wrappers.
+//
+// A trace starts with the "VKSTRACE" magic, a uint32_t version, a uint32_t
+// command count and the command names as a uint32_t length followed by the
+// characters. It is followed by records made of a uint32_t command id, a
+// uint32_t payload size and the payload. Payloads hold the raw bytes of the
+// parameters, with every pointer replaced by a uint64_t element count (zero
+// for NULL) and the pointed data, recursively. Handles created by the command
+// follow the parameters. Values are in host byte order and structs use the
+// host layout, so traces are replayed on the same architecture.
+#include <pthread.h>
+#include <stdint.h>
+#include <time.h>
+#include "{{.Header}}"
+
+int vksCaptureActive = 0;
+
+static const char* capture_names[VKS_CAPTURE_COMMAND_COUNT] = {
+{{range .Data}}	"{{.Name}}",
+{{end}}};
+
+const char* vksCaptureCommandName(uint32_t command) {
+	return command < VKS_CAPTURE_COMMAND_COUNT ? capture_names[command] : NULL;
+}
+
+// Growable byte buffer. Each thread serializes into its own stream, which is
+// appended to the shared buffer once the command returns.
+typedef struct vksCaptureStream {
+	uint8_t* data;
+	size_t len;
+	size_t cap;
+} vksCaptureStream;
+
+static void capture_reserve(vksCaptureStream* s, size_t n) {
+	if (s->len + n > s->cap) {
+		size_t cap = s->cap > 0 ? s->cap * 2 : 4096;
+		while (cap < s->len + n) {
+			cap *= 2;
+		}
+		s->data = realloc(s->data, cap);
+		s->cap = cap;
+	}
+}
+
+static void capture_raw(vksCaptureStream* s, const void* data, size_t n) {
+	capture_reserve(s, n);
+	memcpy(s->data + s->len, data, n);
+	s->len += n;
+}
+
+static void capture_u32(vksCaptureStream* s, uint32_t v) {
+	capture_raw(s, &v, sizeof(v));
+}
+
+static int capture_pointer(vksCaptureStream* s, const void* ptr, size_t count, size_t size) {
+	uint64_t n = ptr == NULL ? 0 : count;
+	capture_raw(s, &n, sizeof(n));
+	if (n > 0) {
+		capture_raw(s, ptr, count * size);
+	}
+	return n > 0;
+}
+
+// Writes only the element count of an array filled in by the command.
+static void capture_output(vksCaptureStream* s, const void* ptr, size_t count) {
+	uint64_t n = ptr == NULL ? 0 : count;
+	capture_raw(s, &n, sizeof(n));
+}
+
+static void capture_string(vksCaptureStream* s, const char* str) {
+	capture_pointer(s, str, str == NULL ? 0 : strlen(str) + 1, 1);
+}
+
+static void capture_strings(vksCaptureStream* s, const char* const* strs, size_t count) {
+	uint64_t n = strs == NULL ? 0 : count;
+	capture_raw(s, &n, sizeof(n));
+	for (size_t i = 0; i < n; i++) {
+		capture_string(s, strs[i]);
+	}
+}
+
+// Double buffered output. Records are appended to the active buffer, and
+// full buffers are handed to the writer through vksCaptureNext.
+static pthread_mutex_t capture_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t capture_cond = PTHREAD_COND_INITIALIZER;
+static vksCaptureStream capture_buffers[2];
+static size_t capture_limit = 0;
+static int capture_current = 0;
+static int capture_ready = -1;
+static int capture_stopped = 1;
+static __thread vksCaptureStream capture_stream;
+
+// Hands the active buffer to the writer, waiting while the writer is busy
+// with the other one. Called with capture_lock held.
+static void capture_swap() {
+	while (capture_ready != -1) {
+		pthread_cond_wait(&capture_cond, &capture_lock);
+	}
+	capture_ready = capture_current;
+	capture_current ^= 1;
+	capture_buffers[capture_current].len = 0;
+	pthread_cond_broadcast(&capture_cond);
+}
+
+static void capture_append(const void* data, size_t n) {
+	pthread_mutex_lock(&capture_lock);
+	if (!capture_stopped) {
+		vksCaptureStream* buf = &capture_buffers[capture_current];
+		if (buf->len > 0 && buf->len + n > capture_limit) {
+			capture_swap();
+			buf = &capture_buffers[capture_current];
+		}
+		capture_raw(buf, data, n);
+	}
+	pthread_mutex_unlock(&capture_lock);
+}
+
+static vksCaptureStream* capture_begin(uint32_t command) {
+	vksCaptureStream* s = &capture_stream;
+	s->len = 0;
+	capture_u32(s, command);
+	capture_u32(s, 0);
+	return s;
+}
+
+static void capture_end(vksCaptureStream* s) {
+	uint32_t size = (uint32_t)(s->len - 2 * sizeof(uint32_t));
+	memcpy(s->data + sizeof(uint32_t), &size, sizeof(size));
+	capture_append(s->data, s->len);
+}
+
+VkResult vksCaptureStart(size_t bufferSize) {
+	pthread_mutex_lock(&capture_lock);
+	if (!capture_stopped || capture_ready != -1) {
+		pthread_mutex_unlock(&capture_lock);
+		return VK_ERROR_INITIALIZATION_FAILED;
+	}
+	capture_limit = bufferSize > 0 ? bufferSize : 1 << 20;
+	capture_current = 0;
+	capture_buffers[0].len = 0;
+	capture_buffers[1].len = 0;
+	capture_reserve(&capture_buffers[0], capture_limit);
+	capture_reserve(&capture_buffers[1], capture_limit);
+
+	vksCaptureStream* buf = &capture_buffers[0];
+	capture_raw(buf, "VKSTRACE", 8);
+	capture_u32(buf, VKS_CAPTURE_VERSION);
+	capture_u32(buf, VKS_CAPTURE_COMMAND_COUNT);
+	for (uint32_t i = 0; i < VKS_CAPTURE_COMMAND_COUNT; i++) {
+		uint32_t n = (uint32_t)strlen(capture_names[i]);
+		capture_u32(buf, n);
+		capture_raw(buf, capture_names[i], n);
+	}
+	capture_stopped = 0;
+	__atomic_store_n(&vksCaptureActive, 1, __ATOMIC_RELEASE);
+	pthread_mutex_unlock(&capture_lock);
+	return VK_SUCCESS;
+}
+
+void vksCaptureFrame() {
+	uint32_t marker[2] = { VKS_CAPTURE_FRAME_MARKER, 0 };
+	capture_append(marker, sizeof(marker));
+}
+
+void vksCaptureStop() {
+	__atomic_store_n(&vksCaptureActive, 0, __ATOMIC_RELEASE);
+	pthread_mutex_lock(&capture_lock);
+	if (!capture_stopped) {
+		if (capture_buffers[capture_current].len > 0) {
+			capture_swap();
+		}
+		capture_stopped = 1;
+		pthread_cond_broadcast(&capture_cond);
+	}
+	pthread_mutex_unlock(&capture_lock);
+}
+
+int vksCaptureNext(const void** data, size_t* len) {
+	pthread_mutex_lock(&capture_lock);
+	while (capture_ready == -1 && !capture_stopped) {
+		pthread_cond_wait(&capture_cond, &capture_lock);
+	}
+	int ok = capture_ready != -1;
+	if (ok) {
+		*data = capture_buffers[capture_ready].data;
+		*len = capture_buffers[capture_ready].len;
+	}
+	pthread_mutex_unlock(&capture_lock);
+	return ok;
+}
+
+void vksCaptureRelease() {
+	pthread_mutex_lock(&capture_lock);
+	capture_ready = -1;
+	pthread_cond_broadcast(&capture_cond);
+	pthread_mutex_unlock(&capture_lock);
+}
+
+// Bounds checked reader over a record payload.
+typedef struct vksReader {
+	const uint8_t* p;
+	const uint8_t* end;
+	int overflow;
+} vksReader;
+
+// Handle map from the captured handles to the replayed ones.
+typedef struct vksReplayEntry {
+	uint64_t key;
+	uint64_t value;
+} vksReplayEntry;
+
+// Blocks of memory for the rebuilt parameters, released after each record.
+typedef struct vksReplayBlock {
+	struct vksReplayBlock* next;
+	size_t len;
+	size_t cap;
+} vksReplayBlock;
+
+struct vksReplay {
+	vksProcAddr global;
+	vksProcAddr procs;
+	vksReplayEntry* entries;
+	size_t count;
+	size_t cap;
+	vksReplayBlock* blocks;
+};
+
+vksReplay* vksReplayCreate() {
+	vksReplay* r = calloc(1, sizeof(vksReplay));
+	if (r != NULL) {
+		r->global = vksProcAddresses;
+		r->procs = vksProcAddresses;
+	}
+	return r;
+}
+
+static void replay_reset(vksReplay* r) {
+	while (r->blocks != NULL && r->blocks->next != NULL) {
+		vksReplayBlock* next = r->blocks->next;
+		free(r->blocks);
+		r->blocks = next;
+	}
+	if (r->blocks != NULL) {
+		r->blocks->len = 0;
+	}
+}
+
+void vksReplayDestroy(vksReplay* r) {
+	replay_reset(r);
+	free(r->blocks);
+	free(r->entries);
+	free(r);
+}
+
+static void* replay_alloc(vksReplay* r, size_t n) {
+	n = (n + 15) & ~(size_t)15;
+	vksReplayBlock* block = r->blocks;
+	if (block == NULL || block->len + n > block->cap) {
+		size_t cap = n > 65536 ? n : 65536;
+		block = malloc(sizeof(vksReplayBlock) + 16 + cap);
+		if (block == NULL) {
+			return NULL;
+		}
+		block->next = r->blocks;
+		block->len = 0;
+		block->cap = cap;
+		r->blocks = block;
+	}
+	uint8_t* base = (uint8_t*)(((uintptr_t)(block + 1) + 15) & ~(uintptr_t)15);
+	void* ptr = base + block->len;
+	block->len += n;
+	memset(ptr, 0, n);
+	return ptr;
+}
+
+static void replay_raw(vksReader* rd, void* dst, size_t n) {
+	if (rd->overflow || (size_t)(rd->end - rd->p) < n) {
+		rd->overflow = 1;
+		memset(dst, 0, n);
+		return;
+	}
+	memcpy(dst, rd->p, n);
+	rd->p += n;
+}
+
+static uint64_t replay_count(vksReader* rd, size_t size) {
+	uint64_t n;
+	replay_raw(rd, &n, sizeof(n));
+	if (size > 0 && n > (uint64_t)(rd->end - rd->p) / size) {
+		rd->overflow = 1;
+		return 0;
+	}
+	return n;
+}
+
+static void* replay_pointer(vksReplay* r, vksReader* rd, size_t size, size_t* count) {
+	uint64_t n = replay_count(rd, size);
+	if (count != NULL) {
+		*count = (size_t)n;
+	}
+	if (n == 0) {
+		return NULL;
+	}
+	void* ptr = replay_alloc(r, (size_t)n * size);
+	if (ptr == NULL) {
+		rd->overflow = 1;
+		if (count != NULL) {
+			*count = 0;
+		}
+		return NULL;
+	}
+	replay_raw(rd, ptr, (size_t)n * size);
+	return ptr;
+}
+
+static void* replay_output(vksReplay* r, vksReader* rd, size_t size) {
+	uint64_t n;
+	replay_raw(rd, &n, sizeof(n));
+	if (n == 0 || n > SIZE_MAX / size) {
+		return NULL;
+	}
+	void* ptr = replay_alloc(r, (size_t)n * size);
+	if (ptr == NULL) {
+		rd->overflow = 1;
+	}
+	return ptr;
+}
+
+static char* replay_string(vksReplay* r, vksReader* rd) {
+	size_t n;
+	char* str = replay_pointer(r, rd, 1, &n);
+	if (n > 0 && str[n - 1] != '\0') {
+		rd->overflow = 1;
+		return NULL;
+	}
+	return str;
+}
+
+static char** replay_strings(vksReplay* r, vksReader* rd) {
+	uint64_t n = replay_count(rd, sizeof(uint64_t));
+	if (n == 0) {
+		return NULL;
+	}
+	char** strs = replay_alloc(r, (size_t)n * sizeof(char*));
+	if (strs == NULL) {
+		rd->overflow = 1;
+		return NULL;
+	}
+	for (uint64_t i = 0; i < n; i++) {
+		strs[i] = replay_string(r, rd);
+	}
+	return strs;
+}
+
+static void replay_set(vksReplay* r, uint64_t key, uint64_t value) {
+	if (key == 0) {
+		return;
+	}
+	if ((r->count + 1) * 2 > r->cap) {
+		size_t cap = r->cap > 0 ? r->cap * 2 : 1024;
+		vksReplayEntry* entries = calloc(cap, sizeof(vksReplayEntry));
+		if (entries == NULL) {
+			return;
+		}
+		for (size_t i = 0; i < r->cap; i++) {
+			if (r->entries[i].key != 0) {
+				size_t h = (r->entries[i].key * 0x9E3779B97F4A7C15ull) & (cap - 1);
+				while (entries[h].key != 0) {
+					h = (h + 1) & (cap - 1);
+				}
+				entries[h] = r->entries[i];
+			}
+		}
+		free(r->entries);
+		r->entries = entries;
+		r->cap = cap;
+	}
+	size_t h = (key * 0x9E3779B97F4A7C15ull) & (r->cap - 1);
+	while (r->entries[h].key != 0 && r->entries[h].key != key) {
+		h = (h + 1) & (r->cap - 1);
+	}
+	if (r->entries[h].key == 0) {
+		r->count++;
+	}
+	r->entries[h].key = key;
+	r->entries[h].value = value;
+}
+
+// Returns the replayed handle for a captured handle. Unknown handles are
+// returned unchanged.
+static uint64_t replay_map(vksReplay* r, uint64_t key) {
+	if (key == 0 || r->cap == 0) {
+		return key;
+	}
+	size_t h = (key * 0x9E3779B97F4A7C15ull) & (r->cap - 1);
+	while (r->entries[h].key != 0) {
+		if (r->entries[h].key == key) {
+			return r->entries[h].value;
+		}
+		h = (h + 1) & (r->cap - 1);
+	}
+	return key;
+}
+
+// Reads the handles returned at capture time and maps them to the handles
+// returned by the replayed command.
+static void replay_remap(vksReplay* r, vksReader* rd, const void* replayed, size_t size) {
+	uint64_t n = replay_count(rd, size);
+	for (uint64_t i = 0; i < n && replayed != NULL; i++) {
+		uint64_t key = 0, value = 0;
+		replay_raw(rd, &key, size);
+		memcpy(&value, (const uint8_t*)replayed + i * size, size);
+		replay_set(r, key, value);
+	}
+}
+
+static uint64_t replay_now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void capture_next(vksCaptureStream* s, const void* next);
+static void* replay_next(vksReplay* r, vksReader* rd);
+{{range .Structs}}__attribute__((unused)) static void capture_{{.Name}}(vksCaptureStream* s, const {{.Name}}* p);
+__attribute__((unused)) static void replay_{{.Name}}(vksReplay* r, vksReader* rd, {{.Name}}* p);
+{{end}}
+{{range .Structs}}
+static void capture_{{.Name}}(vksCaptureStream* s, const {{.Name}}* p) {
+{{range .Capture}}	{{.}}
+{{end}}}
+
+static void replay_{{.Name}}(vksReplay* r, vksReader* rd, {{.Name}}* p) {
+{{range .Replay}}	{{.}}
+{{end}}}
+{{end}}
+// Writes the first struct of the chain known to this binding, or the largest
+// sType value to end the chain; zero is a valid sType. Unknown structs are
+// skipped.
+static void capture_next(vksCaptureStream* s, const void* next) {
+	for (const VkBaseInStructure* n = next; n != NULL; n = n->pNext) {
+		switch (n->sType) {
+{{range .Chained}}		case {{.SType}}:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof({{.Name}}));
+			capture_{{.Name}}(s, (const {{.Name}}*)n);
+			return;
+{{end}}		default:
+			break;
+		}
+	}
+	capture_u32(s, 0x7FFFFFFF);
+}
+
+static void* replay_next(vksReplay* r, vksReader* rd) {
+	uint32_t sType;
+	replay_raw(rd, &sType, sizeof(sType));
+	switch (sType) {
+{{range .Chained}}	case {{.SType}}: {
+		{{.Name}}* p = replay_alloc(r, sizeof({{.Name}}));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof({{.Name}}));
+		replay_{{.Name}}(r, rd, p);
+		return p;
+	}
+{{end}}	default:
+		return NULL;
+	}
+}
+{{range .Data}}{{if .Define}}
+#ifdef {{.Define}}{{end}}
+{{.Return}} vksCaptured_{{.Name}}(vksProcAddr* addrs{{range .Params}}, {{.}}{{end}}) {
+	vksCaptureStream* s = capture_begin({{.Index}});{{range .Capture}}
+	{{.}}{{end}}
+	{{if ne .Return "void"}}{{.Return}} ret = {{end}}((PFN_{{.Name}})addrs->p{{.Name}})({{join .Args ", "}});{{if .Outputs}}
+	int ok = {{if eq .Return "VkResult"}}ret >= 0{{else}}1{{end}};{{range .Outputs}}
+	{{.}}{{end}}{{end}}
+	capture_end(s);{{if ne .Return "void"}}
+	return ret;{{end}}
+}
+{{if .Replayable}}
+static VkResult replay_{{.Name}}(vksReplay* r, vksReader* rd, uint64_t* ns) {
+{{range .Replay}}	{{.}}
+{{end}}	if (rd->overflow || r->{{if .Global}}global{{else}}procs{{end}}.p{{.Name}} == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	{{if eq .Return "VkResult"}}VkResult ret = {{end}}((PFN_{{.Name}})r->{{if .Global}}global{{else}}procs{{end}}.p{{.Name}})({{join .Args ", "}});
+	*ns = replay_now() - start;{{if .Remap}}{{if eq .Return "VkResult"}}
+	if (ret >= 0) {
+{{range .Remap}}		{{.}}
+{{end}}	}{{else}}{{range .Remap}}
+	{{.}}{{end}}{{end}}{{end}}{{if eq .Name "vkCreateInstance"}}{{if $.InstanceLoad}}
+	if (ret >= 0) {
+		{{$.InstanceLoad}}(*pInstance, &r->procs);
+	}{{end}}{{end}}
+	return {{if eq .Return "VkResult"}}ret{{else}}VK_SUCCESS{{end}};
+}
+{{end}}{{if .Define}}#endif
+{{end}}{{end}}
+// Replays one record. Returns zero when the command is unknown, cannot be
+// replayed or the payload is malformed.
+int vksReplayRecord(vksReplay* r, uint32_t command, const void* data, size_t len, VkResult* result, uint64_t* ns) {
+	vksReader rd = { data, (const uint8_t*)data + len, 0 };
+	replay_reset(r);
+	*ns = 0;
+	switch (command) {
+{{range .Data}}{{if .Replayable}}{{if .Define}}#ifdef {{.Define}}
+{{end}}	case {{.Index}}:
+		*result = replay_{{.Name}}(r, &rd, ns);
+		break;
+{{if .Define}}#endif
+{{end}}{{end}}{{end}}	default:
+		return 0;
+	}
+	return !rd.overflow;
+}
+`
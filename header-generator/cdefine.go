@@ -3,46 +3,87 @@ package main
 import (
 	"fmt"
 	"os"
+	"path/filepath"
+	"strings"
 	"text/template"
 )
 
-func GenerateCDefineFile(config *Config, graph RegistryGraph) error {
+// cDefineShard is the part of the header owned by one shard.
+type cDefineShard struct {
+	Shard  *Shard
+	Header string
+	Guard  string
+	Data   []interface{}
+}
+
+func GenerateCDefineFile(config *Config, graph RegistryGraph, shards *Shards) error {
 	fn := fmt.Sprintf("%s.h", config.OutputName)
 
 	var err error
 	t := template.New(fn).Funcs(template.FuncMap{
-		"cparam":  handleCArraySyntax,
-		"preproc": func() []string { return config.CDefinePreProc },
+		"cparam":     handleCArraySyntax,
+		"preproc":    func() []string { return config.CDefinePreProc },
+		"isFastCall": func(cmd CommandData) bool { return config.IsFastCall(cmd) },
+		"isHandle":   isHandleType,
 	})
-	if t, err = t.Parse(cDefinePrimaryTemplate); err != nil {
-		return err
+	for _, tmpl := range []string{cDefinePrimaryTemplate, cDefineShardTemplate} {
+		if t, err = t.Parse(tmpl); err != nil {
+			return err
+		}
 	}
 
-	data := []interface{}{}
+	groups := make([]*cDefineShard, len(shards.List))
+	index := make(map[*Shard]*cDefineShard, len(shards.List))
+	for k, shard := range shards.List {
+		groups[k] = &cDefineShard{
+			Shard:  shard,
+			Header: filepath.Base(shard.FileName(config.OutputName, ".h")),
+			Guard:  fmt.Sprintf("__VKS_%s_H__", strings.ToUpper(shard.Suffix)),
+		}
+		index[shard] = groups[k]
+	}
 	store := func(path []*RegistryNode) {
 		node := path[len(path)-1]
 		if command := node.CommandElement(); command != nil {
 			if len(command.Alias()) == 0 {
 				if ok, cmd := CommandToData(node, *command); ok {
-					data = append(data, cmd)
+					group := index[shards.Of(node)]
+					group.Data = append(group.Data, cmd)
 				}
 			}
 		}
 	}
 	graph.DepthFirstSearch(config.Enabled(), store)
 
-	var fh *os.File
-	fh, err = os.OpenFile(fn, os.O_WRONLY|os.O_TRUNC|os.O_CREATE, 0644)
-	if err != nil {
-		return err
+	// Shards without commands have nothing to declare.
+	var used []*cDefineShard
+	for _, group := range groups {
+		if group.Shard.Core() || len(group.Data) > 0 {
+			used = append(used, group)
+		}
 	}
-	defer fh.Close()
 
-	err = t.Execute(fh, struct {
-		Data []interface{}
-	}{data})
-	if err != nil {
-		return err
+	for _, group := range used {
+		var fh *os.File
+		fh, err = os.OpenFile(group.Shard.FileName(config.OutputName, ".h"), os.O_WRONLY|os.O_TRUNC|os.O_CREATE, 0644)
+		if err != nil {
+			return err
+		}
+		if group.Shard.Core() {
+			err = t.Execute(fh, struct {
+				Shards []*cDefineShard
+				Data   []interface{}
+			}{used, group.Data})
+		} else {
+			err = t.ExecuteTemplate(fh, "shard", struct {
+				Core *cDefineShard
+				*cDefineShard
+			}{used[0], group})
+		}
+		fh.Close()
+		if err != nil {
+			return err
+		}
 	}
 
 	return nil
@@ -62,15 +103,56 @@ const cDefinePrimaryTemplate = `#ifndef __VKS_H__
 #include <string.h>
 #include "vulkan/vulkan.h"
 
-typedef struct vksProcAddr { {{range .Data}}{{with .Data}}
+typedef struct vksProcAddr { {{range .Shards}}{{if .Shard.Core}}{{range .Data}}{{with .Data}}
+	void* p{{.Name.C}};{{end}}{{end}}{{else}}
+#ifdef {{.Shard.Define}}{{range .Data}}{{with .Data}}
 	void* p{{.Name.C}};{{end}}{{end}}
+#endif{{end}}{{end}}
 } vksProcAddr;
 extern vksProcAddr vksProcAddresses;
 void vksLoadInstanceProcAddrs(VkInstance, vksProcAddr*);
 void vksLoadDeviceProcAddrs(VkDevice, vksProcAddr*, vksProcAddr*);
 
+// A loaded Vulkan implementation: the Vulkan loader, or an installable client
+// driver (ICD) loaded directly.
+typedef struct vksLoader {
+	void* library;
+	int icd;
+	uint32_t icdInterfaceVersion;
+	vksProcAddr procs;
+} vksLoader;
+VkResult vksLoaderOpen(vksLoader*, const char*);
+VkResult vksLoaderOpenICD(vksLoader*, const char*);
+void vksLoaderClose(vksLoader*);
+
 VkResult vksDynamicLoad();
+VkResult vksDynamicLoadLibrary(const char*);
+VkResult vksDynamicLoadICD(const char*);
 void vksDynamicUnload();
-{{range .Data}}{{with .Data}}{{.Return.C}} {{.Name.C}}(vksProcAddr* addrs{{range .Parameters}}, {{cparam .Type .Name}}{{end}});
-{{end}}{{end}}
-#endif`
+
+// The result of a vksEnumerate_ call, and the number of elements it filled,
+// or needs when the result is VK_INCOMPLETE.
+typedef struct vksEnumerateResult {
+	VkResult result;
+	uint32_t count;
+} vksEnumerateResult;
+{{template "prototypes" .Data}}{{range .Shards}}{{if not .Shard.Core}}
+#ifdef {{.Shard.Define}}
+#include "{{.Header}}"
+#endif{{end}}{{end}}
+#endif{{define "prototypes"}}{{range .}}{{with .Data}}{{.Return.C}} {{.Name.C}}(vksProcAddr* addrs{{range .Parameters}}, {{cparam .Type .Name}}{{end}});
+{{if isFastCall .}}typedef struct vksFastArgs_{{.Name.C}} {
+	vksProcAddr* addrs;{{range $key, $val := .Parameters}}
+	{{$val.Type.C}} p{{$key}};{{end}}
+} vksFastArgs_{{.Name.C}};
+void vksFast_{{.Name.C}}(void*);
+{{end}}{{with $cmd := .}}{{with .Enumerate}}vksEnumerateResult vksEnumerate_{{$cmd.Name.C}}(vksProcAddr* addrs{{range .Leading}}, {{if isHandle .Type}}uint64_t {{.Name.C}}{{else}}{{cparam .Type .Name}}{{end}}{{end}}, uint32_t capacity, {{cparam .Items.Type .Items.Name}});
+{{end}}{{end}}{{end}}{{end}}{{end}}`
+
+const cDefineShardTemplate = `{{define "shard"}}#ifndef {{.Guard}}
+#define {{.Guard}}
+#include "{{.Core.Header}}"
+
+// Wrappers of {{.Shard.Name}}.
+{{template "prototypes" .Data}}
+#endif{{end}}`
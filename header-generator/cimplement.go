@@ -3,67 +3,100 @@ package main
 import (
 	"fmt"
 	"os"
+	"path/filepath"
 	"text/template"
 )
 
-func GenerateCImplementFile(config *Config, graph RegistryGraph) error {
+func GenerateCImplementFile(config *Config, graph RegistryGraph, shards *Shards) error {
 	fn := fmt.Sprintf("%s.c", config.OutputName)
-	header := fmt.Sprintf("%s.h", config.OutputName)
+	header := filepath.Base(fmt.Sprintf("%s.h", config.OutputName))
+	capture := ""
+	if len(config.CaptureName) > 0 {
+		capture = filepath.Base(fmt.Sprintf("%s.h", config.CaptureName))
+	}
 
 	var err error
 	t := template.New(fn).Funcs(template.FuncMap{
-		"cparam": handleCArraySyntax,
-		"globalProcs": func() []string {
-			keys := make([]string, 0, len(config.GlobalProcs))
+		"cparam":     handleCArraySyntax,
+		"isFastCall": func(cmd CommandData) bool { return config.IsFastCall(cmd) },
+		"isHandle":   isHandleType,
+		"captured":   func(name Translator) bool { return len(capture) > 0 && !captureSkipCommands[name.C()] },
+		"globalProcs": func() []struct{ Name, Define string } {
+			keys := make([]struct{ Name, Define string }, 0, len(config.GlobalProcs))
 			for _, v := range config.GlobalProcs {
 				if v != "vkGetInstanceProcAddr" {
-					keys = append(keys, v)
+					keys = append(keys, struct{ Name, Define string }{v, shards.Named(v).Define()})
 				}
 			}
 			return keys
 		},
 	})
-	if t, err = t.Parse(cImplementPrimaryTemplate); err != nil {
-		return err
+	for _, tmpl := range []string{cImplementPrimaryTemplate, cImplementShardTemplate} {
+		if t, err = t.Parse(tmpl); err != nil {
+			return err
+		}
 	}
 
-	data := []interface{}{}
+	// Reuses the header grouping; the wrappers of each shard go into their
+	// own file next to the primary one.
+	groups := make([]*cDefineShard, len(shards.List))
+	index := make(map[*Shard]*cDefineShard, len(shards.List))
+	for k, shard := range shards.List {
+		groups[k] = &cDefineShard{Shard: shard}
+		index[shard] = groups[k]
+	}
 	store := func(path []*RegistryNode) {
 		node := path[len(path)-1]
 		if command := node.CommandElement(); command != nil {
 			if len(command.Alias()) == 0 {
 				if ok, cmd := CommandToData(node, *command); ok {
-					data = append(data, cmd)
+					group := index[shards.Of(node)]
+					group.Data = append(group.Data, cmd)
 				}
 			}
 		}
 	}
 	graph.DepthFirstSearch(config.Enabled(), store)
 
-	var fh *os.File
-	fh, err = os.OpenFile(fn, os.O_WRONLY|os.O_TRUNC|os.O_CREATE, 0644)
-	if err != nil {
-		return err
-	}
-	defer fh.Close()
-
-	err = t.Execute(fh, struct {
-		Header string
-		Data   []interface{}
-	}{header, data})
-	if err != nil {
-		return err
+	for _, group := range groups {
+		if !group.Shard.Core() && len(group.Data) == 0 {
+			continue
+		}
+		var fh *os.File
+		fh, err = os.OpenFile(group.Shard.FileName(config.OutputName, ".c"), os.O_WRONLY|os.O_TRUNC|os.O_CREATE, 0644)
+		if err != nil {
+			return err
+		}
+		if group.Shard.Core() {
+			err = t.Execute(fh, struct {
+				Header  string
+				Capture string
+				Shards  []*cDefineShard
+				Data    []interface{}
+			}{header, capture, groups, group.Data})
+		} else {
+			err = t.ExecuteTemplate(fh, "shard", struct {
+				Header  string
+				Capture string
+				*cDefineShard
+			}{header, capture, group})
+		}
+		fh.Close()
+		if err != nil {
+			return err
+		}
 	}
 
 	return nil
 }
 
 const cImplementPrimaryTemplate = `#include <dlfcn.h>
-#include "{{.Header}}"
+#include "{{.Header}}"{{if .Capture}}
+#include "{{.Capture}}"{{end}}
 
-// Global for proc addresses.
+// Global for proc addresses, copied from the default loader.
 vksProcAddr vksProcAddresses;
-void *vulkanHandle = NULL;
+static vksLoader vksDefaultLoader;
 
 #if defined(_WIN64) || defined(_WIN32)
     #define LIB_NAME "vulkan.dll"
@@ -73,36 +106,209 @@ void *vulkanHandle = NULL;
     #define LIB_NAME "libvulkan.dylib"
 #endif
 
+// The newest loader-ICD interface version requested from drivers.
+#define VKS_ICD_INTERFACE_VERSION 7
+
+typedef VkResult (VKAPI_PTR *vksPFN_NegotiateLoaderICDInterfaceVersion)(uint32_t*);
+
 // default dynamic loader?
 VkResult vksDynamicLoad() {
-	// TODO Start: Abstract this block to be specialized as needed.
-	vulkanHandle = dlopen(LIB_NAME, RTLD_NOW | RTLD_LOCAL);
-	if (vulkanHandle == NULL) {
+	const char* libName = getenv("VKS_VULKAN_LIBRARY");
+	if (libName == NULL || libName[0] == '\0') {
+		libName = LIB_NAME;
+	}
+	return vksDynamicLoadLibrary(libName);
+}
+
+// load a specific library, like a stand-in driver for benchmarks.
+VkResult vksDynamicLoadLibrary(const char* libName) {
+	VkResult ret = vksLoaderOpen(&vksDefaultLoader, libName);
+	if (ret == VK_SUCCESS) {
+		vksProcAddresses = vksDefaultLoader.procs;
+	}
+	return ret;
+}
+
+// load a driver directly, skipping the Vulkan loader.
+VkResult vksDynamicLoadICD(const char* libName) {
+	VkResult ret = vksLoaderOpenICD(&vksDefaultLoader, libName);
+	if (ret == VK_SUCCESS) {
+		vksProcAddresses = vksDefaultLoader.procs;
+	}
+	return ret;
+}
+
+void vksDynamicUnload() {
+	vksLoaderClose(&vksDefaultLoader);
+}
+
+// call getProcAddress for the global commands.
+static void vksLoadGlobalProcAddrs(vksProcAddr* addrs) { {{range globalProcs}}{{if .Define}}
+#ifdef {{.Define}}{{end}}
+	addrs->p{{.Name}} = vkGetInstanceProcAddr(addrs, NULL, "{{.Name}}");{{if .Define}}
+#endif{{end}}{{end}}
+}
+
+VkResult vksLoaderOpen(vksLoader* loader, const char* libName) {
+	memset(loader, 0, sizeof(vksLoader));
+	loader->library = dlopen(libName, RTLD_NOW | RTLD_LOCAL);
+	if (loader->library == NULL) {
 		return VK_ERROR_UNKNOWN;
 	}
-	vksProcAddresses.pvkGetInstanceProcAddr = dlsym(vulkanHandle, "vkGetInstanceProcAddr");
-	// TODO end
-{{range globalProcs}}
-	vksProcAddresses.p{{.}} = vkGetInstanceProcAddr(&vksProcAddresses, NULL, "{{.}}");{{end}}
+	loader->procs.pvkGetInstanceProcAddr = dlsym(loader->library, "vkGetInstanceProcAddr");
+	if (loader->procs.pvkGetInstanceProcAddr == NULL) {
+		vksLoaderClose(loader);
+		return VK_ERROR_INCOMPATIBLE_DRIVER;
+	}
+	vksLoadGlobalProcAddrs(&loader->procs);
 	return VK_SUCCESS;
 }
 
-void vksDynamicUnload() {
-	dlclose(vulkanHandle);
+// Drivers leave the layer and version queries to the Vulkan loader.
+__attribute__((unused)) static VKAPI_ATTR VkResult VKAPI_CALL vksIcdEnumerateInstanceLayerProperties(uint32_t* pPropertyCount, VkLayerProperties* pProperties) {
+	*pPropertyCount = 0;
+	return VK_SUCCESS;
 }
 
-// call getProcAddress for all the commands.
-void vksLoadInstanceProcAddrs(VkInstance hndl, vksProcAddr* addrs) { {{range .Data}}{{with .Data}}
-	addrs->p{{.Name.C}} = vkGetInstanceProcAddr(&vksProcAddresses, hndl, "{{.Name.C}}");{{end}}{{end}}
+__attribute__((unused)) static VKAPI_ATTR VkResult VKAPI_CALL vksIcdEnumerateInstanceVersion(uint32_t* pApiVersion) {
+	*pApiVersion = VK_API_VERSION_1_0;
+	return VK_SUCCESS;
+}
+
+// Loads a driver the way the Vulkan loader does, following the loader-ICD
+// interface: the interface version is negotiated, and every command is
+// resolved through vk_icdGetInstanceProcAddr. Drivers older than the
+// negotiation export vkGetInstanceProcAddr instead.
+VkResult vksLoaderOpenICD(vksLoader* loader, const char* libName) {
+	memset(loader, 0, sizeof(vksLoader));
+	loader->library = dlopen(libName, RTLD_NOW | RTLD_LOCAL);
+	if (loader->library == NULL) {
+		return VK_ERROR_UNKNOWN;
+	}
+	loader->icd = 1;
+	void* gipa = dlsym(loader->library, "vk_icdGetInstanceProcAddr");
+	vksPFN_NegotiateLoaderICDInterfaceVersion negotiate = (vksPFN_NegotiateLoaderICDInterfaceVersion)dlsym(loader->library, "vk_icdNegotiateLoaderICDInterfaceVersion");
+	if (negotiate != NULL) {
+		loader->icdInterfaceVersion = VKS_ICD_INTERFACE_VERSION;
+		if (negotiate(&loader->icdInterfaceVersion) != VK_SUCCESS) {
+			vksLoaderClose(loader);
+			return VK_ERROR_INCOMPATIBLE_DRIVER;
+		}
+	} else if (gipa != NULL) {
+		loader->icdInterfaceVersion = 1;
+	}
+	if (gipa == NULL) {
+		gipa = dlsym(loader->library, "vkGetInstanceProcAddr");
+	}
+	if (gipa == NULL) {
+		vksLoaderClose(loader);
+		return VK_ERROR_INCOMPATIBLE_DRIVER;
+	}
+	loader->procs.pvkGetInstanceProcAddr = gipa;
+	vksLoadGlobalProcAddrs(&loader->procs);{{range globalProcs}}{{if eq .Name "vkEnumerateInstanceLayerProperties" "vkEnumerateInstanceVersion"}}{{if .Define}}
+#ifdef {{.Define}}{{end}}
+	if (loader->procs.p{{.Name}} == NULL) {
+		loader->procs.p{{.Name}} = (void*)vksIcd{{slice .Name 2}};
+	}{{if .Define}}
+#endif{{end}}{{end}}{{end}}
+	return VK_SUCCESS;
+}
+
+void vksLoaderClose(vksLoader* loader) {
+	if (loader->library != NULL) {
+		dlclose(loader->library);
+	}
+	memset(loader, 0, sizeof(vksLoader));
+}
+
+// call getProcAddress for all the commands. The vkGetInstanceProcAddr in
+// addrs selects the loader; the default loader is used when it is NULL.
+void vksLoadInstanceProcAddrs(VkInstance hndl, vksProcAddr* addrs) {
+	vksProcAddr loader = {0};
+	loader.pvkGetInstanceProcAddr = addrs->pvkGetInstanceProcAddr != NULL ? addrs->pvkGetInstanceProcAddr : vksProcAddresses.pvkGetInstanceProcAddr;{{range .Shards}}{{if .Shard.Define}}{{if .Data}}
+#ifdef {{.Shard.Define}}{{end}}{{end}}{{range .Data}}{{with .Data}}
+	addrs->p{{.Name.C}} = vkGetInstanceProcAddr(&loader, hndl, "{{.Name.C}}");{{end}}{{end}}{{if .Shard.Define}}{{if .Data}}
+#endif{{end}}{{end}}{{end}}
 }
 
 // call getProcAddress for all the commands.
-void vksLoadDeviceProcAddrs(VkDevice hndl, vksProcAddr* addrs, vksProcAddr* parent) { {{range .Data}}{{with .Data}}
-	addrs->p{{.Name.C}} = vkGetDeviceProcAddr(parent, hndl, "{{.Name.C}}");{{end}}{{end}}
+void vksLoadDeviceProcAddrs(VkDevice hndl, vksProcAddr* addrs, vksProcAddr* parent) { {{range .Shards}}{{if .Shard.Define}}{{if .Data}}
+#ifdef {{.Shard.Define}}{{end}}{{end}}{{range .Data}}{{with .Data}}
+	addrs->p{{.Name.C}} = vkGetDeviceProcAddr(parent, hndl, "{{.Name.C}}");{{end}}{{end}}{{if .Shard.Define}}{{if .Data}}
+#endif{{end}}{{end}}{{end}}
 }
 
-{{range .Data}}{{with .Data}}{{.Return.C}} {{.Name.C}}(vksProcAddr* addrs{{range .Parameters}}, {{cparam .Type .Name}}{{end}}) {
+{{template "wrappers" .Data}}`
+
+const cImplementShardTemplate = `{{define "shard"}}//go:build {{.Shard.Constraint}}
+
+// Wrappers of {{.Shard.Name}}.
+#include "{{.Header}}"{{if .Capture}}
+#include "{{.Capture}}"{{end}}
+
+{{template "wrappers" .Data}}{{end}}{{define "wrappers"}}{{range .}}{{with .Data}}{{.Return.C}} {{.Name.C}}(vksProcAddr* addrs{{range .Parameters}}, {{cparam .Type .Name}}{{end}}) { {{if captured .Name}}
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		{{if ne .Return.C "void"}}return {{end}}vksCaptured_{{.Name.C}}(addrs{{range .Parameters}}, {{.Name.C}}{{end}});{{if eq .Return.C "void"}}
+		return;{{end}}
+	}{{end}}
 	{{if ne .Return.C "void"}}{{.Return.C}} ret = {{end}}(((PFN_{{.Name.C}})addrs->p{{.Name.C}})({{range $idx, $param := .Parameters}}{{if ne $idx 0}}, {{end}}{{$param.Name.C}}{{end}}));{{if ne .Return.C "void"}}
 	return ret;{{end}}
 }
-{{end}}{{end}}`
+{{if isFastCall .}}
+// Called on the system stack by the Fast method, with a vksFastArgs_{{.Name.C}}.
+// It calls the driver directly: the capture wrappers can block on the Go
+// writer, which the trampoline would deadlock, so the Fast method uses cgo
+// while a capture runs.
+void vksFast_{{.Name.C}}(void* p) {
+	vksFastArgs_{{.Name.C}}* a = p;
+	((PFN_{{.Name.C}})a->addrs->p{{.Name.C}})({{range $key, $val := .Parameters}}{{if ne $key 0}}, {{end}}a->p{{$key}}{{end}});
+}
+{{end}}{{with $cmd := .}}{{with .Enumerate}}
+// Runs the two-call idiom of {{$cmd.Name.C}} in one call. capacity is the
+// length of {{.Items.Name.C}}; when it is too small, the result is VK_INCOMPLETE
+// with the count needed.
+vksEnumerateResult vksEnumerate_{{$cmd.Name.C}}(vksProcAddr* addrs{{range .Leading}}, {{if isHandle .Type}}uint64_t {{.Name.C}}{{else}}{{cparam .Type .Name}}{{end}}{{end}}, uint32_t capacity, {{cparam .Items.Type .Items.Name}}) {
+	vksEnumerateResult r = { VK_SUCCESS, capacity };{{if .SType}}
+	for (uint32_t i = 0; i < capacity; i++) {
+		{{.Items.Name.C}}[i].sType = {{.SType}};
+	}{{end}}{{if eq $cmd.Return.C "void"}}
+	r.count = 0;
+	{{$cmd.Name.C}}(addrs{{range .Leading}}, {{if isHandle .Type}}({{.Type.C}})(uintptr_t){{end}}{{.Name.C}}{{end}}, &r.count, NULL);
+	if (r.count > capacity) {
+		r.result = VK_INCOMPLETE;
+		return r;
+	}
+	{{$cmd.Name.C}}(addrs{{range .Leading}}, {{if isHandle .Type}}({{.Type.C}})(uintptr_t){{end}}{{.Name.C}}{{end}}, &r.count, {{.Items.Name.C}});
+	return r;{{else}}
+	if (capacity > 0) {
+		// Large enough buffers skip the count query.
+		r.result = {{$cmd.Name.C}}(addrs{{range .Leading}}, {{if isHandle .Type}}({{.Type.C}})(uintptr_t){{end}}{{.Name.C}}{{end}}, &r.count, {{.Items.Name.C}});
+		if (r.result < 0) {
+			r.count = 0;
+		}
+		if (r.result != VK_INCOMPLETE) {
+			return r;
+		}
+	}
+	for (;;) {
+		r.count = 0;
+		r.result = {{$cmd.Name.C}}(addrs{{range .Leading}}, {{if isHandle .Type}}({{.Type.C}})(uintptr_t){{end}}{{.Name.C}}{{end}}, &r.count, NULL);
+		if (r.result < 0) {
+			r.count = 0;
+			return r;
+		}
+		if (r.count > capacity) {
+			r.result = VK_INCOMPLETE;
+			return r;
+		}
+		r.result = {{$cmd.Name.C}}(addrs{{range .Leading}}, {{if isHandle .Type}}({{.Type.C}})(uintptr_t){{end}}{{.Name.C}}{{end}}, &r.count, {{.Items.Name.C}});
+		if (r.result != VK_INCOMPLETE) {
+			if (r.result < 0) {
+				r.count = 0;
+			}
+			return r;
+		}
+		// The count grew between the calls.
+	}{{end}}
+}
+{{end}}{{end}}{{end}}{{end}}{{end}}`
@@ -0,0 +1,557 @@
+package main
+
+import (
+	"fmt"
+	"os"
+	"path/filepath"
+	"sort"
+	"strings"
+	"text/template"
+)
+
+// nullDriverNameSize is the size of an entry in the shared memory names table.
+const nullDriverNameSize = 64
+
+// NullDriverCommand is the data needed to emit one entry point of the null
+// driver.
+type NullDriverCommand struct {
+	Index  int      // Position in the shared memory tables.
+	Name   string   // e.g. vkCreateBuffer
+	Return string   // e.g. VkResult
+	Params []string // C parameter declarations.
+	Trace  []string // Parameters converted to uint64_t for recording.
+	Body   string   // C statements implementing the command.
+}
+
+// nullDriverOverrides replaces the generated body of commands where returning
+// success is not enough for the binding to keep working. Memory is backed by
+// real host memory so mapped writes are safe, and the physical device reports
+// a single queue family and a single host visible, coherent memory type.
+var nullDriverOverrides = map[string]string{
+	"vkGetInstanceProcAddr": `return null_lookup(pName);`,
+	"vkGetDeviceProcAddr":   `return null_lookup(pName);`,
+	"vkEnumerateInstanceVersion": `*pApiVersion = NULL_API_VERSION;
+	return VK_SUCCESS;`,
+	"vkDestroyInstance": `free(instance);`,
+	"vkDestroyDevice":   `free(device);`,
+	"vkFreeCommandBuffers": `for (uint32_t i = 0; i < commandBufferCount; i++) {
+		free(pCommandBuffers[i]);
+	}`,
+	"vkAllocateMemory": `void* mem = calloc(1, pAllocateInfo->allocationSize > 0 ? pAllocateInfo->allocationSize : 1);
+	if (mem == NULL) {
+		return VK_ERROR_OUT_OF_HOST_MEMORY;
+	}
+	*pMemory = (VkDeviceMemory)(uintptr_t)mem;
+	return VK_SUCCESS;`,
+	"vkFreeMemory": `free((void*)(uintptr_t)memory);`,
+	"vkMapMemory": `*ppData = (char*)(uintptr_t)memory + offset;
+	return VK_SUCCESS;`,
+	"vkCreateBuffer": `null_sized* obj = malloc(sizeof(null_sized));
+	if (obj == NULL) {
+		return VK_ERROR_OUT_OF_HOST_MEMORY;
+	}
+	obj->size = pCreateInfo->size;
+	*pBuffer = (VkBuffer)(uintptr_t)obj;
+	return VK_SUCCESS;`,
+	"vkDestroyBuffer": `free((void*)(uintptr_t)buffer);`,
+	"vkCreateImage": `null_sized* obj = malloc(sizeof(null_sized));
+	if (obj == NULL) {
+		return VK_ERROR_OUT_OF_HOST_MEMORY;
+	}
+	obj->size = null_image_size(pCreateInfo);
+	*pImage = (VkImage)(uintptr_t)obj;
+	return VK_SUCCESS;`,
+	"vkDestroyImage":                       `free((void*)(uintptr_t)image);`,
+	"vkGetBufferMemoryRequirements":        `null_memory_requirements(((null_sized*)(uintptr_t)buffer)->size, pMemoryRequirements);`,
+	"vkGetBufferMemoryRequirements2":       `null_memory_requirements(((null_sized*)(uintptr_t)pInfo->buffer)->size, &pMemoryRequirements->memoryRequirements);`,
+	"vkGetImageMemoryRequirements":         `null_memory_requirements(((null_sized*)(uintptr_t)image)->size, pMemoryRequirements);`,
+	"vkGetImageMemoryRequirements2":        `null_memory_requirements(((null_sized*)(uintptr_t)pInfo->image)->size, &pMemoryRequirements->memoryRequirements);`,
+	"vkGetDeviceBufferMemoryRequirements":  `null_memory_requirements(pInfo->pCreateInfo->size, &pMemoryRequirements->memoryRequirements);`,
+	"vkGetDeviceImageMemoryRequirements":   `null_memory_requirements(null_image_size(pInfo->pCreateInfo), &pMemoryRequirements->memoryRequirements);`,
+	"vkGetPhysicalDeviceMemoryProperties":  `null_memory_properties(pMemoryProperties);`,
+	"vkGetPhysicalDeviceMemoryProperties2": `null_memory_properties(&pMemoryProperties->memoryProperties);`,
+	"vkGetPhysicalDeviceProperties":        `null_physical_device_properties(pProperties);`,
+	"vkGetPhysicalDeviceProperties2":       `null_physical_device_properties(&pProperties->properties);`,
+	"vkGetPhysicalDeviceQueueFamilyProperties": `if (pQueueFamilyProperties == NULL) {
+		*pQueueFamilyPropertyCount = 1;
+	} else if (*pQueueFamilyPropertyCount > 0) {
+		*pQueueFamilyPropertyCount = 1;
+		null_queue_family_properties(pQueueFamilyProperties);
+	}`,
+	"vkGetPhysicalDeviceQueueFamilyProperties2": `if (pQueueFamilyProperties == NULL) {
+		*pQueueFamilyPropertyCount = 1;
+	} else if (*pQueueFamilyPropertyCount > 0) {
+		*pQueueFamilyPropertyCount = 1;
+		null_queue_family_properties(&pQueueFamilyProperties->queueFamilyProperties);
+	}`,
+	"vkGetSemaphoreCounterValue": `*pValue = UINT64_MAX;
+	return VK_SUCCESS;`,
+}
+
+// GenerateCNullDriverFile writes a stand-in Vulkan implementation that exports
+// the enabled command set. Every command succeeds and create commands return
+// unique fake handles. It is skipped when no null driver name is configured.
+func GenerateCNullDriverFile(config *Config, graph RegistryGraph) error {
+	if len(config.NullDriverName) == 0 {
+		return nil
+	}
+	fn := fmt.Sprintf("%s.c", config.NullDriverName)
+
+	var err error
+	t := template.New(fn).Funcs(template.FuncMap{
+		"preproc": func() []string { return config.CDefinePreProc },
+	})
+	if t, err = t.Parse(cNullDriverPrimaryTemplate); err != nil {
+		return err
+	}
+
+	handles := make(map[string]bool, 0) // handle name to dispatchable
+	commands := []CommandElement{}
+	store := func(path []*RegistryNode) {
+		node := path[len(path)-1]
+		if tiepuh := node.TypeElement(); tiepuh != nil {
+			if tiepuh.Category == TypeCategoryHandle && len(tiepuh.Alias) == 0 {
+				handles[tiepuh.Name()] = tiepuh.TypeTag == "VK_DEFINE_HANDLE"
+			}
+		}
+		if command := node.CommandElement(); command != nil {
+			if len(command.Alias()) == 0 {
+				commands = append(commands, *command)
+			}
+		}
+	}
+	graph.DepthFirstSearch(config.Enabled(), store)
+
+	data := make([]NullDriverCommand, 0, len(commands))
+	maxArgs := 1
+	for _, command := range commands {
+		ok, tmp := CommandToData(nil, command)
+		if !ok {
+			continue
+		}
+		cmd := tmp.(*struct {
+			Template string
+			Data     CommandData
+		}).Data
+		if len(command.Name()) >= nullDriverNameSize {
+			return fmt.Errorf("command name %s does not fit the null driver names table", command.Name())
+		}
+		entry := NullDriverCommand{
+			Index:  len(data),
+			Name:   command.Name(),
+			Return: cmd.Return.C(),
+		}
+		for k, v := range cmd.Parameters {
+			entry.Params = append(entry.Params, handleCArraySyntax(v.Type, v.Name))
+			entry.Trace = append(entry.Trace, nullDriverTraceArg(command.Params[k], handles))
+		}
+		if body, ok := nullDriverOverrides[entry.Name]; ok {
+			entry.Body = body
+		} else {
+			entry.Body = nullDriverDefaultBody(command, entry.Return, handles)
+		}
+		if len(entry.Trace) > maxArgs {
+			maxArgs = len(entry.Trace)
+		}
+		data = append(data, entry)
+	}
+
+	sorted := make([]NullDriverCommand, len(data))
+	copy(sorted, data)
+	sort.Slice(sorted, func(a, b int) bool { return sorted[a].Name < sorted[b].Name })
+
+	if err = os.MkdirAll(filepath.Dir(fn), 0755); err != nil {
+		return err
+	}
+	var fh *os.File
+	fh, err = os.OpenFile(fn, os.O_WRONLY|os.O_TRUNC|os.O_CREATE, 0644)
+	if err != nil {
+		return err
+	}
+	defer fh.Close()
+
+	err = t.Execute(fh, struct {
+		ApiVersion string
+		NameSize   int
+		MaxArgs    int
+		Data       []NullDriverCommand
+		Sorted     []NullDriverCommand
+	}{nullDriverApiVersion(config), nullDriverNameSize, maxArgs, data, sorted})
+	if err != nil {
+		return err
+	}
+
+	return nil
+}
+
+// nullDriverApiVersion returns the VK_API_VERSION define of the highest
+// enabled core version.
+func nullDriverApiVersion(config *Config) string {
+	version := "VK_API_VERSION_1_0"
+	for _, v := range config.Features {
+		if candidate := strings.Replace(v, "VK_VERSION_", "VK_API_VERSION_", 1); candidate > version {
+			version = candidate
+		}
+	}
+	return version
+}
+
+// nullDriverTraceArg converts a parameter to the uint64_t stored in the
+// argument records. Floats are stored as their bit pattern.
+func nullDriverTraceArg(param CommandParamElement, handles map[string]bool) string {
+	if strings.ContainsAny(param.Raw, "*[") {
+		return fmt.Sprintf("(uint64_t)(uintptr_t)%s", param.Name)
+	} else if param.Type == "float" {
+		return fmt.Sprintf("null_f32(%s)", param.Name)
+	} else if _, ok := handles[param.Type]; ok {
+		return fmt.Sprintf("(uint64_t)(uintptr_t)%s", param.Name)
+	}
+	return fmt.Sprintf("(uint64_t)%s", param.Name)
+}
+
+// nullDriverHandleValue returns the C expression producing a new fake handle.
+func nullDriverHandleValue(handle string, dispatchable bool) string {
+	switch {
+	case handle == "VkPhysicalDevice":
+		return "(VkPhysicalDevice)&null_physical_device"
+	case handle == "VkQueue":
+		return "(VkQueue)&null_queue"
+	case dispatchable:
+		return fmt.Sprintf("(%s)null_dispatchable()", handle)
+	}
+	return fmt.Sprintf("(%s)(uintptr_t)null_handle()", handle)
+}
+
+// nullDriverDefaultBody fills output handles with fake values, reports one
+// element for handle enumerations and zero elements for every other
+// enumeration, and returns success.
+func nullDriverDefaultBody(command CommandElement, ret string, handles map[string]bool) string {
+	params := make(map[string]CommandParamElement, len(command.Params))
+	for _, v := range command.Params {
+		params[v.Name] = v
+	}
+
+	lines := []string{}
+	counted := make(map[string]bool, 0)
+	for _, v := range command.Params {
+		if strings.Contains(v.Raw, "const") || !strings.Contains(v.Raw, "*") {
+			continue
+		}
+		dispatchable, isHandle := handles[v.Type]
+		count, isEnumeration := params[v.Length]
+		isEnumeration = isEnumeration && strings.Contains(count.Raw, "*")
+		switch {
+		case isHandle && len(v.Length) == 0:
+			lines = append(lines, fmt.Sprintf("*%s = %s;", v.Name, nullDriverHandleValue(v.Type, dispatchable)))
+		case isHandle && isEnumeration:
+			counted[count.Name] = true
+			lines = append(lines, fmt.Sprintf(`if (%[1]s == NULL) {
+		*%[2]s = 1;
+	} else if (*%[2]s > 0) {
+		*%[2]s = 1;
+		%[1]s[0] = %[3]s;
+	}`, v.Name, count.Name, nullDriverHandleValue(v.Type, dispatchable)))
+		case isHandle:
+			length := strings.ReplaceAll(v.Length, "::", "->")
+			lines = append(lines, fmt.Sprintf(`for (uint32_t i = 0; i < %s; i++) {
+		%s[i] = %s;
+	}`, length, v.Name, nullDriverHandleValue(v.Type, dispatchable)))
+		case isEnumeration && !counted[count.Name]:
+			counted[count.Name] = true
+			lines = append(lines, fmt.Sprintf("*%s = 0;", count.Name))
+		}
+	}
+
+	switch ret {
+	case "void":
+	case "VkResult":
+		lines = append(lines, "return VK_SUCCESS;")
+	default:
+		lines = append(lines, "return 0;")
+	}
+	if len(lines) == 0 {
+		return "return;"
+	}
+	return strings.Join(lines, "\n\t")
+}
+
+const cNullDriverPrimaryTemplate = `// Stand-in Vulkan implementation with a near zero cost per call. Every
+// command succeeds, create commands return unique fake handles, and
+// enumerations report a single handle or no elements.
+//
+// Build it as a shared library and point VKS_VULKAN_LIBRARY (or InitLibrary)
+// at it to measure the overhead of the binding without a driver.
+//
+// When VKS_NULL_SHM names a POSIX shared memory object, calls are counted in
+// it. When VKS_NULL_RECORD is also set to a record count, the arguments of
+// every call are written into a ring of that many records. The layout is a
+// vksNullShmHeader, commandCount names of VKS_NULL_NAME_SIZE bytes,
+// commandCount uint64_t call counts and recordCapacity vksNullRecords. The
+// sequence of a record is written last; records may be overwritten while
+// they are being read.{{range preproc}}
+{{.}}{{end}}
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "vulkan/vulkan.h"
+
+#define NULL_API_VERSION {{.ApiVersion}}
+#define VKS_NULL_SHM_MAGIC 0x4e534b56
+#define VKS_NULL_SHM_VERSION 1
+#define VKS_NULL_NAME_SIZE {{.NameSize}}
+#define VKS_NULL_COMMAND_COUNT {{len .Data}}
+#define VKS_NULL_MAX_ARGS {{.MaxArgs}}
+
+typedef struct vksNullShmHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t commandCount;
+	uint32_t maxArgs;
+	uint64_t recordCapacity;
+	uint64_t recordHead;
+} vksNullShmHeader;
+
+typedef struct vksNullRecord {
+	uint64_t sequence;
+	uint32_t command;
+	uint32_t argCount;
+	uint64_t args[VKS_NULL_MAX_ARGS];
+} vksNullRecord;
+
+static const char* null_names[VKS_NULL_COMMAND_COUNT] = { {{range .Data}}
+	"{{.Name}}",{{end}}
+};
+
+static vksNullShmHeader* null_shm = NULL;
+static uint64_t* null_counts = NULL;
+static vksNullRecord* null_records = NULL;
+
+__attribute__((constructor)) static void null_init() {
+	const char* name = getenv("VKS_NULL_SHM");
+	if (name == NULL || name[0] == '\0') {
+		return;
+	}
+	const char* record = getenv("VKS_NULL_RECORD");
+	uint64_t capacity = record == NULL ? 0 : strtoull(record, NULL, 10);
+	size_t namesSize = VKS_NULL_COMMAND_COUNT * VKS_NULL_NAME_SIZE;
+	size_t countsSize = VKS_NULL_COMMAND_COUNT * sizeof(uint64_t);
+	size_t size = sizeof(vksNullShmHeader) + namesSize + countsSize + capacity * sizeof(vksNullRecord);
+
+	int fd = shm_open(name, O_RDWR | O_CREAT, 0600);
+	if (fd < 0) {
+		return;
+	}
+	if (ftruncate(fd, size) != 0) {
+		close(fd);
+		return;
+	}
+	void* ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (ptr == MAP_FAILED) {
+		return;
+	}
+
+	memset(ptr, 0, size);
+	vksNullShmHeader* hdr = ptr;
+	hdr->commandCount = VKS_NULL_COMMAND_COUNT;
+	hdr->maxArgs = VKS_NULL_MAX_ARGS;
+	hdr->recordCapacity = capacity;
+	char* names = (char*)(hdr + 1);
+	for (int i = 0; i < VKS_NULL_COMMAND_COUNT; i++) {
+		strncpy(names + i * VKS_NULL_NAME_SIZE, null_names[i], VKS_NULL_NAME_SIZE - 1);
+	}
+	null_counts = (uint64_t*)(names + namesSize);
+	null_records = capacity > 0 ? (vksNullRecord*)(null_counts + VKS_NULL_COMMAND_COUNT) : NULL;
+	hdr->version = VKS_NULL_SHM_VERSION;
+	__atomic_store_n(&hdr->magic, VKS_NULL_SHM_MAGIC, __ATOMIC_RELEASE);
+	null_shm = hdr;
+}
+
+static void null_trace(uint32_t command, const uint64_t* args, uint32_t argCount) {
+	__atomic_add_fetch(&null_counts[command], 1, __ATOMIC_RELAXED);
+	if (null_records == NULL) {
+		return;
+	}
+	uint64_t sequence = __atomic_add_fetch(&null_shm->recordHead, 1, __ATOMIC_RELAXED);
+	vksNullRecord* rec = &null_records[(sequence - 1) % null_shm->recordCapacity];
+	rec->command = command;
+	rec->argCount = argCount;
+	memcpy(rec->args, args, argCount * sizeof(uint64_t));
+	__atomic_store_n(&rec->sequence, sequence, __ATOMIC_RELEASE);
+}
+
+static uint64_t null_f32(float f) {
+	uint32_t bits;
+	memcpy(&bits, &f, sizeof(bits));
+	return bits;
+}
+
+// Dispatchable handles must point at memory starting with the loader magic.
+typedef struct null_object {
+	uintptr_t loaderMagic;
+	uint64_t id;
+} null_object;
+
+static uint64_t null_next_handle = 0;
+static null_object null_physical_device = { 0x01CDC0DE, 0 };
+static null_object null_queue = { 0x01CDC0DE, 0 };
+
+static uint64_t null_handle() {
+	return __atomic_add_fetch(&null_next_handle, 1, __ATOMIC_RELAXED);
+}
+
+static void* null_dispatchable() {
+	null_object* obj = malloc(sizeof(null_object));
+	if (obj != NULL) {
+		obj->loaderMagic = 0x01CDC0DE;
+		obj->id = null_handle();
+	}
+	return obj;
+}
+
+// Buffers and images remember their size to report memory requirements.
+typedef struct null_sized {
+	VkDeviceSize size;
+} null_sized;
+
+static VkDeviceSize null_image_size(const VkImageCreateInfo* info) {
+	// An upper bound of 16 bytes per texel, with room for the mip chain.
+	VkDeviceSize texels = (VkDeviceSize)info->extent.width * info->extent.height * info->extent.depth;
+	return texels * info->arrayLayers * 16 * (info->mipLevels > 1 ? 2 : 1);
+}
+
+static void null_memory_requirements(VkDeviceSize size, VkMemoryRequirements* reqs) {
+	reqs->alignment = 256;
+	reqs->size = (size + reqs->alignment - 1) & ~(reqs->alignment - 1);
+	reqs->memoryTypeBits = 1;
+}
+
+static void null_memory_properties(VkPhysicalDeviceMemoryProperties* props) {
+	memset(props, 0, sizeof(*props));
+	props->memoryTypeCount = 1;
+	props->memoryTypes[0].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT |
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+		VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+	props->memoryTypes[0].heapIndex = 0;
+	props->memoryHeapCount = 1;
+	props->memoryHeaps[0].size = (VkDeviceSize)1 << 32;
+	props->memoryHeaps[0].flags = VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
+}
+
+static void null_queue_family_properties(VkQueueFamilyProperties* props) {
+	memset(props, 0, sizeof(*props));
+	props->queueFlags = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+	props->queueCount = 1;
+	props->timestampValidBits = 64;
+	props->minImageTransferGranularity.width = 1;
+	props->minImageTransferGranularity.height = 1;
+	props->minImageTransferGranularity.depth = 1;
+}
+
+static void null_physical_device_properties(VkPhysicalDeviceProperties* props) {
+	memset(props, 0, sizeof(*props));
+	props->apiVersion = NULL_API_VERSION;
+	props->driverVersion = 1;
+	props->deviceType = VK_PHYSICAL_DEVICE_TYPE_CPU;
+	strncpy(props->deviceName, "vks null driver", VK_MAX_PHYSICAL_DEVICE_NAME_SIZE - 1);
+
+	VkPhysicalDeviceLimits* limits = &props->limits;
+	limits->maxImageDimension1D = 16384;
+	limits->maxImageDimension2D = 16384;
+	limits->maxImageDimension3D = 2048;
+	limits->maxImageDimensionCube = 16384;
+	limits->maxImageArrayLayers = 2048;
+	limits->maxUniformBufferRange = 65536;
+	limits->maxStorageBufferRange = UINT32_MAX;
+	limits->maxPushConstantsSize = 256;
+	limits->maxMemoryAllocationCount = UINT32_MAX;
+	limits->maxSamplerAllocationCount = UINT32_MAX;
+	limits->bufferImageGranularity = 1;
+	limits->maxBoundDescriptorSets = 32;
+	limits->maxPerStageResources = UINT32_MAX;
+	limits->maxDescriptorSetUniformBuffersDynamic = 16;
+	limits->maxDescriptorSetStorageBuffersDynamic = 16;
+	limits->maxVertexInputAttributes = 32;
+	limits->maxVertexInputBindings = 32;
+	limits->maxComputeSharedMemorySize = 65536;
+	limits->maxComputeWorkGroupCount[0] = 65535;
+	limits->maxComputeWorkGroupCount[1] = 65535;
+	limits->maxComputeWorkGroupCount[2] = 65535;
+	limits->maxComputeWorkGroupInvocations = 1024;
+	limits->maxComputeWorkGroupSize[0] = 1024;
+	limits->maxComputeWorkGroupSize[1] = 1024;
+	limits->maxComputeWorkGroupSize[2] = 64;
+	limits->maxViewports = 16;
+	limits->maxViewportDimensions[0] = 16384;
+	limits->maxViewportDimensions[1] = 16384;
+	limits->minMemoryMapAlignment = 64;
+	limits->minTexelBufferOffsetAlignment = 16;
+	limits->minUniformBufferOffsetAlignment = 256;
+	limits->minStorageBufferOffsetAlignment = 256;
+	limits->maxFramebufferWidth = 16384;
+	limits->maxFramebufferHeight = 16384;
+	limits->maxFramebufferLayers = 2048;
+	limits->maxColorAttachments = 8;
+	limits->timestampComputeAndGraphics = VK_TRUE;
+	limits->timestampPeriod = 1.0f;
+	limits->optimalBufferCopyOffsetAlignment = 1;
+	limits->optimalBufferCopyRowPitchAlignment = 1;
+	limits->nonCoherentAtomSize = 64;
+}
+
+static PFN_vkVoidFunction null_lookup(const char* pName);
+{{range .Data}}
+static VKAPI_ATTR {{.Return}} VKAPI_CALL null_{{.Name}}({{range $idx, $param := .Params}}{{if ne $idx 0}}, {{end}}{{$param}}{{end}}) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { {{range $idx, $arg := .Trace}}{{if ne $idx 0}}, {{end}}{{$arg}}{{end}} };
+		null_trace({{.Index}}, args, {{len .Trace}});
+	}
+	{{.Body}}
+}
+{{end}}
+typedef struct null_entry {
+	const char* name;
+	PFN_vkVoidFunction func;
+} null_entry;
+
+// Sorted by name for the binary search in null_lookup.
+static const null_entry null_entries[VKS_NULL_COMMAND_COUNT] = { {{range .Sorted}}
+	{ "{{.Name}}", (PFN_vkVoidFunction)null_{{.Name}} },{{end}}
+};
+
+static int null_compare(const void* key, const void* entry) {
+	return strcmp((const char*)key, ((const null_entry*)entry)->name);
+}
+
+static PFN_vkVoidFunction null_lookup(const char* pName) {
+	const null_entry* entry = bsearch(pName, null_entries, VKS_NULL_COMMAND_COUNT, sizeof(null_entry), null_compare);
+	return entry == NULL ? NULL : entry->func;
+}
+
+__attribute__((visibility("default"))) VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(VkInstance instance, const char* pName) {
+	return null_lookup(pName);
+}
+
+__attribute__((visibility("default"))) VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(VkDevice device, const char* pName) {
+	return null_lookup(pName);
+}
+
+// Loader-ICD interface, so the driver can also be loaded with vks.OpenICD.
+__attribute__((visibility("default"))) VKAPI_ATTR VkResult VKAPI_CALL vk_icdNegotiateLoaderICDInterfaceVersion(uint32_t* pSupportedVersion) {
+	if (*pSupportedVersion > 5) {
+		*pSupportedVersion = 5;
+	}
+	return VK_SUCCESS;
+}
+
+__attribute__((visibility("default"))) VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vk_icdGetInstanceProcAddr(VkInstance instance, const char* pName) {
+	return null_lookup(pName);
+}
+
+__attribute__((visibility("default"))) VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vk_icdGetPhysicalDeviceProcAddr(VkInstance instance, const char* pName) {
+	return null_lookup(pName);
+}
+`
@@ -3,10 +3,11 @@ package main
 import (
 	"fmt"
 	"os"
+	"strings"
 	"text/template"
 )
 
-func GenerateGoFile(config *Config, constants *RegistryNode, graph RegistryGraph) error {
+func GenerateGoFile(config *Config, constants *RegistryNode, graph RegistryGraph, shards *Shards) error {
 	fn := fmt.Sprintf("%s.go", config.OutputName)
 	header := fmt.Sprintf("%s.h", config.OutputName)
 	needsFacade := determineFacades(config, graph)
@@ -24,12 +25,24 @@ func GenerateGoFile(config *Config, constants *RegistryNode, graph RegistryGraph
 			}
 			return params[1:]
 		},
+		"ooEnumParams": func(name Translator, params []CommandParamData) []CommandParamData {
+			if config.IsGlobalProc(name.C()) || len(params) == 0 {
+				return params
+			}
+			return params[1:]
+		},
 		"needsFacade": func(name Translator) bool {
 			return needsFacade[name.C()]
 		},
+		"isFastCall": func(cmd CommandData) bool {
+			return config.IsFastCall(cmd)
+		},
+		"isHandle": isHandleType,
 	})
 	templates := []string{
 		goPrimaryTemplate,
+		goNodeTemplate,
+		goShardTemplate,
 		goDocURLTemplate,
 		goConstTemplate,
 		goVersionTemplate,
@@ -45,6 +58,7 @@ func GenerateGoFile(config *Config, constants *RegistryNode, graph RegistryGraph
 	}
 
 	data := append([]interface{}{}, ConstToData(constants))
+	owners := []*Shard{shards.Core()}
 	store := func(nodes []*RegistryNode) {
 		node := nodes[len(nodes)-1]
 		switch node.NodeType {
@@ -52,37 +66,77 @@ func GenerateGoFile(config *Config, constants *RegistryNode, graph RegistryGraph
 			if tiepuh := node.TypeElement(); tiepuh != nil {
 				if b, d := TypeToData(node, *tiepuh); b {
 					data = append(data, d)
+					owners = append(owners, shards.Of(node))
 				}
 			}
 		case RegistryNodeCommand:
 			if command := node.CommandElement(); command != nil {
 				if b, d := CommandToData(node, *command); b {
 					data = append(data, d)
+					owners = append(owners, shards.Of(node))
 				}
 			}
 		}
 	}
 	graph.DepthFirstSearch(config.Enabled(), store)
 
-	var fh *os.File
-	fh, err = os.OpenFile(fn, os.O_WRONLY|os.O_TRUNC|os.O_CREATE, 0644)
+	rendered, err := renderNodes(t, "node", data)
 	if err != nil {
 		return err
 	}
-	defer fh.Close()
+	nodes := make(map[*Shard][]string, len(shards.List))
+	for k, v := range rendered {
+		nodes[owners[k]] = append(nodes[owners[k]], v)
+	}
 
-	err = t.Execute(fh, struct {
-		PackageName string
-		Header      string
-		Data        []interface{}
-	}{config.PackageName, header, data})
-	if err != nil {
-		return err
+	for _, shard := range shards.List {
+		if !shard.Core() && len(nodes[shard]) == 0 {
+			continue
+		}
+		var fh *os.File
+		fh, err = os.OpenFile(shard.FileName(config.OutputName, ".go"), os.O_WRONLY|os.O_TRUNC|os.O_CREATE, 0644)
+		if err != nil {
+			return err
+		}
+		if shard.Core() {
+			err = t.Execute(fh, struct {
+				PackageName string
+				Header      string
+				Nodes       []string
+			}{config.PackageName, header, nodes[shard]})
+		} else {
+			err = t.ExecuteTemplate(fh, "shard", struct {
+				PackageName string
+				Header      string
+				Shard       *Shard
+				Imports     []string
+				Nodes       []string
+			}{config.PackageName, header, shard, goShardImports(nodes[shard]), nodes[shard]})
+		}
+		fh.Close()
+		if err != nil {
+			return err
+		}
 	}
 
 	return nil
 }
 
+// goShardImports returns the packages of the primary file's imports that the
+// rendered nodes of a shard use.
+func goShardImports(nodes []string) []string {
+	var imports []string
+	for _, pkg := range []string{"fmt", "runtime", "strings", "unsafe"} {
+		for _, v := range nodes {
+			if strings.Contains(v, pkg+".") {
+				imports = append(imports, pkg)
+				break
+			}
+		}
+	}
+	return imports
+}
+
 func determineFacades(config *Config, graph RegistryGraph) map[string]bool {
 	facades := make(map[string]bool, 0)
 	dependsOn := make(map[string]string, 0)
@@ -161,13 +215,21 @@ const ({{range .Values}}
 	{{.Name.Go}} {{.Type.Go}} = {{.Value.Go}}{{end}}
 )
 
-var (
-	reverse{{.Name.Go}} map[{{.Name.Go}}]string = map[{{.Name.Go}}]string{ {{range .Values}}{{if not .Alias}}
-		{{.Name.Go}}: "{{.Name.Go}}",{{end}}{{end}}
-	}
-)
+{{with .Table}}const enumNames{{$.Name.Go}} = {{range $i, $n := .Names}}{{if $i}} +
+	{{end}}"{{$n}}"{{end}}
+
+var enumTable{{$.Name.Go}} = enumTable[{{$.Name.Go}}, {{.IndexType}}]{ {{if .Dense}}
+	first: {{.First}},
+	dense: {{.Dense}},{{end}}{{if .Sparse}}
+	sparse: []{{$.Name.Go}}{ {{range .Sparse}}
+		{{.}},{{end}}
+	},{{end}}
+	names: enumNames{{$.Name.Go}},
+	index: []{{.IndexType}}{ {{range $i, $n := .Index}}{{if $i}}, {{end}}{{$n}}{{end}} },
+}
+{{end}}
 func (x {{.Name.Go}}) String() string {
-	if s, ok := reverse{{.Name.Go}}[x]; ok {
+	if s, ok := enumTable{{.Name.Go}}.name(x); ok {
 		return s
 	}
 	return fmt.Sprintf("{{.Name.Go}}=%d", x)
@@ -175,7 +237,28 @@ func (x {{.Name.Go}}) String() string {
 {{end}}{{define "bitmask"}}// {{.Name.Go}} bitmask
 // {{template "docurl" .Name.C}}
 type {{.Name.Go}} {{.Type.Go}}
-{{end}}{{define "func"}}// {{.Name.Go}} function pointer
+{{with .Bits}}
+// Bits appends the {{.Go}} set in x to dst, lowest first.
+func (x {{$.Name.Go}}) Bits(dst []{{.Go}}) []{{.Go}} {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x {{$.Name.Go}}) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTable{{.Go}})
+}
+
+func (x {{$.Name.Go}}) String() string {
+	return flagsString(x, &enumTable{{.Go}})
+}
+
+// Parse{{$.Name.Go}} parses the names of {{.Go}} values, or numbers,
+// separated by |.
+func Parse{{$.Name.Go}}(s string) ({{$.Name.Go}}, error) {
+	x, err := parseFlags(s, &enumTable{{.Go}})
+	return {{$.Name.Go}}(x), err
+}
+{{end}}{{end}}{{define "func"}}// {{.Name.Go}} function pointer
 // {{template "docurl" .Name.C}}
 type {{.Name.Go}} {{.Name.CGo}}
 {{end}}{{define "union"}}// {{.Name.Go}} union
@@ -238,13 +321,66 @@ type {{.Name.GoFacade}} struct {
 const goCommandTemplate = `{{define "command"}}// {{.Name.Go}} command
 // {{template "docurl" .Name.C}}
 func {{if eq (isGlobal .Name) false}}(x {{.Parent.GoFacade}}){{end}}{{.Name.Go}}({{range ooParams .Name .Parameters}}{{.Name.Go}} {{.Type.Go}}, {{end}}) {{if ne .Return.Go "void"}}{{.Return.Go}} {{end}}{
-	addrs := {{if isGlobal .Name}}&C.vksProcAddresses{{else}}x.procs{{end}}{{$cmd := .Name}}{{range $key, $val := .Parameters}}
+	addrs := {{if isGlobal .Name}}&C.vksProcAddresses{{else}}x.procs{{end}}{{with .Destroys}}
+	if destroyHooks.Load() != nil { {{- if and .Slice .Count}}
+		for k := 0; k < int({{.Count.Name.Go}}) && k < len({{.Param.Name.Go}}); k++ {
+			handleDestroyed({{.ObjectType}}, uint64(uintptr(unsafe.Pointer({{.Param.Name.Go}}[k]))))
+		}{{else if .Slice}}
+		for _, h := range {{.Param.Name.Go}} {
+			handleDestroyed({{.ObjectType}}, uint64(uintptr(unsafe.Pointer(h))))
+		}{{else}}
+		handleDestroyed({{.ObjectType}}, uint64(uintptr(unsafe.Pointer({{.Param.Name.Go}})))){{end}}
+	}{{end}}{{template "commandCall" .}}}
+{{if isGlobal .Name}}
+// {{.Name.Go}} calls {{.Name.Go}} of the loader.
+func (loader *Loader) {{.Name.Go}}({{range .Parameters}}{{.Name.Go}} {{.Type.Go}}, {{end}}) {{if ne .Return.Go "void"}}{{.Return.Go}} {{end}}{
+	addrs := &loader.ptr.procs{{template "commandCall" .}}}
+{{end}}{{if isFastCall .}}
+// Fast{{.Name.Go}} calls {{.Name.Go}} without cgo, through the assembly
+// trampoline. Where the trampoline is not available, or while a capture runs,
+// it calls {{.Name.Go}}.
+func (x {{.Parent.GoFacade}}) Fast{{.Name.Go}}({{range ooParams .Name .Parameters}}{{.Name.Go}} {{.Type.Go}}, {{end}}) {
+	if !fastcallSupported || capturing() {
+		x.{{.Name.Go}}({{range ooParams .Name .Parameters}}{{.Name.Go}}, {{end}})
+		return
+	}
+	addrs := x.procs{{range $key, $val := .Parameters}}
+	p{{$key}} := {{$val.Type.GoToC}}(&{{if ne $key 0}}{{$val.Name.Go}}{{else}}x.H{{end}}){{end}}
+	args := C.vksFastArgs_{{.Name.C}}{addrs: addrs{{range $key, $val := .Parameters}}, p{{$key}}: *p{{$key}}{{end}}}
+	fastcall(unsafe.Pointer(C.vksFast_{{.Name.C}}), unsafe.Pointer(&args))
+}
+{{end}}{{if .Enumerate}}{{template "enumerate" .}}{{end}}{{end}}{{define "enumerate"}}{{$cmd := .}}
+// {{.Name.Go}}Into calls {{.Name.Go}} with the count query, the fill and
+// the VK_INCOMPLETE retries in a single cgo call. The elements are stored in
+// dst, reallocated only when its capacity is too small, and returned.{{if .Enumerate.SType}}
+// The sType of every element is set; pNext is passed through.{{end}}
+func {{if eq (isGlobal .Name) false}}(x {{.Parent.GoFacade}}){{end}}{{.Name.Go}}Into({{range ooEnumParams .Name .Enumerate.Leading}}{{.Name.Go}} {{.Type.Go}}, {{end}}dst {{.Enumerate.Items.Type.Go}}) ({{.Enumerate.Items.Type.Go}}{{if ne .Return.Go "void"}}, {{.Return.Go}}{{end}}) {
+	addrs := {{if isGlobal .Name}}&C.vksProcAddresses{{else}}x.procs{{end}}{{template "enumerateCall" .}}}
+{{if isGlobal .Name}}
+// {{.Name.Go}}Into calls {{.Name.Go}}Into with the commands of the loader.
+func (loader *Loader) {{.Name.Go}}Into({{range .Enumerate.Leading}}{{.Name.Go}} {{.Type.Go}}, {{end}}dst {{.Enumerate.Items.Type.Go}}) ({{.Enumerate.Items.Type.Go}}{{if ne .Return.Go "void"}}, {{.Return.Go}}{{end}}) {
+	addrs := &loader.ptr.procs{{template "enumerateCall" .}}}
+{{end}}{{end}}{{define "enumerateCall"}}{{$cmd := .Name}}{{range $key, $val := .Enumerate.Leading}}
+	p{{$key}} := {{$val.Type.GoToC}}(&{{if or (isGlobal $cmd) (ne $key 0)}}{{$val.Name.Go}}{{else}}x.H{{end}}){{end}}
+	for {
+		dst = dst[:cap(dst)]
+		var items {{.Enumerate.Items.Type.CGo}}
+		if len(dst) > 0 {
+			items = ({{.Enumerate.Items.Type.CGo}})(unsafe.Pointer(&dst[0]))
+		}
+		ret := C.vksEnumerate_{{.Name.C}}(addrs{{range $key, $val := .Enumerate.Leading}}, {{if isHandle $val.Type}}C.uint64_t(uintptr(unsafe.Pointer(*p{{$key}}))){{else}}*p{{$key}}{{end}}{{end}}, C.uint32_t(len(dst)), items)
+		if Result(ret.result) == VK_INCOMPLETE && int(ret.count) > len(dst) {
+			dst = make({{.Enumerate.Items.Type.Go}}, ret.count)
+			continue
+		}
+		return dst[:ret.count]{{if ne .Return.Go "void"}}, Result(ret.result){{end}}
+	}
+{{end}}{{define "commandCall"}}{{$cmd := .Name}}{{range $key, $val := .Parameters}}
 	p{{$key}} := {{$val.Type.GoToC}}(&{{if or (isGlobal $cmd) (ne $key 0)}}{{$val.Name.Go}}{{else}}x.H{{end}}){{end}}
 	{{if ne .Return.Go "void"}}ret := {{end}}{{.Name.CGo}}(addrs{{range $key, $val := .Parameters}}, *p{{$key}}{{end}})
 	{{if ne .Return.Go "void"}}retPtr := {{.Return.CToGo}}(&ret)
 	return *retPtr
-{{end}}}
-{{end}}`
+{{end}}{{end}}`
 const goStructTemplate = `{{define "struct"}}// {{.Name.Go}} provides a go interface for {{.Name.C}}.
 // {{template "docurl" .Name.C}}
 type {{.Name.Go}} {{.Name.CGo}}
@@ -316,11 +452,22 @@ func {{.Name.Go}}MakeCSlice(x ...{{.Name.Go}}) []{{.Name.Go}} {
 	return dst
 }{{with $struct := .}}{{range .Members}}
 
-// {{.Name.Go}} returns the value of {{.Name.C}} from {{$struct.Name.C}}
-func (x {{$struct.Name.Go}}) {{.Name.Go}}() {{.Type.Go}} {
+// {{.Name.Go}} returns the value of {{.Name.C}} from {{$struct.Name.C}}{{if and $struct.Large .Copy}}
+// The slice references the array in x; it is not a copy.{{end}}
+func (x {{if $struct.Large}}*{{end}}{{$struct.Name.Go}}) {{.Name.Go}}() {{.Type.Go}} { {{- if and (or (ne .Length nil) .AltLength) (not .Copy) (eq (printf "%.2s" .Type.Go) "[]")}}
+	if x.{{.Name.CGo}} == nil {
+		return nil
+	}
+	return unsafe.Slice((*{{slice .Type.Go 2}})(unsafe.Pointer(x.{{.Name.CGo}})), {{if ne .Length nil}}x.{{.Length.Name.CGo}}{{else}}{{.AltLength}}{{end}}){{else}}
 	ptr := {{.Type.CToGo}}(&x.{{.Name.CGo}})
-	return *ptr
-}{{if ne .Value nil}}
+	return *ptr{{end}}
+}{{if .View}}
+
+// {{.Name.Go}}View returns a pointer to {{.Name.C}} in x, to read the
+// struct without copying it.
+func (x *{{$struct.Name.Go}}) {{.Name.Go}}View() *{{.Type.Go}} {
+	return (*{{.Type.Go}})(&x.{{.Name.CGo}})
+}{{end}}{{if ne .Value nil}}
 
 // WithDefault{{.Name.Go}} clones a new {{$struct.Name.Go}} with the value of
 // {{.Name.Go}} to the value provided in the specification.
@@ -351,7 +498,20 @@ func (x *{{$struct.Name.Go}}) Set{{.Name.Go}}(y {{.Type.Go}}) { {{- if .Copy}}
 	copy(x.{{.Name.CGo}}[:], unsafe.Slice(*ptr, len(y))){{else}}
 	x.{{.Name.CGo}} = *({{.Type.GoToC}}(&y)){{end}}{{if ne .Length nil}}
 	x.Set{{.Length.Name.Go}}({{.Length.Type.Go}}(len(y))){{end}}
-}{{end}}{{end}}
+}{{if .Pin}}
+
+// Pin{{.Name.Go}} pins the Go memory referenced by y with the AutoReleasePool
+// and sets {{.Name.Go}}, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *{{$struct.Name.Go}}) Pin{{.Name.Go}}(arp *AutoReleasePool, y {{.Type.Go}}) { {{- if eq .Type.Go "unsafe.Pointer"}}
+	arp.Pin(y){{else if eq (printf "%.2s" .Type.Go) "[]"}}
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}{{else}}
+	arp.Pin(unsafe.Pointer(y)){{end}}
+	x.Set{{.Name.Go}}(y)
+}{{end}}{{end}}{{end}}
 {{end}}{{end}}
 {{define "structalias"}}//{{.Name.Go}} is an alias to {{.Alias.Go}}.
 // {{template "docurl" .Name.C}}
@@ -360,6 +520,34 @@ func (x *{{$struct.Name.Go}}) Set{{.Name.Go}}(y {{.Type.Go}}) { {{- if .Copy}}
 // promoted to features. If possible, update code to use the promoted name: {{.Alias.Go}}.
 type {{.Name.Go}} = {{.Alias.Go}}{{end}}
 `
+const goNodeTemplate = `{{define "node"}}{{if eq .Template "const"}}{{block "const" .Data}}{{.}}{{end}}
+{{else if eq .Template "version"}}{{block "version" .Data}}{{.}}{{end}}
+{{else if eq .Template "headerversion"}}{{block "headerversion" .Data}}{{.}}{{end}}
+{{else if eq .Template "headerversioncomplete"}}{{block "headerversioncomplete" .Data}}{{.}}{{end}}
+{{else if eq .Template "base"}}{{block "base" .Data}}{{.}}{{end}}
+{{else if eq .Template "handle"}}{{block "handle" .Data}}{{.}}{{end}}
+{{else if eq .Template "enum"}}{{block "enum" .Data}}{{.}}{{end}}
+{{else if eq .Template "bitmask"}}{{block "bitmask" .Data}}{{.}}{{end}}
+{{else if eq .Template "func"}}{{block "func" .Data}}{{.}}{{end}}
+{{else if eq .Template "struct"}}{{block "struct" .Data}}{{.}}{{end}}
+{{else if eq .Template "structalias"}}{{block "structalias" .Data}}{{.}}{{end}}
+{{else if eq .Template "union"}}{{block "union" .Data}}{{.}}{{end}}
+{{else if eq .Template "command"}}{{block "command" .Data}}{{.}}{{end}}
+{{end}}{{end}}`
+const goShardTemplate = `{{define "shard"}}//go:build {{.Shard.Constraint}}
+
+package {{.PackageName}}
+
+// Bindings of {{.Shard.Name}}, left out by the {{.Shard.Tag}} build tag.
+
+//#cgo CFLAGS: -D{{.Shard.Define}}
+//#include "{{.Header}}"
+import "C"{{if .Imports}}
+import ({{range .Imports}}
+	"{{.}}"{{end}}
+){{end}}
+
+{{range .Nodes}}{{.}}{{end}}{{end}}`
 const goPrimaryTemplate = `package {{.PackageName}}
 
 //#cgo LDFLAGS: -lvulkan
@@ -368,8 +556,10 @@ const goPrimaryTemplate = `package {{.PackageName}}
 //#include "{{.Header}}"
 import "C"
 import (
-	"bytes"
 	"fmt"
+	"runtime"
+	"strconv"
+	"strings"
 	"unsafe"
 )
 
@@ -380,11 +570,96 @@ func Init() Result {
 	return *ptr
 }
 
+// InitLibrary loads the Vulkan library from path instead of the default
+// library name. Init also honors the VKS_VULKAN_LIBRARY environment variable.
+func InitLibrary(path string) Result {
+	cPath := C.CString(path)
+	defer C.free(unsafe.Pointer(cPath))
+	ret := C.vksDynamicLoadLibrary(cPath)
+	ptr := (*Result)(&ret)
+	return *ptr
+}
+
+// InitICD loads the driver library at path directly, without the Vulkan
+// loader. See OpenICD.
+func InitICD(path string) Result {
+	cPath := C.CString(path)
+	defer C.free(unsafe.Pointer(cPath))
+	ret := C.vksDynamicLoadICD(cPath)
+	ptr := (*Result)(&ret)
+	return *ptr
+}
+
 // Destroy unloads the Vulkan Library.
 func Destroy() {
 	C.vksDynamicUnload()
 }
 
+// Loader is a loaded Vulkan implementation, either the Vulkan loader or a
+// driver loaded directly. Each Loader has its own proc addresses, so several
+// can be used in one process. The global commands are also methods of
+// Loader; the package level ones use the library loaded by Init.
+type Loader struct {
+	ptr *C.vksLoader
+}
+
+// OpenLoader loads the Vulkan loader library at path.
+func OpenLoader(path string) (*Loader, error) {
+	return openLoader(path, false)
+}
+
+// OpenICD loads the installable client driver (ICD) library at path
+// directly, skipping the Vulkan loader: there is no layer or manifest
+// discovery, and commands dispatch straight into the driver. The
+// loader-ICD interface version is negotiated the way the loader does. Only
+// the instance extensions of the driver itself are available.
+func OpenICD(path string) (*Loader, error) {
+	return openLoader(path, true)
+}
+
+func openLoader(path string, icd bool) (*Loader, error) {
+	cPath := C.CString(path)
+	defer C.free(unsafe.Pointer(cPath))
+	loader := &Loader{ptr: (*C.vksLoader)(newCBlock(cULong(unsafe.Sizeof(C.vksLoader{}))))}
+	var ret C.VkResult
+	if icd {
+		ret = C.vksLoaderOpenICD(loader.ptr, cPath)
+	} else {
+		ret = C.vksLoaderOpen(loader.ptr, cPath)
+	}
+	if err := Result(ret).AsErr(); err != nil {
+		C.free(unsafe.Pointer(loader.ptr))
+		return nil, fmt.Errorf("error: loading %s: %w", path, err)
+	}
+	return loader, nil
+}
+
+// ICDInterfaceVersion returns the negotiated loader-ICD interface version,
+// and false when the Vulkan loader was loaded instead of a driver.
+func (loader *Loader) ICDInterfaceVersion() (uint32, bool) {
+	return uint32(loader.ptr.icdInterfaceVersion), loader.ptr.icd != 0
+}
+
+// MakeInstanceFacade is MakeInstanceFacade with the proc addresses of the
+// loader.
+func (loader *Loader) MakeInstanceFacade(x Instance) InstanceFacade {
+	var addrs C.vksProcAddr
+	addrs.pvkGetInstanceProcAddr = loader.ptr.procs.pvkGetInstanceProcAddr
+	C.vksLoadInstanceProcAddrs(x, &addrs)
+	return InstanceFacade{
+		H:     x,
+		procs: &addrs,
+	}
+}
+
+// Close unloads the library. Facades made from the loader must not be used
+// afterwards.
+func (loader *Loader) Close() {
+	C.vksLoaderClose(loader.ptr)
+	C.free(unsafe.Pointer(loader.ptr))
+	loader.ptr = nil
+}
+
 // Freer represents types that can Free resources
 type Freer interface {
 	Free()
@@ -396,9 +671,10 @@ type CCloner[OUT any] interface {
 }
 
 // AutoReleasePool is a collection of pointers that will all be released at
-// once.
+// once. It also pins Go memory referenced by structures passed to C, see Pin.
 type AutoReleasePool struct {
-	ptrs []Freer
+	ptrs   []Freer
+	pinner runtime.Pinner
 }
 
 // NewAutoReleaser creates a new AutoReleasePool. This is normally followed by
@@ -414,6 +690,7 @@ func (arp *AutoReleasePool) Release() {
 		v.Free()
 	}
 	arp.ptrs = nil
+	arp.pinner.Unpin()
 }
 
 // Add adds pointers to the AutoReleasePool.
@@ -421,24 +698,36 @@ func (arp *AutoReleasePool) Add(ptr ...Freer) {
 	arp.ptrs = append(arp.ptrs, ptr...)
 }
 
+// Pin pins the Go object ptr points to until the pool is released. cgo allows
+// pinned Go memory to be referenced from memory passed to C, so Go slices and
+// structures can be handed to commands without copying them to the C heap.
+// Nil pointers are ignored. ptr must not point to C memory.
+func (arp *AutoReleasePool) Pin(ptr unsafe.Pointer) {
+	if ptr != nil {
+		arp.pinner.Pin(ptr)
+	}
+}
+
 // NewCStr allocates the provided string on the C heap. The AutoReleasePool is responsible for
 // releasing the memory.
 func NewCStr(arp *AutoReleasePool, s string) *byte {
-	b := nullTerminatedBuffer(s).Bytes()
-	ptr := C.malloc(C.ulong(len(b)))
+	ptr := NewCString(s)
 	if arp != nil {
-		arp.Add(cFreer(uintptr(ptr)))
+		arp.Add(cFreer(uintptr(unsafe.Pointer(ptr))))
 	}
-	C.memcpy(ptr, unsafe.Pointer(&b[0]), C.ulong(len(b)))
-	return (*byte)(ptr)
+	return ptr
 }
 
 // NewCString allocates the provided string on the C heap. FreeCString must be
-// called when the string is no longer needed.
+// called when the string is no longer needed. The string is cut at its first
+// null byte, and copied with a single allocation.
 func NewCString(s string) *byte {
-	b := nullTerminatedBuffer(s).Bytes()
-	ptr := C.malloc(C.ulong(len(b)))
-	C.memcpy(ptr, unsafe.Pointer(&b[0]), C.ulong(len(b)))
+	if n := strings.IndexByte(s, 0); n >= 0 {
+		s = s[:n]
+	}
+	ptr := C.malloc(C.ulong(len(s) + 1))
+	b := unsafe.Slice((*byte)(ptr), len(s)+1)
+	b[copy(b, s)] = 0
 	return (*byte)(ptr)
 }
 
@@ -449,20 +738,124 @@ func FreeCString(ptr *byte) {
 	}
 }
 
-{{range .Data}}{{if eq .Template "const"}}{{block "const" .Data}}{{.}}{{end}}
-{{else if eq .Template "version"}}{{block "version" .Data}}{{.}}{{end}}
-{{else if eq .Template "headerversion"}}{{block "headerversion" .Data}}{{.}}{{end}}
-{{else if eq .Template "headerversioncomplete"}}{{block "headerversioncomplete" .Data}}{{.}}{{end}}
-{{else if eq .Template "base"}}{{block "base" .Data}}{{.}}{{end}}
-{{else if eq .Template "handle"}}{{block "handle" .Data}}{{.}}{{end}}
-{{else if eq .Template "enum"}}{{block "enum" .Data}}{{.}}{{end}}
-{{else if eq .Template "bitmask"}}{{block "bitmask" .Data}}{{.}}{{end}}
-{{else if eq .Template "func"}}{{block "func" .Data}}{{.}}{{end}}
-{{else if eq .Template "struct"}}{{block "struct" .Data}}{{.}}{{end}}
-{{else if eq .Template "structalias"}}{{block "structalias" .Data}}{{.}}{{end}}
-{{else if eq .Template "union"}}{{block "union" .Data}}{{.}}{{end}}
-{{else if eq .Template "command"}}{{block "command" .Data}}{{.}}{{end}}
-{{end}}{{end}}
+// enumTable is the name table of an enum. The names are concatenated in
+// names, and index holds their offsets: the first dense entries are the names
+// of first, first+1 and so on, the others are the names of the sparse values,
+// in increasing order. The tables are composite literals of constants, laid
+// out by the linker, so they cost nothing at init.
+type enumTable[T ~int32 | ~uint32 | ~int64 | ~uint64, I ~uint16 | ~uint32] struct {
+	first  T
+	dense  int
+	sparse []T
+	names  string
+	index  []I
+}
+
+// name returns the name of x, without allocating.
+func (t *enumTable[T, I]) name(x T) (string, bool) {
+	i := -1
+	if t.dense > 0 && x >= t.first && x < t.first+T(t.dense) {
+		i = int(x - t.first)
+	} else {
+		lo, hi := 0, len(t.sparse)
+		for lo < hi {
+			m := int(uint(lo+hi) >> 1)
+			if t.sparse[m] < x {
+				lo = m + 1
+			} else {
+				hi = m
+			}
+		}
+		if lo < len(t.sparse) && t.sparse[lo] == x {
+			i = t.dense + lo
+		}
+	}
+	if i < 0 {
+		return "", false
+	}
+	s := t.names[t.index[i]:t.index[i+1]]
+	return s, len(s) > 0
+}
+
+// value returns the value named s.
+func (t *enumTable[T, I]) value(s string) (T, bool) {
+	if len(s) == 0 {
+		return 0, false
+	}
+	for i := 0; i+1 < len(t.index); i++ {
+		if t.names[t.index[i]:t.index[i+1]] != s {
+			continue
+		} else if i < t.dense {
+			return t.first + T(i), true
+		}
+		return t.sparse[i-t.dense], true
+	}
+	return 0, false
+}
+
+// appendFlagBits appends the bits set in x to dst, lowest first.
+func appendFlagBits[F ~uint32 | ~uint64, B ~int32 | ~uint32 | ~int64 | ~uint64](dst []B, x F) []B {
+	for v := uint64(x); v != 0; v &= v - 1 {
+		dst = append(dst, B(v&-v))
+	}
+	return dst
+}
+
+// appendFlagNames appends the names of the bits set in x to dst, separated by
+// |. The bits without a name are appended in hexadecimal.
+func appendFlagNames[F ~uint32 | ~uint64, B ~int32 | ~uint32 | ~int64 | ~uint64, I ~uint16 | ~uint32](dst []byte, x F, t *enumTable[B, I]) []byte {
+	if x == 0 {
+		return append(dst, '0')
+	}
+	for v := uint64(x); v != 0; v &= v - 1 {
+		if v != uint64(x) {
+			dst = append(dst, '|')
+		}
+		bit := v & -v
+		if s, ok := t.name(B(bit)); ok && uint64(B(bit)) == bit {
+			dst = append(dst, s...)
+		} else {
+			dst = append(dst, "0x"...)
+			dst = strconv.AppendUint(dst, bit, 16)
+		}
+	}
+	return dst
+}
+
+// flagsString returns the name of x when it has one, like 0 or a single bit,
+// without allocating, and the names of its bits otherwise.
+func flagsString[F ~uint32 | ~uint64, B ~int32 | ~uint32 | ~int64 | ~uint64, I ~uint16 | ~uint32](x F, t *enumTable[B, I]) string {
+	if s, ok := t.name(B(x)); ok && uint64(B(x)) == uint64(x) {
+		return s
+	}
+	return string(appendFlagNames(nil, x, t))
+}
+
+// parseFlags parses the names of the values of t, or numbers, separated by |.
+func parseFlags[B ~int32 | ~uint32 | ~int64 | ~uint64, I ~uint16 | ~uint32](s string, t *enumTable[B, I]) (uint64, error) {
+	var x uint64
+	for len(s) > 0 {
+		tok := s
+		if n := strings.IndexByte(s, '|'); n >= 0 {
+			tok, s = s[:n], s[n+1:]
+		} else {
+			s = ""
+		}
+		tok = strings.TrimSpace(tok)
+		if v, ok := t.value(tok); ok {
+			x |= uint64(v)
+			continue
+		}
+		v, err := strconv.ParseUint(tok, 0, 64)
+		if err != nil {
+			return 0, fmt.Errorf("error: unknown flag %q", tok)
+		}
+		x |= v
+	}
+	return x, nil
+}
+
+{{range .Nodes}}{{.}}{{end}}
 
 type cULong C.ulong
 
@@ -480,22 +873,4 @@ func newCBlock(s cULong) unsafe.Pointer {
 	C.memset(ptr, 0, sz)
 	return ptr
 }
-
-func nullTerminatedBuffer(s string) *bytes.Buffer {
-	var str bytes.Buffer
-	var isNullTerminated bool
-	for _, c := range ([]byte)(s) {
-		if c == 0 {
-			isNullTerminated = true
-		}
-		str.WriteByte(c)
-		if isNullTerminated {
-			break
-		}
-	}
-	if !isNullTerminated {
-		str.WriteByte(0)
-	}
-	return &str
-}
 `
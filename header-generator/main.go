@@ -2,6 +2,10 @@ package main
 
 import (
 	"os"
+	"runtime"
+	"strings"
+	"sync"
+	"text/template"
 
 	"gopkg.in/yaml.v3"
 )
@@ -25,11 +29,8 @@ func main() {
 		enabledMap[v] = true
 	}
 
-	// Load up the XML data.
-	registry := LoadRegistry(config.VkxmlPath)
-
-	// Trim the registry to the specified API.
-	registry = registry.ForApi(config.Api)
+	// Load up the XML data, trimmed to the specified API.
+	registry := LoadRegistry(config.VkxmlPath, config.Api, config.RegistryCacheDir)
 
 	graph, constants := registry.Graph(enabledMap)
 
@@ -40,16 +41,64 @@ func main() {
 		graph.ApplyExtensionExtensions(v, enabledMap, constants)
 	}
 	graph.DepthFirstSearch(config.Enabled(), CacheConverters)
-
-	if err := GenerateGoFile(config, constants, graph); err != nil {
-		panic(err)
-	}
-	if err := GenerateCDefineFile(config, graph); err != nil {
-		panic(err)
+	shards := ShardGraph(config, graph)
+
+	// The outputs only read the graph, so they are generated concurrently.
+	generators := []func() error{
+		func() error { return GenerateGoFile(config, constants, graph, shards) },
+		func() error { return GenerateCDefineFile(config, graph, shards) },
+		func() error { return GenerateCImplementFile(config, graph, shards) },
+		func() error { return GenerateCNullDriverFile(config, graph) },
+		func() error { return GenerateCCaptureFiles(config, graph, shards) },
+	}
+	errs := make([]error, len(generators))
+	var wg sync.WaitGroup
+	for k, generate := range generators {
+		wg.Add(1)
+		go func(k int, generate func() error) {
+			defer wg.Done()
+			errs[k] = generate()
+		}(k, generate)
+	}
+	wg.Wait()
+	for _, err := range errs {
+		if err != nil {
+			panic(err)
+		}
 	}
-	if err := GenerateCImplementFile(config, graph); err != nil {
-		panic(err)
+}
+
+// renderNodes executes the named template once per item on GOMAXPROCS
+// goroutines. The results are returned in the order of items, so the output
+// does not depend on scheduling.
+func renderNodes(t *template.Template, name string, items []interface{}) ([]string, error) {
+	out := make([]string, len(items))
+	errs := make([]error, len(items))
+	next := make(chan int)
+	var wg sync.WaitGroup
+	for w := 0; w < runtime.GOMAXPROCS(0); w++ {
+		wg.Add(1)
+		go func() {
+			defer wg.Done()
+			var buf strings.Builder
+			for k := range next {
+				buf.Reset()
+				errs[k] = t.ExecuteTemplate(&buf, name, items[k])
+				out[k] = buf.String()
+			}
+		}()
+	}
+	for k := range items {
+		next <- k
+	}
+	close(next)
+	wg.Wait()
+	for _, err := range errs {
+		if err != nil {
+			return nil, err
+		}
 	}
+	return out, nil
 }
 
 func OpenOutput(fn string) *os.File {
@@ -79,11 +128,16 @@ func LoadConfig(fn string) *Config {
 type Config struct {
 	PackageName      string
 	VkxmlPath        string
+	RegistryCacheDir string
 	OutputName       string
+	NullDriverName   string
+	CaptureName      string
+	Shard            bool // Split the bindings into files per feature and extension.
 	Api              string
 	Features         []string
 	Extensions       []string
 	GlobalProcs      []string
+	FastCalls        []string // vkCmd* commands that also get a Fast method.
 	ProcLoaders      map[string]string
 	CDefinePreProc   []string
 	ExportTranslator []TranslatorConfig
@@ -109,23 +163,37 @@ func (config *Config) IsGlobalProc(specName string) bool {
 	return false
 }
 
+// IsFastCall reports if the command gets a Fast method that calls it through
+// the assembly trampoline instead of cgo. Only commands recorded into a
+// command buffer qualify: they return nothing, take only handles, enums and
+// scalars by value and are expected to return quickly, as the goroutine cannot
+// be preempted or have its stack scanned until they do. Pointers, slices and
+// unsafe.Pointer would hand Go memory to C without cgocheck.
+func (config *Config) IsFastCall(cmd CommandData) bool {
+	if !strings.HasPrefix(cmd.Name.C(), "vkCmd") || cmd.Return.C() != "void" {
+		return false
+	}
+	for _, v := range cmd.Parameters {
+		switch xl8r := v.Type.(type) {
+		case *HandleConverter, *TypeDefConverter:
+		case *ScalarConverter:
+			if xl8r == UnsafePointerTranslator {
+				return false
+			}
+		default:
+			return false
+		}
+	}
+	for _, v := range config.FastCalls {
+		if v == cmd.Name.C() {
+			return true
+		}
+	}
+	return false
+}
+
 type TranslatorConfig struct {
 	Action      string
 	Pattern     string
 	Replacement string
 }
-
-func LoadRegistry(fn string) *Registry {
-	// Open the datasource.
-	fh, err := os.OpenFile(fn, os.O_RDONLY, 0)
-	if err != nil {
-		panic(err)
-	}
-	defer fh.Close()
-
-	if registry, err := DecodeRegistry(fh); err != nil {
-		panic(err)
-	} else {
-		return registry
-	}
-}
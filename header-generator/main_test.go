@@ -0,0 +1,189 @@
+package main
+
+import (
+	"bytes"
+	"os"
+	"os/exec"
+	"path/filepath"
+	"reflect"
+	"strings"
+	"testing"
+)
+
+// The generator keeps its converters in globals, so every generation runs
+// in a fresh process, like a real run: the test binary runs main in the
+// directory named by VKS_GENERATE_DIR.
+func TestMain(m *testing.M) {
+	if dir := os.Getenv("VKS_GENERATE_DIR"); len(dir) > 0 {
+		if err := os.Chdir(dir); err != nil {
+			panic(err)
+		}
+		main()
+		os.Exit(0)
+	}
+	os.Exit(m.Run())
+}
+
+// generateConfig writes the vkxml.yml of the repository into a new directory,
+// with the registry snapshot cached in cacheDir, or "none" to disable it.
+func generateConfig(tb testing.TB, cacheDir string) string {
+	raw, err := os.ReadFile("../vkxml.yml")
+	if err != nil {
+		tb.Fatal(err)
+	}
+	vkxml, err := filepath.Abs("../vk.xml")
+	if err != nil {
+		tb.Fatal(err)
+	}
+	var lines []string
+	for _, line := range strings.Split(string(raw), "\n") {
+		switch {
+		case strings.HasPrefix(line, "vkxmlpath:"):
+			line = "vkxmlpath: " + vkxml
+		case strings.HasPrefix(line, "registrycachedir:"):
+			continue
+		}
+		lines = append(lines, line)
+	}
+	lines = append([]string{"registrycachedir: " + cacheDir}, lines...)
+
+	dir := tb.TempDir()
+	fn := filepath.Join(dir, "vkxml.yml")
+	if err := os.WriteFile(fn, []byte(strings.Join(lines, "\n")), 0644); err != nil {
+		tb.Fatal(err)
+	}
+	config := LoadConfig(fn)
+	if err := os.MkdirAll(filepath.Join(dir, filepath.Dir(config.NullDriverName)), 0755); err != nil {
+		tb.Fatal(err)
+	}
+	return dir
+}
+
+func runGenerate(tb testing.TB, dir string) {
+	cmd := exec.Command(os.Args[0], "-test.run=^$")
+	cmd.Env = append(os.Environ(), "VKS_GENERATE_DIR="+dir)
+	if out, err := cmd.CombinedOutput(); err != nil {
+		tb.Fatalf("generating in %s: %v\n%s", dir, err, out)
+	}
+}
+
+// generated returns the files written by the generator in dir.
+func generated(tb testing.TB, dir string) map[string][]byte {
+	files := make(map[string][]byte)
+	err := filepath.Walk(dir, func(path string, info os.FileInfo, err error) error {
+		if err != nil || info.IsDir() || info.Name() == "vkxml.yml" {
+			return err
+		}
+		data, err := os.ReadFile(path)
+		rel, _ := filepath.Rel(dir, path)
+		files[rel] = data
+		return err
+	})
+	if err != nil {
+		tb.Fatal(err)
+	}
+	return files
+}
+
+// TestGenerateSnapshot checks the outputs are byte for byte the same without
+// the registry snapshot, when writing it and when reading it.
+func TestGenerateSnapshot(t *testing.T) {
+	cacheDir := t.TempDir()
+	runs := []struct {
+		name  string
+		cache string
+	}{
+		{"uncached", "none"},
+		{"cold", cacheDir},
+		{"warm", cacheDir},
+	}
+	var want map[string][]byte
+	for _, run := range runs {
+		dir := generateConfig(t, run.cache)
+		runGenerate(t, dir)
+		got := generated(t, dir)
+		if want == nil {
+			want = got
+			if len(want) == 0 {
+				t.Fatal("no output generated")
+			}
+			continue
+		}
+		if len(got) != len(want) {
+			t.Errorf("%s run wrote %d files, want %d", run.name, len(got), len(want))
+		}
+		for fn, data := range want {
+			if !bytes.Equal(got[fn], data) {
+				t.Errorf("%s run: %s differs from the uncached run", run.name, fn)
+			}
+		}
+	}
+	if snapshots, _ := filepath.Glob(filepath.Join(cacheDir, "*.gob")); len(snapshots) != 1 {
+		t.Errorf("found snapshots %v, want one", snapshots)
+	}
+}
+
+// TestRegistrySnapshot checks the *int attributes that are present but zero
+// survive the snapshot, which gob would decode as nil. TestGenerateSnapshot
+// covers the rest of the registry through the outputs.
+func TestRegistrySnapshot(t *testing.T) {
+	raw, err := os.Open("../vk.xml")
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer raw.Close()
+	registry, err := DecodeRegistry(raw)
+	if err != nil {
+		t.Fatal(err)
+	}
+	registry = registry.ForApi("vulkan")
+
+	zeros := 0
+	visitIntPointers(reflect.ValueOf(registry), func(ptr reflect.Value) {
+		if !ptr.IsNil() && ptr.Elem().Int() == 0 {
+			zeros++
+		}
+	})
+	if zeros == 0 {
+		t.Fatal("the registry has no zero *int attribute to restore")
+	}
+
+	fn := filepath.Join(t.TempDir(), "registry.gob")
+	if err := writeRegistrySnapshot(fn, registry); err != nil {
+		t.Fatal(err)
+	}
+	cached, err := readRegistrySnapshot(fn)
+	if err != nil {
+		t.Fatal(err)
+	}
+	restored := 0
+	visitIntPointers(reflect.ValueOf(cached), func(ptr reflect.Value) {
+		if !ptr.IsNil() && ptr.Elem().Int() == 0 {
+			restored++
+		}
+	})
+	if restored != zeros {
+		t.Errorf("restored %d zero *int attributes, want %d", restored, zeros)
+	}
+}
+
+// BenchmarkGenerate times whole generator runs, decoding vk.xml (cold) or
+// reading the registry snapshot (warm).
+func BenchmarkGenerate(b *testing.B) {
+	b.Run("cold", func(b *testing.B) {
+		for k := 0; k < b.N; k++ {
+			b.StopTimer()
+			dir := generateConfig(b, b.TempDir())
+			b.StartTimer()
+			runGenerate(b, dir)
+		}
+	})
+	b.Run("warm", func(b *testing.B) {
+		dir := generateConfig(b, b.TempDir())
+		runGenerate(b, dir)
+		b.ResetTimer()
+		for k := 0; k < b.N; k++ {
+			runGenerate(b, dir)
+		}
+	})
+}
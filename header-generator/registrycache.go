@@ -0,0 +1,141 @@
+package main
+
+import (
+	"bytes"
+	"crypto/sha256"
+	"encoding/gob"
+	"fmt"
+	"os"
+	"path/filepath"
+	"reflect"
+)
+
+// registrySnapshot is the cached form of a Registry. gob drops zero values,
+// so optional *int attributes that are present but zero (an offset="0" for
+// example) would come back as nil; ZeroPointers restores them.
+type registrySnapshot struct {
+	Registry     *Registry
+	ZeroPointers []bool
+}
+
+// registrySnapshotVersion is part of the snapshot key. Bump it whenever the
+// Registry element types change, so stale snapshots are not decoded.
+const registrySnapshotVersion = 2
+
+// LoadRegistry decodes the registry at fn and trims it to apiName. The trimmed
+// registry is cached as a gob snapshot in cacheDir, keyed by the hash of the
+// registry XML, so later runs against the same vk.xml skip the XML decoding.
+// An empty cacheDir uses the user cache directory; "none" disables the cache.
+// Cache failures are not fatal, the registry is decoded from the XML instead.
+func LoadRegistry(fn, apiName, cacheDir string) *Registry {
+	raw, err := os.ReadFile(fn)
+	if err != nil {
+		panic(err)
+	}
+
+	snapshot := registrySnapshotPath(raw, apiName, cacheDir)
+	if len(snapshot) > 0 {
+		if registry, err := readRegistrySnapshot(snapshot); err == nil {
+			return registry
+		}
+	}
+
+	registry, err := DecodeRegistry(bytes.NewReader(raw))
+	if err != nil {
+		panic(err)
+	}
+	registry = registry.ForApi(apiName)
+
+	if len(snapshot) > 0 {
+		if err := writeRegistrySnapshot(snapshot, registry); err != nil {
+			fmt.Fprintf(os.Stderr, "warning: registry snapshot not cached: %v\n", err)
+		}
+	}
+	return registry
+}
+
+func registrySnapshotPath(raw []byte, apiName, cacheDir string) string {
+	switch cacheDir {
+	case "none":
+		return ""
+	case "":
+		dir, err := os.UserCacheDir()
+		if err != nil {
+			return ""
+		}
+		cacheDir = filepath.Join(dir, "vks-header-generator")
+	}
+	sum := sha256.Sum256(raw)
+	return filepath.Join(cacheDir, fmt.Sprintf("%x-%s-v%d.gob", sum, apiName, registrySnapshotVersion))
+}
+
+func readRegistrySnapshot(fn string) (*Registry, error) {
+	fh, err := os.Open(fn)
+	if err != nil {
+		return nil, err
+	}
+	defer fh.Close()
+
+	var snapshot registrySnapshot
+	if err := gob.NewDecoder(fh).Decode(&snapshot); err != nil {
+		return nil, err
+	}
+	if snapshot.Registry == nil {
+		return nil, fmt.Errorf("error: empty registry snapshot %s", fn)
+	}
+	var k int
+	visitIntPointers(reflect.ValueOf(snapshot.Registry), func(ptr reflect.Value) {
+		if k < len(snapshot.ZeroPointers) && snapshot.ZeroPointers[k] {
+			ptr.Set(reflect.ValueOf(new(int)))
+		}
+		k++
+	})
+	return snapshot.Registry, nil
+}
+
+// writeRegistrySnapshot writes to a temporary file and renames it, so
+// concurrent generator runs never read a partial snapshot.
+func writeRegistrySnapshot(fn string, registry *Registry) error {
+	if err := os.MkdirAll(filepath.Dir(fn), 0755); err != nil {
+		return err
+	}
+	fh, err := os.CreateTemp(filepath.Dir(fn), "snapshot-*.tmp")
+	if err != nil {
+		return err
+	}
+	defer os.Remove(fh.Name())
+
+	snapshot := registrySnapshot{Registry: registry}
+	visitIntPointers(reflect.ValueOf(registry), func(ptr reflect.Value) {
+		snapshot.ZeroPointers = append(snapshot.ZeroPointers, !ptr.IsNil() && ptr.Elem().Int() == 0)
+	})
+	if err := gob.NewEncoder(fh).Encode(&snapshot); err != nil {
+		fh.Close()
+		return err
+	}
+	if err := fh.Close(); err != nil {
+		return err
+	}
+	return os.Rename(fh.Name(), fn)
+}
+
+// visitIntPointers calls visit for every *int field reachable from v, in a
+// stable order.
+func visitIntPointers(v reflect.Value, visit func(reflect.Value)) {
+	switch v.Kind() {
+	case reflect.Pointer:
+		if v.Type().Elem().Kind() == reflect.Int {
+			visit(v)
+		} else if !v.IsNil() {
+			visitIntPointers(v.Elem(), visit)
+		}
+	case reflect.Struct:
+		for h := 0; h < v.NumField(); h++ {
+			visitIntPointers(v.Field(h), visit)
+		}
+	case reflect.Slice:
+		for h := 0; h < v.Len(); h++ {
+			visitIntPointers(v.Index(h), visit)
+		}
+	}
+}
@@ -0,0 +1,131 @@
+package main
+
+import (
+	"fmt"
+	"sort"
+	"strings"
+)
+
+// Shard is the part of the generated bindings owned by one enabled feature or
+// extension. Every node of the graph belongs to the first enabled feature or
+// extension, in configuration order, that requires it. The first shard is the
+// core and is always built; the others go into their own files, excluded by
+// the vks_no_<suffix> build tag.
+type Shard struct {
+	Name   string   // e.g. VK_KHR_swapchain
+	Suffix string   // e.g. khr_swapchain; empty for the core shard.
+	Deps   []*Shard // Shards this shard refers to, directly or not.
+}
+
+// Core reports if the shard is built unconditionally.
+func (shard *Shard) Core() bool {
+	return len(shard.Suffix) == 0
+}
+
+// Tag is the build tag that excludes the shard.
+func (shard *Shard) Tag() string {
+	if shard.Core() {
+		return ""
+	}
+	return "vks_no_" + shard.Suffix
+}
+
+// Define is the C macro defined by the cgo flags of the shard's Go file, so C
+// code and the shared vksProcAddr layout only include the enabled shards.
+func (shard *Shard) Define() string {
+	if shard.Core() {
+		return ""
+	}
+	return "VKS_ENABLE_" + strings.ToUpper(shard.Suffix)
+}
+
+// Constraint is the build constraint of the shard's files. A shard is
+// excluded with any of the shards it depends on.
+func (shard *Shard) Constraint() string {
+	tags := []string{"!" + shard.Tag()}
+	for _, dep := range shard.Deps {
+		tags = append(tags, "!"+dep.Tag())
+	}
+	return strings.Join(tags, " && ")
+}
+
+// FileName returns base with the shard suffix and ext appended.
+func (shard *Shard) FileName(base, ext string) string {
+	if shard.Core() {
+		return base + ext
+	}
+	return fmt.Sprintf("%s_%s%s", base, shard.Suffix, ext)
+}
+
+// Shards maps the nodes of the graph to their shards.
+type Shards struct {
+	List  []*Shard
+	owner map[*RegistryNode]*Shard
+	graph RegistryGraph
+}
+
+// ShardGraph assigns every node reachable from the enabled features and
+// extensions to a shard. When sharding is disabled in the configuration,
+// everything belongs to a single core shard.
+func ShardGraph(config *Config, graph RegistryGraph) *Shards {
+	enabled := config.Enabled()
+	shards := &Shards{
+		owner: make(map[*RegistryNode]*Shard),
+		graph: graph,
+	}
+	if len(enabled) == 0 {
+		shards.List = append(shards.List, &Shard{})
+		return shards
+	}
+	if !config.Shard {
+		shards.List = append(shards.List, &Shard{Name: enabled[0]})
+		return shards
+	}
+
+	for k, name := range enabled {
+		shard := &Shard{Name: name}
+		if k > 0 {
+			shard.Suffix = strings.ToLower(strings.TrimPrefix(name, "VK_"))
+		}
+		deps := make(map[*Shard]bool)
+		graph.DepthFirstSearch([]string{name}, func(path []*RegistryNode) {
+			node := path[len(path)-1]
+			if owner, ok := shards.owner[node]; !ok {
+				shards.owner[node] = shard
+			} else if owner != shard && !owner.Core() {
+				deps[owner] = true
+				for _, dep := range owner.Deps {
+					deps[dep] = true
+				}
+			}
+		})
+		for dep := range deps {
+			shard.Deps = append(shard.Deps, dep)
+		}
+		sort.Slice(shard.Deps, func(a, b int) bool { return shard.Deps[a].Suffix < shard.Deps[b].Suffix })
+		shards.List = append(shards.List, shard)
+	}
+	return shards
+}
+
+// Core returns the shard that is always built.
+func (shards *Shards) Core() *Shard {
+	return shards.List[0]
+}
+
+// Of returns the shard owning the node. Nodes outside the enabled graph, like
+// the virtual constants node, belong to the core.
+func (shards *Shards) Of(node *RegistryNode) *Shard {
+	if shard, ok := shards.owner[node]; ok {
+		return shard
+	}
+	return shards.Core()
+}
+
+// Named returns the shard owning the named node.
+func (shards *Shards) Named(name string) *Shard {
+	if node, ok := shards.graph[name]; ok {
+		return shards.Of(node)
+	}
+	return shards.Core()
+}
@@ -4,8 +4,10 @@ import (
 	"fmt"
 	"log"
 	"regexp"
+	"sort"
 	"strconv"
 	"strings"
+	"sync"
 
 	strip "github.com/grokify/html-strip-tags-go"
 )
@@ -189,6 +191,7 @@ var (
 	Int16Translator                          = &ScalarConverter{"int16_t", "C.int16_t", "int16"}
 	Int32Translator                          = &ScalarConverter{"int32_t", "C.int32_t", "int32"}
 	Int64Translator                          = &ScalarConverter{"int64_t", "C.int64_t", "int64"}
+	IntTranslator                            = &ScalarConverter{"int", "C.int", "int32"}
 	Uint8Translator                          = &ScalarConverter{"uint8_t", "C.uint8_t", "byte"}
 	Uint16Translator                         = &ScalarConverter{"uint16_t", "C.uint16_t", "uint16"}
 	Uint32Translator                         = &ScalarConverter{"uint32_t", "C.uint32_t", "uint32"}
@@ -298,11 +301,15 @@ func (xl8r *ArrayConverter) GoToC() string {
 }
 
 var (
-	cachedTranslatorMap map[string]Translator = map[string]Translator{
+	// cachedTranslatorLock guards cachedTranslatorMap, the output files are
+	// generated concurrently.
+	cachedTranslatorLock sync.RWMutex
+	cachedTranslatorMap  map[string]Translator = map[string]Translator{
 		"int8_t":   Int8Translator,
 		"int16_t":  Int16Translator,
 		"int32_t":  Int32Translator,
 		"int64_t":  Int64Translator,
+		"int":      IntTranslator,
 		"uint8_t":  Uint8Translator,
 		"uint16_t": Uint16Translator,
 		"uint32_t": Uint32Translator,
@@ -325,10 +332,24 @@ func CachedConverter(specType string) (Converter, bool) {
 }
 
 func CachedTranslator(specType string) (Translator, bool) {
+	cachedTranslatorLock.RLock()
+	defer cachedTranslatorLock.RUnlock()
 	entry, ok := cachedTranslatorMap[specType]
 	return entry, ok
 }
 
+// cacheTranslator stores entry for specType, unless another goroutine stored
+// one first. The stored translator is returned.
+func cacheTranslator(specType string, entry Translator) Translator {
+	cachedTranslatorLock.Lock()
+	defer cachedTranslatorLock.Unlock()
+	if existing, ok := cachedTranslatorMap[specType]; ok {
+		return existing
+	}
+	cachedTranslatorMap[specType] = entry
+	return entry
+}
+
 func GetScalarConverter(specType string) Converter {
 	if converter, ok := CachedConverter(specType); ok {
 		return converter
@@ -341,8 +362,7 @@ func GetCommandTranslator(specType string) Translator {
 		return entry
 	}
 	entry := &ExportTranslator{&TypeDefTranslator{specType}}
-	cachedTranslatorMap[specType] = entry
-	return entry
+	return cacheTranslator(specType, entry)
 }
 
 func GetDefineTranslator(specType string) Translator {
@@ -350,8 +370,7 @@ func GetDefineTranslator(specType string) Translator {
 		return entry
 	}
 	entry := &ExportTranslator{&CamelCaseTranslator{specType}}
-	cachedTranslatorMap[specType] = entry
-	return entry
+	return cacheTranslator(specType, entry)
 }
 
 func GetBaseConverter(specType string) Converter {
@@ -359,8 +378,7 @@ func GetBaseConverter(specType string) Converter {
 		return entry
 	}
 	entry := &TypeDefConverter{&ExportTranslator{&TypeDefTranslator{specType}}}
-	cachedTranslatorMap[specType] = entry
-	return entry
+	return cacheTranslator(specType, entry).(Converter)
 }
 
 func GetHandleConverter(specType string) Converter {
@@ -368,8 +386,7 @@ func GetHandleConverter(specType string) Converter {
 		return converter
 	}
 	entry := &HandleConverter{&ExportTranslator{&TypeDefTranslator{specType}}}
-	cachedTranslatorMap[specType] = entry
-	return entry
+	return cacheTranslator(specType, entry).(Converter)
 }
 
 func GetEnumNameConverter(specType string) Converter {
@@ -377,8 +394,7 @@ func GetEnumNameConverter(specType string) Converter {
 		return entry
 	}
 	entry := &TypeDefConverter{&ExportTranslator{&TypeDefTranslator{specType}}}
-	cachedTranslatorMap[specType] = entry
-	return entry
+	return cacheTranslator(specType, entry).(Converter)
 }
 
 func GetEnumValueConverter(specType string) Converter {
@@ -386,8 +402,7 @@ func GetEnumValueConverter(specType string) Converter {
 		return entry
 	}
 	entry := &TypeDefConverter{&ExportTranslator{&TypeDefTranslator{specType}}}
-	cachedTranslatorMap[specType] = entry
-	return entry
+	return cacheTranslator(specType, entry).(Converter)
 }
 
 func GetFuncConverter(specType string) Converter {
@@ -395,8 +410,7 @@ func GetFuncConverter(specType string) Converter {
 		return entry
 	}
 	entry := &TypeDefConverter{&ExportTranslator{&TypeDefTranslator{specType}}}
-	cachedTranslatorMap[specType] = entry
-	return entry
+	return cacheTranslator(specType, entry).(Converter)
 }
 
 func GetStructConverter(specType string) Converter {
@@ -404,8 +418,7 @@ func GetStructConverter(specType string) Converter {
 		return entry
 	}
 	entry := &TypeDefConverter{&ExportTranslator{&StructTranslator{specType}}}
-	cachedTranslatorMap[specType] = entry
-	return entry
+	return cacheTranslator(specType, entry).(Converter)
 }
 
 func GetUnionConverter(specType string) Converter {
@@ -413,8 +426,7 @@ func GetUnionConverter(specType string) Converter {
 		return entry
 	}
 	entry := &TypeDefConverter{&ExportTranslator{&TypeDefTranslator{specType}}}
-	cachedTranslatorMap[specType] = entry
-	return entry
+	return cacheTranslator(specType, entry).(Converter)
 }
 
 func CacheConverters(path []*RegistryNode) {
@@ -479,6 +491,22 @@ type EnumData struct {
 	Type   Translator // e.g. uint32
 	Name   Translator // e.g. VkResult or VK_SUCCESS
 	Values []EnumValueData
+	Table  *EnumTableData // nil when there are no values.
+	Bits   Translator     // e.g. VkCullModeFlagBits for VkCullModeFlags.
+}
+
+// EnumTableData is the static name table of an enum. The names are
+// concatenated in Names, and Index holds their offsets: the first Dense
+// entries are the names of First, First+1 and so on (empty for the values
+// without a name), the others are the names of the Sparse values, in
+// increasing order.
+type EnumTableData struct {
+	IndexType string // uint16, or uint32 for long tables.
+	First     string // e.g. VK_FORMAT_UNDEFINED
+	Dense     int
+	Sparse    []string // e.g. VK_FORMAT_G8B8G8R8_422_UNORM
+	Names     []string
+	Index     []int
 }
 
 // const (VK_SUCCESS VkResult = 0)
@@ -501,6 +529,7 @@ type StructData struct {
 	Members  []StructMemberData
 	ReadOnly bool
 	Alias    Translator
+	Large    bool // The getters take a pointer receiver.
 }
 
 // x int32
@@ -509,7 +538,12 @@ type StructMemberData struct {
 	Type   Translator // e.g. int32
 	Value  Translator
 	Copy   bool
+	Pin    bool
 	Length interface{}
+	// AltLength is the Go expression of the length of a slice member when
+	// the specification gives it as a formula (altlen) of other members.
+	AltLength string
+	View      bool // The member is a large struct, with a View getter.
 }
 
 // type VkClearValue C.VkClearValue
@@ -530,6 +564,26 @@ type CommandData struct {
 	Return     Translator // e.g. PFN_vkVoidFunction
 	Parent     Translator // i.e. first parameter type
 	Parameters []CommandParamData
+	Enumerate  *CommandEnumerateData // Set when the command follows the two-call idiom.
+	Destroys   *CommandDestroyData   // Set when the command destroys or frees handles.
+}
+
+// CommandDestroyData describes the handles a vkDestroy*, vkFree* or
+// vkResetDescriptorPool command releases, reported to the destroy hooks.
+type CommandDestroyData struct {
+	Param      CommandParamData  // The handle, or slice of handles.
+	Count      *CommandParamData // The number of handles in the slice.
+	ObjectType string            // e.g. VK_OBJECT_TYPE_BUFFER
+	Slice      bool
+}
+
+// CommandEnumerateData describes a command ending with a uint32_t count
+// pointer and an output array of that length, e.g. vkEnumeratePhysicalDevices.
+// It gets an Into variant that runs the count query and the fill in one call.
+type CommandEnumerateData struct {
+	Leading []CommandParamData // The parameters before the count.
+	Items   CommandParamData
+	SType   string // The sType of the elements, when they have one.
 }
 
 // ... (instance VkInstance, pName string) ...
@@ -565,6 +619,8 @@ func CommandToData(node *RegistryNode, command CommandElement) (bool, interface{
 				data.Parent = data.Parameters[0].Type
 			}
 		}
+		data.Enumerate = commandEnumerateData(node, command, data.Parameters)
+		data.Destroys = commandDestroyData(node, command, data.Parameters)
 
 		return true, &struct {
 			Template string
@@ -573,6 +629,85 @@ func CommandToData(node *RegistryNode, command CommandElement) (bool, interface{
 	}
 }
 
+// isHandleType reports if the translator is the one of a handle. The
+// enumeration helpers take handles as integers, as cgo boxes pointers to
+// incomplete types when it checks the arguments.
+func isHandleType(xl8r Translator) bool {
+	_, ok := xl8r.(*HandleConverter)
+	return ok
+}
+
+// commandEnumerateData returns the enumeration data of a command following the
+// two-call idiom, or nil.
+func commandEnumerateData(node *RegistryNode, command CommandElement, params []CommandParamData) *CommandEnumerateData {
+	n := len(command.Params)
+	if n < 2 {
+		return nil
+	}
+	count, items := command.Params[n-2], command.Params[n-1]
+	if count.Type != "uint32_t" || strings.Count(count.Raw, "*") != 1 || items.Length != count.Name {
+		return nil
+	}
+	if _, ok := params[n-1].Type.(*SliceConverter); !ok || items.Type == "void" || strings.Contains(items.Raw, "const") {
+		return nil
+	}
+	data := &CommandEnumerateData{
+		Leading: params[:n-2],
+		Items:   params[n-1],
+	}
+	if node == nil {
+		return data
+	}
+	for _, parent := range node.Parents {
+		if tiepuh := parent.TypeElement(); tiepuh != nil && tiepuh.Name() == items.Type {
+			for _, member := range tiepuh.StructMembers {
+				if member.Name == "sType" && len(member.Values) > 0 && !strings.Contains(member.Values, ",") {
+					data.SType = member.Values
+				}
+			}
+		}
+	}
+	return data
+}
+
+// commandDestroyData returns the destroy data of a command releasing handles
+// of a device or instance, or nil. vkDestroyDevice and vkDestroyInstance are
+// left out.
+func commandDestroyData(node *RegistryNode, command CommandElement, params []CommandParamData) *CommandDestroyData {
+	name := command.Name()
+	if node == nil || len(params) < 2 {
+		return nil
+	}
+	k := 1
+	switch {
+	case strings.HasPrefix(name, "vkDestroy"), name == "vkResetDescriptorPool":
+	case strings.HasPrefix(name, "vkFree"):
+		if slice, ok := params[len(params)-1].Type.(*SliceConverter); ok && isHandleType(slice.orig) {
+			k = len(params) - 1
+		}
+	default:
+		return nil
+	}
+	data := &CommandDestroyData{Param: params[k]}
+	if slice, ok := params[k].Type.(*SliceConverter); ok && isHandleType(slice.orig) {
+		data.Slice = true
+		for h, param := range command.Params {
+			if param.Name == command.Params[k].Length {
+				data.Count = &params[h]
+			}
+		}
+	} else if !isHandleType(params[k].Type) {
+		return nil
+	}
+	if parent := helperParentType(node, command.Params[k].Type); parent != nil {
+		data.ObjectType = parent.TypeElement().ObjTypeEnum
+	}
+	if len(data.ObjectType) == 0 {
+		return nil
+	}
+	return data
+}
+
 func TypeToData(node *RegistryNode, tiepuh TypeElement) (bool, interface{}) {
 	switch tiepuh.Category {
 	case TypeCategoryDefine:
@@ -724,8 +859,10 @@ func enumTypeToData(node *RegistryNode, tiepuh TypeElement) *struct {
 				ed.Type = t
 			}
 		}
+		ed.Bits = bitmaskBitsType(node, tiepuh)
 		bitmask = true
 	}
+	var entries []enumTableEntry
 	for _, v := range node.EnumsParents() {
 		var largestValue, smallestValue float64
 		if v.E.Type == EnumsElementBitmask {
@@ -758,6 +895,7 @@ func enumTypeToData(node *RegistryNode, tiepuh TypeElement) *struct {
 						smallestValue = float64(uint64(1) << bitPos)
 					}
 					valueTranslator = &BitValueTranslator{bitPos}
+					entries = append(entries, enumTableEntry{evd.Name.Go(), int64(uint64(1) << bitPos)})
 				}
 			} else {
 				valueTranslator = &LiteralTranslator{v.E.Value}
@@ -768,6 +906,13 @@ func enumTypeToData(node *RegistryNode, tiepuh TypeElement) *struct {
 					smallestValue = val
 				}
 			}
+			if _, ok := valueTranslator.(*LiteralTranslator); ok && !evd.Alias {
+				if n, err := strconv.ParseInt(v.E.Value, 0, 64); err == nil {
+					entries = append(entries, enumTableEntry{evd.Name.Go(), n})
+				} else if n, err := strconv.ParseUint(v.E.Value, 0, 64); err == nil {
+					entries = append(entries, enumTableEntry{evd.Name.Go(), int64(n)})
+				}
+			}
 			evd.Value = valueTranslator
 			ed.Values = append(ed.Values, evd)
 		}
@@ -784,6 +929,9 @@ func enumTypeToData(node *RegistryNode, tiepuh TypeElement) *struct {
 	if ed.Type == nil {
 		ed.Type = Uint32Translator
 	}
+	if len(ed.Values) > 0 {
+		ed.Table = enumTableData(entries, ed.Type == Uint64Translator)
+	}
 
 	return &struct {
 		Template string
@@ -791,6 +939,104 @@ func enumTypeToData(node *RegistryNode, tiepuh TypeElement) *struct {
 	}{templateName, ed}
 }
 
+// bitmaskBitsType returns the FlagBits enum of a bitmask, when it has values.
+func bitmaskBitsType(node *RegistryNode, tiepuh TypeElement) Translator {
+	name := tiepuh.Requires
+	if len(tiepuh.BitValues) > 0 {
+		name = tiepuh.BitValues
+	}
+	if len(name) == 0 || node == nil {
+		return nil
+	}
+	for _, p := range node.Parents {
+		if t := p.TypeElement(); t == nil || t.Name() != name {
+			continue
+		}
+		for _, e := range p.EnumsParents() {
+			if len(e.N.EnumParents()) > 0 {
+				return GetEnumNameConverter(name)
+			}
+		}
+	}
+	return nil
+}
+
+type enumTableEntry struct {
+	name  string
+	value int64 // The bits of the value, for the uint64 enums.
+}
+
+// enumTableData builds the name table of an enum. The longest run of values
+// with small gaps goes to the dense part of the table, indexed directly; the
+// extension values, like 1000001003, go to the sparse part, searched.
+func enumTableData(entries []enumTableEntry, unsigned bool) *EnumTableData {
+	less := func(a, b int64) bool {
+		if unsigned {
+			return uint64(a) < uint64(b)
+		}
+		return a < b
+	}
+	sort.SliceStable(entries, func(a, b int) bool {
+		return less(entries[a].value, entries[b].value)
+	})
+	// Values with more than one name keep the first one, like the map did.
+	unique := entries[:0]
+	for _, e := range entries {
+		if len(unique) == 0 || unique[len(unique)-1].value != e.value {
+			unique = append(unique, e)
+		}
+	}
+	entries = unique
+
+	const maxGap = 4
+	start, end := 0, 0
+	for i := 0; i < len(entries); {
+		j := i + 1
+		for j < len(entries) && uint64(entries[j].value-entries[j-1].value) <= maxGap {
+			j++
+		}
+		if j-i > end-start {
+			start, end = i, j
+		}
+		i = j
+	}
+	if end-start < 4 {
+		start, end = 0, 0
+	}
+
+	data := &EnumTableData{}
+	var length int
+	data.Index = append(data.Index, 0)
+	if end > start {
+		data.First = entries[start].name
+		first := entries[start].value
+		for _, e := range entries[start:end] {
+			for int64(data.Dense) < e.value-first {
+				data.Index = append(data.Index, length)
+				data.Dense++
+			}
+			data.Names = append(data.Names, e.name)
+			length += len(e.name)
+			data.Index = append(data.Index, length)
+			data.Dense++
+		}
+	}
+	for i, e := range entries {
+		if i >= start && i < end {
+			continue
+		}
+		data.Sparse = append(data.Sparse, e.name)
+		data.Names = append(data.Names, e.name)
+		length += len(e.name)
+		data.Index = append(data.Index, length)
+	}
+	data.IndexType = "uint16"
+	if length > 0xFFFF {
+		data.IndexType = "uint32"
+	}
+	return data
+}
+
 func funcTypeToData(node *RegistryNode, tiepuh TypeElement) *struct {
 	Template string
 	Data     FuncData
@@ -831,15 +1077,28 @@ func structTypeToData(node *RegistryNode, tiepuh TypeElement) *struct {
 			subData.Value = &LiteralTranslator{v.Values}
 		} else if strings.ContainsAny(subData.Type.CGo(), "[]") {
 			subData.Copy = true
+		} else {
+			subData.Pin = helperMemberIsPinnable(subData.Type)
+		}
+		if !strings.ContainsAny(v.Raw, "*[") {
+			if parent := helperParentType(node, v.Type); parent != nil && parent.TypeElement().Category == TypeCategoryStruct {
+				subData.View = helperTypeSize(parent) >= largeStructSize
+			}
 		}
 		data.Members = append(data.Members, subData)
 		lengthLookup[v.Name] = &data.Members[len(data.Members)-1]
 	}
+	data.Large = helperTypeSize(node) >= largeStructSize
 	for k, v := range tiepuh.StructMembers {
-		if len(v.Length) > 0 && v.Length != "1" && len(strings.Split(v.Length, ",")) == 1 {
-			if ptr, ok := lengthLookup[v.Length]; ok && data.Members[k].Type.Go() != "unsafe.Pointer" {
-				data.Members[k].Length = ptr
-			}
+		if len(v.Length) == 0 || v.Length == "1" || data.Members[k].Type.Go() == "unsafe.Pointer" {
+			continue
+		}
+		// e.g. enabledLayerCount,null-terminated: the first part is the
+		// length of the outer array.
+		if ptr, ok := lengthLookup[strings.Split(v.Length, ",")[0]]; ok {
+			data.Members[k].Length = ptr
+		} else if len(v.AltLength) > 0 {
+			data.Members[k].AltLength = helperAltLength(v.AltLength, lengthLookup)
 		}
 	}
 	return &struct {
@@ -848,6 +1107,124 @@ func structTypeToData(node *RegistryNode, tiepuh TypeElement) *struct {
 	}{"struct", data}
 }
 
+var altLengthIdentifier = regexp.MustCompile(`[A-Za-z_][A-Za-z0-9_]*`)
+
+// helperAltLength translates the altlen of a member, e.g. codeSize / 4, to
+// a Go expression reading the members of x. It returns an empty string when
+// the formula names something other than members and API constants.
+func helperAltLength(altlen string, members map[string]*StructMemberData) string {
+	ok := true
+	expr := altLengthIdentifier.ReplaceAllStringFunc(altlen, func(name string) string {
+		if member, found := members[name]; found {
+			return "x." + member.Name.CGo()
+		}
+		if strings.HasPrefix(name, "VK_") {
+			return "C." + name
+		}
+		ok = false
+		return name
+	})
+	if !ok {
+		return ""
+	}
+	return expr
+}
+
+// helperMemberIsPinnable reports if the member holds a pointer that can
+// reference Go memory pinned by runtime.Pinner.
+func helperMemberIsPinnable(t Translator) bool {
+	switch t.(type) {
+	case *SliceConverter, *PointerConverter:
+		return true
+	}
+	return t.Go() == "unsafe.Pointer"
+}
+
+// largeStructSize is the estimated size, in bytes, from which the getters of a
+// struct take a pointer receiver: copying the struct on every read costs more
+// than the indirection.
+const largeStructSize = 64
+
+// helperParentType returns the type node named name among the parents of
+// node, or nil.
+func helperParentType(node *RegistryNode, name string) *RegistryNode {
+	for _, parent := range node.Parents {
+		if tiepuh := parent.TypeElement(); tiepuh != nil && tiepuh.Name() == name {
+			return parent
+		}
+	}
+	return nil
+}
+
+// helperTypeSize estimates the C size of a type node on a 64 bit platform,
+// ignoring padding.
+func helperTypeSize(node *RegistryNode) int {
+	tiepuh := node.TypeElement()
+	if tiepuh == nil {
+		return 4
+	}
+	switch tiepuh.Name() {
+	case "char", "int8_t", "uint8_t":
+		return 1
+	case "int16_t", "uint16_t":
+		return 2
+	case "int64_t", "uint64_t", "size_t", "double":
+		return 8
+	}
+	if len(tiepuh.Alias) > 0 {
+		if parent := helperParentType(node, tiepuh.Alias); parent != nil {
+			return helperTypeSize(parent)
+		}
+	}
+	switch tiepuh.Category {
+	case TypeCategoryHandle, TypeCategoryFuncpointer:
+		return 8
+	case TypeCategoryBasetype, TypeCategoryBitmask:
+		if parent := helperParentType(node, tiepuh.TypeTag); parent != nil {
+			return helperTypeSize(parent)
+		}
+	case TypeCategoryStruct, TypeCategoryUnion:
+		size := 0
+		for _, member := range tiepuh.StructMembers {
+			n := helperMemberSize(node, member)
+			if tiepuh.Category == TypeCategoryUnion {
+				if n > size {
+					size = n
+				}
+			} else {
+				size += n
+			}
+		}
+		return size
+	}
+	return 4
+}
+
+// helperMemberSize estimates the C size of a member of the struct node.
+func helperMemberSize(node *RegistryNode, member TypeMemberElement) int {
+	if strings.Contains(member.Raw, "*") {
+		return 8
+	}
+	size := 4
+	if parent := helperParentType(node, member.Type); parent != nil {
+		size = helperTypeSize(parent)
+	}
+	for _, dim := range arrayNumericSizeRegexp.FindAllString(member.Raw, -1) {
+		n, _ := strconv.Atoi(dim[1 : len(dim)-1])
+		size *= n
+	}
+	if len(member.Enum) > 0 {
+		for _, parent := range node.Parents {
+			if enum := parent.EnumElement(); enum != nil && enum.Name == member.Enum {
+				if n, err := strconv.Atoi(enum.Value); err == nil {
+					size *= n
+				}
+			}
+		}
+	}
+	return size
+}
+
 func unionTypeToData(node *RegistryNode, tiepuh TypeElement) *struct {
 	Template string
 	Data     UnionData
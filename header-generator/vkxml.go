@@ -134,7 +134,7 @@ type TypeElement struct {
 	NameTag string `xml:"name"`
 	// BitValues contains the name of the enumeration defining flag values for a
 	// bitmask type. Ignored for other types.
-	BitValues string `xml:"bitvalues,omitempty"`
+	BitValues string `xml:"bitvalues,attr,omitempty"`
 	// Raw is if the category attribute is one of basetype, bitmask, define,
 	// funcpointer, group, handle or include, or is not specified, type contains
 	// text which is legal C code for a type declaration.
@@ -961,6 +961,7 @@ func (registry *Registry) Graph(enabledMap map[string]bool) (RegistryGraph, *Reg
 	for _, v := range registry.Types {
 		self := dictionary[v.Name()]
 		link(self, v.Requires)
+		link(self, v.BitValues)
 		link(self, v.Alias)
 		link(self, v.Parent)
 		for _, member := range v.StructMembers {
@@ -1256,7 +1257,7 @@ func (registryNode RegistryNode) Name() string {
 		break
 	case RegistryNodeType:
 		if tiepuh := registryNode.TypeElement(); tiepuh != nil {
-			name = strings.TrimSpace(fmt.Sprintf("%s %s", tiepuh.Category, tiepuh.Name))
+			name = strings.TrimSpace(fmt.Sprintf("%s %s", tiepuh.Category, tiepuh.Name()))
 		}
 		break
 	case RegistryNodeEnums:
@@ -0,0 +1,22 @@
+//go:build (amd64 || arm64) && !vks_no_fastcall
+
+// Package trampoline calls C functions on the system stack without going
+// through cgo. It lives outside of vks because packages using cgo cannot
+// contain Go assembly.
+package trampoline
+
+import "unsafe"
+
+// Supported reports if Call is available. Build with the vks_no_fastcall tag
+// to disable it.
+const Supported = true
+
+// Call calls the C function fn with arg on the system stack of the current
+// thread, through runtime.asmcgocall, the way the runtime calls libc on some
+// platforms. Unlike a cgo call it does not enter a system call, so the
+// scheduler and garbage collector wait until fn returns; fn must be short and
+// must not block or call back into Go. arg may point to the goroutine stack,
+// which cannot move while fn runs.
+//
+//go:noescape
+func Call(fn, arg unsafe.Pointer) int32
@@ -0,0 +1,9 @@
+//go:build !vks_no_fastcall
+
+#include "textflag.h"
+
+// func Call(fn, arg unsafe.Pointer) int32
+// Tail calls runtime·asmcgocall, which has the same argument layout. It
+// switches to the system stack, aligns it for the C ABI and calls fn(arg).
+TEXT ·Call(SB), NOSPLIT, $0-20
+	JMP runtime·asmcgocall(SB)
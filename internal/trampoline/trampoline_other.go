@@ -0,0 +1,13 @@
+//go:build !(amd64 || arm64) || vks_no_fastcall
+
+package trampoline
+
+import "unsafe"
+
+// Supported reports if Call is available.
+const Supported = false
+
+// Call panics; callers check Supported first.
+func Call(fn, arg unsafe.Pointer) int32 {
+	panic("trampoline: not supported on this platform")
+}
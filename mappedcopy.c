@@ -0,0 +1,151 @@
+// Copies into and out of mapped device memory that is not HOST_CACHED.
+//
+// Such memory is usually write-combined: the CPU gathers the stores to a
+// cache line in a buffer and sends the line to the device in one burst when it
+// is complete. Partial lines, reads and regular cached stores, which read the
+// line first, defeat the buffer. vksStreamStore aligns the destination to a
+// cache line and writes whole lines with non-temporal stores; vksStreamLoad
+// reads whole lines with streaming loads, which fill a line buffer instead of
+// going through the cache one uncached access at a time.
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include "mappedcopy.h"
+
+#define VKS_CACHE_LINE 64
+
+#if defined(__x86_64__)
+#include <immintrin.h>
+
+static void stream_store_sse2(uint8_t* d, const uint8_t* s, size_t lines) {
+	for (size_t i = 0; i < lines; i++, d += VKS_CACHE_LINE, s += VKS_CACHE_LINE) {
+		__m128i a = _mm_loadu_si128((const __m128i*)s);
+		__m128i b = _mm_loadu_si128((const __m128i*)(s + 16));
+		__m128i c = _mm_loadu_si128((const __m128i*)(s + 32));
+		__m128i e = _mm_loadu_si128((const __m128i*)(s + 48));
+		_mm_stream_si128((__m128i*)d, a);
+		_mm_stream_si128((__m128i*)(d + 16), b);
+		_mm_stream_si128((__m128i*)(d + 32), c);
+		_mm_stream_si128((__m128i*)(d + 48), e);
+	}
+	_mm_sfence();
+}
+
+__attribute__((target("avx"))) static void stream_store_avx(uint8_t* d, const uint8_t* s, size_t lines) {
+	for (size_t i = 0; i < lines; i++, d += VKS_CACHE_LINE, s += VKS_CACHE_LINE) {
+		__m256i a = _mm256_loadu_si256((const __m256i*)s);
+		__m256i b = _mm256_loadu_si256((const __m256i*)(s + 32));
+		_mm256_stream_si256((__m256i*)d, a);
+		_mm256_stream_si256((__m256i*)(d + 32), b);
+	}
+	_mm_sfence();
+}
+
+__attribute__((target("sse4.1"))) static void stream_load_sse41(uint8_t* d, const uint8_t* s, size_t lines) {
+	for (size_t i = 0; i < lines; i++, d += VKS_CACHE_LINE, s += VKS_CACHE_LINE) {
+		__m128i a = _mm_stream_load_si128((__m128i*)s);
+		__m128i b = _mm_stream_load_si128((__m128i*)(s + 16));
+		__m128i c = _mm_stream_load_si128((__m128i*)(s + 32));
+		__m128i e = _mm_stream_load_si128((__m128i*)(s + 48));
+		_mm_storeu_si128((__m128i*)d, a);
+		_mm_storeu_si128((__m128i*)(d + 16), b);
+		_mm_storeu_si128((__m128i*)(d + 32), c);
+		_mm_storeu_si128((__m128i*)(d + 48), e);
+	}
+}
+
+static void copy_lines(uint8_t* d, const uint8_t* s, size_t lines) {
+	memcpy(d, s, lines * VKS_CACHE_LINE);
+}
+
+static void (*store_lines)(uint8_t*, const uint8_t*, size_t) = stream_store_sse2;
+static void (*load_lines)(uint8_t*, const uint8_t*, size_t) = copy_lines;
+static pthread_once_t copy_once = PTHREAD_ONCE_INIT;
+
+static void copy_init() {
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx")) {
+		store_lines = stream_store_avx;
+	}
+	if (__builtin_cpu_supports("sse4.1")) {
+		load_lines = stream_load_sse41;
+	}
+}
+
+#elif defined(__aarch64__)
+
+// STNP and LDNP are the non-temporal pair stores and loads.
+static void stream_store_lines(uint8_t* d, const uint8_t* s, size_t lines) {
+	for (size_t i = 0; i < lines; i++, d += VKS_CACHE_LINE, s += VKS_CACHE_LINE) {
+		__asm__ volatile(
+			"ldp q0, q1, [%1]\n\t"
+			"ldp q2, q3, [%1, #32]\n\t"
+			"stnp q0, q1, [%0]\n\t"
+			"stnp q2, q3, [%0, #32]\n\t"
+			:
+			: "r"(d), "r"(s)
+			: "v0", "v1", "v2", "v3", "memory");
+	}
+	__asm__ volatile("dmb ishst" ::: "memory");
+}
+
+static void stream_load_lines(uint8_t* d, const uint8_t* s, size_t lines) {
+	for (size_t i = 0; i < lines; i++, d += VKS_CACHE_LINE, s += VKS_CACHE_LINE) {
+		__asm__ volatile(
+			"ldnp q0, q1, [%1]\n\t"
+			"ldnp q2, q3, [%1, #32]\n\t"
+			"stp q0, q1, [%0]\n\t"
+			"stp q2, q3, [%0, #32]\n\t"
+			:
+			: "r"(d), "r"(s)
+			: "v0", "v1", "v2", "v3", "memory");
+	}
+}
+
+static void (*store_lines)(uint8_t*, const uint8_t*, size_t) = stream_store_lines;
+static void (*load_lines)(uint8_t*, const uint8_t*, size_t) = stream_load_lines;
+static pthread_once_t copy_once = PTHREAD_ONCE_INIT;
+
+static void copy_init() {}
+
+#else
+
+static void copy_lines(uint8_t* d, const uint8_t* s, size_t lines) {
+	memcpy(d, s, lines * VKS_CACHE_LINE);
+}
+
+static void (*store_lines)(uint8_t*, const uint8_t*, size_t) = copy_lines;
+static void (*load_lines)(uint8_t*, const uint8_t*, size_t) = copy_lines;
+static pthread_once_t copy_once = PTHREAD_ONCE_INIT;
+
+static void copy_init() {}
+
+#endif
+
+// split copies the bytes before the first cache line boundary of the mapped
+// side and after the last one with memcpy, and the lines in between with fn.
+static void split(uint8_t* d, const uint8_t* s, size_t n, uintptr_t mapped, void (*fn)(uint8_t*, const uint8_t*, size_t)) {
+	size_t head = (VKS_CACHE_LINE - (mapped & (VKS_CACHE_LINE - 1))) & (VKS_CACHE_LINE - 1);
+	if (head > n) {
+		head = n;
+	}
+	memcpy(d, s, head);
+	d += head;
+	s += head;
+	n -= head;
+	size_t lines = n / VKS_CACHE_LINE;
+	if (lines > 0) {
+		fn(d, s, lines);
+	}
+	memcpy(d + lines * VKS_CACHE_LINE, s + lines * VKS_CACHE_LINE, n - lines * VKS_CACHE_LINE);
+}
+
+void vksStreamStore(void* dst, const void* src, size_t n) {
+	pthread_once(&copy_once, copy_init);
+	split((uint8_t*)dst, (const uint8_t*)src, n, (uintptr_t)dst, store_lines);
+}
+
+void vksStreamLoad(void* dst, const void* src, size_t n) {
+	pthread_once(&copy_once, copy_init);
+	split((uint8_t*)dst, (const uint8_t*)src, n, (uintptr_t)src, load_lines);
+}
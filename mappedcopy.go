@@ -0,0 +1,106 @@
+package vks
+
+//#include "mappedcopy.h"
+import "C"
+import (
+	"runtime"
+	"sync"
+	"unsafe"
+)
+
+// Mapped copies below streamCopyMinBytes use copy: the cgo call costs more
+// than the partial write-combining they save. From parallelCopyBytes, the
+// copy is split in parallelCopyChunk byte chunks over at most
+// parallelCopyWorkers goroutines; a few cores are enough to saturate the bus.
+const (
+	streamCopyMinBytes  = 4 << 10
+	parallelCopyBytes   = 4 << 20
+	parallelCopyChunk   = 1 << 20
+	parallelCopyWorkers = 4
+)
+
+// uncachedMemory reports if mapped memory with the property flags is likely
+// write-combined: host visible, but not host cached.
+func uncachedMemory(props MemoryPropertyFlags) bool {
+	hostVisible := MemoryPropertyFlags(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+	hostCached := MemoryPropertyFlags(VK_MEMORY_PROPERTY_HOST_CACHED_BIT)
+	return props&(hostVisible|hostCached) == hostVisible
+}
+
+// CopyToMapped copies src into dst, mapped memory of a memory type with the
+// provided property flags, and returns the number of bytes copied. When the
+// memory is not HOST_CACHED, so usually write-combined, the copy uses
+// non-temporal stores of whole cache lines, and multi-megabyte copies are
+// split across goroutines. Other memory is copied with copy.
+func CopyToMapped(dst, src []byte, props MemoryPropertyFlags) int {
+	n := min(len(dst), len(src))
+	if !uncachedMemory(props) || n < streamCopyMinBytes {
+		return copy(dst, src)
+	}
+	parallelCopy(dst[:n], src[:n], func(d, s []byte) {
+		C.vksStreamStore(unsafe.Pointer(unsafe.SliceData(d)), unsafe.Pointer(unsafe.SliceData(s)), C.size_t(len(d)))
+	})
+	return n
+}
+
+// CopyFromMapped copies src, mapped memory of a memory type with the provided
+// property flags, into dst and returns the number of bytes copied. When the
+// memory is not HOST_CACHED, the copy uses streaming loads of whole cache
+// lines, and multi-megabyte copies are split across goroutines.
+func CopyFromMapped(dst, src []byte, props MemoryPropertyFlags) int {
+	n := min(len(dst), len(src))
+	if !uncachedMemory(props) || n < streamCopyMinBytes {
+		return copy(dst, src)
+	}
+	parallelCopy(dst[:n], src[:n], func(d, s []byte) {
+		C.vksStreamLoad(unsafe.Pointer(unsafe.SliceData(d)), unsafe.Pointer(unsafe.SliceData(s)), C.size_t(len(d)))
+	})
+	return n
+}
+
+// parallelCopy calls fn on chunks of dst and src, from several goroutines for
+// large copies. The chunks are multiples of parallelCopyChunk, so every chunk
+// but the first and the last covers whole cache lines on both sides.
+func parallelCopy(dst, src []byte, fn func(d, s []byte)) {
+	n := len(dst)
+	workers := min(runtime.GOMAXPROCS(0), parallelCopyWorkers, n/parallelCopyChunk)
+	if n < parallelCopyBytes || workers < 2 {
+		fn(dst, src)
+		return
+	}
+	per := (n/workers + parallelCopyChunk - 1) / parallelCopyChunk * parallelCopyChunk
+	var wg sync.WaitGroup
+	for off := 0; off < n; off += per {
+		end := min(off+per, n)
+		wg.Add(1)
+		go func(off, end int) {
+			defer wg.Done()
+			fn(dst[off:end], src[off:end])
+		}(off, end)
+	}
+	wg.Wait()
+}
+
+// CopyToMemoryType is CopyToMemory for memory of a memory type with the
+// provided property flags. See CopyToMapped.
+func (device DeviceFacade) CopyToMemoryType(memory DeviceMemory, props MemoryPropertyFlags, offset, size DeviceSize, flags MemoryMapFlags, src []byte) (int, error) {
+	var pData unsafe.Pointer
+	if err := device.MapMemory(memory, offset, size, flags, &pData).AsErr(); err != nil {
+		return 0, err
+	}
+	n := CopyToMapped(unsafe.Slice((*byte)(pData), size), src, props)
+	device.UnmapMemory(memory)
+	return n, nil
+}
+
+// CopyFromMemoryType is CopyFromMemory for memory of a memory type with the
+// provided property flags. See CopyFromMapped.
+func (device DeviceFacade) CopyFromMemoryType(memory DeviceMemory, props MemoryPropertyFlags, offset, size DeviceSize, flags MemoryMapFlags, dst []byte) (int, error) {
+	var pData unsafe.Pointer
+	if err := device.MapMemory(memory, offset, size, flags, &pData).AsErr(); err != nil {
+		return 0, err
+	}
+	n := CopyFromMapped(dst, unsafe.Slice((*byte)(pData), size), props)
+	device.UnmapMemory(memory)
+	return n, nil
+}
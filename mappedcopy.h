@@ -0,0 +1,13 @@
+#ifndef __VKS_MAPPEDCOPY_H__
+#define __VKS_MAPPEDCOPY_H__
+#include <stddef.h>
+
+// vksStreamStore copies n bytes to write-combined memory with non-temporal,
+// full cache line stores.
+void vksStreamStore(void* dst, const void* src, size_t n);
+
+// vksStreamLoad copies n bytes from write-combined or uncached memory with
+// streaming loads.
+void vksStreamLoad(void* dst, const void* src, size_t n);
+
+#endif
@@ -0,0 +1,130 @@
+package vks
+
+import (
+	"bytes"
+	"fmt"
+	"testing"
+	"unsafe"
+)
+
+var uncachedProps = MemoryPropertyFlags(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+
+// TestMappedCopySplit copies to and from every cache line alignment of the
+// mapped side, around the sizes switching to the streaming and the parallel
+// copies, and checks the bytes around the destination are left alone.
+func TestMappedCopySplit(t *testing.T) {
+	sizes := []int{
+		1, 63, 64, 65,
+		streamCopyMinBytes - 1, streamCopyMinBytes, streamCopyMinBytes + 1, streamCopyMinBytes + 63,
+		parallelCopyBytes - 1, parallelCopyBytes, parallelCopyBytes + 65,
+	}
+	const guard = 128
+	src := make([]byte, parallelCopyBytes+4096)
+	for k := range src {
+		src[k] = byte(k*7 + k>>8)
+	}
+	dst := make([]byte, len(src)+2*guard)
+	for _, n := range sizes {
+		for align := 0; align < 64; align++ {
+			for _, to := range []bool{true, false} {
+				for k := range dst {
+					dst[k] = 0xa5
+				}
+				// The other side gets a different alignment.
+				s := src[(align*5)%64:][:n]
+				d := dst[guard+align:][:n]
+				var copied int
+				if to {
+					copied = CopyToMapped(d, s, uncachedProps)
+				} else {
+					copied = CopyFromMapped(d, s, uncachedProps)
+				}
+				name := fmt.Sprintf("to=%v size %d alignment %d", to, n, align)
+				if copied != n {
+					t.Fatalf("%s: copied %d bytes", name, copied)
+				}
+				if !bytes.Equal(d, s) {
+					t.Fatalf("%s: the copy differs", name)
+				}
+				for k, b := range dst {
+					if (k < guard+align || k >= guard+align+n) && b != 0xa5 {
+						t.Fatalf("%s: wrote byte %d outside of the destination", name, k-guard-align)
+					}
+				}
+			}
+		}
+	}
+}
+
+// mappedMemoryTypes allocates size bytes of every host visible memory type
+// of the loaded driver, and maps them. It skips the benchmark when there are
+// none.
+func mappedMemoryTypes(b *testing.B, size DeviceSize) (types []uint32, flags []MemoryPropertyFlags, mapped [][]byte) {
+	pd := nullPhysicalDevice(b)
+	device := nullDeviceOf(b, pd)
+	var props PhysicalDeviceMemoryProperties
+	pd.GetPhysicalDeviceMemoryProperties(&props)
+	hostVisible := MemoryPropertyFlags(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+	for h, memoryType := range props.MemoryTypes()[:props.MemoryTypeCount()] {
+		if memoryType.PropertyFlags()&hostVisible == 0 {
+			continue
+		}
+		info := &MemoryAllocateInfo{}
+		info.SetDefaultSType()
+		info.SetAllocationSize(size)
+		info.SetMemoryTypeIndex(uint32(h))
+		var memory DeviceMemory
+		if err := device.AllocateMemory(info, nil, &memory).AsErr(); err != nil {
+			b.Logf("memory type %d: %v", h, err)
+			continue
+		}
+		b.Cleanup(func() { device.FreeMemory(memory, nil) })
+		var pData unsafe.Pointer
+		if err := device.MapMemory(memory, 0, size, 0, &pData).AsErr(); err != nil {
+			b.Fatal(err)
+		}
+		b.Cleanup(func() { device.UnmapMemory(memory) })
+		types = append(types, uint32(h))
+		flags = append(flags, memoryType.PropertyFlags())
+		mapped = append(mapped, unsafe.Slice((*byte)(pData), size))
+	}
+	if len(types) == 0 {
+		b.Skip("the driver has no host visible memory")
+	}
+	return types, flags, mapped
+}
+
+// benchmarkMappedCopy copies between Go memory and mapped memory of every
+// host visible memory type, named after the type index and whether it is
+// host cached.
+func benchmarkMappedCopy(b *testing.B, to bool) {
+	sizes := []int{16 << 10, 1 << 20, 16 << 20}
+	types, flags, mapped := mappedMemoryTypes(b, DeviceSize(sizes[len(sizes)-1]))
+	for h := range types {
+		kind := "Uncached"
+		if !uncachedMemory(flags[h]) {
+			kind = "Cached"
+		}
+		for _, size := range sizes {
+			b.Run(fmt.Sprintf("Type%d%s/%dK", types[h], kind, size>>10), func(b *testing.B) {
+				local := make([]byte, size)
+				b.SetBytes(int64(size))
+				for k := 0; k < b.N; k++ {
+					if to {
+						CopyToMapped(mapped[h][:size], local, flags[h])
+					} else {
+						CopyFromMapped(local, mapped[h][:size], flags[h])
+					}
+				}
+			})
+		}
+	}
+}
+
+func BenchmarkCopyToMapped(b *testing.B) {
+	benchmarkMappedCopy(b, true)
+}
+
+func BenchmarkCopyFromMapped(b *testing.B) {
+	benchmarkMappedCopy(b, false)
+}
@@ -0,0 +1,310 @@
+//go:build !vks_no_ext_memory_budget && !vks_no_version_1_1
+
+package vks
+
+import (
+	"sync"
+	"time"
+	"unsafe"
+)
+
+// MemoryBudgetConfig configures a MemoryBudget.
+type MemoryBudgetConfig struct {
+	// Interval is the period of the budget polling; one second when zero.
+	// The budget changes with the memory pressure of the whole system, so
+	// polling faster than a few times per second buys nothing.
+	Interval time.Duration
+
+	// Headroom is the fraction of a heap budget the allocations may reach
+	// before they are refused; 0.9 when zero. The rest absorbs the
+	// allocations of the driver and of the other memory users between two
+	// polls.
+	Headroom float64
+}
+
+// MemoryHeapBudget is the state of a memory heap.
+type MemoryHeapBudget struct {
+	Flags  MemoryHeapFlags
+	Size   DeviceSize // The size of the heap.
+	Budget DeviceSize // How much the process can use before paging starts.
+	Usage  DeviceSize // The last polled usage plus the allocations since.
+}
+
+// MemoryBudgetStats counts the polls and the interventions of a MemoryBudget.
+type MemoryBudgetStats struct {
+	Polls     int
+	Refused   int        // The reservations over budget, even after eviction.
+	Evictions int        // The evictor calls.
+	Evicted   DeviceSize // The bytes the evictors reported freeing.
+}
+
+// MemoryEvictor frees cached allocations from a heap under pressure. need is
+// the number of bytes over the budget. It returns the number of bytes it
+// freed. Without VK_EXT_memory_budget, only the memory returned through
+// MemoryBudget.Release lowers the usage.
+type MemoryEvictor func(heap uint32, need DeviceSize) DeviceSize
+
+type memoryReservation struct {
+	heap uint32
+	size DeviceSize
+}
+
+// MemoryBudget tracks the memory budget and usage of every heap of a physical
+// device, from VK_EXT_memory_budget polled on a goroutine, and implements
+// MemoryBudgeter. Between two polls, the allocations reserved through the
+// budget are added to the polled usage, so bursts of allocations are accounted
+// for before the driver reports them. When a reservation would go over the
+// budget, the evictors are called before it is refused, and the allocation
+// falls back to another memory type.
+//
+// Without VK_EXT_memory_budget, the budget of a heap is its size and the usage
+// is the sum of the reservations, so every allocation must go through the
+// budget to be accounted for.
+type MemoryBudget struct {
+	pd        PhysicalDeviceFacade
+	memory    PhysicalDeviceMemoryProperties
+	supported bool
+	headroom  float64
+
+	mu        sync.Mutex
+	budget    []DeviceSize
+	usage     []DeviceSize // As of the last poll.
+	local     []int64      // Reserved minus released since the last poll.
+	reserved  map[DeviceMemory]memoryReservation
+	evictors  []MemoryEvictor
+	stats     MemoryBudgetStats
+	pollMutex sync.Mutex
+
+	stop chan struct{}
+	done chan struct{}
+}
+
+// NewMemoryBudget polls the budget of the heaps of the physical device, and
+// starts the polling goroutine when the device supports VK_EXT_memory_budget.
+func NewMemoryBudget(pd PhysicalDeviceFacade, config MemoryBudgetConfig) *MemoryBudget {
+	if config.Interval <= 0 {
+		config.Interval = time.Second
+	}
+	if config.Headroom <= 0 || config.Headroom > 1 {
+		config.Headroom = 0.9
+	}
+	mb := &MemoryBudget{
+		pd:        pd,
+		supported: memoryBudgetSupported(pd),
+		headroom:  config.Headroom,
+		reserved:  make(map[DeviceMemory]memoryReservation),
+		stop:      make(chan struct{}),
+		done:      make(chan struct{}),
+	}
+	mb.Poll()
+	if mb.supported {
+		go mb.run(config.Interval)
+	} else {
+		close(mb.done)
+	}
+	return mb
+}
+
+func memoryBudgetSupported(pd PhysicalDeviceFacade) bool {
+	props, result := pd.EnumerateDeviceExtensionPropertiesInto(nil, nil)
+	if !result.IsSuccess() {
+		return false
+	}
+	for _, p := range props {
+		if ToStringView(p.ExtensionName()) == VK_EXT_MEMORY_BUDGET_EXTENSION_NAME {
+			return true
+		}
+	}
+	return false
+}
+
+func (mb *MemoryBudget) run(interval time.Duration) {
+	defer close(mb.done)
+	ticker := time.NewTicker(interval)
+	defer ticker.Stop()
+	for {
+		select {
+		case <-mb.stop:
+			return
+		case <-ticker.C:
+			mb.Poll()
+		}
+	}
+}
+
+// Supported returns whether the budgets come from VK_EXT_memory_budget.
+func (mb *MemoryBudget) Supported() bool {
+	return mb.supported
+}
+
+// Poll refreshes the budget and usage of every heap. It is called by the
+// polling goroutine, and after the evictors ran.
+func (mb *MemoryBudget) Poll() {
+	// Concurrent polls would subtract the same reservations twice.
+	mb.pollMutex.Lock()
+	defer mb.pollMutex.Unlock()
+
+	mb.mu.Lock()
+	since := append([]int64(nil), mb.local...)
+	mb.mu.Unlock()
+
+	arp := NewAutoReleaser()
+	defer arp.Release()
+	var budget PhysicalDeviceMemoryBudgetPropertiesEXT
+	budget.SetDefaultSType()
+	var memory PhysicalDeviceMemoryProperties2
+	memory.SetDefaultSType()
+	if mb.supported {
+		memory.PinPNext(arp, unsafe.Pointer(&budget))
+	}
+	mb.pd.GetPhysicalDeviceMemoryProperties2(&memory)
+
+	mb.mu.Lock()
+	defer mb.mu.Unlock()
+	mb.memory = memory.MemoryProperties()
+	heaps := mb.memory.MemoryHeaps()[:mb.memory.MemoryHeapCount()]
+	if mb.budget == nil {
+		mb.budget = make([]DeviceSize, len(heaps))
+		mb.usage = make([]DeviceSize, len(heaps))
+		mb.local = make([]int64, len(heaps))
+	}
+	for h, heap := range heaps {
+		if !mb.supported {
+			mb.budget[h] = heap.Size()
+			continue
+		}
+		mb.budget[h] = budget.HeapBudget()[h]
+		mb.usage[h] = budget.HeapUsage()[h]
+		// The polled usage includes what was reserved before the query.
+		if h < len(since) {
+			mb.local[h] -= since[h]
+		}
+	}
+	mb.stats.Polls++
+}
+
+// Heaps returns the state of every heap.
+func (mb *MemoryBudget) Heaps() []MemoryHeapBudget {
+	mb.mu.Lock()
+	defer mb.mu.Unlock()
+	heaps := make([]MemoryHeapBudget, len(mb.budget))
+	for h := range heaps {
+		heap := mb.memory.MemoryHeaps()[h]
+		heaps[h] = MemoryHeapBudget{
+			Flags:  heap.Flags(),
+			Size:   heap.Size(),
+			Budget: mb.budget[h],
+			Usage:  mb.heapUsage(uint32(h)),
+		}
+	}
+	return heaps
+}
+
+// Stats returns the counters of the budget.
+func (mb *MemoryBudget) Stats() MemoryBudgetStats {
+	mb.mu.Lock()
+	defer mb.mu.Unlock()
+	return mb.stats
+}
+
+// AddEvictor registers an evictor called when a reservation would go over the
+// budget. Evictors are called in registration order, without any lock held,
+// until enough memory is freed.
+func (mb *MemoryBudget) AddEvictor(evictor MemoryEvictor) {
+	mb.mu.Lock()
+	defer mb.mu.Unlock()
+	mb.evictors = append(mb.evictors, evictor)
+}
+
+// Reserve implements MemoryBudgeter.
+func (mb *MemoryBudget) Reserve(typeIndex uint32, size DeviceSize) bool {
+	mb.mu.Lock()
+	if typeIndex >= mb.memory.MemoryTypeCount() {
+		mb.mu.Unlock()
+		return false
+	}
+	heap := mb.memory.MemoryTypes()[typeIndex].HeapIndex()
+	need := mb.overBudget(heap, size)
+	evictors := mb.evictors
+	mb.mu.Unlock()
+
+	if need > 0 && len(evictors) > 0 {
+		var freed DeviceSize
+		calls := 0
+		for _, evictor := range evictors {
+			freed += evictor(heap, need-freed)
+			calls++
+			if freed >= need {
+				break
+			}
+		}
+		mb.mu.Lock()
+		mb.stats.Evictions += calls
+		mb.stats.Evicted += freed
+		mb.mu.Unlock()
+		if mb.supported {
+			mb.Poll()
+		}
+	}
+
+	mb.mu.Lock()
+	defer mb.mu.Unlock()
+	if mb.overBudget(heap, size) > 0 {
+		mb.stats.Refused++
+		return false
+	}
+	mb.local[heap] += int64(size)
+	return true
+}
+
+// Commit implements MemoryBudgeter.
+func (mb *MemoryBudget) Commit(memory DeviceMemory, typeIndex uint32, size DeviceSize) {
+	mb.mu.Lock()
+	defer mb.mu.Unlock()
+	heap := mb.memory.MemoryTypes()[typeIndex].HeapIndex()
+	if memory == NullDeviceMemory {
+		mb.local[heap] -= int64(size)
+		return
+	}
+	mb.reserved[memory] = memoryReservation{heap, size}
+}
+
+// Release implements MemoryBudgeter.
+func (mb *MemoryBudget) Release(memory DeviceMemory) {
+	mb.mu.Lock()
+	defer mb.mu.Unlock()
+	if r, ok := mb.reserved[memory]; ok {
+		delete(mb.reserved, memory)
+		mb.local[r.heap] -= int64(r.size)
+	}
+}
+
+// Destroy stops the polling goroutine.
+func (mb *MemoryBudget) Destroy() {
+	select {
+	case <-mb.stop:
+	default:
+		close(mb.stop)
+	}
+	<-mb.done
+}
+
+// heapUsage returns the polled usage of the heap plus the reservations since.
+// mb.mu must be held.
+func (mb *MemoryBudget) heapUsage(heap uint32) DeviceSize {
+	usage := int64(mb.usage[heap]) + mb.local[heap]
+	if usage < 0 {
+		return 0
+	}
+	return DeviceSize(usage)
+}
+
+// overBudget returns by how much an allocation of size bytes would go over
+// the usable part of the heap budget. mb.mu must be held.
+func (mb *MemoryBudget) overBudget(heap uint32, size DeviceSize) DeviceSize {
+	limit := DeviceSize(float64(mb.budget[heap]) * mb.headroom)
+	if total := mb.heapUsage(heap) + size; total > limit {
+		return total - limit
+	}
+	return 0
+}
@@ -0,0 +1,84 @@
+//go:build !vks_no_ext_memory_budget && !vks_no_version_1_1
+
+package vks
+
+import "testing"
+
+func TestMemoryBudgetReservations(t *testing.T) {
+	pd := nullPhysicalDevice(t)
+	device := nullDeviceOf(t, pd)
+	mb := NewMemoryBudget(pd, MemoryBudgetConfig{Headroom: 0.5})
+	defer mb.Destroy()
+	if mb.Supported() {
+		t.Skip("the driver reports VK_EXT_memory_budget; the usage is not only the reservations")
+	}
+	heaps := mb.Heaps()
+	if len(heaps) == 0 || heaps[0].Budget != heaps[0].Size {
+		t.Fatalf("heaps %+v, want the budget of a heap to be its size", heaps)
+	}
+	half := heaps[0].Size / 2
+	usage := func() DeviceSize { return mb.Heaps()[0].Usage }
+	allocate := func() DeviceMemory {
+		info := &MemoryAllocateInfo{}
+		info.SetDefaultSType()
+		info.SetAllocationSize(1)
+		var memory DeviceMemory
+		if err := device.AllocateMemory(info, nil, &memory).AsErr(); err != nil {
+			t.Fatal(err)
+		}
+		t.Cleanup(func() { device.FreeMemory(memory, nil) })
+		return memory
+	}
+
+	if mb.Reserve(uint32(len(heaps)+32), 1) {
+		t.Error("reserved memory of an unknown type")
+	}
+	if !mb.Reserve(0, half/2) || usage() != half/2 {
+		t.Fatalf("reserving a quarter of the heap left a usage of %d", usage())
+	}
+	if mb.Reserve(0, half) {
+		t.Error("reserved past the headroom")
+	}
+	if stats := mb.Stats(); stats.Refused != 1 {
+		t.Errorf("stats count %d refusals, want 1", stats.Refused)
+	}
+
+	// A failed allocation returns its reservation; a committed one keeps it
+	// until released.
+	mb.Commit(NullDeviceMemory, 0, half/2)
+	if usage() != 0 {
+		t.Errorf("usage is %d after a failed allocation, want 0", usage())
+	}
+	memory := allocate()
+	mb.Reserve(0, half/2)
+	mb.Commit(memory, 0, half/2)
+	if usage() != half/2 {
+		t.Errorf("usage is %d after an allocation, want %d", usage(), half/2)
+	}
+	mb.Release(memory)
+	mb.Release(memory)
+	if usage() != 0 {
+		t.Errorf("usage is %d after releasing the allocation twice, want 0", usage())
+	}
+
+	// The evictors run before a reservation is refused.
+	cached := allocate()
+	mb.Reserve(0, half)
+	mb.Commit(cached, 0, half)
+	mb.AddEvictor(func(heap uint32, need DeviceSize) DeviceSize {
+		if heap != 0 || need != half/2 {
+			t.Errorf("evictor called for %d bytes of heap %d, want %d of heap 0", need, heap, half/2)
+		}
+		mb.Release(cached)
+		return half
+	})
+	if !mb.Reserve(0, half/2) {
+		t.Error("the reservation was refused after the eviction")
+	}
+	if stats := mb.Stats(); stats.Evictions != 1 || stats.Evicted != half || stats.Refused != 1 {
+		t.Errorf("stats %+v, want 1 eviction of %d bytes and 1 refusal", stats, half)
+	}
+	if usage() != half/2 {
+		t.Errorf("usage is %d after the eviction, want %d", usage(), half/2)
+	}
+}
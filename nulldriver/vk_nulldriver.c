@@ -0,0 +1,2877 @@
+// Stand-in Vulkan implementation with a near zero cost per call. Every
+// command succeeds, create commands return unique fake handles, and
+// enumerations report a single handle or no elements.
+//
+// Build it as a shared library and point VKS_VULKAN_LIBRARY (or InitLibrary)
+// at it to measure the overhead of the binding without a driver.
+//
+// When VKS_NULL_SHM names a POSIX shared memory object, calls are counted in
+// it. When VKS_NULL_RECORD is also set to a record count, the arguments of
+// every call are written into a ring of that many records. The layout is a
+// vksNullShmHeader, commandCount names of VKS_NULL_NAME_SIZE bytes,
+// commandCount uint64_t call counts and recordCapacity vksNullRecords. The
+// sequence of a record is written last; records may be overwritten while
+// they are being read.
+#define VK_ENABLE_BETA_EXTENSIONS
+#define VK_NO_PROTOTYPES
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include "vulkan/vulkan.h"
+
+#define NULL_API_VERSION VK_API_VERSION_1_3
+#define VKS_NULL_SHM_MAGIC 0x4e534b56
+#define VKS_NULL_SHM_VERSION 1
+#define VKS_NULL_NAME_SIZE 64
+#define VKS_NULL_COMMAND_COUNT 250
+#define VKS_NULL_MAX_ARGS 11
+
+typedef struct vksNullShmHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t commandCount;
+	uint32_t maxArgs;
+	uint64_t recordCapacity;
+	uint64_t recordHead;
+} vksNullShmHeader;
+
+typedef struct vksNullRecord {
+	uint64_t sequence;
+	uint32_t command;
+	uint32_t argCount;
+	uint64_t args[VKS_NULL_MAX_ARGS];
+} vksNullRecord;
+
+static const char* null_names[VKS_NULL_COMMAND_COUNT] = { 
+	"vkGetImageMemoryRequirements",
+	"vkUnmapMemory",
+	"vkResetDescriptorPool",
+	"vkAllocateDescriptorSets",
+	"vkFreeDescriptorSets",
+	"vkUpdateDescriptorSets",
+	"vkFreeMemory",
+	"vkDestroyQueryPool",
+	"vkMapMemory",
+	"vkResetFences",
+	"vkFlushMappedMemoryRanges",
+	"vkInvalidateMappedMemoryRanges",
+	"vkGetDeviceMemoryCommitment",
+	"vkGetDeviceProcAddr",
+	"vkBindBufferMemory",
+	"vkGetInstanceProcAddr",
+	"vkBindImageMemory",
+	"vkEnumerateInstanceLayerProperties",
+	"vkGetBufferMemoryRequirements",
+	"vkGetPhysicalDeviceQueueFamilyProperties",
+	"vkGetPhysicalDeviceProperties",
+	"vkCreatePipelineLayout",
+	"vkGetPhysicalDeviceImageFormatProperties",
+	"vkGetImageSparseMemoryRequirements",
+	"vkCreateFramebuffer",
+	"vkDestroyFramebuffer",
+	"vkCreateRenderPass",
+	"vkDestroyRenderPass",
+	"vkGetRenderAreaGranularity",
+	"vkGetPhysicalDeviceFormatProperties",
+	"vkGetPhysicalDeviceFeatures",
+	"vkDestroyPipeline",
+	"vkEnumeratePhysicalDevices",
+	"vkDestroyInstance",
+	"vkCreateInstance",
+	"vkCreateComputePipelines",
+	"vkCreateGraphicsPipelines",
+	"vkGetPhysicalDeviceSparseImageFormatProperties",
+	"vkQueueBindSparse",
+	"vkMergePipelineCaches",
+	"vkGetPipelineCacheData",
+	"vkDestroyPipelineCache",
+	"vkCreatePipelineCache",
+	"vkDestroyShaderModule",
+	"vkCreateShaderModule",
+	"vkDestroyImageView",
+	"vkCreateDescriptorPool",
+	"vkCreateImageView",
+	"vkCreateFence",
+	"vkGetImageSubresourceLayout",
+	"vkDestroyDescriptorSetLayout",
+	"vkCreateDescriptorSetLayout",
+	"vkCreateCommandPool",
+	"vkDestroyCommandPool",
+	"vkResetCommandPool",
+	"vkAllocateMemory",
+	"vkDeviceWaitIdle",
+	"vkQueueWaitIdle",
+	"vkDestroyImage",
+	"vkQueueSubmit",
+	"vkGetDeviceQueue",
+	"vkAllocateCommandBuffers",
+	"vkFreeCommandBuffers",
+	"vkBeginCommandBuffer",
+	"vkEndCommandBuffer",
+	"vkResetCommandBuffer",
+	"vkEnumerateDeviceLayerProperties",
+	"vkCreateImage",
+	"vkCreateBuffer",
+	"vkDestroyDescriptorPool",
+	"vkGetPhysicalDeviceMemoryProperties",
+	"vkEnumerateDeviceExtensionProperties",
+	"vkDestroySampler",
+	"vkCreateSampler",
+	"vkEnumerateInstanceExtensionProperties",
+	"vkDestroyDevice",
+	"vkDestroyBufferView",
+	"vkCmdBindPipeline",
+	"vkCmdSetViewport",
+	"vkCmdSetScissor",
+	"vkCmdSetLineWidth",
+	"vkCmdSetDepthBias",
+	"vkCmdSetBlendConstants",
+	"vkCmdSetDepthBounds",
+	"vkCmdSetStencilCompareMask",
+	"vkCmdSetStencilWriteMask",
+	"vkCmdSetStencilReference",
+	"vkCmdBindDescriptorSets",
+	"vkCmdBindIndexBuffer",
+	"vkCmdBindVertexBuffers",
+	"vkCmdDraw",
+	"vkCmdDrawIndexed",
+	"vkCmdDrawIndirect",
+	"vkCmdDrawIndexedIndirect",
+	"vkCmdDispatch",
+	"vkCmdDispatchIndirect",
+	"vkCmdCopyBuffer",
+	"vkCmdCopyImage",
+	"vkCmdBlitImage",
+	"vkCmdCopyBufferToImage",
+	"vkCmdCopyImageToBuffer",
+	"vkCmdUpdateBuffer",
+	"vkCmdFillBuffer",
+	"vkCmdClearColorImage",
+	"vkCmdClearDepthStencilImage",
+	"vkCmdClearAttachments",
+	"vkCmdResolveImage",
+	"vkCmdSetEvent",
+	"vkCmdResetEvent",
+	"vkCmdWaitEvents",
+	"vkCmdPipelineBarrier",
+	"vkCmdBeginQuery",
+	"vkCmdEndQuery",
+	"vkCmdResetQueryPool",
+	"vkCmdWriteTimestamp",
+	"vkCmdCopyQueryPoolResults",
+	"vkCmdPushConstants",
+	"vkCmdBeginRenderPass",
+	"vkCmdNextSubpass",
+	"vkCmdEndRenderPass",
+	"vkCmdExecuteCommands",
+	"vkCreateBufferView",
+	"vkGetFenceStatus",
+	"vkWaitForFences",
+	"vkCreateDevice",
+	"vkCreateSemaphore",
+	"vkDestroySemaphore",
+	"vkDestroyPipelineLayout",
+	"vkDestroyBuffer",
+	"vkDestroyFence",
+	"vkCreateEvent",
+	"vkDestroyEvent",
+	"vkGetEventStatus",
+	"vkSetEvent",
+	"vkResetEvent",
+	"vkCreateQueryPool",
+	"vkGetQueryPoolResults",
+	"vkGetPhysicalDeviceFormatProperties2",
+	"vkGetPhysicalDeviceExternalFenceProperties",
+	"vkGetPhysicalDeviceExternalBufferProperties",
+	"vkUpdateDescriptorSetWithTemplate",
+	"vkDestroyDescriptorUpdateTemplate",
+	"vkCreateDescriptorUpdateTemplate",
+	"vkDestroySamplerYcbcrConversion",
+	"vkCreateSamplerYcbcrConversion",
+	"vkGetDeviceQueue2",
+	"vkTrimCommandPool",
+	"vkGetPhysicalDeviceExternalSemaphoreProperties",
+	"vkGetPhysicalDeviceSparseImageFormatProperties2",
+	"vkGetPhysicalDeviceMemoryProperties2",
+	"vkGetPhysicalDeviceQueueFamilyProperties2",
+	"vkGetPhysicalDeviceImageFormatProperties2",
+	"vkGetPhysicalDeviceProperties2",
+	"vkGetPhysicalDeviceFeatures2",
+	"vkGetImageSparseMemoryRequirements2",
+	"vkGetBufferMemoryRequirements2",
+	"vkGetDescriptorSetLayoutSupport",
+	"vkGetImageMemoryRequirements2",
+	"vkEnumeratePhysicalDeviceGroups",
+	"vkCmdDispatchBase",
+	"vkCmdSetDeviceMask",
+	"vkGetDeviceGroupPeerMemoryFeatures",
+	"vkBindImageMemory2",
+	"vkBindBufferMemory2",
+	"vkEnumerateInstanceVersion",
+	"vkCmdBeginRenderPass2",
+	"vkGetBufferOpaqueCaptureAddress",
+	"vkGetBufferDeviceAddress",
+	"vkCmdDrawIndirectCount",
+	"vkCmdDrawIndexedIndirectCount",
+	"vkCreateRenderPass2",
+	"vkGetDeviceMemoryOpaqueCaptureAddress",
+	"vkCmdNextSubpass2",
+	"vkCmdEndRenderPass2",
+	"vkSignalSemaphore",
+	"vkWaitSemaphores",
+	"vkGetSemaphoreCounterValue",
+	"vkResetQueryPool",
+	"vkCmdWriteTimestamp2",
+	"vkCmdCopyImage2",
+	"vkCmdSetDepthBoundsTestEnable",
+	"vkCmdSetStencilOp",
+	"vkCmdSetDepthWriteEnable",
+	"vkCmdSetDepthTestEnable",
+	"vkCmdBindVertexBuffers2",
+	"vkCmdSetScissorWithCount",
+	"vkCmdSetViewportWithCount",
+	"vkCmdSetPrimitiveTopology",
+	"vkCmdSetFrontFace",
+	"vkCmdSetCullMode",
+	"vkCmdSetEvent2",
+	"vkCmdEndRendering",
+	"vkCmdBeginRendering",
+	"vkCmdResetEvent2",
+	"vkCmdWaitEvents2",
+	"vkCmdPipelineBarrier2",
+	"vkCmdSetDepthCompareOp",
+	"vkCmdSetStencilTestEnable",
+	"vkCmdSetPrimitiveRestartEnable",
+	"vkCmdSetDepthBiasEnable",
+	"vkQueueSubmit2",
+	"vkGetPhysicalDeviceToolProperties",
+	"vkCmdResolveImage2",
+	"vkGetDeviceBufferMemoryRequirements",
+	"vkGetDeviceImageMemoryRequirements",
+	"vkGetDeviceImageSparseMemoryRequirements",
+	"vkGetPrivateData",
+	"vkSetPrivateData",
+	"vkDestroyPrivateDataSlot",
+	"vkCreatePrivateDataSlot",
+	"vkCmdBlitImage2",
+	"vkCmdCopyImageToBuffer2",
+	"vkCmdCopyBufferToImage2",
+	"vkCmdSetRasterizerDiscardEnable",
+	"vkCmdCopyBuffer2",
+	"vkCreateDebugReportCallbackEXT",
+	"vkDebugReportMessageEXT",
+	"vkDestroyDebugReportCallbackEXT",
+	"vkGetPhysicalDeviceSurfacePresentModesKHR",
+	"vkGetPhysicalDeviceSurfaceFormatsKHR",
+	"vkGetPhysicalDeviceSurfaceCapabilitiesKHR",
+	"vkGetPhysicalDeviceSurfaceSupportKHR",
+	"vkDestroySurfaceKHR",
+	"vkGetPhysicalDeviceSurfaceCapabilities2KHR",
+	"vkGetPhysicalDeviceSurfaceFormats2KHR",
+	"vkCreateSwapchainKHR",
+	"vkAcquireNextImageKHR",
+	"vkQueuePresentKHR",
+	"vkAcquireNextImage2KHR",
+	"vkGetPhysicalDevicePresentRectanglesKHR",
+	"vkGetSwapchainImagesKHR",
+	"vkGetDeviceGroupSurfacePresentModesKHR",
+	"vkDestroySwapchainKHR",
+	"vkGetDeviceGroupPresentCapabilitiesKHR",
+	"vkGetPhysicalDeviceDisplayPropertiesKHR",
+	"vkGetDisplayPlaneCapabilitiesKHR",
+	"vkGetPhysicalDeviceDisplayPlanePropertiesKHR",
+	"vkCreateDisplayModeKHR",
+	"vkGetDisplayModePropertiesKHR",
+	"vkCreateDisplayPlaneSurfaceKHR",
+	"vkGetDisplayPlaneSupportedDisplaysKHR",
+	"vkGetPhysicalDeviceDisplayPlaneProperties2KHR",
+	"vkGetPhysicalDeviceDisplayProperties2KHR",
+	"vkGetDisplayPlaneCapabilities2KHR",
+	"vkGetDisplayModeProperties2KHR",
+	"vkCreateSharedSwapchainsKHR",
+	"vkGetMemoryFdKHR",
+	"vkGetMemoryFdPropertiesKHR",
+	"vkImportSemaphoreFdKHR",
+	"vkGetSemaphoreFdKHR",
+};
+
+static vksNullShmHeader* null_shm = NULL;
+static uint64_t* null_counts = NULL;
+static vksNullRecord* null_records = NULL;
+
+__attribute__((constructor)) static void null_init() {
+	const char* name = getenv("VKS_NULL_SHM");
+	if (name == NULL || name[0] == '\0') {
+		return;
+	}
+	const char* record = getenv("VKS_NULL_RECORD");
+	uint64_t capacity = record == NULL ? 0 : strtoull(record, NULL, 10);
+	size_t namesSize = VKS_NULL_COMMAND_COUNT * VKS_NULL_NAME_SIZE;
+	size_t countsSize = VKS_NULL_COMMAND_COUNT * sizeof(uint64_t);
+	size_t size = sizeof(vksNullShmHeader) + namesSize + countsSize + capacity * sizeof(vksNullRecord);
+
+	int fd = shm_open(name, O_RDWR | O_CREAT, 0600);
+	if (fd < 0) {
+		return;
+	}
+	if (ftruncate(fd, size) != 0) {
+		close(fd);
+		return;
+	}
+	void* ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (ptr == MAP_FAILED) {
+		return;
+	}
+
+	memset(ptr, 0, size);
+	vksNullShmHeader* hdr = ptr;
+	hdr->commandCount = VKS_NULL_COMMAND_COUNT;
+	hdr->maxArgs = VKS_NULL_MAX_ARGS;
+	hdr->recordCapacity = capacity;
+	char* names = (char*)(hdr + 1);
+	for (int i = 0; i < VKS_NULL_COMMAND_COUNT; i++) {
+		strncpy(names + i * VKS_NULL_NAME_SIZE, null_names[i], VKS_NULL_NAME_SIZE - 1);
+	}
+	null_counts = (uint64_t*)(names + namesSize);
+	null_records = capacity > 0 ? (vksNullRecord*)(null_counts + VKS_NULL_COMMAND_COUNT) : NULL;
+	hdr->version = VKS_NULL_SHM_VERSION;
+	__atomic_store_n(&hdr->magic, VKS_NULL_SHM_MAGIC, __ATOMIC_RELEASE);
+	null_shm = hdr;
+}
+
+static void null_trace(uint32_t command, const uint64_t* args, uint32_t argCount) {
+	__atomic_add_fetch(&null_counts[command], 1, __ATOMIC_RELAXED);
+	if (null_records == NULL) {
+		return;
+	}
+	uint64_t sequence = __atomic_add_fetch(&null_shm->recordHead, 1, __ATOMIC_RELAXED);
+	vksNullRecord* rec = &null_records[(sequence - 1) % null_shm->recordCapacity];
+	rec->command = command;
+	rec->argCount = argCount;
+	memcpy(rec->args, args, argCount * sizeof(uint64_t));
+	__atomic_store_n(&rec->sequence, sequence, __ATOMIC_RELEASE);
+}
+
+static uint64_t null_f32(float f) {
+	uint32_t bits;
+	memcpy(&bits, &f, sizeof(bits));
+	return bits;
+}
+
+// Dispatchable handles must point at memory starting with the loader magic.
+typedef struct null_object {
+	uintptr_t loaderMagic;
+	uint64_t id;
+} null_object;
+
+static uint64_t null_next_handle = 0;
+static null_object null_physical_device = { 0x01CDC0DE, 0 };
+static null_object null_queue = { 0x01CDC0DE, 0 };
+
+static uint64_t null_handle() {
+	return __atomic_add_fetch(&null_next_handle, 1, __ATOMIC_RELAXED);
+}
+
+static void* null_dispatchable() {
+	null_object* obj = malloc(sizeof(null_object));
+	if (obj != NULL) {
+		obj->loaderMagic = 0x01CDC0DE;
+		obj->id = null_handle();
+	}
+	return obj;
+}
+
+// Buffers and images remember their size to report memory requirements.
+typedef struct null_sized {
+	VkDeviceSize size;
+} null_sized;
+
+static VkDeviceSize null_image_size(const VkImageCreateInfo* info) {
+	// An upper bound of 16 bytes per texel, with room for the mip chain.
+	VkDeviceSize texels = (VkDeviceSize)info->extent.width * info->extent.height * info->extent.depth;
+	return texels * info->arrayLayers * 16 * (info->mipLevels > 1 ? 2 : 1);
+}
+
+static void null_memory_requirements(VkDeviceSize size, VkMemoryRequirements* reqs) {
+	reqs->alignment = 256;
+	reqs->size = (size + reqs->alignment - 1) & ~(reqs->alignment - 1);
+	reqs->memoryTypeBits = 1;
+}
+
+static void null_memory_properties(VkPhysicalDeviceMemoryProperties* props) {
+	memset(props, 0, sizeof(*props));
+	props->memoryTypeCount = 1;
+	props->memoryTypes[0].propertyFlags = VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT |
+		VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT |
+		VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+	props->memoryTypes[0].heapIndex = 0;
+	props->memoryHeapCount = 1;
+	props->memoryHeaps[0].size = (VkDeviceSize)1 << 32;
+	props->memoryHeaps[0].flags = VK_MEMORY_HEAP_DEVICE_LOCAL_BIT;
+}
+
+static void null_queue_family_properties(VkQueueFamilyProperties* props) {
+	memset(props, 0, sizeof(*props));
+	props->queueFlags = VK_QUEUE_GRAPHICS_BIT | VK_QUEUE_COMPUTE_BIT | VK_QUEUE_TRANSFER_BIT;
+	props->queueCount = 1;
+	props->timestampValidBits = 64;
+	props->minImageTransferGranularity.width = 1;
+	props->minImageTransferGranularity.height = 1;
+	props->minImageTransferGranularity.depth = 1;
+}
+
+static void null_physical_device_properties(VkPhysicalDeviceProperties* props) {
+	memset(props, 0, sizeof(*props));
+	props->apiVersion = NULL_API_VERSION;
+	props->driverVersion = 1;
+	props->deviceType = VK_PHYSICAL_DEVICE_TYPE_CPU;
+	strncpy(props->deviceName, "vks null driver", VK_MAX_PHYSICAL_DEVICE_NAME_SIZE - 1);
+
+	VkPhysicalDeviceLimits* limits = &props->limits;
+	limits->maxImageDimension1D = 16384;
+	limits->maxImageDimension2D = 16384;
+	limits->maxImageDimension3D = 2048;
+	limits->maxImageDimensionCube = 16384;
+	limits->maxImageArrayLayers = 2048;
+	limits->maxUniformBufferRange = 65536;
+	limits->maxStorageBufferRange = UINT32_MAX;
+	limits->maxPushConstantsSize = 256;
+	limits->maxMemoryAllocationCount = UINT32_MAX;
+	limits->maxSamplerAllocationCount = UINT32_MAX;
+	limits->bufferImageGranularity = 1;
+	limits->maxBoundDescriptorSets = 32;
+	limits->maxPerStageResources = UINT32_MAX;
+	limits->maxDescriptorSetUniformBuffersDynamic = 16;
+	limits->maxDescriptorSetStorageBuffersDynamic = 16;
+	limits->maxVertexInputAttributes = 32;
+	limits->maxVertexInputBindings = 32;
+	limits->maxComputeSharedMemorySize = 65536;
+	limits->maxComputeWorkGroupCount[0] = 65535;
+	limits->maxComputeWorkGroupCount[1] = 65535;
+	limits->maxComputeWorkGroupCount[2] = 65535;
+	limits->maxComputeWorkGroupInvocations = 1024;
+	limits->maxComputeWorkGroupSize[0] = 1024;
+	limits->maxComputeWorkGroupSize[1] = 1024;
+	limits->maxComputeWorkGroupSize[2] = 64;
+	limits->maxViewports = 16;
+	limits->maxViewportDimensions[0] = 16384;
+	limits->maxViewportDimensions[1] = 16384;
+	limits->minMemoryMapAlignment = 64;
+	limits->minTexelBufferOffsetAlignment = 16;
+	limits->minUniformBufferOffsetAlignment = 256;
+	limits->minStorageBufferOffsetAlignment = 256;
+	limits->maxFramebufferWidth = 16384;
+	limits->maxFramebufferHeight = 16384;
+	limits->maxFramebufferLayers = 2048;
+	limits->maxColorAttachments = 8;
+	limits->timestampComputeAndGraphics = VK_TRUE;
+	limits->timestampPeriod = 1.0f;
+	limits->optimalBufferCopyOffsetAlignment = 1;
+	limits->optimalBufferCopyRowPitchAlignment = 1;
+	limits->nonCoherentAtomSize = 64;
+}
+
+static PFN_vkVoidFunction null_lookup(const char* pName);
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetImageMemoryRequirements(VkDevice device, VkImage image, VkMemoryRequirements* pMemoryRequirements) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)image, (uint64_t)(uintptr_t)pMemoryRequirements };
+		null_trace(0, args, 3);
+	}
+	null_memory_requirements(((null_sized*)(uintptr_t)image)->size, pMemoryRequirements);
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkUnmapMemory(VkDevice device, VkDeviceMemory memory) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)memory };
+		null_trace(1, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkResetDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)descriptorPool, (uint64_t)flags };
+		null_trace(2, args, 3);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkAllocateDescriptorSets(VkDevice device, VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pAllocateInfo, (uint64_t)(uintptr_t)pDescriptorSets };
+		null_trace(3, args, 3);
+	}
+	for (uint32_t i = 0; i < pAllocateInfo->descriptorSetCount; i++) {
+		pDescriptorSets[i] = (VkDescriptorSet)(uintptr_t)null_handle();
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkFreeDescriptorSets(VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount, VkDescriptorSet* pDescriptorSets) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)descriptorPool, (uint64_t)descriptorSetCount, (uint64_t)(uintptr_t)pDescriptorSets };
+		null_trace(4, args, 4);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkUpdateDescriptorSets(VkDevice device, uint32_t descriptorWriteCount, VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount, VkCopyDescriptorSet* pDescriptorCopies) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)descriptorWriteCount, (uint64_t)(uintptr_t)pDescriptorWrites, (uint64_t)descriptorCopyCount, (uint64_t)(uintptr_t)pDescriptorCopies };
+		null_trace(5, args, 5);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkFreeMemory(VkDevice device, VkDeviceMemory memory, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)memory, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(6, args, 3);
+	}
+	free((void*)(uintptr_t)memory);
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyQueryPool(VkDevice device, VkQueryPool queryPool, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)queryPool, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(7, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkMapMemory(VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)memory, (uint64_t)offset, (uint64_t)size, (uint64_t)flags, (uint64_t)(uintptr_t)ppData };
+		null_trace(8, args, 6);
+	}
+	*ppData = (char*)(uintptr_t)memory + offset;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkResetFences(VkDevice device, uint32_t fenceCount, VkFence* pFences) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)fenceCount, (uint64_t)(uintptr_t)pFences };
+		null_trace(9, args, 3);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkFlushMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, VkMappedMemoryRange* pMemoryRanges) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)memoryRangeCount, (uint64_t)(uintptr_t)pMemoryRanges };
+		null_trace(10, args, 3);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkInvalidateMappedMemoryRanges(VkDevice device, uint32_t memoryRangeCount, VkMappedMemoryRange* pMemoryRanges) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)memoryRangeCount, (uint64_t)(uintptr_t)pMemoryRanges };
+		null_trace(11, args, 3);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceMemoryCommitment(VkDevice device, VkDeviceMemory memory, VkDeviceSize* pCommittedMemoryInBytes) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)memory, (uint64_t)(uintptr_t)pCommittedMemoryInBytes };
+		null_trace(12, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL null_vkGetDeviceProcAddr(VkDevice device, char* pName) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pName };
+		null_trace(13, args, 2);
+	}
+	return null_lookup(pName);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkBindBufferMemory(VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)buffer, (uint64_t)(uintptr_t)memory, (uint64_t)memoryOffset };
+		null_trace(14, args, 4);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL null_vkGetInstanceProcAddr(VkInstance instance, char* pName) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)instance, (uint64_t)(uintptr_t)pName };
+		null_trace(15, args, 2);
+	}
+	return null_lookup(pName);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkBindImageMemory(VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)image, (uint64_t)(uintptr_t)memory, (uint64_t)memoryOffset };
+		null_trace(16, args, 4);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkEnumerateInstanceLayerProperties(uint32_t* pPropertyCount, VkLayerProperties* pProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)pPropertyCount, (uint64_t)(uintptr_t)pProperties };
+		null_trace(17, args, 2);
+	}
+	*pPropertyCount = 0;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetBufferMemoryRequirements(VkDevice device, VkBuffer buffer, VkMemoryRequirements* pMemoryRequirements) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)buffer, (uint64_t)(uintptr_t)pMemoryRequirements };
+		null_trace(18, args, 3);
+	}
+	null_memory_requirements(((null_sized*)(uintptr_t)buffer)->size, pMemoryRequirements);
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceQueueFamilyProperties(VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties* pQueueFamilyProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pQueueFamilyPropertyCount, (uint64_t)(uintptr_t)pQueueFamilyProperties };
+		null_trace(19, args, 3);
+	}
+	if (pQueueFamilyProperties == NULL) {
+		*pQueueFamilyPropertyCount = 1;
+	} else if (*pQueueFamilyPropertyCount > 0) {
+		*pQueueFamilyPropertyCount = 1;
+		null_queue_family_properties(pQueueFamilyProperties);
+	}
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties* pProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pProperties };
+		null_trace(20, args, 2);
+	}
+	null_physical_device_properties(pProperties);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreatePipelineLayout(VkDevice device, VkPipelineLayoutCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pPipelineLayout };
+		null_trace(21, args, 4);
+	}
+	*pPipelineLayout = (VkPipelineLayout)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkImageFormatProperties* pImageFormatProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)format, (uint64_t)type, (uint64_t)tiling, (uint64_t)usage, (uint64_t)flags, (uint64_t)(uintptr_t)pImageFormatProperties };
+		null_trace(22, args, 7);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetImageSparseMemoryRequirements(VkDevice device, VkImage image, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements* pSparseMemoryRequirements) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)image, (uint64_t)(uintptr_t)pSparseMemoryRequirementCount, (uint64_t)(uintptr_t)pSparseMemoryRequirements };
+		null_trace(23, args, 4);
+	}
+	*pSparseMemoryRequirementCount = 0;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateFramebuffer(VkDevice device, VkFramebufferCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pFramebuffer };
+		null_trace(24, args, 4);
+	}
+	*pFramebuffer = (VkFramebuffer)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyFramebuffer(VkDevice device, VkFramebuffer framebuffer, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)framebuffer, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(25, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateRenderPass(VkDevice device, VkRenderPassCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pRenderPass };
+		null_trace(26, args, 4);
+	}
+	*pRenderPass = (VkRenderPass)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyRenderPass(VkDevice device, VkRenderPass renderPass, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)renderPass, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(27, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetRenderAreaGranularity(VkDevice device, VkRenderPass renderPass, VkExtent2D* pGranularity) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)renderPass, (uint64_t)(uintptr_t)pGranularity };
+		null_trace(28, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties* pFormatProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)format, (uint64_t)(uintptr_t)pFormatProperties };
+		null_trace(29, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceFeatures(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures* pFeatures) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pFeatures };
+		null_trace(30, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyPipeline(VkDevice device, VkPipeline pipeline, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pipeline, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(31, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkEnumeratePhysicalDevices(VkInstance instance, uint32_t* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)instance, (uint64_t)(uintptr_t)pPhysicalDeviceCount, (uint64_t)(uintptr_t)pPhysicalDevices };
+		null_trace(32, args, 3);
+	}
+	if (pPhysicalDevices == NULL) {
+		*pPhysicalDeviceCount = 1;
+	} else if (*pPhysicalDeviceCount > 0) {
+		*pPhysicalDeviceCount = 1;
+		pPhysicalDevices[0] = (VkPhysicalDevice)&null_physical_device;
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyInstance(VkInstance instance, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)instance, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(33, args, 2);
+	}
+	free(instance);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateInstance(VkInstanceCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkInstance* pInstance) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pInstance };
+		null_trace(34, args, 3);
+	}
+	*pInstance = (VkInstance)null_dispatchable();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateComputePipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, VkComputePipelineCreateInfo* pCreateInfos, VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pipelineCache, (uint64_t)createInfoCount, (uint64_t)(uintptr_t)pCreateInfos, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pPipelines };
+		null_trace(35, args, 6);
+	}
+	for (uint32_t i = 0; i < createInfoCount; i++) {
+		pPipelines[i] = (VkPipeline)(uintptr_t)null_handle();
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateGraphicsPipelines(VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, VkGraphicsPipelineCreateInfo* pCreateInfos, VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pipelineCache, (uint64_t)createInfoCount, (uint64_t)(uintptr_t)pCreateInfos, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pPipelines };
+		null_trace(36, args, 6);
+	}
+	for (uint32_t i = 0; i < createInfoCount; i++) {
+		pPipelines[i] = (VkPipeline)(uintptr_t)null_handle();
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceSparseImageFormatProperties(VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkSampleCountFlagBits samples, VkImageUsageFlags usage, VkImageTiling tiling, uint32_t* pPropertyCount, VkSparseImageFormatProperties* pProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)format, (uint64_t)type, (uint64_t)samples, (uint64_t)usage, (uint64_t)tiling, (uint64_t)(uintptr_t)pPropertyCount, (uint64_t)(uintptr_t)pProperties };
+		null_trace(37, args, 8);
+	}
+	*pPropertyCount = 0;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkQueueBindSparse(VkQueue queue, uint32_t bindInfoCount, VkBindSparseInfo* pBindInfo, VkFence fence) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)queue, (uint64_t)bindInfoCount, (uint64_t)(uintptr_t)pBindInfo, (uint64_t)(uintptr_t)fence };
+		null_trace(38, args, 4);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkMergePipelineCaches(VkDevice device, VkPipelineCache dstCache, uint32_t srcCacheCount, VkPipelineCache* pSrcCaches) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)dstCache, (uint64_t)srcCacheCount, (uint64_t)(uintptr_t)pSrcCaches };
+		null_trace(39, args, 4);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPipelineCacheData(VkDevice device, VkPipelineCache pipelineCache, size_t* pDataSize, void* pData) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pipelineCache, (uint64_t)(uintptr_t)pDataSize, (uint64_t)(uintptr_t)pData };
+		null_trace(40, args, 4);
+	}
+	*pDataSize = 0;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyPipelineCache(VkDevice device, VkPipelineCache pipelineCache, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pipelineCache, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(41, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreatePipelineCache(VkDevice device, VkPipelineCacheCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pPipelineCache };
+		null_trace(42, args, 4);
+	}
+	*pPipelineCache = (VkPipelineCache)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyShaderModule(VkDevice device, VkShaderModule shaderModule, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)shaderModule, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(43, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateShaderModule(VkDevice device, VkShaderModuleCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pShaderModule };
+		null_trace(44, args, 4);
+	}
+	*pShaderModule = (VkShaderModule)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyImageView(VkDevice device, VkImageView imageView, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)imageView, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(45, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateDescriptorPool(VkDevice device, VkDescriptorPoolCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pDescriptorPool };
+		null_trace(46, args, 4);
+	}
+	*pDescriptorPool = (VkDescriptorPool)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateImageView(VkDevice device, VkImageViewCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkImageView* pView) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pView };
+		null_trace(47, args, 4);
+	}
+	*pView = (VkImageView)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateFence(VkDevice device, VkFenceCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkFence* pFence) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pFence };
+		null_trace(48, args, 4);
+	}
+	*pFence = (VkFence)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetImageSubresourceLayout(VkDevice device, VkImage image, VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)image, (uint64_t)(uintptr_t)pSubresource, (uint64_t)(uintptr_t)pLayout };
+		null_trace(49, args, 4);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyDescriptorSetLayout(VkDevice device, VkDescriptorSetLayout descriptorSetLayout, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)descriptorSetLayout, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(50, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateDescriptorSetLayout(VkDevice device, VkDescriptorSetLayoutCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pSetLayout };
+		null_trace(51, args, 4);
+	}
+	*pSetLayout = (VkDescriptorSetLayout)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateCommandPool(VkDevice device, VkCommandPoolCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pCommandPool };
+		null_trace(52, args, 4);
+	}
+	*pCommandPool = (VkCommandPool)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyCommandPool(VkDevice device, VkCommandPool commandPool, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)commandPool, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(53, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkResetCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)commandPool, (uint64_t)flags };
+		null_trace(54, args, 3);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkAllocateMemory(VkDevice device, VkMemoryAllocateInfo* pAllocateInfo, VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pAllocateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pMemory };
+		null_trace(55, args, 4);
+	}
+	void* mem = calloc(1, pAllocateInfo->allocationSize > 0 ? pAllocateInfo->allocationSize : 1);
+	if (mem == NULL) {
+		return VK_ERROR_OUT_OF_HOST_MEMORY;
+	}
+	*pMemory = (VkDeviceMemory)(uintptr_t)mem;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkDeviceWaitIdle(VkDevice device) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device };
+		null_trace(56, args, 1);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkQueueWaitIdle(VkQueue queue) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)queue };
+		null_trace(57, args, 1);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyImage(VkDevice device, VkImage image, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)image, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(58, args, 3);
+	}
+	free((void*)(uintptr_t)image);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkQueueSubmit(VkQueue queue, uint32_t submitCount, VkSubmitInfo* pSubmits, VkFence fence) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)queue, (uint64_t)submitCount, (uint64_t)(uintptr_t)pSubmits, (uint64_t)(uintptr_t)fence };
+		null_trace(59, args, 4);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceQueue(VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)queueFamilyIndex, (uint64_t)queueIndex, (uint64_t)(uintptr_t)pQueue };
+		null_trace(60, args, 4);
+	}
+	*pQueue = (VkQueue)&null_queue;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkAllocateCommandBuffers(VkDevice device, VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pAllocateInfo, (uint64_t)(uintptr_t)pCommandBuffers };
+		null_trace(61, args, 3);
+	}
+	for (uint32_t i = 0; i < pAllocateInfo->commandBufferCount; i++) {
+		pCommandBuffers[i] = (VkCommandBuffer)null_dispatchable();
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkFreeCommandBuffers(VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, VkCommandBuffer* pCommandBuffers) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)commandPool, (uint64_t)commandBufferCount, (uint64_t)(uintptr_t)pCommandBuffers };
+		null_trace(62, args, 4);
+	}
+	for (uint32_t i = 0; i < commandBufferCount; i++) {
+		free(pCommandBuffers[i]);
+	}
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkBeginCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferBeginInfo* pBeginInfo) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)pBeginInfo };
+		null_trace(63, args, 2);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkEndCommandBuffer(VkCommandBuffer commandBuffer) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer };
+		null_trace(64, args, 1);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkResetCommandBuffer(VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)flags };
+		null_trace(65, args, 2);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkEnumerateDeviceLayerProperties(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkLayerProperties* pProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pPropertyCount, (uint64_t)(uintptr_t)pProperties };
+		null_trace(66, args, 3);
+	}
+	*pPropertyCount = 0;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateImage(VkDevice device, VkImageCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkImage* pImage) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pImage };
+		null_trace(67, args, 4);
+	}
+	null_sized* obj = malloc(sizeof(null_sized));
+	if (obj == NULL) {
+		return VK_ERROR_OUT_OF_HOST_MEMORY;
+	}
+	obj->size = null_image_size(pCreateInfo);
+	*pImage = (VkImage)(uintptr_t)obj;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateBuffer(VkDevice device, VkBufferCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pBuffer };
+		null_trace(68, args, 4);
+	}
+	null_sized* obj = malloc(sizeof(null_sized));
+	if (obj == NULL) {
+		return VK_ERROR_OUT_OF_HOST_MEMORY;
+	}
+	obj->size = pCreateInfo->size;
+	*pBuffer = (VkBuffer)(uintptr_t)obj;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyDescriptorPool(VkDevice device, VkDescriptorPool descriptorPool, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)descriptorPool, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(69, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceMemoryProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties* pMemoryProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pMemoryProperties };
+		null_trace(70, args, 2);
+	}
+	null_memory_properties(pMemoryProperties);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkEnumerateDeviceExtensionProperties(VkPhysicalDevice physicalDevice, char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pLayerName, (uint64_t)(uintptr_t)pPropertyCount, (uint64_t)(uintptr_t)pProperties };
+		null_trace(71, args, 4);
+	}
+	*pPropertyCount = 0;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroySampler(VkDevice device, VkSampler sampler, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)sampler, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(72, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateSampler(VkDevice device, VkSamplerCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkSampler* pSampler) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pSampler };
+		null_trace(73, args, 4);
+	}
+	*pSampler = (VkSampler)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkEnumerateInstanceExtensionProperties(char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)pLayerName, (uint64_t)(uintptr_t)pPropertyCount, (uint64_t)(uintptr_t)pProperties };
+		null_trace(74, args, 3);
+	}
+	*pPropertyCount = 0;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyDevice(VkDevice device, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(75, args, 2);
+	}
+	free(device);
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyBufferView(VkDevice device, VkBufferView bufferView, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)bufferView, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(76, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindPipeline(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)pipelineBindPoint, (uint64_t)(uintptr_t)pipeline };
+		null_trace(77, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetViewport(VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, VkViewport* pViewports) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)firstViewport, (uint64_t)viewportCount, (uint64_t)(uintptr_t)pViewports };
+		null_trace(78, args, 4);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetScissor(VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, VkRect2D* pScissors) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)firstScissor, (uint64_t)scissorCount, (uint64_t)(uintptr_t)pScissors };
+		null_trace(79, args, 4);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetLineWidth(VkCommandBuffer commandBuffer, float lineWidth) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, null_f32(lineWidth) };
+		null_trace(80, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthBias(VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, null_f32(depthBiasConstantFactor), null_f32(depthBiasClamp), null_f32(depthBiasSlopeFactor) };
+		null_trace(81, args, 4);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetBlendConstants(VkCommandBuffer commandBuffer, float blendConstants[4]) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)blendConstants };
+		null_trace(82, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthBounds(VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, null_f32(minDepthBounds), null_f32(maxDepthBounds) };
+		null_trace(83, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetStencilCompareMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t compareMask) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)faceMask, (uint64_t)compareMask };
+		null_trace(84, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetStencilWriteMask(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)faceMask, (uint64_t)writeMask };
+		null_trace(85, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetStencilReference(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)faceMask, (uint64_t)reference };
+		null_trace(86, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindDescriptorSets(VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, uint32_t* pDynamicOffsets) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)pipelineBindPoint, (uint64_t)(uintptr_t)layout, (uint64_t)firstSet, (uint64_t)descriptorSetCount, (uint64_t)(uintptr_t)pDescriptorSets, (uint64_t)dynamicOffsetCount, (uint64_t)(uintptr_t)pDynamicOffsets };
+		null_trace(87, args, 8);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindIndexBuffer(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)buffer, (uint64_t)offset, (uint64_t)indexType };
+		null_trace(88, args, 4);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindVertexBuffers(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, VkBuffer* pBuffers, VkDeviceSize* pOffsets) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)firstBinding, (uint64_t)bindingCount, (uint64_t)(uintptr_t)pBuffers, (uint64_t)(uintptr_t)pOffsets };
+		null_trace(89, args, 5);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDraw(VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)vertexCount, (uint64_t)instanceCount, (uint64_t)firstVertex, (uint64_t)firstInstance };
+		null_trace(90, args, 5);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawIndexed(VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)indexCount, (uint64_t)instanceCount, (uint64_t)firstIndex, (uint64_t)vertexOffset, (uint64_t)firstInstance };
+		null_trace(91, args, 6);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)buffer, (uint64_t)offset, (uint64_t)drawCount, (uint64_t)stride };
+		null_trace(92, args, 5);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawIndexedIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)buffer, (uint64_t)offset, (uint64_t)drawCount, (uint64_t)stride };
+		null_trace(93, args, 5);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDispatch(VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)groupCountX, (uint64_t)groupCountY, (uint64_t)groupCountZ };
+		null_trace(94, args, 4);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDispatchIndirect(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)buffer, (uint64_t)offset };
+		null_trace(95, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyBuffer(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, VkBufferCopy* pRegions) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)srcBuffer, (uint64_t)(uintptr_t)dstBuffer, (uint64_t)regionCount, (uint64_t)(uintptr_t)pRegions };
+		null_trace(96, args, 5);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, VkImageCopy* pRegions) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)srcImage, (uint64_t)srcImageLayout, (uint64_t)(uintptr_t)dstImage, (uint64_t)dstImageLayout, (uint64_t)regionCount, (uint64_t)(uintptr_t)pRegions };
+		null_trace(97, args, 7);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBlitImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, VkImageBlit* pRegions, VkFilter filter) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)srcImage, (uint64_t)srcImageLayout, (uint64_t)(uintptr_t)dstImage, (uint64_t)dstImageLayout, (uint64_t)regionCount, (uint64_t)(uintptr_t)pRegions, (uint64_t)filter };
+		null_trace(98, args, 8);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyBufferToImage(VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, VkBufferImageCopy* pRegions) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)srcBuffer, (uint64_t)(uintptr_t)dstImage, (uint64_t)dstImageLayout, (uint64_t)regionCount, (uint64_t)(uintptr_t)pRegions };
+		null_trace(99, args, 6);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyImageToBuffer(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, uint32_t regionCount, VkBufferImageCopy* pRegions) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)srcImage, (uint64_t)srcImageLayout, (uint64_t)(uintptr_t)dstBuffer, (uint64_t)regionCount, (uint64_t)(uintptr_t)pRegions };
+		null_trace(100, args, 6);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdUpdateBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, void* pData) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)dstBuffer, (uint64_t)dstOffset, (uint64_t)dataSize, (uint64_t)(uintptr_t)pData };
+		null_trace(101, args, 5);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdFillBuffer(VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)dstBuffer, (uint64_t)dstOffset, (uint64_t)size, (uint64_t)data };
+		null_trace(102, args, 5);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdClearColorImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, VkClearColorValue* pColor, uint32_t rangeCount, VkImageSubresourceRange* pRanges) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)image, (uint64_t)imageLayout, (uint64_t)(uintptr_t)pColor, (uint64_t)rangeCount, (uint64_t)(uintptr_t)pRanges };
+		null_trace(103, args, 6);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdClearDepthStencilImage(VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount, VkImageSubresourceRange* pRanges) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)image, (uint64_t)imageLayout, (uint64_t)(uintptr_t)pDepthStencil, (uint64_t)rangeCount, (uint64_t)(uintptr_t)pRanges };
+		null_trace(104, args, 6);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdClearAttachments(VkCommandBuffer commandBuffer, uint32_t attachmentCount, VkClearAttachment* pAttachments, uint32_t rectCount, VkClearRect* pRects) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)attachmentCount, (uint64_t)(uintptr_t)pAttachments, (uint64_t)rectCount, (uint64_t)(uintptr_t)pRects };
+		null_trace(105, args, 5);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdResolveImage(VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, VkImageResolve* pRegions) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)srcImage, (uint64_t)srcImageLayout, (uint64_t)(uintptr_t)dstImage, (uint64_t)dstImageLayout, (uint64_t)regionCount, (uint64_t)(uintptr_t)pRegions };
+		null_trace(106, args, 7);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)event, (uint64_t)stageMask };
+		null_trace(107, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdResetEvent(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)event, (uint64_t)stageMask };
+		null_trace(108, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdWaitEvents(VkCommandBuffer commandBuffer, uint32_t eventCount, VkEvent* pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, VkImageMemoryBarrier* pImageMemoryBarriers) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)eventCount, (uint64_t)(uintptr_t)pEvents, (uint64_t)srcStageMask, (uint64_t)dstStageMask, (uint64_t)memoryBarrierCount, (uint64_t)(uintptr_t)pMemoryBarriers, (uint64_t)bufferMemoryBarrierCount, (uint64_t)(uintptr_t)pBufferMemoryBarriers, (uint64_t)imageMemoryBarrierCount, (uint64_t)(uintptr_t)pImageMemoryBarriers };
+		null_trace(109, args, 11);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdPipelineBarrier(VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, VkImageMemoryBarrier* pImageMemoryBarriers) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)srcStageMask, (uint64_t)dstStageMask, (uint64_t)dependencyFlags, (uint64_t)memoryBarrierCount, (uint64_t)(uintptr_t)pMemoryBarriers, (uint64_t)bufferMemoryBarrierCount, (uint64_t)(uintptr_t)pBufferMemoryBarriers, (uint64_t)imageMemoryBarrierCount, (uint64_t)(uintptr_t)pImageMemoryBarriers };
+		null_trace(110, args, 10);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBeginQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)queryPool, (uint64_t)query, (uint64_t)flags };
+		null_trace(111, args, 4);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdEndQuery(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)queryPool, (uint64_t)query };
+		null_trace(112, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdResetQueryPool(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)queryPool, (uint64_t)firstQuery, (uint64_t)queryCount };
+		null_trace(113, args, 4);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdWriteTimestamp(VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t query) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)pipelineStage, (uint64_t)(uintptr_t)queryPool, (uint64_t)query };
+		null_trace(114, args, 4);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyQueryPoolResults(VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)queryPool, (uint64_t)firstQuery, (uint64_t)queryCount, (uint64_t)(uintptr_t)dstBuffer, (uint64_t)dstOffset, (uint64_t)stride, (uint64_t)flags };
+		null_trace(115, args, 8);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdPushConstants(VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, void* pValues) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)layout, (uint64_t)stageFlags, (uint64_t)offset, (uint64_t)size, (uint64_t)(uintptr_t)pValues };
+		null_trace(116, args, 6);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBeginRenderPass(VkCommandBuffer commandBuffer, VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassContents contents) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)pRenderPassBegin, (uint64_t)contents };
+		null_trace(117, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdNextSubpass(VkCommandBuffer commandBuffer, VkSubpassContents contents) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)contents };
+		null_trace(118, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdEndRenderPass(VkCommandBuffer commandBuffer) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer };
+		null_trace(119, args, 1);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdExecuteCommands(VkCommandBuffer commandBuffer, uint32_t commandBufferCount, VkCommandBuffer* pCommandBuffers) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)commandBufferCount, (uint64_t)(uintptr_t)pCommandBuffers };
+		null_trace(120, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateBufferView(VkDevice device, VkBufferViewCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkBufferView* pView) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pView };
+		null_trace(121, args, 4);
+	}
+	*pView = (VkBufferView)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetFenceStatus(VkDevice device, VkFence fence) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)fence };
+		null_trace(122, args, 2);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkWaitForFences(VkDevice device, uint32_t fenceCount, VkFence* pFences, VkBool32 waitAll, uint64_t timeout) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)fenceCount, (uint64_t)(uintptr_t)pFences, (uint64_t)waitAll, (uint64_t)timeout };
+		null_trace(123, args, 5);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateDevice(VkPhysicalDevice physicalDevice, VkDeviceCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkDevice* pDevice) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pDevice };
+		null_trace(124, args, 4);
+	}
+	*pDevice = (VkDevice)null_dispatchable();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateSemaphore(VkDevice device, VkSemaphoreCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pSemaphore };
+		null_trace(125, args, 4);
+	}
+	*pSemaphore = (VkSemaphore)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroySemaphore(VkDevice device, VkSemaphore semaphore, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)semaphore, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(126, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyPipelineLayout(VkDevice device, VkPipelineLayout pipelineLayout, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pipelineLayout, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(127, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyBuffer(VkDevice device, VkBuffer buffer, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)buffer, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(128, args, 3);
+	}
+	free((void*)(uintptr_t)buffer);
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyFence(VkDevice device, VkFence fence, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)fence, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(129, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateEvent(VkDevice device, VkEventCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkEvent* pEvent) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pEvent };
+		null_trace(130, args, 4);
+	}
+	*pEvent = (VkEvent)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyEvent(VkDevice device, VkEvent event, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)event, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(131, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetEventStatus(VkDevice device, VkEvent event) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)event };
+		null_trace(132, args, 2);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkSetEvent(VkDevice device, VkEvent event) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)event };
+		null_trace(133, args, 2);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkResetEvent(VkDevice device, VkEvent event) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)event };
+		null_trace(134, args, 2);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateQueryPool(VkDevice device, VkQueryPoolCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pQueryPool };
+		null_trace(135, args, 4);
+	}
+	*pQueryPool = (VkQueryPool)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetQueryPoolResults(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)queryPool, (uint64_t)firstQuery, (uint64_t)queryCount, (uint64_t)dataSize, (uint64_t)(uintptr_t)pData, (uint64_t)stride, (uint64_t)flags };
+		null_trace(136, args, 8);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceFormatProperties2(VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties2* pFormatProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)format, (uint64_t)(uintptr_t)pFormatProperties };
+		null_trace(137, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceExternalFenceProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceExternalFenceInfo* pExternalFenceInfo, VkExternalFenceProperties* pExternalFenceProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pExternalFenceInfo, (uint64_t)(uintptr_t)pExternalFenceProperties };
+		null_trace(138, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceExternalBufferProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceExternalBufferInfo* pExternalBufferInfo, VkExternalBufferProperties* pExternalBufferProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pExternalBufferInfo, (uint64_t)(uintptr_t)pExternalBufferProperties };
+		null_trace(139, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkUpdateDescriptorSetWithTemplate(VkDevice device, VkDescriptorSet descriptorSet, VkDescriptorUpdateTemplate descriptorUpdateTemplate, void* pData) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)descriptorSet, (uint64_t)(uintptr_t)descriptorUpdateTemplate, (uint64_t)(uintptr_t)pData };
+		null_trace(140, args, 4);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyDescriptorUpdateTemplate(VkDevice device, VkDescriptorUpdateTemplate descriptorUpdateTemplate, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)descriptorUpdateTemplate, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(141, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateDescriptorUpdateTemplate(VkDevice device, VkDescriptorUpdateTemplateCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pDescriptorUpdateTemplate };
+		null_trace(142, args, 4);
+	}
+	*pDescriptorUpdateTemplate = (VkDescriptorUpdateTemplate)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroySamplerYcbcrConversion(VkDevice device, VkSamplerYcbcrConversion ycbcrConversion, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)ycbcrConversion, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(143, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateSamplerYcbcrConversion(VkDevice device, VkSamplerYcbcrConversionCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkSamplerYcbcrConversion* pYcbcrConversion) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pYcbcrConversion };
+		null_trace(144, args, 4);
+	}
+	*pYcbcrConversion = (VkSamplerYcbcrConversion)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceQueue2(VkDevice device, VkDeviceQueueInfo2* pQueueInfo, VkQueue* pQueue) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pQueueInfo, (uint64_t)(uintptr_t)pQueue };
+		null_trace(145, args, 3);
+	}
+	*pQueue = (VkQueue)&null_queue;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkTrimCommandPool(VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlags flags) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)commandPool, (uint64_t)flags };
+		null_trace(146, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceExternalSemaphoreProperties(VkPhysicalDevice physicalDevice, VkPhysicalDeviceExternalSemaphoreInfo* pExternalSemaphoreInfo, VkExternalSemaphoreProperties* pExternalSemaphoreProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pExternalSemaphoreInfo, (uint64_t)(uintptr_t)pExternalSemaphoreProperties };
+		null_trace(147, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceSparseImageFormatProperties2(VkPhysicalDevice physicalDevice, VkPhysicalDeviceSparseImageFormatInfo2* pFormatInfo, uint32_t* pPropertyCount, VkSparseImageFormatProperties2* pProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pFormatInfo, (uint64_t)(uintptr_t)pPropertyCount, (uint64_t)(uintptr_t)pProperties };
+		null_trace(148, args, 4);
+	}
+	*pPropertyCount = 0;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceMemoryProperties2(VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties2* pMemoryProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pMemoryProperties };
+		null_trace(149, args, 2);
+	}
+	null_memory_properties(&pMemoryProperties->memoryProperties);
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceQueueFamilyProperties2(VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties2* pQueueFamilyProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pQueueFamilyPropertyCount, (uint64_t)(uintptr_t)pQueueFamilyProperties };
+		null_trace(150, args, 3);
+	}
+	if (pQueueFamilyProperties == NULL) {
+		*pQueueFamilyPropertyCount = 1;
+	} else if (*pQueueFamilyPropertyCount > 0) {
+		*pQueueFamilyPropertyCount = 1;
+		null_queue_family_properties(&pQueueFamilyProperties->queueFamilyProperties);
+	}
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceImageFormatProperties2(VkPhysicalDevice physicalDevice, VkPhysicalDeviceImageFormatInfo2* pImageFormatInfo, VkImageFormatProperties2* pImageFormatProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pImageFormatInfo, (uint64_t)(uintptr_t)pImageFormatProperties };
+		null_trace(151, args, 3);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceProperties2(VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties2* pProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pProperties };
+		null_trace(152, args, 2);
+	}
+	null_physical_device_properties(&pProperties->properties);
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPhysicalDeviceFeatures2(VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures2* pFeatures) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pFeatures };
+		null_trace(153, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetImageSparseMemoryRequirements2(VkDevice device, VkImageSparseMemoryRequirementsInfo2* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2* pSparseMemoryRequirements) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pInfo, (uint64_t)(uintptr_t)pSparseMemoryRequirementCount, (uint64_t)(uintptr_t)pSparseMemoryRequirements };
+		null_trace(154, args, 4);
+	}
+	*pSparseMemoryRequirementCount = 0;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetBufferMemoryRequirements2(VkDevice device, VkBufferMemoryRequirementsInfo2* pInfo, VkMemoryRequirements2* pMemoryRequirements) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pInfo, (uint64_t)(uintptr_t)pMemoryRequirements };
+		null_trace(155, args, 3);
+	}
+	null_memory_requirements(((null_sized*)(uintptr_t)pInfo->buffer)->size, &pMemoryRequirements->memoryRequirements);
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDescriptorSetLayoutSupport(VkDevice device, VkDescriptorSetLayoutCreateInfo* pCreateInfo, VkDescriptorSetLayoutSupport* pSupport) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pSupport };
+		null_trace(156, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetImageMemoryRequirements2(VkDevice device, VkImageMemoryRequirementsInfo2* pInfo, VkMemoryRequirements2* pMemoryRequirements) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pInfo, (uint64_t)(uintptr_t)pMemoryRequirements };
+		null_trace(157, args, 3);
+	}
+	null_memory_requirements(((null_sized*)(uintptr_t)pInfo->image)->size, &pMemoryRequirements->memoryRequirements);
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkEnumeratePhysicalDeviceGroups(VkInstance instance, uint32_t* pPhysicalDeviceGroupCount, VkPhysicalDeviceGroupProperties* pPhysicalDeviceGroupProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)instance, (uint64_t)(uintptr_t)pPhysicalDeviceGroupCount, (uint64_t)(uintptr_t)pPhysicalDeviceGroupProperties };
+		null_trace(158, args, 3);
+	}
+	*pPhysicalDeviceGroupCount = 0;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDispatchBase(VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)baseGroupX, (uint64_t)baseGroupY, (uint64_t)baseGroupZ, (uint64_t)groupCountX, (uint64_t)groupCountY, (uint64_t)groupCountZ };
+		null_trace(159, args, 7);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDeviceMask(VkCommandBuffer commandBuffer, uint32_t deviceMask) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)deviceMask };
+		null_trace(160, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceGroupPeerMemoryFeatures(VkDevice device, uint32_t heapIndex, uint32_t localDeviceIndex, uint32_t remoteDeviceIndex, VkPeerMemoryFeatureFlags* pPeerMemoryFeatures) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)heapIndex, (uint64_t)localDeviceIndex, (uint64_t)remoteDeviceIndex, (uint64_t)(uintptr_t)pPeerMemoryFeatures };
+		null_trace(161, args, 5);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkBindImageMemory2(VkDevice device, uint32_t bindInfoCount, VkBindImageMemoryInfo* pBindInfos) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)bindInfoCount, (uint64_t)(uintptr_t)pBindInfos };
+		null_trace(162, args, 3);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkBindBufferMemory2(VkDevice device, uint32_t bindInfoCount, VkBindBufferMemoryInfo* pBindInfos) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)bindInfoCount, (uint64_t)(uintptr_t)pBindInfos };
+		null_trace(163, args, 3);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkEnumerateInstanceVersion(uint32_t* pApiVersion) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)pApiVersion };
+		null_trace(164, args, 1);
+	}
+	*pApiVersion = NULL_API_VERSION;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBeginRenderPass2(VkCommandBuffer commandBuffer, VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassBeginInfo* pSubpassBeginInfo) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)pRenderPassBegin, (uint64_t)(uintptr_t)pSubpassBeginInfo };
+		null_trace(165, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR uint64_t VKAPI_CALL null_vkGetBufferOpaqueCaptureAddress(VkDevice device, VkBufferDeviceAddressInfo* pInfo) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pInfo };
+		null_trace(166, args, 2);
+	}
+	return 0;
+}
+
+static VKAPI_ATTR VkDeviceAddress VKAPI_CALL null_vkGetBufferDeviceAddress(VkDevice device, VkBufferDeviceAddressInfo* pInfo) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pInfo };
+		null_trace(167, args, 2);
+	}
+	return 0;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)buffer, (uint64_t)offset, (uint64_t)(uintptr_t)countBuffer, (uint64_t)countBufferOffset, (uint64_t)maxDrawCount, (uint64_t)stride };
+		null_trace(168, args, 7);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdDrawIndexedIndirectCount(VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)buffer, (uint64_t)offset, (uint64_t)(uintptr_t)countBuffer, (uint64_t)countBufferOffset, (uint64_t)maxDrawCount, (uint64_t)stride };
+		null_trace(169, args, 7);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateRenderPass2(VkDevice device, VkRenderPassCreateInfo2* pCreateInfo, VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pRenderPass };
+		null_trace(170, args, 4);
+	}
+	*pRenderPass = (VkRenderPass)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR uint64_t VKAPI_CALL null_vkGetDeviceMemoryOpaqueCaptureAddress(VkDevice device, VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pInfo };
+		null_trace(171, args, 2);
+	}
+	return 0;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdNextSubpass2(VkCommandBuffer commandBuffer, VkSubpassBeginInfo* pSubpassBeginInfo, VkSubpassEndInfo* pSubpassEndInfo) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)pSubpassBeginInfo, (uint64_t)(uintptr_t)pSubpassEndInfo };
+		null_trace(172, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdEndRenderPass2(VkCommandBuffer commandBuffer, VkSubpassEndInfo* pSubpassEndInfo) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)pSubpassEndInfo };
+		null_trace(173, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkSignalSemaphore(VkDevice device, VkSemaphoreSignalInfo* pSignalInfo) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pSignalInfo };
+		null_trace(174, args, 2);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkWaitSemaphores(VkDevice device, VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pWaitInfo, (uint64_t)timeout };
+		null_trace(175, args, 3);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetSemaphoreCounterValue(VkDevice device, VkSemaphore semaphore, uint64_t* pValue) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)semaphore, (uint64_t)(uintptr_t)pValue };
+		null_trace(176, args, 3);
+	}
+	*pValue = UINT64_MAX;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkResetQueryPool(VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)queryPool, (uint64_t)firstQuery, (uint64_t)queryCount };
+		null_trace(177, args, 4);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdWriteTimestamp2(VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage, VkQueryPool queryPool, uint32_t query) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)stage, (uint64_t)(uintptr_t)queryPool, (uint64_t)query };
+		null_trace(178, args, 4);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyImage2(VkCommandBuffer commandBuffer, VkCopyImageInfo2* pCopyImageInfo) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)pCopyImageInfo };
+		null_trace(179, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthBoundsTestEnable(VkCommandBuffer commandBuffer, VkBool32 depthBoundsTestEnable) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)depthBoundsTestEnable };
+		null_trace(180, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetStencilOp(VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp, VkStencilOp passOp, VkStencilOp depthFailOp, VkCompareOp compareOp) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)faceMask, (uint64_t)failOp, (uint64_t)passOp, (uint64_t)depthFailOp, (uint64_t)compareOp };
+		null_trace(181, args, 6);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthWriteEnable(VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)depthWriteEnable };
+		null_trace(182, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthTestEnable(VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)depthTestEnable };
+		null_trace(183, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBindVertexBuffers2(VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, VkBuffer* pBuffers, VkDeviceSize* pOffsets, VkDeviceSize* pSizes, VkDeviceSize* pStrides) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)firstBinding, (uint64_t)bindingCount, (uint64_t)(uintptr_t)pBuffers, (uint64_t)(uintptr_t)pOffsets, (uint64_t)(uintptr_t)pSizes, (uint64_t)(uintptr_t)pStrides };
+		null_trace(184, args, 7);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetScissorWithCount(VkCommandBuffer commandBuffer, uint32_t scissorCount, VkRect2D* pScissors) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)scissorCount, (uint64_t)(uintptr_t)pScissors };
+		null_trace(185, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetViewportWithCount(VkCommandBuffer commandBuffer, uint32_t viewportCount, VkViewport* pViewports) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)viewportCount, (uint64_t)(uintptr_t)pViewports };
+		null_trace(186, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetPrimitiveTopology(VkCommandBuffer commandBuffer, VkPrimitiveTopology primitiveTopology) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)primitiveTopology };
+		null_trace(187, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetFrontFace(VkCommandBuffer commandBuffer, VkFrontFace frontFace) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)frontFace };
+		null_trace(188, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetCullMode(VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)cullMode };
+		null_trace(189, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetEvent2(VkCommandBuffer commandBuffer, VkEvent event, VkDependencyInfo* pDependencyInfo) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)event, (uint64_t)(uintptr_t)pDependencyInfo };
+		null_trace(190, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdEndRendering(VkCommandBuffer commandBuffer) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer };
+		null_trace(191, args, 1);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBeginRendering(VkCommandBuffer commandBuffer, VkRenderingInfo* pRenderingInfo) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)pRenderingInfo };
+		null_trace(192, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdResetEvent2(VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2 stageMask) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)event, (uint64_t)stageMask };
+		null_trace(193, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdWaitEvents2(VkCommandBuffer commandBuffer, uint32_t eventCount, VkEvent* pEvents, VkDependencyInfo* pDependencyInfos) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)eventCount, (uint64_t)(uintptr_t)pEvents, (uint64_t)(uintptr_t)pDependencyInfos };
+		null_trace(194, args, 4);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdPipelineBarrier2(VkCommandBuffer commandBuffer, VkDependencyInfo* pDependencyInfo) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)pDependencyInfo };
+		null_trace(195, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthCompareOp(VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)depthCompareOp };
+		null_trace(196, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetStencilTestEnable(VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)stencilTestEnable };
+		null_trace(197, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetPrimitiveRestartEnable(VkCommandBuffer commandBuffer, VkBool32 primitiveRestartEnable) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)primitiveRestartEnable };
+		null_trace(198, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetDepthBiasEnable(VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)depthBiasEnable };
+		null_trace(199, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkQueueSubmit2(VkQueue queue, uint32_t submitCount, VkSubmitInfo2* pSubmits, VkFence fence) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)queue, (uint64_t)submitCount, (uint64_t)(uintptr_t)pSubmits, (uint64_t)(uintptr_t)fence };
+		null_trace(200, args, 4);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceToolProperties(VkPhysicalDevice physicalDevice, uint32_t* pToolCount, VkPhysicalDeviceToolProperties* pToolProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pToolCount, (uint64_t)(uintptr_t)pToolProperties };
+		null_trace(201, args, 3);
+	}
+	*pToolCount = 0;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdResolveImage2(VkCommandBuffer commandBuffer, VkResolveImageInfo2* pResolveImageInfo) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)pResolveImageInfo };
+		null_trace(202, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceBufferMemoryRequirements(VkDevice device, VkDeviceBufferMemoryRequirements* pInfo, VkMemoryRequirements2* pMemoryRequirements) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pInfo, (uint64_t)(uintptr_t)pMemoryRequirements };
+		null_trace(203, args, 3);
+	}
+	null_memory_requirements(pInfo->pCreateInfo->size, &pMemoryRequirements->memoryRequirements);
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceImageMemoryRequirements(VkDevice device, VkDeviceImageMemoryRequirements* pInfo, VkMemoryRequirements2* pMemoryRequirements) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pInfo, (uint64_t)(uintptr_t)pMemoryRequirements };
+		null_trace(204, args, 3);
+	}
+	null_memory_requirements(null_image_size(pInfo->pCreateInfo), &pMemoryRequirements->memoryRequirements);
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetDeviceImageSparseMemoryRequirements(VkDevice device, VkDeviceImageMemoryRequirements* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2* pSparseMemoryRequirements) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pInfo, (uint64_t)(uintptr_t)pSparseMemoryRequirementCount, (uint64_t)(uintptr_t)pSparseMemoryRequirements };
+		null_trace(205, args, 4);
+	}
+	*pSparseMemoryRequirementCount = 0;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkGetPrivateData(VkDevice device, VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlot privateDataSlot, uint64_t* pData) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)objectType, (uint64_t)objectHandle, (uint64_t)(uintptr_t)privateDataSlot, (uint64_t)(uintptr_t)pData };
+		null_trace(206, args, 5);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkSetPrivateData(VkDevice device, VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlot privateDataSlot, uint64_t data) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)objectType, (uint64_t)objectHandle, (uint64_t)(uintptr_t)privateDataSlot, (uint64_t)data };
+		null_trace(207, args, 5);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyPrivateDataSlot(VkDevice device, VkPrivateDataSlot privateDataSlot, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)privateDataSlot, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(208, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreatePrivateDataSlot(VkDevice device, VkPrivateDataSlotCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkPrivateDataSlot* pPrivateDataSlot) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pPrivateDataSlot };
+		null_trace(209, args, 4);
+	}
+	*pPrivateDataSlot = (VkPrivateDataSlot)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdBlitImage2(VkCommandBuffer commandBuffer, VkBlitImageInfo2* pBlitImageInfo) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)pBlitImageInfo };
+		null_trace(210, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyImageToBuffer2(VkCommandBuffer commandBuffer, VkCopyImageToBufferInfo2* pCopyImageToBufferInfo) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)pCopyImageToBufferInfo };
+		null_trace(211, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyBufferToImage2(VkCommandBuffer commandBuffer, VkCopyBufferToImageInfo2* pCopyBufferToImageInfo) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)pCopyBufferToImageInfo };
+		null_trace(212, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdSetRasterizerDiscardEnable(VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)rasterizerDiscardEnable };
+		null_trace(213, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkCmdCopyBuffer2(VkCommandBuffer commandBuffer, VkCopyBufferInfo2* pCopyBufferInfo) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)commandBuffer, (uint64_t)(uintptr_t)pCopyBufferInfo };
+		null_trace(214, args, 2);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateDebugReportCallbackEXT(VkInstance instance, VkDebugReportCallbackCreateInfoEXT* pCreateInfo, VkAllocationCallbacks* pAllocator, VkDebugReportCallbackEXT* pCallback) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)instance, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pCallback };
+		null_trace(215, args, 4);
+	}
+	*pCallback = (VkDebugReportCallbackEXT)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDebugReportMessageEXT(VkInstance instance, VkDebugReportFlagsEXT flags, VkDebugReportObjectTypeEXT objectType, uint64_t object, size_t location, int32_t messageCode, char* pLayerPrefix, char* pMessage) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)instance, (uint64_t)flags, (uint64_t)objectType, (uint64_t)object, (uint64_t)location, (uint64_t)messageCode, (uint64_t)(uintptr_t)pLayerPrefix, (uint64_t)(uintptr_t)pMessage };
+		null_trace(216, args, 8);
+	}
+	return;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroyDebugReportCallbackEXT(VkInstance instance, VkDebugReportCallbackEXT callback, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)instance, (uint64_t)(uintptr_t)callback, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(217, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceSurfacePresentModesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pPresentModeCount, VkPresentModeKHR* pPresentModes) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)surface, (uint64_t)(uintptr_t)pPresentModeCount, (uint64_t)(uintptr_t)pPresentModes };
+		null_trace(218, args, 4);
+	}
+	*pPresentModeCount = 0;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceSurfaceFormatsKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pSurfaceFormatCount, VkSurfaceFormatKHR* pSurfaceFormats) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)surface, (uint64_t)(uintptr_t)pSurfaceFormatCount, (uint64_t)(uintptr_t)pSurfaceFormats };
+		null_trace(219, args, 4);
+	}
+	*pSurfaceFormatCount = 0;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR* pSurfaceCapabilities) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)surface, (uint64_t)(uintptr_t)pSurfaceCapabilities };
+		null_trace(220, args, 3);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceSurfaceSupportKHR(VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, VkSurfaceKHR surface, VkBool32* pSupported) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)queueFamilyIndex, (uint64_t)(uintptr_t)surface, (uint64_t)(uintptr_t)pSupported };
+		null_trace(221, args, 4);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroySurfaceKHR(VkInstance instance, VkSurfaceKHR surface, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)instance, (uint64_t)(uintptr_t)surface, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(222, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceSurfaceCapabilities2KHR(VkPhysicalDevice physicalDevice, VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, VkSurfaceCapabilities2KHR* pSurfaceCapabilities) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pSurfaceInfo, (uint64_t)(uintptr_t)pSurfaceCapabilities };
+		null_trace(223, args, 3);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceSurfaceFormats2KHR(VkPhysicalDevice physicalDevice, VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, uint32_t* pSurfaceFormatCount, VkSurfaceFormat2KHR* pSurfaceFormats) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pSurfaceInfo, (uint64_t)(uintptr_t)pSurfaceFormatCount, (uint64_t)(uintptr_t)pSurfaceFormats };
+		null_trace(224, args, 4);
+	}
+	*pSurfaceFormatCount = 0;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateSwapchainKHR(VkDevice device, VkSwapchainCreateInfoKHR* pCreateInfo, VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pSwapchain };
+		null_trace(225, args, 4);
+	}
+	*pSwapchain = (VkSwapchainKHR)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkAcquireNextImageKHR(VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)swapchain, (uint64_t)timeout, (uint64_t)(uintptr_t)semaphore, (uint64_t)(uintptr_t)fence, (uint64_t)(uintptr_t)pImageIndex };
+		null_trace(226, args, 6);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkQueuePresentKHR(VkQueue queue, VkPresentInfoKHR* pPresentInfo) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)queue, (uint64_t)(uintptr_t)pPresentInfo };
+		null_trace(227, args, 2);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkAcquireNextImage2KHR(VkDevice device, VkAcquireNextImageInfoKHR* pAcquireInfo, uint32_t* pImageIndex) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pAcquireInfo, (uint64_t)(uintptr_t)pImageIndex };
+		null_trace(228, args, 3);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDevicePresentRectanglesKHR(VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pRectCount, VkRect2D* pRects) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)surface, (uint64_t)(uintptr_t)pRectCount, (uint64_t)(uintptr_t)pRects };
+		null_trace(229, args, 4);
+	}
+	*pRectCount = 0;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetSwapchainImagesKHR(VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)swapchain, (uint64_t)(uintptr_t)pSwapchainImageCount, (uint64_t)(uintptr_t)pSwapchainImages };
+		null_trace(230, args, 4);
+	}
+	if (pSwapchainImages == NULL) {
+		*pSwapchainImageCount = 1;
+	} else if (*pSwapchainImageCount > 0) {
+		*pSwapchainImageCount = 1;
+		pSwapchainImages[0] = (VkImage)(uintptr_t)null_handle();
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetDeviceGroupSurfacePresentModesKHR(VkDevice device, VkSurfaceKHR surface, VkDeviceGroupPresentModeFlagsKHR* pModes) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)surface, (uint64_t)(uintptr_t)pModes };
+		null_trace(231, args, 3);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR void VKAPI_CALL null_vkDestroySwapchainKHR(VkDevice device, VkSwapchainKHR swapchain, VkAllocationCallbacks* pAllocator) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)swapchain, (uint64_t)(uintptr_t)pAllocator };
+		null_trace(232, args, 3);
+	}
+	return;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetDeviceGroupPresentCapabilitiesKHR(VkDevice device, VkDeviceGroupPresentCapabilitiesKHR* pDeviceGroupPresentCapabilities) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pDeviceGroupPresentCapabilities };
+		null_trace(233, args, 2);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceDisplayPropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPropertiesKHR* pProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pPropertyCount, (uint64_t)(uintptr_t)pProperties };
+		null_trace(234, args, 3);
+	}
+	*pPropertyCount = 0;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetDisplayPlaneCapabilitiesKHR(VkPhysicalDevice physicalDevice, VkDisplayModeKHR mode, uint32_t planeIndex, VkDisplayPlaneCapabilitiesKHR* pCapabilities) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)mode, (uint64_t)planeIndex, (uint64_t)(uintptr_t)pCapabilities };
+		null_trace(235, args, 4);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPlanePropertiesKHR* pProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pPropertyCount, (uint64_t)(uintptr_t)pProperties };
+		null_trace(236, args, 3);
+	}
+	*pPropertyCount = 0;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateDisplayModeKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, VkDisplayModeCreateInfoKHR* pCreateInfo, VkAllocationCallbacks* pAllocator, VkDisplayModeKHR* pMode) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)display, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pMode };
+		null_trace(237, args, 5);
+	}
+	*pMode = (VkDisplayModeKHR)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetDisplayModePropertiesKHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t* pPropertyCount, VkDisplayModePropertiesKHR* pProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)display, (uint64_t)(uintptr_t)pPropertyCount, (uint64_t)(uintptr_t)pProperties };
+		null_trace(238, args, 4);
+	}
+	*pPropertyCount = 0;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateDisplayPlaneSurfaceKHR(VkInstance instance, VkDisplaySurfaceCreateInfoKHR* pCreateInfo, VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)instance, (uint64_t)(uintptr_t)pCreateInfo, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pSurface };
+		null_trace(239, args, 4);
+	}
+	*pSurface = (VkSurfaceKHR)(uintptr_t)null_handle();
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetDisplayPlaneSupportedDisplaysKHR(VkPhysicalDevice physicalDevice, uint32_t planeIndex, uint32_t* pDisplayCount, VkDisplayKHR* pDisplays) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)planeIndex, (uint64_t)(uintptr_t)pDisplayCount, (uint64_t)(uintptr_t)pDisplays };
+		null_trace(240, args, 4);
+	}
+	if (pDisplays == NULL) {
+		*pDisplayCount = 1;
+	} else if (*pDisplayCount > 0) {
+		*pDisplayCount = 1;
+		pDisplays[0] = (VkDisplayKHR)(uintptr_t)null_handle();
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPlaneProperties2KHR* pProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pPropertyCount, (uint64_t)(uintptr_t)pProperties };
+		null_trace(241, args, 3);
+	}
+	*pPropertyCount = 0;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetPhysicalDeviceDisplayProperties2KHR(VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayProperties2KHR* pProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pPropertyCount, (uint64_t)(uintptr_t)pProperties };
+		null_trace(242, args, 3);
+	}
+	*pPropertyCount = 0;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetDisplayPlaneCapabilities2KHR(VkPhysicalDevice physicalDevice, VkDisplayPlaneInfo2KHR* pDisplayPlaneInfo, VkDisplayPlaneCapabilities2KHR* pCapabilities) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)pDisplayPlaneInfo, (uint64_t)(uintptr_t)pCapabilities };
+		null_trace(243, args, 3);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetDisplayModeProperties2KHR(VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t* pPropertyCount, VkDisplayModeProperties2KHR* pProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)physicalDevice, (uint64_t)(uintptr_t)display, (uint64_t)(uintptr_t)pPropertyCount, (uint64_t)(uintptr_t)pProperties };
+		null_trace(244, args, 4);
+	}
+	*pPropertyCount = 0;
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkCreateSharedSwapchainsKHR(VkDevice device, uint32_t swapchainCount, VkSwapchainCreateInfoKHR* pCreateInfos, VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)swapchainCount, (uint64_t)(uintptr_t)pCreateInfos, (uint64_t)(uintptr_t)pAllocator, (uint64_t)(uintptr_t)pSwapchains };
+		null_trace(245, args, 5);
+	}
+	for (uint32_t i = 0; i < swapchainCount; i++) {
+		pSwapchains[i] = (VkSwapchainKHR)(uintptr_t)null_handle();
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetMemoryFdKHR(VkDevice device, VkMemoryGetFdInfoKHR* pGetFdInfo, int* pFd) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pGetFdInfo, (uint64_t)(uintptr_t)pFd };
+		null_trace(246, args, 3);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetMemoryFdPropertiesKHR(VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, int fd, VkMemoryFdPropertiesKHR* pMemoryFdProperties) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)handleType, (uint64_t)fd, (uint64_t)(uintptr_t)pMemoryFdProperties };
+		null_trace(247, args, 4);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkImportSemaphoreFdKHR(VkDevice device, VkImportSemaphoreFdInfoKHR* pImportSemaphoreFdInfo) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pImportSemaphoreFdInfo };
+		null_trace(248, args, 2);
+	}
+	return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL null_vkGetSemaphoreFdKHR(VkDevice device, VkSemaphoreGetFdInfoKHR* pGetFdInfo, int* pFd) {
+	if (null_shm != NULL) {
+		const uint64_t args[] = { (uint64_t)(uintptr_t)device, (uint64_t)(uintptr_t)pGetFdInfo, (uint64_t)(uintptr_t)pFd };
+		null_trace(249, args, 3);
+	}
+	return VK_SUCCESS;
+}
+
+typedef struct null_entry {
+	const char* name;
+	PFN_vkVoidFunction func;
+} null_entry;
+
+// Sorted by name for the binary search in null_lookup.
+static const null_entry null_entries[VKS_NULL_COMMAND_COUNT] = { 
+	{ "vkAcquireNextImage2KHR", (PFN_vkVoidFunction)null_vkAcquireNextImage2KHR },
+	{ "vkAcquireNextImageKHR", (PFN_vkVoidFunction)null_vkAcquireNextImageKHR },
+	{ "vkAllocateCommandBuffers", (PFN_vkVoidFunction)null_vkAllocateCommandBuffers },
+	{ "vkAllocateDescriptorSets", (PFN_vkVoidFunction)null_vkAllocateDescriptorSets },
+	{ "vkAllocateMemory", (PFN_vkVoidFunction)null_vkAllocateMemory },
+	{ "vkBeginCommandBuffer", (PFN_vkVoidFunction)null_vkBeginCommandBuffer },
+	{ "vkBindBufferMemory", (PFN_vkVoidFunction)null_vkBindBufferMemory },
+	{ "vkBindBufferMemory2", (PFN_vkVoidFunction)null_vkBindBufferMemory2 },
+	{ "vkBindImageMemory", (PFN_vkVoidFunction)null_vkBindImageMemory },
+	{ "vkBindImageMemory2", (PFN_vkVoidFunction)null_vkBindImageMemory2 },
+	{ "vkCmdBeginQuery", (PFN_vkVoidFunction)null_vkCmdBeginQuery },
+	{ "vkCmdBeginRenderPass", (PFN_vkVoidFunction)null_vkCmdBeginRenderPass },
+	{ "vkCmdBeginRenderPass2", (PFN_vkVoidFunction)null_vkCmdBeginRenderPass2 },
+	{ "vkCmdBeginRendering", (PFN_vkVoidFunction)null_vkCmdBeginRendering },
+	{ "vkCmdBindDescriptorSets", (PFN_vkVoidFunction)null_vkCmdBindDescriptorSets },
+	{ "vkCmdBindIndexBuffer", (PFN_vkVoidFunction)null_vkCmdBindIndexBuffer },
+	{ "vkCmdBindPipeline", (PFN_vkVoidFunction)null_vkCmdBindPipeline },
+	{ "vkCmdBindVertexBuffers", (PFN_vkVoidFunction)null_vkCmdBindVertexBuffers },
+	{ "vkCmdBindVertexBuffers2", (PFN_vkVoidFunction)null_vkCmdBindVertexBuffers2 },
+	{ "vkCmdBlitImage", (PFN_vkVoidFunction)null_vkCmdBlitImage },
+	{ "vkCmdBlitImage2", (PFN_vkVoidFunction)null_vkCmdBlitImage2 },
+	{ "vkCmdClearAttachments", (PFN_vkVoidFunction)null_vkCmdClearAttachments },
+	{ "vkCmdClearColorImage", (PFN_vkVoidFunction)null_vkCmdClearColorImage },
+	{ "vkCmdClearDepthStencilImage", (PFN_vkVoidFunction)null_vkCmdClearDepthStencilImage },
+	{ "vkCmdCopyBuffer", (PFN_vkVoidFunction)null_vkCmdCopyBuffer },
+	{ "vkCmdCopyBuffer2", (PFN_vkVoidFunction)null_vkCmdCopyBuffer2 },
+	{ "vkCmdCopyBufferToImage", (PFN_vkVoidFunction)null_vkCmdCopyBufferToImage },
+	{ "vkCmdCopyBufferToImage2", (PFN_vkVoidFunction)null_vkCmdCopyBufferToImage2 },
+	{ "vkCmdCopyImage", (PFN_vkVoidFunction)null_vkCmdCopyImage },
+	{ "vkCmdCopyImage2", (PFN_vkVoidFunction)null_vkCmdCopyImage2 },
+	{ "vkCmdCopyImageToBuffer", (PFN_vkVoidFunction)null_vkCmdCopyImageToBuffer },
+	{ "vkCmdCopyImageToBuffer2", (PFN_vkVoidFunction)null_vkCmdCopyImageToBuffer2 },
+	{ "vkCmdCopyQueryPoolResults", (PFN_vkVoidFunction)null_vkCmdCopyQueryPoolResults },
+	{ "vkCmdDispatch", (PFN_vkVoidFunction)null_vkCmdDispatch },
+	{ "vkCmdDispatchBase", (PFN_vkVoidFunction)null_vkCmdDispatchBase },
+	{ "vkCmdDispatchIndirect", (PFN_vkVoidFunction)null_vkCmdDispatchIndirect },
+	{ "vkCmdDraw", (PFN_vkVoidFunction)null_vkCmdDraw },
+	{ "vkCmdDrawIndexed", (PFN_vkVoidFunction)null_vkCmdDrawIndexed },
+	{ "vkCmdDrawIndexedIndirect", (PFN_vkVoidFunction)null_vkCmdDrawIndexedIndirect },
+	{ "vkCmdDrawIndexedIndirectCount", (PFN_vkVoidFunction)null_vkCmdDrawIndexedIndirectCount },
+	{ "vkCmdDrawIndirect", (PFN_vkVoidFunction)null_vkCmdDrawIndirect },
+	{ "vkCmdDrawIndirectCount", (PFN_vkVoidFunction)null_vkCmdDrawIndirectCount },
+	{ "vkCmdEndQuery", (PFN_vkVoidFunction)null_vkCmdEndQuery },
+	{ "vkCmdEndRenderPass", (PFN_vkVoidFunction)null_vkCmdEndRenderPass },
+	{ "vkCmdEndRenderPass2", (PFN_vkVoidFunction)null_vkCmdEndRenderPass2 },
+	{ "vkCmdEndRendering", (PFN_vkVoidFunction)null_vkCmdEndRendering },
+	{ "vkCmdExecuteCommands", (PFN_vkVoidFunction)null_vkCmdExecuteCommands },
+	{ "vkCmdFillBuffer", (PFN_vkVoidFunction)null_vkCmdFillBuffer },
+	{ "vkCmdNextSubpass", (PFN_vkVoidFunction)null_vkCmdNextSubpass },
+	{ "vkCmdNextSubpass2", (PFN_vkVoidFunction)null_vkCmdNextSubpass2 },
+	{ "vkCmdPipelineBarrier", (PFN_vkVoidFunction)null_vkCmdPipelineBarrier },
+	{ "vkCmdPipelineBarrier2", (PFN_vkVoidFunction)null_vkCmdPipelineBarrier2 },
+	{ "vkCmdPushConstants", (PFN_vkVoidFunction)null_vkCmdPushConstants },
+	{ "vkCmdResetEvent", (PFN_vkVoidFunction)null_vkCmdResetEvent },
+	{ "vkCmdResetEvent2", (PFN_vkVoidFunction)null_vkCmdResetEvent2 },
+	{ "vkCmdResetQueryPool", (PFN_vkVoidFunction)null_vkCmdResetQueryPool },
+	{ "vkCmdResolveImage", (PFN_vkVoidFunction)null_vkCmdResolveImage },
+	{ "vkCmdResolveImage2", (PFN_vkVoidFunction)null_vkCmdResolveImage2 },
+	{ "vkCmdSetBlendConstants", (PFN_vkVoidFunction)null_vkCmdSetBlendConstants },
+	{ "vkCmdSetCullMode", (PFN_vkVoidFunction)null_vkCmdSetCullMode },
+	{ "vkCmdSetDepthBias", (PFN_vkVoidFunction)null_vkCmdSetDepthBias },
+	{ "vkCmdSetDepthBiasEnable", (PFN_vkVoidFunction)null_vkCmdSetDepthBiasEnable },
+	{ "vkCmdSetDepthBounds", (PFN_vkVoidFunction)null_vkCmdSetDepthBounds },
+	{ "vkCmdSetDepthBoundsTestEnable", (PFN_vkVoidFunction)null_vkCmdSetDepthBoundsTestEnable },
+	{ "vkCmdSetDepthCompareOp", (PFN_vkVoidFunction)null_vkCmdSetDepthCompareOp },
+	{ "vkCmdSetDepthTestEnable", (PFN_vkVoidFunction)null_vkCmdSetDepthTestEnable },
+	{ "vkCmdSetDepthWriteEnable", (PFN_vkVoidFunction)null_vkCmdSetDepthWriteEnable },
+	{ "vkCmdSetDeviceMask", (PFN_vkVoidFunction)null_vkCmdSetDeviceMask },
+	{ "vkCmdSetEvent", (PFN_vkVoidFunction)null_vkCmdSetEvent },
+	{ "vkCmdSetEvent2", (PFN_vkVoidFunction)null_vkCmdSetEvent2 },
+	{ "vkCmdSetFrontFace", (PFN_vkVoidFunction)null_vkCmdSetFrontFace },
+	{ "vkCmdSetLineWidth", (PFN_vkVoidFunction)null_vkCmdSetLineWidth },
+	{ "vkCmdSetPrimitiveRestartEnable", (PFN_vkVoidFunction)null_vkCmdSetPrimitiveRestartEnable },
+	{ "vkCmdSetPrimitiveTopology", (PFN_vkVoidFunction)null_vkCmdSetPrimitiveTopology },
+	{ "vkCmdSetRasterizerDiscardEnable", (PFN_vkVoidFunction)null_vkCmdSetRasterizerDiscardEnable },
+	{ "vkCmdSetScissor", (PFN_vkVoidFunction)null_vkCmdSetScissor },
+	{ "vkCmdSetScissorWithCount", (PFN_vkVoidFunction)null_vkCmdSetScissorWithCount },
+	{ "vkCmdSetStencilCompareMask", (PFN_vkVoidFunction)null_vkCmdSetStencilCompareMask },
+	{ "vkCmdSetStencilOp", (PFN_vkVoidFunction)null_vkCmdSetStencilOp },
+	{ "vkCmdSetStencilReference", (PFN_vkVoidFunction)null_vkCmdSetStencilReference },
+	{ "vkCmdSetStencilTestEnable", (PFN_vkVoidFunction)null_vkCmdSetStencilTestEnable },
+	{ "vkCmdSetStencilWriteMask", (PFN_vkVoidFunction)null_vkCmdSetStencilWriteMask },
+	{ "vkCmdSetViewport", (PFN_vkVoidFunction)null_vkCmdSetViewport },
+	{ "vkCmdSetViewportWithCount", (PFN_vkVoidFunction)null_vkCmdSetViewportWithCount },
+	{ "vkCmdUpdateBuffer", (PFN_vkVoidFunction)null_vkCmdUpdateBuffer },
+	{ "vkCmdWaitEvents", (PFN_vkVoidFunction)null_vkCmdWaitEvents },
+	{ "vkCmdWaitEvents2", (PFN_vkVoidFunction)null_vkCmdWaitEvents2 },
+	{ "vkCmdWriteTimestamp", (PFN_vkVoidFunction)null_vkCmdWriteTimestamp },
+	{ "vkCmdWriteTimestamp2", (PFN_vkVoidFunction)null_vkCmdWriteTimestamp2 },
+	{ "vkCreateBuffer", (PFN_vkVoidFunction)null_vkCreateBuffer },
+	{ "vkCreateBufferView", (PFN_vkVoidFunction)null_vkCreateBufferView },
+	{ "vkCreateCommandPool", (PFN_vkVoidFunction)null_vkCreateCommandPool },
+	{ "vkCreateComputePipelines", (PFN_vkVoidFunction)null_vkCreateComputePipelines },
+	{ "vkCreateDebugReportCallbackEXT", (PFN_vkVoidFunction)null_vkCreateDebugReportCallbackEXT },
+	{ "vkCreateDescriptorPool", (PFN_vkVoidFunction)null_vkCreateDescriptorPool },
+	{ "vkCreateDescriptorSetLayout", (PFN_vkVoidFunction)null_vkCreateDescriptorSetLayout },
+	{ "vkCreateDescriptorUpdateTemplate", (PFN_vkVoidFunction)null_vkCreateDescriptorUpdateTemplate },
+	{ "vkCreateDevice", (PFN_vkVoidFunction)null_vkCreateDevice },
+	{ "vkCreateDisplayModeKHR", (PFN_vkVoidFunction)null_vkCreateDisplayModeKHR },
+	{ "vkCreateDisplayPlaneSurfaceKHR", (PFN_vkVoidFunction)null_vkCreateDisplayPlaneSurfaceKHR },
+	{ "vkCreateEvent", (PFN_vkVoidFunction)null_vkCreateEvent },
+	{ "vkCreateFence", (PFN_vkVoidFunction)null_vkCreateFence },
+	{ "vkCreateFramebuffer", (PFN_vkVoidFunction)null_vkCreateFramebuffer },
+	{ "vkCreateGraphicsPipelines", (PFN_vkVoidFunction)null_vkCreateGraphicsPipelines },
+	{ "vkCreateImage", (PFN_vkVoidFunction)null_vkCreateImage },
+	{ "vkCreateImageView", (PFN_vkVoidFunction)null_vkCreateImageView },
+	{ "vkCreateInstance", (PFN_vkVoidFunction)null_vkCreateInstance },
+	{ "vkCreatePipelineCache", (PFN_vkVoidFunction)null_vkCreatePipelineCache },
+	{ "vkCreatePipelineLayout", (PFN_vkVoidFunction)null_vkCreatePipelineLayout },
+	{ "vkCreatePrivateDataSlot", (PFN_vkVoidFunction)null_vkCreatePrivateDataSlot },
+	{ "vkCreateQueryPool", (PFN_vkVoidFunction)null_vkCreateQueryPool },
+	{ "vkCreateRenderPass", (PFN_vkVoidFunction)null_vkCreateRenderPass },
+	{ "vkCreateRenderPass2", (PFN_vkVoidFunction)null_vkCreateRenderPass2 },
+	{ "vkCreateSampler", (PFN_vkVoidFunction)null_vkCreateSampler },
+	{ "vkCreateSamplerYcbcrConversion", (PFN_vkVoidFunction)null_vkCreateSamplerYcbcrConversion },
+	{ "vkCreateSemaphore", (PFN_vkVoidFunction)null_vkCreateSemaphore },
+	{ "vkCreateShaderModule", (PFN_vkVoidFunction)null_vkCreateShaderModule },
+	{ "vkCreateSharedSwapchainsKHR", (PFN_vkVoidFunction)null_vkCreateSharedSwapchainsKHR },
+	{ "vkCreateSwapchainKHR", (PFN_vkVoidFunction)null_vkCreateSwapchainKHR },
+	{ "vkDebugReportMessageEXT", (PFN_vkVoidFunction)null_vkDebugReportMessageEXT },
+	{ "vkDestroyBuffer", (PFN_vkVoidFunction)null_vkDestroyBuffer },
+	{ "vkDestroyBufferView", (PFN_vkVoidFunction)null_vkDestroyBufferView },
+	{ "vkDestroyCommandPool", (PFN_vkVoidFunction)null_vkDestroyCommandPool },
+	{ "vkDestroyDebugReportCallbackEXT", (PFN_vkVoidFunction)null_vkDestroyDebugReportCallbackEXT },
+	{ "vkDestroyDescriptorPool", (PFN_vkVoidFunction)null_vkDestroyDescriptorPool },
+	{ "vkDestroyDescriptorSetLayout", (PFN_vkVoidFunction)null_vkDestroyDescriptorSetLayout },
+	{ "vkDestroyDescriptorUpdateTemplate", (PFN_vkVoidFunction)null_vkDestroyDescriptorUpdateTemplate },
+	{ "vkDestroyDevice", (PFN_vkVoidFunction)null_vkDestroyDevice },
+	{ "vkDestroyEvent", (PFN_vkVoidFunction)null_vkDestroyEvent },
+	{ "vkDestroyFence", (PFN_vkVoidFunction)null_vkDestroyFence },
+	{ "vkDestroyFramebuffer", (PFN_vkVoidFunction)null_vkDestroyFramebuffer },
+	{ "vkDestroyImage", (PFN_vkVoidFunction)null_vkDestroyImage },
+	{ "vkDestroyImageView", (PFN_vkVoidFunction)null_vkDestroyImageView },
+	{ "vkDestroyInstance", (PFN_vkVoidFunction)null_vkDestroyInstance },
+	{ "vkDestroyPipeline", (PFN_vkVoidFunction)null_vkDestroyPipeline },
+	{ "vkDestroyPipelineCache", (PFN_vkVoidFunction)null_vkDestroyPipelineCache },
+	{ "vkDestroyPipelineLayout", (PFN_vkVoidFunction)null_vkDestroyPipelineLayout },
+	{ "vkDestroyPrivateDataSlot", (PFN_vkVoidFunction)null_vkDestroyPrivateDataSlot },
+	{ "vkDestroyQueryPool", (PFN_vkVoidFunction)null_vkDestroyQueryPool },
+	{ "vkDestroyRenderPass", (PFN_vkVoidFunction)null_vkDestroyRenderPass },
+	{ "vkDestroySampler", (PFN_vkVoidFunction)null_vkDestroySampler },
+	{ "vkDestroySamplerYcbcrConversion", (PFN_vkVoidFunction)null_vkDestroySamplerYcbcrConversion },
+	{ "vkDestroySemaphore", (PFN_vkVoidFunction)null_vkDestroySemaphore },
+	{ "vkDestroyShaderModule", (PFN_vkVoidFunction)null_vkDestroyShaderModule },
+	{ "vkDestroySurfaceKHR", (PFN_vkVoidFunction)null_vkDestroySurfaceKHR },
+	{ "vkDestroySwapchainKHR", (PFN_vkVoidFunction)null_vkDestroySwapchainKHR },
+	{ "vkDeviceWaitIdle", (PFN_vkVoidFunction)null_vkDeviceWaitIdle },
+	{ "vkEndCommandBuffer", (PFN_vkVoidFunction)null_vkEndCommandBuffer },
+	{ "vkEnumerateDeviceExtensionProperties", (PFN_vkVoidFunction)null_vkEnumerateDeviceExtensionProperties },
+	{ "vkEnumerateDeviceLayerProperties", (PFN_vkVoidFunction)null_vkEnumerateDeviceLayerProperties },
+	{ "vkEnumerateInstanceExtensionProperties", (PFN_vkVoidFunction)null_vkEnumerateInstanceExtensionProperties },
+	{ "vkEnumerateInstanceLayerProperties", (PFN_vkVoidFunction)null_vkEnumerateInstanceLayerProperties },
+	{ "vkEnumerateInstanceVersion", (PFN_vkVoidFunction)null_vkEnumerateInstanceVersion },
+	{ "vkEnumeratePhysicalDeviceGroups", (PFN_vkVoidFunction)null_vkEnumeratePhysicalDeviceGroups },
+	{ "vkEnumeratePhysicalDevices", (PFN_vkVoidFunction)null_vkEnumeratePhysicalDevices },
+	{ "vkFlushMappedMemoryRanges", (PFN_vkVoidFunction)null_vkFlushMappedMemoryRanges },
+	{ "vkFreeCommandBuffers", (PFN_vkVoidFunction)null_vkFreeCommandBuffers },
+	{ "vkFreeDescriptorSets", (PFN_vkVoidFunction)null_vkFreeDescriptorSets },
+	{ "vkFreeMemory", (PFN_vkVoidFunction)null_vkFreeMemory },
+	{ "vkGetBufferDeviceAddress", (PFN_vkVoidFunction)null_vkGetBufferDeviceAddress },
+	{ "vkGetBufferMemoryRequirements", (PFN_vkVoidFunction)null_vkGetBufferMemoryRequirements },
+	{ "vkGetBufferMemoryRequirements2", (PFN_vkVoidFunction)null_vkGetBufferMemoryRequirements2 },
+	{ "vkGetBufferOpaqueCaptureAddress", (PFN_vkVoidFunction)null_vkGetBufferOpaqueCaptureAddress },
+	{ "vkGetDescriptorSetLayoutSupport", (PFN_vkVoidFunction)null_vkGetDescriptorSetLayoutSupport },
+	{ "vkGetDeviceBufferMemoryRequirements", (PFN_vkVoidFunction)null_vkGetDeviceBufferMemoryRequirements },
+	{ "vkGetDeviceGroupPeerMemoryFeatures", (PFN_vkVoidFunction)null_vkGetDeviceGroupPeerMemoryFeatures },
+	{ "vkGetDeviceGroupPresentCapabilitiesKHR", (PFN_vkVoidFunction)null_vkGetDeviceGroupPresentCapabilitiesKHR },
+	{ "vkGetDeviceGroupSurfacePresentModesKHR", (PFN_vkVoidFunction)null_vkGetDeviceGroupSurfacePresentModesKHR },
+	{ "vkGetDeviceImageMemoryRequirements", (PFN_vkVoidFunction)null_vkGetDeviceImageMemoryRequirements },
+	{ "vkGetDeviceImageSparseMemoryRequirements", (PFN_vkVoidFunction)null_vkGetDeviceImageSparseMemoryRequirements },
+	{ "vkGetDeviceMemoryCommitment", (PFN_vkVoidFunction)null_vkGetDeviceMemoryCommitment },
+	{ "vkGetDeviceMemoryOpaqueCaptureAddress", (PFN_vkVoidFunction)null_vkGetDeviceMemoryOpaqueCaptureAddress },
+	{ "vkGetDeviceProcAddr", (PFN_vkVoidFunction)null_vkGetDeviceProcAddr },
+	{ "vkGetDeviceQueue", (PFN_vkVoidFunction)null_vkGetDeviceQueue },
+	{ "vkGetDeviceQueue2", (PFN_vkVoidFunction)null_vkGetDeviceQueue2 },
+	{ "vkGetDisplayModeProperties2KHR", (PFN_vkVoidFunction)null_vkGetDisplayModeProperties2KHR },
+	{ "vkGetDisplayModePropertiesKHR", (PFN_vkVoidFunction)null_vkGetDisplayModePropertiesKHR },
+	{ "vkGetDisplayPlaneCapabilities2KHR", (PFN_vkVoidFunction)null_vkGetDisplayPlaneCapabilities2KHR },
+	{ "vkGetDisplayPlaneCapabilitiesKHR", (PFN_vkVoidFunction)null_vkGetDisplayPlaneCapabilitiesKHR },
+	{ "vkGetDisplayPlaneSupportedDisplaysKHR", (PFN_vkVoidFunction)null_vkGetDisplayPlaneSupportedDisplaysKHR },
+	{ "vkGetEventStatus", (PFN_vkVoidFunction)null_vkGetEventStatus },
+	{ "vkGetFenceStatus", (PFN_vkVoidFunction)null_vkGetFenceStatus },
+	{ "vkGetImageMemoryRequirements", (PFN_vkVoidFunction)null_vkGetImageMemoryRequirements },
+	{ "vkGetImageMemoryRequirements2", (PFN_vkVoidFunction)null_vkGetImageMemoryRequirements2 },
+	{ "vkGetImageSparseMemoryRequirements", (PFN_vkVoidFunction)null_vkGetImageSparseMemoryRequirements },
+	{ "vkGetImageSparseMemoryRequirements2", (PFN_vkVoidFunction)null_vkGetImageSparseMemoryRequirements2 },
+	{ "vkGetImageSubresourceLayout", (PFN_vkVoidFunction)null_vkGetImageSubresourceLayout },
+	{ "vkGetInstanceProcAddr", (PFN_vkVoidFunction)null_vkGetInstanceProcAddr },
+	{ "vkGetMemoryFdKHR", (PFN_vkVoidFunction)null_vkGetMemoryFdKHR },
+	{ "vkGetMemoryFdPropertiesKHR", (PFN_vkVoidFunction)null_vkGetMemoryFdPropertiesKHR },
+	{ "vkGetPhysicalDeviceDisplayPlaneProperties2KHR", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceDisplayPlaneProperties2KHR },
+	{ "vkGetPhysicalDeviceDisplayPlanePropertiesKHR", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceDisplayPlanePropertiesKHR },
+	{ "vkGetPhysicalDeviceDisplayProperties2KHR", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceDisplayProperties2KHR },
+	{ "vkGetPhysicalDeviceDisplayPropertiesKHR", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceDisplayPropertiesKHR },
+	{ "vkGetPhysicalDeviceExternalBufferProperties", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceExternalBufferProperties },
+	{ "vkGetPhysicalDeviceExternalFenceProperties", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceExternalFenceProperties },
+	{ "vkGetPhysicalDeviceExternalSemaphoreProperties", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceExternalSemaphoreProperties },
+	{ "vkGetPhysicalDeviceFeatures", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceFeatures },
+	{ "vkGetPhysicalDeviceFeatures2", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceFeatures2 },
+	{ "vkGetPhysicalDeviceFormatProperties", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceFormatProperties },
+	{ "vkGetPhysicalDeviceFormatProperties2", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceFormatProperties2 },
+	{ "vkGetPhysicalDeviceImageFormatProperties", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceImageFormatProperties },
+	{ "vkGetPhysicalDeviceImageFormatProperties2", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceImageFormatProperties2 },
+	{ "vkGetPhysicalDeviceMemoryProperties", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceMemoryProperties },
+	{ "vkGetPhysicalDeviceMemoryProperties2", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceMemoryProperties2 },
+	{ "vkGetPhysicalDevicePresentRectanglesKHR", (PFN_vkVoidFunction)null_vkGetPhysicalDevicePresentRectanglesKHR },
+	{ "vkGetPhysicalDeviceProperties", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceProperties },
+	{ "vkGetPhysicalDeviceProperties2", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceProperties2 },
+	{ "vkGetPhysicalDeviceQueueFamilyProperties", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceQueueFamilyProperties },
+	{ "vkGetPhysicalDeviceQueueFamilyProperties2", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceQueueFamilyProperties2 },
+	{ "vkGetPhysicalDeviceSparseImageFormatProperties", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceSparseImageFormatProperties },
+	{ "vkGetPhysicalDeviceSparseImageFormatProperties2", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceSparseImageFormatProperties2 },
+	{ "vkGetPhysicalDeviceSurfaceCapabilities2KHR", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceSurfaceCapabilities2KHR },
+	{ "vkGetPhysicalDeviceSurfaceCapabilitiesKHR", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceSurfaceCapabilitiesKHR },
+	{ "vkGetPhysicalDeviceSurfaceFormats2KHR", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceSurfaceFormats2KHR },
+	{ "vkGetPhysicalDeviceSurfaceFormatsKHR", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceSurfaceFormatsKHR },
+	{ "vkGetPhysicalDeviceSurfacePresentModesKHR", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceSurfacePresentModesKHR },
+	{ "vkGetPhysicalDeviceSurfaceSupportKHR", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceSurfaceSupportKHR },
+	{ "vkGetPhysicalDeviceToolProperties", (PFN_vkVoidFunction)null_vkGetPhysicalDeviceToolProperties },
+	{ "vkGetPipelineCacheData", (PFN_vkVoidFunction)null_vkGetPipelineCacheData },
+	{ "vkGetPrivateData", (PFN_vkVoidFunction)null_vkGetPrivateData },
+	{ "vkGetQueryPoolResults", (PFN_vkVoidFunction)null_vkGetQueryPoolResults },
+	{ "vkGetRenderAreaGranularity", (PFN_vkVoidFunction)null_vkGetRenderAreaGranularity },
+	{ "vkGetSemaphoreCounterValue", (PFN_vkVoidFunction)null_vkGetSemaphoreCounterValue },
+	{ "vkGetSemaphoreFdKHR", (PFN_vkVoidFunction)null_vkGetSemaphoreFdKHR },
+	{ "vkGetSwapchainImagesKHR", (PFN_vkVoidFunction)null_vkGetSwapchainImagesKHR },
+	{ "vkImportSemaphoreFdKHR", (PFN_vkVoidFunction)null_vkImportSemaphoreFdKHR },
+	{ "vkInvalidateMappedMemoryRanges", (PFN_vkVoidFunction)null_vkInvalidateMappedMemoryRanges },
+	{ "vkMapMemory", (PFN_vkVoidFunction)null_vkMapMemory },
+	{ "vkMergePipelineCaches", (PFN_vkVoidFunction)null_vkMergePipelineCaches },
+	{ "vkQueueBindSparse", (PFN_vkVoidFunction)null_vkQueueBindSparse },
+	{ "vkQueuePresentKHR", (PFN_vkVoidFunction)null_vkQueuePresentKHR },
+	{ "vkQueueSubmit", (PFN_vkVoidFunction)null_vkQueueSubmit },
+	{ "vkQueueSubmit2", (PFN_vkVoidFunction)null_vkQueueSubmit2 },
+	{ "vkQueueWaitIdle", (PFN_vkVoidFunction)null_vkQueueWaitIdle },
+	{ "vkResetCommandBuffer", (PFN_vkVoidFunction)null_vkResetCommandBuffer },
+	{ "vkResetCommandPool", (PFN_vkVoidFunction)null_vkResetCommandPool },
+	{ "vkResetDescriptorPool", (PFN_vkVoidFunction)null_vkResetDescriptorPool },
+	{ "vkResetEvent", (PFN_vkVoidFunction)null_vkResetEvent },
+	{ "vkResetFences", (PFN_vkVoidFunction)null_vkResetFences },
+	{ "vkResetQueryPool", (PFN_vkVoidFunction)null_vkResetQueryPool },
+	{ "vkSetEvent", (PFN_vkVoidFunction)null_vkSetEvent },
+	{ "vkSetPrivateData", (PFN_vkVoidFunction)null_vkSetPrivateData },
+	{ "vkSignalSemaphore", (PFN_vkVoidFunction)null_vkSignalSemaphore },
+	{ "vkTrimCommandPool", (PFN_vkVoidFunction)null_vkTrimCommandPool },
+	{ "vkUnmapMemory", (PFN_vkVoidFunction)null_vkUnmapMemory },
+	{ "vkUpdateDescriptorSetWithTemplate", (PFN_vkVoidFunction)null_vkUpdateDescriptorSetWithTemplate },
+	{ "vkUpdateDescriptorSets", (PFN_vkVoidFunction)null_vkUpdateDescriptorSets },
+	{ "vkWaitForFences", (PFN_vkVoidFunction)null_vkWaitForFences },
+	{ "vkWaitSemaphores", (PFN_vkVoidFunction)null_vkWaitSemaphores },
+};
+
+static int null_compare(const void* key, const void* entry) {
+	return strcmp((const char*)key, ((const null_entry*)entry)->name);
+}
+
+static PFN_vkVoidFunction null_lookup(const char* pName) {
+	const null_entry* entry = bsearch(pName, null_entries, VKS_NULL_COMMAND_COUNT, sizeof(null_entry), null_compare);
+	return entry == NULL ? NULL : entry->func;
+}
+
+__attribute__((visibility("default"))) VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetInstanceProcAddr(VkInstance instance, const char* pName) {
+	return null_lookup(pName);
+}
+
+__attribute__((visibility("default"))) VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vkGetDeviceProcAddr(VkDevice device, const char* pName) {
+	return null_lookup(pName);
+}
+
+// Loader-ICD interface, so the driver can also be loaded with vks.OpenICD.
+__attribute__((visibility("default"))) VKAPI_ATTR VkResult VKAPI_CALL vk_icdNegotiateLoaderICDInterfaceVersion(uint32_t* pSupportedVersion) {
+	if (*pSupportedVersion > 5) {
+		*pSupportedVersion = 5;
+	}
+	return VK_SUCCESS;
+}
+
+__attribute__((visibility("default"))) VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vk_icdGetInstanceProcAddr(VkInstance instance, const char* pName) {
+	return null_lookup(pName);
+}
+
+__attribute__((visibility("default"))) VKAPI_ATTR PFN_vkVoidFunction VKAPI_CALL vk_icdGetPhysicalDeviceProcAddr(VkInstance instance, const char* pName) {
+	return null_lookup(pName);
+}
@@ -0,0 +1,181 @@
+package vks
+
+import (
+	"bytes"
+	"encoding/binary"
+	"fmt"
+	"os"
+	"sync/atomic"
+	"syscall"
+	"testing"
+	"unsafe"
+)
+
+// The tests needing a Vulkan implementation run against the null driver,
+// built with make nulldriver, or the library named by VKS_VULKAN_LIBRARY.
+// They are skipped when it cannot be loaded. TestMain asks the null driver to
+// record the arguments of the calls into a shared memory object.
+
+const (
+	nullTestRecords  = 4096
+	nullTestNameSize = 64 // VKS_NULL_NAME_SIZE
+)
+
+// nullRecord is one call recorded by the null driver.
+type nullRecord struct {
+	Command string
+	Args    []uint64
+}
+
+// nullTrace maps the shared memory object of the null driver.
+type nullTrace struct {
+	data     []byte
+	names    []string
+	maxArgs  int
+	capacity uint64
+	records  int // offset of the records
+}
+
+var (
+	nullLoaded bool
+	nullShm    *nullTrace
+)
+
+func TestMain(m *testing.M) {
+	path := os.Getenv("VKS_VULKAN_LIBRARY")
+	if len(path) == 0 {
+		path = "nulldriver/libvks_null.so"
+	}
+	name := fmt.Sprintf("/vks_test_%d", os.Getpid())
+	if _, err := os.Stat(path); err == nil {
+		os.Setenv("VKS_NULL_SHM", name)
+		os.Setenv("VKS_NULL_RECORD", fmt.Sprint(nullTestRecords))
+		nullLoaded = InitLibrary(path).IsSuccess()
+		if nullLoaded {
+			nullShm = openNullTrace("/dev/shm" + name)
+		}
+	}
+	code := m.Run()
+	if nullShm != nil {
+		os.Remove("/dev/shm" + name)
+	}
+	os.Exit(code)
+}
+
+func openNullTrace(path string) *nullTrace {
+	f, err := os.Open(path)
+	if err != nil {
+		return nil
+	}
+	defer f.Close()
+	info, err := f.Stat()
+	if err != nil || info.Size() < 32 {
+		return nil
+	}
+	data, err := syscall.Mmap(int(f.Fd()), 0, int(info.Size()), syscall.PROT_READ, syscall.MAP_SHARED)
+	if err != nil {
+		return nil
+	}
+	if binary.LittleEndian.Uint32(data) != 0x4e534b56 {
+		syscall.Munmap(data)
+		return nil
+	}
+	trace := &nullTrace{
+		data:     data,
+		maxArgs:  int(binary.LittleEndian.Uint32(data[12:])),
+		capacity: binary.LittleEndian.Uint64(data[16:]),
+	}
+	count := int(binary.LittleEndian.Uint32(data[8:]))
+	for k := 0; k < count; k++ {
+		name := data[32+k*nullTestNameSize : 32+(k+1)*nullTestNameSize]
+		trace.names = append(trace.names, string(name[:bytes.IndexByte(name, 0)]))
+	}
+	trace.records = 32 + count*nullTestNameSize + count*8
+	return trace
+}
+
+// head returns the number of calls recorded so far.
+func (trace *nullTrace) head() uint64 {
+	return atomic.LoadUint64((*uint64)(unsafe.Pointer(&trace.data[24])))
+}
+
+// since returns the calls recorded after head start.
+func (trace *nullTrace) since(t *testing.T, start uint64) []nullRecord {
+	end := trace.head()
+	if end-start > trace.capacity {
+		t.Fatalf("%d calls overflow the %d records", end-start, trace.capacity)
+	}
+	size := 16 + 8*trace.maxArgs
+	var records []nullRecord
+	for seq := start + 1; seq <= end; seq++ {
+		rec := trace.data[trace.records+int((seq-1)%trace.capacity)*size:]
+		argCount := int(binary.LittleEndian.Uint32(rec[12:]))
+		record := nullRecord{Command: trace.names[binary.LittleEndian.Uint32(rec[8:])]}
+		for k := 0; k < argCount; k++ {
+			record.Args = append(record.Args, binary.LittleEndian.Uint64(rec[16+8*k:]))
+		}
+		records = append(records, record)
+	}
+	return records
+}
+
+// nullPhysicalDevice creates an instance on the null driver and returns its
+// physical device.
+func nullPhysicalDevice(t testing.TB) PhysicalDeviceFacade {
+	if !nullLoaded {
+		t.Skip("the null driver is not built")
+	}
+	arp := NewAutoReleaser()
+	defer arp.Release()
+	var vkInstance Instance
+	if err := CreateInstance(CPtr(arp, &InstanceCreateInfo{}, SetDefaultSType), nil, &vkInstance).AsErr(); err != nil {
+		t.Fatal(err)
+	}
+	instance := MakeInstanceFacade(vkInstance)
+	t.Cleanup(func() { instance.DestroyInstance(nil) })
+	physicals, result := instance.EnumeratePhysicalDevicesInto(nil)
+	if !result.IsSuccess() || len(physicals) == 0 {
+		t.Fatal("error: no physical device")
+	}
+	return instance.MakePhysicalDeviceFacade(physicals[0])
+}
+
+// nullDevice creates an instance and a device on the null driver.
+func nullDevice(t testing.TB) DeviceFacade {
+	return nullDeviceOf(t, nullPhysicalDevice(t))
+}
+
+// nullDeviceOf creates a device on the physical device of the null driver.
+func nullDeviceOf(t testing.TB, pd PhysicalDeviceFacade) DeviceFacade {
+	arp := NewAutoReleaser()
+	defer arp.Release()
+	var vkDevice Device
+	if err := pd.CreateDevice(CPtr(arp, &DeviceCreateInfo{}, SetDefaultSType), nil, &vkDevice).AsErr(); err != nil {
+		t.Fatal(err)
+	}
+	device := pd.MakeDeviceFacade(vkDevice)
+	t.Cleanup(func() { device.DestroyDevice(nil) })
+	return device
+}
+
+// nullCommandBuffer allocates a primary command buffer on the null driver.
+func nullCommandBuffer(t testing.TB) (DeviceFacade, CommandBufferFacade) {
+	device := nullDevice(t)
+	arp := NewAutoReleaser()
+	defer arp.Release()
+	var vkPool CommandPool
+	if err := device.CreateCommandPool(CPtr(arp, &CommandPoolCreateInfo{}, SetDefaultSType), nil, &vkPool).AsErr(); err != nil {
+		t.Fatal(err)
+	}
+	pool := device.MakeCommandPoolFacade(vkPool)
+	t.Cleanup(func() { device.DestroyCommandPool(vkPool, nil) })
+	info := CPtr(arp, &CommandBufferAllocateInfo{}, SetDefaultSType)
+	info.SetCommandPool(vkPool)
+	info.SetLevel(VK_COMMAND_BUFFER_LEVEL_PRIMARY)
+	info.SetCommandBufferCount(1)
+	cmds := make([]CommandBuffer, 1)
+	if err := device.AllocateCommandBuffers(info, cmds).AsErr(); err != nil {
+		t.Fatal(err)
+	}
+	return device, pool.MakeCommandBufferFacade(cmds[0])
+}
@@ -0,0 +1,578 @@
+//go:build !vks_no_version_1_3 && !vks_no_version_1_1 && !vks_no_version_1_2
+
+package vks
+
+import (
+	"fmt"
+	"image"
+	"image/color"
+	"time"
+	"unsafe"
+)
+
+// offscreenTexelSizes are the formats an OffscreenPool can read back as
+// images, and their texel sizes.
+var offscreenTexelSizes = map[Format]int{
+	VK_FORMAT_R8G8B8A8_UNORM: 4,
+	VK_FORMAT_R8G8B8A8_SRGB:  4,
+	VK_FORMAT_B8G8R8A8_UNORM: 4,
+	VK_FORMAT_B8G8R8A8_SRGB:  4,
+	VK_FORMAT_R8_UNORM:       1,
+}
+
+// OffscreenConfig configures an OffscreenPool.
+type OffscreenConfig struct {
+	Width, Height uint32
+	Format        Format          // One of the 8 bit RGBA, BGRA or R UNORM and SRGB formats.
+	Frames        int             // The number of frames in flight; 2 when zero.
+	Usage         ImageUsageFlags // Added to the color attachment and transfer source usages.
+
+	// Linear renders straight into host visible, linearly tiled images
+	// when the format supports it as a color attachment, skipping the copy
+	// to the readback buffer. Otherwise the images use optimal tiling.
+	Linear bool
+
+	// Budget, when not nil, is consulted before the images and the readback
+	// memory are allocated.
+	Budget MemoryBudgeter
+}
+
+// OffscreenFrame is a render target handed out by OffscreenPool.Acquire.
+type OffscreenFrame struct {
+	Image Image
+	View  ImageView
+	Slot  int
+
+	pool *OffscreenPool
+	seq  uint64
+}
+
+// OffscreenReadback is the content of a rendered frame. Pix aliases the
+// persistently mapped readback memory, so it is only valid until Release,
+// which hands the frame back to the pool.
+type OffscreenReadback struct {
+	Seq    uint64 // The timeline value the frame signaled.
+	Format Format
+	Pix    []byte
+	Stride int
+	Rect   image.Rectangle
+	Err    error // Set when waiting for the frame failed; Pix is nil.
+
+	pool *OffscreenPool
+	slot int
+}
+
+// OffscreenPool is a pool of offscreen color render targets with a ring of
+// persistently mapped readback memory, one region per frame in flight. Frames
+// are acquired, rendered and read back by the caller's command buffers, and
+// their readbacks are delivered in order on the Readbacks channel once the
+// device is done with them. Acquire blocks while every frame is rendering or
+// still held by a consumer, so slow consumers apply backpressure to the
+// renderer.
+//
+// The per frame usage is Acquire, recording the rendering followed by
+// CmdReadback, submitting with Signal in the signal semaphores, and Queue.
+// The device must be created with the timelineSemaphore and synchronization2
+// features enabled.
+type OffscreenPool struct {
+	device    DeviceFacade
+	extent    Extent3D
+	format    Format
+	texelSize int
+	linear    bool
+	budget    MemoryBudgeter
+
+	images   []Image
+	views    []ImageView
+	memories []DeviceMemory // Per image; host visible when linear.
+	mapped   [][]byte       // Per slot readback memory.
+	strides  []int
+
+	buffer     Buffer // The readback ring; unused when linear.
+	memory     DeviceMemory
+	regionSize DeviceSize
+	coherent   bool
+	memFlags   MemoryPropertyFlags // Of the readback memory.
+
+	timeline Semaphore
+	seq      uint64
+
+	free      chan int
+	pending   chan *OffscreenFrame
+	readbacks chan *OffscreenReadback
+
+	// C memory used by the waiting goroutine.
+	waitInfo  *SemaphoreWaitInfo
+	waitSem   []Semaphore
+	waitValue []uint64
+	invalid   *MappedMemoryRange
+}
+
+// NewOffscreenPool creates the render targets, the readback memory and the
+// timeline semaphore of the pool, and starts the goroutine delivering the
+// readbacks. caps provides the memory properties, limits and format features
+// of the physical device.
+func NewOffscreenPool(device DeviceFacade, caps *DeviceCapabilities, config OffscreenConfig) (*OffscreenPool, error) {
+	texelSize, ok := offscreenTexelSizes[config.Format]
+	if !ok {
+		return nil, fmt.Errorf("error: offscreen readback of %v is not supported", config.Format)
+	}
+	if config.Frames == 0 {
+		config.Frames = 2
+	}
+	if config.Frames < 1 || config.Width == 0 || config.Height == 0 {
+		return nil, fmt.Errorf("error: offscreen pool needs at least one frame of non-zero size, got %d of %dx%d", config.Frames, config.Width, config.Height)
+	}
+	pool := &OffscreenPool{
+		device:    device,
+		extent:    Extent3D{}.WithWidth(config.Width).WithHeight(config.Height).WithDepth(1),
+		format:    config.Format,
+		texelSize: texelSize,
+		budget:    config.Budget,
+		images:    make([]Image, config.Frames),
+		views:     make([]ImageView, config.Frames),
+		memories:  make([]DeviceMemory, config.Frames),
+		mapped:    make([][]byte, config.Frames),
+		strides:   make([]int, config.Frames),
+		free:      make(chan int, config.Frames),
+		pending:   make(chan *OffscreenFrame, config.Frames),
+		readbacks: make(chan *OffscreenReadback, config.Frames),
+	}
+	if config.Linear {
+		features, _ := caps.Format(config.Format)
+		pool.linear = features.LinearTilingFeatures&FormatFeatureFlags2(VK_FORMAT_FEATURE_2_COLOR_ATTACHMENT_BIT) != 0
+	}
+
+	err := pool.createImages(caps, config.Usage)
+	if err != nil && pool.linear {
+		// No host visible memory for linear images, use the copy instead.
+		pool.destroyImages()
+		pool.linear = false
+		err = pool.createImages(caps, config.Usage)
+	}
+	if err == nil && !pool.linear {
+		err = pool.createBuffer(caps)
+	}
+	if err == nil {
+		err = pool.createSync()
+	}
+	if err != nil {
+		pool.destroyImages()
+		pool.destroySync()
+		return nil, err
+	}
+
+	for h := range pool.images {
+		pool.free <- h
+	}
+	go pool.wait()
+	return pool, nil
+}
+
+func (pool *OffscreenPool) createImages(caps *DeviceCapabilities, usage ImageUsageFlags) error {
+	info := &ImageCreateInfo{}
+	info.SetDefaultSType()
+	info.SetImageType(VK_IMAGE_TYPE_2D)
+	info.SetFormat(pool.format)
+	info.SetExtent(pool.extent)
+	info.SetMipLevels(1)
+	info.SetArrayLayers(1)
+	info.SetSamples(VK_SAMPLE_COUNT_1_BIT)
+	info.SetSharingMode(VK_SHARING_MODE_EXCLUSIVE)
+	info.SetInitialLayout(VK_IMAGE_LAYOUT_UNDEFINED)
+	usage |= ImageUsageFlags(VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT)
+	preferred := MemoryPropertyFlags(VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT)
+	var required MemoryPropertyFlags
+	if pool.linear {
+		info.SetTiling(VK_IMAGE_TILING_LINEAR)
+		preferred = MemoryPropertyFlags(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_CACHED_BIT)
+		required = MemoryPropertyFlags(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+	} else {
+		info.SetTiling(VK_IMAGE_TILING_OPTIMAL)
+		usage |= ImageUsageFlags(VK_IMAGE_USAGE_TRANSFER_SRC_BIT)
+	}
+	info.SetUsage(usage)
+
+	pool.coherent = true
+	pool.memFlags = ^MemoryPropertyFlags(0)
+	for h := range pool.images {
+		var img Image
+		if err := pool.device.CreateImage(info, nil, &img).AsErr(); err != nil {
+			return err
+		}
+		pool.images[h] = img
+		var reqs MemoryRequirements
+		pool.device.GetImageMemoryRequirements(img, &reqs)
+		memory, flags, err := allocateMemory(pool.device, pool.budget, &caps.Memory, reqs, preferred, required)
+		if err != nil {
+			return err
+		}
+		pool.memories[h] = memory
+		if err := pool.device.BindImageMemory(img, memory, 0).AsErr(); err != nil {
+			return err
+		}
+
+		vInfo := ImageViewCreateInfo{}.
+			WithDefaultSType().
+			WithImage(img).
+			WithViewType(VK_IMAGE_VIEW_TYPE_2D).
+			WithFormat(pool.format).
+			WithSubresourceRange(colorSubresourceRange())
+		var view ImageView
+		if err := pool.device.CreateImageView(&vInfo, nil, &view).AsErr(); err != nil {
+			return err
+		}
+		pool.views[h] = view
+
+		if pool.linear {
+			pool.coherent = pool.coherent && flags&MemoryPropertyFlags(VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0
+			pool.memFlags &= flags
+			subresource := ImageSubresource{}.WithAspectMask(ImageAspectFlags(VK_IMAGE_ASPECT_COLOR_BIT))
+			var layout SubresourceLayout
+			pool.device.GetImageSubresourceLayout(img, &subresource, &layout)
+			var pData unsafe.Pointer
+			if err := pool.device.MapMemory(memory, 0, DeviceSize(VK_WHOLE_SIZE), 0, &pData).AsErr(); err != nil {
+				return err
+			}
+			pool.strides[h] = int(layout.RowPitch())
+			pool.mapped[h] = unsafe.Slice((*byte)(unsafe.Add(pData, layout.Offset())), pool.pixSize(pool.strides[h]))
+		}
+	}
+	return nil
+}
+
+func (pool *OffscreenPool) createBuffer(caps *DeviceCapabilities) error {
+	limits := caps.Properties.LimitsView()
+	stride := int(pool.extent.Width()) * pool.texelSize
+	// Regions are invalidated on their own, and copies need texel aligned
+	// buffer offsets.
+	align := maxDeviceSize(limits.NonCoherentAtomSize(), DeviceSize(pool.texelSize))
+	pool.regionSize = alignDeviceSize(DeviceSize(pool.pixSize(stride)), maxDeviceSize(align, 4))
+
+	info := &BufferCreateInfo{}
+	info.SetDefaultSType()
+	info.SetSize(pool.regionSize * DeviceSize(len(pool.images)))
+	info.SetUsage(BufferUsageFlags(VK_BUFFER_USAGE_TRANSFER_DST_BIT))
+	info.SetSharingMode(VK_SHARING_MODE_EXCLUSIVE)
+	hostVisible := MemoryPropertyFlags(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+	hostCached := MemoryPropertyFlags(VK_MEMORY_PROPERTY_HOST_CACHED_BIT)
+	buffer, memory, flags, err := allocateBuffer(pool.device, pool.budget, info, &caps.Memory, hostVisible|hostCached, hostVisible)
+	if err != nil {
+		return err
+	}
+	pool.buffer, pool.memory = buffer, memory
+	pool.coherent = flags&MemoryPropertyFlags(VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) != 0
+	pool.memFlags = flags
+
+	var pData unsafe.Pointer
+	if err := pool.device.MapMemory(pool.memory, 0, DeviceSize(VK_WHOLE_SIZE), 0, &pData).AsErr(); err != nil {
+		return err
+	}
+	all := unsafe.Slice((*byte)(pData), pool.regionSize*DeviceSize(len(pool.images)))
+	for h := range pool.mapped {
+		base := int(pool.regionSize) * h
+		pool.mapped[h] = all[base : base+pool.pixSize(stride) : base+pool.pixSize(stride)]
+		pool.strides[h] = stride
+	}
+	return nil
+}
+
+func (pool *OffscreenPool) createSync() error {
+	arp := NewAutoReleaser()
+	defer arp.Release()
+
+	typeInfo := &SemaphoreTypeCreateInfo{}
+	typeInfo.SetDefaultSType()
+	typeInfo.SetSemaphoreType(VK_SEMAPHORE_TYPE_TIMELINE)
+	info := &SemaphoreCreateInfo{}
+	info.SetDefaultSType()
+	info.PinPNext(arp, unsafe.Pointer(typeInfo))
+	var semaphore Semaphore
+	if err := pool.device.CreateSemaphore(info, nil, &semaphore).AsErr(); err != nil {
+		return err
+	}
+	pool.timeline = semaphore
+
+	pool.waitSem = unsafe.Slice((*Semaphore)(newCBlock(cULong(unsafe.Sizeof(NullSemaphore)))), 1)
+	pool.waitValue = unsafe.Slice((*uint64)(newCBlock(cULong(unsafe.Sizeof(uint64(0))))), 1)
+	pool.waitSem[0] = pool.timeline
+	pool.waitInfo = SemaphoreWaitInfo{}.
+		WithDefaultSType().
+		WithPSemaphores(pool.waitSem).
+		WithPValues(pool.waitValue).
+		AsCPtr()
+	pool.invalid = MappedMemoryRange{}.
+		WithDefaultSType().
+		AsCPtr()
+	return nil
+}
+
+// pixSize returns the number of bytes from the first to the last texel of an
+// image with the provided row pitch.
+func (pool *OffscreenPool) pixSize(stride int) int {
+	return stride*(int(pool.extent.Height())-1) + int(pool.extent.Width())*pool.texelSize
+}
+
+// Linear reports if the frames are rendered straight into host visible
+// memory.
+func (pool *OffscreenPool) Linear() bool {
+	return pool.linear
+}
+
+// Readbacks returns the channel the readbacks are delivered on, in the order
+// the frames were queued. It is closed by Destroy.
+func (pool *OffscreenPool) Readbacks() <-chan *OffscreenReadback {
+	return pool.readbacks
+}
+
+// Acquire returns a frame to render into, waiting up to timeout nanoseconds
+// for a frame to be released. It returns the VK_TIMEOUT error when none is.
+func (pool *OffscreenPool) Acquire(timeout uint64) (*OffscreenFrame, error) {
+	var slot int
+	select {
+	case slot = <-pool.free:
+	default:
+		if timeout == 0 {
+			return nil, VK_TIMEOUT.AsErr()
+		}
+		var expired <-chan time.Time
+		if timeout < uint64(1<<63-1) {
+			timer := time.NewTimer(time.Duration(timeout))
+			defer timer.Stop()
+			expired = timer.C
+		}
+		select {
+		case slot = <-pool.free:
+		case <-expired:
+			return nil, VK_TIMEOUT.AsErr()
+		}
+	}
+	return &OffscreenFrame{
+		Image: pool.images[slot],
+		View:  pool.views[slot],
+		Slot:  slot,
+		pool:  pool,
+	}, nil
+}
+
+// Signal returns the timeline semaphore signal the submission rendering the
+// frame must include. Frames must be submitted in the order Signal is called.
+func (frame *OffscreenFrame) Signal() SemaphoreSubmitInfo {
+	if frame.seq == 0 {
+		frame.pool.seq++
+		frame.seq = frame.pool.seq
+	}
+	return SemaphoreSubmitInfo{}.
+		WithDefaultSType().
+		WithSemaphore(frame.pool.timeline).
+		WithValue(frame.seq).
+		WithStageMask(PipelineStageFlags2(VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT))
+}
+
+// CmdReadback records the readback of the frame after its rendering. layout
+// is the layout the rendering left the image in, usually
+// VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL. The image is copied to the
+// frame's region of the readback ring, or, for linear frames, transitioned to
+// the general layout and made visible to the host in place.
+func (frame *OffscreenFrame) CmdReadback(cmd CommandBufferFacade, layout ImageLayout) {
+	pool := frame.pool
+	arp := NewAutoReleaser()
+	defer arp.Release()
+
+	barrier := ImageMemoryBarrier2{}.
+		WithDefaultSType().
+		WithSrcStageMask(PipelineStageFlags2(VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT)).
+		WithSrcAccessMask(AccessFlags2(VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT)).
+		WithOldLayout(layout).
+		WithSrcQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED).
+		WithDstQueueFamilyIndex(VK_QUEUE_FAMILY_IGNORED).
+		WithImage(frame.Image).
+		WithSubresourceRange(colorSubresourceRange())
+	host := MemoryBarrier2{}.
+		WithDefaultSType().
+		WithDstStageMask(PipelineStageFlags2(VK_PIPELINE_STAGE_2_HOST_BIT)).
+		WithDstAccessMask(AccessFlags2(VK_ACCESS_2_HOST_READ_BIT))
+
+	if pool.linear {
+		barrier.SetDstStageMask(PipelineStageFlags2(VK_PIPELINE_STAGE_2_HOST_BIT))
+		barrier.SetDstAccessMask(AccessFlags2(VK_ACCESS_2_HOST_READ_BIT))
+		barrier.SetNewLayout(VK_IMAGE_LAYOUT_GENERAL)
+		dependency := DependencyInfo{}.WithDefaultSType()
+		dependency.PinPImageMemoryBarriers(arp, []ImageMemoryBarrier2{barrier})
+		cmd.CmdPipelineBarrier2(&dependency)
+		return
+	}
+
+	barrier.SetDstStageMask(PipelineStageFlags2(VK_PIPELINE_STAGE_2_COPY_BIT))
+	barrier.SetDstAccessMask(AccessFlags2(VK_ACCESS_2_TRANSFER_READ_BIT))
+	barrier.SetNewLayout(VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL)
+	toCopy := DependencyInfo{}.WithDefaultSType()
+	toCopy.PinPImageMemoryBarriers(arp, []ImageMemoryBarrier2{barrier})
+	cmd.CmdPipelineBarrier2(&toCopy)
+
+	region := BufferImageCopy2{}.
+		WithDefaultSType().
+		WithBufferOffset(pool.regionSize * DeviceSize(frame.Slot)).
+		WithImageSubresource(ImageSubresourceLayers{}.
+			WithAspectMask(ImageAspectFlags(VK_IMAGE_ASPECT_COLOR_BIT)).
+			WithLayerCount(1)).
+		WithImageExtent(pool.extent)
+	copyInfo := CopyImageToBufferInfo2{}.
+		WithDefaultSType().
+		WithSrcImage(frame.Image).
+		WithSrcImageLayout(VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL).
+		WithDstBuffer(pool.buffer)
+	copyInfo.PinPRegions(arp, []BufferImageCopy2{region})
+	cmd.CmdCopyImageToBuffer2(&copyInfo)
+
+	host.SetSrcStageMask(PipelineStageFlags2(VK_PIPELINE_STAGE_2_COPY_BIT))
+	host.SetSrcAccessMask(AccessFlags2(VK_ACCESS_2_TRANSFER_WRITE_BIT))
+	toHost := DependencyInfo{}.WithDefaultSType()
+	toHost.PinPMemoryBarriers(arp, []MemoryBarrier2{host})
+	cmd.CmdPipelineBarrier2(&toHost)
+}
+
+// Queue hands the frame to the goroutine delivering the readbacks. It must be
+// called after the submission including Signal.
+func (pool *OffscreenPool) Queue(frame *OffscreenFrame) {
+	frame.Signal()
+	pool.pending <- frame
+}
+
+// Image returns the readback as an image.Image aliasing Pix: an *image.RGBA
+// for RGBA formats, a *BGRAImage for BGRA formats and an *image.Gray for R8.
+// The RGBA and BGRA colors are not premultiplied by the device, so the alpha
+// channel is only meaningful for opaque renderings.
+func (rb *OffscreenReadback) Image() image.Image {
+	switch rb.Format {
+	case VK_FORMAT_R8G8B8A8_UNORM, VK_FORMAT_R8G8B8A8_SRGB:
+		return &image.RGBA{Pix: rb.Pix, Stride: rb.Stride, Rect: rb.Rect}
+	case VK_FORMAT_B8G8R8A8_UNORM, VK_FORMAT_B8G8R8A8_SRGB:
+		return &BGRAImage{Pix: rb.Pix, Stride: rb.Stride, Rect: rb.Rect}
+	case VK_FORMAT_R8_UNORM:
+		return &image.Gray{Pix: rb.Pix, Stride: rb.Stride, Rect: rb.Rect}
+	}
+	return nil
+}
+
+// CopyPix copies Pix into dst and returns the number of bytes copied, with
+// streaming loads when the readback memory is not host cached. Reading the
+// texels once this way is faster than reading them in place, and lets the
+// frame be released before they are processed. See CopyFromMapped.
+func (rb *OffscreenReadback) CopyPix(dst []byte) int {
+	return CopyFromMapped(dst, rb.Pix, rb.pool.memFlags)
+}
+
+// Release hands the frame back to the pool. Pix and the images returned by
+// Image must not be used afterwards.
+func (rb *OffscreenReadback) Release() {
+	rb.Pix = nil
+	rb.pool.free <- rb.slot
+}
+
+// wait delivers the queued frames once the device is done with them.
+func (pool *OffscreenPool) wait() {
+	for frame := range pool.pending {
+		rb := &OffscreenReadback{
+			Seq:    frame.seq,
+			Format: pool.format,
+			Stride: pool.strides[frame.Slot],
+			Rect:   image.Rect(0, 0, int(pool.extent.Width()), int(pool.extent.Height())),
+			pool:   pool,
+			slot:   frame.Slot,
+		}
+		pool.waitValue[0] = frame.seq
+		rb.Err = pool.device.WaitSemaphores(pool.waitInfo, ^uint64(0)).AsErr()
+		if rb.Err == nil && !pool.coherent {
+			if pool.linear {
+				pool.invalid.SetMemory(pool.memories[frame.Slot])
+				pool.invalid.SetOffset(0)
+			} else {
+				pool.invalid.SetMemory(pool.memory)
+				pool.invalid.SetOffset(pool.regionSize * DeviceSize(frame.Slot))
+			}
+			pool.invalid.SetSize(DeviceSize(VK_WHOLE_SIZE))
+			rb.Err = pool.device.InvalidateMappedMemoryRanges(1, unsafe.Slice(pool.invalid, 1)).AsErr()
+		}
+		if rb.Err == nil {
+			rb.Pix = pool.mapped[frame.Slot]
+		}
+		pool.readbacks <- rb
+	}
+	close(pool.readbacks)
+}
+
+// Destroy waits for the queued frames, then destroys the render targets,
+// readback memory and semaphore. Readbacks not received yet are dropped, and
+// the Pix of received ones must not be used afterwards; releasing them stays
+// safe. Frames acquired but not queued must not be in use by the device.
+func (pool *OffscreenPool) Destroy() {
+	close(pool.pending)
+	for range pool.readbacks {
+	}
+	pool.destroyImages()
+	pool.destroySync()
+}
+
+func (pool *OffscreenPool) destroyImages() {
+	for h := range pool.images {
+		pool.device.DestroyImageView(pool.views[h], nil)
+		pool.device.DestroyImage(pool.images[h], nil)
+		if pool.linear && pool.mapped[h] != nil {
+			pool.device.UnmapMemory(pool.memories[h])
+		}
+		freeMemory(pool.device, pool.budget, pool.memories[h])
+		pool.images[h], pool.views[h], pool.memories[h], pool.mapped[h] = NullImage, NullImageView, NullDeviceMemory, nil
+	}
+	if pool.buffer != NullBuffer {
+		pool.device.UnmapMemory(pool.memory)
+	}
+	pool.device.DestroyBuffer(pool.buffer, nil)
+	freeMemory(pool.device, pool.budget, pool.memory)
+	pool.buffer, pool.memory = NullBuffer, NullDeviceMemory
+}
+
+func (pool *OffscreenPool) destroySync() {
+	pool.device.DestroySemaphore(pool.timeline, nil)
+	if pool.waitInfo != nil {
+		pool.waitInfo.Free()
+		cFreer(uintptr(unsafe.Pointer(&pool.waitSem[0]))).Free()
+		cFreer(uintptr(unsafe.Pointer(&pool.waitValue[0]))).Free()
+		pool.invalid.Free()
+		pool.waitInfo = nil
+	}
+}
+
+func colorSubresourceRange() ImageSubresourceRange {
+	return ImageSubresourceRange{}.
+		WithAspectMask(ImageAspectFlags(VK_IMAGE_ASPECT_COLOR_BIT)).
+		WithLevelCount(1).
+		WithLayerCount(1)
+}
+
+// BGRAImage is an in-memory image of 8 bit BGRA pixels, the layout of the
+// B8G8R8A8 formats. It is the BGRA counterpart of image.RGBA.
+type BGRAImage struct {
+	Pix    []uint8
+	Stride int
+	Rect   image.Rectangle
+}
+
+func (img *BGRAImage) ColorModel() color.Model { return color.RGBAModel }
+
+func (img *BGRAImage) Bounds() image.Rectangle { return img.Rect }
+
+func (img *BGRAImage) At(x, y int) color.Color {
+	if !(image.Point{x, y}.In(img.Rect)) {
+		return color.RGBA{}
+	}
+	h := img.PixOffset(x, y)
+	s := img.Pix[h : h+4 : h+4]
+	return color.RGBA{s[2], s[1], s[0], s[3]}
+}
+
+// PixOffset returns the index of the first element of Pix that corresponds to
+// the pixel at (x, y).
+func (img *BGRAImage) PixOffset(x, y int) int {
+	return (y-img.Rect.Min.Y)*img.Stride + (x-img.Rect.Min.X)*4
+}
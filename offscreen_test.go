@@ -0,0 +1,86 @@
+//go:build !vks_no_version_1_3 && !vks_no_version_1_1 && !vks_no_version_1_2
+
+package vks
+
+import (
+	"image"
+	"testing"
+	"time"
+)
+
+func TestOffscreenPoolBackpressure(t *testing.T) {
+	pd := nullPhysicalDevice(t)
+	device := nullDeviceOf(t, pd)
+	pool, err := NewOffscreenPool(device, QueryDeviceCapabilities(pd), OffscreenConfig{
+		Width:  4,
+		Height: 2,
+		Format: VK_FORMAT_R8G8B8A8_UNORM,
+		Frames: 2,
+	})
+	if err != nil {
+		t.Fatal(err)
+	}
+	defer pool.Destroy()
+
+	var frames []*OffscreenFrame
+	for k := 0; k < 2; k++ {
+		frame, err := pool.Acquire(0)
+		if err != nil {
+			t.Fatal(err)
+		}
+		frames = append(frames, frame)
+	}
+	if frames[0].Slot == frames[1].Slot {
+		t.Fatalf("acquired slot %d twice", frames[0].Slot)
+	}
+	for _, timeout := range []uint64{0, uint64(time.Millisecond)} {
+		if _, err := pool.Acquire(timeout); err == nil || err.Error() != VK_TIMEOUT.AsErr().Error() {
+			t.Errorf("Acquire(%d) with every frame rendering returned %v, want VK_TIMEOUT", timeout, err)
+		}
+	}
+
+	// The readbacks are delivered in Signal order.
+	frames[1].Signal()
+	frames[0].Signal()
+	pool.Queue(frames[1])
+	pool.Queue(frames[0])
+	var readbacks []*OffscreenReadback
+	for k := 0; k < 2; k++ {
+		rb := <-pool.Readbacks()
+		if rb.Err != nil {
+			t.Fatal(rb.Err)
+		}
+		readbacks = append(readbacks, rb)
+	}
+	if readbacks[0].Seq != 1 || readbacks[0].slot != frames[1].Slot || readbacks[1].Seq != 2 {
+		t.Errorf("received readbacks %d of slot %d and %d, want 1 of slot %d and 2", readbacks[0].Seq, readbacks[0].slot, readbacks[1].Seq, frames[1].Slot)
+	}
+	rb := readbacks[0]
+	if len(rb.Pix) < rb.Stride+4*4 || rb.Rect != image.Rect(0, 0, 4, 2) {
+		t.Errorf("readback has %d bytes with a stride of %d for %v", len(rb.Pix), rb.Stride, rb.Rect)
+	}
+	if _, ok := rb.Image().(*image.RGBA); !ok {
+		t.Errorf("Image returned a %T, want an *image.RGBA", rb.Image())
+	}
+
+	// Frames held by consumers are not handed out again until released.
+	if _, err := pool.Acquire(0); err == nil {
+		t.Error("acquired a frame held by a consumer")
+	}
+	acquired := make(chan *OffscreenFrame)
+	go func() {
+		frame, _ := pool.Acquire(^uint64(0))
+		acquired <- frame
+	}()
+	time.Sleep(10 * time.Millisecond)
+	select {
+	case <-acquired:
+		t.Fatal("Acquire returned before a frame was released")
+	default:
+	}
+	rb.Release()
+	if frame := <-acquired; frame == nil || frame.Slot != rb.slot {
+		t.Errorf("Acquire returned %v after releasing slot %d", frame, rb.slot)
+	}
+	readbacks[1].Release()
+}
@@ -0,0 +1,562 @@
+//go:build !vks_no_version_1_3 && !vks_no_version_1_1 && !vks_no_version_1_2 && !vks_no_khr_pipeline_library && !vks_no_ext_graphics_pipeline_library
+
+package vks
+
+import (
+	"crypto/sha256"
+	"encoding/binary"
+	"fmt"
+	"hash"
+	"sync"
+	"unsafe"
+)
+
+// PipelineShader is a shader stage of a pipeline library part.
+type PipelineShader struct {
+	Stage          ShaderStageFlagBits
+	SPIRV          []uint32
+	EntryPoint     string // "main" when empty.
+	Specialization []SpecializationConstant
+}
+
+// VertexInputPart is the vertex input interface of a graphics pipeline: the
+// vertex format and the primitive topology.
+type VertexInputPart struct {
+	Bindings         []VertexInputBindingDescription
+	Attributes       []VertexInputAttributeDescription
+	Topology         PrimitiveTopology
+	PrimitiveRestart bool
+}
+
+// PreRasterizationPart is the pre-rasterization shaders of a graphics pipeline,
+// usually a vertex shader, and the rasterization state. The viewport and
+// scissor are dynamic, with one of each.
+type PreRasterizationPart struct {
+	Shaders     []PipelineShader
+	PolygonMode PolygonMode
+	CullMode    CullModeFlags
+	FrontFace   FrontFace
+	DepthClamp  bool
+}
+
+// FragmentShaderPart is the fragment shader of a graphics pipeline and the
+// depth test.
+type FragmentShaderPart struct {
+	Shader       PipelineShader
+	DepthTest    bool
+	DepthWrite   bool
+	DepthCompare CompareOp
+}
+
+// FragmentOutputPart is the fragment output interface of a graphics pipeline:
+// the dynamic rendering attachment formats, the sample count and the color
+// blending.
+type FragmentOutputPart struct {
+	ColorFormats  []Format
+	DepthFormat   Format
+	StencilFormat Format
+	Samples       SampleCountFlagBits // 1 when zero.
+
+	// Blend is the blend state of every color attachment. When shorter
+	// than ColorFormats, the other attachments write every component
+	// without blending.
+	Blend []PipelineColorBlendAttachmentState
+}
+
+// PipelineLibrary is a compiled part of a graphics pipeline.
+type PipelineLibrary struct {
+	H    Pipeline
+	part GraphicsPipelineLibraryFlagBitsEXT
+}
+
+// PipelineLibrariesConfig configures PipelineLibraries.
+type PipelineLibrariesConfig struct {
+	// Layout is the layout of every pipeline. It is owned by the caller.
+	Layout PipelineLayout
+
+	// Cache is used to compile the parts and the optimized pipelines. It
+	// is owned by the caller and may be NullPipelineCache.
+	Cache PipelineCache
+
+	// Optimize relinks every linked pipeline with link time optimization
+	// in the background; Link returns the optimized pipeline once it is
+	// ready.
+	Optimize bool
+
+	// Optimizers is the number of pipelines optimized at once; 1 when
+	// zero.
+	Optimizers int
+}
+
+// linkedPipeline is a pipeline linked from four libraries.
+type linkedPipeline struct {
+	fast      Pipeline
+	optimized Pipeline
+}
+
+// PipelineLibraries compiles the four parts of graphics pipelines separately
+// with VK_EXT_graphics_pipeline_library, caches them, and links them into
+// complete pipelines on demand. A new combination of parts only costs a link,
+// which is fast on drivers reporting graphicsPipelineLibraryFastLinking,
+// instead of the compilation of every shader. With Optimize, every linked
+// pipeline is also relinked with link time optimization on another goroutine,
+// and Link returns the optimized pipeline from then on.
+//
+// The device must be created with VK_KHR_pipeline_library,
+// VK_EXT_graphics_pipeline_library and its graphicsPipelineLibrary feature
+// enabled. The pipelines use dynamic rendering, with a dynamic viewport and
+// scissor. The methods are safe for concurrent use; parts are compiled one at
+// a time.
+type PipelineLibraries struct {
+	device   DeviceFacade
+	layout   PipelineLayout
+	cache    PipelineCache
+	optimize bool
+
+	lock       sync.Mutex
+	parts      map[[sha256.Size]byte]Pipeline
+	linked     map[[4]Pipeline]*linkedPipeline
+	closed     bool
+	optimizers chan struct{}
+	running    sync.WaitGroup
+}
+
+// GraphicsPipelineLibrarySupported reports if the physical device supports
+// VK_EXT_graphics_pipeline_library and its graphicsPipelineLibrary feature,
+// and if linking is fast.
+func GraphicsPipelineLibrarySupported(pd PhysicalDeviceFacade) (supported, fastLinking bool) {
+	props, result := pd.EnumerateDeviceExtensionPropertiesInto(nil, nil)
+	if !result.IsSuccess() {
+		return false, false
+	}
+	found := 0
+	for _, p := range props {
+		switch ToStringView(p.ExtensionName()) {
+		case VK_KHR_PIPELINE_LIBRARY_EXTENSION_NAME, VK_EXT_GRAPHICS_PIPELINE_LIBRARY_EXTENSION_NAME:
+			found++
+		}
+	}
+	if found < 2 {
+		return false, false
+	}
+
+	arp := NewAutoReleaser()
+	defer arp.Release()
+	gplFeatures := &PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT{}
+	gplFeatures.SetDefaultSType()
+	features := &PhysicalDeviceFeatures2{}
+	features.SetDefaultSType()
+	features.PinPNext(arp, unsafe.Pointer(gplFeatures))
+	pd.GetPhysicalDeviceFeatures2(features)
+	gplProps := &PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT{}
+	gplProps.SetDefaultSType()
+	properties := &PhysicalDeviceProperties2{}
+	properties.SetDefaultSType()
+	properties.PinPNext(arp, unsafe.Pointer(gplProps))
+	pd.GetPhysicalDeviceProperties2(properties)
+	return gplFeatures.GraphicsPipelineLibrary().IsTrue(), gplProps.GraphicsPipelineLibraryFastLinking().IsTrue()
+}
+
+// NewPipelineLibraries creates a pipeline library manager.
+func NewPipelineLibraries(device DeviceFacade, config PipelineLibrariesConfig) *PipelineLibraries {
+	if config.Optimizers <= 0 {
+		config.Optimizers = 1
+	}
+	return &PipelineLibraries{
+		device:     device,
+		layout:     config.Layout,
+		cache:      config.Cache,
+		optimize:   config.Optimize,
+		parts:      make(map[[sha256.Size]byte]Pipeline),
+		linked:     make(map[[4]Pipeline]*linkedPipeline),
+		optimizers: make(chan struct{}, config.Optimizers),
+	}
+}
+
+// libraryHash hashes the description of a part.
+type libraryHash struct {
+	hash.Hash
+}
+
+func newLibraryHash(part GraphicsPipelineLibraryFlagBitsEXT) libraryHash {
+	h := libraryHash{sha256.New()}
+	h.uint32(uint32(part))
+	return h
+}
+
+func (h libraryHash) uint32(values ...uint32) {
+	var b [4]byte
+	for _, v := range values {
+		binary.LittleEndian.PutUint32(b[:], v)
+		h.Write(b[:])
+	}
+}
+
+func (h libraryHash) bool(v bool) {
+	if v {
+		h.uint32(1)
+	} else {
+		h.uint32(0)
+	}
+}
+
+// raw hashes the bytes of n plain C structures.
+func (h libraryHash) raw(ptr unsafe.Pointer, size, n int) {
+	h.uint32(uint32(n))
+	if n > 0 {
+		h.Write(unsafe.Slice((*byte)(ptr), size*n))
+	}
+}
+
+func (h libraryHash) shader(shader *PipelineShader) {
+	h.uint32(uint32(shader.Stage), uint32(len(shader.SPIRV)))
+	h.raw(unsafe.Pointer(unsafe.SliceData(shader.SPIRV)), 4, len(shader.SPIRV))
+	h.uint32(uint32(len(shader.EntryPoint)))
+	h.Write([]byte(shader.EntryPoint))
+	for _, c := range shader.Specialization {
+		h.uint32(c.ID, c.Value)
+	}
+}
+
+func (h libraryHash) key() (key [sha256.Size]byte) {
+	h.Sum(key[:0])
+	return key
+}
+
+// VertexInput returns the library of the vertex input part, compiling it on
+// first use.
+func (libs *PipelineLibraries) VertexInput(part *VertexInputPart) (PipelineLibrary, error) {
+	h := newLibraryHash(VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT)
+	h.raw(unsafe.Pointer(unsafe.SliceData(part.Bindings)), SizeofVertexInputBindingDescription, len(part.Bindings))
+	h.raw(unsafe.Pointer(unsafe.SliceData(part.Attributes)), SizeofVertexInputAttributeDescription, len(part.Attributes))
+	h.uint32(uint32(part.Topology))
+	h.bool(part.PrimitiveRestart)
+
+	return libs.library(VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT, h.key(), func(arp *AutoReleasePool, info *GraphicsPipelineCreateInfo) error {
+		vertexInput := &PipelineVertexInputStateCreateInfo{}
+		vertexInput.SetDefaultSType()
+		if len(part.Bindings) > 0 {
+			vertexInput.PinPVertexBindingDescriptions(arp, part.Bindings)
+		}
+		if len(part.Attributes) > 0 {
+			vertexInput.PinPVertexAttributeDescriptions(arp, part.Attributes)
+		}
+		inputAssembly := &PipelineInputAssemblyStateCreateInfo{}
+		inputAssembly.SetDefaultSType()
+		inputAssembly.SetTopology(part.Topology)
+		inputAssembly.SetPrimitiveRestartEnable(MakeBool32(part.PrimitiveRestart))
+		info.PinPVertexInputState(arp, vertexInput)
+		info.PinPInputAssemblyState(arp, inputAssembly)
+		return nil
+	})
+}
+
+// PreRasterization returns the library of the pre-rasterization part,
+// compiling it on first use.
+func (libs *PipelineLibraries) PreRasterization(part *PreRasterizationPart) (PipelineLibrary, error) {
+	h := newLibraryHash(VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT)
+	h.uint32(uint32(len(part.Shaders)))
+	for k := range part.Shaders {
+		h.shader(&part.Shaders[k])
+	}
+	h.uint32(uint32(part.PolygonMode), uint32(part.CullMode), uint32(part.FrontFace))
+	h.bool(part.DepthClamp)
+
+	return libs.library(VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT, h.key(), func(arp *AutoReleasePool, info *GraphicsPipelineCreateInfo) error {
+		if len(part.Shaders) == 0 {
+			return fmt.Errorf("error: pre-rasterization part has no shader")
+		}
+		if err := libs.stages(arp, info, part.Shaders); err != nil {
+			return err
+		}
+		viewport := &PipelineViewportStateCreateInfo{}
+		viewport.SetDefaultSType()
+		viewport.SetViewportCount(1)
+		viewport.SetScissorCount(1)
+		rasterization := &PipelineRasterizationStateCreateInfo{}
+		rasterization.SetDefaultSType()
+		rasterization.SetDepthClampEnable(MakeBool32(part.DepthClamp))
+		rasterization.SetPolygonMode(part.PolygonMode)
+		rasterization.SetCullMode(part.CullMode)
+		rasterization.SetFrontFace(part.FrontFace)
+		rasterization.SetLineWidth(1)
+		dynamic := &PipelineDynamicStateCreateInfo{}
+		dynamic.SetDefaultSType()
+		dynamic.PinPDynamicStates(arp, []DynamicState{VK_DYNAMIC_STATE_VIEWPORT, VK_DYNAMIC_STATE_SCISSOR})
+		info.PinPViewportState(arp, viewport)
+		info.PinPRasterizationState(arp, rasterization)
+		info.PinPDynamicState(arp, dynamic)
+		info.SetLayout(libs.layout)
+		return nil
+	})
+}
+
+// FragmentShader returns the library of the fragment shader part, compiling
+// it on first use.
+func (libs *PipelineLibraries) FragmentShader(part *FragmentShaderPart) (PipelineLibrary, error) {
+	h := newLibraryHash(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT)
+	h.shader(&part.Shader)
+	h.bool(part.DepthTest)
+	h.bool(part.DepthWrite)
+	h.uint32(uint32(part.DepthCompare))
+
+	return libs.library(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT, h.key(), func(arp *AutoReleasePool, info *GraphicsPipelineCreateInfo) error {
+		if len(part.Shader.SPIRV) == 0 {
+			return fmt.Errorf("error: fragment shader part has no SPIR-V")
+		}
+		if err := libs.stages(arp, info, []PipelineShader{part.Shader}); err != nil {
+			return err
+		}
+		depthStencil := &PipelineDepthStencilStateCreateInfo{}
+		depthStencil.SetDefaultSType()
+		depthStencil.SetDepthTestEnable(MakeBool32(part.DepthTest))
+		depthStencil.SetDepthWriteEnable(MakeBool32(part.DepthWrite))
+		depthStencil.SetDepthCompareOp(part.DepthCompare)
+		info.PinPDepthStencilState(arp, depthStencil)
+		info.SetLayout(libs.layout)
+		return nil
+	})
+}
+
+// FragmentOutput returns the library of the fragment output part, compiling
+// it on first use.
+func (libs *PipelineLibraries) FragmentOutput(part *FragmentOutputPart) (PipelineLibrary, error) {
+	samples := part.Samples
+	if samples == 0 {
+		samples = VK_SAMPLE_COUNT_1_BIT
+	}
+	blend := make([]PipelineColorBlendAttachmentState, len(part.ColorFormats))
+	for k := range blend {
+		if k < len(part.Blend) {
+			blend[k] = part.Blend[k]
+		} else {
+			blend[k].SetColorWriteMask(ColorComponentFlags(VK_COLOR_COMPONENT_R_BIT | VK_COLOR_COMPONENT_G_BIT | VK_COLOR_COMPONENT_B_BIT | VK_COLOR_COMPONENT_A_BIT))
+		}
+	}
+	h := newLibraryHash(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT)
+	h.raw(unsafe.Pointer(unsafe.SliceData(part.ColorFormats)), 4, len(part.ColorFormats))
+	h.uint32(uint32(part.DepthFormat), uint32(part.StencilFormat), uint32(samples))
+	h.raw(unsafe.Pointer(unsafe.SliceData(blend)), SizeofPipelineColorBlendAttachmentState, len(blend))
+
+	return libs.library(VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT, h.key(), func(arp *AutoReleasePool, info *GraphicsPipelineCreateInfo) error {
+		rendering := &PipelineRenderingCreateInfo{}
+		rendering.SetDefaultSType()
+		if len(part.ColorFormats) > 0 {
+			rendering.PinPColorAttachmentFormats(arp, part.ColorFormats)
+		}
+		rendering.SetDepthAttachmentFormat(part.DepthFormat)
+		rendering.SetStencilAttachmentFormat(part.StencilFormat)
+		multisample := &PipelineMultisampleStateCreateInfo{}
+		multisample.SetDefaultSType()
+		multisample.SetRasterizationSamples(samples)
+		colorBlend := &PipelineColorBlendStateCreateInfo{}
+		colorBlend.SetDefaultSType()
+		if len(blend) > 0 {
+			colorBlend.PinPAttachments(arp, blend)
+		}
+		rendering.SetPNext(info.PNext())
+		info.PinPNext(arp, unsafe.Pointer(rendering))
+		info.PinPMultisampleState(arp, multisample)
+		info.PinPColorBlendState(arp, colorBlend)
+		return nil
+	})
+}
+
+// stages sets the shader stages of info. The shader modules are destroyed
+// when arp is released; libraries do not need them once created.
+func (libs *PipelineLibraries) stages(arp *AutoReleasePool, info *GraphicsPipelineCreateInfo, shaders []PipelineShader) error {
+	stages := make([]PipelineShaderStageCreateInfo, len(shaders))
+	for k := range shaders {
+		shader := &shaders[k]
+		smInfo := &ShaderModuleCreateInfo{}
+		smInfo.SetDefaultSType()
+		smInfo.SetCodeSize(uint64(4 * len(shader.SPIRV)))
+		smInfo.PinPCode(arp, shader.SPIRV)
+		var module ShaderModule
+		if err := libs.device.CreateShaderModule(smInfo, nil, &module).AsErr(); err != nil {
+			return err
+		}
+		arp.Add(shaderModuleReleaser{libs.device, module})
+		entry := shader.EntryPoint
+		if len(entry) == 0 {
+			entry = "main"
+		}
+		stages[k].SetDefaultSType()
+		stages[k].SetStage(shader.Stage)
+		stages[k].SetModule(module)
+		stages[k].SetPName(InternCStr(entry))
+		if len(shader.Specialization) > 0 {
+			stages[k].PinPSpecializationInfo(arp, specializationInfo(arp, shader.Specialization))
+		}
+	}
+	info.PinPStages(arp, stages)
+	return nil
+}
+
+// shaderModuleReleaser destroys a shader module with an AutoReleasePool.
+type shaderModuleReleaser struct {
+	device DeviceFacade
+	module ShaderModule
+}
+
+func (r shaderModuleReleaser) Free() {
+	r.device.DestroyShaderModule(r.module, nil)
+}
+
+// library returns the cached library of key, or compiles it with the state
+// set by fill.
+func (libs *PipelineLibraries) library(part GraphicsPipelineLibraryFlagBitsEXT, key [sha256.Size]byte, fill func(*AutoReleasePool, *GraphicsPipelineCreateInfo) error) (PipelineLibrary, error) {
+	libs.lock.Lock()
+	defer libs.lock.Unlock()
+	if libs.closed {
+		return PipelineLibrary{}, fmt.Errorf("error: pipeline libraries destroyed")
+	}
+	if pipeline, ok := libs.parts[key]; ok {
+		return PipelineLibrary{pipeline, part}, nil
+	}
+
+	arp := NewAutoReleaser()
+	defer arp.Release()
+	libraryInfo := &GraphicsPipelineLibraryCreateInfoEXT{}
+	libraryInfo.SetDefaultSType()
+	libraryInfo.SetFlags(GraphicsPipelineLibraryFlagsEXT(part))
+	infos := make([]GraphicsPipelineCreateInfo, 1)
+	infos[0].SetDefaultSType()
+	infos[0].PinPNext(arp, unsafe.Pointer(libraryInfo))
+	flags := PipelineCreateFlags(VK_PIPELINE_CREATE_LIBRARY_BIT_KHR)
+	if libs.optimize {
+		flags |= PipelineCreateFlags(VK_PIPELINE_CREATE_RETAIN_LINK_TIME_OPTIMIZATION_INFO_BIT_EXT)
+	}
+	infos[0].SetFlags(flags)
+	if err := fill(arp, &infos[0]); err != nil {
+		return PipelineLibrary{}, err
+	}
+	pipelines := make([]Pipeline, 1)
+	if err := libs.device.CreateGraphicsPipelines(libs.cache, 1, infos, nil, pipelines).AsErr(); err != nil {
+		return PipelineLibrary{}, err
+	}
+	libs.parts[key] = pipelines[0]
+	return PipelineLibrary{pipelines[0], part}, nil
+}
+
+// link links the libraries into a complete pipeline.
+func (libs *PipelineLibraries) link(parts [4]Pipeline, flags PipelineCreateFlags) (Pipeline, error) {
+	arp := NewAutoReleaser()
+	defer arp.Release()
+	libraryInfo := &PipelineLibraryCreateInfoKHR{}
+	libraryInfo.SetDefaultSType()
+	libraryInfo.PinPLibraries(arp, parts[:])
+	infos := make([]GraphicsPipelineCreateInfo, 1)
+	infos[0].SetDefaultSType()
+	infos[0].PinPNext(arp, unsafe.Pointer(libraryInfo))
+	infos[0].SetFlags(flags)
+	infos[0].SetLayout(libs.layout)
+	pipelines := make([]Pipeline, 1)
+	if err := libs.device.CreateGraphicsPipelines(libs.cache, 1, infos, nil, pipelines).AsErr(); err != nil {
+		return NullPipeline, err
+	}
+	return pipelines[0], nil
+}
+
+// Link returns the pipeline linked from one library of every part. The first
+// call for a combination links it without optimization and, with Optimize,
+// starts its optimized relink; later calls return the optimized pipeline once
+// it is ready. The pipelines are owned by the PipelineLibraries.
+func (libs *PipelineLibraries) Link(vertexInput, preRasterization, fragmentShader, fragmentOutput PipelineLibrary) (Pipeline, error) {
+	if vertexInput.part != VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT ||
+		preRasterization.part != VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT ||
+		fragmentShader.part != VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT ||
+		fragmentOutput.part != VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT {
+		return NullPipeline, fmt.Errorf("error: pipeline libraries linked out of order")
+	}
+	parts := [4]Pipeline{vertexInput.H, preRasterization.H, fragmentShader.H, fragmentOutput.H}
+
+	libs.lock.Lock()
+	defer libs.lock.Unlock()
+	if libs.closed {
+		return NullPipeline, fmt.Errorf("error: pipeline libraries destroyed")
+	}
+	if linked, ok := libs.linked[parts]; ok {
+		if linked.optimized != NullPipeline {
+			return linked.optimized, nil
+		}
+		return linked.fast, nil
+	}
+	fast, err := libs.link(parts, 0)
+	if err != nil {
+		return NullPipeline, err
+	}
+	linked := &linkedPipeline{fast: fast}
+	libs.linked[parts] = linked
+	if libs.optimize {
+		libs.running.Add(1)
+		go libs.relink(parts, linked)
+	}
+	return fast, nil
+}
+
+// relink links the optimized pipeline of the libraries, at most
+// config.Optimizers at a time.
+func (libs *PipelineLibraries) relink(parts [4]Pipeline, linked *linkedPipeline) {
+	defer libs.running.Done()
+	libs.optimizers <- struct{}{}
+	defer func() { <-libs.optimizers }()
+
+	libs.lock.Lock()
+	closed := libs.closed
+	libs.lock.Unlock()
+	if closed {
+		return
+	}
+	// A failed relink keeps the fast linked pipeline.
+	optimized, err := libs.link(parts, PipelineCreateFlags(VK_PIPELINE_CREATE_LINK_TIME_OPTIMIZATION_BIT_EXT))
+	if err != nil {
+		return
+	}
+	libs.lock.Lock()
+	linked.optimized = optimized
+	libs.lock.Unlock()
+}
+
+// Wait waits for the optimized relinks started so far.
+func (libs *PipelineLibraries) Wait() {
+	libs.running.Wait()
+}
+
+// Trim destroys the fast linked pipelines replaced by optimized pipelines. No
+// command buffer using them may be pending.
+func (libs *PipelineLibraries) Trim() {
+	libs.lock.Lock()
+	defer libs.lock.Unlock()
+	for _, linked := range libs.linked {
+		if linked.optimized != NullPipeline && linked.fast != NullPipeline {
+			libs.device.DestroyPipeline(linked.fast, nil)
+			linked.fast = NullPipeline
+		}
+	}
+}
+
+// Destroy waits for the optimized relinks, then destroys every pipeline and
+// library. No command buffer using them may be pending.
+func (libs *PipelineLibraries) Destroy() {
+	libs.lock.Lock()
+	libs.closed = true
+	libs.lock.Unlock()
+	libs.running.Wait()
+
+	libs.lock.Lock()
+	defer libs.lock.Unlock()
+	for _, linked := range libs.linked {
+		if linked.fast != NullPipeline {
+			libs.device.DestroyPipeline(linked.fast, nil)
+		}
+		if linked.optimized != NullPipeline {
+			libs.device.DestroyPipeline(linked.optimized, nil)
+		}
+	}
+	for _, pipeline := range libs.parts {
+		libs.device.DestroyPipeline(pipeline, nil)
+	}
+	libs.linked = nil
+	libs.parts = nil
+}
@@ -0,0 +1,100 @@
+//go:build !vks_no_version_1_3 && !vks_no_version_1_1 && !vks_no_version_1_2 && !vks_no_khr_pipeline_library && !vks_no_ext_graphics_pipeline_library
+
+package vks
+
+import "testing"
+
+// testPipelineParts returns the four libraries of a pipeline; vertex is the
+// SPIR-V of its vertex shader.
+func testPipelineParts(t *testing.T, libs *PipelineLibraries, vertex []uint32) [4]PipelineLibrary {
+	var parts [4]PipelineLibrary
+	var err error
+	if parts[0], err = libs.VertexInput(&VertexInputPart{Topology: VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST}); err != nil {
+		t.Fatal(err)
+	}
+	if parts[1], err = libs.PreRasterization(&PreRasterizationPart{
+		Shaders:   []PipelineShader{{Stage: VK_SHADER_STAGE_VERTEX_BIT, SPIRV: vertex}},
+		FrontFace: VK_FRONT_FACE_COUNTER_CLOCKWISE,
+	}); err != nil {
+		t.Fatal(err)
+	}
+	if parts[2], err = libs.FragmentShader(&FragmentShaderPart{
+		Shader: PipelineShader{Stage: VK_SHADER_STAGE_FRAGMENT_BIT, SPIRV: []uint32{0x07230203, 2}},
+	}); err != nil {
+		t.Fatal(err)
+	}
+	if parts[3], err = libs.FragmentOutput(&FragmentOutputPart{ColorFormats: []Format{VK_FORMAT_B8G8R8A8_SRGB}}); err != nil {
+		t.Fatal(err)
+	}
+	return parts
+}
+
+func TestPipelineLibrariesCaching(t *testing.T) {
+	libs := NewPipelineLibraries(nullDevice(t), PipelineLibrariesConfig{})
+	defer libs.Destroy()
+
+	vertex := []uint32{0x07230203, 1}
+	parts := testPipelineParts(t, libs, vertex)
+	if again := testPipelineParts(t, libs, append([]uint32(nil), vertex...)); again != parts {
+		t.Errorf("the same descriptions compiled libraries %v, then %v", parts, again)
+	}
+	if len(libs.parts) != 4 {
+		t.Errorf("compiled %d libraries, want 4", len(libs.parts))
+	}
+	strip, err := libs.VertexInput(&VertexInputPart{Topology: VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP})
+	if err != nil {
+		t.Fatal(err)
+	}
+	other := testPipelineParts(t, libs, []uint32{0x07230203, 3})
+	if strip == parts[0] || other[1] == parts[1] || other[0] != parts[0] || len(libs.parts) != 6 {
+		t.Errorf("another topology and vertex shader compiled %d libraries, want 6", len(libs.parts))
+	}
+	if _, err := libs.PreRasterization(&PreRasterizationPart{}); err == nil {
+		t.Error("compiled a pre-rasterization part without shaders")
+	}
+
+	pipeline, err := libs.Link(parts[0], parts[1], parts[2], parts[3])
+	if err != nil {
+		t.Fatal(err)
+	}
+	if again, err := libs.Link(parts[0], parts[1], parts[2], parts[3]); err != nil || again != pipeline {
+		t.Errorf("linking the same libraries returned %v, %v, want %v", again, err, pipeline)
+	}
+	if again, err := libs.Link(strip, parts[1], parts[2], parts[3]); err != nil || again == pipeline {
+		t.Errorf("linking other libraries returned %v, %v", again, err)
+	}
+	if _, err := libs.Link(parts[1], parts[0], parts[2], parts[3]); err == nil {
+		t.Error("linked the libraries out of order")
+	}
+	if len(libs.linked) != 2 {
+		t.Errorf("linked %d pipelines, want 2", len(libs.linked))
+	}
+
+	libs.Destroy()
+	if _, err := libs.VertexInput(&VertexInputPart{}); err == nil {
+		t.Error("compiled a library after Destroy")
+	}
+	if _, err := libs.Link(parts[0], parts[1], parts[2], parts[3]); err == nil {
+		t.Error("linked a pipeline after Destroy")
+	}
+}
+
+func TestPipelineLibrariesOptimize(t *testing.T) {
+	libs := NewPipelineLibraries(nullDevice(t), PipelineLibrariesConfig{Optimize: true, Optimizers: 2})
+	defer libs.Destroy()
+	parts := testPipelineParts(t, libs, []uint32{0x07230203, 1})
+	fast, err := libs.Link(parts[0], parts[1], parts[2], parts[3])
+	if err != nil {
+		t.Fatal(err)
+	}
+	libs.Wait()
+	optimized, err := libs.Link(parts[0], parts[1], parts[2], parts[3])
+	if err != nil || optimized == fast {
+		t.Fatalf("Link returned %v, %v after the relink, want the optimized pipeline", optimized, err)
+	}
+	libs.Trim()
+	linked := libs.linked[[4]Pipeline{parts[0].H, parts[1].H, parts[2].H, parts[3].H}]
+	if linked.fast != NullPipeline || linked.optimized != optimized {
+		t.Errorf("Trim kept %v and %v, want only the optimized pipeline %v", linked.fast, linked.optimized, optimized)
+	}
+}
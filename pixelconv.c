@@ -0,0 +1,458 @@
+// Pixel format conversion kernels for the upload and readback paths.
+//
+// Every kernel has a scalar version and, where the instruction set helps, an
+// SSE2, AVX2 (with F16C) or NEON version picked at the first call. The SIMD
+// versions produce the same bytes as the scalar ones: the float16 conversions
+// round to nearest even, like F16C and NEON do, the unorm packs clamp NaN to
+// zero and round to nearest even, and the sRGB conversions go through the same
+// tables. Define VKS_NO_SIMD to only build the scalar versions.
+#include <math.h>
+#include <pthread.h>
+#include <string.h>
+#include "pixelconv.h"
+
+#if !defined(VKS_NO_SIMD) && defined(__x86_64__)
+#define VKS_PIXEL_X86 1
+#include <immintrin.h>
+#elif !defined(VKS_NO_SIMD) && defined(__aarch64__)
+#define VKS_PIXEL_ARM 1
+#include <arm_neon.h>
+#endif
+
+// sRGB tables, built by pixel_init.
+static uint8_t srgb_decode8[256];   // sRGB byte to linear byte.
+static uint8_t srgb_encode8[256];   // Linear byte to sRGB byte.
+static float srgb_decode_f32[256];  // sRGB byte to linear float.
+static float srgb_encode_limit[256]; // Smallest linear float encoded as each sRGB byte.
+
+static double srgb_to_linear(double u) {
+	return u <= 0.04045 ? u / 12.92 : pow((u + 0.055) / 1.055, 2.4);
+}
+
+static double linear_to_srgb(double u) {
+	return u <= 0.0031308 ? u * 12.92 : 1.055 * pow(u, 1 / 2.4) - 0.055;
+}
+
+// Scalar kernels.
+
+static void swap_rb8_scalar(uint8_t* dst, const uint8_t* src, size_t n) {
+	for (size_t i = 0; i < n; i++, dst += 4, src += 4) {
+		uint8_t r = src[0], g = src[1], b = src[2], a = src[3];
+		dst[0] = b;
+		dst[1] = g;
+		dst[2] = r;
+		dst[3] = a;
+	}
+}
+
+static void lut8_scalar(uint8_t* dst, const uint8_t* src, size_t n, const uint8_t* lut, int swap) {
+	for (size_t i = 0; i < n; i++, dst += 4, src += 4) {
+		uint8_t r = lut[src[0]], g = lut[src[1]], b = lut[src[2]], a = src[3];
+		dst[0] = swap ? b : r;
+		dst[1] = g;
+		dst[2] = swap ? r : b;
+		dst[3] = a;
+	}
+}
+
+static uint16_t f32_to_f16(float f) {
+	uint32_t x;
+	memcpy(&x, &f, sizeof(x));
+	uint32_t sign = (x >> 16) & 0x8000;
+	uint32_t e = (x >> 23) & 0xff;
+	uint32_t m = x & 0x7fffff;
+	if (e == 0xff) {
+		return sign | 0x7c00 | (m ? 0x200 | (m >> 13) : 0);
+	}
+	int32_t exp = (int32_t)e - 127 + 15;
+	if (exp >= 0x1f) {
+		return sign | 0x7c00;
+	} else if (exp <= 0) {
+		// Subnormal, or zero once shifted past the mantissa.
+		if (exp < -10) {
+			return sign;
+		}
+		m |= 0x800000;
+		uint32_t shift = 14 - exp;
+		uint32_t h = m >> shift;
+		uint32_t rem = m & ((1u << shift) - 1);
+		uint32_t half = 1u << (shift - 1);
+		if (rem > half || (rem == half && (h & 1))) {
+			h++;
+		}
+		return sign | h;
+	}
+	// A carry out of the mantissa moves to the next exponent, up to infinity.
+	uint32_t h = ((uint32_t)exp << 10) | (m >> 13);
+	uint32_t rem = m & 0x1fff;
+	if (rem > 0x1000 || (rem == 0x1000 && (h & 1))) {
+		h++;
+	}
+	return sign | h;
+}
+
+static float f16_to_f32(uint16_t h) {
+	uint32_t sign = (uint32_t)(h & 0x8000) << 16;
+	uint32_t e = (h >> 10) & 0x1f;
+	uint32_t m = h & 0x3ff;
+	uint32_t x;
+	if (e == 0x1f) {
+		x = sign | 0x7f800000 | (m ? 0x400000 | (m << 13) : 0);
+	} else if (e != 0) {
+		x = sign | ((e + 112) << 23) | (m << 13);
+	} else if (m != 0) {
+		e = 113;
+		while (!(m & 0x400)) {
+			m <<= 1;
+			e--;
+		}
+		x = sign | (e << 23) | ((m & 0x3ff) << 13);
+	} else {
+		x = sign;
+	}
+	float f;
+	memcpy(&f, &x, sizeof(f));
+	return f;
+}
+
+static void f32_to_f16_scalar(uint16_t* dst, const float* src, size_t n) {
+	for (size_t i = 0; i < n; i++) {
+		dst[i] = f32_to_f16(src[i]);
+	}
+}
+
+static void f16_to_f32_scalar(float* dst, const uint16_t* src, size_t n) {
+	for (size_t i = 0; i < n; i++) {
+		dst[i] = f16_to_f32(src[i]);
+	}
+}
+
+static void u8_to_f32_scalar(float* dst, const uint8_t* src, size_t n, int swap, int decode) {
+	for (size_t i = 0; i < n; i++, dst += 4, src += 4) {
+		float r, g, b;
+		if (decode) {
+			r = srgb_decode_f32[src[0]];
+			g = srgb_decode_f32[src[1]];
+			b = srgb_decode_f32[src[2]];
+		} else {
+			r = (float)src[0] / 255.0f;
+			g = (float)src[1] / 255.0f;
+			b = (float)src[2] / 255.0f;
+		}
+		dst[0] = swap ? b : r;
+		dst[1] = g;
+		dst[2] = swap ? r : b;
+		dst[3] = (float)src[3] / 255.0f;
+	}
+}
+
+static uint8_t unorm8(float x) {
+	if (!(x > 0.0f)) {
+		x = 0.0f;
+	} else if (x > 1.0f) {
+		x = 1.0f;
+	}
+	return (uint8_t)lrintf(x * 255.0f);
+}
+
+// srgb8 returns the sRGB byte nearest to the encoding of x, by binary search
+// of the table of the linear values half way between two bytes.
+static uint8_t srgb8(float x) {
+	uint32_t k = 0;
+	for (uint32_t step = 128; step > 0; step >>= 1) {
+		if (k + step <= 255 && x >= srgb_encode_limit[k + step]) {
+			k += step;
+		}
+	}
+	return (uint8_t)k;
+}
+
+static void f32_to_u8_scalar(uint8_t* dst, const float* src, size_t n, int swap, int encode) {
+	for (size_t i = 0; i < n; i++, dst += 4, src += 4) {
+		uint8_t r, g, b;
+		if (encode) {
+			r = srgb8(src[0]);
+			g = srgb8(src[1]);
+			b = srgb8(src[2]);
+		} else {
+			r = unorm8(src[0]);
+			g = unorm8(src[1]);
+			b = unorm8(src[2]);
+		}
+		dst[0] = swap ? b : r;
+		dst[1] = g;
+		dst[2] = swap ? r : b;
+		dst[3] = unorm8(src[3]);
+	}
+}
+
+#if defined(VKS_PIXEL_X86)
+
+static inline __m128i swap_rb_sse2(__m128i p) {
+	const __m128i ga = _mm_set1_epi32((int)0xff00ff00);
+	const __m128i lo = _mm_set1_epi32(0xff);
+	__m128i r = _mm_slli_epi32(_mm_and_si128(p, lo), 16);
+	__m128i b = _mm_and_si128(_mm_srli_epi32(p, 16), lo);
+	return _mm_or_si128(_mm_and_si128(p, ga), _mm_or_si128(r, b));
+}
+
+static void swap_rb8_sse2(uint8_t* dst, const uint8_t* src, size_t n) {
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) {
+		__m128i p = _mm_loadu_si128((const __m128i*)(src + 4 * i));
+		_mm_storeu_si128((__m128i*)(dst + 4 * i), swap_rb_sse2(p));
+	}
+	swap_rb8_scalar(dst + 4 * i, src + 4 * i, n - i);
+}
+
+static void u8_to_f32_sse2(float* dst, const uint8_t* src, size_t n, int swap, int decode) {
+	const __m128i zero = _mm_setzero_si128();
+	const __m128 scale = _mm_set1_ps(255.0f);
+	size_t i = 0;
+	for (; !decode && i + 4 <= n; i += 4) {
+		__m128i p = _mm_loadu_si128((const __m128i*)(src + 4 * i));
+		if (swap) {
+			p = swap_rb_sse2(p);
+		}
+		__m128i lo = _mm_unpacklo_epi8(p, zero);
+		__m128i hi = _mm_unpackhi_epi8(p, zero);
+		float* d = dst + 4 * i;
+		_mm_storeu_ps(d, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+		_mm_storeu_ps(d + 4, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+		_mm_storeu_ps(d + 8, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+		_mm_storeu_ps(d + 12, _mm_div_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+	}
+	u8_to_f32_scalar(dst + 4 * i, src + 4 * i, n - i, swap, decode);
+}
+
+static inline __m128i unorm8_sse2(const float* src) {
+	const __m128 zero = _mm_setzero_ps();
+	const __m128 one = _mm_set1_ps(1.0f);
+	const __m128 scale = _mm_set1_ps(255.0f);
+	// maxps returns its second operand when the first one is NaN.
+	__m128 x = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(src), zero), one);
+	return _mm_cvtps_epi32(_mm_mul_ps(x, scale));
+}
+
+static void f32_to_u8_sse2(uint8_t* dst, const float* src, size_t n, int swap, int encode) {
+	size_t i = 0;
+	for (; !encode && i + 4 <= n; i += 4) {
+		const float* s = src + 4 * i;
+		__m128i ab = _mm_packs_epi32(unorm8_sse2(s), unorm8_sse2(s + 4));
+		__m128i cd = _mm_packs_epi32(unorm8_sse2(s + 8), unorm8_sse2(s + 12));
+		__m128i p = _mm_packus_epi16(ab, cd);
+		if (swap) {
+			p = swap_rb_sse2(p);
+		}
+		_mm_storeu_si128((__m128i*)(dst + 4 * i), p);
+	}
+	f32_to_u8_scalar(dst + 4 * i, src + 4 * i, n - i, swap, encode);
+}
+
+__attribute__((target("avx2"))) static void swap_rb8_avx2(uint8_t* dst, const uint8_t* src, size_t n) {
+	const __m256i ga = _mm256_set1_epi32((int)0xff00ff00);
+	const __m256i lo = _mm256_set1_epi32(0xff);
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		__m256i p = _mm256_loadu_si256((const __m256i*)(src + 4 * i));
+		__m256i r = _mm256_slli_epi32(_mm256_and_si256(p, lo), 16);
+		__m256i b = _mm256_and_si256(_mm256_srli_epi32(p, 16), lo);
+		p = _mm256_or_si256(_mm256_and_si256(p, ga), _mm256_or_si256(r, b));
+		_mm256_storeu_si256((__m256i*)(dst + 4 * i), p);
+	}
+	swap_rb8_sse2(dst + 4 * i, src + 4 * i, n - i);
+}
+
+__attribute__((target("avx2"))) static void u8_to_f32_avx2(float* dst, const uint8_t* src, size_t n, int swap, int decode) {
+	const __m256 scale = _mm256_set1_ps(255.0f);
+	size_t i = 0;
+	for (; !decode && i + 4 <= n; i += 4) {
+		__m128i p = _mm_loadu_si128((const __m128i*)(src + 4 * i));
+		if (swap) {
+			p = swap_rb_sse2(p);
+		}
+		__m256 lo = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(p));
+		__m256 hi = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_unpackhi_epi64(p, p)));
+		_mm256_storeu_ps(dst + 4 * i, _mm256_div_ps(lo, scale));
+		_mm256_storeu_ps(dst + 4 * i + 8, _mm256_div_ps(hi, scale));
+	}
+	u8_to_f32_scalar(dst + 4 * i, src + 4 * i, n - i, swap, decode);
+}
+
+__attribute__((target("avx,f16c"))) static void f32_to_f16_f16c(uint16_t* dst, const float* src, size_t n) {
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		__m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+		_mm_storeu_si128((__m128i*)(dst + i), h);
+	}
+	f32_to_f16_scalar(dst + i, src + i, n - i);
+}
+
+__attribute__((target("avx,f16c"))) static void f16_to_f32_f16c(float* dst, const uint16_t* src, size_t n) {
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		_mm256_storeu_ps(dst + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(src + i))));
+	}
+	f16_to_f32_scalar(dst + i, src + i, n - i);
+}
+
+#elif defined(VKS_PIXEL_ARM)
+
+static inline uint8x16_t swap_rb_neon(uint8x16_t p) {
+	static const uint8_t idx[16] = {2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15};
+	return vqtbl1q_u8(p, vld1q_u8(idx));
+}
+
+static void swap_rb8_neon(uint8_t* dst, const uint8_t* src, size_t n) {
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) {
+		vst1q_u8(dst + 4 * i, swap_rb_neon(vld1q_u8(src + 4 * i)));
+	}
+	swap_rb8_scalar(dst + 4 * i, src + 4 * i, n - i);
+}
+
+static void u8_to_f32_neon(float* dst, const uint8_t* src, size_t n, int swap, int decode) {
+	const float32x4_t scale = vdupq_n_f32(255.0f);
+	size_t i = 0;
+	for (; !decode && i + 4 <= n; i += 4) {
+		uint8x16_t p = vld1q_u8(src + 4 * i);
+		if (swap) {
+			p = swap_rb_neon(p);
+		}
+		uint16x8_t lo = vmovl_u8(vget_low_u8(p));
+		uint16x8_t hi = vmovl_u8(vget_high_u8(p));
+		float* d = dst + 4 * i;
+		vst1q_f32(d, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))), scale));
+		vst1q_f32(d + 4, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))), scale));
+		vst1q_f32(d + 8, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))), scale));
+		vst1q_f32(d + 12, vdivq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))), scale));
+	}
+	u8_to_f32_scalar(dst + 4 * i, src + 4 * i, n - i, swap, decode);
+}
+
+static inline uint16x4_t unorm8_neon(const float* src) {
+	// vmaxnm returns the number when one operand is NaN.
+	float32x4_t x = vminq_f32(vmaxnmq_f32(vld1q_f32(src), vdupq_n_f32(0.0f)), vdupq_n_f32(1.0f));
+	return vmovn_u32(vcvtnq_u32_f32(vmulq_f32(x, vdupq_n_f32(255.0f))));
+}
+
+static void f32_to_u8_neon(uint8_t* dst, const float* src, size_t n, int swap, int encode) {
+	size_t i = 0;
+	for (; !encode && i + 4 <= n; i += 4) {
+		const float* s = src + 4 * i;
+		uint16x8_t ab = vcombine_u16(unorm8_neon(s), unorm8_neon(s + 4));
+		uint16x8_t cd = vcombine_u16(unorm8_neon(s + 8), unorm8_neon(s + 12));
+		uint8x16_t p = vcombine_u8(vmovn_u16(ab), vmovn_u16(cd));
+		if (swap) {
+			p = swap_rb_neon(p);
+		}
+		vst1q_u8(dst + 4 * i, p);
+	}
+	f32_to_u8_scalar(dst + 4 * i, src + 4 * i, n - i, swap, encode);
+}
+
+static void f32_to_f16_neon(uint16_t* dst, const float* src, size_t n) {
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) {
+		vst1_u16(dst + i, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(src + i))));
+	}
+	f32_to_f16_scalar(dst + i, src + i, n - i);
+}
+
+static void f16_to_f32_neon(float* dst, const uint16_t* src, size_t n) {
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) {
+		vst1q_f32(dst + i, vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(src + i))));
+	}
+	f16_to_f32_scalar(dst + i, src + i, n - i);
+}
+
+#endif
+
+// The kernels picked by pixel_init.
+static int pixel_simd = VKS_PIXEL_SCALAR;
+static void (*swap_rb8)(uint8_t*, const uint8_t*, size_t) = swap_rb8_scalar;
+static void (*f32_to_f16_row)(uint16_t*, const float*, size_t) = f32_to_f16_scalar;
+static void (*f16_to_f32_row)(float*, const uint16_t*, size_t) = f16_to_f32_scalar;
+static void (*u8_to_f32)(float*, const uint8_t*, size_t, int, int) = u8_to_f32_scalar;
+static void (*f32_to_u8)(uint8_t*, const float*, size_t, int, int) = f32_to_u8_scalar;
+static pthread_once_t pixel_once = PTHREAD_ONCE_INIT;
+
+static void pixel_init() {
+	for (int i = 0; i < 256; i++) {
+		double decoded = srgb_to_linear(i / 255.0);
+		srgb_decode8[i] = (uint8_t)lrint(decoded * 255);
+		srgb_encode8[i] = (uint8_t)lrint(linear_to_srgb(i / 255.0) * 255);
+		srgb_decode_f32[i] = (float)decoded;
+		srgb_encode_limit[i] = i == 0 ? -INFINITY : (float)srgb_to_linear((i - 0.5) / 255.0);
+	}
+
+#if defined(VKS_PIXEL_X86)
+	pixel_simd = VKS_PIXEL_SSE2;
+	swap_rb8 = swap_rb8_sse2;
+	u8_to_f32 = u8_to_f32_sse2;
+	f32_to_u8 = f32_to_u8_sse2;
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2")) {
+		pixel_simd = VKS_PIXEL_AVX2;
+		swap_rb8 = swap_rb8_avx2;
+		u8_to_f32 = u8_to_f32_avx2;
+	}
+	if (__builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c")) {
+		f32_to_f16_row = f32_to_f16_f16c;
+		f16_to_f32_row = f16_to_f32_f16c;
+	}
+#elif defined(VKS_PIXEL_ARM)
+	pixel_simd = VKS_PIXEL_NEON;
+	swap_rb8 = swap_rb8_neon;
+	u8_to_f32 = u8_to_f32_neon;
+	f32_to_u8 = f32_to_u8_neon;
+	f32_to_f16_row = f32_to_f16_neon;
+	f16_to_f32_row = f16_to_f32_neon;
+#endif
+}
+
+int vksPixelSimd() {
+	pthread_once(&pixel_once, pixel_init);
+	return pixel_simd;
+}
+
+void vksConvertPixels(const vksPixelConversion* conv, void* dst, size_t dstStride, const void* src, size_t srcStride, size_t width, size_t height) {
+	pthread_once(&pixel_once, pixel_init);
+	uint8_t* d = (uint8_t*)dst;
+	const uint8_t* s = (const uint8_t*)src;
+	const uint8_t* lut = conv->decode ? srgb_decode8 : srgb_encode8;
+	size_t elements = width * conv->channels;
+	void (*swap)(uint8_t*, const uint8_t*, size_t) = conv->scalar ? swap_rb8_scalar : swap_rb8;
+	void (*to_f16)(uint16_t*, const float*, size_t) = conv->scalar ? f32_to_f16_scalar : f32_to_f16_row;
+	void (*to_f32)(float*, const uint16_t*, size_t) = conv->scalar ? f16_to_f32_scalar : f16_to_f32_row;
+	void (*unpack)(float*, const uint8_t*, size_t, int, int) = conv->scalar ? u8_to_f32_scalar : u8_to_f32;
+	void (*pack)(uint8_t*, const float*, size_t, int, int) = conv->scalar ? f32_to_u8_scalar : f32_to_u8;
+	for (size_t y = 0; y < height; y++, d += dstStride, s += srcStride) {
+		switch (conv->kernel) {
+		case VKS_PIXEL_COPY:
+			if (d != s) {
+				memcpy(d, s, width * conv->srcSize);
+			}
+			break;
+		case VKS_PIXEL_SWAP_RB8:
+			swap(d, s, width);
+			break;
+		case VKS_PIXEL_LUT8:
+			lut8_scalar(d, s, width, lut, conv->swapRB);
+			break;
+		case VKS_PIXEL_F32_TO_F16:
+			to_f16((uint16_t*)d, (const float*)s, elements);
+			break;
+		case VKS_PIXEL_F16_TO_F32:
+			to_f32((float*)d, (const uint16_t*)s, elements);
+			break;
+		case VKS_PIXEL_U8_TO_F32:
+			unpack((float*)d, s, width, conv->swapRB, conv->decode);
+			break;
+		case VKS_PIXEL_F32_TO_U8:
+			pack(d, (const float*)s, width, conv->swapRB, conv->encode);
+			break;
+		}
+	}
+}
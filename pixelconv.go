@@ -0,0 +1,300 @@
+package vks
+
+//#cgo LDFLAGS: -lm
+//#include "pixelconv.h"
+import "C"
+import (
+	"fmt"
+	"runtime"
+	"sync"
+	"unsafe"
+)
+
+// pixelParallelBytes is the source size from which a PixelConversion splits
+// the conversion across goroutines, and pixelChunkBytes the smallest share of
+// a goroutine. Below that the cgo call and goroutine costs outweigh the gain.
+const (
+	pixelParallelBytes = 1 << 20
+	pixelChunkBytes    = 256 << 10
+)
+
+// pixelClass groups the formats ConvertPixels knows about.
+type pixelClass int
+
+const (
+	pixelRGBA8 pixelClass = iota
+	pixelFloat32
+	pixelFloat16
+)
+
+type pixelFormat struct {
+	class    pixelClass
+	channels int
+	bgr      bool
+	srgb     bool
+}
+
+func (pf pixelFormat) size() int {
+	switch pf.class {
+	case pixelFloat32:
+		return 4 * pf.channels
+	case pixelFloat16:
+		return 2 * pf.channels
+	}
+	return 4
+}
+
+func pixelFormatOf(format Format) (pixelFormat, bool) {
+	switch format {
+	case VK_FORMAT_R8G8B8A8_UNORM:
+		return pixelFormat{pixelRGBA8, 4, false, false}, true
+	case VK_FORMAT_R8G8B8A8_SRGB:
+		return pixelFormat{pixelRGBA8, 4, false, true}, true
+	case VK_FORMAT_B8G8R8A8_UNORM:
+		return pixelFormat{pixelRGBA8, 4, true, false}, true
+	case VK_FORMAT_B8G8R8A8_SRGB:
+		return pixelFormat{pixelRGBA8, 4, true, true}, true
+	case VK_FORMAT_R32_SFLOAT:
+		return pixelFormat{pixelFloat32, 1, false, false}, true
+	case VK_FORMAT_R32G32_SFLOAT:
+		return pixelFormat{pixelFloat32, 2, false, false}, true
+	case VK_FORMAT_R32G32B32_SFLOAT:
+		return pixelFormat{pixelFloat32, 3, false, false}, true
+	case VK_FORMAT_R32G32B32A32_SFLOAT:
+		return pixelFormat{pixelFloat32, 4, false, false}, true
+	case VK_FORMAT_R16_SFLOAT:
+		return pixelFormat{pixelFloat16, 1, false, false}, true
+	case VK_FORMAT_R16G16_SFLOAT:
+		return pixelFormat{pixelFloat16, 2, false, false}, true
+	case VK_FORMAT_R16G16B16_SFLOAT:
+		return pixelFormat{pixelFloat16, 3, false, false}, true
+	case VK_FORMAT_R16G16B16A16_SFLOAT:
+		return pixelFormat{pixelFloat16, 4, false, false}, true
+	}
+	return pixelFormat{}, false
+}
+
+// PixelConversion converts texels from one format to another. The supported
+// formats are R8G8B8A8 and B8G8R8A8 in UNORM and SRGB, and the one to four
+// channel SFLOAT formats of 16 and 32 bits. The RGBA8 formats convert to each
+// other, swapping the channels and encoding or decoding sRGB; the float
+// formats convert between 16 and 32 bits at the same channel count; and the
+// RGBA8 formats convert to and from R32G32B32A32_SFLOAT, with sRGB decoded to
+// linear and linear encoded to sRGB. Alpha is never encoded.
+//
+// The kernels are written in C, with SSE2, AVX2 and F16C versions selected at
+// run time on amd64 and NEON versions on arm64; the vks_no_simd build tag
+// selects the scalar versions, which produce the same bytes. A PixelConversion
+// is immutable and can be shared between goroutines.
+type PixelConversion struct {
+	conv     C.vksPixelConversion
+	Src, Dst Format
+	SrcTexel int // Bytes per source texel.
+	DstTexel int // Bytes per destination texel.
+}
+
+// NewPixelConversion returns the conversion from src to dst texels.
+func NewPixelConversion(dst, src Format) (*PixelConversion, error) {
+	sf, sok := pixelFormatOf(src)
+	df, dok := pixelFormatOf(dst)
+	if !sok || !dok {
+		return nil, fmt.Errorf("error: pixel conversion from %v to %v is not supported", src, dst)
+	}
+	pc := &PixelConversion{
+		Src:      src,
+		Dst:      dst,
+		SrcTexel: sf.size(),
+		DstTexel: df.size(),
+	}
+	pc.conv.srcSize = C.int32_t(pc.SrcTexel)
+	pc.conv.dstSize = C.int32_t(pc.DstTexel)
+	pc.conv.channels = C.int32_t(sf.channels)
+
+	boolInt := func(b bool) C.int32_t {
+		if b {
+			return 1
+		}
+		return 0
+	}
+	switch {
+	case src == dst:
+		pc.conv.kernel = C.VKS_PIXEL_COPY
+	case sf.class == pixelRGBA8 && df.class == pixelRGBA8:
+		pc.conv.swapRB = boolInt(sf.bgr != df.bgr)
+		pc.conv.decode = boolInt(sf.srgb && !df.srgb)
+		pc.conv.encode = boolInt(!sf.srgb && df.srgb)
+		if sf.srgb != df.srgb {
+			pc.conv.kernel = C.VKS_PIXEL_LUT8
+		} else {
+			pc.conv.kernel = C.VKS_PIXEL_SWAP_RB8
+		}
+	case sf.class == pixelFloat32 && df.class == pixelFloat16 && sf.channels == df.channels:
+		pc.conv.kernel = C.VKS_PIXEL_F32_TO_F16
+	case sf.class == pixelFloat16 && df.class == pixelFloat32 && sf.channels == df.channels:
+		pc.conv.kernel = C.VKS_PIXEL_F16_TO_F32
+	case sf.class == pixelRGBA8 && df.class == pixelFloat32 && df.channels == 4:
+		pc.conv.kernel = C.VKS_PIXEL_U8_TO_F32
+		pc.conv.swapRB = boolInt(sf.bgr)
+		pc.conv.decode = boolInt(sf.srgb)
+	case sf.class == pixelFloat32 && sf.channels == 4 && df.class == pixelRGBA8:
+		pc.conv.kernel = C.VKS_PIXEL_F32_TO_U8
+		pc.conv.swapRB = boolInt(df.bgr)
+		pc.conv.encode = boolInt(df.srgb)
+	default:
+		return nil, fmt.Errorf("error: pixel conversion from %v to %v is not supported", src, dst)
+	}
+	return pc, nil
+}
+
+// scalar returns a copy of the conversion running the scalar kernels, the
+// ones of the vks_no_simd build, which the SIMD kernels must match.
+func (pc *PixelConversion) scalar() *PixelConversion {
+	clone := *pc
+	clone.conv.scalar = 1
+	return &clone
+}
+
+// PixelSIMD returns the instruction set of the conversion kernels: avx2, sse2,
+// neon or scalar.
+func PixelSIMD() string {
+	switch C.vksPixelSimd() {
+	case C.VKS_PIXEL_AVX2:
+		return "avx2"
+	case C.VKS_PIXEL_SSE2:
+		return "sse2"
+	case C.VKS_PIXEL_NEON:
+		return "neon"
+	}
+	return "scalar"
+}
+
+// Convert converts the texels of src into dst, as many as both hold, and
+// returns the number of texels converted. dst and src may be mapped device
+// memory. They must not overlap, unless they are the same slice and the texel
+// sizes are equal.
+func (pc *PixelConversion) Convert(dst, src []byte) int {
+	n := len(src) / pc.SrcTexel
+	if m := len(dst) / pc.DstTexel; m < n {
+		n = m
+	}
+	if n > 0 {
+		pc.rows(dst, pc.DstTexel*n, src, pc.SrcTexel*n, n, 1)
+	}
+	return n
+}
+
+// ConvertRows converts height rows of width texels, the rows starting every
+// dstStride bytes of dst and srcStride bytes of src, like the rows of a
+// linear image or of a buffer to image copy with a row length.
+func (pc *PixelConversion) ConvertRows(dst []byte, dstStride int, src []byte, srcStride int, width, height int) error {
+	if width <= 0 || height <= 0 {
+		return nil
+	}
+	if dstStride < width*pc.DstTexel || srcStride < width*pc.SrcTexel {
+		return fmt.Errorf("error: pixel row stride smaller than %d texels", width)
+	}
+	if len(dst) < dstStride*(height-1)+width*pc.DstTexel || len(src) < srcStride*(height-1)+width*pc.SrcTexel {
+		return fmt.Errorf("error: pixel buffer smaller than %dx%d texels", width, height)
+	}
+	pc.rows(dst, dstStride, src, srcStride, width, height)
+	return nil
+}
+
+// rows splits large conversions across goroutines, by rows, or by texels for
+// a single row.
+func (pc *PixelConversion) rows(dst []byte, dstStride int, src []byte, srcStride int, width, height int) {
+	total := width * height * pc.SrcTexel
+	workers := runtime.GOMAXPROCS(0)
+	if m := total / pixelChunkBytes; m < workers {
+		workers = m
+	}
+	if total < pixelParallelBytes || workers < 2 {
+		pc.call(dst, dstStride, src, srcStride, width, height)
+		return
+	}
+
+	var wg sync.WaitGroup
+	if height == 1 {
+		per := (width + workers - 1) / workers
+		for x := 0; x < width; x += per {
+			w := per
+			if x+w > width {
+				w = width - x
+			}
+			wg.Add(1)
+			go func(x, w int) {
+				defer wg.Done()
+				pc.call(dst[x*pc.DstTexel:], dstStride, src[x*pc.SrcTexel:], srcStride, w, 1)
+			}(x, w)
+		}
+	} else {
+		per := (height + workers - 1) / workers
+		for y := 0; y < height; y += per {
+			h := per
+			if y+h > height {
+				h = height - y
+			}
+			wg.Add(1)
+			go func(y, h int) {
+				defer wg.Done()
+				pc.call(dst[y*dstStride:], dstStride, src[y*srcStride:], srcStride, width, h)
+			}(y, h)
+		}
+	}
+	wg.Wait()
+}
+
+func (pc *PixelConversion) call(dst []byte, dstStride int, src []byte, srcStride int, width, height int) {
+	C.vksConvertPixels(&pc.conv,
+		unsafe.Pointer(unsafe.SliceData(dst)), C.size_t(dstStride),
+		unsafe.Pointer(unsafe.SliceData(src)), C.size_t(srcStride),
+		C.size_t(width), C.size_t(height))
+}
+
+// ConvertPixels converts the texels of src, in srcFormat, into dst, in
+// dstFormat. It returns the number of texels converted. See PixelConversion.
+func ConvertPixels(dst []byte, dstFormat Format, src []byte, srcFormat Format) (int, error) {
+	pc, err := NewPixelConversion(dstFormat, srcFormat)
+	if err != nil {
+		return 0, err
+	}
+	return pc.Convert(dst, src), nil
+}
+
+// ConvertToMemory converts the texels of src, in srcFormat, into device
+// memory, in format, without a staging copy. See MapMemory for possible
+// errors. Returns the number of texels converted.
+func (device DeviceFacade) ConvertToMemory(memory DeviceMemory, offset DeviceSize, flags MemoryMapFlags, format Format, src []byte, srcFormat Format) (int, error) {
+	pc, err := NewPixelConversion(format, srcFormat)
+	if err != nil {
+		return 0, err
+	}
+	size := DeviceSize(len(src) / pc.SrcTexel * pc.DstTexel)
+	if size == 0 {
+		return 0, nil
+	}
+	var pData unsafe.Pointer
+	if err := device.MapMemory(memory, offset, size, flags, &pData).AsErr(); err != nil {
+		return 0, err
+	}
+	n := pc.Convert(unsafe.Slice((*byte)(pData), size), src)
+	device.UnmapMemory(memory)
+	return n, nil
+}
+
+// ConvertFromMemory converts size bytes of texels in format, from device
+// memory, into dst, in dstFormat, without a staging copy. See MapMemory for
+// possible errors. Returns the number of texels converted.
+func (device DeviceFacade) ConvertFromMemory(memory DeviceMemory, offset, size DeviceSize, flags MemoryMapFlags, format Format, dst []byte, dstFormat Format) (int, error) {
+	pc, err := NewPixelConversion(dstFormat, format)
+	if err != nil {
+		return 0, err
+	}
+	var pData unsafe.Pointer
+	if err := device.MapMemory(memory, offset, size, flags, &pData).AsErr(); err != nil {
+		return 0, err
+	}
+	n := pc.Convert(dst, unsafe.Slice((*byte)(pData), size))
+	device.UnmapMemory(memory)
+	return n, nil
+}
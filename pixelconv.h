@@ -0,0 +1,38 @@
+#ifndef __VKS_PIXELCONV_H__
+#define __VKS_PIXELCONV_H__
+#include <stddef.h>
+#include <stdint.h>
+
+// The kernels of vksConvertPixels.
+#define VKS_PIXEL_COPY 0       // Copies the texels.
+#define VKS_PIXEL_SWAP_RB8 1   // Swaps the R and B bytes of RGBA8 texels.
+#define VKS_PIXEL_LUT8 2       // Maps the RGB bytes of RGBA8 texels through the sRGB tables.
+#define VKS_PIXEL_F32_TO_F16 3 // Packs float32 channels into float16.
+#define VKS_PIXEL_F16_TO_F32 4 // Unpacks float16 channels into float32.
+#define VKS_PIXEL_U8_TO_F32 5  // Unpacks RGBA8 texels into float32.
+#define VKS_PIXEL_F32_TO_U8 6  // Packs float32 RGBA texels into RGBA8.
+
+#define VKS_PIXEL_SCALAR 0
+#define VKS_PIXEL_SSE2 1
+#define VKS_PIXEL_AVX2 2
+#define VKS_PIXEL_NEON 3
+
+typedef struct vksPixelConversion {
+	int32_t kernel;
+	int32_t channels; // Channels per texel of the float kernels.
+	int32_t srcSize;  // Bytes per source texel.
+	int32_t dstSize;  // Bytes per destination texel.
+	int32_t swapRB;   // Swap the R and B channels of the RGBA8 side.
+	int32_t decode;   // sRGB to linear.
+	int32_t encode;   // Linear to sRGB.
+	int32_t scalar;   // Use the scalar kernels even where SIMD ones exist.
+} vksPixelConversion;
+
+// vksPixelSimd returns the instruction set the kernels use.
+int vksPixelSimd();
+
+// vksConvertPixels converts height rows of width texels. dst and src must not
+// overlap, unless they are the same and the texel sizes are equal.
+void vksConvertPixels(const vksPixelConversion* conv, void* dst, size_t dstStride, const void* src, size_t srcStride, size_t width, size_t height);
+
+#endif
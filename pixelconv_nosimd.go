@@ -0,0 +1,8 @@
+//go:build vks_no_simd
+
+package vks
+
+// The vks_no_simd build tag builds the scalar pixel conversion kernels only.
+
+//#cgo CFLAGS: -DVKS_NO_SIMD
+import "C"
@@ -0,0 +1,213 @@
+package vks
+
+import (
+	"bytes"
+	"encoding/binary"
+	"math"
+	"math/rand"
+	"testing"
+)
+
+var (
+	rgba8Formats = []Format{
+		VK_FORMAT_R8G8B8A8_UNORM,
+		VK_FORMAT_R8G8B8A8_SRGB,
+		VK_FORMAT_B8G8R8A8_UNORM,
+		VK_FORMAT_B8G8R8A8_SRGB,
+	}
+	float16Formats = []Format{
+		VK_FORMAT_R16_SFLOAT,
+		VK_FORMAT_R16G16_SFLOAT,
+		VK_FORMAT_R16G16B16_SFLOAT,
+		VK_FORMAT_R16G16B16A16_SFLOAT,
+	}
+	float32Formats = []Format{
+		VK_FORMAT_R32_SFLOAT,
+		VK_FORMAT_R32G32_SFLOAT,
+		VK_FORMAT_R32G32B32_SFLOAT,
+		VK_FORMAT_R32G32B32A32_SFLOAT,
+	}
+)
+
+// compareScalar converts src with the kernels of the build and with the scalar
+// ones, and fails at the first texel where they differ.
+func compareScalar(t *testing.T, dst, src Format, input []byte) {
+	t.Helper()
+	pc, err := NewPixelConversion(dst, src)
+	if err != nil {
+		t.Fatal(err)
+	}
+	n := len(input) / pc.SrcTexel
+	simd := make([]byte, n*pc.DstTexel)
+	scalar := make([]byte, n*pc.DstTexel)
+	if got := pc.Convert(simd, input); got != n {
+		t.Fatalf("%v to %v converted %d texels, want %d", src, dst, got, n)
+	}
+	pc.scalar().Convert(scalar, input)
+	if bytes.Equal(simd, scalar) {
+		return
+	}
+	for k := 0; k < n; k++ {
+		d := k * pc.DstTexel
+		if !bytes.Equal(simd[d:d+pc.DstTexel], scalar[d:d+pc.DstTexel]) {
+			t.Fatalf("%v to %v with %s: texel %d % x is % x, scalar % x", src, dst, PixelSIMD(), k,
+				input[k*pc.SrcTexel:(k+1)*pc.SrcTexel], simd[d:d+pc.DstTexel], scalar[d:d+pc.DstTexel])
+		}
+	}
+}
+
+func float32Bytes(values []float32) []byte {
+	data := make([]byte, 4*len(values))
+	for k, v := range values {
+		binary.LittleEndian.PutUint32(data[4*k:], math.Float32bits(v))
+	}
+	return data
+}
+
+// TestPixelFloat16 converts every float16 value to float32 and back.
+func TestPixelFloat16(t *testing.T) {
+	halves := make([]byte, 2*65536)
+	for k := 0; k < 65536; k++ {
+		binary.LittleEndian.PutUint16(halves[2*k:], uint16(k))
+	}
+	for k, f16 := range float16Formats {
+		compareScalar(t, float32Formats[k], f16, halves)
+	}
+
+	pc, _ := NewPixelConversion(VK_FORMAT_R32_SFLOAT, VK_FORMAT_R16_SFLOAT)
+	floats := make([]byte, 4*65536)
+	pc.scalar().Convert(floats, halves)
+	for k, f32 := range float32Formats {
+		compareScalar(t, float16Formats[k], f32, floats)
+	}
+}
+
+// pixelFloats are float32 inputs around the edges of the float16 and unorm
+// conversions: NaNs, infinities, denormals, the float16 range and rounding
+// boundaries, the unorm and sRGB byte boundaries, and a sweep of bit patterns.
+func pixelFloats() []float32 {
+	values := []float32{
+		0, float32(math.Copysign(0, -1)), 1, -1, 0.5, 2,
+		float32(math.Inf(1)), float32(math.Inf(-1)),
+		float32(math.NaN()), math.Float32frombits(0x7f800001), math.Float32frombits(0xffc00000),
+		math.Float32frombits(0x7fbfffff), math.Float32frombits(0xffffffff),
+		math.Float32frombits(1), math.Float32frombits(0x807fffff), math.Float32frombits(0x00400000),
+		math.SmallestNonzeroFloat32, math.MaxFloat32, -math.MaxFloat32,
+		65504, 65519, 65520, -65520, 6.1035156e-05, 5.9604645e-08, 2.9802322e-08, 2.9802326e-08,
+	}
+	for k := 0; k <= 255; k++ {
+		for _, edge := range []float64{float64(k) / 255, (float64(k) + 0.5) / 255, srgbToLinear((float64(k) + 0.5) / 255)} {
+			f := float32(edge)
+			values = append(values, math.Nextafter32(f, -1), f, math.Nextafter32(f, 2))
+		}
+	}
+	for bits := uint64(0); bits < 1<<32; bits += 4093 {
+		values = append(values, math.Float32frombits(uint32(bits)))
+	}
+	rng := rand.New(rand.NewSource(1))
+	for k := 0; k < 1<<16; k++ {
+		values = append(values, rng.Float32()*1.25-0.125)
+	}
+	// Whole texels for every channel count.
+	for len(values)%12 != 0 {
+		values = append(values, 0)
+	}
+	return values
+}
+
+func srgbToLinear(u float64) float64 {
+	if u <= 0.04045 {
+		return u / 12.92
+	}
+	return math.Pow((u+0.055)/1.055, 2.4)
+}
+
+func TestPixelFloat32Specials(t *testing.T) {
+	floats := float32Bytes(pixelFloats())
+	for k, f16 := range float16Formats {
+		compareScalar(t, f16, float32Formats[k], floats)
+	}
+	for _, rgba8 := range rgba8Formats {
+		compareScalar(t, rgba8, VK_FORMAT_R32G32B32A32_SFLOAT, floats)
+	}
+}
+
+// TestPixelRGBA8 converts texels holding every pair of R and B bytes, and of G
+// and A bytes, between every supported pair of formats.
+func TestPixelRGBA8(t *testing.T) {
+	texels := make([]byte, 4*65536)
+	for k := 0; k < 65536; k++ {
+		texels[4*k] = byte(k)
+		texels[4*k+1] = byte(k >> 8)
+		texels[4*k+2] = byte(k >> 8)
+		texels[4*k+3] = byte(k)
+	}
+	for _, src := range rgba8Formats {
+		for _, dst := range rgba8Formats {
+			compareScalar(t, dst, src, texels)
+		}
+		compareScalar(t, VK_FORMAT_R32G32B32A32_SFLOAT, src, texels)
+	}
+}
+
+// TestPixelConvertRows checks the row strides and the texels left after the
+// SIMD blocks, and that the bytes between the rows are left alone.
+func TestPixelConvertRows(t *testing.T) {
+	pairs := [][2]Format{
+		{VK_FORMAT_B8G8R8A8_UNORM, VK_FORMAT_R8G8B8A8_UNORM},
+		{VK_FORMAT_R8G8B8A8_SRGB, VK_FORMAT_R8G8B8A8_UNORM},
+		{VK_FORMAT_R32G32B32A32_SFLOAT, VK_FORMAT_B8G8R8A8_SRGB},
+		{VK_FORMAT_R8G8B8A8_SRGB, VK_FORMAT_R32G32B32A32_SFLOAT},
+		{VK_FORMAT_R16G16B16_SFLOAT, VK_FORMAT_R32G32B32_SFLOAT},
+		{VK_FORMAT_R32_SFLOAT, VK_FORMAT_R16_SFLOAT},
+	}
+	rng := rand.New(rand.NewSource(2))
+	for _, pair := range pairs {
+		pc, err := NewPixelConversion(pair[0], pair[1])
+		if err != nil {
+			t.Fatal(err)
+		}
+		for width := 1; width <= 67; width++ {
+			for _, height := range []int{1, 2, 5} {
+				srcStride := width*pc.SrcTexel + rng.Intn(3)*4
+				dstStride := width*pc.DstTexel + rng.Intn(3)*4
+				src := make([]byte, srcStride*height)
+				rng.Read(src)
+				if pair[1] == VK_FORMAT_R32G32B32A32_SFLOAT || pair[1] == VK_FORMAT_R32G32B32_SFLOAT {
+					for k := 0; k+4 <= len(src); k += 4 {
+						binary.LittleEndian.PutUint32(src[k:], math.Float32bits(rng.Float32()*1.25-0.125))
+					}
+				}
+				simd := bytes.Repeat([]byte{0xa5}, dstStride*height)
+				scalar := bytes.Repeat([]byte{0xa5}, dstStride*height)
+				if err := pc.ConvertRows(simd, dstStride, src, srcStride, width, height); err != nil {
+					t.Fatal(err)
+				}
+				pc.scalar().ConvertRows(scalar, dstStride, src, srcStride, width, height)
+				if !bytes.Equal(simd, scalar) {
+					t.Fatalf("%v to %v %dx%d differs from scalar", pair[1], pair[0], width, height)
+				}
+				for y := 0; y < height; y++ {
+					for _, b := range simd[y*dstStride+width*pc.DstTexel : (y+1)*dstStride] {
+						if b != 0xa5 {
+							t.Fatalf("%v to %v %dx%d wrote past row %d", pair[1], pair[0], width, height, y)
+						}
+					}
+				}
+			}
+		}
+	}
+
+	// Large enough to be split across goroutines.
+	pc, _ := NewPixelConversion(VK_FORMAT_R32G32B32A32_SFLOAT, VK_FORMAT_B8G8R8A8_SRGB)
+	width, height := 1023, 301
+	src := make([]byte, 4*width*height)
+	rng.Read(src)
+	simd := make([]byte, 16*width*height)
+	scalar := make([]byte, 16*width*height)
+	pc.ConvertRows(simd, 16*width, src, 4*width, width, height)
+	pc.scalar().ConvertRows(scalar, 16*width, src, 4*width, width, height)
+	if !bytes.Equal(simd, scalar) {
+		t.Fatalf("split conversion differs from scalar")
+	}
+}
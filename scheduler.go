@@ -0,0 +1,391 @@
+//go:build !vks_no_version_1_3 && !vks_no_version_1_1 && !vks_no_version_1_2
+
+package vks
+
+import (
+	"fmt"
+	"sync"
+	"unsafe"
+)
+
+// DeviceSchedulerConfig configures a DeviceScheduler.
+type DeviceSchedulerConfig struct {
+	InFlight int        // The jobs in flight per device; see ComputeRunnerConfig.
+	SlotSize DeviceSize // The maximum input and output size of a job.
+
+	// Groups creates one device per device group instead of one per
+	// physical device, so split jobs are spread over the physical devices
+	// of a group. See ComputeJob.Split.
+	Groups bool
+
+	// CacheDir caches the capabilities of the physical devices; see
+	// LoadDeviceCapabilities. They are queried every time when empty.
+	CacheDir string
+}
+
+// schedulerWorker is the device, queues, pipeline cache and compute runner of
+// one suitable physical device or device group. Its goroutine is the only
+// user of the runner.
+type schedulerWorker struct {
+	physical PhysicalDeviceFacade
+	device   DeviceFacade
+	caps     *DeviceCapabilities
+	cache    PipelineCache
+	runner   *ComputeRunner
+
+	// Guarded by the scheduler mutex.
+	queued  []*ComputeJob // Assigned and not submitted yet.
+	running int           // Submitted to the runner and not completed.
+	cost    float64       // Measured seconds per job; 0 until known.
+	stats   ComputeRunnerStats
+}
+
+// DeviceScheduler distributes independent compute jobs over every suitable
+// physical device of an instance. Every device gets its own queues, pipeline
+// cache and ComputeRunner, with its own staging and device memory, driven by
+// a goroutine. Jobs are assigned to the device with the earliest expected
+// completion, from its queue depth and measured seconds per job, and idle
+// devices steal queued jobs from the busiest one.
+//
+// A physical device is suitable when it supports Vulkan 1.3 with the
+// timelineSemaphore and synchronization2 features and has a compute queue.
+// The instance must be created for Vulkan 1.3.
+type DeviceScheduler struct {
+	workers []*schedulerWorker
+
+	mu      sync.Mutex
+	cond    *sync.Cond
+	pending int // Submitted jobs not completed yet.
+	err     error
+	closed  bool
+	done    sync.WaitGroup // The worker goroutines.
+}
+
+// NewDeviceScheduler creates a device and compute runner for every suitable
+// physical device, or device group, of the instance. It fails when none is
+// suitable.
+func NewDeviceScheduler(instance InstanceFacade, config DeviceSchedulerConfig) (*DeviceScheduler, error) {
+	groups, err := enumerateDeviceGroups(instance, config.Groups)
+	if err != nil {
+		return nil, err
+	}
+	sched := &DeviceScheduler{}
+	sched.cond = sync.NewCond(&sched.mu)
+	for _, group := range groups {
+		worker, err := newSchedulerWorker(instance, group, config)
+		if err != nil {
+			sched.Destroy()
+			return nil, err
+		}
+		if worker != nil {
+			sched.workers = append(sched.workers, worker)
+		}
+	}
+	if len(sched.workers) == 0 {
+		return nil, fmt.Errorf("error: no physical device supports Vulkan 1.3 compute with timeline semaphores and synchronization2")
+	}
+	for _, worker := range sched.workers {
+		sched.done.Add(1)
+		go sched.run(worker)
+	}
+	return sched, nil
+}
+
+// enumerateDeviceGroups returns the physical devices of the instance, each in
+// its own group unless groups is set.
+func enumerateDeviceGroups(instance InstanceFacade, groups bool) ([][]PhysicalDevice, error) {
+	if !groups {
+		devices, ret := instance.EnumeratePhysicalDevicesInto(nil)
+		if err := ret.AsErr(); err != nil {
+			return nil, err
+		}
+		result := make([][]PhysicalDevice, len(devices))
+		for h := range result {
+			result[h] = devices[h : h+1]
+		}
+		return result, nil
+	}
+
+	props, ret := instance.EnumeratePhysicalDeviceGroupsInto(nil)
+	if err := ret.AsErr(); err != nil {
+		return nil, err
+	}
+	result := make([][]PhysicalDevice, len(props))
+	for h := range result {
+		result[h] = props[h].PhysicalDevices()[:props[h].PhysicalDeviceCount()]
+	}
+	return result, nil
+}
+
+// newSchedulerWorker creates the device of the group. It returns nil without
+// an error when the group is not suitable.
+func newSchedulerWorker(instance InstanceFacade, group []PhysicalDevice, config DeviceSchedulerConfig) (*schedulerWorker, error) {
+	worker := &schedulerWorker{physical: instance.MakePhysicalDeviceFacade(group[0])}
+	if len(config.CacheDir) > 0 {
+		// The cache only speeds up the next start; the capabilities are
+		// still returned when it cannot be written.
+		worker.caps, _ = LoadDeviceCapabilities(worker.physical, config.CacheDir)
+	} else {
+		worker.caps = QueryDeviceCapabilities(worker.physical)
+	}
+	caps := worker.caps
+	version := ApiVersion(caps.Properties.ApiVersion())
+	if version.Major() == 1 && version.Minor() < 3 ||
+		!caps.Vulkan12Features.TimelineSemaphore().IsTrue() ||
+		!caps.Vulkan13Features.Synchronization2().IsTrue() {
+		return nil, nil
+	}
+	compute, ok := caps.FindQueueFamily(QueueFlags(VK_QUEUE_COMPUTE_BIT))
+	if !ok {
+		return nil, nil
+	}
+	// A family with transfers only is usually a separate copy engine.
+	transfer := compute
+	for h, family := range caps.QueueFamilies {
+		flags := family.QueueFlags()
+		if flags&QueueFlags(VK_QUEUE_TRANSFER_BIT) != 0 && flags&QueueFlags(VK_QUEUE_GRAPHICS_BIT|VK_QUEUE_COMPUTE_BIT) == 0 {
+			transfer = uint32(h)
+			break
+		}
+	}
+
+	arp := NewAutoReleaser()
+	defer arp.Release()
+	priorities := []float32{1}
+	queueInfos := make([]DeviceQueueCreateInfo, 1, 2)
+	queueInfos[0].SetDefaultSType()
+	queueInfos[0].SetQueueFamilyIndex(compute)
+	queueInfos[0].PinPQueuePriorities(arp, priorities)
+	if transfer != compute {
+		queueInfos = queueInfos[:2]
+		queueInfos[1] = queueInfos[0]
+		queueInfos[1].SetQueueFamilyIndex(transfer)
+	}
+	features12 := &PhysicalDeviceVulkan12Features{}
+	features12.SetDefaultSType()
+	features12.SetTimelineSemaphore(VK_TRUE)
+	features13 := &PhysicalDeviceVulkan13Features{}
+	features13.SetDefaultSType()
+	features13.SetSynchronization2(VK_TRUE)
+	features12.PinPNext(arp, unsafe.Pointer(features13))
+	if len(group) > 1 {
+		groupInfo := &DeviceGroupDeviceCreateInfo{}
+		groupInfo.SetDefaultSType()
+		groupInfo.PinPPhysicalDevices(arp, group)
+		features13.PinPNext(arp, unsafe.Pointer(groupInfo))
+	}
+	info := &DeviceCreateInfo{}
+	info.SetDefaultSType()
+	info.PinPNext(arp, unsafe.Pointer(features12))
+	info.PinPQueueCreateInfos(arp, queueInfos)
+	var device Device
+	if err := worker.physical.CreateDevice(info, nil, &device).AsErr(); err != nil {
+		return nil, err
+	}
+	worker.device = worker.physical.MakeDeviceFacade(device)
+
+	cacheInfo := PipelineCacheCreateInfo{}.WithDefaultSType()
+	var cache PipelineCache
+	if err := worker.device.CreatePipelineCache(&cacheInfo, nil, &cache).AsErr(); err != nil {
+		worker.destroy()
+		return nil, err
+	}
+	worker.cache = cache
+
+	queues := make([]ComputeQueue, 2)
+	for h, family := range []uint32{compute, transfer} {
+		var queue Queue
+		worker.device.GetDeviceQueue(family, 0, &queue)
+		queues[h] = ComputeQueue{Queue: worker.device.MakeQueueFacade(queue), Family: family}
+	}
+	runner, err := NewComputeRunner(worker.device, caps, ComputeRunnerConfig{
+		Compute:       queues[0],
+		Transfer:      queues[1],
+		InFlight:      config.InFlight,
+		SlotSize:      config.SlotSize,
+		PipelineCache: worker.cache,
+		DeviceCount:   len(group),
+	})
+	if err != nil {
+		worker.destroy()
+		return nil, err
+	}
+	worker.runner = runner
+	return worker, nil
+}
+
+func (worker *schedulerWorker) destroy() {
+	if worker.runner != nil {
+		worker.runner.Destroy()
+	}
+	worker.device.DestroyPipelineCache(worker.cache, nil)
+	worker.device.DestroyDevice(nil)
+}
+
+// Devices returns the number of devices jobs are distributed over.
+func (sched *DeviceScheduler) Devices() int {
+	return len(sched.workers)
+}
+
+// Device returns the physical device and the device of the worker at index.
+func (sched *DeviceScheduler) Device(index int) (PhysicalDeviceFacade, DeviceFacade) {
+	return sched.workers[index].physical, sched.workers[index].device
+}
+
+// Stats returns the statistics of the compute runner of every device.
+func (sched *DeviceScheduler) Stats() []ComputeRunnerStats {
+	sched.mu.Lock()
+	defer sched.mu.Unlock()
+	stats := make([]ComputeRunnerStats, len(sched.workers))
+	for h, worker := range sched.workers {
+		stats[h] = worker.stats
+	}
+	return stats
+}
+
+// Submit assigns the job to the device expected to complete it first. The
+// job's Output is filled by the time Wait returns.
+func (sched *DeviceScheduler) Submit(job *ComputeJob) {
+	sched.mu.Lock()
+	defer sched.mu.Unlock()
+
+	// Devices without measurements yet are assumed to be as fast as the
+	// measured ones.
+	var known, total float64
+	for _, worker := range sched.workers {
+		if worker.cost > 0 {
+			known++
+			total += worker.cost
+		}
+	}
+	fallback := 1.0
+	if known > 0 {
+		fallback = total / known
+	}
+	var best *schedulerWorker
+	var bestEta float64
+	for _, worker := range sched.workers {
+		cost := worker.cost
+		if cost == 0 {
+			cost = fallback
+		}
+		eta := float64(len(worker.queued)+worker.running+1) * cost
+		if best == nil || eta < bestEta {
+			best, bestEta = worker, eta
+		}
+	}
+	best.queued = append(best.queued, job)
+	sched.pending++
+	sched.cond.Broadcast()
+}
+
+// Wait waits for every submitted job to complete, and returns the first error
+// since the previous Wait.
+func (sched *DeviceScheduler) Wait() error {
+	sched.mu.Lock()
+	defer sched.mu.Unlock()
+	for sched.pending > 0 {
+		sched.cond.Wait()
+	}
+	err := sched.err
+	sched.err = nil
+	return err
+}
+
+// Destroy waits for the submitted jobs, stops the workers and destroys their
+// runners, pipeline caches and devices.
+func (sched *DeviceScheduler) Destroy() {
+	sched.mu.Lock()
+	sched.closed = true
+	sched.cond.Broadcast()
+	sched.mu.Unlock()
+	sched.done.Wait()
+	for _, worker := range sched.workers {
+		worker.destroy()
+	}
+	sched.workers = nil
+}
+
+// take returns the next job of the worker: its own oldest queued job, or the
+// newest queued job of the busiest worker. It only blocks when wait is set,
+// and returns nil once the scheduler is closed and no job is left.
+func (sched *DeviceScheduler) take(worker *schedulerWorker, wait bool) *ComputeJob {
+	sched.mu.Lock()
+	defer sched.mu.Unlock()
+	for {
+		if len(worker.queued) > 0 {
+			job := worker.queued[0]
+			worker.queued = worker.queued[1:]
+			worker.running++
+			return job
+		}
+		var victim *schedulerWorker
+		for _, other := range sched.workers {
+			if len(other.queued) > 0 && (victim == nil || len(other.queued) > len(victim.queued)) {
+				victim = other
+			}
+		}
+		if victim != nil {
+			last := len(victim.queued) - 1
+			job := victim.queued[last]
+			victim.queued = victim.queued[:last]
+			worker.running++
+			return job
+		}
+		if !wait || sched.closed {
+			return nil
+		}
+		sched.cond.Wait()
+	}
+}
+
+// complete records the completion of n jobs of the worker.
+func (sched *DeviceScheduler) complete(worker *schedulerWorker, n int, err error) {
+	if n == 0 && err == nil {
+		return
+	}
+	stats := worker.runner.Stats()
+	sched.mu.Lock()
+	defer sched.mu.Unlock()
+	worker.running -= n
+	sched.pending -= n
+	worker.stats = stats
+	if stats.Jobs > 0 {
+		worker.cost = stats.Elapsed.Seconds() / float64(stats.Jobs)
+	}
+	if err != nil && sched.err == nil {
+		sched.err = err
+	}
+	sched.cond.Broadcast()
+}
+
+// run feeds the worker's runner until the scheduler is closed. It only waits
+// for the runner when there is nothing left to submit, so the stages of
+// consecutive jobs keep overlapping.
+func (sched *DeviceScheduler) run(worker *schedulerWorker) {
+	defer sched.done.Done()
+	runner := worker.runner
+	inFlight := 0
+	for {
+		job := sched.take(worker, inFlight == 0)
+		if job == nil {
+			if inFlight == 0 {
+				return
+			}
+			err := runner.Wait(^uint64(0))
+			sched.complete(worker, inFlight, err)
+			inFlight = 0
+			continue
+		}
+
+		before := runner.Completed()
+		if err := runner.Submit(job, ^uint64(0)); err != nil {
+			sched.complete(worker, 1, err)
+		} else {
+			inFlight++
+		}
+		n := int(runner.Completed() - before)
+		inFlight -= n
+		sched.complete(worker, n, nil)
+	}
+}
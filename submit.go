@@ -0,0 +1,134 @@
+//go:build !vks_no_version_1_3 && !vks_no_version_1_1 && !vks_no_version_1_2
+
+package vks
+
+// PreparedSubmitInfo describes one SubmitInfo2 of a PreparedSubmit. The
+// semaphore and command buffer infos are copied into C memory by
+// NewPreparedSubmit, so the slices can be reused or discarded afterwards.
+type PreparedSubmitInfo struct {
+	Flags          SubmitFlags
+	Waits          []SemaphoreSubmitInfo
+	CommandBuffers []CommandBufferSubmitInfo
+	Signals        []SemaphoreSubmitInfo
+}
+
+// PreparedSubmit is a set of SubmitInfo2 structures, and the semaphore and
+// command buffer infos they point to, built once in C memory. Per frame, only
+// the command buffer handles, semaphores and timeline values are patched in
+// place before calling Submit, so submitting does not allocate or copy the
+// submit infos from Go to C.
+//
+// Free must be called to release the C memory.
+type PreparedSubmit struct {
+	submits []SubmitInfo2
+	waits   [][]SemaphoreSubmitInfo
+	cmds    [][]CommandBufferSubmitInfo
+	signals [][]SemaphoreSubmitInfo
+
+	// The backing C arrays shared by all the submits.
+	waitBlock   []SemaphoreSubmitInfo
+	cmdBlock    []CommandBufferSubmitInfo
+	signalBlock []SemaphoreSubmitInfo
+}
+
+// NewPreparedSubmit copies the provided descriptions into C memory and links
+// them together as SubmitInfo2 structures. The sType of every copied structure
+// is set to the specification default.
+func NewPreparedSubmit(infos ...PreparedSubmitInfo) *PreparedSubmit {
+	ps := &PreparedSubmit{
+		waits:   make([][]SemaphoreSubmitInfo, len(infos)),
+		cmds:    make([][]CommandBufferSubmitInfo, len(infos)),
+		signals: make([][]SemaphoreSubmitInfo, len(infos)),
+	}
+
+	var waits, signals []SemaphoreSubmitInfo
+	var cmds []CommandBufferSubmitInfo
+	for _, info := range infos {
+		waits = append(waits, info.Waits...)
+		cmds = append(cmds, info.CommandBuffers...)
+		signals = append(signals, info.Signals...)
+	}
+	ps.waitBlock = SemaphoreSubmitInfoMakeCSlice(waits...)
+	ps.cmdBlock = CommandBufferSubmitInfoMakeCSlice(cmds...)
+	ps.signalBlock = SemaphoreSubmitInfoMakeCSlice(signals...)
+	for h := range ps.waitBlock {
+		ps.waitBlock[h].SetDefaultSType()
+	}
+	for h := range ps.cmdBlock {
+		ps.cmdBlock[h].SetDefaultSType()
+	}
+	for h := range ps.signalBlock {
+		ps.signalBlock[h].SetDefaultSType()
+	}
+
+	submits := make([]SubmitInfo2, len(infos))
+	var waitIdx, cmdIdx, signalIdx int
+	for k, info := range infos {
+		ps.waits[k] = ps.waitBlock[waitIdx : waitIdx+len(info.Waits) : waitIdx+len(info.Waits)]
+		ps.cmds[k] = ps.cmdBlock[cmdIdx : cmdIdx+len(info.CommandBuffers) : cmdIdx+len(info.CommandBuffers)]
+		ps.signals[k] = ps.signalBlock[signalIdx : signalIdx+len(info.Signals) : signalIdx+len(info.Signals)]
+		waitIdx += len(info.Waits)
+		cmdIdx += len(info.CommandBuffers)
+		signalIdx += len(info.Signals)
+
+		submits[k].SetDefaultSType()
+		submits[k].SetFlags(info.Flags)
+		submits[k].SetPWaitSemaphoreInfos(ps.waits[k])
+		submits[k].SetPCommandBufferInfos(ps.cmds[k])
+		submits[k].SetPSignalSemaphoreInfos(ps.signals[k])
+	}
+	ps.submits = SubmitInfo2MakeCSlice(submits...)
+	return ps
+}
+
+// Len returns the number of SubmitInfo2 structures in the prepared submit.
+func (ps *PreparedSubmit) Len() int {
+	return len(ps.submits)
+}
+
+// SetCommandBuffer patches the command buffer handle at index of the submit.
+func (ps *PreparedSubmit) SetCommandBuffer(submit, index int, commandBuffer CommandBuffer) {
+	ps.cmds[submit][index].SetCommandBuffer(commandBuffer)
+}
+
+// SetWait patches the semaphore and timeline value of the wait at index of
+// the submit. The value is ignored for binary semaphores.
+func (ps *PreparedSubmit) SetWait(submit, index int, semaphore Semaphore, value uint64) {
+	ps.waits[submit][index].SetSemaphore(semaphore)
+	ps.waits[submit][index].SetValue(value)
+}
+
+// SetWaitValue patches only the timeline value of the wait at index of the
+// submit.
+func (ps *PreparedSubmit) SetWaitValue(submit, index int, value uint64) {
+	ps.waits[submit][index].SetValue(value)
+}
+
+// SetSignal patches the semaphore and timeline value of the signal at index
+// of the submit. The value is ignored for binary semaphores.
+func (ps *PreparedSubmit) SetSignal(submit, index int, semaphore Semaphore, value uint64) {
+	ps.signals[submit][index].SetSemaphore(semaphore)
+	ps.signals[submit][index].SetValue(value)
+}
+
+// SetSignalValue patches only the timeline value of the signal at index of
+// the submit.
+func (ps *PreparedSubmit) SetSignalValue(submit, index int, value uint64) {
+	ps.signals[submit][index].SetValue(value)
+}
+
+// Submit submits all the prepared SubmitInfo2 structures to the queue with a
+// single QueueSubmit2 call.
+func (ps *PreparedSubmit) Submit(queue QueueFacade, fence Fence) Result {
+	return queue.QueueSubmit2(uint32(len(ps.submits)), ps.submits, fence)
+}
+
+// Free releases the C memory allocated by NewPreparedSubmit.
+func (ps *PreparedSubmit) Free() {
+	SubmitInfo2FreeCSlice(ps.submits)
+	SemaphoreSubmitInfoFreeCSlice(ps.waitBlock)
+	CommandBufferSubmitInfoFreeCSlice(ps.cmdBlock)
+	SemaphoreSubmitInfoFreeCSlice(ps.signalBlock)
+	ps.submits, ps.waitBlock, ps.cmdBlock, ps.signalBlock = nil, nil, nil, nil
+	ps.waits, ps.cmds, ps.signals = nil, nil, nil
+}
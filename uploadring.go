@@ -0,0 +1,312 @@
+//go:build !vks_no_version_1_2 && !vks_no_version_1_1
+
+package vks
+
+import (
+	"fmt"
+	"unsafe"
+)
+
+// ErrUploadRingFull is returned when an allocation does not fit in the
+// remaining space of the current frame region.
+var ErrUploadRingFull = fmt.Errorf("error: upload ring frame region is full")
+
+// UploadRingAllocation is a sub-allocation handed out by an UploadRing. Data
+// points directly into the mapped memory, so writes to it are visible to the
+// device once the frame is submitted.
+type UploadRingAllocation struct {
+	Buffer Buffer     // The buffer backing the ring.
+	Offset DeviceSize // The offset of the allocation inside Buffer.
+	Data   []byte     // The mapped bytes of the allocation.
+}
+
+// DynamicOffset returns the offset as a dynamic offset for
+// CmdBindDescriptorSets. It assumes the descriptor was written with an offset
+// of zero into the ring buffer.
+func (alloc UploadRingAllocation) DynamicOffset() uint32 {
+	return uint32(alloc.Offset)
+}
+
+// UploadRing is a persistently mapped, host visible buffer split into one
+// region per frame in flight. Sub-allocations are bump allocated from the
+// region of the current frame, and the region is reclaimed once the fence or
+// timeline value recorded by EndFrame has completed.
+//
+// The expected usage per frame is BeginFrame, any number of Alloc calls,
+// EndFrame with the fence or timeline value the frame's submission will
+// signal, and finally the queue submission itself.
+type UploadRing struct {
+	device       DeviceFacade
+	buffer       Buffer
+	memory       DeviceMemory
+	mapped       []byte
+	props        MemoryPropertyFlags
+	coherent     bool
+	atomSize     DeviceSize
+	uniformAlign DeviceSize
+	storageAlign DeviceSize
+	regionSize   DeviceSize
+	current      int
+	head         DeviceSize
+
+	// Per region completion guards. Fences are kept in their own slice so a
+	// single fence can be passed to WaitForFences without allocating.
+	fences     []Fence
+	semaphores []Semaphore
+	values     []uint64
+
+	// C memory reused for timeline waits and non-coherent flushes.
+	waitInfo  *SemaphoreWaitInfo
+	waitSem   []Semaphore
+	waitValue []uint64
+	flush     *MappedMemoryRange
+}
+
+// NewUploadRing creates the ring buffer, allocates host visible memory for it
+// and maps the memory for the lifetime of the ring. frames is the number of
+// frames in flight and regionSize is the number of bytes available to each
+// frame. usage should contain the buffer usages the allocations will be bound
+// as (for example uniform, storage or vertex buffer usage).
+func NewUploadRing(device DeviceFacade, memProps *PhysicalDeviceMemoryProperties, limits PhysicalDeviceLimits, frames int, regionSize DeviceSize, usage BufferUsageFlags) (*UploadRing, error) {
+	if frames < 1 {
+		return nil, fmt.Errorf("error: upload ring needs at least one frame, got %d", frames)
+	}
+	ring := &UploadRing{
+		device:       device,
+		atomSize:     maxDeviceSize(limits.NonCoherentAtomSize(), 1),
+		uniformAlign: maxDeviceSize(limits.MinUniformBufferOffsetAlignment(), 1),
+		storageAlign: maxDeviceSize(limits.MinStorageBufferOffsetAlignment(), 1),
+		fences:       make([]Fence, frames),
+		semaphores:   make([]Semaphore, frames),
+		values:       make([]uint64, frames),
+	}
+
+	// Regions start on an alignment that satisfies every kind of
+	// allocation, and non-coherent flushes of a region stay within it.
+	regionAlign := maxDeviceSize(ring.atomSize, maxDeviceSize(ring.uniformAlign, ring.storageAlign))
+	ring.regionSize = alignDeviceSize(regionSize, regionAlign)
+
+	arp := NewAutoReleaser()
+	defer arp.Release()
+
+	bInfo := CPtr(arp, &BufferCreateInfo{},
+		SetDefaultSType,
+		func(in *BufferCreateInfo) {
+			in.SetSize(ring.regionSize * DeviceSize(frames))
+			in.SetUsage(usage)
+			in.SetSharingMode(VK_SHARING_MODE_EXCLUSIVE)
+		},
+	)
+	// Handles are returned through locals; cgo rejects pointers into ring
+	// because it holds other Go pointers.
+	var buffer Buffer
+	if err := device.CreateBuffer(bInfo, nil, &buffer).AsErr(); err != nil {
+		return nil, err
+	}
+	ring.buffer = buffer
+
+	var reqs MemoryRequirements
+	device.GetBufferMemoryRequirements(ring.buffer, &reqs)
+	hostVisible := MemoryPropertyFlags(VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT)
+	hostCoherent := MemoryPropertyFlags(VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+	typeIndex, ok := FindMemoryTypeIndex(memProps, reqs.MemoryTypeBits(), hostVisible|hostCoherent)
+	ring.coherent = ok
+	if !ok {
+		if typeIndex, ok = FindMemoryTypeIndex(memProps, reqs.MemoryTypeBits(), hostVisible); !ok {
+			device.DestroyBuffer(ring.buffer, nil)
+			return nil, fmt.Errorf("error: no host visible memory type for upload ring")
+		}
+	}
+	ring.props = memProps.MemoryTypes()[typeIndex].PropertyFlags()
+
+	aInfo := CPtr(arp, &MemoryAllocateInfo{},
+		SetDefaultSType,
+		func(in *MemoryAllocateInfo) {
+			in.SetAllocationSize(reqs.Size())
+			in.SetMemoryTypeIndex(typeIndex)
+		},
+	)
+	var memory DeviceMemory
+	if err := device.AllocateMemory(aInfo, nil, &memory).AsErr(); err != nil {
+		device.DestroyBuffer(ring.buffer, nil)
+		return nil, err
+	}
+	ring.memory = memory
+	if err := device.BindBufferMemory(ring.buffer, ring.memory, 0).AsErr(); err != nil {
+		ring.release()
+		return nil, err
+	}
+
+	var pData unsafe.Pointer
+	if err := device.MapMemory(ring.memory, 0, DeviceSize(VK_WHOLE_SIZE), 0, &pData).AsErr(); err != nil {
+		ring.release()
+		return nil, err
+	}
+	ring.mapped = unsafe.Slice((*byte)(pData), ring.regionSize*DeviceSize(frames))
+
+	ring.waitSem = unsafe.Slice((*Semaphore)(newCBlock(cULong(unsafe.Sizeof(NullSemaphore)))), 1)
+	ring.waitValue = unsafe.Slice((*uint64)(newCBlock(cULong(unsafe.Sizeof(uint64(0))))), 1)
+	ring.waitInfo = SemaphoreWaitInfo{}.
+		WithDefaultSType().
+		WithPSemaphores(ring.waitSem).
+		WithPValues(ring.waitValue).
+		AsCPtr()
+	ring.flush = MappedMemoryRange{}.
+		WithDefaultSType().
+		WithMemory(ring.memory).
+		AsCPtr()
+
+	return ring, nil
+}
+
+// Buffer returns the buffer backing the ring.
+func (ring *UploadRing) Buffer() Buffer {
+	return ring.buffer
+}
+
+// Frames returns the number of frame regions in the ring.
+func (ring *UploadRing) Frames() int {
+	return len(ring.fences)
+}
+
+// RegionSize returns the number of bytes available to each frame.
+func (ring *UploadRing) RegionSize() DeviceSize {
+	return ring.regionSize
+}
+
+// BeginFrame advances the ring to the next frame region. If the region is
+// still in use by the device, it waits up to timeout nanoseconds for the fence
+// or timeline value recorded by EndFrame. See WaitForFences and
+// WaitSemaphores for possible errors.
+func (ring *UploadRing) BeginFrame(timeout uint64) error {
+	next := (ring.current + 1) % len(ring.fences)
+	if err := ring.reclaim(next, timeout); err != nil {
+		return err
+	}
+	ring.current = next
+	ring.head = 0
+	return nil
+}
+
+// EndFrame records the fence that is signaled when the device is done with the
+// current region. Non-coherent memory is flushed before returning, so EndFrame
+// must be called before the frame is submitted.
+func (ring *UploadRing) EndFrame(fence Fence) error {
+	ring.fences[ring.current] = fence
+	ring.semaphores[ring.current] = NullSemaphore
+	return ring.flushCurrent()
+}
+
+// EndFrameTimeline records the timeline semaphore value that is reached when
+// the device is done with the current region. Non-coherent memory is flushed
+// before returning, so EndFrameTimeline must be called before the frame is
+// submitted.
+func (ring *UploadRing) EndFrameTimeline(semaphore Semaphore, value uint64) error {
+	ring.fences[ring.current] = NullFence
+	ring.semaphores[ring.current] = semaphore
+	ring.values[ring.current] = value
+	return ring.flushCurrent()
+}
+
+// Alloc sub-allocates size bytes aligned to alignment from the current frame
+// region. It returns ErrUploadRingFull when the region is exhausted.
+func (ring *UploadRing) Alloc(size, alignment DeviceSize) (UploadRingAllocation, error) {
+	offset := alignDeviceSize(ring.head, maxDeviceSize(alignment, 1))
+	if offset+size > ring.regionSize {
+		return UploadRingAllocation{}, ErrUploadRingFull
+	}
+	ring.head = offset + size
+	base := ring.regionSize*DeviceSize(ring.current) + offset
+	return UploadRingAllocation{
+		Buffer: ring.buffer,
+		Offset: base,
+		Data:   ring.mapped[base : base+size : base+size],
+	}, nil
+}
+
+// AllocUniform sub-allocates size bytes aligned to
+// minUniformBufferOffsetAlignment.
+func (ring *UploadRing) AllocUniform(size DeviceSize) (UploadRingAllocation, error) {
+	return ring.Alloc(size, ring.uniformAlign)
+}
+
+// AllocStorage sub-allocates size bytes aligned to
+// minStorageBufferOffsetAlignment.
+func (ring *UploadRing) AllocStorage(size DeviceSize) (UploadRingAllocation, error) {
+	return ring.Alloc(size, ring.storageAlign)
+}
+
+// Upload sub-allocates len(src) bytes with the provided alignment and copies
+// src into the mapped memory, with streaming stores when the memory is not
+// host cached. See CopyToMapped.
+func (ring *UploadRing) Upload(src []byte, alignment DeviceSize) (UploadRingAllocation, error) {
+	alloc, err := ring.Alloc(DeviceSize(len(src)), alignment)
+	if err == nil {
+		CopyToMapped(alloc.Data, src, ring.props)
+	}
+	return alloc, err
+}
+
+// Destroy waits for every region to be released by the device, then unmaps
+// the memory and destroys the buffer and memory. Fences and semaphores passed
+// to EndFrame are owned by the caller and are not destroyed.
+func (ring *UploadRing) Destroy() {
+	for h := range ring.fences {
+		ring.reclaim(h, ^uint64(0))
+	}
+	ring.device.UnmapMemory(ring.memory)
+	ring.mapped = nil
+	ring.release()
+	ring.waitInfo.Free()
+	cFreer(uintptr(unsafe.Pointer(&ring.waitSem[0]))).Free()
+	cFreer(uintptr(unsafe.Pointer(&ring.waitValue[0]))).Free()
+	ring.flush.Free()
+}
+
+func (ring *UploadRing) release() {
+	ring.device.DestroyBuffer(ring.buffer, nil)
+	ring.device.FreeMemory(ring.memory, nil)
+}
+
+func (ring *UploadRing) reclaim(idx int, timeout uint64) error {
+	if fence := ring.fences[idx]; fence != NullFence {
+		if err := ring.device.WaitForFences(1, ring.fences[idx:idx+1], VK_TRUE, timeout).AsErr(); err != nil {
+			return err
+		}
+		ring.fences[idx] = NullFence
+	} else if sem := ring.semaphores[idx]; sem != NullSemaphore {
+		var value uint64
+		if err := ring.device.GetSemaphoreCounterValue(sem, &value).AsErr(); err != nil {
+			return err
+		}
+		if value < ring.values[idx] {
+			ring.waitSem[0] = sem
+			ring.waitValue[0] = ring.values[idx]
+			if err := ring.device.WaitSemaphores(ring.waitInfo, timeout).AsErr(); err != nil {
+				return err
+			}
+		}
+		ring.semaphores[idx] = NullSemaphore
+	}
+	return nil
+}
+
+func (ring *UploadRing) flushCurrent() error {
+	if ring.coherent || ring.head == 0 {
+		return nil
+	}
+	ring.flush.SetOffset(ring.regionSize * DeviceSize(ring.current))
+	ring.flush.SetSize(alignDeviceSize(ring.head, ring.atomSize))
+	return ring.device.FlushMappedMemoryRanges(1, unsafe.Slice(ring.flush, 1)).AsErr()
+}
+
+func alignDeviceSize(v, alignment DeviceSize) DeviceSize {
+	return (v + alignment - 1) / alignment * alignment
+}
+
+func maxDeviceSize(a, b DeviceSize) DeviceSize {
+	if a > b {
+		return a
+	}
+	return b
+}
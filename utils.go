@@ -3,6 +3,8 @@ package vks
 import (
 	"bytes"
 	"fmt"
+	"strings"
+	"sync"
 	"unsafe"
 )
 
@@ -52,6 +54,14 @@ func (bool32 Bool32) IsFalse() bool {
 	return bool32 == VK_FALSE
 }
 
+// MakeBool32 converts a Go bool to VK_TRUE or VK_FALSE.
+func MakeBool32(b bool) Bool32 {
+	if b {
+		return VK_TRUE
+	}
+	return VK_FALSE
+}
+
 // String returns the string representation of the bool.
 func (bool32 Bool32) String() string {
 	return fmt.Sprintf("%t", bool32.IsTrue())
@@ -59,14 +69,52 @@ func (bool32 Bool32) String() string {
 
 // ToString converts a null terminated slice of bytes into a Go string.
 func ToString(b []byte) string {
-	var str bytes.Buffer
-	for _, c := range b {
-		if c == '\x00' {
-			return str.String()
-		}
-		str.WriteByte(c)
+	if n := bytes.IndexByte(b, 0); n >= 0 {
+		b = b[:n]
+	}
+	return string(b)
+}
+
+// ToStringView is ToString without the copy: the string shares the memory of
+// b, which must not change while the string is in use. It suits the names
+// returned by getters like ExtensionProperties.ExtensionName, which return a
+// private copy of the structure.
+func ToStringView(b []byte) string {
+	if n := bytes.IndexByte(b, 0); n >= 0 {
+		b = b[:n]
 	}
-	return str.String()
+	return unsafe.String(unsafe.SliceData(b), len(b))
+}
+
+// internedCStrs holds the C strings of InternCStr.
+var internedCStrs struct {
+	sync.RWMutex
+	m map[string]*byte
+}
+
+// InternCStr returns a C copy of s shared by the whole process. The copy is
+// made on the first call and never released, so it suits the small set of
+// strings passed over and over, like layer, extension and entry point names.
+// The returned string must not be modified or freed.
+func InternCStr(s string) *byte {
+	internedCStrs.RLock()
+	ptr, ok := internedCStrs.m[s]
+	internedCStrs.RUnlock()
+	if ok {
+		return ptr
+	}
+
+	internedCStrs.Lock()
+	defer internedCStrs.Unlock()
+	if ptr, ok := internedCStrs.m[s]; ok {
+		return ptr
+	}
+	if internedCStrs.m == nil {
+		internedCStrs.m = make(map[string]*byte)
+	}
+	ptr = NewCString(s)
+	internedCStrs.m[strings.Clone(s)] = ptr
+	return ptr
 }
 
 func CPtr[OUT any, IN CCloner[OUT]](arp *AutoReleasePool, in IN, opts ...ConfigFunction[IN]) OUT {
@@ -90,3 +138,16 @@ func SetPNext[T interface{ SetPNext(unsafe.Pointer) }, S any](next *S) ConfigFun
 		in.SetPNext(ptr)
 	}
 }
+
+type pNextPinner interface {
+	PinPNext(*AutoReleasePool, unsafe.Pointer)
+}
+
+// PinPNext is SetPNext for Go memory. The struct next points to is pinned with
+// the AutoReleasePool instead of being copied to the C heap.
+func PinPNext[T pNextPinner, S any](arp *AutoReleasePool, next *S) ConfigFunction[T] {
+	ptr := unsafe.Pointer(next)
+	return func(in T) {
+		in.PinPNext(arp, ptr)
+	}
+}
@@ -0,0 +1,17976 @@
+// Binary capture and replay of the commands issued through the wrappers.
+//
+// A trace starts with the "VKSTRACE" magic, a uint32_t version, a uint32_t
+// command count and the command names as a uint32_t length followed by the
+// characters. It is followed by records made of a uint32_t command id, a
+// uint32_t payload size and the payload. Payloads hold the raw bytes of the
+// parameters, with every pointer replaced by a uint64_t element count (zero
+// for NULL) and the pointed data, recursively. Handles created by the command
+// follow the parameters. Values are in host byte order and structs use the
+// host layout, so traces are replayed on the same architecture.
+#include <pthread.h>
+#include <stdint.h>
+#include <time.h>
+#include "vk_capture.h"
+
+int vksCaptureActive = 0;
+
+static const char* capture_names[VKS_CAPTURE_COMMAND_COUNT] = {
+	"vkGetImageMemoryRequirements",
+	"vkUnmapMemory",
+	"vkResetDescriptorPool",
+	"vkAllocateDescriptorSets",
+	"vkFreeDescriptorSets",
+	"vkUpdateDescriptorSets",
+	"vkFreeMemory",
+	"vkDestroyQueryPool",
+	"vkMapMemory",
+	"vkResetFences",
+	"vkFlushMappedMemoryRanges",
+	"vkInvalidateMappedMemoryRanges",
+	"vkGetDeviceMemoryCommitment",
+	"vkBindBufferMemory",
+	"vkBindImageMemory",
+	"vkEnumerateInstanceLayerProperties",
+	"vkGetBufferMemoryRequirements",
+	"vkGetPhysicalDeviceQueueFamilyProperties",
+	"vkGetPhysicalDeviceProperties",
+	"vkCreatePipelineLayout",
+	"vkGetPhysicalDeviceImageFormatProperties",
+	"vkGetImageSparseMemoryRequirements",
+	"vkCreateFramebuffer",
+	"vkDestroyFramebuffer",
+	"vkCreateRenderPass",
+	"vkDestroyRenderPass",
+	"vkGetRenderAreaGranularity",
+	"vkGetPhysicalDeviceFormatProperties",
+	"vkGetPhysicalDeviceFeatures",
+	"vkDestroyPipeline",
+	"vkEnumeratePhysicalDevices",
+	"vkDestroyInstance",
+	"vkCreateInstance",
+	"vkCreateComputePipelines",
+	"vkCreateGraphicsPipelines",
+	"vkGetPhysicalDeviceSparseImageFormatProperties",
+	"vkQueueBindSparse",
+	"vkMergePipelineCaches",
+	"vkGetPipelineCacheData",
+	"vkDestroyPipelineCache",
+	"vkCreatePipelineCache",
+	"vkDestroyShaderModule",
+	"vkCreateShaderModule",
+	"vkDestroyImageView",
+	"vkCreateDescriptorPool",
+	"vkCreateImageView",
+	"vkCreateFence",
+	"vkGetImageSubresourceLayout",
+	"vkDestroyDescriptorSetLayout",
+	"vkCreateDescriptorSetLayout",
+	"vkCreateCommandPool",
+	"vkDestroyCommandPool",
+	"vkResetCommandPool",
+	"vkAllocateMemory",
+	"vkDeviceWaitIdle",
+	"vkQueueWaitIdle",
+	"vkDestroyImage",
+	"vkQueueSubmit",
+	"vkGetDeviceQueue",
+	"vkAllocateCommandBuffers",
+	"vkFreeCommandBuffers",
+	"vkBeginCommandBuffer",
+	"vkEndCommandBuffer",
+	"vkResetCommandBuffer",
+	"vkEnumerateDeviceLayerProperties",
+	"vkCreateImage",
+	"vkCreateBuffer",
+	"vkDestroyDescriptorPool",
+	"vkGetPhysicalDeviceMemoryProperties",
+	"vkEnumerateDeviceExtensionProperties",
+	"vkDestroySampler",
+	"vkCreateSampler",
+	"vkEnumerateInstanceExtensionProperties",
+	"vkDestroyDevice",
+	"vkDestroyBufferView",
+	"vkCmdBindPipeline",
+	"vkCmdSetViewport",
+	"vkCmdSetScissor",
+	"vkCmdSetLineWidth",
+	"vkCmdSetDepthBias",
+	"vkCmdSetBlendConstants",
+	"vkCmdSetDepthBounds",
+	"vkCmdSetStencilCompareMask",
+	"vkCmdSetStencilWriteMask",
+	"vkCmdSetStencilReference",
+	"vkCmdBindDescriptorSets",
+	"vkCmdBindIndexBuffer",
+	"vkCmdBindVertexBuffers",
+	"vkCmdDraw",
+	"vkCmdDrawIndexed",
+	"vkCmdDrawIndirect",
+	"vkCmdDrawIndexedIndirect",
+	"vkCmdDispatch",
+	"vkCmdDispatchIndirect",
+	"vkCmdCopyBuffer",
+	"vkCmdCopyImage",
+	"vkCmdBlitImage",
+	"vkCmdCopyBufferToImage",
+	"vkCmdCopyImageToBuffer",
+	"vkCmdUpdateBuffer",
+	"vkCmdFillBuffer",
+	"vkCmdClearColorImage",
+	"vkCmdClearDepthStencilImage",
+	"vkCmdClearAttachments",
+	"vkCmdResolveImage",
+	"vkCmdSetEvent",
+	"vkCmdResetEvent",
+	"vkCmdWaitEvents",
+	"vkCmdPipelineBarrier",
+	"vkCmdBeginQuery",
+	"vkCmdEndQuery",
+	"vkCmdResetQueryPool",
+	"vkCmdWriteTimestamp",
+	"vkCmdCopyQueryPoolResults",
+	"vkCmdPushConstants",
+	"vkCmdBeginRenderPass",
+	"vkCmdNextSubpass",
+	"vkCmdEndRenderPass",
+	"vkCmdExecuteCommands",
+	"vkCreateBufferView",
+	"vkGetFenceStatus",
+	"vkWaitForFences",
+	"vkCreateDevice",
+	"vkCreateSemaphore",
+	"vkDestroySemaphore",
+	"vkDestroyPipelineLayout",
+	"vkDestroyBuffer",
+	"vkDestroyFence",
+	"vkCreateEvent",
+	"vkDestroyEvent",
+	"vkGetEventStatus",
+	"vkSetEvent",
+	"vkResetEvent",
+	"vkCreateQueryPool",
+	"vkGetQueryPoolResults",
+	"vkGetPhysicalDeviceFormatProperties2",
+	"vkGetPhysicalDeviceExternalFenceProperties",
+	"vkGetPhysicalDeviceExternalBufferProperties",
+	"vkUpdateDescriptorSetWithTemplate",
+	"vkDestroyDescriptorUpdateTemplate",
+	"vkCreateDescriptorUpdateTemplate",
+	"vkDestroySamplerYcbcrConversion",
+	"vkCreateSamplerYcbcrConversion",
+	"vkGetDeviceQueue2",
+	"vkTrimCommandPool",
+	"vkGetPhysicalDeviceExternalSemaphoreProperties",
+	"vkGetPhysicalDeviceSparseImageFormatProperties2",
+	"vkGetPhysicalDeviceMemoryProperties2",
+	"vkGetPhysicalDeviceQueueFamilyProperties2",
+	"vkGetPhysicalDeviceImageFormatProperties2",
+	"vkGetPhysicalDeviceProperties2",
+	"vkGetPhysicalDeviceFeatures2",
+	"vkGetImageSparseMemoryRequirements2",
+	"vkGetBufferMemoryRequirements2",
+	"vkGetDescriptorSetLayoutSupport",
+	"vkGetImageMemoryRequirements2",
+	"vkEnumeratePhysicalDeviceGroups",
+	"vkCmdDispatchBase",
+	"vkCmdSetDeviceMask",
+	"vkGetDeviceGroupPeerMemoryFeatures",
+	"vkBindImageMemory2",
+	"vkBindBufferMemory2",
+	"vkEnumerateInstanceVersion",
+	"vkCmdBeginRenderPass2",
+	"vkGetBufferOpaqueCaptureAddress",
+	"vkGetBufferDeviceAddress",
+	"vkCmdDrawIndirectCount",
+	"vkCmdDrawIndexedIndirectCount",
+	"vkCreateRenderPass2",
+	"vkGetDeviceMemoryOpaqueCaptureAddress",
+	"vkCmdNextSubpass2",
+	"vkCmdEndRenderPass2",
+	"vkSignalSemaphore",
+	"vkWaitSemaphores",
+	"vkGetSemaphoreCounterValue",
+	"vkResetQueryPool",
+	"vkCmdWriteTimestamp2",
+	"vkCmdCopyImage2",
+	"vkCmdSetDepthBoundsTestEnable",
+	"vkCmdSetStencilOp",
+	"vkCmdSetDepthWriteEnable",
+	"vkCmdSetDepthTestEnable",
+	"vkCmdBindVertexBuffers2",
+	"vkCmdSetScissorWithCount",
+	"vkCmdSetViewportWithCount",
+	"vkCmdSetPrimitiveTopology",
+	"vkCmdSetFrontFace",
+	"vkCmdSetCullMode",
+	"vkCmdSetEvent2",
+	"vkCmdEndRendering",
+	"vkCmdBeginRendering",
+	"vkCmdResetEvent2",
+	"vkCmdWaitEvents2",
+	"vkCmdPipelineBarrier2",
+	"vkCmdSetDepthCompareOp",
+	"vkCmdSetStencilTestEnable",
+	"vkCmdSetPrimitiveRestartEnable",
+	"vkCmdSetDepthBiasEnable",
+	"vkQueueSubmit2",
+	"vkGetPhysicalDeviceToolProperties",
+	"vkCmdResolveImage2",
+	"vkGetDeviceBufferMemoryRequirements",
+	"vkGetDeviceImageMemoryRequirements",
+	"vkGetDeviceImageSparseMemoryRequirements",
+	"vkGetPrivateData",
+	"vkSetPrivateData",
+	"vkDestroyPrivateDataSlot",
+	"vkCreatePrivateDataSlot",
+	"vkCmdBlitImage2",
+	"vkCmdCopyImageToBuffer2",
+	"vkCmdCopyBufferToImage2",
+	"vkCmdSetRasterizerDiscardEnable",
+	"vkCmdCopyBuffer2",
+	"vkCreateDebugReportCallbackEXT",
+	"vkDebugReportMessageEXT",
+	"vkDestroyDebugReportCallbackEXT",
+	"vkGetPhysicalDeviceSurfacePresentModesKHR",
+	"vkGetPhysicalDeviceSurfaceFormatsKHR",
+	"vkGetPhysicalDeviceSurfaceCapabilitiesKHR",
+	"vkGetPhysicalDeviceSurfaceSupportKHR",
+	"vkDestroySurfaceKHR",
+	"vkGetPhysicalDeviceSurfaceCapabilities2KHR",
+	"vkGetPhysicalDeviceSurfaceFormats2KHR",
+	"vkCreateSwapchainKHR",
+	"vkAcquireNextImageKHR",
+	"vkQueuePresentKHR",
+	"vkAcquireNextImage2KHR",
+	"vkGetPhysicalDevicePresentRectanglesKHR",
+	"vkGetSwapchainImagesKHR",
+	"vkGetDeviceGroupSurfacePresentModesKHR",
+	"vkDestroySwapchainKHR",
+	"vkGetDeviceGroupPresentCapabilitiesKHR",
+	"vkGetPhysicalDeviceDisplayPropertiesKHR",
+	"vkGetDisplayPlaneCapabilitiesKHR",
+	"vkGetPhysicalDeviceDisplayPlanePropertiesKHR",
+	"vkCreateDisplayModeKHR",
+	"vkGetDisplayModePropertiesKHR",
+	"vkCreateDisplayPlaneSurfaceKHR",
+	"vkGetDisplayPlaneSupportedDisplaysKHR",
+	"vkGetPhysicalDeviceDisplayPlaneProperties2KHR",
+	"vkGetPhysicalDeviceDisplayProperties2KHR",
+	"vkGetDisplayPlaneCapabilities2KHR",
+	"vkGetDisplayModeProperties2KHR",
+	"vkCreateSharedSwapchainsKHR",
+	"vkGetMemoryFdKHR",
+	"vkGetMemoryFdPropertiesKHR",
+	"vkImportSemaphoreFdKHR",
+	"vkGetSemaphoreFdKHR",
+};
+
+const char* vksCaptureCommandName(uint32_t command) {
+	return command < VKS_CAPTURE_COMMAND_COUNT ? capture_names[command] : NULL;
+}
+
+// Growable byte buffer. Each thread serializes into its own stream, which is
+// appended to the shared buffer once the command returns.
+typedef struct vksCaptureStream {
+	uint8_t* data;
+	size_t len;
+	size_t cap;
+} vksCaptureStream;
+
+static void capture_reserve(vksCaptureStream* s, size_t n) {
+	if (s->len + n > s->cap) {
+		size_t cap = s->cap > 0 ? s->cap * 2 : 4096;
+		while (cap < s->len + n) {
+			cap *= 2;
+		}
+		s->data = realloc(s->data, cap);
+		s->cap = cap;
+	}
+}
+
+static void capture_raw(vksCaptureStream* s, const void* data, size_t n) {
+	capture_reserve(s, n);
+	memcpy(s->data + s->len, data, n);
+	s->len += n;
+}
+
+static void capture_u32(vksCaptureStream* s, uint32_t v) {
+	capture_raw(s, &v, sizeof(v));
+}
+
+static int capture_pointer(vksCaptureStream* s, const void* ptr, size_t count, size_t size) {
+	uint64_t n = ptr == NULL ? 0 : count;
+	capture_raw(s, &n, sizeof(n));
+	if (n > 0) {
+		capture_raw(s, ptr, count * size);
+	}
+	return n > 0;
+}
+
+// Writes only the element count of an array filled in by the command.
+static void capture_output(vksCaptureStream* s, const void* ptr, size_t count) {
+	uint64_t n = ptr == NULL ? 0 : count;
+	capture_raw(s, &n, sizeof(n));
+}
+
+static void capture_string(vksCaptureStream* s, const char* str) {
+	capture_pointer(s, str, str == NULL ? 0 : strlen(str) + 1, 1);
+}
+
+static void capture_strings(vksCaptureStream* s, const char* const* strs, size_t count) {
+	uint64_t n = strs == NULL ? 0 : count;
+	capture_raw(s, &n, sizeof(n));
+	for (size_t i = 0; i < n; i++) {
+		capture_string(s, strs[i]);
+	}
+}
+
+// Double buffered output. Records are appended to the active buffer, and
+// full buffers are handed to the writer through vksCaptureNext.
+static pthread_mutex_t capture_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t capture_cond = PTHREAD_COND_INITIALIZER;
+static vksCaptureStream capture_buffers[2];
+static size_t capture_limit = 0;
+static int capture_current = 0;
+static int capture_ready = -1;
+static int capture_stopped = 1;
+static __thread vksCaptureStream capture_stream;
+
+// Hands the active buffer to the writer, waiting while the writer is busy
+// with the other one. Called with capture_lock held.
+static void capture_swap() {
+	while (capture_ready != -1) {
+		pthread_cond_wait(&capture_cond, &capture_lock);
+	}
+	capture_ready = capture_current;
+	capture_current ^= 1;
+	capture_buffers[capture_current].len = 0;
+	pthread_cond_broadcast(&capture_cond);
+}
+
+static void capture_append(const void* data, size_t n) {
+	pthread_mutex_lock(&capture_lock);
+	if (!capture_stopped) {
+		vksCaptureStream* buf = &capture_buffers[capture_current];
+		if (buf->len > 0 && buf->len + n > capture_limit) {
+			capture_swap();
+			buf = &capture_buffers[capture_current];
+		}
+		capture_raw(buf, data, n);
+	}
+	pthread_mutex_unlock(&capture_lock);
+}
+
+static vksCaptureStream* capture_begin(uint32_t command) {
+	vksCaptureStream* s = &capture_stream;
+	s->len = 0;
+	capture_u32(s, command);
+	capture_u32(s, 0);
+	return s;
+}
+
+static void capture_end(vksCaptureStream* s) {
+	uint32_t size = (uint32_t)(s->len - 2 * sizeof(uint32_t));
+	memcpy(s->data + sizeof(uint32_t), &size, sizeof(size));
+	capture_append(s->data, s->len);
+}
+
+VkResult vksCaptureStart(size_t bufferSize) {
+	pthread_mutex_lock(&capture_lock);
+	if (!capture_stopped || capture_ready != -1) {
+		pthread_mutex_unlock(&capture_lock);
+		return VK_ERROR_INITIALIZATION_FAILED;
+	}
+	capture_limit = bufferSize > 0 ? bufferSize : 1 << 20;
+	capture_current = 0;
+	capture_buffers[0].len = 0;
+	capture_buffers[1].len = 0;
+	capture_reserve(&capture_buffers[0], capture_limit);
+	capture_reserve(&capture_buffers[1], capture_limit);
+
+	vksCaptureStream* buf = &capture_buffers[0];
+	capture_raw(buf, "VKSTRACE", 8);
+	capture_u32(buf, VKS_CAPTURE_VERSION);
+	capture_u32(buf, VKS_CAPTURE_COMMAND_COUNT);
+	for (uint32_t i = 0; i < VKS_CAPTURE_COMMAND_COUNT; i++) {
+		uint32_t n = (uint32_t)strlen(capture_names[i]);
+		capture_u32(buf, n);
+		capture_raw(buf, capture_names[i], n);
+	}
+	capture_stopped = 0;
+	__atomic_store_n(&vksCaptureActive, 1, __ATOMIC_RELEASE);
+	pthread_mutex_unlock(&capture_lock);
+	return VK_SUCCESS;
+}
+
+void vksCaptureFrame() {
+	uint32_t marker[2] = { VKS_CAPTURE_FRAME_MARKER, 0 };
+	capture_append(marker, sizeof(marker));
+}
+
+void vksCaptureStop() {
+	__atomic_store_n(&vksCaptureActive, 0, __ATOMIC_RELEASE);
+	pthread_mutex_lock(&capture_lock);
+	if (!capture_stopped) {
+		if (capture_buffers[capture_current].len > 0) {
+			capture_swap();
+		}
+		capture_stopped = 1;
+		pthread_cond_broadcast(&capture_cond);
+	}
+	pthread_mutex_unlock(&capture_lock);
+}
+
+int vksCaptureNext(const void** data, size_t* len) {
+	pthread_mutex_lock(&capture_lock);
+	while (capture_ready == -1 && !capture_stopped) {
+		pthread_cond_wait(&capture_cond, &capture_lock);
+	}
+	int ok = capture_ready != -1;
+	if (ok) {
+		*data = capture_buffers[capture_ready].data;
+		*len = capture_buffers[capture_ready].len;
+	}
+	pthread_mutex_unlock(&capture_lock);
+	return ok;
+}
+
+void vksCaptureRelease() {
+	pthread_mutex_lock(&capture_lock);
+	capture_ready = -1;
+	pthread_cond_broadcast(&capture_cond);
+	pthread_mutex_unlock(&capture_lock);
+}
+
+// Bounds checked reader over a record payload.
+typedef struct vksReader {
+	const uint8_t* p;
+	const uint8_t* end;
+	int overflow;
+} vksReader;
+
+// Handle map from the captured handles to the replayed ones.
+typedef struct vksReplayEntry {
+	uint64_t key;
+	uint64_t value;
+} vksReplayEntry;
+
+// Blocks of memory for the rebuilt parameters, released after each record.
+typedef struct vksReplayBlock {
+	struct vksReplayBlock* next;
+	size_t len;
+	size_t cap;
+} vksReplayBlock;
+
+struct vksReplay {
+	vksProcAddr global;
+	vksProcAddr procs;
+	vksReplayEntry* entries;
+	size_t count;
+	size_t cap;
+	vksReplayBlock* blocks;
+};
+
+vksReplay* vksReplayCreate() {
+	vksReplay* r = calloc(1, sizeof(vksReplay));
+	if (r != NULL) {
+		r->global = vksProcAddresses;
+		r->procs = vksProcAddresses;
+	}
+	return r;
+}
+
+static void replay_reset(vksReplay* r) {
+	while (r->blocks != NULL && r->blocks->next != NULL) {
+		vksReplayBlock* next = r->blocks->next;
+		free(r->blocks);
+		r->blocks = next;
+	}
+	if (r->blocks != NULL) {
+		r->blocks->len = 0;
+	}
+}
+
+void vksReplayDestroy(vksReplay* r) {
+	replay_reset(r);
+	free(r->blocks);
+	free(r->entries);
+	free(r);
+}
+
+static void* replay_alloc(vksReplay* r, size_t n) {
+	n = (n + 15) & ~(size_t)15;
+	vksReplayBlock* block = r->blocks;
+	if (block == NULL || block->len + n > block->cap) {
+		size_t cap = n > 65536 ? n : 65536;
+		block = malloc(sizeof(vksReplayBlock) + 16 + cap);
+		if (block == NULL) {
+			return NULL;
+		}
+		block->next = r->blocks;
+		block->len = 0;
+		block->cap = cap;
+		r->blocks = block;
+	}
+	uint8_t* base = (uint8_t*)(((uintptr_t)(block + 1) + 15) & ~(uintptr_t)15);
+	void* ptr = base + block->len;
+	block->len += n;
+	memset(ptr, 0, n);
+	return ptr;
+}
+
+static void replay_raw(vksReader* rd, void* dst, size_t n) {
+	if (rd->overflow || (size_t)(rd->end - rd->p) < n) {
+		rd->overflow = 1;
+		memset(dst, 0, n);
+		return;
+	}
+	memcpy(dst, rd->p, n);
+	rd->p += n;
+}
+
+static uint64_t replay_count(vksReader* rd, size_t size) {
+	uint64_t n;
+	replay_raw(rd, &n, sizeof(n));
+	if (size > 0 && n > (uint64_t)(rd->end - rd->p) / size) {
+		rd->overflow = 1;
+		return 0;
+	}
+	return n;
+}
+
+static void* replay_pointer(vksReplay* r, vksReader* rd, size_t size, size_t* count) {
+	uint64_t n = replay_count(rd, size);
+	if (count != NULL) {
+		*count = (size_t)n;
+	}
+	if (n == 0) {
+		return NULL;
+	}
+	void* ptr = replay_alloc(r, (size_t)n * size);
+	if (ptr == NULL) {
+		rd->overflow = 1;
+		if (count != NULL) {
+			*count = 0;
+		}
+		return NULL;
+	}
+	replay_raw(rd, ptr, (size_t)n * size);
+	return ptr;
+}
+
+static void* replay_output(vksReplay* r, vksReader* rd, size_t size) {
+	uint64_t n;
+	replay_raw(rd, &n, sizeof(n));
+	if (n == 0 || n > SIZE_MAX / size) {
+		return NULL;
+	}
+	void* ptr = replay_alloc(r, (size_t)n * size);
+	if (ptr == NULL) {
+		rd->overflow = 1;
+	}
+	return ptr;
+}
+
+static char* replay_string(vksReplay* r, vksReader* rd) {
+	size_t n;
+	char* str = replay_pointer(r, rd, 1, &n);
+	if (n > 0 && str[n - 1] != '\0') {
+		rd->overflow = 1;
+		return NULL;
+	}
+	return str;
+}
+
+static char** replay_strings(vksReplay* r, vksReader* rd) {
+	uint64_t n = replay_count(rd, sizeof(uint64_t));
+	if (n == 0) {
+		return NULL;
+	}
+	char** strs = replay_alloc(r, (size_t)n * sizeof(char*));
+	if (strs == NULL) {
+		rd->overflow = 1;
+		return NULL;
+	}
+	for (uint64_t i = 0; i < n; i++) {
+		strs[i] = replay_string(r, rd);
+	}
+	return strs;
+}
+
+static void replay_set(vksReplay* r, uint64_t key, uint64_t value) {
+	if (key == 0) {
+		return;
+	}
+	if ((r->count + 1) * 2 > r->cap) {
+		size_t cap = r->cap > 0 ? r->cap * 2 : 1024;
+		vksReplayEntry* entries = calloc(cap, sizeof(vksReplayEntry));
+		if (entries == NULL) {
+			return;
+		}
+		for (size_t i = 0; i < r->cap; i++) {
+			if (r->entries[i].key != 0) {
+				size_t h = (r->entries[i].key * 0x9E3779B97F4A7C15ull) & (cap - 1);
+				while (entries[h].key != 0) {
+					h = (h + 1) & (cap - 1);
+				}
+				entries[h] = r->entries[i];
+			}
+		}
+		free(r->entries);
+		r->entries = entries;
+		r->cap = cap;
+	}
+	size_t h = (key * 0x9E3779B97F4A7C15ull) & (r->cap - 1);
+	while (r->entries[h].key != 0 && r->entries[h].key != key) {
+		h = (h + 1) & (r->cap - 1);
+	}
+	if (r->entries[h].key == 0) {
+		r->count++;
+	}
+	r->entries[h].key = key;
+	r->entries[h].value = value;
+}
+
+// Returns the replayed handle for a captured handle. Unknown handles are
+// returned unchanged.
+static uint64_t replay_map(vksReplay* r, uint64_t key) {
+	if (key == 0 || r->cap == 0) {
+		return key;
+	}
+	size_t h = (key * 0x9E3779B97F4A7C15ull) & (r->cap - 1);
+	while (r->entries[h].key != 0) {
+		if (r->entries[h].key == key) {
+			return r->entries[h].value;
+		}
+		h = (h + 1) & (r->cap - 1);
+	}
+	return key;
+}
+
+// Reads the handles returned at capture time and maps them to the handles
+// returned by the replayed command.
+static void replay_remap(vksReplay* r, vksReader* rd, const void* replayed, size_t size) {
+	uint64_t n = replay_count(rd, size);
+	for (uint64_t i = 0; i < n && replayed != NULL; i++) {
+		uint64_t key = 0, value = 0;
+		replay_raw(rd, &key, size);
+		memcpy(&value, (const uint8_t*)replayed + i * size, size);
+		replay_set(r, key, value);
+	}
+}
+
+static uint64_t replay_now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void capture_next(vksCaptureStream* s, const void* next);
+static void* replay_next(vksReplay* r, vksReader* rd);
+__attribute__((unused)) static void capture_VkDescriptorBufferInfo(vksCaptureStream* s, const VkDescriptorBufferInfo* p);
+__attribute__((unused)) static void replay_VkDescriptorBufferInfo(vksReplay* r, vksReader* rd, VkDescriptorBufferInfo* p);
+__attribute__((unused)) static void capture_VkEventCreateInfo(vksCaptureStream* s, const VkEventCreateInfo* p);
+__attribute__((unused)) static void replay_VkEventCreateInfo(vksReplay* r, vksReader* rd, VkEventCreateInfo* p);
+__attribute__((unused)) static void capture_VkRenderPassBeginInfo(vksCaptureStream* s, const VkRenderPassBeginInfo* p);
+__attribute__((unused)) static void replay_VkRenderPassBeginInfo(vksReplay* r, vksReader* rd, VkRenderPassBeginInfo* p);
+__attribute__((unused)) static void capture_VkQueryPoolCreateInfo(vksCaptureStream* s, const VkQueryPoolCreateInfo* p);
+__attribute__((unused)) static void replay_VkQueryPoolCreateInfo(vksReplay* r, vksReader* rd, VkQueryPoolCreateInfo* p);
+__attribute__((unused)) static void capture_VkSemaphoreCreateInfo(vksCaptureStream* s, const VkSemaphoreCreateInfo* p);
+__attribute__((unused)) static void replay_VkSemaphoreCreateInfo(vksReplay* r, vksReader* rd, VkSemaphoreCreateInfo* p);
+__attribute__((unused)) static void capture_VkBufferCreateInfo(vksCaptureStream* s, const VkBufferCreateInfo* p);
+__attribute__((unused)) static void replay_VkBufferCreateInfo(vksReplay* r, vksReader* rd, VkBufferCreateInfo* p);
+__attribute__((unused)) static void capture_VkFenceCreateInfo(vksCaptureStream* s, const VkFenceCreateInfo* p);
+__attribute__((unused)) static void replay_VkFenceCreateInfo(vksReplay* r, vksReader* rd, VkFenceCreateInfo* p);
+__attribute__((unused)) static void capture_VkCommandBufferInheritanceInfo(vksCaptureStream* s, const VkCommandBufferInheritanceInfo* p);
+__attribute__((unused)) static void replay_VkCommandBufferInheritanceInfo(vksReplay* r, vksReader* rd, VkCommandBufferInheritanceInfo* p);
+__attribute__((unused)) static void capture_VkCommandBufferBeginInfo(vksCaptureStream* s, const VkCommandBufferBeginInfo* p);
+__attribute__((unused)) static void replay_VkCommandBufferBeginInfo(vksReplay* r, vksReader* rd, VkCommandBufferBeginInfo* p);
+__attribute__((unused)) static void capture_VkBufferViewCreateInfo(vksCaptureStream* s, const VkBufferViewCreateInfo* p);
+__attribute__((unused)) static void replay_VkBufferViewCreateInfo(vksReplay* r, vksReader* rd, VkBufferViewCreateInfo* p);
+__attribute__((unused)) static void capture_VkCommandBufferAllocateInfo(vksCaptureStream* s, const VkCommandBufferAllocateInfo* p);
+__attribute__((unused)) static void replay_VkCommandBufferAllocateInfo(vksReplay* r, vksReader* rd, VkCommandBufferAllocateInfo* p);
+__attribute__((unused)) static void capture_VkCommandPoolCreateInfo(vksCaptureStream* s, const VkCommandPoolCreateInfo* p);
+__attribute__((unused)) static void replay_VkCommandPoolCreateInfo(vksReplay* r, vksReader* rd, VkCommandPoolCreateInfo* p);
+__attribute__((unused)) static void capture_VkSubpassDescription(vksCaptureStream* s, const VkSubpassDescription* p);
+__attribute__((unused)) static void replay_VkSubpassDescription(vksReplay* r, vksReader* rd, VkSubpassDescription* p);
+__attribute__((unused)) static void capture_VkImageCreateInfo(vksCaptureStream* s, const VkImageCreateInfo* p);
+__attribute__((unused)) static void replay_VkImageCreateInfo(vksReplay* r, vksReader* rd, VkImageCreateInfo* p);
+__attribute__((unused)) static void capture_VkSparseMemoryBind(vksCaptureStream* s, const VkSparseMemoryBind* p);
+__attribute__((unused)) static void replay_VkSparseMemoryBind(vksReplay* r, vksReader* rd, VkSparseMemoryBind* p);
+__attribute__((unused)) static void capture_VkRenderPassCreateInfo(vksCaptureStream* s, const VkRenderPassCreateInfo* p);
+__attribute__((unused)) static void replay_VkRenderPassCreateInfo(vksReplay* r, vksReader* rd, VkRenderPassCreateInfo* p);
+__attribute__((unused)) static void capture_VkBaseInStructure(vksCaptureStream* s, const VkBaseInStructure* p);
+__attribute__((unused)) static void replay_VkBaseInStructure(vksReplay* r, vksReader* rd, VkBaseInStructure* p);
+__attribute__((unused)) static void capture_VkSparseImageOpaqueMemoryBindInfo(vksCaptureStream* s, const VkSparseImageOpaqueMemoryBindInfo* p);
+__attribute__((unused)) static void replay_VkSparseImageOpaqueMemoryBindInfo(vksReplay* r, vksReader* rd, VkSparseImageOpaqueMemoryBindInfo* p);
+__attribute__((unused)) static void capture_VkSparseImageMemoryBind(vksCaptureStream* s, const VkSparseImageMemoryBind* p);
+__attribute__((unused)) static void replay_VkSparseImageMemoryBind(vksReplay* r, vksReader* rd, VkSparseImageMemoryBind* p);
+__attribute__((unused)) static void capture_VkSparseImageMemoryBindInfo(vksCaptureStream* s, const VkSparseImageMemoryBindInfo* p);
+__attribute__((unused)) static void replay_VkSparseImageMemoryBindInfo(vksReplay* r, vksReader* rd, VkSparseImageMemoryBindInfo* p);
+__attribute__((unused)) static void capture_VkImageViewCreateInfo(vksCaptureStream* s, const VkImageViewCreateInfo* p);
+__attribute__((unused)) static void replay_VkImageViewCreateInfo(vksReplay* r, vksReader* rd, VkImageViewCreateInfo* p);
+__attribute__((unused)) static void capture_VkSparseBufferMemoryBindInfo(vksCaptureStream* s, const VkSparseBufferMemoryBindInfo* p);
+__attribute__((unused)) static void replay_VkSparseBufferMemoryBindInfo(vksReplay* r, vksReader* rd, VkSparseBufferMemoryBindInfo* p);
+__attribute__((unused)) static void capture_VkBaseOutStructure(vksCaptureStream* s, const VkBaseOutStructure* p);
+__attribute__((unused)) static void replay_VkBaseOutStructure(vksReplay* r, vksReader* rd, VkBaseOutStructure* p);
+__attribute__((unused)) static void capture_VkBufferMemoryBarrier(vksCaptureStream* s, const VkBufferMemoryBarrier* p);
+__attribute__((unused)) static void replay_VkBufferMemoryBarrier(vksReplay* r, vksReader* rd, VkBufferMemoryBarrier* p);
+__attribute__((unused)) static void capture_VkBindSparseInfo(vksCaptureStream* s, const VkBindSparseInfo* p);
+__attribute__((unused)) static void replay_VkBindSparseInfo(vksReplay* r, vksReader* rd, VkBindSparseInfo* p);
+__attribute__((unused)) static void capture_VkShaderModuleCreateInfo(vksCaptureStream* s, const VkShaderModuleCreateInfo* p);
+__attribute__((unused)) static void replay_VkShaderModuleCreateInfo(vksReplay* r, vksReader* rd, VkShaderModuleCreateInfo* p);
+__attribute__((unused)) static void capture_VkFramebufferCreateInfo(vksCaptureStream* s, const VkFramebufferCreateInfo* p);
+__attribute__((unused)) static void replay_VkFramebufferCreateInfo(vksReplay* r, vksReader* rd, VkFramebufferCreateInfo* p);
+__attribute__((unused)) static void capture_VkImageMemoryBarrier(vksCaptureStream* s, const VkImageMemoryBarrier* p);
+__attribute__((unused)) static void replay_VkImageMemoryBarrier(vksReplay* r, vksReader* rd, VkImageMemoryBarrier* p);
+__attribute__((unused)) static void capture_VkMemoryBarrier(vksCaptureStream* s, const VkMemoryBarrier* p);
+__attribute__((unused)) static void replay_VkMemoryBarrier(vksReplay* r, vksReader* rd, VkMemoryBarrier* p);
+__attribute__((unused)) static void capture_VkPipelineCacheCreateInfo(vksCaptureStream* s, const VkPipelineCacheCreateInfo* p);
+__attribute__((unused)) static void replay_VkPipelineCacheCreateInfo(vksReplay* r, vksReader* rd, VkPipelineCacheCreateInfo* p);
+__attribute__((unused)) static void capture_VkDescriptorImageInfo(vksCaptureStream* s, const VkDescriptorImageInfo* p);
+__attribute__((unused)) static void replay_VkDescriptorImageInfo(vksReplay* r, vksReader* rd, VkDescriptorImageInfo* p);
+__attribute__((unused)) static void capture_VkWriteDescriptorSet(vksCaptureStream* s, const VkWriteDescriptorSet* p);
+__attribute__((unused)) static void replay_VkWriteDescriptorSet(vksReplay* r, vksReader* rd, VkWriteDescriptorSet* p);
+__attribute__((unused)) static void capture_VkDescriptorSetLayoutBinding(vksCaptureStream* s, const VkDescriptorSetLayoutBinding* p);
+__attribute__((unused)) static void replay_VkDescriptorSetLayoutBinding(vksReplay* r, vksReader* rd, VkDescriptorSetLayoutBinding* p);
+__attribute__((unused)) static void capture_VkDescriptorSetLayoutCreateInfo(vksCaptureStream* s, const VkDescriptorSetLayoutCreateInfo* p);
+__attribute__((unused)) static void replay_VkDescriptorSetLayoutCreateInfo(vksReplay* r, vksReader* rd, VkDescriptorSetLayoutCreateInfo* p);
+__attribute__((unused)) static void capture_VkDescriptorSetAllocateInfo(vksCaptureStream* s, const VkDescriptorSetAllocateInfo* p);
+__attribute__((unused)) static void replay_VkDescriptorSetAllocateInfo(vksReplay* r, vksReader* rd, VkDescriptorSetAllocateInfo* p);
+__attribute__((unused)) static void capture_VkSpecializationInfo(vksCaptureStream* s, const VkSpecializationInfo* p);
+__attribute__((unused)) static void replay_VkSpecializationInfo(vksReplay* r, vksReader* rd, VkSpecializationInfo* p);
+__attribute__((unused)) static void capture_VkPipelineShaderStageCreateInfo(vksCaptureStream* s, const VkPipelineShaderStageCreateInfo* p);
+__attribute__((unused)) static void replay_VkPipelineShaderStageCreateInfo(vksReplay* r, vksReader* rd, VkPipelineShaderStageCreateInfo* p);
+__attribute__((unused)) static void capture_VkComputePipelineCreateInfo(vksCaptureStream* s, const VkComputePipelineCreateInfo* p);
+__attribute__((unused)) static void replay_VkComputePipelineCreateInfo(vksReplay* r, vksReader* rd, VkComputePipelineCreateInfo* p);
+__attribute__((unused)) static void capture_VkMemoryAllocateInfo(vksCaptureStream* s, const VkMemoryAllocateInfo* p);
+__attribute__((unused)) static void replay_VkMemoryAllocateInfo(vksReplay* r, vksReader* rd, VkMemoryAllocateInfo* p);
+__attribute__((unused)) static void capture_VkMappedMemoryRange(vksCaptureStream* s, const VkMappedMemoryRange* p);
+__attribute__((unused)) static void replay_VkMappedMemoryRange(vksReplay* r, vksReader* rd, VkMappedMemoryRange* p);
+__attribute__((unused)) static void capture_VkDescriptorPoolCreateInfo(vksCaptureStream* s, const VkDescriptorPoolCreateInfo* p);
+__attribute__((unused)) static void replay_VkDescriptorPoolCreateInfo(vksReplay* r, vksReader* rd, VkDescriptorPoolCreateInfo* p);
+__attribute__((unused)) static void capture_VkPipelineDynamicStateCreateInfo(vksCaptureStream* s, const VkPipelineDynamicStateCreateInfo* p);
+__attribute__((unused)) static void replay_VkPipelineDynamicStateCreateInfo(vksReplay* r, vksReader* rd, VkPipelineDynamicStateCreateInfo* p);
+__attribute__((unused)) static void capture_VkPipelineColorBlendStateCreateInfo(vksCaptureStream* s, const VkPipelineColorBlendStateCreateInfo* p);
+__attribute__((unused)) static void replay_VkPipelineColorBlendStateCreateInfo(vksReplay* r, vksReader* rd, VkPipelineColorBlendStateCreateInfo* p);
+__attribute__((unused)) static void capture_VkPipelineDepthStencilStateCreateInfo(vksCaptureStream* s, const VkPipelineDepthStencilStateCreateInfo* p);
+__attribute__((unused)) static void replay_VkPipelineDepthStencilStateCreateInfo(vksReplay* r, vksReader* rd, VkPipelineDepthStencilStateCreateInfo* p);
+__attribute__((unused)) static void capture_VkPipelineMultisampleStateCreateInfo(vksCaptureStream* s, const VkPipelineMultisampleStateCreateInfo* p);
+__attribute__((unused)) static void replay_VkPipelineMultisampleStateCreateInfo(vksReplay* r, vksReader* rd, VkPipelineMultisampleStateCreateInfo* p);
+__attribute__((unused)) static void capture_VkPipelineRasterizationStateCreateInfo(vksCaptureStream* s, const VkPipelineRasterizationStateCreateInfo* p);
+__attribute__((unused)) static void replay_VkPipelineRasterizationStateCreateInfo(vksReplay* r, vksReader* rd, VkPipelineRasterizationStateCreateInfo* p);
+__attribute__((unused)) static void capture_VkPipelineViewportStateCreateInfo(vksCaptureStream* s, const VkPipelineViewportStateCreateInfo* p);
+__attribute__((unused)) static void replay_VkPipelineViewportStateCreateInfo(vksReplay* r, vksReader* rd, VkPipelineViewportStateCreateInfo* p);
+__attribute__((unused)) static void capture_VkPipelineTessellationStateCreateInfo(vksCaptureStream* s, const VkPipelineTessellationStateCreateInfo* p);
+__attribute__((unused)) static void replay_VkPipelineTessellationStateCreateInfo(vksReplay* r, vksReader* rd, VkPipelineTessellationStateCreateInfo* p);
+__attribute__((unused)) static void capture_VkPipelineInputAssemblyStateCreateInfo(vksCaptureStream* s, const VkPipelineInputAssemblyStateCreateInfo* p);
+__attribute__((unused)) static void replay_VkPipelineInputAssemblyStateCreateInfo(vksReplay* r, vksReader* rd, VkPipelineInputAssemblyStateCreateInfo* p);
+__attribute__((unused)) static void capture_VkPipelineVertexInputStateCreateInfo(vksCaptureStream* s, const VkPipelineVertexInputStateCreateInfo* p);
+__attribute__((unused)) static void replay_VkPipelineVertexInputStateCreateInfo(vksReplay* r, vksReader* rd, VkPipelineVertexInputStateCreateInfo* p);
+__attribute__((unused)) static void capture_VkGraphicsPipelineCreateInfo(vksCaptureStream* s, const VkGraphicsPipelineCreateInfo* p);
+__attribute__((unused)) static void replay_VkGraphicsPipelineCreateInfo(vksReplay* r, vksReader* rd, VkGraphicsPipelineCreateInfo* p);
+__attribute__((unused)) static void capture_VkAllocationCallbacks(vksCaptureStream* s, const VkAllocationCallbacks* p);
+__attribute__((unused)) static void replay_VkAllocationCallbacks(vksReplay* r, vksReader* rd, VkAllocationCallbacks* p);
+__attribute__((unused)) static void capture_VkApplicationInfo(vksCaptureStream* s, const VkApplicationInfo* p);
+__attribute__((unused)) static void replay_VkApplicationInfo(vksReplay* r, vksReader* rd, VkApplicationInfo* p);
+__attribute__((unused)) static void capture_VkCopyDescriptorSet(vksCaptureStream* s, const VkCopyDescriptorSet* p);
+__attribute__((unused)) static void replay_VkCopyDescriptorSet(vksReplay* r, vksReader* rd, VkCopyDescriptorSet* p);
+__attribute__((unused)) static void capture_VkSubmitInfo(vksCaptureStream* s, const VkSubmitInfo* p);
+__attribute__((unused)) static void replay_VkSubmitInfo(vksReplay* r, vksReader* rd, VkSubmitInfo* p);
+__attribute__((unused)) static void capture_VkSamplerCreateInfo(vksCaptureStream* s, const VkSamplerCreateInfo* p);
+__attribute__((unused)) static void replay_VkSamplerCreateInfo(vksReplay* r, vksReader* rd, VkSamplerCreateInfo* p);
+__attribute__((unused)) static void capture_VkInstanceCreateInfo(vksCaptureStream* s, const VkInstanceCreateInfo* p);
+__attribute__((unused)) static void replay_VkInstanceCreateInfo(vksReplay* r, vksReader* rd, VkInstanceCreateInfo* p);
+__attribute__((unused)) static void capture_VkDeviceQueueCreateInfo(vksCaptureStream* s, const VkDeviceQueueCreateInfo* p);
+__attribute__((unused)) static void replay_VkDeviceQueueCreateInfo(vksReplay* r, vksReader* rd, VkDeviceQueueCreateInfo* p);
+__attribute__((unused)) static void capture_VkDeviceCreateInfo(vksCaptureStream* s, const VkDeviceCreateInfo* p);
+__attribute__((unused)) static void replay_VkDeviceCreateInfo(vksReplay* r, vksReader* rd, VkDeviceCreateInfo* p);
+__attribute__((unused)) static void capture_VkPipelineLayoutCreateInfo(vksCaptureStream* s, const VkPipelineLayoutCreateInfo* p);
+__attribute__((unused)) static void replay_VkPipelineLayoutCreateInfo(vksReplay* r, vksReader* rd, VkPipelineLayoutCreateInfo* p);
+__attribute__((unused)) static void capture_VkSamplerYcbcrConversionImageFormatProperties(vksCaptureStream* s, const VkSamplerYcbcrConversionImageFormatProperties* p);
+__attribute__((unused)) static void replay_VkSamplerYcbcrConversionImageFormatProperties(vksReplay* r, vksReader* rd, VkSamplerYcbcrConversionImageFormatProperties* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceShaderDrawParametersFeatures(vksCaptureStream* s, const VkPhysicalDeviceShaderDrawParametersFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceShaderDrawParametersFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceShaderDrawParametersFeatures* p);
+__attribute__((unused)) static void capture_VkExternalMemoryBufferCreateInfo(vksCaptureStream* s, const VkExternalMemoryBufferCreateInfo* p);
+__attribute__((unused)) static void replay_VkExternalMemoryBufferCreateInfo(vksReplay* r, vksReader* rd, VkExternalMemoryBufferCreateInfo* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceExternalImageFormatInfo(vksCaptureStream* s, const VkPhysicalDeviceExternalImageFormatInfo* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceExternalImageFormatInfo(vksReplay* r, vksReader* rd, VkPhysicalDeviceExternalImageFormatInfo* p);
+__attribute__((unused)) static void capture_VkExternalImageFormatProperties(vksCaptureStream* s, const VkExternalImageFormatProperties* p);
+__attribute__((unused)) static void replay_VkExternalImageFormatProperties(vksReplay* r, vksReader* rd, VkExternalImageFormatProperties* p);
+__attribute__((unused)) static void capture_VkDescriptorUpdateTemplateCreateInfo(vksCaptureStream* s, const VkDescriptorUpdateTemplateCreateInfo* p);
+__attribute__((unused)) static void replay_VkDescriptorUpdateTemplateCreateInfo(vksReplay* r, vksReader* rd, VkDescriptorUpdateTemplateCreateInfo* p);
+__attribute__((unused)) static void capture_VkBindBufferMemoryDeviceGroupInfo(vksCaptureStream* s, const VkBindBufferMemoryDeviceGroupInfo* p);
+__attribute__((unused)) static void replay_VkBindBufferMemoryDeviceGroupInfo(vksReplay* r, vksReader* rd, VkBindBufferMemoryDeviceGroupInfo* p);
+__attribute__((unused)) static void capture_VkBindImageMemoryDeviceGroupInfo(vksCaptureStream* s, const VkBindImageMemoryDeviceGroupInfo* p);
+__attribute__((unused)) static void replay_VkBindImageMemoryDeviceGroupInfo(vksReplay* r, vksReader* rd, VkBindImageMemoryDeviceGroupInfo* p);
+__attribute__((unused)) static void capture_VkMemoryDedicatedAllocateInfo(vksCaptureStream* s, const VkMemoryDedicatedAllocateInfo* p);
+__attribute__((unused)) static void replay_VkMemoryDedicatedAllocateInfo(vksReplay* r, vksReader* rd, VkMemoryDedicatedAllocateInfo* p);
+__attribute__((unused)) static void capture_VkDeviceGroupBindSparseInfo(vksCaptureStream* s, const VkDeviceGroupBindSparseInfo* p);
+__attribute__((unused)) static void replay_VkDeviceGroupBindSparseInfo(vksReplay* r, vksReader* rd, VkDeviceGroupBindSparseInfo* p);
+__attribute__((unused)) static void capture_VkDescriptorSetLayoutSupport(vksCaptureStream* s, const VkDescriptorSetLayoutSupport* p);
+__attribute__((unused)) static void replay_VkDescriptorSetLayoutSupport(vksReplay* r, vksReader* rd, VkDescriptorSetLayoutSupport* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceGroupProperties(vksCaptureStream* s, const VkPhysicalDeviceGroupProperties* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceGroupProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceGroupProperties* p);
+__attribute__((unused)) static void capture_VkDeviceGroupDeviceCreateInfo(vksCaptureStream* s, const VkDeviceGroupDeviceCreateInfo* p);
+__attribute__((unused)) static void replay_VkDeviceGroupDeviceCreateInfo(vksReplay* r, vksReader* rd, VkDeviceGroupDeviceCreateInfo* p);
+__attribute__((unused)) static void capture_VkMemoryDedicatedRequirements(vksCaptureStream* s, const VkMemoryDedicatedRequirements* p);
+__attribute__((unused)) static void replay_VkMemoryDedicatedRequirements(vksReplay* r, vksReader* rd, VkMemoryDedicatedRequirements* p);
+__attribute__((unused)) static void capture_VkExportMemoryAllocateInfo(vksCaptureStream* s, const VkExportMemoryAllocateInfo* p);
+__attribute__((unused)) static void replay_VkExportMemoryAllocateInfo(vksReplay* r, vksReader* rd, VkExportMemoryAllocateInfo* p);
+__attribute__((unused)) static void capture_VkExportFenceCreateInfo(vksCaptureStream* s, const VkExportFenceCreateInfo* p);
+__attribute__((unused)) static void replay_VkExportFenceCreateInfo(vksReplay* r, vksReader* rd, VkExportFenceCreateInfo* p);
+__attribute__((unused)) static void capture_VkPhysicalDevice16BitStorageFeatures(vksCaptureStream* s, const VkPhysicalDevice16BitStorageFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDevice16BitStorageFeatures(vksReplay* r, vksReader* rd, VkPhysicalDevice16BitStorageFeatures* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceMaintenance3Properties(vksCaptureStream* s, const VkPhysicalDeviceMaintenance3Properties* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceMaintenance3Properties(vksReplay* r, vksReader* rd, VkPhysicalDeviceMaintenance3Properties* p);
+__attribute__((unused)) static void capture_VkDeviceGroupSubmitInfo(vksCaptureStream* s, const VkDeviceGroupSubmitInfo* p);
+__attribute__((unused)) static void replay_VkDeviceGroupSubmitInfo(vksReplay* r, vksReader* rd, VkDeviceGroupSubmitInfo* p);
+__attribute__((unused)) static void capture_VkDeviceGroupCommandBufferBeginInfo(vksCaptureStream* s, const VkDeviceGroupCommandBufferBeginInfo* p);
+__attribute__((unused)) static void replay_VkDeviceGroupCommandBufferBeginInfo(vksReplay* r, vksReader* rd, VkDeviceGroupCommandBufferBeginInfo* p);
+__attribute__((unused)) static void capture_VkBufferMemoryRequirementsInfo2(vksCaptureStream* s, const VkBufferMemoryRequirementsInfo2* p);
+__attribute__((unused)) static void replay_VkBufferMemoryRequirementsInfo2(vksReplay* r, vksReader* rd, VkBufferMemoryRequirementsInfo2* p);
+__attribute__((unused)) static void capture_VkImageMemoryRequirementsInfo2(vksCaptureStream* s, const VkImageMemoryRequirementsInfo2* p);
+__attribute__((unused)) static void replay_VkImageMemoryRequirementsInfo2(vksReplay* r, vksReader* rd, VkImageMemoryRequirementsInfo2* p);
+__attribute__((unused)) static void capture_VkImageSparseMemoryRequirementsInfo2(vksCaptureStream* s, const VkImageSparseMemoryRequirementsInfo2* p);
+__attribute__((unused)) static void replay_VkImageSparseMemoryRequirementsInfo2(vksReplay* r, vksReader* rd, VkImageSparseMemoryRequirementsInfo2* p);
+__attribute__((unused)) static void capture_VkMemoryRequirements2(vksCaptureStream* s, const VkMemoryRequirements2* p);
+__attribute__((unused)) static void replay_VkMemoryRequirements2(vksReplay* r, vksReader* rd, VkMemoryRequirements2* p);
+__attribute__((unused)) static void capture_VkSparseImageMemoryRequirements2(vksCaptureStream* s, const VkSparseImageMemoryRequirements2* p);
+__attribute__((unused)) static void replay_VkSparseImageMemoryRequirements2(vksReplay* r, vksReader* rd, VkSparseImageMemoryRequirements2* p);
+__attribute__((unused)) static void capture_VkBindImageMemoryInfo(vksCaptureStream* s, const VkBindImageMemoryInfo* p);
+__attribute__((unused)) static void replay_VkBindImageMemoryInfo(vksReplay* r, vksReader* rd, VkBindImageMemoryInfo* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceExternalBufferInfo(vksCaptureStream* s, const VkPhysicalDeviceExternalBufferInfo* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceExternalBufferInfo(vksReplay* r, vksReader* rd, VkPhysicalDeviceExternalBufferInfo* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceSamplerYcbcrConversionFeatures(vksCaptureStream* s, const VkPhysicalDeviceSamplerYcbcrConversionFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceSamplerYcbcrConversionFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceSamplerYcbcrConversionFeatures* p);
+__attribute__((unused)) static void capture_VkImagePlaneMemoryRequirementsInfo(vksCaptureStream* s, const VkImagePlaneMemoryRequirementsInfo* p);
+__attribute__((unused)) static void replay_VkImagePlaneMemoryRequirementsInfo(vksReplay* r, vksReader* rd, VkImagePlaneMemoryRequirementsInfo* p);
+__attribute__((unused)) static void capture_VkBindImagePlaneMemoryInfo(vksCaptureStream* s, const VkBindImagePlaneMemoryInfo* p);
+__attribute__((unused)) static void replay_VkBindImagePlaneMemoryInfo(vksReplay* r, vksReader* rd, VkBindImagePlaneMemoryInfo* p);
+__attribute__((unused)) static void capture_VkExternalSemaphoreProperties(vksCaptureStream* s, const VkExternalSemaphoreProperties* p);
+__attribute__((unused)) static void replay_VkExternalSemaphoreProperties(vksReplay* r, vksReader* rd, VkExternalSemaphoreProperties* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceExternalSemaphoreInfo(vksCaptureStream* s, const VkPhysicalDeviceExternalSemaphoreInfo* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceExternalSemaphoreInfo(vksReplay* r, vksReader* rd, VkPhysicalDeviceExternalSemaphoreInfo* p);
+__attribute__((unused)) static void capture_VkBindBufferMemoryInfo(vksCaptureStream* s, const VkBindBufferMemoryInfo* p);
+__attribute__((unused)) static void replay_VkBindBufferMemoryInfo(vksReplay* r, vksReader* rd, VkBindBufferMemoryInfo* p);
+__attribute__((unused)) static void capture_VkExternalMemoryImageCreateInfo(vksCaptureStream* s, const VkExternalMemoryImageCreateInfo* p);
+__attribute__((unused)) static void replay_VkExternalMemoryImageCreateInfo(vksReplay* r, vksReader* rd, VkExternalMemoryImageCreateInfo* p);
+__attribute__((unused)) static void capture_VkDeviceGroupRenderPassBeginInfo(vksCaptureStream* s, const VkDeviceGroupRenderPassBeginInfo* p);
+__attribute__((unused)) static void replay_VkDeviceGroupRenderPassBeginInfo(vksReplay* r, vksReader* rd, VkDeviceGroupRenderPassBeginInfo* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceExternalFenceInfo(vksCaptureStream* s, const VkPhysicalDeviceExternalFenceInfo* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceExternalFenceInfo(vksReplay* r, vksReader* rd, VkPhysicalDeviceExternalFenceInfo* p);
+__attribute__((unused)) static void capture_VkMemoryAllocateFlagsInfo(vksCaptureStream* s, const VkMemoryAllocateFlagsInfo* p);
+__attribute__((unused)) static void replay_VkMemoryAllocateFlagsInfo(vksReplay* r, vksReader* rd, VkMemoryAllocateFlagsInfo* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceFeatures2(vksCaptureStream* s, const VkPhysicalDeviceFeatures2* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceFeatures2(vksReplay* r, vksReader* rd, VkPhysicalDeviceFeatures2* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceProperties2(vksCaptureStream* s, const VkPhysicalDeviceProperties2* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceProperties2(vksReplay* r, vksReader* rd, VkPhysicalDeviceProperties2* p);
+__attribute__((unused)) static void capture_VkFormatProperties2(vksCaptureStream* s, const VkFormatProperties2* p);
+__attribute__((unused)) static void replay_VkFormatProperties2(vksReplay* r, vksReader* rd, VkFormatProperties2* p);
+__attribute__((unused)) static void capture_VkImageFormatProperties2(vksCaptureStream* s, const VkImageFormatProperties2* p);
+__attribute__((unused)) static void replay_VkImageFormatProperties2(vksReplay* r, vksReader* rd, VkImageFormatProperties2* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceImageFormatInfo2(vksCaptureStream* s, const VkPhysicalDeviceImageFormatInfo2* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceImageFormatInfo2(vksReplay* r, vksReader* rd, VkPhysicalDeviceImageFormatInfo2* p);
+__attribute__((unused)) static void capture_VkQueueFamilyProperties2(vksCaptureStream* s, const VkQueueFamilyProperties2* p);
+__attribute__((unused)) static void replay_VkQueueFamilyProperties2(vksReplay* r, vksReader* rd, VkQueueFamilyProperties2* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceMemoryProperties2(vksCaptureStream* s, const VkPhysicalDeviceMemoryProperties2* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceMemoryProperties2(vksReplay* r, vksReader* rd, VkPhysicalDeviceMemoryProperties2* p);
+__attribute__((unused)) static void capture_VkSparseImageFormatProperties2(vksCaptureStream* s, const VkSparseImageFormatProperties2* p);
+__attribute__((unused)) static void replay_VkSparseImageFormatProperties2(vksReplay* r, vksReader* rd, VkSparseImageFormatProperties2* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceSparseImageFormatInfo2(vksCaptureStream* s, const VkPhysicalDeviceSparseImageFormatInfo2* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceSparseImageFormatInfo2(vksReplay* r, vksReader* rd, VkPhysicalDeviceSparseImageFormatInfo2* p);
+__attribute__((unused)) static void capture_VkSamplerYcbcrConversionInfo(vksCaptureStream* s, const VkSamplerYcbcrConversionInfo* p);
+__attribute__((unused)) static void replay_VkSamplerYcbcrConversionInfo(vksReplay* r, vksReader* rd, VkSamplerYcbcrConversionInfo* p);
+__attribute__((unused)) static void capture_VkSamplerYcbcrConversionCreateInfo(vksCaptureStream* s, const VkSamplerYcbcrConversionCreateInfo* p);
+__attribute__((unused)) static void replay_VkSamplerYcbcrConversionCreateInfo(vksReplay* r, vksReader* rd, VkSamplerYcbcrConversionCreateInfo* p);
+__attribute__((unused)) static void capture_VkRenderPassMultiviewCreateInfo(vksCaptureStream* s, const VkRenderPassMultiviewCreateInfo* p);
+__attribute__((unused)) static void replay_VkRenderPassMultiviewCreateInfo(vksReplay* r, vksReader* rd, VkRenderPassMultiviewCreateInfo* p);
+__attribute__((unused)) static void capture_VkProtectedSubmitInfo(vksCaptureStream* s, const VkProtectedSubmitInfo* p);
+__attribute__((unused)) static void replay_VkProtectedSubmitInfo(vksReplay* r, vksReader* rd, VkProtectedSubmitInfo* p);
+__attribute__((unused)) static void capture_VkDeviceQueueInfo2(vksCaptureStream* s, const VkDeviceQueueInfo2* p);
+__attribute__((unused)) static void replay_VkDeviceQueueInfo2(vksReplay* r, vksReader* rd, VkDeviceQueueInfo2* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceVariablePointersFeatures(vksCaptureStream* s, const VkPhysicalDeviceVariablePointersFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceVariablePointersFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceVariablePointersFeatures* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceProtectedMemoryFeatures(vksCaptureStream* s, const VkPhysicalDeviceProtectedMemoryFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceProtectedMemoryFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceProtectedMemoryFeatures* p);
+__attribute__((unused)) static void capture_VkExportSemaphoreCreateInfo(vksCaptureStream* s, const VkExportSemaphoreCreateInfo* p);
+__attribute__((unused)) static void replay_VkExportSemaphoreCreateInfo(vksReplay* r, vksReader* rd, VkExportSemaphoreCreateInfo* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceIDProperties(vksCaptureStream* s, const VkPhysicalDeviceIDProperties* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceIDProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceIDProperties* p);
+__attribute__((unused)) static void capture_VkExternalBufferProperties(vksCaptureStream* s, const VkExternalBufferProperties* p);
+__attribute__((unused)) static void replay_VkExternalBufferProperties(vksReplay* r, vksReader* rd, VkExternalBufferProperties* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceProtectedMemoryProperties(vksCaptureStream* s, const VkPhysicalDeviceProtectedMemoryProperties* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceProtectedMemoryProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceProtectedMemoryProperties* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceMultiviewProperties(vksCaptureStream* s, const VkPhysicalDeviceMultiviewProperties* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceMultiviewProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceMultiviewProperties* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceMultiviewFeatures(vksCaptureStream* s, const VkPhysicalDeviceMultiviewFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceMultiviewFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceMultiviewFeatures* p);
+__attribute__((unused)) static void capture_VkPhysicalDevicePointClippingProperties(vksCaptureStream* s, const VkPhysicalDevicePointClippingProperties* p);
+__attribute__((unused)) static void replay_VkPhysicalDevicePointClippingProperties(vksReplay* r, vksReader* rd, VkPhysicalDevicePointClippingProperties* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceSubgroupProperties(vksCaptureStream* s, const VkPhysicalDeviceSubgroupProperties* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceSubgroupProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceSubgroupProperties* p);
+__attribute__((unused)) static void capture_VkRenderPassInputAttachmentAspectCreateInfo(vksCaptureStream* s, const VkRenderPassInputAttachmentAspectCreateInfo* p);
+__attribute__((unused)) static void replay_VkRenderPassInputAttachmentAspectCreateInfo(vksReplay* r, vksReader* rd, VkRenderPassInputAttachmentAspectCreateInfo* p);
+__attribute__((unused)) static void capture_VkImageViewUsageCreateInfo(vksCaptureStream* s, const VkImageViewUsageCreateInfo* p);
+__attribute__((unused)) static void replay_VkImageViewUsageCreateInfo(vksReplay* r, vksReader* rd, VkImageViewUsageCreateInfo* p);
+__attribute__((unused)) static void capture_VkExternalFenceProperties(vksCaptureStream* s, const VkExternalFenceProperties* p);
+__attribute__((unused)) static void replay_VkExternalFenceProperties(vksReplay* r, vksReader* rd, VkExternalFenceProperties* p);
+__attribute__((unused)) static void capture_VkPipelineTessellationDomainOriginStateCreateInfo(vksCaptureStream* s, const VkPipelineTessellationDomainOriginStateCreateInfo* p);
+__attribute__((unused)) static void replay_VkPipelineTessellationDomainOriginStateCreateInfo(vksReplay* r, vksReader* rd, VkPipelineTessellationDomainOriginStateCreateInfo* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures(vksCaptureStream* s, const VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceDriverProperties(vksCaptureStream* s, const VkPhysicalDeviceDriverProperties* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceDriverProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceDriverProperties* p);
+__attribute__((unused)) static void capture_VkSemaphoreSignalInfo(vksCaptureStream* s, const VkSemaphoreSignalInfo* p);
+__attribute__((unused)) static void replay_VkSemaphoreSignalInfo(vksReplay* r, vksReader* rd, VkSemaphoreSignalInfo* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceBufferDeviceAddressFeatures(vksCaptureStream* s, const VkPhysicalDeviceBufferDeviceAddressFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceBufferDeviceAddressFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceBufferDeviceAddressFeatures* p);
+__attribute__((unused)) static void capture_VkTimelineSemaphoreSubmitInfo(vksCaptureStream* s, const VkTimelineSemaphoreSubmitInfo* p);
+__attribute__((unused)) static void replay_VkTimelineSemaphoreSubmitInfo(vksReplay* r, vksReader* rd, VkTimelineSemaphoreSubmitInfo* p);
+__attribute__((unused)) static void capture_VkSemaphoreTypeCreateInfo(vksCaptureStream* s, const VkSemaphoreTypeCreateInfo* p);
+__attribute__((unused)) static void replay_VkSemaphoreTypeCreateInfo(vksReplay* r, vksReader* rd, VkSemaphoreTypeCreateInfo* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceTimelineSemaphoreProperties(vksCaptureStream* s, const VkPhysicalDeviceTimelineSemaphoreProperties* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceTimelineSemaphoreProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceTimelineSemaphoreProperties* p);
+__attribute__((unused)) static void capture_VkSubpassDependency2(vksCaptureStream* s, const VkSubpassDependency2* p);
+__attribute__((unused)) static void replay_VkSubpassDependency2(vksReplay* r, vksReader* rd, VkSubpassDependency2* p);
+__attribute__((unused)) static void capture_VkAttachmentReference2(vksCaptureStream* s, const VkAttachmentReference2* p);
+__attribute__((unused)) static void replay_VkAttachmentReference2(vksReplay* r, vksReader* rd, VkAttachmentReference2* p);
+__attribute__((unused)) static void capture_VkSubpassDescription2(vksCaptureStream* s, const VkSubpassDescription2* p);
+__attribute__((unused)) static void replay_VkSubpassDescription2(vksReplay* r, vksReader* rd, VkSubpassDescription2* p);
+__attribute__((unused)) static void capture_VkAttachmentDescription2(vksCaptureStream* s, const VkAttachmentDescription2* p);
+__attribute__((unused)) static void replay_VkAttachmentDescription2(vksReplay* r, vksReader* rd, VkAttachmentDescription2* p);
+__attribute__((unused)) static void capture_VkRenderPassCreateInfo2(vksCaptureStream* s, const VkRenderPassCreateInfo2* p);
+__attribute__((unused)) static void replay_VkRenderPassCreateInfo2(vksReplay* r, vksReader* rd, VkRenderPassCreateInfo2* p);
+__attribute__((unused)) static void capture_VkSubpassBeginInfo(vksCaptureStream* s, const VkSubpassBeginInfo* p);
+__attribute__((unused)) static void replay_VkSubpassBeginInfo(vksReplay* r, vksReader* rd, VkSubpassBeginInfo* p);
+__attribute__((unused)) static void capture_VkSubpassEndInfo(vksCaptureStream* s, const VkSubpassEndInfo* p);
+__attribute__((unused)) static void replay_VkSubpassEndInfo(vksReplay* r, vksReader* rd, VkSubpassEndInfo* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceTimelineSemaphoreFeatures(vksCaptureStream* s, const VkPhysicalDeviceTimelineSemaphoreFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceTimelineSemaphoreFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceTimelineSemaphoreFeatures* p);
+__attribute__((unused)) static void capture_VkImageFormatListCreateInfo(vksCaptureStream* s, const VkImageFormatListCreateInfo* p);
+__attribute__((unused)) static void replay_VkImageFormatListCreateInfo(vksReplay* r, vksReader* rd, VkImageFormatListCreateInfo* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceHostQueryResetFeatures(vksCaptureStream* s, const VkPhysicalDeviceHostQueryResetFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceHostQueryResetFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceHostQueryResetFeatures* p);
+__attribute__((unused)) static void capture_VkAttachmentDescriptionStencilLayout(vksCaptureStream* s, const VkAttachmentDescriptionStencilLayout* p);
+__attribute__((unused)) static void replay_VkAttachmentDescriptionStencilLayout(vksReplay* r, vksReader* rd, VkAttachmentDescriptionStencilLayout* p);
+__attribute__((unused)) static void capture_VkAttachmentReferenceStencilLayout(vksCaptureStream* s, const VkAttachmentReferenceStencilLayout* p);
+__attribute__((unused)) static void replay_VkAttachmentReferenceStencilLayout(vksReplay* r, vksReader* rd, VkAttachmentReferenceStencilLayout* p);
+__attribute__((unused)) static void capture_VkSubpassDescriptionDepthStencilResolve(vksCaptureStream* s, const VkSubpassDescriptionDepthStencilResolve* p);
+__attribute__((unused)) static void replay_VkSubpassDescriptionDepthStencilResolve(vksReplay* r, vksReader* rd, VkSubpassDescriptionDepthStencilResolve* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures(vksCaptureStream* s, const VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures* p);
+__attribute__((unused)) static void capture_VkPhysicalDevice8BitStorageFeatures(vksCaptureStream* s, const VkPhysicalDevice8BitStorageFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDevice8BitStorageFeatures(vksReplay* r, vksReader* rd, VkPhysicalDevice8BitStorageFeatures* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceUniformBufferStandardLayoutFeatures(vksCaptureStream* s, const VkPhysicalDeviceUniformBufferStandardLayoutFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceUniformBufferStandardLayoutFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceUniformBufferStandardLayoutFeatures* p);
+__attribute__((unused)) static void capture_VkBufferDeviceAddressInfo(vksCaptureStream* s, const VkBufferDeviceAddressInfo* p);
+__attribute__((unused)) static void replay_VkBufferDeviceAddressInfo(vksReplay* r, vksReader* rd, VkBufferDeviceAddressInfo* p);
+__attribute__((unused)) static void capture_VkSemaphoreWaitInfo(vksCaptureStream* s, const VkSemaphoreWaitInfo* p);
+__attribute__((unused)) static void replay_VkSemaphoreWaitInfo(vksReplay* r, vksReader* rd, VkSemaphoreWaitInfo* p);
+__attribute__((unused)) static void capture_VkRenderPassAttachmentBeginInfo(vksCaptureStream* s, const VkRenderPassAttachmentBeginInfo* p);
+__attribute__((unused)) static void replay_VkRenderPassAttachmentBeginInfo(vksReplay* r, vksReader* rd, VkRenderPassAttachmentBeginInfo* p);
+__attribute__((unused)) static void capture_VkFramebufferAttachmentImageInfo(vksCaptureStream* s, const VkFramebufferAttachmentImageInfo* p);
+__attribute__((unused)) static void replay_VkFramebufferAttachmentImageInfo(vksReplay* r, vksReader* rd, VkFramebufferAttachmentImageInfo* p);
+__attribute__((unused)) static void capture_VkFramebufferAttachmentsCreateInfo(vksCaptureStream* s, const VkFramebufferAttachmentsCreateInfo* p);
+__attribute__((unused)) static void replay_VkFramebufferAttachmentsCreateInfo(vksReplay* r, vksReader* rd, VkFramebufferAttachmentsCreateInfo* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceShaderAtomicInt64Features(vksCaptureStream* s, const VkPhysicalDeviceShaderAtomicInt64Features* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceShaderAtomicInt64Features(vksReplay* r, vksReader* rd, VkPhysicalDeviceShaderAtomicInt64Features* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceImagelessFramebufferFeatures(vksCaptureStream* s, const VkPhysicalDeviceImagelessFramebufferFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceImagelessFramebufferFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceImagelessFramebufferFeatures* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceShaderFloat16Int8Features(vksCaptureStream* s, const VkPhysicalDeviceShaderFloat16Int8Features* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceShaderFloat16Int8Features(vksReplay* r, vksReader* rd, VkPhysicalDeviceShaderFloat16Int8Features* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceVulkanMemoryModelFeatures(vksCaptureStream* s, const VkPhysicalDeviceVulkanMemoryModelFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceVulkanMemoryModelFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceVulkanMemoryModelFeatures* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceFloatControlsProperties(vksCaptureStream* s, const VkPhysicalDeviceFloatControlsProperties* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceFloatControlsProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceFloatControlsProperties* p);
+__attribute__((unused)) static void capture_VkBufferOpaqueCaptureAddressCreateInfo(vksCaptureStream* s, const VkBufferOpaqueCaptureAddressCreateInfo* p);
+__attribute__((unused)) static void replay_VkBufferOpaqueCaptureAddressCreateInfo(vksReplay* r, vksReader* rd, VkBufferOpaqueCaptureAddressCreateInfo* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceSamplerFilterMinmaxProperties(vksCaptureStream* s, const VkPhysicalDeviceSamplerFilterMinmaxProperties* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceSamplerFilterMinmaxProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceSamplerFilterMinmaxProperties* p);
+__attribute__((unused)) static void capture_VkDescriptorSetLayoutBindingFlagsCreateInfo(vksCaptureStream* s, const VkDescriptorSetLayoutBindingFlagsCreateInfo* p);
+__attribute__((unused)) static void replay_VkDescriptorSetLayoutBindingFlagsCreateInfo(vksReplay* r, vksReader* rd, VkDescriptorSetLayoutBindingFlagsCreateInfo* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceDescriptorIndexingFeatures(vksCaptureStream* s, const VkPhysicalDeviceDescriptorIndexingFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceDescriptorIndexingFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceDescriptorIndexingFeatures* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceDescriptorIndexingProperties(vksCaptureStream* s, const VkPhysicalDeviceDescriptorIndexingProperties* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceDescriptorIndexingProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceDescriptorIndexingProperties* p);
+__attribute__((unused)) static void capture_VkDescriptorSetVariableDescriptorCountAllocateInfo(vksCaptureStream* s, const VkDescriptorSetVariableDescriptorCountAllocateInfo* p);
+__attribute__((unused)) static void replay_VkDescriptorSetVariableDescriptorCountAllocateInfo(vksReplay* r, vksReader* rd, VkDescriptorSetVariableDescriptorCountAllocateInfo* p);
+__attribute__((unused)) static void capture_VkDescriptorSetVariableDescriptorCountLayoutSupport(vksCaptureStream* s, const VkDescriptorSetVariableDescriptorCountLayoutSupport* p);
+__attribute__((unused)) static void replay_VkDescriptorSetVariableDescriptorCountLayoutSupport(vksReplay* r, vksReader* rd, VkDescriptorSetVariableDescriptorCountLayoutSupport* p);
+__attribute__((unused)) static void capture_VkMemoryOpaqueCaptureAddressAllocateInfo(vksCaptureStream* s, const VkMemoryOpaqueCaptureAddressAllocateInfo* p);
+__attribute__((unused)) static void replay_VkMemoryOpaqueCaptureAddressAllocateInfo(vksReplay* r, vksReader* rd, VkMemoryOpaqueCaptureAddressAllocateInfo* p);
+__attribute__((unused)) static void capture_VkDeviceMemoryOpaqueCaptureAddressInfo(vksCaptureStream* s, const VkDeviceMemoryOpaqueCaptureAddressInfo* p);
+__attribute__((unused)) static void replay_VkDeviceMemoryOpaqueCaptureAddressInfo(vksReplay* r, vksReader* rd, VkDeviceMemoryOpaqueCaptureAddressInfo* p);
+__attribute__((unused)) static void capture_VkSamplerReductionModeCreateInfo(vksCaptureStream* s, const VkSamplerReductionModeCreateInfo* p);
+__attribute__((unused)) static void replay_VkSamplerReductionModeCreateInfo(vksReplay* r, vksReader* rd, VkSamplerReductionModeCreateInfo* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceVulkan12Properties(vksCaptureStream* s, const VkPhysicalDeviceVulkan12Properties* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceVulkan12Properties(vksReplay* r, vksReader* rd, VkPhysicalDeviceVulkan12Properties* p);
+__attribute__((unused)) static void capture_VkImageStencilUsageCreateInfo(vksCaptureStream* s, const VkImageStencilUsageCreateInfo* p);
+__attribute__((unused)) static void replay_VkImageStencilUsageCreateInfo(vksReplay* r, vksReader* rd, VkImageStencilUsageCreateInfo* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceVulkan12Features(vksCaptureStream* s, const VkPhysicalDeviceVulkan12Features* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceVulkan12Features(vksReplay* r, vksReader* rd, VkPhysicalDeviceVulkan12Features* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceScalarBlockLayoutFeatures(vksCaptureStream* s, const VkPhysicalDeviceScalarBlockLayoutFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceScalarBlockLayoutFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceScalarBlockLayoutFeatures* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceVulkan11Properties(vksCaptureStream* s, const VkPhysicalDeviceVulkan11Properties* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceVulkan11Properties(vksReplay* r, vksReader* rd, VkPhysicalDeviceVulkan11Properties* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceVulkan11Features(vksCaptureStream* s, const VkPhysicalDeviceVulkan11Features* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceVulkan11Features(vksReplay* r, vksReader* rd, VkPhysicalDeviceVulkan11Features* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceDepthStencilResolveProperties(vksCaptureStream* s, const VkPhysicalDeviceDepthStencilResolveProperties* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceDepthStencilResolveProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceDepthStencilResolveProperties* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceSubgroupSizeControlProperties(vksCaptureStream* s, const VkPhysicalDeviceSubgroupSizeControlProperties* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceSubgroupSizeControlProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceSubgroupSizeControlProperties* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceInlineUniformBlockFeatures(vksCaptureStream* s, const VkPhysicalDeviceInlineUniformBlockFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceInlineUniformBlockFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceInlineUniformBlockFeatures* p);
+__attribute__((unused)) static void capture_VkWriteDescriptorSetInlineUniformBlock(vksCaptureStream* s, const VkWriteDescriptorSetInlineUniformBlock* p);
+__attribute__((unused)) static void replay_VkWriteDescriptorSetInlineUniformBlock(vksReplay* r, vksReader* rd, VkWriteDescriptorSetInlineUniformBlock* p);
+__attribute__((unused)) static void capture_VkDeviceBufferMemoryRequirements(vksCaptureStream* s, const VkDeviceBufferMemoryRequirements* p);
+__attribute__((unused)) static void replay_VkDeviceBufferMemoryRequirements(vksReplay* r, vksReader* rd, VkDeviceBufferMemoryRequirements* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceMaintenance4Properties(vksCaptureStream* s, const VkPhysicalDeviceMaintenance4Properties* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceMaintenance4Properties(vksReplay* r, vksReader* rd, VkPhysicalDeviceMaintenance4Properties* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceMaintenance4Features(vksCaptureStream* s, const VkPhysicalDeviceMaintenance4Features* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceMaintenance4Features(vksReplay* r, vksReader* rd, VkPhysicalDeviceMaintenance4Features* p);
+__attribute__((unused)) static void capture_VkPhysicalDevicePrivateDataFeatures(vksCaptureStream* s, const VkPhysicalDevicePrivateDataFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDevicePrivateDataFeatures(vksReplay* r, vksReader* rd, VkPhysicalDevicePrivateDataFeatures* p);
+__attribute__((unused)) static void capture_VkDevicePrivateDataCreateInfo(vksCaptureStream* s, const VkDevicePrivateDataCreateInfo* p);
+__attribute__((unused)) static void replay_VkDevicePrivateDataCreateInfo(vksReplay* r, vksReader* rd, VkDevicePrivateDataCreateInfo* p);
+__attribute__((unused)) static void capture_VkPrivateDataSlotCreateInfo(vksCaptureStream* s, const VkPrivateDataSlotCreateInfo* p);
+__attribute__((unused)) static void replay_VkPrivateDataSlotCreateInfo(vksReplay* r, vksReader* rd, VkPrivateDataSlotCreateInfo* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures(vksCaptureStream* s, const VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures* p);
+__attribute__((unused)) static void capture_VkFormatProperties3(vksCaptureStream* s, const VkFormatProperties3* p);
+__attribute__((unused)) static void replay_VkFormatProperties3(vksReplay* r, vksReader* rd, VkFormatProperties3* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceVulkan13Features(vksCaptureStream* s, const VkPhysicalDeviceVulkan13Features* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceVulkan13Features(vksReplay* r, vksReader* rd, VkPhysicalDeviceVulkan13Features* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceVulkan13Properties(vksCaptureStream* s, const VkPhysicalDeviceVulkan13Properties* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceVulkan13Properties(vksReplay* r, vksReader* rd, VkPhysicalDeviceVulkan13Properties* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceTexelBufferAlignmentProperties(vksCaptureStream* s, const VkPhysicalDeviceTexelBufferAlignmentProperties* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceTexelBufferAlignmentProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceTexelBufferAlignmentProperties* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceShaderIntegerDotProductProperties(vksCaptureStream* s, const VkPhysicalDeviceShaderIntegerDotProductProperties* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceShaderIntegerDotProductProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceShaderIntegerDotProductProperties* p);
+__attribute__((unused)) static void capture_VkPhysicalDevicePipelineCreationCacheControlFeatures(vksCaptureStream* s, const VkPhysicalDevicePipelineCreationCacheControlFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDevicePipelineCreationCacheControlFeatures(vksReplay* r, vksReader* rd, VkPhysicalDevicePipelineCreationCacheControlFeatures* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceShaderIntegerDotProductFeatures(vksCaptureStream* s, const VkPhysicalDeviceShaderIntegerDotProductFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceShaderIntegerDotProductFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceShaderIntegerDotProductFeatures* p);
+__attribute__((unused)) static void capture_VkCommandBufferInheritanceRenderingInfo(vksCaptureStream* s, const VkCommandBufferInheritanceRenderingInfo* p);
+__attribute__((unused)) static void replay_VkCommandBufferInheritanceRenderingInfo(vksReplay* r, vksReader* rd, VkCommandBufferInheritanceRenderingInfo* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceDynamicRenderingFeatures(vksCaptureStream* s, const VkPhysicalDeviceDynamicRenderingFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceDynamicRenderingFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceDynamicRenderingFeatures* p);
+__attribute__((unused)) static void capture_VkPipelineRenderingCreateInfo(vksCaptureStream* s, const VkPipelineRenderingCreateInfo* p);
+__attribute__((unused)) static void replay_VkPipelineRenderingCreateInfo(vksReplay* r, vksReader* rd, VkPipelineRenderingCreateInfo* p);
+__attribute__((unused)) static void capture_VkRenderingAttachmentInfo(vksCaptureStream* s, const VkRenderingAttachmentInfo* p);
+__attribute__((unused)) static void replay_VkRenderingAttachmentInfo(vksReplay* r, vksReader* rd, VkRenderingAttachmentInfo* p);
+__attribute__((unused)) static void capture_VkRenderingInfo(vksCaptureStream* s, const VkRenderingInfo* p);
+__attribute__((unused)) static void replay_VkRenderingInfo(vksReplay* r, vksReader* rd, VkRenderingInfo* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceTextureCompressionASTCHDRFeatures(vksCaptureStream* s, const VkPhysicalDeviceTextureCompressionASTCHDRFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceTextureCompressionASTCHDRFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceTextureCompressionASTCHDRFeatures* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceInlineUniformBlockProperties(vksCaptureStream* s, const VkPhysicalDeviceInlineUniformBlockProperties* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceInlineUniformBlockProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceInlineUniformBlockProperties* p);
+__attribute__((unused)) static void capture_VkDescriptorPoolInlineUniformBlockCreateInfo(vksCaptureStream* s, const VkDescriptorPoolInlineUniformBlockCreateInfo* p);
+__attribute__((unused)) static void replay_VkDescriptorPoolInlineUniformBlockCreateInfo(vksReplay* r, vksReader* rd, VkDescriptorPoolInlineUniformBlockCreateInfo* p);
+__attribute__((unused)) static void capture_VkDeviceImageMemoryRequirements(vksCaptureStream* s, const VkDeviceImageMemoryRequirements* p);
+__attribute__((unused)) static void replay_VkDeviceImageMemoryRequirements(vksReplay* r, vksReader* rd, VkDeviceImageMemoryRequirements* p);
+__attribute__((unused)) static void capture_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo(vksCaptureStream* s, const VkPipelineShaderStageRequiredSubgroupSizeCreateInfo* p);
+__attribute__((unused)) static void replay_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo(vksReplay* r, vksReader* rd, VkPipelineShaderStageRequiredSubgroupSizeCreateInfo* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceToolProperties(vksCaptureStream* s, const VkPhysicalDeviceToolProperties* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceToolProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceToolProperties* p);
+__attribute__((unused)) static void capture_VkPipelineCreationFeedbackCreateInfo(vksCaptureStream* s, const VkPipelineCreationFeedbackCreateInfo* p);
+__attribute__((unused)) static void replay_VkPipelineCreationFeedbackCreateInfo(vksReplay* r, vksReader* rd, VkPipelineCreationFeedbackCreateInfo* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceSubgroupSizeControlFeatures(vksCaptureStream* s, const VkPhysicalDeviceSubgroupSizeControlFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceSubgroupSizeControlFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceSubgroupSizeControlFeatures* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceShaderTerminateInvocationFeatures(vksCaptureStream* s, const VkPhysicalDeviceShaderTerminateInvocationFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceShaderTerminateInvocationFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceShaderTerminateInvocationFeatures* p);
+__attribute__((unused)) static void capture_VkMemoryBarrier2(vksCaptureStream* s, const VkMemoryBarrier2* p);
+__attribute__((unused)) static void replay_VkMemoryBarrier2(vksReplay* r, vksReader* rd, VkMemoryBarrier2* p);
+__attribute__((unused)) static void capture_VkBufferMemoryBarrier2(vksCaptureStream* s, const VkBufferMemoryBarrier2* p);
+__attribute__((unused)) static void replay_VkBufferMemoryBarrier2(vksReplay* r, vksReader* rd, VkBufferMemoryBarrier2* p);
+__attribute__((unused)) static void capture_VkImageMemoryBarrier2(vksCaptureStream* s, const VkImageMemoryBarrier2* p);
+__attribute__((unused)) static void replay_VkImageMemoryBarrier2(vksReplay* r, vksReader* rd, VkImageMemoryBarrier2* p);
+__attribute__((unused)) static void capture_VkDependencyInfo(vksCaptureStream* s, const VkDependencyInfo* p);
+__attribute__((unused)) static void replay_VkDependencyInfo(vksReplay* r, vksReader* rd, VkDependencyInfo* p);
+__attribute__((unused)) static void capture_VkSemaphoreSubmitInfo(vksCaptureStream* s, const VkSemaphoreSubmitInfo* p);
+__attribute__((unused)) static void replay_VkSemaphoreSubmitInfo(vksReplay* r, vksReader* rd, VkSemaphoreSubmitInfo* p);
+__attribute__((unused)) static void capture_VkCommandBufferSubmitInfo(vksCaptureStream* s, const VkCommandBufferSubmitInfo* p);
+__attribute__((unused)) static void replay_VkCommandBufferSubmitInfo(vksReplay* r, vksReader* rd, VkCommandBufferSubmitInfo* p);
+__attribute__((unused)) static void capture_VkSubmitInfo2(vksCaptureStream* s, const VkSubmitInfo2* p);
+__attribute__((unused)) static void replay_VkSubmitInfo2(vksReplay* r, vksReader* rd, VkSubmitInfo2* p);
+__attribute__((unused)) static void capture_VkImageResolve2(vksCaptureStream* s, const VkImageResolve2* p);
+__attribute__((unused)) static void replay_VkImageResolve2(vksReplay* r, vksReader* rd, VkImageResolve2* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceSynchronization2Features(vksCaptureStream* s, const VkPhysicalDeviceSynchronization2Features* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceSynchronization2Features(vksReplay* r, vksReader* rd, VkPhysicalDeviceSynchronization2Features* p);
+__attribute__((unused)) static void capture_VkBufferImageCopy2(vksCaptureStream* s, const VkBufferImageCopy2* p);
+__attribute__((unused)) static void replay_VkBufferImageCopy2(vksReplay* r, vksReader* rd, VkBufferImageCopy2* p);
+__attribute__((unused)) static void capture_VkImageBlit2(vksCaptureStream* s, const VkImageBlit2* p);
+__attribute__((unused)) static void replay_VkImageBlit2(vksReplay* r, vksReader* rd, VkImageBlit2* p);
+__attribute__((unused)) static void capture_VkImageCopy2(vksCaptureStream* s, const VkImageCopy2* p);
+__attribute__((unused)) static void replay_VkImageCopy2(vksReplay* r, vksReader* rd, VkImageCopy2* p);
+__attribute__((unused)) static void capture_VkBufferCopy2(vksCaptureStream* s, const VkBufferCopy2* p);
+__attribute__((unused)) static void replay_VkBufferCopy2(vksReplay* r, vksReader* rd, VkBufferCopy2* p);
+__attribute__((unused)) static void capture_VkResolveImageInfo2(vksCaptureStream* s, const VkResolveImageInfo2* p);
+__attribute__((unused)) static void replay_VkResolveImageInfo2(vksReplay* r, vksReader* rd, VkResolveImageInfo2* p);
+__attribute__((unused)) static void capture_VkBlitImageInfo2(vksCaptureStream* s, const VkBlitImageInfo2* p);
+__attribute__((unused)) static void replay_VkBlitImageInfo2(vksReplay* r, vksReader* rd, VkBlitImageInfo2* p);
+__attribute__((unused)) static void capture_VkCopyImageToBufferInfo2(vksCaptureStream* s, const VkCopyImageToBufferInfo2* p);
+__attribute__((unused)) static void replay_VkCopyImageToBufferInfo2(vksReplay* r, vksReader* rd, VkCopyImageToBufferInfo2* p);
+__attribute__((unused)) static void capture_VkCopyBufferToImageInfo2(vksCaptureStream* s, const VkCopyBufferToImageInfo2* p);
+__attribute__((unused)) static void replay_VkCopyBufferToImageInfo2(vksReplay* r, vksReader* rd, VkCopyBufferToImageInfo2* p);
+__attribute__((unused)) static void capture_VkCopyImageInfo2(vksCaptureStream* s, const VkCopyImageInfo2* p);
+__attribute__((unused)) static void replay_VkCopyImageInfo2(vksReplay* r, vksReader* rd, VkCopyImageInfo2* p);
+__attribute__((unused)) static void capture_VkCopyBufferInfo2(vksCaptureStream* s, const VkCopyBufferInfo2* p);
+__attribute__((unused)) static void replay_VkCopyBufferInfo2(vksReplay* r, vksReader* rd, VkCopyBufferInfo2* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceImageRobustnessFeatures(vksCaptureStream* s, const VkPhysicalDeviceImageRobustnessFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceImageRobustnessFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceImageRobustnessFeatures* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures(vksCaptureStream* s, const VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures* p);
+__attribute__((unused)) static void capture_VkDebugReportCallbackCreateInfoEXT(vksCaptureStream* s, const VkDebugReportCallbackCreateInfoEXT* p);
+__attribute__((unused)) static void replay_VkDebugReportCallbackCreateInfoEXT(vksReplay* r, vksReader* rd, VkDebugReportCallbackCreateInfoEXT* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceSurfaceInfo2KHR(vksCaptureStream* s, const VkPhysicalDeviceSurfaceInfo2KHR* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceSurfaceInfo2KHR(vksReplay* r, vksReader* rd, VkPhysicalDeviceSurfaceInfo2KHR* p);
+__attribute__((unused)) static void capture_VkSurfaceCapabilities2KHR(vksCaptureStream* s, const VkSurfaceCapabilities2KHR* p);
+__attribute__((unused)) static void replay_VkSurfaceCapabilities2KHR(vksReplay* r, vksReader* rd, VkSurfaceCapabilities2KHR* p);
+__attribute__((unused)) static void capture_VkSurfaceFormat2KHR(vksCaptureStream* s, const VkSurfaceFormat2KHR* p);
+__attribute__((unused)) static void replay_VkSurfaceFormat2KHR(vksReplay* r, vksReader* rd, VkSurfaceFormat2KHR* p);
+__attribute__((unused)) static void capture_VkSurfaceProtectedCapabilitiesKHR(vksCaptureStream* s, const VkSurfaceProtectedCapabilitiesKHR* p);
+__attribute__((unused)) static void replay_VkSurfaceProtectedCapabilitiesKHR(vksReplay* r, vksReader* rd, VkSurfaceProtectedCapabilitiesKHR* p);
+__attribute__((unused)) static void capture_VkDeviceGroupSwapchainCreateInfoKHR(vksCaptureStream* s, const VkDeviceGroupSwapchainCreateInfoKHR* p);
+__attribute__((unused)) static void replay_VkDeviceGroupSwapchainCreateInfoKHR(vksReplay* r, vksReader* rd, VkDeviceGroupSwapchainCreateInfoKHR* p);
+__attribute__((unused)) static void capture_VkSwapchainCreateInfoKHR(vksCaptureStream* s, const VkSwapchainCreateInfoKHR* p);
+__attribute__((unused)) static void replay_VkSwapchainCreateInfoKHR(vksReplay* r, vksReader* rd, VkSwapchainCreateInfoKHR* p);
+__attribute__((unused)) static void capture_VkPresentInfoKHR(vksCaptureStream* s, const VkPresentInfoKHR* p);
+__attribute__((unused)) static void replay_VkPresentInfoKHR(vksReplay* r, vksReader* rd, VkPresentInfoKHR* p);
+__attribute__((unused)) static void capture_VkDeviceGroupPresentCapabilitiesKHR(vksCaptureStream* s, const VkDeviceGroupPresentCapabilitiesKHR* p);
+__attribute__((unused)) static void replay_VkDeviceGroupPresentCapabilitiesKHR(vksReplay* r, vksReader* rd, VkDeviceGroupPresentCapabilitiesKHR* p);
+__attribute__((unused)) static void capture_VkDeviceGroupPresentInfoKHR(vksCaptureStream* s, const VkDeviceGroupPresentInfoKHR* p);
+__attribute__((unused)) static void replay_VkDeviceGroupPresentInfoKHR(vksReplay* r, vksReader* rd, VkDeviceGroupPresentInfoKHR* p);
+__attribute__((unused)) static void capture_VkImageSwapchainCreateInfoKHR(vksCaptureStream* s, const VkImageSwapchainCreateInfoKHR* p);
+__attribute__((unused)) static void replay_VkImageSwapchainCreateInfoKHR(vksReplay* r, vksReader* rd, VkImageSwapchainCreateInfoKHR* p);
+__attribute__((unused)) static void capture_VkAcquireNextImageInfoKHR(vksCaptureStream* s, const VkAcquireNextImageInfoKHR* p);
+__attribute__((unused)) static void replay_VkAcquireNextImageInfoKHR(vksReplay* r, vksReader* rd, VkAcquireNextImageInfoKHR* p);
+__attribute__((unused)) static void capture_VkBindImageMemorySwapchainInfoKHR(vksCaptureStream* s, const VkBindImageMemorySwapchainInfoKHR* p);
+__attribute__((unused)) static void replay_VkBindImageMemorySwapchainInfoKHR(vksReplay* r, vksReader* rd, VkBindImageMemorySwapchainInfoKHR* p);
+__attribute__((unused)) static void capture_VkDisplayModePropertiesKHR(vksCaptureStream* s, const VkDisplayModePropertiesKHR* p);
+__attribute__((unused)) static void replay_VkDisplayModePropertiesKHR(vksReplay* r, vksReader* rd, VkDisplayModePropertiesKHR* p);
+__attribute__((unused)) static void capture_VkDisplaySurfaceCreateInfoKHR(vksCaptureStream* s, const VkDisplaySurfaceCreateInfoKHR* p);
+__attribute__((unused)) static void replay_VkDisplaySurfaceCreateInfoKHR(vksReplay* r, vksReader* rd, VkDisplaySurfaceCreateInfoKHR* p);
+__attribute__((unused)) static void capture_VkDisplayModeCreateInfoKHR(vksCaptureStream* s, const VkDisplayModeCreateInfoKHR* p);
+__attribute__((unused)) static void replay_VkDisplayModeCreateInfoKHR(vksReplay* r, vksReader* rd, VkDisplayModeCreateInfoKHR* p);
+__attribute__((unused)) static void capture_VkDisplayPropertiesKHR(vksCaptureStream* s, const VkDisplayPropertiesKHR* p);
+__attribute__((unused)) static void replay_VkDisplayPropertiesKHR(vksReplay* r, vksReader* rd, VkDisplayPropertiesKHR* p);
+__attribute__((unused)) static void capture_VkDisplayPlanePropertiesKHR(vksCaptureStream* s, const VkDisplayPlanePropertiesKHR* p);
+__attribute__((unused)) static void replay_VkDisplayPlanePropertiesKHR(vksReplay* r, vksReader* rd, VkDisplayPlanePropertiesKHR* p);
+__attribute__((unused)) static void capture_VkDisplayPlaneCapabilities2KHR(vksCaptureStream* s, const VkDisplayPlaneCapabilities2KHR* p);
+__attribute__((unused)) static void replay_VkDisplayPlaneCapabilities2KHR(vksReplay* r, vksReader* rd, VkDisplayPlaneCapabilities2KHR* p);
+__attribute__((unused)) static void capture_VkDisplayPlaneProperties2KHR(vksCaptureStream* s, const VkDisplayPlaneProperties2KHR* p);
+__attribute__((unused)) static void replay_VkDisplayPlaneProperties2KHR(vksReplay* r, vksReader* rd, VkDisplayPlaneProperties2KHR* p);
+__attribute__((unused)) static void capture_VkDisplayPlaneInfo2KHR(vksCaptureStream* s, const VkDisplayPlaneInfo2KHR* p);
+__attribute__((unused)) static void replay_VkDisplayPlaneInfo2KHR(vksReplay* r, vksReader* rd, VkDisplayPlaneInfo2KHR* p);
+__attribute__((unused)) static void capture_VkDisplayProperties2KHR(vksCaptureStream* s, const VkDisplayProperties2KHR* p);
+__attribute__((unused)) static void replay_VkDisplayProperties2KHR(vksReplay* r, vksReader* rd, VkDisplayProperties2KHR* p);
+__attribute__((unused)) static void capture_VkDisplayModeProperties2KHR(vksCaptureStream* s, const VkDisplayModeProperties2KHR* p);
+__attribute__((unused)) static void replay_VkDisplayModeProperties2KHR(vksReplay* r, vksReader* rd, VkDisplayModeProperties2KHR* p);
+__attribute__((unused)) static void capture_VkDisplayPresentInfoKHR(vksCaptureStream* s, const VkDisplayPresentInfoKHR* p);
+__attribute__((unused)) static void replay_VkDisplayPresentInfoKHR(vksReplay* r, vksReader* rd, VkDisplayPresentInfoKHR* p);
+__attribute__((unused)) static void capture_VkPhysicalDevicePortabilitySubsetFeaturesKHR(vksCaptureStream* s, const VkPhysicalDevicePortabilitySubsetFeaturesKHR* p);
+__attribute__((unused)) static void replay_VkPhysicalDevicePortabilitySubsetFeaturesKHR(vksReplay* r, vksReader* rd, VkPhysicalDevicePortabilitySubsetFeaturesKHR* p);
+__attribute__((unused)) static void capture_VkPhysicalDevicePortabilitySubsetPropertiesKHR(vksCaptureStream* s, const VkPhysicalDevicePortabilitySubsetPropertiesKHR* p);
+__attribute__((unused)) static void replay_VkPhysicalDevicePortabilitySubsetPropertiesKHR(vksReplay* r, vksReader* rd, VkPhysicalDevicePortabilitySubsetPropertiesKHR* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceMemoryBudgetPropertiesEXT(vksCaptureStream* s, const VkPhysicalDeviceMemoryBudgetPropertiesEXT* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceMemoryBudgetPropertiesEXT(vksReplay* r, vksReader* rd, VkPhysicalDeviceMemoryBudgetPropertiesEXT* p);
+__attribute__((unused)) static void capture_VkPipelineLibraryCreateInfoKHR(vksCaptureStream* s, const VkPipelineLibraryCreateInfoKHR* p);
+__attribute__((unused)) static void replay_VkPipelineLibraryCreateInfoKHR(vksReplay* r, vksReader* rd, VkPipelineLibraryCreateInfoKHR* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT(vksCaptureStream* s, const VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT(vksReplay* r, vksReader* rd, VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT* p);
+__attribute__((unused)) static void capture_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT(vksCaptureStream* s, const VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT* p);
+__attribute__((unused)) static void replay_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT(vksReplay* r, vksReader* rd, VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT* p);
+__attribute__((unused)) static void capture_VkGraphicsPipelineLibraryCreateInfoEXT(vksCaptureStream* s, const VkGraphicsPipelineLibraryCreateInfoEXT* p);
+__attribute__((unused)) static void replay_VkGraphicsPipelineLibraryCreateInfoEXT(vksReplay* r, vksReader* rd, VkGraphicsPipelineLibraryCreateInfoEXT* p);
+__attribute__((unused)) static void capture_VkImportMemoryFdInfoKHR(vksCaptureStream* s, const VkImportMemoryFdInfoKHR* p);
+__attribute__((unused)) static void replay_VkImportMemoryFdInfoKHR(vksReplay* r, vksReader* rd, VkImportMemoryFdInfoKHR* p);
+__attribute__((unused)) static void capture_VkMemoryFdPropertiesKHR(vksCaptureStream* s, const VkMemoryFdPropertiesKHR* p);
+__attribute__((unused)) static void replay_VkMemoryFdPropertiesKHR(vksReplay* r, vksReader* rd, VkMemoryFdPropertiesKHR* p);
+__attribute__((unused)) static void capture_VkMemoryGetFdInfoKHR(vksCaptureStream* s, const VkMemoryGetFdInfoKHR* p);
+__attribute__((unused)) static void replay_VkMemoryGetFdInfoKHR(vksReplay* r, vksReader* rd, VkMemoryGetFdInfoKHR* p);
+__attribute__((unused)) static void capture_VkImportSemaphoreFdInfoKHR(vksCaptureStream* s, const VkImportSemaphoreFdInfoKHR* p);
+__attribute__((unused)) static void replay_VkImportSemaphoreFdInfoKHR(vksReplay* r, vksReader* rd, VkImportSemaphoreFdInfoKHR* p);
+__attribute__((unused)) static void capture_VkSemaphoreGetFdInfoKHR(vksCaptureStream* s, const VkSemaphoreGetFdInfoKHR* p);
+__attribute__((unused)) static void replay_VkSemaphoreGetFdInfoKHR(vksReplay* r, vksReader* rd, VkSemaphoreGetFdInfoKHR* p);
+
+
+static void capture_VkDescriptorBufferInfo(vksCaptureStream* s, const VkDescriptorBufferInfo* p) {
+}
+
+static void replay_VkDescriptorBufferInfo(vksReplay* r, vksReader* rd, VkDescriptorBufferInfo* p) {
+	p->buffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)p->buffer);
+}
+
+static void capture_VkEventCreateInfo(vksCaptureStream* s, const VkEventCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkEventCreateInfo(vksReplay* r, vksReader* rd, VkEventCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkRenderPassBeginInfo(vksCaptureStream* s, const VkRenderPassBeginInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pClearValues, (size_t)(p->clearValueCount), sizeof(VkClearValue));
+}
+
+static void replay_VkRenderPassBeginInfo(vksReplay* r, vksReader* rd, VkRenderPassBeginInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->renderPass = (VkRenderPass)replay_map(r, (uint64_t)(uintptr_t)p->renderPass);
+	p->framebuffer = (VkFramebuffer)replay_map(r, (uint64_t)(uintptr_t)p->framebuffer);
+	p->pClearValues = replay_pointer(r, rd, sizeof(VkClearValue), NULL);
+}
+
+static void capture_VkQueryPoolCreateInfo(vksCaptureStream* s, const VkQueryPoolCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkQueryPoolCreateInfo(vksReplay* r, vksReader* rd, VkQueryPoolCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkSemaphoreCreateInfo(vksCaptureStream* s, const VkSemaphoreCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkSemaphoreCreateInfo(vksReplay* r, vksReader* rd, VkSemaphoreCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkBufferCreateInfo(vksCaptureStream* s, const VkBufferCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pQueueFamilyIndices, (size_t)(p->queueFamilyIndexCount), sizeof(uint32_t));
+}
+
+static void replay_VkBufferCreateInfo(vksReplay* r, vksReader* rd, VkBufferCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pQueueFamilyIndices = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+}
+
+static void capture_VkFenceCreateInfo(vksCaptureStream* s, const VkFenceCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkFenceCreateInfo(vksReplay* r, vksReader* rd, VkFenceCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkCommandBufferInheritanceInfo(vksCaptureStream* s, const VkCommandBufferInheritanceInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkCommandBufferInheritanceInfo(vksReplay* r, vksReader* rd, VkCommandBufferInheritanceInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->renderPass = (VkRenderPass)replay_map(r, (uint64_t)(uintptr_t)p->renderPass);
+	p->framebuffer = (VkFramebuffer)replay_map(r, (uint64_t)(uintptr_t)p->framebuffer);
+}
+
+static void capture_VkCommandBufferBeginInfo(vksCaptureStream* s, const VkCommandBufferBeginInfo* p) {
+	capture_next(s, p->pNext);
+	if (capture_pointer(s, p->pInheritanceInfo, (size_t)(1), sizeof(VkCommandBufferInheritanceInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkCommandBufferInheritanceInfo(s, &p->pInheritanceInfo[i]);
+		}
+	}
+}
+
+static void replay_VkCommandBufferBeginInfo(vksReplay* r, vksReader* rd, VkCommandBufferBeginInfo* p) {
+	p->pNext = replay_next(r, rd);
+	{
+		size_t n;
+		VkCommandBufferInheritanceInfo* v = replay_pointer(r, rd, sizeof(VkCommandBufferInheritanceInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkCommandBufferInheritanceInfo(r, rd, &v[i]);
+		}
+		p->pInheritanceInfo = v;
+	}
+}
+
+static void capture_VkBufferViewCreateInfo(vksCaptureStream* s, const VkBufferViewCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkBufferViewCreateInfo(vksReplay* r, vksReader* rd, VkBufferViewCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->buffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)p->buffer);
+}
+
+static void capture_VkCommandBufferAllocateInfo(vksCaptureStream* s, const VkCommandBufferAllocateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkCommandBufferAllocateInfo(vksReplay* r, vksReader* rd, VkCommandBufferAllocateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->commandPool = (VkCommandPool)replay_map(r, (uint64_t)(uintptr_t)p->commandPool);
+}
+
+static void capture_VkCommandPoolCreateInfo(vksCaptureStream* s, const VkCommandPoolCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkCommandPoolCreateInfo(vksReplay* r, vksReader* rd, VkCommandPoolCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkSubpassDescription(vksCaptureStream* s, const VkSubpassDescription* p) {
+	capture_pointer(s, p->pInputAttachments, (size_t)(p->inputAttachmentCount), sizeof(VkAttachmentReference));
+	capture_pointer(s, p->pColorAttachments, (size_t)(p->colorAttachmentCount), sizeof(VkAttachmentReference));
+	capture_pointer(s, p->pResolveAttachments, (size_t)(p->colorAttachmentCount), sizeof(VkAttachmentReference));
+	capture_pointer(s, p->pDepthStencilAttachment, (size_t)(1), sizeof(VkAttachmentReference));
+	capture_pointer(s, p->pPreserveAttachments, (size_t)(p->preserveAttachmentCount), sizeof(uint32_t));
+}
+
+static void replay_VkSubpassDescription(vksReplay* r, vksReader* rd, VkSubpassDescription* p) {
+	p->pInputAttachments = replay_pointer(r, rd, sizeof(VkAttachmentReference), NULL);
+	p->pColorAttachments = replay_pointer(r, rd, sizeof(VkAttachmentReference), NULL);
+	p->pResolveAttachments = replay_pointer(r, rd, sizeof(VkAttachmentReference), NULL);
+	p->pDepthStencilAttachment = replay_pointer(r, rd, sizeof(VkAttachmentReference), NULL);
+	p->pPreserveAttachments = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+}
+
+static void capture_VkImageCreateInfo(vksCaptureStream* s, const VkImageCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pQueueFamilyIndices, (size_t)(p->queueFamilyIndexCount), sizeof(uint32_t));
+}
+
+static void replay_VkImageCreateInfo(vksReplay* r, vksReader* rd, VkImageCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pQueueFamilyIndices = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+}
+
+static void capture_VkSparseMemoryBind(vksCaptureStream* s, const VkSparseMemoryBind* p) {
+}
+
+static void replay_VkSparseMemoryBind(vksReplay* r, vksReader* rd, VkSparseMemoryBind* p) {
+	p->memory = (VkDeviceMemory)replay_map(r, (uint64_t)(uintptr_t)p->memory);
+}
+
+static void capture_VkRenderPassCreateInfo(vksCaptureStream* s, const VkRenderPassCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pAttachments, (size_t)(p->attachmentCount), sizeof(VkAttachmentDescription));
+	if (capture_pointer(s, p->pSubpasses, (size_t)(p->subpassCount), sizeof(VkSubpassDescription))) {
+		for (size_t i = 0; i < (size_t)(p->subpassCount); i++) {
+			capture_VkSubpassDescription(s, &p->pSubpasses[i]);
+		}
+	}
+	capture_pointer(s, p->pDependencies, (size_t)(p->dependencyCount), sizeof(VkSubpassDependency));
+}
+
+static void replay_VkRenderPassCreateInfo(vksReplay* r, vksReader* rd, VkRenderPassCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pAttachments = replay_pointer(r, rd, sizeof(VkAttachmentDescription), NULL);
+	{
+		size_t n;
+		VkSubpassDescription* v = replay_pointer(r, rd, sizeof(VkSubpassDescription), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSubpassDescription(r, rd, &v[i]);
+		}
+		p->pSubpasses = v;
+	}
+	p->pDependencies = replay_pointer(r, rd, sizeof(VkSubpassDependency), NULL);
+}
+
+static void capture_VkBaseInStructure(vksCaptureStream* s, const VkBaseInStructure* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkBaseInStructure(vksReplay* r, vksReader* rd, VkBaseInStructure* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkSparseImageOpaqueMemoryBindInfo(vksCaptureStream* s, const VkSparseImageOpaqueMemoryBindInfo* p) {
+	if (capture_pointer(s, p->pBinds, (size_t)(p->bindCount), sizeof(VkSparseMemoryBind))) {
+		for (size_t i = 0; i < (size_t)(p->bindCount); i++) {
+			capture_VkSparseMemoryBind(s, &p->pBinds[i]);
+		}
+	}
+}
+
+static void replay_VkSparseImageOpaqueMemoryBindInfo(vksReplay* r, vksReader* rd, VkSparseImageOpaqueMemoryBindInfo* p) {
+	p->image = (VkImage)replay_map(r, (uint64_t)(uintptr_t)p->image);
+	{
+		size_t n;
+		VkSparseMemoryBind* v = replay_pointer(r, rd, sizeof(VkSparseMemoryBind), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSparseMemoryBind(r, rd, &v[i]);
+		}
+		p->pBinds = v;
+	}
+}
+
+static void capture_VkSparseImageMemoryBind(vksCaptureStream* s, const VkSparseImageMemoryBind* p) {
+}
+
+static void replay_VkSparseImageMemoryBind(vksReplay* r, vksReader* rd, VkSparseImageMemoryBind* p) {
+	p->memory = (VkDeviceMemory)replay_map(r, (uint64_t)(uintptr_t)p->memory);
+}
+
+static void capture_VkSparseImageMemoryBindInfo(vksCaptureStream* s, const VkSparseImageMemoryBindInfo* p) {
+	if (capture_pointer(s, p->pBinds, (size_t)(p->bindCount), sizeof(VkSparseImageMemoryBind))) {
+		for (size_t i = 0; i < (size_t)(p->bindCount); i++) {
+			capture_VkSparseImageMemoryBind(s, &p->pBinds[i]);
+		}
+	}
+}
+
+static void replay_VkSparseImageMemoryBindInfo(vksReplay* r, vksReader* rd, VkSparseImageMemoryBindInfo* p) {
+	p->image = (VkImage)replay_map(r, (uint64_t)(uintptr_t)p->image);
+	{
+		size_t n;
+		VkSparseImageMemoryBind* v = replay_pointer(r, rd, sizeof(VkSparseImageMemoryBind), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSparseImageMemoryBind(r, rd, &v[i]);
+		}
+		p->pBinds = v;
+	}
+}
+
+static void capture_VkImageViewCreateInfo(vksCaptureStream* s, const VkImageViewCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkImageViewCreateInfo(vksReplay* r, vksReader* rd, VkImageViewCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->image = (VkImage)replay_map(r, (uint64_t)(uintptr_t)p->image);
+}
+
+static void capture_VkSparseBufferMemoryBindInfo(vksCaptureStream* s, const VkSparseBufferMemoryBindInfo* p) {
+	if (capture_pointer(s, p->pBinds, (size_t)(p->bindCount), sizeof(VkSparseMemoryBind))) {
+		for (size_t i = 0; i < (size_t)(p->bindCount); i++) {
+			capture_VkSparseMemoryBind(s, &p->pBinds[i]);
+		}
+	}
+}
+
+static void replay_VkSparseBufferMemoryBindInfo(vksReplay* r, vksReader* rd, VkSparseBufferMemoryBindInfo* p) {
+	p->buffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)p->buffer);
+	{
+		size_t n;
+		VkSparseMemoryBind* v = replay_pointer(r, rd, sizeof(VkSparseMemoryBind), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSparseMemoryBind(r, rd, &v[i]);
+		}
+		p->pBinds = v;
+	}
+}
+
+static void capture_VkBaseOutStructure(vksCaptureStream* s, const VkBaseOutStructure* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkBaseOutStructure(vksReplay* r, vksReader* rd, VkBaseOutStructure* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkBufferMemoryBarrier(vksCaptureStream* s, const VkBufferMemoryBarrier* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkBufferMemoryBarrier(vksReplay* r, vksReader* rd, VkBufferMemoryBarrier* p) {
+	p->pNext = replay_next(r, rd);
+	p->buffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)p->buffer);
+}
+
+static void capture_VkBindSparseInfo(vksCaptureStream* s, const VkBindSparseInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pWaitSemaphores, (size_t)(p->waitSemaphoreCount), sizeof(VkSemaphore));
+	if (capture_pointer(s, p->pBufferBinds, (size_t)(p->bufferBindCount), sizeof(VkSparseBufferMemoryBindInfo))) {
+		for (size_t i = 0; i < (size_t)(p->bufferBindCount); i++) {
+			capture_VkSparseBufferMemoryBindInfo(s, &p->pBufferBinds[i]);
+		}
+	}
+	if (capture_pointer(s, p->pImageOpaqueBinds, (size_t)(p->imageOpaqueBindCount), sizeof(VkSparseImageOpaqueMemoryBindInfo))) {
+		for (size_t i = 0; i < (size_t)(p->imageOpaqueBindCount); i++) {
+			capture_VkSparseImageOpaqueMemoryBindInfo(s, &p->pImageOpaqueBinds[i]);
+		}
+	}
+	if (capture_pointer(s, p->pImageBinds, (size_t)(p->imageBindCount), sizeof(VkSparseImageMemoryBindInfo))) {
+		for (size_t i = 0; i < (size_t)(p->imageBindCount); i++) {
+			capture_VkSparseImageMemoryBindInfo(s, &p->pImageBinds[i]);
+		}
+	}
+	capture_pointer(s, p->pSignalSemaphores, (size_t)(p->signalSemaphoreCount), sizeof(VkSemaphore));
+}
+
+static void replay_VkBindSparseInfo(vksReplay* r, vksReader* rd, VkBindSparseInfo* p) {
+	p->pNext = replay_next(r, rd);
+	{
+		size_t n;
+		VkSemaphore* v = replay_pointer(r, rd, sizeof(VkSemaphore), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkSemaphore)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		p->pWaitSemaphores = v;
+	}
+	{
+		size_t n;
+		VkSparseBufferMemoryBindInfo* v = replay_pointer(r, rd, sizeof(VkSparseBufferMemoryBindInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSparseBufferMemoryBindInfo(r, rd, &v[i]);
+		}
+		p->pBufferBinds = v;
+	}
+	{
+		size_t n;
+		VkSparseImageOpaqueMemoryBindInfo* v = replay_pointer(r, rd, sizeof(VkSparseImageOpaqueMemoryBindInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSparseImageOpaqueMemoryBindInfo(r, rd, &v[i]);
+		}
+		p->pImageOpaqueBinds = v;
+	}
+	{
+		size_t n;
+		VkSparseImageMemoryBindInfo* v = replay_pointer(r, rd, sizeof(VkSparseImageMemoryBindInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSparseImageMemoryBindInfo(r, rd, &v[i]);
+		}
+		p->pImageBinds = v;
+	}
+	{
+		size_t n;
+		VkSemaphore* v = replay_pointer(r, rd, sizeof(VkSemaphore), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkSemaphore)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		p->pSignalSemaphores = v;
+	}
+}
+
+static void capture_VkShaderModuleCreateInfo(vksCaptureStream* s, const VkShaderModuleCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pCode, (size_t)(p->codeSize / 4), sizeof(uint32_t));
+}
+
+static void replay_VkShaderModuleCreateInfo(vksReplay* r, vksReader* rd, VkShaderModuleCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pCode = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+}
+
+static void capture_VkFramebufferCreateInfo(vksCaptureStream* s, const VkFramebufferCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pAttachments, (size_t)(p->attachmentCount), sizeof(VkImageView));
+}
+
+static void replay_VkFramebufferCreateInfo(vksReplay* r, vksReader* rd, VkFramebufferCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->renderPass = (VkRenderPass)replay_map(r, (uint64_t)(uintptr_t)p->renderPass);
+	{
+		size_t n;
+		VkImageView* v = replay_pointer(r, rd, sizeof(VkImageView), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkImageView)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		p->pAttachments = v;
+	}
+}
+
+static void capture_VkImageMemoryBarrier(vksCaptureStream* s, const VkImageMemoryBarrier* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkImageMemoryBarrier(vksReplay* r, vksReader* rd, VkImageMemoryBarrier* p) {
+	p->pNext = replay_next(r, rd);
+	p->image = (VkImage)replay_map(r, (uint64_t)(uintptr_t)p->image);
+}
+
+static void capture_VkMemoryBarrier(vksCaptureStream* s, const VkMemoryBarrier* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkMemoryBarrier(vksReplay* r, vksReader* rd, VkMemoryBarrier* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPipelineCacheCreateInfo(vksCaptureStream* s, const VkPipelineCacheCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pInitialData, (size_t)(p->initialDataSize), sizeof(uint8_t));
+}
+
+static void replay_VkPipelineCacheCreateInfo(vksReplay* r, vksReader* rd, VkPipelineCacheCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pInitialData = replay_pointer(r, rd, sizeof(uint8_t), NULL);
+}
+
+static void capture_VkDescriptorImageInfo(vksCaptureStream* s, const VkDescriptorImageInfo* p) {
+}
+
+static void replay_VkDescriptorImageInfo(vksReplay* r, vksReader* rd, VkDescriptorImageInfo* p) {
+	p->sampler = (VkSampler)replay_map(r, (uint64_t)(uintptr_t)p->sampler);
+	p->imageView = (VkImageView)replay_map(r, (uint64_t)(uintptr_t)p->imageView);
+}
+
+static void capture_VkWriteDescriptorSet(vksCaptureStream* s, const VkWriteDescriptorSet* p) {
+	capture_next(s, p->pNext);
+	if (capture_pointer(s, p->pImageInfo, (size_t)(p->descriptorCount), sizeof(VkDescriptorImageInfo))) {
+		for (size_t i = 0; i < (size_t)(p->descriptorCount); i++) {
+			capture_VkDescriptorImageInfo(s, &p->pImageInfo[i]);
+		}
+	}
+	if (capture_pointer(s, p->pBufferInfo, (size_t)(p->descriptorCount), sizeof(VkDescriptorBufferInfo))) {
+		for (size_t i = 0; i < (size_t)(p->descriptorCount); i++) {
+			capture_VkDescriptorBufferInfo(s, &p->pBufferInfo[i]);
+		}
+	}
+	capture_pointer(s, p->pTexelBufferView, (size_t)(p->descriptorCount), sizeof(VkBufferView));
+}
+
+static void replay_VkWriteDescriptorSet(vksReplay* r, vksReader* rd, VkWriteDescriptorSet* p) {
+	p->pNext = replay_next(r, rd);
+	p->dstSet = (VkDescriptorSet)replay_map(r, (uint64_t)(uintptr_t)p->dstSet);
+	{
+		size_t n;
+		VkDescriptorImageInfo* v = replay_pointer(r, rd, sizeof(VkDescriptorImageInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDescriptorImageInfo(r, rd, &v[i]);
+		}
+		p->pImageInfo = v;
+	}
+	{
+		size_t n;
+		VkDescriptorBufferInfo* v = replay_pointer(r, rd, sizeof(VkDescriptorBufferInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDescriptorBufferInfo(r, rd, &v[i]);
+		}
+		p->pBufferInfo = v;
+	}
+	{
+		size_t n;
+		VkBufferView* v = replay_pointer(r, rd, sizeof(VkBufferView), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkBufferView)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		p->pTexelBufferView = v;
+	}
+}
+
+static void capture_VkDescriptorSetLayoutBinding(vksCaptureStream* s, const VkDescriptorSetLayoutBinding* p) {
+	capture_pointer(s, p->pImmutableSamplers, (size_t)(p->descriptorCount), sizeof(VkSampler));
+}
+
+static void replay_VkDescriptorSetLayoutBinding(vksReplay* r, vksReader* rd, VkDescriptorSetLayoutBinding* p) {
+	{
+		size_t n;
+		VkSampler* v = replay_pointer(r, rd, sizeof(VkSampler), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkSampler)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		p->pImmutableSamplers = v;
+	}
+}
+
+static void capture_VkDescriptorSetLayoutCreateInfo(vksCaptureStream* s, const VkDescriptorSetLayoutCreateInfo* p) {
+	capture_next(s, p->pNext);
+	if (capture_pointer(s, p->pBindings, (size_t)(p->bindingCount), sizeof(VkDescriptorSetLayoutBinding))) {
+		for (size_t i = 0; i < (size_t)(p->bindingCount); i++) {
+			capture_VkDescriptorSetLayoutBinding(s, &p->pBindings[i]);
+		}
+	}
+}
+
+static void replay_VkDescriptorSetLayoutCreateInfo(vksReplay* r, vksReader* rd, VkDescriptorSetLayoutCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	{
+		size_t n;
+		VkDescriptorSetLayoutBinding* v = replay_pointer(r, rd, sizeof(VkDescriptorSetLayoutBinding), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDescriptorSetLayoutBinding(r, rd, &v[i]);
+		}
+		p->pBindings = v;
+	}
+}
+
+static void capture_VkDescriptorSetAllocateInfo(vksCaptureStream* s, const VkDescriptorSetAllocateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pSetLayouts, (size_t)(p->descriptorSetCount), sizeof(VkDescriptorSetLayout));
+}
+
+static void replay_VkDescriptorSetAllocateInfo(vksReplay* r, vksReader* rd, VkDescriptorSetAllocateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->descriptorPool = (VkDescriptorPool)replay_map(r, (uint64_t)(uintptr_t)p->descriptorPool);
+	{
+		size_t n;
+		VkDescriptorSetLayout* v = replay_pointer(r, rd, sizeof(VkDescriptorSetLayout), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkDescriptorSetLayout)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		p->pSetLayouts = v;
+	}
+}
+
+static void capture_VkSpecializationInfo(vksCaptureStream* s, const VkSpecializationInfo* p) {
+	capture_pointer(s, p->pMapEntries, (size_t)(p->mapEntryCount), sizeof(VkSpecializationMapEntry));
+	capture_pointer(s, p->pData, (size_t)(p->dataSize), sizeof(uint8_t));
+}
+
+static void replay_VkSpecializationInfo(vksReplay* r, vksReader* rd, VkSpecializationInfo* p) {
+	p->pMapEntries = replay_pointer(r, rd, sizeof(VkSpecializationMapEntry), NULL);
+	p->pData = replay_pointer(r, rd, sizeof(uint8_t), NULL);
+}
+
+static void capture_VkPipelineShaderStageCreateInfo(vksCaptureStream* s, const VkPipelineShaderStageCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_string(s, p->pName);
+	if (capture_pointer(s, p->pSpecializationInfo, (size_t)(1), sizeof(VkSpecializationInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkSpecializationInfo(s, &p->pSpecializationInfo[i]);
+		}
+	}
+}
+
+static void replay_VkPipelineShaderStageCreateInfo(vksReplay* r, vksReader* rd, VkPipelineShaderStageCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->module = (VkShaderModule)replay_map(r, (uint64_t)(uintptr_t)p->module);
+	p->pName = replay_string(r, rd);
+	{
+		size_t n;
+		VkSpecializationInfo* v = replay_pointer(r, rd, sizeof(VkSpecializationInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSpecializationInfo(r, rd, &v[i]);
+		}
+		p->pSpecializationInfo = v;
+	}
+}
+
+static void capture_VkComputePipelineCreateInfo(vksCaptureStream* s, const VkComputePipelineCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_VkPipelineShaderStageCreateInfo(s, &p->stage);
+}
+
+static void replay_VkComputePipelineCreateInfo(vksReplay* r, vksReader* rd, VkComputePipelineCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	replay_VkPipelineShaderStageCreateInfo(r, rd, &p->stage);
+	p->layout = (VkPipelineLayout)replay_map(r, (uint64_t)(uintptr_t)p->layout);
+	p->basePipelineHandle = (VkPipeline)replay_map(r, (uint64_t)(uintptr_t)p->basePipelineHandle);
+}
+
+static void capture_VkMemoryAllocateInfo(vksCaptureStream* s, const VkMemoryAllocateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkMemoryAllocateInfo(vksReplay* r, vksReader* rd, VkMemoryAllocateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkMappedMemoryRange(vksCaptureStream* s, const VkMappedMemoryRange* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkMappedMemoryRange(vksReplay* r, vksReader* rd, VkMappedMemoryRange* p) {
+	p->pNext = replay_next(r, rd);
+	p->memory = (VkDeviceMemory)replay_map(r, (uint64_t)(uintptr_t)p->memory);
+}
+
+static void capture_VkDescriptorPoolCreateInfo(vksCaptureStream* s, const VkDescriptorPoolCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pPoolSizes, (size_t)(p->poolSizeCount), sizeof(VkDescriptorPoolSize));
+}
+
+static void replay_VkDescriptorPoolCreateInfo(vksReplay* r, vksReader* rd, VkDescriptorPoolCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pPoolSizes = replay_pointer(r, rd, sizeof(VkDescriptorPoolSize), NULL);
+}
+
+static void capture_VkPipelineDynamicStateCreateInfo(vksCaptureStream* s, const VkPipelineDynamicStateCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pDynamicStates, (size_t)(p->dynamicStateCount), sizeof(VkDynamicState));
+}
+
+static void replay_VkPipelineDynamicStateCreateInfo(vksReplay* r, vksReader* rd, VkPipelineDynamicStateCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pDynamicStates = replay_pointer(r, rd, sizeof(VkDynamicState), NULL);
+}
+
+static void capture_VkPipelineColorBlendStateCreateInfo(vksCaptureStream* s, const VkPipelineColorBlendStateCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pAttachments, (size_t)(p->attachmentCount), sizeof(VkPipelineColorBlendAttachmentState));
+}
+
+static void replay_VkPipelineColorBlendStateCreateInfo(vksReplay* r, vksReader* rd, VkPipelineColorBlendStateCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pAttachments = replay_pointer(r, rd, sizeof(VkPipelineColorBlendAttachmentState), NULL);
+}
+
+static void capture_VkPipelineDepthStencilStateCreateInfo(vksCaptureStream* s, const VkPipelineDepthStencilStateCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPipelineDepthStencilStateCreateInfo(vksReplay* r, vksReader* rd, VkPipelineDepthStencilStateCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPipelineMultisampleStateCreateInfo(vksCaptureStream* s, const VkPipelineMultisampleStateCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pSampleMask, (size_t)((p->rasterizationSamples + 31) / 32), sizeof(VkSampleMask));
+}
+
+static void replay_VkPipelineMultisampleStateCreateInfo(vksReplay* r, vksReader* rd, VkPipelineMultisampleStateCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pSampleMask = replay_pointer(r, rd, sizeof(VkSampleMask), NULL);
+}
+
+static void capture_VkPipelineRasterizationStateCreateInfo(vksCaptureStream* s, const VkPipelineRasterizationStateCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPipelineRasterizationStateCreateInfo(vksReplay* r, vksReader* rd, VkPipelineRasterizationStateCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPipelineViewportStateCreateInfo(vksCaptureStream* s, const VkPipelineViewportStateCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pViewports, (size_t)(p->viewportCount), sizeof(VkViewport));
+	capture_pointer(s, p->pScissors, (size_t)(p->scissorCount), sizeof(VkRect2D));
+}
+
+static void replay_VkPipelineViewportStateCreateInfo(vksReplay* r, vksReader* rd, VkPipelineViewportStateCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pViewports = replay_pointer(r, rd, sizeof(VkViewport), NULL);
+	p->pScissors = replay_pointer(r, rd, sizeof(VkRect2D), NULL);
+}
+
+static void capture_VkPipelineTessellationStateCreateInfo(vksCaptureStream* s, const VkPipelineTessellationStateCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPipelineTessellationStateCreateInfo(vksReplay* r, vksReader* rd, VkPipelineTessellationStateCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPipelineInputAssemblyStateCreateInfo(vksCaptureStream* s, const VkPipelineInputAssemblyStateCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPipelineInputAssemblyStateCreateInfo(vksReplay* r, vksReader* rd, VkPipelineInputAssemblyStateCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPipelineVertexInputStateCreateInfo(vksCaptureStream* s, const VkPipelineVertexInputStateCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pVertexBindingDescriptions, (size_t)(p->vertexBindingDescriptionCount), sizeof(VkVertexInputBindingDescription));
+	capture_pointer(s, p->pVertexAttributeDescriptions, (size_t)(p->vertexAttributeDescriptionCount), sizeof(VkVertexInputAttributeDescription));
+}
+
+static void replay_VkPipelineVertexInputStateCreateInfo(vksReplay* r, vksReader* rd, VkPipelineVertexInputStateCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pVertexBindingDescriptions = replay_pointer(r, rd, sizeof(VkVertexInputBindingDescription), NULL);
+	p->pVertexAttributeDescriptions = replay_pointer(r, rd, sizeof(VkVertexInputAttributeDescription), NULL);
+}
+
+static void capture_VkGraphicsPipelineCreateInfo(vksCaptureStream* s, const VkGraphicsPipelineCreateInfo* p) {
+	capture_next(s, p->pNext);
+	if (capture_pointer(s, p->pStages, (size_t)(p->stageCount), sizeof(VkPipelineShaderStageCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(p->stageCount); i++) {
+			capture_VkPipelineShaderStageCreateInfo(s, &p->pStages[i]);
+		}
+	}
+	if (capture_pointer(s, p->pVertexInputState, (size_t)(1), sizeof(VkPipelineVertexInputStateCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPipelineVertexInputStateCreateInfo(s, &p->pVertexInputState[i]);
+		}
+	}
+	if (capture_pointer(s, p->pInputAssemblyState, (size_t)(1), sizeof(VkPipelineInputAssemblyStateCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPipelineInputAssemblyStateCreateInfo(s, &p->pInputAssemblyState[i]);
+		}
+	}
+	if (capture_pointer(s, p->pTessellationState, (size_t)(1), sizeof(VkPipelineTessellationStateCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPipelineTessellationStateCreateInfo(s, &p->pTessellationState[i]);
+		}
+	}
+	if (capture_pointer(s, p->pViewportState, (size_t)(1), sizeof(VkPipelineViewportStateCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPipelineViewportStateCreateInfo(s, &p->pViewportState[i]);
+		}
+	}
+	if (capture_pointer(s, p->pRasterizationState, (size_t)(1), sizeof(VkPipelineRasterizationStateCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPipelineRasterizationStateCreateInfo(s, &p->pRasterizationState[i]);
+		}
+	}
+	if (capture_pointer(s, p->pMultisampleState, (size_t)(1), sizeof(VkPipelineMultisampleStateCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPipelineMultisampleStateCreateInfo(s, &p->pMultisampleState[i]);
+		}
+	}
+	if (capture_pointer(s, p->pDepthStencilState, (size_t)(1), sizeof(VkPipelineDepthStencilStateCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPipelineDepthStencilStateCreateInfo(s, &p->pDepthStencilState[i]);
+		}
+	}
+	if (capture_pointer(s, p->pColorBlendState, (size_t)(1), sizeof(VkPipelineColorBlendStateCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPipelineColorBlendStateCreateInfo(s, &p->pColorBlendState[i]);
+		}
+	}
+	if (capture_pointer(s, p->pDynamicState, (size_t)(1), sizeof(VkPipelineDynamicStateCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPipelineDynamicStateCreateInfo(s, &p->pDynamicState[i]);
+		}
+	}
+}
+
+static void replay_VkGraphicsPipelineCreateInfo(vksReplay* r, vksReader* rd, VkGraphicsPipelineCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	{
+		size_t n;
+		VkPipelineShaderStageCreateInfo* v = replay_pointer(r, rd, sizeof(VkPipelineShaderStageCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPipelineShaderStageCreateInfo(r, rd, &v[i]);
+		}
+		p->pStages = v;
+	}
+	{
+		size_t n;
+		VkPipelineVertexInputStateCreateInfo* v = replay_pointer(r, rd, sizeof(VkPipelineVertexInputStateCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPipelineVertexInputStateCreateInfo(r, rd, &v[i]);
+		}
+		p->pVertexInputState = v;
+	}
+	{
+		size_t n;
+		VkPipelineInputAssemblyStateCreateInfo* v = replay_pointer(r, rd, sizeof(VkPipelineInputAssemblyStateCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPipelineInputAssemblyStateCreateInfo(r, rd, &v[i]);
+		}
+		p->pInputAssemblyState = v;
+	}
+	{
+		size_t n;
+		VkPipelineTessellationStateCreateInfo* v = replay_pointer(r, rd, sizeof(VkPipelineTessellationStateCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPipelineTessellationStateCreateInfo(r, rd, &v[i]);
+		}
+		p->pTessellationState = v;
+	}
+	{
+		size_t n;
+		VkPipelineViewportStateCreateInfo* v = replay_pointer(r, rd, sizeof(VkPipelineViewportStateCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPipelineViewportStateCreateInfo(r, rd, &v[i]);
+		}
+		p->pViewportState = v;
+	}
+	{
+		size_t n;
+		VkPipelineRasterizationStateCreateInfo* v = replay_pointer(r, rd, sizeof(VkPipelineRasterizationStateCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPipelineRasterizationStateCreateInfo(r, rd, &v[i]);
+		}
+		p->pRasterizationState = v;
+	}
+	{
+		size_t n;
+		VkPipelineMultisampleStateCreateInfo* v = replay_pointer(r, rd, sizeof(VkPipelineMultisampleStateCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPipelineMultisampleStateCreateInfo(r, rd, &v[i]);
+		}
+		p->pMultisampleState = v;
+	}
+	{
+		size_t n;
+		VkPipelineDepthStencilStateCreateInfo* v = replay_pointer(r, rd, sizeof(VkPipelineDepthStencilStateCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPipelineDepthStencilStateCreateInfo(r, rd, &v[i]);
+		}
+		p->pDepthStencilState = v;
+	}
+	{
+		size_t n;
+		VkPipelineColorBlendStateCreateInfo* v = replay_pointer(r, rd, sizeof(VkPipelineColorBlendStateCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPipelineColorBlendStateCreateInfo(r, rd, &v[i]);
+		}
+		p->pColorBlendState = v;
+	}
+	{
+		size_t n;
+		VkPipelineDynamicStateCreateInfo* v = replay_pointer(r, rd, sizeof(VkPipelineDynamicStateCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPipelineDynamicStateCreateInfo(r, rd, &v[i]);
+		}
+		p->pDynamicState = v;
+	}
+	p->layout = (VkPipelineLayout)replay_map(r, (uint64_t)(uintptr_t)p->layout);
+	p->renderPass = (VkRenderPass)replay_map(r, (uint64_t)(uintptr_t)p->renderPass);
+	p->basePipelineHandle = (VkPipeline)replay_map(r, (uint64_t)(uintptr_t)p->basePipelineHandle);
+}
+
+static void capture_VkAllocationCallbacks(vksCaptureStream* s, const VkAllocationCallbacks* p) {
+}
+
+static void replay_VkAllocationCallbacks(vksReplay* r, vksReader* rd, VkAllocationCallbacks* p) {
+	p->pUserData = NULL;
+	p->pfnAllocation = NULL;
+	p->pfnReallocation = NULL;
+	p->pfnFree = NULL;
+	p->pfnInternalAllocation = NULL;
+	p->pfnInternalFree = NULL;
+}
+
+static void capture_VkApplicationInfo(vksCaptureStream* s, const VkApplicationInfo* p) {
+	capture_next(s, p->pNext);
+	capture_string(s, p->pApplicationName);
+	capture_string(s, p->pEngineName);
+}
+
+static void replay_VkApplicationInfo(vksReplay* r, vksReader* rd, VkApplicationInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pApplicationName = replay_string(r, rd);
+	p->pEngineName = replay_string(r, rd);
+}
+
+static void capture_VkCopyDescriptorSet(vksCaptureStream* s, const VkCopyDescriptorSet* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkCopyDescriptorSet(vksReplay* r, vksReader* rd, VkCopyDescriptorSet* p) {
+	p->pNext = replay_next(r, rd);
+	p->srcSet = (VkDescriptorSet)replay_map(r, (uint64_t)(uintptr_t)p->srcSet);
+	p->dstSet = (VkDescriptorSet)replay_map(r, (uint64_t)(uintptr_t)p->dstSet);
+}
+
+static void capture_VkSubmitInfo(vksCaptureStream* s, const VkSubmitInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pWaitSemaphores, (size_t)(p->waitSemaphoreCount), sizeof(VkSemaphore));
+	capture_pointer(s, p->pWaitDstStageMask, (size_t)(p->waitSemaphoreCount), sizeof(VkPipelineStageFlags));
+	capture_pointer(s, p->pCommandBuffers, (size_t)(p->commandBufferCount), sizeof(VkCommandBuffer));
+	capture_pointer(s, p->pSignalSemaphores, (size_t)(p->signalSemaphoreCount), sizeof(VkSemaphore));
+}
+
+static void replay_VkSubmitInfo(vksReplay* r, vksReader* rd, VkSubmitInfo* p) {
+	p->pNext = replay_next(r, rd);
+	{
+		size_t n;
+		VkSemaphore* v = replay_pointer(r, rd, sizeof(VkSemaphore), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkSemaphore)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		p->pWaitSemaphores = v;
+	}
+	p->pWaitDstStageMask = replay_pointer(r, rd, sizeof(VkPipelineStageFlags), NULL);
+	{
+		size_t n;
+		VkCommandBuffer* v = replay_pointer(r, rd, sizeof(VkCommandBuffer), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		p->pCommandBuffers = v;
+	}
+	{
+		size_t n;
+		VkSemaphore* v = replay_pointer(r, rd, sizeof(VkSemaphore), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkSemaphore)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		p->pSignalSemaphores = v;
+	}
+}
+
+static void capture_VkSamplerCreateInfo(vksCaptureStream* s, const VkSamplerCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkSamplerCreateInfo(vksReplay* r, vksReader* rd, VkSamplerCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkInstanceCreateInfo(vksCaptureStream* s, const VkInstanceCreateInfo* p) {
+	capture_next(s, p->pNext);
+	if (capture_pointer(s, p->pApplicationInfo, (size_t)(1), sizeof(VkApplicationInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkApplicationInfo(s, &p->pApplicationInfo[i]);
+		}
+	}
+	capture_strings(s, p->ppEnabledLayerNames, (size_t)(p->enabledLayerCount));
+	capture_strings(s, p->ppEnabledExtensionNames, (size_t)(p->enabledExtensionCount));
+}
+
+static void replay_VkInstanceCreateInfo(vksReplay* r, vksReader* rd, VkInstanceCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	{
+		size_t n;
+		VkApplicationInfo* v = replay_pointer(r, rd, sizeof(VkApplicationInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkApplicationInfo(r, rd, &v[i]);
+		}
+		p->pApplicationInfo = v;
+	}
+	p->ppEnabledLayerNames = (const char* const*)replay_strings(r, rd);
+	p->ppEnabledExtensionNames = (const char* const*)replay_strings(r, rd);
+}
+
+static void capture_VkDeviceQueueCreateInfo(vksCaptureStream* s, const VkDeviceQueueCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pQueuePriorities, (size_t)(p->queueCount), sizeof(float));
+}
+
+static void replay_VkDeviceQueueCreateInfo(vksReplay* r, vksReader* rd, VkDeviceQueueCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pQueuePriorities = replay_pointer(r, rd, sizeof(float), NULL);
+}
+
+static void capture_VkDeviceCreateInfo(vksCaptureStream* s, const VkDeviceCreateInfo* p) {
+	capture_next(s, p->pNext);
+	if (capture_pointer(s, p->pQueueCreateInfos, (size_t)(p->queueCreateInfoCount), sizeof(VkDeviceQueueCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(p->queueCreateInfoCount); i++) {
+			capture_VkDeviceQueueCreateInfo(s, &p->pQueueCreateInfos[i]);
+		}
+	}
+	capture_strings(s, p->ppEnabledLayerNames, (size_t)(p->enabledLayerCount));
+	capture_strings(s, p->ppEnabledExtensionNames, (size_t)(p->enabledExtensionCount));
+	capture_pointer(s, p->pEnabledFeatures, (size_t)(1), sizeof(VkPhysicalDeviceFeatures));
+}
+
+static void replay_VkDeviceCreateInfo(vksReplay* r, vksReader* rd, VkDeviceCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	{
+		size_t n;
+		VkDeviceQueueCreateInfo* v = replay_pointer(r, rd, sizeof(VkDeviceQueueCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDeviceQueueCreateInfo(r, rd, &v[i]);
+		}
+		p->pQueueCreateInfos = v;
+	}
+	p->ppEnabledLayerNames = (const char* const*)replay_strings(r, rd);
+	p->ppEnabledExtensionNames = (const char* const*)replay_strings(r, rd);
+	p->pEnabledFeatures = replay_pointer(r, rd, sizeof(VkPhysicalDeviceFeatures), NULL);
+}
+
+static void capture_VkPipelineLayoutCreateInfo(vksCaptureStream* s, const VkPipelineLayoutCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pSetLayouts, (size_t)(p->setLayoutCount), sizeof(VkDescriptorSetLayout));
+	capture_pointer(s, p->pPushConstantRanges, (size_t)(p->pushConstantRangeCount), sizeof(VkPushConstantRange));
+}
+
+static void replay_VkPipelineLayoutCreateInfo(vksReplay* r, vksReader* rd, VkPipelineLayoutCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	{
+		size_t n;
+		VkDescriptorSetLayout* v = replay_pointer(r, rd, sizeof(VkDescriptorSetLayout), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkDescriptorSetLayout)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		p->pSetLayouts = v;
+	}
+	p->pPushConstantRanges = replay_pointer(r, rd, sizeof(VkPushConstantRange), NULL);
+}
+
+static void capture_VkSamplerYcbcrConversionImageFormatProperties(vksCaptureStream* s, const VkSamplerYcbcrConversionImageFormatProperties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkSamplerYcbcrConversionImageFormatProperties(vksReplay* r, vksReader* rd, VkSamplerYcbcrConversionImageFormatProperties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceShaderDrawParametersFeatures(vksCaptureStream* s, const VkPhysicalDeviceShaderDrawParametersFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceShaderDrawParametersFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceShaderDrawParametersFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkExternalMemoryBufferCreateInfo(vksCaptureStream* s, const VkExternalMemoryBufferCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkExternalMemoryBufferCreateInfo(vksReplay* r, vksReader* rd, VkExternalMemoryBufferCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceExternalImageFormatInfo(vksCaptureStream* s, const VkPhysicalDeviceExternalImageFormatInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceExternalImageFormatInfo(vksReplay* r, vksReader* rd, VkPhysicalDeviceExternalImageFormatInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkExternalImageFormatProperties(vksCaptureStream* s, const VkExternalImageFormatProperties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkExternalImageFormatProperties(vksReplay* r, vksReader* rd, VkExternalImageFormatProperties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkDescriptorUpdateTemplateCreateInfo(vksCaptureStream* s, const VkDescriptorUpdateTemplateCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pDescriptorUpdateEntries, (size_t)(p->descriptorUpdateEntryCount), sizeof(VkDescriptorUpdateTemplateEntry));
+}
+
+static void replay_VkDescriptorUpdateTemplateCreateInfo(vksReplay* r, vksReader* rd, VkDescriptorUpdateTemplateCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pDescriptorUpdateEntries = replay_pointer(r, rd, sizeof(VkDescriptorUpdateTemplateEntry), NULL);
+	p->descriptorSetLayout = (VkDescriptorSetLayout)replay_map(r, (uint64_t)(uintptr_t)p->descriptorSetLayout);
+	p->pipelineLayout = (VkPipelineLayout)replay_map(r, (uint64_t)(uintptr_t)p->pipelineLayout);
+}
+
+static void capture_VkBindBufferMemoryDeviceGroupInfo(vksCaptureStream* s, const VkBindBufferMemoryDeviceGroupInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pDeviceIndices, (size_t)(p->deviceIndexCount), sizeof(uint32_t));
+}
+
+static void replay_VkBindBufferMemoryDeviceGroupInfo(vksReplay* r, vksReader* rd, VkBindBufferMemoryDeviceGroupInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pDeviceIndices = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+}
+
+static void capture_VkBindImageMemoryDeviceGroupInfo(vksCaptureStream* s, const VkBindImageMemoryDeviceGroupInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pDeviceIndices, (size_t)(p->deviceIndexCount), sizeof(uint32_t));
+	capture_pointer(s, p->pSplitInstanceBindRegions, (size_t)(p->splitInstanceBindRegionCount), sizeof(VkRect2D));
+}
+
+static void replay_VkBindImageMemoryDeviceGroupInfo(vksReplay* r, vksReader* rd, VkBindImageMemoryDeviceGroupInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pDeviceIndices = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	p->pSplitInstanceBindRegions = replay_pointer(r, rd, sizeof(VkRect2D), NULL);
+}
+
+static void capture_VkMemoryDedicatedAllocateInfo(vksCaptureStream* s, const VkMemoryDedicatedAllocateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkMemoryDedicatedAllocateInfo(vksReplay* r, vksReader* rd, VkMemoryDedicatedAllocateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->image = (VkImage)replay_map(r, (uint64_t)(uintptr_t)p->image);
+	p->buffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)p->buffer);
+}
+
+static void capture_VkDeviceGroupBindSparseInfo(vksCaptureStream* s, const VkDeviceGroupBindSparseInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkDeviceGroupBindSparseInfo(vksReplay* r, vksReader* rd, VkDeviceGroupBindSparseInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkDescriptorSetLayoutSupport(vksCaptureStream* s, const VkDescriptorSetLayoutSupport* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkDescriptorSetLayoutSupport(vksReplay* r, vksReader* rd, VkDescriptorSetLayoutSupport* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceGroupProperties(vksCaptureStream* s, const VkPhysicalDeviceGroupProperties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceGroupProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceGroupProperties* p) {
+	p->pNext = replay_next(r, rd);
+	for (size_t i = 0; i < VK_MAX_DEVICE_GROUP_SIZE; i++) {
+		p->physicalDevices[i] = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)p->physicalDevices[i]);
+	}
+}
+
+static void capture_VkDeviceGroupDeviceCreateInfo(vksCaptureStream* s, const VkDeviceGroupDeviceCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pPhysicalDevices, (size_t)(p->physicalDeviceCount), sizeof(VkPhysicalDevice));
+}
+
+static void replay_VkDeviceGroupDeviceCreateInfo(vksReplay* r, vksReader* rd, VkDeviceGroupDeviceCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	{
+		size_t n;
+		VkPhysicalDevice* v = replay_pointer(r, rd, sizeof(VkPhysicalDevice), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		p->pPhysicalDevices = v;
+	}
+}
+
+static void capture_VkMemoryDedicatedRequirements(vksCaptureStream* s, const VkMemoryDedicatedRequirements* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkMemoryDedicatedRequirements(vksReplay* r, vksReader* rd, VkMemoryDedicatedRequirements* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkExportMemoryAllocateInfo(vksCaptureStream* s, const VkExportMemoryAllocateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkExportMemoryAllocateInfo(vksReplay* r, vksReader* rd, VkExportMemoryAllocateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkExportFenceCreateInfo(vksCaptureStream* s, const VkExportFenceCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkExportFenceCreateInfo(vksReplay* r, vksReader* rd, VkExportFenceCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDevice16BitStorageFeatures(vksCaptureStream* s, const VkPhysicalDevice16BitStorageFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDevice16BitStorageFeatures(vksReplay* r, vksReader* rd, VkPhysicalDevice16BitStorageFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceMaintenance3Properties(vksCaptureStream* s, const VkPhysicalDeviceMaintenance3Properties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceMaintenance3Properties(vksReplay* r, vksReader* rd, VkPhysicalDeviceMaintenance3Properties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkDeviceGroupSubmitInfo(vksCaptureStream* s, const VkDeviceGroupSubmitInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pWaitSemaphoreDeviceIndices, (size_t)(p->waitSemaphoreCount), sizeof(uint32_t));
+	capture_pointer(s, p->pCommandBufferDeviceMasks, (size_t)(p->commandBufferCount), sizeof(uint32_t));
+	capture_pointer(s, p->pSignalSemaphoreDeviceIndices, (size_t)(p->signalSemaphoreCount), sizeof(uint32_t));
+}
+
+static void replay_VkDeviceGroupSubmitInfo(vksReplay* r, vksReader* rd, VkDeviceGroupSubmitInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pWaitSemaphoreDeviceIndices = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	p->pCommandBufferDeviceMasks = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	p->pSignalSemaphoreDeviceIndices = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+}
+
+static void capture_VkDeviceGroupCommandBufferBeginInfo(vksCaptureStream* s, const VkDeviceGroupCommandBufferBeginInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkDeviceGroupCommandBufferBeginInfo(vksReplay* r, vksReader* rd, VkDeviceGroupCommandBufferBeginInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkBufferMemoryRequirementsInfo2(vksCaptureStream* s, const VkBufferMemoryRequirementsInfo2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkBufferMemoryRequirementsInfo2(vksReplay* r, vksReader* rd, VkBufferMemoryRequirementsInfo2* p) {
+	p->pNext = replay_next(r, rd);
+	p->buffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)p->buffer);
+}
+
+static void capture_VkImageMemoryRequirementsInfo2(vksCaptureStream* s, const VkImageMemoryRequirementsInfo2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkImageMemoryRequirementsInfo2(vksReplay* r, vksReader* rd, VkImageMemoryRequirementsInfo2* p) {
+	p->pNext = replay_next(r, rd);
+	p->image = (VkImage)replay_map(r, (uint64_t)(uintptr_t)p->image);
+}
+
+static void capture_VkImageSparseMemoryRequirementsInfo2(vksCaptureStream* s, const VkImageSparseMemoryRequirementsInfo2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkImageSparseMemoryRequirementsInfo2(vksReplay* r, vksReader* rd, VkImageSparseMemoryRequirementsInfo2* p) {
+	p->pNext = replay_next(r, rd);
+	p->image = (VkImage)replay_map(r, (uint64_t)(uintptr_t)p->image);
+}
+
+static void capture_VkMemoryRequirements2(vksCaptureStream* s, const VkMemoryRequirements2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkMemoryRequirements2(vksReplay* r, vksReader* rd, VkMemoryRequirements2* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkSparseImageMemoryRequirements2(vksCaptureStream* s, const VkSparseImageMemoryRequirements2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkSparseImageMemoryRequirements2(vksReplay* r, vksReader* rd, VkSparseImageMemoryRequirements2* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkBindImageMemoryInfo(vksCaptureStream* s, const VkBindImageMemoryInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkBindImageMemoryInfo(vksReplay* r, vksReader* rd, VkBindImageMemoryInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->image = (VkImage)replay_map(r, (uint64_t)(uintptr_t)p->image);
+	p->memory = (VkDeviceMemory)replay_map(r, (uint64_t)(uintptr_t)p->memory);
+}
+
+static void capture_VkPhysicalDeviceExternalBufferInfo(vksCaptureStream* s, const VkPhysicalDeviceExternalBufferInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceExternalBufferInfo(vksReplay* r, vksReader* rd, VkPhysicalDeviceExternalBufferInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceSamplerYcbcrConversionFeatures(vksCaptureStream* s, const VkPhysicalDeviceSamplerYcbcrConversionFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceSamplerYcbcrConversionFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceSamplerYcbcrConversionFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkImagePlaneMemoryRequirementsInfo(vksCaptureStream* s, const VkImagePlaneMemoryRequirementsInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkImagePlaneMemoryRequirementsInfo(vksReplay* r, vksReader* rd, VkImagePlaneMemoryRequirementsInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkBindImagePlaneMemoryInfo(vksCaptureStream* s, const VkBindImagePlaneMemoryInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkBindImagePlaneMemoryInfo(vksReplay* r, vksReader* rd, VkBindImagePlaneMemoryInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkExternalSemaphoreProperties(vksCaptureStream* s, const VkExternalSemaphoreProperties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkExternalSemaphoreProperties(vksReplay* r, vksReader* rd, VkExternalSemaphoreProperties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceExternalSemaphoreInfo(vksCaptureStream* s, const VkPhysicalDeviceExternalSemaphoreInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceExternalSemaphoreInfo(vksReplay* r, vksReader* rd, VkPhysicalDeviceExternalSemaphoreInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkBindBufferMemoryInfo(vksCaptureStream* s, const VkBindBufferMemoryInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkBindBufferMemoryInfo(vksReplay* r, vksReader* rd, VkBindBufferMemoryInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->buffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)p->buffer);
+	p->memory = (VkDeviceMemory)replay_map(r, (uint64_t)(uintptr_t)p->memory);
+}
+
+static void capture_VkExternalMemoryImageCreateInfo(vksCaptureStream* s, const VkExternalMemoryImageCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkExternalMemoryImageCreateInfo(vksReplay* r, vksReader* rd, VkExternalMemoryImageCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkDeviceGroupRenderPassBeginInfo(vksCaptureStream* s, const VkDeviceGroupRenderPassBeginInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pDeviceRenderAreas, (size_t)(p->deviceRenderAreaCount), sizeof(VkRect2D));
+}
+
+static void replay_VkDeviceGroupRenderPassBeginInfo(vksReplay* r, vksReader* rd, VkDeviceGroupRenderPassBeginInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pDeviceRenderAreas = replay_pointer(r, rd, sizeof(VkRect2D), NULL);
+}
+
+static void capture_VkPhysicalDeviceExternalFenceInfo(vksCaptureStream* s, const VkPhysicalDeviceExternalFenceInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceExternalFenceInfo(vksReplay* r, vksReader* rd, VkPhysicalDeviceExternalFenceInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkMemoryAllocateFlagsInfo(vksCaptureStream* s, const VkMemoryAllocateFlagsInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkMemoryAllocateFlagsInfo(vksReplay* r, vksReader* rd, VkMemoryAllocateFlagsInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceFeatures2(vksCaptureStream* s, const VkPhysicalDeviceFeatures2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceFeatures2(vksReplay* r, vksReader* rd, VkPhysicalDeviceFeatures2* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceProperties2(vksCaptureStream* s, const VkPhysicalDeviceProperties2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceProperties2(vksReplay* r, vksReader* rd, VkPhysicalDeviceProperties2* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkFormatProperties2(vksCaptureStream* s, const VkFormatProperties2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkFormatProperties2(vksReplay* r, vksReader* rd, VkFormatProperties2* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkImageFormatProperties2(vksCaptureStream* s, const VkImageFormatProperties2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkImageFormatProperties2(vksReplay* r, vksReader* rd, VkImageFormatProperties2* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceImageFormatInfo2(vksCaptureStream* s, const VkPhysicalDeviceImageFormatInfo2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceImageFormatInfo2(vksReplay* r, vksReader* rd, VkPhysicalDeviceImageFormatInfo2* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkQueueFamilyProperties2(vksCaptureStream* s, const VkQueueFamilyProperties2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkQueueFamilyProperties2(vksReplay* r, vksReader* rd, VkQueueFamilyProperties2* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceMemoryProperties2(vksCaptureStream* s, const VkPhysicalDeviceMemoryProperties2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceMemoryProperties2(vksReplay* r, vksReader* rd, VkPhysicalDeviceMemoryProperties2* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkSparseImageFormatProperties2(vksCaptureStream* s, const VkSparseImageFormatProperties2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkSparseImageFormatProperties2(vksReplay* r, vksReader* rd, VkSparseImageFormatProperties2* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceSparseImageFormatInfo2(vksCaptureStream* s, const VkPhysicalDeviceSparseImageFormatInfo2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceSparseImageFormatInfo2(vksReplay* r, vksReader* rd, VkPhysicalDeviceSparseImageFormatInfo2* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkSamplerYcbcrConversionInfo(vksCaptureStream* s, const VkSamplerYcbcrConversionInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkSamplerYcbcrConversionInfo(vksReplay* r, vksReader* rd, VkSamplerYcbcrConversionInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->conversion = (VkSamplerYcbcrConversion)replay_map(r, (uint64_t)(uintptr_t)p->conversion);
+}
+
+static void capture_VkSamplerYcbcrConversionCreateInfo(vksCaptureStream* s, const VkSamplerYcbcrConversionCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkSamplerYcbcrConversionCreateInfo(vksReplay* r, vksReader* rd, VkSamplerYcbcrConversionCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkRenderPassMultiviewCreateInfo(vksCaptureStream* s, const VkRenderPassMultiviewCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pViewMasks, (size_t)(p->subpassCount), sizeof(uint32_t));
+	capture_pointer(s, p->pViewOffsets, (size_t)(p->dependencyCount), sizeof(int32_t));
+	capture_pointer(s, p->pCorrelationMasks, (size_t)(p->correlationMaskCount), sizeof(uint32_t));
+}
+
+static void replay_VkRenderPassMultiviewCreateInfo(vksReplay* r, vksReader* rd, VkRenderPassMultiviewCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pViewMasks = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	p->pViewOffsets = replay_pointer(r, rd, sizeof(int32_t), NULL);
+	p->pCorrelationMasks = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+}
+
+static void capture_VkProtectedSubmitInfo(vksCaptureStream* s, const VkProtectedSubmitInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkProtectedSubmitInfo(vksReplay* r, vksReader* rd, VkProtectedSubmitInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkDeviceQueueInfo2(vksCaptureStream* s, const VkDeviceQueueInfo2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkDeviceQueueInfo2(vksReplay* r, vksReader* rd, VkDeviceQueueInfo2* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceVariablePointersFeatures(vksCaptureStream* s, const VkPhysicalDeviceVariablePointersFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceVariablePointersFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceVariablePointersFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceProtectedMemoryFeatures(vksCaptureStream* s, const VkPhysicalDeviceProtectedMemoryFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceProtectedMemoryFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceProtectedMemoryFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkExportSemaphoreCreateInfo(vksCaptureStream* s, const VkExportSemaphoreCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkExportSemaphoreCreateInfo(vksReplay* r, vksReader* rd, VkExportSemaphoreCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceIDProperties(vksCaptureStream* s, const VkPhysicalDeviceIDProperties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceIDProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceIDProperties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkExternalBufferProperties(vksCaptureStream* s, const VkExternalBufferProperties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkExternalBufferProperties(vksReplay* r, vksReader* rd, VkExternalBufferProperties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceProtectedMemoryProperties(vksCaptureStream* s, const VkPhysicalDeviceProtectedMemoryProperties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceProtectedMemoryProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceProtectedMemoryProperties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceMultiviewProperties(vksCaptureStream* s, const VkPhysicalDeviceMultiviewProperties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceMultiviewProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceMultiviewProperties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceMultiviewFeatures(vksCaptureStream* s, const VkPhysicalDeviceMultiviewFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceMultiviewFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceMultiviewFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDevicePointClippingProperties(vksCaptureStream* s, const VkPhysicalDevicePointClippingProperties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDevicePointClippingProperties(vksReplay* r, vksReader* rd, VkPhysicalDevicePointClippingProperties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceSubgroupProperties(vksCaptureStream* s, const VkPhysicalDeviceSubgroupProperties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceSubgroupProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceSubgroupProperties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkRenderPassInputAttachmentAspectCreateInfo(vksCaptureStream* s, const VkRenderPassInputAttachmentAspectCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pAspectReferences, (size_t)(p->aspectReferenceCount), sizeof(VkInputAttachmentAspectReference));
+}
+
+static void replay_VkRenderPassInputAttachmentAspectCreateInfo(vksReplay* r, vksReader* rd, VkRenderPassInputAttachmentAspectCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pAspectReferences = replay_pointer(r, rd, sizeof(VkInputAttachmentAspectReference), NULL);
+}
+
+static void capture_VkImageViewUsageCreateInfo(vksCaptureStream* s, const VkImageViewUsageCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkImageViewUsageCreateInfo(vksReplay* r, vksReader* rd, VkImageViewUsageCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkExternalFenceProperties(vksCaptureStream* s, const VkExternalFenceProperties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkExternalFenceProperties(vksReplay* r, vksReader* rd, VkExternalFenceProperties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPipelineTessellationDomainOriginStateCreateInfo(vksCaptureStream* s, const VkPipelineTessellationDomainOriginStateCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPipelineTessellationDomainOriginStateCreateInfo(vksReplay* r, vksReader* rd, VkPipelineTessellationDomainOriginStateCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures(vksCaptureStream* s, const VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceDriverProperties(vksCaptureStream* s, const VkPhysicalDeviceDriverProperties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceDriverProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceDriverProperties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkSemaphoreSignalInfo(vksCaptureStream* s, const VkSemaphoreSignalInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkSemaphoreSignalInfo(vksReplay* r, vksReader* rd, VkSemaphoreSignalInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->semaphore = (VkSemaphore)replay_map(r, (uint64_t)(uintptr_t)p->semaphore);
+}
+
+static void capture_VkPhysicalDeviceBufferDeviceAddressFeatures(vksCaptureStream* s, const VkPhysicalDeviceBufferDeviceAddressFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceBufferDeviceAddressFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceBufferDeviceAddressFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkTimelineSemaphoreSubmitInfo(vksCaptureStream* s, const VkTimelineSemaphoreSubmitInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pWaitSemaphoreValues, (size_t)(p->waitSemaphoreValueCount), sizeof(uint64_t));
+	capture_pointer(s, p->pSignalSemaphoreValues, (size_t)(p->signalSemaphoreValueCount), sizeof(uint64_t));
+}
+
+static void replay_VkTimelineSemaphoreSubmitInfo(vksReplay* r, vksReader* rd, VkTimelineSemaphoreSubmitInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pWaitSemaphoreValues = replay_pointer(r, rd, sizeof(uint64_t), NULL);
+	p->pSignalSemaphoreValues = replay_pointer(r, rd, sizeof(uint64_t), NULL);
+}
+
+static void capture_VkSemaphoreTypeCreateInfo(vksCaptureStream* s, const VkSemaphoreTypeCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkSemaphoreTypeCreateInfo(vksReplay* r, vksReader* rd, VkSemaphoreTypeCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceTimelineSemaphoreProperties(vksCaptureStream* s, const VkPhysicalDeviceTimelineSemaphoreProperties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceTimelineSemaphoreProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceTimelineSemaphoreProperties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkSubpassDependency2(vksCaptureStream* s, const VkSubpassDependency2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkSubpassDependency2(vksReplay* r, vksReader* rd, VkSubpassDependency2* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkAttachmentReference2(vksCaptureStream* s, const VkAttachmentReference2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkAttachmentReference2(vksReplay* r, vksReader* rd, VkAttachmentReference2* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkSubpassDescription2(vksCaptureStream* s, const VkSubpassDescription2* p) {
+	capture_next(s, p->pNext);
+	if (capture_pointer(s, p->pInputAttachments, (size_t)(p->inputAttachmentCount), sizeof(VkAttachmentReference2))) {
+		for (size_t i = 0; i < (size_t)(p->inputAttachmentCount); i++) {
+			capture_VkAttachmentReference2(s, &p->pInputAttachments[i]);
+		}
+	}
+	if (capture_pointer(s, p->pColorAttachments, (size_t)(p->colorAttachmentCount), sizeof(VkAttachmentReference2))) {
+		for (size_t i = 0; i < (size_t)(p->colorAttachmentCount); i++) {
+			capture_VkAttachmentReference2(s, &p->pColorAttachments[i]);
+		}
+	}
+	if (capture_pointer(s, p->pResolveAttachments, (size_t)(p->colorAttachmentCount), sizeof(VkAttachmentReference2))) {
+		for (size_t i = 0; i < (size_t)(p->colorAttachmentCount); i++) {
+			capture_VkAttachmentReference2(s, &p->pResolveAttachments[i]);
+		}
+	}
+	if (capture_pointer(s, p->pDepthStencilAttachment, (size_t)(1), sizeof(VkAttachmentReference2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkAttachmentReference2(s, &p->pDepthStencilAttachment[i]);
+		}
+	}
+	capture_pointer(s, p->pPreserveAttachments, (size_t)(p->preserveAttachmentCount), sizeof(uint32_t));
+}
+
+static void replay_VkSubpassDescription2(vksReplay* r, vksReader* rd, VkSubpassDescription2* p) {
+	p->pNext = replay_next(r, rd);
+	{
+		size_t n;
+		VkAttachmentReference2* v = replay_pointer(r, rd, sizeof(VkAttachmentReference2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkAttachmentReference2(r, rd, &v[i]);
+		}
+		p->pInputAttachments = v;
+	}
+	{
+		size_t n;
+		VkAttachmentReference2* v = replay_pointer(r, rd, sizeof(VkAttachmentReference2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkAttachmentReference2(r, rd, &v[i]);
+		}
+		p->pColorAttachments = v;
+	}
+	{
+		size_t n;
+		VkAttachmentReference2* v = replay_pointer(r, rd, sizeof(VkAttachmentReference2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkAttachmentReference2(r, rd, &v[i]);
+		}
+		p->pResolveAttachments = v;
+	}
+	{
+		size_t n;
+		VkAttachmentReference2* v = replay_pointer(r, rd, sizeof(VkAttachmentReference2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkAttachmentReference2(r, rd, &v[i]);
+		}
+		p->pDepthStencilAttachment = v;
+	}
+	p->pPreserveAttachments = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+}
+
+static void capture_VkAttachmentDescription2(vksCaptureStream* s, const VkAttachmentDescription2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkAttachmentDescription2(vksReplay* r, vksReader* rd, VkAttachmentDescription2* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkRenderPassCreateInfo2(vksCaptureStream* s, const VkRenderPassCreateInfo2* p) {
+	capture_next(s, p->pNext);
+	if (capture_pointer(s, p->pAttachments, (size_t)(p->attachmentCount), sizeof(VkAttachmentDescription2))) {
+		for (size_t i = 0; i < (size_t)(p->attachmentCount); i++) {
+			capture_VkAttachmentDescription2(s, &p->pAttachments[i]);
+		}
+	}
+	if (capture_pointer(s, p->pSubpasses, (size_t)(p->subpassCount), sizeof(VkSubpassDescription2))) {
+		for (size_t i = 0; i < (size_t)(p->subpassCount); i++) {
+			capture_VkSubpassDescription2(s, &p->pSubpasses[i]);
+		}
+	}
+	if (capture_pointer(s, p->pDependencies, (size_t)(p->dependencyCount), sizeof(VkSubpassDependency2))) {
+		for (size_t i = 0; i < (size_t)(p->dependencyCount); i++) {
+			capture_VkSubpassDependency2(s, &p->pDependencies[i]);
+		}
+	}
+	capture_pointer(s, p->pCorrelatedViewMasks, (size_t)(p->correlatedViewMaskCount), sizeof(uint32_t));
+}
+
+static void replay_VkRenderPassCreateInfo2(vksReplay* r, vksReader* rd, VkRenderPassCreateInfo2* p) {
+	p->pNext = replay_next(r, rd);
+	{
+		size_t n;
+		VkAttachmentDescription2* v = replay_pointer(r, rd, sizeof(VkAttachmentDescription2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkAttachmentDescription2(r, rd, &v[i]);
+		}
+		p->pAttachments = v;
+	}
+	{
+		size_t n;
+		VkSubpassDescription2* v = replay_pointer(r, rd, sizeof(VkSubpassDescription2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSubpassDescription2(r, rd, &v[i]);
+		}
+		p->pSubpasses = v;
+	}
+	{
+		size_t n;
+		VkSubpassDependency2* v = replay_pointer(r, rd, sizeof(VkSubpassDependency2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSubpassDependency2(r, rd, &v[i]);
+		}
+		p->pDependencies = v;
+	}
+	p->pCorrelatedViewMasks = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+}
+
+static void capture_VkSubpassBeginInfo(vksCaptureStream* s, const VkSubpassBeginInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkSubpassBeginInfo(vksReplay* r, vksReader* rd, VkSubpassBeginInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkSubpassEndInfo(vksCaptureStream* s, const VkSubpassEndInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkSubpassEndInfo(vksReplay* r, vksReader* rd, VkSubpassEndInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceTimelineSemaphoreFeatures(vksCaptureStream* s, const VkPhysicalDeviceTimelineSemaphoreFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceTimelineSemaphoreFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceTimelineSemaphoreFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkImageFormatListCreateInfo(vksCaptureStream* s, const VkImageFormatListCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pViewFormats, (size_t)(p->viewFormatCount), sizeof(VkFormat));
+}
+
+static void replay_VkImageFormatListCreateInfo(vksReplay* r, vksReader* rd, VkImageFormatListCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pViewFormats = replay_pointer(r, rd, sizeof(VkFormat), NULL);
+}
+
+static void capture_VkPhysicalDeviceHostQueryResetFeatures(vksCaptureStream* s, const VkPhysicalDeviceHostQueryResetFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceHostQueryResetFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceHostQueryResetFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkAttachmentDescriptionStencilLayout(vksCaptureStream* s, const VkAttachmentDescriptionStencilLayout* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkAttachmentDescriptionStencilLayout(vksReplay* r, vksReader* rd, VkAttachmentDescriptionStencilLayout* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkAttachmentReferenceStencilLayout(vksCaptureStream* s, const VkAttachmentReferenceStencilLayout* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkAttachmentReferenceStencilLayout(vksReplay* r, vksReader* rd, VkAttachmentReferenceStencilLayout* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkSubpassDescriptionDepthStencilResolve(vksCaptureStream* s, const VkSubpassDescriptionDepthStencilResolve* p) {
+	capture_next(s, p->pNext);
+	if (capture_pointer(s, p->pDepthStencilResolveAttachment, (size_t)(1), sizeof(VkAttachmentReference2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkAttachmentReference2(s, &p->pDepthStencilResolveAttachment[i]);
+		}
+	}
+}
+
+static void replay_VkSubpassDescriptionDepthStencilResolve(vksReplay* r, vksReader* rd, VkSubpassDescriptionDepthStencilResolve* p) {
+	p->pNext = replay_next(r, rd);
+	{
+		size_t n;
+		VkAttachmentReference2* v = replay_pointer(r, rd, sizeof(VkAttachmentReference2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkAttachmentReference2(r, rd, &v[i]);
+		}
+		p->pDepthStencilResolveAttachment = v;
+	}
+}
+
+static void capture_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures(vksCaptureStream* s, const VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDevice8BitStorageFeatures(vksCaptureStream* s, const VkPhysicalDevice8BitStorageFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDevice8BitStorageFeatures(vksReplay* r, vksReader* rd, VkPhysicalDevice8BitStorageFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceUniformBufferStandardLayoutFeatures(vksCaptureStream* s, const VkPhysicalDeviceUniformBufferStandardLayoutFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceUniformBufferStandardLayoutFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceUniformBufferStandardLayoutFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkBufferDeviceAddressInfo(vksCaptureStream* s, const VkBufferDeviceAddressInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkBufferDeviceAddressInfo(vksReplay* r, vksReader* rd, VkBufferDeviceAddressInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->buffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)p->buffer);
+}
+
+static void capture_VkSemaphoreWaitInfo(vksCaptureStream* s, const VkSemaphoreWaitInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pSemaphores, (size_t)(p->semaphoreCount), sizeof(VkSemaphore));
+	capture_pointer(s, p->pValues, (size_t)(p->semaphoreCount), sizeof(uint64_t));
+}
+
+static void replay_VkSemaphoreWaitInfo(vksReplay* r, vksReader* rd, VkSemaphoreWaitInfo* p) {
+	p->pNext = replay_next(r, rd);
+	{
+		size_t n;
+		VkSemaphore* v = replay_pointer(r, rd, sizeof(VkSemaphore), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkSemaphore)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		p->pSemaphores = v;
+	}
+	p->pValues = replay_pointer(r, rd, sizeof(uint64_t), NULL);
+}
+
+static void capture_VkRenderPassAttachmentBeginInfo(vksCaptureStream* s, const VkRenderPassAttachmentBeginInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pAttachments, (size_t)(p->attachmentCount), sizeof(VkImageView));
+}
+
+static void replay_VkRenderPassAttachmentBeginInfo(vksReplay* r, vksReader* rd, VkRenderPassAttachmentBeginInfo* p) {
+	p->pNext = replay_next(r, rd);
+	{
+		size_t n;
+		VkImageView* v = replay_pointer(r, rd, sizeof(VkImageView), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkImageView)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		p->pAttachments = v;
+	}
+}
+
+static void capture_VkFramebufferAttachmentImageInfo(vksCaptureStream* s, const VkFramebufferAttachmentImageInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pViewFormats, (size_t)(p->viewFormatCount), sizeof(VkFormat));
+}
+
+static void replay_VkFramebufferAttachmentImageInfo(vksReplay* r, vksReader* rd, VkFramebufferAttachmentImageInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pViewFormats = replay_pointer(r, rd, sizeof(VkFormat), NULL);
+}
+
+static void capture_VkFramebufferAttachmentsCreateInfo(vksCaptureStream* s, const VkFramebufferAttachmentsCreateInfo* p) {
+	capture_next(s, p->pNext);
+	if (capture_pointer(s, p->pAttachmentImageInfos, (size_t)(p->attachmentImageInfoCount), sizeof(VkFramebufferAttachmentImageInfo))) {
+		for (size_t i = 0; i < (size_t)(p->attachmentImageInfoCount); i++) {
+			capture_VkFramebufferAttachmentImageInfo(s, &p->pAttachmentImageInfos[i]);
+		}
+	}
+}
+
+static void replay_VkFramebufferAttachmentsCreateInfo(vksReplay* r, vksReader* rd, VkFramebufferAttachmentsCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	{
+		size_t n;
+		VkFramebufferAttachmentImageInfo* v = replay_pointer(r, rd, sizeof(VkFramebufferAttachmentImageInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkFramebufferAttachmentImageInfo(r, rd, &v[i]);
+		}
+		p->pAttachmentImageInfos = v;
+	}
+}
+
+static void capture_VkPhysicalDeviceShaderAtomicInt64Features(vksCaptureStream* s, const VkPhysicalDeviceShaderAtomicInt64Features* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceShaderAtomicInt64Features(vksReplay* r, vksReader* rd, VkPhysicalDeviceShaderAtomicInt64Features* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceImagelessFramebufferFeatures(vksCaptureStream* s, const VkPhysicalDeviceImagelessFramebufferFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceImagelessFramebufferFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceImagelessFramebufferFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceShaderFloat16Int8Features(vksCaptureStream* s, const VkPhysicalDeviceShaderFloat16Int8Features* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceShaderFloat16Int8Features(vksReplay* r, vksReader* rd, VkPhysicalDeviceShaderFloat16Int8Features* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceVulkanMemoryModelFeatures(vksCaptureStream* s, const VkPhysicalDeviceVulkanMemoryModelFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceVulkanMemoryModelFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceVulkanMemoryModelFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceFloatControlsProperties(vksCaptureStream* s, const VkPhysicalDeviceFloatControlsProperties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceFloatControlsProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceFloatControlsProperties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkBufferOpaqueCaptureAddressCreateInfo(vksCaptureStream* s, const VkBufferOpaqueCaptureAddressCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkBufferOpaqueCaptureAddressCreateInfo(vksReplay* r, vksReader* rd, VkBufferOpaqueCaptureAddressCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceSamplerFilterMinmaxProperties(vksCaptureStream* s, const VkPhysicalDeviceSamplerFilterMinmaxProperties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceSamplerFilterMinmaxProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceSamplerFilterMinmaxProperties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkDescriptorSetLayoutBindingFlagsCreateInfo(vksCaptureStream* s, const VkDescriptorSetLayoutBindingFlagsCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pBindingFlags, (size_t)(p->bindingCount), sizeof(VkDescriptorBindingFlags));
+}
+
+static void replay_VkDescriptorSetLayoutBindingFlagsCreateInfo(vksReplay* r, vksReader* rd, VkDescriptorSetLayoutBindingFlagsCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pBindingFlags = replay_pointer(r, rd, sizeof(VkDescriptorBindingFlags), NULL);
+}
+
+static void capture_VkPhysicalDeviceDescriptorIndexingFeatures(vksCaptureStream* s, const VkPhysicalDeviceDescriptorIndexingFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceDescriptorIndexingFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceDescriptorIndexingFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceDescriptorIndexingProperties(vksCaptureStream* s, const VkPhysicalDeviceDescriptorIndexingProperties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceDescriptorIndexingProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceDescriptorIndexingProperties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkDescriptorSetVariableDescriptorCountAllocateInfo(vksCaptureStream* s, const VkDescriptorSetVariableDescriptorCountAllocateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pDescriptorCounts, (size_t)(p->descriptorSetCount), sizeof(uint32_t));
+}
+
+static void replay_VkDescriptorSetVariableDescriptorCountAllocateInfo(vksReplay* r, vksReader* rd, VkDescriptorSetVariableDescriptorCountAllocateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pDescriptorCounts = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+}
+
+static void capture_VkDescriptorSetVariableDescriptorCountLayoutSupport(vksCaptureStream* s, const VkDescriptorSetVariableDescriptorCountLayoutSupport* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkDescriptorSetVariableDescriptorCountLayoutSupport(vksReplay* r, vksReader* rd, VkDescriptorSetVariableDescriptorCountLayoutSupport* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkMemoryOpaqueCaptureAddressAllocateInfo(vksCaptureStream* s, const VkMemoryOpaqueCaptureAddressAllocateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkMemoryOpaqueCaptureAddressAllocateInfo(vksReplay* r, vksReader* rd, VkMemoryOpaqueCaptureAddressAllocateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkDeviceMemoryOpaqueCaptureAddressInfo(vksCaptureStream* s, const VkDeviceMemoryOpaqueCaptureAddressInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkDeviceMemoryOpaqueCaptureAddressInfo(vksReplay* r, vksReader* rd, VkDeviceMemoryOpaqueCaptureAddressInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->memory = (VkDeviceMemory)replay_map(r, (uint64_t)(uintptr_t)p->memory);
+}
+
+static void capture_VkSamplerReductionModeCreateInfo(vksCaptureStream* s, const VkSamplerReductionModeCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkSamplerReductionModeCreateInfo(vksReplay* r, vksReader* rd, VkSamplerReductionModeCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceVulkan12Properties(vksCaptureStream* s, const VkPhysicalDeviceVulkan12Properties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceVulkan12Properties(vksReplay* r, vksReader* rd, VkPhysicalDeviceVulkan12Properties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkImageStencilUsageCreateInfo(vksCaptureStream* s, const VkImageStencilUsageCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkImageStencilUsageCreateInfo(vksReplay* r, vksReader* rd, VkImageStencilUsageCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceVulkan12Features(vksCaptureStream* s, const VkPhysicalDeviceVulkan12Features* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceVulkan12Features(vksReplay* r, vksReader* rd, VkPhysicalDeviceVulkan12Features* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceScalarBlockLayoutFeatures(vksCaptureStream* s, const VkPhysicalDeviceScalarBlockLayoutFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceScalarBlockLayoutFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceScalarBlockLayoutFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceVulkan11Properties(vksCaptureStream* s, const VkPhysicalDeviceVulkan11Properties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceVulkan11Properties(vksReplay* r, vksReader* rd, VkPhysicalDeviceVulkan11Properties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceVulkan11Features(vksCaptureStream* s, const VkPhysicalDeviceVulkan11Features* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceVulkan11Features(vksReplay* r, vksReader* rd, VkPhysicalDeviceVulkan11Features* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceDepthStencilResolveProperties(vksCaptureStream* s, const VkPhysicalDeviceDepthStencilResolveProperties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceDepthStencilResolveProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceDepthStencilResolveProperties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceSubgroupSizeControlProperties(vksCaptureStream* s, const VkPhysicalDeviceSubgroupSizeControlProperties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceSubgroupSizeControlProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceSubgroupSizeControlProperties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceInlineUniformBlockFeatures(vksCaptureStream* s, const VkPhysicalDeviceInlineUniformBlockFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceInlineUniformBlockFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceInlineUniformBlockFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkWriteDescriptorSetInlineUniformBlock(vksCaptureStream* s, const VkWriteDescriptorSetInlineUniformBlock* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pData, (size_t)(p->dataSize), sizeof(uint8_t));
+}
+
+static void replay_VkWriteDescriptorSetInlineUniformBlock(vksReplay* r, vksReader* rd, VkWriteDescriptorSetInlineUniformBlock* p) {
+	p->pNext = replay_next(r, rd);
+	p->pData = replay_pointer(r, rd, sizeof(uint8_t), NULL);
+}
+
+static void capture_VkDeviceBufferMemoryRequirements(vksCaptureStream* s, const VkDeviceBufferMemoryRequirements* p) {
+	capture_next(s, p->pNext);
+	if (capture_pointer(s, p->pCreateInfo, (size_t)(1), sizeof(VkBufferCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkBufferCreateInfo(s, &p->pCreateInfo[i]);
+		}
+	}
+}
+
+static void replay_VkDeviceBufferMemoryRequirements(vksReplay* r, vksReader* rd, VkDeviceBufferMemoryRequirements* p) {
+	p->pNext = replay_next(r, rd);
+	{
+		size_t n;
+		VkBufferCreateInfo* v = replay_pointer(r, rd, sizeof(VkBufferCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkBufferCreateInfo(r, rd, &v[i]);
+		}
+		p->pCreateInfo = v;
+	}
+}
+
+static void capture_VkPhysicalDeviceMaintenance4Properties(vksCaptureStream* s, const VkPhysicalDeviceMaintenance4Properties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceMaintenance4Properties(vksReplay* r, vksReader* rd, VkPhysicalDeviceMaintenance4Properties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceMaintenance4Features(vksCaptureStream* s, const VkPhysicalDeviceMaintenance4Features* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceMaintenance4Features(vksReplay* r, vksReader* rd, VkPhysicalDeviceMaintenance4Features* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDevicePrivateDataFeatures(vksCaptureStream* s, const VkPhysicalDevicePrivateDataFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDevicePrivateDataFeatures(vksReplay* r, vksReader* rd, VkPhysicalDevicePrivateDataFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkDevicePrivateDataCreateInfo(vksCaptureStream* s, const VkDevicePrivateDataCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkDevicePrivateDataCreateInfo(vksReplay* r, vksReader* rd, VkDevicePrivateDataCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPrivateDataSlotCreateInfo(vksCaptureStream* s, const VkPrivateDataSlotCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPrivateDataSlotCreateInfo(vksReplay* r, vksReader* rd, VkPrivateDataSlotCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures(vksCaptureStream* s, const VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkFormatProperties3(vksCaptureStream* s, const VkFormatProperties3* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkFormatProperties3(vksReplay* r, vksReader* rd, VkFormatProperties3* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceVulkan13Features(vksCaptureStream* s, const VkPhysicalDeviceVulkan13Features* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceVulkan13Features(vksReplay* r, vksReader* rd, VkPhysicalDeviceVulkan13Features* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceVulkan13Properties(vksCaptureStream* s, const VkPhysicalDeviceVulkan13Properties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceVulkan13Properties(vksReplay* r, vksReader* rd, VkPhysicalDeviceVulkan13Properties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceTexelBufferAlignmentProperties(vksCaptureStream* s, const VkPhysicalDeviceTexelBufferAlignmentProperties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceTexelBufferAlignmentProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceTexelBufferAlignmentProperties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceShaderIntegerDotProductProperties(vksCaptureStream* s, const VkPhysicalDeviceShaderIntegerDotProductProperties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceShaderIntegerDotProductProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceShaderIntegerDotProductProperties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDevicePipelineCreationCacheControlFeatures(vksCaptureStream* s, const VkPhysicalDevicePipelineCreationCacheControlFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDevicePipelineCreationCacheControlFeatures(vksReplay* r, vksReader* rd, VkPhysicalDevicePipelineCreationCacheControlFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceShaderIntegerDotProductFeatures(vksCaptureStream* s, const VkPhysicalDeviceShaderIntegerDotProductFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceShaderIntegerDotProductFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceShaderIntegerDotProductFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkCommandBufferInheritanceRenderingInfo(vksCaptureStream* s, const VkCommandBufferInheritanceRenderingInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pColorAttachmentFormats, (size_t)(p->colorAttachmentCount), sizeof(VkFormat));
+}
+
+static void replay_VkCommandBufferInheritanceRenderingInfo(vksReplay* r, vksReader* rd, VkCommandBufferInheritanceRenderingInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pColorAttachmentFormats = replay_pointer(r, rd, sizeof(VkFormat), NULL);
+}
+
+static void capture_VkPhysicalDeviceDynamicRenderingFeatures(vksCaptureStream* s, const VkPhysicalDeviceDynamicRenderingFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceDynamicRenderingFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceDynamicRenderingFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPipelineRenderingCreateInfo(vksCaptureStream* s, const VkPipelineRenderingCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pColorAttachmentFormats, (size_t)(p->colorAttachmentCount), sizeof(VkFormat));
+}
+
+static void replay_VkPipelineRenderingCreateInfo(vksReplay* r, vksReader* rd, VkPipelineRenderingCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pColorAttachmentFormats = replay_pointer(r, rd, sizeof(VkFormat), NULL);
+}
+
+static void capture_VkRenderingAttachmentInfo(vksCaptureStream* s, const VkRenderingAttachmentInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkRenderingAttachmentInfo(vksReplay* r, vksReader* rd, VkRenderingAttachmentInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->imageView = (VkImageView)replay_map(r, (uint64_t)(uintptr_t)p->imageView);
+	p->resolveImageView = (VkImageView)replay_map(r, (uint64_t)(uintptr_t)p->resolveImageView);
+}
+
+static void capture_VkRenderingInfo(vksCaptureStream* s, const VkRenderingInfo* p) {
+	capture_next(s, p->pNext);
+	if (capture_pointer(s, p->pColorAttachments, (size_t)(p->colorAttachmentCount), sizeof(VkRenderingAttachmentInfo))) {
+		for (size_t i = 0; i < (size_t)(p->colorAttachmentCount); i++) {
+			capture_VkRenderingAttachmentInfo(s, &p->pColorAttachments[i]);
+		}
+	}
+	if (capture_pointer(s, p->pDepthAttachment, (size_t)(1), sizeof(VkRenderingAttachmentInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkRenderingAttachmentInfo(s, &p->pDepthAttachment[i]);
+		}
+	}
+	if (capture_pointer(s, p->pStencilAttachment, (size_t)(1), sizeof(VkRenderingAttachmentInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkRenderingAttachmentInfo(s, &p->pStencilAttachment[i]);
+		}
+	}
+}
+
+static void replay_VkRenderingInfo(vksReplay* r, vksReader* rd, VkRenderingInfo* p) {
+	p->pNext = replay_next(r, rd);
+	{
+		size_t n;
+		VkRenderingAttachmentInfo* v = replay_pointer(r, rd, sizeof(VkRenderingAttachmentInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkRenderingAttachmentInfo(r, rd, &v[i]);
+		}
+		p->pColorAttachments = v;
+	}
+	{
+		size_t n;
+		VkRenderingAttachmentInfo* v = replay_pointer(r, rd, sizeof(VkRenderingAttachmentInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkRenderingAttachmentInfo(r, rd, &v[i]);
+		}
+		p->pDepthAttachment = v;
+	}
+	{
+		size_t n;
+		VkRenderingAttachmentInfo* v = replay_pointer(r, rd, sizeof(VkRenderingAttachmentInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkRenderingAttachmentInfo(r, rd, &v[i]);
+		}
+		p->pStencilAttachment = v;
+	}
+}
+
+static void capture_VkPhysicalDeviceTextureCompressionASTCHDRFeatures(vksCaptureStream* s, const VkPhysicalDeviceTextureCompressionASTCHDRFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceTextureCompressionASTCHDRFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceTextureCompressionASTCHDRFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceInlineUniformBlockProperties(vksCaptureStream* s, const VkPhysicalDeviceInlineUniformBlockProperties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceInlineUniformBlockProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceInlineUniformBlockProperties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkDescriptorPoolInlineUniformBlockCreateInfo(vksCaptureStream* s, const VkDescriptorPoolInlineUniformBlockCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkDescriptorPoolInlineUniformBlockCreateInfo(vksReplay* r, vksReader* rd, VkDescriptorPoolInlineUniformBlockCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkDeviceImageMemoryRequirements(vksCaptureStream* s, const VkDeviceImageMemoryRequirements* p) {
+	capture_next(s, p->pNext);
+	if (capture_pointer(s, p->pCreateInfo, (size_t)(1), sizeof(VkImageCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkImageCreateInfo(s, &p->pCreateInfo[i]);
+		}
+	}
+}
+
+static void replay_VkDeviceImageMemoryRequirements(vksReplay* r, vksReader* rd, VkDeviceImageMemoryRequirements* p) {
+	p->pNext = replay_next(r, rd);
+	{
+		size_t n;
+		VkImageCreateInfo* v = replay_pointer(r, rd, sizeof(VkImageCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkImageCreateInfo(r, rd, &v[i]);
+		}
+		p->pCreateInfo = v;
+	}
+}
+
+static void capture_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo(vksCaptureStream* s, const VkPipelineShaderStageRequiredSubgroupSizeCreateInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo(vksReplay* r, vksReader* rd, VkPipelineShaderStageRequiredSubgroupSizeCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceToolProperties(vksCaptureStream* s, const VkPhysicalDeviceToolProperties* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceToolProperties(vksReplay* r, vksReader* rd, VkPhysicalDeviceToolProperties* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPipelineCreationFeedbackCreateInfo(vksCaptureStream* s, const VkPipelineCreationFeedbackCreateInfo* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pPipelineCreationFeedback, (size_t)(1), sizeof(VkPipelineCreationFeedback));
+	capture_pointer(s, p->pPipelineStageCreationFeedbacks, (size_t)(p->pipelineStageCreationFeedbackCount), sizeof(VkPipelineCreationFeedback));
+}
+
+static void replay_VkPipelineCreationFeedbackCreateInfo(vksReplay* r, vksReader* rd, VkPipelineCreationFeedbackCreateInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->pPipelineCreationFeedback = replay_pointer(r, rd, sizeof(VkPipelineCreationFeedback), NULL);
+	p->pPipelineStageCreationFeedbacks = replay_pointer(r, rd, sizeof(VkPipelineCreationFeedback), NULL);
+}
+
+static void capture_VkPhysicalDeviceSubgroupSizeControlFeatures(vksCaptureStream* s, const VkPhysicalDeviceSubgroupSizeControlFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceSubgroupSizeControlFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceSubgroupSizeControlFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceShaderTerminateInvocationFeatures(vksCaptureStream* s, const VkPhysicalDeviceShaderTerminateInvocationFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceShaderTerminateInvocationFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceShaderTerminateInvocationFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkMemoryBarrier2(vksCaptureStream* s, const VkMemoryBarrier2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkMemoryBarrier2(vksReplay* r, vksReader* rd, VkMemoryBarrier2* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkBufferMemoryBarrier2(vksCaptureStream* s, const VkBufferMemoryBarrier2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkBufferMemoryBarrier2(vksReplay* r, vksReader* rd, VkBufferMemoryBarrier2* p) {
+	p->pNext = replay_next(r, rd);
+	p->buffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)p->buffer);
+}
+
+static void capture_VkImageMemoryBarrier2(vksCaptureStream* s, const VkImageMemoryBarrier2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkImageMemoryBarrier2(vksReplay* r, vksReader* rd, VkImageMemoryBarrier2* p) {
+	p->pNext = replay_next(r, rd);
+	p->image = (VkImage)replay_map(r, (uint64_t)(uintptr_t)p->image);
+}
+
+static void capture_VkDependencyInfo(vksCaptureStream* s, const VkDependencyInfo* p) {
+	capture_next(s, p->pNext);
+	if (capture_pointer(s, p->pMemoryBarriers, (size_t)(p->memoryBarrierCount), sizeof(VkMemoryBarrier2))) {
+		for (size_t i = 0; i < (size_t)(p->memoryBarrierCount); i++) {
+			capture_VkMemoryBarrier2(s, &p->pMemoryBarriers[i]);
+		}
+	}
+	if (capture_pointer(s, p->pBufferMemoryBarriers, (size_t)(p->bufferMemoryBarrierCount), sizeof(VkBufferMemoryBarrier2))) {
+		for (size_t i = 0; i < (size_t)(p->bufferMemoryBarrierCount); i++) {
+			capture_VkBufferMemoryBarrier2(s, &p->pBufferMemoryBarriers[i]);
+		}
+	}
+	if (capture_pointer(s, p->pImageMemoryBarriers, (size_t)(p->imageMemoryBarrierCount), sizeof(VkImageMemoryBarrier2))) {
+		for (size_t i = 0; i < (size_t)(p->imageMemoryBarrierCount); i++) {
+			capture_VkImageMemoryBarrier2(s, &p->pImageMemoryBarriers[i]);
+		}
+	}
+}
+
+static void replay_VkDependencyInfo(vksReplay* r, vksReader* rd, VkDependencyInfo* p) {
+	p->pNext = replay_next(r, rd);
+	{
+		size_t n;
+		VkMemoryBarrier2* v = replay_pointer(r, rd, sizeof(VkMemoryBarrier2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkMemoryBarrier2(r, rd, &v[i]);
+		}
+		p->pMemoryBarriers = v;
+	}
+	{
+		size_t n;
+		VkBufferMemoryBarrier2* v = replay_pointer(r, rd, sizeof(VkBufferMemoryBarrier2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkBufferMemoryBarrier2(r, rd, &v[i]);
+		}
+		p->pBufferMemoryBarriers = v;
+	}
+	{
+		size_t n;
+		VkImageMemoryBarrier2* v = replay_pointer(r, rd, sizeof(VkImageMemoryBarrier2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkImageMemoryBarrier2(r, rd, &v[i]);
+		}
+		p->pImageMemoryBarriers = v;
+	}
+}
+
+static void capture_VkSemaphoreSubmitInfo(vksCaptureStream* s, const VkSemaphoreSubmitInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkSemaphoreSubmitInfo(vksReplay* r, vksReader* rd, VkSemaphoreSubmitInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->semaphore = (VkSemaphore)replay_map(r, (uint64_t)(uintptr_t)p->semaphore);
+}
+
+static void capture_VkCommandBufferSubmitInfo(vksCaptureStream* s, const VkCommandBufferSubmitInfo* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkCommandBufferSubmitInfo(vksReplay* r, vksReader* rd, VkCommandBufferSubmitInfo* p) {
+	p->pNext = replay_next(r, rd);
+	p->commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)p->commandBuffer);
+}
+
+static void capture_VkSubmitInfo2(vksCaptureStream* s, const VkSubmitInfo2* p) {
+	capture_next(s, p->pNext);
+	if (capture_pointer(s, p->pWaitSemaphoreInfos, (size_t)(p->waitSemaphoreInfoCount), sizeof(VkSemaphoreSubmitInfo))) {
+		for (size_t i = 0; i < (size_t)(p->waitSemaphoreInfoCount); i++) {
+			capture_VkSemaphoreSubmitInfo(s, &p->pWaitSemaphoreInfos[i]);
+		}
+	}
+	if (capture_pointer(s, p->pCommandBufferInfos, (size_t)(p->commandBufferInfoCount), sizeof(VkCommandBufferSubmitInfo))) {
+		for (size_t i = 0; i < (size_t)(p->commandBufferInfoCount); i++) {
+			capture_VkCommandBufferSubmitInfo(s, &p->pCommandBufferInfos[i]);
+		}
+	}
+	if (capture_pointer(s, p->pSignalSemaphoreInfos, (size_t)(p->signalSemaphoreInfoCount), sizeof(VkSemaphoreSubmitInfo))) {
+		for (size_t i = 0; i < (size_t)(p->signalSemaphoreInfoCount); i++) {
+			capture_VkSemaphoreSubmitInfo(s, &p->pSignalSemaphoreInfos[i]);
+		}
+	}
+}
+
+static void replay_VkSubmitInfo2(vksReplay* r, vksReader* rd, VkSubmitInfo2* p) {
+	p->pNext = replay_next(r, rd);
+	{
+		size_t n;
+		VkSemaphoreSubmitInfo* v = replay_pointer(r, rd, sizeof(VkSemaphoreSubmitInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSemaphoreSubmitInfo(r, rd, &v[i]);
+		}
+		p->pWaitSemaphoreInfos = v;
+	}
+	{
+		size_t n;
+		VkCommandBufferSubmitInfo* v = replay_pointer(r, rd, sizeof(VkCommandBufferSubmitInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkCommandBufferSubmitInfo(r, rd, &v[i]);
+		}
+		p->pCommandBufferInfos = v;
+	}
+	{
+		size_t n;
+		VkSemaphoreSubmitInfo* v = replay_pointer(r, rd, sizeof(VkSemaphoreSubmitInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSemaphoreSubmitInfo(r, rd, &v[i]);
+		}
+		p->pSignalSemaphoreInfos = v;
+	}
+}
+
+static void capture_VkImageResolve2(vksCaptureStream* s, const VkImageResolve2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkImageResolve2(vksReplay* r, vksReader* rd, VkImageResolve2* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceSynchronization2Features(vksCaptureStream* s, const VkPhysicalDeviceSynchronization2Features* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceSynchronization2Features(vksReplay* r, vksReader* rd, VkPhysicalDeviceSynchronization2Features* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkBufferImageCopy2(vksCaptureStream* s, const VkBufferImageCopy2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkBufferImageCopy2(vksReplay* r, vksReader* rd, VkBufferImageCopy2* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkImageBlit2(vksCaptureStream* s, const VkImageBlit2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkImageBlit2(vksReplay* r, vksReader* rd, VkImageBlit2* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkImageCopy2(vksCaptureStream* s, const VkImageCopy2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkImageCopy2(vksReplay* r, vksReader* rd, VkImageCopy2* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkBufferCopy2(vksCaptureStream* s, const VkBufferCopy2* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkBufferCopy2(vksReplay* r, vksReader* rd, VkBufferCopy2* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkResolveImageInfo2(vksCaptureStream* s, const VkResolveImageInfo2* p) {
+	capture_next(s, p->pNext);
+	if (capture_pointer(s, p->pRegions, (size_t)(p->regionCount), sizeof(VkImageResolve2))) {
+		for (size_t i = 0; i < (size_t)(p->regionCount); i++) {
+			capture_VkImageResolve2(s, &p->pRegions[i]);
+		}
+	}
+}
+
+static void replay_VkResolveImageInfo2(vksReplay* r, vksReader* rd, VkResolveImageInfo2* p) {
+	p->pNext = replay_next(r, rd);
+	p->srcImage = (VkImage)replay_map(r, (uint64_t)(uintptr_t)p->srcImage);
+	p->dstImage = (VkImage)replay_map(r, (uint64_t)(uintptr_t)p->dstImage);
+	{
+		size_t n;
+		VkImageResolve2* v = replay_pointer(r, rd, sizeof(VkImageResolve2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkImageResolve2(r, rd, &v[i]);
+		}
+		p->pRegions = v;
+	}
+}
+
+static void capture_VkBlitImageInfo2(vksCaptureStream* s, const VkBlitImageInfo2* p) {
+	capture_next(s, p->pNext);
+	if (capture_pointer(s, p->pRegions, (size_t)(p->regionCount), sizeof(VkImageBlit2))) {
+		for (size_t i = 0; i < (size_t)(p->regionCount); i++) {
+			capture_VkImageBlit2(s, &p->pRegions[i]);
+		}
+	}
+}
+
+static void replay_VkBlitImageInfo2(vksReplay* r, vksReader* rd, VkBlitImageInfo2* p) {
+	p->pNext = replay_next(r, rd);
+	p->srcImage = (VkImage)replay_map(r, (uint64_t)(uintptr_t)p->srcImage);
+	p->dstImage = (VkImage)replay_map(r, (uint64_t)(uintptr_t)p->dstImage);
+	{
+		size_t n;
+		VkImageBlit2* v = replay_pointer(r, rd, sizeof(VkImageBlit2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkImageBlit2(r, rd, &v[i]);
+		}
+		p->pRegions = v;
+	}
+}
+
+static void capture_VkCopyImageToBufferInfo2(vksCaptureStream* s, const VkCopyImageToBufferInfo2* p) {
+	capture_next(s, p->pNext);
+	if (capture_pointer(s, p->pRegions, (size_t)(p->regionCount), sizeof(VkBufferImageCopy2))) {
+		for (size_t i = 0; i < (size_t)(p->regionCount); i++) {
+			capture_VkBufferImageCopy2(s, &p->pRegions[i]);
+		}
+	}
+}
+
+static void replay_VkCopyImageToBufferInfo2(vksReplay* r, vksReader* rd, VkCopyImageToBufferInfo2* p) {
+	p->pNext = replay_next(r, rd);
+	p->srcImage = (VkImage)replay_map(r, (uint64_t)(uintptr_t)p->srcImage);
+	p->dstBuffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)p->dstBuffer);
+	{
+		size_t n;
+		VkBufferImageCopy2* v = replay_pointer(r, rd, sizeof(VkBufferImageCopy2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkBufferImageCopy2(r, rd, &v[i]);
+		}
+		p->pRegions = v;
+	}
+}
+
+static void capture_VkCopyBufferToImageInfo2(vksCaptureStream* s, const VkCopyBufferToImageInfo2* p) {
+	capture_next(s, p->pNext);
+	if (capture_pointer(s, p->pRegions, (size_t)(p->regionCount), sizeof(VkBufferImageCopy2))) {
+		for (size_t i = 0; i < (size_t)(p->regionCount); i++) {
+			capture_VkBufferImageCopy2(s, &p->pRegions[i]);
+		}
+	}
+}
+
+static void replay_VkCopyBufferToImageInfo2(vksReplay* r, vksReader* rd, VkCopyBufferToImageInfo2* p) {
+	p->pNext = replay_next(r, rd);
+	p->srcBuffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)p->srcBuffer);
+	p->dstImage = (VkImage)replay_map(r, (uint64_t)(uintptr_t)p->dstImage);
+	{
+		size_t n;
+		VkBufferImageCopy2* v = replay_pointer(r, rd, sizeof(VkBufferImageCopy2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkBufferImageCopy2(r, rd, &v[i]);
+		}
+		p->pRegions = v;
+	}
+}
+
+static void capture_VkCopyImageInfo2(vksCaptureStream* s, const VkCopyImageInfo2* p) {
+	capture_next(s, p->pNext);
+	if (capture_pointer(s, p->pRegions, (size_t)(p->regionCount), sizeof(VkImageCopy2))) {
+		for (size_t i = 0; i < (size_t)(p->regionCount); i++) {
+			capture_VkImageCopy2(s, &p->pRegions[i]);
+		}
+	}
+}
+
+static void replay_VkCopyImageInfo2(vksReplay* r, vksReader* rd, VkCopyImageInfo2* p) {
+	p->pNext = replay_next(r, rd);
+	p->srcImage = (VkImage)replay_map(r, (uint64_t)(uintptr_t)p->srcImage);
+	p->dstImage = (VkImage)replay_map(r, (uint64_t)(uintptr_t)p->dstImage);
+	{
+		size_t n;
+		VkImageCopy2* v = replay_pointer(r, rd, sizeof(VkImageCopy2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkImageCopy2(r, rd, &v[i]);
+		}
+		p->pRegions = v;
+	}
+}
+
+static void capture_VkCopyBufferInfo2(vksCaptureStream* s, const VkCopyBufferInfo2* p) {
+	capture_next(s, p->pNext);
+	if (capture_pointer(s, p->pRegions, (size_t)(p->regionCount), sizeof(VkBufferCopy2))) {
+		for (size_t i = 0; i < (size_t)(p->regionCount); i++) {
+			capture_VkBufferCopy2(s, &p->pRegions[i]);
+		}
+	}
+}
+
+static void replay_VkCopyBufferInfo2(vksReplay* r, vksReader* rd, VkCopyBufferInfo2* p) {
+	p->pNext = replay_next(r, rd);
+	p->srcBuffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)p->srcBuffer);
+	p->dstBuffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)p->dstBuffer);
+	{
+		size_t n;
+		VkBufferCopy2* v = replay_pointer(r, rd, sizeof(VkBufferCopy2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkBufferCopy2(r, rd, &v[i]);
+		}
+		p->pRegions = v;
+	}
+}
+
+static void capture_VkPhysicalDeviceImageRobustnessFeatures(vksCaptureStream* s, const VkPhysicalDeviceImageRobustnessFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceImageRobustnessFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceImageRobustnessFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures(vksCaptureStream* s, const VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures(vksReplay* r, vksReader* rd, VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkDebugReportCallbackCreateInfoEXT(vksCaptureStream* s, const VkDebugReportCallbackCreateInfoEXT* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkDebugReportCallbackCreateInfoEXT(vksReplay* r, vksReader* rd, VkDebugReportCallbackCreateInfoEXT* p) {
+	p->pNext = replay_next(r, rd);
+	p->pfnCallback = NULL;
+	p->pUserData = NULL;
+}
+
+static void capture_VkPhysicalDeviceSurfaceInfo2KHR(vksCaptureStream* s, const VkPhysicalDeviceSurfaceInfo2KHR* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceSurfaceInfo2KHR(vksReplay* r, vksReader* rd, VkPhysicalDeviceSurfaceInfo2KHR* p) {
+	p->pNext = replay_next(r, rd);
+	p->surface = (VkSurfaceKHR)replay_map(r, (uint64_t)(uintptr_t)p->surface);
+}
+
+static void capture_VkSurfaceCapabilities2KHR(vksCaptureStream* s, const VkSurfaceCapabilities2KHR* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkSurfaceCapabilities2KHR(vksReplay* r, vksReader* rd, VkSurfaceCapabilities2KHR* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkSurfaceFormat2KHR(vksCaptureStream* s, const VkSurfaceFormat2KHR* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkSurfaceFormat2KHR(vksReplay* r, vksReader* rd, VkSurfaceFormat2KHR* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkSurfaceProtectedCapabilitiesKHR(vksCaptureStream* s, const VkSurfaceProtectedCapabilitiesKHR* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkSurfaceProtectedCapabilitiesKHR(vksReplay* r, vksReader* rd, VkSurfaceProtectedCapabilitiesKHR* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkDeviceGroupSwapchainCreateInfoKHR(vksCaptureStream* s, const VkDeviceGroupSwapchainCreateInfoKHR* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkDeviceGroupSwapchainCreateInfoKHR(vksReplay* r, vksReader* rd, VkDeviceGroupSwapchainCreateInfoKHR* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkSwapchainCreateInfoKHR(vksCaptureStream* s, const VkSwapchainCreateInfoKHR* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pQueueFamilyIndices, (size_t)(p->queueFamilyIndexCount), sizeof(uint32_t));
+}
+
+static void replay_VkSwapchainCreateInfoKHR(vksReplay* r, vksReader* rd, VkSwapchainCreateInfoKHR* p) {
+	p->pNext = replay_next(r, rd);
+	p->surface = (VkSurfaceKHR)replay_map(r, (uint64_t)(uintptr_t)p->surface);
+	p->pQueueFamilyIndices = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	p->oldSwapchain = (VkSwapchainKHR)replay_map(r, (uint64_t)(uintptr_t)p->oldSwapchain);
+}
+
+static void capture_VkPresentInfoKHR(vksCaptureStream* s, const VkPresentInfoKHR* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pWaitSemaphores, (size_t)(p->waitSemaphoreCount), sizeof(VkSemaphore));
+	capture_pointer(s, p->pSwapchains, (size_t)(p->swapchainCount), sizeof(VkSwapchainKHR));
+	capture_pointer(s, p->pImageIndices, (size_t)(p->swapchainCount), sizeof(uint32_t));
+	capture_pointer(s, p->pResults, (size_t)(p->swapchainCount), sizeof(VkResult));
+}
+
+static void replay_VkPresentInfoKHR(vksReplay* r, vksReader* rd, VkPresentInfoKHR* p) {
+	p->pNext = replay_next(r, rd);
+	{
+		size_t n;
+		VkSemaphore* v = replay_pointer(r, rd, sizeof(VkSemaphore), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkSemaphore)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		p->pWaitSemaphores = v;
+	}
+	{
+		size_t n;
+		VkSwapchainKHR* v = replay_pointer(r, rd, sizeof(VkSwapchainKHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkSwapchainKHR)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		p->pSwapchains = v;
+	}
+	p->pImageIndices = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	p->pResults = replay_pointer(r, rd, sizeof(VkResult), NULL);
+}
+
+static void capture_VkDeviceGroupPresentCapabilitiesKHR(vksCaptureStream* s, const VkDeviceGroupPresentCapabilitiesKHR* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkDeviceGroupPresentCapabilitiesKHR(vksReplay* r, vksReader* rd, VkDeviceGroupPresentCapabilitiesKHR* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkDeviceGroupPresentInfoKHR(vksCaptureStream* s, const VkDeviceGroupPresentInfoKHR* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pDeviceMasks, (size_t)(p->swapchainCount), sizeof(uint32_t));
+}
+
+static void replay_VkDeviceGroupPresentInfoKHR(vksReplay* r, vksReader* rd, VkDeviceGroupPresentInfoKHR* p) {
+	p->pNext = replay_next(r, rd);
+	p->pDeviceMasks = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+}
+
+static void capture_VkImageSwapchainCreateInfoKHR(vksCaptureStream* s, const VkImageSwapchainCreateInfoKHR* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkImageSwapchainCreateInfoKHR(vksReplay* r, vksReader* rd, VkImageSwapchainCreateInfoKHR* p) {
+	p->pNext = replay_next(r, rd);
+	p->swapchain = (VkSwapchainKHR)replay_map(r, (uint64_t)(uintptr_t)p->swapchain);
+}
+
+static void capture_VkAcquireNextImageInfoKHR(vksCaptureStream* s, const VkAcquireNextImageInfoKHR* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkAcquireNextImageInfoKHR(vksReplay* r, vksReader* rd, VkAcquireNextImageInfoKHR* p) {
+	p->pNext = replay_next(r, rd);
+	p->swapchain = (VkSwapchainKHR)replay_map(r, (uint64_t)(uintptr_t)p->swapchain);
+	p->semaphore = (VkSemaphore)replay_map(r, (uint64_t)(uintptr_t)p->semaphore);
+	p->fence = (VkFence)replay_map(r, (uint64_t)(uintptr_t)p->fence);
+}
+
+static void capture_VkBindImageMemorySwapchainInfoKHR(vksCaptureStream* s, const VkBindImageMemorySwapchainInfoKHR* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkBindImageMemorySwapchainInfoKHR(vksReplay* r, vksReader* rd, VkBindImageMemorySwapchainInfoKHR* p) {
+	p->pNext = replay_next(r, rd);
+	p->swapchain = (VkSwapchainKHR)replay_map(r, (uint64_t)(uintptr_t)p->swapchain);
+}
+
+static void capture_VkDisplayModePropertiesKHR(vksCaptureStream* s, const VkDisplayModePropertiesKHR* p) {
+}
+
+static void replay_VkDisplayModePropertiesKHR(vksReplay* r, vksReader* rd, VkDisplayModePropertiesKHR* p) {
+	p->displayMode = (VkDisplayModeKHR)replay_map(r, (uint64_t)(uintptr_t)p->displayMode);
+}
+
+static void capture_VkDisplaySurfaceCreateInfoKHR(vksCaptureStream* s, const VkDisplaySurfaceCreateInfoKHR* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkDisplaySurfaceCreateInfoKHR(vksReplay* r, vksReader* rd, VkDisplaySurfaceCreateInfoKHR* p) {
+	p->pNext = replay_next(r, rd);
+	p->displayMode = (VkDisplayModeKHR)replay_map(r, (uint64_t)(uintptr_t)p->displayMode);
+}
+
+static void capture_VkDisplayModeCreateInfoKHR(vksCaptureStream* s, const VkDisplayModeCreateInfoKHR* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkDisplayModeCreateInfoKHR(vksReplay* r, vksReader* rd, VkDisplayModeCreateInfoKHR* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkDisplayPropertiesKHR(vksCaptureStream* s, const VkDisplayPropertiesKHR* p) {
+	capture_string(s, p->displayName);
+}
+
+static void replay_VkDisplayPropertiesKHR(vksReplay* r, vksReader* rd, VkDisplayPropertiesKHR* p) {
+	p->display = (VkDisplayKHR)replay_map(r, (uint64_t)(uintptr_t)p->display);
+	p->displayName = replay_string(r, rd);
+}
+
+static void capture_VkDisplayPlanePropertiesKHR(vksCaptureStream* s, const VkDisplayPlanePropertiesKHR* p) {
+}
+
+static void replay_VkDisplayPlanePropertiesKHR(vksReplay* r, vksReader* rd, VkDisplayPlanePropertiesKHR* p) {
+	p->currentDisplay = (VkDisplayKHR)replay_map(r, (uint64_t)(uintptr_t)p->currentDisplay);
+}
+
+static void capture_VkDisplayPlaneCapabilities2KHR(vksCaptureStream* s, const VkDisplayPlaneCapabilities2KHR* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkDisplayPlaneCapabilities2KHR(vksReplay* r, vksReader* rd, VkDisplayPlaneCapabilities2KHR* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkDisplayPlaneProperties2KHR(vksCaptureStream* s, const VkDisplayPlaneProperties2KHR* p) {
+	capture_next(s, p->pNext);
+	capture_VkDisplayPlanePropertiesKHR(s, &p->displayPlaneProperties);
+}
+
+static void replay_VkDisplayPlaneProperties2KHR(vksReplay* r, vksReader* rd, VkDisplayPlaneProperties2KHR* p) {
+	p->pNext = replay_next(r, rd);
+	replay_VkDisplayPlanePropertiesKHR(r, rd, &p->displayPlaneProperties);
+}
+
+static void capture_VkDisplayPlaneInfo2KHR(vksCaptureStream* s, const VkDisplayPlaneInfo2KHR* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkDisplayPlaneInfo2KHR(vksReplay* r, vksReader* rd, VkDisplayPlaneInfo2KHR* p) {
+	p->pNext = replay_next(r, rd);
+	p->mode = (VkDisplayModeKHR)replay_map(r, (uint64_t)(uintptr_t)p->mode);
+}
+
+static void capture_VkDisplayProperties2KHR(vksCaptureStream* s, const VkDisplayProperties2KHR* p) {
+	capture_next(s, p->pNext);
+	capture_VkDisplayPropertiesKHR(s, &p->displayProperties);
+}
+
+static void replay_VkDisplayProperties2KHR(vksReplay* r, vksReader* rd, VkDisplayProperties2KHR* p) {
+	p->pNext = replay_next(r, rd);
+	replay_VkDisplayPropertiesKHR(r, rd, &p->displayProperties);
+}
+
+static void capture_VkDisplayModeProperties2KHR(vksCaptureStream* s, const VkDisplayModeProperties2KHR* p) {
+	capture_next(s, p->pNext);
+	capture_VkDisplayModePropertiesKHR(s, &p->displayModeProperties);
+}
+
+static void replay_VkDisplayModeProperties2KHR(vksReplay* r, vksReader* rd, VkDisplayModeProperties2KHR* p) {
+	p->pNext = replay_next(r, rd);
+	replay_VkDisplayModePropertiesKHR(r, rd, &p->displayModeProperties);
+}
+
+static void capture_VkDisplayPresentInfoKHR(vksCaptureStream* s, const VkDisplayPresentInfoKHR* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkDisplayPresentInfoKHR(vksReplay* r, vksReader* rd, VkDisplayPresentInfoKHR* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDevicePortabilitySubsetFeaturesKHR(vksCaptureStream* s, const VkPhysicalDevicePortabilitySubsetFeaturesKHR* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDevicePortabilitySubsetFeaturesKHR(vksReplay* r, vksReader* rd, VkPhysicalDevicePortabilitySubsetFeaturesKHR* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDevicePortabilitySubsetPropertiesKHR(vksCaptureStream* s, const VkPhysicalDevicePortabilitySubsetPropertiesKHR* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDevicePortabilitySubsetPropertiesKHR(vksReplay* r, vksReader* rd, VkPhysicalDevicePortabilitySubsetPropertiesKHR* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceMemoryBudgetPropertiesEXT(vksCaptureStream* s, const VkPhysicalDeviceMemoryBudgetPropertiesEXT* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceMemoryBudgetPropertiesEXT(vksReplay* r, vksReader* rd, VkPhysicalDeviceMemoryBudgetPropertiesEXT* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPipelineLibraryCreateInfoKHR(vksCaptureStream* s, const VkPipelineLibraryCreateInfoKHR* p) {
+	capture_next(s, p->pNext);
+	capture_pointer(s, p->pLibraries, (size_t)(p->libraryCount), sizeof(VkPipeline));
+}
+
+static void replay_VkPipelineLibraryCreateInfoKHR(vksReplay* r, vksReader* rd, VkPipelineLibraryCreateInfoKHR* p) {
+	p->pNext = replay_next(r, rd);
+	{
+		size_t n;
+		VkPipeline* v = replay_pointer(r, rd, sizeof(VkPipeline), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkPipeline)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		p->pLibraries = v;
+	}
+}
+
+static void capture_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT(vksCaptureStream* s, const VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT(vksReplay* r, vksReader* rd, VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT(vksCaptureStream* s, const VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT(vksReplay* r, vksReader* rd, VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkGraphicsPipelineLibraryCreateInfoEXT(vksCaptureStream* s, const VkGraphicsPipelineLibraryCreateInfoEXT* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkGraphicsPipelineLibraryCreateInfoEXT(vksReplay* r, vksReader* rd, VkGraphicsPipelineLibraryCreateInfoEXT* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkImportMemoryFdInfoKHR(vksCaptureStream* s, const VkImportMemoryFdInfoKHR* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkImportMemoryFdInfoKHR(vksReplay* r, vksReader* rd, VkImportMemoryFdInfoKHR* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkMemoryFdPropertiesKHR(vksCaptureStream* s, const VkMemoryFdPropertiesKHR* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkMemoryFdPropertiesKHR(vksReplay* r, vksReader* rd, VkMemoryFdPropertiesKHR* p) {
+	p->pNext = replay_next(r, rd);
+}
+
+static void capture_VkMemoryGetFdInfoKHR(vksCaptureStream* s, const VkMemoryGetFdInfoKHR* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkMemoryGetFdInfoKHR(vksReplay* r, vksReader* rd, VkMemoryGetFdInfoKHR* p) {
+	p->pNext = replay_next(r, rd);
+	p->memory = (VkDeviceMemory)replay_map(r, (uint64_t)(uintptr_t)p->memory);
+}
+
+static void capture_VkImportSemaphoreFdInfoKHR(vksCaptureStream* s, const VkImportSemaphoreFdInfoKHR* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkImportSemaphoreFdInfoKHR(vksReplay* r, vksReader* rd, VkImportSemaphoreFdInfoKHR* p) {
+	p->pNext = replay_next(r, rd);
+	p->semaphore = (VkSemaphore)replay_map(r, (uint64_t)(uintptr_t)p->semaphore);
+}
+
+static void capture_VkSemaphoreGetFdInfoKHR(vksCaptureStream* s, const VkSemaphoreGetFdInfoKHR* p) {
+	capture_next(s, p->pNext);
+}
+
+static void replay_VkSemaphoreGetFdInfoKHR(vksReplay* r, vksReader* rd, VkSemaphoreGetFdInfoKHR* p) {
+	p->pNext = replay_next(r, rd);
+	p->semaphore = (VkSemaphore)replay_map(r, (uint64_t)(uintptr_t)p->semaphore);
+}
+
+// Writes the first struct of the chain known to this binding, or the largest
+// sType value to end the chain; zero is a valid sType. Unknown structs are
+// skipped.
+static void capture_next(vksCaptureStream* s, const void* next) {
+	for (const VkBaseInStructure* n = next; n != NULL; n = n->pNext) {
+		switch (n->sType) {
+		case VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkAcquireNextImageInfoKHR));
+			capture_VkAcquireNextImageInfoKHR(s, (const VkAcquireNextImageInfoKHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_APPLICATION_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkApplicationInfo));
+			capture_VkApplicationInfo(s, (const VkApplicationInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkAttachmentDescription2));
+			capture_VkAttachmentDescription2(s, (const VkAttachmentDescription2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkAttachmentDescriptionStencilLayout));
+			capture_VkAttachmentDescriptionStencilLayout(s, (const VkAttachmentDescriptionStencilLayout*)n);
+			return;
+		case VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkAttachmentReference2));
+			capture_VkAttachmentReference2(s, (const VkAttachmentReference2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkAttachmentReferenceStencilLayout));
+			capture_VkAttachmentReferenceStencilLayout(s, (const VkAttachmentReferenceStencilLayout*)n);
+			return;
+		case VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkBindBufferMemoryDeviceGroupInfo));
+			capture_VkBindBufferMemoryDeviceGroupInfo(s, (const VkBindBufferMemoryDeviceGroupInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkBindBufferMemoryInfo));
+			capture_VkBindBufferMemoryInfo(s, (const VkBindBufferMemoryInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkBindImageMemoryDeviceGroupInfo));
+			capture_VkBindImageMemoryDeviceGroupInfo(s, (const VkBindImageMemoryDeviceGroupInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkBindImageMemoryInfo));
+			capture_VkBindImageMemoryInfo(s, (const VkBindImageMemoryInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkBindImageMemorySwapchainInfoKHR));
+			capture_VkBindImageMemorySwapchainInfoKHR(s, (const VkBindImageMemorySwapchainInfoKHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkBindImagePlaneMemoryInfo));
+			capture_VkBindImagePlaneMemoryInfo(s, (const VkBindImagePlaneMemoryInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_BIND_SPARSE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkBindSparseInfo));
+			capture_VkBindSparseInfo(s, (const VkBindSparseInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_BLIT_IMAGE_INFO_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkBlitImageInfo2));
+			capture_VkBlitImageInfo2(s, (const VkBlitImageInfo2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_BUFFER_COPY_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkBufferCopy2));
+			capture_VkBufferCopy2(s, (const VkBufferCopy2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkBufferCreateInfo));
+			capture_VkBufferCreateInfo(s, (const VkBufferCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkBufferDeviceAddressInfo));
+			capture_VkBufferDeviceAddressInfo(s, (const VkBufferDeviceAddressInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkBufferImageCopy2));
+			capture_VkBufferImageCopy2(s, (const VkBufferImageCopy2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkBufferMemoryBarrier));
+			capture_VkBufferMemoryBarrier(s, (const VkBufferMemoryBarrier*)n);
+			return;
+		case VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkBufferMemoryBarrier2));
+			capture_VkBufferMemoryBarrier2(s, (const VkBufferMemoryBarrier2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkBufferMemoryRequirementsInfo2));
+			capture_VkBufferMemoryRequirementsInfo2(s, (const VkBufferMemoryRequirementsInfo2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkBufferOpaqueCaptureAddressCreateInfo));
+			capture_VkBufferOpaqueCaptureAddressCreateInfo(s, (const VkBufferOpaqueCaptureAddressCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkBufferViewCreateInfo));
+			capture_VkBufferViewCreateInfo(s, (const VkBufferViewCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkCommandBufferAllocateInfo));
+			capture_VkCommandBufferAllocateInfo(s, (const VkCommandBufferAllocateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkCommandBufferBeginInfo));
+			capture_VkCommandBufferBeginInfo(s, (const VkCommandBufferBeginInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkCommandBufferInheritanceInfo));
+			capture_VkCommandBufferInheritanceInfo(s, (const VkCommandBufferInheritanceInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkCommandBufferInheritanceRenderingInfo));
+			capture_VkCommandBufferInheritanceRenderingInfo(s, (const VkCommandBufferInheritanceRenderingInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkCommandBufferSubmitInfo));
+			capture_VkCommandBufferSubmitInfo(s, (const VkCommandBufferSubmitInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkCommandPoolCreateInfo));
+			capture_VkCommandPoolCreateInfo(s, (const VkCommandPoolCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkComputePipelineCreateInfo));
+			capture_VkComputePipelineCreateInfo(s, (const VkComputePipelineCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_COPY_BUFFER_INFO_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkCopyBufferInfo2));
+			capture_VkCopyBufferInfo2(s, (const VkCopyBufferInfo2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_COPY_BUFFER_TO_IMAGE_INFO_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkCopyBufferToImageInfo2));
+			capture_VkCopyBufferToImageInfo2(s, (const VkCopyBufferToImageInfo2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkCopyDescriptorSet));
+			capture_VkCopyDescriptorSet(s, (const VkCopyDescriptorSet*)n);
+			return;
+		case VK_STRUCTURE_TYPE_COPY_IMAGE_INFO_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkCopyImageInfo2));
+			capture_VkCopyImageInfo2(s, (const VkCopyImageInfo2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_COPY_IMAGE_TO_BUFFER_INFO_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkCopyImageToBufferInfo2));
+			capture_VkCopyImageToBufferInfo2(s, (const VkCopyImageToBufferInfo2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDebugReportCallbackCreateInfoEXT));
+			capture_VkDebugReportCallbackCreateInfoEXT(s, (const VkDebugReportCallbackCreateInfoEXT*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DEPENDENCY_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDependencyInfo));
+			capture_VkDependencyInfo(s, (const VkDependencyInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDescriptorPoolCreateInfo));
+			capture_VkDescriptorPoolCreateInfo(s, (const VkDescriptorPoolCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDescriptorPoolInlineUniformBlockCreateInfo));
+			capture_VkDescriptorPoolInlineUniformBlockCreateInfo(s, (const VkDescriptorPoolInlineUniformBlockCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDescriptorSetAllocateInfo));
+			capture_VkDescriptorSetAllocateInfo(s, (const VkDescriptorSetAllocateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDescriptorSetLayoutBindingFlagsCreateInfo));
+			capture_VkDescriptorSetLayoutBindingFlagsCreateInfo(s, (const VkDescriptorSetLayoutBindingFlagsCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDescriptorSetLayoutCreateInfo));
+			capture_VkDescriptorSetLayoutCreateInfo(s, (const VkDescriptorSetLayoutCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_SUPPORT:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDescriptorSetLayoutSupport));
+			capture_VkDescriptorSetLayoutSupport(s, (const VkDescriptorSetLayoutSupport*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDescriptorSetVariableDescriptorCountAllocateInfo));
+			capture_VkDescriptorSetVariableDescriptorCountAllocateInfo(s, (const VkDescriptorSetVariableDescriptorCountAllocateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDescriptorSetVariableDescriptorCountLayoutSupport));
+			capture_VkDescriptorSetVariableDescriptorCountLayoutSupport(s, (const VkDescriptorSetVariableDescriptorCountLayoutSupport*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDescriptorUpdateTemplateCreateInfo));
+			capture_VkDescriptorUpdateTemplateCreateInfo(s, (const VkDescriptorUpdateTemplateCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DEVICE_BUFFER_MEMORY_REQUIREMENTS:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDeviceBufferMemoryRequirements));
+			capture_VkDeviceBufferMemoryRequirements(s, (const VkDeviceBufferMemoryRequirements*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDeviceCreateInfo));
+			capture_VkDeviceCreateInfo(s, (const VkDeviceCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDeviceGroupBindSparseInfo));
+			capture_VkDeviceGroupBindSparseInfo(s, (const VkDeviceGroupBindSparseInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDeviceGroupCommandBufferBeginInfo));
+			capture_VkDeviceGroupCommandBufferBeginInfo(s, (const VkDeviceGroupCommandBufferBeginInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDeviceGroupDeviceCreateInfo));
+			capture_VkDeviceGroupDeviceCreateInfo(s, (const VkDeviceGroupDeviceCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_CAPABILITIES_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDeviceGroupPresentCapabilitiesKHR));
+			capture_VkDeviceGroupPresentCapabilitiesKHR(s, (const VkDeviceGroupPresentCapabilitiesKHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDeviceGroupPresentInfoKHR));
+			capture_VkDeviceGroupPresentInfoKHR(s, (const VkDeviceGroupPresentInfoKHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDeviceGroupRenderPassBeginInfo));
+			capture_VkDeviceGroupRenderPassBeginInfo(s, (const VkDeviceGroupRenderPassBeginInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDeviceGroupSubmitInfo));
+			capture_VkDeviceGroupSubmitInfo(s, (const VkDeviceGroupSubmitInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDeviceGroupSwapchainCreateInfoKHR));
+			capture_VkDeviceGroupSwapchainCreateInfoKHR(s, (const VkDeviceGroupSwapchainCreateInfoKHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDeviceImageMemoryRequirements));
+			capture_VkDeviceImageMemoryRequirements(s, (const VkDeviceImageMemoryRequirements*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DEVICE_MEMORY_OPAQUE_CAPTURE_ADDRESS_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDeviceMemoryOpaqueCaptureAddressInfo));
+			capture_VkDeviceMemoryOpaqueCaptureAddressInfo(s, (const VkDeviceMemoryOpaqueCaptureAddressInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDevicePrivateDataCreateInfo));
+			capture_VkDevicePrivateDataCreateInfo(s, (const VkDevicePrivateDataCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDeviceQueueCreateInfo));
+			capture_VkDeviceQueueCreateInfo(s, (const VkDeviceQueueCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DEVICE_QUEUE_INFO_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDeviceQueueInfo2));
+			capture_VkDeviceQueueInfo2(s, (const VkDeviceQueueInfo2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DISPLAY_MODE_CREATE_INFO_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDisplayModeCreateInfoKHR));
+			capture_VkDisplayModeCreateInfoKHR(s, (const VkDisplayModeCreateInfoKHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DISPLAY_MODE_PROPERTIES_2_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDisplayModeProperties2KHR));
+			capture_VkDisplayModeProperties2KHR(s, (const VkDisplayModeProperties2KHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DISPLAY_PLANE_CAPABILITIES_2_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDisplayPlaneCapabilities2KHR));
+			capture_VkDisplayPlaneCapabilities2KHR(s, (const VkDisplayPlaneCapabilities2KHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DISPLAY_PLANE_INFO_2_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDisplayPlaneInfo2KHR));
+			capture_VkDisplayPlaneInfo2KHR(s, (const VkDisplayPlaneInfo2KHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DISPLAY_PLANE_PROPERTIES_2_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDisplayPlaneProperties2KHR));
+			capture_VkDisplayPlaneProperties2KHR(s, (const VkDisplayPlaneProperties2KHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDisplayPresentInfoKHR));
+			capture_VkDisplayPresentInfoKHR(s, (const VkDisplayPresentInfoKHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DISPLAY_PROPERTIES_2_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDisplayProperties2KHR));
+			capture_VkDisplayProperties2KHR(s, (const VkDisplayProperties2KHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_DISPLAY_SURFACE_CREATE_INFO_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkDisplaySurfaceCreateInfoKHR));
+			capture_VkDisplaySurfaceCreateInfoKHR(s, (const VkDisplaySurfaceCreateInfoKHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_EVENT_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkEventCreateInfo));
+			capture_VkEventCreateInfo(s, (const VkEventCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkExportFenceCreateInfo));
+			capture_VkExportFenceCreateInfo(s, (const VkExportFenceCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkExportMemoryAllocateInfo));
+			capture_VkExportMemoryAllocateInfo(s, (const VkExportMemoryAllocateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkExportSemaphoreCreateInfo));
+			capture_VkExportSemaphoreCreateInfo(s, (const VkExportSemaphoreCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_EXTERNAL_BUFFER_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkExternalBufferProperties));
+			capture_VkExternalBufferProperties(s, (const VkExternalBufferProperties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_EXTERNAL_FENCE_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkExternalFenceProperties));
+			capture_VkExternalFenceProperties(s, (const VkExternalFenceProperties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkExternalImageFormatProperties));
+			capture_VkExternalImageFormatProperties(s, (const VkExternalImageFormatProperties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkExternalMemoryBufferCreateInfo));
+			capture_VkExternalMemoryBufferCreateInfo(s, (const VkExternalMemoryBufferCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkExternalMemoryImageCreateInfo));
+			capture_VkExternalMemoryImageCreateInfo(s, (const VkExternalMemoryImageCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_EXTERNAL_SEMAPHORE_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkExternalSemaphoreProperties));
+			capture_VkExternalSemaphoreProperties(s, (const VkExternalSemaphoreProperties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_FENCE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkFenceCreateInfo));
+			capture_VkFenceCreateInfo(s, (const VkFenceCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkFormatProperties2));
+			capture_VkFormatProperties2(s, (const VkFormatProperties2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkFormatProperties3));
+			capture_VkFormatProperties3(s, (const VkFormatProperties3*)n);
+			return;
+		case VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENT_IMAGE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkFramebufferAttachmentImageInfo));
+			capture_VkFramebufferAttachmentImageInfo(s, (const VkFramebufferAttachmentImageInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkFramebufferAttachmentsCreateInfo));
+			capture_VkFramebufferAttachmentsCreateInfo(s, (const VkFramebufferAttachmentsCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkFramebufferCreateInfo));
+			capture_VkFramebufferCreateInfo(s, (const VkFramebufferCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkGraphicsPipelineCreateInfo));
+			capture_VkGraphicsPipelineCreateInfo(s, (const VkGraphicsPipelineCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkGraphicsPipelineLibraryCreateInfoEXT));
+			capture_VkGraphicsPipelineLibraryCreateInfoEXT(s, (const VkGraphicsPipelineLibraryCreateInfoEXT*)n);
+			return;
+		case VK_STRUCTURE_TYPE_IMAGE_BLIT_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkImageBlit2));
+			capture_VkImageBlit2(s, (const VkImageBlit2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_IMAGE_COPY_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkImageCopy2));
+			capture_VkImageCopy2(s, (const VkImageCopy2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkImageCreateInfo));
+			capture_VkImageCreateInfo(s, (const VkImageCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkImageFormatListCreateInfo));
+			capture_VkImageFormatListCreateInfo(s, (const VkImageFormatListCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkImageFormatProperties2));
+			capture_VkImageFormatProperties2(s, (const VkImageFormatProperties2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkImageMemoryBarrier));
+			capture_VkImageMemoryBarrier(s, (const VkImageMemoryBarrier*)n);
+			return;
+		case VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkImageMemoryBarrier2));
+			capture_VkImageMemoryBarrier2(s, (const VkImageMemoryBarrier2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkImageMemoryRequirementsInfo2));
+			capture_VkImageMemoryRequirementsInfo2(s, (const VkImageMemoryRequirementsInfo2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkImagePlaneMemoryRequirementsInfo));
+			capture_VkImagePlaneMemoryRequirementsInfo(s, (const VkImagePlaneMemoryRequirementsInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_IMAGE_RESOLVE_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkImageResolve2));
+			capture_VkImageResolve2(s, (const VkImageResolve2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_IMAGE_SPARSE_MEMORY_REQUIREMENTS_INFO_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkImageSparseMemoryRequirementsInfo2));
+			capture_VkImageSparseMemoryRequirementsInfo2(s, (const VkImageSparseMemoryRequirementsInfo2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkImageStencilUsageCreateInfo));
+			capture_VkImageStencilUsageCreateInfo(s, (const VkImageStencilUsageCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkImageSwapchainCreateInfoKHR));
+			capture_VkImageSwapchainCreateInfoKHR(s, (const VkImageSwapchainCreateInfoKHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkImageViewCreateInfo));
+			capture_VkImageViewCreateInfo(s, (const VkImageViewCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkImageViewUsageCreateInfo));
+			capture_VkImageViewUsageCreateInfo(s, (const VkImageViewUsageCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkImportMemoryFdInfoKHR));
+			capture_VkImportMemoryFdInfoKHR(s, (const VkImportMemoryFdInfoKHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_FD_INFO_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkImportSemaphoreFdInfoKHR));
+			capture_VkImportSemaphoreFdInfoKHR(s, (const VkImportSemaphoreFdInfoKHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkInstanceCreateInfo));
+			capture_VkInstanceCreateInfo(s, (const VkInstanceCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkMappedMemoryRange));
+			capture_VkMappedMemoryRange(s, (const VkMappedMemoryRange*)n);
+			return;
+		case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkMemoryAllocateFlagsInfo));
+			capture_VkMemoryAllocateFlagsInfo(s, (const VkMemoryAllocateFlagsInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkMemoryAllocateInfo));
+			capture_VkMemoryAllocateInfo(s, (const VkMemoryAllocateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_MEMORY_BARRIER:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkMemoryBarrier));
+			capture_VkMemoryBarrier(s, (const VkMemoryBarrier*)n);
+			return;
+		case VK_STRUCTURE_TYPE_MEMORY_BARRIER_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkMemoryBarrier2));
+			capture_VkMemoryBarrier2(s, (const VkMemoryBarrier2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkMemoryDedicatedAllocateInfo));
+			capture_VkMemoryDedicatedAllocateInfo(s, (const VkMemoryDedicatedAllocateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkMemoryDedicatedRequirements));
+			capture_VkMemoryDedicatedRequirements(s, (const VkMemoryDedicatedRequirements*)n);
+			return;
+		case VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkMemoryFdPropertiesKHR));
+			capture_VkMemoryFdPropertiesKHR(s, (const VkMemoryFdPropertiesKHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkMemoryGetFdInfoKHR));
+			capture_VkMemoryGetFdInfoKHR(s, (const VkMemoryGetFdInfoKHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkMemoryOpaqueCaptureAddressAllocateInfo));
+			capture_VkMemoryOpaqueCaptureAddressAllocateInfo(s, (const VkMemoryOpaqueCaptureAddressAllocateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkMemoryRequirements2));
+			capture_VkMemoryRequirements2(s, (const VkMemoryRequirements2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDevice16BitStorageFeatures));
+			capture_VkPhysicalDevice16BitStorageFeatures(s, (const VkPhysicalDevice16BitStorageFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDevice8BitStorageFeatures));
+			capture_VkPhysicalDevice8BitStorageFeatures(s, (const VkPhysicalDevice8BitStorageFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceBufferDeviceAddressFeatures));
+			capture_VkPhysicalDeviceBufferDeviceAddressFeatures(s, (const VkPhysicalDeviceBufferDeviceAddressFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_STENCIL_RESOLVE_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceDepthStencilResolveProperties));
+			capture_VkPhysicalDeviceDepthStencilResolveProperties(s, (const VkPhysicalDeviceDepthStencilResolveProperties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceDescriptorIndexingFeatures));
+			capture_VkPhysicalDeviceDescriptorIndexingFeatures(s, (const VkPhysicalDeviceDescriptorIndexingFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceDescriptorIndexingProperties));
+			capture_VkPhysicalDeviceDescriptorIndexingProperties(s, (const VkPhysicalDeviceDescriptorIndexingProperties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceDriverProperties));
+			capture_VkPhysicalDeviceDriverProperties(s, (const VkPhysicalDeviceDriverProperties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceDynamicRenderingFeatures));
+			capture_VkPhysicalDeviceDynamicRenderingFeatures(s, (const VkPhysicalDeviceDynamicRenderingFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_BUFFER_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceExternalBufferInfo));
+			capture_VkPhysicalDeviceExternalBufferInfo(s, (const VkPhysicalDeviceExternalBufferInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_FENCE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceExternalFenceInfo));
+			capture_VkPhysicalDeviceExternalFenceInfo(s, (const VkPhysicalDeviceExternalFenceInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceExternalImageFormatInfo));
+			capture_VkPhysicalDeviceExternalImageFormatInfo(s, (const VkPhysicalDeviceExternalImageFormatInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_SEMAPHORE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceExternalSemaphoreInfo));
+			capture_VkPhysicalDeviceExternalSemaphoreInfo(s, (const VkPhysicalDeviceExternalSemaphoreInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceFeatures2));
+			capture_VkPhysicalDeviceFeatures2(s, (const VkPhysicalDeviceFeatures2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceFloatControlsProperties));
+			capture_VkPhysicalDeviceFloatControlsProperties(s, (const VkPhysicalDeviceFloatControlsProperties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT));
+			capture_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT(s, (const VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT));
+			capture_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT(s, (const VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceGroupProperties));
+			capture_VkPhysicalDeviceGroupProperties(s, (const VkPhysicalDeviceGroupProperties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceHostQueryResetFeatures));
+			capture_VkPhysicalDeviceHostQueryResetFeatures(s, (const VkPhysicalDeviceHostQueryResetFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceIDProperties));
+			capture_VkPhysicalDeviceIDProperties(s, (const VkPhysicalDeviceIDProperties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceImageFormatInfo2));
+			capture_VkPhysicalDeviceImageFormatInfo2(s, (const VkPhysicalDeviceImageFormatInfo2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ROBUSTNESS_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceImageRobustnessFeatures));
+			capture_VkPhysicalDeviceImageRobustnessFeatures(s, (const VkPhysicalDeviceImageRobustnessFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceImagelessFramebufferFeatures));
+			capture_VkPhysicalDeviceImagelessFramebufferFeatures(s, (const VkPhysicalDeviceImagelessFramebufferFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceInlineUniformBlockFeatures));
+			capture_VkPhysicalDeviceInlineUniformBlockFeatures(s, (const VkPhysicalDeviceInlineUniformBlockFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceInlineUniformBlockProperties));
+			capture_VkPhysicalDeviceInlineUniformBlockProperties(s, (const VkPhysicalDeviceInlineUniformBlockProperties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceMaintenance3Properties));
+			capture_VkPhysicalDeviceMaintenance3Properties(s, (const VkPhysicalDeviceMaintenance3Properties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceMaintenance4Features));
+			capture_VkPhysicalDeviceMaintenance4Features(s, (const VkPhysicalDeviceMaintenance4Features*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceMaintenance4Properties));
+			capture_VkPhysicalDeviceMaintenance4Properties(s, (const VkPhysicalDeviceMaintenance4Properties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceMemoryBudgetPropertiesEXT));
+			capture_VkPhysicalDeviceMemoryBudgetPropertiesEXT(s, (const VkPhysicalDeviceMemoryBudgetPropertiesEXT*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceMemoryProperties2));
+			capture_VkPhysicalDeviceMemoryProperties2(s, (const VkPhysicalDeviceMemoryProperties2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceMultiviewFeatures));
+			capture_VkPhysicalDeviceMultiviewFeatures(s, (const VkPhysicalDeviceMultiviewFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceMultiviewProperties));
+			capture_VkPhysicalDeviceMultiviewProperties(s, (const VkPhysicalDeviceMultiviewProperties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CREATION_CACHE_CONTROL_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDevicePipelineCreationCacheControlFeatures));
+			capture_VkPhysicalDevicePipelineCreationCacheControlFeatures(s, (const VkPhysicalDevicePipelineCreationCacheControlFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDevicePointClippingProperties));
+			capture_VkPhysicalDevicePointClippingProperties(s, (const VkPhysicalDevicePointClippingProperties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_FEATURES_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDevicePortabilitySubsetFeaturesKHR));
+			capture_VkPhysicalDevicePortabilitySubsetFeaturesKHR(s, (const VkPhysicalDevicePortabilitySubsetFeaturesKHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_PROPERTIES_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDevicePortabilitySubsetPropertiesKHR));
+			capture_VkPhysicalDevicePortabilitySubsetPropertiesKHR(s, (const VkPhysicalDevicePortabilitySubsetPropertiesKHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIVATE_DATA_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDevicePrivateDataFeatures));
+			capture_VkPhysicalDevicePrivateDataFeatures(s, (const VkPhysicalDevicePrivateDataFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceProperties2));
+			capture_VkPhysicalDeviceProperties2(s, (const VkPhysicalDeviceProperties2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceProtectedMemoryFeatures));
+			capture_VkPhysicalDeviceProtectedMemoryFeatures(s, (const VkPhysicalDeviceProtectedMemoryFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceProtectedMemoryProperties));
+			capture_VkPhysicalDeviceProtectedMemoryProperties(s, (const VkPhysicalDeviceProtectedMemoryProperties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceSamplerFilterMinmaxProperties));
+			capture_VkPhysicalDeviceSamplerFilterMinmaxProperties(s, (const VkPhysicalDeviceSamplerFilterMinmaxProperties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceSamplerYcbcrConversionFeatures));
+			capture_VkPhysicalDeviceSamplerYcbcrConversionFeatures(s, (const VkPhysicalDeviceSamplerYcbcrConversionFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceScalarBlockLayoutFeatures));
+			capture_VkPhysicalDeviceScalarBlockLayoutFeatures(s, (const VkPhysicalDeviceScalarBlockLayoutFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SEPARATE_DEPTH_STENCIL_LAYOUTS_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures));
+			capture_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures(s, (const VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_INT64_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceShaderAtomicInt64Features));
+			capture_VkPhysicalDeviceShaderAtomicInt64Features(s, (const VkPhysicalDeviceShaderAtomicInt64Features*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DEMOTE_TO_HELPER_INVOCATION_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures));
+			capture_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures(s, (const VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceShaderDrawParametersFeatures));
+			capture_VkPhysicalDeviceShaderDrawParametersFeatures(s, (const VkPhysicalDeviceShaderDrawParametersFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceShaderFloat16Int8Features));
+			capture_VkPhysicalDeviceShaderFloat16Int8Features(s, (const VkPhysicalDeviceShaderFloat16Int8Features*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceShaderIntegerDotProductFeatures));
+			capture_VkPhysicalDeviceShaderIntegerDotProductFeatures(s, (const VkPhysicalDeviceShaderIntegerDotProductFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceShaderIntegerDotProductProperties));
+			capture_VkPhysicalDeviceShaderIntegerDotProductProperties(s, (const VkPhysicalDeviceShaderIntegerDotProductProperties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_EXTENDED_TYPES_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures));
+			capture_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures(s, (const VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TERMINATE_INVOCATION_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceShaderTerminateInvocationFeatures));
+			capture_VkPhysicalDeviceShaderTerminateInvocationFeatures(s, (const VkPhysicalDeviceShaderTerminateInvocationFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SPARSE_IMAGE_FORMAT_INFO_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceSparseImageFormatInfo2));
+			capture_VkPhysicalDeviceSparseImageFormatInfo2(s, (const VkPhysicalDeviceSparseImageFormatInfo2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceSubgroupProperties));
+			capture_VkPhysicalDeviceSubgroupProperties(s, (const VkPhysicalDeviceSubgroupProperties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceSubgroupSizeControlFeatures));
+			capture_VkPhysicalDeviceSubgroupSizeControlFeatures(s, (const VkPhysicalDeviceSubgroupSizeControlFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceSubgroupSizeControlProperties));
+			capture_VkPhysicalDeviceSubgroupSizeControlProperties(s, (const VkPhysicalDeviceSubgroupSizeControlProperties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SURFACE_INFO_2_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceSurfaceInfo2KHR));
+			capture_VkPhysicalDeviceSurfaceInfo2KHR(s, (const VkPhysicalDeviceSurfaceInfo2KHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceSynchronization2Features));
+			capture_VkPhysicalDeviceSynchronization2Features(s, (const VkPhysicalDeviceSynchronization2Features*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceTexelBufferAlignmentProperties));
+			capture_VkPhysicalDeviceTexelBufferAlignmentProperties(s, (const VkPhysicalDeviceTexelBufferAlignmentProperties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_HDR_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceTextureCompressionASTCHDRFeatures));
+			capture_VkPhysicalDeviceTextureCompressionASTCHDRFeatures(s, (const VkPhysicalDeviceTextureCompressionASTCHDRFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceTimelineSemaphoreFeatures));
+			capture_VkPhysicalDeviceTimelineSemaphoreFeatures(s, (const VkPhysicalDeviceTimelineSemaphoreFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceTimelineSemaphoreProperties));
+			capture_VkPhysicalDeviceTimelineSemaphoreProperties(s, (const VkPhysicalDeviceTimelineSemaphoreProperties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TOOL_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceToolProperties));
+			capture_VkPhysicalDeviceToolProperties(s, (const VkPhysicalDeviceToolProperties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFORM_BUFFER_STANDARD_LAYOUT_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceUniformBufferStandardLayoutFeatures));
+			capture_VkPhysicalDeviceUniformBufferStandardLayoutFeatures(s, (const VkPhysicalDeviceUniformBufferStandardLayoutFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceVariablePointersFeatures));
+			capture_VkPhysicalDeviceVariablePointersFeatures(s, (const VkPhysicalDeviceVariablePointersFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceVulkan11Features));
+			capture_VkPhysicalDeviceVulkan11Features(s, (const VkPhysicalDeviceVulkan11Features*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceVulkan11Properties));
+			capture_VkPhysicalDeviceVulkan11Properties(s, (const VkPhysicalDeviceVulkan11Properties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceVulkan12Features));
+			capture_VkPhysicalDeviceVulkan12Features(s, (const VkPhysicalDeviceVulkan12Features*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceVulkan12Properties));
+			capture_VkPhysicalDeviceVulkan12Properties(s, (const VkPhysicalDeviceVulkan12Properties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceVulkan13Features));
+			capture_VkPhysicalDeviceVulkan13Features(s, (const VkPhysicalDeviceVulkan13Features*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceVulkan13Properties));
+			capture_VkPhysicalDeviceVulkan13Properties(s, (const VkPhysicalDeviceVulkan13Properties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceVulkanMemoryModelFeatures));
+			capture_VkPhysicalDeviceVulkanMemoryModelFeatures(s, (const VkPhysicalDeviceVulkanMemoryModelFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ZERO_INITIALIZE_WORKGROUP_MEMORY_FEATURES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures));
+			capture_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures(s, (const VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPipelineCacheCreateInfo));
+			capture_VkPipelineCacheCreateInfo(s, (const VkPipelineCacheCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPipelineColorBlendStateCreateInfo));
+			capture_VkPipelineColorBlendStateCreateInfo(s, (const VkPipelineColorBlendStateCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPipelineCreationFeedbackCreateInfo));
+			capture_VkPipelineCreationFeedbackCreateInfo(s, (const VkPipelineCreationFeedbackCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPipelineDepthStencilStateCreateInfo));
+			capture_VkPipelineDepthStencilStateCreateInfo(s, (const VkPipelineDepthStencilStateCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPipelineDynamicStateCreateInfo));
+			capture_VkPipelineDynamicStateCreateInfo(s, (const VkPipelineDynamicStateCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPipelineInputAssemblyStateCreateInfo));
+			capture_VkPipelineInputAssemblyStateCreateInfo(s, (const VkPipelineInputAssemblyStateCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPipelineLayoutCreateInfo));
+			capture_VkPipelineLayoutCreateInfo(s, (const VkPipelineLayoutCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPipelineLibraryCreateInfoKHR));
+			capture_VkPipelineLibraryCreateInfoKHR(s, (const VkPipelineLibraryCreateInfoKHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPipelineMultisampleStateCreateInfo));
+			capture_VkPipelineMultisampleStateCreateInfo(s, (const VkPipelineMultisampleStateCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPipelineRasterizationStateCreateInfo));
+			capture_VkPipelineRasterizationStateCreateInfo(s, (const VkPipelineRasterizationStateCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPipelineRenderingCreateInfo));
+			capture_VkPipelineRenderingCreateInfo(s, (const VkPipelineRenderingCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPipelineShaderStageCreateInfo));
+			capture_VkPipelineShaderStageCreateInfo(s, (const VkPipelineShaderStageCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPipelineShaderStageRequiredSubgroupSizeCreateInfo));
+			capture_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo(s, (const VkPipelineShaderStageRequiredSubgroupSizeCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPipelineTessellationDomainOriginStateCreateInfo));
+			capture_VkPipelineTessellationDomainOriginStateCreateInfo(s, (const VkPipelineTessellationDomainOriginStateCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPipelineTessellationStateCreateInfo));
+			capture_VkPipelineTessellationStateCreateInfo(s, (const VkPipelineTessellationStateCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPipelineVertexInputStateCreateInfo));
+			capture_VkPipelineVertexInputStateCreateInfo(s, (const VkPipelineVertexInputStateCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPipelineViewportStateCreateInfo));
+			capture_VkPipelineViewportStateCreateInfo(s, (const VkPipelineViewportStateCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PRESENT_INFO_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPresentInfoKHR));
+			capture_VkPresentInfoKHR(s, (const VkPresentInfoKHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PRIVATE_DATA_SLOT_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkPrivateDataSlotCreateInfo));
+			capture_VkPrivateDataSlotCreateInfo(s, (const VkPrivateDataSlotCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkProtectedSubmitInfo));
+			capture_VkProtectedSubmitInfo(s, (const VkProtectedSubmitInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkQueryPoolCreateInfo));
+			capture_VkQueryPoolCreateInfo(s, (const VkQueryPoolCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkQueueFamilyProperties2));
+			capture_VkQueueFamilyProperties2(s, (const VkQueueFamilyProperties2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkRenderPassAttachmentBeginInfo));
+			capture_VkRenderPassAttachmentBeginInfo(s, (const VkRenderPassAttachmentBeginInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkRenderPassBeginInfo));
+			capture_VkRenderPassBeginInfo(s, (const VkRenderPassBeginInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkRenderPassCreateInfo));
+			capture_VkRenderPassCreateInfo(s, (const VkRenderPassCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkRenderPassCreateInfo2));
+			capture_VkRenderPassCreateInfo2(s, (const VkRenderPassCreateInfo2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkRenderPassInputAttachmentAspectCreateInfo));
+			capture_VkRenderPassInputAttachmentAspectCreateInfo(s, (const VkRenderPassInputAttachmentAspectCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkRenderPassMultiviewCreateInfo));
+			capture_VkRenderPassMultiviewCreateInfo(s, (const VkRenderPassMultiviewCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkRenderingAttachmentInfo));
+			capture_VkRenderingAttachmentInfo(s, (const VkRenderingAttachmentInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_RENDERING_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkRenderingInfo));
+			capture_VkRenderingInfo(s, (const VkRenderingInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_RESOLVE_IMAGE_INFO_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkResolveImageInfo2));
+			capture_VkResolveImageInfo2(s, (const VkResolveImageInfo2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSamplerCreateInfo));
+			capture_VkSamplerCreateInfo(s, (const VkSamplerCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSamplerReductionModeCreateInfo));
+			capture_VkSamplerReductionModeCreateInfo(s, (const VkSamplerReductionModeCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSamplerYcbcrConversionCreateInfo));
+			capture_VkSamplerYcbcrConversionCreateInfo(s, (const VkSamplerYcbcrConversionCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_FORMAT_PROPERTIES:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSamplerYcbcrConversionImageFormatProperties));
+			capture_VkSamplerYcbcrConversionImageFormatProperties(s, (const VkSamplerYcbcrConversionImageFormatProperties*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSamplerYcbcrConversionInfo));
+			capture_VkSamplerYcbcrConversionInfo(s, (const VkSamplerYcbcrConversionInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSemaphoreCreateInfo));
+			capture_VkSemaphoreCreateInfo(s, (const VkSemaphoreCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SEMAPHORE_GET_FD_INFO_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSemaphoreGetFdInfoKHR));
+			capture_VkSemaphoreGetFdInfoKHR(s, (const VkSemaphoreGetFdInfoKHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSemaphoreSignalInfo));
+			capture_VkSemaphoreSignalInfo(s, (const VkSemaphoreSignalInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSemaphoreSubmitInfo));
+			capture_VkSemaphoreSubmitInfo(s, (const VkSemaphoreSubmitInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSemaphoreTypeCreateInfo));
+			capture_VkSemaphoreTypeCreateInfo(s, (const VkSemaphoreTypeCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSemaphoreWaitInfo));
+			capture_VkSemaphoreWaitInfo(s, (const VkSemaphoreWaitInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkShaderModuleCreateInfo));
+			capture_VkShaderModuleCreateInfo(s, (const VkShaderModuleCreateInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SPARSE_IMAGE_FORMAT_PROPERTIES_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSparseImageFormatProperties2));
+			capture_VkSparseImageFormatProperties2(s, (const VkSparseImageFormatProperties2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SPARSE_IMAGE_MEMORY_REQUIREMENTS_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSparseImageMemoryRequirements2));
+			capture_VkSparseImageMemoryRequirements2(s, (const VkSparseImageMemoryRequirements2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SUBMIT_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSubmitInfo));
+			capture_VkSubmitInfo(s, (const VkSubmitInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SUBMIT_INFO_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSubmitInfo2));
+			capture_VkSubmitInfo2(s, (const VkSubmitInfo2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SUBPASS_BEGIN_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSubpassBeginInfo));
+			capture_VkSubpassBeginInfo(s, (const VkSubpassBeginInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SUBPASS_DEPENDENCY_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSubpassDependency2));
+			capture_VkSubpassDependency2(s, (const VkSubpassDependency2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_2:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSubpassDescription2));
+			capture_VkSubpassDescription2(s, (const VkSubpassDescription2*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENCIL_RESOLVE:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSubpassDescriptionDepthStencilResolve));
+			capture_VkSubpassDescriptionDepthStencilResolve(s, (const VkSubpassDescriptionDepthStencilResolve*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SUBPASS_END_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSubpassEndInfo));
+			capture_VkSubpassEndInfo(s, (const VkSubpassEndInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSurfaceCapabilities2KHR));
+			capture_VkSurfaceCapabilities2KHR(s, (const VkSurfaceCapabilities2KHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SURFACE_FORMAT_2_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSurfaceFormat2KHR));
+			capture_VkSurfaceFormat2KHR(s, (const VkSurfaceFormat2KHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SURFACE_PROTECTED_CAPABILITIES_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSurfaceProtectedCapabilitiesKHR));
+			capture_VkSurfaceProtectedCapabilitiesKHR(s, (const VkSurfaceProtectedCapabilitiesKHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkSwapchainCreateInfoKHR));
+			capture_VkSwapchainCreateInfoKHR(s, (const VkSwapchainCreateInfoKHR*)n);
+			return;
+		case VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkTimelineSemaphoreSubmitInfo));
+			capture_VkTimelineSemaphoreSubmitInfo(s, (const VkTimelineSemaphoreSubmitInfo*)n);
+			return;
+		case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkWriteDescriptorSet));
+			capture_VkWriteDescriptorSet(s, (const VkWriteDescriptorSet*)n);
+			return;
+		case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK:
+			capture_u32(s, n->sType);
+			capture_raw(s, n, sizeof(VkWriteDescriptorSetInlineUniformBlock));
+			capture_VkWriteDescriptorSetInlineUniformBlock(s, (const VkWriteDescriptorSetInlineUniformBlock*)n);
+			return;
+		default:
+			break;
+		}
+	}
+	capture_u32(s, 0x7FFFFFFF);
+}
+
+static void* replay_next(vksReplay* r, vksReader* rd) {
+	uint32_t sType;
+	replay_raw(rd, &sType, sizeof(sType));
+	switch (sType) {
+	case VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHR: {
+		VkAcquireNextImageInfoKHR* p = replay_alloc(r, sizeof(VkAcquireNextImageInfoKHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkAcquireNextImageInfoKHR));
+		replay_VkAcquireNextImageInfoKHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_APPLICATION_INFO: {
+		VkApplicationInfo* p = replay_alloc(r, sizeof(VkApplicationInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkApplicationInfo));
+		replay_VkApplicationInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_2: {
+		VkAttachmentDescription2* p = replay_alloc(r, sizeof(VkAttachmentDescription2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkAttachmentDescription2));
+		replay_VkAttachmentDescription2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT: {
+		VkAttachmentDescriptionStencilLayout* p = replay_alloc(r, sizeof(VkAttachmentDescriptionStencilLayout));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkAttachmentDescriptionStencilLayout));
+		replay_VkAttachmentDescriptionStencilLayout(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2: {
+		VkAttachmentReference2* p = replay_alloc(r, sizeof(VkAttachmentReference2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkAttachmentReference2));
+		replay_VkAttachmentReference2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT: {
+		VkAttachmentReferenceStencilLayout* p = replay_alloc(r, sizeof(VkAttachmentReferenceStencilLayout));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkAttachmentReferenceStencilLayout));
+		replay_VkAttachmentReferenceStencilLayout(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO: {
+		VkBindBufferMemoryDeviceGroupInfo* p = replay_alloc(r, sizeof(VkBindBufferMemoryDeviceGroupInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkBindBufferMemoryDeviceGroupInfo));
+		replay_VkBindBufferMemoryDeviceGroupInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_INFO: {
+		VkBindBufferMemoryInfo* p = replay_alloc(r, sizeof(VkBindBufferMemoryInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkBindBufferMemoryInfo));
+		replay_VkBindBufferMemoryInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO: {
+		VkBindImageMemoryDeviceGroupInfo* p = replay_alloc(r, sizeof(VkBindImageMemoryDeviceGroupInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkBindImageMemoryDeviceGroupInfo));
+		replay_VkBindImageMemoryDeviceGroupInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_INFO: {
+		VkBindImageMemoryInfo* p = replay_alloc(r, sizeof(VkBindImageMemoryInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkBindImageMemoryInfo));
+		replay_VkBindImageMemoryInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR: {
+		VkBindImageMemorySwapchainInfoKHR* p = replay_alloc(r, sizeof(VkBindImageMemorySwapchainInfoKHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkBindImageMemorySwapchainInfoKHR));
+		replay_VkBindImageMemorySwapchainInfoKHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO: {
+		VkBindImagePlaneMemoryInfo* p = replay_alloc(r, sizeof(VkBindImagePlaneMemoryInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkBindImagePlaneMemoryInfo));
+		replay_VkBindImagePlaneMemoryInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_BIND_SPARSE_INFO: {
+		VkBindSparseInfo* p = replay_alloc(r, sizeof(VkBindSparseInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkBindSparseInfo));
+		replay_VkBindSparseInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_BLIT_IMAGE_INFO_2: {
+		VkBlitImageInfo2* p = replay_alloc(r, sizeof(VkBlitImageInfo2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkBlitImageInfo2));
+		replay_VkBlitImageInfo2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_BUFFER_COPY_2: {
+		VkBufferCopy2* p = replay_alloc(r, sizeof(VkBufferCopy2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkBufferCopy2));
+		replay_VkBufferCopy2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO: {
+		VkBufferCreateInfo* p = replay_alloc(r, sizeof(VkBufferCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkBufferCreateInfo));
+		replay_VkBufferCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO: {
+		VkBufferDeviceAddressInfo* p = replay_alloc(r, sizeof(VkBufferDeviceAddressInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkBufferDeviceAddressInfo));
+		replay_VkBufferDeviceAddressInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2: {
+		VkBufferImageCopy2* p = replay_alloc(r, sizeof(VkBufferImageCopy2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkBufferImageCopy2));
+		replay_VkBufferImageCopy2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER: {
+		VkBufferMemoryBarrier* p = replay_alloc(r, sizeof(VkBufferMemoryBarrier));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkBufferMemoryBarrier));
+		replay_VkBufferMemoryBarrier(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2: {
+		VkBufferMemoryBarrier2* p = replay_alloc(r, sizeof(VkBufferMemoryBarrier2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkBufferMemoryBarrier2));
+		replay_VkBufferMemoryBarrier2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2: {
+		VkBufferMemoryRequirementsInfo2* p = replay_alloc(r, sizeof(VkBufferMemoryRequirementsInfo2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkBufferMemoryRequirementsInfo2));
+		replay_VkBufferMemoryRequirementsInfo2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO: {
+		VkBufferOpaqueCaptureAddressCreateInfo* p = replay_alloc(r, sizeof(VkBufferOpaqueCaptureAddressCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkBufferOpaqueCaptureAddressCreateInfo));
+		replay_VkBufferOpaqueCaptureAddressCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_BUFFER_VIEW_CREATE_INFO: {
+		VkBufferViewCreateInfo* p = replay_alloc(r, sizeof(VkBufferViewCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkBufferViewCreateInfo));
+		replay_VkBufferViewCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO: {
+		VkCommandBufferAllocateInfo* p = replay_alloc(r, sizeof(VkCommandBufferAllocateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkCommandBufferAllocateInfo));
+		replay_VkCommandBufferAllocateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO: {
+		VkCommandBufferBeginInfo* p = replay_alloc(r, sizeof(VkCommandBufferBeginInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkCommandBufferBeginInfo));
+		replay_VkCommandBufferBeginInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO: {
+		VkCommandBufferInheritanceInfo* p = replay_alloc(r, sizeof(VkCommandBufferInheritanceInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkCommandBufferInheritanceInfo));
+		replay_VkCommandBufferInheritanceInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO: {
+		VkCommandBufferInheritanceRenderingInfo* p = replay_alloc(r, sizeof(VkCommandBufferInheritanceRenderingInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkCommandBufferInheritanceRenderingInfo));
+		replay_VkCommandBufferInheritanceRenderingInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO: {
+		VkCommandBufferSubmitInfo* p = replay_alloc(r, sizeof(VkCommandBufferSubmitInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkCommandBufferSubmitInfo));
+		replay_VkCommandBufferSubmitInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO: {
+		VkCommandPoolCreateInfo* p = replay_alloc(r, sizeof(VkCommandPoolCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkCommandPoolCreateInfo));
+		replay_VkCommandPoolCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO: {
+		VkComputePipelineCreateInfo* p = replay_alloc(r, sizeof(VkComputePipelineCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkComputePipelineCreateInfo));
+		replay_VkComputePipelineCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_COPY_BUFFER_INFO_2: {
+		VkCopyBufferInfo2* p = replay_alloc(r, sizeof(VkCopyBufferInfo2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkCopyBufferInfo2));
+		replay_VkCopyBufferInfo2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_COPY_BUFFER_TO_IMAGE_INFO_2: {
+		VkCopyBufferToImageInfo2* p = replay_alloc(r, sizeof(VkCopyBufferToImageInfo2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkCopyBufferToImageInfo2));
+		replay_VkCopyBufferToImageInfo2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_COPY_DESCRIPTOR_SET: {
+		VkCopyDescriptorSet* p = replay_alloc(r, sizeof(VkCopyDescriptorSet));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkCopyDescriptorSet));
+		replay_VkCopyDescriptorSet(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_COPY_IMAGE_INFO_2: {
+		VkCopyImageInfo2* p = replay_alloc(r, sizeof(VkCopyImageInfo2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkCopyImageInfo2));
+		replay_VkCopyImageInfo2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_COPY_IMAGE_TO_BUFFER_INFO_2: {
+		VkCopyImageToBufferInfo2* p = replay_alloc(r, sizeof(VkCopyImageToBufferInfo2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkCopyImageToBufferInfo2));
+		replay_VkCopyImageToBufferInfo2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT: {
+		VkDebugReportCallbackCreateInfoEXT* p = replay_alloc(r, sizeof(VkDebugReportCallbackCreateInfoEXT));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDebugReportCallbackCreateInfoEXT));
+		replay_VkDebugReportCallbackCreateInfoEXT(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DEPENDENCY_INFO: {
+		VkDependencyInfo* p = replay_alloc(r, sizeof(VkDependencyInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDependencyInfo));
+		replay_VkDependencyInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO: {
+		VkDescriptorPoolCreateInfo* p = replay_alloc(r, sizeof(VkDescriptorPoolCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDescriptorPoolCreateInfo));
+		replay_VkDescriptorPoolCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO: {
+		VkDescriptorPoolInlineUniformBlockCreateInfo* p = replay_alloc(r, sizeof(VkDescriptorPoolInlineUniformBlockCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDescriptorPoolInlineUniformBlockCreateInfo));
+		replay_VkDescriptorPoolInlineUniformBlockCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO: {
+		VkDescriptorSetAllocateInfo* p = replay_alloc(r, sizeof(VkDescriptorSetAllocateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDescriptorSetAllocateInfo));
+		replay_VkDescriptorSetAllocateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO: {
+		VkDescriptorSetLayoutBindingFlagsCreateInfo* p = replay_alloc(r, sizeof(VkDescriptorSetLayoutBindingFlagsCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDescriptorSetLayoutBindingFlagsCreateInfo));
+		replay_VkDescriptorSetLayoutBindingFlagsCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO: {
+		VkDescriptorSetLayoutCreateInfo* p = replay_alloc(r, sizeof(VkDescriptorSetLayoutCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDescriptorSetLayoutCreateInfo));
+		replay_VkDescriptorSetLayoutCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_SUPPORT: {
+		VkDescriptorSetLayoutSupport* p = replay_alloc(r, sizeof(VkDescriptorSetLayoutSupport));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDescriptorSetLayoutSupport));
+		replay_VkDescriptorSetLayoutSupport(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO: {
+		VkDescriptorSetVariableDescriptorCountAllocateInfo* p = replay_alloc(r, sizeof(VkDescriptorSetVariableDescriptorCountAllocateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDescriptorSetVariableDescriptorCountAllocateInfo));
+		replay_VkDescriptorSetVariableDescriptorCountAllocateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT: {
+		VkDescriptorSetVariableDescriptorCountLayoutSupport* p = replay_alloc(r, sizeof(VkDescriptorSetVariableDescriptorCountLayoutSupport));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDescriptorSetVariableDescriptorCountLayoutSupport));
+		replay_VkDescriptorSetVariableDescriptorCountLayoutSupport(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO: {
+		VkDescriptorUpdateTemplateCreateInfo* p = replay_alloc(r, sizeof(VkDescriptorUpdateTemplateCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDescriptorUpdateTemplateCreateInfo));
+		replay_VkDescriptorUpdateTemplateCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DEVICE_BUFFER_MEMORY_REQUIREMENTS: {
+		VkDeviceBufferMemoryRequirements* p = replay_alloc(r, sizeof(VkDeviceBufferMemoryRequirements));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDeviceBufferMemoryRequirements));
+		replay_VkDeviceBufferMemoryRequirements(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO: {
+		VkDeviceCreateInfo* p = replay_alloc(r, sizeof(VkDeviceCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDeviceCreateInfo));
+		replay_VkDeviceCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO: {
+		VkDeviceGroupBindSparseInfo* p = replay_alloc(r, sizeof(VkDeviceGroupBindSparseInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDeviceGroupBindSparseInfo));
+		replay_VkDeviceGroupBindSparseInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO: {
+		VkDeviceGroupCommandBufferBeginInfo* p = replay_alloc(r, sizeof(VkDeviceGroupCommandBufferBeginInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDeviceGroupCommandBufferBeginInfo));
+		replay_VkDeviceGroupCommandBufferBeginInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO: {
+		VkDeviceGroupDeviceCreateInfo* p = replay_alloc(r, sizeof(VkDeviceGroupDeviceCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDeviceGroupDeviceCreateInfo));
+		replay_VkDeviceGroupDeviceCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_CAPABILITIES_KHR: {
+		VkDeviceGroupPresentCapabilitiesKHR* p = replay_alloc(r, sizeof(VkDeviceGroupPresentCapabilitiesKHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDeviceGroupPresentCapabilitiesKHR));
+		replay_VkDeviceGroupPresentCapabilitiesKHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR: {
+		VkDeviceGroupPresentInfoKHR* p = replay_alloc(r, sizeof(VkDeviceGroupPresentInfoKHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDeviceGroupPresentInfoKHR));
+		replay_VkDeviceGroupPresentInfoKHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO: {
+		VkDeviceGroupRenderPassBeginInfo* p = replay_alloc(r, sizeof(VkDeviceGroupRenderPassBeginInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDeviceGroupRenderPassBeginInfo));
+		replay_VkDeviceGroupRenderPassBeginInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO: {
+		VkDeviceGroupSubmitInfo* p = replay_alloc(r, sizeof(VkDeviceGroupSubmitInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDeviceGroupSubmitInfo));
+		replay_VkDeviceGroupSubmitInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR: {
+		VkDeviceGroupSwapchainCreateInfoKHR* p = replay_alloc(r, sizeof(VkDeviceGroupSwapchainCreateInfoKHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDeviceGroupSwapchainCreateInfoKHR));
+		replay_VkDeviceGroupSwapchainCreateInfoKHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS: {
+		VkDeviceImageMemoryRequirements* p = replay_alloc(r, sizeof(VkDeviceImageMemoryRequirements));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDeviceImageMemoryRequirements));
+		replay_VkDeviceImageMemoryRequirements(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DEVICE_MEMORY_OPAQUE_CAPTURE_ADDRESS_INFO: {
+		VkDeviceMemoryOpaqueCaptureAddressInfo* p = replay_alloc(r, sizeof(VkDeviceMemoryOpaqueCaptureAddressInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDeviceMemoryOpaqueCaptureAddressInfo));
+		replay_VkDeviceMemoryOpaqueCaptureAddressInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO: {
+		VkDevicePrivateDataCreateInfo* p = replay_alloc(r, sizeof(VkDevicePrivateDataCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDevicePrivateDataCreateInfo));
+		replay_VkDevicePrivateDataCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DEVICE_QUEUE_CREATE_INFO: {
+		VkDeviceQueueCreateInfo* p = replay_alloc(r, sizeof(VkDeviceQueueCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDeviceQueueCreateInfo));
+		replay_VkDeviceQueueCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DEVICE_QUEUE_INFO_2: {
+		VkDeviceQueueInfo2* p = replay_alloc(r, sizeof(VkDeviceQueueInfo2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDeviceQueueInfo2));
+		replay_VkDeviceQueueInfo2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DISPLAY_MODE_CREATE_INFO_KHR: {
+		VkDisplayModeCreateInfoKHR* p = replay_alloc(r, sizeof(VkDisplayModeCreateInfoKHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDisplayModeCreateInfoKHR));
+		replay_VkDisplayModeCreateInfoKHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DISPLAY_MODE_PROPERTIES_2_KHR: {
+		VkDisplayModeProperties2KHR* p = replay_alloc(r, sizeof(VkDisplayModeProperties2KHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDisplayModeProperties2KHR));
+		replay_VkDisplayModeProperties2KHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DISPLAY_PLANE_CAPABILITIES_2_KHR: {
+		VkDisplayPlaneCapabilities2KHR* p = replay_alloc(r, sizeof(VkDisplayPlaneCapabilities2KHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDisplayPlaneCapabilities2KHR));
+		replay_VkDisplayPlaneCapabilities2KHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DISPLAY_PLANE_INFO_2_KHR: {
+		VkDisplayPlaneInfo2KHR* p = replay_alloc(r, sizeof(VkDisplayPlaneInfo2KHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDisplayPlaneInfo2KHR));
+		replay_VkDisplayPlaneInfo2KHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DISPLAY_PLANE_PROPERTIES_2_KHR: {
+		VkDisplayPlaneProperties2KHR* p = replay_alloc(r, sizeof(VkDisplayPlaneProperties2KHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDisplayPlaneProperties2KHR));
+		replay_VkDisplayPlaneProperties2KHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR: {
+		VkDisplayPresentInfoKHR* p = replay_alloc(r, sizeof(VkDisplayPresentInfoKHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDisplayPresentInfoKHR));
+		replay_VkDisplayPresentInfoKHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DISPLAY_PROPERTIES_2_KHR: {
+		VkDisplayProperties2KHR* p = replay_alloc(r, sizeof(VkDisplayProperties2KHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDisplayProperties2KHR));
+		replay_VkDisplayProperties2KHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_DISPLAY_SURFACE_CREATE_INFO_KHR: {
+		VkDisplaySurfaceCreateInfoKHR* p = replay_alloc(r, sizeof(VkDisplaySurfaceCreateInfoKHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkDisplaySurfaceCreateInfoKHR));
+		replay_VkDisplaySurfaceCreateInfoKHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_EVENT_CREATE_INFO: {
+		VkEventCreateInfo* p = replay_alloc(r, sizeof(VkEventCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkEventCreateInfo));
+		replay_VkEventCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO: {
+		VkExportFenceCreateInfo* p = replay_alloc(r, sizeof(VkExportFenceCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkExportFenceCreateInfo));
+		replay_VkExportFenceCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO: {
+		VkExportMemoryAllocateInfo* p = replay_alloc(r, sizeof(VkExportMemoryAllocateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkExportMemoryAllocateInfo));
+		replay_VkExportMemoryAllocateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO: {
+		VkExportSemaphoreCreateInfo* p = replay_alloc(r, sizeof(VkExportSemaphoreCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkExportSemaphoreCreateInfo));
+		replay_VkExportSemaphoreCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_EXTERNAL_BUFFER_PROPERTIES: {
+		VkExternalBufferProperties* p = replay_alloc(r, sizeof(VkExternalBufferProperties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkExternalBufferProperties));
+		replay_VkExternalBufferProperties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_EXTERNAL_FENCE_PROPERTIES: {
+		VkExternalFenceProperties* p = replay_alloc(r, sizeof(VkExternalFenceProperties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkExternalFenceProperties));
+		replay_VkExternalFenceProperties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES: {
+		VkExternalImageFormatProperties* p = replay_alloc(r, sizeof(VkExternalImageFormatProperties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkExternalImageFormatProperties));
+		replay_VkExternalImageFormatProperties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO: {
+		VkExternalMemoryBufferCreateInfo* p = replay_alloc(r, sizeof(VkExternalMemoryBufferCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkExternalMemoryBufferCreateInfo));
+		replay_VkExternalMemoryBufferCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO: {
+		VkExternalMemoryImageCreateInfo* p = replay_alloc(r, sizeof(VkExternalMemoryImageCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkExternalMemoryImageCreateInfo));
+		replay_VkExternalMemoryImageCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_EXTERNAL_SEMAPHORE_PROPERTIES: {
+		VkExternalSemaphoreProperties* p = replay_alloc(r, sizeof(VkExternalSemaphoreProperties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkExternalSemaphoreProperties));
+		replay_VkExternalSemaphoreProperties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_FENCE_CREATE_INFO: {
+		VkFenceCreateInfo* p = replay_alloc(r, sizeof(VkFenceCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkFenceCreateInfo));
+		replay_VkFenceCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2: {
+		VkFormatProperties2* p = replay_alloc(r, sizeof(VkFormatProperties2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkFormatProperties2));
+		replay_VkFormatProperties2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3: {
+		VkFormatProperties3* p = replay_alloc(r, sizeof(VkFormatProperties3));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkFormatProperties3));
+		replay_VkFormatProperties3(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENT_IMAGE_INFO: {
+		VkFramebufferAttachmentImageInfo* p = replay_alloc(r, sizeof(VkFramebufferAttachmentImageInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkFramebufferAttachmentImageInfo));
+		replay_VkFramebufferAttachmentImageInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO: {
+		VkFramebufferAttachmentsCreateInfo* p = replay_alloc(r, sizeof(VkFramebufferAttachmentsCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkFramebufferAttachmentsCreateInfo));
+		replay_VkFramebufferAttachmentsCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO: {
+		VkFramebufferCreateInfo* p = replay_alloc(r, sizeof(VkFramebufferCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkFramebufferCreateInfo));
+		replay_VkFramebufferCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_CREATE_INFO: {
+		VkGraphicsPipelineCreateInfo* p = replay_alloc(r, sizeof(VkGraphicsPipelineCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkGraphicsPipelineCreateInfo));
+		replay_VkGraphicsPipelineCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT: {
+		VkGraphicsPipelineLibraryCreateInfoEXT* p = replay_alloc(r, sizeof(VkGraphicsPipelineLibraryCreateInfoEXT));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkGraphicsPipelineLibraryCreateInfoEXT));
+		replay_VkGraphicsPipelineLibraryCreateInfoEXT(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_IMAGE_BLIT_2: {
+		VkImageBlit2* p = replay_alloc(r, sizeof(VkImageBlit2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkImageBlit2));
+		replay_VkImageBlit2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_IMAGE_COPY_2: {
+		VkImageCopy2* p = replay_alloc(r, sizeof(VkImageCopy2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkImageCopy2));
+		replay_VkImageCopy2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO: {
+		VkImageCreateInfo* p = replay_alloc(r, sizeof(VkImageCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkImageCreateInfo));
+		replay_VkImageCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO: {
+		VkImageFormatListCreateInfo* p = replay_alloc(r, sizeof(VkImageFormatListCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkImageFormatListCreateInfo));
+		replay_VkImageFormatListCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2: {
+		VkImageFormatProperties2* p = replay_alloc(r, sizeof(VkImageFormatProperties2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkImageFormatProperties2));
+		replay_VkImageFormatProperties2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER: {
+		VkImageMemoryBarrier* p = replay_alloc(r, sizeof(VkImageMemoryBarrier));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkImageMemoryBarrier));
+		replay_VkImageMemoryBarrier(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2: {
+		VkImageMemoryBarrier2* p = replay_alloc(r, sizeof(VkImageMemoryBarrier2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkImageMemoryBarrier2));
+		replay_VkImageMemoryBarrier2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2: {
+		VkImageMemoryRequirementsInfo2* p = replay_alloc(r, sizeof(VkImageMemoryRequirementsInfo2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkImageMemoryRequirementsInfo2));
+		replay_VkImageMemoryRequirementsInfo2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO: {
+		VkImagePlaneMemoryRequirementsInfo* p = replay_alloc(r, sizeof(VkImagePlaneMemoryRequirementsInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkImagePlaneMemoryRequirementsInfo));
+		replay_VkImagePlaneMemoryRequirementsInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_IMAGE_RESOLVE_2: {
+		VkImageResolve2* p = replay_alloc(r, sizeof(VkImageResolve2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkImageResolve2));
+		replay_VkImageResolve2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_IMAGE_SPARSE_MEMORY_REQUIREMENTS_INFO_2: {
+		VkImageSparseMemoryRequirementsInfo2* p = replay_alloc(r, sizeof(VkImageSparseMemoryRequirementsInfo2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkImageSparseMemoryRequirementsInfo2));
+		replay_VkImageSparseMemoryRequirementsInfo2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO: {
+		VkImageStencilUsageCreateInfo* p = replay_alloc(r, sizeof(VkImageStencilUsageCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkImageStencilUsageCreateInfo));
+		replay_VkImageStencilUsageCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR: {
+		VkImageSwapchainCreateInfoKHR* p = replay_alloc(r, sizeof(VkImageSwapchainCreateInfoKHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkImageSwapchainCreateInfoKHR));
+		replay_VkImageSwapchainCreateInfoKHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_IMAGE_VIEW_CREATE_INFO: {
+		VkImageViewCreateInfo* p = replay_alloc(r, sizeof(VkImageViewCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkImageViewCreateInfo));
+		replay_VkImageViewCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO: {
+		VkImageViewUsageCreateInfo* p = replay_alloc(r, sizeof(VkImageViewUsageCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkImageViewUsageCreateInfo));
+		replay_VkImageViewUsageCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR: {
+		VkImportMemoryFdInfoKHR* p = replay_alloc(r, sizeof(VkImportMemoryFdInfoKHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkImportMemoryFdInfoKHR));
+		replay_VkImportMemoryFdInfoKHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_FD_INFO_KHR: {
+		VkImportSemaphoreFdInfoKHR* p = replay_alloc(r, sizeof(VkImportSemaphoreFdInfoKHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkImportSemaphoreFdInfoKHR));
+		replay_VkImportSemaphoreFdInfoKHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_INSTANCE_CREATE_INFO: {
+		VkInstanceCreateInfo* p = replay_alloc(r, sizeof(VkInstanceCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkInstanceCreateInfo));
+		replay_VkInstanceCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE: {
+		VkMappedMemoryRange* p = replay_alloc(r, sizeof(VkMappedMemoryRange));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkMappedMemoryRange));
+		replay_VkMappedMemoryRange(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO: {
+		VkMemoryAllocateFlagsInfo* p = replay_alloc(r, sizeof(VkMemoryAllocateFlagsInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkMemoryAllocateFlagsInfo));
+		replay_VkMemoryAllocateFlagsInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO: {
+		VkMemoryAllocateInfo* p = replay_alloc(r, sizeof(VkMemoryAllocateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkMemoryAllocateInfo));
+		replay_VkMemoryAllocateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_MEMORY_BARRIER: {
+		VkMemoryBarrier* p = replay_alloc(r, sizeof(VkMemoryBarrier));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkMemoryBarrier));
+		replay_VkMemoryBarrier(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_MEMORY_BARRIER_2: {
+		VkMemoryBarrier2* p = replay_alloc(r, sizeof(VkMemoryBarrier2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkMemoryBarrier2));
+		replay_VkMemoryBarrier2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO: {
+		VkMemoryDedicatedAllocateInfo* p = replay_alloc(r, sizeof(VkMemoryDedicatedAllocateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkMemoryDedicatedAllocateInfo));
+		replay_VkMemoryDedicatedAllocateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS: {
+		VkMemoryDedicatedRequirements* p = replay_alloc(r, sizeof(VkMemoryDedicatedRequirements));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkMemoryDedicatedRequirements));
+		replay_VkMemoryDedicatedRequirements(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHR: {
+		VkMemoryFdPropertiesKHR* p = replay_alloc(r, sizeof(VkMemoryFdPropertiesKHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkMemoryFdPropertiesKHR));
+		replay_VkMemoryFdPropertiesKHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR: {
+		VkMemoryGetFdInfoKHR* p = replay_alloc(r, sizeof(VkMemoryGetFdInfoKHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkMemoryGetFdInfoKHR));
+		replay_VkMemoryGetFdInfoKHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO: {
+		VkMemoryOpaqueCaptureAddressAllocateInfo* p = replay_alloc(r, sizeof(VkMemoryOpaqueCaptureAddressAllocateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkMemoryOpaqueCaptureAddressAllocateInfo));
+		replay_VkMemoryOpaqueCaptureAddressAllocateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2: {
+		VkMemoryRequirements2* p = replay_alloc(r, sizeof(VkMemoryRequirements2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkMemoryRequirements2));
+		replay_VkMemoryRequirements2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES: {
+		VkPhysicalDevice16BitStorageFeatures* p = replay_alloc(r, sizeof(VkPhysicalDevice16BitStorageFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDevice16BitStorageFeatures));
+		replay_VkPhysicalDevice16BitStorageFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES: {
+		VkPhysicalDevice8BitStorageFeatures* p = replay_alloc(r, sizeof(VkPhysicalDevice8BitStorageFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDevice8BitStorageFeatures));
+		replay_VkPhysicalDevice8BitStorageFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES: {
+		VkPhysicalDeviceBufferDeviceAddressFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceBufferDeviceAddressFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceBufferDeviceAddressFeatures));
+		replay_VkPhysicalDeviceBufferDeviceAddressFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_STENCIL_RESOLVE_PROPERTIES: {
+		VkPhysicalDeviceDepthStencilResolveProperties* p = replay_alloc(r, sizeof(VkPhysicalDeviceDepthStencilResolveProperties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceDepthStencilResolveProperties));
+		replay_VkPhysicalDeviceDepthStencilResolveProperties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES: {
+		VkPhysicalDeviceDescriptorIndexingFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceDescriptorIndexingFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceDescriptorIndexingFeatures));
+		replay_VkPhysicalDeviceDescriptorIndexingFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES: {
+		VkPhysicalDeviceDescriptorIndexingProperties* p = replay_alloc(r, sizeof(VkPhysicalDeviceDescriptorIndexingProperties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceDescriptorIndexingProperties));
+		replay_VkPhysicalDeviceDescriptorIndexingProperties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTIES: {
+		VkPhysicalDeviceDriverProperties* p = replay_alloc(r, sizeof(VkPhysicalDeviceDriverProperties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceDriverProperties));
+		replay_VkPhysicalDeviceDriverProperties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES: {
+		VkPhysicalDeviceDynamicRenderingFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceDynamicRenderingFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceDynamicRenderingFeatures));
+		replay_VkPhysicalDeviceDynamicRenderingFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_BUFFER_INFO: {
+		VkPhysicalDeviceExternalBufferInfo* p = replay_alloc(r, sizeof(VkPhysicalDeviceExternalBufferInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceExternalBufferInfo));
+		replay_VkPhysicalDeviceExternalBufferInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_FENCE_INFO: {
+		VkPhysicalDeviceExternalFenceInfo* p = replay_alloc(r, sizeof(VkPhysicalDeviceExternalFenceInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceExternalFenceInfo));
+		replay_VkPhysicalDeviceExternalFenceInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO: {
+		VkPhysicalDeviceExternalImageFormatInfo* p = replay_alloc(r, sizeof(VkPhysicalDeviceExternalImageFormatInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceExternalImageFormatInfo));
+		replay_VkPhysicalDeviceExternalImageFormatInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_SEMAPHORE_INFO: {
+		VkPhysicalDeviceExternalSemaphoreInfo* p = replay_alloc(r, sizeof(VkPhysicalDeviceExternalSemaphoreInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceExternalSemaphoreInfo));
+		replay_VkPhysicalDeviceExternalSemaphoreInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2: {
+		VkPhysicalDeviceFeatures2* p = replay_alloc(r, sizeof(VkPhysicalDeviceFeatures2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceFeatures2));
+		replay_VkPhysicalDeviceFeatures2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_PROPERTIES: {
+		VkPhysicalDeviceFloatControlsProperties* p = replay_alloc(r, sizeof(VkPhysicalDeviceFloatControlsProperties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceFloatControlsProperties));
+		replay_VkPhysicalDeviceFloatControlsProperties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT: {
+		VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT* p = replay_alloc(r, sizeof(VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT));
+		replay_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT: {
+		VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT* p = replay_alloc(r, sizeof(VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT));
+		replay_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES: {
+		VkPhysicalDeviceGroupProperties* p = replay_alloc(r, sizeof(VkPhysicalDeviceGroupProperties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceGroupProperties));
+		replay_VkPhysicalDeviceGroupProperties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES: {
+		VkPhysicalDeviceHostQueryResetFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceHostQueryResetFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceHostQueryResetFeatures));
+		replay_VkPhysicalDeviceHostQueryResetFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES: {
+		VkPhysicalDeviceIDProperties* p = replay_alloc(r, sizeof(VkPhysicalDeviceIDProperties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceIDProperties));
+		replay_VkPhysicalDeviceIDProperties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2: {
+		VkPhysicalDeviceImageFormatInfo2* p = replay_alloc(r, sizeof(VkPhysicalDeviceImageFormatInfo2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceImageFormatInfo2));
+		replay_VkPhysicalDeviceImageFormatInfo2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ROBUSTNESS_FEATURES: {
+		VkPhysicalDeviceImageRobustnessFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceImageRobustnessFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceImageRobustnessFeatures));
+		replay_VkPhysicalDeviceImageRobustnessFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES: {
+		VkPhysicalDeviceImagelessFramebufferFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceImagelessFramebufferFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceImagelessFramebufferFeatures));
+		replay_VkPhysicalDeviceImagelessFramebufferFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_FEATURES: {
+		VkPhysicalDeviceInlineUniformBlockFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceInlineUniformBlockFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceInlineUniformBlockFeatures));
+		replay_VkPhysicalDeviceInlineUniformBlockFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_PROPERTIES: {
+		VkPhysicalDeviceInlineUniformBlockProperties* p = replay_alloc(r, sizeof(VkPhysicalDeviceInlineUniformBlockProperties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceInlineUniformBlockProperties));
+		replay_VkPhysicalDeviceInlineUniformBlockProperties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES: {
+		VkPhysicalDeviceMaintenance3Properties* p = replay_alloc(r, sizeof(VkPhysicalDeviceMaintenance3Properties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceMaintenance3Properties));
+		replay_VkPhysicalDeviceMaintenance3Properties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_FEATURES: {
+		VkPhysicalDeviceMaintenance4Features* p = replay_alloc(r, sizeof(VkPhysicalDeviceMaintenance4Features));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceMaintenance4Features));
+		replay_VkPhysicalDeviceMaintenance4Features(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_PROPERTIES: {
+		VkPhysicalDeviceMaintenance4Properties* p = replay_alloc(r, sizeof(VkPhysicalDeviceMaintenance4Properties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceMaintenance4Properties));
+		replay_VkPhysicalDeviceMaintenance4Properties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT: {
+		VkPhysicalDeviceMemoryBudgetPropertiesEXT* p = replay_alloc(r, sizeof(VkPhysicalDeviceMemoryBudgetPropertiesEXT));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceMemoryBudgetPropertiesEXT));
+		replay_VkPhysicalDeviceMemoryBudgetPropertiesEXT(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2: {
+		VkPhysicalDeviceMemoryProperties2* p = replay_alloc(r, sizeof(VkPhysicalDeviceMemoryProperties2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceMemoryProperties2));
+		replay_VkPhysicalDeviceMemoryProperties2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES: {
+		VkPhysicalDeviceMultiviewFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceMultiviewFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceMultiviewFeatures));
+		replay_VkPhysicalDeviceMultiviewFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES: {
+		VkPhysicalDeviceMultiviewProperties* p = replay_alloc(r, sizeof(VkPhysicalDeviceMultiviewProperties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceMultiviewProperties));
+		replay_VkPhysicalDeviceMultiviewProperties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CREATION_CACHE_CONTROL_FEATURES: {
+		VkPhysicalDevicePipelineCreationCacheControlFeatures* p = replay_alloc(r, sizeof(VkPhysicalDevicePipelineCreationCacheControlFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDevicePipelineCreationCacheControlFeatures));
+		replay_VkPhysicalDevicePipelineCreationCacheControlFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_PROPERTIES: {
+		VkPhysicalDevicePointClippingProperties* p = replay_alloc(r, sizeof(VkPhysicalDevicePointClippingProperties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDevicePointClippingProperties));
+		replay_VkPhysicalDevicePointClippingProperties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_FEATURES_KHR: {
+		VkPhysicalDevicePortabilitySubsetFeaturesKHR* p = replay_alloc(r, sizeof(VkPhysicalDevicePortabilitySubsetFeaturesKHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDevicePortabilitySubsetFeaturesKHR));
+		replay_VkPhysicalDevicePortabilitySubsetFeaturesKHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_PROPERTIES_KHR: {
+		VkPhysicalDevicePortabilitySubsetPropertiesKHR* p = replay_alloc(r, sizeof(VkPhysicalDevicePortabilitySubsetPropertiesKHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDevicePortabilitySubsetPropertiesKHR));
+		replay_VkPhysicalDevicePortabilitySubsetPropertiesKHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIVATE_DATA_FEATURES: {
+		VkPhysicalDevicePrivateDataFeatures* p = replay_alloc(r, sizeof(VkPhysicalDevicePrivateDataFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDevicePrivateDataFeatures));
+		replay_VkPhysicalDevicePrivateDataFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2: {
+		VkPhysicalDeviceProperties2* p = replay_alloc(r, sizeof(VkPhysicalDeviceProperties2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceProperties2));
+		replay_VkPhysicalDeviceProperties2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES: {
+		VkPhysicalDeviceProtectedMemoryFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceProtectedMemoryFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceProtectedMemoryFeatures));
+		replay_VkPhysicalDeviceProtectedMemoryFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES: {
+		VkPhysicalDeviceProtectedMemoryProperties* p = replay_alloc(r, sizeof(VkPhysicalDeviceProtectedMemoryProperties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceProtectedMemoryProperties));
+		replay_VkPhysicalDeviceProtectedMemoryProperties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES: {
+		VkPhysicalDeviceSamplerFilterMinmaxProperties* p = replay_alloc(r, sizeof(VkPhysicalDeviceSamplerFilterMinmaxProperties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceSamplerFilterMinmaxProperties));
+		replay_VkPhysicalDeviceSamplerFilterMinmaxProperties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES: {
+		VkPhysicalDeviceSamplerYcbcrConversionFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceSamplerYcbcrConversionFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceSamplerYcbcrConversionFeatures));
+		replay_VkPhysicalDeviceSamplerYcbcrConversionFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES: {
+		VkPhysicalDeviceScalarBlockLayoutFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceScalarBlockLayoutFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceScalarBlockLayoutFeatures));
+		replay_VkPhysicalDeviceScalarBlockLayoutFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SEPARATE_DEPTH_STENCIL_LAYOUTS_FEATURES: {
+		VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures));
+		replay_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_INT64_FEATURES: {
+		VkPhysicalDeviceShaderAtomicInt64Features* p = replay_alloc(r, sizeof(VkPhysicalDeviceShaderAtomicInt64Features));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceShaderAtomicInt64Features));
+		replay_VkPhysicalDeviceShaderAtomicInt64Features(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DEMOTE_TO_HELPER_INVOCATION_FEATURES: {
+		VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures));
+		replay_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES: {
+		VkPhysicalDeviceShaderDrawParametersFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceShaderDrawParametersFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceShaderDrawParametersFeatures));
+		replay_VkPhysicalDeviceShaderDrawParametersFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES: {
+		VkPhysicalDeviceShaderFloat16Int8Features* p = replay_alloc(r, sizeof(VkPhysicalDeviceShaderFloat16Int8Features));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceShaderFloat16Int8Features));
+		replay_VkPhysicalDeviceShaderFloat16Int8Features(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_FEATURES: {
+		VkPhysicalDeviceShaderIntegerDotProductFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceShaderIntegerDotProductFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceShaderIntegerDotProductFeatures));
+		replay_VkPhysicalDeviceShaderIntegerDotProductFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_PROPERTIES: {
+		VkPhysicalDeviceShaderIntegerDotProductProperties* p = replay_alloc(r, sizeof(VkPhysicalDeviceShaderIntegerDotProductProperties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceShaderIntegerDotProductProperties));
+		replay_VkPhysicalDeviceShaderIntegerDotProductProperties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_EXTENDED_TYPES_FEATURES: {
+		VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures));
+		replay_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TERMINATE_INVOCATION_FEATURES: {
+		VkPhysicalDeviceShaderTerminateInvocationFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceShaderTerminateInvocationFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceShaderTerminateInvocationFeatures));
+		replay_VkPhysicalDeviceShaderTerminateInvocationFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SPARSE_IMAGE_FORMAT_INFO_2: {
+		VkPhysicalDeviceSparseImageFormatInfo2* p = replay_alloc(r, sizeof(VkPhysicalDeviceSparseImageFormatInfo2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceSparseImageFormatInfo2));
+		replay_VkPhysicalDeviceSparseImageFormatInfo2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES: {
+		VkPhysicalDeviceSubgroupProperties* p = replay_alloc(r, sizeof(VkPhysicalDeviceSubgroupProperties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceSubgroupProperties));
+		replay_VkPhysicalDeviceSubgroupProperties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES: {
+		VkPhysicalDeviceSubgroupSizeControlFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceSubgroupSizeControlFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceSubgroupSizeControlFeatures));
+		replay_VkPhysicalDeviceSubgroupSizeControlFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES: {
+		VkPhysicalDeviceSubgroupSizeControlProperties* p = replay_alloc(r, sizeof(VkPhysicalDeviceSubgroupSizeControlProperties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceSubgroupSizeControlProperties));
+		replay_VkPhysicalDeviceSubgroupSizeControlProperties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SURFACE_INFO_2_KHR: {
+		VkPhysicalDeviceSurfaceInfo2KHR* p = replay_alloc(r, sizeof(VkPhysicalDeviceSurfaceInfo2KHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceSurfaceInfo2KHR));
+		replay_VkPhysicalDeviceSurfaceInfo2KHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES: {
+		VkPhysicalDeviceSynchronization2Features* p = replay_alloc(r, sizeof(VkPhysicalDeviceSynchronization2Features));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceSynchronization2Features));
+		replay_VkPhysicalDeviceSynchronization2Features(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_PROPERTIES: {
+		VkPhysicalDeviceTexelBufferAlignmentProperties* p = replay_alloc(r, sizeof(VkPhysicalDeviceTexelBufferAlignmentProperties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceTexelBufferAlignmentProperties));
+		replay_VkPhysicalDeviceTexelBufferAlignmentProperties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_HDR_FEATURES: {
+		VkPhysicalDeviceTextureCompressionASTCHDRFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceTextureCompressionASTCHDRFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceTextureCompressionASTCHDRFeatures));
+		replay_VkPhysicalDeviceTextureCompressionASTCHDRFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES: {
+		VkPhysicalDeviceTimelineSemaphoreFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceTimelineSemaphoreFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceTimelineSemaphoreFeatures));
+		replay_VkPhysicalDeviceTimelineSemaphoreFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES: {
+		VkPhysicalDeviceTimelineSemaphoreProperties* p = replay_alloc(r, sizeof(VkPhysicalDeviceTimelineSemaphoreProperties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceTimelineSemaphoreProperties));
+		replay_VkPhysicalDeviceTimelineSemaphoreProperties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TOOL_PROPERTIES: {
+		VkPhysicalDeviceToolProperties* p = replay_alloc(r, sizeof(VkPhysicalDeviceToolProperties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceToolProperties));
+		replay_VkPhysicalDeviceToolProperties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFORM_BUFFER_STANDARD_LAYOUT_FEATURES: {
+		VkPhysicalDeviceUniformBufferStandardLayoutFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceUniformBufferStandardLayoutFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceUniformBufferStandardLayoutFeatures));
+		replay_VkPhysicalDeviceUniformBufferStandardLayoutFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES: {
+		VkPhysicalDeviceVariablePointersFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceVariablePointersFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceVariablePointersFeatures));
+		replay_VkPhysicalDeviceVariablePointersFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES: {
+		VkPhysicalDeviceVulkan11Features* p = replay_alloc(r, sizeof(VkPhysicalDeviceVulkan11Features));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceVulkan11Features));
+		replay_VkPhysicalDeviceVulkan11Features(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES: {
+		VkPhysicalDeviceVulkan11Properties* p = replay_alloc(r, sizeof(VkPhysicalDeviceVulkan11Properties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceVulkan11Properties));
+		replay_VkPhysicalDeviceVulkan11Properties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES: {
+		VkPhysicalDeviceVulkan12Features* p = replay_alloc(r, sizeof(VkPhysicalDeviceVulkan12Features));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceVulkan12Features));
+		replay_VkPhysicalDeviceVulkan12Features(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES: {
+		VkPhysicalDeviceVulkan12Properties* p = replay_alloc(r, sizeof(VkPhysicalDeviceVulkan12Properties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceVulkan12Properties));
+		replay_VkPhysicalDeviceVulkan12Properties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES: {
+		VkPhysicalDeviceVulkan13Features* p = replay_alloc(r, sizeof(VkPhysicalDeviceVulkan13Features));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceVulkan13Features));
+		replay_VkPhysicalDeviceVulkan13Features(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_PROPERTIES: {
+		VkPhysicalDeviceVulkan13Properties* p = replay_alloc(r, sizeof(VkPhysicalDeviceVulkan13Properties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceVulkan13Properties));
+		replay_VkPhysicalDeviceVulkan13Properties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES: {
+		VkPhysicalDeviceVulkanMemoryModelFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceVulkanMemoryModelFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceVulkanMemoryModelFeatures));
+		replay_VkPhysicalDeviceVulkanMemoryModelFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ZERO_INITIALIZE_WORKGROUP_MEMORY_FEATURES: {
+		VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures* p = replay_alloc(r, sizeof(VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures));
+		replay_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO: {
+		VkPipelineCacheCreateInfo* p = replay_alloc(r, sizeof(VkPipelineCacheCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPipelineCacheCreateInfo));
+		replay_VkPipelineCacheCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_STATE_CREATE_INFO: {
+		VkPipelineColorBlendStateCreateInfo* p = replay_alloc(r, sizeof(VkPipelineColorBlendStateCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPipelineColorBlendStateCreateInfo));
+		replay_VkPipelineColorBlendStateCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO: {
+		VkPipelineCreationFeedbackCreateInfo* p = replay_alloc(r, sizeof(VkPipelineCreationFeedbackCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPipelineCreationFeedbackCreateInfo));
+		replay_VkPipelineCreationFeedbackCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PIPELINE_DEPTH_STENCIL_STATE_CREATE_INFO: {
+		VkPipelineDepthStencilStateCreateInfo* p = replay_alloc(r, sizeof(VkPipelineDepthStencilStateCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPipelineDepthStencilStateCreateInfo));
+		replay_VkPipelineDepthStencilStateCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PIPELINE_DYNAMIC_STATE_CREATE_INFO: {
+		VkPipelineDynamicStateCreateInfo* p = replay_alloc(r, sizeof(VkPipelineDynamicStateCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPipelineDynamicStateCreateInfo));
+		replay_VkPipelineDynamicStateCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PIPELINE_INPUT_ASSEMBLY_STATE_CREATE_INFO: {
+		VkPipelineInputAssemblyStateCreateInfo* p = replay_alloc(r, sizeof(VkPipelineInputAssemblyStateCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPipelineInputAssemblyStateCreateInfo));
+		replay_VkPipelineInputAssemblyStateCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO: {
+		VkPipelineLayoutCreateInfo* p = replay_alloc(r, sizeof(VkPipelineLayoutCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPipelineLayoutCreateInfo));
+		replay_VkPipelineLayoutCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR: {
+		VkPipelineLibraryCreateInfoKHR* p = replay_alloc(r, sizeof(VkPipelineLibraryCreateInfoKHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPipelineLibraryCreateInfoKHR));
+		replay_VkPipelineLibraryCreateInfoKHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PIPELINE_MULTISAMPLE_STATE_CREATE_INFO: {
+		VkPipelineMultisampleStateCreateInfo* p = replay_alloc(r, sizeof(VkPipelineMultisampleStateCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPipelineMultisampleStateCreateInfo));
+		replay_VkPipelineMultisampleStateCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_CREATE_INFO: {
+		VkPipelineRasterizationStateCreateInfo* p = replay_alloc(r, sizeof(VkPipelineRasterizationStateCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPipelineRasterizationStateCreateInfo));
+		replay_VkPipelineRasterizationStateCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO: {
+		VkPipelineRenderingCreateInfo* p = replay_alloc(r, sizeof(VkPipelineRenderingCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPipelineRenderingCreateInfo));
+		replay_VkPipelineRenderingCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO: {
+		VkPipelineShaderStageCreateInfo* p = replay_alloc(r, sizeof(VkPipelineShaderStageCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPipelineShaderStageCreateInfo));
+		replay_VkPipelineShaderStageCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO: {
+		VkPipelineShaderStageRequiredSubgroupSizeCreateInfo* p = replay_alloc(r, sizeof(VkPipelineShaderStageRequiredSubgroupSizeCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPipelineShaderStageRequiredSubgroupSizeCreateInfo));
+		replay_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO: {
+		VkPipelineTessellationDomainOriginStateCreateInfo* p = replay_alloc(r, sizeof(VkPipelineTessellationDomainOriginStateCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPipelineTessellationDomainOriginStateCreateInfo));
+		replay_VkPipelineTessellationDomainOriginStateCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_STATE_CREATE_INFO: {
+		VkPipelineTessellationStateCreateInfo* p = replay_alloc(r, sizeof(VkPipelineTessellationStateCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPipelineTessellationStateCreateInfo));
+		replay_VkPipelineTessellationStateCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_STATE_CREATE_INFO: {
+		VkPipelineVertexInputStateCreateInfo* p = replay_alloc(r, sizeof(VkPipelineVertexInputStateCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPipelineVertexInputStateCreateInfo));
+		replay_VkPipelineVertexInputStateCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_STATE_CREATE_INFO: {
+		VkPipelineViewportStateCreateInfo* p = replay_alloc(r, sizeof(VkPipelineViewportStateCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPipelineViewportStateCreateInfo));
+		replay_VkPipelineViewportStateCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PRESENT_INFO_KHR: {
+		VkPresentInfoKHR* p = replay_alloc(r, sizeof(VkPresentInfoKHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPresentInfoKHR));
+		replay_VkPresentInfoKHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PRIVATE_DATA_SLOT_CREATE_INFO: {
+		VkPrivateDataSlotCreateInfo* p = replay_alloc(r, sizeof(VkPrivateDataSlotCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkPrivateDataSlotCreateInfo));
+		replay_VkPrivateDataSlotCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO: {
+		VkProtectedSubmitInfo* p = replay_alloc(r, sizeof(VkProtectedSubmitInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkProtectedSubmitInfo));
+		replay_VkProtectedSubmitInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO: {
+		VkQueryPoolCreateInfo* p = replay_alloc(r, sizeof(VkQueryPoolCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkQueryPoolCreateInfo));
+		replay_VkQueryPoolCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2: {
+		VkQueueFamilyProperties2* p = replay_alloc(r, sizeof(VkQueueFamilyProperties2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkQueueFamilyProperties2));
+		replay_VkQueueFamilyProperties2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO: {
+		VkRenderPassAttachmentBeginInfo* p = replay_alloc(r, sizeof(VkRenderPassAttachmentBeginInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkRenderPassAttachmentBeginInfo));
+		replay_VkRenderPassAttachmentBeginInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO: {
+		VkRenderPassBeginInfo* p = replay_alloc(r, sizeof(VkRenderPassBeginInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkRenderPassBeginInfo));
+		replay_VkRenderPassBeginInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO: {
+		VkRenderPassCreateInfo* p = replay_alloc(r, sizeof(VkRenderPassCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkRenderPassCreateInfo));
+		replay_VkRenderPassCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO_2: {
+		VkRenderPassCreateInfo2* p = replay_alloc(r, sizeof(VkRenderPassCreateInfo2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkRenderPassCreateInfo2));
+		replay_VkRenderPassCreateInfo2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO: {
+		VkRenderPassInputAttachmentAspectCreateInfo* p = replay_alloc(r, sizeof(VkRenderPassInputAttachmentAspectCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkRenderPassInputAttachmentAspectCreateInfo));
+		replay_VkRenderPassInputAttachmentAspectCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO: {
+		VkRenderPassMultiviewCreateInfo* p = replay_alloc(r, sizeof(VkRenderPassMultiviewCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkRenderPassMultiviewCreateInfo));
+		replay_VkRenderPassMultiviewCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO: {
+		VkRenderingAttachmentInfo* p = replay_alloc(r, sizeof(VkRenderingAttachmentInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkRenderingAttachmentInfo));
+		replay_VkRenderingAttachmentInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_RENDERING_INFO: {
+		VkRenderingInfo* p = replay_alloc(r, sizeof(VkRenderingInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkRenderingInfo));
+		replay_VkRenderingInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_RESOLVE_IMAGE_INFO_2: {
+		VkResolveImageInfo2* p = replay_alloc(r, sizeof(VkResolveImageInfo2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkResolveImageInfo2));
+		replay_VkResolveImageInfo2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO: {
+		VkSamplerCreateInfo* p = replay_alloc(r, sizeof(VkSamplerCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSamplerCreateInfo));
+		replay_VkSamplerCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO: {
+		VkSamplerReductionModeCreateInfo* p = replay_alloc(r, sizeof(VkSamplerReductionModeCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSamplerReductionModeCreateInfo));
+		replay_VkSamplerReductionModeCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_CREATE_INFO: {
+		VkSamplerYcbcrConversionCreateInfo* p = replay_alloc(r, sizeof(VkSamplerYcbcrConversionCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSamplerYcbcrConversionCreateInfo));
+		replay_VkSamplerYcbcrConversionCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_FORMAT_PROPERTIES: {
+		VkSamplerYcbcrConversionImageFormatProperties* p = replay_alloc(r, sizeof(VkSamplerYcbcrConversionImageFormatProperties));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSamplerYcbcrConversionImageFormatProperties));
+		replay_VkSamplerYcbcrConversionImageFormatProperties(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO: {
+		VkSamplerYcbcrConversionInfo* p = replay_alloc(r, sizeof(VkSamplerYcbcrConversionInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSamplerYcbcrConversionInfo));
+		replay_VkSamplerYcbcrConversionInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO: {
+		VkSemaphoreCreateInfo* p = replay_alloc(r, sizeof(VkSemaphoreCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSemaphoreCreateInfo));
+		replay_VkSemaphoreCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SEMAPHORE_GET_FD_INFO_KHR: {
+		VkSemaphoreGetFdInfoKHR* p = replay_alloc(r, sizeof(VkSemaphoreGetFdInfoKHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSemaphoreGetFdInfoKHR));
+		replay_VkSemaphoreGetFdInfoKHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO: {
+		VkSemaphoreSignalInfo* p = replay_alloc(r, sizeof(VkSemaphoreSignalInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSemaphoreSignalInfo));
+		replay_VkSemaphoreSignalInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO: {
+		VkSemaphoreSubmitInfo* p = replay_alloc(r, sizeof(VkSemaphoreSubmitInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSemaphoreSubmitInfo));
+		replay_VkSemaphoreSubmitInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO: {
+		VkSemaphoreTypeCreateInfo* p = replay_alloc(r, sizeof(VkSemaphoreTypeCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSemaphoreTypeCreateInfo));
+		replay_VkSemaphoreTypeCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO: {
+		VkSemaphoreWaitInfo* p = replay_alloc(r, sizeof(VkSemaphoreWaitInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSemaphoreWaitInfo));
+		replay_VkSemaphoreWaitInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SHADER_MODULE_CREATE_INFO: {
+		VkShaderModuleCreateInfo* p = replay_alloc(r, sizeof(VkShaderModuleCreateInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkShaderModuleCreateInfo));
+		replay_VkShaderModuleCreateInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SPARSE_IMAGE_FORMAT_PROPERTIES_2: {
+		VkSparseImageFormatProperties2* p = replay_alloc(r, sizeof(VkSparseImageFormatProperties2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSparseImageFormatProperties2));
+		replay_VkSparseImageFormatProperties2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SPARSE_IMAGE_MEMORY_REQUIREMENTS_2: {
+		VkSparseImageMemoryRequirements2* p = replay_alloc(r, sizeof(VkSparseImageMemoryRequirements2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSparseImageMemoryRequirements2));
+		replay_VkSparseImageMemoryRequirements2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SUBMIT_INFO: {
+		VkSubmitInfo* p = replay_alloc(r, sizeof(VkSubmitInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSubmitInfo));
+		replay_VkSubmitInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SUBMIT_INFO_2: {
+		VkSubmitInfo2* p = replay_alloc(r, sizeof(VkSubmitInfo2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSubmitInfo2));
+		replay_VkSubmitInfo2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SUBPASS_BEGIN_INFO: {
+		VkSubpassBeginInfo* p = replay_alloc(r, sizeof(VkSubpassBeginInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSubpassBeginInfo));
+		replay_VkSubpassBeginInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SUBPASS_DEPENDENCY_2: {
+		VkSubpassDependency2* p = replay_alloc(r, sizeof(VkSubpassDependency2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSubpassDependency2));
+		replay_VkSubpassDependency2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_2: {
+		VkSubpassDescription2* p = replay_alloc(r, sizeof(VkSubpassDescription2));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSubpassDescription2));
+		replay_VkSubpassDescription2(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENCIL_RESOLVE: {
+		VkSubpassDescriptionDepthStencilResolve* p = replay_alloc(r, sizeof(VkSubpassDescriptionDepthStencilResolve));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSubpassDescriptionDepthStencilResolve));
+		replay_VkSubpassDescriptionDepthStencilResolve(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SUBPASS_END_INFO: {
+		VkSubpassEndInfo* p = replay_alloc(r, sizeof(VkSubpassEndInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSubpassEndInfo));
+		replay_VkSubpassEndInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_KHR: {
+		VkSurfaceCapabilities2KHR* p = replay_alloc(r, sizeof(VkSurfaceCapabilities2KHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSurfaceCapabilities2KHR));
+		replay_VkSurfaceCapabilities2KHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SURFACE_FORMAT_2_KHR: {
+		VkSurfaceFormat2KHR* p = replay_alloc(r, sizeof(VkSurfaceFormat2KHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSurfaceFormat2KHR));
+		replay_VkSurfaceFormat2KHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SURFACE_PROTECTED_CAPABILITIES_KHR: {
+		VkSurfaceProtectedCapabilitiesKHR* p = replay_alloc(r, sizeof(VkSurfaceProtectedCapabilitiesKHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSurfaceProtectedCapabilitiesKHR));
+		replay_VkSurfaceProtectedCapabilitiesKHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR: {
+		VkSwapchainCreateInfoKHR* p = replay_alloc(r, sizeof(VkSwapchainCreateInfoKHR));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkSwapchainCreateInfoKHR));
+		replay_VkSwapchainCreateInfoKHR(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO: {
+		VkTimelineSemaphoreSubmitInfo* p = replay_alloc(r, sizeof(VkTimelineSemaphoreSubmitInfo));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkTimelineSemaphoreSubmitInfo));
+		replay_VkTimelineSemaphoreSubmitInfo(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET: {
+		VkWriteDescriptorSet* p = replay_alloc(r, sizeof(VkWriteDescriptorSet));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkWriteDescriptorSet));
+		replay_VkWriteDescriptorSet(r, rd, p);
+		return p;
+	}
+	case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK: {
+		VkWriteDescriptorSetInlineUniformBlock* p = replay_alloc(r, sizeof(VkWriteDescriptorSetInlineUniformBlock));
+		if (p == NULL) {
+			rd->overflow = 1;
+			return NULL;
+		}
+		replay_raw(rd, p, sizeof(VkWriteDescriptorSetInlineUniformBlock));
+		replay_VkWriteDescriptorSetInlineUniformBlock(r, rd, p);
+		return p;
+	}
+	default:
+		return NULL;
+	}
+}
+
+void vksCaptured_vkGetImageMemoryRequirements(vksProcAddr* addrs, VkDevice device, VkImage image, VkMemoryRequirements* pMemoryRequirements) {
+	vksCaptureStream* s = capture_begin(0);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &image, sizeof(image));
+	capture_pointer(s, pMemoryRequirements, (size_t)(1), sizeof(VkMemoryRequirements));
+	((PFN_vkGetImageMemoryRequirements)addrs->pvkGetImageMemoryRequirements)(device, image, pMemoryRequirements);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetImageMemoryRequirements(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkImage image;
+	replay_raw(rd, &image, sizeof(image));
+	image = (VkImage)replay_map(r, (uint64_t)(uintptr_t)image);
+	VkMemoryRequirements* pMemoryRequirements = NULL;
+	pMemoryRequirements = replay_pointer(r, rd, sizeof(VkMemoryRequirements), NULL);
+	if (rd->overflow || r->procs.pvkGetImageMemoryRequirements == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetImageMemoryRequirements)r->procs.pvkGetImageMemoryRequirements)(device, image, pMemoryRequirements);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkUnmapMemory(vksProcAddr* addrs, VkDevice device, VkDeviceMemory memory) {
+	vksCaptureStream* s = capture_begin(1);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &memory, sizeof(memory));
+	((PFN_vkUnmapMemory)addrs->pvkUnmapMemory)(device, memory);
+	capture_end(s);
+}
+
+static VkResult replay_vkUnmapMemory(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkDeviceMemory memory;
+	replay_raw(rd, &memory, sizeof(memory));
+	memory = (VkDeviceMemory)replay_map(r, (uint64_t)(uintptr_t)memory);
+	if (rd->overflow || r->procs.pvkUnmapMemory == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkUnmapMemory)r->procs.pvkUnmapMemory)(device, memory);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+VkResult vksCaptured_vkResetDescriptorPool(vksProcAddr* addrs, VkDevice device, VkDescriptorPool descriptorPool, VkDescriptorPoolResetFlags flags) {
+	vksCaptureStream* s = capture_begin(2);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &descriptorPool, sizeof(descriptorPool));
+	capture_raw(s, &flags, sizeof(flags));
+	VkResult ret = ((PFN_vkResetDescriptorPool)addrs->pvkResetDescriptorPool)(device, descriptorPool, flags);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkResetDescriptorPool(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkDescriptorPool descriptorPool;
+	replay_raw(rd, &descriptorPool, sizeof(descriptorPool));
+	descriptorPool = (VkDescriptorPool)replay_map(r, (uint64_t)(uintptr_t)descriptorPool);
+	VkDescriptorPoolResetFlags flags;
+	replay_raw(rd, &flags, sizeof(flags));
+	if (rd->overflow || r->procs.pvkResetDescriptorPool == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkResetDescriptorPool)r->procs.pvkResetDescriptorPool)(device, descriptorPool, flags);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+VkResult vksCaptured_vkAllocateDescriptorSets(vksProcAddr* addrs, VkDevice device, VkDescriptorSetAllocateInfo* pAllocateInfo, VkDescriptorSet* pDescriptorSets) {
+	vksCaptureStream* s = capture_begin(3);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pAllocateInfo, (size_t)(1), sizeof(VkDescriptorSetAllocateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkDescriptorSetAllocateInfo(s, &pAllocateInfo[i]);
+		}
+	}
+	capture_output(s, pDescriptorSets, (size_t)(pAllocateInfo->descriptorSetCount));
+	VkResult ret = ((PFN_vkAllocateDescriptorSets)addrs->pvkAllocateDescriptorSets)(device, pAllocateInfo, pDescriptorSets);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pDescriptorSets : NULL, (size_t)(pAllocateInfo->descriptorSetCount), sizeof(VkDescriptorSet));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkAllocateDescriptorSets(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkDescriptorSetAllocateInfo* pAllocateInfo = NULL;
+	{
+		size_t n;
+		VkDescriptorSetAllocateInfo* v = replay_pointer(r, rd, sizeof(VkDescriptorSetAllocateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDescriptorSetAllocateInfo(r, rd, &v[i]);
+		}
+		pAllocateInfo = v;
+	}
+	VkDescriptorSet* pDescriptorSets = replay_output(r, rd, sizeof(VkDescriptorSet));
+	if (rd->overflow || r->procs.pvkAllocateDescriptorSets == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkAllocateDescriptorSets)r->procs.pvkAllocateDescriptorSets)(device, pAllocateInfo, pDescriptorSets);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pDescriptorSets, sizeof(VkDescriptorSet));
+	}
+	return ret;
+}
+
+VkResult vksCaptured_vkFreeDescriptorSets(vksProcAddr* addrs, VkDevice device, VkDescriptorPool descriptorPool, uint32_t descriptorSetCount, VkDescriptorSet* pDescriptorSets) {
+	vksCaptureStream* s = capture_begin(4);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &descriptorPool, sizeof(descriptorPool));
+	capture_raw(s, &descriptorSetCount, sizeof(descriptorSetCount));
+	capture_pointer(s, pDescriptorSets, (size_t)(descriptorSetCount), sizeof(VkDescriptorSet));
+	VkResult ret = ((PFN_vkFreeDescriptorSets)addrs->pvkFreeDescriptorSets)(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkFreeDescriptorSets(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkDescriptorPool descriptorPool;
+	replay_raw(rd, &descriptorPool, sizeof(descriptorPool));
+	descriptorPool = (VkDescriptorPool)replay_map(r, (uint64_t)(uintptr_t)descriptorPool);
+	uint32_t descriptorSetCount;
+	replay_raw(rd, &descriptorSetCount, sizeof(descriptorSetCount));
+	VkDescriptorSet* pDescriptorSets = NULL;
+	{
+		size_t n;
+		VkDescriptorSet* v = replay_pointer(r, rd, sizeof(VkDescriptorSet), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkDescriptorSet)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		pDescriptorSets = v;
+	}
+	if (rd->overflow || r->procs.pvkFreeDescriptorSets == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkFreeDescriptorSets)r->procs.pvkFreeDescriptorSets)(device, descriptorPool, descriptorSetCount, pDescriptorSets);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+void vksCaptured_vkUpdateDescriptorSets(vksProcAddr* addrs, VkDevice device, uint32_t descriptorWriteCount, VkWriteDescriptorSet* pDescriptorWrites, uint32_t descriptorCopyCount, VkCopyDescriptorSet* pDescriptorCopies) {
+	vksCaptureStream* s = capture_begin(5);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &descriptorWriteCount, sizeof(descriptorWriteCount));
+	if (capture_pointer(s, pDescriptorWrites, (size_t)(descriptorWriteCount), sizeof(VkWriteDescriptorSet))) {
+		for (size_t i = 0; i < (size_t)(descriptorWriteCount); i++) {
+			capture_VkWriteDescriptorSet(s, &pDescriptorWrites[i]);
+		}
+	}
+	capture_raw(s, &descriptorCopyCount, sizeof(descriptorCopyCount));
+	if (capture_pointer(s, pDescriptorCopies, (size_t)(descriptorCopyCount), sizeof(VkCopyDescriptorSet))) {
+		for (size_t i = 0; i < (size_t)(descriptorCopyCount); i++) {
+			capture_VkCopyDescriptorSet(s, &pDescriptorCopies[i]);
+		}
+	}
+	((PFN_vkUpdateDescriptorSets)addrs->pvkUpdateDescriptorSets)(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+	capture_end(s);
+}
+
+static VkResult replay_vkUpdateDescriptorSets(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	uint32_t descriptorWriteCount;
+	replay_raw(rd, &descriptorWriteCount, sizeof(descriptorWriteCount));
+	VkWriteDescriptorSet* pDescriptorWrites = NULL;
+	{
+		size_t n;
+		VkWriteDescriptorSet* v = replay_pointer(r, rd, sizeof(VkWriteDescriptorSet), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkWriteDescriptorSet(r, rd, &v[i]);
+		}
+		pDescriptorWrites = v;
+	}
+	uint32_t descriptorCopyCount;
+	replay_raw(rd, &descriptorCopyCount, sizeof(descriptorCopyCount));
+	VkCopyDescriptorSet* pDescriptorCopies = NULL;
+	{
+		size_t n;
+		VkCopyDescriptorSet* v = replay_pointer(r, rd, sizeof(VkCopyDescriptorSet), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkCopyDescriptorSet(r, rd, &v[i]);
+		}
+		pDescriptorCopies = v;
+	}
+	if (rd->overflow || r->procs.pvkUpdateDescriptorSets == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkUpdateDescriptorSets)r->procs.pvkUpdateDescriptorSets)(device, descriptorWriteCount, pDescriptorWrites, descriptorCopyCount, pDescriptorCopies);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkFreeMemory(vksProcAddr* addrs, VkDevice device, VkDeviceMemory memory, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(6);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &memory, sizeof(memory));
+	((PFN_vkFreeMemory)addrs->pvkFreeMemory)(device, memory, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkFreeMemory(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkDeviceMemory memory;
+	replay_raw(rd, &memory, sizeof(memory));
+	memory = (VkDeviceMemory)replay_map(r, (uint64_t)(uintptr_t)memory);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkFreeMemory == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkFreeMemory)r->procs.pvkFreeMemory)(device, memory, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkDestroyQueryPool(vksProcAddr* addrs, VkDevice device, VkQueryPool queryPool, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(7);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &queryPool, sizeof(queryPool));
+	((PFN_vkDestroyQueryPool)addrs->pvkDestroyQueryPool)(device, queryPool, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroyQueryPool(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkQueryPool queryPool;
+	replay_raw(rd, &queryPool, sizeof(queryPool));
+	queryPool = (VkQueryPool)replay_map(r, (uint64_t)(uintptr_t)queryPool);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroyQueryPool == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroyQueryPool)r->procs.pvkDestroyQueryPool)(device, queryPool, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+VkResult vksCaptured_vkMapMemory(vksProcAddr* addrs, VkDevice device, VkDeviceMemory memory, VkDeviceSize offset, VkDeviceSize size, VkMemoryMapFlags flags, void** ppData) {
+	vksCaptureStream* s = capture_begin(8);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &memory, sizeof(memory));
+	capture_raw(s, &offset, sizeof(offset));
+	capture_raw(s, &size, sizeof(size));
+	capture_raw(s, &flags, sizeof(flags));
+	VkResult ret = ((PFN_vkMapMemory)addrs->pvkMapMemory)(device, memory, offset, size, flags, ppData);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkMapMemory(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkDeviceMemory memory;
+	replay_raw(rd, &memory, sizeof(memory));
+	memory = (VkDeviceMemory)replay_map(r, (uint64_t)(uintptr_t)memory);
+	VkDeviceSize offset;
+	replay_raw(rd, &offset, sizeof(offset));
+	VkDeviceSize size;
+	replay_raw(rd, &size, sizeof(size));
+	VkMemoryMapFlags flags;
+	replay_raw(rd, &flags, sizeof(flags));
+	void** ppData = NULL;
+	ppData = replay_alloc(r, sizeof(void*));
+	if (rd->overflow || r->procs.pvkMapMemory == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkMapMemory)r->procs.pvkMapMemory)(device, memory, offset, size, flags, ppData);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+VkResult vksCaptured_vkResetFences(vksProcAddr* addrs, VkDevice device, uint32_t fenceCount, VkFence* pFences) {
+	vksCaptureStream* s = capture_begin(9);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &fenceCount, sizeof(fenceCount));
+	capture_pointer(s, pFences, (size_t)(fenceCount), sizeof(VkFence));
+	VkResult ret = ((PFN_vkResetFences)addrs->pvkResetFences)(device, fenceCount, pFences);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkResetFences(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	uint32_t fenceCount;
+	replay_raw(rd, &fenceCount, sizeof(fenceCount));
+	VkFence* pFences = NULL;
+	{
+		size_t n;
+		VkFence* v = replay_pointer(r, rd, sizeof(VkFence), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkFence)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		pFences = v;
+	}
+	if (rd->overflow || r->procs.pvkResetFences == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkResetFences)r->procs.pvkResetFences)(device, fenceCount, pFences);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+VkResult vksCaptured_vkFlushMappedMemoryRanges(vksProcAddr* addrs, VkDevice device, uint32_t memoryRangeCount, VkMappedMemoryRange* pMemoryRanges) {
+	vksCaptureStream* s = capture_begin(10);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &memoryRangeCount, sizeof(memoryRangeCount));
+	if (capture_pointer(s, pMemoryRanges, (size_t)(memoryRangeCount), sizeof(VkMappedMemoryRange))) {
+		for (size_t i = 0; i < (size_t)(memoryRangeCount); i++) {
+			capture_VkMappedMemoryRange(s, &pMemoryRanges[i]);
+		}
+	}
+	VkResult ret = ((PFN_vkFlushMappedMemoryRanges)addrs->pvkFlushMappedMemoryRanges)(device, memoryRangeCount, pMemoryRanges);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkFlushMappedMemoryRanges(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	uint32_t memoryRangeCount;
+	replay_raw(rd, &memoryRangeCount, sizeof(memoryRangeCount));
+	VkMappedMemoryRange* pMemoryRanges = NULL;
+	{
+		size_t n;
+		VkMappedMemoryRange* v = replay_pointer(r, rd, sizeof(VkMappedMemoryRange), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkMappedMemoryRange(r, rd, &v[i]);
+		}
+		pMemoryRanges = v;
+	}
+	if (rd->overflow || r->procs.pvkFlushMappedMemoryRanges == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkFlushMappedMemoryRanges)r->procs.pvkFlushMappedMemoryRanges)(device, memoryRangeCount, pMemoryRanges);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+VkResult vksCaptured_vkInvalidateMappedMemoryRanges(vksProcAddr* addrs, VkDevice device, uint32_t memoryRangeCount, VkMappedMemoryRange* pMemoryRanges) {
+	vksCaptureStream* s = capture_begin(11);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &memoryRangeCount, sizeof(memoryRangeCount));
+	if (capture_pointer(s, pMemoryRanges, (size_t)(memoryRangeCount), sizeof(VkMappedMemoryRange))) {
+		for (size_t i = 0; i < (size_t)(memoryRangeCount); i++) {
+			capture_VkMappedMemoryRange(s, &pMemoryRanges[i]);
+		}
+	}
+	VkResult ret = ((PFN_vkInvalidateMappedMemoryRanges)addrs->pvkInvalidateMappedMemoryRanges)(device, memoryRangeCount, pMemoryRanges);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkInvalidateMappedMemoryRanges(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	uint32_t memoryRangeCount;
+	replay_raw(rd, &memoryRangeCount, sizeof(memoryRangeCount));
+	VkMappedMemoryRange* pMemoryRanges = NULL;
+	{
+		size_t n;
+		VkMappedMemoryRange* v = replay_pointer(r, rd, sizeof(VkMappedMemoryRange), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkMappedMemoryRange(r, rd, &v[i]);
+		}
+		pMemoryRanges = v;
+	}
+	if (rd->overflow || r->procs.pvkInvalidateMappedMemoryRanges == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkInvalidateMappedMemoryRanges)r->procs.pvkInvalidateMappedMemoryRanges)(device, memoryRangeCount, pMemoryRanges);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+void vksCaptured_vkGetDeviceMemoryCommitment(vksProcAddr* addrs, VkDevice device, VkDeviceMemory memory, VkDeviceSize* pCommittedMemoryInBytes) {
+	vksCaptureStream* s = capture_begin(12);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &memory, sizeof(memory));
+	capture_pointer(s, pCommittedMemoryInBytes, (size_t)(1), sizeof(VkDeviceSize));
+	((PFN_vkGetDeviceMemoryCommitment)addrs->pvkGetDeviceMemoryCommitment)(device, memory, pCommittedMemoryInBytes);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetDeviceMemoryCommitment(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkDeviceMemory memory;
+	replay_raw(rd, &memory, sizeof(memory));
+	memory = (VkDeviceMemory)replay_map(r, (uint64_t)(uintptr_t)memory);
+	VkDeviceSize* pCommittedMemoryInBytes = NULL;
+	pCommittedMemoryInBytes = replay_pointer(r, rd, sizeof(VkDeviceSize), NULL);
+	if (rd->overflow || r->procs.pvkGetDeviceMemoryCommitment == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetDeviceMemoryCommitment)r->procs.pvkGetDeviceMemoryCommitment)(device, memory, pCommittedMemoryInBytes);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+VkResult vksCaptured_vkBindBufferMemory(vksProcAddr* addrs, VkDevice device, VkBuffer buffer, VkDeviceMemory memory, VkDeviceSize memoryOffset) {
+	vksCaptureStream* s = capture_begin(13);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &buffer, sizeof(buffer));
+	capture_raw(s, &memory, sizeof(memory));
+	capture_raw(s, &memoryOffset, sizeof(memoryOffset));
+	VkResult ret = ((PFN_vkBindBufferMemory)addrs->pvkBindBufferMemory)(device, buffer, memory, memoryOffset);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkBindBufferMemory(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkBuffer buffer;
+	replay_raw(rd, &buffer, sizeof(buffer));
+	buffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)buffer);
+	VkDeviceMemory memory;
+	replay_raw(rd, &memory, sizeof(memory));
+	memory = (VkDeviceMemory)replay_map(r, (uint64_t)(uintptr_t)memory);
+	VkDeviceSize memoryOffset;
+	replay_raw(rd, &memoryOffset, sizeof(memoryOffset));
+	if (rd->overflow || r->procs.pvkBindBufferMemory == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkBindBufferMemory)r->procs.pvkBindBufferMemory)(device, buffer, memory, memoryOffset);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+VkResult vksCaptured_vkBindImageMemory(vksProcAddr* addrs, VkDevice device, VkImage image, VkDeviceMemory memory, VkDeviceSize memoryOffset) {
+	vksCaptureStream* s = capture_begin(14);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &image, sizeof(image));
+	capture_raw(s, &memory, sizeof(memory));
+	capture_raw(s, &memoryOffset, sizeof(memoryOffset));
+	VkResult ret = ((PFN_vkBindImageMemory)addrs->pvkBindImageMemory)(device, image, memory, memoryOffset);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkBindImageMemory(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkImage image;
+	replay_raw(rd, &image, sizeof(image));
+	image = (VkImage)replay_map(r, (uint64_t)(uintptr_t)image);
+	VkDeviceMemory memory;
+	replay_raw(rd, &memory, sizeof(memory));
+	memory = (VkDeviceMemory)replay_map(r, (uint64_t)(uintptr_t)memory);
+	VkDeviceSize memoryOffset;
+	replay_raw(rd, &memoryOffset, sizeof(memoryOffset));
+	if (rd->overflow || r->procs.pvkBindImageMemory == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkBindImageMemory)r->procs.pvkBindImageMemory)(device, image, memory, memoryOffset);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+VkResult vksCaptured_vkEnumerateInstanceLayerProperties(vksProcAddr* addrs, uint32_t* pPropertyCount, VkLayerProperties* pProperties) {
+	vksCaptureStream* s = capture_begin(15);
+	capture_pointer(s, pPropertyCount, (size_t)(1), sizeof(uint32_t));
+	capture_pointer(s, pProperties, (size_t)((pPropertyCount != NULL ? *pPropertyCount : 0)), sizeof(VkLayerProperties));
+	VkResult ret = ((PFN_vkEnumerateInstanceLayerProperties)addrs->pvkEnumerateInstanceLayerProperties)(pPropertyCount, pProperties);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkEnumerateInstanceLayerProperties(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	uint32_t* pPropertyCount = NULL;
+	pPropertyCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkLayerProperties* pProperties = NULL;
+	pProperties = replay_pointer(r, rd, sizeof(VkLayerProperties), NULL);
+	if (rd->overflow || r->global.pvkEnumerateInstanceLayerProperties == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkEnumerateInstanceLayerProperties)r->global.pvkEnumerateInstanceLayerProperties)(pPropertyCount, pProperties);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+void vksCaptured_vkGetBufferMemoryRequirements(vksProcAddr* addrs, VkDevice device, VkBuffer buffer, VkMemoryRequirements* pMemoryRequirements) {
+	vksCaptureStream* s = capture_begin(16);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &buffer, sizeof(buffer));
+	capture_pointer(s, pMemoryRequirements, (size_t)(1), sizeof(VkMemoryRequirements));
+	((PFN_vkGetBufferMemoryRequirements)addrs->pvkGetBufferMemoryRequirements)(device, buffer, pMemoryRequirements);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetBufferMemoryRequirements(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkBuffer buffer;
+	replay_raw(rd, &buffer, sizeof(buffer));
+	buffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)buffer);
+	VkMemoryRequirements* pMemoryRequirements = NULL;
+	pMemoryRequirements = replay_pointer(r, rd, sizeof(VkMemoryRequirements), NULL);
+	if (rd->overflow || r->procs.pvkGetBufferMemoryRequirements == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetBufferMemoryRequirements)r->procs.pvkGetBufferMemoryRequirements)(device, buffer, pMemoryRequirements);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkGetPhysicalDeviceQueueFamilyProperties(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties* pQueueFamilyProperties) {
+	vksCaptureStream* s = capture_begin(17);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_pointer(s, pQueueFamilyPropertyCount, (size_t)(1), sizeof(uint32_t));
+	capture_pointer(s, pQueueFamilyProperties, (size_t)((pQueueFamilyPropertyCount != NULL ? *pQueueFamilyPropertyCount : 0)), sizeof(VkQueueFamilyProperties));
+	((PFN_vkGetPhysicalDeviceQueueFamilyProperties)addrs->pvkGetPhysicalDeviceQueueFamilyProperties)(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetPhysicalDeviceQueueFamilyProperties(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	uint32_t* pQueueFamilyPropertyCount = NULL;
+	pQueueFamilyPropertyCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkQueueFamilyProperties* pQueueFamilyProperties = NULL;
+	pQueueFamilyProperties = replay_pointer(r, rd, sizeof(VkQueueFamilyProperties), NULL);
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceQueueFamilyProperties == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetPhysicalDeviceQueueFamilyProperties)r->procs.pvkGetPhysicalDeviceQueueFamilyProperties)(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkGetPhysicalDeviceProperties(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties* pProperties) {
+	vksCaptureStream* s = capture_begin(18);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_pointer(s, pProperties, (size_t)(1), sizeof(VkPhysicalDeviceProperties));
+	((PFN_vkGetPhysicalDeviceProperties)addrs->pvkGetPhysicalDeviceProperties)(physicalDevice, pProperties);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetPhysicalDeviceProperties(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkPhysicalDeviceProperties* pProperties = NULL;
+	pProperties = replay_pointer(r, rd, sizeof(VkPhysicalDeviceProperties), NULL);
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceProperties == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetPhysicalDeviceProperties)r->procs.pvkGetPhysicalDeviceProperties)(physicalDevice, pProperties);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+VkResult vksCaptured_vkCreatePipelineLayout(vksProcAddr* addrs, VkDevice device, VkPipelineLayoutCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkPipelineLayout* pPipelineLayout) {
+	vksCaptureStream* s = capture_begin(19);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkPipelineLayoutCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPipelineLayoutCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pPipelineLayout, (size_t)(1));
+	VkResult ret = ((PFN_vkCreatePipelineLayout)addrs->pvkCreatePipelineLayout)(device, pCreateInfo, pAllocator, pPipelineLayout);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pPipelineLayout : NULL, (size_t)(1), sizeof(VkPipelineLayout));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreatePipelineLayout(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkPipelineLayoutCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkPipelineLayoutCreateInfo* v = replay_pointer(r, rd, sizeof(VkPipelineLayoutCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPipelineLayoutCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkPipelineLayout* pPipelineLayout = replay_output(r, rd, sizeof(VkPipelineLayout));
+	if (rd->overflow || r->procs.pvkCreatePipelineLayout == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreatePipelineLayout)r->procs.pvkCreatePipelineLayout)(device, pCreateInfo, pAllocator, pPipelineLayout);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pPipelineLayout, sizeof(VkPipelineLayout));
+	}
+	return ret;
+}
+
+VkResult vksCaptured_vkGetPhysicalDeviceImageFormatProperties(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkImageTiling tiling, VkImageUsageFlags usage, VkImageCreateFlags flags, VkImageFormatProperties* pImageFormatProperties) {
+	vksCaptureStream* s = capture_begin(20);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_raw(s, &format, sizeof(format));
+	capture_raw(s, &type, sizeof(type));
+	capture_raw(s, &tiling, sizeof(tiling));
+	capture_raw(s, &usage, sizeof(usage));
+	capture_raw(s, &flags, sizeof(flags));
+	capture_pointer(s, pImageFormatProperties, (size_t)(1), sizeof(VkImageFormatProperties));
+	VkResult ret = ((PFN_vkGetPhysicalDeviceImageFormatProperties)addrs->pvkGetPhysicalDeviceImageFormatProperties)(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetPhysicalDeviceImageFormatProperties(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkFormat format;
+	replay_raw(rd, &format, sizeof(format));
+	VkImageType type;
+	replay_raw(rd, &type, sizeof(type));
+	VkImageTiling tiling;
+	replay_raw(rd, &tiling, sizeof(tiling));
+	VkImageUsageFlags usage;
+	replay_raw(rd, &usage, sizeof(usage));
+	VkImageCreateFlags flags;
+	replay_raw(rd, &flags, sizeof(flags));
+	VkImageFormatProperties* pImageFormatProperties = NULL;
+	pImageFormatProperties = replay_pointer(r, rd, sizeof(VkImageFormatProperties), NULL);
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceImageFormatProperties == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetPhysicalDeviceImageFormatProperties)r->procs.pvkGetPhysicalDeviceImageFormatProperties)(physicalDevice, format, type, tiling, usage, flags, pImageFormatProperties);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+void vksCaptured_vkGetImageSparseMemoryRequirements(vksProcAddr* addrs, VkDevice device, VkImage image, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements* pSparseMemoryRequirements) {
+	vksCaptureStream* s = capture_begin(21);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &image, sizeof(image));
+	capture_pointer(s, pSparseMemoryRequirementCount, (size_t)(1), sizeof(uint32_t));
+	capture_pointer(s, pSparseMemoryRequirements, (size_t)((pSparseMemoryRequirementCount != NULL ? *pSparseMemoryRequirementCount : 0)), sizeof(VkSparseImageMemoryRequirements));
+	((PFN_vkGetImageSparseMemoryRequirements)addrs->pvkGetImageSparseMemoryRequirements)(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetImageSparseMemoryRequirements(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkImage image;
+	replay_raw(rd, &image, sizeof(image));
+	image = (VkImage)replay_map(r, (uint64_t)(uintptr_t)image);
+	uint32_t* pSparseMemoryRequirementCount = NULL;
+	pSparseMemoryRequirementCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkSparseImageMemoryRequirements* pSparseMemoryRequirements = NULL;
+	pSparseMemoryRequirements = replay_pointer(r, rd, sizeof(VkSparseImageMemoryRequirements), NULL);
+	if (rd->overflow || r->procs.pvkGetImageSparseMemoryRequirements == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetImageSparseMemoryRequirements)r->procs.pvkGetImageSparseMemoryRequirements)(device, image, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+VkResult vksCaptured_vkCreateFramebuffer(vksProcAddr* addrs, VkDevice device, VkFramebufferCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkFramebuffer* pFramebuffer) {
+	vksCaptureStream* s = capture_begin(22);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkFramebufferCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkFramebufferCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pFramebuffer, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateFramebuffer)addrs->pvkCreateFramebuffer)(device, pCreateInfo, pAllocator, pFramebuffer);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pFramebuffer : NULL, (size_t)(1), sizeof(VkFramebuffer));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateFramebuffer(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkFramebufferCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkFramebufferCreateInfo* v = replay_pointer(r, rd, sizeof(VkFramebufferCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkFramebufferCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkFramebuffer* pFramebuffer = replay_output(r, rd, sizeof(VkFramebuffer));
+	if (rd->overflow || r->procs.pvkCreateFramebuffer == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateFramebuffer)r->procs.pvkCreateFramebuffer)(device, pCreateInfo, pAllocator, pFramebuffer);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pFramebuffer, sizeof(VkFramebuffer));
+	}
+	return ret;
+}
+
+void vksCaptured_vkDestroyFramebuffer(vksProcAddr* addrs, VkDevice device, VkFramebuffer framebuffer, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(23);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &framebuffer, sizeof(framebuffer));
+	((PFN_vkDestroyFramebuffer)addrs->pvkDestroyFramebuffer)(device, framebuffer, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroyFramebuffer(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkFramebuffer framebuffer;
+	replay_raw(rd, &framebuffer, sizeof(framebuffer));
+	framebuffer = (VkFramebuffer)replay_map(r, (uint64_t)(uintptr_t)framebuffer);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroyFramebuffer == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroyFramebuffer)r->procs.pvkDestroyFramebuffer)(device, framebuffer, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+VkResult vksCaptured_vkCreateRenderPass(vksProcAddr* addrs, VkDevice device, VkRenderPassCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
+	vksCaptureStream* s = capture_begin(24);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkRenderPassCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkRenderPassCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pRenderPass, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateRenderPass)addrs->pvkCreateRenderPass)(device, pCreateInfo, pAllocator, pRenderPass);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pRenderPass : NULL, (size_t)(1), sizeof(VkRenderPass));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateRenderPass(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkRenderPassCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkRenderPassCreateInfo* v = replay_pointer(r, rd, sizeof(VkRenderPassCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkRenderPassCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkRenderPass* pRenderPass = replay_output(r, rd, sizeof(VkRenderPass));
+	if (rd->overflow || r->procs.pvkCreateRenderPass == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateRenderPass)r->procs.pvkCreateRenderPass)(device, pCreateInfo, pAllocator, pRenderPass);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pRenderPass, sizeof(VkRenderPass));
+	}
+	return ret;
+}
+
+void vksCaptured_vkDestroyRenderPass(vksProcAddr* addrs, VkDevice device, VkRenderPass renderPass, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(25);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &renderPass, sizeof(renderPass));
+	((PFN_vkDestroyRenderPass)addrs->pvkDestroyRenderPass)(device, renderPass, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroyRenderPass(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkRenderPass renderPass;
+	replay_raw(rd, &renderPass, sizeof(renderPass));
+	renderPass = (VkRenderPass)replay_map(r, (uint64_t)(uintptr_t)renderPass);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroyRenderPass == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroyRenderPass)r->procs.pvkDestroyRenderPass)(device, renderPass, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkGetRenderAreaGranularity(vksProcAddr* addrs, VkDevice device, VkRenderPass renderPass, VkExtent2D* pGranularity) {
+	vksCaptureStream* s = capture_begin(26);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &renderPass, sizeof(renderPass));
+	capture_pointer(s, pGranularity, (size_t)(1), sizeof(VkExtent2D));
+	((PFN_vkGetRenderAreaGranularity)addrs->pvkGetRenderAreaGranularity)(device, renderPass, pGranularity);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetRenderAreaGranularity(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkRenderPass renderPass;
+	replay_raw(rd, &renderPass, sizeof(renderPass));
+	renderPass = (VkRenderPass)replay_map(r, (uint64_t)(uintptr_t)renderPass);
+	VkExtent2D* pGranularity = NULL;
+	pGranularity = replay_pointer(r, rd, sizeof(VkExtent2D), NULL);
+	if (rd->overflow || r->procs.pvkGetRenderAreaGranularity == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetRenderAreaGranularity)r->procs.pvkGetRenderAreaGranularity)(device, renderPass, pGranularity);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkGetPhysicalDeviceFormatProperties(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties* pFormatProperties) {
+	vksCaptureStream* s = capture_begin(27);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_raw(s, &format, sizeof(format));
+	capture_pointer(s, pFormatProperties, (size_t)(1), sizeof(VkFormatProperties));
+	((PFN_vkGetPhysicalDeviceFormatProperties)addrs->pvkGetPhysicalDeviceFormatProperties)(physicalDevice, format, pFormatProperties);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetPhysicalDeviceFormatProperties(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkFormat format;
+	replay_raw(rd, &format, sizeof(format));
+	VkFormatProperties* pFormatProperties = NULL;
+	pFormatProperties = replay_pointer(r, rd, sizeof(VkFormatProperties), NULL);
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceFormatProperties == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetPhysicalDeviceFormatProperties)r->procs.pvkGetPhysicalDeviceFormatProperties)(physicalDevice, format, pFormatProperties);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkGetPhysicalDeviceFeatures(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures* pFeatures) {
+	vksCaptureStream* s = capture_begin(28);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_pointer(s, pFeatures, (size_t)(1), sizeof(VkPhysicalDeviceFeatures));
+	((PFN_vkGetPhysicalDeviceFeatures)addrs->pvkGetPhysicalDeviceFeatures)(physicalDevice, pFeatures);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetPhysicalDeviceFeatures(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkPhysicalDeviceFeatures* pFeatures = NULL;
+	pFeatures = replay_pointer(r, rd, sizeof(VkPhysicalDeviceFeatures), NULL);
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceFeatures == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetPhysicalDeviceFeatures)r->procs.pvkGetPhysicalDeviceFeatures)(physicalDevice, pFeatures);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkDestroyPipeline(vksProcAddr* addrs, VkDevice device, VkPipeline pipeline, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(29);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &pipeline, sizeof(pipeline));
+	((PFN_vkDestroyPipeline)addrs->pvkDestroyPipeline)(device, pipeline, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroyPipeline(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkPipeline pipeline;
+	replay_raw(rd, &pipeline, sizeof(pipeline));
+	pipeline = (VkPipeline)replay_map(r, (uint64_t)(uintptr_t)pipeline);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroyPipeline == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroyPipeline)r->procs.pvkDestroyPipeline)(device, pipeline, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+VkResult vksCaptured_vkEnumeratePhysicalDevices(vksProcAddr* addrs, VkInstance instance, uint32_t* pPhysicalDeviceCount, VkPhysicalDevice* pPhysicalDevices) {
+	vksCaptureStream* s = capture_begin(30);
+	capture_raw(s, &instance, sizeof(instance));
+	capture_pointer(s, pPhysicalDeviceCount, (size_t)(1), sizeof(uint32_t));
+	capture_output(s, pPhysicalDevices, (size_t)((pPhysicalDeviceCount != NULL ? *pPhysicalDeviceCount : 0)));
+	VkResult ret = ((PFN_vkEnumeratePhysicalDevices)addrs->pvkEnumeratePhysicalDevices)(instance, pPhysicalDeviceCount, pPhysicalDevices);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pPhysicalDevices : NULL, (size_t)((pPhysicalDeviceCount != NULL ? *pPhysicalDeviceCount : 0)), sizeof(VkPhysicalDevice));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkEnumeratePhysicalDevices(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkInstance instance;
+	replay_raw(rd, &instance, sizeof(instance));
+	instance = (VkInstance)replay_map(r, (uint64_t)(uintptr_t)instance);
+	uint32_t* pPhysicalDeviceCount = NULL;
+	pPhysicalDeviceCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkPhysicalDevice* pPhysicalDevices = replay_output(r, rd, sizeof(VkPhysicalDevice));
+	if (rd->overflow || r->procs.pvkEnumeratePhysicalDevices == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkEnumeratePhysicalDevices)r->procs.pvkEnumeratePhysicalDevices)(instance, pPhysicalDeviceCount, pPhysicalDevices);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pPhysicalDevices, sizeof(VkPhysicalDevice));
+	}
+	return ret;
+}
+
+void vksCaptured_vkDestroyInstance(vksProcAddr* addrs, VkInstance instance, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(31);
+	capture_raw(s, &instance, sizeof(instance));
+	((PFN_vkDestroyInstance)addrs->pvkDestroyInstance)(instance, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroyInstance(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkInstance instance;
+	replay_raw(rd, &instance, sizeof(instance));
+	instance = (VkInstance)replay_map(r, (uint64_t)(uintptr_t)instance);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroyInstance == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroyInstance)r->procs.pvkDestroyInstance)(instance, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+VkResult vksCaptured_vkCreateInstance(vksProcAddr* addrs, VkInstanceCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkInstance* pInstance) {
+	vksCaptureStream* s = capture_begin(32);
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkInstanceCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkInstanceCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pInstance, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateInstance)addrs->pvkCreateInstance)(pCreateInfo, pAllocator, pInstance);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pInstance : NULL, (size_t)(1), sizeof(VkInstance));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateInstance(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkInstanceCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkInstanceCreateInfo* v = replay_pointer(r, rd, sizeof(VkInstanceCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkInstanceCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkInstance* pInstance = replay_output(r, rd, sizeof(VkInstance));
+	if (rd->overflow || r->global.pvkCreateInstance == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateInstance)r->global.pvkCreateInstance)(pCreateInfo, pAllocator, pInstance);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pInstance, sizeof(VkInstance));
+	}
+	if (ret >= 0) {
+		vksLoadInstanceProcAddrs(*pInstance, &r->procs);
+	}
+	return ret;
+}
+
+VkResult vksCaptured_vkCreateComputePipelines(vksProcAddr* addrs, VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, VkComputePipelineCreateInfo* pCreateInfos, VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
+	vksCaptureStream* s = capture_begin(33);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &pipelineCache, sizeof(pipelineCache));
+	capture_raw(s, &createInfoCount, sizeof(createInfoCount));
+	if (capture_pointer(s, pCreateInfos, (size_t)(createInfoCount), sizeof(VkComputePipelineCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(createInfoCount); i++) {
+			capture_VkComputePipelineCreateInfo(s, &pCreateInfos[i]);
+		}
+	}
+	capture_output(s, pPipelines, (size_t)(createInfoCount));
+	VkResult ret = ((PFN_vkCreateComputePipelines)addrs->pvkCreateComputePipelines)(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pPipelines : NULL, (size_t)(createInfoCount), sizeof(VkPipeline));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateComputePipelines(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkPipelineCache pipelineCache;
+	replay_raw(rd, &pipelineCache, sizeof(pipelineCache));
+	pipelineCache = (VkPipelineCache)replay_map(r, (uint64_t)(uintptr_t)pipelineCache);
+	uint32_t createInfoCount;
+	replay_raw(rd, &createInfoCount, sizeof(createInfoCount));
+	VkComputePipelineCreateInfo* pCreateInfos = NULL;
+	{
+		size_t n;
+		VkComputePipelineCreateInfo* v = replay_pointer(r, rd, sizeof(VkComputePipelineCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkComputePipelineCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfos = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkPipeline* pPipelines = replay_output(r, rd, sizeof(VkPipeline));
+	if (rd->overflow || r->procs.pvkCreateComputePipelines == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateComputePipelines)r->procs.pvkCreateComputePipelines)(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pPipelines, sizeof(VkPipeline));
+	}
+	return ret;
+}
+
+VkResult vksCaptured_vkCreateGraphicsPipelines(vksProcAddr* addrs, VkDevice device, VkPipelineCache pipelineCache, uint32_t createInfoCount, VkGraphicsPipelineCreateInfo* pCreateInfos, VkAllocationCallbacks* pAllocator, VkPipeline* pPipelines) {
+	vksCaptureStream* s = capture_begin(34);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &pipelineCache, sizeof(pipelineCache));
+	capture_raw(s, &createInfoCount, sizeof(createInfoCount));
+	if (capture_pointer(s, pCreateInfos, (size_t)(createInfoCount), sizeof(VkGraphicsPipelineCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(createInfoCount); i++) {
+			capture_VkGraphicsPipelineCreateInfo(s, &pCreateInfos[i]);
+		}
+	}
+	capture_output(s, pPipelines, (size_t)(createInfoCount));
+	VkResult ret = ((PFN_vkCreateGraphicsPipelines)addrs->pvkCreateGraphicsPipelines)(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pPipelines : NULL, (size_t)(createInfoCount), sizeof(VkPipeline));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateGraphicsPipelines(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkPipelineCache pipelineCache;
+	replay_raw(rd, &pipelineCache, sizeof(pipelineCache));
+	pipelineCache = (VkPipelineCache)replay_map(r, (uint64_t)(uintptr_t)pipelineCache);
+	uint32_t createInfoCount;
+	replay_raw(rd, &createInfoCount, sizeof(createInfoCount));
+	VkGraphicsPipelineCreateInfo* pCreateInfos = NULL;
+	{
+		size_t n;
+		VkGraphicsPipelineCreateInfo* v = replay_pointer(r, rd, sizeof(VkGraphicsPipelineCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkGraphicsPipelineCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfos = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkPipeline* pPipelines = replay_output(r, rd, sizeof(VkPipeline));
+	if (rd->overflow || r->procs.pvkCreateGraphicsPipelines == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateGraphicsPipelines)r->procs.pvkCreateGraphicsPipelines)(device, pipelineCache, createInfoCount, pCreateInfos, pAllocator, pPipelines);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pPipelines, sizeof(VkPipeline));
+	}
+	return ret;
+}
+
+void vksCaptured_vkGetPhysicalDeviceSparseImageFormatProperties(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkFormat format, VkImageType type, VkSampleCountFlagBits samples, VkImageUsageFlags usage, VkImageTiling tiling, uint32_t* pPropertyCount, VkSparseImageFormatProperties* pProperties) {
+	vksCaptureStream* s = capture_begin(35);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_raw(s, &format, sizeof(format));
+	capture_raw(s, &type, sizeof(type));
+	capture_raw(s, &samples, sizeof(samples));
+	capture_raw(s, &usage, sizeof(usage));
+	capture_raw(s, &tiling, sizeof(tiling));
+	capture_pointer(s, pPropertyCount, (size_t)(1), sizeof(uint32_t));
+	capture_pointer(s, pProperties, (size_t)((pPropertyCount != NULL ? *pPropertyCount : 0)), sizeof(VkSparseImageFormatProperties));
+	((PFN_vkGetPhysicalDeviceSparseImageFormatProperties)addrs->pvkGetPhysicalDeviceSparseImageFormatProperties)(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetPhysicalDeviceSparseImageFormatProperties(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkFormat format;
+	replay_raw(rd, &format, sizeof(format));
+	VkImageType type;
+	replay_raw(rd, &type, sizeof(type));
+	VkSampleCountFlagBits samples;
+	replay_raw(rd, &samples, sizeof(samples));
+	VkImageUsageFlags usage;
+	replay_raw(rd, &usage, sizeof(usage));
+	VkImageTiling tiling;
+	replay_raw(rd, &tiling, sizeof(tiling));
+	uint32_t* pPropertyCount = NULL;
+	pPropertyCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkSparseImageFormatProperties* pProperties = NULL;
+	pProperties = replay_pointer(r, rd, sizeof(VkSparseImageFormatProperties), NULL);
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceSparseImageFormatProperties == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetPhysicalDeviceSparseImageFormatProperties)r->procs.pvkGetPhysicalDeviceSparseImageFormatProperties)(physicalDevice, format, type, samples, usage, tiling, pPropertyCount, pProperties);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+VkResult vksCaptured_vkQueueBindSparse(vksProcAddr* addrs, VkQueue queue, uint32_t bindInfoCount, VkBindSparseInfo* pBindInfo, VkFence fence) {
+	vksCaptureStream* s = capture_begin(36);
+	capture_raw(s, &queue, sizeof(queue));
+	capture_raw(s, &bindInfoCount, sizeof(bindInfoCount));
+	if (capture_pointer(s, pBindInfo, (size_t)(bindInfoCount), sizeof(VkBindSparseInfo))) {
+		for (size_t i = 0; i < (size_t)(bindInfoCount); i++) {
+			capture_VkBindSparseInfo(s, &pBindInfo[i]);
+		}
+	}
+	capture_raw(s, &fence, sizeof(fence));
+	VkResult ret = ((PFN_vkQueueBindSparse)addrs->pvkQueueBindSparse)(queue, bindInfoCount, pBindInfo, fence);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkQueueBindSparse(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkQueue queue;
+	replay_raw(rd, &queue, sizeof(queue));
+	queue = (VkQueue)replay_map(r, (uint64_t)(uintptr_t)queue);
+	uint32_t bindInfoCount;
+	replay_raw(rd, &bindInfoCount, sizeof(bindInfoCount));
+	VkBindSparseInfo* pBindInfo = NULL;
+	{
+		size_t n;
+		VkBindSparseInfo* v = replay_pointer(r, rd, sizeof(VkBindSparseInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkBindSparseInfo(r, rd, &v[i]);
+		}
+		pBindInfo = v;
+	}
+	VkFence fence;
+	replay_raw(rd, &fence, sizeof(fence));
+	fence = (VkFence)replay_map(r, (uint64_t)(uintptr_t)fence);
+	if (rd->overflow || r->procs.pvkQueueBindSparse == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkQueueBindSparse)r->procs.pvkQueueBindSparse)(queue, bindInfoCount, pBindInfo, fence);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+VkResult vksCaptured_vkMergePipelineCaches(vksProcAddr* addrs, VkDevice device, VkPipelineCache dstCache, uint32_t srcCacheCount, VkPipelineCache* pSrcCaches) {
+	vksCaptureStream* s = capture_begin(37);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &dstCache, sizeof(dstCache));
+	capture_raw(s, &srcCacheCount, sizeof(srcCacheCount));
+	capture_pointer(s, pSrcCaches, (size_t)(srcCacheCount), sizeof(VkPipelineCache));
+	VkResult ret = ((PFN_vkMergePipelineCaches)addrs->pvkMergePipelineCaches)(device, dstCache, srcCacheCount, pSrcCaches);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkMergePipelineCaches(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkPipelineCache dstCache;
+	replay_raw(rd, &dstCache, sizeof(dstCache));
+	dstCache = (VkPipelineCache)replay_map(r, (uint64_t)(uintptr_t)dstCache);
+	uint32_t srcCacheCount;
+	replay_raw(rd, &srcCacheCount, sizeof(srcCacheCount));
+	VkPipelineCache* pSrcCaches = NULL;
+	{
+		size_t n;
+		VkPipelineCache* v = replay_pointer(r, rd, sizeof(VkPipelineCache), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkPipelineCache)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		pSrcCaches = v;
+	}
+	if (rd->overflow || r->procs.pvkMergePipelineCaches == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkMergePipelineCaches)r->procs.pvkMergePipelineCaches)(device, dstCache, srcCacheCount, pSrcCaches);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+VkResult vksCaptured_vkGetPipelineCacheData(vksProcAddr* addrs, VkDevice device, VkPipelineCache pipelineCache, size_t* pDataSize, void* pData) {
+	vksCaptureStream* s = capture_begin(38);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &pipelineCache, sizeof(pipelineCache));
+	capture_pointer(s, pDataSize, (size_t)(1), sizeof(size_t));
+	capture_pointer(s, pData, (size_t)((pDataSize != NULL ? *pDataSize : 0)), sizeof(uint8_t));
+	VkResult ret = ((PFN_vkGetPipelineCacheData)addrs->pvkGetPipelineCacheData)(device, pipelineCache, pDataSize, pData);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetPipelineCacheData(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkPipelineCache pipelineCache;
+	replay_raw(rd, &pipelineCache, sizeof(pipelineCache));
+	pipelineCache = (VkPipelineCache)replay_map(r, (uint64_t)(uintptr_t)pipelineCache);
+	size_t* pDataSize = NULL;
+	pDataSize = replay_pointer(r, rd, sizeof(size_t), NULL);
+	void* pData = NULL;
+	pData = replay_pointer(r, rd, sizeof(uint8_t), NULL);
+	if (rd->overflow || r->procs.pvkGetPipelineCacheData == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetPipelineCacheData)r->procs.pvkGetPipelineCacheData)(device, pipelineCache, pDataSize, pData);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+void vksCaptured_vkDestroyPipelineCache(vksProcAddr* addrs, VkDevice device, VkPipelineCache pipelineCache, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(39);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &pipelineCache, sizeof(pipelineCache));
+	((PFN_vkDestroyPipelineCache)addrs->pvkDestroyPipelineCache)(device, pipelineCache, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroyPipelineCache(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkPipelineCache pipelineCache;
+	replay_raw(rd, &pipelineCache, sizeof(pipelineCache));
+	pipelineCache = (VkPipelineCache)replay_map(r, (uint64_t)(uintptr_t)pipelineCache);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroyPipelineCache == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroyPipelineCache)r->procs.pvkDestroyPipelineCache)(device, pipelineCache, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+VkResult vksCaptured_vkCreatePipelineCache(vksProcAddr* addrs, VkDevice device, VkPipelineCacheCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkPipelineCache* pPipelineCache) {
+	vksCaptureStream* s = capture_begin(40);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkPipelineCacheCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPipelineCacheCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pPipelineCache, (size_t)(1));
+	VkResult ret = ((PFN_vkCreatePipelineCache)addrs->pvkCreatePipelineCache)(device, pCreateInfo, pAllocator, pPipelineCache);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pPipelineCache : NULL, (size_t)(1), sizeof(VkPipelineCache));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreatePipelineCache(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkPipelineCacheCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkPipelineCacheCreateInfo* v = replay_pointer(r, rd, sizeof(VkPipelineCacheCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPipelineCacheCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkPipelineCache* pPipelineCache = replay_output(r, rd, sizeof(VkPipelineCache));
+	if (rd->overflow || r->procs.pvkCreatePipelineCache == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreatePipelineCache)r->procs.pvkCreatePipelineCache)(device, pCreateInfo, pAllocator, pPipelineCache);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pPipelineCache, sizeof(VkPipelineCache));
+	}
+	return ret;
+}
+
+void vksCaptured_vkDestroyShaderModule(vksProcAddr* addrs, VkDevice device, VkShaderModule shaderModule, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(41);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &shaderModule, sizeof(shaderModule));
+	((PFN_vkDestroyShaderModule)addrs->pvkDestroyShaderModule)(device, shaderModule, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroyShaderModule(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkShaderModule shaderModule;
+	replay_raw(rd, &shaderModule, sizeof(shaderModule));
+	shaderModule = (VkShaderModule)replay_map(r, (uint64_t)(uintptr_t)shaderModule);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroyShaderModule == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroyShaderModule)r->procs.pvkDestroyShaderModule)(device, shaderModule, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+VkResult vksCaptured_vkCreateShaderModule(vksProcAddr* addrs, VkDevice device, VkShaderModuleCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkShaderModule* pShaderModule) {
+	vksCaptureStream* s = capture_begin(42);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkShaderModuleCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkShaderModuleCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pShaderModule, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateShaderModule)addrs->pvkCreateShaderModule)(device, pCreateInfo, pAllocator, pShaderModule);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pShaderModule : NULL, (size_t)(1), sizeof(VkShaderModule));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateShaderModule(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkShaderModuleCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkShaderModuleCreateInfo* v = replay_pointer(r, rd, sizeof(VkShaderModuleCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkShaderModuleCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkShaderModule* pShaderModule = replay_output(r, rd, sizeof(VkShaderModule));
+	if (rd->overflow || r->procs.pvkCreateShaderModule == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateShaderModule)r->procs.pvkCreateShaderModule)(device, pCreateInfo, pAllocator, pShaderModule);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pShaderModule, sizeof(VkShaderModule));
+	}
+	return ret;
+}
+
+void vksCaptured_vkDestroyImageView(vksProcAddr* addrs, VkDevice device, VkImageView imageView, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(43);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &imageView, sizeof(imageView));
+	((PFN_vkDestroyImageView)addrs->pvkDestroyImageView)(device, imageView, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroyImageView(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkImageView imageView;
+	replay_raw(rd, &imageView, sizeof(imageView));
+	imageView = (VkImageView)replay_map(r, (uint64_t)(uintptr_t)imageView);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroyImageView == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroyImageView)r->procs.pvkDestroyImageView)(device, imageView, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+VkResult vksCaptured_vkCreateDescriptorPool(vksProcAddr* addrs, VkDevice device, VkDescriptorPoolCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkDescriptorPool* pDescriptorPool) {
+	vksCaptureStream* s = capture_begin(44);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkDescriptorPoolCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkDescriptorPoolCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pDescriptorPool, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateDescriptorPool)addrs->pvkCreateDescriptorPool)(device, pCreateInfo, pAllocator, pDescriptorPool);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pDescriptorPool : NULL, (size_t)(1), sizeof(VkDescriptorPool));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateDescriptorPool(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkDescriptorPoolCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkDescriptorPoolCreateInfo* v = replay_pointer(r, rd, sizeof(VkDescriptorPoolCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDescriptorPoolCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkDescriptorPool* pDescriptorPool = replay_output(r, rd, sizeof(VkDescriptorPool));
+	if (rd->overflow || r->procs.pvkCreateDescriptorPool == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateDescriptorPool)r->procs.pvkCreateDescriptorPool)(device, pCreateInfo, pAllocator, pDescriptorPool);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pDescriptorPool, sizeof(VkDescriptorPool));
+	}
+	return ret;
+}
+
+VkResult vksCaptured_vkCreateImageView(vksProcAddr* addrs, VkDevice device, VkImageViewCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkImageView* pView) {
+	vksCaptureStream* s = capture_begin(45);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkImageViewCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkImageViewCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pView, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateImageView)addrs->pvkCreateImageView)(device, pCreateInfo, pAllocator, pView);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pView : NULL, (size_t)(1), sizeof(VkImageView));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateImageView(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkImageViewCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkImageViewCreateInfo* v = replay_pointer(r, rd, sizeof(VkImageViewCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkImageViewCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkImageView* pView = replay_output(r, rd, sizeof(VkImageView));
+	if (rd->overflow || r->procs.pvkCreateImageView == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateImageView)r->procs.pvkCreateImageView)(device, pCreateInfo, pAllocator, pView);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pView, sizeof(VkImageView));
+	}
+	return ret;
+}
+
+VkResult vksCaptured_vkCreateFence(vksProcAddr* addrs, VkDevice device, VkFenceCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkFence* pFence) {
+	vksCaptureStream* s = capture_begin(46);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkFenceCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkFenceCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pFence, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateFence)addrs->pvkCreateFence)(device, pCreateInfo, pAllocator, pFence);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pFence : NULL, (size_t)(1), sizeof(VkFence));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateFence(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkFenceCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkFenceCreateInfo* v = replay_pointer(r, rd, sizeof(VkFenceCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkFenceCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkFence* pFence = replay_output(r, rd, sizeof(VkFence));
+	if (rd->overflow || r->procs.pvkCreateFence == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateFence)r->procs.pvkCreateFence)(device, pCreateInfo, pAllocator, pFence);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pFence, sizeof(VkFence));
+	}
+	return ret;
+}
+
+void vksCaptured_vkGetImageSubresourceLayout(vksProcAddr* addrs, VkDevice device, VkImage image, VkImageSubresource* pSubresource, VkSubresourceLayout* pLayout) {
+	vksCaptureStream* s = capture_begin(47);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &image, sizeof(image));
+	capture_pointer(s, pSubresource, (size_t)(1), sizeof(VkImageSubresource));
+	capture_pointer(s, pLayout, (size_t)(1), sizeof(VkSubresourceLayout));
+	((PFN_vkGetImageSubresourceLayout)addrs->pvkGetImageSubresourceLayout)(device, image, pSubresource, pLayout);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetImageSubresourceLayout(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkImage image;
+	replay_raw(rd, &image, sizeof(image));
+	image = (VkImage)replay_map(r, (uint64_t)(uintptr_t)image);
+	VkImageSubresource* pSubresource = NULL;
+	pSubresource = replay_pointer(r, rd, sizeof(VkImageSubresource), NULL);
+	VkSubresourceLayout* pLayout = NULL;
+	pLayout = replay_pointer(r, rd, sizeof(VkSubresourceLayout), NULL);
+	if (rd->overflow || r->procs.pvkGetImageSubresourceLayout == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetImageSubresourceLayout)r->procs.pvkGetImageSubresourceLayout)(device, image, pSubresource, pLayout);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkDestroyDescriptorSetLayout(vksProcAddr* addrs, VkDevice device, VkDescriptorSetLayout descriptorSetLayout, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(48);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &descriptorSetLayout, sizeof(descriptorSetLayout));
+	((PFN_vkDestroyDescriptorSetLayout)addrs->pvkDestroyDescriptorSetLayout)(device, descriptorSetLayout, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroyDescriptorSetLayout(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkDescriptorSetLayout descriptorSetLayout;
+	replay_raw(rd, &descriptorSetLayout, sizeof(descriptorSetLayout));
+	descriptorSetLayout = (VkDescriptorSetLayout)replay_map(r, (uint64_t)(uintptr_t)descriptorSetLayout);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroyDescriptorSetLayout == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroyDescriptorSetLayout)r->procs.pvkDestroyDescriptorSetLayout)(device, descriptorSetLayout, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+VkResult vksCaptured_vkCreateDescriptorSetLayout(vksProcAddr* addrs, VkDevice device, VkDescriptorSetLayoutCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkDescriptorSetLayout* pSetLayout) {
+	vksCaptureStream* s = capture_begin(49);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkDescriptorSetLayoutCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkDescriptorSetLayoutCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pSetLayout, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateDescriptorSetLayout)addrs->pvkCreateDescriptorSetLayout)(device, pCreateInfo, pAllocator, pSetLayout);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pSetLayout : NULL, (size_t)(1), sizeof(VkDescriptorSetLayout));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateDescriptorSetLayout(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkDescriptorSetLayoutCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkDescriptorSetLayoutCreateInfo* v = replay_pointer(r, rd, sizeof(VkDescriptorSetLayoutCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDescriptorSetLayoutCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkDescriptorSetLayout* pSetLayout = replay_output(r, rd, sizeof(VkDescriptorSetLayout));
+	if (rd->overflow || r->procs.pvkCreateDescriptorSetLayout == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateDescriptorSetLayout)r->procs.pvkCreateDescriptorSetLayout)(device, pCreateInfo, pAllocator, pSetLayout);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pSetLayout, sizeof(VkDescriptorSetLayout));
+	}
+	return ret;
+}
+
+VkResult vksCaptured_vkCreateCommandPool(vksProcAddr* addrs, VkDevice device, VkCommandPoolCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkCommandPool* pCommandPool) {
+	vksCaptureStream* s = capture_begin(50);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkCommandPoolCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkCommandPoolCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pCommandPool, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateCommandPool)addrs->pvkCreateCommandPool)(device, pCreateInfo, pAllocator, pCommandPool);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pCommandPool : NULL, (size_t)(1), sizeof(VkCommandPool));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateCommandPool(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkCommandPoolCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkCommandPoolCreateInfo* v = replay_pointer(r, rd, sizeof(VkCommandPoolCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkCommandPoolCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkCommandPool* pCommandPool = replay_output(r, rd, sizeof(VkCommandPool));
+	if (rd->overflow || r->procs.pvkCreateCommandPool == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateCommandPool)r->procs.pvkCreateCommandPool)(device, pCreateInfo, pAllocator, pCommandPool);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pCommandPool, sizeof(VkCommandPool));
+	}
+	return ret;
+}
+
+void vksCaptured_vkDestroyCommandPool(vksProcAddr* addrs, VkDevice device, VkCommandPool commandPool, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(51);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &commandPool, sizeof(commandPool));
+	((PFN_vkDestroyCommandPool)addrs->pvkDestroyCommandPool)(device, commandPool, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroyCommandPool(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkCommandPool commandPool;
+	replay_raw(rd, &commandPool, sizeof(commandPool));
+	commandPool = (VkCommandPool)replay_map(r, (uint64_t)(uintptr_t)commandPool);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroyCommandPool == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroyCommandPool)r->procs.pvkDestroyCommandPool)(device, commandPool, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+VkResult vksCaptured_vkResetCommandPool(vksProcAddr* addrs, VkDevice device, VkCommandPool commandPool, VkCommandPoolResetFlags flags) {
+	vksCaptureStream* s = capture_begin(52);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &commandPool, sizeof(commandPool));
+	capture_raw(s, &flags, sizeof(flags));
+	VkResult ret = ((PFN_vkResetCommandPool)addrs->pvkResetCommandPool)(device, commandPool, flags);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkResetCommandPool(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkCommandPool commandPool;
+	replay_raw(rd, &commandPool, sizeof(commandPool));
+	commandPool = (VkCommandPool)replay_map(r, (uint64_t)(uintptr_t)commandPool);
+	VkCommandPoolResetFlags flags;
+	replay_raw(rd, &flags, sizeof(flags));
+	if (rd->overflow || r->procs.pvkResetCommandPool == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkResetCommandPool)r->procs.pvkResetCommandPool)(device, commandPool, flags);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+VkResult vksCaptured_vkAllocateMemory(vksProcAddr* addrs, VkDevice device, VkMemoryAllocateInfo* pAllocateInfo, VkAllocationCallbacks* pAllocator, VkDeviceMemory* pMemory) {
+	vksCaptureStream* s = capture_begin(53);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pAllocateInfo, (size_t)(1), sizeof(VkMemoryAllocateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkMemoryAllocateInfo(s, &pAllocateInfo[i]);
+		}
+	}
+	capture_output(s, pMemory, (size_t)(1));
+	VkResult ret = ((PFN_vkAllocateMemory)addrs->pvkAllocateMemory)(device, pAllocateInfo, pAllocator, pMemory);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pMemory : NULL, (size_t)(1), sizeof(VkDeviceMemory));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkAllocateMemory(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkMemoryAllocateInfo* pAllocateInfo = NULL;
+	{
+		size_t n;
+		VkMemoryAllocateInfo* v = replay_pointer(r, rd, sizeof(VkMemoryAllocateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkMemoryAllocateInfo(r, rd, &v[i]);
+		}
+		pAllocateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkDeviceMemory* pMemory = replay_output(r, rd, sizeof(VkDeviceMemory));
+	if (rd->overflow || r->procs.pvkAllocateMemory == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkAllocateMemory)r->procs.pvkAllocateMemory)(device, pAllocateInfo, pAllocator, pMemory);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pMemory, sizeof(VkDeviceMemory));
+	}
+	return ret;
+}
+
+VkResult vksCaptured_vkDeviceWaitIdle(vksProcAddr* addrs, VkDevice device) {
+	vksCaptureStream* s = capture_begin(54);
+	capture_raw(s, &device, sizeof(device));
+	VkResult ret = ((PFN_vkDeviceWaitIdle)addrs->pvkDeviceWaitIdle)(device);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkDeviceWaitIdle(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	if (rd->overflow || r->procs.pvkDeviceWaitIdle == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkDeviceWaitIdle)r->procs.pvkDeviceWaitIdle)(device);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+VkResult vksCaptured_vkQueueWaitIdle(vksProcAddr* addrs, VkQueue queue) {
+	vksCaptureStream* s = capture_begin(55);
+	capture_raw(s, &queue, sizeof(queue));
+	VkResult ret = ((PFN_vkQueueWaitIdle)addrs->pvkQueueWaitIdle)(queue);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkQueueWaitIdle(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkQueue queue;
+	replay_raw(rd, &queue, sizeof(queue));
+	queue = (VkQueue)replay_map(r, (uint64_t)(uintptr_t)queue);
+	if (rd->overflow || r->procs.pvkQueueWaitIdle == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkQueueWaitIdle)r->procs.pvkQueueWaitIdle)(queue);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+void vksCaptured_vkDestroyImage(vksProcAddr* addrs, VkDevice device, VkImage image, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(56);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &image, sizeof(image));
+	((PFN_vkDestroyImage)addrs->pvkDestroyImage)(device, image, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroyImage(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkImage image;
+	replay_raw(rd, &image, sizeof(image));
+	image = (VkImage)replay_map(r, (uint64_t)(uintptr_t)image);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroyImage == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroyImage)r->procs.pvkDestroyImage)(device, image, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+VkResult vksCaptured_vkQueueSubmit(vksProcAddr* addrs, VkQueue queue, uint32_t submitCount, VkSubmitInfo* pSubmits, VkFence fence) {
+	vksCaptureStream* s = capture_begin(57);
+	capture_raw(s, &queue, sizeof(queue));
+	capture_raw(s, &submitCount, sizeof(submitCount));
+	if (capture_pointer(s, pSubmits, (size_t)(submitCount), sizeof(VkSubmitInfo))) {
+		for (size_t i = 0; i < (size_t)(submitCount); i++) {
+			capture_VkSubmitInfo(s, &pSubmits[i]);
+		}
+	}
+	capture_raw(s, &fence, sizeof(fence));
+	VkResult ret = ((PFN_vkQueueSubmit)addrs->pvkQueueSubmit)(queue, submitCount, pSubmits, fence);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkQueueSubmit(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkQueue queue;
+	replay_raw(rd, &queue, sizeof(queue));
+	queue = (VkQueue)replay_map(r, (uint64_t)(uintptr_t)queue);
+	uint32_t submitCount;
+	replay_raw(rd, &submitCount, sizeof(submitCount));
+	VkSubmitInfo* pSubmits = NULL;
+	{
+		size_t n;
+		VkSubmitInfo* v = replay_pointer(r, rd, sizeof(VkSubmitInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSubmitInfo(r, rd, &v[i]);
+		}
+		pSubmits = v;
+	}
+	VkFence fence;
+	replay_raw(rd, &fence, sizeof(fence));
+	fence = (VkFence)replay_map(r, (uint64_t)(uintptr_t)fence);
+	if (rd->overflow || r->procs.pvkQueueSubmit == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkQueueSubmit)r->procs.pvkQueueSubmit)(queue, submitCount, pSubmits, fence);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+void vksCaptured_vkGetDeviceQueue(vksProcAddr* addrs, VkDevice device, uint32_t queueFamilyIndex, uint32_t queueIndex, VkQueue* pQueue) {
+	vksCaptureStream* s = capture_begin(58);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &queueFamilyIndex, sizeof(queueFamilyIndex));
+	capture_raw(s, &queueIndex, sizeof(queueIndex));
+	capture_output(s, pQueue, (size_t)(1));
+	((PFN_vkGetDeviceQueue)addrs->pvkGetDeviceQueue)(device, queueFamilyIndex, queueIndex, pQueue);
+	int ok = 1;
+	capture_pointer(s, ok ? pQueue : NULL, (size_t)(1), sizeof(VkQueue));
+	capture_end(s);
+}
+
+static VkResult replay_vkGetDeviceQueue(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	uint32_t queueFamilyIndex;
+	replay_raw(rd, &queueFamilyIndex, sizeof(queueFamilyIndex));
+	uint32_t queueIndex;
+	replay_raw(rd, &queueIndex, sizeof(queueIndex));
+	VkQueue* pQueue = replay_output(r, rd, sizeof(VkQueue));
+	if (rd->overflow || r->procs.pvkGetDeviceQueue == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetDeviceQueue)r->procs.pvkGetDeviceQueue)(device, queueFamilyIndex, queueIndex, pQueue);
+	*ns = replay_now() - start;
+	replay_remap(r, rd, pQueue, sizeof(VkQueue));
+	return VK_SUCCESS;
+}
+
+VkResult vksCaptured_vkAllocateCommandBuffers(vksProcAddr* addrs, VkDevice device, VkCommandBufferAllocateInfo* pAllocateInfo, VkCommandBuffer* pCommandBuffers) {
+	vksCaptureStream* s = capture_begin(59);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pAllocateInfo, (size_t)(1), sizeof(VkCommandBufferAllocateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkCommandBufferAllocateInfo(s, &pAllocateInfo[i]);
+		}
+	}
+	capture_output(s, pCommandBuffers, (size_t)(pAllocateInfo->commandBufferCount));
+	VkResult ret = ((PFN_vkAllocateCommandBuffers)addrs->pvkAllocateCommandBuffers)(device, pAllocateInfo, pCommandBuffers);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pCommandBuffers : NULL, (size_t)(pAllocateInfo->commandBufferCount), sizeof(VkCommandBuffer));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkAllocateCommandBuffers(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkCommandBufferAllocateInfo* pAllocateInfo = NULL;
+	{
+		size_t n;
+		VkCommandBufferAllocateInfo* v = replay_pointer(r, rd, sizeof(VkCommandBufferAllocateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkCommandBufferAllocateInfo(r, rd, &v[i]);
+		}
+		pAllocateInfo = v;
+	}
+	VkCommandBuffer* pCommandBuffers = replay_output(r, rd, sizeof(VkCommandBuffer));
+	if (rd->overflow || r->procs.pvkAllocateCommandBuffers == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkAllocateCommandBuffers)r->procs.pvkAllocateCommandBuffers)(device, pAllocateInfo, pCommandBuffers);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pCommandBuffers, sizeof(VkCommandBuffer));
+	}
+	return ret;
+}
+
+void vksCaptured_vkFreeCommandBuffers(vksProcAddr* addrs, VkDevice device, VkCommandPool commandPool, uint32_t commandBufferCount, VkCommandBuffer* pCommandBuffers) {
+	vksCaptureStream* s = capture_begin(60);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &commandPool, sizeof(commandPool));
+	capture_raw(s, &commandBufferCount, sizeof(commandBufferCount));
+	capture_pointer(s, pCommandBuffers, (size_t)(commandBufferCount), sizeof(VkCommandBuffer));
+	((PFN_vkFreeCommandBuffers)addrs->pvkFreeCommandBuffers)(device, commandPool, commandBufferCount, pCommandBuffers);
+	capture_end(s);
+}
+
+static VkResult replay_vkFreeCommandBuffers(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkCommandPool commandPool;
+	replay_raw(rd, &commandPool, sizeof(commandPool));
+	commandPool = (VkCommandPool)replay_map(r, (uint64_t)(uintptr_t)commandPool);
+	uint32_t commandBufferCount;
+	replay_raw(rd, &commandBufferCount, sizeof(commandBufferCount));
+	VkCommandBuffer* pCommandBuffers = NULL;
+	{
+		size_t n;
+		VkCommandBuffer* v = replay_pointer(r, rd, sizeof(VkCommandBuffer), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		pCommandBuffers = v;
+	}
+	if (rd->overflow || r->procs.pvkFreeCommandBuffers == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkFreeCommandBuffers)r->procs.pvkFreeCommandBuffers)(device, commandPool, commandBufferCount, pCommandBuffers);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+VkResult vksCaptured_vkBeginCommandBuffer(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkCommandBufferBeginInfo* pBeginInfo) {
+	vksCaptureStream* s = capture_begin(61);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	if (capture_pointer(s, pBeginInfo, (size_t)(1), sizeof(VkCommandBufferBeginInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkCommandBufferBeginInfo(s, &pBeginInfo[i]);
+		}
+	}
+	VkResult ret = ((PFN_vkBeginCommandBuffer)addrs->pvkBeginCommandBuffer)(commandBuffer, pBeginInfo);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkBeginCommandBuffer(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkCommandBufferBeginInfo* pBeginInfo = NULL;
+	{
+		size_t n;
+		VkCommandBufferBeginInfo* v = replay_pointer(r, rd, sizeof(VkCommandBufferBeginInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkCommandBufferBeginInfo(r, rd, &v[i]);
+		}
+		pBeginInfo = v;
+	}
+	if (rd->overflow || r->procs.pvkBeginCommandBuffer == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkBeginCommandBuffer)r->procs.pvkBeginCommandBuffer)(commandBuffer, pBeginInfo);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+VkResult vksCaptured_vkEndCommandBuffer(vksProcAddr* addrs, VkCommandBuffer commandBuffer) {
+	vksCaptureStream* s = capture_begin(62);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	VkResult ret = ((PFN_vkEndCommandBuffer)addrs->pvkEndCommandBuffer)(commandBuffer);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkEndCommandBuffer(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	if (rd->overflow || r->procs.pvkEndCommandBuffer == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkEndCommandBuffer)r->procs.pvkEndCommandBuffer)(commandBuffer);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+VkResult vksCaptured_vkResetCommandBuffer(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkCommandBufferResetFlags flags) {
+	vksCaptureStream* s = capture_begin(63);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &flags, sizeof(flags));
+	VkResult ret = ((PFN_vkResetCommandBuffer)addrs->pvkResetCommandBuffer)(commandBuffer, flags);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkResetCommandBuffer(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkCommandBufferResetFlags flags;
+	replay_raw(rd, &flags, sizeof(flags));
+	if (rd->overflow || r->procs.pvkResetCommandBuffer == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkResetCommandBuffer)r->procs.pvkResetCommandBuffer)(commandBuffer, flags);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+VkResult vksCaptured_vkEnumerateDeviceLayerProperties(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkLayerProperties* pProperties) {
+	vksCaptureStream* s = capture_begin(64);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_pointer(s, pPropertyCount, (size_t)(1), sizeof(uint32_t));
+	capture_pointer(s, pProperties, (size_t)((pPropertyCount != NULL ? *pPropertyCount : 0)), sizeof(VkLayerProperties));
+	VkResult ret = ((PFN_vkEnumerateDeviceLayerProperties)addrs->pvkEnumerateDeviceLayerProperties)(physicalDevice, pPropertyCount, pProperties);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkEnumerateDeviceLayerProperties(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	uint32_t* pPropertyCount = NULL;
+	pPropertyCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkLayerProperties* pProperties = NULL;
+	pProperties = replay_pointer(r, rd, sizeof(VkLayerProperties), NULL);
+	if (rd->overflow || r->procs.pvkEnumerateDeviceLayerProperties == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkEnumerateDeviceLayerProperties)r->procs.pvkEnumerateDeviceLayerProperties)(physicalDevice, pPropertyCount, pProperties);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+VkResult vksCaptured_vkCreateImage(vksProcAddr* addrs, VkDevice device, VkImageCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkImage* pImage) {
+	vksCaptureStream* s = capture_begin(65);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkImageCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkImageCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pImage, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateImage)addrs->pvkCreateImage)(device, pCreateInfo, pAllocator, pImage);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pImage : NULL, (size_t)(1), sizeof(VkImage));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateImage(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkImageCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkImageCreateInfo* v = replay_pointer(r, rd, sizeof(VkImageCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkImageCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkImage* pImage = replay_output(r, rd, sizeof(VkImage));
+	if (rd->overflow || r->procs.pvkCreateImage == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateImage)r->procs.pvkCreateImage)(device, pCreateInfo, pAllocator, pImage);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pImage, sizeof(VkImage));
+	}
+	return ret;
+}
+
+VkResult vksCaptured_vkCreateBuffer(vksProcAddr* addrs, VkDevice device, VkBufferCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkBuffer* pBuffer) {
+	vksCaptureStream* s = capture_begin(66);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkBufferCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkBufferCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pBuffer, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateBuffer)addrs->pvkCreateBuffer)(device, pCreateInfo, pAllocator, pBuffer);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pBuffer : NULL, (size_t)(1), sizeof(VkBuffer));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateBuffer(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkBufferCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkBufferCreateInfo* v = replay_pointer(r, rd, sizeof(VkBufferCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkBufferCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkBuffer* pBuffer = replay_output(r, rd, sizeof(VkBuffer));
+	if (rd->overflow || r->procs.pvkCreateBuffer == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateBuffer)r->procs.pvkCreateBuffer)(device, pCreateInfo, pAllocator, pBuffer);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pBuffer, sizeof(VkBuffer));
+	}
+	return ret;
+}
+
+void vksCaptured_vkDestroyDescriptorPool(vksProcAddr* addrs, VkDevice device, VkDescriptorPool descriptorPool, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(67);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &descriptorPool, sizeof(descriptorPool));
+	((PFN_vkDestroyDescriptorPool)addrs->pvkDestroyDescriptorPool)(device, descriptorPool, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroyDescriptorPool(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkDescriptorPool descriptorPool;
+	replay_raw(rd, &descriptorPool, sizeof(descriptorPool));
+	descriptorPool = (VkDescriptorPool)replay_map(r, (uint64_t)(uintptr_t)descriptorPool);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroyDescriptorPool == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroyDescriptorPool)r->procs.pvkDestroyDescriptorPool)(device, descriptorPool, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkGetPhysicalDeviceMemoryProperties(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties* pMemoryProperties) {
+	vksCaptureStream* s = capture_begin(68);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_pointer(s, pMemoryProperties, (size_t)(1), sizeof(VkPhysicalDeviceMemoryProperties));
+	((PFN_vkGetPhysicalDeviceMemoryProperties)addrs->pvkGetPhysicalDeviceMemoryProperties)(physicalDevice, pMemoryProperties);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetPhysicalDeviceMemoryProperties(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkPhysicalDeviceMemoryProperties* pMemoryProperties = NULL;
+	pMemoryProperties = replay_pointer(r, rd, sizeof(VkPhysicalDeviceMemoryProperties), NULL);
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceMemoryProperties == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetPhysicalDeviceMemoryProperties)r->procs.pvkGetPhysicalDeviceMemoryProperties)(physicalDevice, pMemoryProperties);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+VkResult vksCaptured_vkEnumerateDeviceExtensionProperties(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties) {
+	vksCaptureStream* s = capture_begin(69);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_string(s, pLayerName);
+	capture_pointer(s, pPropertyCount, (size_t)(1), sizeof(uint32_t));
+	capture_pointer(s, pProperties, (size_t)((pPropertyCount != NULL ? *pPropertyCount : 0)), sizeof(VkExtensionProperties));
+	VkResult ret = ((PFN_vkEnumerateDeviceExtensionProperties)addrs->pvkEnumerateDeviceExtensionProperties)(physicalDevice, pLayerName, pPropertyCount, pProperties);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkEnumerateDeviceExtensionProperties(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	char* pLayerName = NULL;
+	pLayerName = replay_string(r, rd);
+	uint32_t* pPropertyCount = NULL;
+	pPropertyCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkExtensionProperties* pProperties = NULL;
+	pProperties = replay_pointer(r, rd, sizeof(VkExtensionProperties), NULL);
+	if (rd->overflow || r->procs.pvkEnumerateDeviceExtensionProperties == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkEnumerateDeviceExtensionProperties)r->procs.pvkEnumerateDeviceExtensionProperties)(physicalDevice, pLayerName, pPropertyCount, pProperties);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+void vksCaptured_vkDestroySampler(vksProcAddr* addrs, VkDevice device, VkSampler sampler, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(70);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &sampler, sizeof(sampler));
+	((PFN_vkDestroySampler)addrs->pvkDestroySampler)(device, sampler, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroySampler(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkSampler sampler;
+	replay_raw(rd, &sampler, sizeof(sampler));
+	sampler = (VkSampler)replay_map(r, (uint64_t)(uintptr_t)sampler);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroySampler == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroySampler)r->procs.pvkDestroySampler)(device, sampler, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+VkResult vksCaptured_vkCreateSampler(vksProcAddr* addrs, VkDevice device, VkSamplerCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkSampler* pSampler) {
+	vksCaptureStream* s = capture_begin(71);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkSamplerCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkSamplerCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pSampler, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateSampler)addrs->pvkCreateSampler)(device, pCreateInfo, pAllocator, pSampler);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pSampler : NULL, (size_t)(1), sizeof(VkSampler));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateSampler(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkSamplerCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkSamplerCreateInfo* v = replay_pointer(r, rd, sizeof(VkSamplerCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSamplerCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkSampler* pSampler = replay_output(r, rd, sizeof(VkSampler));
+	if (rd->overflow || r->procs.pvkCreateSampler == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateSampler)r->procs.pvkCreateSampler)(device, pCreateInfo, pAllocator, pSampler);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pSampler, sizeof(VkSampler));
+	}
+	return ret;
+}
+
+VkResult vksCaptured_vkEnumerateInstanceExtensionProperties(vksProcAddr* addrs, char* pLayerName, uint32_t* pPropertyCount, VkExtensionProperties* pProperties) {
+	vksCaptureStream* s = capture_begin(72);
+	capture_string(s, pLayerName);
+	capture_pointer(s, pPropertyCount, (size_t)(1), sizeof(uint32_t));
+	capture_pointer(s, pProperties, (size_t)((pPropertyCount != NULL ? *pPropertyCount : 0)), sizeof(VkExtensionProperties));
+	VkResult ret = ((PFN_vkEnumerateInstanceExtensionProperties)addrs->pvkEnumerateInstanceExtensionProperties)(pLayerName, pPropertyCount, pProperties);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkEnumerateInstanceExtensionProperties(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	char* pLayerName = NULL;
+	pLayerName = replay_string(r, rd);
+	uint32_t* pPropertyCount = NULL;
+	pPropertyCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkExtensionProperties* pProperties = NULL;
+	pProperties = replay_pointer(r, rd, sizeof(VkExtensionProperties), NULL);
+	if (rd->overflow || r->global.pvkEnumerateInstanceExtensionProperties == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkEnumerateInstanceExtensionProperties)r->global.pvkEnumerateInstanceExtensionProperties)(pLayerName, pPropertyCount, pProperties);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+void vksCaptured_vkDestroyDevice(vksProcAddr* addrs, VkDevice device, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(73);
+	capture_raw(s, &device, sizeof(device));
+	((PFN_vkDestroyDevice)addrs->pvkDestroyDevice)(device, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroyDevice(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroyDevice == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroyDevice)r->procs.pvkDestroyDevice)(device, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkDestroyBufferView(vksProcAddr* addrs, VkDevice device, VkBufferView bufferView, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(74);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &bufferView, sizeof(bufferView));
+	((PFN_vkDestroyBufferView)addrs->pvkDestroyBufferView)(device, bufferView, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroyBufferView(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkBufferView bufferView;
+	replay_raw(rd, &bufferView, sizeof(bufferView));
+	bufferView = (VkBufferView)replay_map(r, (uint64_t)(uintptr_t)bufferView);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroyBufferView == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroyBufferView)r->procs.pvkDestroyBufferView)(device, bufferView, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdBindPipeline(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) {
+	vksCaptureStream* s = capture_begin(75);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &pipelineBindPoint, sizeof(pipelineBindPoint));
+	capture_raw(s, &pipeline, sizeof(pipeline));
+	((PFN_vkCmdBindPipeline)addrs->pvkCmdBindPipeline)(commandBuffer, pipelineBindPoint, pipeline);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdBindPipeline(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkPipelineBindPoint pipelineBindPoint;
+	replay_raw(rd, &pipelineBindPoint, sizeof(pipelineBindPoint));
+	VkPipeline pipeline;
+	replay_raw(rd, &pipeline, sizeof(pipeline));
+	pipeline = (VkPipeline)replay_map(r, (uint64_t)(uintptr_t)pipeline);
+	if (rd->overflow || r->procs.pvkCmdBindPipeline == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdBindPipeline)r->procs.pvkCmdBindPipeline)(commandBuffer, pipelineBindPoint, pipeline);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdSetViewport(vksProcAddr* addrs, VkCommandBuffer commandBuffer, uint32_t firstViewport, uint32_t viewportCount, VkViewport* pViewports) {
+	vksCaptureStream* s = capture_begin(76);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &firstViewport, sizeof(firstViewport));
+	capture_raw(s, &viewportCount, sizeof(viewportCount));
+	capture_pointer(s, pViewports, (size_t)(viewportCount), sizeof(VkViewport));
+	((PFN_vkCmdSetViewport)addrs->pvkCmdSetViewport)(commandBuffer, firstViewport, viewportCount, pViewports);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetViewport(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	uint32_t firstViewport;
+	replay_raw(rd, &firstViewport, sizeof(firstViewport));
+	uint32_t viewportCount;
+	replay_raw(rd, &viewportCount, sizeof(viewportCount));
+	VkViewport* pViewports = NULL;
+	pViewports = replay_pointer(r, rd, sizeof(VkViewport), NULL);
+	if (rd->overflow || r->procs.pvkCmdSetViewport == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetViewport)r->procs.pvkCmdSetViewport)(commandBuffer, firstViewport, viewportCount, pViewports);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdSetScissor(vksProcAddr* addrs, VkCommandBuffer commandBuffer, uint32_t firstScissor, uint32_t scissorCount, VkRect2D* pScissors) {
+	vksCaptureStream* s = capture_begin(77);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &firstScissor, sizeof(firstScissor));
+	capture_raw(s, &scissorCount, sizeof(scissorCount));
+	capture_pointer(s, pScissors, (size_t)(scissorCount), sizeof(VkRect2D));
+	((PFN_vkCmdSetScissor)addrs->pvkCmdSetScissor)(commandBuffer, firstScissor, scissorCount, pScissors);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetScissor(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	uint32_t firstScissor;
+	replay_raw(rd, &firstScissor, sizeof(firstScissor));
+	uint32_t scissorCount;
+	replay_raw(rd, &scissorCount, sizeof(scissorCount));
+	VkRect2D* pScissors = NULL;
+	pScissors = replay_pointer(r, rd, sizeof(VkRect2D), NULL);
+	if (rd->overflow || r->procs.pvkCmdSetScissor == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetScissor)r->procs.pvkCmdSetScissor)(commandBuffer, firstScissor, scissorCount, pScissors);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdSetLineWidth(vksProcAddr* addrs, VkCommandBuffer commandBuffer, float lineWidth) {
+	vksCaptureStream* s = capture_begin(78);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &lineWidth, sizeof(lineWidth));
+	((PFN_vkCmdSetLineWidth)addrs->pvkCmdSetLineWidth)(commandBuffer, lineWidth);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetLineWidth(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	float lineWidth;
+	replay_raw(rd, &lineWidth, sizeof(lineWidth));
+	if (rd->overflow || r->procs.pvkCmdSetLineWidth == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetLineWidth)r->procs.pvkCmdSetLineWidth)(commandBuffer, lineWidth);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdSetDepthBias(vksProcAddr* addrs, VkCommandBuffer commandBuffer, float depthBiasConstantFactor, float depthBiasClamp, float depthBiasSlopeFactor) {
+	vksCaptureStream* s = capture_begin(79);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &depthBiasConstantFactor, sizeof(depthBiasConstantFactor));
+	capture_raw(s, &depthBiasClamp, sizeof(depthBiasClamp));
+	capture_raw(s, &depthBiasSlopeFactor, sizeof(depthBiasSlopeFactor));
+	((PFN_vkCmdSetDepthBias)addrs->pvkCmdSetDepthBias)(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetDepthBias(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	float depthBiasConstantFactor;
+	replay_raw(rd, &depthBiasConstantFactor, sizeof(depthBiasConstantFactor));
+	float depthBiasClamp;
+	replay_raw(rd, &depthBiasClamp, sizeof(depthBiasClamp));
+	float depthBiasSlopeFactor;
+	replay_raw(rd, &depthBiasSlopeFactor, sizeof(depthBiasSlopeFactor));
+	if (rd->overflow || r->procs.pvkCmdSetDepthBias == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetDepthBias)r->procs.pvkCmdSetDepthBias)(commandBuffer, depthBiasConstantFactor, depthBiasClamp, depthBiasSlopeFactor);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdSetBlendConstants(vksProcAddr* addrs, VkCommandBuffer commandBuffer, float blendConstants[4]) {
+	vksCaptureStream* s = capture_begin(80);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_pointer(s, blendConstants, (size_t)(4), sizeof(float));
+	((PFN_vkCmdSetBlendConstants)addrs->pvkCmdSetBlendConstants)(commandBuffer, blendConstants);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetBlendConstants(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	float* blendConstants = NULL;
+	blendConstants = replay_pointer(r, rd, sizeof(float), NULL);
+	if (rd->overflow || r->procs.pvkCmdSetBlendConstants == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetBlendConstants)r->procs.pvkCmdSetBlendConstants)(commandBuffer, blendConstants);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdSetDepthBounds(vksProcAddr* addrs, VkCommandBuffer commandBuffer, float minDepthBounds, float maxDepthBounds) {
+	vksCaptureStream* s = capture_begin(81);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &minDepthBounds, sizeof(minDepthBounds));
+	capture_raw(s, &maxDepthBounds, sizeof(maxDepthBounds));
+	((PFN_vkCmdSetDepthBounds)addrs->pvkCmdSetDepthBounds)(commandBuffer, minDepthBounds, maxDepthBounds);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetDepthBounds(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	float minDepthBounds;
+	replay_raw(rd, &minDepthBounds, sizeof(minDepthBounds));
+	float maxDepthBounds;
+	replay_raw(rd, &maxDepthBounds, sizeof(maxDepthBounds));
+	if (rd->overflow || r->procs.pvkCmdSetDepthBounds == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetDepthBounds)r->procs.pvkCmdSetDepthBounds)(commandBuffer, minDepthBounds, maxDepthBounds);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdSetStencilCompareMask(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t compareMask) {
+	vksCaptureStream* s = capture_begin(82);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &faceMask, sizeof(faceMask));
+	capture_raw(s, &compareMask, sizeof(compareMask));
+	((PFN_vkCmdSetStencilCompareMask)addrs->pvkCmdSetStencilCompareMask)(commandBuffer, faceMask, compareMask);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetStencilCompareMask(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkStencilFaceFlags faceMask;
+	replay_raw(rd, &faceMask, sizeof(faceMask));
+	uint32_t compareMask;
+	replay_raw(rd, &compareMask, sizeof(compareMask));
+	if (rd->overflow || r->procs.pvkCmdSetStencilCompareMask == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetStencilCompareMask)r->procs.pvkCmdSetStencilCompareMask)(commandBuffer, faceMask, compareMask);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdSetStencilWriteMask(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t writeMask) {
+	vksCaptureStream* s = capture_begin(83);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &faceMask, sizeof(faceMask));
+	capture_raw(s, &writeMask, sizeof(writeMask));
+	((PFN_vkCmdSetStencilWriteMask)addrs->pvkCmdSetStencilWriteMask)(commandBuffer, faceMask, writeMask);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetStencilWriteMask(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkStencilFaceFlags faceMask;
+	replay_raw(rd, &faceMask, sizeof(faceMask));
+	uint32_t writeMask;
+	replay_raw(rd, &writeMask, sizeof(writeMask));
+	if (rd->overflow || r->procs.pvkCmdSetStencilWriteMask == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetStencilWriteMask)r->procs.pvkCmdSetStencilWriteMask)(commandBuffer, faceMask, writeMask);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdSetStencilReference(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, uint32_t reference) {
+	vksCaptureStream* s = capture_begin(84);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &faceMask, sizeof(faceMask));
+	capture_raw(s, &reference, sizeof(reference));
+	((PFN_vkCmdSetStencilReference)addrs->pvkCmdSetStencilReference)(commandBuffer, faceMask, reference);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetStencilReference(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkStencilFaceFlags faceMask;
+	replay_raw(rd, &faceMask, sizeof(faceMask));
+	uint32_t reference;
+	replay_raw(rd, &reference, sizeof(reference));
+	if (rd->overflow || r->procs.pvkCmdSetStencilReference == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetStencilReference)r->procs.pvkCmdSetStencilReference)(commandBuffer, faceMask, reference);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdBindDescriptorSets(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkPipelineBindPoint pipelineBindPoint, VkPipelineLayout layout, uint32_t firstSet, uint32_t descriptorSetCount, VkDescriptorSet* pDescriptorSets, uint32_t dynamicOffsetCount, uint32_t* pDynamicOffsets) {
+	vksCaptureStream* s = capture_begin(85);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &pipelineBindPoint, sizeof(pipelineBindPoint));
+	capture_raw(s, &layout, sizeof(layout));
+	capture_raw(s, &firstSet, sizeof(firstSet));
+	capture_raw(s, &descriptorSetCount, sizeof(descriptorSetCount));
+	capture_pointer(s, pDescriptorSets, (size_t)(descriptorSetCount), sizeof(VkDescriptorSet));
+	capture_raw(s, &dynamicOffsetCount, sizeof(dynamicOffsetCount));
+	capture_pointer(s, pDynamicOffsets, (size_t)(dynamicOffsetCount), sizeof(uint32_t));
+	((PFN_vkCmdBindDescriptorSets)addrs->pvkCmdBindDescriptorSets)(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdBindDescriptorSets(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkPipelineBindPoint pipelineBindPoint;
+	replay_raw(rd, &pipelineBindPoint, sizeof(pipelineBindPoint));
+	VkPipelineLayout layout;
+	replay_raw(rd, &layout, sizeof(layout));
+	layout = (VkPipelineLayout)replay_map(r, (uint64_t)(uintptr_t)layout);
+	uint32_t firstSet;
+	replay_raw(rd, &firstSet, sizeof(firstSet));
+	uint32_t descriptorSetCount;
+	replay_raw(rd, &descriptorSetCount, sizeof(descriptorSetCount));
+	VkDescriptorSet* pDescriptorSets = NULL;
+	{
+		size_t n;
+		VkDescriptorSet* v = replay_pointer(r, rd, sizeof(VkDescriptorSet), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkDescriptorSet)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		pDescriptorSets = v;
+	}
+	uint32_t dynamicOffsetCount;
+	replay_raw(rd, &dynamicOffsetCount, sizeof(dynamicOffsetCount));
+	uint32_t* pDynamicOffsets = NULL;
+	pDynamicOffsets = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	if (rd->overflow || r->procs.pvkCmdBindDescriptorSets == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdBindDescriptorSets)r->procs.pvkCmdBindDescriptorSets)(commandBuffer, pipelineBindPoint, layout, firstSet, descriptorSetCount, pDescriptorSets, dynamicOffsetCount, pDynamicOffsets);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdBindIndexBuffer(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkIndexType indexType) {
+	vksCaptureStream* s = capture_begin(86);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &buffer, sizeof(buffer));
+	capture_raw(s, &offset, sizeof(offset));
+	capture_raw(s, &indexType, sizeof(indexType));
+	((PFN_vkCmdBindIndexBuffer)addrs->pvkCmdBindIndexBuffer)(commandBuffer, buffer, offset, indexType);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdBindIndexBuffer(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkBuffer buffer;
+	replay_raw(rd, &buffer, sizeof(buffer));
+	buffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)buffer);
+	VkDeviceSize offset;
+	replay_raw(rd, &offset, sizeof(offset));
+	VkIndexType indexType;
+	replay_raw(rd, &indexType, sizeof(indexType));
+	if (rd->overflow || r->procs.pvkCmdBindIndexBuffer == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdBindIndexBuffer)r->procs.pvkCmdBindIndexBuffer)(commandBuffer, buffer, offset, indexType);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdBindVertexBuffers(vksProcAddr* addrs, VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, VkBuffer* pBuffers, VkDeviceSize* pOffsets) {
+	vksCaptureStream* s = capture_begin(87);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &firstBinding, sizeof(firstBinding));
+	capture_raw(s, &bindingCount, sizeof(bindingCount));
+	capture_pointer(s, pBuffers, (size_t)(bindingCount), sizeof(VkBuffer));
+	capture_pointer(s, pOffsets, (size_t)(bindingCount), sizeof(VkDeviceSize));
+	((PFN_vkCmdBindVertexBuffers)addrs->pvkCmdBindVertexBuffers)(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdBindVertexBuffers(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	uint32_t firstBinding;
+	replay_raw(rd, &firstBinding, sizeof(firstBinding));
+	uint32_t bindingCount;
+	replay_raw(rd, &bindingCount, sizeof(bindingCount));
+	VkBuffer* pBuffers = NULL;
+	{
+		size_t n;
+		VkBuffer* v = replay_pointer(r, rd, sizeof(VkBuffer), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		pBuffers = v;
+	}
+	VkDeviceSize* pOffsets = NULL;
+	pOffsets = replay_pointer(r, rd, sizeof(VkDeviceSize), NULL);
+	if (rd->overflow || r->procs.pvkCmdBindVertexBuffers == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdBindVertexBuffers)r->procs.pvkCmdBindVertexBuffers)(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdDraw(vksProcAddr* addrs, VkCommandBuffer commandBuffer, uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) {
+	vksCaptureStream* s = capture_begin(88);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &vertexCount, sizeof(vertexCount));
+	capture_raw(s, &instanceCount, sizeof(instanceCount));
+	capture_raw(s, &firstVertex, sizeof(firstVertex));
+	capture_raw(s, &firstInstance, sizeof(firstInstance));
+	((PFN_vkCmdDraw)addrs->pvkCmdDraw)(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdDraw(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	uint32_t vertexCount;
+	replay_raw(rd, &vertexCount, sizeof(vertexCount));
+	uint32_t instanceCount;
+	replay_raw(rd, &instanceCount, sizeof(instanceCount));
+	uint32_t firstVertex;
+	replay_raw(rd, &firstVertex, sizeof(firstVertex));
+	uint32_t firstInstance;
+	replay_raw(rd, &firstInstance, sizeof(firstInstance));
+	if (rd->overflow || r->procs.pvkCmdDraw == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdDraw)r->procs.pvkCmdDraw)(commandBuffer, vertexCount, instanceCount, firstVertex, firstInstance);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdDrawIndexed(vksProcAddr* addrs, VkCommandBuffer commandBuffer, uint32_t indexCount, uint32_t instanceCount, uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) {
+	vksCaptureStream* s = capture_begin(89);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &indexCount, sizeof(indexCount));
+	capture_raw(s, &instanceCount, sizeof(instanceCount));
+	capture_raw(s, &firstIndex, sizeof(firstIndex));
+	capture_raw(s, &vertexOffset, sizeof(vertexOffset));
+	capture_raw(s, &firstInstance, sizeof(firstInstance));
+	((PFN_vkCmdDrawIndexed)addrs->pvkCmdDrawIndexed)(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdDrawIndexed(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	uint32_t indexCount;
+	replay_raw(rd, &indexCount, sizeof(indexCount));
+	uint32_t instanceCount;
+	replay_raw(rd, &instanceCount, sizeof(instanceCount));
+	uint32_t firstIndex;
+	replay_raw(rd, &firstIndex, sizeof(firstIndex));
+	int32_t vertexOffset;
+	replay_raw(rd, &vertexOffset, sizeof(vertexOffset));
+	uint32_t firstInstance;
+	replay_raw(rd, &firstInstance, sizeof(firstInstance));
+	if (rd->overflow || r->procs.pvkCmdDrawIndexed == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdDrawIndexed)r->procs.pvkCmdDrawIndexed)(commandBuffer, indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdDrawIndirect(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
+	vksCaptureStream* s = capture_begin(90);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &buffer, sizeof(buffer));
+	capture_raw(s, &offset, sizeof(offset));
+	capture_raw(s, &drawCount, sizeof(drawCount));
+	capture_raw(s, &stride, sizeof(stride));
+	((PFN_vkCmdDrawIndirect)addrs->pvkCmdDrawIndirect)(commandBuffer, buffer, offset, drawCount, stride);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdDrawIndirect(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkBuffer buffer;
+	replay_raw(rd, &buffer, sizeof(buffer));
+	buffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)buffer);
+	VkDeviceSize offset;
+	replay_raw(rd, &offset, sizeof(offset));
+	uint32_t drawCount;
+	replay_raw(rd, &drawCount, sizeof(drawCount));
+	uint32_t stride;
+	replay_raw(rd, &stride, sizeof(stride));
+	if (rd->overflow || r->procs.pvkCmdDrawIndirect == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdDrawIndirect)r->procs.pvkCmdDrawIndirect)(commandBuffer, buffer, offset, drawCount, stride);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdDrawIndexedIndirect(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, uint32_t drawCount, uint32_t stride) {
+	vksCaptureStream* s = capture_begin(91);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &buffer, sizeof(buffer));
+	capture_raw(s, &offset, sizeof(offset));
+	capture_raw(s, &drawCount, sizeof(drawCount));
+	capture_raw(s, &stride, sizeof(stride));
+	((PFN_vkCmdDrawIndexedIndirect)addrs->pvkCmdDrawIndexedIndirect)(commandBuffer, buffer, offset, drawCount, stride);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdDrawIndexedIndirect(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkBuffer buffer;
+	replay_raw(rd, &buffer, sizeof(buffer));
+	buffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)buffer);
+	VkDeviceSize offset;
+	replay_raw(rd, &offset, sizeof(offset));
+	uint32_t drawCount;
+	replay_raw(rd, &drawCount, sizeof(drawCount));
+	uint32_t stride;
+	replay_raw(rd, &stride, sizeof(stride));
+	if (rd->overflow || r->procs.pvkCmdDrawIndexedIndirect == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdDrawIndexedIndirect)r->procs.pvkCmdDrawIndexedIndirect)(commandBuffer, buffer, offset, drawCount, stride);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdDispatch(vksProcAddr* addrs, VkCommandBuffer commandBuffer, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
+	vksCaptureStream* s = capture_begin(92);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &groupCountX, sizeof(groupCountX));
+	capture_raw(s, &groupCountY, sizeof(groupCountY));
+	capture_raw(s, &groupCountZ, sizeof(groupCountZ));
+	((PFN_vkCmdDispatch)addrs->pvkCmdDispatch)(commandBuffer, groupCountX, groupCountY, groupCountZ);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdDispatch(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	uint32_t groupCountX;
+	replay_raw(rd, &groupCountX, sizeof(groupCountX));
+	uint32_t groupCountY;
+	replay_raw(rd, &groupCountY, sizeof(groupCountY));
+	uint32_t groupCountZ;
+	replay_raw(rd, &groupCountZ, sizeof(groupCountZ));
+	if (rd->overflow || r->procs.pvkCmdDispatch == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdDispatch)r->procs.pvkCmdDispatch)(commandBuffer, groupCountX, groupCountY, groupCountZ);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdDispatchIndirect(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset) {
+	vksCaptureStream* s = capture_begin(93);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &buffer, sizeof(buffer));
+	capture_raw(s, &offset, sizeof(offset));
+	((PFN_vkCmdDispatchIndirect)addrs->pvkCmdDispatchIndirect)(commandBuffer, buffer, offset);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdDispatchIndirect(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkBuffer buffer;
+	replay_raw(rd, &buffer, sizeof(buffer));
+	buffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)buffer);
+	VkDeviceSize offset;
+	replay_raw(rd, &offset, sizeof(offset));
+	if (rd->overflow || r->procs.pvkCmdDispatchIndirect == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdDispatchIndirect)r->procs.pvkCmdDispatchIndirect)(commandBuffer, buffer, offset);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdCopyBuffer(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkBuffer dstBuffer, uint32_t regionCount, VkBufferCopy* pRegions) {
+	vksCaptureStream* s = capture_begin(94);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &srcBuffer, sizeof(srcBuffer));
+	capture_raw(s, &dstBuffer, sizeof(dstBuffer));
+	capture_raw(s, &regionCount, sizeof(regionCount));
+	capture_pointer(s, pRegions, (size_t)(regionCount), sizeof(VkBufferCopy));
+	((PFN_vkCmdCopyBuffer)addrs->pvkCmdCopyBuffer)(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdCopyBuffer(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkBuffer srcBuffer;
+	replay_raw(rd, &srcBuffer, sizeof(srcBuffer));
+	srcBuffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)srcBuffer);
+	VkBuffer dstBuffer;
+	replay_raw(rd, &dstBuffer, sizeof(dstBuffer));
+	dstBuffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)dstBuffer);
+	uint32_t regionCount;
+	replay_raw(rd, &regionCount, sizeof(regionCount));
+	VkBufferCopy* pRegions = NULL;
+	pRegions = replay_pointer(r, rd, sizeof(VkBufferCopy), NULL);
+	if (rd->overflow || r->procs.pvkCmdCopyBuffer == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdCopyBuffer)r->procs.pvkCmdCopyBuffer)(commandBuffer, srcBuffer, dstBuffer, regionCount, pRegions);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdCopyImage(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, VkImageCopy* pRegions) {
+	vksCaptureStream* s = capture_begin(95);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &srcImage, sizeof(srcImage));
+	capture_raw(s, &srcImageLayout, sizeof(srcImageLayout));
+	capture_raw(s, &dstImage, sizeof(dstImage));
+	capture_raw(s, &dstImageLayout, sizeof(dstImageLayout));
+	capture_raw(s, &regionCount, sizeof(regionCount));
+	capture_pointer(s, pRegions, (size_t)(regionCount), sizeof(VkImageCopy));
+	((PFN_vkCmdCopyImage)addrs->pvkCmdCopyImage)(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdCopyImage(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkImage srcImage;
+	replay_raw(rd, &srcImage, sizeof(srcImage));
+	srcImage = (VkImage)replay_map(r, (uint64_t)(uintptr_t)srcImage);
+	VkImageLayout srcImageLayout;
+	replay_raw(rd, &srcImageLayout, sizeof(srcImageLayout));
+	VkImage dstImage;
+	replay_raw(rd, &dstImage, sizeof(dstImage));
+	dstImage = (VkImage)replay_map(r, (uint64_t)(uintptr_t)dstImage);
+	VkImageLayout dstImageLayout;
+	replay_raw(rd, &dstImageLayout, sizeof(dstImageLayout));
+	uint32_t regionCount;
+	replay_raw(rd, &regionCount, sizeof(regionCount));
+	VkImageCopy* pRegions = NULL;
+	pRegions = replay_pointer(r, rd, sizeof(VkImageCopy), NULL);
+	if (rd->overflow || r->procs.pvkCmdCopyImage == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdCopyImage)r->procs.pvkCmdCopyImage)(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdBlitImage(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, VkImageBlit* pRegions, VkFilter filter) {
+	vksCaptureStream* s = capture_begin(96);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &srcImage, sizeof(srcImage));
+	capture_raw(s, &srcImageLayout, sizeof(srcImageLayout));
+	capture_raw(s, &dstImage, sizeof(dstImage));
+	capture_raw(s, &dstImageLayout, sizeof(dstImageLayout));
+	capture_raw(s, &regionCount, sizeof(regionCount));
+	capture_pointer(s, pRegions, (size_t)(regionCount), sizeof(VkImageBlit));
+	capture_raw(s, &filter, sizeof(filter));
+	((PFN_vkCmdBlitImage)addrs->pvkCmdBlitImage)(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdBlitImage(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkImage srcImage;
+	replay_raw(rd, &srcImage, sizeof(srcImage));
+	srcImage = (VkImage)replay_map(r, (uint64_t)(uintptr_t)srcImage);
+	VkImageLayout srcImageLayout;
+	replay_raw(rd, &srcImageLayout, sizeof(srcImageLayout));
+	VkImage dstImage;
+	replay_raw(rd, &dstImage, sizeof(dstImage));
+	dstImage = (VkImage)replay_map(r, (uint64_t)(uintptr_t)dstImage);
+	VkImageLayout dstImageLayout;
+	replay_raw(rd, &dstImageLayout, sizeof(dstImageLayout));
+	uint32_t regionCount;
+	replay_raw(rd, &regionCount, sizeof(regionCount));
+	VkImageBlit* pRegions = NULL;
+	pRegions = replay_pointer(r, rd, sizeof(VkImageBlit), NULL);
+	VkFilter filter;
+	replay_raw(rd, &filter, sizeof(filter));
+	if (rd->overflow || r->procs.pvkCmdBlitImage == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdBlitImage)r->procs.pvkCmdBlitImage)(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions, filter);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdCopyBufferToImage(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBuffer srcBuffer, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, VkBufferImageCopy* pRegions) {
+	vksCaptureStream* s = capture_begin(97);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &srcBuffer, sizeof(srcBuffer));
+	capture_raw(s, &dstImage, sizeof(dstImage));
+	capture_raw(s, &dstImageLayout, sizeof(dstImageLayout));
+	capture_raw(s, &regionCount, sizeof(regionCount));
+	capture_pointer(s, pRegions, (size_t)(regionCount), sizeof(VkBufferImageCopy));
+	((PFN_vkCmdCopyBufferToImage)addrs->pvkCmdCopyBufferToImage)(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdCopyBufferToImage(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkBuffer srcBuffer;
+	replay_raw(rd, &srcBuffer, sizeof(srcBuffer));
+	srcBuffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)srcBuffer);
+	VkImage dstImage;
+	replay_raw(rd, &dstImage, sizeof(dstImage));
+	dstImage = (VkImage)replay_map(r, (uint64_t)(uintptr_t)dstImage);
+	VkImageLayout dstImageLayout;
+	replay_raw(rd, &dstImageLayout, sizeof(dstImageLayout));
+	uint32_t regionCount;
+	replay_raw(rd, &regionCount, sizeof(regionCount));
+	VkBufferImageCopy* pRegions = NULL;
+	pRegions = replay_pointer(r, rd, sizeof(VkBufferImageCopy), NULL);
+	if (rd->overflow || r->procs.pvkCmdCopyBufferToImage == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdCopyBufferToImage)r->procs.pvkCmdCopyBufferToImage)(commandBuffer, srcBuffer, dstImage, dstImageLayout, regionCount, pRegions);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdCopyImageToBuffer(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkBuffer dstBuffer, uint32_t regionCount, VkBufferImageCopy* pRegions) {
+	vksCaptureStream* s = capture_begin(98);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &srcImage, sizeof(srcImage));
+	capture_raw(s, &srcImageLayout, sizeof(srcImageLayout));
+	capture_raw(s, &dstBuffer, sizeof(dstBuffer));
+	capture_raw(s, &regionCount, sizeof(regionCount));
+	capture_pointer(s, pRegions, (size_t)(regionCount), sizeof(VkBufferImageCopy));
+	((PFN_vkCmdCopyImageToBuffer)addrs->pvkCmdCopyImageToBuffer)(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdCopyImageToBuffer(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkImage srcImage;
+	replay_raw(rd, &srcImage, sizeof(srcImage));
+	srcImage = (VkImage)replay_map(r, (uint64_t)(uintptr_t)srcImage);
+	VkImageLayout srcImageLayout;
+	replay_raw(rd, &srcImageLayout, sizeof(srcImageLayout));
+	VkBuffer dstBuffer;
+	replay_raw(rd, &dstBuffer, sizeof(dstBuffer));
+	dstBuffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)dstBuffer);
+	uint32_t regionCount;
+	replay_raw(rd, &regionCount, sizeof(regionCount));
+	VkBufferImageCopy* pRegions = NULL;
+	pRegions = replay_pointer(r, rd, sizeof(VkBufferImageCopy), NULL);
+	if (rd->overflow || r->procs.pvkCmdCopyImageToBuffer == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdCopyImageToBuffer)r->procs.pvkCmdCopyImageToBuffer)(commandBuffer, srcImage, srcImageLayout, dstBuffer, regionCount, pRegions);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdUpdateBuffer(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize dataSize, void* pData) {
+	vksCaptureStream* s = capture_begin(99);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &dstBuffer, sizeof(dstBuffer));
+	capture_raw(s, &dstOffset, sizeof(dstOffset));
+	capture_raw(s, &dataSize, sizeof(dataSize));
+	capture_pointer(s, pData, (size_t)(dataSize), sizeof(uint8_t));
+	((PFN_vkCmdUpdateBuffer)addrs->pvkCmdUpdateBuffer)(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdUpdateBuffer(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkBuffer dstBuffer;
+	replay_raw(rd, &dstBuffer, sizeof(dstBuffer));
+	dstBuffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)dstBuffer);
+	VkDeviceSize dstOffset;
+	replay_raw(rd, &dstOffset, sizeof(dstOffset));
+	VkDeviceSize dataSize;
+	replay_raw(rd, &dataSize, sizeof(dataSize));
+	void* pData = NULL;
+	pData = replay_pointer(r, rd, sizeof(uint8_t), NULL);
+	if (rd->overflow || r->procs.pvkCmdUpdateBuffer == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdUpdateBuffer)r->procs.pvkCmdUpdateBuffer)(commandBuffer, dstBuffer, dstOffset, dataSize, pData);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdFillBuffer(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize size, uint32_t data) {
+	vksCaptureStream* s = capture_begin(100);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &dstBuffer, sizeof(dstBuffer));
+	capture_raw(s, &dstOffset, sizeof(dstOffset));
+	capture_raw(s, &size, sizeof(size));
+	capture_raw(s, &data, sizeof(data));
+	((PFN_vkCmdFillBuffer)addrs->pvkCmdFillBuffer)(commandBuffer, dstBuffer, dstOffset, size, data);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdFillBuffer(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkBuffer dstBuffer;
+	replay_raw(rd, &dstBuffer, sizeof(dstBuffer));
+	dstBuffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)dstBuffer);
+	VkDeviceSize dstOffset;
+	replay_raw(rd, &dstOffset, sizeof(dstOffset));
+	VkDeviceSize size;
+	replay_raw(rd, &size, sizeof(size));
+	uint32_t data;
+	replay_raw(rd, &data, sizeof(data));
+	if (rd->overflow || r->procs.pvkCmdFillBuffer == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdFillBuffer)r->procs.pvkCmdFillBuffer)(commandBuffer, dstBuffer, dstOffset, size, data);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdClearColorImage(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, VkClearColorValue* pColor, uint32_t rangeCount, VkImageSubresourceRange* pRanges) {
+	vksCaptureStream* s = capture_begin(101);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &image, sizeof(image));
+	capture_raw(s, &imageLayout, sizeof(imageLayout));
+	capture_pointer(s, pColor, (size_t)(1), sizeof(VkClearColorValue));
+	capture_raw(s, &rangeCount, sizeof(rangeCount));
+	capture_pointer(s, pRanges, (size_t)(rangeCount), sizeof(VkImageSubresourceRange));
+	((PFN_vkCmdClearColorImage)addrs->pvkCmdClearColorImage)(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdClearColorImage(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkImage image;
+	replay_raw(rd, &image, sizeof(image));
+	image = (VkImage)replay_map(r, (uint64_t)(uintptr_t)image);
+	VkImageLayout imageLayout;
+	replay_raw(rd, &imageLayout, sizeof(imageLayout));
+	VkClearColorValue* pColor = NULL;
+	pColor = replay_pointer(r, rd, sizeof(VkClearColorValue), NULL);
+	uint32_t rangeCount;
+	replay_raw(rd, &rangeCount, sizeof(rangeCount));
+	VkImageSubresourceRange* pRanges = NULL;
+	pRanges = replay_pointer(r, rd, sizeof(VkImageSubresourceRange), NULL);
+	if (rd->overflow || r->procs.pvkCmdClearColorImage == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdClearColorImage)r->procs.pvkCmdClearColorImage)(commandBuffer, image, imageLayout, pColor, rangeCount, pRanges);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdClearDepthStencilImage(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkImage image, VkImageLayout imageLayout, VkClearDepthStencilValue* pDepthStencil, uint32_t rangeCount, VkImageSubresourceRange* pRanges) {
+	vksCaptureStream* s = capture_begin(102);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &image, sizeof(image));
+	capture_raw(s, &imageLayout, sizeof(imageLayout));
+	capture_pointer(s, pDepthStencil, (size_t)(1), sizeof(VkClearDepthStencilValue));
+	capture_raw(s, &rangeCount, sizeof(rangeCount));
+	capture_pointer(s, pRanges, (size_t)(rangeCount), sizeof(VkImageSubresourceRange));
+	((PFN_vkCmdClearDepthStencilImage)addrs->pvkCmdClearDepthStencilImage)(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdClearDepthStencilImage(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkImage image;
+	replay_raw(rd, &image, sizeof(image));
+	image = (VkImage)replay_map(r, (uint64_t)(uintptr_t)image);
+	VkImageLayout imageLayout;
+	replay_raw(rd, &imageLayout, sizeof(imageLayout));
+	VkClearDepthStencilValue* pDepthStencil = NULL;
+	pDepthStencil = replay_pointer(r, rd, sizeof(VkClearDepthStencilValue), NULL);
+	uint32_t rangeCount;
+	replay_raw(rd, &rangeCount, sizeof(rangeCount));
+	VkImageSubresourceRange* pRanges = NULL;
+	pRanges = replay_pointer(r, rd, sizeof(VkImageSubresourceRange), NULL);
+	if (rd->overflow || r->procs.pvkCmdClearDepthStencilImage == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdClearDepthStencilImage)r->procs.pvkCmdClearDepthStencilImage)(commandBuffer, image, imageLayout, pDepthStencil, rangeCount, pRanges);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdClearAttachments(vksProcAddr* addrs, VkCommandBuffer commandBuffer, uint32_t attachmentCount, VkClearAttachment* pAttachments, uint32_t rectCount, VkClearRect* pRects) {
+	vksCaptureStream* s = capture_begin(103);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &attachmentCount, sizeof(attachmentCount));
+	capture_pointer(s, pAttachments, (size_t)(attachmentCount), sizeof(VkClearAttachment));
+	capture_raw(s, &rectCount, sizeof(rectCount));
+	capture_pointer(s, pRects, (size_t)(rectCount), sizeof(VkClearRect));
+	((PFN_vkCmdClearAttachments)addrs->pvkCmdClearAttachments)(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdClearAttachments(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	uint32_t attachmentCount;
+	replay_raw(rd, &attachmentCount, sizeof(attachmentCount));
+	VkClearAttachment* pAttachments = NULL;
+	pAttachments = replay_pointer(r, rd, sizeof(VkClearAttachment), NULL);
+	uint32_t rectCount;
+	replay_raw(rd, &rectCount, sizeof(rectCount));
+	VkClearRect* pRects = NULL;
+	pRects = replay_pointer(r, rd, sizeof(VkClearRect), NULL);
+	if (rd->overflow || r->procs.pvkCmdClearAttachments == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdClearAttachments)r->procs.pvkCmdClearAttachments)(commandBuffer, attachmentCount, pAttachments, rectCount, pRects);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdResolveImage(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkImage srcImage, VkImageLayout srcImageLayout, VkImage dstImage, VkImageLayout dstImageLayout, uint32_t regionCount, VkImageResolve* pRegions) {
+	vksCaptureStream* s = capture_begin(104);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &srcImage, sizeof(srcImage));
+	capture_raw(s, &srcImageLayout, sizeof(srcImageLayout));
+	capture_raw(s, &dstImage, sizeof(dstImage));
+	capture_raw(s, &dstImageLayout, sizeof(dstImageLayout));
+	capture_raw(s, &regionCount, sizeof(regionCount));
+	capture_pointer(s, pRegions, (size_t)(regionCount), sizeof(VkImageResolve));
+	((PFN_vkCmdResolveImage)addrs->pvkCmdResolveImage)(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdResolveImage(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkImage srcImage;
+	replay_raw(rd, &srcImage, sizeof(srcImage));
+	srcImage = (VkImage)replay_map(r, (uint64_t)(uintptr_t)srcImage);
+	VkImageLayout srcImageLayout;
+	replay_raw(rd, &srcImageLayout, sizeof(srcImageLayout));
+	VkImage dstImage;
+	replay_raw(rd, &dstImage, sizeof(dstImage));
+	dstImage = (VkImage)replay_map(r, (uint64_t)(uintptr_t)dstImage);
+	VkImageLayout dstImageLayout;
+	replay_raw(rd, &dstImageLayout, sizeof(dstImageLayout));
+	uint32_t regionCount;
+	replay_raw(rd, &regionCount, sizeof(regionCount));
+	VkImageResolve* pRegions = NULL;
+	pRegions = replay_pointer(r, rd, sizeof(VkImageResolve), NULL);
+	if (rd->overflow || r->procs.pvkCmdResolveImage == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdResolveImage)r->procs.pvkCmdResolveImage)(commandBuffer, srcImage, srcImageLayout, dstImage, dstImageLayout, regionCount, pRegions);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdSetEvent(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
+	vksCaptureStream* s = capture_begin(105);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &event, sizeof(event));
+	capture_raw(s, &stageMask, sizeof(stageMask));
+	((PFN_vkCmdSetEvent)addrs->pvkCmdSetEvent)(commandBuffer, event, stageMask);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetEvent(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkEvent event;
+	replay_raw(rd, &event, sizeof(event));
+	event = (VkEvent)replay_map(r, (uint64_t)(uintptr_t)event);
+	VkPipelineStageFlags stageMask;
+	replay_raw(rd, &stageMask, sizeof(stageMask));
+	if (rd->overflow || r->procs.pvkCmdSetEvent == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetEvent)r->procs.pvkCmdSetEvent)(commandBuffer, event, stageMask);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdResetEvent(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags stageMask) {
+	vksCaptureStream* s = capture_begin(106);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &event, sizeof(event));
+	capture_raw(s, &stageMask, sizeof(stageMask));
+	((PFN_vkCmdResetEvent)addrs->pvkCmdResetEvent)(commandBuffer, event, stageMask);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdResetEvent(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkEvent event;
+	replay_raw(rd, &event, sizeof(event));
+	event = (VkEvent)replay_map(r, (uint64_t)(uintptr_t)event);
+	VkPipelineStageFlags stageMask;
+	replay_raw(rd, &stageMask, sizeof(stageMask));
+	if (rd->overflow || r->procs.pvkCmdResetEvent == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdResetEvent)r->procs.pvkCmdResetEvent)(commandBuffer, event, stageMask);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdWaitEvents(vksProcAddr* addrs, VkCommandBuffer commandBuffer, uint32_t eventCount, VkEvent* pEvents, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, uint32_t memoryBarrierCount, VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, VkImageMemoryBarrier* pImageMemoryBarriers) {
+	vksCaptureStream* s = capture_begin(107);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &eventCount, sizeof(eventCount));
+	capture_pointer(s, pEvents, (size_t)(eventCount), sizeof(VkEvent));
+	capture_raw(s, &srcStageMask, sizeof(srcStageMask));
+	capture_raw(s, &dstStageMask, sizeof(dstStageMask));
+	capture_raw(s, &memoryBarrierCount, sizeof(memoryBarrierCount));
+	if (capture_pointer(s, pMemoryBarriers, (size_t)(memoryBarrierCount), sizeof(VkMemoryBarrier))) {
+		for (size_t i = 0; i < (size_t)(memoryBarrierCount); i++) {
+			capture_VkMemoryBarrier(s, &pMemoryBarriers[i]);
+		}
+	}
+	capture_raw(s, &bufferMemoryBarrierCount, sizeof(bufferMemoryBarrierCount));
+	if (capture_pointer(s, pBufferMemoryBarriers, (size_t)(bufferMemoryBarrierCount), sizeof(VkBufferMemoryBarrier))) {
+		for (size_t i = 0; i < (size_t)(bufferMemoryBarrierCount); i++) {
+			capture_VkBufferMemoryBarrier(s, &pBufferMemoryBarriers[i]);
+		}
+	}
+	capture_raw(s, &imageMemoryBarrierCount, sizeof(imageMemoryBarrierCount));
+	if (capture_pointer(s, pImageMemoryBarriers, (size_t)(imageMemoryBarrierCount), sizeof(VkImageMemoryBarrier))) {
+		for (size_t i = 0; i < (size_t)(imageMemoryBarrierCount); i++) {
+			capture_VkImageMemoryBarrier(s, &pImageMemoryBarriers[i]);
+		}
+	}
+	((PFN_vkCmdWaitEvents)addrs->pvkCmdWaitEvents)(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdWaitEvents(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	uint32_t eventCount;
+	replay_raw(rd, &eventCount, sizeof(eventCount));
+	VkEvent* pEvents = NULL;
+	{
+		size_t n;
+		VkEvent* v = replay_pointer(r, rd, sizeof(VkEvent), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkEvent)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		pEvents = v;
+	}
+	VkPipelineStageFlags srcStageMask;
+	replay_raw(rd, &srcStageMask, sizeof(srcStageMask));
+	VkPipelineStageFlags dstStageMask;
+	replay_raw(rd, &dstStageMask, sizeof(dstStageMask));
+	uint32_t memoryBarrierCount;
+	replay_raw(rd, &memoryBarrierCount, sizeof(memoryBarrierCount));
+	VkMemoryBarrier* pMemoryBarriers = NULL;
+	{
+		size_t n;
+		VkMemoryBarrier* v = replay_pointer(r, rd, sizeof(VkMemoryBarrier), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkMemoryBarrier(r, rd, &v[i]);
+		}
+		pMemoryBarriers = v;
+	}
+	uint32_t bufferMemoryBarrierCount;
+	replay_raw(rd, &bufferMemoryBarrierCount, sizeof(bufferMemoryBarrierCount));
+	VkBufferMemoryBarrier* pBufferMemoryBarriers = NULL;
+	{
+		size_t n;
+		VkBufferMemoryBarrier* v = replay_pointer(r, rd, sizeof(VkBufferMemoryBarrier), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkBufferMemoryBarrier(r, rd, &v[i]);
+		}
+		pBufferMemoryBarriers = v;
+	}
+	uint32_t imageMemoryBarrierCount;
+	replay_raw(rd, &imageMemoryBarrierCount, sizeof(imageMemoryBarrierCount));
+	VkImageMemoryBarrier* pImageMemoryBarriers = NULL;
+	{
+		size_t n;
+		VkImageMemoryBarrier* v = replay_pointer(r, rd, sizeof(VkImageMemoryBarrier), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkImageMemoryBarrier(r, rd, &v[i]);
+		}
+		pImageMemoryBarriers = v;
+	}
+	if (rd->overflow || r->procs.pvkCmdWaitEvents == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdWaitEvents)r->procs.pvkCmdWaitEvents)(commandBuffer, eventCount, pEvents, srcStageMask, dstStageMask, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdPipelineBarrier(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkPipelineStageFlags srcStageMask, VkPipelineStageFlags dstStageMask, VkDependencyFlags dependencyFlags, uint32_t memoryBarrierCount, VkMemoryBarrier* pMemoryBarriers, uint32_t bufferMemoryBarrierCount, VkBufferMemoryBarrier* pBufferMemoryBarriers, uint32_t imageMemoryBarrierCount, VkImageMemoryBarrier* pImageMemoryBarriers) {
+	vksCaptureStream* s = capture_begin(108);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &srcStageMask, sizeof(srcStageMask));
+	capture_raw(s, &dstStageMask, sizeof(dstStageMask));
+	capture_raw(s, &dependencyFlags, sizeof(dependencyFlags));
+	capture_raw(s, &memoryBarrierCount, sizeof(memoryBarrierCount));
+	if (capture_pointer(s, pMemoryBarriers, (size_t)(memoryBarrierCount), sizeof(VkMemoryBarrier))) {
+		for (size_t i = 0; i < (size_t)(memoryBarrierCount); i++) {
+			capture_VkMemoryBarrier(s, &pMemoryBarriers[i]);
+		}
+	}
+	capture_raw(s, &bufferMemoryBarrierCount, sizeof(bufferMemoryBarrierCount));
+	if (capture_pointer(s, pBufferMemoryBarriers, (size_t)(bufferMemoryBarrierCount), sizeof(VkBufferMemoryBarrier))) {
+		for (size_t i = 0; i < (size_t)(bufferMemoryBarrierCount); i++) {
+			capture_VkBufferMemoryBarrier(s, &pBufferMemoryBarriers[i]);
+		}
+	}
+	capture_raw(s, &imageMemoryBarrierCount, sizeof(imageMemoryBarrierCount));
+	if (capture_pointer(s, pImageMemoryBarriers, (size_t)(imageMemoryBarrierCount), sizeof(VkImageMemoryBarrier))) {
+		for (size_t i = 0; i < (size_t)(imageMemoryBarrierCount); i++) {
+			capture_VkImageMemoryBarrier(s, &pImageMemoryBarriers[i]);
+		}
+	}
+	((PFN_vkCmdPipelineBarrier)addrs->pvkCmdPipelineBarrier)(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdPipelineBarrier(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkPipelineStageFlags srcStageMask;
+	replay_raw(rd, &srcStageMask, sizeof(srcStageMask));
+	VkPipelineStageFlags dstStageMask;
+	replay_raw(rd, &dstStageMask, sizeof(dstStageMask));
+	VkDependencyFlags dependencyFlags;
+	replay_raw(rd, &dependencyFlags, sizeof(dependencyFlags));
+	uint32_t memoryBarrierCount;
+	replay_raw(rd, &memoryBarrierCount, sizeof(memoryBarrierCount));
+	VkMemoryBarrier* pMemoryBarriers = NULL;
+	{
+		size_t n;
+		VkMemoryBarrier* v = replay_pointer(r, rd, sizeof(VkMemoryBarrier), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkMemoryBarrier(r, rd, &v[i]);
+		}
+		pMemoryBarriers = v;
+	}
+	uint32_t bufferMemoryBarrierCount;
+	replay_raw(rd, &bufferMemoryBarrierCount, sizeof(bufferMemoryBarrierCount));
+	VkBufferMemoryBarrier* pBufferMemoryBarriers = NULL;
+	{
+		size_t n;
+		VkBufferMemoryBarrier* v = replay_pointer(r, rd, sizeof(VkBufferMemoryBarrier), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkBufferMemoryBarrier(r, rd, &v[i]);
+		}
+		pBufferMemoryBarriers = v;
+	}
+	uint32_t imageMemoryBarrierCount;
+	replay_raw(rd, &imageMemoryBarrierCount, sizeof(imageMemoryBarrierCount));
+	VkImageMemoryBarrier* pImageMemoryBarriers = NULL;
+	{
+		size_t n;
+		VkImageMemoryBarrier* v = replay_pointer(r, rd, sizeof(VkImageMemoryBarrier), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkImageMemoryBarrier(r, rd, &v[i]);
+		}
+		pImageMemoryBarriers = v;
+	}
+	if (rd->overflow || r->procs.pvkCmdPipelineBarrier == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdPipelineBarrier)r->procs.pvkCmdPipelineBarrier)(commandBuffer, srcStageMask, dstStageMask, dependencyFlags, memoryBarrierCount, pMemoryBarriers, bufferMemoryBarrierCount, pBufferMemoryBarriers, imageMemoryBarrierCount, pImageMemoryBarriers);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdBeginQuery(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query, VkQueryControlFlags flags) {
+	vksCaptureStream* s = capture_begin(109);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &queryPool, sizeof(queryPool));
+	capture_raw(s, &query, sizeof(query));
+	capture_raw(s, &flags, sizeof(flags));
+	((PFN_vkCmdBeginQuery)addrs->pvkCmdBeginQuery)(commandBuffer, queryPool, query, flags);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdBeginQuery(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkQueryPool queryPool;
+	replay_raw(rd, &queryPool, sizeof(queryPool));
+	queryPool = (VkQueryPool)replay_map(r, (uint64_t)(uintptr_t)queryPool);
+	uint32_t query;
+	replay_raw(rd, &query, sizeof(query));
+	VkQueryControlFlags flags;
+	replay_raw(rd, &flags, sizeof(flags));
+	if (rd->overflow || r->procs.pvkCmdBeginQuery == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdBeginQuery)r->procs.pvkCmdBeginQuery)(commandBuffer, queryPool, query, flags);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdEndQuery(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t query) {
+	vksCaptureStream* s = capture_begin(110);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &queryPool, sizeof(queryPool));
+	capture_raw(s, &query, sizeof(query));
+	((PFN_vkCmdEndQuery)addrs->pvkCmdEndQuery)(commandBuffer, queryPool, query);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdEndQuery(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkQueryPool queryPool;
+	replay_raw(rd, &queryPool, sizeof(queryPool));
+	queryPool = (VkQueryPool)replay_map(r, (uint64_t)(uintptr_t)queryPool);
+	uint32_t query;
+	replay_raw(rd, &query, sizeof(query));
+	if (rd->overflow || r->procs.pvkCmdEndQuery == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdEndQuery)r->procs.pvkCmdEndQuery)(commandBuffer, queryPool, query);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdResetQueryPool(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
+	vksCaptureStream* s = capture_begin(111);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &queryPool, sizeof(queryPool));
+	capture_raw(s, &firstQuery, sizeof(firstQuery));
+	capture_raw(s, &queryCount, sizeof(queryCount));
+	((PFN_vkCmdResetQueryPool)addrs->pvkCmdResetQueryPool)(commandBuffer, queryPool, firstQuery, queryCount);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdResetQueryPool(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkQueryPool queryPool;
+	replay_raw(rd, &queryPool, sizeof(queryPool));
+	queryPool = (VkQueryPool)replay_map(r, (uint64_t)(uintptr_t)queryPool);
+	uint32_t firstQuery;
+	replay_raw(rd, &firstQuery, sizeof(firstQuery));
+	uint32_t queryCount;
+	replay_raw(rd, &queryCount, sizeof(queryCount));
+	if (rd->overflow || r->procs.pvkCmdResetQueryPool == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdResetQueryPool)r->procs.pvkCmdResetQueryPool)(commandBuffer, queryPool, firstQuery, queryCount);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdWriteTimestamp(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkPipelineStageFlagBits pipelineStage, VkQueryPool queryPool, uint32_t query) {
+	vksCaptureStream* s = capture_begin(112);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &pipelineStage, sizeof(pipelineStage));
+	capture_raw(s, &queryPool, sizeof(queryPool));
+	capture_raw(s, &query, sizeof(query));
+	((PFN_vkCmdWriteTimestamp)addrs->pvkCmdWriteTimestamp)(commandBuffer, pipelineStage, queryPool, query);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdWriteTimestamp(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkPipelineStageFlagBits pipelineStage;
+	replay_raw(rd, &pipelineStage, sizeof(pipelineStage));
+	VkQueryPool queryPool;
+	replay_raw(rd, &queryPool, sizeof(queryPool));
+	queryPool = (VkQueryPool)replay_map(r, (uint64_t)(uintptr_t)queryPool);
+	uint32_t query;
+	replay_raw(rd, &query, sizeof(query));
+	if (rd->overflow || r->procs.pvkCmdWriteTimestamp == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdWriteTimestamp)r->procs.pvkCmdWriteTimestamp)(commandBuffer, pipelineStage, queryPool, query);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdCopyQueryPoolResults(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, VkBuffer dstBuffer, VkDeviceSize dstOffset, VkDeviceSize stride, VkQueryResultFlags flags) {
+	vksCaptureStream* s = capture_begin(113);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &queryPool, sizeof(queryPool));
+	capture_raw(s, &firstQuery, sizeof(firstQuery));
+	capture_raw(s, &queryCount, sizeof(queryCount));
+	capture_raw(s, &dstBuffer, sizeof(dstBuffer));
+	capture_raw(s, &dstOffset, sizeof(dstOffset));
+	capture_raw(s, &stride, sizeof(stride));
+	capture_raw(s, &flags, sizeof(flags));
+	((PFN_vkCmdCopyQueryPoolResults)addrs->pvkCmdCopyQueryPoolResults)(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdCopyQueryPoolResults(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkQueryPool queryPool;
+	replay_raw(rd, &queryPool, sizeof(queryPool));
+	queryPool = (VkQueryPool)replay_map(r, (uint64_t)(uintptr_t)queryPool);
+	uint32_t firstQuery;
+	replay_raw(rd, &firstQuery, sizeof(firstQuery));
+	uint32_t queryCount;
+	replay_raw(rd, &queryCount, sizeof(queryCount));
+	VkBuffer dstBuffer;
+	replay_raw(rd, &dstBuffer, sizeof(dstBuffer));
+	dstBuffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)dstBuffer);
+	VkDeviceSize dstOffset;
+	replay_raw(rd, &dstOffset, sizeof(dstOffset));
+	VkDeviceSize stride;
+	replay_raw(rd, &stride, sizeof(stride));
+	VkQueryResultFlags flags;
+	replay_raw(rd, &flags, sizeof(flags));
+	if (rd->overflow || r->procs.pvkCmdCopyQueryPoolResults == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdCopyQueryPoolResults)r->procs.pvkCmdCopyQueryPoolResults)(commandBuffer, queryPool, firstQuery, queryCount, dstBuffer, dstOffset, stride, flags);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdPushConstants(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkPipelineLayout layout, VkShaderStageFlags stageFlags, uint32_t offset, uint32_t size, void* pValues) {
+	vksCaptureStream* s = capture_begin(114);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &layout, sizeof(layout));
+	capture_raw(s, &stageFlags, sizeof(stageFlags));
+	capture_raw(s, &offset, sizeof(offset));
+	capture_raw(s, &size, sizeof(size));
+	capture_pointer(s, pValues, (size_t)(size), sizeof(uint8_t));
+	((PFN_vkCmdPushConstants)addrs->pvkCmdPushConstants)(commandBuffer, layout, stageFlags, offset, size, pValues);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdPushConstants(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkPipelineLayout layout;
+	replay_raw(rd, &layout, sizeof(layout));
+	layout = (VkPipelineLayout)replay_map(r, (uint64_t)(uintptr_t)layout);
+	VkShaderStageFlags stageFlags;
+	replay_raw(rd, &stageFlags, sizeof(stageFlags));
+	uint32_t offset;
+	replay_raw(rd, &offset, sizeof(offset));
+	uint32_t size;
+	replay_raw(rd, &size, sizeof(size));
+	void* pValues = NULL;
+	pValues = replay_pointer(r, rd, sizeof(uint8_t), NULL);
+	if (rd->overflow || r->procs.pvkCmdPushConstants == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdPushConstants)r->procs.pvkCmdPushConstants)(commandBuffer, layout, stageFlags, offset, size, pValues);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdBeginRenderPass(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassContents contents) {
+	vksCaptureStream* s = capture_begin(115);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	if (capture_pointer(s, pRenderPassBegin, (size_t)(1), sizeof(VkRenderPassBeginInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkRenderPassBeginInfo(s, &pRenderPassBegin[i]);
+		}
+	}
+	capture_raw(s, &contents, sizeof(contents));
+	((PFN_vkCmdBeginRenderPass)addrs->pvkCmdBeginRenderPass)(commandBuffer, pRenderPassBegin, contents);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdBeginRenderPass(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkRenderPassBeginInfo* pRenderPassBegin = NULL;
+	{
+		size_t n;
+		VkRenderPassBeginInfo* v = replay_pointer(r, rd, sizeof(VkRenderPassBeginInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkRenderPassBeginInfo(r, rd, &v[i]);
+		}
+		pRenderPassBegin = v;
+	}
+	VkSubpassContents contents;
+	replay_raw(rd, &contents, sizeof(contents));
+	if (rd->overflow || r->procs.pvkCmdBeginRenderPass == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdBeginRenderPass)r->procs.pvkCmdBeginRenderPass)(commandBuffer, pRenderPassBegin, contents);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdNextSubpass(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkSubpassContents contents) {
+	vksCaptureStream* s = capture_begin(116);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &contents, sizeof(contents));
+	((PFN_vkCmdNextSubpass)addrs->pvkCmdNextSubpass)(commandBuffer, contents);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdNextSubpass(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkSubpassContents contents;
+	replay_raw(rd, &contents, sizeof(contents));
+	if (rd->overflow || r->procs.pvkCmdNextSubpass == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdNextSubpass)r->procs.pvkCmdNextSubpass)(commandBuffer, contents);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdEndRenderPass(vksProcAddr* addrs, VkCommandBuffer commandBuffer) {
+	vksCaptureStream* s = capture_begin(117);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	((PFN_vkCmdEndRenderPass)addrs->pvkCmdEndRenderPass)(commandBuffer);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdEndRenderPass(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	if (rd->overflow || r->procs.pvkCmdEndRenderPass == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdEndRenderPass)r->procs.pvkCmdEndRenderPass)(commandBuffer);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkCmdExecuteCommands(vksProcAddr* addrs, VkCommandBuffer commandBuffer, uint32_t commandBufferCount, VkCommandBuffer* pCommandBuffers) {
+	vksCaptureStream* s = capture_begin(118);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &commandBufferCount, sizeof(commandBufferCount));
+	capture_pointer(s, pCommandBuffers, (size_t)(commandBufferCount), sizeof(VkCommandBuffer));
+	((PFN_vkCmdExecuteCommands)addrs->pvkCmdExecuteCommands)(commandBuffer, commandBufferCount, pCommandBuffers);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdExecuteCommands(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	uint32_t commandBufferCount;
+	replay_raw(rd, &commandBufferCount, sizeof(commandBufferCount));
+	VkCommandBuffer* pCommandBuffers = NULL;
+	{
+		size_t n;
+		VkCommandBuffer* v = replay_pointer(r, rd, sizeof(VkCommandBuffer), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		pCommandBuffers = v;
+	}
+	if (rd->overflow || r->procs.pvkCmdExecuteCommands == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdExecuteCommands)r->procs.pvkCmdExecuteCommands)(commandBuffer, commandBufferCount, pCommandBuffers);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+VkResult vksCaptured_vkCreateBufferView(vksProcAddr* addrs, VkDevice device, VkBufferViewCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkBufferView* pView) {
+	vksCaptureStream* s = capture_begin(119);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkBufferViewCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkBufferViewCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pView, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateBufferView)addrs->pvkCreateBufferView)(device, pCreateInfo, pAllocator, pView);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pView : NULL, (size_t)(1), sizeof(VkBufferView));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateBufferView(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkBufferViewCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkBufferViewCreateInfo* v = replay_pointer(r, rd, sizeof(VkBufferViewCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkBufferViewCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkBufferView* pView = replay_output(r, rd, sizeof(VkBufferView));
+	if (rd->overflow || r->procs.pvkCreateBufferView == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateBufferView)r->procs.pvkCreateBufferView)(device, pCreateInfo, pAllocator, pView);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pView, sizeof(VkBufferView));
+	}
+	return ret;
+}
+
+VkResult vksCaptured_vkGetFenceStatus(vksProcAddr* addrs, VkDevice device, VkFence fence) {
+	vksCaptureStream* s = capture_begin(120);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &fence, sizeof(fence));
+	VkResult ret = ((PFN_vkGetFenceStatus)addrs->pvkGetFenceStatus)(device, fence);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetFenceStatus(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkFence fence;
+	replay_raw(rd, &fence, sizeof(fence));
+	fence = (VkFence)replay_map(r, (uint64_t)(uintptr_t)fence);
+	if (rd->overflow || r->procs.pvkGetFenceStatus == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetFenceStatus)r->procs.pvkGetFenceStatus)(device, fence);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+VkResult vksCaptured_vkWaitForFences(vksProcAddr* addrs, VkDevice device, uint32_t fenceCount, VkFence* pFences, VkBool32 waitAll, uint64_t timeout) {
+	vksCaptureStream* s = capture_begin(121);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &fenceCount, sizeof(fenceCount));
+	capture_pointer(s, pFences, (size_t)(fenceCount), sizeof(VkFence));
+	capture_raw(s, &waitAll, sizeof(waitAll));
+	capture_raw(s, &timeout, sizeof(timeout));
+	VkResult ret = ((PFN_vkWaitForFences)addrs->pvkWaitForFences)(device, fenceCount, pFences, waitAll, timeout);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkWaitForFences(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	uint32_t fenceCount;
+	replay_raw(rd, &fenceCount, sizeof(fenceCount));
+	VkFence* pFences = NULL;
+	{
+		size_t n;
+		VkFence* v = replay_pointer(r, rd, sizeof(VkFence), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkFence)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		pFences = v;
+	}
+	VkBool32 waitAll;
+	replay_raw(rd, &waitAll, sizeof(waitAll));
+	uint64_t timeout;
+	replay_raw(rd, &timeout, sizeof(timeout));
+	if (rd->overflow || r->procs.pvkWaitForFences == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkWaitForFences)r->procs.pvkWaitForFences)(device, fenceCount, pFences, waitAll, timeout);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+VkResult vksCaptured_vkCreateDevice(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkDeviceCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkDevice* pDevice) {
+	vksCaptureStream* s = capture_begin(122);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkDeviceCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkDeviceCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pDevice, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateDevice)addrs->pvkCreateDevice)(physicalDevice, pCreateInfo, pAllocator, pDevice);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pDevice : NULL, (size_t)(1), sizeof(VkDevice));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateDevice(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkDeviceCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkDeviceCreateInfo* v = replay_pointer(r, rd, sizeof(VkDeviceCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDeviceCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkDevice* pDevice = replay_output(r, rd, sizeof(VkDevice));
+	if (rd->overflow || r->procs.pvkCreateDevice == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateDevice)r->procs.pvkCreateDevice)(physicalDevice, pCreateInfo, pAllocator, pDevice);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pDevice, sizeof(VkDevice));
+	}
+	return ret;
+}
+
+VkResult vksCaptured_vkCreateSemaphore(vksProcAddr* addrs, VkDevice device, VkSemaphoreCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkSemaphore* pSemaphore) {
+	vksCaptureStream* s = capture_begin(123);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkSemaphoreCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkSemaphoreCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pSemaphore, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateSemaphore)addrs->pvkCreateSemaphore)(device, pCreateInfo, pAllocator, pSemaphore);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pSemaphore : NULL, (size_t)(1), sizeof(VkSemaphore));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateSemaphore(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkSemaphoreCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkSemaphoreCreateInfo* v = replay_pointer(r, rd, sizeof(VkSemaphoreCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSemaphoreCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkSemaphore* pSemaphore = replay_output(r, rd, sizeof(VkSemaphore));
+	if (rd->overflow || r->procs.pvkCreateSemaphore == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateSemaphore)r->procs.pvkCreateSemaphore)(device, pCreateInfo, pAllocator, pSemaphore);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pSemaphore, sizeof(VkSemaphore));
+	}
+	return ret;
+}
+
+void vksCaptured_vkDestroySemaphore(vksProcAddr* addrs, VkDevice device, VkSemaphore semaphore, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(124);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &semaphore, sizeof(semaphore));
+	((PFN_vkDestroySemaphore)addrs->pvkDestroySemaphore)(device, semaphore, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroySemaphore(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkSemaphore semaphore;
+	replay_raw(rd, &semaphore, sizeof(semaphore));
+	semaphore = (VkSemaphore)replay_map(r, (uint64_t)(uintptr_t)semaphore);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroySemaphore == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroySemaphore)r->procs.pvkDestroySemaphore)(device, semaphore, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkDestroyPipelineLayout(vksProcAddr* addrs, VkDevice device, VkPipelineLayout pipelineLayout, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(125);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &pipelineLayout, sizeof(pipelineLayout));
+	((PFN_vkDestroyPipelineLayout)addrs->pvkDestroyPipelineLayout)(device, pipelineLayout, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroyPipelineLayout(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkPipelineLayout pipelineLayout;
+	replay_raw(rd, &pipelineLayout, sizeof(pipelineLayout));
+	pipelineLayout = (VkPipelineLayout)replay_map(r, (uint64_t)(uintptr_t)pipelineLayout);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroyPipelineLayout == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroyPipelineLayout)r->procs.pvkDestroyPipelineLayout)(device, pipelineLayout, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkDestroyBuffer(vksProcAddr* addrs, VkDevice device, VkBuffer buffer, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(126);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &buffer, sizeof(buffer));
+	((PFN_vkDestroyBuffer)addrs->pvkDestroyBuffer)(device, buffer, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroyBuffer(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkBuffer buffer;
+	replay_raw(rd, &buffer, sizeof(buffer));
+	buffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)buffer);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroyBuffer == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroyBuffer)r->procs.pvkDestroyBuffer)(device, buffer, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+void vksCaptured_vkDestroyFence(vksProcAddr* addrs, VkDevice device, VkFence fence, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(127);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &fence, sizeof(fence));
+	((PFN_vkDestroyFence)addrs->pvkDestroyFence)(device, fence, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroyFence(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkFence fence;
+	replay_raw(rd, &fence, sizeof(fence));
+	fence = (VkFence)replay_map(r, (uint64_t)(uintptr_t)fence);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroyFence == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroyFence)r->procs.pvkDestroyFence)(device, fence, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+VkResult vksCaptured_vkCreateEvent(vksProcAddr* addrs, VkDevice device, VkEventCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkEvent* pEvent) {
+	vksCaptureStream* s = capture_begin(128);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkEventCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkEventCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pEvent, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateEvent)addrs->pvkCreateEvent)(device, pCreateInfo, pAllocator, pEvent);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pEvent : NULL, (size_t)(1), sizeof(VkEvent));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateEvent(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkEventCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkEventCreateInfo* v = replay_pointer(r, rd, sizeof(VkEventCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkEventCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkEvent* pEvent = replay_output(r, rd, sizeof(VkEvent));
+	if (rd->overflow || r->procs.pvkCreateEvent == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateEvent)r->procs.pvkCreateEvent)(device, pCreateInfo, pAllocator, pEvent);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pEvent, sizeof(VkEvent));
+	}
+	return ret;
+}
+
+void vksCaptured_vkDestroyEvent(vksProcAddr* addrs, VkDevice device, VkEvent event, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(129);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &event, sizeof(event));
+	((PFN_vkDestroyEvent)addrs->pvkDestroyEvent)(device, event, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroyEvent(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkEvent event;
+	replay_raw(rd, &event, sizeof(event));
+	event = (VkEvent)replay_map(r, (uint64_t)(uintptr_t)event);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroyEvent == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroyEvent)r->procs.pvkDestroyEvent)(device, event, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+
+VkResult vksCaptured_vkGetEventStatus(vksProcAddr* addrs, VkDevice device, VkEvent event) {
+	vksCaptureStream* s = capture_begin(130);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &event, sizeof(event));
+	VkResult ret = ((PFN_vkGetEventStatus)addrs->pvkGetEventStatus)(device, event);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetEventStatus(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkEvent event;
+	replay_raw(rd, &event, sizeof(event));
+	event = (VkEvent)replay_map(r, (uint64_t)(uintptr_t)event);
+	if (rd->overflow || r->procs.pvkGetEventStatus == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetEventStatus)r->procs.pvkGetEventStatus)(device, event);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+VkResult vksCaptured_vkSetEvent(vksProcAddr* addrs, VkDevice device, VkEvent event) {
+	vksCaptureStream* s = capture_begin(131);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &event, sizeof(event));
+	VkResult ret = ((PFN_vkSetEvent)addrs->pvkSetEvent)(device, event);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkSetEvent(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkEvent event;
+	replay_raw(rd, &event, sizeof(event));
+	event = (VkEvent)replay_map(r, (uint64_t)(uintptr_t)event);
+	if (rd->overflow || r->procs.pvkSetEvent == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkSetEvent)r->procs.pvkSetEvent)(device, event);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+VkResult vksCaptured_vkResetEvent(vksProcAddr* addrs, VkDevice device, VkEvent event) {
+	vksCaptureStream* s = capture_begin(132);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &event, sizeof(event));
+	VkResult ret = ((PFN_vkResetEvent)addrs->pvkResetEvent)(device, event);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkResetEvent(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkEvent event;
+	replay_raw(rd, &event, sizeof(event));
+	event = (VkEvent)replay_map(r, (uint64_t)(uintptr_t)event);
+	if (rd->overflow || r->procs.pvkResetEvent == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkResetEvent)r->procs.pvkResetEvent)(device, event);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+VkResult vksCaptured_vkCreateQueryPool(vksProcAddr* addrs, VkDevice device, VkQueryPoolCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkQueryPool* pQueryPool) {
+	vksCaptureStream* s = capture_begin(133);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkQueryPoolCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkQueryPoolCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pQueryPool, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateQueryPool)addrs->pvkCreateQueryPool)(device, pCreateInfo, pAllocator, pQueryPool);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pQueryPool : NULL, (size_t)(1), sizeof(VkQueryPool));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateQueryPool(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkQueryPoolCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkQueryPoolCreateInfo* v = replay_pointer(r, rd, sizeof(VkQueryPoolCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkQueryPoolCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkQueryPool* pQueryPool = replay_output(r, rd, sizeof(VkQueryPool));
+	if (rd->overflow || r->procs.pvkCreateQueryPool == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateQueryPool)r->procs.pvkCreateQueryPool)(device, pCreateInfo, pAllocator, pQueryPool);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pQueryPool, sizeof(VkQueryPool));
+	}
+	return ret;
+}
+
+VkResult vksCaptured_vkGetQueryPoolResults(vksProcAddr* addrs, VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount, size_t dataSize, void* pData, VkDeviceSize stride, VkQueryResultFlags flags) {
+	vksCaptureStream* s = capture_begin(134);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &queryPool, sizeof(queryPool));
+	capture_raw(s, &firstQuery, sizeof(firstQuery));
+	capture_raw(s, &queryCount, sizeof(queryCount));
+	capture_raw(s, &dataSize, sizeof(dataSize));
+	capture_pointer(s, pData, (size_t)(dataSize), sizeof(uint8_t));
+	capture_raw(s, &stride, sizeof(stride));
+	capture_raw(s, &flags, sizeof(flags));
+	VkResult ret = ((PFN_vkGetQueryPoolResults)addrs->pvkGetQueryPoolResults)(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetQueryPoolResults(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkQueryPool queryPool;
+	replay_raw(rd, &queryPool, sizeof(queryPool));
+	queryPool = (VkQueryPool)replay_map(r, (uint64_t)(uintptr_t)queryPool);
+	uint32_t firstQuery;
+	replay_raw(rd, &firstQuery, sizeof(firstQuery));
+	uint32_t queryCount;
+	replay_raw(rd, &queryCount, sizeof(queryCount));
+	size_t dataSize;
+	replay_raw(rd, &dataSize, sizeof(dataSize));
+	void* pData = NULL;
+	pData = replay_pointer(r, rd, sizeof(uint8_t), NULL);
+	VkDeviceSize stride;
+	replay_raw(rd, &stride, sizeof(stride));
+	VkQueryResultFlags flags;
+	replay_raw(rd, &flags, sizeof(flags));
+	if (rd->overflow || r->procs.pvkGetQueryPoolResults == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetQueryPoolResults)r->procs.pvkGetQueryPoolResults)(device, queryPool, firstQuery, queryCount, dataSize, pData, stride, flags);
+	*ns = replay_now() - start;
+	return ret;
+}
+
+#ifdef VKS_ENABLE_VERSION_1_1
+void vksCaptured_vkGetPhysicalDeviceFormatProperties2(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties2* pFormatProperties) {
+	vksCaptureStream* s = capture_begin(135);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_raw(s, &format, sizeof(format));
+	if (capture_pointer(s, pFormatProperties, (size_t)(1), sizeof(VkFormatProperties2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkFormatProperties2(s, &pFormatProperties[i]);
+		}
+	}
+	((PFN_vkGetPhysicalDeviceFormatProperties2)addrs->pvkGetPhysicalDeviceFormatProperties2)(physicalDevice, format, pFormatProperties);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetPhysicalDeviceFormatProperties2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkFormat format;
+	replay_raw(rd, &format, sizeof(format));
+	VkFormatProperties2* pFormatProperties = NULL;
+	{
+		size_t n;
+		VkFormatProperties2* v = replay_pointer(r, rd, sizeof(VkFormatProperties2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkFormatProperties2(r, rd, &v[i]);
+		}
+		pFormatProperties = v;
+	}
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceFormatProperties2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetPhysicalDeviceFormatProperties2)r->procs.pvkGetPhysicalDeviceFormatProperties2)(physicalDevice, format, pFormatProperties);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+void vksCaptured_vkGetPhysicalDeviceExternalFenceProperties(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceExternalFenceInfo* pExternalFenceInfo, VkExternalFenceProperties* pExternalFenceProperties) {
+	vksCaptureStream* s = capture_begin(136);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	if (capture_pointer(s, pExternalFenceInfo, (size_t)(1), sizeof(VkPhysicalDeviceExternalFenceInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPhysicalDeviceExternalFenceInfo(s, &pExternalFenceInfo[i]);
+		}
+	}
+	if (capture_pointer(s, pExternalFenceProperties, (size_t)(1), sizeof(VkExternalFenceProperties))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkExternalFenceProperties(s, &pExternalFenceProperties[i]);
+		}
+	}
+	((PFN_vkGetPhysicalDeviceExternalFenceProperties)addrs->pvkGetPhysicalDeviceExternalFenceProperties)(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetPhysicalDeviceExternalFenceProperties(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkPhysicalDeviceExternalFenceInfo* pExternalFenceInfo = NULL;
+	{
+		size_t n;
+		VkPhysicalDeviceExternalFenceInfo* v = replay_pointer(r, rd, sizeof(VkPhysicalDeviceExternalFenceInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPhysicalDeviceExternalFenceInfo(r, rd, &v[i]);
+		}
+		pExternalFenceInfo = v;
+	}
+	VkExternalFenceProperties* pExternalFenceProperties = NULL;
+	{
+		size_t n;
+		VkExternalFenceProperties* v = replay_pointer(r, rd, sizeof(VkExternalFenceProperties), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkExternalFenceProperties(r, rd, &v[i]);
+		}
+		pExternalFenceProperties = v;
+	}
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceExternalFenceProperties == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetPhysicalDeviceExternalFenceProperties)r->procs.pvkGetPhysicalDeviceExternalFenceProperties)(physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+void vksCaptured_vkGetPhysicalDeviceExternalBufferProperties(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceExternalBufferInfo* pExternalBufferInfo, VkExternalBufferProperties* pExternalBufferProperties) {
+	vksCaptureStream* s = capture_begin(137);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	if (capture_pointer(s, pExternalBufferInfo, (size_t)(1), sizeof(VkPhysicalDeviceExternalBufferInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPhysicalDeviceExternalBufferInfo(s, &pExternalBufferInfo[i]);
+		}
+	}
+	if (capture_pointer(s, pExternalBufferProperties, (size_t)(1), sizeof(VkExternalBufferProperties))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkExternalBufferProperties(s, &pExternalBufferProperties[i]);
+		}
+	}
+	((PFN_vkGetPhysicalDeviceExternalBufferProperties)addrs->pvkGetPhysicalDeviceExternalBufferProperties)(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetPhysicalDeviceExternalBufferProperties(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkPhysicalDeviceExternalBufferInfo* pExternalBufferInfo = NULL;
+	{
+		size_t n;
+		VkPhysicalDeviceExternalBufferInfo* v = replay_pointer(r, rd, sizeof(VkPhysicalDeviceExternalBufferInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPhysicalDeviceExternalBufferInfo(r, rd, &v[i]);
+		}
+		pExternalBufferInfo = v;
+	}
+	VkExternalBufferProperties* pExternalBufferProperties = NULL;
+	{
+		size_t n;
+		VkExternalBufferProperties* v = replay_pointer(r, rd, sizeof(VkExternalBufferProperties), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkExternalBufferProperties(r, rd, &v[i]);
+		}
+		pExternalBufferProperties = v;
+	}
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceExternalBufferProperties == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetPhysicalDeviceExternalBufferProperties)r->procs.pvkGetPhysicalDeviceExternalBufferProperties)(physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+void vksCaptured_vkUpdateDescriptorSetWithTemplate(vksProcAddr* addrs, VkDevice device, VkDescriptorSet descriptorSet, VkDescriptorUpdateTemplate descriptorUpdateTemplate, void* pData) {
+	vksCaptureStream* s = capture_begin(138);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &descriptorSet, sizeof(descriptorSet));
+	capture_raw(s, &descriptorUpdateTemplate, sizeof(descriptorUpdateTemplate));
+	((PFN_vkUpdateDescriptorSetWithTemplate)addrs->pvkUpdateDescriptorSetWithTemplate)(device, descriptorSet, descriptorUpdateTemplate, pData);
+	capture_end(s);
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+void vksCaptured_vkDestroyDescriptorUpdateTemplate(vksProcAddr* addrs, VkDevice device, VkDescriptorUpdateTemplate descriptorUpdateTemplate, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(139);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &descriptorUpdateTemplate, sizeof(descriptorUpdateTemplate));
+	((PFN_vkDestroyDescriptorUpdateTemplate)addrs->pvkDestroyDescriptorUpdateTemplate)(device, descriptorUpdateTemplate, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroyDescriptorUpdateTemplate(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkDescriptorUpdateTemplate descriptorUpdateTemplate;
+	replay_raw(rd, &descriptorUpdateTemplate, sizeof(descriptorUpdateTemplate));
+	descriptorUpdateTemplate = (VkDescriptorUpdateTemplate)replay_map(r, (uint64_t)(uintptr_t)descriptorUpdateTemplate);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroyDescriptorUpdateTemplate == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroyDescriptorUpdateTemplate)r->procs.pvkDestroyDescriptorUpdateTemplate)(device, descriptorUpdateTemplate, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+VkResult vksCaptured_vkCreateDescriptorUpdateTemplate(vksProcAddr* addrs, VkDevice device, VkDescriptorUpdateTemplateCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate) {
+	vksCaptureStream* s = capture_begin(140);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkDescriptorUpdateTemplateCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkDescriptorUpdateTemplateCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pDescriptorUpdateTemplate, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateDescriptorUpdateTemplate)addrs->pvkCreateDescriptorUpdateTemplate)(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pDescriptorUpdateTemplate : NULL, (size_t)(1), sizeof(VkDescriptorUpdateTemplate));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateDescriptorUpdateTemplate(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkDescriptorUpdateTemplateCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkDescriptorUpdateTemplateCreateInfo* v = replay_pointer(r, rd, sizeof(VkDescriptorUpdateTemplateCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDescriptorUpdateTemplateCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate = replay_output(r, rd, sizeof(VkDescriptorUpdateTemplate));
+	if (rd->overflow || r->procs.pvkCreateDescriptorUpdateTemplate == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateDescriptorUpdateTemplate)r->procs.pvkCreateDescriptorUpdateTemplate)(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pDescriptorUpdateTemplate, sizeof(VkDescriptorUpdateTemplate));
+	}
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+void vksCaptured_vkDestroySamplerYcbcrConversion(vksProcAddr* addrs, VkDevice device, VkSamplerYcbcrConversion ycbcrConversion, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(141);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &ycbcrConversion, sizeof(ycbcrConversion));
+	((PFN_vkDestroySamplerYcbcrConversion)addrs->pvkDestroySamplerYcbcrConversion)(device, ycbcrConversion, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroySamplerYcbcrConversion(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkSamplerYcbcrConversion ycbcrConversion;
+	replay_raw(rd, &ycbcrConversion, sizeof(ycbcrConversion));
+	ycbcrConversion = (VkSamplerYcbcrConversion)replay_map(r, (uint64_t)(uintptr_t)ycbcrConversion);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroySamplerYcbcrConversion == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroySamplerYcbcrConversion)r->procs.pvkDestroySamplerYcbcrConversion)(device, ycbcrConversion, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+VkResult vksCaptured_vkCreateSamplerYcbcrConversion(vksProcAddr* addrs, VkDevice device, VkSamplerYcbcrConversionCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkSamplerYcbcrConversion* pYcbcrConversion) {
+	vksCaptureStream* s = capture_begin(142);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkSamplerYcbcrConversionCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkSamplerYcbcrConversionCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pYcbcrConversion, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateSamplerYcbcrConversion)addrs->pvkCreateSamplerYcbcrConversion)(device, pCreateInfo, pAllocator, pYcbcrConversion);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pYcbcrConversion : NULL, (size_t)(1), sizeof(VkSamplerYcbcrConversion));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateSamplerYcbcrConversion(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkSamplerYcbcrConversionCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkSamplerYcbcrConversionCreateInfo* v = replay_pointer(r, rd, sizeof(VkSamplerYcbcrConversionCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSamplerYcbcrConversionCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkSamplerYcbcrConversion* pYcbcrConversion = replay_output(r, rd, sizeof(VkSamplerYcbcrConversion));
+	if (rd->overflow || r->procs.pvkCreateSamplerYcbcrConversion == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateSamplerYcbcrConversion)r->procs.pvkCreateSamplerYcbcrConversion)(device, pCreateInfo, pAllocator, pYcbcrConversion);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pYcbcrConversion, sizeof(VkSamplerYcbcrConversion));
+	}
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+void vksCaptured_vkGetDeviceQueue2(vksProcAddr* addrs, VkDevice device, VkDeviceQueueInfo2* pQueueInfo, VkQueue* pQueue) {
+	vksCaptureStream* s = capture_begin(143);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pQueueInfo, (size_t)(1), sizeof(VkDeviceQueueInfo2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkDeviceQueueInfo2(s, &pQueueInfo[i]);
+		}
+	}
+	capture_output(s, pQueue, (size_t)(1));
+	((PFN_vkGetDeviceQueue2)addrs->pvkGetDeviceQueue2)(device, pQueueInfo, pQueue);
+	int ok = 1;
+	capture_pointer(s, ok ? pQueue : NULL, (size_t)(1), sizeof(VkQueue));
+	capture_end(s);
+}
+
+static VkResult replay_vkGetDeviceQueue2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkDeviceQueueInfo2* pQueueInfo = NULL;
+	{
+		size_t n;
+		VkDeviceQueueInfo2* v = replay_pointer(r, rd, sizeof(VkDeviceQueueInfo2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDeviceQueueInfo2(r, rd, &v[i]);
+		}
+		pQueueInfo = v;
+	}
+	VkQueue* pQueue = replay_output(r, rd, sizeof(VkQueue));
+	if (rd->overflow || r->procs.pvkGetDeviceQueue2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetDeviceQueue2)r->procs.pvkGetDeviceQueue2)(device, pQueueInfo, pQueue);
+	*ns = replay_now() - start;
+	replay_remap(r, rd, pQueue, sizeof(VkQueue));
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+void vksCaptured_vkTrimCommandPool(vksProcAddr* addrs, VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlags flags) {
+	vksCaptureStream* s = capture_begin(144);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &commandPool, sizeof(commandPool));
+	capture_raw(s, &flags, sizeof(flags));
+	((PFN_vkTrimCommandPool)addrs->pvkTrimCommandPool)(device, commandPool, flags);
+	capture_end(s);
+}
+
+static VkResult replay_vkTrimCommandPool(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkCommandPool commandPool;
+	replay_raw(rd, &commandPool, sizeof(commandPool));
+	commandPool = (VkCommandPool)replay_map(r, (uint64_t)(uintptr_t)commandPool);
+	VkCommandPoolTrimFlags flags;
+	replay_raw(rd, &flags, sizeof(flags));
+	if (rd->overflow || r->procs.pvkTrimCommandPool == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkTrimCommandPool)r->procs.pvkTrimCommandPool)(device, commandPool, flags);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+void vksCaptured_vkGetPhysicalDeviceExternalSemaphoreProperties(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceExternalSemaphoreInfo* pExternalSemaphoreInfo, VkExternalSemaphoreProperties* pExternalSemaphoreProperties) {
+	vksCaptureStream* s = capture_begin(145);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	if (capture_pointer(s, pExternalSemaphoreInfo, (size_t)(1), sizeof(VkPhysicalDeviceExternalSemaphoreInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPhysicalDeviceExternalSemaphoreInfo(s, &pExternalSemaphoreInfo[i]);
+		}
+	}
+	if (capture_pointer(s, pExternalSemaphoreProperties, (size_t)(1), sizeof(VkExternalSemaphoreProperties))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkExternalSemaphoreProperties(s, &pExternalSemaphoreProperties[i]);
+		}
+	}
+	((PFN_vkGetPhysicalDeviceExternalSemaphoreProperties)addrs->pvkGetPhysicalDeviceExternalSemaphoreProperties)(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetPhysicalDeviceExternalSemaphoreProperties(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkPhysicalDeviceExternalSemaphoreInfo* pExternalSemaphoreInfo = NULL;
+	{
+		size_t n;
+		VkPhysicalDeviceExternalSemaphoreInfo* v = replay_pointer(r, rd, sizeof(VkPhysicalDeviceExternalSemaphoreInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPhysicalDeviceExternalSemaphoreInfo(r, rd, &v[i]);
+		}
+		pExternalSemaphoreInfo = v;
+	}
+	VkExternalSemaphoreProperties* pExternalSemaphoreProperties = NULL;
+	{
+		size_t n;
+		VkExternalSemaphoreProperties* v = replay_pointer(r, rd, sizeof(VkExternalSemaphoreProperties), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkExternalSemaphoreProperties(r, rd, &v[i]);
+		}
+		pExternalSemaphoreProperties = v;
+	}
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceExternalSemaphoreProperties == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetPhysicalDeviceExternalSemaphoreProperties)r->procs.pvkGetPhysicalDeviceExternalSemaphoreProperties)(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+void vksCaptured_vkGetPhysicalDeviceSparseImageFormatProperties2(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceSparseImageFormatInfo2* pFormatInfo, uint32_t* pPropertyCount, VkSparseImageFormatProperties2* pProperties) {
+	vksCaptureStream* s = capture_begin(146);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	if (capture_pointer(s, pFormatInfo, (size_t)(1), sizeof(VkPhysicalDeviceSparseImageFormatInfo2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPhysicalDeviceSparseImageFormatInfo2(s, &pFormatInfo[i]);
+		}
+	}
+	capture_pointer(s, pPropertyCount, (size_t)(1), sizeof(uint32_t));
+	if (capture_pointer(s, pProperties, (size_t)((pPropertyCount != NULL ? *pPropertyCount : 0)), sizeof(VkSparseImageFormatProperties2))) {
+		for (size_t i = 0; i < (size_t)((pPropertyCount != NULL ? *pPropertyCount : 0)); i++) {
+			capture_VkSparseImageFormatProperties2(s, &pProperties[i]);
+		}
+	}
+	((PFN_vkGetPhysicalDeviceSparseImageFormatProperties2)addrs->pvkGetPhysicalDeviceSparseImageFormatProperties2)(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetPhysicalDeviceSparseImageFormatProperties2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkPhysicalDeviceSparseImageFormatInfo2* pFormatInfo = NULL;
+	{
+		size_t n;
+		VkPhysicalDeviceSparseImageFormatInfo2* v = replay_pointer(r, rd, sizeof(VkPhysicalDeviceSparseImageFormatInfo2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPhysicalDeviceSparseImageFormatInfo2(r, rd, &v[i]);
+		}
+		pFormatInfo = v;
+	}
+	uint32_t* pPropertyCount = NULL;
+	pPropertyCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkSparseImageFormatProperties2* pProperties = NULL;
+	{
+		size_t n;
+		VkSparseImageFormatProperties2* v = replay_pointer(r, rd, sizeof(VkSparseImageFormatProperties2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSparseImageFormatProperties2(r, rd, &v[i]);
+		}
+		pProperties = v;
+	}
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceSparseImageFormatProperties2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetPhysicalDeviceSparseImageFormatProperties2)r->procs.pvkGetPhysicalDeviceSparseImageFormatProperties2)(physicalDevice, pFormatInfo, pPropertyCount, pProperties);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+void vksCaptured_vkGetPhysicalDeviceMemoryProperties2(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties2* pMemoryProperties) {
+	vksCaptureStream* s = capture_begin(147);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	if (capture_pointer(s, pMemoryProperties, (size_t)(1), sizeof(VkPhysicalDeviceMemoryProperties2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPhysicalDeviceMemoryProperties2(s, &pMemoryProperties[i]);
+		}
+	}
+	((PFN_vkGetPhysicalDeviceMemoryProperties2)addrs->pvkGetPhysicalDeviceMemoryProperties2)(physicalDevice, pMemoryProperties);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetPhysicalDeviceMemoryProperties2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkPhysicalDeviceMemoryProperties2* pMemoryProperties = NULL;
+	{
+		size_t n;
+		VkPhysicalDeviceMemoryProperties2* v = replay_pointer(r, rd, sizeof(VkPhysicalDeviceMemoryProperties2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPhysicalDeviceMemoryProperties2(r, rd, &v[i]);
+		}
+		pMemoryProperties = v;
+	}
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceMemoryProperties2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetPhysicalDeviceMemoryProperties2)r->procs.pvkGetPhysicalDeviceMemoryProperties2)(physicalDevice, pMemoryProperties);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+void vksCaptured_vkGetPhysicalDeviceQueueFamilyProperties2(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties2* pQueueFamilyProperties) {
+	vksCaptureStream* s = capture_begin(148);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_pointer(s, pQueueFamilyPropertyCount, (size_t)(1), sizeof(uint32_t));
+	if (capture_pointer(s, pQueueFamilyProperties, (size_t)((pQueueFamilyPropertyCount != NULL ? *pQueueFamilyPropertyCount : 0)), sizeof(VkQueueFamilyProperties2))) {
+		for (size_t i = 0; i < (size_t)((pQueueFamilyPropertyCount != NULL ? *pQueueFamilyPropertyCount : 0)); i++) {
+			capture_VkQueueFamilyProperties2(s, &pQueueFamilyProperties[i]);
+		}
+	}
+	((PFN_vkGetPhysicalDeviceQueueFamilyProperties2)addrs->pvkGetPhysicalDeviceQueueFamilyProperties2)(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetPhysicalDeviceQueueFamilyProperties2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	uint32_t* pQueueFamilyPropertyCount = NULL;
+	pQueueFamilyPropertyCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkQueueFamilyProperties2* pQueueFamilyProperties = NULL;
+	{
+		size_t n;
+		VkQueueFamilyProperties2* v = replay_pointer(r, rd, sizeof(VkQueueFamilyProperties2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkQueueFamilyProperties2(r, rd, &v[i]);
+		}
+		pQueueFamilyProperties = v;
+	}
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceQueueFamilyProperties2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetPhysicalDeviceQueueFamilyProperties2)r->procs.pvkGetPhysicalDeviceQueueFamilyProperties2)(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+VkResult vksCaptured_vkGetPhysicalDeviceImageFormatProperties2(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceImageFormatInfo2* pImageFormatInfo, VkImageFormatProperties2* pImageFormatProperties) {
+	vksCaptureStream* s = capture_begin(149);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	if (capture_pointer(s, pImageFormatInfo, (size_t)(1), sizeof(VkPhysicalDeviceImageFormatInfo2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPhysicalDeviceImageFormatInfo2(s, &pImageFormatInfo[i]);
+		}
+	}
+	if (capture_pointer(s, pImageFormatProperties, (size_t)(1), sizeof(VkImageFormatProperties2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkImageFormatProperties2(s, &pImageFormatProperties[i]);
+		}
+	}
+	VkResult ret = ((PFN_vkGetPhysicalDeviceImageFormatProperties2)addrs->pvkGetPhysicalDeviceImageFormatProperties2)(physicalDevice, pImageFormatInfo, pImageFormatProperties);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetPhysicalDeviceImageFormatProperties2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkPhysicalDeviceImageFormatInfo2* pImageFormatInfo = NULL;
+	{
+		size_t n;
+		VkPhysicalDeviceImageFormatInfo2* v = replay_pointer(r, rd, sizeof(VkPhysicalDeviceImageFormatInfo2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPhysicalDeviceImageFormatInfo2(r, rd, &v[i]);
+		}
+		pImageFormatInfo = v;
+	}
+	VkImageFormatProperties2* pImageFormatProperties = NULL;
+	{
+		size_t n;
+		VkImageFormatProperties2* v = replay_pointer(r, rd, sizeof(VkImageFormatProperties2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkImageFormatProperties2(r, rd, &v[i]);
+		}
+		pImageFormatProperties = v;
+	}
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceImageFormatProperties2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetPhysicalDeviceImageFormatProperties2)r->procs.pvkGetPhysicalDeviceImageFormatProperties2)(physicalDevice, pImageFormatInfo, pImageFormatProperties);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+void vksCaptured_vkGetPhysicalDeviceProperties2(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties2* pProperties) {
+	vksCaptureStream* s = capture_begin(150);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	if (capture_pointer(s, pProperties, (size_t)(1), sizeof(VkPhysicalDeviceProperties2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPhysicalDeviceProperties2(s, &pProperties[i]);
+		}
+	}
+	((PFN_vkGetPhysicalDeviceProperties2)addrs->pvkGetPhysicalDeviceProperties2)(physicalDevice, pProperties);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetPhysicalDeviceProperties2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkPhysicalDeviceProperties2* pProperties = NULL;
+	{
+		size_t n;
+		VkPhysicalDeviceProperties2* v = replay_pointer(r, rd, sizeof(VkPhysicalDeviceProperties2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPhysicalDeviceProperties2(r, rd, &v[i]);
+		}
+		pProperties = v;
+	}
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceProperties2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetPhysicalDeviceProperties2)r->procs.pvkGetPhysicalDeviceProperties2)(physicalDevice, pProperties);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+void vksCaptured_vkGetPhysicalDeviceFeatures2(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures2* pFeatures) {
+	vksCaptureStream* s = capture_begin(151);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	if (capture_pointer(s, pFeatures, (size_t)(1), sizeof(VkPhysicalDeviceFeatures2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPhysicalDeviceFeatures2(s, &pFeatures[i]);
+		}
+	}
+	((PFN_vkGetPhysicalDeviceFeatures2)addrs->pvkGetPhysicalDeviceFeatures2)(physicalDevice, pFeatures);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetPhysicalDeviceFeatures2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkPhysicalDeviceFeatures2* pFeatures = NULL;
+	{
+		size_t n;
+		VkPhysicalDeviceFeatures2* v = replay_pointer(r, rd, sizeof(VkPhysicalDeviceFeatures2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPhysicalDeviceFeatures2(r, rd, &v[i]);
+		}
+		pFeatures = v;
+	}
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceFeatures2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetPhysicalDeviceFeatures2)r->procs.pvkGetPhysicalDeviceFeatures2)(physicalDevice, pFeatures);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+void vksCaptured_vkGetImageSparseMemoryRequirements2(vksProcAddr* addrs, VkDevice device, VkImageSparseMemoryRequirementsInfo2* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2* pSparseMemoryRequirements) {
+	vksCaptureStream* s = capture_begin(152);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pInfo, (size_t)(1), sizeof(VkImageSparseMemoryRequirementsInfo2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkImageSparseMemoryRequirementsInfo2(s, &pInfo[i]);
+		}
+	}
+	capture_pointer(s, pSparseMemoryRequirementCount, (size_t)(1), sizeof(uint32_t));
+	if (capture_pointer(s, pSparseMemoryRequirements, (size_t)((pSparseMemoryRequirementCount != NULL ? *pSparseMemoryRequirementCount : 0)), sizeof(VkSparseImageMemoryRequirements2))) {
+		for (size_t i = 0; i < (size_t)((pSparseMemoryRequirementCount != NULL ? *pSparseMemoryRequirementCount : 0)); i++) {
+			capture_VkSparseImageMemoryRequirements2(s, &pSparseMemoryRequirements[i]);
+		}
+	}
+	((PFN_vkGetImageSparseMemoryRequirements2)addrs->pvkGetImageSparseMemoryRequirements2)(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetImageSparseMemoryRequirements2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkImageSparseMemoryRequirementsInfo2* pInfo = NULL;
+	{
+		size_t n;
+		VkImageSparseMemoryRequirementsInfo2* v = replay_pointer(r, rd, sizeof(VkImageSparseMemoryRequirementsInfo2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkImageSparseMemoryRequirementsInfo2(r, rd, &v[i]);
+		}
+		pInfo = v;
+	}
+	uint32_t* pSparseMemoryRequirementCount = NULL;
+	pSparseMemoryRequirementCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkSparseImageMemoryRequirements2* pSparseMemoryRequirements = NULL;
+	{
+		size_t n;
+		VkSparseImageMemoryRequirements2* v = replay_pointer(r, rd, sizeof(VkSparseImageMemoryRequirements2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSparseImageMemoryRequirements2(r, rd, &v[i]);
+		}
+		pSparseMemoryRequirements = v;
+	}
+	if (rd->overflow || r->procs.pvkGetImageSparseMemoryRequirements2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetImageSparseMemoryRequirements2)r->procs.pvkGetImageSparseMemoryRequirements2)(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+void vksCaptured_vkGetBufferMemoryRequirements2(vksProcAddr* addrs, VkDevice device, VkBufferMemoryRequirementsInfo2* pInfo, VkMemoryRequirements2* pMemoryRequirements) {
+	vksCaptureStream* s = capture_begin(153);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pInfo, (size_t)(1), sizeof(VkBufferMemoryRequirementsInfo2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkBufferMemoryRequirementsInfo2(s, &pInfo[i]);
+		}
+	}
+	if (capture_pointer(s, pMemoryRequirements, (size_t)(1), sizeof(VkMemoryRequirements2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkMemoryRequirements2(s, &pMemoryRequirements[i]);
+		}
+	}
+	((PFN_vkGetBufferMemoryRequirements2)addrs->pvkGetBufferMemoryRequirements2)(device, pInfo, pMemoryRequirements);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetBufferMemoryRequirements2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkBufferMemoryRequirementsInfo2* pInfo = NULL;
+	{
+		size_t n;
+		VkBufferMemoryRequirementsInfo2* v = replay_pointer(r, rd, sizeof(VkBufferMemoryRequirementsInfo2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkBufferMemoryRequirementsInfo2(r, rd, &v[i]);
+		}
+		pInfo = v;
+	}
+	VkMemoryRequirements2* pMemoryRequirements = NULL;
+	{
+		size_t n;
+		VkMemoryRequirements2* v = replay_pointer(r, rd, sizeof(VkMemoryRequirements2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkMemoryRequirements2(r, rd, &v[i]);
+		}
+		pMemoryRequirements = v;
+	}
+	if (rd->overflow || r->procs.pvkGetBufferMemoryRequirements2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetBufferMemoryRequirements2)r->procs.pvkGetBufferMemoryRequirements2)(device, pInfo, pMemoryRequirements);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+void vksCaptured_vkGetDescriptorSetLayoutSupport(vksProcAddr* addrs, VkDevice device, VkDescriptorSetLayoutCreateInfo* pCreateInfo, VkDescriptorSetLayoutSupport* pSupport) {
+	vksCaptureStream* s = capture_begin(154);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkDescriptorSetLayoutCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkDescriptorSetLayoutCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	if (capture_pointer(s, pSupport, (size_t)(1), sizeof(VkDescriptorSetLayoutSupport))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkDescriptorSetLayoutSupport(s, &pSupport[i]);
+		}
+	}
+	((PFN_vkGetDescriptorSetLayoutSupport)addrs->pvkGetDescriptorSetLayoutSupport)(device, pCreateInfo, pSupport);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetDescriptorSetLayoutSupport(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkDescriptorSetLayoutCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkDescriptorSetLayoutCreateInfo* v = replay_pointer(r, rd, sizeof(VkDescriptorSetLayoutCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDescriptorSetLayoutCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkDescriptorSetLayoutSupport* pSupport = NULL;
+	{
+		size_t n;
+		VkDescriptorSetLayoutSupport* v = replay_pointer(r, rd, sizeof(VkDescriptorSetLayoutSupport), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDescriptorSetLayoutSupport(r, rd, &v[i]);
+		}
+		pSupport = v;
+	}
+	if (rd->overflow || r->procs.pvkGetDescriptorSetLayoutSupport == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetDescriptorSetLayoutSupport)r->procs.pvkGetDescriptorSetLayoutSupport)(device, pCreateInfo, pSupport);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+void vksCaptured_vkGetImageMemoryRequirements2(vksProcAddr* addrs, VkDevice device, VkImageMemoryRequirementsInfo2* pInfo, VkMemoryRequirements2* pMemoryRequirements) {
+	vksCaptureStream* s = capture_begin(155);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pInfo, (size_t)(1), sizeof(VkImageMemoryRequirementsInfo2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkImageMemoryRequirementsInfo2(s, &pInfo[i]);
+		}
+	}
+	if (capture_pointer(s, pMemoryRequirements, (size_t)(1), sizeof(VkMemoryRequirements2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkMemoryRequirements2(s, &pMemoryRequirements[i]);
+		}
+	}
+	((PFN_vkGetImageMemoryRequirements2)addrs->pvkGetImageMemoryRequirements2)(device, pInfo, pMemoryRequirements);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetImageMemoryRequirements2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkImageMemoryRequirementsInfo2* pInfo = NULL;
+	{
+		size_t n;
+		VkImageMemoryRequirementsInfo2* v = replay_pointer(r, rd, sizeof(VkImageMemoryRequirementsInfo2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkImageMemoryRequirementsInfo2(r, rd, &v[i]);
+		}
+		pInfo = v;
+	}
+	VkMemoryRequirements2* pMemoryRequirements = NULL;
+	{
+		size_t n;
+		VkMemoryRequirements2* v = replay_pointer(r, rd, sizeof(VkMemoryRequirements2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkMemoryRequirements2(r, rd, &v[i]);
+		}
+		pMemoryRequirements = v;
+	}
+	if (rd->overflow || r->procs.pvkGetImageMemoryRequirements2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetImageMemoryRequirements2)r->procs.pvkGetImageMemoryRequirements2)(device, pInfo, pMemoryRequirements);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+VkResult vksCaptured_vkEnumeratePhysicalDeviceGroups(vksProcAddr* addrs, VkInstance instance, uint32_t* pPhysicalDeviceGroupCount, VkPhysicalDeviceGroupProperties* pPhysicalDeviceGroupProperties) {
+	vksCaptureStream* s = capture_begin(156);
+	capture_raw(s, &instance, sizeof(instance));
+	capture_pointer(s, pPhysicalDeviceGroupCount, (size_t)(1), sizeof(uint32_t));
+	if (capture_pointer(s, pPhysicalDeviceGroupProperties, (size_t)((pPhysicalDeviceGroupCount != NULL ? *pPhysicalDeviceGroupCount : 0)), sizeof(VkPhysicalDeviceGroupProperties))) {
+		for (size_t i = 0; i < (size_t)((pPhysicalDeviceGroupCount != NULL ? *pPhysicalDeviceGroupCount : 0)); i++) {
+			capture_VkPhysicalDeviceGroupProperties(s, &pPhysicalDeviceGroupProperties[i]);
+		}
+	}
+	VkResult ret = ((PFN_vkEnumeratePhysicalDeviceGroups)addrs->pvkEnumeratePhysicalDeviceGroups)(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkEnumeratePhysicalDeviceGroups(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkInstance instance;
+	replay_raw(rd, &instance, sizeof(instance));
+	instance = (VkInstance)replay_map(r, (uint64_t)(uintptr_t)instance);
+	uint32_t* pPhysicalDeviceGroupCount = NULL;
+	pPhysicalDeviceGroupCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkPhysicalDeviceGroupProperties* pPhysicalDeviceGroupProperties = NULL;
+	{
+		size_t n;
+		VkPhysicalDeviceGroupProperties* v = replay_pointer(r, rd, sizeof(VkPhysicalDeviceGroupProperties), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPhysicalDeviceGroupProperties(r, rd, &v[i]);
+		}
+		pPhysicalDeviceGroupProperties = v;
+	}
+	if (rd->overflow || r->procs.pvkEnumeratePhysicalDeviceGroups == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkEnumeratePhysicalDeviceGroups)r->procs.pvkEnumeratePhysicalDeviceGroups)(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+void vksCaptured_vkCmdDispatchBase(vksProcAddr* addrs, VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) {
+	vksCaptureStream* s = capture_begin(157);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &baseGroupX, sizeof(baseGroupX));
+	capture_raw(s, &baseGroupY, sizeof(baseGroupY));
+	capture_raw(s, &baseGroupZ, sizeof(baseGroupZ));
+	capture_raw(s, &groupCountX, sizeof(groupCountX));
+	capture_raw(s, &groupCountY, sizeof(groupCountY));
+	capture_raw(s, &groupCountZ, sizeof(groupCountZ));
+	((PFN_vkCmdDispatchBase)addrs->pvkCmdDispatchBase)(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdDispatchBase(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	uint32_t baseGroupX;
+	replay_raw(rd, &baseGroupX, sizeof(baseGroupX));
+	uint32_t baseGroupY;
+	replay_raw(rd, &baseGroupY, sizeof(baseGroupY));
+	uint32_t baseGroupZ;
+	replay_raw(rd, &baseGroupZ, sizeof(baseGroupZ));
+	uint32_t groupCountX;
+	replay_raw(rd, &groupCountX, sizeof(groupCountX));
+	uint32_t groupCountY;
+	replay_raw(rd, &groupCountY, sizeof(groupCountY));
+	uint32_t groupCountZ;
+	replay_raw(rd, &groupCountZ, sizeof(groupCountZ));
+	if (rd->overflow || r->procs.pvkCmdDispatchBase == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdDispatchBase)r->procs.pvkCmdDispatchBase)(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+void vksCaptured_vkCmdSetDeviceMask(vksProcAddr* addrs, VkCommandBuffer commandBuffer, uint32_t deviceMask) {
+	vksCaptureStream* s = capture_begin(158);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &deviceMask, sizeof(deviceMask));
+	((PFN_vkCmdSetDeviceMask)addrs->pvkCmdSetDeviceMask)(commandBuffer, deviceMask);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetDeviceMask(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	uint32_t deviceMask;
+	replay_raw(rd, &deviceMask, sizeof(deviceMask));
+	if (rd->overflow || r->procs.pvkCmdSetDeviceMask == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetDeviceMask)r->procs.pvkCmdSetDeviceMask)(commandBuffer, deviceMask);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+void vksCaptured_vkGetDeviceGroupPeerMemoryFeatures(vksProcAddr* addrs, VkDevice device, uint32_t heapIndex, uint32_t localDeviceIndex, uint32_t remoteDeviceIndex, VkPeerMemoryFeatureFlags* pPeerMemoryFeatures) {
+	vksCaptureStream* s = capture_begin(159);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &heapIndex, sizeof(heapIndex));
+	capture_raw(s, &localDeviceIndex, sizeof(localDeviceIndex));
+	capture_raw(s, &remoteDeviceIndex, sizeof(remoteDeviceIndex));
+	capture_pointer(s, pPeerMemoryFeatures, (size_t)(1), sizeof(VkPeerMemoryFeatureFlags));
+	((PFN_vkGetDeviceGroupPeerMemoryFeatures)addrs->pvkGetDeviceGroupPeerMemoryFeatures)(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetDeviceGroupPeerMemoryFeatures(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	uint32_t heapIndex;
+	replay_raw(rd, &heapIndex, sizeof(heapIndex));
+	uint32_t localDeviceIndex;
+	replay_raw(rd, &localDeviceIndex, sizeof(localDeviceIndex));
+	uint32_t remoteDeviceIndex;
+	replay_raw(rd, &remoteDeviceIndex, sizeof(remoteDeviceIndex));
+	VkPeerMemoryFeatureFlags* pPeerMemoryFeatures = NULL;
+	pPeerMemoryFeatures = replay_pointer(r, rd, sizeof(VkPeerMemoryFeatureFlags), NULL);
+	if (rd->overflow || r->procs.pvkGetDeviceGroupPeerMemoryFeatures == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetDeviceGroupPeerMemoryFeatures)r->procs.pvkGetDeviceGroupPeerMemoryFeatures)(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+VkResult vksCaptured_vkBindImageMemory2(vksProcAddr* addrs, VkDevice device, uint32_t bindInfoCount, VkBindImageMemoryInfo* pBindInfos) {
+	vksCaptureStream* s = capture_begin(160);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &bindInfoCount, sizeof(bindInfoCount));
+	if (capture_pointer(s, pBindInfos, (size_t)(bindInfoCount), sizeof(VkBindImageMemoryInfo))) {
+		for (size_t i = 0; i < (size_t)(bindInfoCount); i++) {
+			capture_VkBindImageMemoryInfo(s, &pBindInfos[i]);
+		}
+	}
+	VkResult ret = ((PFN_vkBindImageMemory2)addrs->pvkBindImageMemory2)(device, bindInfoCount, pBindInfos);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkBindImageMemory2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	uint32_t bindInfoCount;
+	replay_raw(rd, &bindInfoCount, sizeof(bindInfoCount));
+	VkBindImageMemoryInfo* pBindInfos = NULL;
+	{
+		size_t n;
+		VkBindImageMemoryInfo* v = replay_pointer(r, rd, sizeof(VkBindImageMemoryInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkBindImageMemoryInfo(r, rd, &v[i]);
+		}
+		pBindInfos = v;
+	}
+	if (rd->overflow || r->procs.pvkBindImageMemory2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkBindImageMemory2)r->procs.pvkBindImageMemory2)(device, bindInfoCount, pBindInfos);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+VkResult vksCaptured_vkBindBufferMemory2(vksProcAddr* addrs, VkDevice device, uint32_t bindInfoCount, VkBindBufferMemoryInfo* pBindInfos) {
+	vksCaptureStream* s = capture_begin(161);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &bindInfoCount, sizeof(bindInfoCount));
+	if (capture_pointer(s, pBindInfos, (size_t)(bindInfoCount), sizeof(VkBindBufferMemoryInfo))) {
+		for (size_t i = 0; i < (size_t)(bindInfoCount); i++) {
+			capture_VkBindBufferMemoryInfo(s, &pBindInfos[i]);
+		}
+	}
+	VkResult ret = ((PFN_vkBindBufferMemory2)addrs->pvkBindBufferMemory2)(device, bindInfoCount, pBindInfos);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkBindBufferMemory2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	uint32_t bindInfoCount;
+	replay_raw(rd, &bindInfoCount, sizeof(bindInfoCount));
+	VkBindBufferMemoryInfo* pBindInfos = NULL;
+	{
+		size_t n;
+		VkBindBufferMemoryInfo* v = replay_pointer(r, rd, sizeof(VkBindBufferMemoryInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkBindBufferMemoryInfo(r, rd, &v[i]);
+		}
+		pBindInfos = v;
+	}
+	if (rd->overflow || r->procs.pvkBindBufferMemory2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkBindBufferMemory2)r->procs.pvkBindBufferMemory2)(device, bindInfoCount, pBindInfos);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_1
+VkResult vksCaptured_vkEnumerateInstanceVersion(vksProcAddr* addrs, uint32_t* pApiVersion) {
+	vksCaptureStream* s = capture_begin(162);
+	capture_pointer(s, pApiVersion, (size_t)(1), sizeof(uint32_t));
+	VkResult ret = ((PFN_vkEnumerateInstanceVersion)addrs->pvkEnumerateInstanceVersion)(pApiVersion);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkEnumerateInstanceVersion(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	uint32_t* pApiVersion = NULL;
+	pApiVersion = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	if (rd->overflow || r->global.pvkEnumerateInstanceVersion == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkEnumerateInstanceVersion)r->global.pvkEnumerateInstanceVersion)(pApiVersion);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_2
+void vksCaptured_vkCmdBeginRenderPass2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassBeginInfo* pSubpassBeginInfo) {
+	vksCaptureStream* s = capture_begin(163);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	if (capture_pointer(s, pRenderPassBegin, (size_t)(1), sizeof(VkRenderPassBeginInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkRenderPassBeginInfo(s, &pRenderPassBegin[i]);
+		}
+	}
+	if (capture_pointer(s, pSubpassBeginInfo, (size_t)(1), sizeof(VkSubpassBeginInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkSubpassBeginInfo(s, &pSubpassBeginInfo[i]);
+		}
+	}
+	((PFN_vkCmdBeginRenderPass2)addrs->pvkCmdBeginRenderPass2)(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdBeginRenderPass2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkRenderPassBeginInfo* pRenderPassBegin = NULL;
+	{
+		size_t n;
+		VkRenderPassBeginInfo* v = replay_pointer(r, rd, sizeof(VkRenderPassBeginInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkRenderPassBeginInfo(r, rd, &v[i]);
+		}
+		pRenderPassBegin = v;
+	}
+	VkSubpassBeginInfo* pSubpassBeginInfo = NULL;
+	{
+		size_t n;
+		VkSubpassBeginInfo* v = replay_pointer(r, rd, sizeof(VkSubpassBeginInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSubpassBeginInfo(r, rd, &v[i]);
+		}
+		pSubpassBeginInfo = v;
+	}
+	if (rd->overflow || r->procs.pvkCmdBeginRenderPass2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdBeginRenderPass2)r->procs.pvkCmdBeginRenderPass2)(commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_2
+uint64_t vksCaptured_vkGetBufferOpaqueCaptureAddress(vksProcAddr* addrs, VkDevice device, VkBufferDeviceAddressInfo* pInfo) {
+	vksCaptureStream* s = capture_begin(164);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pInfo, (size_t)(1), sizeof(VkBufferDeviceAddressInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkBufferDeviceAddressInfo(s, &pInfo[i]);
+		}
+	}
+	uint64_t ret = ((PFN_vkGetBufferOpaqueCaptureAddress)addrs->pvkGetBufferOpaqueCaptureAddress)(device, pInfo);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetBufferOpaqueCaptureAddress(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkBufferDeviceAddressInfo* pInfo = NULL;
+	{
+		size_t n;
+		VkBufferDeviceAddressInfo* v = replay_pointer(r, rd, sizeof(VkBufferDeviceAddressInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkBufferDeviceAddressInfo(r, rd, &v[i]);
+		}
+		pInfo = v;
+	}
+	if (rd->overflow || r->procs.pvkGetBufferOpaqueCaptureAddress == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetBufferOpaqueCaptureAddress)r->procs.pvkGetBufferOpaqueCaptureAddress)(device, pInfo);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_2
+VkDeviceAddress vksCaptured_vkGetBufferDeviceAddress(vksProcAddr* addrs, VkDevice device, VkBufferDeviceAddressInfo* pInfo) {
+	vksCaptureStream* s = capture_begin(165);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pInfo, (size_t)(1), sizeof(VkBufferDeviceAddressInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkBufferDeviceAddressInfo(s, &pInfo[i]);
+		}
+	}
+	VkDeviceAddress ret = ((PFN_vkGetBufferDeviceAddress)addrs->pvkGetBufferDeviceAddress)(device, pInfo);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetBufferDeviceAddress(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkBufferDeviceAddressInfo* pInfo = NULL;
+	{
+		size_t n;
+		VkBufferDeviceAddressInfo* v = replay_pointer(r, rd, sizeof(VkBufferDeviceAddressInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkBufferDeviceAddressInfo(r, rd, &v[i]);
+		}
+		pInfo = v;
+	}
+	if (rd->overflow || r->procs.pvkGetBufferDeviceAddress == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetBufferDeviceAddress)r->procs.pvkGetBufferDeviceAddress)(device, pInfo);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_2
+void vksCaptured_vkCmdDrawIndirectCount(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
+	vksCaptureStream* s = capture_begin(166);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &buffer, sizeof(buffer));
+	capture_raw(s, &offset, sizeof(offset));
+	capture_raw(s, &countBuffer, sizeof(countBuffer));
+	capture_raw(s, &countBufferOffset, sizeof(countBufferOffset));
+	capture_raw(s, &maxDrawCount, sizeof(maxDrawCount));
+	capture_raw(s, &stride, sizeof(stride));
+	((PFN_vkCmdDrawIndirectCount)addrs->pvkCmdDrawIndirectCount)(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdDrawIndirectCount(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkBuffer buffer;
+	replay_raw(rd, &buffer, sizeof(buffer));
+	buffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)buffer);
+	VkDeviceSize offset;
+	replay_raw(rd, &offset, sizeof(offset));
+	VkBuffer countBuffer;
+	replay_raw(rd, &countBuffer, sizeof(countBuffer));
+	countBuffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)countBuffer);
+	VkDeviceSize countBufferOffset;
+	replay_raw(rd, &countBufferOffset, sizeof(countBufferOffset));
+	uint32_t maxDrawCount;
+	replay_raw(rd, &maxDrawCount, sizeof(maxDrawCount));
+	uint32_t stride;
+	replay_raw(rd, &stride, sizeof(stride));
+	if (rd->overflow || r->procs.pvkCmdDrawIndirectCount == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdDrawIndirectCount)r->procs.pvkCmdDrawIndirectCount)(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_2
+void vksCaptured_vkCmdDrawIndexedIndirectCount(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) {
+	vksCaptureStream* s = capture_begin(167);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &buffer, sizeof(buffer));
+	capture_raw(s, &offset, sizeof(offset));
+	capture_raw(s, &countBuffer, sizeof(countBuffer));
+	capture_raw(s, &countBufferOffset, sizeof(countBufferOffset));
+	capture_raw(s, &maxDrawCount, sizeof(maxDrawCount));
+	capture_raw(s, &stride, sizeof(stride));
+	((PFN_vkCmdDrawIndexedIndirectCount)addrs->pvkCmdDrawIndexedIndirectCount)(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdDrawIndexedIndirectCount(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkBuffer buffer;
+	replay_raw(rd, &buffer, sizeof(buffer));
+	buffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)buffer);
+	VkDeviceSize offset;
+	replay_raw(rd, &offset, sizeof(offset));
+	VkBuffer countBuffer;
+	replay_raw(rd, &countBuffer, sizeof(countBuffer));
+	countBuffer = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)countBuffer);
+	VkDeviceSize countBufferOffset;
+	replay_raw(rd, &countBufferOffset, sizeof(countBufferOffset));
+	uint32_t maxDrawCount;
+	replay_raw(rd, &maxDrawCount, sizeof(maxDrawCount));
+	uint32_t stride;
+	replay_raw(rd, &stride, sizeof(stride));
+	if (rd->overflow || r->procs.pvkCmdDrawIndexedIndirectCount == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdDrawIndexedIndirectCount)r->procs.pvkCmdDrawIndexedIndirectCount)(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_2
+VkResult vksCaptured_vkCreateRenderPass2(vksProcAddr* addrs, VkDevice device, VkRenderPassCreateInfo2* pCreateInfo, VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) {
+	vksCaptureStream* s = capture_begin(168);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkRenderPassCreateInfo2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkRenderPassCreateInfo2(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pRenderPass, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateRenderPass2)addrs->pvkCreateRenderPass2)(device, pCreateInfo, pAllocator, pRenderPass);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pRenderPass : NULL, (size_t)(1), sizeof(VkRenderPass));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateRenderPass2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkRenderPassCreateInfo2* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkRenderPassCreateInfo2* v = replay_pointer(r, rd, sizeof(VkRenderPassCreateInfo2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkRenderPassCreateInfo2(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkRenderPass* pRenderPass = replay_output(r, rd, sizeof(VkRenderPass));
+	if (rd->overflow || r->procs.pvkCreateRenderPass2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateRenderPass2)r->procs.pvkCreateRenderPass2)(device, pCreateInfo, pAllocator, pRenderPass);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pRenderPass, sizeof(VkRenderPass));
+	}
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_2
+uint64_t vksCaptured_vkGetDeviceMemoryOpaqueCaptureAddress(vksProcAddr* addrs, VkDevice device, VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo) {
+	vksCaptureStream* s = capture_begin(169);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pInfo, (size_t)(1), sizeof(VkDeviceMemoryOpaqueCaptureAddressInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkDeviceMemoryOpaqueCaptureAddressInfo(s, &pInfo[i]);
+		}
+	}
+	uint64_t ret = ((PFN_vkGetDeviceMemoryOpaqueCaptureAddress)addrs->pvkGetDeviceMemoryOpaqueCaptureAddress)(device, pInfo);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetDeviceMemoryOpaqueCaptureAddress(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo = NULL;
+	{
+		size_t n;
+		VkDeviceMemoryOpaqueCaptureAddressInfo* v = replay_pointer(r, rd, sizeof(VkDeviceMemoryOpaqueCaptureAddressInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDeviceMemoryOpaqueCaptureAddressInfo(r, rd, &v[i]);
+		}
+		pInfo = v;
+	}
+	if (rd->overflow || r->procs.pvkGetDeviceMemoryOpaqueCaptureAddress == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetDeviceMemoryOpaqueCaptureAddress)r->procs.pvkGetDeviceMemoryOpaqueCaptureAddress)(device, pInfo);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_2
+void vksCaptured_vkCmdNextSubpass2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkSubpassBeginInfo* pSubpassBeginInfo, VkSubpassEndInfo* pSubpassEndInfo) {
+	vksCaptureStream* s = capture_begin(170);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	if (capture_pointer(s, pSubpassBeginInfo, (size_t)(1), sizeof(VkSubpassBeginInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkSubpassBeginInfo(s, &pSubpassBeginInfo[i]);
+		}
+	}
+	if (capture_pointer(s, pSubpassEndInfo, (size_t)(1), sizeof(VkSubpassEndInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkSubpassEndInfo(s, &pSubpassEndInfo[i]);
+		}
+	}
+	((PFN_vkCmdNextSubpass2)addrs->pvkCmdNextSubpass2)(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdNextSubpass2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkSubpassBeginInfo* pSubpassBeginInfo = NULL;
+	{
+		size_t n;
+		VkSubpassBeginInfo* v = replay_pointer(r, rd, sizeof(VkSubpassBeginInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSubpassBeginInfo(r, rd, &v[i]);
+		}
+		pSubpassBeginInfo = v;
+	}
+	VkSubpassEndInfo* pSubpassEndInfo = NULL;
+	{
+		size_t n;
+		VkSubpassEndInfo* v = replay_pointer(r, rd, sizeof(VkSubpassEndInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSubpassEndInfo(r, rd, &v[i]);
+		}
+		pSubpassEndInfo = v;
+	}
+	if (rd->overflow || r->procs.pvkCmdNextSubpass2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdNextSubpass2)r->procs.pvkCmdNextSubpass2)(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_2
+void vksCaptured_vkCmdEndRenderPass2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkSubpassEndInfo* pSubpassEndInfo) {
+	vksCaptureStream* s = capture_begin(171);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	if (capture_pointer(s, pSubpassEndInfo, (size_t)(1), sizeof(VkSubpassEndInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkSubpassEndInfo(s, &pSubpassEndInfo[i]);
+		}
+	}
+	((PFN_vkCmdEndRenderPass2)addrs->pvkCmdEndRenderPass2)(commandBuffer, pSubpassEndInfo);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdEndRenderPass2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkSubpassEndInfo* pSubpassEndInfo = NULL;
+	{
+		size_t n;
+		VkSubpassEndInfo* v = replay_pointer(r, rd, sizeof(VkSubpassEndInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSubpassEndInfo(r, rd, &v[i]);
+		}
+		pSubpassEndInfo = v;
+	}
+	if (rd->overflow || r->procs.pvkCmdEndRenderPass2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdEndRenderPass2)r->procs.pvkCmdEndRenderPass2)(commandBuffer, pSubpassEndInfo);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_2
+VkResult vksCaptured_vkSignalSemaphore(vksProcAddr* addrs, VkDevice device, VkSemaphoreSignalInfo* pSignalInfo) {
+	vksCaptureStream* s = capture_begin(172);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pSignalInfo, (size_t)(1), sizeof(VkSemaphoreSignalInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkSemaphoreSignalInfo(s, &pSignalInfo[i]);
+		}
+	}
+	VkResult ret = ((PFN_vkSignalSemaphore)addrs->pvkSignalSemaphore)(device, pSignalInfo);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkSignalSemaphore(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkSemaphoreSignalInfo* pSignalInfo = NULL;
+	{
+		size_t n;
+		VkSemaphoreSignalInfo* v = replay_pointer(r, rd, sizeof(VkSemaphoreSignalInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSemaphoreSignalInfo(r, rd, &v[i]);
+		}
+		pSignalInfo = v;
+	}
+	if (rd->overflow || r->procs.pvkSignalSemaphore == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkSignalSemaphore)r->procs.pvkSignalSemaphore)(device, pSignalInfo);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_2
+VkResult vksCaptured_vkWaitSemaphores(vksProcAddr* addrs, VkDevice device, VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout) {
+	vksCaptureStream* s = capture_begin(173);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pWaitInfo, (size_t)(1), sizeof(VkSemaphoreWaitInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkSemaphoreWaitInfo(s, &pWaitInfo[i]);
+		}
+	}
+	capture_raw(s, &timeout, sizeof(timeout));
+	VkResult ret = ((PFN_vkWaitSemaphores)addrs->pvkWaitSemaphores)(device, pWaitInfo, timeout);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkWaitSemaphores(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkSemaphoreWaitInfo* pWaitInfo = NULL;
+	{
+		size_t n;
+		VkSemaphoreWaitInfo* v = replay_pointer(r, rd, sizeof(VkSemaphoreWaitInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSemaphoreWaitInfo(r, rd, &v[i]);
+		}
+		pWaitInfo = v;
+	}
+	uint64_t timeout;
+	replay_raw(rd, &timeout, sizeof(timeout));
+	if (rd->overflow || r->procs.pvkWaitSemaphores == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkWaitSemaphores)r->procs.pvkWaitSemaphores)(device, pWaitInfo, timeout);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_2
+VkResult vksCaptured_vkGetSemaphoreCounterValue(vksProcAddr* addrs, VkDevice device, VkSemaphore semaphore, uint64_t* pValue) {
+	vksCaptureStream* s = capture_begin(174);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &semaphore, sizeof(semaphore));
+	capture_pointer(s, pValue, (size_t)(1), sizeof(uint64_t));
+	VkResult ret = ((PFN_vkGetSemaphoreCounterValue)addrs->pvkGetSemaphoreCounterValue)(device, semaphore, pValue);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetSemaphoreCounterValue(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkSemaphore semaphore;
+	replay_raw(rd, &semaphore, sizeof(semaphore));
+	semaphore = (VkSemaphore)replay_map(r, (uint64_t)(uintptr_t)semaphore);
+	uint64_t* pValue = NULL;
+	pValue = replay_pointer(r, rd, sizeof(uint64_t), NULL);
+	if (rd->overflow || r->procs.pvkGetSemaphoreCounterValue == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetSemaphoreCounterValue)r->procs.pvkGetSemaphoreCounterValue)(device, semaphore, pValue);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_2
+void vksCaptured_vkResetQueryPool(vksProcAddr* addrs, VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) {
+	vksCaptureStream* s = capture_begin(175);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &queryPool, sizeof(queryPool));
+	capture_raw(s, &firstQuery, sizeof(firstQuery));
+	capture_raw(s, &queryCount, sizeof(queryCount));
+	((PFN_vkResetQueryPool)addrs->pvkResetQueryPool)(device, queryPool, firstQuery, queryCount);
+	capture_end(s);
+}
+
+static VkResult replay_vkResetQueryPool(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkQueryPool queryPool;
+	replay_raw(rd, &queryPool, sizeof(queryPool));
+	queryPool = (VkQueryPool)replay_map(r, (uint64_t)(uintptr_t)queryPool);
+	uint32_t firstQuery;
+	replay_raw(rd, &firstQuery, sizeof(firstQuery));
+	uint32_t queryCount;
+	replay_raw(rd, &queryCount, sizeof(queryCount));
+	if (rd->overflow || r->procs.pvkResetQueryPool == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkResetQueryPool)r->procs.pvkResetQueryPool)(device, queryPool, firstQuery, queryCount);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdWriteTimestamp2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage, VkQueryPool queryPool, uint32_t query) {
+	vksCaptureStream* s = capture_begin(176);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &stage, sizeof(stage));
+	capture_raw(s, &queryPool, sizeof(queryPool));
+	capture_raw(s, &query, sizeof(query));
+	((PFN_vkCmdWriteTimestamp2)addrs->pvkCmdWriteTimestamp2)(commandBuffer, stage, queryPool, query);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdWriteTimestamp2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkPipelineStageFlags2 stage;
+	replay_raw(rd, &stage, sizeof(stage));
+	VkQueryPool queryPool;
+	replay_raw(rd, &queryPool, sizeof(queryPool));
+	queryPool = (VkQueryPool)replay_map(r, (uint64_t)(uintptr_t)queryPool);
+	uint32_t query;
+	replay_raw(rd, &query, sizeof(query));
+	if (rd->overflow || r->procs.pvkCmdWriteTimestamp2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdWriteTimestamp2)r->procs.pvkCmdWriteTimestamp2)(commandBuffer, stage, queryPool, query);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdCopyImage2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkCopyImageInfo2* pCopyImageInfo) {
+	vksCaptureStream* s = capture_begin(177);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	if (capture_pointer(s, pCopyImageInfo, (size_t)(1), sizeof(VkCopyImageInfo2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkCopyImageInfo2(s, &pCopyImageInfo[i]);
+		}
+	}
+	((PFN_vkCmdCopyImage2)addrs->pvkCmdCopyImage2)(commandBuffer, pCopyImageInfo);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdCopyImage2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkCopyImageInfo2* pCopyImageInfo = NULL;
+	{
+		size_t n;
+		VkCopyImageInfo2* v = replay_pointer(r, rd, sizeof(VkCopyImageInfo2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkCopyImageInfo2(r, rd, &v[i]);
+		}
+		pCopyImageInfo = v;
+	}
+	if (rd->overflow || r->procs.pvkCmdCopyImage2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdCopyImage2)r->procs.pvkCmdCopyImage2)(commandBuffer, pCopyImageInfo);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdSetDepthBoundsTestEnable(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBool32 depthBoundsTestEnable) {
+	vksCaptureStream* s = capture_begin(178);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &depthBoundsTestEnable, sizeof(depthBoundsTestEnable));
+	((PFN_vkCmdSetDepthBoundsTestEnable)addrs->pvkCmdSetDepthBoundsTestEnable)(commandBuffer, depthBoundsTestEnable);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetDepthBoundsTestEnable(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkBool32 depthBoundsTestEnable;
+	replay_raw(rd, &depthBoundsTestEnable, sizeof(depthBoundsTestEnable));
+	if (rd->overflow || r->procs.pvkCmdSetDepthBoundsTestEnable == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetDepthBoundsTestEnable)r->procs.pvkCmdSetDepthBoundsTestEnable)(commandBuffer, depthBoundsTestEnable);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdSetStencilOp(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp, VkStencilOp passOp, VkStencilOp depthFailOp, VkCompareOp compareOp) {
+	vksCaptureStream* s = capture_begin(179);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &faceMask, sizeof(faceMask));
+	capture_raw(s, &failOp, sizeof(failOp));
+	capture_raw(s, &passOp, sizeof(passOp));
+	capture_raw(s, &depthFailOp, sizeof(depthFailOp));
+	capture_raw(s, &compareOp, sizeof(compareOp));
+	((PFN_vkCmdSetStencilOp)addrs->pvkCmdSetStencilOp)(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetStencilOp(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkStencilFaceFlags faceMask;
+	replay_raw(rd, &faceMask, sizeof(faceMask));
+	VkStencilOp failOp;
+	replay_raw(rd, &failOp, sizeof(failOp));
+	VkStencilOp passOp;
+	replay_raw(rd, &passOp, sizeof(passOp));
+	VkStencilOp depthFailOp;
+	replay_raw(rd, &depthFailOp, sizeof(depthFailOp));
+	VkCompareOp compareOp;
+	replay_raw(rd, &compareOp, sizeof(compareOp));
+	if (rd->overflow || r->procs.pvkCmdSetStencilOp == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetStencilOp)r->procs.pvkCmdSetStencilOp)(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdSetDepthWriteEnable(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable) {
+	vksCaptureStream* s = capture_begin(180);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &depthWriteEnable, sizeof(depthWriteEnable));
+	((PFN_vkCmdSetDepthWriteEnable)addrs->pvkCmdSetDepthWriteEnable)(commandBuffer, depthWriteEnable);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetDepthWriteEnable(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkBool32 depthWriteEnable;
+	replay_raw(rd, &depthWriteEnable, sizeof(depthWriteEnable));
+	if (rd->overflow || r->procs.pvkCmdSetDepthWriteEnable == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetDepthWriteEnable)r->procs.pvkCmdSetDepthWriteEnable)(commandBuffer, depthWriteEnable);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdSetDepthTestEnable(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) {
+	vksCaptureStream* s = capture_begin(181);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &depthTestEnable, sizeof(depthTestEnable));
+	((PFN_vkCmdSetDepthTestEnable)addrs->pvkCmdSetDepthTestEnable)(commandBuffer, depthTestEnable);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetDepthTestEnable(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkBool32 depthTestEnable;
+	replay_raw(rd, &depthTestEnable, sizeof(depthTestEnable));
+	if (rd->overflow || r->procs.pvkCmdSetDepthTestEnable == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetDepthTestEnable)r->procs.pvkCmdSetDepthTestEnable)(commandBuffer, depthTestEnable);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdBindVertexBuffers2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, VkBuffer* pBuffers, VkDeviceSize* pOffsets, VkDeviceSize* pSizes, VkDeviceSize* pStrides) {
+	vksCaptureStream* s = capture_begin(182);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &firstBinding, sizeof(firstBinding));
+	capture_raw(s, &bindingCount, sizeof(bindingCount));
+	capture_pointer(s, pBuffers, (size_t)(bindingCount), sizeof(VkBuffer));
+	capture_pointer(s, pOffsets, (size_t)(bindingCount), sizeof(VkDeviceSize));
+	capture_pointer(s, pSizes, (size_t)(bindingCount), sizeof(VkDeviceSize));
+	capture_pointer(s, pStrides, (size_t)(bindingCount), sizeof(VkDeviceSize));
+	((PFN_vkCmdBindVertexBuffers2)addrs->pvkCmdBindVertexBuffers2)(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdBindVertexBuffers2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	uint32_t firstBinding;
+	replay_raw(rd, &firstBinding, sizeof(firstBinding));
+	uint32_t bindingCount;
+	replay_raw(rd, &bindingCount, sizeof(bindingCount));
+	VkBuffer* pBuffers = NULL;
+	{
+		size_t n;
+		VkBuffer* v = replay_pointer(r, rd, sizeof(VkBuffer), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkBuffer)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		pBuffers = v;
+	}
+	VkDeviceSize* pOffsets = NULL;
+	pOffsets = replay_pointer(r, rd, sizeof(VkDeviceSize), NULL);
+	VkDeviceSize* pSizes = NULL;
+	pSizes = replay_pointer(r, rd, sizeof(VkDeviceSize), NULL);
+	VkDeviceSize* pStrides = NULL;
+	pStrides = replay_pointer(r, rd, sizeof(VkDeviceSize), NULL);
+	if (rd->overflow || r->procs.pvkCmdBindVertexBuffers2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdBindVertexBuffers2)r->procs.pvkCmdBindVertexBuffers2)(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdSetScissorWithCount(vksProcAddr* addrs, VkCommandBuffer commandBuffer, uint32_t scissorCount, VkRect2D* pScissors) {
+	vksCaptureStream* s = capture_begin(183);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &scissorCount, sizeof(scissorCount));
+	capture_pointer(s, pScissors, (size_t)(scissorCount), sizeof(VkRect2D));
+	((PFN_vkCmdSetScissorWithCount)addrs->pvkCmdSetScissorWithCount)(commandBuffer, scissorCount, pScissors);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetScissorWithCount(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	uint32_t scissorCount;
+	replay_raw(rd, &scissorCount, sizeof(scissorCount));
+	VkRect2D* pScissors = NULL;
+	pScissors = replay_pointer(r, rd, sizeof(VkRect2D), NULL);
+	if (rd->overflow || r->procs.pvkCmdSetScissorWithCount == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetScissorWithCount)r->procs.pvkCmdSetScissorWithCount)(commandBuffer, scissorCount, pScissors);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdSetViewportWithCount(vksProcAddr* addrs, VkCommandBuffer commandBuffer, uint32_t viewportCount, VkViewport* pViewports) {
+	vksCaptureStream* s = capture_begin(184);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &viewportCount, sizeof(viewportCount));
+	capture_pointer(s, pViewports, (size_t)(viewportCount), sizeof(VkViewport));
+	((PFN_vkCmdSetViewportWithCount)addrs->pvkCmdSetViewportWithCount)(commandBuffer, viewportCount, pViewports);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetViewportWithCount(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	uint32_t viewportCount;
+	replay_raw(rd, &viewportCount, sizeof(viewportCount));
+	VkViewport* pViewports = NULL;
+	pViewports = replay_pointer(r, rd, sizeof(VkViewport), NULL);
+	if (rd->overflow || r->procs.pvkCmdSetViewportWithCount == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetViewportWithCount)r->procs.pvkCmdSetViewportWithCount)(commandBuffer, viewportCount, pViewports);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdSetPrimitiveTopology(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkPrimitiveTopology primitiveTopology) {
+	vksCaptureStream* s = capture_begin(185);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &primitiveTopology, sizeof(primitiveTopology));
+	((PFN_vkCmdSetPrimitiveTopology)addrs->pvkCmdSetPrimitiveTopology)(commandBuffer, primitiveTopology);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetPrimitiveTopology(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkPrimitiveTopology primitiveTopology;
+	replay_raw(rd, &primitiveTopology, sizeof(primitiveTopology));
+	if (rd->overflow || r->procs.pvkCmdSetPrimitiveTopology == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetPrimitiveTopology)r->procs.pvkCmdSetPrimitiveTopology)(commandBuffer, primitiveTopology);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdSetFrontFace(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkFrontFace frontFace) {
+	vksCaptureStream* s = capture_begin(186);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &frontFace, sizeof(frontFace));
+	((PFN_vkCmdSetFrontFace)addrs->pvkCmdSetFrontFace)(commandBuffer, frontFace);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetFrontFace(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkFrontFace frontFace;
+	replay_raw(rd, &frontFace, sizeof(frontFace));
+	if (rd->overflow || r->procs.pvkCmdSetFrontFace == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetFrontFace)r->procs.pvkCmdSetFrontFace)(commandBuffer, frontFace);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdSetCullMode(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) {
+	vksCaptureStream* s = capture_begin(187);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &cullMode, sizeof(cullMode));
+	((PFN_vkCmdSetCullMode)addrs->pvkCmdSetCullMode)(commandBuffer, cullMode);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetCullMode(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkCullModeFlags cullMode;
+	replay_raw(rd, &cullMode, sizeof(cullMode));
+	if (rd->overflow || r->procs.pvkCmdSetCullMode == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetCullMode)r->procs.pvkCmdSetCullMode)(commandBuffer, cullMode);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdSetEvent2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkEvent event, VkDependencyInfo* pDependencyInfo) {
+	vksCaptureStream* s = capture_begin(188);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &event, sizeof(event));
+	if (capture_pointer(s, pDependencyInfo, (size_t)(1), sizeof(VkDependencyInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkDependencyInfo(s, &pDependencyInfo[i]);
+		}
+	}
+	((PFN_vkCmdSetEvent2)addrs->pvkCmdSetEvent2)(commandBuffer, event, pDependencyInfo);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetEvent2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkEvent event;
+	replay_raw(rd, &event, sizeof(event));
+	event = (VkEvent)replay_map(r, (uint64_t)(uintptr_t)event);
+	VkDependencyInfo* pDependencyInfo = NULL;
+	{
+		size_t n;
+		VkDependencyInfo* v = replay_pointer(r, rd, sizeof(VkDependencyInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDependencyInfo(r, rd, &v[i]);
+		}
+		pDependencyInfo = v;
+	}
+	if (rd->overflow || r->procs.pvkCmdSetEvent2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetEvent2)r->procs.pvkCmdSetEvent2)(commandBuffer, event, pDependencyInfo);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdEndRendering(vksProcAddr* addrs, VkCommandBuffer commandBuffer) {
+	vksCaptureStream* s = capture_begin(189);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	((PFN_vkCmdEndRendering)addrs->pvkCmdEndRendering)(commandBuffer);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdEndRendering(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	if (rd->overflow || r->procs.pvkCmdEndRendering == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdEndRendering)r->procs.pvkCmdEndRendering)(commandBuffer);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdBeginRendering(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkRenderingInfo* pRenderingInfo) {
+	vksCaptureStream* s = capture_begin(190);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	if (capture_pointer(s, pRenderingInfo, (size_t)(1), sizeof(VkRenderingInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkRenderingInfo(s, &pRenderingInfo[i]);
+		}
+	}
+	((PFN_vkCmdBeginRendering)addrs->pvkCmdBeginRendering)(commandBuffer, pRenderingInfo);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdBeginRendering(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkRenderingInfo* pRenderingInfo = NULL;
+	{
+		size_t n;
+		VkRenderingInfo* v = replay_pointer(r, rd, sizeof(VkRenderingInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkRenderingInfo(r, rd, &v[i]);
+		}
+		pRenderingInfo = v;
+	}
+	if (rd->overflow || r->procs.pvkCmdBeginRendering == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdBeginRendering)r->procs.pvkCmdBeginRendering)(commandBuffer, pRenderingInfo);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdResetEvent2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2 stageMask) {
+	vksCaptureStream* s = capture_begin(191);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &event, sizeof(event));
+	capture_raw(s, &stageMask, sizeof(stageMask));
+	((PFN_vkCmdResetEvent2)addrs->pvkCmdResetEvent2)(commandBuffer, event, stageMask);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdResetEvent2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkEvent event;
+	replay_raw(rd, &event, sizeof(event));
+	event = (VkEvent)replay_map(r, (uint64_t)(uintptr_t)event);
+	VkPipelineStageFlags2 stageMask;
+	replay_raw(rd, &stageMask, sizeof(stageMask));
+	if (rd->overflow || r->procs.pvkCmdResetEvent2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdResetEvent2)r->procs.pvkCmdResetEvent2)(commandBuffer, event, stageMask);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdWaitEvents2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, uint32_t eventCount, VkEvent* pEvents, VkDependencyInfo* pDependencyInfos) {
+	vksCaptureStream* s = capture_begin(192);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &eventCount, sizeof(eventCount));
+	capture_pointer(s, pEvents, (size_t)(eventCount), sizeof(VkEvent));
+	if (capture_pointer(s, pDependencyInfos, (size_t)(eventCount), sizeof(VkDependencyInfo))) {
+		for (size_t i = 0; i < (size_t)(eventCount); i++) {
+			capture_VkDependencyInfo(s, &pDependencyInfos[i]);
+		}
+	}
+	((PFN_vkCmdWaitEvents2)addrs->pvkCmdWaitEvents2)(commandBuffer, eventCount, pEvents, pDependencyInfos);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdWaitEvents2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	uint32_t eventCount;
+	replay_raw(rd, &eventCount, sizeof(eventCount));
+	VkEvent* pEvents = NULL;
+	{
+		size_t n;
+		VkEvent* v = replay_pointer(r, rd, sizeof(VkEvent), &n);
+		for (size_t i = 0; i < n; i++) {
+			v[i] = (VkEvent)replay_map(r, (uint64_t)(uintptr_t)v[i]);
+		}
+		pEvents = v;
+	}
+	VkDependencyInfo* pDependencyInfos = NULL;
+	{
+		size_t n;
+		VkDependencyInfo* v = replay_pointer(r, rd, sizeof(VkDependencyInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDependencyInfo(r, rd, &v[i]);
+		}
+		pDependencyInfos = v;
+	}
+	if (rd->overflow || r->procs.pvkCmdWaitEvents2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdWaitEvents2)r->procs.pvkCmdWaitEvents2)(commandBuffer, eventCount, pEvents, pDependencyInfos);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdPipelineBarrier2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkDependencyInfo* pDependencyInfo) {
+	vksCaptureStream* s = capture_begin(193);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	if (capture_pointer(s, pDependencyInfo, (size_t)(1), sizeof(VkDependencyInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkDependencyInfo(s, &pDependencyInfo[i]);
+		}
+	}
+	((PFN_vkCmdPipelineBarrier2)addrs->pvkCmdPipelineBarrier2)(commandBuffer, pDependencyInfo);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdPipelineBarrier2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkDependencyInfo* pDependencyInfo = NULL;
+	{
+		size_t n;
+		VkDependencyInfo* v = replay_pointer(r, rd, sizeof(VkDependencyInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDependencyInfo(r, rd, &v[i]);
+		}
+		pDependencyInfo = v;
+	}
+	if (rd->overflow || r->procs.pvkCmdPipelineBarrier2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdPipelineBarrier2)r->procs.pvkCmdPipelineBarrier2)(commandBuffer, pDependencyInfo);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdSetDepthCompareOp(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp) {
+	vksCaptureStream* s = capture_begin(194);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &depthCompareOp, sizeof(depthCompareOp));
+	((PFN_vkCmdSetDepthCompareOp)addrs->pvkCmdSetDepthCompareOp)(commandBuffer, depthCompareOp);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetDepthCompareOp(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkCompareOp depthCompareOp;
+	replay_raw(rd, &depthCompareOp, sizeof(depthCompareOp));
+	if (rd->overflow || r->procs.pvkCmdSetDepthCompareOp == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetDepthCompareOp)r->procs.pvkCmdSetDepthCompareOp)(commandBuffer, depthCompareOp);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdSetStencilTestEnable(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable) {
+	vksCaptureStream* s = capture_begin(195);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &stencilTestEnable, sizeof(stencilTestEnable));
+	((PFN_vkCmdSetStencilTestEnable)addrs->pvkCmdSetStencilTestEnable)(commandBuffer, stencilTestEnable);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetStencilTestEnable(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkBool32 stencilTestEnable;
+	replay_raw(rd, &stencilTestEnable, sizeof(stencilTestEnable));
+	if (rd->overflow || r->procs.pvkCmdSetStencilTestEnable == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetStencilTestEnable)r->procs.pvkCmdSetStencilTestEnable)(commandBuffer, stencilTestEnable);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdSetPrimitiveRestartEnable(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBool32 primitiveRestartEnable) {
+	vksCaptureStream* s = capture_begin(196);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &primitiveRestartEnable, sizeof(primitiveRestartEnable));
+	((PFN_vkCmdSetPrimitiveRestartEnable)addrs->pvkCmdSetPrimitiveRestartEnable)(commandBuffer, primitiveRestartEnable);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetPrimitiveRestartEnable(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkBool32 primitiveRestartEnable;
+	replay_raw(rd, &primitiveRestartEnable, sizeof(primitiveRestartEnable));
+	if (rd->overflow || r->procs.pvkCmdSetPrimitiveRestartEnable == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetPrimitiveRestartEnable)r->procs.pvkCmdSetPrimitiveRestartEnable)(commandBuffer, primitiveRestartEnable);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdSetDepthBiasEnable(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable) {
+	vksCaptureStream* s = capture_begin(197);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &depthBiasEnable, sizeof(depthBiasEnable));
+	((PFN_vkCmdSetDepthBiasEnable)addrs->pvkCmdSetDepthBiasEnable)(commandBuffer, depthBiasEnable);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetDepthBiasEnable(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkBool32 depthBiasEnable;
+	replay_raw(rd, &depthBiasEnable, sizeof(depthBiasEnable));
+	if (rd->overflow || r->procs.pvkCmdSetDepthBiasEnable == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetDepthBiasEnable)r->procs.pvkCmdSetDepthBiasEnable)(commandBuffer, depthBiasEnable);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+VkResult vksCaptured_vkQueueSubmit2(vksProcAddr* addrs, VkQueue queue, uint32_t submitCount, VkSubmitInfo2* pSubmits, VkFence fence) {
+	vksCaptureStream* s = capture_begin(198);
+	capture_raw(s, &queue, sizeof(queue));
+	capture_raw(s, &submitCount, sizeof(submitCount));
+	if (capture_pointer(s, pSubmits, (size_t)(submitCount), sizeof(VkSubmitInfo2))) {
+		for (size_t i = 0; i < (size_t)(submitCount); i++) {
+			capture_VkSubmitInfo2(s, &pSubmits[i]);
+		}
+	}
+	capture_raw(s, &fence, sizeof(fence));
+	VkResult ret = ((PFN_vkQueueSubmit2)addrs->pvkQueueSubmit2)(queue, submitCount, pSubmits, fence);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkQueueSubmit2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkQueue queue;
+	replay_raw(rd, &queue, sizeof(queue));
+	queue = (VkQueue)replay_map(r, (uint64_t)(uintptr_t)queue);
+	uint32_t submitCount;
+	replay_raw(rd, &submitCount, sizeof(submitCount));
+	VkSubmitInfo2* pSubmits = NULL;
+	{
+		size_t n;
+		VkSubmitInfo2* v = replay_pointer(r, rd, sizeof(VkSubmitInfo2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSubmitInfo2(r, rd, &v[i]);
+		}
+		pSubmits = v;
+	}
+	VkFence fence;
+	replay_raw(rd, &fence, sizeof(fence));
+	fence = (VkFence)replay_map(r, (uint64_t)(uintptr_t)fence);
+	if (rd->overflow || r->procs.pvkQueueSubmit2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkQueueSubmit2)r->procs.pvkQueueSubmit2)(queue, submitCount, pSubmits, fence);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+VkResult vksCaptured_vkGetPhysicalDeviceToolProperties(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t* pToolCount, VkPhysicalDeviceToolProperties* pToolProperties) {
+	vksCaptureStream* s = capture_begin(199);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_pointer(s, pToolCount, (size_t)(1), sizeof(uint32_t));
+	if (capture_pointer(s, pToolProperties, (size_t)((pToolCount != NULL ? *pToolCount : 0)), sizeof(VkPhysicalDeviceToolProperties))) {
+		for (size_t i = 0; i < (size_t)((pToolCount != NULL ? *pToolCount : 0)); i++) {
+			capture_VkPhysicalDeviceToolProperties(s, &pToolProperties[i]);
+		}
+	}
+	VkResult ret = ((PFN_vkGetPhysicalDeviceToolProperties)addrs->pvkGetPhysicalDeviceToolProperties)(physicalDevice, pToolCount, pToolProperties);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetPhysicalDeviceToolProperties(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	uint32_t* pToolCount = NULL;
+	pToolCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkPhysicalDeviceToolProperties* pToolProperties = NULL;
+	{
+		size_t n;
+		VkPhysicalDeviceToolProperties* v = replay_pointer(r, rd, sizeof(VkPhysicalDeviceToolProperties), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPhysicalDeviceToolProperties(r, rd, &v[i]);
+		}
+		pToolProperties = v;
+	}
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceToolProperties == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetPhysicalDeviceToolProperties)r->procs.pvkGetPhysicalDeviceToolProperties)(physicalDevice, pToolCount, pToolProperties);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdResolveImage2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkResolveImageInfo2* pResolveImageInfo) {
+	vksCaptureStream* s = capture_begin(200);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	if (capture_pointer(s, pResolveImageInfo, (size_t)(1), sizeof(VkResolveImageInfo2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkResolveImageInfo2(s, &pResolveImageInfo[i]);
+		}
+	}
+	((PFN_vkCmdResolveImage2)addrs->pvkCmdResolveImage2)(commandBuffer, pResolveImageInfo);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdResolveImage2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkResolveImageInfo2* pResolveImageInfo = NULL;
+	{
+		size_t n;
+		VkResolveImageInfo2* v = replay_pointer(r, rd, sizeof(VkResolveImageInfo2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkResolveImageInfo2(r, rd, &v[i]);
+		}
+		pResolveImageInfo = v;
+	}
+	if (rd->overflow || r->procs.pvkCmdResolveImage2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdResolveImage2)r->procs.pvkCmdResolveImage2)(commandBuffer, pResolveImageInfo);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkGetDeviceBufferMemoryRequirements(vksProcAddr* addrs, VkDevice device, VkDeviceBufferMemoryRequirements* pInfo, VkMemoryRequirements2* pMemoryRequirements) {
+	vksCaptureStream* s = capture_begin(201);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pInfo, (size_t)(1), sizeof(VkDeviceBufferMemoryRequirements))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkDeviceBufferMemoryRequirements(s, &pInfo[i]);
+		}
+	}
+	if (capture_pointer(s, pMemoryRequirements, (size_t)(1), sizeof(VkMemoryRequirements2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkMemoryRequirements2(s, &pMemoryRequirements[i]);
+		}
+	}
+	((PFN_vkGetDeviceBufferMemoryRequirements)addrs->pvkGetDeviceBufferMemoryRequirements)(device, pInfo, pMemoryRequirements);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetDeviceBufferMemoryRequirements(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkDeviceBufferMemoryRequirements* pInfo = NULL;
+	{
+		size_t n;
+		VkDeviceBufferMemoryRequirements* v = replay_pointer(r, rd, sizeof(VkDeviceBufferMemoryRequirements), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDeviceBufferMemoryRequirements(r, rd, &v[i]);
+		}
+		pInfo = v;
+	}
+	VkMemoryRequirements2* pMemoryRequirements = NULL;
+	{
+		size_t n;
+		VkMemoryRequirements2* v = replay_pointer(r, rd, sizeof(VkMemoryRequirements2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkMemoryRequirements2(r, rd, &v[i]);
+		}
+		pMemoryRequirements = v;
+	}
+	if (rd->overflow || r->procs.pvkGetDeviceBufferMemoryRequirements == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetDeviceBufferMemoryRequirements)r->procs.pvkGetDeviceBufferMemoryRequirements)(device, pInfo, pMemoryRequirements);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkGetDeviceImageMemoryRequirements(vksProcAddr* addrs, VkDevice device, VkDeviceImageMemoryRequirements* pInfo, VkMemoryRequirements2* pMemoryRequirements) {
+	vksCaptureStream* s = capture_begin(202);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pInfo, (size_t)(1), sizeof(VkDeviceImageMemoryRequirements))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkDeviceImageMemoryRequirements(s, &pInfo[i]);
+		}
+	}
+	if (capture_pointer(s, pMemoryRequirements, (size_t)(1), sizeof(VkMemoryRequirements2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkMemoryRequirements2(s, &pMemoryRequirements[i]);
+		}
+	}
+	((PFN_vkGetDeviceImageMemoryRequirements)addrs->pvkGetDeviceImageMemoryRequirements)(device, pInfo, pMemoryRequirements);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetDeviceImageMemoryRequirements(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkDeviceImageMemoryRequirements* pInfo = NULL;
+	{
+		size_t n;
+		VkDeviceImageMemoryRequirements* v = replay_pointer(r, rd, sizeof(VkDeviceImageMemoryRequirements), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDeviceImageMemoryRequirements(r, rd, &v[i]);
+		}
+		pInfo = v;
+	}
+	VkMemoryRequirements2* pMemoryRequirements = NULL;
+	{
+		size_t n;
+		VkMemoryRequirements2* v = replay_pointer(r, rd, sizeof(VkMemoryRequirements2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkMemoryRequirements2(r, rd, &v[i]);
+		}
+		pMemoryRequirements = v;
+	}
+	if (rd->overflow || r->procs.pvkGetDeviceImageMemoryRequirements == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetDeviceImageMemoryRequirements)r->procs.pvkGetDeviceImageMemoryRequirements)(device, pInfo, pMemoryRequirements);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkGetDeviceImageSparseMemoryRequirements(vksProcAddr* addrs, VkDevice device, VkDeviceImageMemoryRequirements* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2* pSparseMemoryRequirements) {
+	vksCaptureStream* s = capture_begin(203);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pInfo, (size_t)(1), sizeof(VkDeviceImageMemoryRequirements))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkDeviceImageMemoryRequirements(s, &pInfo[i]);
+		}
+	}
+	capture_pointer(s, pSparseMemoryRequirementCount, (size_t)(1), sizeof(uint32_t));
+	if (capture_pointer(s, pSparseMemoryRequirements, (size_t)((pSparseMemoryRequirementCount != NULL ? *pSparseMemoryRequirementCount : 0)), sizeof(VkSparseImageMemoryRequirements2))) {
+		for (size_t i = 0; i < (size_t)((pSparseMemoryRequirementCount != NULL ? *pSparseMemoryRequirementCount : 0)); i++) {
+			capture_VkSparseImageMemoryRequirements2(s, &pSparseMemoryRequirements[i]);
+		}
+	}
+	((PFN_vkGetDeviceImageSparseMemoryRequirements)addrs->pvkGetDeviceImageSparseMemoryRequirements)(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetDeviceImageSparseMemoryRequirements(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkDeviceImageMemoryRequirements* pInfo = NULL;
+	{
+		size_t n;
+		VkDeviceImageMemoryRequirements* v = replay_pointer(r, rd, sizeof(VkDeviceImageMemoryRequirements), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDeviceImageMemoryRequirements(r, rd, &v[i]);
+		}
+		pInfo = v;
+	}
+	uint32_t* pSparseMemoryRequirementCount = NULL;
+	pSparseMemoryRequirementCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkSparseImageMemoryRequirements2* pSparseMemoryRequirements = NULL;
+	{
+		size_t n;
+		VkSparseImageMemoryRequirements2* v = replay_pointer(r, rd, sizeof(VkSparseImageMemoryRequirements2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSparseImageMemoryRequirements2(r, rd, &v[i]);
+		}
+		pSparseMemoryRequirements = v;
+	}
+	if (rd->overflow || r->procs.pvkGetDeviceImageSparseMemoryRequirements == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetDeviceImageSparseMemoryRequirements)r->procs.pvkGetDeviceImageSparseMemoryRequirements)(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkGetPrivateData(vksProcAddr* addrs, VkDevice device, VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlot privateDataSlot, uint64_t* pData) {
+	vksCaptureStream* s = capture_begin(204);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &objectType, sizeof(objectType));
+	capture_raw(s, &objectHandle, sizeof(objectHandle));
+	capture_raw(s, &privateDataSlot, sizeof(privateDataSlot));
+	capture_pointer(s, pData, (size_t)(1), sizeof(uint64_t));
+	((PFN_vkGetPrivateData)addrs->pvkGetPrivateData)(device, objectType, objectHandle, privateDataSlot, pData);
+	capture_end(s);
+}
+
+static VkResult replay_vkGetPrivateData(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkObjectType objectType;
+	replay_raw(rd, &objectType, sizeof(objectType));
+	uint64_t objectHandle;
+	replay_raw(rd, &objectHandle, sizeof(objectHandle));
+	VkPrivateDataSlot privateDataSlot;
+	replay_raw(rd, &privateDataSlot, sizeof(privateDataSlot));
+	privateDataSlot = (VkPrivateDataSlot)replay_map(r, (uint64_t)(uintptr_t)privateDataSlot);
+	uint64_t* pData = NULL;
+	pData = replay_pointer(r, rd, sizeof(uint64_t), NULL);
+	if (rd->overflow || r->procs.pvkGetPrivateData == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkGetPrivateData)r->procs.pvkGetPrivateData)(device, objectType, objectHandle, privateDataSlot, pData);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+VkResult vksCaptured_vkSetPrivateData(vksProcAddr* addrs, VkDevice device, VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlot privateDataSlot, uint64_t data) {
+	vksCaptureStream* s = capture_begin(205);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &objectType, sizeof(objectType));
+	capture_raw(s, &objectHandle, sizeof(objectHandle));
+	capture_raw(s, &privateDataSlot, sizeof(privateDataSlot));
+	capture_raw(s, &data, sizeof(data));
+	VkResult ret = ((PFN_vkSetPrivateData)addrs->pvkSetPrivateData)(device, objectType, objectHandle, privateDataSlot, data);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkSetPrivateData(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkObjectType objectType;
+	replay_raw(rd, &objectType, sizeof(objectType));
+	uint64_t objectHandle;
+	replay_raw(rd, &objectHandle, sizeof(objectHandle));
+	VkPrivateDataSlot privateDataSlot;
+	replay_raw(rd, &privateDataSlot, sizeof(privateDataSlot));
+	privateDataSlot = (VkPrivateDataSlot)replay_map(r, (uint64_t)(uintptr_t)privateDataSlot);
+	uint64_t data;
+	replay_raw(rd, &data, sizeof(data));
+	if (rd->overflow || r->procs.pvkSetPrivateData == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkSetPrivateData)r->procs.pvkSetPrivateData)(device, objectType, objectHandle, privateDataSlot, data);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkDestroyPrivateDataSlot(vksProcAddr* addrs, VkDevice device, VkPrivateDataSlot privateDataSlot, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(206);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &privateDataSlot, sizeof(privateDataSlot));
+	((PFN_vkDestroyPrivateDataSlot)addrs->pvkDestroyPrivateDataSlot)(device, privateDataSlot, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroyPrivateDataSlot(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkPrivateDataSlot privateDataSlot;
+	replay_raw(rd, &privateDataSlot, sizeof(privateDataSlot));
+	privateDataSlot = (VkPrivateDataSlot)replay_map(r, (uint64_t)(uintptr_t)privateDataSlot);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroyPrivateDataSlot == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroyPrivateDataSlot)r->procs.pvkDestroyPrivateDataSlot)(device, privateDataSlot, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+VkResult vksCaptured_vkCreatePrivateDataSlot(vksProcAddr* addrs, VkDevice device, VkPrivateDataSlotCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkPrivateDataSlot* pPrivateDataSlot) {
+	vksCaptureStream* s = capture_begin(207);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkPrivateDataSlotCreateInfo))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPrivateDataSlotCreateInfo(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pPrivateDataSlot, (size_t)(1));
+	VkResult ret = ((PFN_vkCreatePrivateDataSlot)addrs->pvkCreatePrivateDataSlot)(device, pCreateInfo, pAllocator, pPrivateDataSlot);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pPrivateDataSlot : NULL, (size_t)(1), sizeof(VkPrivateDataSlot));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreatePrivateDataSlot(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkPrivateDataSlotCreateInfo* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkPrivateDataSlotCreateInfo* v = replay_pointer(r, rd, sizeof(VkPrivateDataSlotCreateInfo), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPrivateDataSlotCreateInfo(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkPrivateDataSlot* pPrivateDataSlot = replay_output(r, rd, sizeof(VkPrivateDataSlot));
+	if (rd->overflow || r->procs.pvkCreatePrivateDataSlot == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreatePrivateDataSlot)r->procs.pvkCreatePrivateDataSlot)(device, pCreateInfo, pAllocator, pPrivateDataSlot);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pPrivateDataSlot, sizeof(VkPrivateDataSlot));
+	}
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdBlitImage2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBlitImageInfo2* pBlitImageInfo) {
+	vksCaptureStream* s = capture_begin(208);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	if (capture_pointer(s, pBlitImageInfo, (size_t)(1), sizeof(VkBlitImageInfo2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkBlitImageInfo2(s, &pBlitImageInfo[i]);
+		}
+	}
+	((PFN_vkCmdBlitImage2)addrs->pvkCmdBlitImage2)(commandBuffer, pBlitImageInfo);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdBlitImage2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkBlitImageInfo2* pBlitImageInfo = NULL;
+	{
+		size_t n;
+		VkBlitImageInfo2* v = replay_pointer(r, rd, sizeof(VkBlitImageInfo2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkBlitImageInfo2(r, rd, &v[i]);
+		}
+		pBlitImageInfo = v;
+	}
+	if (rd->overflow || r->procs.pvkCmdBlitImage2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdBlitImage2)r->procs.pvkCmdBlitImage2)(commandBuffer, pBlitImageInfo);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdCopyImageToBuffer2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkCopyImageToBufferInfo2* pCopyImageToBufferInfo) {
+	vksCaptureStream* s = capture_begin(209);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	if (capture_pointer(s, pCopyImageToBufferInfo, (size_t)(1), sizeof(VkCopyImageToBufferInfo2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkCopyImageToBufferInfo2(s, &pCopyImageToBufferInfo[i]);
+		}
+	}
+	((PFN_vkCmdCopyImageToBuffer2)addrs->pvkCmdCopyImageToBuffer2)(commandBuffer, pCopyImageToBufferInfo);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdCopyImageToBuffer2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkCopyImageToBufferInfo2* pCopyImageToBufferInfo = NULL;
+	{
+		size_t n;
+		VkCopyImageToBufferInfo2* v = replay_pointer(r, rd, sizeof(VkCopyImageToBufferInfo2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkCopyImageToBufferInfo2(r, rd, &v[i]);
+		}
+		pCopyImageToBufferInfo = v;
+	}
+	if (rd->overflow || r->procs.pvkCmdCopyImageToBuffer2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdCopyImageToBuffer2)r->procs.pvkCmdCopyImageToBuffer2)(commandBuffer, pCopyImageToBufferInfo);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdCopyBufferToImage2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkCopyBufferToImageInfo2* pCopyBufferToImageInfo) {
+	vksCaptureStream* s = capture_begin(210);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	if (capture_pointer(s, pCopyBufferToImageInfo, (size_t)(1), sizeof(VkCopyBufferToImageInfo2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkCopyBufferToImageInfo2(s, &pCopyBufferToImageInfo[i]);
+		}
+	}
+	((PFN_vkCmdCopyBufferToImage2)addrs->pvkCmdCopyBufferToImage2)(commandBuffer, pCopyBufferToImageInfo);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdCopyBufferToImage2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkCopyBufferToImageInfo2* pCopyBufferToImageInfo = NULL;
+	{
+		size_t n;
+		VkCopyBufferToImageInfo2* v = replay_pointer(r, rd, sizeof(VkCopyBufferToImageInfo2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkCopyBufferToImageInfo2(r, rd, &v[i]);
+		}
+		pCopyBufferToImageInfo = v;
+	}
+	if (rd->overflow || r->procs.pvkCmdCopyBufferToImage2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdCopyBufferToImage2)r->procs.pvkCmdCopyBufferToImage2)(commandBuffer, pCopyBufferToImageInfo);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdSetRasterizerDiscardEnable(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable) {
+	vksCaptureStream* s = capture_begin(211);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	capture_raw(s, &rasterizerDiscardEnable, sizeof(rasterizerDiscardEnable));
+	((PFN_vkCmdSetRasterizerDiscardEnable)addrs->pvkCmdSetRasterizerDiscardEnable)(commandBuffer, rasterizerDiscardEnable);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdSetRasterizerDiscardEnable(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkBool32 rasterizerDiscardEnable;
+	replay_raw(rd, &rasterizerDiscardEnable, sizeof(rasterizerDiscardEnable));
+	if (rd->overflow || r->procs.pvkCmdSetRasterizerDiscardEnable == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdSetRasterizerDiscardEnable)r->procs.pvkCmdSetRasterizerDiscardEnable)(commandBuffer, rasterizerDiscardEnable);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_VERSION_1_3
+void vksCaptured_vkCmdCopyBuffer2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkCopyBufferInfo2* pCopyBufferInfo) {
+	vksCaptureStream* s = capture_begin(212);
+	capture_raw(s, &commandBuffer, sizeof(commandBuffer));
+	if (capture_pointer(s, pCopyBufferInfo, (size_t)(1), sizeof(VkCopyBufferInfo2))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkCopyBufferInfo2(s, &pCopyBufferInfo[i]);
+		}
+	}
+	((PFN_vkCmdCopyBuffer2)addrs->pvkCmdCopyBuffer2)(commandBuffer, pCopyBufferInfo);
+	capture_end(s);
+}
+
+static VkResult replay_vkCmdCopyBuffer2(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkCommandBuffer commandBuffer;
+	replay_raw(rd, &commandBuffer, sizeof(commandBuffer));
+	commandBuffer = (VkCommandBuffer)replay_map(r, (uint64_t)(uintptr_t)commandBuffer);
+	VkCopyBufferInfo2* pCopyBufferInfo = NULL;
+	{
+		size_t n;
+		VkCopyBufferInfo2* v = replay_pointer(r, rd, sizeof(VkCopyBufferInfo2), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkCopyBufferInfo2(r, rd, &v[i]);
+		}
+		pCopyBufferInfo = v;
+	}
+	if (rd->overflow || r->procs.pvkCmdCopyBuffer2 == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkCmdCopyBuffer2)r->procs.pvkCmdCopyBuffer2)(commandBuffer, pCopyBufferInfo);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_EXT_DEBUG_REPORT
+VkResult vksCaptured_vkCreateDebugReportCallbackEXT(vksProcAddr* addrs, VkInstance instance, VkDebugReportCallbackCreateInfoEXT* pCreateInfo, VkAllocationCallbacks* pAllocator, VkDebugReportCallbackEXT* pCallback) {
+	vksCaptureStream* s = capture_begin(213);
+	capture_raw(s, &instance, sizeof(instance));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkDebugReportCallbackCreateInfoEXT))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkDebugReportCallbackCreateInfoEXT(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pCallback, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateDebugReportCallbackEXT)addrs->pvkCreateDebugReportCallbackEXT)(instance, pCreateInfo, pAllocator, pCallback);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pCallback : NULL, (size_t)(1), sizeof(VkDebugReportCallbackEXT));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateDebugReportCallbackEXT(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkInstance instance;
+	replay_raw(rd, &instance, sizeof(instance));
+	instance = (VkInstance)replay_map(r, (uint64_t)(uintptr_t)instance);
+	VkDebugReportCallbackCreateInfoEXT* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkDebugReportCallbackCreateInfoEXT* v = replay_pointer(r, rd, sizeof(VkDebugReportCallbackCreateInfoEXT), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDebugReportCallbackCreateInfoEXT(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkDebugReportCallbackEXT* pCallback = replay_output(r, rd, sizeof(VkDebugReportCallbackEXT));
+	if (rd->overflow || r->procs.pvkCreateDebugReportCallbackEXT == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateDebugReportCallbackEXT)r->procs.pvkCreateDebugReportCallbackEXT)(instance, pCreateInfo, pAllocator, pCallback);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pCallback, sizeof(VkDebugReportCallbackEXT));
+	}
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_EXT_DEBUG_REPORT
+void vksCaptured_vkDebugReportMessageEXT(vksProcAddr* addrs, VkInstance instance, VkDebugReportFlagsEXT flags, VkDebugReportObjectTypeEXT objectType, uint64_t object, size_t location, int32_t messageCode, char* pLayerPrefix, char* pMessage) {
+	vksCaptureStream* s = capture_begin(214);
+	capture_raw(s, &instance, sizeof(instance));
+	capture_raw(s, &flags, sizeof(flags));
+	capture_raw(s, &objectType, sizeof(objectType));
+	capture_raw(s, &object, sizeof(object));
+	capture_raw(s, &location, sizeof(location));
+	capture_raw(s, &messageCode, sizeof(messageCode));
+	capture_string(s, pLayerPrefix);
+	capture_string(s, pMessage);
+	((PFN_vkDebugReportMessageEXT)addrs->pvkDebugReportMessageEXT)(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
+	capture_end(s);
+}
+
+static VkResult replay_vkDebugReportMessageEXT(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkInstance instance;
+	replay_raw(rd, &instance, sizeof(instance));
+	instance = (VkInstance)replay_map(r, (uint64_t)(uintptr_t)instance);
+	VkDebugReportFlagsEXT flags;
+	replay_raw(rd, &flags, sizeof(flags));
+	VkDebugReportObjectTypeEXT objectType;
+	replay_raw(rd, &objectType, sizeof(objectType));
+	uint64_t object;
+	replay_raw(rd, &object, sizeof(object));
+	size_t location;
+	replay_raw(rd, &location, sizeof(location));
+	int32_t messageCode;
+	replay_raw(rd, &messageCode, sizeof(messageCode));
+	char* pLayerPrefix = NULL;
+	pLayerPrefix = replay_string(r, rd);
+	char* pMessage = NULL;
+	pMessage = replay_string(r, rd);
+	if (rd->overflow || r->procs.pvkDebugReportMessageEXT == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDebugReportMessageEXT)r->procs.pvkDebugReportMessageEXT)(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_EXT_DEBUG_REPORT
+void vksCaptured_vkDestroyDebugReportCallbackEXT(vksProcAddr* addrs, VkInstance instance, VkDebugReportCallbackEXT callback, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(215);
+	capture_raw(s, &instance, sizeof(instance));
+	capture_raw(s, &callback, sizeof(callback));
+	((PFN_vkDestroyDebugReportCallbackEXT)addrs->pvkDestroyDebugReportCallbackEXT)(instance, callback, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroyDebugReportCallbackEXT(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkInstance instance;
+	replay_raw(rd, &instance, sizeof(instance));
+	instance = (VkInstance)replay_map(r, (uint64_t)(uintptr_t)instance);
+	VkDebugReportCallbackEXT callback;
+	replay_raw(rd, &callback, sizeof(callback));
+	callback = (VkDebugReportCallbackEXT)replay_map(r, (uint64_t)(uintptr_t)callback);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroyDebugReportCallbackEXT == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroyDebugReportCallbackEXT)r->procs.pvkDestroyDebugReportCallbackEXT)(instance, callback, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_SURFACE
+VkResult vksCaptured_vkGetPhysicalDeviceSurfacePresentModesKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pPresentModeCount, VkPresentModeKHR* pPresentModes) {
+	vksCaptureStream* s = capture_begin(216);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_raw(s, &surface, sizeof(surface));
+	capture_pointer(s, pPresentModeCount, (size_t)(1), sizeof(uint32_t));
+	capture_pointer(s, pPresentModes, (size_t)((pPresentModeCount != NULL ? *pPresentModeCount : 0)), sizeof(VkPresentModeKHR));
+	VkResult ret = ((PFN_vkGetPhysicalDeviceSurfacePresentModesKHR)addrs->pvkGetPhysicalDeviceSurfacePresentModesKHR)(physicalDevice, surface, pPresentModeCount, pPresentModes);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetPhysicalDeviceSurfacePresentModesKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkSurfaceKHR surface;
+	replay_raw(rd, &surface, sizeof(surface));
+	surface = (VkSurfaceKHR)replay_map(r, (uint64_t)(uintptr_t)surface);
+	uint32_t* pPresentModeCount = NULL;
+	pPresentModeCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkPresentModeKHR* pPresentModes = NULL;
+	pPresentModes = replay_pointer(r, rd, sizeof(VkPresentModeKHR), NULL);
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceSurfacePresentModesKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetPhysicalDeviceSurfacePresentModesKHR)r->procs.pvkGetPhysicalDeviceSurfacePresentModesKHR)(physicalDevice, surface, pPresentModeCount, pPresentModes);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_SURFACE
+VkResult vksCaptured_vkGetPhysicalDeviceSurfaceFormatsKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pSurfaceFormatCount, VkSurfaceFormatKHR* pSurfaceFormats) {
+	vksCaptureStream* s = capture_begin(217);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_raw(s, &surface, sizeof(surface));
+	capture_pointer(s, pSurfaceFormatCount, (size_t)(1), sizeof(uint32_t));
+	capture_pointer(s, pSurfaceFormats, (size_t)((pSurfaceFormatCount != NULL ? *pSurfaceFormatCount : 0)), sizeof(VkSurfaceFormatKHR));
+	VkResult ret = ((PFN_vkGetPhysicalDeviceSurfaceFormatsKHR)addrs->pvkGetPhysicalDeviceSurfaceFormatsKHR)(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetPhysicalDeviceSurfaceFormatsKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkSurfaceKHR surface;
+	replay_raw(rd, &surface, sizeof(surface));
+	surface = (VkSurfaceKHR)replay_map(r, (uint64_t)(uintptr_t)surface);
+	uint32_t* pSurfaceFormatCount = NULL;
+	pSurfaceFormatCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkSurfaceFormatKHR* pSurfaceFormats = NULL;
+	pSurfaceFormats = replay_pointer(r, rd, sizeof(VkSurfaceFormatKHR), NULL);
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceSurfaceFormatsKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetPhysicalDeviceSurfaceFormatsKHR)r->procs.pvkGetPhysicalDeviceSurfaceFormatsKHR)(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_SURFACE
+VkResult vksCaptured_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR* pSurfaceCapabilities) {
+	vksCaptureStream* s = capture_begin(218);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_raw(s, &surface, sizeof(surface));
+	capture_pointer(s, pSurfaceCapabilities, (size_t)(1), sizeof(VkSurfaceCapabilitiesKHR));
+	VkResult ret = ((PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR)addrs->pvkGetPhysicalDeviceSurfaceCapabilitiesKHR)(physicalDevice, surface, pSurfaceCapabilities);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkSurfaceKHR surface;
+	replay_raw(rd, &surface, sizeof(surface));
+	surface = (VkSurfaceKHR)replay_map(r, (uint64_t)(uintptr_t)surface);
+	VkSurfaceCapabilitiesKHR* pSurfaceCapabilities = NULL;
+	pSurfaceCapabilities = replay_pointer(r, rd, sizeof(VkSurfaceCapabilitiesKHR), NULL);
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceSurfaceCapabilitiesKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR)r->procs.pvkGetPhysicalDeviceSurfaceCapabilitiesKHR)(physicalDevice, surface, pSurfaceCapabilities);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_SURFACE
+VkResult vksCaptured_vkGetPhysicalDeviceSurfaceSupportKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, VkSurfaceKHR surface, VkBool32* pSupported) {
+	vksCaptureStream* s = capture_begin(219);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_raw(s, &queueFamilyIndex, sizeof(queueFamilyIndex));
+	capture_raw(s, &surface, sizeof(surface));
+	capture_pointer(s, pSupported, (size_t)(1), sizeof(VkBool32));
+	VkResult ret = ((PFN_vkGetPhysicalDeviceSurfaceSupportKHR)addrs->pvkGetPhysicalDeviceSurfaceSupportKHR)(physicalDevice, queueFamilyIndex, surface, pSupported);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetPhysicalDeviceSurfaceSupportKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	uint32_t queueFamilyIndex;
+	replay_raw(rd, &queueFamilyIndex, sizeof(queueFamilyIndex));
+	VkSurfaceKHR surface;
+	replay_raw(rd, &surface, sizeof(surface));
+	surface = (VkSurfaceKHR)replay_map(r, (uint64_t)(uintptr_t)surface);
+	VkBool32* pSupported = NULL;
+	pSupported = replay_pointer(r, rd, sizeof(VkBool32), NULL);
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceSurfaceSupportKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetPhysicalDeviceSurfaceSupportKHR)r->procs.pvkGetPhysicalDeviceSurfaceSupportKHR)(physicalDevice, queueFamilyIndex, surface, pSupported);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_SURFACE
+void vksCaptured_vkDestroySurfaceKHR(vksProcAddr* addrs, VkInstance instance, VkSurfaceKHR surface, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(220);
+	capture_raw(s, &instance, sizeof(instance));
+	capture_raw(s, &surface, sizeof(surface));
+	((PFN_vkDestroySurfaceKHR)addrs->pvkDestroySurfaceKHR)(instance, surface, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroySurfaceKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkInstance instance;
+	replay_raw(rd, &instance, sizeof(instance));
+	instance = (VkInstance)replay_map(r, (uint64_t)(uintptr_t)instance);
+	VkSurfaceKHR surface;
+	replay_raw(rd, &surface, sizeof(surface));
+	surface = (VkSurfaceKHR)replay_map(r, (uint64_t)(uintptr_t)surface);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroySurfaceKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroySurfaceKHR)r->procs.pvkDestroySurfaceKHR)(instance, surface, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_GET_SURFACE_CAPABILITIES2
+VkResult vksCaptured_vkGetPhysicalDeviceSurfaceCapabilities2KHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, VkSurfaceCapabilities2KHR* pSurfaceCapabilities) {
+	vksCaptureStream* s = capture_begin(221);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	if (capture_pointer(s, pSurfaceInfo, (size_t)(1), sizeof(VkPhysicalDeviceSurfaceInfo2KHR))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPhysicalDeviceSurfaceInfo2KHR(s, &pSurfaceInfo[i]);
+		}
+	}
+	if (capture_pointer(s, pSurfaceCapabilities, (size_t)(1), sizeof(VkSurfaceCapabilities2KHR))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkSurfaceCapabilities2KHR(s, &pSurfaceCapabilities[i]);
+		}
+	}
+	VkResult ret = ((PFN_vkGetPhysicalDeviceSurfaceCapabilities2KHR)addrs->pvkGetPhysicalDeviceSurfaceCapabilities2KHR)(physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetPhysicalDeviceSurfaceCapabilities2KHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo = NULL;
+	{
+		size_t n;
+		VkPhysicalDeviceSurfaceInfo2KHR* v = replay_pointer(r, rd, sizeof(VkPhysicalDeviceSurfaceInfo2KHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPhysicalDeviceSurfaceInfo2KHR(r, rd, &v[i]);
+		}
+		pSurfaceInfo = v;
+	}
+	VkSurfaceCapabilities2KHR* pSurfaceCapabilities = NULL;
+	{
+		size_t n;
+		VkSurfaceCapabilities2KHR* v = replay_pointer(r, rd, sizeof(VkSurfaceCapabilities2KHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSurfaceCapabilities2KHR(r, rd, &v[i]);
+		}
+		pSurfaceCapabilities = v;
+	}
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceSurfaceCapabilities2KHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetPhysicalDeviceSurfaceCapabilities2KHR)r->procs.pvkGetPhysicalDeviceSurfaceCapabilities2KHR)(physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_GET_SURFACE_CAPABILITIES2
+VkResult vksCaptured_vkGetPhysicalDeviceSurfaceFormats2KHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, uint32_t* pSurfaceFormatCount, VkSurfaceFormat2KHR* pSurfaceFormats) {
+	vksCaptureStream* s = capture_begin(222);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	if (capture_pointer(s, pSurfaceInfo, (size_t)(1), sizeof(VkPhysicalDeviceSurfaceInfo2KHR))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPhysicalDeviceSurfaceInfo2KHR(s, &pSurfaceInfo[i]);
+		}
+	}
+	capture_pointer(s, pSurfaceFormatCount, (size_t)(1), sizeof(uint32_t));
+	if (capture_pointer(s, pSurfaceFormats, (size_t)((pSurfaceFormatCount != NULL ? *pSurfaceFormatCount : 0)), sizeof(VkSurfaceFormat2KHR))) {
+		for (size_t i = 0; i < (size_t)((pSurfaceFormatCount != NULL ? *pSurfaceFormatCount : 0)); i++) {
+			capture_VkSurfaceFormat2KHR(s, &pSurfaceFormats[i]);
+		}
+	}
+	VkResult ret = ((PFN_vkGetPhysicalDeviceSurfaceFormats2KHR)addrs->pvkGetPhysicalDeviceSurfaceFormats2KHR)(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetPhysicalDeviceSurfaceFormats2KHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo = NULL;
+	{
+		size_t n;
+		VkPhysicalDeviceSurfaceInfo2KHR* v = replay_pointer(r, rd, sizeof(VkPhysicalDeviceSurfaceInfo2KHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPhysicalDeviceSurfaceInfo2KHR(r, rd, &v[i]);
+		}
+		pSurfaceInfo = v;
+	}
+	uint32_t* pSurfaceFormatCount = NULL;
+	pSurfaceFormatCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkSurfaceFormat2KHR* pSurfaceFormats = NULL;
+	{
+		size_t n;
+		VkSurfaceFormat2KHR* v = replay_pointer(r, rd, sizeof(VkSurfaceFormat2KHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSurfaceFormat2KHR(r, rd, &v[i]);
+		}
+		pSurfaceFormats = v;
+	}
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceSurfaceFormats2KHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetPhysicalDeviceSurfaceFormats2KHR)r->procs.pvkGetPhysicalDeviceSurfaceFormats2KHR)(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_SWAPCHAIN
+VkResult vksCaptured_vkCreateSwapchainKHR(vksProcAddr* addrs, VkDevice device, VkSwapchainCreateInfoKHR* pCreateInfo, VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain) {
+	vksCaptureStream* s = capture_begin(223);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkSwapchainCreateInfoKHR))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkSwapchainCreateInfoKHR(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pSwapchain, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateSwapchainKHR)addrs->pvkCreateSwapchainKHR)(device, pCreateInfo, pAllocator, pSwapchain);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pSwapchain : NULL, (size_t)(1), sizeof(VkSwapchainKHR));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateSwapchainKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkSwapchainCreateInfoKHR* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkSwapchainCreateInfoKHR* v = replay_pointer(r, rd, sizeof(VkSwapchainCreateInfoKHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSwapchainCreateInfoKHR(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkSwapchainKHR* pSwapchain = replay_output(r, rd, sizeof(VkSwapchainKHR));
+	if (rd->overflow || r->procs.pvkCreateSwapchainKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateSwapchainKHR)r->procs.pvkCreateSwapchainKHR)(device, pCreateInfo, pAllocator, pSwapchain);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pSwapchain, sizeof(VkSwapchainKHR));
+	}
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_SWAPCHAIN
+VkResult vksCaptured_vkAcquireNextImageKHR(vksProcAddr* addrs, VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex) {
+	vksCaptureStream* s = capture_begin(224);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &swapchain, sizeof(swapchain));
+	capture_raw(s, &timeout, sizeof(timeout));
+	capture_raw(s, &semaphore, sizeof(semaphore));
+	capture_raw(s, &fence, sizeof(fence));
+	capture_pointer(s, pImageIndex, (size_t)(1), sizeof(uint32_t));
+	VkResult ret = ((PFN_vkAcquireNextImageKHR)addrs->pvkAcquireNextImageKHR)(device, swapchain, timeout, semaphore, fence, pImageIndex);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkAcquireNextImageKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkSwapchainKHR swapchain;
+	replay_raw(rd, &swapchain, sizeof(swapchain));
+	swapchain = (VkSwapchainKHR)replay_map(r, (uint64_t)(uintptr_t)swapchain);
+	uint64_t timeout;
+	replay_raw(rd, &timeout, sizeof(timeout));
+	VkSemaphore semaphore;
+	replay_raw(rd, &semaphore, sizeof(semaphore));
+	semaphore = (VkSemaphore)replay_map(r, (uint64_t)(uintptr_t)semaphore);
+	VkFence fence;
+	replay_raw(rd, &fence, sizeof(fence));
+	fence = (VkFence)replay_map(r, (uint64_t)(uintptr_t)fence);
+	uint32_t* pImageIndex = NULL;
+	pImageIndex = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	if (rd->overflow || r->procs.pvkAcquireNextImageKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkAcquireNextImageKHR)r->procs.pvkAcquireNextImageKHR)(device, swapchain, timeout, semaphore, fence, pImageIndex);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_SWAPCHAIN
+VkResult vksCaptured_vkQueuePresentKHR(vksProcAddr* addrs, VkQueue queue, VkPresentInfoKHR* pPresentInfo) {
+	vksCaptureStream* s = capture_begin(225);
+	capture_raw(s, &queue, sizeof(queue));
+	if (capture_pointer(s, pPresentInfo, (size_t)(1), sizeof(VkPresentInfoKHR))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkPresentInfoKHR(s, &pPresentInfo[i]);
+		}
+	}
+	VkResult ret = ((PFN_vkQueuePresentKHR)addrs->pvkQueuePresentKHR)(queue, pPresentInfo);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkQueuePresentKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkQueue queue;
+	replay_raw(rd, &queue, sizeof(queue));
+	queue = (VkQueue)replay_map(r, (uint64_t)(uintptr_t)queue);
+	VkPresentInfoKHR* pPresentInfo = NULL;
+	{
+		size_t n;
+		VkPresentInfoKHR* v = replay_pointer(r, rd, sizeof(VkPresentInfoKHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkPresentInfoKHR(r, rd, &v[i]);
+		}
+		pPresentInfo = v;
+	}
+	if (rd->overflow || r->procs.pvkQueuePresentKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkQueuePresentKHR)r->procs.pvkQueuePresentKHR)(queue, pPresentInfo);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_SWAPCHAIN
+VkResult vksCaptured_vkAcquireNextImage2KHR(vksProcAddr* addrs, VkDevice device, VkAcquireNextImageInfoKHR* pAcquireInfo, uint32_t* pImageIndex) {
+	vksCaptureStream* s = capture_begin(226);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pAcquireInfo, (size_t)(1), sizeof(VkAcquireNextImageInfoKHR))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkAcquireNextImageInfoKHR(s, &pAcquireInfo[i]);
+		}
+	}
+	capture_pointer(s, pImageIndex, (size_t)(1), sizeof(uint32_t));
+	VkResult ret = ((PFN_vkAcquireNextImage2KHR)addrs->pvkAcquireNextImage2KHR)(device, pAcquireInfo, pImageIndex);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkAcquireNextImage2KHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkAcquireNextImageInfoKHR* pAcquireInfo = NULL;
+	{
+		size_t n;
+		VkAcquireNextImageInfoKHR* v = replay_pointer(r, rd, sizeof(VkAcquireNextImageInfoKHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkAcquireNextImageInfoKHR(r, rd, &v[i]);
+		}
+		pAcquireInfo = v;
+	}
+	uint32_t* pImageIndex = NULL;
+	pImageIndex = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	if (rd->overflow || r->procs.pvkAcquireNextImage2KHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkAcquireNextImage2KHR)r->procs.pvkAcquireNextImage2KHR)(device, pAcquireInfo, pImageIndex);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_SWAPCHAIN
+VkResult vksCaptured_vkGetPhysicalDevicePresentRectanglesKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pRectCount, VkRect2D* pRects) {
+	vksCaptureStream* s = capture_begin(227);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_raw(s, &surface, sizeof(surface));
+	capture_pointer(s, pRectCount, (size_t)(1), sizeof(uint32_t));
+	capture_pointer(s, pRects, (size_t)((pRectCount != NULL ? *pRectCount : 0)), sizeof(VkRect2D));
+	VkResult ret = ((PFN_vkGetPhysicalDevicePresentRectanglesKHR)addrs->pvkGetPhysicalDevicePresentRectanglesKHR)(physicalDevice, surface, pRectCount, pRects);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetPhysicalDevicePresentRectanglesKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkSurfaceKHR surface;
+	replay_raw(rd, &surface, sizeof(surface));
+	surface = (VkSurfaceKHR)replay_map(r, (uint64_t)(uintptr_t)surface);
+	uint32_t* pRectCount = NULL;
+	pRectCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkRect2D* pRects = NULL;
+	pRects = replay_pointer(r, rd, sizeof(VkRect2D), NULL);
+	if (rd->overflow || r->procs.pvkGetPhysicalDevicePresentRectanglesKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetPhysicalDevicePresentRectanglesKHR)r->procs.pvkGetPhysicalDevicePresentRectanglesKHR)(physicalDevice, surface, pRectCount, pRects);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_SWAPCHAIN
+VkResult vksCaptured_vkGetSwapchainImagesKHR(vksProcAddr* addrs, VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages) {
+	vksCaptureStream* s = capture_begin(228);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &swapchain, sizeof(swapchain));
+	capture_pointer(s, pSwapchainImageCount, (size_t)(1), sizeof(uint32_t));
+	capture_output(s, pSwapchainImages, (size_t)((pSwapchainImageCount != NULL ? *pSwapchainImageCount : 0)));
+	VkResult ret = ((PFN_vkGetSwapchainImagesKHR)addrs->pvkGetSwapchainImagesKHR)(device, swapchain, pSwapchainImageCount, pSwapchainImages);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pSwapchainImages : NULL, (size_t)((pSwapchainImageCount != NULL ? *pSwapchainImageCount : 0)), sizeof(VkImage));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetSwapchainImagesKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkSwapchainKHR swapchain;
+	replay_raw(rd, &swapchain, sizeof(swapchain));
+	swapchain = (VkSwapchainKHR)replay_map(r, (uint64_t)(uintptr_t)swapchain);
+	uint32_t* pSwapchainImageCount = NULL;
+	pSwapchainImageCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkImage* pSwapchainImages = replay_output(r, rd, sizeof(VkImage));
+	if (rd->overflow || r->procs.pvkGetSwapchainImagesKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetSwapchainImagesKHR)r->procs.pvkGetSwapchainImagesKHR)(device, swapchain, pSwapchainImageCount, pSwapchainImages);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pSwapchainImages, sizeof(VkImage));
+	}
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_SWAPCHAIN
+VkResult vksCaptured_vkGetDeviceGroupSurfacePresentModesKHR(vksProcAddr* addrs, VkDevice device, VkSurfaceKHR surface, VkDeviceGroupPresentModeFlagsKHR* pModes) {
+	vksCaptureStream* s = capture_begin(229);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &surface, sizeof(surface));
+	capture_pointer(s, pModes, (size_t)(1), sizeof(VkDeviceGroupPresentModeFlagsKHR));
+	VkResult ret = ((PFN_vkGetDeviceGroupSurfacePresentModesKHR)addrs->pvkGetDeviceGroupSurfacePresentModesKHR)(device, surface, pModes);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetDeviceGroupSurfacePresentModesKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkSurfaceKHR surface;
+	replay_raw(rd, &surface, sizeof(surface));
+	surface = (VkSurfaceKHR)replay_map(r, (uint64_t)(uintptr_t)surface);
+	VkDeviceGroupPresentModeFlagsKHR* pModes = NULL;
+	pModes = replay_pointer(r, rd, sizeof(VkDeviceGroupPresentModeFlagsKHR), NULL);
+	if (rd->overflow || r->procs.pvkGetDeviceGroupSurfacePresentModesKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetDeviceGroupSurfacePresentModesKHR)r->procs.pvkGetDeviceGroupSurfacePresentModesKHR)(device, surface, pModes);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_SWAPCHAIN
+void vksCaptured_vkDestroySwapchainKHR(vksProcAddr* addrs, VkDevice device, VkSwapchainKHR swapchain, VkAllocationCallbacks* pAllocator) {
+	vksCaptureStream* s = capture_begin(230);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &swapchain, sizeof(swapchain));
+	((PFN_vkDestroySwapchainKHR)addrs->pvkDestroySwapchainKHR)(device, swapchain, pAllocator);
+	capture_end(s);
+}
+
+static VkResult replay_vkDestroySwapchainKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkSwapchainKHR swapchain;
+	replay_raw(rd, &swapchain, sizeof(swapchain));
+	swapchain = (VkSwapchainKHR)replay_map(r, (uint64_t)(uintptr_t)swapchain);
+	VkAllocationCallbacks* pAllocator = NULL;
+	if (rd->overflow || r->procs.pvkDestroySwapchainKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	((PFN_vkDestroySwapchainKHR)r->procs.pvkDestroySwapchainKHR)(device, swapchain, pAllocator);
+	*ns = replay_now() - start;
+	return VK_SUCCESS;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_SWAPCHAIN
+VkResult vksCaptured_vkGetDeviceGroupPresentCapabilitiesKHR(vksProcAddr* addrs, VkDevice device, VkDeviceGroupPresentCapabilitiesKHR* pDeviceGroupPresentCapabilities) {
+	vksCaptureStream* s = capture_begin(231);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pDeviceGroupPresentCapabilities, (size_t)(1), sizeof(VkDeviceGroupPresentCapabilitiesKHR))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkDeviceGroupPresentCapabilitiesKHR(s, &pDeviceGroupPresentCapabilities[i]);
+		}
+	}
+	VkResult ret = ((PFN_vkGetDeviceGroupPresentCapabilitiesKHR)addrs->pvkGetDeviceGroupPresentCapabilitiesKHR)(device, pDeviceGroupPresentCapabilities);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetDeviceGroupPresentCapabilitiesKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkDeviceGroupPresentCapabilitiesKHR* pDeviceGroupPresentCapabilities = NULL;
+	{
+		size_t n;
+		VkDeviceGroupPresentCapabilitiesKHR* v = replay_pointer(r, rd, sizeof(VkDeviceGroupPresentCapabilitiesKHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDeviceGroupPresentCapabilitiesKHR(r, rd, &v[i]);
+		}
+		pDeviceGroupPresentCapabilities = v;
+	}
+	if (rd->overflow || r->procs.pvkGetDeviceGroupPresentCapabilitiesKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetDeviceGroupPresentCapabilitiesKHR)r->procs.pvkGetDeviceGroupPresentCapabilitiesKHR)(device, pDeviceGroupPresentCapabilities);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_DISPLAY
+VkResult vksCaptured_vkGetPhysicalDeviceDisplayPropertiesKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPropertiesKHR* pProperties) {
+	vksCaptureStream* s = capture_begin(232);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_pointer(s, pPropertyCount, (size_t)(1), sizeof(uint32_t));
+	if (capture_pointer(s, pProperties, (size_t)((pPropertyCount != NULL ? *pPropertyCount : 0)), sizeof(VkDisplayPropertiesKHR))) {
+		for (size_t i = 0; i < (size_t)((pPropertyCount != NULL ? *pPropertyCount : 0)); i++) {
+			capture_VkDisplayPropertiesKHR(s, &pProperties[i]);
+		}
+	}
+	VkResult ret = ((PFN_vkGetPhysicalDeviceDisplayPropertiesKHR)addrs->pvkGetPhysicalDeviceDisplayPropertiesKHR)(physicalDevice, pPropertyCount, pProperties);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetPhysicalDeviceDisplayPropertiesKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	uint32_t* pPropertyCount = NULL;
+	pPropertyCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkDisplayPropertiesKHR* pProperties = NULL;
+	{
+		size_t n;
+		VkDisplayPropertiesKHR* v = replay_pointer(r, rd, sizeof(VkDisplayPropertiesKHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDisplayPropertiesKHR(r, rd, &v[i]);
+		}
+		pProperties = v;
+	}
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceDisplayPropertiesKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetPhysicalDeviceDisplayPropertiesKHR)r->procs.pvkGetPhysicalDeviceDisplayPropertiesKHR)(physicalDevice, pPropertyCount, pProperties);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_DISPLAY
+VkResult vksCaptured_vkGetDisplayPlaneCapabilitiesKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkDisplayModeKHR mode, uint32_t planeIndex, VkDisplayPlaneCapabilitiesKHR* pCapabilities) {
+	vksCaptureStream* s = capture_begin(233);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_raw(s, &mode, sizeof(mode));
+	capture_raw(s, &planeIndex, sizeof(planeIndex));
+	capture_pointer(s, pCapabilities, (size_t)(1), sizeof(VkDisplayPlaneCapabilitiesKHR));
+	VkResult ret = ((PFN_vkGetDisplayPlaneCapabilitiesKHR)addrs->pvkGetDisplayPlaneCapabilitiesKHR)(physicalDevice, mode, planeIndex, pCapabilities);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetDisplayPlaneCapabilitiesKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkDisplayModeKHR mode;
+	replay_raw(rd, &mode, sizeof(mode));
+	mode = (VkDisplayModeKHR)replay_map(r, (uint64_t)(uintptr_t)mode);
+	uint32_t planeIndex;
+	replay_raw(rd, &planeIndex, sizeof(planeIndex));
+	VkDisplayPlaneCapabilitiesKHR* pCapabilities = NULL;
+	pCapabilities = replay_pointer(r, rd, sizeof(VkDisplayPlaneCapabilitiesKHR), NULL);
+	if (rd->overflow || r->procs.pvkGetDisplayPlaneCapabilitiesKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetDisplayPlaneCapabilitiesKHR)r->procs.pvkGetDisplayPlaneCapabilitiesKHR)(physicalDevice, mode, planeIndex, pCapabilities);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_DISPLAY
+VkResult vksCaptured_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPlanePropertiesKHR* pProperties) {
+	vksCaptureStream* s = capture_begin(234);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_pointer(s, pPropertyCount, (size_t)(1), sizeof(uint32_t));
+	if (capture_pointer(s, pProperties, (size_t)((pPropertyCount != NULL ? *pPropertyCount : 0)), sizeof(VkDisplayPlanePropertiesKHR))) {
+		for (size_t i = 0; i < (size_t)((pPropertyCount != NULL ? *pPropertyCount : 0)); i++) {
+			capture_VkDisplayPlanePropertiesKHR(s, &pProperties[i]);
+		}
+	}
+	VkResult ret = ((PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR)addrs->pvkGetPhysicalDeviceDisplayPlanePropertiesKHR)(physicalDevice, pPropertyCount, pProperties);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	uint32_t* pPropertyCount = NULL;
+	pPropertyCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkDisplayPlanePropertiesKHR* pProperties = NULL;
+	{
+		size_t n;
+		VkDisplayPlanePropertiesKHR* v = replay_pointer(r, rd, sizeof(VkDisplayPlanePropertiesKHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDisplayPlanePropertiesKHR(r, rd, &v[i]);
+		}
+		pProperties = v;
+	}
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceDisplayPlanePropertiesKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR)r->procs.pvkGetPhysicalDeviceDisplayPlanePropertiesKHR)(physicalDevice, pPropertyCount, pProperties);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_DISPLAY
+VkResult vksCaptured_vkCreateDisplayModeKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkDisplayKHR display, VkDisplayModeCreateInfoKHR* pCreateInfo, VkAllocationCallbacks* pAllocator, VkDisplayModeKHR* pMode) {
+	vksCaptureStream* s = capture_begin(235);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_raw(s, &display, sizeof(display));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkDisplayModeCreateInfoKHR))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkDisplayModeCreateInfoKHR(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pMode, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateDisplayModeKHR)addrs->pvkCreateDisplayModeKHR)(physicalDevice, display, pCreateInfo, pAllocator, pMode);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pMode : NULL, (size_t)(1), sizeof(VkDisplayModeKHR));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateDisplayModeKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkDisplayKHR display;
+	replay_raw(rd, &display, sizeof(display));
+	display = (VkDisplayKHR)replay_map(r, (uint64_t)(uintptr_t)display);
+	VkDisplayModeCreateInfoKHR* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkDisplayModeCreateInfoKHR* v = replay_pointer(r, rd, sizeof(VkDisplayModeCreateInfoKHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDisplayModeCreateInfoKHR(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkDisplayModeKHR* pMode = replay_output(r, rd, sizeof(VkDisplayModeKHR));
+	if (rd->overflow || r->procs.pvkCreateDisplayModeKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateDisplayModeKHR)r->procs.pvkCreateDisplayModeKHR)(physicalDevice, display, pCreateInfo, pAllocator, pMode);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pMode, sizeof(VkDisplayModeKHR));
+	}
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_DISPLAY
+VkResult vksCaptured_vkGetDisplayModePropertiesKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t* pPropertyCount, VkDisplayModePropertiesKHR* pProperties) {
+	vksCaptureStream* s = capture_begin(236);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_raw(s, &display, sizeof(display));
+	capture_pointer(s, pPropertyCount, (size_t)(1), sizeof(uint32_t));
+	if (capture_pointer(s, pProperties, (size_t)((pPropertyCount != NULL ? *pPropertyCount : 0)), sizeof(VkDisplayModePropertiesKHR))) {
+		for (size_t i = 0; i < (size_t)((pPropertyCount != NULL ? *pPropertyCount : 0)); i++) {
+			capture_VkDisplayModePropertiesKHR(s, &pProperties[i]);
+		}
+	}
+	VkResult ret = ((PFN_vkGetDisplayModePropertiesKHR)addrs->pvkGetDisplayModePropertiesKHR)(physicalDevice, display, pPropertyCount, pProperties);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetDisplayModePropertiesKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkDisplayKHR display;
+	replay_raw(rd, &display, sizeof(display));
+	display = (VkDisplayKHR)replay_map(r, (uint64_t)(uintptr_t)display);
+	uint32_t* pPropertyCount = NULL;
+	pPropertyCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkDisplayModePropertiesKHR* pProperties = NULL;
+	{
+		size_t n;
+		VkDisplayModePropertiesKHR* v = replay_pointer(r, rd, sizeof(VkDisplayModePropertiesKHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDisplayModePropertiesKHR(r, rd, &v[i]);
+		}
+		pProperties = v;
+	}
+	if (rd->overflow || r->procs.pvkGetDisplayModePropertiesKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetDisplayModePropertiesKHR)r->procs.pvkGetDisplayModePropertiesKHR)(physicalDevice, display, pPropertyCount, pProperties);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_DISPLAY
+VkResult vksCaptured_vkCreateDisplayPlaneSurfaceKHR(vksProcAddr* addrs, VkInstance instance, VkDisplaySurfaceCreateInfoKHR* pCreateInfo, VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) {
+	vksCaptureStream* s = capture_begin(237);
+	capture_raw(s, &instance, sizeof(instance));
+	if (capture_pointer(s, pCreateInfo, (size_t)(1), sizeof(VkDisplaySurfaceCreateInfoKHR))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkDisplaySurfaceCreateInfoKHR(s, &pCreateInfo[i]);
+		}
+	}
+	capture_output(s, pSurface, (size_t)(1));
+	VkResult ret = ((PFN_vkCreateDisplayPlaneSurfaceKHR)addrs->pvkCreateDisplayPlaneSurfaceKHR)(instance, pCreateInfo, pAllocator, pSurface);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pSurface : NULL, (size_t)(1), sizeof(VkSurfaceKHR));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateDisplayPlaneSurfaceKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkInstance instance;
+	replay_raw(rd, &instance, sizeof(instance));
+	instance = (VkInstance)replay_map(r, (uint64_t)(uintptr_t)instance);
+	VkDisplaySurfaceCreateInfoKHR* pCreateInfo = NULL;
+	{
+		size_t n;
+		VkDisplaySurfaceCreateInfoKHR* v = replay_pointer(r, rd, sizeof(VkDisplaySurfaceCreateInfoKHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDisplaySurfaceCreateInfoKHR(r, rd, &v[i]);
+		}
+		pCreateInfo = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkSurfaceKHR* pSurface = replay_output(r, rd, sizeof(VkSurfaceKHR));
+	if (rd->overflow || r->procs.pvkCreateDisplayPlaneSurfaceKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateDisplayPlaneSurfaceKHR)r->procs.pvkCreateDisplayPlaneSurfaceKHR)(instance, pCreateInfo, pAllocator, pSurface);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pSurface, sizeof(VkSurfaceKHR));
+	}
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_DISPLAY
+VkResult vksCaptured_vkGetDisplayPlaneSupportedDisplaysKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t planeIndex, uint32_t* pDisplayCount, VkDisplayKHR* pDisplays) {
+	vksCaptureStream* s = capture_begin(238);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_raw(s, &planeIndex, sizeof(planeIndex));
+	capture_pointer(s, pDisplayCount, (size_t)(1), sizeof(uint32_t));
+	capture_output(s, pDisplays, (size_t)((pDisplayCount != NULL ? *pDisplayCount : 0)));
+	VkResult ret = ((PFN_vkGetDisplayPlaneSupportedDisplaysKHR)addrs->pvkGetDisplayPlaneSupportedDisplaysKHR)(physicalDevice, planeIndex, pDisplayCount, pDisplays);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pDisplays : NULL, (size_t)((pDisplayCount != NULL ? *pDisplayCount : 0)), sizeof(VkDisplayKHR));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetDisplayPlaneSupportedDisplaysKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	uint32_t planeIndex;
+	replay_raw(rd, &planeIndex, sizeof(planeIndex));
+	uint32_t* pDisplayCount = NULL;
+	pDisplayCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkDisplayKHR* pDisplays = replay_output(r, rd, sizeof(VkDisplayKHR));
+	if (rd->overflow || r->procs.pvkGetDisplayPlaneSupportedDisplaysKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetDisplayPlaneSupportedDisplaysKHR)r->procs.pvkGetDisplayPlaneSupportedDisplaysKHR)(physicalDevice, planeIndex, pDisplayCount, pDisplays);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pDisplays, sizeof(VkDisplayKHR));
+	}
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_GET_DISPLAY_PROPERTIES2
+VkResult vksCaptured_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPlaneProperties2KHR* pProperties) {
+	vksCaptureStream* s = capture_begin(239);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_pointer(s, pPropertyCount, (size_t)(1), sizeof(uint32_t));
+	if (capture_pointer(s, pProperties, (size_t)((pPropertyCount != NULL ? *pPropertyCount : 0)), sizeof(VkDisplayPlaneProperties2KHR))) {
+		for (size_t i = 0; i < (size_t)((pPropertyCount != NULL ? *pPropertyCount : 0)); i++) {
+			capture_VkDisplayPlaneProperties2KHR(s, &pProperties[i]);
+		}
+	}
+	VkResult ret = ((PFN_vkGetPhysicalDeviceDisplayPlaneProperties2KHR)addrs->pvkGetPhysicalDeviceDisplayPlaneProperties2KHR)(physicalDevice, pPropertyCount, pProperties);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	uint32_t* pPropertyCount = NULL;
+	pPropertyCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkDisplayPlaneProperties2KHR* pProperties = NULL;
+	{
+		size_t n;
+		VkDisplayPlaneProperties2KHR* v = replay_pointer(r, rd, sizeof(VkDisplayPlaneProperties2KHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDisplayPlaneProperties2KHR(r, rd, &v[i]);
+		}
+		pProperties = v;
+	}
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceDisplayPlaneProperties2KHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetPhysicalDeviceDisplayPlaneProperties2KHR)r->procs.pvkGetPhysicalDeviceDisplayPlaneProperties2KHR)(physicalDevice, pPropertyCount, pProperties);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_GET_DISPLAY_PROPERTIES2
+VkResult vksCaptured_vkGetPhysicalDeviceDisplayProperties2KHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayProperties2KHR* pProperties) {
+	vksCaptureStream* s = capture_begin(240);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_pointer(s, pPropertyCount, (size_t)(1), sizeof(uint32_t));
+	if (capture_pointer(s, pProperties, (size_t)((pPropertyCount != NULL ? *pPropertyCount : 0)), sizeof(VkDisplayProperties2KHR))) {
+		for (size_t i = 0; i < (size_t)((pPropertyCount != NULL ? *pPropertyCount : 0)); i++) {
+			capture_VkDisplayProperties2KHR(s, &pProperties[i]);
+		}
+	}
+	VkResult ret = ((PFN_vkGetPhysicalDeviceDisplayProperties2KHR)addrs->pvkGetPhysicalDeviceDisplayProperties2KHR)(physicalDevice, pPropertyCount, pProperties);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetPhysicalDeviceDisplayProperties2KHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	uint32_t* pPropertyCount = NULL;
+	pPropertyCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkDisplayProperties2KHR* pProperties = NULL;
+	{
+		size_t n;
+		VkDisplayProperties2KHR* v = replay_pointer(r, rd, sizeof(VkDisplayProperties2KHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDisplayProperties2KHR(r, rd, &v[i]);
+		}
+		pProperties = v;
+	}
+	if (rd->overflow || r->procs.pvkGetPhysicalDeviceDisplayProperties2KHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetPhysicalDeviceDisplayProperties2KHR)r->procs.pvkGetPhysicalDeviceDisplayProperties2KHR)(physicalDevice, pPropertyCount, pProperties);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_GET_DISPLAY_PROPERTIES2
+VkResult vksCaptured_vkGetDisplayPlaneCapabilities2KHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkDisplayPlaneInfo2KHR* pDisplayPlaneInfo, VkDisplayPlaneCapabilities2KHR* pCapabilities) {
+	vksCaptureStream* s = capture_begin(241);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	if (capture_pointer(s, pDisplayPlaneInfo, (size_t)(1), sizeof(VkDisplayPlaneInfo2KHR))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkDisplayPlaneInfo2KHR(s, &pDisplayPlaneInfo[i]);
+		}
+	}
+	if (capture_pointer(s, pCapabilities, (size_t)(1), sizeof(VkDisplayPlaneCapabilities2KHR))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkDisplayPlaneCapabilities2KHR(s, &pCapabilities[i]);
+		}
+	}
+	VkResult ret = ((PFN_vkGetDisplayPlaneCapabilities2KHR)addrs->pvkGetDisplayPlaneCapabilities2KHR)(physicalDevice, pDisplayPlaneInfo, pCapabilities);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetDisplayPlaneCapabilities2KHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkDisplayPlaneInfo2KHR* pDisplayPlaneInfo = NULL;
+	{
+		size_t n;
+		VkDisplayPlaneInfo2KHR* v = replay_pointer(r, rd, sizeof(VkDisplayPlaneInfo2KHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDisplayPlaneInfo2KHR(r, rd, &v[i]);
+		}
+		pDisplayPlaneInfo = v;
+	}
+	VkDisplayPlaneCapabilities2KHR* pCapabilities = NULL;
+	{
+		size_t n;
+		VkDisplayPlaneCapabilities2KHR* v = replay_pointer(r, rd, sizeof(VkDisplayPlaneCapabilities2KHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDisplayPlaneCapabilities2KHR(r, rd, &v[i]);
+		}
+		pCapabilities = v;
+	}
+	if (rd->overflow || r->procs.pvkGetDisplayPlaneCapabilities2KHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetDisplayPlaneCapabilities2KHR)r->procs.pvkGetDisplayPlaneCapabilities2KHR)(physicalDevice, pDisplayPlaneInfo, pCapabilities);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_GET_DISPLAY_PROPERTIES2
+VkResult vksCaptured_vkGetDisplayModeProperties2KHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t* pPropertyCount, VkDisplayModeProperties2KHR* pProperties) {
+	vksCaptureStream* s = capture_begin(242);
+	capture_raw(s, &physicalDevice, sizeof(physicalDevice));
+	capture_raw(s, &display, sizeof(display));
+	capture_pointer(s, pPropertyCount, (size_t)(1), sizeof(uint32_t));
+	if (capture_pointer(s, pProperties, (size_t)((pPropertyCount != NULL ? *pPropertyCount : 0)), sizeof(VkDisplayModeProperties2KHR))) {
+		for (size_t i = 0; i < (size_t)((pPropertyCount != NULL ? *pPropertyCount : 0)); i++) {
+			capture_VkDisplayModeProperties2KHR(s, &pProperties[i]);
+		}
+	}
+	VkResult ret = ((PFN_vkGetDisplayModeProperties2KHR)addrs->pvkGetDisplayModeProperties2KHR)(physicalDevice, display, pPropertyCount, pProperties);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetDisplayModeProperties2KHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkPhysicalDevice physicalDevice;
+	replay_raw(rd, &physicalDevice, sizeof(physicalDevice));
+	physicalDevice = (VkPhysicalDevice)replay_map(r, (uint64_t)(uintptr_t)physicalDevice);
+	VkDisplayKHR display;
+	replay_raw(rd, &display, sizeof(display));
+	display = (VkDisplayKHR)replay_map(r, (uint64_t)(uintptr_t)display);
+	uint32_t* pPropertyCount = NULL;
+	pPropertyCount = replay_pointer(r, rd, sizeof(uint32_t), NULL);
+	VkDisplayModeProperties2KHR* pProperties = NULL;
+	{
+		size_t n;
+		VkDisplayModeProperties2KHR* v = replay_pointer(r, rd, sizeof(VkDisplayModeProperties2KHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkDisplayModeProperties2KHR(r, rd, &v[i]);
+		}
+		pProperties = v;
+	}
+	if (rd->overflow || r->procs.pvkGetDisplayModeProperties2KHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetDisplayModeProperties2KHR)r->procs.pvkGetDisplayModeProperties2KHR)(physicalDevice, display, pPropertyCount, pProperties);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_DISPLAY_SWAPCHAIN
+VkResult vksCaptured_vkCreateSharedSwapchainsKHR(vksProcAddr* addrs, VkDevice device, uint32_t swapchainCount, VkSwapchainCreateInfoKHR* pCreateInfos, VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains) {
+	vksCaptureStream* s = capture_begin(243);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &swapchainCount, sizeof(swapchainCount));
+	if (capture_pointer(s, pCreateInfos, (size_t)(swapchainCount), sizeof(VkSwapchainCreateInfoKHR))) {
+		for (size_t i = 0; i < (size_t)(swapchainCount); i++) {
+			capture_VkSwapchainCreateInfoKHR(s, &pCreateInfos[i]);
+		}
+	}
+	capture_output(s, pSwapchains, (size_t)(swapchainCount));
+	VkResult ret = ((PFN_vkCreateSharedSwapchainsKHR)addrs->pvkCreateSharedSwapchainsKHR)(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
+	int ok = ret >= 0;
+	capture_pointer(s, ok ? pSwapchains : NULL, (size_t)(swapchainCount), sizeof(VkSwapchainKHR));
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkCreateSharedSwapchainsKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	uint32_t swapchainCount;
+	replay_raw(rd, &swapchainCount, sizeof(swapchainCount));
+	VkSwapchainCreateInfoKHR* pCreateInfos = NULL;
+	{
+		size_t n;
+		VkSwapchainCreateInfoKHR* v = replay_pointer(r, rd, sizeof(VkSwapchainCreateInfoKHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSwapchainCreateInfoKHR(r, rd, &v[i]);
+		}
+		pCreateInfos = v;
+	}
+	VkAllocationCallbacks* pAllocator = NULL;
+	VkSwapchainKHR* pSwapchains = replay_output(r, rd, sizeof(VkSwapchainKHR));
+	if (rd->overflow || r->procs.pvkCreateSharedSwapchainsKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkCreateSharedSwapchainsKHR)r->procs.pvkCreateSharedSwapchainsKHR)(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
+	*ns = replay_now() - start;
+	if (ret >= 0) {
+		replay_remap(r, rd, pSwapchains, sizeof(VkSwapchainKHR));
+	}
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_EXTERNAL_MEMORY_FD
+VkResult vksCaptured_vkGetMemoryFdKHR(vksProcAddr* addrs, VkDevice device, VkMemoryGetFdInfoKHR* pGetFdInfo, int* pFd) {
+	vksCaptureStream* s = capture_begin(244);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pGetFdInfo, (size_t)(1), sizeof(VkMemoryGetFdInfoKHR))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkMemoryGetFdInfoKHR(s, &pGetFdInfo[i]);
+		}
+	}
+	capture_pointer(s, pFd, (size_t)(1), sizeof(int));
+	VkResult ret = ((PFN_vkGetMemoryFdKHR)addrs->pvkGetMemoryFdKHR)(device, pGetFdInfo, pFd);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetMemoryFdKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkMemoryGetFdInfoKHR* pGetFdInfo = NULL;
+	{
+		size_t n;
+		VkMemoryGetFdInfoKHR* v = replay_pointer(r, rd, sizeof(VkMemoryGetFdInfoKHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkMemoryGetFdInfoKHR(r, rd, &v[i]);
+		}
+		pGetFdInfo = v;
+	}
+	int* pFd = NULL;
+	pFd = replay_pointer(r, rd, sizeof(int), NULL);
+	if (rd->overflow || r->procs.pvkGetMemoryFdKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetMemoryFdKHR)r->procs.pvkGetMemoryFdKHR)(device, pGetFdInfo, pFd);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_EXTERNAL_MEMORY_FD
+VkResult vksCaptured_vkGetMemoryFdPropertiesKHR(vksProcAddr* addrs, VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, int fd, VkMemoryFdPropertiesKHR* pMemoryFdProperties) {
+	vksCaptureStream* s = capture_begin(245);
+	capture_raw(s, &device, sizeof(device));
+	capture_raw(s, &handleType, sizeof(handleType));
+	capture_raw(s, &fd, sizeof(fd));
+	if (capture_pointer(s, pMemoryFdProperties, (size_t)(1), sizeof(VkMemoryFdPropertiesKHR))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkMemoryFdPropertiesKHR(s, &pMemoryFdProperties[i]);
+		}
+	}
+	VkResult ret = ((PFN_vkGetMemoryFdPropertiesKHR)addrs->pvkGetMemoryFdPropertiesKHR)(device, handleType, fd, pMemoryFdProperties);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetMemoryFdPropertiesKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkExternalMemoryHandleTypeFlagBits handleType;
+	replay_raw(rd, &handleType, sizeof(handleType));
+	int fd;
+	replay_raw(rd, &fd, sizeof(fd));
+	VkMemoryFdPropertiesKHR* pMemoryFdProperties = NULL;
+	{
+		size_t n;
+		VkMemoryFdPropertiesKHR* v = replay_pointer(r, rd, sizeof(VkMemoryFdPropertiesKHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkMemoryFdPropertiesKHR(r, rd, &v[i]);
+		}
+		pMemoryFdProperties = v;
+	}
+	if (rd->overflow || r->procs.pvkGetMemoryFdPropertiesKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetMemoryFdPropertiesKHR)r->procs.pvkGetMemoryFdPropertiesKHR)(device, handleType, fd, pMemoryFdProperties);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_EXTERNAL_SEMAPHORE_FD
+VkResult vksCaptured_vkImportSemaphoreFdKHR(vksProcAddr* addrs, VkDevice device, VkImportSemaphoreFdInfoKHR* pImportSemaphoreFdInfo) {
+	vksCaptureStream* s = capture_begin(246);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pImportSemaphoreFdInfo, (size_t)(1), sizeof(VkImportSemaphoreFdInfoKHR))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkImportSemaphoreFdInfoKHR(s, &pImportSemaphoreFdInfo[i]);
+		}
+	}
+	VkResult ret = ((PFN_vkImportSemaphoreFdKHR)addrs->pvkImportSemaphoreFdKHR)(device, pImportSemaphoreFdInfo);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkImportSemaphoreFdKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkImportSemaphoreFdInfoKHR* pImportSemaphoreFdInfo = NULL;
+	{
+		size_t n;
+		VkImportSemaphoreFdInfoKHR* v = replay_pointer(r, rd, sizeof(VkImportSemaphoreFdInfoKHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkImportSemaphoreFdInfoKHR(r, rd, &v[i]);
+		}
+		pImportSemaphoreFdInfo = v;
+	}
+	if (rd->overflow || r->procs.pvkImportSemaphoreFdKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkImportSemaphoreFdKHR)r->procs.pvkImportSemaphoreFdKHR)(device, pImportSemaphoreFdInfo);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+#ifdef VKS_ENABLE_KHR_EXTERNAL_SEMAPHORE_FD
+VkResult vksCaptured_vkGetSemaphoreFdKHR(vksProcAddr* addrs, VkDevice device, VkSemaphoreGetFdInfoKHR* pGetFdInfo, int* pFd) {
+	vksCaptureStream* s = capture_begin(247);
+	capture_raw(s, &device, sizeof(device));
+	if (capture_pointer(s, pGetFdInfo, (size_t)(1), sizeof(VkSemaphoreGetFdInfoKHR))) {
+		for (size_t i = 0; i < (size_t)(1); i++) {
+			capture_VkSemaphoreGetFdInfoKHR(s, &pGetFdInfo[i]);
+		}
+	}
+	capture_pointer(s, pFd, (size_t)(1), sizeof(int));
+	VkResult ret = ((PFN_vkGetSemaphoreFdKHR)addrs->pvkGetSemaphoreFdKHR)(device, pGetFdInfo, pFd);
+	capture_end(s);
+	return ret;
+}
+
+static VkResult replay_vkGetSemaphoreFdKHR(vksReplay* r, vksReader* rd, uint64_t* ns) {
+	VkDevice device;
+	replay_raw(rd, &device, sizeof(device));
+	device = (VkDevice)replay_map(r, (uint64_t)(uintptr_t)device);
+	VkSemaphoreGetFdInfoKHR* pGetFdInfo = NULL;
+	{
+		size_t n;
+		VkSemaphoreGetFdInfoKHR* v = replay_pointer(r, rd, sizeof(VkSemaphoreGetFdInfoKHR), &n);
+		for (size_t i = 0; i < n; i++) {
+			replay_VkSemaphoreGetFdInfoKHR(r, rd, &v[i]);
+		}
+		pGetFdInfo = v;
+	}
+	int* pFd = NULL;
+	pFd = replay_pointer(r, rd, sizeof(int), NULL);
+	if (rd->overflow || r->procs.pvkGetSemaphoreFdKHR == NULL) {
+		rd->overflow = 1;
+		return VK_ERROR_UNKNOWN;
+	}
+	uint64_t start = replay_now();
+	VkResult ret = ((PFN_vkGetSemaphoreFdKHR)r->procs.pvkGetSemaphoreFdKHR)(device, pGetFdInfo, pFd);
+	*ns = replay_now() - start;
+	return ret;
+}
+#endif
+
+// Replays one record. Returns zero when the command is unknown, cannot be
+// replayed or the payload is malformed.
+int vksReplayRecord(vksReplay* r, uint32_t command, const void* data, size_t len, VkResult* result, uint64_t* ns) {
+	vksReader rd = { data, (const uint8_t*)data + len, 0 };
+	replay_reset(r);
+	*ns = 0;
+	switch (command) {
+	case 0:
+		*result = replay_vkGetImageMemoryRequirements(r, &rd, ns);
+		break;
+	case 1:
+		*result = replay_vkUnmapMemory(r, &rd, ns);
+		break;
+	case 2:
+		*result = replay_vkResetDescriptorPool(r, &rd, ns);
+		break;
+	case 3:
+		*result = replay_vkAllocateDescriptorSets(r, &rd, ns);
+		break;
+	case 4:
+		*result = replay_vkFreeDescriptorSets(r, &rd, ns);
+		break;
+	case 5:
+		*result = replay_vkUpdateDescriptorSets(r, &rd, ns);
+		break;
+	case 6:
+		*result = replay_vkFreeMemory(r, &rd, ns);
+		break;
+	case 7:
+		*result = replay_vkDestroyQueryPool(r, &rd, ns);
+		break;
+	case 8:
+		*result = replay_vkMapMemory(r, &rd, ns);
+		break;
+	case 9:
+		*result = replay_vkResetFences(r, &rd, ns);
+		break;
+	case 10:
+		*result = replay_vkFlushMappedMemoryRanges(r, &rd, ns);
+		break;
+	case 11:
+		*result = replay_vkInvalidateMappedMemoryRanges(r, &rd, ns);
+		break;
+	case 12:
+		*result = replay_vkGetDeviceMemoryCommitment(r, &rd, ns);
+		break;
+	case 13:
+		*result = replay_vkBindBufferMemory(r, &rd, ns);
+		break;
+	case 14:
+		*result = replay_vkBindImageMemory(r, &rd, ns);
+		break;
+	case 15:
+		*result = replay_vkEnumerateInstanceLayerProperties(r, &rd, ns);
+		break;
+	case 16:
+		*result = replay_vkGetBufferMemoryRequirements(r, &rd, ns);
+		break;
+	case 17:
+		*result = replay_vkGetPhysicalDeviceQueueFamilyProperties(r, &rd, ns);
+		break;
+	case 18:
+		*result = replay_vkGetPhysicalDeviceProperties(r, &rd, ns);
+		break;
+	case 19:
+		*result = replay_vkCreatePipelineLayout(r, &rd, ns);
+		break;
+	case 20:
+		*result = replay_vkGetPhysicalDeviceImageFormatProperties(r, &rd, ns);
+		break;
+	case 21:
+		*result = replay_vkGetImageSparseMemoryRequirements(r, &rd, ns);
+		break;
+	case 22:
+		*result = replay_vkCreateFramebuffer(r, &rd, ns);
+		break;
+	case 23:
+		*result = replay_vkDestroyFramebuffer(r, &rd, ns);
+		break;
+	case 24:
+		*result = replay_vkCreateRenderPass(r, &rd, ns);
+		break;
+	case 25:
+		*result = replay_vkDestroyRenderPass(r, &rd, ns);
+		break;
+	case 26:
+		*result = replay_vkGetRenderAreaGranularity(r, &rd, ns);
+		break;
+	case 27:
+		*result = replay_vkGetPhysicalDeviceFormatProperties(r, &rd, ns);
+		break;
+	case 28:
+		*result = replay_vkGetPhysicalDeviceFeatures(r, &rd, ns);
+		break;
+	case 29:
+		*result = replay_vkDestroyPipeline(r, &rd, ns);
+		break;
+	case 30:
+		*result = replay_vkEnumeratePhysicalDevices(r, &rd, ns);
+		break;
+	case 31:
+		*result = replay_vkDestroyInstance(r, &rd, ns);
+		break;
+	case 32:
+		*result = replay_vkCreateInstance(r, &rd, ns);
+		break;
+	case 33:
+		*result = replay_vkCreateComputePipelines(r, &rd, ns);
+		break;
+	case 34:
+		*result = replay_vkCreateGraphicsPipelines(r, &rd, ns);
+		break;
+	case 35:
+		*result = replay_vkGetPhysicalDeviceSparseImageFormatProperties(r, &rd, ns);
+		break;
+	case 36:
+		*result = replay_vkQueueBindSparse(r, &rd, ns);
+		break;
+	case 37:
+		*result = replay_vkMergePipelineCaches(r, &rd, ns);
+		break;
+	case 38:
+		*result = replay_vkGetPipelineCacheData(r, &rd, ns);
+		break;
+	case 39:
+		*result = replay_vkDestroyPipelineCache(r, &rd, ns);
+		break;
+	case 40:
+		*result = replay_vkCreatePipelineCache(r, &rd, ns);
+		break;
+	case 41:
+		*result = replay_vkDestroyShaderModule(r, &rd, ns);
+		break;
+	case 42:
+		*result = replay_vkCreateShaderModule(r, &rd, ns);
+		break;
+	case 43:
+		*result = replay_vkDestroyImageView(r, &rd, ns);
+		break;
+	case 44:
+		*result = replay_vkCreateDescriptorPool(r, &rd, ns);
+		break;
+	case 45:
+		*result = replay_vkCreateImageView(r, &rd, ns);
+		break;
+	case 46:
+		*result = replay_vkCreateFence(r, &rd, ns);
+		break;
+	case 47:
+		*result = replay_vkGetImageSubresourceLayout(r, &rd, ns);
+		break;
+	case 48:
+		*result = replay_vkDestroyDescriptorSetLayout(r, &rd, ns);
+		break;
+	case 49:
+		*result = replay_vkCreateDescriptorSetLayout(r, &rd, ns);
+		break;
+	case 50:
+		*result = replay_vkCreateCommandPool(r, &rd, ns);
+		break;
+	case 51:
+		*result = replay_vkDestroyCommandPool(r, &rd, ns);
+		break;
+	case 52:
+		*result = replay_vkResetCommandPool(r, &rd, ns);
+		break;
+	case 53:
+		*result = replay_vkAllocateMemory(r, &rd, ns);
+		break;
+	case 54:
+		*result = replay_vkDeviceWaitIdle(r, &rd, ns);
+		break;
+	case 55:
+		*result = replay_vkQueueWaitIdle(r, &rd, ns);
+		break;
+	case 56:
+		*result = replay_vkDestroyImage(r, &rd, ns);
+		break;
+	case 57:
+		*result = replay_vkQueueSubmit(r, &rd, ns);
+		break;
+	case 58:
+		*result = replay_vkGetDeviceQueue(r, &rd, ns);
+		break;
+	case 59:
+		*result = replay_vkAllocateCommandBuffers(r, &rd, ns);
+		break;
+	case 60:
+		*result = replay_vkFreeCommandBuffers(r, &rd, ns);
+		break;
+	case 61:
+		*result = replay_vkBeginCommandBuffer(r, &rd, ns);
+		break;
+	case 62:
+		*result = replay_vkEndCommandBuffer(r, &rd, ns);
+		break;
+	case 63:
+		*result = replay_vkResetCommandBuffer(r, &rd, ns);
+		break;
+	case 64:
+		*result = replay_vkEnumerateDeviceLayerProperties(r, &rd, ns);
+		break;
+	case 65:
+		*result = replay_vkCreateImage(r, &rd, ns);
+		break;
+	case 66:
+		*result = replay_vkCreateBuffer(r, &rd, ns);
+		break;
+	case 67:
+		*result = replay_vkDestroyDescriptorPool(r, &rd, ns);
+		break;
+	case 68:
+		*result = replay_vkGetPhysicalDeviceMemoryProperties(r, &rd, ns);
+		break;
+	case 69:
+		*result = replay_vkEnumerateDeviceExtensionProperties(r, &rd, ns);
+		break;
+	case 70:
+		*result = replay_vkDestroySampler(r, &rd, ns);
+		break;
+	case 71:
+		*result = replay_vkCreateSampler(r, &rd, ns);
+		break;
+	case 72:
+		*result = replay_vkEnumerateInstanceExtensionProperties(r, &rd, ns);
+		break;
+	case 73:
+		*result = replay_vkDestroyDevice(r, &rd, ns);
+		break;
+	case 74:
+		*result = replay_vkDestroyBufferView(r, &rd, ns);
+		break;
+	case 75:
+		*result = replay_vkCmdBindPipeline(r, &rd, ns);
+		break;
+	case 76:
+		*result = replay_vkCmdSetViewport(r, &rd, ns);
+		break;
+	case 77:
+		*result = replay_vkCmdSetScissor(r, &rd, ns);
+		break;
+	case 78:
+		*result = replay_vkCmdSetLineWidth(r, &rd, ns);
+		break;
+	case 79:
+		*result = replay_vkCmdSetDepthBias(r, &rd, ns);
+		break;
+	case 80:
+		*result = replay_vkCmdSetBlendConstants(r, &rd, ns);
+		break;
+	case 81:
+		*result = replay_vkCmdSetDepthBounds(r, &rd, ns);
+		break;
+	case 82:
+		*result = replay_vkCmdSetStencilCompareMask(r, &rd, ns);
+		break;
+	case 83:
+		*result = replay_vkCmdSetStencilWriteMask(r, &rd, ns);
+		break;
+	case 84:
+		*result = replay_vkCmdSetStencilReference(r, &rd, ns);
+		break;
+	case 85:
+		*result = replay_vkCmdBindDescriptorSets(r, &rd, ns);
+		break;
+	case 86:
+		*result = replay_vkCmdBindIndexBuffer(r, &rd, ns);
+		break;
+	case 87:
+		*result = replay_vkCmdBindVertexBuffers(r, &rd, ns);
+		break;
+	case 88:
+		*result = replay_vkCmdDraw(r, &rd, ns);
+		break;
+	case 89:
+		*result = replay_vkCmdDrawIndexed(r, &rd, ns);
+		break;
+	case 90:
+		*result = replay_vkCmdDrawIndirect(r, &rd, ns);
+		break;
+	case 91:
+		*result = replay_vkCmdDrawIndexedIndirect(r, &rd, ns);
+		break;
+	case 92:
+		*result = replay_vkCmdDispatch(r, &rd, ns);
+		break;
+	case 93:
+		*result = replay_vkCmdDispatchIndirect(r, &rd, ns);
+		break;
+	case 94:
+		*result = replay_vkCmdCopyBuffer(r, &rd, ns);
+		break;
+	case 95:
+		*result = replay_vkCmdCopyImage(r, &rd, ns);
+		break;
+	case 96:
+		*result = replay_vkCmdBlitImage(r, &rd, ns);
+		break;
+	case 97:
+		*result = replay_vkCmdCopyBufferToImage(r, &rd, ns);
+		break;
+	case 98:
+		*result = replay_vkCmdCopyImageToBuffer(r, &rd, ns);
+		break;
+	case 99:
+		*result = replay_vkCmdUpdateBuffer(r, &rd, ns);
+		break;
+	case 100:
+		*result = replay_vkCmdFillBuffer(r, &rd, ns);
+		break;
+	case 101:
+		*result = replay_vkCmdClearColorImage(r, &rd, ns);
+		break;
+	case 102:
+		*result = replay_vkCmdClearDepthStencilImage(r, &rd, ns);
+		break;
+	case 103:
+		*result = replay_vkCmdClearAttachments(r, &rd, ns);
+		break;
+	case 104:
+		*result = replay_vkCmdResolveImage(r, &rd, ns);
+		break;
+	case 105:
+		*result = replay_vkCmdSetEvent(r, &rd, ns);
+		break;
+	case 106:
+		*result = replay_vkCmdResetEvent(r, &rd, ns);
+		break;
+	case 107:
+		*result = replay_vkCmdWaitEvents(r, &rd, ns);
+		break;
+	case 108:
+		*result = replay_vkCmdPipelineBarrier(r, &rd, ns);
+		break;
+	case 109:
+		*result = replay_vkCmdBeginQuery(r, &rd, ns);
+		break;
+	case 110:
+		*result = replay_vkCmdEndQuery(r, &rd, ns);
+		break;
+	case 111:
+		*result = replay_vkCmdResetQueryPool(r, &rd, ns);
+		break;
+	case 112:
+		*result = replay_vkCmdWriteTimestamp(r, &rd, ns);
+		break;
+	case 113:
+		*result = replay_vkCmdCopyQueryPoolResults(r, &rd, ns);
+		break;
+	case 114:
+		*result = replay_vkCmdPushConstants(r, &rd, ns);
+		break;
+	case 115:
+		*result = replay_vkCmdBeginRenderPass(r, &rd, ns);
+		break;
+	case 116:
+		*result = replay_vkCmdNextSubpass(r, &rd, ns);
+		break;
+	case 117:
+		*result = replay_vkCmdEndRenderPass(r, &rd, ns);
+		break;
+	case 118:
+		*result = replay_vkCmdExecuteCommands(r, &rd, ns);
+		break;
+	case 119:
+		*result = replay_vkCreateBufferView(r, &rd, ns);
+		break;
+	case 120:
+		*result = replay_vkGetFenceStatus(r, &rd, ns);
+		break;
+	case 121:
+		*result = replay_vkWaitForFences(r, &rd, ns);
+		break;
+	case 122:
+		*result = replay_vkCreateDevice(r, &rd, ns);
+		break;
+	case 123:
+		*result = replay_vkCreateSemaphore(r, &rd, ns);
+		break;
+	case 124:
+		*result = replay_vkDestroySemaphore(r, &rd, ns);
+		break;
+	case 125:
+		*result = replay_vkDestroyPipelineLayout(r, &rd, ns);
+		break;
+	case 126:
+		*result = replay_vkDestroyBuffer(r, &rd, ns);
+		break;
+	case 127:
+		*result = replay_vkDestroyFence(r, &rd, ns);
+		break;
+	case 128:
+		*result = replay_vkCreateEvent(r, &rd, ns);
+		break;
+	case 129:
+		*result = replay_vkDestroyEvent(r, &rd, ns);
+		break;
+	case 130:
+		*result = replay_vkGetEventStatus(r, &rd, ns);
+		break;
+	case 131:
+		*result = replay_vkSetEvent(r, &rd, ns);
+		break;
+	case 132:
+		*result = replay_vkResetEvent(r, &rd, ns);
+		break;
+	case 133:
+		*result = replay_vkCreateQueryPool(r, &rd, ns);
+		break;
+	case 134:
+		*result = replay_vkGetQueryPoolResults(r, &rd, ns);
+		break;
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 135:
+		*result = replay_vkGetPhysicalDeviceFormatProperties2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 136:
+		*result = replay_vkGetPhysicalDeviceExternalFenceProperties(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 137:
+		*result = replay_vkGetPhysicalDeviceExternalBufferProperties(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 139:
+		*result = replay_vkDestroyDescriptorUpdateTemplate(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 140:
+		*result = replay_vkCreateDescriptorUpdateTemplate(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 141:
+		*result = replay_vkDestroySamplerYcbcrConversion(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 142:
+		*result = replay_vkCreateSamplerYcbcrConversion(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 143:
+		*result = replay_vkGetDeviceQueue2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 144:
+		*result = replay_vkTrimCommandPool(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 145:
+		*result = replay_vkGetPhysicalDeviceExternalSemaphoreProperties(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 146:
+		*result = replay_vkGetPhysicalDeviceSparseImageFormatProperties2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 147:
+		*result = replay_vkGetPhysicalDeviceMemoryProperties2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 148:
+		*result = replay_vkGetPhysicalDeviceQueueFamilyProperties2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 149:
+		*result = replay_vkGetPhysicalDeviceImageFormatProperties2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 150:
+		*result = replay_vkGetPhysicalDeviceProperties2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 151:
+		*result = replay_vkGetPhysicalDeviceFeatures2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 152:
+		*result = replay_vkGetImageSparseMemoryRequirements2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 153:
+		*result = replay_vkGetBufferMemoryRequirements2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 154:
+		*result = replay_vkGetDescriptorSetLayoutSupport(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 155:
+		*result = replay_vkGetImageMemoryRequirements2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 156:
+		*result = replay_vkEnumeratePhysicalDeviceGroups(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 157:
+		*result = replay_vkCmdDispatchBase(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 158:
+		*result = replay_vkCmdSetDeviceMask(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 159:
+		*result = replay_vkGetDeviceGroupPeerMemoryFeatures(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 160:
+		*result = replay_vkBindImageMemory2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 161:
+		*result = replay_vkBindBufferMemory2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_1
+	case 162:
+		*result = replay_vkEnumerateInstanceVersion(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_2
+	case 163:
+		*result = replay_vkCmdBeginRenderPass2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_2
+	case 164:
+		*result = replay_vkGetBufferOpaqueCaptureAddress(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_2
+	case 165:
+		*result = replay_vkGetBufferDeviceAddress(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_2
+	case 166:
+		*result = replay_vkCmdDrawIndirectCount(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_2
+	case 167:
+		*result = replay_vkCmdDrawIndexedIndirectCount(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_2
+	case 168:
+		*result = replay_vkCreateRenderPass2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_2
+	case 169:
+		*result = replay_vkGetDeviceMemoryOpaqueCaptureAddress(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_2
+	case 170:
+		*result = replay_vkCmdNextSubpass2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_2
+	case 171:
+		*result = replay_vkCmdEndRenderPass2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_2
+	case 172:
+		*result = replay_vkSignalSemaphore(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_2
+	case 173:
+		*result = replay_vkWaitSemaphores(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_2
+	case 174:
+		*result = replay_vkGetSemaphoreCounterValue(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_2
+	case 175:
+		*result = replay_vkResetQueryPool(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 176:
+		*result = replay_vkCmdWriteTimestamp2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 177:
+		*result = replay_vkCmdCopyImage2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 178:
+		*result = replay_vkCmdSetDepthBoundsTestEnable(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 179:
+		*result = replay_vkCmdSetStencilOp(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 180:
+		*result = replay_vkCmdSetDepthWriteEnable(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 181:
+		*result = replay_vkCmdSetDepthTestEnable(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 182:
+		*result = replay_vkCmdBindVertexBuffers2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 183:
+		*result = replay_vkCmdSetScissorWithCount(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 184:
+		*result = replay_vkCmdSetViewportWithCount(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 185:
+		*result = replay_vkCmdSetPrimitiveTopology(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 186:
+		*result = replay_vkCmdSetFrontFace(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 187:
+		*result = replay_vkCmdSetCullMode(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 188:
+		*result = replay_vkCmdSetEvent2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 189:
+		*result = replay_vkCmdEndRendering(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 190:
+		*result = replay_vkCmdBeginRendering(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 191:
+		*result = replay_vkCmdResetEvent2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 192:
+		*result = replay_vkCmdWaitEvents2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 193:
+		*result = replay_vkCmdPipelineBarrier2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 194:
+		*result = replay_vkCmdSetDepthCompareOp(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 195:
+		*result = replay_vkCmdSetStencilTestEnable(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 196:
+		*result = replay_vkCmdSetPrimitiveRestartEnable(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 197:
+		*result = replay_vkCmdSetDepthBiasEnable(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 198:
+		*result = replay_vkQueueSubmit2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 199:
+		*result = replay_vkGetPhysicalDeviceToolProperties(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 200:
+		*result = replay_vkCmdResolveImage2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 201:
+		*result = replay_vkGetDeviceBufferMemoryRequirements(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 202:
+		*result = replay_vkGetDeviceImageMemoryRequirements(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 203:
+		*result = replay_vkGetDeviceImageSparseMemoryRequirements(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 204:
+		*result = replay_vkGetPrivateData(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 205:
+		*result = replay_vkSetPrivateData(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 206:
+		*result = replay_vkDestroyPrivateDataSlot(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 207:
+		*result = replay_vkCreatePrivateDataSlot(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 208:
+		*result = replay_vkCmdBlitImage2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 209:
+		*result = replay_vkCmdCopyImageToBuffer2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 210:
+		*result = replay_vkCmdCopyBufferToImage2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 211:
+		*result = replay_vkCmdSetRasterizerDiscardEnable(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_VERSION_1_3
+	case 212:
+		*result = replay_vkCmdCopyBuffer2(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_EXT_DEBUG_REPORT
+	case 213:
+		*result = replay_vkCreateDebugReportCallbackEXT(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_EXT_DEBUG_REPORT
+	case 214:
+		*result = replay_vkDebugReportMessageEXT(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_EXT_DEBUG_REPORT
+	case 215:
+		*result = replay_vkDestroyDebugReportCallbackEXT(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_SURFACE
+	case 216:
+		*result = replay_vkGetPhysicalDeviceSurfacePresentModesKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_SURFACE
+	case 217:
+		*result = replay_vkGetPhysicalDeviceSurfaceFormatsKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_SURFACE
+	case 218:
+		*result = replay_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_SURFACE
+	case 219:
+		*result = replay_vkGetPhysicalDeviceSurfaceSupportKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_SURFACE
+	case 220:
+		*result = replay_vkDestroySurfaceKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_GET_SURFACE_CAPABILITIES2
+	case 221:
+		*result = replay_vkGetPhysicalDeviceSurfaceCapabilities2KHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_GET_SURFACE_CAPABILITIES2
+	case 222:
+		*result = replay_vkGetPhysicalDeviceSurfaceFormats2KHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_SWAPCHAIN
+	case 223:
+		*result = replay_vkCreateSwapchainKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_SWAPCHAIN
+	case 224:
+		*result = replay_vkAcquireNextImageKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_SWAPCHAIN
+	case 225:
+		*result = replay_vkQueuePresentKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_SWAPCHAIN
+	case 226:
+		*result = replay_vkAcquireNextImage2KHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_SWAPCHAIN
+	case 227:
+		*result = replay_vkGetPhysicalDevicePresentRectanglesKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_SWAPCHAIN
+	case 228:
+		*result = replay_vkGetSwapchainImagesKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_SWAPCHAIN
+	case 229:
+		*result = replay_vkGetDeviceGroupSurfacePresentModesKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_SWAPCHAIN
+	case 230:
+		*result = replay_vkDestroySwapchainKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_SWAPCHAIN
+	case 231:
+		*result = replay_vkGetDeviceGroupPresentCapabilitiesKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_DISPLAY
+	case 232:
+		*result = replay_vkGetPhysicalDeviceDisplayPropertiesKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_DISPLAY
+	case 233:
+		*result = replay_vkGetDisplayPlaneCapabilitiesKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_DISPLAY
+	case 234:
+		*result = replay_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_DISPLAY
+	case 235:
+		*result = replay_vkCreateDisplayModeKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_DISPLAY
+	case 236:
+		*result = replay_vkGetDisplayModePropertiesKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_DISPLAY
+	case 237:
+		*result = replay_vkCreateDisplayPlaneSurfaceKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_DISPLAY
+	case 238:
+		*result = replay_vkGetDisplayPlaneSupportedDisplaysKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_GET_DISPLAY_PROPERTIES2
+	case 239:
+		*result = replay_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_GET_DISPLAY_PROPERTIES2
+	case 240:
+		*result = replay_vkGetPhysicalDeviceDisplayProperties2KHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_GET_DISPLAY_PROPERTIES2
+	case 241:
+		*result = replay_vkGetDisplayPlaneCapabilities2KHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_GET_DISPLAY_PROPERTIES2
+	case 242:
+		*result = replay_vkGetDisplayModeProperties2KHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_DISPLAY_SWAPCHAIN
+	case 243:
+		*result = replay_vkCreateSharedSwapchainsKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_EXTERNAL_MEMORY_FD
+	case 244:
+		*result = replay_vkGetMemoryFdKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_EXTERNAL_MEMORY_FD
+	case 245:
+		*result = replay_vkGetMemoryFdPropertiesKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_EXTERNAL_SEMAPHORE_FD
+	case 246:
+		*result = replay_vkImportSemaphoreFdKHR(r, &rd, ns);
+		break;
+#endif
+#ifdef VKS_ENABLE_KHR_EXTERNAL_SEMAPHORE_FD
+	case 247:
+		*result = replay_vkGetSemaphoreFdKHR(r, &rd, ns);
+		break;
+#endif
+	default:
+		return 0;
+	}
+	return !rd.overflow;
+}
@@ -0,0 +1,27 @@
+//go:build !vks_no_ext_debug_report
+
+// Wrappers of VK_EXT_debug_report.
+#include "vk_wrapper.h"
+#include "vk_capture.h"
+
+VkResult vkCreateDebugReportCallbackEXT(vksProcAddr* addrs, VkInstance instance, VkDebugReportCallbackCreateInfoEXT* pCreateInfo, VkAllocationCallbacks* pAllocator, VkDebugReportCallbackEXT* pCallback) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkCreateDebugReportCallbackEXT(addrs, instance, pCreateInfo, pAllocator, pCallback);
+	}
+	VkResult ret = (((PFN_vkCreateDebugReportCallbackEXT)addrs->pvkCreateDebugReportCallbackEXT)(instance, pCreateInfo, pAllocator, pCallback));
+	return ret;
+}
+void vkDebugReportMessageEXT(vksProcAddr* addrs, VkInstance instance, VkDebugReportFlagsEXT flags, VkDebugReportObjectTypeEXT objectType, uint64_t object, size_t location, int32_t messageCode, char* pLayerPrefix, char* pMessage) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkDebugReportMessageEXT(addrs, instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage);
+		return;
+	}
+	(((PFN_vkDebugReportMessageEXT)addrs->pvkDebugReportMessageEXT)(instance, flags, objectType, object, location, messageCode, pLayerPrefix, pMessage));
+}
+void vkDestroyDebugReportCallbackEXT(vksProcAddr* addrs, VkInstance instance, VkDebugReportCallbackEXT callback, VkAllocationCallbacks* pAllocator) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkDestroyDebugReportCallbackEXT(addrs, instance, callback, pAllocator);
+		return;
+	}
+	(((PFN_vkDestroyDebugReportCallbackEXT)addrs->pvkDestroyDebugReportCallbackEXT)(instance, callback, pAllocator));
+}
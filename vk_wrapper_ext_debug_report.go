@@ -0,0 +1,421 @@
+//go:build !vks_no_ext_debug_report
+
+package vks
+
+// Bindings of VK_EXT_debug_report, left out by the vks_no_ext_debug_report build tag.
+
+//#cgo CFLAGS: -DVKS_ENABLE_EXT_DEBUG_REPORT
+//#include "vk_wrapper.h"
+import "C"
+import (
+	"fmt"
+	"unsafe"
+)
+
+// DebugReportCallbackEXT is a Handle to a vulkan resource.
+// DebugReportCallbackEXT is a child of Instance.
+//
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDebugReportCallbackEXT.html
+type DebugReportCallbackEXT C.VkDebugReportCallbackEXT
+
+// NullDebugReportCallbackEXT is a typed Null value for the DebugReportCallbackEXT type.
+var NullDebugReportCallbackEXT DebugReportCallbackEXT
+
+// DebugReportObjectTypeEXT enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDebugReportObjectTypeEXT.html
+type DebugReportObjectTypeEXT uint32
+
+const (
+	VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT                    DebugReportObjectTypeEXT = 0
+	VK_DEBUG_REPORT_OBJECT_TYPE_INSTANCE_EXT                   DebugReportObjectTypeEXT = 1
+	VK_DEBUG_REPORT_OBJECT_TYPE_PHYSICAL_DEVICE_EXT            DebugReportObjectTypeEXT = 2
+	VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT                     DebugReportObjectTypeEXT = 3
+	VK_DEBUG_REPORT_OBJECT_TYPE_QUEUE_EXT                      DebugReportObjectTypeEXT = 4
+	VK_DEBUG_REPORT_OBJECT_TYPE_SEMAPHORE_EXT                  DebugReportObjectTypeEXT = 5
+	VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT             DebugReportObjectTypeEXT = 6
+	VK_DEBUG_REPORT_OBJECT_TYPE_FENCE_EXT                      DebugReportObjectTypeEXT = 7
+	VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT              DebugReportObjectTypeEXT = 8
+	VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT                     DebugReportObjectTypeEXT = 9
+	VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT                      DebugReportObjectTypeEXT = 10
+	VK_DEBUG_REPORT_OBJECT_TYPE_EVENT_EXT                      DebugReportObjectTypeEXT = 11
+	VK_DEBUG_REPORT_OBJECT_TYPE_QUERY_POOL_EXT                 DebugReportObjectTypeEXT = 12
+	VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_VIEW_EXT                DebugReportObjectTypeEXT = 13
+	VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT                 DebugReportObjectTypeEXT = 14
+	VK_DEBUG_REPORT_OBJECT_TYPE_SHADER_MODULE_EXT              DebugReportObjectTypeEXT = 15
+	VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_CACHE_EXT             DebugReportObjectTypeEXT = 16
+	VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_LAYOUT_EXT            DebugReportObjectTypeEXT = 17
+	VK_DEBUG_REPORT_OBJECT_TYPE_RENDER_PASS_EXT                DebugReportObjectTypeEXT = 18
+	VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_EXT                   DebugReportObjectTypeEXT = 19
+	VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_LAYOUT_EXT      DebugReportObjectTypeEXT = 20
+	VK_DEBUG_REPORT_OBJECT_TYPE_SAMPLER_EXT                    DebugReportObjectTypeEXT = 21
+	VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_POOL_EXT            DebugReportObjectTypeEXT = 22
+	VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT             DebugReportObjectTypeEXT = 23
+	VK_DEBUG_REPORT_OBJECT_TYPE_FRAMEBUFFER_EXT                DebugReportObjectTypeEXT = 24
+	VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_POOL_EXT               DebugReportObjectTypeEXT = 25
+	VK_DEBUG_REPORT_OBJECT_TYPE_SURFACE_KHR_EXT                DebugReportObjectTypeEXT = 26
+	VK_DEBUG_REPORT_OBJECT_TYPE_SWAPCHAIN_KHR_EXT              DebugReportObjectTypeEXT = 27
+	VK_DEBUG_REPORT_OBJECT_TYPE_DEBUG_REPORT_CALLBACK_EXT_EXT  DebugReportObjectTypeEXT = 28
+	VK_DEBUG_REPORT_OBJECT_TYPE_DEBUG_REPORT_EXT               DebugReportObjectTypeEXT = VK_DEBUG_REPORT_OBJECT_TYPE_DEBUG_REPORT_CALLBACK_EXT_EXT
+	VK_DEBUG_REPORT_OBJECT_TYPE_DISPLAY_KHR_EXT                DebugReportObjectTypeEXT = 29
+	VK_DEBUG_REPORT_OBJECT_TYPE_DISPLAY_MODE_KHR_EXT           DebugReportObjectTypeEXT = 30
+	VK_DEBUG_REPORT_OBJECT_TYPE_VALIDATION_CACHE_EXT_EXT       DebugReportObjectTypeEXT = 33
+	VK_DEBUG_REPORT_OBJECT_TYPE_VALIDATION_CACHE_EXT           DebugReportObjectTypeEXT = VK_DEBUG_REPORT_OBJECT_TYPE_VALIDATION_CACHE_EXT_EXT
+	VK_DEBUG_REPORT_OBJECT_TYPE_SAMPLER_YCBCR_CONVERSION_EXT   DebugReportObjectTypeEXT = 1000156000
+	VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_EXT DebugReportObjectTypeEXT = 1000085000
+)
+
+const enumNamesDebugReportObjectTypeEXT = "VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_INSTANCE_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_PHYSICAL_DEVICE_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_QUEUE_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_SEMAPHORE_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_BUFFER_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_FENCE_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_DEVICE_MEMORY_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_EVENT_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_QUERY_POOL_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_BUFFER_VIEW_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_IMAGE_VIEW_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_SHADER_MODULE_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_CACHE_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_LAYOUT_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_RENDER_PASS_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_PIPELINE_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_LAYOUT_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_SAMPLER_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_POOL_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_SET_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_FRAMEBUFFER_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_COMMAND_POOL_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_SURFACE_KHR_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_SWAPCHAIN_KHR_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_DEBUG_REPORT_CALLBACK_EXT_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_DISPLAY_KHR_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_DISPLAY_MODE_KHR_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_VALIDATION_CACHE_EXT_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_EXT" +
+	"VK_DEBUG_REPORT_OBJECT_TYPE_SAMPLER_YCBCR_CONVERSION_EXT"
+
+var enumTableDebugReportObjectTypeEXT = enumTable[DebugReportObjectTypeEXT, uint16]{
+	first: VK_DEBUG_REPORT_OBJECT_TYPE_UNKNOWN_EXT,
+	dense: 34,
+	sparse: []DebugReportObjectTypeEXT{
+		VK_DEBUG_REPORT_OBJECT_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_EXT,
+		VK_DEBUG_REPORT_OBJECT_TYPE_SAMPLER_YCBCR_CONVERSION_EXT,
+	},
+	names: enumNamesDebugReportObjectTypeEXT,
+	index: []uint16{0, 39, 79, 126, 164, 201, 242, 288, 325, 370, 408, 445, 482, 524, 567, 609, 654, 700, 747, 790, 830, 883, 922, 969, 1015, 1058, 1102, 1145, 1190, 1247, 1290, 1338, 1338, 1338, 1390, 1448, 1504},
+}
+
+func (x DebugReportObjectTypeEXT) String() string {
+	if s, ok := enumTableDebugReportObjectTypeEXT.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("DebugReportObjectTypeEXT=%d", x)
+}
+
+// DebugReportFlagBitsEXT enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDebugReportFlagBitsEXT.html
+type DebugReportFlagBitsEXT uint32
+
+const (
+	VK_DEBUG_REPORT_INFORMATION_BIT_EXT         DebugReportFlagBitsEXT = (1 << 0)
+	VK_DEBUG_REPORT_WARNING_BIT_EXT             DebugReportFlagBitsEXT = (1 << 1)
+	VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT DebugReportFlagBitsEXT = (1 << 2)
+	VK_DEBUG_REPORT_ERROR_BIT_EXT               DebugReportFlagBitsEXT = (1 << 3)
+	VK_DEBUG_REPORT_DEBUG_BIT_EXT               DebugReportFlagBitsEXT = (1 << 4)
+)
+
+const enumNamesDebugReportFlagBitsEXT = "VK_DEBUG_REPORT_INFORMATION_BIT_EXT" +
+	"VK_DEBUG_REPORT_WARNING_BIT_EXT" +
+	"VK_DEBUG_REPORT_PERFORMANCE_WARNING_BIT_EXT" +
+	"VK_DEBUG_REPORT_ERROR_BIT_EXT" +
+	"VK_DEBUG_REPORT_DEBUG_BIT_EXT"
+
+var enumTableDebugReportFlagBitsEXT = enumTable[DebugReportFlagBitsEXT, uint16]{
+	first: VK_DEBUG_REPORT_INFORMATION_BIT_EXT,
+	dense: 8,
+	sparse: []DebugReportFlagBitsEXT{
+		VK_DEBUG_REPORT_DEBUG_BIT_EXT,
+	},
+	names: enumNamesDebugReportFlagBitsEXT,
+	index: []uint16{0, 35, 66, 66, 109, 109, 109, 109, 138, 167},
+}
+
+func (x DebugReportFlagBitsEXT) String() string {
+	if s, ok := enumTableDebugReportFlagBitsEXT.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("DebugReportFlagBitsEXT=%d", x)
+}
+
+// DebugReportFlagsEXT bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDebugReportFlagsEXT.html
+type DebugReportFlagsEXT Flags
+
+// Bits appends the DebugReportFlagBitsEXT set in x to dst, lowest first.
+func (x DebugReportFlagsEXT) Bits(dst []DebugReportFlagBitsEXT) []DebugReportFlagBitsEXT {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x DebugReportFlagsEXT) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableDebugReportFlagBitsEXT)
+}
+
+func (x DebugReportFlagsEXT) String() string {
+	return flagsString(x, &enumTableDebugReportFlagBitsEXT)
+}
+
+// ParseDebugReportFlagsEXT parses the names of DebugReportFlagBitsEXT values, or numbers,
+// separated by |.
+func ParseDebugReportFlagsEXT(s string) (DebugReportFlagsEXT, error) {
+	x, err := parseFlags(s, &enumTableDebugReportFlagBitsEXT)
+	return DebugReportFlagsEXT(x), err
+}
+
+// PFN_vkDebugReportCallbackEXT function pointer
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/PFN_vkDebugReportCallbackEXT.html
+type PFN_vkDebugReportCallbackEXT C.PFN_vkDebugReportCallbackEXT
+
+// DebugReportCallbackCreateInfoEXT provides a go interface for VkDebugReportCallbackCreateInfoEXT.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDebugReportCallbackCreateInfoEXT.html
+type DebugReportCallbackCreateInfoEXT C.struct_VkDebugReportCallbackCreateInfoEXT
+
+// SizeofDebugReportCallbackCreateInfoEXT is the memory size of a DebugReportCallbackCreateInfoEXT
+var SizeofDebugReportCallbackCreateInfoEXT int = int(unsafe.Sizeof(DebugReportCallbackCreateInfoEXT{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DebugReportCallbackCreateInfoEXT) ArpPtr(arp *AutoReleasePool) *DebugReportCallbackCreateInfoEXT {
+	ptr := newCBlock(cULong(SizeofDebugReportCallbackCreateInfoEXT))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DebugReportCallbackCreateInfoEXT)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DebugReportCallbackCreateInfoEXT) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DebugReportCallbackCreateInfoEXT) AsCPtr() *DebugReportCallbackCreateInfoEXT {
+	clone := (*DebugReportCallbackCreateInfoEXT)(newCBlock(cULong(SizeofDebugReportCallbackCreateInfoEXT)))
+	*clone = x
+	return clone
+}
+
+// DebugReportCallbackCreateInfoEXTCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DebugReportCallbackCreateInfoEXTCSlice(arp *AutoReleasePool, x ...DebugReportCallbackCreateInfoEXT) []DebugReportCallbackCreateInfoEXT {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDebugReportCallbackCreateInfoEXT * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DebugReportCallbackCreateInfoEXT)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DebugReportCallbackCreateInfoEXTFreeCSlice releases the memory allocated by DebugReportCallbackCreateInfoEXTMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DebugReportCallbackCreateInfoEXTFreeCSlice(x []DebugReportCallbackCreateInfoEXT) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DebugReportCallbackCreateInfoEXTMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DebugReportCallbackCreateInfoEXTFreeCSlice must be called on the returned slice.
+func DebugReportCallbackCreateInfoEXTMakeCSlice(x ...DebugReportCallbackCreateInfoEXT) []DebugReportCallbackCreateInfoEXT {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDebugReportCallbackCreateInfoEXT * len(x)
+	dst := unsafe.Slice((*DebugReportCallbackCreateInfoEXT)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDebugReportCallbackCreateInfoEXT
+func (x DebugReportCallbackCreateInfoEXT) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DebugReportCallbackCreateInfoEXT with the value of
+// SType to the value provided in the specification.
+func (x DebugReportCallbackCreateInfoEXT) WithDefaultSType() DebugReportCallbackCreateInfoEXT {
+	return x.WithSType(VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DebugReportCallbackCreateInfoEXT) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT)
+}
+
+// WithSType clones a new DebugReportCallbackCreateInfoEXT with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DebugReportCallbackCreateInfoEXT) WithSType(y StructureType) DebugReportCallbackCreateInfoEXT {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DebugReportCallbackCreateInfoEXT) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDebugReportCallbackCreateInfoEXT
+func (x DebugReportCallbackCreateInfoEXT) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DebugReportCallbackCreateInfoEXT with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DebugReportCallbackCreateInfoEXT) WithPNext(y unsafe.Pointer) DebugReportCallbackCreateInfoEXT {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DebugReportCallbackCreateInfoEXT) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DebugReportCallbackCreateInfoEXT) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Flags returns the value of flags from VkDebugReportCallbackCreateInfoEXT
+func (x DebugReportCallbackCreateInfoEXT) Flags() DebugReportFlagsEXT {
+	ptr := /* typedef */ (*DebugReportFlagsEXT)(&x.flags)
+	return *ptr
+}
+
+// WithFlags clones a new DebugReportCallbackCreateInfoEXT with the value of
+// Flags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DebugReportCallbackCreateInfoEXT) WithFlags(y DebugReportFlagsEXT) DebugReportCallbackCreateInfoEXT {
+	x.flags = *( /* typedef */ (*C.VkDebugReportFlagsEXT)(&y))
+	return x
+}
+func (x *DebugReportCallbackCreateInfoEXT) SetFlags(y DebugReportFlagsEXT) {
+	x.flags = *( /* typedef */ (*C.VkDebugReportFlagsEXT)(&y))
+}
+
+// PfnCallback returns the value of pfnCallback from VkDebugReportCallbackCreateInfoEXT
+func (x DebugReportCallbackCreateInfoEXT) PfnCallback() PFN_vkDebugReportCallbackEXT {
+	ptr := /* typedef */ (*PFN_vkDebugReportCallbackEXT)(&x.pfnCallback)
+	return *ptr
+}
+
+// WithPfnCallback clones a new DebugReportCallbackCreateInfoEXT with the value of
+// PfnCallback updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DebugReportCallbackCreateInfoEXT) WithPfnCallback(y PFN_vkDebugReportCallbackEXT) DebugReportCallbackCreateInfoEXT {
+	x.pfnCallback = *( /* typedef */ (*C.PFN_vkDebugReportCallbackEXT)(&y))
+	return x
+}
+func (x *DebugReportCallbackCreateInfoEXT) SetPfnCallback(y PFN_vkDebugReportCallbackEXT) {
+	x.pfnCallback = *( /* typedef */ (*C.PFN_vkDebugReportCallbackEXT)(&y))
+}
+
+// PUserData returns the value of pUserData from VkDebugReportCallbackCreateInfoEXT
+func (x DebugReportCallbackCreateInfoEXT) PUserData() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pUserData)
+	return *ptr
+}
+
+// WithPUserData clones a new DebugReportCallbackCreateInfoEXT with the value of
+// PUserData updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DebugReportCallbackCreateInfoEXT) WithPUserData(y unsafe.Pointer) DebugReportCallbackCreateInfoEXT {
+	x.pUserData = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DebugReportCallbackCreateInfoEXT) SetPUserData(y unsafe.Pointer) {
+	x.pUserData = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPUserData pins the Go memory referenced by y with the AutoReleasePool
+// and sets PUserData, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DebugReportCallbackCreateInfoEXT) PinPUserData(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPUserData(y)
+}
+
+// CreateDebugReportCallbackEXT command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCreateDebugReportCallbackEXT.html
+func (x InstanceFacade) CreateDebugReportCallbackEXT(pCreateInfo *DebugReportCallbackCreateInfoEXT, pAllocator *AllocationCallbacks, pCallback *DebugReportCallbackEXT) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkInstance)(&x.H)
+	p1 := func(x **DebugReportCallbackCreateInfoEXT) **C.struct_VkDebugReportCallbackCreateInfoEXT { /* Pointer */
+		g2c := (*C.struct_VkDebugReportCallbackCreateInfoEXT)(*x)
+		return &g2c
+	}(&pCreateInfo)
+	p2 := func(x **AllocationCallbacks) **C.struct_VkAllocationCallbacks { /* Pointer */
+		g2c := (*C.struct_VkAllocationCallbacks)(*x)
+		return &g2c
+	}(&pAllocator)
+	p3 := func(x **DebugReportCallbackEXT) **C.VkDebugReportCallbackEXT { /* Pointer */
+		g2c := (*C.VkDebugReportCallbackEXT)(*x)
+		return &g2c
+	}(&pCallback)
+	ret := C.vkCreateDebugReportCallbackEXT(addrs, *p0, *p1, *p2, *p3)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// DebugReportMessageEXT command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkDebugReportMessageEXT.html
+func (x InstanceFacade) DebugReportMessageEXT(flags DebugReportFlagsEXT, objectType DebugReportObjectTypeEXT, object uint64, location uint64, messageCode int32, pLayerPrefix *byte, pMessage *byte) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkInstance)(&x.H)
+	p1 := /* typedef */ (*C.VkDebugReportFlagsEXT)(&flags)
+	p2 := /* typedef */ (*C.VkDebugReportObjectTypeEXT)(&objectType)
+	p3 := func(x *uint64) *C.uint64_t { /* Scalar */ g2c := C.uint64_t(*x); return &g2c }(&object)
+	p4 := func(x *uint64) *C.size_t { /* Scalar */ g2c := C.size_t(*x); return &g2c }(&location)
+	p5 := func(x *int32) *C.int32_t { /* Scalar */ g2c := C.int32_t(*x); return &g2c }(&messageCode)
+	p6 := func(x **byte) **C.char { /* Pointer */ return (**C.char)(unsafe.Pointer(x)) }(&pLayerPrefix)
+	p7 := func(x **byte) **C.char { /* Pointer */ return (**C.char)(unsafe.Pointer(x)) }(&pMessage)
+	C.vkDebugReportMessageEXT(addrs, *p0, *p1, *p2, *p3, *p4, *p5, *p6, *p7)
+}
+
+// DestroyDebugReportCallbackEXT command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkDestroyDebugReportCallbackEXT.html
+func (x InstanceFacade) DestroyDebugReportCallbackEXT(callback DebugReportCallbackEXT, pAllocator *AllocationCallbacks) {
+	addrs := x.procs
+	if destroyHooks.Load() != nil {
+		handleDestroyed(VK_OBJECT_TYPE_DEBUG_REPORT_CALLBACK_EXT, uint64(uintptr(unsafe.Pointer(callback))))
+	}
+	p0 := /* handle */ (*C.VkInstance)(&x.H)
+	p1 := /* handle */ (*C.VkDebugReportCallbackEXT)(&callback)
+	p2 := func(x **AllocationCallbacks) **C.struct_VkAllocationCallbacks { /* Pointer */
+		g2c := (*C.struct_VkAllocationCallbacks)(*x)
+		return &g2c
+	}(&pAllocator)
+	C.vkDestroyDebugReportCallbackEXT(addrs, *p0, *p1, *p2)
+}
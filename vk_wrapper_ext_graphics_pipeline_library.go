@@ -0,0 +1,514 @@
+//go:build !vks_no_ext_graphics_pipeline_library
+
+package vks
+
+// Bindings of VK_EXT_graphics_pipeline_library, left out by the vks_no_ext_graphics_pipeline_library build tag.
+
+//#cgo CFLAGS: -DVKS_ENABLE_EXT_GRAPHICS_PIPELINE_LIBRARY
+//#include "vk_wrapper.h"
+import "C"
+import (
+	"fmt"
+	"unsafe"
+)
+
+// GraphicsPipelineLibraryFlagBitsEXT enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkGraphicsPipelineLibraryFlagBitsEXT.html
+type GraphicsPipelineLibraryFlagBitsEXT uint32
+
+const (
+	VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT    GraphicsPipelineLibraryFlagBitsEXT = (1 << 0)
+	VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT GraphicsPipelineLibraryFlagBitsEXT = (1 << 1)
+	VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT           GraphicsPipelineLibraryFlagBitsEXT = (1 << 2)
+	VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT GraphicsPipelineLibraryFlagBitsEXT = (1 << 3)
+)
+
+const enumNamesGraphicsPipelineLibraryFlagBitsEXT = "VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT" +
+	"VK_GRAPHICS_PIPELINE_LIBRARY_PRE_RASTERIZATION_SHADERS_BIT_EXT" +
+	"VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_SHADER_BIT_EXT" +
+	"VK_GRAPHICS_PIPELINE_LIBRARY_FRAGMENT_OUTPUT_INTERFACE_BIT_EXT"
+
+var enumTableGraphicsPipelineLibraryFlagBitsEXT = enumTable[GraphicsPipelineLibraryFlagBitsEXT, uint16]{
+	first: VK_GRAPHICS_PIPELINE_LIBRARY_VERTEX_INPUT_INTERFACE_BIT_EXT,
+	dense: 8,
+	names: enumNamesGraphicsPipelineLibraryFlagBitsEXT,
+	index: []uint16{0, 59, 121, 121, 173, 173, 173, 173, 235},
+}
+
+func (x GraphicsPipelineLibraryFlagBitsEXT) String() string {
+	if s, ok := enumTableGraphicsPipelineLibraryFlagBitsEXT.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("GraphicsPipelineLibraryFlagBitsEXT=%d", x)
+}
+
+// GraphicsPipelineLibraryFlagsEXT bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkGraphicsPipelineLibraryFlagsEXT.html
+type GraphicsPipelineLibraryFlagsEXT Flags
+
+// Bits appends the GraphicsPipelineLibraryFlagBitsEXT set in x to dst, lowest first.
+func (x GraphicsPipelineLibraryFlagsEXT) Bits(dst []GraphicsPipelineLibraryFlagBitsEXT) []GraphicsPipelineLibraryFlagBitsEXT {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x GraphicsPipelineLibraryFlagsEXT) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableGraphicsPipelineLibraryFlagBitsEXT)
+}
+
+func (x GraphicsPipelineLibraryFlagsEXT) String() string {
+	return flagsString(x, &enumTableGraphicsPipelineLibraryFlagBitsEXT)
+}
+
+// ParseGraphicsPipelineLibraryFlagsEXT parses the names of GraphicsPipelineLibraryFlagBitsEXT values, or numbers,
+// separated by |.
+func ParseGraphicsPipelineLibraryFlagsEXT(s string) (GraphicsPipelineLibraryFlagsEXT, error) {
+	x, err := parseFlags(s, &enumTableGraphicsPipelineLibraryFlagBitsEXT)
+	return GraphicsPipelineLibraryFlagsEXT(x), err
+}
+
+// PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT provides a go interface for VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT.html
+type PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT C.struct_VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT
+
+// SizeofPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT is the memory size of a PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT
+var SizeofPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT int = int(unsafe.Sizeof(PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT) AsCPtr() *PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT {
+	clone := (*PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT)(newCBlock(cULong(SizeofPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceGraphicsPipelineLibraryFeaturesEXTCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceGraphicsPipelineLibraryFeaturesEXTCSlice(arp *AutoReleasePool, x ...PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT) []PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceGraphicsPipelineLibraryFeaturesEXTFreeCSlice releases the memory allocated by PhysicalDeviceGraphicsPipelineLibraryFeaturesEXTMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceGraphicsPipelineLibraryFeaturesEXTFreeCSlice(x []PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceGraphicsPipelineLibraryFeaturesEXTMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceGraphicsPipelineLibraryFeaturesEXTFreeCSlice must be called on the returned slice.
+func PhysicalDeviceGraphicsPipelineLibraryFeaturesEXTMakeCSlice(x ...PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT) []PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT
+func (x PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT) WithDefaultSType() PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_FEATURES_EXT)
+}
+
+// WithSType clones a new PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT) WithSType(y StructureType) PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT
+func (x PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT) WithPNext(y unsafe.Pointer) PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// GraphicsPipelineLibrary returns the value of graphicsPipelineLibrary from VkPhysicalDeviceGraphicsPipelineLibraryFeaturesEXT
+func (x PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT) GraphicsPipelineLibrary() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.graphicsPipelineLibrary)
+	return *ptr
+}
+
+// WithGraphicsPipelineLibrary clones a new PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT with the value of
+// GraphicsPipelineLibrary updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT) WithGraphicsPipelineLibrary(y Bool32) PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT {
+	x.graphicsPipelineLibrary = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceGraphicsPipelineLibraryFeaturesEXT) SetGraphicsPipelineLibrary(y Bool32) {
+	x.graphicsPipelineLibrary = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT provides a go interface for VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT.html
+type PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT C.struct_VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT
+
+// SizeofPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT is the memory size of a PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT
+var SizeofPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT int = int(unsafe.Sizeof(PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT) AsCPtr() *PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT {
+	clone := (*PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT)(newCBlock(cULong(SizeofPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceGraphicsPipelineLibraryPropertiesEXTCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceGraphicsPipelineLibraryPropertiesEXTCSlice(arp *AutoReleasePool, x ...PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT) []PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceGraphicsPipelineLibraryPropertiesEXTFreeCSlice releases the memory allocated by PhysicalDeviceGraphicsPipelineLibraryPropertiesEXTMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceGraphicsPipelineLibraryPropertiesEXTFreeCSlice(x []PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceGraphicsPipelineLibraryPropertiesEXTMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceGraphicsPipelineLibraryPropertiesEXTFreeCSlice must be called on the returned slice.
+func PhysicalDeviceGraphicsPipelineLibraryPropertiesEXTMakeCSlice(x ...PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT) []PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT
+func (x PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT) WithDefaultSType() PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GRAPHICS_PIPELINE_LIBRARY_PROPERTIES_EXT)
+}
+
+// WithSType clones a new PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT) WithSType(y StructureType) PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT
+func (x PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT) WithPNext(y unsafe.Pointer) PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// GraphicsPipelineLibraryFastLinking returns the value of graphicsPipelineLibraryFastLinking from VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT
+func (x PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT) GraphicsPipelineLibraryFastLinking() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.graphicsPipelineLibraryFastLinking)
+	return *ptr
+}
+
+// WithGraphicsPipelineLibraryFastLinking clones a new PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT with the value of
+// GraphicsPipelineLibraryFastLinking updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT) WithGraphicsPipelineLibraryFastLinking(y Bool32) PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT {
+	x.graphicsPipelineLibraryFastLinking = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT) SetGraphicsPipelineLibraryFastLinking(y Bool32) {
+	x.graphicsPipelineLibraryFastLinking = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// GraphicsPipelineLibraryIndependentInterpolationDecoration returns the value of graphicsPipelineLibraryIndependentInterpolationDecoration from VkPhysicalDeviceGraphicsPipelineLibraryPropertiesEXT
+func (x PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT) GraphicsPipelineLibraryIndependentInterpolationDecoration() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.graphicsPipelineLibraryIndependentInterpolationDecoration)
+	return *ptr
+}
+
+// WithGraphicsPipelineLibraryIndependentInterpolationDecoration clones a new PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT with the value of
+// GraphicsPipelineLibraryIndependentInterpolationDecoration updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT) WithGraphicsPipelineLibraryIndependentInterpolationDecoration(y Bool32) PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT {
+	x.graphicsPipelineLibraryIndependentInterpolationDecoration = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceGraphicsPipelineLibraryPropertiesEXT) SetGraphicsPipelineLibraryIndependentInterpolationDecoration(y Bool32) {
+	x.graphicsPipelineLibraryIndependentInterpolationDecoration = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// GraphicsPipelineLibraryCreateInfoEXT provides a go interface for VkGraphicsPipelineLibraryCreateInfoEXT.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkGraphicsPipelineLibraryCreateInfoEXT.html
+type GraphicsPipelineLibraryCreateInfoEXT C.struct_VkGraphicsPipelineLibraryCreateInfoEXT
+
+// SizeofGraphicsPipelineLibraryCreateInfoEXT is the memory size of a GraphicsPipelineLibraryCreateInfoEXT
+var SizeofGraphicsPipelineLibraryCreateInfoEXT int = int(unsafe.Sizeof(GraphicsPipelineLibraryCreateInfoEXT{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x GraphicsPipelineLibraryCreateInfoEXT) ArpPtr(arp *AutoReleasePool) *GraphicsPipelineLibraryCreateInfoEXT {
+	ptr := newCBlock(cULong(SizeofGraphicsPipelineLibraryCreateInfoEXT))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*GraphicsPipelineLibraryCreateInfoEXT)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *GraphicsPipelineLibraryCreateInfoEXT) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x GraphicsPipelineLibraryCreateInfoEXT) AsCPtr() *GraphicsPipelineLibraryCreateInfoEXT {
+	clone := (*GraphicsPipelineLibraryCreateInfoEXT)(newCBlock(cULong(SizeofGraphicsPipelineLibraryCreateInfoEXT)))
+	*clone = x
+	return clone
+}
+
+// GraphicsPipelineLibraryCreateInfoEXTCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func GraphicsPipelineLibraryCreateInfoEXTCSlice(arp *AutoReleasePool, x ...GraphicsPipelineLibraryCreateInfoEXT) []GraphicsPipelineLibraryCreateInfoEXT {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofGraphicsPipelineLibraryCreateInfoEXT * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*GraphicsPipelineLibraryCreateInfoEXT)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// GraphicsPipelineLibraryCreateInfoEXTFreeCSlice releases the memory allocated by GraphicsPipelineLibraryCreateInfoEXTMakeCSlice.
+// It does not free pointers stored inside the slice.
+func GraphicsPipelineLibraryCreateInfoEXTFreeCSlice(x []GraphicsPipelineLibraryCreateInfoEXT) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// GraphicsPipelineLibraryCreateInfoEXTMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. GraphicsPipelineLibraryCreateInfoEXTFreeCSlice must be called on the returned slice.
+func GraphicsPipelineLibraryCreateInfoEXTMakeCSlice(x ...GraphicsPipelineLibraryCreateInfoEXT) []GraphicsPipelineLibraryCreateInfoEXT {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofGraphicsPipelineLibraryCreateInfoEXT * len(x)
+	dst := unsafe.Slice((*GraphicsPipelineLibraryCreateInfoEXT)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkGraphicsPipelineLibraryCreateInfoEXT
+func (x GraphicsPipelineLibraryCreateInfoEXT) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new GraphicsPipelineLibraryCreateInfoEXT with the value of
+// SType to the value provided in the specification.
+func (x GraphicsPipelineLibraryCreateInfoEXT) WithDefaultSType() GraphicsPipelineLibraryCreateInfoEXT {
+	return x.WithSType(VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *GraphicsPipelineLibraryCreateInfoEXT) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_LIBRARY_CREATE_INFO_EXT)
+}
+
+// WithSType clones a new GraphicsPipelineLibraryCreateInfoEXT with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x GraphicsPipelineLibraryCreateInfoEXT) WithSType(y StructureType) GraphicsPipelineLibraryCreateInfoEXT {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *GraphicsPipelineLibraryCreateInfoEXT) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkGraphicsPipelineLibraryCreateInfoEXT
+func (x GraphicsPipelineLibraryCreateInfoEXT) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new GraphicsPipelineLibraryCreateInfoEXT with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x GraphicsPipelineLibraryCreateInfoEXT) WithPNext(y unsafe.Pointer) GraphicsPipelineLibraryCreateInfoEXT {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *GraphicsPipelineLibraryCreateInfoEXT) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *GraphicsPipelineLibraryCreateInfoEXT) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Flags returns the value of flags from VkGraphicsPipelineLibraryCreateInfoEXT
+func (x GraphicsPipelineLibraryCreateInfoEXT) Flags() GraphicsPipelineLibraryFlagsEXT {
+	ptr := /* typedef */ (*GraphicsPipelineLibraryFlagsEXT)(&x.flags)
+	return *ptr
+}
+
+// WithFlags clones a new GraphicsPipelineLibraryCreateInfoEXT with the value of
+// Flags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x GraphicsPipelineLibraryCreateInfoEXT) WithFlags(y GraphicsPipelineLibraryFlagsEXT) GraphicsPipelineLibraryCreateInfoEXT {
+	x.flags = *( /* typedef */ (*C.VkGraphicsPipelineLibraryFlagsEXT)(&y))
+	return x
+}
+func (x *GraphicsPipelineLibraryCreateInfoEXT) SetFlags(y GraphicsPipelineLibraryFlagsEXT) {
+	x.flags = *( /* typedef */ (*C.VkGraphicsPipelineLibraryFlagsEXT)(&y))
+}
@@ -0,0 +1,158 @@
+//go:build !vks_no_ext_memory_budget && !vks_no_version_1_1
+
+package vks
+
+// Bindings of VK_EXT_memory_budget, left out by the vks_no_ext_memory_budget build tag.
+
+//#cgo CFLAGS: -DVKS_ENABLE_EXT_MEMORY_BUDGET
+//#include "vk_wrapper.h"
+import "C"
+import (
+	"unsafe"
+)
+
+// PhysicalDeviceMemoryBudgetPropertiesEXT provides a go interface for VkPhysicalDeviceMemoryBudgetPropertiesEXT.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceMemoryBudgetPropertiesEXT.html
+type PhysicalDeviceMemoryBudgetPropertiesEXT C.struct_VkPhysicalDeviceMemoryBudgetPropertiesEXT
+
+// SizeofPhysicalDeviceMemoryBudgetPropertiesEXT is the memory size of a PhysicalDeviceMemoryBudgetPropertiesEXT
+var SizeofPhysicalDeviceMemoryBudgetPropertiesEXT int = int(unsafe.Sizeof(PhysicalDeviceMemoryBudgetPropertiesEXT{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceMemoryBudgetPropertiesEXT) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceMemoryBudgetPropertiesEXT {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceMemoryBudgetPropertiesEXT))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceMemoryBudgetPropertiesEXT)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceMemoryBudgetPropertiesEXT) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceMemoryBudgetPropertiesEXT) AsCPtr() *PhysicalDeviceMemoryBudgetPropertiesEXT {
+	clone := (*PhysicalDeviceMemoryBudgetPropertiesEXT)(newCBlock(cULong(SizeofPhysicalDeviceMemoryBudgetPropertiesEXT)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceMemoryBudgetPropertiesEXTCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceMemoryBudgetPropertiesEXTCSlice(arp *AutoReleasePool, x ...PhysicalDeviceMemoryBudgetPropertiesEXT) []PhysicalDeviceMemoryBudgetPropertiesEXT {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceMemoryBudgetPropertiesEXT * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceMemoryBudgetPropertiesEXT)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceMemoryBudgetPropertiesEXTFreeCSlice releases the memory allocated by PhysicalDeviceMemoryBudgetPropertiesEXTMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceMemoryBudgetPropertiesEXTFreeCSlice(x []PhysicalDeviceMemoryBudgetPropertiesEXT) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceMemoryBudgetPropertiesEXTMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceMemoryBudgetPropertiesEXTFreeCSlice must be called on the returned slice.
+func PhysicalDeviceMemoryBudgetPropertiesEXTMakeCSlice(x ...PhysicalDeviceMemoryBudgetPropertiesEXT) []PhysicalDeviceMemoryBudgetPropertiesEXT {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceMemoryBudgetPropertiesEXT * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceMemoryBudgetPropertiesEXT)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceMemoryBudgetPropertiesEXT
+func (x *PhysicalDeviceMemoryBudgetPropertiesEXT) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceMemoryBudgetPropertiesEXT with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceMemoryBudgetPropertiesEXT) WithDefaultSType() PhysicalDeviceMemoryBudgetPropertiesEXT {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceMemoryBudgetPropertiesEXT) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT)
+}
+
+// WithSType clones a new PhysicalDeviceMemoryBudgetPropertiesEXT with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceMemoryBudgetPropertiesEXT) WithSType(y StructureType) PhysicalDeviceMemoryBudgetPropertiesEXT {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceMemoryBudgetPropertiesEXT) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceMemoryBudgetPropertiesEXT
+func (x *PhysicalDeviceMemoryBudgetPropertiesEXT) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceMemoryBudgetPropertiesEXT with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceMemoryBudgetPropertiesEXT) WithPNext(y unsafe.Pointer) PhysicalDeviceMemoryBudgetPropertiesEXT {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceMemoryBudgetPropertiesEXT) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceMemoryBudgetPropertiesEXT) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// HeapBudget returns the value of heapBudget from VkPhysicalDeviceMemoryBudgetPropertiesEXT
+// The slice references the array in x; it is not a copy.
+func (x *PhysicalDeviceMemoryBudgetPropertiesEXT) HeapBudget() []DeviceSize {
+	ptr := func(x *[VK_MAX_MEMORY_HEAPS]C.VkDeviceSize) *[]DeviceSize { /* Array for DeviceSize */
+		slc := unsafe.Slice((*DeviceSize)(unsafe.Pointer(x)), VK_MAX_MEMORY_HEAPS)
+		return &slc
+	}(&x.heapBudget)
+	return *ptr
+}
+
+// HeapUsage returns the value of heapUsage from VkPhysicalDeviceMemoryBudgetPropertiesEXT
+// The slice references the array in x; it is not a copy.
+func (x *PhysicalDeviceMemoryBudgetPropertiesEXT) HeapUsage() []DeviceSize {
+	ptr := func(x *[VK_MAX_MEMORY_HEAPS]C.VkDeviceSize) *[]DeviceSize { /* Array for DeviceSize */
+		slc := unsafe.Slice((*DeviceSize)(unsafe.Pointer(x)), VK_MAX_MEMORY_HEAPS)
+		return &slc
+	}(&x.heapUsage)
+	return *ptr
+}
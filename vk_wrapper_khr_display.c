@@ -0,0 +1,203 @@
+//go:build !vks_no_khr_display && !vks_no_khr_surface
+
+// Wrappers of VK_KHR_display.
+#include "vk_wrapper.h"
+#include "vk_capture.h"
+
+VkResult vkGetPhysicalDeviceDisplayPropertiesKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPropertiesKHR* pProperties) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetPhysicalDeviceDisplayPropertiesKHR(addrs, physicalDevice, pPropertyCount, pProperties);
+	}
+	VkResult ret = (((PFN_vkGetPhysicalDeviceDisplayPropertiesKHR)addrs->pvkGetPhysicalDeviceDisplayPropertiesKHR)(physicalDevice, pPropertyCount, pProperties));
+	return ret;
+}
+
+// Runs the two-call idiom of vkGetPhysicalDeviceDisplayPropertiesKHR in one call. capacity is the
+// length of pProperties; when it is too small, the result is VK_INCOMPLETE
+// with the count needed.
+vksEnumerateResult vksEnumerate_vkGetPhysicalDeviceDisplayPropertiesKHR(vksProcAddr* addrs, uint64_t physicalDevice, uint32_t capacity, VkDisplayPropertiesKHR* pProperties) {
+	vksEnumerateResult r = { VK_SUCCESS, capacity };
+	if (capacity > 0) {
+		// Large enough buffers skip the count query.
+		r.result = vkGetPhysicalDeviceDisplayPropertiesKHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, &r.count, pProperties);
+		if (r.result < 0) {
+			r.count = 0;
+		}
+		if (r.result != VK_INCOMPLETE) {
+			return r;
+		}
+	}
+	for (;;) {
+		r.count = 0;
+		r.result = vkGetPhysicalDeviceDisplayPropertiesKHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, &r.count, NULL);
+		if (r.result < 0) {
+			r.count = 0;
+			return r;
+		}
+		if (r.count > capacity) {
+			r.result = VK_INCOMPLETE;
+			return r;
+		}
+		r.result = vkGetPhysicalDeviceDisplayPropertiesKHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, &r.count, pProperties);
+		if (r.result != VK_INCOMPLETE) {
+			if (r.result < 0) {
+				r.count = 0;
+			}
+			return r;
+		}
+		// The count grew between the calls.
+	}
+}
+VkResult vkGetDisplayPlaneCapabilitiesKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkDisplayModeKHR mode, uint32_t planeIndex, VkDisplayPlaneCapabilitiesKHR* pCapabilities) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetDisplayPlaneCapabilitiesKHR(addrs, physicalDevice, mode, planeIndex, pCapabilities);
+	}
+	VkResult ret = (((PFN_vkGetDisplayPlaneCapabilitiesKHR)addrs->pvkGetDisplayPlaneCapabilitiesKHR)(physicalDevice, mode, planeIndex, pCapabilities));
+	return ret;
+}
+VkResult vkGetPhysicalDeviceDisplayPlanePropertiesKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPlanePropertiesKHR* pProperties) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(addrs, physicalDevice, pPropertyCount, pProperties);
+	}
+	VkResult ret = (((PFN_vkGetPhysicalDeviceDisplayPlanePropertiesKHR)addrs->pvkGetPhysicalDeviceDisplayPlanePropertiesKHR)(physicalDevice, pPropertyCount, pProperties));
+	return ret;
+}
+
+// Runs the two-call idiom of vkGetPhysicalDeviceDisplayPlanePropertiesKHR in one call. capacity is the
+// length of pProperties; when it is too small, the result is VK_INCOMPLETE
+// with the count needed.
+vksEnumerateResult vksEnumerate_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(vksProcAddr* addrs, uint64_t physicalDevice, uint32_t capacity, VkDisplayPlanePropertiesKHR* pProperties) {
+	vksEnumerateResult r = { VK_SUCCESS, capacity };
+	if (capacity > 0) {
+		// Large enough buffers skip the count query.
+		r.result = vkGetPhysicalDeviceDisplayPlanePropertiesKHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, &r.count, pProperties);
+		if (r.result < 0) {
+			r.count = 0;
+		}
+		if (r.result != VK_INCOMPLETE) {
+			return r;
+		}
+	}
+	for (;;) {
+		r.count = 0;
+		r.result = vkGetPhysicalDeviceDisplayPlanePropertiesKHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, &r.count, NULL);
+		if (r.result < 0) {
+			r.count = 0;
+			return r;
+		}
+		if (r.count > capacity) {
+			r.result = VK_INCOMPLETE;
+			return r;
+		}
+		r.result = vkGetPhysicalDeviceDisplayPlanePropertiesKHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, &r.count, pProperties);
+		if (r.result != VK_INCOMPLETE) {
+			if (r.result < 0) {
+				r.count = 0;
+			}
+			return r;
+		}
+		// The count grew between the calls.
+	}
+}
+VkResult vkCreateDisplayModeKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkDisplayKHR display, VkDisplayModeCreateInfoKHR* pCreateInfo, VkAllocationCallbacks* pAllocator, VkDisplayModeKHR* pMode) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkCreateDisplayModeKHR(addrs, physicalDevice, display, pCreateInfo, pAllocator, pMode);
+	}
+	VkResult ret = (((PFN_vkCreateDisplayModeKHR)addrs->pvkCreateDisplayModeKHR)(physicalDevice, display, pCreateInfo, pAllocator, pMode));
+	return ret;
+}
+VkResult vkGetDisplayModePropertiesKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t* pPropertyCount, VkDisplayModePropertiesKHR* pProperties) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetDisplayModePropertiesKHR(addrs, physicalDevice, display, pPropertyCount, pProperties);
+	}
+	VkResult ret = (((PFN_vkGetDisplayModePropertiesKHR)addrs->pvkGetDisplayModePropertiesKHR)(physicalDevice, display, pPropertyCount, pProperties));
+	return ret;
+}
+
+// Runs the two-call idiom of vkGetDisplayModePropertiesKHR in one call. capacity is the
+// length of pProperties; when it is too small, the result is VK_INCOMPLETE
+// with the count needed.
+vksEnumerateResult vksEnumerate_vkGetDisplayModePropertiesKHR(vksProcAddr* addrs, uint64_t physicalDevice, uint64_t display, uint32_t capacity, VkDisplayModePropertiesKHR* pProperties) {
+	vksEnumerateResult r = { VK_SUCCESS, capacity };
+	if (capacity > 0) {
+		// Large enough buffers skip the count query.
+		r.result = vkGetDisplayModePropertiesKHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, (VkDisplayKHR)(uintptr_t)display, &r.count, pProperties);
+		if (r.result < 0) {
+			r.count = 0;
+		}
+		if (r.result != VK_INCOMPLETE) {
+			return r;
+		}
+	}
+	for (;;) {
+		r.count = 0;
+		r.result = vkGetDisplayModePropertiesKHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, (VkDisplayKHR)(uintptr_t)display, &r.count, NULL);
+		if (r.result < 0) {
+			r.count = 0;
+			return r;
+		}
+		if (r.count > capacity) {
+			r.result = VK_INCOMPLETE;
+			return r;
+		}
+		r.result = vkGetDisplayModePropertiesKHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, (VkDisplayKHR)(uintptr_t)display, &r.count, pProperties);
+		if (r.result != VK_INCOMPLETE) {
+			if (r.result < 0) {
+				r.count = 0;
+			}
+			return r;
+		}
+		// The count grew between the calls.
+	}
+}
+VkResult vkCreateDisplayPlaneSurfaceKHR(vksProcAddr* addrs, VkInstance instance, VkDisplaySurfaceCreateInfoKHR* pCreateInfo, VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkCreateDisplayPlaneSurfaceKHR(addrs, instance, pCreateInfo, pAllocator, pSurface);
+	}
+	VkResult ret = (((PFN_vkCreateDisplayPlaneSurfaceKHR)addrs->pvkCreateDisplayPlaneSurfaceKHR)(instance, pCreateInfo, pAllocator, pSurface));
+	return ret;
+}
+VkResult vkGetDisplayPlaneSupportedDisplaysKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t planeIndex, uint32_t* pDisplayCount, VkDisplayKHR* pDisplays) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetDisplayPlaneSupportedDisplaysKHR(addrs, physicalDevice, planeIndex, pDisplayCount, pDisplays);
+	}
+	VkResult ret = (((PFN_vkGetDisplayPlaneSupportedDisplaysKHR)addrs->pvkGetDisplayPlaneSupportedDisplaysKHR)(physicalDevice, planeIndex, pDisplayCount, pDisplays));
+	return ret;
+}
+
+// Runs the two-call idiom of vkGetDisplayPlaneSupportedDisplaysKHR in one call. capacity is the
+// length of pDisplays; when it is too small, the result is VK_INCOMPLETE
+// with the count needed.
+vksEnumerateResult vksEnumerate_vkGetDisplayPlaneSupportedDisplaysKHR(vksProcAddr* addrs, uint64_t physicalDevice, uint32_t planeIndex, uint32_t capacity, VkDisplayKHR* pDisplays) {
+	vksEnumerateResult r = { VK_SUCCESS, capacity };
+	if (capacity > 0) {
+		// Large enough buffers skip the count query.
+		r.result = vkGetDisplayPlaneSupportedDisplaysKHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, planeIndex, &r.count, pDisplays);
+		if (r.result < 0) {
+			r.count = 0;
+		}
+		if (r.result != VK_INCOMPLETE) {
+			return r;
+		}
+	}
+	for (;;) {
+		r.count = 0;
+		r.result = vkGetDisplayPlaneSupportedDisplaysKHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, planeIndex, &r.count, NULL);
+		if (r.result < 0) {
+			r.count = 0;
+			return r;
+		}
+		if (r.count > capacity) {
+			r.result = VK_INCOMPLETE;
+			return r;
+		}
+		r.result = vkGetDisplayPlaneSupportedDisplaysKHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, planeIndex, &r.count, pDisplays);
+		if (r.result != VK_INCOMPLETE) {
+			if (r.result < 0) {
+				r.count = 0;
+			}
+			return r;
+		}
+		// The count grew between the calls.
+	}
+}
@@ -0,0 +1,1247 @@
+//go:build !vks_no_khr_display && !vks_no_khr_surface
+
+package vks
+
+// Bindings of VK_KHR_display, left out by the vks_no_khr_display build tag.
+
+//#cgo CFLAGS: -DVKS_ENABLE_KHR_DISPLAY
+//#include "vk_wrapper.h"
+import "C"
+import (
+	"fmt"
+	"unsafe"
+)
+
+// DisplayKHR is a Handle to a vulkan resource.
+// DisplayKHR is a child of PhysicalDevice.
+//
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDisplayKHR.html
+type DisplayKHR C.VkDisplayKHR
+
+// NullDisplayKHR is a typed Null value for the DisplayKHR type.
+var NullDisplayKHR DisplayKHR
+
+// DisplayModeKHR is a Handle to a vulkan resource.
+// DisplayModeKHR is a child of DisplayKHR.
+//
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDisplayModeKHR.html
+type DisplayModeKHR C.VkDisplayModeKHR
+
+// NullDisplayModeKHR is a typed Null value for the DisplayModeKHR type.
+var NullDisplayModeKHR DisplayModeKHR
+
+// DisplayPlaneAlphaFlagBitsKHR enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDisplayPlaneAlphaFlagBitsKHR.html
+type DisplayPlaneAlphaFlagBitsKHR uint32
+
+const (
+	VK_DISPLAY_PLANE_ALPHA_OPAQUE_BIT_KHR                  DisplayPlaneAlphaFlagBitsKHR = (1 << 0)
+	VK_DISPLAY_PLANE_ALPHA_GLOBAL_BIT_KHR                  DisplayPlaneAlphaFlagBitsKHR = (1 << 1)
+	VK_DISPLAY_PLANE_ALPHA_PER_PIXEL_BIT_KHR               DisplayPlaneAlphaFlagBitsKHR = (1 << 2)
+	VK_DISPLAY_PLANE_ALPHA_PER_PIXEL_PREMULTIPLIED_BIT_KHR DisplayPlaneAlphaFlagBitsKHR = (1 << 3)
+)
+
+const enumNamesDisplayPlaneAlphaFlagBitsKHR = "VK_DISPLAY_PLANE_ALPHA_OPAQUE_BIT_KHR" +
+	"VK_DISPLAY_PLANE_ALPHA_GLOBAL_BIT_KHR" +
+	"VK_DISPLAY_PLANE_ALPHA_PER_PIXEL_BIT_KHR" +
+	"VK_DISPLAY_PLANE_ALPHA_PER_PIXEL_PREMULTIPLIED_BIT_KHR"
+
+var enumTableDisplayPlaneAlphaFlagBitsKHR = enumTable[DisplayPlaneAlphaFlagBitsKHR, uint16]{
+	first: VK_DISPLAY_PLANE_ALPHA_OPAQUE_BIT_KHR,
+	dense: 8,
+	names: enumNamesDisplayPlaneAlphaFlagBitsKHR,
+	index: []uint16{0, 37, 74, 74, 114, 114, 114, 114, 168},
+}
+
+func (x DisplayPlaneAlphaFlagBitsKHR) String() string {
+	if s, ok := enumTableDisplayPlaneAlphaFlagBitsKHR.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("DisplayPlaneAlphaFlagBitsKHR=%d", x)
+}
+
+// DisplaySurfaceCreateFlagsKHR bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDisplaySurfaceCreateFlagsKHR.html
+type DisplaySurfaceCreateFlagsKHR Flags
+
+// DisplayPlaneAlphaFlagsKHR bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDisplayPlaneAlphaFlagsKHR.html
+type DisplayPlaneAlphaFlagsKHR Flags
+
+// Bits appends the DisplayPlaneAlphaFlagBitsKHR set in x to dst, lowest first.
+func (x DisplayPlaneAlphaFlagsKHR) Bits(dst []DisplayPlaneAlphaFlagBitsKHR) []DisplayPlaneAlphaFlagBitsKHR {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x DisplayPlaneAlphaFlagsKHR) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableDisplayPlaneAlphaFlagBitsKHR)
+}
+
+func (x DisplayPlaneAlphaFlagsKHR) String() string {
+	return flagsString(x, &enumTableDisplayPlaneAlphaFlagBitsKHR)
+}
+
+// ParseDisplayPlaneAlphaFlagsKHR parses the names of DisplayPlaneAlphaFlagBitsKHR values, or numbers,
+// separated by |.
+func ParseDisplayPlaneAlphaFlagsKHR(s string) (DisplayPlaneAlphaFlagsKHR, error) {
+	x, err := parseFlags(s, &enumTableDisplayPlaneAlphaFlagBitsKHR)
+	return DisplayPlaneAlphaFlagsKHR(x), err
+}
+
+// DisplayModeCreateFlagsKHR bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDisplayModeCreateFlagsKHR.html
+type DisplayModeCreateFlagsKHR Flags
+
+// DisplayModeParametersKHR provides a go interface for VkDisplayModeParametersKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDisplayModeParametersKHR.html
+type DisplayModeParametersKHR C.struct_VkDisplayModeParametersKHR
+
+// SizeofDisplayModeParametersKHR is the memory size of a DisplayModeParametersKHR
+var SizeofDisplayModeParametersKHR int = int(unsafe.Sizeof(DisplayModeParametersKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DisplayModeParametersKHR) ArpPtr(arp *AutoReleasePool) *DisplayModeParametersKHR {
+	ptr := newCBlock(cULong(SizeofDisplayModeParametersKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DisplayModeParametersKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DisplayModeParametersKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DisplayModeParametersKHR) AsCPtr() *DisplayModeParametersKHR {
+	clone := (*DisplayModeParametersKHR)(newCBlock(cULong(SizeofDisplayModeParametersKHR)))
+	*clone = x
+	return clone
+}
+
+// DisplayModeParametersKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DisplayModeParametersKHRCSlice(arp *AutoReleasePool, x ...DisplayModeParametersKHR) []DisplayModeParametersKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayModeParametersKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DisplayModeParametersKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DisplayModeParametersKHRFreeCSlice releases the memory allocated by DisplayModeParametersKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DisplayModeParametersKHRFreeCSlice(x []DisplayModeParametersKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DisplayModeParametersKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DisplayModeParametersKHRFreeCSlice must be called on the returned slice.
+func DisplayModeParametersKHRMakeCSlice(x ...DisplayModeParametersKHR) []DisplayModeParametersKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayModeParametersKHR * len(x)
+	dst := unsafe.Slice((*DisplayModeParametersKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// VisibleRegion returns the value of visibleRegion from VkDisplayModeParametersKHR
+func (x DisplayModeParametersKHR) VisibleRegion() Extent2D {
+	ptr := /* typedef */ (*Extent2D)(&x.visibleRegion)
+	return *ptr
+}
+
+// WithVisibleRegion clones a new DisplayModeParametersKHR with the value of
+// VisibleRegion updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayModeParametersKHR) WithVisibleRegion(y Extent2D) DisplayModeParametersKHR {
+	x.visibleRegion = *( /* typedef */ (*C.struct_VkExtent2D)(&y))
+	return x
+}
+func (x *DisplayModeParametersKHR) SetVisibleRegion(y Extent2D) {
+	x.visibleRegion = *( /* typedef */ (*C.struct_VkExtent2D)(&y))
+}
+
+// RefreshRate returns the value of refreshRate from VkDisplayModeParametersKHR
+func (x DisplayModeParametersKHR) RefreshRate() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.refreshRate)
+	return *ptr
+}
+
+// WithRefreshRate clones a new DisplayModeParametersKHR with the value of
+// RefreshRate updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayModeParametersKHR) WithRefreshRate(y uint32) DisplayModeParametersKHR {
+	x.refreshRate = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DisplayModeParametersKHR) SetRefreshRate(y uint32) {
+	x.refreshRate = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// DisplayModePropertiesKHR provides a go interface for VkDisplayModePropertiesKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDisplayModePropertiesKHR.html
+type DisplayModePropertiesKHR C.struct_VkDisplayModePropertiesKHR
+
+// SizeofDisplayModePropertiesKHR is the memory size of a DisplayModePropertiesKHR
+var SizeofDisplayModePropertiesKHR int = int(unsafe.Sizeof(DisplayModePropertiesKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DisplayModePropertiesKHR) ArpPtr(arp *AutoReleasePool) *DisplayModePropertiesKHR {
+	ptr := newCBlock(cULong(SizeofDisplayModePropertiesKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DisplayModePropertiesKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DisplayModePropertiesKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DisplayModePropertiesKHR) AsCPtr() *DisplayModePropertiesKHR {
+	clone := (*DisplayModePropertiesKHR)(newCBlock(cULong(SizeofDisplayModePropertiesKHR)))
+	*clone = x
+	return clone
+}
+
+// DisplayModePropertiesKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DisplayModePropertiesKHRCSlice(arp *AutoReleasePool, x ...DisplayModePropertiesKHR) []DisplayModePropertiesKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayModePropertiesKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DisplayModePropertiesKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DisplayModePropertiesKHRFreeCSlice releases the memory allocated by DisplayModePropertiesKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DisplayModePropertiesKHRFreeCSlice(x []DisplayModePropertiesKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DisplayModePropertiesKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DisplayModePropertiesKHRFreeCSlice must be called on the returned slice.
+func DisplayModePropertiesKHRMakeCSlice(x ...DisplayModePropertiesKHR) []DisplayModePropertiesKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayModePropertiesKHR * len(x)
+	dst := unsafe.Slice((*DisplayModePropertiesKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DisplayMode returns the value of displayMode from VkDisplayModePropertiesKHR
+func (x DisplayModePropertiesKHR) DisplayMode() DisplayModeKHR {
+	ptr := /* handle */ (*DisplayModeKHR)(&x.displayMode)
+	return *ptr
+}
+
+// Parameters returns the value of parameters from VkDisplayModePropertiesKHR
+func (x DisplayModePropertiesKHR) Parameters() DisplayModeParametersKHR {
+	ptr := /* typedef */ (*DisplayModeParametersKHR)(&x.parameters)
+	return *ptr
+}
+
+// DisplayPlaneCapabilitiesKHR provides a go interface for VkDisplayPlaneCapabilitiesKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDisplayPlaneCapabilitiesKHR.html
+type DisplayPlaneCapabilitiesKHR C.struct_VkDisplayPlaneCapabilitiesKHR
+
+// SizeofDisplayPlaneCapabilitiesKHR is the memory size of a DisplayPlaneCapabilitiesKHR
+var SizeofDisplayPlaneCapabilitiesKHR int = int(unsafe.Sizeof(DisplayPlaneCapabilitiesKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DisplayPlaneCapabilitiesKHR) ArpPtr(arp *AutoReleasePool) *DisplayPlaneCapabilitiesKHR {
+	ptr := newCBlock(cULong(SizeofDisplayPlaneCapabilitiesKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DisplayPlaneCapabilitiesKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DisplayPlaneCapabilitiesKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DisplayPlaneCapabilitiesKHR) AsCPtr() *DisplayPlaneCapabilitiesKHR {
+	clone := (*DisplayPlaneCapabilitiesKHR)(newCBlock(cULong(SizeofDisplayPlaneCapabilitiesKHR)))
+	*clone = x
+	return clone
+}
+
+// DisplayPlaneCapabilitiesKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DisplayPlaneCapabilitiesKHRCSlice(arp *AutoReleasePool, x ...DisplayPlaneCapabilitiesKHR) []DisplayPlaneCapabilitiesKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayPlaneCapabilitiesKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DisplayPlaneCapabilitiesKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DisplayPlaneCapabilitiesKHRFreeCSlice releases the memory allocated by DisplayPlaneCapabilitiesKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DisplayPlaneCapabilitiesKHRFreeCSlice(x []DisplayPlaneCapabilitiesKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DisplayPlaneCapabilitiesKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DisplayPlaneCapabilitiesKHRFreeCSlice must be called on the returned slice.
+func DisplayPlaneCapabilitiesKHRMakeCSlice(x ...DisplayPlaneCapabilitiesKHR) []DisplayPlaneCapabilitiesKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayPlaneCapabilitiesKHR * len(x)
+	dst := unsafe.Slice((*DisplayPlaneCapabilitiesKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SupportedAlpha returns the value of supportedAlpha from VkDisplayPlaneCapabilitiesKHR
+func (x *DisplayPlaneCapabilitiesKHR) SupportedAlpha() DisplayPlaneAlphaFlagsKHR {
+	ptr := /* typedef */ (*DisplayPlaneAlphaFlagsKHR)(&x.supportedAlpha)
+	return *ptr
+}
+
+// MinSrcPosition returns the value of minSrcPosition from VkDisplayPlaneCapabilitiesKHR
+func (x *DisplayPlaneCapabilitiesKHR) MinSrcPosition() Offset2D {
+	ptr := /* typedef */ (*Offset2D)(&x.minSrcPosition)
+	return *ptr
+}
+
+// MaxSrcPosition returns the value of maxSrcPosition from VkDisplayPlaneCapabilitiesKHR
+func (x *DisplayPlaneCapabilitiesKHR) MaxSrcPosition() Offset2D {
+	ptr := /* typedef */ (*Offset2D)(&x.maxSrcPosition)
+	return *ptr
+}
+
+// MinSrcExtent returns the value of minSrcExtent from VkDisplayPlaneCapabilitiesKHR
+func (x *DisplayPlaneCapabilitiesKHR) MinSrcExtent() Extent2D {
+	ptr := /* typedef */ (*Extent2D)(&x.minSrcExtent)
+	return *ptr
+}
+
+// MaxSrcExtent returns the value of maxSrcExtent from VkDisplayPlaneCapabilitiesKHR
+func (x *DisplayPlaneCapabilitiesKHR) MaxSrcExtent() Extent2D {
+	ptr := /* typedef */ (*Extent2D)(&x.maxSrcExtent)
+	return *ptr
+}
+
+// MinDstPosition returns the value of minDstPosition from VkDisplayPlaneCapabilitiesKHR
+func (x *DisplayPlaneCapabilitiesKHR) MinDstPosition() Offset2D {
+	ptr := /* typedef */ (*Offset2D)(&x.minDstPosition)
+	return *ptr
+}
+
+// MaxDstPosition returns the value of maxDstPosition from VkDisplayPlaneCapabilitiesKHR
+func (x *DisplayPlaneCapabilitiesKHR) MaxDstPosition() Offset2D {
+	ptr := /* typedef */ (*Offset2D)(&x.maxDstPosition)
+	return *ptr
+}
+
+// MinDstExtent returns the value of minDstExtent from VkDisplayPlaneCapabilitiesKHR
+func (x *DisplayPlaneCapabilitiesKHR) MinDstExtent() Extent2D {
+	ptr := /* typedef */ (*Extent2D)(&x.minDstExtent)
+	return *ptr
+}
+
+// MaxDstExtent returns the value of maxDstExtent from VkDisplayPlaneCapabilitiesKHR
+func (x *DisplayPlaneCapabilitiesKHR) MaxDstExtent() Extent2D {
+	ptr := /* typedef */ (*Extent2D)(&x.maxDstExtent)
+	return *ptr
+}
+
+// DisplaySurfaceCreateInfoKHR provides a go interface for VkDisplaySurfaceCreateInfoKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDisplaySurfaceCreateInfoKHR.html
+type DisplaySurfaceCreateInfoKHR C.struct_VkDisplaySurfaceCreateInfoKHR
+
+// SizeofDisplaySurfaceCreateInfoKHR is the memory size of a DisplaySurfaceCreateInfoKHR
+var SizeofDisplaySurfaceCreateInfoKHR int = int(unsafe.Sizeof(DisplaySurfaceCreateInfoKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DisplaySurfaceCreateInfoKHR) ArpPtr(arp *AutoReleasePool) *DisplaySurfaceCreateInfoKHR {
+	ptr := newCBlock(cULong(SizeofDisplaySurfaceCreateInfoKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DisplaySurfaceCreateInfoKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DisplaySurfaceCreateInfoKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DisplaySurfaceCreateInfoKHR) AsCPtr() *DisplaySurfaceCreateInfoKHR {
+	clone := (*DisplaySurfaceCreateInfoKHR)(newCBlock(cULong(SizeofDisplaySurfaceCreateInfoKHR)))
+	*clone = x
+	return clone
+}
+
+// DisplaySurfaceCreateInfoKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DisplaySurfaceCreateInfoKHRCSlice(arp *AutoReleasePool, x ...DisplaySurfaceCreateInfoKHR) []DisplaySurfaceCreateInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplaySurfaceCreateInfoKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DisplaySurfaceCreateInfoKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DisplaySurfaceCreateInfoKHRFreeCSlice releases the memory allocated by DisplaySurfaceCreateInfoKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DisplaySurfaceCreateInfoKHRFreeCSlice(x []DisplaySurfaceCreateInfoKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DisplaySurfaceCreateInfoKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DisplaySurfaceCreateInfoKHRFreeCSlice must be called on the returned slice.
+func DisplaySurfaceCreateInfoKHRMakeCSlice(x ...DisplaySurfaceCreateInfoKHR) []DisplaySurfaceCreateInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplaySurfaceCreateInfoKHR * len(x)
+	dst := unsafe.Slice((*DisplaySurfaceCreateInfoKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDisplaySurfaceCreateInfoKHR
+func (x DisplaySurfaceCreateInfoKHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DisplaySurfaceCreateInfoKHR with the value of
+// SType to the value provided in the specification.
+func (x DisplaySurfaceCreateInfoKHR) WithDefaultSType() DisplaySurfaceCreateInfoKHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_DISPLAY_SURFACE_CREATE_INFO_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DisplaySurfaceCreateInfoKHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DISPLAY_SURFACE_CREATE_INFO_KHR)
+}
+
+// WithSType clones a new DisplaySurfaceCreateInfoKHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplaySurfaceCreateInfoKHR) WithSType(y StructureType) DisplaySurfaceCreateInfoKHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DisplaySurfaceCreateInfoKHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDisplaySurfaceCreateInfoKHR
+func (x DisplaySurfaceCreateInfoKHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DisplaySurfaceCreateInfoKHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplaySurfaceCreateInfoKHR) WithPNext(y unsafe.Pointer) DisplaySurfaceCreateInfoKHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DisplaySurfaceCreateInfoKHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DisplaySurfaceCreateInfoKHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Flags returns the value of flags from VkDisplaySurfaceCreateInfoKHR
+func (x DisplaySurfaceCreateInfoKHR) Flags() DisplaySurfaceCreateFlagsKHR {
+	ptr := /* typedef */ (*DisplaySurfaceCreateFlagsKHR)(&x.flags)
+	return *ptr
+}
+
+// WithFlags clones a new DisplaySurfaceCreateInfoKHR with the value of
+// Flags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplaySurfaceCreateInfoKHR) WithFlags(y DisplaySurfaceCreateFlagsKHR) DisplaySurfaceCreateInfoKHR {
+	x.flags = *( /* typedef */ (*C.VkDisplaySurfaceCreateFlagsKHR)(&y))
+	return x
+}
+func (x *DisplaySurfaceCreateInfoKHR) SetFlags(y DisplaySurfaceCreateFlagsKHR) {
+	x.flags = *( /* typedef */ (*C.VkDisplaySurfaceCreateFlagsKHR)(&y))
+}
+
+// DisplayMode returns the value of displayMode from VkDisplaySurfaceCreateInfoKHR
+func (x DisplaySurfaceCreateInfoKHR) DisplayMode() DisplayModeKHR {
+	ptr := /* handle */ (*DisplayModeKHR)(&x.displayMode)
+	return *ptr
+}
+
+// WithDisplayMode clones a new DisplaySurfaceCreateInfoKHR with the value of
+// DisplayMode updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplaySurfaceCreateInfoKHR) WithDisplayMode(y DisplayModeKHR) DisplaySurfaceCreateInfoKHR {
+	x.displayMode = *( /* handle */ (*C.VkDisplayModeKHR)(&y))
+	return x
+}
+func (x *DisplaySurfaceCreateInfoKHR) SetDisplayMode(y DisplayModeKHR) {
+	x.displayMode = *( /* handle */ (*C.VkDisplayModeKHR)(&y))
+}
+
+// PlaneIndex returns the value of planeIndex from VkDisplaySurfaceCreateInfoKHR
+func (x DisplaySurfaceCreateInfoKHR) PlaneIndex() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.planeIndex)
+	return *ptr
+}
+
+// WithPlaneIndex clones a new DisplaySurfaceCreateInfoKHR with the value of
+// PlaneIndex updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplaySurfaceCreateInfoKHR) WithPlaneIndex(y uint32) DisplaySurfaceCreateInfoKHR {
+	x.planeIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DisplaySurfaceCreateInfoKHR) SetPlaneIndex(y uint32) {
+	x.planeIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PlaneStackIndex returns the value of planeStackIndex from VkDisplaySurfaceCreateInfoKHR
+func (x DisplaySurfaceCreateInfoKHR) PlaneStackIndex() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.planeStackIndex)
+	return *ptr
+}
+
+// WithPlaneStackIndex clones a new DisplaySurfaceCreateInfoKHR with the value of
+// PlaneStackIndex updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplaySurfaceCreateInfoKHR) WithPlaneStackIndex(y uint32) DisplaySurfaceCreateInfoKHR {
+	x.planeStackIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DisplaySurfaceCreateInfoKHR) SetPlaneStackIndex(y uint32) {
+	x.planeStackIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// Transform returns the value of transform from VkDisplaySurfaceCreateInfoKHR
+func (x DisplaySurfaceCreateInfoKHR) Transform() SurfaceTransformFlagBitsKHR {
+	ptr := /* typedef */ (*SurfaceTransformFlagBitsKHR)(&x.transform)
+	return *ptr
+}
+
+// WithTransform clones a new DisplaySurfaceCreateInfoKHR with the value of
+// Transform updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplaySurfaceCreateInfoKHR) WithTransform(y SurfaceTransformFlagBitsKHR) DisplaySurfaceCreateInfoKHR {
+	x.transform = *( /* typedef */ (*C.VkSurfaceTransformFlagBitsKHR)(&y))
+	return x
+}
+func (x *DisplaySurfaceCreateInfoKHR) SetTransform(y SurfaceTransformFlagBitsKHR) {
+	x.transform = *( /* typedef */ (*C.VkSurfaceTransformFlagBitsKHR)(&y))
+}
+
+// GlobalAlpha returns the value of globalAlpha from VkDisplaySurfaceCreateInfoKHR
+func (x DisplaySurfaceCreateInfoKHR) GlobalAlpha() float32 {
+	ptr := func(x *C.float) *float32 { /* Scalar */ c2g := float32(*x); return &c2g }(&x.globalAlpha)
+	return *ptr
+}
+
+// WithGlobalAlpha clones a new DisplaySurfaceCreateInfoKHR with the value of
+// GlobalAlpha updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplaySurfaceCreateInfoKHR) WithGlobalAlpha(y float32) DisplaySurfaceCreateInfoKHR {
+	x.globalAlpha = *(func(x *float32) *C.float { /* Scalar */ g2c := C.float(*x); return &g2c }(&y))
+	return x
+}
+func (x *DisplaySurfaceCreateInfoKHR) SetGlobalAlpha(y float32) {
+	x.globalAlpha = *(func(x *float32) *C.float { /* Scalar */ g2c := C.float(*x); return &g2c }(&y))
+}
+
+// AlphaMode returns the value of alphaMode from VkDisplaySurfaceCreateInfoKHR
+func (x DisplaySurfaceCreateInfoKHR) AlphaMode() DisplayPlaneAlphaFlagBitsKHR {
+	ptr := /* typedef */ (*DisplayPlaneAlphaFlagBitsKHR)(&x.alphaMode)
+	return *ptr
+}
+
+// WithAlphaMode clones a new DisplaySurfaceCreateInfoKHR with the value of
+// AlphaMode updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplaySurfaceCreateInfoKHR) WithAlphaMode(y DisplayPlaneAlphaFlagBitsKHR) DisplaySurfaceCreateInfoKHR {
+	x.alphaMode = *( /* typedef */ (*C.VkDisplayPlaneAlphaFlagBitsKHR)(&y))
+	return x
+}
+func (x *DisplaySurfaceCreateInfoKHR) SetAlphaMode(y DisplayPlaneAlphaFlagBitsKHR) {
+	x.alphaMode = *( /* typedef */ (*C.VkDisplayPlaneAlphaFlagBitsKHR)(&y))
+}
+
+// ImageExtent returns the value of imageExtent from VkDisplaySurfaceCreateInfoKHR
+func (x DisplaySurfaceCreateInfoKHR) ImageExtent() Extent2D {
+	ptr := /* typedef */ (*Extent2D)(&x.imageExtent)
+	return *ptr
+}
+
+// WithImageExtent clones a new DisplaySurfaceCreateInfoKHR with the value of
+// ImageExtent updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplaySurfaceCreateInfoKHR) WithImageExtent(y Extent2D) DisplaySurfaceCreateInfoKHR {
+	x.imageExtent = *( /* typedef */ (*C.struct_VkExtent2D)(&y))
+	return x
+}
+func (x *DisplaySurfaceCreateInfoKHR) SetImageExtent(y Extent2D) {
+	x.imageExtent = *( /* typedef */ (*C.struct_VkExtent2D)(&y))
+}
+
+// DisplayModeCreateInfoKHR provides a go interface for VkDisplayModeCreateInfoKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDisplayModeCreateInfoKHR.html
+type DisplayModeCreateInfoKHR C.struct_VkDisplayModeCreateInfoKHR
+
+// SizeofDisplayModeCreateInfoKHR is the memory size of a DisplayModeCreateInfoKHR
+var SizeofDisplayModeCreateInfoKHR int = int(unsafe.Sizeof(DisplayModeCreateInfoKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DisplayModeCreateInfoKHR) ArpPtr(arp *AutoReleasePool) *DisplayModeCreateInfoKHR {
+	ptr := newCBlock(cULong(SizeofDisplayModeCreateInfoKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DisplayModeCreateInfoKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DisplayModeCreateInfoKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DisplayModeCreateInfoKHR) AsCPtr() *DisplayModeCreateInfoKHR {
+	clone := (*DisplayModeCreateInfoKHR)(newCBlock(cULong(SizeofDisplayModeCreateInfoKHR)))
+	*clone = x
+	return clone
+}
+
+// DisplayModeCreateInfoKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DisplayModeCreateInfoKHRCSlice(arp *AutoReleasePool, x ...DisplayModeCreateInfoKHR) []DisplayModeCreateInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayModeCreateInfoKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DisplayModeCreateInfoKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DisplayModeCreateInfoKHRFreeCSlice releases the memory allocated by DisplayModeCreateInfoKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DisplayModeCreateInfoKHRFreeCSlice(x []DisplayModeCreateInfoKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DisplayModeCreateInfoKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DisplayModeCreateInfoKHRFreeCSlice must be called on the returned slice.
+func DisplayModeCreateInfoKHRMakeCSlice(x ...DisplayModeCreateInfoKHR) []DisplayModeCreateInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayModeCreateInfoKHR * len(x)
+	dst := unsafe.Slice((*DisplayModeCreateInfoKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDisplayModeCreateInfoKHR
+func (x DisplayModeCreateInfoKHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DisplayModeCreateInfoKHR with the value of
+// SType to the value provided in the specification.
+func (x DisplayModeCreateInfoKHR) WithDefaultSType() DisplayModeCreateInfoKHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_DISPLAY_MODE_CREATE_INFO_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DisplayModeCreateInfoKHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DISPLAY_MODE_CREATE_INFO_KHR)
+}
+
+// WithSType clones a new DisplayModeCreateInfoKHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayModeCreateInfoKHR) WithSType(y StructureType) DisplayModeCreateInfoKHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DisplayModeCreateInfoKHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDisplayModeCreateInfoKHR
+func (x DisplayModeCreateInfoKHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DisplayModeCreateInfoKHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayModeCreateInfoKHR) WithPNext(y unsafe.Pointer) DisplayModeCreateInfoKHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DisplayModeCreateInfoKHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DisplayModeCreateInfoKHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Flags returns the value of flags from VkDisplayModeCreateInfoKHR
+func (x DisplayModeCreateInfoKHR) Flags() DisplayModeCreateFlagsKHR {
+	ptr := /* typedef */ (*DisplayModeCreateFlagsKHR)(&x.flags)
+	return *ptr
+}
+
+// WithFlags clones a new DisplayModeCreateInfoKHR with the value of
+// Flags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayModeCreateInfoKHR) WithFlags(y DisplayModeCreateFlagsKHR) DisplayModeCreateInfoKHR {
+	x.flags = *( /* typedef */ (*C.VkDisplayModeCreateFlagsKHR)(&y))
+	return x
+}
+func (x *DisplayModeCreateInfoKHR) SetFlags(y DisplayModeCreateFlagsKHR) {
+	x.flags = *( /* typedef */ (*C.VkDisplayModeCreateFlagsKHR)(&y))
+}
+
+// Parameters returns the value of parameters from VkDisplayModeCreateInfoKHR
+func (x DisplayModeCreateInfoKHR) Parameters() DisplayModeParametersKHR {
+	ptr := /* typedef */ (*DisplayModeParametersKHR)(&x.parameters)
+	return *ptr
+}
+
+// WithParameters clones a new DisplayModeCreateInfoKHR with the value of
+// Parameters updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayModeCreateInfoKHR) WithParameters(y DisplayModeParametersKHR) DisplayModeCreateInfoKHR {
+	x.parameters = *( /* typedef */ (*C.struct_VkDisplayModeParametersKHR)(&y))
+	return x
+}
+func (x *DisplayModeCreateInfoKHR) SetParameters(y DisplayModeParametersKHR) {
+	x.parameters = *( /* typedef */ (*C.struct_VkDisplayModeParametersKHR)(&y))
+}
+
+// DisplayPropertiesKHR provides a go interface for VkDisplayPropertiesKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDisplayPropertiesKHR.html
+type DisplayPropertiesKHR C.struct_VkDisplayPropertiesKHR
+
+// SizeofDisplayPropertiesKHR is the memory size of a DisplayPropertiesKHR
+var SizeofDisplayPropertiesKHR int = int(unsafe.Sizeof(DisplayPropertiesKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DisplayPropertiesKHR) ArpPtr(arp *AutoReleasePool) *DisplayPropertiesKHR {
+	ptr := newCBlock(cULong(SizeofDisplayPropertiesKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DisplayPropertiesKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DisplayPropertiesKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DisplayPropertiesKHR) AsCPtr() *DisplayPropertiesKHR {
+	clone := (*DisplayPropertiesKHR)(newCBlock(cULong(SizeofDisplayPropertiesKHR)))
+	*clone = x
+	return clone
+}
+
+// DisplayPropertiesKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DisplayPropertiesKHRCSlice(arp *AutoReleasePool, x ...DisplayPropertiesKHR) []DisplayPropertiesKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayPropertiesKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DisplayPropertiesKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DisplayPropertiesKHRFreeCSlice releases the memory allocated by DisplayPropertiesKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DisplayPropertiesKHRFreeCSlice(x []DisplayPropertiesKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DisplayPropertiesKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DisplayPropertiesKHRFreeCSlice must be called on the returned slice.
+func DisplayPropertiesKHRMakeCSlice(x ...DisplayPropertiesKHR) []DisplayPropertiesKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayPropertiesKHR * len(x)
+	dst := unsafe.Slice((*DisplayPropertiesKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// Display returns the value of display from VkDisplayPropertiesKHR
+func (x DisplayPropertiesKHR) Display() DisplayKHR {
+	ptr := /* handle */ (*DisplayKHR)(&x.display)
+	return *ptr
+}
+
+// DisplayName returns the value of displayName from VkDisplayPropertiesKHR
+func (x DisplayPropertiesKHR) DisplayName() *byte {
+	ptr := func(x **C.char) **byte { /* Pointer */ return (**byte)(unsafe.Pointer(x)) }(&x.displayName)
+	return *ptr
+}
+
+// PhysicalDimensions returns the value of physicalDimensions from VkDisplayPropertiesKHR
+func (x DisplayPropertiesKHR) PhysicalDimensions() Extent2D {
+	ptr := /* typedef */ (*Extent2D)(&x.physicalDimensions)
+	return *ptr
+}
+
+// PhysicalResolution returns the value of physicalResolution from VkDisplayPropertiesKHR
+func (x DisplayPropertiesKHR) PhysicalResolution() Extent2D {
+	ptr := /* typedef */ (*Extent2D)(&x.physicalResolution)
+	return *ptr
+}
+
+// SupportedTransforms returns the value of supportedTransforms from VkDisplayPropertiesKHR
+func (x DisplayPropertiesKHR) SupportedTransforms() SurfaceTransformFlagsKHR {
+	ptr := /* typedef */ (*SurfaceTransformFlagsKHR)(&x.supportedTransforms)
+	return *ptr
+}
+
+// PlaneReorderPossible returns the value of planeReorderPossible from VkDisplayPropertiesKHR
+func (x DisplayPropertiesKHR) PlaneReorderPossible() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.planeReorderPossible)
+	return *ptr
+}
+
+// PersistentContent returns the value of persistentContent from VkDisplayPropertiesKHR
+func (x DisplayPropertiesKHR) PersistentContent() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.persistentContent)
+	return *ptr
+}
+
+// DisplayPlanePropertiesKHR provides a go interface for VkDisplayPlanePropertiesKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDisplayPlanePropertiesKHR.html
+type DisplayPlanePropertiesKHR C.struct_VkDisplayPlanePropertiesKHR
+
+// SizeofDisplayPlanePropertiesKHR is the memory size of a DisplayPlanePropertiesKHR
+var SizeofDisplayPlanePropertiesKHR int = int(unsafe.Sizeof(DisplayPlanePropertiesKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DisplayPlanePropertiesKHR) ArpPtr(arp *AutoReleasePool) *DisplayPlanePropertiesKHR {
+	ptr := newCBlock(cULong(SizeofDisplayPlanePropertiesKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DisplayPlanePropertiesKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DisplayPlanePropertiesKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DisplayPlanePropertiesKHR) AsCPtr() *DisplayPlanePropertiesKHR {
+	clone := (*DisplayPlanePropertiesKHR)(newCBlock(cULong(SizeofDisplayPlanePropertiesKHR)))
+	*clone = x
+	return clone
+}
+
+// DisplayPlanePropertiesKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DisplayPlanePropertiesKHRCSlice(arp *AutoReleasePool, x ...DisplayPlanePropertiesKHR) []DisplayPlanePropertiesKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayPlanePropertiesKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DisplayPlanePropertiesKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DisplayPlanePropertiesKHRFreeCSlice releases the memory allocated by DisplayPlanePropertiesKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DisplayPlanePropertiesKHRFreeCSlice(x []DisplayPlanePropertiesKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DisplayPlanePropertiesKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DisplayPlanePropertiesKHRFreeCSlice must be called on the returned slice.
+func DisplayPlanePropertiesKHRMakeCSlice(x ...DisplayPlanePropertiesKHR) []DisplayPlanePropertiesKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayPlanePropertiesKHR * len(x)
+	dst := unsafe.Slice((*DisplayPlanePropertiesKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// CurrentDisplay returns the value of currentDisplay from VkDisplayPlanePropertiesKHR
+func (x DisplayPlanePropertiesKHR) CurrentDisplay() DisplayKHR {
+	ptr := /* handle */ (*DisplayKHR)(&x.currentDisplay)
+	return *ptr
+}
+
+// CurrentStackIndex returns the value of currentStackIndex from VkDisplayPlanePropertiesKHR
+func (x DisplayPlanePropertiesKHR) CurrentStackIndex() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.currentStackIndex)
+	return *ptr
+}
+
+// GetPhysicalDeviceDisplayPropertiesKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPhysicalDeviceDisplayPropertiesKHR.html
+func (x PhysicalDeviceFacade) GetPhysicalDeviceDisplayPropertiesKHR(pPropertyCount *uint32, pProperties []DisplayPropertiesKHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := func(x **uint32) **C.uint32_t { /* Pointer */ g2c := (*C.uint32_t)(*x); return &g2c }(&pPropertyCount)
+	p2 := func(x *[]DisplayPropertiesKHR) **C.struct_VkDisplayPropertiesKHR { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkDisplayPropertiesKHR)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkDisplayPropertiesKHR)(unsafe.Pointer((&ptr)))
+	}(&pProperties)
+	ret := C.vkGetPhysicalDeviceDisplayPropertiesKHR(addrs, *p0, *p1, *p2)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetPhysicalDeviceDisplayPropertiesKHRInto calls GetPhysicalDeviceDisplayPropertiesKHR with the count query, the fill and
+// the VK_INCOMPLETE retries in a single cgo call. The elements are stored in
+// dst, reallocated only when its capacity is too small, and returned.
+func (x PhysicalDeviceFacade) GetPhysicalDeviceDisplayPropertiesKHRInto(dst []DisplayPropertiesKHR) ([]DisplayPropertiesKHR, Result) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	for {
+		dst = dst[:cap(dst)]
+		var items *C.struct_VkDisplayPropertiesKHR
+		if len(dst) > 0 {
+			items = (*C.struct_VkDisplayPropertiesKHR)(unsafe.Pointer(&dst[0]))
+		}
+		ret := C.vksEnumerate_vkGetPhysicalDeviceDisplayPropertiesKHR(addrs, C.uint64_t(uintptr(unsafe.Pointer(*p0))), C.uint32_t(len(dst)), items)
+		if Result(ret.result) == VK_INCOMPLETE && int(ret.count) > len(dst) {
+			dst = make([]DisplayPropertiesKHR, ret.count)
+			continue
+		}
+		return dst[:ret.count], Result(ret.result)
+	}
+}
+
+// GetDisplayPlaneCapabilitiesKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetDisplayPlaneCapabilitiesKHR.html
+func (x PhysicalDeviceFacade) GetDisplayPlaneCapabilitiesKHR(mode DisplayModeKHR, planeIndex uint32, pCapabilities *DisplayPlaneCapabilitiesKHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := /* handle */ (*C.VkDisplayModeKHR)(&mode)
+	p2 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&planeIndex)
+	p3 := func(x **DisplayPlaneCapabilitiesKHR) **C.struct_VkDisplayPlaneCapabilitiesKHR { /* Pointer */
+		g2c := (*C.struct_VkDisplayPlaneCapabilitiesKHR)(*x)
+		return &g2c
+	}(&pCapabilities)
+	ret := C.vkGetDisplayPlaneCapabilitiesKHR(addrs, *p0, *p1, *p2, *p3)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetPhysicalDeviceDisplayPlanePropertiesKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPhysicalDeviceDisplayPlanePropertiesKHR.html
+func (x PhysicalDeviceFacade) GetPhysicalDeviceDisplayPlanePropertiesKHR(pPropertyCount *uint32, pProperties []DisplayPlanePropertiesKHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := func(x **uint32) **C.uint32_t { /* Pointer */ g2c := (*C.uint32_t)(*x); return &g2c }(&pPropertyCount)
+	p2 := func(x *[]DisplayPlanePropertiesKHR) **C.struct_VkDisplayPlanePropertiesKHR { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkDisplayPlanePropertiesKHR)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkDisplayPlanePropertiesKHR)(unsafe.Pointer((&ptr)))
+	}(&pProperties)
+	ret := C.vkGetPhysicalDeviceDisplayPlanePropertiesKHR(addrs, *p0, *p1, *p2)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetPhysicalDeviceDisplayPlanePropertiesKHRInto calls GetPhysicalDeviceDisplayPlanePropertiesKHR with the count query, the fill and
+// the VK_INCOMPLETE retries in a single cgo call. The elements are stored in
+// dst, reallocated only when its capacity is too small, and returned.
+func (x PhysicalDeviceFacade) GetPhysicalDeviceDisplayPlanePropertiesKHRInto(dst []DisplayPlanePropertiesKHR) ([]DisplayPlanePropertiesKHR, Result) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	for {
+		dst = dst[:cap(dst)]
+		var items *C.struct_VkDisplayPlanePropertiesKHR
+		if len(dst) > 0 {
+			items = (*C.struct_VkDisplayPlanePropertiesKHR)(unsafe.Pointer(&dst[0]))
+		}
+		ret := C.vksEnumerate_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(addrs, C.uint64_t(uintptr(unsafe.Pointer(*p0))), C.uint32_t(len(dst)), items)
+		if Result(ret.result) == VK_INCOMPLETE && int(ret.count) > len(dst) {
+			dst = make([]DisplayPlanePropertiesKHR, ret.count)
+			continue
+		}
+		return dst[:ret.count], Result(ret.result)
+	}
+}
+
+// CreateDisplayModeKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCreateDisplayModeKHR.html
+func (x PhysicalDeviceFacade) CreateDisplayModeKHR(display DisplayKHR, pCreateInfo *DisplayModeCreateInfoKHR, pAllocator *AllocationCallbacks, pMode *DisplayModeKHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := /* handle */ (*C.VkDisplayKHR)(&display)
+	p2 := func(x **DisplayModeCreateInfoKHR) **C.struct_VkDisplayModeCreateInfoKHR { /* Pointer */
+		g2c := (*C.struct_VkDisplayModeCreateInfoKHR)(*x)
+		return &g2c
+	}(&pCreateInfo)
+	p3 := func(x **AllocationCallbacks) **C.struct_VkAllocationCallbacks { /* Pointer */
+		g2c := (*C.struct_VkAllocationCallbacks)(*x)
+		return &g2c
+	}(&pAllocator)
+	p4 := func(x **DisplayModeKHR) **C.VkDisplayModeKHR { /* Pointer */
+		g2c := (*C.VkDisplayModeKHR)(*x)
+		return &g2c
+	}(&pMode)
+	ret := C.vkCreateDisplayModeKHR(addrs, *p0, *p1, *p2, *p3, *p4)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetDisplayModePropertiesKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetDisplayModePropertiesKHR.html
+func (x PhysicalDeviceFacade) GetDisplayModePropertiesKHR(display DisplayKHR, pPropertyCount *uint32, pProperties []DisplayModePropertiesKHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := /* handle */ (*C.VkDisplayKHR)(&display)
+	p2 := func(x **uint32) **C.uint32_t { /* Pointer */ g2c := (*C.uint32_t)(*x); return &g2c }(&pPropertyCount)
+	p3 := func(x *[]DisplayModePropertiesKHR) **C.struct_VkDisplayModePropertiesKHR { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkDisplayModePropertiesKHR)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkDisplayModePropertiesKHR)(unsafe.Pointer((&ptr)))
+	}(&pProperties)
+	ret := C.vkGetDisplayModePropertiesKHR(addrs, *p0, *p1, *p2, *p3)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetDisplayModePropertiesKHRInto calls GetDisplayModePropertiesKHR with the count query, the fill and
+// the VK_INCOMPLETE retries in a single cgo call. The elements are stored in
+// dst, reallocated only when its capacity is too small, and returned.
+func (x PhysicalDeviceFacade) GetDisplayModePropertiesKHRInto(display DisplayKHR, dst []DisplayModePropertiesKHR) ([]DisplayModePropertiesKHR, Result) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := /* handle */ (*C.VkDisplayKHR)(&display)
+	for {
+		dst = dst[:cap(dst)]
+		var items *C.struct_VkDisplayModePropertiesKHR
+		if len(dst) > 0 {
+			items = (*C.struct_VkDisplayModePropertiesKHR)(unsafe.Pointer(&dst[0]))
+		}
+		ret := C.vksEnumerate_vkGetDisplayModePropertiesKHR(addrs, C.uint64_t(uintptr(unsafe.Pointer(*p0))), C.uint64_t(uintptr(unsafe.Pointer(*p1))), C.uint32_t(len(dst)), items)
+		if Result(ret.result) == VK_INCOMPLETE && int(ret.count) > len(dst) {
+			dst = make([]DisplayModePropertiesKHR, ret.count)
+			continue
+		}
+		return dst[:ret.count], Result(ret.result)
+	}
+}
+
+// CreateDisplayPlaneSurfaceKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCreateDisplayPlaneSurfaceKHR.html
+func (x InstanceFacade) CreateDisplayPlaneSurfaceKHR(pCreateInfo *DisplaySurfaceCreateInfoKHR, pAllocator *AllocationCallbacks, pSurface *SurfaceKHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkInstance)(&x.H)
+	p1 := func(x **DisplaySurfaceCreateInfoKHR) **C.struct_VkDisplaySurfaceCreateInfoKHR { /* Pointer */
+		g2c := (*C.struct_VkDisplaySurfaceCreateInfoKHR)(*x)
+		return &g2c
+	}(&pCreateInfo)
+	p2 := func(x **AllocationCallbacks) **C.struct_VkAllocationCallbacks { /* Pointer */
+		g2c := (*C.struct_VkAllocationCallbacks)(*x)
+		return &g2c
+	}(&pAllocator)
+	p3 := func(x **SurfaceKHR) **C.VkSurfaceKHR { /* Pointer */ g2c := (*C.VkSurfaceKHR)(*x); return &g2c }(&pSurface)
+	ret := C.vkCreateDisplayPlaneSurfaceKHR(addrs, *p0, *p1, *p2, *p3)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetDisplayPlaneSupportedDisplaysKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetDisplayPlaneSupportedDisplaysKHR.html
+func (x PhysicalDeviceFacade) GetDisplayPlaneSupportedDisplaysKHR(planeIndex uint32, pDisplayCount *uint32, pDisplays []DisplayKHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&planeIndex)
+	p2 := func(x **uint32) **C.uint32_t { /* Pointer */ g2c := (*C.uint32_t)(*x); return &g2c }(&pDisplayCount)
+	p3 := func(x *[]DisplayKHR) **C.VkDisplayKHR { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkDisplayKHR)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkDisplayKHR)(unsafe.Pointer((&ptr)))
+	}(&pDisplays)
+	ret := C.vkGetDisplayPlaneSupportedDisplaysKHR(addrs, *p0, *p1, *p2, *p3)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetDisplayPlaneSupportedDisplaysKHRInto calls GetDisplayPlaneSupportedDisplaysKHR with the count query, the fill and
+// the VK_INCOMPLETE retries in a single cgo call. The elements are stored in
+// dst, reallocated only when its capacity is too small, and returned.
+func (x PhysicalDeviceFacade) GetDisplayPlaneSupportedDisplaysKHRInto(planeIndex uint32, dst []DisplayKHR) ([]DisplayKHR, Result) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&planeIndex)
+	for {
+		dst = dst[:cap(dst)]
+		var items *C.VkDisplayKHR
+		if len(dst) > 0 {
+			items = (*C.VkDisplayKHR)(unsafe.Pointer(&dst[0]))
+		}
+		ret := C.vksEnumerate_vkGetDisplayPlaneSupportedDisplaysKHR(addrs, C.uint64_t(uintptr(unsafe.Pointer(*p0))), *p1, C.uint32_t(len(dst)), items)
+		if Result(ret.result) == VK_INCOMPLETE && int(ret.count) > len(dst) {
+			dst = make([]DisplayKHR, ret.count)
+			continue
+		}
+		return dst[:ret.count], Result(ret.result)
+	}
+}
@@ -0,0 +1,18 @@
+#ifndef __VKS_KHR_DISPLAY_H__
+#define __VKS_KHR_DISPLAY_H__
+#include "vk_wrapper.h"
+
+// Wrappers of VK_KHR_display.
+VkResult vkGetPhysicalDeviceDisplayPropertiesKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPropertiesKHR* pProperties);
+vksEnumerateResult vksEnumerate_vkGetPhysicalDeviceDisplayPropertiesKHR(vksProcAddr* addrs, uint64_t physicalDevice, uint32_t capacity, VkDisplayPropertiesKHR* pProperties);
+VkResult vkGetDisplayPlaneCapabilitiesKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkDisplayModeKHR mode, uint32_t planeIndex, VkDisplayPlaneCapabilitiesKHR* pCapabilities);
+VkResult vkGetPhysicalDeviceDisplayPlanePropertiesKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPlanePropertiesKHR* pProperties);
+vksEnumerateResult vksEnumerate_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(vksProcAddr* addrs, uint64_t physicalDevice, uint32_t capacity, VkDisplayPlanePropertiesKHR* pProperties);
+VkResult vkCreateDisplayModeKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkDisplayKHR display, VkDisplayModeCreateInfoKHR* pCreateInfo, VkAllocationCallbacks* pAllocator, VkDisplayModeKHR* pMode);
+VkResult vkGetDisplayModePropertiesKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t* pPropertyCount, VkDisplayModePropertiesKHR* pProperties);
+vksEnumerateResult vksEnumerate_vkGetDisplayModePropertiesKHR(vksProcAddr* addrs, uint64_t physicalDevice, uint64_t display, uint32_t capacity, VkDisplayModePropertiesKHR* pProperties);
+VkResult vkCreateDisplayPlaneSurfaceKHR(vksProcAddr* addrs, VkInstance instance, VkDisplaySurfaceCreateInfoKHR* pCreateInfo, VkAllocationCallbacks* pAllocator, VkSurfaceKHR* pSurface);
+VkResult vkGetDisplayPlaneSupportedDisplaysKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t planeIndex, uint32_t* pDisplayCount, VkDisplayKHR* pDisplays);
+vksEnumerateResult vksEnumerate_vkGetDisplayPlaneSupportedDisplaysKHR(vksProcAddr* addrs, uint64_t physicalDevice, uint32_t planeIndex, uint32_t capacity, VkDisplayKHR* pDisplays);
+
+#endif
\ No newline at end of file
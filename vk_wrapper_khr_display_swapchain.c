@@ -0,0 +1,13 @@
+//go:build !vks_no_khr_display_swapchain && !vks_no_khr_display && !vks_no_khr_surface && !vks_no_khr_swapchain && !vks_no_version_1_1
+
+// Wrappers of VK_KHR_display_swapchain.
+#include "vk_wrapper.h"
+#include "vk_capture.h"
+
+VkResult vkCreateSharedSwapchainsKHR(vksProcAddr* addrs, VkDevice device, uint32_t swapchainCount, VkSwapchainCreateInfoKHR* pCreateInfos, VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkCreateSharedSwapchainsKHR(addrs, device, swapchainCount, pCreateInfos, pAllocator, pSwapchains);
+	}
+	VkResult ret = (((PFN_vkCreateSharedSwapchainsKHR)addrs->pvkCreateSharedSwapchainsKHR)(device, swapchainCount, pCreateInfos, pAllocator, pSwapchains));
+	return ret;
+}
@@ -0,0 +1,220 @@
+//go:build !vks_no_khr_display_swapchain && !vks_no_khr_display && !vks_no_khr_surface && !vks_no_khr_swapchain && !vks_no_version_1_1
+
+package vks
+
+// Bindings of VK_KHR_display_swapchain, left out by the vks_no_khr_display_swapchain build tag.
+
+//#cgo CFLAGS: -DVKS_ENABLE_KHR_DISPLAY_SWAPCHAIN
+//#include "vk_wrapper.h"
+import "C"
+import (
+	"unsafe"
+)
+
+// DisplayPresentInfoKHR provides a go interface for VkDisplayPresentInfoKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDisplayPresentInfoKHR.html
+type DisplayPresentInfoKHR C.struct_VkDisplayPresentInfoKHR
+
+// SizeofDisplayPresentInfoKHR is the memory size of a DisplayPresentInfoKHR
+var SizeofDisplayPresentInfoKHR int = int(unsafe.Sizeof(DisplayPresentInfoKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DisplayPresentInfoKHR) ArpPtr(arp *AutoReleasePool) *DisplayPresentInfoKHR {
+	ptr := newCBlock(cULong(SizeofDisplayPresentInfoKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DisplayPresentInfoKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DisplayPresentInfoKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DisplayPresentInfoKHR) AsCPtr() *DisplayPresentInfoKHR {
+	clone := (*DisplayPresentInfoKHR)(newCBlock(cULong(SizeofDisplayPresentInfoKHR)))
+	*clone = x
+	return clone
+}
+
+// DisplayPresentInfoKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DisplayPresentInfoKHRCSlice(arp *AutoReleasePool, x ...DisplayPresentInfoKHR) []DisplayPresentInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayPresentInfoKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DisplayPresentInfoKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DisplayPresentInfoKHRFreeCSlice releases the memory allocated by DisplayPresentInfoKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DisplayPresentInfoKHRFreeCSlice(x []DisplayPresentInfoKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DisplayPresentInfoKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DisplayPresentInfoKHRFreeCSlice must be called on the returned slice.
+func DisplayPresentInfoKHRMakeCSlice(x ...DisplayPresentInfoKHR) []DisplayPresentInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayPresentInfoKHR * len(x)
+	dst := unsafe.Slice((*DisplayPresentInfoKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDisplayPresentInfoKHR
+func (x DisplayPresentInfoKHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DisplayPresentInfoKHR with the value of
+// SType to the value provided in the specification.
+func (x DisplayPresentInfoKHR) WithDefaultSType() DisplayPresentInfoKHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DisplayPresentInfoKHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR)
+}
+
+// WithSType clones a new DisplayPresentInfoKHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayPresentInfoKHR) WithSType(y StructureType) DisplayPresentInfoKHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DisplayPresentInfoKHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDisplayPresentInfoKHR
+func (x DisplayPresentInfoKHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DisplayPresentInfoKHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayPresentInfoKHR) WithPNext(y unsafe.Pointer) DisplayPresentInfoKHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DisplayPresentInfoKHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DisplayPresentInfoKHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SrcRect returns the value of srcRect from VkDisplayPresentInfoKHR
+func (x DisplayPresentInfoKHR) SrcRect() Rect2D {
+	ptr := /* typedef */ (*Rect2D)(&x.srcRect)
+	return *ptr
+}
+
+// WithSrcRect clones a new DisplayPresentInfoKHR with the value of
+// SrcRect updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayPresentInfoKHR) WithSrcRect(y Rect2D) DisplayPresentInfoKHR {
+	x.srcRect = *( /* typedef */ (*C.struct_VkRect2D)(&y))
+	return x
+}
+func (x *DisplayPresentInfoKHR) SetSrcRect(y Rect2D) {
+	x.srcRect = *( /* typedef */ (*C.struct_VkRect2D)(&y))
+}
+
+// DstRect returns the value of dstRect from VkDisplayPresentInfoKHR
+func (x DisplayPresentInfoKHR) DstRect() Rect2D {
+	ptr := /* typedef */ (*Rect2D)(&x.dstRect)
+	return *ptr
+}
+
+// WithDstRect clones a new DisplayPresentInfoKHR with the value of
+// DstRect updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayPresentInfoKHR) WithDstRect(y Rect2D) DisplayPresentInfoKHR {
+	x.dstRect = *( /* typedef */ (*C.struct_VkRect2D)(&y))
+	return x
+}
+func (x *DisplayPresentInfoKHR) SetDstRect(y Rect2D) {
+	x.dstRect = *( /* typedef */ (*C.struct_VkRect2D)(&y))
+}
+
+// Persistent returns the value of persistent from VkDisplayPresentInfoKHR
+func (x DisplayPresentInfoKHR) Persistent() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.persistent)
+	return *ptr
+}
+
+// WithPersistent clones a new DisplayPresentInfoKHR with the value of
+// Persistent updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayPresentInfoKHR) WithPersistent(y Bool32) DisplayPresentInfoKHR {
+	x.persistent = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *DisplayPresentInfoKHR) SetPersistent(y Bool32) {
+	x.persistent = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// CreateSharedSwapchainsKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCreateSharedSwapchainsKHR.html
+func (x DeviceFacade) CreateSharedSwapchainsKHR(swapchainCount uint32, pCreateInfos []SwapchainCreateInfoKHR, pAllocator *AllocationCallbacks, pSwapchains []SwapchainKHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&swapchainCount)
+	p2 := func(x *[]SwapchainCreateInfoKHR) **C.struct_VkSwapchainCreateInfoKHR { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkSwapchainCreateInfoKHR)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkSwapchainCreateInfoKHR)(unsafe.Pointer((&ptr)))
+	}(&pCreateInfos)
+	p3 := func(x **AllocationCallbacks) **C.struct_VkAllocationCallbacks { /* Pointer */
+		g2c := (*C.struct_VkAllocationCallbacks)(*x)
+		return &g2c
+	}(&pAllocator)
+	p4 := func(x *[]SwapchainKHR) **C.VkSwapchainKHR { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkSwapchainKHR)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkSwapchainKHR)(unsafe.Pointer((&ptr)))
+	}(&pSwapchains)
+	ret := C.vkCreateSharedSwapchainsKHR(addrs, *p0, *p1, *p2, *p3, *p4)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
@@ -0,0 +1,8 @@
+#ifndef __VKS_KHR_DISPLAY_SWAPCHAIN_H__
+#define __VKS_KHR_DISPLAY_SWAPCHAIN_H__
+#include "vk_wrapper.h"
+
+// Wrappers of VK_KHR_display_swapchain.
+VkResult vkCreateSharedSwapchainsKHR(vksProcAddr* addrs, VkDevice device, uint32_t swapchainCount, VkSwapchainCreateInfoKHR* pCreateInfos, VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchains);
+
+#endif
\ No newline at end of file
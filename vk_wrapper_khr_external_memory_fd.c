@@ -0,0 +1,20 @@
+//go:build !vks_no_khr_external_memory_fd && !vks_no_version_1_1
+
+// Wrappers of VK_KHR_external_memory_fd.
+#include "vk_wrapper.h"
+#include "vk_capture.h"
+
+VkResult vkGetMemoryFdKHR(vksProcAddr* addrs, VkDevice device, VkMemoryGetFdInfoKHR* pGetFdInfo, int* pFd) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetMemoryFdKHR(addrs, device, pGetFdInfo, pFd);
+	}
+	VkResult ret = (((PFN_vkGetMemoryFdKHR)addrs->pvkGetMemoryFdKHR)(device, pGetFdInfo, pFd));
+	return ret;
+}
+VkResult vkGetMemoryFdPropertiesKHR(vksProcAddr* addrs, VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, int fd, VkMemoryFdPropertiesKHR* pMemoryFdProperties) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetMemoryFdPropertiesKHR(addrs, device, handleType, fd, pMemoryFdProperties);
+	}
+	VkResult ret = (((PFN_vkGetMemoryFdPropertiesKHR)addrs->pvkGetMemoryFdPropertiesKHR)(device, handleType, fd, pMemoryFdProperties));
+	return ret;
+}
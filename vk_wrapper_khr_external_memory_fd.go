@@ -0,0 +1,495 @@
+//go:build !vks_no_khr_external_memory_fd && !vks_no_version_1_1
+
+package vks
+
+// Bindings of VK_KHR_external_memory_fd, left out by the vks_no_khr_external_memory_fd build tag.
+
+//#cgo CFLAGS: -DVKS_ENABLE_KHR_EXTERNAL_MEMORY_FD
+//#include "vk_wrapper.h"
+import "C"
+import (
+	"unsafe"
+)
+
+// ImportMemoryFdInfoKHR provides a go interface for VkImportMemoryFdInfoKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkImportMemoryFdInfoKHR.html
+type ImportMemoryFdInfoKHR C.struct_VkImportMemoryFdInfoKHR
+
+// SizeofImportMemoryFdInfoKHR is the memory size of a ImportMemoryFdInfoKHR
+var SizeofImportMemoryFdInfoKHR int = int(unsafe.Sizeof(ImportMemoryFdInfoKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ImportMemoryFdInfoKHR) ArpPtr(arp *AutoReleasePool) *ImportMemoryFdInfoKHR {
+	ptr := newCBlock(cULong(SizeofImportMemoryFdInfoKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ImportMemoryFdInfoKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ImportMemoryFdInfoKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ImportMemoryFdInfoKHR) AsCPtr() *ImportMemoryFdInfoKHR {
+	clone := (*ImportMemoryFdInfoKHR)(newCBlock(cULong(SizeofImportMemoryFdInfoKHR)))
+	*clone = x
+	return clone
+}
+
+// ImportMemoryFdInfoKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ImportMemoryFdInfoKHRCSlice(arp *AutoReleasePool, x ...ImportMemoryFdInfoKHR) []ImportMemoryFdInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImportMemoryFdInfoKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ImportMemoryFdInfoKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ImportMemoryFdInfoKHRFreeCSlice releases the memory allocated by ImportMemoryFdInfoKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func ImportMemoryFdInfoKHRFreeCSlice(x []ImportMemoryFdInfoKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ImportMemoryFdInfoKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ImportMemoryFdInfoKHRFreeCSlice must be called on the returned slice.
+func ImportMemoryFdInfoKHRMakeCSlice(x ...ImportMemoryFdInfoKHR) []ImportMemoryFdInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImportMemoryFdInfoKHR * len(x)
+	dst := unsafe.Slice((*ImportMemoryFdInfoKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkImportMemoryFdInfoKHR
+func (x ImportMemoryFdInfoKHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ImportMemoryFdInfoKHR with the value of
+// SType to the value provided in the specification.
+func (x ImportMemoryFdInfoKHR) WithDefaultSType() ImportMemoryFdInfoKHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ImportMemoryFdInfoKHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR)
+}
+
+// WithSType clones a new ImportMemoryFdInfoKHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImportMemoryFdInfoKHR) WithSType(y StructureType) ImportMemoryFdInfoKHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ImportMemoryFdInfoKHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkImportMemoryFdInfoKHR
+func (x ImportMemoryFdInfoKHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ImportMemoryFdInfoKHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImportMemoryFdInfoKHR) WithPNext(y unsafe.Pointer) ImportMemoryFdInfoKHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ImportMemoryFdInfoKHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ImportMemoryFdInfoKHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// HandleType returns the value of handleType from VkImportMemoryFdInfoKHR
+func (x ImportMemoryFdInfoKHR) HandleType() ExternalMemoryHandleTypeFlagBits {
+	ptr := /* typedef */ (*ExternalMemoryHandleTypeFlagBits)(&x.handleType)
+	return *ptr
+}
+
+// WithHandleType clones a new ImportMemoryFdInfoKHR with the value of
+// HandleType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImportMemoryFdInfoKHR) WithHandleType(y ExternalMemoryHandleTypeFlagBits) ImportMemoryFdInfoKHR {
+	x.handleType = *( /* typedef */ (*C.VkExternalMemoryHandleTypeFlagBits)(&y))
+	return x
+}
+func (x *ImportMemoryFdInfoKHR) SetHandleType(y ExternalMemoryHandleTypeFlagBits) {
+	x.handleType = *( /* typedef */ (*C.VkExternalMemoryHandleTypeFlagBits)(&y))
+}
+
+// Fd returns the value of fd from VkImportMemoryFdInfoKHR
+func (x ImportMemoryFdInfoKHR) Fd() int32 {
+	ptr := func(x *C.int) *int32 { /* Scalar */ c2g := int32(*x); return &c2g }(&x.fd)
+	return *ptr
+}
+
+// WithFd clones a new ImportMemoryFdInfoKHR with the value of
+// Fd updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImportMemoryFdInfoKHR) WithFd(y int32) ImportMemoryFdInfoKHR {
+	x.fd = *(func(x *int32) *C.int { /* Scalar */ g2c := C.int(*x); return &g2c }(&y))
+	return x
+}
+func (x *ImportMemoryFdInfoKHR) SetFd(y int32) {
+	x.fd = *(func(x *int32) *C.int { /* Scalar */ g2c := C.int(*x); return &g2c }(&y))
+}
+
+// MemoryFdPropertiesKHR provides a go interface for VkMemoryFdPropertiesKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkMemoryFdPropertiesKHR.html
+type MemoryFdPropertiesKHR C.struct_VkMemoryFdPropertiesKHR
+
+// SizeofMemoryFdPropertiesKHR is the memory size of a MemoryFdPropertiesKHR
+var SizeofMemoryFdPropertiesKHR int = int(unsafe.Sizeof(MemoryFdPropertiesKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x MemoryFdPropertiesKHR) ArpPtr(arp *AutoReleasePool) *MemoryFdPropertiesKHR {
+	ptr := newCBlock(cULong(SizeofMemoryFdPropertiesKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*MemoryFdPropertiesKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *MemoryFdPropertiesKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x MemoryFdPropertiesKHR) AsCPtr() *MemoryFdPropertiesKHR {
+	clone := (*MemoryFdPropertiesKHR)(newCBlock(cULong(SizeofMemoryFdPropertiesKHR)))
+	*clone = x
+	return clone
+}
+
+// MemoryFdPropertiesKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func MemoryFdPropertiesKHRCSlice(arp *AutoReleasePool, x ...MemoryFdPropertiesKHR) []MemoryFdPropertiesKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofMemoryFdPropertiesKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*MemoryFdPropertiesKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// MemoryFdPropertiesKHRFreeCSlice releases the memory allocated by MemoryFdPropertiesKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func MemoryFdPropertiesKHRFreeCSlice(x []MemoryFdPropertiesKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// MemoryFdPropertiesKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. MemoryFdPropertiesKHRFreeCSlice must be called on the returned slice.
+func MemoryFdPropertiesKHRMakeCSlice(x ...MemoryFdPropertiesKHR) []MemoryFdPropertiesKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofMemoryFdPropertiesKHR * len(x)
+	dst := unsafe.Slice((*MemoryFdPropertiesKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkMemoryFdPropertiesKHR
+func (x MemoryFdPropertiesKHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new MemoryFdPropertiesKHR with the value of
+// SType to the value provided in the specification.
+func (x MemoryFdPropertiesKHR) WithDefaultSType() MemoryFdPropertiesKHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *MemoryFdPropertiesKHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_MEMORY_FD_PROPERTIES_KHR)
+}
+
+// WithSType clones a new MemoryFdPropertiesKHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryFdPropertiesKHR) WithSType(y StructureType) MemoryFdPropertiesKHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *MemoryFdPropertiesKHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkMemoryFdPropertiesKHR
+func (x MemoryFdPropertiesKHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new MemoryFdPropertiesKHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryFdPropertiesKHR) WithPNext(y unsafe.Pointer) MemoryFdPropertiesKHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *MemoryFdPropertiesKHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *MemoryFdPropertiesKHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// MemoryTypeBits returns the value of memoryTypeBits from VkMemoryFdPropertiesKHR
+func (x MemoryFdPropertiesKHR) MemoryTypeBits() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.memoryTypeBits)
+	return *ptr
+}
+
+// MemoryGetFdInfoKHR provides a go interface for VkMemoryGetFdInfoKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkMemoryGetFdInfoKHR.html
+type MemoryGetFdInfoKHR C.struct_VkMemoryGetFdInfoKHR
+
+// SizeofMemoryGetFdInfoKHR is the memory size of a MemoryGetFdInfoKHR
+var SizeofMemoryGetFdInfoKHR int = int(unsafe.Sizeof(MemoryGetFdInfoKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x MemoryGetFdInfoKHR) ArpPtr(arp *AutoReleasePool) *MemoryGetFdInfoKHR {
+	ptr := newCBlock(cULong(SizeofMemoryGetFdInfoKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*MemoryGetFdInfoKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *MemoryGetFdInfoKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x MemoryGetFdInfoKHR) AsCPtr() *MemoryGetFdInfoKHR {
+	clone := (*MemoryGetFdInfoKHR)(newCBlock(cULong(SizeofMemoryGetFdInfoKHR)))
+	*clone = x
+	return clone
+}
+
+// MemoryGetFdInfoKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func MemoryGetFdInfoKHRCSlice(arp *AutoReleasePool, x ...MemoryGetFdInfoKHR) []MemoryGetFdInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofMemoryGetFdInfoKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*MemoryGetFdInfoKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// MemoryGetFdInfoKHRFreeCSlice releases the memory allocated by MemoryGetFdInfoKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func MemoryGetFdInfoKHRFreeCSlice(x []MemoryGetFdInfoKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// MemoryGetFdInfoKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. MemoryGetFdInfoKHRFreeCSlice must be called on the returned slice.
+func MemoryGetFdInfoKHRMakeCSlice(x ...MemoryGetFdInfoKHR) []MemoryGetFdInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofMemoryGetFdInfoKHR * len(x)
+	dst := unsafe.Slice((*MemoryGetFdInfoKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkMemoryGetFdInfoKHR
+func (x MemoryGetFdInfoKHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new MemoryGetFdInfoKHR with the value of
+// SType to the value provided in the specification.
+func (x MemoryGetFdInfoKHR) WithDefaultSType() MemoryGetFdInfoKHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *MemoryGetFdInfoKHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_MEMORY_GET_FD_INFO_KHR)
+}
+
+// WithSType clones a new MemoryGetFdInfoKHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryGetFdInfoKHR) WithSType(y StructureType) MemoryGetFdInfoKHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *MemoryGetFdInfoKHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkMemoryGetFdInfoKHR
+func (x MemoryGetFdInfoKHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new MemoryGetFdInfoKHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryGetFdInfoKHR) WithPNext(y unsafe.Pointer) MemoryGetFdInfoKHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *MemoryGetFdInfoKHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *MemoryGetFdInfoKHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Memory returns the value of memory from VkMemoryGetFdInfoKHR
+func (x MemoryGetFdInfoKHR) Memory() DeviceMemory {
+	ptr := /* handle */ (*DeviceMemory)(&x.memory)
+	return *ptr
+}
+
+// WithMemory clones a new MemoryGetFdInfoKHR with the value of
+// Memory updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryGetFdInfoKHR) WithMemory(y DeviceMemory) MemoryGetFdInfoKHR {
+	x.memory = *( /* handle */ (*C.VkDeviceMemory)(&y))
+	return x
+}
+func (x *MemoryGetFdInfoKHR) SetMemory(y DeviceMemory) {
+	x.memory = *( /* handle */ (*C.VkDeviceMemory)(&y))
+}
+
+// HandleType returns the value of handleType from VkMemoryGetFdInfoKHR
+func (x MemoryGetFdInfoKHR) HandleType() ExternalMemoryHandleTypeFlagBits {
+	ptr := /* typedef */ (*ExternalMemoryHandleTypeFlagBits)(&x.handleType)
+	return *ptr
+}
+
+// WithHandleType clones a new MemoryGetFdInfoKHR with the value of
+// HandleType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryGetFdInfoKHR) WithHandleType(y ExternalMemoryHandleTypeFlagBits) MemoryGetFdInfoKHR {
+	x.handleType = *( /* typedef */ (*C.VkExternalMemoryHandleTypeFlagBits)(&y))
+	return x
+}
+func (x *MemoryGetFdInfoKHR) SetHandleType(y ExternalMemoryHandleTypeFlagBits) {
+	x.handleType = *( /* typedef */ (*C.VkExternalMemoryHandleTypeFlagBits)(&y))
+}
+
+// GetMemoryFdKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetMemoryFdKHR.html
+func (x DeviceFacade) GetMemoryFdKHR(pGetFdInfo *MemoryGetFdInfoKHR, pFd *int32) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **MemoryGetFdInfoKHR) **C.struct_VkMemoryGetFdInfoKHR { /* Pointer */
+		g2c := (*C.struct_VkMemoryGetFdInfoKHR)(*x)
+		return &g2c
+	}(&pGetFdInfo)
+	p2 := func(x **int32) **C.int { /* Pointer */ g2c := (*C.int)(*x); return &g2c }(&pFd)
+	ret := C.vkGetMemoryFdKHR(addrs, *p0, *p1, *p2)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetMemoryFdPropertiesKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetMemoryFdPropertiesKHR.html
+func (x DeviceFacade) GetMemoryFdPropertiesKHR(handleType ExternalMemoryHandleTypeFlagBits, fd int32, pMemoryFdProperties *MemoryFdPropertiesKHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := /* typedef */ (*C.VkExternalMemoryHandleTypeFlagBits)(&handleType)
+	p2 := func(x *int32) *C.int { /* Scalar */ g2c := C.int(*x); return &g2c }(&fd)
+	p3 := func(x **MemoryFdPropertiesKHR) **C.struct_VkMemoryFdPropertiesKHR { /* Pointer */
+		g2c := (*C.struct_VkMemoryFdPropertiesKHR)(*x)
+		return &g2c
+	}(&pMemoryFdProperties)
+	ret := C.vkGetMemoryFdPropertiesKHR(addrs, *p0, *p1, *p2, *p3)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
@@ -0,0 +1,9 @@
+#ifndef __VKS_KHR_EXTERNAL_MEMORY_FD_H__
+#define __VKS_KHR_EXTERNAL_MEMORY_FD_H__
+#include "vk_wrapper.h"
+
+// Wrappers of VK_KHR_external_memory_fd.
+VkResult vkGetMemoryFdKHR(vksProcAddr* addrs, VkDevice device, VkMemoryGetFdInfoKHR* pGetFdInfo, int* pFd);
+VkResult vkGetMemoryFdPropertiesKHR(vksProcAddr* addrs, VkDevice device, VkExternalMemoryHandleTypeFlagBits handleType, int fd, VkMemoryFdPropertiesKHR* pMemoryFdProperties);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,20 @@
+//go:build !vks_no_khr_external_semaphore_fd && !vks_no_khr_external_memory_fd && !vks_no_version_1_1
+
+// Wrappers of VK_KHR_external_semaphore_fd.
+#include "vk_wrapper.h"
+#include "vk_capture.h"
+
+VkResult vkImportSemaphoreFdKHR(vksProcAddr* addrs, VkDevice device, VkImportSemaphoreFdInfoKHR* pImportSemaphoreFdInfo) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkImportSemaphoreFdKHR(addrs, device, pImportSemaphoreFdInfo);
+	}
+	VkResult ret = (((PFN_vkImportSemaphoreFdKHR)addrs->pvkImportSemaphoreFdKHR)(device, pImportSemaphoreFdInfo));
+	return ret;
+}
+VkResult vkGetSemaphoreFdKHR(vksProcAddr* addrs, VkDevice device, VkSemaphoreGetFdInfoKHR* pGetFdInfo, int* pFd) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetSemaphoreFdKHR(addrs, device, pGetFdInfo, pFd);
+	}
+	VkResult ret = (((PFN_vkGetSemaphoreFdKHR)addrs->pvkGetSemaphoreFdKHR)(device, pGetFdInfo, pFd));
+	return ret;
+}
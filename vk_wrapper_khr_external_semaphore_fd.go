@@ -0,0 +1,395 @@
+//go:build !vks_no_khr_external_semaphore_fd && !vks_no_khr_external_memory_fd && !vks_no_version_1_1
+
+package vks
+
+// Bindings of VK_KHR_external_semaphore_fd, left out by the vks_no_khr_external_semaphore_fd build tag.
+
+//#cgo CFLAGS: -DVKS_ENABLE_KHR_EXTERNAL_SEMAPHORE_FD
+//#include "vk_wrapper.h"
+import "C"
+import (
+	"unsafe"
+)
+
+// ImportSemaphoreFdInfoKHR provides a go interface for VkImportSemaphoreFdInfoKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkImportSemaphoreFdInfoKHR.html
+type ImportSemaphoreFdInfoKHR C.struct_VkImportSemaphoreFdInfoKHR
+
+// SizeofImportSemaphoreFdInfoKHR is the memory size of a ImportSemaphoreFdInfoKHR
+var SizeofImportSemaphoreFdInfoKHR int = int(unsafe.Sizeof(ImportSemaphoreFdInfoKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ImportSemaphoreFdInfoKHR) ArpPtr(arp *AutoReleasePool) *ImportSemaphoreFdInfoKHR {
+	ptr := newCBlock(cULong(SizeofImportSemaphoreFdInfoKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ImportSemaphoreFdInfoKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ImportSemaphoreFdInfoKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ImportSemaphoreFdInfoKHR) AsCPtr() *ImportSemaphoreFdInfoKHR {
+	clone := (*ImportSemaphoreFdInfoKHR)(newCBlock(cULong(SizeofImportSemaphoreFdInfoKHR)))
+	*clone = x
+	return clone
+}
+
+// ImportSemaphoreFdInfoKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ImportSemaphoreFdInfoKHRCSlice(arp *AutoReleasePool, x ...ImportSemaphoreFdInfoKHR) []ImportSemaphoreFdInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImportSemaphoreFdInfoKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ImportSemaphoreFdInfoKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ImportSemaphoreFdInfoKHRFreeCSlice releases the memory allocated by ImportSemaphoreFdInfoKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func ImportSemaphoreFdInfoKHRFreeCSlice(x []ImportSemaphoreFdInfoKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ImportSemaphoreFdInfoKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ImportSemaphoreFdInfoKHRFreeCSlice must be called on the returned slice.
+func ImportSemaphoreFdInfoKHRMakeCSlice(x ...ImportSemaphoreFdInfoKHR) []ImportSemaphoreFdInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImportSemaphoreFdInfoKHR * len(x)
+	dst := unsafe.Slice((*ImportSemaphoreFdInfoKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkImportSemaphoreFdInfoKHR
+func (x ImportSemaphoreFdInfoKHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ImportSemaphoreFdInfoKHR with the value of
+// SType to the value provided in the specification.
+func (x ImportSemaphoreFdInfoKHR) WithDefaultSType() ImportSemaphoreFdInfoKHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_FD_INFO_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ImportSemaphoreFdInfoKHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_IMPORT_SEMAPHORE_FD_INFO_KHR)
+}
+
+// WithSType clones a new ImportSemaphoreFdInfoKHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImportSemaphoreFdInfoKHR) WithSType(y StructureType) ImportSemaphoreFdInfoKHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ImportSemaphoreFdInfoKHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkImportSemaphoreFdInfoKHR
+func (x ImportSemaphoreFdInfoKHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ImportSemaphoreFdInfoKHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImportSemaphoreFdInfoKHR) WithPNext(y unsafe.Pointer) ImportSemaphoreFdInfoKHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ImportSemaphoreFdInfoKHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ImportSemaphoreFdInfoKHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Semaphore returns the value of semaphore from VkImportSemaphoreFdInfoKHR
+func (x ImportSemaphoreFdInfoKHR) Semaphore() Semaphore {
+	ptr := /* handle */ (*Semaphore)(&x.semaphore)
+	return *ptr
+}
+
+// WithSemaphore clones a new ImportSemaphoreFdInfoKHR with the value of
+// Semaphore updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImportSemaphoreFdInfoKHR) WithSemaphore(y Semaphore) ImportSemaphoreFdInfoKHR {
+	x.semaphore = *( /* handle */ (*C.VkSemaphore)(&y))
+	return x
+}
+func (x *ImportSemaphoreFdInfoKHR) SetSemaphore(y Semaphore) {
+	x.semaphore = *( /* handle */ (*C.VkSemaphore)(&y))
+}
+
+// Flags returns the value of flags from VkImportSemaphoreFdInfoKHR
+func (x ImportSemaphoreFdInfoKHR) Flags() SemaphoreImportFlags {
+	ptr := /* typedef */ (*SemaphoreImportFlags)(&x.flags)
+	return *ptr
+}
+
+// WithFlags clones a new ImportSemaphoreFdInfoKHR with the value of
+// Flags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImportSemaphoreFdInfoKHR) WithFlags(y SemaphoreImportFlags) ImportSemaphoreFdInfoKHR {
+	x.flags = *( /* typedef */ (*C.VkSemaphoreImportFlags)(&y))
+	return x
+}
+func (x *ImportSemaphoreFdInfoKHR) SetFlags(y SemaphoreImportFlags) {
+	x.flags = *( /* typedef */ (*C.VkSemaphoreImportFlags)(&y))
+}
+
+// HandleType returns the value of handleType from VkImportSemaphoreFdInfoKHR
+func (x ImportSemaphoreFdInfoKHR) HandleType() ExternalSemaphoreHandleTypeFlagBits {
+	ptr := /* typedef */ (*ExternalSemaphoreHandleTypeFlagBits)(&x.handleType)
+	return *ptr
+}
+
+// WithHandleType clones a new ImportSemaphoreFdInfoKHR with the value of
+// HandleType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImportSemaphoreFdInfoKHR) WithHandleType(y ExternalSemaphoreHandleTypeFlagBits) ImportSemaphoreFdInfoKHR {
+	x.handleType = *( /* typedef */ (*C.VkExternalSemaphoreHandleTypeFlagBits)(&y))
+	return x
+}
+func (x *ImportSemaphoreFdInfoKHR) SetHandleType(y ExternalSemaphoreHandleTypeFlagBits) {
+	x.handleType = *( /* typedef */ (*C.VkExternalSemaphoreHandleTypeFlagBits)(&y))
+}
+
+// Fd returns the value of fd from VkImportSemaphoreFdInfoKHR
+func (x ImportSemaphoreFdInfoKHR) Fd() int32 {
+	ptr := func(x *C.int) *int32 { /* Scalar */ c2g := int32(*x); return &c2g }(&x.fd)
+	return *ptr
+}
+
+// WithFd clones a new ImportSemaphoreFdInfoKHR with the value of
+// Fd updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImportSemaphoreFdInfoKHR) WithFd(y int32) ImportSemaphoreFdInfoKHR {
+	x.fd = *(func(x *int32) *C.int { /* Scalar */ g2c := C.int(*x); return &g2c }(&y))
+	return x
+}
+func (x *ImportSemaphoreFdInfoKHR) SetFd(y int32) {
+	x.fd = *(func(x *int32) *C.int { /* Scalar */ g2c := C.int(*x); return &g2c }(&y))
+}
+
+// SemaphoreGetFdInfoKHR provides a go interface for VkSemaphoreGetFdInfoKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSemaphoreGetFdInfoKHR.html
+type SemaphoreGetFdInfoKHR C.struct_VkSemaphoreGetFdInfoKHR
+
+// SizeofSemaphoreGetFdInfoKHR is the memory size of a SemaphoreGetFdInfoKHR
+var SizeofSemaphoreGetFdInfoKHR int = int(unsafe.Sizeof(SemaphoreGetFdInfoKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SemaphoreGetFdInfoKHR) ArpPtr(arp *AutoReleasePool) *SemaphoreGetFdInfoKHR {
+	ptr := newCBlock(cULong(SizeofSemaphoreGetFdInfoKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SemaphoreGetFdInfoKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SemaphoreGetFdInfoKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SemaphoreGetFdInfoKHR) AsCPtr() *SemaphoreGetFdInfoKHR {
+	clone := (*SemaphoreGetFdInfoKHR)(newCBlock(cULong(SizeofSemaphoreGetFdInfoKHR)))
+	*clone = x
+	return clone
+}
+
+// SemaphoreGetFdInfoKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SemaphoreGetFdInfoKHRCSlice(arp *AutoReleasePool, x ...SemaphoreGetFdInfoKHR) []SemaphoreGetFdInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSemaphoreGetFdInfoKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SemaphoreGetFdInfoKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SemaphoreGetFdInfoKHRFreeCSlice releases the memory allocated by SemaphoreGetFdInfoKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func SemaphoreGetFdInfoKHRFreeCSlice(x []SemaphoreGetFdInfoKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SemaphoreGetFdInfoKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SemaphoreGetFdInfoKHRFreeCSlice must be called on the returned slice.
+func SemaphoreGetFdInfoKHRMakeCSlice(x ...SemaphoreGetFdInfoKHR) []SemaphoreGetFdInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSemaphoreGetFdInfoKHR * len(x)
+	dst := unsafe.Slice((*SemaphoreGetFdInfoKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkSemaphoreGetFdInfoKHR
+func (x SemaphoreGetFdInfoKHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new SemaphoreGetFdInfoKHR with the value of
+// SType to the value provided in the specification.
+func (x SemaphoreGetFdInfoKHR) WithDefaultSType() SemaphoreGetFdInfoKHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_SEMAPHORE_GET_FD_INFO_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *SemaphoreGetFdInfoKHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_SEMAPHORE_GET_FD_INFO_KHR)
+}
+
+// WithSType clones a new SemaphoreGetFdInfoKHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SemaphoreGetFdInfoKHR) WithSType(y StructureType) SemaphoreGetFdInfoKHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *SemaphoreGetFdInfoKHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkSemaphoreGetFdInfoKHR
+func (x SemaphoreGetFdInfoKHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new SemaphoreGetFdInfoKHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SemaphoreGetFdInfoKHR) WithPNext(y unsafe.Pointer) SemaphoreGetFdInfoKHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *SemaphoreGetFdInfoKHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SemaphoreGetFdInfoKHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Semaphore returns the value of semaphore from VkSemaphoreGetFdInfoKHR
+func (x SemaphoreGetFdInfoKHR) Semaphore() Semaphore {
+	ptr := /* handle */ (*Semaphore)(&x.semaphore)
+	return *ptr
+}
+
+// WithSemaphore clones a new SemaphoreGetFdInfoKHR with the value of
+// Semaphore updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SemaphoreGetFdInfoKHR) WithSemaphore(y Semaphore) SemaphoreGetFdInfoKHR {
+	x.semaphore = *( /* handle */ (*C.VkSemaphore)(&y))
+	return x
+}
+func (x *SemaphoreGetFdInfoKHR) SetSemaphore(y Semaphore) {
+	x.semaphore = *( /* handle */ (*C.VkSemaphore)(&y))
+}
+
+// HandleType returns the value of handleType from VkSemaphoreGetFdInfoKHR
+func (x SemaphoreGetFdInfoKHR) HandleType() ExternalSemaphoreHandleTypeFlagBits {
+	ptr := /* typedef */ (*ExternalSemaphoreHandleTypeFlagBits)(&x.handleType)
+	return *ptr
+}
+
+// WithHandleType clones a new SemaphoreGetFdInfoKHR with the value of
+// HandleType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SemaphoreGetFdInfoKHR) WithHandleType(y ExternalSemaphoreHandleTypeFlagBits) SemaphoreGetFdInfoKHR {
+	x.handleType = *( /* typedef */ (*C.VkExternalSemaphoreHandleTypeFlagBits)(&y))
+	return x
+}
+func (x *SemaphoreGetFdInfoKHR) SetHandleType(y ExternalSemaphoreHandleTypeFlagBits) {
+	x.handleType = *( /* typedef */ (*C.VkExternalSemaphoreHandleTypeFlagBits)(&y))
+}
+
+// ImportSemaphoreFdKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkImportSemaphoreFdKHR.html
+func (x DeviceFacade) ImportSemaphoreFdKHR(pImportSemaphoreFdInfo *ImportSemaphoreFdInfoKHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **ImportSemaphoreFdInfoKHR) **C.struct_VkImportSemaphoreFdInfoKHR { /* Pointer */
+		g2c := (*C.struct_VkImportSemaphoreFdInfoKHR)(*x)
+		return &g2c
+	}(&pImportSemaphoreFdInfo)
+	ret := C.vkImportSemaphoreFdKHR(addrs, *p0, *p1)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetSemaphoreFdKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetSemaphoreFdKHR.html
+func (x DeviceFacade) GetSemaphoreFdKHR(pGetFdInfo *SemaphoreGetFdInfoKHR, pFd *int32) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **SemaphoreGetFdInfoKHR) **C.struct_VkSemaphoreGetFdInfoKHR { /* Pointer */
+		g2c := (*C.struct_VkSemaphoreGetFdInfoKHR)(*x)
+		return &g2c
+	}(&pGetFdInfo)
+	p2 := func(x **int32) **C.int { /* Pointer */ g2c := (*C.int)(*x); return &g2c }(&pFd)
+	ret := C.vkGetSemaphoreFdKHR(addrs, *p0, *p1, *p2)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
@@ -0,0 +1,9 @@
+#ifndef __VKS_KHR_EXTERNAL_SEMAPHORE_FD_H__
+#define __VKS_KHR_EXTERNAL_SEMAPHORE_FD_H__
+#include "vk_wrapper.h"
+
+// Wrappers of VK_KHR_external_semaphore_fd.
+VkResult vkImportSemaphoreFdKHR(vksProcAddr* addrs, VkDevice device, VkImportSemaphoreFdInfoKHR* pImportSemaphoreFdInfo);
+VkResult vkGetSemaphoreFdKHR(vksProcAddr* addrs, VkDevice device, VkSemaphoreGetFdInfoKHR* pGetFdInfo, int* pFd);
+
+#endif
\ No newline at end of file
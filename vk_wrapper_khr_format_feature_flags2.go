@@ -0,0 +1,24 @@
+//go:build !vks_no_khr_format_feature_flags2 && !vks_no_version_1_1 && !vks_no_version_1_2 && !vks_no_version_1_3
+
+package vks
+
+// Bindings of VK_KHR_format_feature_flags2, left out by the vks_no_khr_format_feature_flags2 build tag.
+
+//#cgo CFLAGS: -DVKS_ENABLE_KHR_FORMAT_FEATURE_FLAGS2
+//#include "vk_wrapper.h"
+import "C"
+
+// FormatFeatureFlagBits2KHR enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkFormatFeatureFlagBits2KHR.html
+type FormatFeatureFlagBits2KHR uint32
+
+// FormatFeatureFlags2KHR bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkFormatFeatureFlags2KHR.html
+type FormatFeatureFlags2KHR uint32
+
+// FormatProperties3KHR is an alias to FormatProperties3.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkFormatProperties3KHR.html
+//
+// Deprecated: Most Aliases in the Vulkan spec are for compatibility purposes as extensions get
+// promoted to features. If possible, update code to use the promoted name: FormatProperties3.
+type FormatProperties3KHR = FormatProperties3
@@ -0,0 +1,154 @@
+//go:build !vks_no_khr_get_display_properties2 && !vks_no_khr_display && !vks_no_khr_surface
+
+// Wrappers of VK_KHR_get_display_properties2.
+#include "vk_wrapper.h"
+#include "vk_capture.h"
+
+VkResult vkGetPhysicalDeviceDisplayPlaneProperties2KHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPlaneProperties2KHR* pProperties) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(addrs, physicalDevice, pPropertyCount, pProperties);
+	}
+	VkResult ret = (((PFN_vkGetPhysicalDeviceDisplayPlaneProperties2KHR)addrs->pvkGetPhysicalDeviceDisplayPlaneProperties2KHR)(physicalDevice, pPropertyCount, pProperties));
+	return ret;
+}
+
+// Runs the two-call idiom of vkGetPhysicalDeviceDisplayPlaneProperties2KHR in one call. capacity is the
+// length of pProperties; when it is too small, the result is VK_INCOMPLETE
+// with the count needed.
+vksEnumerateResult vksEnumerate_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(vksProcAddr* addrs, uint64_t physicalDevice, uint32_t capacity, VkDisplayPlaneProperties2KHR* pProperties) {
+	vksEnumerateResult r = { VK_SUCCESS, capacity };
+	for (uint32_t i = 0; i < capacity; i++) {
+		pProperties[i].sType = VK_STRUCTURE_TYPE_DISPLAY_PLANE_PROPERTIES_2_KHR;
+	}
+	if (capacity > 0) {
+		// Large enough buffers skip the count query.
+		r.result = vkGetPhysicalDeviceDisplayPlaneProperties2KHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, &r.count, pProperties);
+		if (r.result < 0) {
+			r.count = 0;
+		}
+		if (r.result != VK_INCOMPLETE) {
+			return r;
+		}
+	}
+	for (;;) {
+		r.count = 0;
+		r.result = vkGetPhysicalDeviceDisplayPlaneProperties2KHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, &r.count, NULL);
+		if (r.result < 0) {
+			r.count = 0;
+			return r;
+		}
+		if (r.count > capacity) {
+			r.result = VK_INCOMPLETE;
+			return r;
+		}
+		r.result = vkGetPhysicalDeviceDisplayPlaneProperties2KHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, &r.count, pProperties);
+		if (r.result != VK_INCOMPLETE) {
+			if (r.result < 0) {
+				r.count = 0;
+			}
+			return r;
+		}
+		// The count grew between the calls.
+	}
+}
+VkResult vkGetPhysicalDeviceDisplayProperties2KHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayProperties2KHR* pProperties) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetPhysicalDeviceDisplayProperties2KHR(addrs, physicalDevice, pPropertyCount, pProperties);
+	}
+	VkResult ret = (((PFN_vkGetPhysicalDeviceDisplayProperties2KHR)addrs->pvkGetPhysicalDeviceDisplayProperties2KHR)(physicalDevice, pPropertyCount, pProperties));
+	return ret;
+}
+
+// Runs the two-call idiom of vkGetPhysicalDeviceDisplayProperties2KHR in one call. capacity is the
+// length of pProperties; when it is too small, the result is VK_INCOMPLETE
+// with the count needed.
+vksEnumerateResult vksEnumerate_vkGetPhysicalDeviceDisplayProperties2KHR(vksProcAddr* addrs, uint64_t physicalDevice, uint32_t capacity, VkDisplayProperties2KHR* pProperties) {
+	vksEnumerateResult r = { VK_SUCCESS, capacity };
+	for (uint32_t i = 0; i < capacity; i++) {
+		pProperties[i].sType = VK_STRUCTURE_TYPE_DISPLAY_PROPERTIES_2_KHR;
+	}
+	if (capacity > 0) {
+		// Large enough buffers skip the count query.
+		r.result = vkGetPhysicalDeviceDisplayProperties2KHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, &r.count, pProperties);
+		if (r.result < 0) {
+			r.count = 0;
+		}
+		if (r.result != VK_INCOMPLETE) {
+			return r;
+		}
+	}
+	for (;;) {
+		r.count = 0;
+		r.result = vkGetPhysicalDeviceDisplayProperties2KHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, &r.count, NULL);
+		if (r.result < 0) {
+			r.count = 0;
+			return r;
+		}
+		if (r.count > capacity) {
+			r.result = VK_INCOMPLETE;
+			return r;
+		}
+		r.result = vkGetPhysicalDeviceDisplayProperties2KHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, &r.count, pProperties);
+		if (r.result != VK_INCOMPLETE) {
+			if (r.result < 0) {
+				r.count = 0;
+			}
+			return r;
+		}
+		// The count grew between the calls.
+	}
+}
+VkResult vkGetDisplayPlaneCapabilities2KHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkDisplayPlaneInfo2KHR* pDisplayPlaneInfo, VkDisplayPlaneCapabilities2KHR* pCapabilities) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetDisplayPlaneCapabilities2KHR(addrs, physicalDevice, pDisplayPlaneInfo, pCapabilities);
+	}
+	VkResult ret = (((PFN_vkGetDisplayPlaneCapabilities2KHR)addrs->pvkGetDisplayPlaneCapabilities2KHR)(physicalDevice, pDisplayPlaneInfo, pCapabilities));
+	return ret;
+}
+VkResult vkGetDisplayModeProperties2KHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t* pPropertyCount, VkDisplayModeProperties2KHR* pProperties) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetDisplayModeProperties2KHR(addrs, physicalDevice, display, pPropertyCount, pProperties);
+	}
+	VkResult ret = (((PFN_vkGetDisplayModeProperties2KHR)addrs->pvkGetDisplayModeProperties2KHR)(physicalDevice, display, pPropertyCount, pProperties));
+	return ret;
+}
+
+// Runs the two-call idiom of vkGetDisplayModeProperties2KHR in one call. capacity is the
+// length of pProperties; when it is too small, the result is VK_INCOMPLETE
+// with the count needed.
+vksEnumerateResult vksEnumerate_vkGetDisplayModeProperties2KHR(vksProcAddr* addrs, uint64_t physicalDevice, uint64_t display, uint32_t capacity, VkDisplayModeProperties2KHR* pProperties) {
+	vksEnumerateResult r = { VK_SUCCESS, capacity };
+	for (uint32_t i = 0; i < capacity; i++) {
+		pProperties[i].sType = VK_STRUCTURE_TYPE_DISPLAY_MODE_PROPERTIES_2_KHR;
+	}
+	if (capacity > 0) {
+		// Large enough buffers skip the count query.
+		r.result = vkGetDisplayModeProperties2KHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, (VkDisplayKHR)(uintptr_t)display, &r.count, pProperties);
+		if (r.result < 0) {
+			r.count = 0;
+		}
+		if (r.result != VK_INCOMPLETE) {
+			return r;
+		}
+	}
+	for (;;) {
+		r.count = 0;
+		r.result = vkGetDisplayModeProperties2KHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, (VkDisplayKHR)(uintptr_t)display, &r.count, NULL);
+		if (r.result < 0) {
+			r.count = 0;
+			return r;
+		}
+		if (r.count > capacity) {
+			r.result = VK_INCOMPLETE;
+			return r;
+		}
+		r.result = vkGetDisplayModeProperties2KHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, (VkDisplayKHR)(uintptr_t)display, &r.count, pProperties);
+		if (r.result != VK_INCOMPLETE) {
+			if (r.result < 0) {
+				r.count = 0;
+			}
+			return r;
+		}
+		// The count grew between the calls.
+	}
+}
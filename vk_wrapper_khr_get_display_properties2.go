@@ -0,0 +1,849 @@
+//go:build !vks_no_khr_get_display_properties2 && !vks_no_khr_display && !vks_no_khr_surface
+
+package vks
+
+// Bindings of VK_KHR_get_display_properties2, left out by the vks_no_khr_get_display_properties2 build tag.
+
+//#cgo CFLAGS: -DVKS_ENABLE_KHR_GET_DISPLAY_PROPERTIES2
+//#include "vk_wrapper.h"
+import "C"
+import (
+	"unsafe"
+)
+
+// DisplayPlaneCapabilities2KHR provides a go interface for VkDisplayPlaneCapabilities2KHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDisplayPlaneCapabilities2KHR.html
+type DisplayPlaneCapabilities2KHR C.struct_VkDisplayPlaneCapabilities2KHR
+
+// SizeofDisplayPlaneCapabilities2KHR is the memory size of a DisplayPlaneCapabilities2KHR
+var SizeofDisplayPlaneCapabilities2KHR int = int(unsafe.Sizeof(DisplayPlaneCapabilities2KHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DisplayPlaneCapabilities2KHR) ArpPtr(arp *AutoReleasePool) *DisplayPlaneCapabilities2KHR {
+	ptr := newCBlock(cULong(SizeofDisplayPlaneCapabilities2KHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DisplayPlaneCapabilities2KHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DisplayPlaneCapabilities2KHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DisplayPlaneCapabilities2KHR) AsCPtr() *DisplayPlaneCapabilities2KHR {
+	clone := (*DisplayPlaneCapabilities2KHR)(newCBlock(cULong(SizeofDisplayPlaneCapabilities2KHR)))
+	*clone = x
+	return clone
+}
+
+// DisplayPlaneCapabilities2KHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DisplayPlaneCapabilities2KHRCSlice(arp *AutoReleasePool, x ...DisplayPlaneCapabilities2KHR) []DisplayPlaneCapabilities2KHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayPlaneCapabilities2KHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DisplayPlaneCapabilities2KHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DisplayPlaneCapabilities2KHRFreeCSlice releases the memory allocated by DisplayPlaneCapabilities2KHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DisplayPlaneCapabilities2KHRFreeCSlice(x []DisplayPlaneCapabilities2KHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DisplayPlaneCapabilities2KHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DisplayPlaneCapabilities2KHRFreeCSlice must be called on the returned slice.
+func DisplayPlaneCapabilities2KHRMakeCSlice(x ...DisplayPlaneCapabilities2KHR) []DisplayPlaneCapabilities2KHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayPlaneCapabilities2KHR * len(x)
+	dst := unsafe.Slice((*DisplayPlaneCapabilities2KHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDisplayPlaneCapabilities2KHR
+func (x *DisplayPlaneCapabilities2KHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DisplayPlaneCapabilities2KHR with the value of
+// SType to the value provided in the specification.
+func (x DisplayPlaneCapabilities2KHR) WithDefaultSType() DisplayPlaneCapabilities2KHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_DISPLAY_PLANE_CAPABILITIES_2_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DisplayPlaneCapabilities2KHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DISPLAY_PLANE_CAPABILITIES_2_KHR)
+}
+
+// WithSType clones a new DisplayPlaneCapabilities2KHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayPlaneCapabilities2KHR) WithSType(y StructureType) DisplayPlaneCapabilities2KHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DisplayPlaneCapabilities2KHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDisplayPlaneCapabilities2KHR
+func (x *DisplayPlaneCapabilities2KHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DisplayPlaneCapabilities2KHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayPlaneCapabilities2KHR) WithPNext(y unsafe.Pointer) DisplayPlaneCapabilities2KHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DisplayPlaneCapabilities2KHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DisplayPlaneCapabilities2KHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Capabilities returns the value of capabilities from VkDisplayPlaneCapabilities2KHR
+func (x *DisplayPlaneCapabilities2KHR) Capabilities() DisplayPlaneCapabilitiesKHR {
+	ptr := /* typedef */ (*DisplayPlaneCapabilitiesKHR)(&x.capabilities)
+	return *ptr
+}
+
+// CapabilitiesView returns a pointer to capabilities in x, to read the
+// struct without copying it.
+func (x *DisplayPlaneCapabilities2KHR) CapabilitiesView() *DisplayPlaneCapabilitiesKHR {
+	return (*DisplayPlaneCapabilitiesKHR)(&x.capabilities)
+}
+
+// DisplayPlaneProperties2KHR provides a go interface for VkDisplayPlaneProperties2KHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDisplayPlaneProperties2KHR.html
+type DisplayPlaneProperties2KHR C.struct_VkDisplayPlaneProperties2KHR
+
+// SizeofDisplayPlaneProperties2KHR is the memory size of a DisplayPlaneProperties2KHR
+var SizeofDisplayPlaneProperties2KHR int = int(unsafe.Sizeof(DisplayPlaneProperties2KHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DisplayPlaneProperties2KHR) ArpPtr(arp *AutoReleasePool) *DisplayPlaneProperties2KHR {
+	ptr := newCBlock(cULong(SizeofDisplayPlaneProperties2KHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DisplayPlaneProperties2KHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DisplayPlaneProperties2KHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DisplayPlaneProperties2KHR) AsCPtr() *DisplayPlaneProperties2KHR {
+	clone := (*DisplayPlaneProperties2KHR)(newCBlock(cULong(SizeofDisplayPlaneProperties2KHR)))
+	*clone = x
+	return clone
+}
+
+// DisplayPlaneProperties2KHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DisplayPlaneProperties2KHRCSlice(arp *AutoReleasePool, x ...DisplayPlaneProperties2KHR) []DisplayPlaneProperties2KHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayPlaneProperties2KHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DisplayPlaneProperties2KHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DisplayPlaneProperties2KHRFreeCSlice releases the memory allocated by DisplayPlaneProperties2KHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DisplayPlaneProperties2KHRFreeCSlice(x []DisplayPlaneProperties2KHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DisplayPlaneProperties2KHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DisplayPlaneProperties2KHRFreeCSlice must be called on the returned slice.
+func DisplayPlaneProperties2KHRMakeCSlice(x ...DisplayPlaneProperties2KHR) []DisplayPlaneProperties2KHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayPlaneProperties2KHR * len(x)
+	dst := unsafe.Slice((*DisplayPlaneProperties2KHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDisplayPlaneProperties2KHR
+func (x DisplayPlaneProperties2KHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DisplayPlaneProperties2KHR with the value of
+// SType to the value provided in the specification.
+func (x DisplayPlaneProperties2KHR) WithDefaultSType() DisplayPlaneProperties2KHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_DISPLAY_PLANE_PROPERTIES_2_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DisplayPlaneProperties2KHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DISPLAY_PLANE_PROPERTIES_2_KHR)
+}
+
+// WithSType clones a new DisplayPlaneProperties2KHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayPlaneProperties2KHR) WithSType(y StructureType) DisplayPlaneProperties2KHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DisplayPlaneProperties2KHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDisplayPlaneProperties2KHR
+func (x DisplayPlaneProperties2KHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DisplayPlaneProperties2KHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayPlaneProperties2KHR) WithPNext(y unsafe.Pointer) DisplayPlaneProperties2KHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DisplayPlaneProperties2KHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DisplayPlaneProperties2KHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// DisplayPlaneProperties returns the value of displayPlaneProperties from VkDisplayPlaneProperties2KHR
+func (x DisplayPlaneProperties2KHR) DisplayPlaneProperties() DisplayPlanePropertiesKHR {
+	ptr := /* typedef */ (*DisplayPlanePropertiesKHR)(&x.displayPlaneProperties)
+	return *ptr
+}
+
+// DisplayPlaneInfo2KHR provides a go interface for VkDisplayPlaneInfo2KHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDisplayPlaneInfo2KHR.html
+type DisplayPlaneInfo2KHR C.struct_VkDisplayPlaneInfo2KHR
+
+// SizeofDisplayPlaneInfo2KHR is the memory size of a DisplayPlaneInfo2KHR
+var SizeofDisplayPlaneInfo2KHR int = int(unsafe.Sizeof(DisplayPlaneInfo2KHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DisplayPlaneInfo2KHR) ArpPtr(arp *AutoReleasePool) *DisplayPlaneInfo2KHR {
+	ptr := newCBlock(cULong(SizeofDisplayPlaneInfo2KHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DisplayPlaneInfo2KHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DisplayPlaneInfo2KHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DisplayPlaneInfo2KHR) AsCPtr() *DisplayPlaneInfo2KHR {
+	clone := (*DisplayPlaneInfo2KHR)(newCBlock(cULong(SizeofDisplayPlaneInfo2KHR)))
+	*clone = x
+	return clone
+}
+
+// DisplayPlaneInfo2KHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DisplayPlaneInfo2KHRCSlice(arp *AutoReleasePool, x ...DisplayPlaneInfo2KHR) []DisplayPlaneInfo2KHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayPlaneInfo2KHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DisplayPlaneInfo2KHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DisplayPlaneInfo2KHRFreeCSlice releases the memory allocated by DisplayPlaneInfo2KHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DisplayPlaneInfo2KHRFreeCSlice(x []DisplayPlaneInfo2KHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DisplayPlaneInfo2KHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DisplayPlaneInfo2KHRFreeCSlice must be called on the returned slice.
+func DisplayPlaneInfo2KHRMakeCSlice(x ...DisplayPlaneInfo2KHR) []DisplayPlaneInfo2KHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayPlaneInfo2KHR * len(x)
+	dst := unsafe.Slice((*DisplayPlaneInfo2KHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDisplayPlaneInfo2KHR
+func (x DisplayPlaneInfo2KHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DisplayPlaneInfo2KHR with the value of
+// SType to the value provided in the specification.
+func (x DisplayPlaneInfo2KHR) WithDefaultSType() DisplayPlaneInfo2KHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_DISPLAY_PLANE_INFO_2_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DisplayPlaneInfo2KHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DISPLAY_PLANE_INFO_2_KHR)
+}
+
+// WithSType clones a new DisplayPlaneInfo2KHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayPlaneInfo2KHR) WithSType(y StructureType) DisplayPlaneInfo2KHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DisplayPlaneInfo2KHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDisplayPlaneInfo2KHR
+func (x DisplayPlaneInfo2KHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DisplayPlaneInfo2KHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayPlaneInfo2KHR) WithPNext(y unsafe.Pointer) DisplayPlaneInfo2KHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DisplayPlaneInfo2KHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DisplayPlaneInfo2KHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Mode returns the value of mode from VkDisplayPlaneInfo2KHR
+func (x DisplayPlaneInfo2KHR) Mode() DisplayModeKHR {
+	ptr := /* handle */ (*DisplayModeKHR)(&x.mode)
+	return *ptr
+}
+
+// WithMode clones a new DisplayPlaneInfo2KHR with the value of
+// Mode updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayPlaneInfo2KHR) WithMode(y DisplayModeKHR) DisplayPlaneInfo2KHR {
+	x.mode = *( /* handle */ (*C.VkDisplayModeKHR)(&y))
+	return x
+}
+func (x *DisplayPlaneInfo2KHR) SetMode(y DisplayModeKHR) {
+	x.mode = *( /* handle */ (*C.VkDisplayModeKHR)(&y))
+}
+
+// PlaneIndex returns the value of planeIndex from VkDisplayPlaneInfo2KHR
+func (x DisplayPlaneInfo2KHR) PlaneIndex() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.planeIndex)
+	return *ptr
+}
+
+// WithPlaneIndex clones a new DisplayPlaneInfo2KHR with the value of
+// PlaneIndex updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayPlaneInfo2KHR) WithPlaneIndex(y uint32) DisplayPlaneInfo2KHR {
+	x.planeIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DisplayPlaneInfo2KHR) SetPlaneIndex(y uint32) {
+	x.planeIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// DisplayProperties2KHR provides a go interface for VkDisplayProperties2KHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDisplayProperties2KHR.html
+type DisplayProperties2KHR C.struct_VkDisplayProperties2KHR
+
+// SizeofDisplayProperties2KHR is the memory size of a DisplayProperties2KHR
+var SizeofDisplayProperties2KHR int = int(unsafe.Sizeof(DisplayProperties2KHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DisplayProperties2KHR) ArpPtr(arp *AutoReleasePool) *DisplayProperties2KHR {
+	ptr := newCBlock(cULong(SizeofDisplayProperties2KHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DisplayProperties2KHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DisplayProperties2KHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DisplayProperties2KHR) AsCPtr() *DisplayProperties2KHR {
+	clone := (*DisplayProperties2KHR)(newCBlock(cULong(SizeofDisplayProperties2KHR)))
+	*clone = x
+	return clone
+}
+
+// DisplayProperties2KHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DisplayProperties2KHRCSlice(arp *AutoReleasePool, x ...DisplayProperties2KHR) []DisplayProperties2KHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayProperties2KHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DisplayProperties2KHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DisplayProperties2KHRFreeCSlice releases the memory allocated by DisplayProperties2KHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DisplayProperties2KHRFreeCSlice(x []DisplayProperties2KHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DisplayProperties2KHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DisplayProperties2KHRFreeCSlice must be called on the returned slice.
+func DisplayProperties2KHRMakeCSlice(x ...DisplayProperties2KHR) []DisplayProperties2KHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayProperties2KHR * len(x)
+	dst := unsafe.Slice((*DisplayProperties2KHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDisplayProperties2KHR
+func (x DisplayProperties2KHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DisplayProperties2KHR with the value of
+// SType to the value provided in the specification.
+func (x DisplayProperties2KHR) WithDefaultSType() DisplayProperties2KHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_DISPLAY_PROPERTIES_2_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DisplayProperties2KHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DISPLAY_PROPERTIES_2_KHR)
+}
+
+// WithSType clones a new DisplayProperties2KHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayProperties2KHR) WithSType(y StructureType) DisplayProperties2KHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DisplayProperties2KHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDisplayProperties2KHR
+func (x DisplayProperties2KHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DisplayProperties2KHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayProperties2KHR) WithPNext(y unsafe.Pointer) DisplayProperties2KHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DisplayProperties2KHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DisplayProperties2KHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// DisplayProperties returns the value of displayProperties from VkDisplayProperties2KHR
+func (x DisplayProperties2KHR) DisplayProperties() DisplayPropertiesKHR {
+	ptr := /* typedef */ (*DisplayPropertiesKHR)(&x.displayProperties)
+	return *ptr
+}
+
+// DisplayModeProperties2KHR provides a go interface for VkDisplayModeProperties2KHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDisplayModeProperties2KHR.html
+type DisplayModeProperties2KHR C.struct_VkDisplayModeProperties2KHR
+
+// SizeofDisplayModeProperties2KHR is the memory size of a DisplayModeProperties2KHR
+var SizeofDisplayModeProperties2KHR int = int(unsafe.Sizeof(DisplayModeProperties2KHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DisplayModeProperties2KHR) ArpPtr(arp *AutoReleasePool) *DisplayModeProperties2KHR {
+	ptr := newCBlock(cULong(SizeofDisplayModeProperties2KHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DisplayModeProperties2KHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DisplayModeProperties2KHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DisplayModeProperties2KHR) AsCPtr() *DisplayModeProperties2KHR {
+	clone := (*DisplayModeProperties2KHR)(newCBlock(cULong(SizeofDisplayModeProperties2KHR)))
+	*clone = x
+	return clone
+}
+
+// DisplayModeProperties2KHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DisplayModeProperties2KHRCSlice(arp *AutoReleasePool, x ...DisplayModeProperties2KHR) []DisplayModeProperties2KHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayModeProperties2KHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DisplayModeProperties2KHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DisplayModeProperties2KHRFreeCSlice releases the memory allocated by DisplayModeProperties2KHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DisplayModeProperties2KHRFreeCSlice(x []DisplayModeProperties2KHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DisplayModeProperties2KHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DisplayModeProperties2KHRFreeCSlice must be called on the returned slice.
+func DisplayModeProperties2KHRMakeCSlice(x ...DisplayModeProperties2KHR) []DisplayModeProperties2KHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDisplayModeProperties2KHR * len(x)
+	dst := unsafe.Slice((*DisplayModeProperties2KHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDisplayModeProperties2KHR
+func (x DisplayModeProperties2KHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DisplayModeProperties2KHR with the value of
+// SType to the value provided in the specification.
+func (x DisplayModeProperties2KHR) WithDefaultSType() DisplayModeProperties2KHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_DISPLAY_MODE_PROPERTIES_2_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DisplayModeProperties2KHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DISPLAY_MODE_PROPERTIES_2_KHR)
+}
+
+// WithSType clones a new DisplayModeProperties2KHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayModeProperties2KHR) WithSType(y StructureType) DisplayModeProperties2KHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DisplayModeProperties2KHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDisplayModeProperties2KHR
+func (x DisplayModeProperties2KHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DisplayModeProperties2KHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DisplayModeProperties2KHR) WithPNext(y unsafe.Pointer) DisplayModeProperties2KHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DisplayModeProperties2KHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DisplayModeProperties2KHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// DisplayModeProperties returns the value of displayModeProperties from VkDisplayModeProperties2KHR
+func (x DisplayModeProperties2KHR) DisplayModeProperties() DisplayModePropertiesKHR {
+	ptr := /* typedef */ (*DisplayModePropertiesKHR)(&x.displayModeProperties)
+	return *ptr
+}
+
+// GetPhysicalDeviceDisplayPlaneProperties2KHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPhysicalDeviceDisplayPlaneProperties2KHR.html
+func (x PhysicalDeviceFacade) GetPhysicalDeviceDisplayPlaneProperties2KHR(pPropertyCount *uint32, pProperties []DisplayPlaneProperties2KHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := func(x **uint32) **C.uint32_t { /* Pointer */ g2c := (*C.uint32_t)(*x); return &g2c }(&pPropertyCount)
+	p2 := func(x *[]DisplayPlaneProperties2KHR) **C.struct_VkDisplayPlaneProperties2KHR { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkDisplayPlaneProperties2KHR)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkDisplayPlaneProperties2KHR)(unsafe.Pointer((&ptr)))
+	}(&pProperties)
+	ret := C.vkGetPhysicalDeviceDisplayPlaneProperties2KHR(addrs, *p0, *p1, *p2)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetPhysicalDeviceDisplayPlaneProperties2KHRInto calls GetPhysicalDeviceDisplayPlaneProperties2KHR with the count query, the fill and
+// the VK_INCOMPLETE retries in a single cgo call. The elements are stored in
+// dst, reallocated only when its capacity is too small, and returned.
+// The sType of every element is set; pNext is passed through.
+func (x PhysicalDeviceFacade) GetPhysicalDeviceDisplayPlaneProperties2KHRInto(dst []DisplayPlaneProperties2KHR) ([]DisplayPlaneProperties2KHR, Result) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	for {
+		dst = dst[:cap(dst)]
+		var items *C.struct_VkDisplayPlaneProperties2KHR
+		if len(dst) > 0 {
+			items = (*C.struct_VkDisplayPlaneProperties2KHR)(unsafe.Pointer(&dst[0]))
+		}
+		ret := C.vksEnumerate_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(addrs, C.uint64_t(uintptr(unsafe.Pointer(*p0))), C.uint32_t(len(dst)), items)
+		if Result(ret.result) == VK_INCOMPLETE && int(ret.count) > len(dst) {
+			dst = make([]DisplayPlaneProperties2KHR, ret.count)
+			continue
+		}
+		return dst[:ret.count], Result(ret.result)
+	}
+}
+
+// GetPhysicalDeviceDisplayProperties2KHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPhysicalDeviceDisplayProperties2KHR.html
+func (x PhysicalDeviceFacade) GetPhysicalDeviceDisplayProperties2KHR(pPropertyCount *uint32, pProperties []DisplayProperties2KHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := func(x **uint32) **C.uint32_t { /* Pointer */ g2c := (*C.uint32_t)(*x); return &g2c }(&pPropertyCount)
+	p2 := func(x *[]DisplayProperties2KHR) **C.struct_VkDisplayProperties2KHR { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkDisplayProperties2KHR)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkDisplayProperties2KHR)(unsafe.Pointer((&ptr)))
+	}(&pProperties)
+	ret := C.vkGetPhysicalDeviceDisplayProperties2KHR(addrs, *p0, *p1, *p2)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetPhysicalDeviceDisplayProperties2KHRInto calls GetPhysicalDeviceDisplayProperties2KHR with the count query, the fill and
+// the VK_INCOMPLETE retries in a single cgo call. The elements are stored in
+// dst, reallocated only when its capacity is too small, and returned.
+// The sType of every element is set; pNext is passed through.
+func (x PhysicalDeviceFacade) GetPhysicalDeviceDisplayProperties2KHRInto(dst []DisplayProperties2KHR) ([]DisplayProperties2KHR, Result) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	for {
+		dst = dst[:cap(dst)]
+		var items *C.struct_VkDisplayProperties2KHR
+		if len(dst) > 0 {
+			items = (*C.struct_VkDisplayProperties2KHR)(unsafe.Pointer(&dst[0]))
+		}
+		ret := C.vksEnumerate_vkGetPhysicalDeviceDisplayProperties2KHR(addrs, C.uint64_t(uintptr(unsafe.Pointer(*p0))), C.uint32_t(len(dst)), items)
+		if Result(ret.result) == VK_INCOMPLETE && int(ret.count) > len(dst) {
+			dst = make([]DisplayProperties2KHR, ret.count)
+			continue
+		}
+		return dst[:ret.count], Result(ret.result)
+	}
+}
+
+// GetDisplayPlaneCapabilities2KHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetDisplayPlaneCapabilities2KHR.html
+func (x PhysicalDeviceFacade) GetDisplayPlaneCapabilities2KHR(pDisplayPlaneInfo *DisplayPlaneInfo2KHR, pCapabilities *DisplayPlaneCapabilities2KHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := func(x **DisplayPlaneInfo2KHR) **C.struct_VkDisplayPlaneInfo2KHR { /* Pointer */
+		g2c := (*C.struct_VkDisplayPlaneInfo2KHR)(*x)
+		return &g2c
+	}(&pDisplayPlaneInfo)
+	p2 := func(x **DisplayPlaneCapabilities2KHR) **C.struct_VkDisplayPlaneCapabilities2KHR { /* Pointer */
+		g2c := (*C.struct_VkDisplayPlaneCapabilities2KHR)(*x)
+		return &g2c
+	}(&pCapabilities)
+	ret := C.vkGetDisplayPlaneCapabilities2KHR(addrs, *p0, *p1, *p2)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetDisplayModeProperties2KHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetDisplayModeProperties2KHR.html
+func (x PhysicalDeviceFacade) GetDisplayModeProperties2KHR(display DisplayKHR, pPropertyCount *uint32, pProperties []DisplayModeProperties2KHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := /* handle */ (*C.VkDisplayKHR)(&display)
+	p2 := func(x **uint32) **C.uint32_t { /* Pointer */ g2c := (*C.uint32_t)(*x); return &g2c }(&pPropertyCount)
+	p3 := func(x *[]DisplayModeProperties2KHR) **C.struct_VkDisplayModeProperties2KHR { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkDisplayModeProperties2KHR)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkDisplayModeProperties2KHR)(unsafe.Pointer((&ptr)))
+	}(&pProperties)
+	ret := C.vkGetDisplayModeProperties2KHR(addrs, *p0, *p1, *p2, *p3)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetDisplayModeProperties2KHRInto calls GetDisplayModeProperties2KHR with the count query, the fill and
+// the VK_INCOMPLETE retries in a single cgo call. The elements are stored in
+// dst, reallocated only when its capacity is too small, and returned.
+// The sType of every element is set; pNext is passed through.
+func (x PhysicalDeviceFacade) GetDisplayModeProperties2KHRInto(display DisplayKHR, dst []DisplayModeProperties2KHR) ([]DisplayModeProperties2KHR, Result) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := /* handle */ (*C.VkDisplayKHR)(&display)
+	for {
+		dst = dst[:cap(dst)]
+		var items *C.struct_VkDisplayModeProperties2KHR
+		if len(dst) > 0 {
+			items = (*C.struct_VkDisplayModeProperties2KHR)(unsafe.Pointer(&dst[0]))
+		}
+		ret := C.vksEnumerate_vkGetDisplayModeProperties2KHR(addrs, C.uint64_t(uintptr(unsafe.Pointer(*p0))), C.uint64_t(uintptr(unsafe.Pointer(*p1))), C.uint32_t(len(dst)), items)
+		if Result(ret.result) == VK_INCOMPLETE && int(ret.count) > len(dst) {
+			dst = make([]DisplayModeProperties2KHR, ret.count)
+			continue
+		}
+		return dst[:ret.count], Result(ret.result)
+	}
+}
@@ -0,0 +1,14 @@
+#ifndef __VKS_KHR_GET_DISPLAY_PROPERTIES2_H__
+#define __VKS_KHR_GET_DISPLAY_PROPERTIES2_H__
+#include "vk_wrapper.h"
+
+// Wrappers of VK_KHR_get_display_properties2.
+VkResult vkGetPhysicalDeviceDisplayPlaneProperties2KHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayPlaneProperties2KHR* pProperties);
+vksEnumerateResult vksEnumerate_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(vksProcAddr* addrs, uint64_t physicalDevice, uint32_t capacity, VkDisplayPlaneProperties2KHR* pProperties);
+VkResult vkGetPhysicalDeviceDisplayProperties2KHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t* pPropertyCount, VkDisplayProperties2KHR* pProperties);
+vksEnumerateResult vksEnumerate_vkGetPhysicalDeviceDisplayProperties2KHR(vksProcAddr* addrs, uint64_t physicalDevice, uint32_t capacity, VkDisplayProperties2KHR* pProperties);
+VkResult vkGetDisplayPlaneCapabilities2KHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkDisplayPlaneInfo2KHR* pDisplayPlaneInfo, VkDisplayPlaneCapabilities2KHR* pCapabilities);
+VkResult vkGetDisplayModeProperties2KHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkDisplayKHR display, uint32_t* pPropertyCount, VkDisplayModeProperties2KHR* pProperties);
+vksEnumerateResult vksEnumerate_vkGetDisplayModeProperties2KHR(vksProcAddr* addrs, uint64_t physicalDevice, uint64_t display, uint32_t capacity, VkDisplayModeProperties2KHR* pProperties);
+
+#endif
\ No newline at end of file
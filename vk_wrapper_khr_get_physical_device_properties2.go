@@ -0,0 +1,72 @@
+//go:build !vks_no_khr_get_physical_device_properties2 && !vks_no_version_1_1
+
+package vks
+
+// Bindings of VK_KHR_get_physical_device_properties2, left out by the vks_no_khr_get_physical_device_properties2 build tag.
+
+//#cgo CFLAGS: -DVKS_ENABLE_KHR_GET_PHYSICAL_DEVICE_PROPERTIES2
+//#include "vk_wrapper.h"
+import "C"
+
+// FormatProperties2KHR is an alias to FormatProperties2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkFormatProperties2KHR.html
+//
+// Deprecated: Most Aliases in the Vulkan spec are for compatibility purposes as extensions get
+// promoted to features. If possible, update code to use the promoted name: FormatProperties2.
+type FormatProperties2KHR = FormatProperties2
+
+// PhysicalDeviceSparseImageFormatInfo2KHR is an alias to PhysicalDeviceSparseImageFormatInfo2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceSparseImageFormatInfo2KHR.html
+//
+// Deprecated: Most Aliases in the Vulkan spec are for compatibility purposes as extensions get
+// promoted to features. If possible, update code to use the promoted name: PhysicalDeviceSparseImageFormatInfo2.
+type PhysicalDeviceSparseImageFormatInfo2KHR = PhysicalDeviceSparseImageFormatInfo2
+
+// SparseImageFormatProperties2KHR is an alias to SparseImageFormatProperties2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSparseImageFormatProperties2KHR.html
+//
+// Deprecated: Most Aliases in the Vulkan spec are for compatibility purposes as extensions get
+// promoted to features. If possible, update code to use the promoted name: SparseImageFormatProperties2.
+type SparseImageFormatProperties2KHR = SparseImageFormatProperties2
+
+// PhysicalDeviceMemoryProperties2KHR is an alias to PhysicalDeviceMemoryProperties2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceMemoryProperties2KHR.html
+//
+// Deprecated: Most Aliases in the Vulkan spec are for compatibility purposes as extensions get
+// promoted to features. If possible, update code to use the promoted name: PhysicalDeviceMemoryProperties2.
+type PhysicalDeviceMemoryProperties2KHR = PhysicalDeviceMemoryProperties2
+
+// QueueFamilyProperties2KHR is an alias to QueueFamilyProperties2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkQueueFamilyProperties2KHR.html
+//
+// Deprecated: Most Aliases in the Vulkan spec are for compatibility purposes as extensions get
+// promoted to features. If possible, update code to use the promoted name: QueueFamilyProperties2.
+type QueueFamilyProperties2KHR = QueueFamilyProperties2
+
+// PhysicalDeviceImageFormatInfo2KHR is an alias to PhysicalDeviceImageFormatInfo2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceImageFormatInfo2KHR.html
+//
+// Deprecated: Most Aliases in the Vulkan spec are for compatibility purposes as extensions get
+// promoted to features. If possible, update code to use the promoted name: PhysicalDeviceImageFormatInfo2.
+type PhysicalDeviceImageFormatInfo2KHR = PhysicalDeviceImageFormatInfo2
+
+// ImageFormatProperties2KHR is an alias to ImageFormatProperties2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkImageFormatProperties2KHR.html
+//
+// Deprecated: Most Aliases in the Vulkan spec are for compatibility purposes as extensions get
+// promoted to features. If possible, update code to use the promoted name: ImageFormatProperties2.
+type ImageFormatProperties2KHR = ImageFormatProperties2
+
+// PhysicalDeviceFeatures2KHR is an alias to PhysicalDeviceFeatures2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceFeatures2KHR.html
+//
+// Deprecated: Most Aliases in the Vulkan spec are for compatibility purposes as extensions get
+// promoted to features. If possible, update code to use the promoted name: PhysicalDeviceFeatures2.
+type PhysicalDeviceFeatures2KHR = PhysicalDeviceFeatures2
+
+// PhysicalDeviceProperties2KHR is an alias to PhysicalDeviceProperties2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceProperties2KHR.html
+//
+// Deprecated: Most Aliases in the Vulkan spec are for compatibility purposes as extensions get
+// promoted to features. If possible, update code to use the promoted name: PhysicalDeviceProperties2.
+type PhysicalDeviceProperties2KHR = PhysicalDeviceProperties2
@@ -0,0 +1,60 @@
+//go:build !vks_no_khr_get_surface_capabilities2 && !vks_no_khr_surface
+
+// Wrappers of VK_KHR_get_surface_capabilities2.
+#include "vk_wrapper.h"
+#include "vk_capture.h"
+
+VkResult vkGetPhysicalDeviceSurfaceCapabilities2KHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, VkSurfaceCapabilities2KHR* pSurfaceCapabilities) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetPhysicalDeviceSurfaceCapabilities2KHR(addrs, physicalDevice, pSurfaceInfo, pSurfaceCapabilities);
+	}
+	VkResult ret = (((PFN_vkGetPhysicalDeviceSurfaceCapabilities2KHR)addrs->pvkGetPhysicalDeviceSurfaceCapabilities2KHR)(physicalDevice, pSurfaceInfo, pSurfaceCapabilities));
+	return ret;
+}
+VkResult vkGetPhysicalDeviceSurfaceFormats2KHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, uint32_t* pSurfaceFormatCount, VkSurfaceFormat2KHR* pSurfaceFormats) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetPhysicalDeviceSurfaceFormats2KHR(addrs, physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats);
+	}
+	VkResult ret = (((PFN_vkGetPhysicalDeviceSurfaceFormats2KHR)addrs->pvkGetPhysicalDeviceSurfaceFormats2KHR)(physicalDevice, pSurfaceInfo, pSurfaceFormatCount, pSurfaceFormats));
+	return ret;
+}
+
+// Runs the two-call idiom of vkGetPhysicalDeviceSurfaceFormats2KHR in one call. capacity is the
+// length of pSurfaceFormats; when it is too small, the result is VK_INCOMPLETE
+// with the count needed.
+vksEnumerateResult vksEnumerate_vkGetPhysicalDeviceSurfaceFormats2KHR(vksProcAddr* addrs, uint64_t physicalDevice, VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, uint32_t capacity, VkSurfaceFormat2KHR* pSurfaceFormats) {
+	vksEnumerateResult r = { VK_SUCCESS, capacity };
+	for (uint32_t i = 0; i < capacity; i++) {
+		pSurfaceFormats[i].sType = VK_STRUCTURE_TYPE_SURFACE_FORMAT_2_KHR;
+	}
+	if (capacity > 0) {
+		// Large enough buffers skip the count query.
+		r.result = vkGetPhysicalDeviceSurfaceFormats2KHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, pSurfaceInfo, &r.count, pSurfaceFormats);
+		if (r.result < 0) {
+			r.count = 0;
+		}
+		if (r.result != VK_INCOMPLETE) {
+			return r;
+		}
+	}
+	for (;;) {
+		r.count = 0;
+		r.result = vkGetPhysicalDeviceSurfaceFormats2KHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, pSurfaceInfo, &r.count, NULL);
+		if (r.result < 0) {
+			r.count = 0;
+			return r;
+		}
+		if (r.count > capacity) {
+			r.result = VK_INCOMPLETE;
+			return r;
+		}
+		r.result = vkGetPhysicalDeviceSurfaceFormats2KHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, pSurfaceInfo, &r.count, pSurfaceFormats);
+		if (r.result != VK_INCOMPLETE) {
+			if (r.result < 0) {
+				r.count = 0;
+			}
+			return r;
+		}
+		// The count grew between the calls.
+	}
+}
@@ -0,0 +1,486 @@
+//go:build !vks_no_khr_get_surface_capabilities2 && !vks_no_khr_surface
+
+package vks
+
+// Bindings of VK_KHR_get_surface_capabilities2, left out by the vks_no_khr_get_surface_capabilities2 build tag.
+
+//#cgo CFLAGS: -DVKS_ENABLE_KHR_GET_SURFACE_CAPABILITIES2
+//#include "vk_wrapper.h"
+import "C"
+import (
+	"unsafe"
+)
+
+// PhysicalDeviceSurfaceInfo2KHR provides a go interface for VkPhysicalDeviceSurfaceInfo2KHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceSurfaceInfo2KHR.html
+type PhysicalDeviceSurfaceInfo2KHR C.struct_VkPhysicalDeviceSurfaceInfo2KHR
+
+// SizeofPhysicalDeviceSurfaceInfo2KHR is the memory size of a PhysicalDeviceSurfaceInfo2KHR
+var SizeofPhysicalDeviceSurfaceInfo2KHR int = int(unsafe.Sizeof(PhysicalDeviceSurfaceInfo2KHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceSurfaceInfo2KHR) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceSurfaceInfo2KHR {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceSurfaceInfo2KHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceSurfaceInfo2KHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceSurfaceInfo2KHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceSurfaceInfo2KHR) AsCPtr() *PhysicalDeviceSurfaceInfo2KHR {
+	clone := (*PhysicalDeviceSurfaceInfo2KHR)(newCBlock(cULong(SizeofPhysicalDeviceSurfaceInfo2KHR)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceSurfaceInfo2KHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceSurfaceInfo2KHRCSlice(arp *AutoReleasePool, x ...PhysicalDeviceSurfaceInfo2KHR) []PhysicalDeviceSurfaceInfo2KHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceSurfaceInfo2KHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceSurfaceInfo2KHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceSurfaceInfo2KHRFreeCSlice releases the memory allocated by PhysicalDeviceSurfaceInfo2KHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceSurfaceInfo2KHRFreeCSlice(x []PhysicalDeviceSurfaceInfo2KHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceSurfaceInfo2KHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceSurfaceInfo2KHRFreeCSlice must be called on the returned slice.
+func PhysicalDeviceSurfaceInfo2KHRMakeCSlice(x ...PhysicalDeviceSurfaceInfo2KHR) []PhysicalDeviceSurfaceInfo2KHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceSurfaceInfo2KHR * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceSurfaceInfo2KHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceSurfaceInfo2KHR
+func (x PhysicalDeviceSurfaceInfo2KHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceSurfaceInfo2KHR with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceSurfaceInfo2KHR) WithDefaultSType() PhysicalDeviceSurfaceInfo2KHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SURFACE_INFO_2_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceSurfaceInfo2KHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SURFACE_INFO_2_KHR)
+}
+
+// WithSType clones a new PhysicalDeviceSurfaceInfo2KHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSurfaceInfo2KHR) WithSType(y StructureType) PhysicalDeviceSurfaceInfo2KHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceSurfaceInfo2KHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceSurfaceInfo2KHR
+func (x PhysicalDeviceSurfaceInfo2KHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceSurfaceInfo2KHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSurfaceInfo2KHR) WithPNext(y unsafe.Pointer) PhysicalDeviceSurfaceInfo2KHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceSurfaceInfo2KHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceSurfaceInfo2KHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Surface returns the value of surface from VkPhysicalDeviceSurfaceInfo2KHR
+func (x PhysicalDeviceSurfaceInfo2KHR) Surface() SurfaceKHR {
+	ptr := /* handle */ (*SurfaceKHR)(&x.surface)
+	return *ptr
+}
+
+// WithSurface clones a new PhysicalDeviceSurfaceInfo2KHR with the value of
+// Surface updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSurfaceInfo2KHR) WithSurface(y SurfaceKHR) PhysicalDeviceSurfaceInfo2KHR {
+	x.surface = *( /* handle */ (*C.VkSurfaceKHR)(&y))
+	return x
+}
+func (x *PhysicalDeviceSurfaceInfo2KHR) SetSurface(y SurfaceKHR) {
+	x.surface = *( /* handle */ (*C.VkSurfaceKHR)(&y))
+}
+
+// SurfaceCapabilities2KHR provides a go interface for VkSurfaceCapabilities2KHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSurfaceCapabilities2KHR.html
+type SurfaceCapabilities2KHR C.struct_VkSurfaceCapabilities2KHR
+
+// SizeofSurfaceCapabilities2KHR is the memory size of a SurfaceCapabilities2KHR
+var SizeofSurfaceCapabilities2KHR int = int(unsafe.Sizeof(SurfaceCapabilities2KHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SurfaceCapabilities2KHR) ArpPtr(arp *AutoReleasePool) *SurfaceCapabilities2KHR {
+	ptr := newCBlock(cULong(SizeofSurfaceCapabilities2KHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SurfaceCapabilities2KHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SurfaceCapabilities2KHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SurfaceCapabilities2KHR) AsCPtr() *SurfaceCapabilities2KHR {
+	clone := (*SurfaceCapabilities2KHR)(newCBlock(cULong(SizeofSurfaceCapabilities2KHR)))
+	*clone = x
+	return clone
+}
+
+// SurfaceCapabilities2KHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SurfaceCapabilities2KHRCSlice(arp *AutoReleasePool, x ...SurfaceCapabilities2KHR) []SurfaceCapabilities2KHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSurfaceCapabilities2KHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SurfaceCapabilities2KHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SurfaceCapabilities2KHRFreeCSlice releases the memory allocated by SurfaceCapabilities2KHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func SurfaceCapabilities2KHRFreeCSlice(x []SurfaceCapabilities2KHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SurfaceCapabilities2KHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SurfaceCapabilities2KHRFreeCSlice must be called on the returned slice.
+func SurfaceCapabilities2KHRMakeCSlice(x ...SurfaceCapabilities2KHR) []SurfaceCapabilities2KHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSurfaceCapabilities2KHR * len(x)
+	dst := unsafe.Slice((*SurfaceCapabilities2KHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkSurfaceCapabilities2KHR
+func (x *SurfaceCapabilities2KHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new SurfaceCapabilities2KHR with the value of
+// SType to the value provided in the specification.
+func (x SurfaceCapabilities2KHR) WithDefaultSType() SurfaceCapabilities2KHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *SurfaceCapabilities2KHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_2_KHR)
+}
+
+// WithSType clones a new SurfaceCapabilities2KHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SurfaceCapabilities2KHR) WithSType(y StructureType) SurfaceCapabilities2KHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *SurfaceCapabilities2KHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkSurfaceCapabilities2KHR
+func (x *SurfaceCapabilities2KHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new SurfaceCapabilities2KHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SurfaceCapabilities2KHR) WithPNext(y unsafe.Pointer) SurfaceCapabilities2KHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *SurfaceCapabilities2KHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SurfaceCapabilities2KHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SurfaceCapabilities returns the value of surfaceCapabilities from VkSurfaceCapabilities2KHR
+func (x *SurfaceCapabilities2KHR) SurfaceCapabilities() SurfaceCapabilitiesKHR {
+	ptr := /* typedef */ (*SurfaceCapabilitiesKHR)(&x.surfaceCapabilities)
+	return *ptr
+}
+
+// SurfaceFormat2KHR provides a go interface for VkSurfaceFormat2KHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSurfaceFormat2KHR.html
+type SurfaceFormat2KHR C.struct_VkSurfaceFormat2KHR
+
+// SizeofSurfaceFormat2KHR is the memory size of a SurfaceFormat2KHR
+var SizeofSurfaceFormat2KHR int = int(unsafe.Sizeof(SurfaceFormat2KHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SurfaceFormat2KHR) ArpPtr(arp *AutoReleasePool) *SurfaceFormat2KHR {
+	ptr := newCBlock(cULong(SizeofSurfaceFormat2KHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SurfaceFormat2KHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SurfaceFormat2KHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SurfaceFormat2KHR) AsCPtr() *SurfaceFormat2KHR {
+	clone := (*SurfaceFormat2KHR)(newCBlock(cULong(SizeofSurfaceFormat2KHR)))
+	*clone = x
+	return clone
+}
+
+// SurfaceFormat2KHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SurfaceFormat2KHRCSlice(arp *AutoReleasePool, x ...SurfaceFormat2KHR) []SurfaceFormat2KHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSurfaceFormat2KHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SurfaceFormat2KHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SurfaceFormat2KHRFreeCSlice releases the memory allocated by SurfaceFormat2KHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func SurfaceFormat2KHRFreeCSlice(x []SurfaceFormat2KHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SurfaceFormat2KHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SurfaceFormat2KHRFreeCSlice must be called on the returned slice.
+func SurfaceFormat2KHRMakeCSlice(x ...SurfaceFormat2KHR) []SurfaceFormat2KHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSurfaceFormat2KHR * len(x)
+	dst := unsafe.Slice((*SurfaceFormat2KHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkSurfaceFormat2KHR
+func (x SurfaceFormat2KHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new SurfaceFormat2KHR with the value of
+// SType to the value provided in the specification.
+func (x SurfaceFormat2KHR) WithDefaultSType() SurfaceFormat2KHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_SURFACE_FORMAT_2_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *SurfaceFormat2KHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_SURFACE_FORMAT_2_KHR)
+}
+
+// WithSType clones a new SurfaceFormat2KHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SurfaceFormat2KHR) WithSType(y StructureType) SurfaceFormat2KHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *SurfaceFormat2KHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkSurfaceFormat2KHR
+func (x SurfaceFormat2KHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new SurfaceFormat2KHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SurfaceFormat2KHR) WithPNext(y unsafe.Pointer) SurfaceFormat2KHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *SurfaceFormat2KHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SurfaceFormat2KHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SurfaceFormat returns the value of surfaceFormat from VkSurfaceFormat2KHR
+func (x SurfaceFormat2KHR) SurfaceFormat() SurfaceFormatKHR {
+	ptr := /* typedef */ (*SurfaceFormatKHR)(&x.surfaceFormat)
+	return *ptr
+}
+
+// GetPhysicalDeviceSurfaceCapabilities2KHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPhysicalDeviceSurfaceCapabilities2KHR.html
+func (x PhysicalDeviceFacade) GetPhysicalDeviceSurfaceCapabilities2KHR(pSurfaceInfo *PhysicalDeviceSurfaceInfo2KHR, pSurfaceCapabilities *SurfaceCapabilities2KHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := func(x **PhysicalDeviceSurfaceInfo2KHR) **C.struct_VkPhysicalDeviceSurfaceInfo2KHR { /* Pointer */
+		g2c := (*C.struct_VkPhysicalDeviceSurfaceInfo2KHR)(*x)
+		return &g2c
+	}(&pSurfaceInfo)
+	p2 := func(x **SurfaceCapabilities2KHR) **C.struct_VkSurfaceCapabilities2KHR { /* Pointer */
+		g2c := (*C.struct_VkSurfaceCapabilities2KHR)(*x)
+		return &g2c
+	}(&pSurfaceCapabilities)
+	ret := C.vkGetPhysicalDeviceSurfaceCapabilities2KHR(addrs, *p0, *p1, *p2)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetPhysicalDeviceSurfaceFormats2KHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPhysicalDeviceSurfaceFormats2KHR.html
+func (x PhysicalDeviceFacade) GetPhysicalDeviceSurfaceFormats2KHR(pSurfaceInfo *PhysicalDeviceSurfaceInfo2KHR, pSurfaceFormatCount *uint32, pSurfaceFormats []SurfaceFormat2KHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := func(x **PhysicalDeviceSurfaceInfo2KHR) **C.struct_VkPhysicalDeviceSurfaceInfo2KHR { /* Pointer */
+		g2c := (*C.struct_VkPhysicalDeviceSurfaceInfo2KHR)(*x)
+		return &g2c
+	}(&pSurfaceInfo)
+	p2 := func(x **uint32) **C.uint32_t { /* Pointer */ g2c := (*C.uint32_t)(*x); return &g2c }(&pSurfaceFormatCount)
+	p3 := func(x *[]SurfaceFormat2KHR) **C.struct_VkSurfaceFormat2KHR { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkSurfaceFormat2KHR)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkSurfaceFormat2KHR)(unsafe.Pointer((&ptr)))
+	}(&pSurfaceFormats)
+	ret := C.vkGetPhysicalDeviceSurfaceFormats2KHR(addrs, *p0, *p1, *p2, *p3)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetPhysicalDeviceSurfaceFormats2KHRInto calls GetPhysicalDeviceSurfaceFormats2KHR with the count query, the fill and
+// the VK_INCOMPLETE retries in a single cgo call. The elements are stored in
+// dst, reallocated only when its capacity is too small, and returned.
+// The sType of every element is set; pNext is passed through.
+func (x PhysicalDeviceFacade) GetPhysicalDeviceSurfaceFormats2KHRInto(pSurfaceInfo *PhysicalDeviceSurfaceInfo2KHR, dst []SurfaceFormat2KHR) ([]SurfaceFormat2KHR, Result) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := func(x **PhysicalDeviceSurfaceInfo2KHR) **C.struct_VkPhysicalDeviceSurfaceInfo2KHR { /* Pointer */
+		g2c := (*C.struct_VkPhysicalDeviceSurfaceInfo2KHR)(*x)
+		return &g2c
+	}(&pSurfaceInfo)
+	for {
+		dst = dst[:cap(dst)]
+		var items *C.struct_VkSurfaceFormat2KHR
+		if len(dst) > 0 {
+			items = (*C.struct_VkSurfaceFormat2KHR)(unsafe.Pointer(&dst[0]))
+		}
+		ret := C.vksEnumerate_vkGetPhysicalDeviceSurfaceFormats2KHR(addrs, C.uint64_t(uintptr(unsafe.Pointer(*p0))), *p1, C.uint32_t(len(dst)), items)
+		if Result(ret.result) == VK_INCOMPLETE && int(ret.count) > len(dst) {
+			dst = make([]SurfaceFormat2KHR, ret.count)
+			continue
+		}
+		return dst[:ret.count], Result(ret.result)
+	}
+}
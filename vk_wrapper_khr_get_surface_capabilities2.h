@@ -0,0 +1,10 @@
+#ifndef __VKS_KHR_GET_SURFACE_CAPABILITIES2_H__
+#define __VKS_KHR_GET_SURFACE_CAPABILITIES2_H__
+#include "vk_wrapper.h"
+
+// Wrappers of VK_KHR_get_surface_capabilities2.
+VkResult vkGetPhysicalDeviceSurfaceCapabilities2KHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, VkSurfaceCapabilities2KHR* pSurfaceCapabilities);
+VkResult vkGetPhysicalDeviceSurfaceFormats2KHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, uint32_t* pSurfaceFormatCount, VkSurfaceFormat2KHR* pSurfaceFormats);
+vksEnumerateResult vksEnumerate_vkGetPhysicalDeviceSurfaceFormats2KHR(vksProcAddr* addrs, uint64_t physicalDevice, VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo, uint32_t capacity, VkSurfaceFormat2KHR* pSurfaceFormats);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,203 @@
+//go:build !vks_no_khr_pipeline_library
+
+package vks
+
+// Bindings of VK_KHR_pipeline_library, left out by the vks_no_khr_pipeline_library build tag.
+
+//#cgo CFLAGS: -DVKS_ENABLE_KHR_PIPELINE_LIBRARY
+//#include "vk_wrapper.h"
+import "C"
+import (
+	"unsafe"
+)
+
+// PipelineLibraryCreateInfoKHR provides a go interface for VkPipelineLibraryCreateInfoKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPipelineLibraryCreateInfoKHR.html
+type PipelineLibraryCreateInfoKHR C.struct_VkPipelineLibraryCreateInfoKHR
+
+// SizeofPipelineLibraryCreateInfoKHR is the memory size of a PipelineLibraryCreateInfoKHR
+var SizeofPipelineLibraryCreateInfoKHR int = int(unsafe.Sizeof(PipelineLibraryCreateInfoKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PipelineLibraryCreateInfoKHR) ArpPtr(arp *AutoReleasePool) *PipelineLibraryCreateInfoKHR {
+	ptr := newCBlock(cULong(SizeofPipelineLibraryCreateInfoKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PipelineLibraryCreateInfoKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PipelineLibraryCreateInfoKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PipelineLibraryCreateInfoKHR) AsCPtr() *PipelineLibraryCreateInfoKHR {
+	clone := (*PipelineLibraryCreateInfoKHR)(newCBlock(cULong(SizeofPipelineLibraryCreateInfoKHR)))
+	*clone = x
+	return clone
+}
+
+// PipelineLibraryCreateInfoKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PipelineLibraryCreateInfoKHRCSlice(arp *AutoReleasePool, x ...PipelineLibraryCreateInfoKHR) []PipelineLibraryCreateInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPipelineLibraryCreateInfoKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PipelineLibraryCreateInfoKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PipelineLibraryCreateInfoKHRFreeCSlice releases the memory allocated by PipelineLibraryCreateInfoKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PipelineLibraryCreateInfoKHRFreeCSlice(x []PipelineLibraryCreateInfoKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PipelineLibraryCreateInfoKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PipelineLibraryCreateInfoKHRFreeCSlice must be called on the returned slice.
+func PipelineLibraryCreateInfoKHRMakeCSlice(x ...PipelineLibraryCreateInfoKHR) []PipelineLibraryCreateInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPipelineLibraryCreateInfoKHR * len(x)
+	dst := unsafe.Slice((*PipelineLibraryCreateInfoKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPipelineLibraryCreateInfoKHR
+func (x PipelineLibraryCreateInfoKHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PipelineLibraryCreateInfoKHR with the value of
+// SType to the value provided in the specification.
+func (x PipelineLibraryCreateInfoKHR) WithDefaultSType() PipelineLibraryCreateInfoKHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PipelineLibraryCreateInfoKHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PIPELINE_LIBRARY_CREATE_INFO_KHR)
+}
+
+// WithSType clones a new PipelineLibraryCreateInfoKHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PipelineLibraryCreateInfoKHR) WithSType(y StructureType) PipelineLibraryCreateInfoKHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PipelineLibraryCreateInfoKHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPipelineLibraryCreateInfoKHR
+func (x PipelineLibraryCreateInfoKHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PipelineLibraryCreateInfoKHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PipelineLibraryCreateInfoKHR) WithPNext(y unsafe.Pointer) PipelineLibraryCreateInfoKHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PipelineLibraryCreateInfoKHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PipelineLibraryCreateInfoKHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// LibraryCount returns the value of libraryCount from VkPipelineLibraryCreateInfoKHR
+func (x PipelineLibraryCreateInfoKHR) LibraryCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.libraryCount)
+	return *ptr
+}
+
+// WithLibraryCount clones a new PipelineLibraryCreateInfoKHR with the value of
+// LibraryCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PipelineLibraryCreateInfoKHR) WithLibraryCount(y uint32) PipelineLibraryCreateInfoKHR {
+	x.libraryCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *PipelineLibraryCreateInfoKHR) SetLibraryCount(y uint32) {
+	x.libraryCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PLibraries returns the value of pLibraries from VkPipelineLibraryCreateInfoKHR
+func (x PipelineLibraryCreateInfoKHR) PLibraries() []Pipeline {
+	if x.pLibraries == nil {
+		return nil
+	}
+	return unsafe.Slice((*Pipeline)(unsafe.Pointer(x.pLibraries)), x.libraryCount)
+}
+
+// WithPLibraries clones a new PipelineLibraryCreateInfoKHR with the value of
+// PLibraries updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines LibraryCount as the length of this field.
+// LibraryCount is updated with the length of the new value.
+func (x PipelineLibraryCreateInfoKHR) WithPLibraries(y []Pipeline) PipelineLibraryCreateInfoKHR {
+	x.pLibraries = *(func(x *[]Pipeline) **C.VkPipeline { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkPipeline)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkPipeline)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithLibraryCount(uint32(len(y)))
+}
+func (x *PipelineLibraryCreateInfoKHR) SetPLibraries(y []Pipeline) {
+	x.pLibraries = *(func(x *[]Pipeline) **C.VkPipeline { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkPipeline)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkPipeline)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetLibraryCount(uint32(len(y)))
+}
+
+// PinPLibraries pins the Go memory referenced by y with the AutoReleasePool
+// and sets PLibraries, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PipelineLibraryCreateInfoKHR) PinPLibraries(arp *AutoReleasePool, y []Pipeline) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPLibraries(y)
+}
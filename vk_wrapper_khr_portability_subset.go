@@ -0,0 +1,536 @@
+//go:build !vks_no_khr_portability_subset && !vks_no_version_1_1
+
+package vks
+
+// Bindings of VK_KHR_portability_subset, left out by the vks_no_khr_portability_subset build tag.
+
+//#cgo CFLAGS: -DVKS_ENABLE_KHR_PORTABILITY_SUBSET
+//#include "vk_wrapper.h"
+import "C"
+import (
+	"unsafe"
+)
+
+// PhysicalDevicePortabilitySubsetFeaturesKHR provides a go interface for VkPhysicalDevicePortabilitySubsetFeaturesKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDevicePortabilitySubsetFeaturesKHR.html
+type PhysicalDevicePortabilitySubsetFeaturesKHR C.struct_VkPhysicalDevicePortabilitySubsetFeaturesKHR
+
+// SizeofPhysicalDevicePortabilitySubsetFeaturesKHR is the memory size of a PhysicalDevicePortabilitySubsetFeaturesKHR
+var SizeofPhysicalDevicePortabilitySubsetFeaturesKHR int = int(unsafe.Sizeof(PhysicalDevicePortabilitySubsetFeaturesKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDevicePortabilitySubsetFeaturesKHR) ArpPtr(arp *AutoReleasePool) *PhysicalDevicePortabilitySubsetFeaturesKHR {
+	ptr := newCBlock(cULong(SizeofPhysicalDevicePortabilitySubsetFeaturesKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDevicePortabilitySubsetFeaturesKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDevicePortabilitySubsetFeaturesKHR) AsCPtr() *PhysicalDevicePortabilitySubsetFeaturesKHR {
+	clone := (*PhysicalDevicePortabilitySubsetFeaturesKHR)(newCBlock(cULong(SizeofPhysicalDevicePortabilitySubsetFeaturesKHR)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDevicePortabilitySubsetFeaturesKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDevicePortabilitySubsetFeaturesKHRCSlice(arp *AutoReleasePool, x ...PhysicalDevicePortabilitySubsetFeaturesKHR) []PhysicalDevicePortabilitySubsetFeaturesKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDevicePortabilitySubsetFeaturesKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDevicePortabilitySubsetFeaturesKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDevicePortabilitySubsetFeaturesKHRFreeCSlice releases the memory allocated by PhysicalDevicePortabilitySubsetFeaturesKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDevicePortabilitySubsetFeaturesKHRFreeCSlice(x []PhysicalDevicePortabilitySubsetFeaturesKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDevicePortabilitySubsetFeaturesKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDevicePortabilitySubsetFeaturesKHRFreeCSlice must be called on the returned slice.
+func PhysicalDevicePortabilitySubsetFeaturesKHRMakeCSlice(x ...PhysicalDevicePortabilitySubsetFeaturesKHR) []PhysicalDevicePortabilitySubsetFeaturesKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDevicePortabilitySubsetFeaturesKHR * len(x)
+	dst := unsafe.Slice((*PhysicalDevicePortabilitySubsetFeaturesKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDevicePortabilitySubsetFeaturesKHR
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDevicePortabilitySubsetFeaturesKHR with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDevicePortabilitySubsetFeaturesKHR) WithDefaultSType() PhysicalDevicePortabilitySubsetFeaturesKHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_FEATURES_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_FEATURES_KHR)
+}
+
+// WithSType clones a new PhysicalDevicePortabilitySubsetFeaturesKHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePortabilitySubsetFeaturesKHR) WithSType(y StructureType) PhysicalDevicePortabilitySubsetFeaturesKHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDevicePortabilitySubsetFeaturesKHR
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDevicePortabilitySubsetFeaturesKHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePortabilitySubsetFeaturesKHR) WithPNext(y unsafe.Pointer) PhysicalDevicePortabilitySubsetFeaturesKHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ConstantAlphaColorBlendFactors returns the value of constantAlphaColorBlendFactors from VkPhysicalDevicePortabilitySubsetFeaturesKHR
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) ConstantAlphaColorBlendFactors() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.constantAlphaColorBlendFactors)
+	return *ptr
+}
+
+// WithConstantAlphaColorBlendFactors clones a new PhysicalDevicePortabilitySubsetFeaturesKHR with the value of
+// ConstantAlphaColorBlendFactors updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePortabilitySubsetFeaturesKHR) WithConstantAlphaColorBlendFactors(y Bool32) PhysicalDevicePortabilitySubsetFeaturesKHR {
+	x.constantAlphaColorBlendFactors = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) SetConstantAlphaColorBlendFactors(y Bool32) {
+	x.constantAlphaColorBlendFactors = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// Events returns the value of events from VkPhysicalDevicePortabilitySubsetFeaturesKHR
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) Events() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.events)
+	return *ptr
+}
+
+// WithEvents clones a new PhysicalDevicePortabilitySubsetFeaturesKHR with the value of
+// Events updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePortabilitySubsetFeaturesKHR) WithEvents(y Bool32) PhysicalDevicePortabilitySubsetFeaturesKHR {
+	x.events = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) SetEvents(y Bool32) {
+	x.events = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ImageViewFormatReinterpretation returns the value of imageViewFormatReinterpretation from VkPhysicalDevicePortabilitySubsetFeaturesKHR
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) ImageViewFormatReinterpretation() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.imageViewFormatReinterpretation)
+	return *ptr
+}
+
+// WithImageViewFormatReinterpretation clones a new PhysicalDevicePortabilitySubsetFeaturesKHR with the value of
+// ImageViewFormatReinterpretation updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePortabilitySubsetFeaturesKHR) WithImageViewFormatReinterpretation(y Bool32) PhysicalDevicePortabilitySubsetFeaturesKHR {
+	x.imageViewFormatReinterpretation = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) SetImageViewFormatReinterpretation(y Bool32) {
+	x.imageViewFormatReinterpretation = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ImageViewFormatSwizzle returns the value of imageViewFormatSwizzle from VkPhysicalDevicePortabilitySubsetFeaturesKHR
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) ImageViewFormatSwizzle() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.imageViewFormatSwizzle)
+	return *ptr
+}
+
+// WithImageViewFormatSwizzle clones a new PhysicalDevicePortabilitySubsetFeaturesKHR with the value of
+// ImageViewFormatSwizzle updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePortabilitySubsetFeaturesKHR) WithImageViewFormatSwizzle(y Bool32) PhysicalDevicePortabilitySubsetFeaturesKHR {
+	x.imageViewFormatSwizzle = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) SetImageViewFormatSwizzle(y Bool32) {
+	x.imageViewFormatSwizzle = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ImageView2DOn3DImage returns the value of imageView2DOn3DImage from VkPhysicalDevicePortabilitySubsetFeaturesKHR
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) ImageView2DOn3DImage() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.imageView2DOn3DImage)
+	return *ptr
+}
+
+// WithImageView2DOn3DImage clones a new PhysicalDevicePortabilitySubsetFeaturesKHR with the value of
+// ImageView2DOn3DImage updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePortabilitySubsetFeaturesKHR) WithImageView2DOn3DImage(y Bool32) PhysicalDevicePortabilitySubsetFeaturesKHR {
+	x.imageView2DOn3DImage = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) SetImageView2DOn3DImage(y Bool32) {
+	x.imageView2DOn3DImage = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// MultisampleArrayImage returns the value of multisampleArrayImage from VkPhysicalDevicePortabilitySubsetFeaturesKHR
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) MultisampleArrayImage() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.multisampleArrayImage)
+	return *ptr
+}
+
+// WithMultisampleArrayImage clones a new PhysicalDevicePortabilitySubsetFeaturesKHR with the value of
+// MultisampleArrayImage updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePortabilitySubsetFeaturesKHR) WithMultisampleArrayImage(y Bool32) PhysicalDevicePortabilitySubsetFeaturesKHR {
+	x.multisampleArrayImage = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) SetMultisampleArrayImage(y Bool32) {
+	x.multisampleArrayImage = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// MutableComparisonSamplers returns the value of mutableComparisonSamplers from VkPhysicalDevicePortabilitySubsetFeaturesKHR
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) MutableComparisonSamplers() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.mutableComparisonSamplers)
+	return *ptr
+}
+
+// WithMutableComparisonSamplers clones a new PhysicalDevicePortabilitySubsetFeaturesKHR with the value of
+// MutableComparisonSamplers updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePortabilitySubsetFeaturesKHR) WithMutableComparisonSamplers(y Bool32) PhysicalDevicePortabilitySubsetFeaturesKHR {
+	x.mutableComparisonSamplers = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) SetMutableComparisonSamplers(y Bool32) {
+	x.mutableComparisonSamplers = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PointPolygons returns the value of pointPolygons from VkPhysicalDevicePortabilitySubsetFeaturesKHR
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) PointPolygons() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.pointPolygons)
+	return *ptr
+}
+
+// WithPointPolygons clones a new PhysicalDevicePortabilitySubsetFeaturesKHR with the value of
+// PointPolygons updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePortabilitySubsetFeaturesKHR) WithPointPolygons(y Bool32) PhysicalDevicePortabilitySubsetFeaturesKHR {
+	x.pointPolygons = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) SetPointPolygons(y Bool32) {
+	x.pointPolygons = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// SamplerMipLodBias returns the value of samplerMipLodBias from VkPhysicalDevicePortabilitySubsetFeaturesKHR
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) SamplerMipLodBias() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.samplerMipLodBias)
+	return *ptr
+}
+
+// WithSamplerMipLodBias clones a new PhysicalDevicePortabilitySubsetFeaturesKHR with the value of
+// SamplerMipLodBias updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePortabilitySubsetFeaturesKHR) WithSamplerMipLodBias(y Bool32) PhysicalDevicePortabilitySubsetFeaturesKHR {
+	x.samplerMipLodBias = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) SetSamplerMipLodBias(y Bool32) {
+	x.samplerMipLodBias = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// SeparateStencilMaskRef returns the value of separateStencilMaskRef from VkPhysicalDevicePortabilitySubsetFeaturesKHR
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) SeparateStencilMaskRef() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.separateStencilMaskRef)
+	return *ptr
+}
+
+// WithSeparateStencilMaskRef clones a new PhysicalDevicePortabilitySubsetFeaturesKHR with the value of
+// SeparateStencilMaskRef updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePortabilitySubsetFeaturesKHR) WithSeparateStencilMaskRef(y Bool32) PhysicalDevicePortabilitySubsetFeaturesKHR {
+	x.separateStencilMaskRef = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) SetSeparateStencilMaskRef(y Bool32) {
+	x.separateStencilMaskRef = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderSampleRateInterpolationFunctions returns the value of shaderSampleRateInterpolationFunctions from VkPhysicalDevicePortabilitySubsetFeaturesKHR
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) ShaderSampleRateInterpolationFunctions() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderSampleRateInterpolationFunctions)
+	return *ptr
+}
+
+// WithShaderSampleRateInterpolationFunctions clones a new PhysicalDevicePortabilitySubsetFeaturesKHR with the value of
+// ShaderSampleRateInterpolationFunctions updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePortabilitySubsetFeaturesKHR) WithShaderSampleRateInterpolationFunctions(y Bool32) PhysicalDevicePortabilitySubsetFeaturesKHR {
+	x.shaderSampleRateInterpolationFunctions = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) SetShaderSampleRateInterpolationFunctions(y Bool32) {
+	x.shaderSampleRateInterpolationFunctions = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// TessellationIsolines returns the value of tessellationIsolines from VkPhysicalDevicePortabilitySubsetFeaturesKHR
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) TessellationIsolines() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.tessellationIsolines)
+	return *ptr
+}
+
+// WithTessellationIsolines clones a new PhysicalDevicePortabilitySubsetFeaturesKHR with the value of
+// TessellationIsolines updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePortabilitySubsetFeaturesKHR) WithTessellationIsolines(y Bool32) PhysicalDevicePortabilitySubsetFeaturesKHR {
+	x.tessellationIsolines = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) SetTessellationIsolines(y Bool32) {
+	x.tessellationIsolines = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// TessellationPointMode returns the value of tessellationPointMode from VkPhysicalDevicePortabilitySubsetFeaturesKHR
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) TessellationPointMode() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.tessellationPointMode)
+	return *ptr
+}
+
+// WithTessellationPointMode clones a new PhysicalDevicePortabilitySubsetFeaturesKHR with the value of
+// TessellationPointMode updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePortabilitySubsetFeaturesKHR) WithTessellationPointMode(y Bool32) PhysicalDevicePortabilitySubsetFeaturesKHR {
+	x.tessellationPointMode = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) SetTessellationPointMode(y Bool32) {
+	x.tessellationPointMode = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// TriangleFans returns the value of triangleFans from VkPhysicalDevicePortabilitySubsetFeaturesKHR
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) TriangleFans() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.triangleFans)
+	return *ptr
+}
+
+// WithTriangleFans clones a new PhysicalDevicePortabilitySubsetFeaturesKHR with the value of
+// TriangleFans updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePortabilitySubsetFeaturesKHR) WithTriangleFans(y Bool32) PhysicalDevicePortabilitySubsetFeaturesKHR {
+	x.triangleFans = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) SetTriangleFans(y Bool32) {
+	x.triangleFans = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// VertexAttributeAccessBeyondStride returns the value of vertexAttributeAccessBeyondStride from VkPhysicalDevicePortabilitySubsetFeaturesKHR
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) VertexAttributeAccessBeyondStride() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.vertexAttributeAccessBeyondStride)
+	return *ptr
+}
+
+// WithVertexAttributeAccessBeyondStride clones a new PhysicalDevicePortabilitySubsetFeaturesKHR with the value of
+// VertexAttributeAccessBeyondStride updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePortabilitySubsetFeaturesKHR) WithVertexAttributeAccessBeyondStride(y Bool32) PhysicalDevicePortabilitySubsetFeaturesKHR {
+	x.vertexAttributeAccessBeyondStride = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevicePortabilitySubsetFeaturesKHR) SetVertexAttributeAccessBeyondStride(y Bool32) {
+	x.vertexAttributeAccessBeyondStride = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PhysicalDevicePortabilitySubsetPropertiesKHR provides a go interface for VkPhysicalDevicePortabilitySubsetPropertiesKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDevicePortabilitySubsetPropertiesKHR.html
+type PhysicalDevicePortabilitySubsetPropertiesKHR C.struct_VkPhysicalDevicePortabilitySubsetPropertiesKHR
+
+// SizeofPhysicalDevicePortabilitySubsetPropertiesKHR is the memory size of a PhysicalDevicePortabilitySubsetPropertiesKHR
+var SizeofPhysicalDevicePortabilitySubsetPropertiesKHR int = int(unsafe.Sizeof(PhysicalDevicePortabilitySubsetPropertiesKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDevicePortabilitySubsetPropertiesKHR) ArpPtr(arp *AutoReleasePool) *PhysicalDevicePortabilitySubsetPropertiesKHR {
+	ptr := newCBlock(cULong(SizeofPhysicalDevicePortabilitySubsetPropertiesKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDevicePortabilitySubsetPropertiesKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDevicePortabilitySubsetPropertiesKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDevicePortabilitySubsetPropertiesKHR) AsCPtr() *PhysicalDevicePortabilitySubsetPropertiesKHR {
+	clone := (*PhysicalDevicePortabilitySubsetPropertiesKHR)(newCBlock(cULong(SizeofPhysicalDevicePortabilitySubsetPropertiesKHR)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDevicePortabilitySubsetPropertiesKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDevicePortabilitySubsetPropertiesKHRCSlice(arp *AutoReleasePool, x ...PhysicalDevicePortabilitySubsetPropertiesKHR) []PhysicalDevicePortabilitySubsetPropertiesKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDevicePortabilitySubsetPropertiesKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDevicePortabilitySubsetPropertiesKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDevicePortabilitySubsetPropertiesKHRFreeCSlice releases the memory allocated by PhysicalDevicePortabilitySubsetPropertiesKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDevicePortabilitySubsetPropertiesKHRFreeCSlice(x []PhysicalDevicePortabilitySubsetPropertiesKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDevicePortabilitySubsetPropertiesKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDevicePortabilitySubsetPropertiesKHRFreeCSlice must be called on the returned slice.
+func PhysicalDevicePortabilitySubsetPropertiesKHRMakeCSlice(x ...PhysicalDevicePortabilitySubsetPropertiesKHR) []PhysicalDevicePortabilitySubsetPropertiesKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDevicePortabilitySubsetPropertiesKHR * len(x)
+	dst := unsafe.Slice((*PhysicalDevicePortabilitySubsetPropertiesKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDevicePortabilitySubsetPropertiesKHR
+func (x PhysicalDevicePortabilitySubsetPropertiesKHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDevicePortabilitySubsetPropertiesKHR with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDevicePortabilitySubsetPropertiesKHR) WithDefaultSType() PhysicalDevicePortabilitySubsetPropertiesKHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_PROPERTIES_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDevicePortabilitySubsetPropertiesKHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_PROPERTIES_KHR)
+}
+
+// WithSType clones a new PhysicalDevicePortabilitySubsetPropertiesKHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePortabilitySubsetPropertiesKHR) WithSType(y StructureType) PhysicalDevicePortabilitySubsetPropertiesKHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDevicePortabilitySubsetPropertiesKHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDevicePortabilitySubsetPropertiesKHR
+func (x PhysicalDevicePortabilitySubsetPropertiesKHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDevicePortabilitySubsetPropertiesKHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePortabilitySubsetPropertiesKHR) WithPNext(y unsafe.Pointer) PhysicalDevicePortabilitySubsetPropertiesKHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDevicePortabilitySubsetPropertiesKHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDevicePortabilitySubsetPropertiesKHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// MinVertexInputBindingStrideAlignment returns the value of minVertexInputBindingStrideAlignment from VkPhysicalDevicePortabilitySubsetPropertiesKHR
+func (x PhysicalDevicePortabilitySubsetPropertiesKHR) MinVertexInputBindingStrideAlignment() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.minVertexInputBindingStrideAlignment)
+	return *ptr
+}
+
+// WithMinVertexInputBindingStrideAlignment clones a new PhysicalDevicePortabilitySubsetPropertiesKHR with the value of
+// MinVertexInputBindingStrideAlignment updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePortabilitySubsetPropertiesKHR) WithMinVertexInputBindingStrideAlignment(y uint32) PhysicalDevicePortabilitySubsetPropertiesKHR {
+	x.minVertexInputBindingStrideAlignment = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDevicePortabilitySubsetPropertiesKHR) SetMinVertexInputBindingStrideAlignment(y uint32) {
+	x.minVertexInputBindingStrideAlignment = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
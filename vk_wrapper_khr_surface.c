@@ -0,0 +1,115 @@
+//go:build !vks_no_khr_surface
+
+// Wrappers of VK_KHR_surface.
+#include "vk_wrapper.h"
+#include "vk_capture.h"
+
+VkResult vkGetPhysicalDeviceSurfacePresentModesKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pPresentModeCount, VkPresentModeKHR* pPresentModes) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetPhysicalDeviceSurfacePresentModesKHR(addrs, physicalDevice, surface, pPresentModeCount, pPresentModes);
+	}
+	VkResult ret = (((PFN_vkGetPhysicalDeviceSurfacePresentModesKHR)addrs->pvkGetPhysicalDeviceSurfacePresentModesKHR)(physicalDevice, surface, pPresentModeCount, pPresentModes));
+	return ret;
+}
+
+// Runs the two-call idiom of vkGetPhysicalDeviceSurfacePresentModesKHR in one call. capacity is the
+// length of pPresentModes; when it is too small, the result is VK_INCOMPLETE
+// with the count needed.
+vksEnumerateResult vksEnumerate_vkGetPhysicalDeviceSurfacePresentModesKHR(vksProcAddr* addrs, uint64_t physicalDevice, uint64_t surface, uint32_t capacity, VkPresentModeKHR* pPresentModes) {
+	vksEnumerateResult r = { VK_SUCCESS, capacity };
+	if (capacity > 0) {
+		// Large enough buffers skip the count query.
+		r.result = vkGetPhysicalDeviceSurfacePresentModesKHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, (VkSurfaceKHR)(uintptr_t)surface, &r.count, pPresentModes);
+		if (r.result < 0) {
+			r.count = 0;
+		}
+		if (r.result != VK_INCOMPLETE) {
+			return r;
+		}
+	}
+	for (;;) {
+		r.count = 0;
+		r.result = vkGetPhysicalDeviceSurfacePresentModesKHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, (VkSurfaceKHR)(uintptr_t)surface, &r.count, NULL);
+		if (r.result < 0) {
+			r.count = 0;
+			return r;
+		}
+		if (r.count > capacity) {
+			r.result = VK_INCOMPLETE;
+			return r;
+		}
+		r.result = vkGetPhysicalDeviceSurfacePresentModesKHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, (VkSurfaceKHR)(uintptr_t)surface, &r.count, pPresentModes);
+		if (r.result != VK_INCOMPLETE) {
+			if (r.result < 0) {
+				r.count = 0;
+			}
+			return r;
+		}
+		// The count grew between the calls.
+	}
+}
+VkResult vkGetPhysicalDeviceSurfaceFormatsKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pSurfaceFormatCount, VkSurfaceFormatKHR* pSurfaceFormats) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetPhysicalDeviceSurfaceFormatsKHR(addrs, physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats);
+	}
+	VkResult ret = (((PFN_vkGetPhysicalDeviceSurfaceFormatsKHR)addrs->pvkGetPhysicalDeviceSurfaceFormatsKHR)(physicalDevice, surface, pSurfaceFormatCount, pSurfaceFormats));
+	return ret;
+}
+
+// Runs the two-call idiom of vkGetPhysicalDeviceSurfaceFormatsKHR in one call. capacity is the
+// length of pSurfaceFormats; when it is too small, the result is VK_INCOMPLETE
+// with the count needed.
+vksEnumerateResult vksEnumerate_vkGetPhysicalDeviceSurfaceFormatsKHR(vksProcAddr* addrs, uint64_t physicalDevice, uint64_t surface, uint32_t capacity, VkSurfaceFormatKHR* pSurfaceFormats) {
+	vksEnumerateResult r = { VK_SUCCESS, capacity };
+	if (capacity > 0) {
+		// Large enough buffers skip the count query.
+		r.result = vkGetPhysicalDeviceSurfaceFormatsKHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, (VkSurfaceKHR)(uintptr_t)surface, &r.count, pSurfaceFormats);
+		if (r.result < 0) {
+			r.count = 0;
+		}
+		if (r.result != VK_INCOMPLETE) {
+			return r;
+		}
+	}
+	for (;;) {
+		r.count = 0;
+		r.result = vkGetPhysicalDeviceSurfaceFormatsKHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, (VkSurfaceKHR)(uintptr_t)surface, &r.count, NULL);
+		if (r.result < 0) {
+			r.count = 0;
+			return r;
+		}
+		if (r.count > capacity) {
+			r.result = VK_INCOMPLETE;
+			return r;
+		}
+		r.result = vkGetPhysicalDeviceSurfaceFormatsKHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, (VkSurfaceKHR)(uintptr_t)surface, &r.count, pSurfaceFormats);
+		if (r.result != VK_INCOMPLETE) {
+			if (r.result < 0) {
+				r.count = 0;
+			}
+			return r;
+		}
+		// The count grew between the calls.
+	}
+}
+VkResult vkGetPhysicalDeviceSurfaceCapabilitiesKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR* pSurfaceCapabilities) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(addrs, physicalDevice, surface, pSurfaceCapabilities);
+	}
+	VkResult ret = (((PFN_vkGetPhysicalDeviceSurfaceCapabilitiesKHR)addrs->pvkGetPhysicalDeviceSurfaceCapabilitiesKHR)(physicalDevice, surface, pSurfaceCapabilities));
+	return ret;
+}
+VkResult vkGetPhysicalDeviceSurfaceSupportKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, VkSurfaceKHR surface, VkBool32* pSupported) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetPhysicalDeviceSurfaceSupportKHR(addrs, physicalDevice, queueFamilyIndex, surface, pSupported);
+	}
+	VkResult ret = (((PFN_vkGetPhysicalDeviceSurfaceSupportKHR)addrs->pvkGetPhysicalDeviceSurfaceSupportKHR)(physicalDevice, queueFamilyIndex, surface, pSupported));
+	return ret;
+}
+void vkDestroySurfaceKHR(vksProcAddr* addrs, VkInstance instance, VkSurfaceKHR surface, VkAllocationCallbacks* pAllocator) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkDestroySurfaceKHR(addrs, instance, surface, pAllocator);
+		return;
+	}
+	(((PFN_vkDestroySurfaceKHR)addrs->pvkDestroySurfaceKHR)(instance, surface, pAllocator));
+}
@@ -0,0 +1,547 @@
+//go:build !vks_no_khr_surface
+
+package vks
+
+// Bindings of VK_KHR_surface, left out by the vks_no_khr_surface build tag.
+
+//#cgo CFLAGS: -DVKS_ENABLE_KHR_SURFACE
+//#include "vk_wrapper.h"
+import "C"
+import (
+	"fmt"
+	"unsafe"
+)
+
+// SurfaceKHR is a Handle to a vulkan resource.
+// SurfaceKHR is a child of Instance.
+//
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSurfaceKHR.html
+type SurfaceKHR C.VkSurfaceKHR
+
+// NullSurfaceKHR is a typed Null value for the SurfaceKHR type.
+var NullSurfaceKHR SurfaceKHR
+
+// SurfaceTransformFlagBitsKHR enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSurfaceTransformFlagBitsKHR.html
+type SurfaceTransformFlagBitsKHR uint32
+
+const (
+	VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR                     SurfaceTransformFlagBitsKHR = (1 << 0)
+	VK_SURFACE_TRANSFORM_ROTATE_90_BIT_KHR                    SurfaceTransformFlagBitsKHR = (1 << 1)
+	VK_SURFACE_TRANSFORM_ROTATE_180_BIT_KHR                   SurfaceTransformFlagBitsKHR = (1 << 2)
+	VK_SURFACE_TRANSFORM_ROTATE_270_BIT_KHR                   SurfaceTransformFlagBitsKHR = (1 << 3)
+	VK_SURFACE_TRANSFORM_HORIZONTAL_MIRROR_BIT_KHR            SurfaceTransformFlagBitsKHR = (1 << 4)
+	VK_SURFACE_TRANSFORM_HORIZONTAL_MIRROR_ROTATE_90_BIT_KHR  SurfaceTransformFlagBitsKHR = (1 << 5)
+	VK_SURFACE_TRANSFORM_HORIZONTAL_MIRROR_ROTATE_180_BIT_KHR SurfaceTransformFlagBitsKHR = (1 << 6)
+	VK_SURFACE_TRANSFORM_HORIZONTAL_MIRROR_ROTATE_270_BIT_KHR SurfaceTransformFlagBitsKHR = (1 << 7)
+	VK_SURFACE_TRANSFORM_INHERIT_BIT_KHR                      SurfaceTransformFlagBitsKHR = (1 << 8)
+)
+
+const enumNamesSurfaceTransformFlagBitsKHR = "VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR" +
+	"VK_SURFACE_TRANSFORM_ROTATE_90_BIT_KHR" +
+	"VK_SURFACE_TRANSFORM_ROTATE_180_BIT_KHR" +
+	"VK_SURFACE_TRANSFORM_ROTATE_270_BIT_KHR" +
+	"VK_SURFACE_TRANSFORM_HORIZONTAL_MIRROR_BIT_KHR" +
+	"VK_SURFACE_TRANSFORM_HORIZONTAL_MIRROR_ROTATE_90_BIT_KHR" +
+	"VK_SURFACE_TRANSFORM_HORIZONTAL_MIRROR_ROTATE_180_BIT_KHR" +
+	"VK_SURFACE_TRANSFORM_HORIZONTAL_MIRROR_ROTATE_270_BIT_KHR" +
+	"VK_SURFACE_TRANSFORM_INHERIT_BIT_KHR"
+
+var enumTableSurfaceTransformFlagBitsKHR = enumTable[SurfaceTransformFlagBitsKHR, uint16]{
+	first: VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR,
+	dense: 8,
+	sparse: []SurfaceTransformFlagBitsKHR{
+		VK_SURFACE_TRANSFORM_HORIZONTAL_MIRROR_BIT_KHR,
+		VK_SURFACE_TRANSFORM_HORIZONTAL_MIRROR_ROTATE_90_BIT_KHR,
+		VK_SURFACE_TRANSFORM_HORIZONTAL_MIRROR_ROTATE_180_BIT_KHR,
+		VK_SURFACE_TRANSFORM_HORIZONTAL_MIRROR_ROTATE_270_BIT_KHR,
+		VK_SURFACE_TRANSFORM_INHERIT_BIT_KHR,
+	},
+	names: enumNamesSurfaceTransformFlagBitsKHR,
+	index: []uint16{0, 37, 75, 75, 114, 114, 114, 114, 153, 199, 255, 312, 369, 405},
+}
+
+func (x SurfaceTransformFlagBitsKHR) String() string {
+	if s, ok := enumTableSurfaceTransformFlagBitsKHR.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("SurfaceTransformFlagBitsKHR=%d", x)
+}
+
+// CompositeAlphaFlagBitsKHR enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkCompositeAlphaFlagBitsKHR.html
+type CompositeAlphaFlagBitsKHR uint32
+
+const (
+	VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR          CompositeAlphaFlagBitsKHR = (1 << 0)
+	VK_COMPOSITE_ALPHA_PRE_MULTIPLIED_BIT_KHR  CompositeAlphaFlagBitsKHR = (1 << 1)
+	VK_COMPOSITE_ALPHA_POST_MULTIPLIED_BIT_KHR CompositeAlphaFlagBitsKHR = (1 << 2)
+	VK_COMPOSITE_ALPHA_INHERIT_BIT_KHR         CompositeAlphaFlagBitsKHR = (1 << 3)
+)
+
+const enumNamesCompositeAlphaFlagBitsKHR = "VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR" +
+	"VK_COMPOSITE_ALPHA_PRE_MULTIPLIED_BIT_KHR" +
+	"VK_COMPOSITE_ALPHA_POST_MULTIPLIED_BIT_KHR" +
+	"VK_COMPOSITE_ALPHA_INHERIT_BIT_KHR"
+
+var enumTableCompositeAlphaFlagBitsKHR = enumTable[CompositeAlphaFlagBitsKHR, uint16]{
+	first: VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR,
+	dense: 8,
+	names: enumNamesCompositeAlphaFlagBitsKHR,
+	index: []uint16{0, 33, 74, 74, 116, 116, 116, 116, 150},
+}
+
+func (x CompositeAlphaFlagBitsKHR) String() string {
+	if s, ok := enumTableCompositeAlphaFlagBitsKHR.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("CompositeAlphaFlagBitsKHR=%d", x)
+}
+
+// ColorSpaceKHR enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkColorSpaceKHR.html
+type ColorSpaceKHR uint32
+
+const (
+	VK_COLOR_SPACE_SRGB_NONLINEAR_KHR ColorSpaceKHR = 0
+	VK_COLORSPACE_SRGB_NONLINEAR_KHR  ColorSpaceKHR = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR
+)
+
+const enumNamesColorSpaceKHR = "VK_COLOR_SPACE_SRGB_NONLINEAR_KHR"
+
+var enumTableColorSpaceKHR = enumTable[ColorSpaceKHR, uint16]{
+	sparse: []ColorSpaceKHR{
+		VK_COLOR_SPACE_SRGB_NONLINEAR_KHR,
+	},
+	names: enumNamesColorSpaceKHR,
+	index: []uint16{0, 33},
+}
+
+func (x ColorSpaceKHR) String() string {
+	if s, ok := enumTableColorSpaceKHR.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("ColorSpaceKHR=%d", x)
+}
+
+// PresentModeKHR enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPresentModeKHR.html
+type PresentModeKHR uint32
+
+const (
+	VK_PRESENT_MODE_IMMEDIATE_KHR    PresentModeKHR = 0
+	VK_PRESENT_MODE_MAILBOX_KHR      PresentModeKHR = 1
+	VK_PRESENT_MODE_FIFO_KHR         PresentModeKHR = 2
+	VK_PRESENT_MODE_FIFO_RELAXED_KHR PresentModeKHR = 3
+)
+
+const enumNamesPresentModeKHR = "VK_PRESENT_MODE_IMMEDIATE_KHR" +
+	"VK_PRESENT_MODE_MAILBOX_KHR" +
+	"VK_PRESENT_MODE_FIFO_KHR" +
+	"VK_PRESENT_MODE_FIFO_RELAXED_KHR"
+
+var enumTablePresentModeKHR = enumTable[PresentModeKHR, uint16]{
+	first: VK_PRESENT_MODE_IMMEDIATE_KHR,
+	dense: 4,
+	names: enumNamesPresentModeKHR,
+	index: []uint16{0, 29, 56, 80, 112},
+}
+
+func (x PresentModeKHR) String() string {
+	if s, ok := enumTablePresentModeKHR.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("PresentModeKHR=%d", x)
+}
+
+// CompositeAlphaFlagsKHR bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkCompositeAlphaFlagsKHR.html
+type CompositeAlphaFlagsKHR Flags
+
+// Bits appends the CompositeAlphaFlagBitsKHR set in x to dst, lowest first.
+func (x CompositeAlphaFlagsKHR) Bits(dst []CompositeAlphaFlagBitsKHR) []CompositeAlphaFlagBitsKHR {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x CompositeAlphaFlagsKHR) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableCompositeAlphaFlagBitsKHR)
+}
+
+func (x CompositeAlphaFlagsKHR) String() string {
+	return flagsString(x, &enumTableCompositeAlphaFlagBitsKHR)
+}
+
+// ParseCompositeAlphaFlagsKHR parses the names of CompositeAlphaFlagBitsKHR values, or numbers,
+// separated by |.
+func ParseCompositeAlphaFlagsKHR(s string) (CompositeAlphaFlagsKHR, error) {
+	x, err := parseFlags(s, &enumTableCompositeAlphaFlagBitsKHR)
+	return CompositeAlphaFlagsKHR(x), err
+}
+
+// SurfaceFormatKHR provides a go interface for VkSurfaceFormatKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSurfaceFormatKHR.html
+type SurfaceFormatKHR C.struct_VkSurfaceFormatKHR
+
+// SizeofSurfaceFormatKHR is the memory size of a SurfaceFormatKHR
+var SizeofSurfaceFormatKHR int = int(unsafe.Sizeof(SurfaceFormatKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SurfaceFormatKHR) ArpPtr(arp *AutoReleasePool) *SurfaceFormatKHR {
+	ptr := newCBlock(cULong(SizeofSurfaceFormatKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SurfaceFormatKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SurfaceFormatKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SurfaceFormatKHR) AsCPtr() *SurfaceFormatKHR {
+	clone := (*SurfaceFormatKHR)(newCBlock(cULong(SizeofSurfaceFormatKHR)))
+	*clone = x
+	return clone
+}
+
+// SurfaceFormatKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SurfaceFormatKHRCSlice(arp *AutoReleasePool, x ...SurfaceFormatKHR) []SurfaceFormatKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSurfaceFormatKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SurfaceFormatKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SurfaceFormatKHRFreeCSlice releases the memory allocated by SurfaceFormatKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func SurfaceFormatKHRFreeCSlice(x []SurfaceFormatKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SurfaceFormatKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SurfaceFormatKHRFreeCSlice must be called on the returned slice.
+func SurfaceFormatKHRMakeCSlice(x ...SurfaceFormatKHR) []SurfaceFormatKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSurfaceFormatKHR * len(x)
+	dst := unsafe.Slice((*SurfaceFormatKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// Format returns the value of format from VkSurfaceFormatKHR
+func (x SurfaceFormatKHR) Format() Format {
+	ptr := /* typedef */ (*Format)(&x.format)
+	return *ptr
+}
+
+// ColorSpace returns the value of colorSpace from VkSurfaceFormatKHR
+func (x SurfaceFormatKHR) ColorSpace() ColorSpaceKHR {
+	ptr := /* typedef */ (*ColorSpaceKHR)(&x.colorSpace)
+	return *ptr
+}
+
+// SurfaceTransformFlagsKHR bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSurfaceTransformFlagsKHR.html
+type SurfaceTransformFlagsKHR Flags
+
+// Bits appends the SurfaceTransformFlagBitsKHR set in x to dst, lowest first.
+func (x SurfaceTransformFlagsKHR) Bits(dst []SurfaceTransformFlagBitsKHR) []SurfaceTransformFlagBitsKHR {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x SurfaceTransformFlagsKHR) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableSurfaceTransformFlagBitsKHR)
+}
+
+func (x SurfaceTransformFlagsKHR) String() string {
+	return flagsString(x, &enumTableSurfaceTransformFlagBitsKHR)
+}
+
+// ParseSurfaceTransformFlagsKHR parses the names of SurfaceTransformFlagBitsKHR values, or numbers,
+// separated by |.
+func ParseSurfaceTransformFlagsKHR(s string) (SurfaceTransformFlagsKHR, error) {
+	x, err := parseFlags(s, &enumTableSurfaceTransformFlagBitsKHR)
+	return SurfaceTransformFlagsKHR(x), err
+}
+
+// SurfaceCapabilitiesKHR provides a go interface for VkSurfaceCapabilitiesKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSurfaceCapabilitiesKHR.html
+type SurfaceCapabilitiesKHR C.struct_VkSurfaceCapabilitiesKHR
+
+// SizeofSurfaceCapabilitiesKHR is the memory size of a SurfaceCapabilitiesKHR
+var SizeofSurfaceCapabilitiesKHR int = int(unsafe.Sizeof(SurfaceCapabilitiesKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SurfaceCapabilitiesKHR) ArpPtr(arp *AutoReleasePool) *SurfaceCapabilitiesKHR {
+	ptr := newCBlock(cULong(SizeofSurfaceCapabilitiesKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SurfaceCapabilitiesKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SurfaceCapabilitiesKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SurfaceCapabilitiesKHR) AsCPtr() *SurfaceCapabilitiesKHR {
+	clone := (*SurfaceCapabilitiesKHR)(newCBlock(cULong(SizeofSurfaceCapabilitiesKHR)))
+	*clone = x
+	return clone
+}
+
+// SurfaceCapabilitiesKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SurfaceCapabilitiesKHRCSlice(arp *AutoReleasePool, x ...SurfaceCapabilitiesKHR) []SurfaceCapabilitiesKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSurfaceCapabilitiesKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SurfaceCapabilitiesKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SurfaceCapabilitiesKHRFreeCSlice releases the memory allocated by SurfaceCapabilitiesKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func SurfaceCapabilitiesKHRFreeCSlice(x []SurfaceCapabilitiesKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SurfaceCapabilitiesKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SurfaceCapabilitiesKHRFreeCSlice must be called on the returned slice.
+func SurfaceCapabilitiesKHRMakeCSlice(x ...SurfaceCapabilitiesKHR) []SurfaceCapabilitiesKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSurfaceCapabilitiesKHR * len(x)
+	dst := unsafe.Slice((*SurfaceCapabilitiesKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// MinImageCount returns the value of minImageCount from VkSurfaceCapabilitiesKHR
+func (x SurfaceCapabilitiesKHR) MinImageCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.minImageCount)
+	return *ptr
+}
+
+// MaxImageCount returns the value of maxImageCount from VkSurfaceCapabilitiesKHR
+func (x SurfaceCapabilitiesKHR) MaxImageCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxImageCount)
+	return *ptr
+}
+
+// CurrentExtent returns the value of currentExtent from VkSurfaceCapabilitiesKHR
+func (x SurfaceCapabilitiesKHR) CurrentExtent() Extent2D {
+	ptr := /* typedef */ (*Extent2D)(&x.currentExtent)
+	return *ptr
+}
+
+// MinImageExtent returns the value of minImageExtent from VkSurfaceCapabilitiesKHR
+func (x SurfaceCapabilitiesKHR) MinImageExtent() Extent2D {
+	ptr := /* typedef */ (*Extent2D)(&x.minImageExtent)
+	return *ptr
+}
+
+// MaxImageExtent returns the value of maxImageExtent from VkSurfaceCapabilitiesKHR
+func (x SurfaceCapabilitiesKHR) MaxImageExtent() Extent2D {
+	ptr := /* typedef */ (*Extent2D)(&x.maxImageExtent)
+	return *ptr
+}
+
+// MaxImageArrayLayers returns the value of maxImageArrayLayers from VkSurfaceCapabilitiesKHR
+func (x SurfaceCapabilitiesKHR) MaxImageArrayLayers() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxImageArrayLayers)
+	return *ptr
+}
+
+// SupportedTransforms returns the value of supportedTransforms from VkSurfaceCapabilitiesKHR
+func (x SurfaceCapabilitiesKHR) SupportedTransforms() SurfaceTransformFlagsKHR {
+	ptr := /* typedef */ (*SurfaceTransformFlagsKHR)(&x.supportedTransforms)
+	return *ptr
+}
+
+// CurrentTransform returns the value of currentTransform from VkSurfaceCapabilitiesKHR
+func (x SurfaceCapabilitiesKHR) CurrentTransform() SurfaceTransformFlagBitsKHR {
+	ptr := /* typedef */ (*SurfaceTransformFlagBitsKHR)(&x.currentTransform)
+	return *ptr
+}
+
+// SupportedCompositeAlpha returns the value of supportedCompositeAlpha from VkSurfaceCapabilitiesKHR
+func (x SurfaceCapabilitiesKHR) SupportedCompositeAlpha() CompositeAlphaFlagsKHR {
+	ptr := /* typedef */ (*CompositeAlphaFlagsKHR)(&x.supportedCompositeAlpha)
+	return *ptr
+}
+
+// SupportedUsageFlags returns the value of supportedUsageFlags from VkSurfaceCapabilitiesKHR
+func (x SurfaceCapabilitiesKHR) SupportedUsageFlags() ImageUsageFlags {
+	ptr := /* typedef */ (*ImageUsageFlags)(&x.supportedUsageFlags)
+	return *ptr
+}
+
+// GetPhysicalDeviceSurfacePresentModesKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPhysicalDeviceSurfacePresentModesKHR.html
+func (x PhysicalDeviceFacade) GetPhysicalDeviceSurfacePresentModesKHR(surface SurfaceKHR, pPresentModeCount *uint32, pPresentModes []PresentModeKHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := /* handle */ (*C.VkSurfaceKHR)(&surface)
+	p2 := func(x **uint32) **C.uint32_t { /* Pointer */ g2c := (*C.uint32_t)(*x); return &g2c }(&pPresentModeCount)
+	p3 := func(x *[]PresentModeKHR) **C.VkPresentModeKHR { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkPresentModeKHR)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkPresentModeKHR)(unsafe.Pointer((&ptr)))
+	}(&pPresentModes)
+	ret := C.vkGetPhysicalDeviceSurfacePresentModesKHR(addrs, *p0, *p1, *p2, *p3)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetPhysicalDeviceSurfacePresentModesKHRInto calls GetPhysicalDeviceSurfacePresentModesKHR with the count query, the fill and
+// the VK_INCOMPLETE retries in a single cgo call. The elements are stored in
+// dst, reallocated only when its capacity is too small, and returned.
+func (x PhysicalDeviceFacade) GetPhysicalDeviceSurfacePresentModesKHRInto(surface SurfaceKHR, dst []PresentModeKHR) ([]PresentModeKHR, Result) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := /* handle */ (*C.VkSurfaceKHR)(&surface)
+	for {
+		dst = dst[:cap(dst)]
+		var items *C.VkPresentModeKHR
+		if len(dst) > 0 {
+			items = (*C.VkPresentModeKHR)(unsafe.Pointer(&dst[0]))
+		}
+		ret := C.vksEnumerate_vkGetPhysicalDeviceSurfacePresentModesKHR(addrs, C.uint64_t(uintptr(unsafe.Pointer(*p0))), C.uint64_t(uintptr(unsafe.Pointer(*p1))), C.uint32_t(len(dst)), items)
+		if Result(ret.result) == VK_INCOMPLETE && int(ret.count) > len(dst) {
+			dst = make([]PresentModeKHR, ret.count)
+			continue
+		}
+		return dst[:ret.count], Result(ret.result)
+	}
+}
+
+// GetPhysicalDeviceSurfaceFormatsKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPhysicalDeviceSurfaceFormatsKHR.html
+func (x PhysicalDeviceFacade) GetPhysicalDeviceSurfaceFormatsKHR(surface SurfaceKHR, pSurfaceFormatCount *uint32, pSurfaceFormats []SurfaceFormatKHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := /* handle */ (*C.VkSurfaceKHR)(&surface)
+	p2 := func(x **uint32) **C.uint32_t { /* Pointer */ g2c := (*C.uint32_t)(*x); return &g2c }(&pSurfaceFormatCount)
+	p3 := func(x *[]SurfaceFormatKHR) **C.struct_VkSurfaceFormatKHR { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkSurfaceFormatKHR)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkSurfaceFormatKHR)(unsafe.Pointer((&ptr)))
+	}(&pSurfaceFormats)
+	ret := C.vkGetPhysicalDeviceSurfaceFormatsKHR(addrs, *p0, *p1, *p2, *p3)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetPhysicalDeviceSurfaceFormatsKHRInto calls GetPhysicalDeviceSurfaceFormatsKHR with the count query, the fill and
+// the VK_INCOMPLETE retries in a single cgo call. The elements are stored in
+// dst, reallocated only when its capacity is too small, and returned.
+func (x PhysicalDeviceFacade) GetPhysicalDeviceSurfaceFormatsKHRInto(surface SurfaceKHR, dst []SurfaceFormatKHR) ([]SurfaceFormatKHR, Result) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := /* handle */ (*C.VkSurfaceKHR)(&surface)
+	for {
+		dst = dst[:cap(dst)]
+		var items *C.struct_VkSurfaceFormatKHR
+		if len(dst) > 0 {
+			items = (*C.struct_VkSurfaceFormatKHR)(unsafe.Pointer(&dst[0]))
+		}
+		ret := C.vksEnumerate_vkGetPhysicalDeviceSurfaceFormatsKHR(addrs, C.uint64_t(uintptr(unsafe.Pointer(*p0))), C.uint64_t(uintptr(unsafe.Pointer(*p1))), C.uint32_t(len(dst)), items)
+		if Result(ret.result) == VK_INCOMPLETE && int(ret.count) > len(dst) {
+			dst = make([]SurfaceFormatKHR, ret.count)
+			continue
+		}
+		return dst[:ret.count], Result(ret.result)
+	}
+}
+
+// GetPhysicalDeviceSurfaceCapabilitiesKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPhysicalDeviceSurfaceCapabilitiesKHR.html
+func (x PhysicalDeviceFacade) GetPhysicalDeviceSurfaceCapabilitiesKHR(surface SurfaceKHR, pSurfaceCapabilities *SurfaceCapabilitiesKHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := /* handle */ (*C.VkSurfaceKHR)(&surface)
+	p2 := func(x **SurfaceCapabilitiesKHR) **C.struct_VkSurfaceCapabilitiesKHR { /* Pointer */
+		g2c := (*C.struct_VkSurfaceCapabilitiesKHR)(*x)
+		return &g2c
+	}(&pSurfaceCapabilities)
+	ret := C.vkGetPhysicalDeviceSurfaceCapabilitiesKHR(addrs, *p0, *p1, *p2)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetPhysicalDeviceSurfaceSupportKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPhysicalDeviceSurfaceSupportKHR.html
+func (x PhysicalDeviceFacade) GetPhysicalDeviceSurfaceSupportKHR(queueFamilyIndex uint32, surface SurfaceKHR, pSupported *Bool32) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&queueFamilyIndex)
+	p2 := /* handle */ (*C.VkSurfaceKHR)(&surface)
+	p3 := func(x **Bool32) **C.VkBool32 { /* Pointer */ g2c := (*C.VkBool32)(*x); return &g2c }(&pSupported)
+	ret := C.vkGetPhysicalDeviceSurfaceSupportKHR(addrs, *p0, *p1, *p2, *p3)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// DestroySurfaceKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkDestroySurfaceKHR.html
+func (x InstanceFacade) DestroySurfaceKHR(surface SurfaceKHR, pAllocator *AllocationCallbacks) {
+	addrs := x.procs
+	if destroyHooks.Load() != nil {
+		handleDestroyed(VK_OBJECT_TYPE_SURFACE_KHR, uint64(uintptr(unsafe.Pointer(surface))))
+	}
+	p0 := /* handle */ (*C.VkInstance)(&x.H)
+	p1 := /* handle */ (*C.VkSurfaceKHR)(&surface)
+	p2 := func(x **AllocationCallbacks) **C.struct_VkAllocationCallbacks { /* Pointer */
+		g2c := (*C.struct_VkAllocationCallbacks)(*x)
+		return &g2c
+	}(&pAllocator)
+	C.vkDestroySurfaceKHR(addrs, *p0, *p1, *p2)
+}
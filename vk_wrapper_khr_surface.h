@@ -0,0 +1,14 @@
+#ifndef __VKS_KHR_SURFACE_H__
+#define __VKS_KHR_SURFACE_H__
+#include "vk_wrapper.h"
+
+// Wrappers of VK_KHR_surface.
+VkResult vkGetPhysicalDeviceSurfacePresentModesKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pPresentModeCount, VkPresentModeKHR* pPresentModes);
+vksEnumerateResult vksEnumerate_vkGetPhysicalDeviceSurfacePresentModesKHR(vksProcAddr* addrs, uint64_t physicalDevice, uint64_t surface, uint32_t capacity, VkPresentModeKHR* pPresentModes);
+VkResult vkGetPhysicalDeviceSurfaceFormatsKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pSurfaceFormatCount, VkSurfaceFormatKHR* pSurfaceFormats);
+vksEnumerateResult vksEnumerate_vkGetPhysicalDeviceSurfaceFormatsKHR(vksProcAddr* addrs, uint64_t physicalDevice, uint64_t surface, uint32_t capacity, VkSurfaceFormatKHR* pSurfaceFormats);
+VkResult vkGetPhysicalDeviceSurfaceCapabilitiesKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, VkSurfaceCapabilitiesKHR* pSurfaceCapabilities);
+VkResult vkGetPhysicalDeviceSurfaceSupportKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t queueFamilyIndex, VkSurfaceKHR surface, VkBool32* pSupported);
+void vkDestroySurfaceKHR(vksProcAddr* addrs, VkInstance instance, VkSurfaceKHR surface, VkAllocationCallbacks* pAllocator);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,144 @@
+//go:build !vks_no_khr_surface_protected_capabilities && !vks_no_khr_get_surface_capabilities2 && !vks_no_khr_surface && !vks_no_version_1_1
+
+package vks
+
+// Bindings of VK_KHR_surface_protected_capabilities, left out by the vks_no_khr_surface_protected_capabilities build tag.
+
+//#cgo CFLAGS: -DVKS_ENABLE_KHR_SURFACE_PROTECTED_CAPABILITIES
+//#include "vk_wrapper.h"
+import "C"
+import (
+	"unsafe"
+)
+
+// SurfaceProtectedCapabilitiesKHR provides a go interface for VkSurfaceProtectedCapabilitiesKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSurfaceProtectedCapabilitiesKHR.html
+type SurfaceProtectedCapabilitiesKHR C.struct_VkSurfaceProtectedCapabilitiesKHR
+
+// SizeofSurfaceProtectedCapabilitiesKHR is the memory size of a SurfaceProtectedCapabilitiesKHR
+var SizeofSurfaceProtectedCapabilitiesKHR int = int(unsafe.Sizeof(SurfaceProtectedCapabilitiesKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SurfaceProtectedCapabilitiesKHR) ArpPtr(arp *AutoReleasePool) *SurfaceProtectedCapabilitiesKHR {
+	ptr := newCBlock(cULong(SizeofSurfaceProtectedCapabilitiesKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SurfaceProtectedCapabilitiesKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SurfaceProtectedCapabilitiesKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SurfaceProtectedCapabilitiesKHR) AsCPtr() *SurfaceProtectedCapabilitiesKHR {
+	clone := (*SurfaceProtectedCapabilitiesKHR)(newCBlock(cULong(SizeofSurfaceProtectedCapabilitiesKHR)))
+	*clone = x
+	return clone
+}
+
+// SurfaceProtectedCapabilitiesKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SurfaceProtectedCapabilitiesKHRCSlice(arp *AutoReleasePool, x ...SurfaceProtectedCapabilitiesKHR) []SurfaceProtectedCapabilitiesKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSurfaceProtectedCapabilitiesKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SurfaceProtectedCapabilitiesKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SurfaceProtectedCapabilitiesKHRFreeCSlice releases the memory allocated by SurfaceProtectedCapabilitiesKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func SurfaceProtectedCapabilitiesKHRFreeCSlice(x []SurfaceProtectedCapabilitiesKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SurfaceProtectedCapabilitiesKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SurfaceProtectedCapabilitiesKHRFreeCSlice must be called on the returned slice.
+func SurfaceProtectedCapabilitiesKHRMakeCSlice(x ...SurfaceProtectedCapabilitiesKHR) []SurfaceProtectedCapabilitiesKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSurfaceProtectedCapabilitiesKHR * len(x)
+	dst := unsafe.Slice((*SurfaceProtectedCapabilitiesKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkSurfaceProtectedCapabilitiesKHR
+func (x SurfaceProtectedCapabilitiesKHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new SurfaceProtectedCapabilitiesKHR with the value of
+// SType to the value provided in the specification.
+func (x SurfaceProtectedCapabilitiesKHR) WithDefaultSType() SurfaceProtectedCapabilitiesKHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_SURFACE_PROTECTED_CAPABILITIES_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *SurfaceProtectedCapabilitiesKHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_SURFACE_PROTECTED_CAPABILITIES_KHR)
+}
+
+// WithSType clones a new SurfaceProtectedCapabilitiesKHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SurfaceProtectedCapabilitiesKHR) WithSType(y StructureType) SurfaceProtectedCapabilitiesKHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *SurfaceProtectedCapabilitiesKHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkSurfaceProtectedCapabilitiesKHR
+func (x SurfaceProtectedCapabilitiesKHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new SurfaceProtectedCapabilitiesKHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SurfaceProtectedCapabilitiesKHR) WithPNext(y unsafe.Pointer) SurfaceProtectedCapabilitiesKHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *SurfaceProtectedCapabilitiesKHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SurfaceProtectedCapabilitiesKHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SupportsProtected returns the value of supportsProtected from VkSurfaceProtectedCapabilitiesKHR
+func (x SurfaceProtectedCapabilitiesKHR) SupportsProtected() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.supportsProtected)
+	return *ptr
+}
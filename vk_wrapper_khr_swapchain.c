@@ -0,0 +1,143 @@
+//go:build !vks_no_khr_swapchain && !vks_no_khr_surface && !vks_no_version_1_1
+
+// Wrappers of VK_KHR_swapchain.
+#include "vk_wrapper.h"
+#include "vk_capture.h"
+
+VkResult vkCreateSwapchainKHR(vksProcAddr* addrs, VkDevice device, VkSwapchainCreateInfoKHR* pCreateInfo, VkAllocationCallbacks* pAllocator, VkSwapchainKHR* pSwapchain) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkCreateSwapchainKHR(addrs, device, pCreateInfo, pAllocator, pSwapchain);
+	}
+	VkResult ret = (((PFN_vkCreateSwapchainKHR)addrs->pvkCreateSwapchainKHR)(device, pCreateInfo, pAllocator, pSwapchain));
+	return ret;
+}
+VkResult vkAcquireNextImageKHR(vksProcAddr* addrs, VkDevice device, VkSwapchainKHR swapchain, uint64_t timeout, VkSemaphore semaphore, VkFence fence, uint32_t* pImageIndex) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkAcquireNextImageKHR(addrs, device, swapchain, timeout, semaphore, fence, pImageIndex);
+	}
+	VkResult ret = (((PFN_vkAcquireNextImageKHR)addrs->pvkAcquireNextImageKHR)(device, swapchain, timeout, semaphore, fence, pImageIndex));
+	return ret;
+}
+VkResult vkQueuePresentKHR(vksProcAddr* addrs, VkQueue queue, VkPresentInfoKHR* pPresentInfo) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkQueuePresentKHR(addrs, queue, pPresentInfo);
+	}
+	VkResult ret = (((PFN_vkQueuePresentKHR)addrs->pvkQueuePresentKHR)(queue, pPresentInfo));
+	return ret;
+}
+VkResult vkAcquireNextImage2KHR(vksProcAddr* addrs, VkDevice device, VkAcquireNextImageInfoKHR* pAcquireInfo, uint32_t* pImageIndex) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkAcquireNextImage2KHR(addrs, device, pAcquireInfo, pImageIndex);
+	}
+	VkResult ret = (((PFN_vkAcquireNextImage2KHR)addrs->pvkAcquireNextImage2KHR)(device, pAcquireInfo, pImageIndex));
+	return ret;
+}
+VkResult vkGetPhysicalDevicePresentRectanglesKHR(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkSurfaceKHR surface, uint32_t* pRectCount, VkRect2D* pRects) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetPhysicalDevicePresentRectanglesKHR(addrs, physicalDevice, surface, pRectCount, pRects);
+	}
+	VkResult ret = (((PFN_vkGetPhysicalDevicePresentRectanglesKHR)addrs->pvkGetPhysicalDevicePresentRectanglesKHR)(physicalDevice, surface, pRectCount, pRects));
+	return ret;
+}
+
+// Runs the two-call idiom of vkGetPhysicalDevicePresentRectanglesKHR in one call. capacity is the
+// length of pRects; when it is too small, the result is VK_INCOMPLETE
+// with the count needed.
+vksEnumerateResult vksEnumerate_vkGetPhysicalDevicePresentRectanglesKHR(vksProcAddr* addrs, uint64_t physicalDevice, uint64_t surface, uint32_t capacity, VkRect2D* pRects) {
+	vksEnumerateResult r = { VK_SUCCESS, capacity };
+	if (capacity > 0) {
+		// Large enough buffers skip the count query.
+		r.result = vkGetPhysicalDevicePresentRectanglesKHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, (VkSurfaceKHR)(uintptr_t)surface, &r.count, pRects);
+		if (r.result < 0) {
+			r.count = 0;
+		}
+		if (r.result != VK_INCOMPLETE) {
+			return r;
+		}
+	}
+	for (;;) {
+		r.count = 0;
+		r.result = vkGetPhysicalDevicePresentRectanglesKHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, (VkSurfaceKHR)(uintptr_t)surface, &r.count, NULL);
+		if (r.result < 0) {
+			r.count = 0;
+			return r;
+		}
+		if (r.count > capacity) {
+			r.result = VK_INCOMPLETE;
+			return r;
+		}
+		r.result = vkGetPhysicalDevicePresentRectanglesKHR(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, (VkSurfaceKHR)(uintptr_t)surface, &r.count, pRects);
+		if (r.result != VK_INCOMPLETE) {
+			if (r.result < 0) {
+				r.count = 0;
+			}
+			return r;
+		}
+		// The count grew between the calls.
+	}
+}
+VkResult vkGetSwapchainImagesKHR(vksProcAddr* addrs, VkDevice device, VkSwapchainKHR swapchain, uint32_t* pSwapchainImageCount, VkImage* pSwapchainImages) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetSwapchainImagesKHR(addrs, device, swapchain, pSwapchainImageCount, pSwapchainImages);
+	}
+	VkResult ret = (((PFN_vkGetSwapchainImagesKHR)addrs->pvkGetSwapchainImagesKHR)(device, swapchain, pSwapchainImageCount, pSwapchainImages));
+	return ret;
+}
+
+// Runs the two-call idiom of vkGetSwapchainImagesKHR in one call. capacity is the
+// length of pSwapchainImages; when it is too small, the result is VK_INCOMPLETE
+// with the count needed.
+vksEnumerateResult vksEnumerate_vkGetSwapchainImagesKHR(vksProcAddr* addrs, uint64_t device, uint64_t swapchain, uint32_t capacity, VkImage* pSwapchainImages) {
+	vksEnumerateResult r = { VK_SUCCESS, capacity };
+	if (capacity > 0) {
+		// Large enough buffers skip the count query.
+		r.result = vkGetSwapchainImagesKHR(addrs, (VkDevice)(uintptr_t)device, (VkSwapchainKHR)(uintptr_t)swapchain, &r.count, pSwapchainImages);
+		if (r.result < 0) {
+			r.count = 0;
+		}
+		if (r.result != VK_INCOMPLETE) {
+			return r;
+		}
+	}
+	for (;;) {
+		r.count = 0;
+		r.result = vkGetSwapchainImagesKHR(addrs, (VkDevice)(uintptr_t)device, (VkSwapchainKHR)(uintptr_t)swapchain, &r.count, NULL);
+		if (r.result < 0) {
+			r.count = 0;
+			return r;
+		}
+		if (r.count > capacity) {
+			r.result = VK_INCOMPLETE;
+			return r;
+		}
+		r.result = vkGetSwapchainImagesKHR(addrs, (VkDevice)(uintptr_t)device, (VkSwapchainKHR)(uintptr_t)swapchain, &r.count, pSwapchainImages);
+		if (r.result != VK_INCOMPLETE) {
+			if (r.result < 0) {
+				r.count = 0;
+			}
+			return r;
+		}
+		// The count grew between the calls.
+	}
+}
+VkResult vkGetDeviceGroupSurfacePresentModesKHR(vksProcAddr* addrs, VkDevice device, VkSurfaceKHR surface, VkDeviceGroupPresentModeFlagsKHR* pModes) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetDeviceGroupSurfacePresentModesKHR(addrs, device, surface, pModes);
+	}
+	VkResult ret = (((PFN_vkGetDeviceGroupSurfacePresentModesKHR)addrs->pvkGetDeviceGroupSurfacePresentModesKHR)(device, surface, pModes));
+	return ret;
+}
+void vkDestroySwapchainKHR(vksProcAddr* addrs, VkDevice device, VkSwapchainKHR swapchain, VkAllocationCallbacks* pAllocator) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkDestroySwapchainKHR(addrs, device, swapchain, pAllocator);
+		return;
+	}
+	(((PFN_vkDestroySwapchainKHR)addrs->pvkDestroySwapchainKHR)(device, swapchain, pAllocator));
+}
+VkResult vkGetDeviceGroupPresentCapabilitiesKHR(vksProcAddr* addrs, VkDevice device, VkDeviceGroupPresentCapabilitiesKHR* pDeviceGroupPresentCapabilities) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetDeviceGroupPresentCapabilitiesKHR(addrs, device, pDeviceGroupPresentCapabilities);
+	}
+	VkResult ret = (((PFN_vkGetDeviceGroupPresentCapabilitiesKHR)addrs->pvkGetDeviceGroupPresentCapabilitiesKHR)(device, pDeviceGroupPresentCapabilities));
+	return ret;
+}
@@ -0,0 +1,2110 @@
+//go:build !vks_no_khr_swapchain && !vks_no_khr_surface && !vks_no_version_1_1
+
+package vks
+
+// Bindings of VK_KHR_swapchain, left out by the vks_no_khr_swapchain build tag.
+
+//#cgo CFLAGS: -DVKS_ENABLE_KHR_SWAPCHAIN
+//#include "vk_wrapper.h"
+import "C"
+import (
+	"fmt"
+	"unsafe"
+)
+
+// SwapchainKHR is a Handle to a vulkan resource.
+// SwapchainKHR is a child of Device.
+//
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSwapchainKHR.html
+type SwapchainKHR C.VkSwapchainKHR
+
+// NullSwapchainKHR is a typed Null value for the SwapchainKHR type.
+var NullSwapchainKHR SwapchainKHR
+
+// SwapchainCreateFlagBitsKHR enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSwapchainCreateFlagBitsKHR.html
+type SwapchainCreateFlagBitsKHR uint32
+
+const (
+	VK_SWAPCHAIN_CREATE_SPLIT_INSTANCE_BIND_REGIONS_BIT_KHR SwapchainCreateFlagBitsKHR = (1 << 0)
+	VK_SWAPCHAIN_CREATE_PROTECTED_BIT_KHR                   SwapchainCreateFlagBitsKHR = (1 << 1)
+)
+
+const enumNamesSwapchainCreateFlagBitsKHR = "VK_SWAPCHAIN_CREATE_SPLIT_INSTANCE_BIND_REGIONS_BIT_KHR" +
+	"VK_SWAPCHAIN_CREATE_PROTECTED_BIT_KHR"
+
+var enumTableSwapchainCreateFlagBitsKHR = enumTable[SwapchainCreateFlagBitsKHR, uint16]{
+	sparse: []SwapchainCreateFlagBitsKHR{
+		VK_SWAPCHAIN_CREATE_SPLIT_INSTANCE_BIND_REGIONS_BIT_KHR,
+		VK_SWAPCHAIN_CREATE_PROTECTED_BIT_KHR,
+	},
+	names: enumNamesSwapchainCreateFlagBitsKHR,
+	index: []uint16{0, 55, 92},
+}
+
+func (x SwapchainCreateFlagBitsKHR) String() string {
+	if s, ok := enumTableSwapchainCreateFlagBitsKHR.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("SwapchainCreateFlagBitsKHR=%d", x)
+}
+
+// DeviceGroupPresentModeFlagBitsKHR enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDeviceGroupPresentModeFlagBitsKHR.html
+type DeviceGroupPresentModeFlagBitsKHR uint32
+
+const (
+	VK_DEVICE_GROUP_PRESENT_MODE_LOCAL_BIT_KHR              DeviceGroupPresentModeFlagBitsKHR = (1 << 0)
+	VK_DEVICE_GROUP_PRESENT_MODE_REMOTE_BIT_KHR             DeviceGroupPresentModeFlagBitsKHR = (1 << 1)
+	VK_DEVICE_GROUP_PRESENT_MODE_SUM_BIT_KHR                DeviceGroupPresentModeFlagBitsKHR = (1 << 2)
+	VK_DEVICE_GROUP_PRESENT_MODE_LOCAL_MULTI_DEVICE_BIT_KHR DeviceGroupPresentModeFlagBitsKHR = (1 << 3)
+)
+
+const enumNamesDeviceGroupPresentModeFlagBitsKHR = "VK_DEVICE_GROUP_PRESENT_MODE_LOCAL_BIT_KHR" +
+	"VK_DEVICE_GROUP_PRESENT_MODE_REMOTE_BIT_KHR" +
+	"VK_DEVICE_GROUP_PRESENT_MODE_SUM_BIT_KHR" +
+	"VK_DEVICE_GROUP_PRESENT_MODE_LOCAL_MULTI_DEVICE_BIT_KHR"
+
+var enumTableDeviceGroupPresentModeFlagBitsKHR = enumTable[DeviceGroupPresentModeFlagBitsKHR, uint16]{
+	first: VK_DEVICE_GROUP_PRESENT_MODE_LOCAL_BIT_KHR,
+	dense: 8,
+	names: enumNamesDeviceGroupPresentModeFlagBitsKHR,
+	index: []uint16{0, 42, 85, 85, 125, 125, 125, 125, 180},
+}
+
+func (x DeviceGroupPresentModeFlagBitsKHR) String() string {
+	if s, ok := enumTableDeviceGroupPresentModeFlagBitsKHR.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("DeviceGroupPresentModeFlagBitsKHR=%d", x)
+}
+
+// DeviceGroupPresentModeFlagsKHR bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDeviceGroupPresentModeFlagsKHR.html
+type DeviceGroupPresentModeFlagsKHR Flags
+
+// Bits appends the DeviceGroupPresentModeFlagBitsKHR set in x to dst, lowest first.
+func (x DeviceGroupPresentModeFlagsKHR) Bits(dst []DeviceGroupPresentModeFlagBitsKHR) []DeviceGroupPresentModeFlagBitsKHR {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x DeviceGroupPresentModeFlagsKHR) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableDeviceGroupPresentModeFlagBitsKHR)
+}
+
+func (x DeviceGroupPresentModeFlagsKHR) String() string {
+	return flagsString(x, &enumTableDeviceGroupPresentModeFlagBitsKHR)
+}
+
+// ParseDeviceGroupPresentModeFlagsKHR parses the names of DeviceGroupPresentModeFlagBitsKHR values, or numbers,
+// separated by |.
+func ParseDeviceGroupPresentModeFlagsKHR(s string) (DeviceGroupPresentModeFlagsKHR, error) {
+	x, err := parseFlags(s, &enumTableDeviceGroupPresentModeFlagBitsKHR)
+	return DeviceGroupPresentModeFlagsKHR(x), err
+}
+
+// SwapchainCreateFlagsKHR bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSwapchainCreateFlagsKHR.html
+type SwapchainCreateFlagsKHR Flags
+
+// Bits appends the SwapchainCreateFlagBitsKHR set in x to dst, lowest first.
+func (x SwapchainCreateFlagsKHR) Bits(dst []SwapchainCreateFlagBitsKHR) []SwapchainCreateFlagBitsKHR {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x SwapchainCreateFlagsKHR) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableSwapchainCreateFlagBitsKHR)
+}
+
+func (x SwapchainCreateFlagsKHR) String() string {
+	return flagsString(x, &enumTableSwapchainCreateFlagBitsKHR)
+}
+
+// ParseSwapchainCreateFlagsKHR parses the names of SwapchainCreateFlagBitsKHR values, or numbers,
+// separated by |.
+func ParseSwapchainCreateFlagsKHR(s string) (SwapchainCreateFlagsKHR, error) {
+	x, err := parseFlags(s, &enumTableSwapchainCreateFlagBitsKHR)
+	return SwapchainCreateFlagsKHR(x), err
+}
+
+// DeviceGroupSwapchainCreateInfoKHR provides a go interface for VkDeviceGroupSwapchainCreateInfoKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDeviceGroupSwapchainCreateInfoKHR.html
+type DeviceGroupSwapchainCreateInfoKHR C.struct_VkDeviceGroupSwapchainCreateInfoKHR
+
+// SizeofDeviceGroupSwapchainCreateInfoKHR is the memory size of a DeviceGroupSwapchainCreateInfoKHR
+var SizeofDeviceGroupSwapchainCreateInfoKHR int = int(unsafe.Sizeof(DeviceGroupSwapchainCreateInfoKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DeviceGroupSwapchainCreateInfoKHR) ArpPtr(arp *AutoReleasePool) *DeviceGroupSwapchainCreateInfoKHR {
+	ptr := newCBlock(cULong(SizeofDeviceGroupSwapchainCreateInfoKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DeviceGroupSwapchainCreateInfoKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DeviceGroupSwapchainCreateInfoKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DeviceGroupSwapchainCreateInfoKHR) AsCPtr() *DeviceGroupSwapchainCreateInfoKHR {
+	clone := (*DeviceGroupSwapchainCreateInfoKHR)(newCBlock(cULong(SizeofDeviceGroupSwapchainCreateInfoKHR)))
+	*clone = x
+	return clone
+}
+
+// DeviceGroupSwapchainCreateInfoKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DeviceGroupSwapchainCreateInfoKHRCSlice(arp *AutoReleasePool, x ...DeviceGroupSwapchainCreateInfoKHR) []DeviceGroupSwapchainCreateInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceGroupSwapchainCreateInfoKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DeviceGroupSwapchainCreateInfoKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DeviceGroupSwapchainCreateInfoKHRFreeCSlice releases the memory allocated by DeviceGroupSwapchainCreateInfoKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DeviceGroupSwapchainCreateInfoKHRFreeCSlice(x []DeviceGroupSwapchainCreateInfoKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DeviceGroupSwapchainCreateInfoKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DeviceGroupSwapchainCreateInfoKHRFreeCSlice must be called on the returned slice.
+func DeviceGroupSwapchainCreateInfoKHRMakeCSlice(x ...DeviceGroupSwapchainCreateInfoKHR) []DeviceGroupSwapchainCreateInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceGroupSwapchainCreateInfoKHR * len(x)
+	dst := unsafe.Slice((*DeviceGroupSwapchainCreateInfoKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDeviceGroupSwapchainCreateInfoKHR
+func (x DeviceGroupSwapchainCreateInfoKHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DeviceGroupSwapchainCreateInfoKHR with the value of
+// SType to the value provided in the specification.
+func (x DeviceGroupSwapchainCreateInfoKHR) WithDefaultSType() DeviceGroupSwapchainCreateInfoKHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DeviceGroupSwapchainCreateInfoKHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR)
+}
+
+// WithSType clones a new DeviceGroupSwapchainCreateInfoKHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupSwapchainCreateInfoKHR) WithSType(y StructureType) DeviceGroupSwapchainCreateInfoKHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DeviceGroupSwapchainCreateInfoKHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDeviceGroupSwapchainCreateInfoKHR
+func (x DeviceGroupSwapchainCreateInfoKHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DeviceGroupSwapchainCreateInfoKHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupSwapchainCreateInfoKHR) WithPNext(y unsafe.Pointer) DeviceGroupSwapchainCreateInfoKHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceGroupSwapchainCreateInfoKHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DeviceGroupSwapchainCreateInfoKHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Modes returns the value of modes from VkDeviceGroupSwapchainCreateInfoKHR
+func (x DeviceGroupSwapchainCreateInfoKHR) Modes() DeviceGroupPresentModeFlagsKHR {
+	ptr := /* typedef */ (*DeviceGroupPresentModeFlagsKHR)(&x.modes)
+	return *ptr
+}
+
+// WithModes clones a new DeviceGroupSwapchainCreateInfoKHR with the value of
+// Modes updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupSwapchainCreateInfoKHR) WithModes(y DeviceGroupPresentModeFlagsKHR) DeviceGroupSwapchainCreateInfoKHR {
+	x.modes = *( /* typedef */ (*C.VkDeviceGroupPresentModeFlagsKHR)(&y))
+	return x
+}
+func (x *DeviceGroupSwapchainCreateInfoKHR) SetModes(y DeviceGroupPresentModeFlagsKHR) {
+	x.modes = *( /* typedef */ (*C.VkDeviceGroupPresentModeFlagsKHR)(&y))
+}
+
+// SwapchainCreateInfoKHR provides a go interface for VkSwapchainCreateInfoKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSwapchainCreateInfoKHR.html
+type SwapchainCreateInfoKHR C.struct_VkSwapchainCreateInfoKHR
+
+// SizeofSwapchainCreateInfoKHR is the memory size of a SwapchainCreateInfoKHR
+var SizeofSwapchainCreateInfoKHR int = int(unsafe.Sizeof(SwapchainCreateInfoKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SwapchainCreateInfoKHR) ArpPtr(arp *AutoReleasePool) *SwapchainCreateInfoKHR {
+	ptr := newCBlock(cULong(SizeofSwapchainCreateInfoKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SwapchainCreateInfoKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SwapchainCreateInfoKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SwapchainCreateInfoKHR) AsCPtr() *SwapchainCreateInfoKHR {
+	clone := (*SwapchainCreateInfoKHR)(newCBlock(cULong(SizeofSwapchainCreateInfoKHR)))
+	*clone = x
+	return clone
+}
+
+// SwapchainCreateInfoKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SwapchainCreateInfoKHRCSlice(arp *AutoReleasePool, x ...SwapchainCreateInfoKHR) []SwapchainCreateInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSwapchainCreateInfoKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SwapchainCreateInfoKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SwapchainCreateInfoKHRFreeCSlice releases the memory allocated by SwapchainCreateInfoKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func SwapchainCreateInfoKHRFreeCSlice(x []SwapchainCreateInfoKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SwapchainCreateInfoKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SwapchainCreateInfoKHRFreeCSlice must be called on the returned slice.
+func SwapchainCreateInfoKHRMakeCSlice(x ...SwapchainCreateInfoKHR) []SwapchainCreateInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSwapchainCreateInfoKHR * len(x)
+	dst := unsafe.Slice((*SwapchainCreateInfoKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkSwapchainCreateInfoKHR
+func (x *SwapchainCreateInfoKHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new SwapchainCreateInfoKHR with the value of
+// SType to the value provided in the specification.
+func (x SwapchainCreateInfoKHR) WithDefaultSType() SwapchainCreateInfoKHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *SwapchainCreateInfoKHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_SWAPCHAIN_CREATE_INFO_KHR)
+}
+
+// WithSType clones a new SwapchainCreateInfoKHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SwapchainCreateInfoKHR) WithSType(y StructureType) SwapchainCreateInfoKHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *SwapchainCreateInfoKHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkSwapchainCreateInfoKHR
+func (x *SwapchainCreateInfoKHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new SwapchainCreateInfoKHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SwapchainCreateInfoKHR) WithPNext(y unsafe.Pointer) SwapchainCreateInfoKHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *SwapchainCreateInfoKHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SwapchainCreateInfoKHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Flags returns the value of flags from VkSwapchainCreateInfoKHR
+func (x *SwapchainCreateInfoKHR) Flags() SwapchainCreateFlagsKHR {
+	ptr := /* typedef */ (*SwapchainCreateFlagsKHR)(&x.flags)
+	return *ptr
+}
+
+// WithFlags clones a new SwapchainCreateInfoKHR with the value of
+// Flags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SwapchainCreateInfoKHR) WithFlags(y SwapchainCreateFlagsKHR) SwapchainCreateInfoKHR {
+	x.flags = *( /* typedef */ (*C.VkSwapchainCreateFlagsKHR)(&y))
+	return x
+}
+func (x *SwapchainCreateInfoKHR) SetFlags(y SwapchainCreateFlagsKHR) {
+	x.flags = *( /* typedef */ (*C.VkSwapchainCreateFlagsKHR)(&y))
+}
+
+// Surface returns the value of surface from VkSwapchainCreateInfoKHR
+func (x *SwapchainCreateInfoKHR) Surface() SurfaceKHR {
+	ptr := /* handle */ (*SurfaceKHR)(&x.surface)
+	return *ptr
+}
+
+// WithSurface clones a new SwapchainCreateInfoKHR with the value of
+// Surface updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SwapchainCreateInfoKHR) WithSurface(y SurfaceKHR) SwapchainCreateInfoKHR {
+	x.surface = *( /* handle */ (*C.VkSurfaceKHR)(&y))
+	return x
+}
+func (x *SwapchainCreateInfoKHR) SetSurface(y SurfaceKHR) {
+	x.surface = *( /* handle */ (*C.VkSurfaceKHR)(&y))
+}
+
+// MinImageCount returns the value of minImageCount from VkSwapchainCreateInfoKHR
+func (x *SwapchainCreateInfoKHR) MinImageCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.minImageCount)
+	return *ptr
+}
+
+// WithMinImageCount clones a new SwapchainCreateInfoKHR with the value of
+// MinImageCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SwapchainCreateInfoKHR) WithMinImageCount(y uint32) SwapchainCreateInfoKHR {
+	x.minImageCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *SwapchainCreateInfoKHR) SetMinImageCount(y uint32) {
+	x.minImageCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// ImageFormat returns the value of imageFormat from VkSwapchainCreateInfoKHR
+func (x *SwapchainCreateInfoKHR) ImageFormat() Format {
+	ptr := /* typedef */ (*Format)(&x.imageFormat)
+	return *ptr
+}
+
+// WithImageFormat clones a new SwapchainCreateInfoKHR with the value of
+// ImageFormat updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SwapchainCreateInfoKHR) WithImageFormat(y Format) SwapchainCreateInfoKHR {
+	x.imageFormat = *( /* typedef */ (*C.VkFormat)(&y))
+	return x
+}
+func (x *SwapchainCreateInfoKHR) SetImageFormat(y Format) {
+	x.imageFormat = *( /* typedef */ (*C.VkFormat)(&y))
+}
+
+// ImageColorSpace returns the value of imageColorSpace from VkSwapchainCreateInfoKHR
+func (x *SwapchainCreateInfoKHR) ImageColorSpace() ColorSpaceKHR {
+	ptr := /* typedef */ (*ColorSpaceKHR)(&x.imageColorSpace)
+	return *ptr
+}
+
+// WithImageColorSpace clones a new SwapchainCreateInfoKHR with the value of
+// ImageColorSpace updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SwapchainCreateInfoKHR) WithImageColorSpace(y ColorSpaceKHR) SwapchainCreateInfoKHR {
+	x.imageColorSpace = *( /* typedef */ (*C.VkColorSpaceKHR)(&y))
+	return x
+}
+func (x *SwapchainCreateInfoKHR) SetImageColorSpace(y ColorSpaceKHR) {
+	x.imageColorSpace = *( /* typedef */ (*C.VkColorSpaceKHR)(&y))
+}
+
+// ImageExtent returns the value of imageExtent from VkSwapchainCreateInfoKHR
+func (x *SwapchainCreateInfoKHR) ImageExtent() Extent2D {
+	ptr := /* typedef */ (*Extent2D)(&x.imageExtent)
+	return *ptr
+}
+
+// WithImageExtent clones a new SwapchainCreateInfoKHR with the value of
+// ImageExtent updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SwapchainCreateInfoKHR) WithImageExtent(y Extent2D) SwapchainCreateInfoKHR {
+	x.imageExtent = *( /* typedef */ (*C.struct_VkExtent2D)(&y))
+	return x
+}
+func (x *SwapchainCreateInfoKHR) SetImageExtent(y Extent2D) {
+	x.imageExtent = *( /* typedef */ (*C.struct_VkExtent2D)(&y))
+}
+
+// ImageArrayLayers returns the value of imageArrayLayers from VkSwapchainCreateInfoKHR
+func (x *SwapchainCreateInfoKHR) ImageArrayLayers() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.imageArrayLayers)
+	return *ptr
+}
+
+// WithImageArrayLayers clones a new SwapchainCreateInfoKHR with the value of
+// ImageArrayLayers updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SwapchainCreateInfoKHR) WithImageArrayLayers(y uint32) SwapchainCreateInfoKHR {
+	x.imageArrayLayers = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *SwapchainCreateInfoKHR) SetImageArrayLayers(y uint32) {
+	x.imageArrayLayers = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// ImageUsage returns the value of imageUsage from VkSwapchainCreateInfoKHR
+func (x *SwapchainCreateInfoKHR) ImageUsage() ImageUsageFlags {
+	ptr := /* typedef */ (*ImageUsageFlags)(&x.imageUsage)
+	return *ptr
+}
+
+// WithImageUsage clones a new SwapchainCreateInfoKHR with the value of
+// ImageUsage updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SwapchainCreateInfoKHR) WithImageUsage(y ImageUsageFlags) SwapchainCreateInfoKHR {
+	x.imageUsage = *( /* typedef */ (*C.VkImageUsageFlags)(&y))
+	return x
+}
+func (x *SwapchainCreateInfoKHR) SetImageUsage(y ImageUsageFlags) {
+	x.imageUsage = *( /* typedef */ (*C.VkImageUsageFlags)(&y))
+}
+
+// ImageSharingMode returns the value of imageSharingMode from VkSwapchainCreateInfoKHR
+func (x *SwapchainCreateInfoKHR) ImageSharingMode() SharingMode {
+	ptr := /* typedef */ (*SharingMode)(&x.imageSharingMode)
+	return *ptr
+}
+
+// WithImageSharingMode clones a new SwapchainCreateInfoKHR with the value of
+// ImageSharingMode updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SwapchainCreateInfoKHR) WithImageSharingMode(y SharingMode) SwapchainCreateInfoKHR {
+	x.imageSharingMode = *( /* typedef */ (*C.VkSharingMode)(&y))
+	return x
+}
+func (x *SwapchainCreateInfoKHR) SetImageSharingMode(y SharingMode) {
+	x.imageSharingMode = *( /* typedef */ (*C.VkSharingMode)(&y))
+}
+
+// QueueFamilyIndexCount returns the value of queueFamilyIndexCount from VkSwapchainCreateInfoKHR
+func (x *SwapchainCreateInfoKHR) QueueFamilyIndexCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.queueFamilyIndexCount)
+	return *ptr
+}
+
+// WithQueueFamilyIndexCount clones a new SwapchainCreateInfoKHR with the value of
+// QueueFamilyIndexCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SwapchainCreateInfoKHR) WithQueueFamilyIndexCount(y uint32) SwapchainCreateInfoKHR {
+	x.queueFamilyIndexCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *SwapchainCreateInfoKHR) SetQueueFamilyIndexCount(y uint32) {
+	x.queueFamilyIndexCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PQueueFamilyIndices returns the value of pQueueFamilyIndices from VkSwapchainCreateInfoKHR
+func (x *SwapchainCreateInfoKHR) PQueueFamilyIndices() []uint32 {
+	if x.pQueueFamilyIndices == nil {
+		return nil
+	}
+	return unsafe.Slice((*uint32)(unsafe.Pointer(x.pQueueFamilyIndices)), x.queueFamilyIndexCount)
+}
+
+// WithPQueueFamilyIndices clones a new SwapchainCreateInfoKHR with the value of
+// PQueueFamilyIndices updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines QueueFamilyIndexCount as the length of this field.
+// QueueFamilyIndexCount is updated with the length of the new value.
+func (x SwapchainCreateInfoKHR) WithPQueueFamilyIndices(y []uint32) SwapchainCreateInfoKHR {
+	x.pQueueFamilyIndices = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithQueueFamilyIndexCount(uint32(len(y)))
+}
+func (x *SwapchainCreateInfoKHR) SetPQueueFamilyIndices(y []uint32) {
+	x.pQueueFamilyIndices = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetQueueFamilyIndexCount(uint32(len(y)))
+}
+
+// PinPQueueFamilyIndices pins the Go memory referenced by y with the AutoReleasePool
+// and sets PQueueFamilyIndices, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SwapchainCreateInfoKHR) PinPQueueFamilyIndices(arp *AutoReleasePool, y []uint32) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPQueueFamilyIndices(y)
+}
+
+// PreTransform returns the value of preTransform from VkSwapchainCreateInfoKHR
+func (x *SwapchainCreateInfoKHR) PreTransform() SurfaceTransformFlagBitsKHR {
+	ptr := /* typedef */ (*SurfaceTransformFlagBitsKHR)(&x.preTransform)
+	return *ptr
+}
+
+// WithPreTransform clones a new SwapchainCreateInfoKHR with the value of
+// PreTransform updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SwapchainCreateInfoKHR) WithPreTransform(y SurfaceTransformFlagBitsKHR) SwapchainCreateInfoKHR {
+	x.preTransform = *( /* typedef */ (*C.VkSurfaceTransformFlagBitsKHR)(&y))
+	return x
+}
+func (x *SwapchainCreateInfoKHR) SetPreTransform(y SurfaceTransformFlagBitsKHR) {
+	x.preTransform = *( /* typedef */ (*C.VkSurfaceTransformFlagBitsKHR)(&y))
+}
+
+// CompositeAlpha returns the value of compositeAlpha from VkSwapchainCreateInfoKHR
+func (x *SwapchainCreateInfoKHR) CompositeAlpha() CompositeAlphaFlagBitsKHR {
+	ptr := /* typedef */ (*CompositeAlphaFlagBitsKHR)(&x.compositeAlpha)
+	return *ptr
+}
+
+// WithCompositeAlpha clones a new SwapchainCreateInfoKHR with the value of
+// CompositeAlpha updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SwapchainCreateInfoKHR) WithCompositeAlpha(y CompositeAlphaFlagBitsKHR) SwapchainCreateInfoKHR {
+	x.compositeAlpha = *( /* typedef */ (*C.VkCompositeAlphaFlagBitsKHR)(&y))
+	return x
+}
+func (x *SwapchainCreateInfoKHR) SetCompositeAlpha(y CompositeAlphaFlagBitsKHR) {
+	x.compositeAlpha = *( /* typedef */ (*C.VkCompositeAlphaFlagBitsKHR)(&y))
+}
+
+// PresentMode returns the value of presentMode from VkSwapchainCreateInfoKHR
+func (x *SwapchainCreateInfoKHR) PresentMode() PresentModeKHR {
+	ptr := /* typedef */ (*PresentModeKHR)(&x.presentMode)
+	return *ptr
+}
+
+// WithPresentMode clones a new SwapchainCreateInfoKHR with the value of
+// PresentMode updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SwapchainCreateInfoKHR) WithPresentMode(y PresentModeKHR) SwapchainCreateInfoKHR {
+	x.presentMode = *( /* typedef */ (*C.VkPresentModeKHR)(&y))
+	return x
+}
+func (x *SwapchainCreateInfoKHR) SetPresentMode(y PresentModeKHR) {
+	x.presentMode = *( /* typedef */ (*C.VkPresentModeKHR)(&y))
+}
+
+// Clipped returns the value of clipped from VkSwapchainCreateInfoKHR
+func (x *SwapchainCreateInfoKHR) Clipped() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.clipped)
+	return *ptr
+}
+
+// WithClipped clones a new SwapchainCreateInfoKHR with the value of
+// Clipped updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SwapchainCreateInfoKHR) WithClipped(y Bool32) SwapchainCreateInfoKHR {
+	x.clipped = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *SwapchainCreateInfoKHR) SetClipped(y Bool32) {
+	x.clipped = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// OldSwapchain returns the value of oldSwapchain from VkSwapchainCreateInfoKHR
+func (x *SwapchainCreateInfoKHR) OldSwapchain() SwapchainKHR {
+	ptr := /* handle */ (*SwapchainKHR)(&x.oldSwapchain)
+	return *ptr
+}
+
+// WithOldSwapchain clones a new SwapchainCreateInfoKHR with the value of
+// OldSwapchain updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SwapchainCreateInfoKHR) WithOldSwapchain(y SwapchainKHR) SwapchainCreateInfoKHR {
+	x.oldSwapchain = *( /* handle */ (*C.VkSwapchainKHR)(&y))
+	return x
+}
+func (x *SwapchainCreateInfoKHR) SetOldSwapchain(y SwapchainKHR) {
+	x.oldSwapchain = *( /* handle */ (*C.VkSwapchainKHR)(&y))
+}
+
+// PresentInfoKHR provides a go interface for VkPresentInfoKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPresentInfoKHR.html
+type PresentInfoKHR C.struct_VkPresentInfoKHR
+
+// SizeofPresentInfoKHR is the memory size of a PresentInfoKHR
+var SizeofPresentInfoKHR int = int(unsafe.Sizeof(PresentInfoKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PresentInfoKHR) ArpPtr(arp *AutoReleasePool) *PresentInfoKHR {
+	ptr := newCBlock(cULong(SizeofPresentInfoKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PresentInfoKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PresentInfoKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PresentInfoKHR) AsCPtr() *PresentInfoKHR {
+	clone := (*PresentInfoKHR)(newCBlock(cULong(SizeofPresentInfoKHR)))
+	*clone = x
+	return clone
+}
+
+// PresentInfoKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PresentInfoKHRCSlice(arp *AutoReleasePool, x ...PresentInfoKHR) []PresentInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPresentInfoKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PresentInfoKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PresentInfoKHRFreeCSlice releases the memory allocated by PresentInfoKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PresentInfoKHRFreeCSlice(x []PresentInfoKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PresentInfoKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PresentInfoKHRFreeCSlice must be called on the returned slice.
+func PresentInfoKHRMakeCSlice(x ...PresentInfoKHR) []PresentInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPresentInfoKHR * len(x)
+	dst := unsafe.Slice((*PresentInfoKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPresentInfoKHR
+func (x PresentInfoKHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PresentInfoKHR with the value of
+// SType to the value provided in the specification.
+func (x PresentInfoKHR) WithDefaultSType() PresentInfoKHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_PRESENT_INFO_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PresentInfoKHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PRESENT_INFO_KHR)
+}
+
+// WithSType clones a new PresentInfoKHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PresentInfoKHR) WithSType(y StructureType) PresentInfoKHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PresentInfoKHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPresentInfoKHR
+func (x PresentInfoKHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PresentInfoKHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PresentInfoKHR) WithPNext(y unsafe.Pointer) PresentInfoKHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PresentInfoKHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PresentInfoKHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// WaitSemaphoreCount returns the value of waitSemaphoreCount from VkPresentInfoKHR
+func (x PresentInfoKHR) WaitSemaphoreCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.waitSemaphoreCount)
+	return *ptr
+}
+
+// WithWaitSemaphoreCount clones a new PresentInfoKHR with the value of
+// WaitSemaphoreCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PresentInfoKHR) WithWaitSemaphoreCount(y uint32) PresentInfoKHR {
+	x.waitSemaphoreCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *PresentInfoKHR) SetWaitSemaphoreCount(y uint32) {
+	x.waitSemaphoreCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PWaitSemaphores returns the value of pWaitSemaphores from VkPresentInfoKHR
+func (x PresentInfoKHR) PWaitSemaphores() []Semaphore {
+	if x.pWaitSemaphores == nil {
+		return nil
+	}
+	return unsafe.Slice((*Semaphore)(unsafe.Pointer(x.pWaitSemaphores)), x.waitSemaphoreCount)
+}
+
+// WithPWaitSemaphores clones a new PresentInfoKHR with the value of
+// PWaitSemaphores updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines WaitSemaphoreCount as the length of this field.
+// WaitSemaphoreCount is updated with the length of the new value.
+func (x PresentInfoKHR) WithPWaitSemaphores(y []Semaphore) PresentInfoKHR {
+	x.pWaitSemaphores = *(func(x *[]Semaphore) **C.VkSemaphore { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkSemaphore)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkSemaphore)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithWaitSemaphoreCount(uint32(len(y)))
+}
+func (x *PresentInfoKHR) SetPWaitSemaphores(y []Semaphore) {
+	x.pWaitSemaphores = *(func(x *[]Semaphore) **C.VkSemaphore { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkSemaphore)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkSemaphore)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetWaitSemaphoreCount(uint32(len(y)))
+}
+
+// PinPWaitSemaphores pins the Go memory referenced by y with the AutoReleasePool
+// and sets PWaitSemaphores, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PresentInfoKHR) PinPWaitSemaphores(arp *AutoReleasePool, y []Semaphore) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPWaitSemaphores(y)
+}
+
+// SwapchainCount returns the value of swapchainCount from VkPresentInfoKHR
+func (x PresentInfoKHR) SwapchainCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.swapchainCount)
+	return *ptr
+}
+
+// WithSwapchainCount clones a new PresentInfoKHR with the value of
+// SwapchainCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PresentInfoKHR) WithSwapchainCount(y uint32) PresentInfoKHR {
+	x.swapchainCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *PresentInfoKHR) SetSwapchainCount(y uint32) {
+	x.swapchainCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PSwapchains returns the value of pSwapchains from VkPresentInfoKHR
+func (x PresentInfoKHR) PSwapchains() []SwapchainKHR {
+	if x.pSwapchains == nil {
+		return nil
+	}
+	return unsafe.Slice((*SwapchainKHR)(unsafe.Pointer(x.pSwapchains)), x.swapchainCount)
+}
+
+// WithPSwapchains clones a new PresentInfoKHR with the value of
+// PSwapchains updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines SwapchainCount as the length of this field.
+// SwapchainCount is updated with the length of the new value.
+func (x PresentInfoKHR) WithPSwapchains(y []SwapchainKHR) PresentInfoKHR {
+	x.pSwapchains = *(func(x *[]SwapchainKHR) **C.VkSwapchainKHR { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkSwapchainKHR)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkSwapchainKHR)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithSwapchainCount(uint32(len(y)))
+}
+func (x *PresentInfoKHR) SetPSwapchains(y []SwapchainKHR) {
+	x.pSwapchains = *(func(x *[]SwapchainKHR) **C.VkSwapchainKHR { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkSwapchainKHR)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkSwapchainKHR)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetSwapchainCount(uint32(len(y)))
+}
+
+// PinPSwapchains pins the Go memory referenced by y with the AutoReleasePool
+// and sets PSwapchains, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PresentInfoKHR) PinPSwapchains(arp *AutoReleasePool, y []SwapchainKHR) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPSwapchains(y)
+}
+
+// PImageIndices returns the value of pImageIndices from VkPresentInfoKHR
+func (x PresentInfoKHR) PImageIndices() []uint32 {
+	if x.pImageIndices == nil {
+		return nil
+	}
+	return unsafe.Slice((*uint32)(unsafe.Pointer(x.pImageIndices)), x.swapchainCount)
+}
+
+// WithPImageIndices clones a new PresentInfoKHR with the value of
+// PImageIndices updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines SwapchainCount as the length of this field.
+// SwapchainCount is updated with the length of the new value.
+func (x PresentInfoKHR) WithPImageIndices(y []uint32) PresentInfoKHR {
+	x.pImageIndices = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithSwapchainCount(uint32(len(y)))
+}
+func (x *PresentInfoKHR) SetPImageIndices(y []uint32) {
+	x.pImageIndices = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetSwapchainCount(uint32(len(y)))
+}
+
+// PinPImageIndices pins the Go memory referenced by y with the AutoReleasePool
+// and sets PImageIndices, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PresentInfoKHR) PinPImageIndices(arp *AutoReleasePool, y []uint32) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPImageIndices(y)
+}
+
+// PResults returns the value of pResults from VkPresentInfoKHR
+func (x PresentInfoKHR) PResults() []Result {
+	if x.pResults == nil {
+		return nil
+	}
+	return unsafe.Slice((*Result)(unsafe.Pointer(x.pResults)), x.swapchainCount)
+}
+
+// WithPResults clones a new PresentInfoKHR with the value of
+// PResults updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines SwapchainCount as the length of this field.
+// SwapchainCount is updated with the length of the new value.
+func (x PresentInfoKHR) WithPResults(y []Result) PresentInfoKHR {
+	x.pResults = *(func(x *[]Result) **C.VkResult { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkResult)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkResult)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithSwapchainCount(uint32(len(y)))
+}
+func (x *PresentInfoKHR) SetPResults(y []Result) {
+	x.pResults = *(func(x *[]Result) **C.VkResult { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkResult)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkResult)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetSwapchainCount(uint32(len(y)))
+}
+
+// PinPResults pins the Go memory referenced by y with the AutoReleasePool
+// and sets PResults, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PresentInfoKHR) PinPResults(arp *AutoReleasePool, y []Result) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPResults(y)
+}
+
+// DeviceGroupPresentCapabilitiesKHR provides a go interface for VkDeviceGroupPresentCapabilitiesKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDeviceGroupPresentCapabilitiesKHR.html
+type DeviceGroupPresentCapabilitiesKHR C.struct_VkDeviceGroupPresentCapabilitiesKHR
+
+// SizeofDeviceGroupPresentCapabilitiesKHR is the memory size of a DeviceGroupPresentCapabilitiesKHR
+var SizeofDeviceGroupPresentCapabilitiesKHR int = int(unsafe.Sizeof(DeviceGroupPresentCapabilitiesKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DeviceGroupPresentCapabilitiesKHR) ArpPtr(arp *AutoReleasePool) *DeviceGroupPresentCapabilitiesKHR {
+	ptr := newCBlock(cULong(SizeofDeviceGroupPresentCapabilitiesKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DeviceGroupPresentCapabilitiesKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DeviceGroupPresentCapabilitiesKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DeviceGroupPresentCapabilitiesKHR) AsCPtr() *DeviceGroupPresentCapabilitiesKHR {
+	clone := (*DeviceGroupPresentCapabilitiesKHR)(newCBlock(cULong(SizeofDeviceGroupPresentCapabilitiesKHR)))
+	*clone = x
+	return clone
+}
+
+// DeviceGroupPresentCapabilitiesKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DeviceGroupPresentCapabilitiesKHRCSlice(arp *AutoReleasePool, x ...DeviceGroupPresentCapabilitiesKHR) []DeviceGroupPresentCapabilitiesKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceGroupPresentCapabilitiesKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DeviceGroupPresentCapabilitiesKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DeviceGroupPresentCapabilitiesKHRFreeCSlice releases the memory allocated by DeviceGroupPresentCapabilitiesKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DeviceGroupPresentCapabilitiesKHRFreeCSlice(x []DeviceGroupPresentCapabilitiesKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DeviceGroupPresentCapabilitiesKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DeviceGroupPresentCapabilitiesKHRFreeCSlice must be called on the returned slice.
+func DeviceGroupPresentCapabilitiesKHRMakeCSlice(x ...DeviceGroupPresentCapabilitiesKHR) []DeviceGroupPresentCapabilitiesKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceGroupPresentCapabilitiesKHR * len(x)
+	dst := unsafe.Slice((*DeviceGroupPresentCapabilitiesKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDeviceGroupPresentCapabilitiesKHR
+func (x *DeviceGroupPresentCapabilitiesKHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DeviceGroupPresentCapabilitiesKHR with the value of
+// SType to the value provided in the specification.
+func (x DeviceGroupPresentCapabilitiesKHR) WithDefaultSType() DeviceGroupPresentCapabilitiesKHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_CAPABILITIES_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DeviceGroupPresentCapabilitiesKHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_CAPABILITIES_KHR)
+}
+
+// WithSType clones a new DeviceGroupPresentCapabilitiesKHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupPresentCapabilitiesKHR) WithSType(y StructureType) DeviceGroupPresentCapabilitiesKHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DeviceGroupPresentCapabilitiesKHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDeviceGroupPresentCapabilitiesKHR
+func (x *DeviceGroupPresentCapabilitiesKHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DeviceGroupPresentCapabilitiesKHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupPresentCapabilitiesKHR) WithPNext(y unsafe.Pointer) DeviceGroupPresentCapabilitiesKHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceGroupPresentCapabilitiesKHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DeviceGroupPresentCapabilitiesKHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// PresentMask returns the value of presentMask from VkDeviceGroupPresentCapabilitiesKHR
+// The slice references the array in x; it is not a copy.
+func (x *DeviceGroupPresentCapabilitiesKHR) PresentMask() []uint32 {
+	ptr := func(x *[VK_MAX_DEVICE_GROUP_SIZE]C.uint32_t) *[]uint32 { /* Array for uint32 */
+		slc := unsafe.Slice((*uint32)(unsafe.Pointer(x)), VK_MAX_DEVICE_GROUP_SIZE)
+		return &slc
+	}(&x.presentMask)
+	return *ptr
+}
+
+// Modes returns the value of modes from VkDeviceGroupPresentCapabilitiesKHR
+func (x *DeviceGroupPresentCapabilitiesKHR) Modes() DeviceGroupPresentModeFlagsKHR {
+	ptr := /* typedef */ (*DeviceGroupPresentModeFlagsKHR)(&x.modes)
+	return *ptr
+}
+
+// DeviceGroupPresentInfoKHR provides a go interface for VkDeviceGroupPresentInfoKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDeviceGroupPresentInfoKHR.html
+type DeviceGroupPresentInfoKHR C.struct_VkDeviceGroupPresentInfoKHR
+
+// SizeofDeviceGroupPresentInfoKHR is the memory size of a DeviceGroupPresentInfoKHR
+var SizeofDeviceGroupPresentInfoKHR int = int(unsafe.Sizeof(DeviceGroupPresentInfoKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DeviceGroupPresentInfoKHR) ArpPtr(arp *AutoReleasePool) *DeviceGroupPresentInfoKHR {
+	ptr := newCBlock(cULong(SizeofDeviceGroupPresentInfoKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DeviceGroupPresentInfoKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DeviceGroupPresentInfoKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DeviceGroupPresentInfoKHR) AsCPtr() *DeviceGroupPresentInfoKHR {
+	clone := (*DeviceGroupPresentInfoKHR)(newCBlock(cULong(SizeofDeviceGroupPresentInfoKHR)))
+	*clone = x
+	return clone
+}
+
+// DeviceGroupPresentInfoKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DeviceGroupPresentInfoKHRCSlice(arp *AutoReleasePool, x ...DeviceGroupPresentInfoKHR) []DeviceGroupPresentInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceGroupPresentInfoKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DeviceGroupPresentInfoKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DeviceGroupPresentInfoKHRFreeCSlice releases the memory allocated by DeviceGroupPresentInfoKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DeviceGroupPresentInfoKHRFreeCSlice(x []DeviceGroupPresentInfoKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DeviceGroupPresentInfoKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DeviceGroupPresentInfoKHRFreeCSlice must be called on the returned slice.
+func DeviceGroupPresentInfoKHRMakeCSlice(x ...DeviceGroupPresentInfoKHR) []DeviceGroupPresentInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceGroupPresentInfoKHR * len(x)
+	dst := unsafe.Slice((*DeviceGroupPresentInfoKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDeviceGroupPresentInfoKHR
+func (x DeviceGroupPresentInfoKHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DeviceGroupPresentInfoKHR with the value of
+// SType to the value provided in the specification.
+func (x DeviceGroupPresentInfoKHR) WithDefaultSType() DeviceGroupPresentInfoKHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DeviceGroupPresentInfoKHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR)
+}
+
+// WithSType clones a new DeviceGroupPresentInfoKHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupPresentInfoKHR) WithSType(y StructureType) DeviceGroupPresentInfoKHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DeviceGroupPresentInfoKHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDeviceGroupPresentInfoKHR
+func (x DeviceGroupPresentInfoKHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DeviceGroupPresentInfoKHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupPresentInfoKHR) WithPNext(y unsafe.Pointer) DeviceGroupPresentInfoKHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceGroupPresentInfoKHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DeviceGroupPresentInfoKHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SwapchainCount returns the value of swapchainCount from VkDeviceGroupPresentInfoKHR
+func (x DeviceGroupPresentInfoKHR) SwapchainCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.swapchainCount)
+	return *ptr
+}
+
+// WithSwapchainCount clones a new DeviceGroupPresentInfoKHR with the value of
+// SwapchainCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupPresentInfoKHR) WithSwapchainCount(y uint32) DeviceGroupPresentInfoKHR {
+	x.swapchainCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceGroupPresentInfoKHR) SetSwapchainCount(y uint32) {
+	x.swapchainCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PDeviceMasks returns the value of pDeviceMasks from VkDeviceGroupPresentInfoKHR
+func (x DeviceGroupPresentInfoKHR) PDeviceMasks() []uint32 {
+	if x.pDeviceMasks == nil {
+		return nil
+	}
+	return unsafe.Slice((*uint32)(unsafe.Pointer(x.pDeviceMasks)), x.swapchainCount)
+}
+
+// WithPDeviceMasks clones a new DeviceGroupPresentInfoKHR with the value of
+// PDeviceMasks updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines SwapchainCount as the length of this field.
+// SwapchainCount is updated with the length of the new value.
+func (x DeviceGroupPresentInfoKHR) WithPDeviceMasks(y []uint32) DeviceGroupPresentInfoKHR {
+	x.pDeviceMasks = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithSwapchainCount(uint32(len(y)))
+}
+func (x *DeviceGroupPresentInfoKHR) SetPDeviceMasks(y []uint32) {
+	x.pDeviceMasks = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetSwapchainCount(uint32(len(y)))
+}
+
+// PinPDeviceMasks pins the Go memory referenced by y with the AutoReleasePool
+// and sets PDeviceMasks, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DeviceGroupPresentInfoKHR) PinPDeviceMasks(arp *AutoReleasePool, y []uint32) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPDeviceMasks(y)
+}
+
+// Mode returns the value of mode from VkDeviceGroupPresentInfoKHR
+func (x DeviceGroupPresentInfoKHR) Mode() DeviceGroupPresentModeFlagBitsKHR {
+	ptr := /* typedef */ (*DeviceGroupPresentModeFlagBitsKHR)(&x.mode)
+	return *ptr
+}
+
+// WithMode clones a new DeviceGroupPresentInfoKHR with the value of
+// Mode updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupPresentInfoKHR) WithMode(y DeviceGroupPresentModeFlagBitsKHR) DeviceGroupPresentInfoKHR {
+	x.mode = *( /* typedef */ (*C.VkDeviceGroupPresentModeFlagBitsKHR)(&y))
+	return x
+}
+func (x *DeviceGroupPresentInfoKHR) SetMode(y DeviceGroupPresentModeFlagBitsKHR) {
+	x.mode = *( /* typedef */ (*C.VkDeviceGroupPresentModeFlagBitsKHR)(&y))
+}
+
+// ImageSwapchainCreateInfoKHR provides a go interface for VkImageSwapchainCreateInfoKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkImageSwapchainCreateInfoKHR.html
+type ImageSwapchainCreateInfoKHR C.struct_VkImageSwapchainCreateInfoKHR
+
+// SizeofImageSwapchainCreateInfoKHR is the memory size of a ImageSwapchainCreateInfoKHR
+var SizeofImageSwapchainCreateInfoKHR int = int(unsafe.Sizeof(ImageSwapchainCreateInfoKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ImageSwapchainCreateInfoKHR) ArpPtr(arp *AutoReleasePool) *ImageSwapchainCreateInfoKHR {
+	ptr := newCBlock(cULong(SizeofImageSwapchainCreateInfoKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ImageSwapchainCreateInfoKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ImageSwapchainCreateInfoKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ImageSwapchainCreateInfoKHR) AsCPtr() *ImageSwapchainCreateInfoKHR {
+	clone := (*ImageSwapchainCreateInfoKHR)(newCBlock(cULong(SizeofImageSwapchainCreateInfoKHR)))
+	*clone = x
+	return clone
+}
+
+// ImageSwapchainCreateInfoKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ImageSwapchainCreateInfoKHRCSlice(arp *AutoReleasePool, x ...ImageSwapchainCreateInfoKHR) []ImageSwapchainCreateInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImageSwapchainCreateInfoKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ImageSwapchainCreateInfoKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ImageSwapchainCreateInfoKHRFreeCSlice releases the memory allocated by ImageSwapchainCreateInfoKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func ImageSwapchainCreateInfoKHRFreeCSlice(x []ImageSwapchainCreateInfoKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ImageSwapchainCreateInfoKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ImageSwapchainCreateInfoKHRFreeCSlice must be called on the returned slice.
+func ImageSwapchainCreateInfoKHRMakeCSlice(x ...ImageSwapchainCreateInfoKHR) []ImageSwapchainCreateInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImageSwapchainCreateInfoKHR * len(x)
+	dst := unsafe.Slice((*ImageSwapchainCreateInfoKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkImageSwapchainCreateInfoKHR
+func (x ImageSwapchainCreateInfoKHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ImageSwapchainCreateInfoKHR with the value of
+// SType to the value provided in the specification.
+func (x ImageSwapchainCreateInfoKHR) WithDefaultSType() ImageSwapchainCreateInfoKHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ImageSwapchainCreateInfoKHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR)
+}
+
+// WithSType clones a new ImageSwapchainCreateInfoKHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageSwapchainCreateInfoKHR) WithSType(y StructureType) ImageSwapchainCreateInfoKHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ImageSwapchainCreateInfoKHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkImageSwapchainCreateInfoKHR
+func (x ImageSwapchainCreateInfoKHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ImageSwapchainCreateInfoKHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageSwapchainCreateInfoKHR) WithPNext(y unsafe.Pointer) ImageSwapchainCreateInfoKHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ImageSwapchainCreateInfoKHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ImageSwapchainCreateInfoKHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Swapchain returns the value of swapchain from VkImageSwapchainCreateInfoKHR
+func (x ImageSwapchainCreateInfoKHR) Swapchain() SwapchainKHR {
+	ptr := /* handle */ (*SwapchainKHR)(&x.swapchain)
+	return *ptr
+}
+
+// WithSwapchain clones a new ImageSwapchainCreateInfoKHR with the value of
+// Swapchain updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageSwapchainCreateInfoKHR) WithSwapchain(y SwapchainKHR) ImageSwapchainCreateInfoKHR {
+	x.swapchain = *( /* handle */ (*C.VkSwapchainKHR)(&y))
+	return x
+}
+func (x *ImageSwapchainCreateInfoKHR) SetSwapchain(y SwapchainKHR) {
+	x.swapchain = *( /* handle */ (*C.VkSwapchainKHR)(&y))
+}
+
+// AcquireNextImageInfoKHR provides a go interface for VkAcquireNextImageInfoKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkAcquireNextImageInfoKHR.html
+type AcquireNextImageInfoKHR C.struct_VkAcquireNextImageInfoKHR
+
+// SizeofAcquireNextImageInfoKHR is the memory size of a AcquireNextImageInfoKHR
+var SizeofAcquireNextImageInfoKHR int = int(unsafe.Sizeof(AcquireNextImageInfoKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x AcquireNextImageInfoKHR) ArpPtr(arp *AutoReleasePool) *AcquireNextImageInfoKHR {
+	ptr := newCBlock(cULong(SizeofAcquireNextImageInfoKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*AcquireNextImageInfoKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *AcquireNextImageInfoKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x AcquireNextImageInfoKHR) AsCPtr() *AcquireNextImageInfoKHR {
+	clone := (*AcquireNextImageInfoKHR)(newCBlock(cULong(SizeofAcquireNextImageInfoKHR)))
+	*clone = x
+	return clone
+}
+
+// AcquireNextImageInfoKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func AcquireNextImageInfoKHRCSlice(arp *AutoReleasePool, x ...AcquireNextImageInfoKHR) []AcquireNextImageInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofAcquireNextImageInfoKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*AcquireNextImageInfoKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// AcquireNextImageInfoKHRFreeCSlice releases the memory allocated by AcquireNextImageInfoKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func AcquireNextImageInfoKHRFreeCSlice(x []AcquireNextImageInfoKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// AcquireNextImageInfoKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. AcquireNextImageInfoKHRFreeCSlice must be called on the returned slice.
+func AcquireNextImageInfoKHRMakeCSlice(x ...AcquireNextImageInfoKHR) []AcquireNextImageInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofAcquireNextImageInfoKHR * len(x)
+	dst := unsafe.Slice((*AcquireNextImageInfoKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkAcquireNextImageInfoKHR
+func (x AcquireNextImageInfoKHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new AcquireNextImageInfoKHR with the value of
+// SType to the value provided in the specification.
+func (x AcquireNextImageInfoKHR) WithDefaultSType() AcquireNextImageInfoKHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *AcquireNextImageInfoKHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_ACQUIRE_NEXT_IMAGE_INFO_KHR)
+}
+
+// WithSType clones a new AcquireNextImageInfoKHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AcquireNextImageInfoKHR) WithSType(y StructureType) AcquireNextImageInfoKHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *AcquireNextImageInfoKHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkAcquireNextImageInfoKHR
+func (x AcquireNextImageInfoKHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new AcquireNextImageInfoKHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AcquireNextImageInfoKHR) WithPNext(y unsafe.Pointer) AcquireNextImageInfoKHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *AcquireNextImageInfoKHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *AcquireNextImageInfoKHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Swapchain returns the value of swapchain from VkAcquireNextImageInfoKHR
+func (x AcquireNextImageInfoKHR) Swapchain() SwapchainKHR {
+	ptr := /* handle */ (*SwapchainKHR)(&x.swapchain)
+	return *ptr
+}
+
+// WithSwapchain clones a new AcquireNextImageInfoKHR with the value of
+// Swapchain updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AcquireNextImageInfoKHR) WithSwapchain(y SwapchainKHR) AcquireNextImageInfoKHR {
+	x.swapchain = *( /* handle */ (*C.VkSwapchainKHR)(&y))
+	return x
+}
+func (x *AcquireNextImageInfoKHR) SetSwapchain(y SwapchainKHR) {
+	x.swapchain = *( /* handle */ (*C.VkSwapchainKHR)(&y))
+}
+
+// Timeout returns the value of timeout from VkAcquireNextImageInfoKHR
+func (x AcquireNextImageInfoKHR) Timeout() uint64 {
+	ptr := func(x *C.uint64_t) *uint64 { /* Scalar */ c2g := uint64(*x); return &c2g }(&x.timeout)
+	return *ptr
+}
+
+// WithTimeout clones a new AcquireNextImageInfoKHR with the value of
+// Timeout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AcquireNextImageInfoKHR) WithTimeout(y uint64) AcquireNextImageInfoKHR {
+	x.timeout = *(func(x *uint64) *C.uint64_t { /* Scalar */ g2c := C.uint64_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *AcquireNextImageInfoKHR) SetTimeout(y uint64) {
+	x.timeout = *(func(x *uint64) *C.uint64_t { /* Scalar */ g2c := C.uint64_t(*x); return &g2c }(&y))
+}
+
+// Semaphore returns the value of semaphore from VkAcquireNextImageInfoKHR
+func (x AcquireNextImageInfoKHR) Semaphore() Semaphore {
+	ptr := /* handle */ (*Semaphore)(&x.semaphore)
+	return *ptr
+}
+
+// WithSemaphore clones a new AcquireNextImageInfoKHR with the value of
+// Semaphore updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AcquireNextImageInfoKHR) WithSemaphore(y Semaphore) AcquireNextImageInfoKHR {
+	x.semaphore = *( /* handle */ (*C.VkSemaphore)(&y))
+	return x
+}
+func (x *AcquireNextImageInfoKHR) SetSemaphore(y Semaphore) {
+	x.semaphore = *( /* handle */ (*C.VkSemaphore)(&y))
+}
+
+// Fence returns the value of fence from VkAcquireNextImageInfoKHR
+func (x AcquireNextImageInfoKHR) Fence() Fence {
+	ptr := /* handle */ (*Fence)(&x.fence)
+	return *ptr
+}
+
+// WithFence clones a new AcquireNextImageInfoKHR with the value of
+// Fence updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AcquireNextImageInfoKHR) WithFence(y Fence) AcquireNextImageInfoKHR {
+	x.fence = *( /* handle */ (*C.VkFence)(&y))
+	return x
+}
+func (x *AcquireNextImageInfoKHR) SetFence(y Fence) {
+	x.fence = *( /* handle */ (*C.VkFence)(&y))
+}
+
+// DeviceMask returns the value of deviceMask from VkAcquireNextImageInfoKHR
+func (x AcquireNextImageInfoKHR) DeviceMask() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.deviceMask)
+	return *ptr
+}
+
+// WithDeviceMask clones a new AcquireNextImageInfoKHR with the value of
+// DeviceMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AcquireNextImageInfoKHR) WithDeviceMask(y uint32) AcquireNextImageInfoKHR {
+	x.deviceMask = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *AcquireNextImageInfoKHR) SetDeviceMask(y uint32) {
+	x.deviceMask = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// BindImageMemorySwapchainInfoKHR provides a go interface for VkBindImageMemorySwapchainInfoKHR.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkBindImageMemorySwapchainInfoKHR.html
+type BindImageMemorySwapchainInfoKHR C.struct_VkBindImageMemorySwapchainInfoKHR
+
+// SizeofBindImageMemorySwapchainInfoKHR is the memory size of a BindImageMemorySwapchainInfoKHR
+var SizeofBindImageMemorySwapchainInfoKHR int = int(unsafe.Sizeof(BindImageMemorySwapchainInfoKHR{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x BindImageMemorySwapchainInfoKHR) ArpPtr(arp *AutoReleasePool) *BindImageMemorySwapchainInfoKHR {
+	ptr := newCBlock(cULong(SizeofBindImageMemorySwapchainInfoKHR))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*BindImageMemorySwapchainInfoKHR)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *BindImageMemorySwapchainInfoKHR) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x BindImageMemorySwapchainInfoKHR) AsCPtr() *BindImageMemorySwapchainInfoKHR {
+	clone := (*BindImageMemorySwapchainInfoKHR)(newCBlock(cULong(SizeofBindImageMemorySwapchainInfoKHR)))
+	*clone = x
+	return clone
+}
+
+// BindImageMemorySwapchainInfoKHRCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func BindImageMemorySwapchainInfoKHRCSlice(arp *AutoReleasePool, x ...BindImageMemorySwapchainInfoKHR) []BindImageMemorySwapchainInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBindImageMemorySwapchainInfoKHR * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*BindImageMemorySwapchainInfoKHR)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// BindImageMemorySwapchainInfoKHRFreeCSlice releases the memory allocated by BindImageMemorySwapchainInfoKHRMakeCSlice.
+// It does not free pointers stored inside the slice.
+func BindImageMemorySwapchainInfoKHRFreeCSlice(x []BindImageMemorySwapchainInfoKHR) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// BindImageMemorySwapchainInfoKHRMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. BindImageMemorySwapchainInfoKHRFreeCSlice must be called on the returned slice.
+func BindImageMemorySwapchainInfoKHRMakeCSlice(x ...BindImageMemorySwapchainInfoKHR) []BindImageMemorySwapchainInfoKHR {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBindImageMemorySwapchainInfoKHR * len(x)
+	dst := unsafe.Slice((*BindImageMemorySwapchainInfoKHR)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkBindImageMemorySwapchainInfoKHR
+func (x BindImageMemorySwapchainInfoKHR) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new BindImageMemorySwapchainInfoKHR with the value of
+// SType to the value provided in the specification.
+func (x BindImageMemorySwapchainInfoKHR) WithDefaultSType() BindImageMemorySwapchainInfoKHR {
+	return x.WithSType(VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *BindImageMemorySwapchainInfoKHR) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR)
+}
+
+// WithSType clones a new BindImageMemorySwapchainInfoKHR with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindImageMemorySwapchainInfoKHR) WithSType(y StructureType) BindImageMemorySwapchainInfoKHR {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *BindImageMemorySwapchainInfoKHR) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkBindImageMemorySwapchainInfoKHR
+func (x BindImageMemorySwapchainInfoKHR) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new BindImageMemorySwapchainInfoKHR with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindImageMemorySwapchainInfoKHR) WithPNext(y unsafe.Pointer) BindImageMemorySwapchainInfoKHR {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *BindImageMemorySwapchainInfoKHR) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *BindImageMemorySwapchainInfoKHR) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Swapchain returns the value of swapchain from VkBindImageMemorySwapchainInfoKHR
+func (x BindImageMemorySwapchainInfoKHR) Swapchain() SwapchainKHR {
+	ptr := /* handle */ (*SwapchainKHR)(&x.swapchain)
+	return *ptr
+}
+
+// WithSwapchain clones a new BindImageMemorySwapchainInfoKHR with the value of
+// Swapchain updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindImageMemorySwapchainInfoKHR) WithSwapchain(y SwapchainKHR) BindImageMemorySwapchainInfoKHR {
+	x.swapchain = *( /* handle */ (*C.VkSwapchainKHR)(&y))
+	return x
+}
+func (x *BindImageMemorySwapchainInfoKHR) SetSwapchain(y SwapchainKHR) {
+	x.swapchain = *( /* handle */ (*C.VkSwapchainKHR)(&y))
+}
+
+// ImageIndex returns the value of imageIndex from VkBindImageMemorySwapchainInfoKHR
+func (x BindImageMemorySwapchainInfoKHR) ImageIndex() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.imageIndex)
+	return *ptr
+}
+
+// WithImageIndex clones a new BindImageMemorySwapchainInfoKHR with the value of
+// ImageIndex updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindImageMemorySwapchainInfoKHR) WithImageIndex(y uint32) BindImageMemorySwapchainInfoKHR {
+	x.imageIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *BindImageMemorySwapchainInfoKHR) SetImageIndex(y uint32) {
+	x.imageIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// CreateSwapchainKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCreateSwapchainKHR.html
+func (x DeviceFacade) CreateSwapchainKHR(pCreateInfo *SwapchainCreateInfoKHR, pAllocator *AllocationCallbacks, pSwapchain *SwapchainKHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **SwapchainCreateInfoKHR) **C.struct_VkSwapchainCreateInfoKHR { /* Pointer */
+		g2c := (*C.struct_VkSwapchainCreateInfoKHR)(*x)
+		return &g2c
+	}(&pCreateInfo)
+	p2 := func(x **AllocationCallbacks) **C.struct_VkAllocationCallbacks { /* Pointer */
+		g2c := (*C.struct_VkAllocationCallbacks)(*x)
+		return &g2c
+	}(&pAllocator)
+	p3 := func(x **SwapchainKHR) **C.VkSwapchainKHR { /* Pointer */ g2c := (*C.VkSwapchainKHR)(*x); return &g2c }(&pSwapchain)
+	ret := C.vkCreateSwapchainKHR(addrs, *p0, *p1, *p2, *p3)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// AcquireNextImageKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkAcquireNextImageKHR.html
+func (x DeviceFacade) AcquireNextImageKHR(swapchain SwapchainKHR, timeout uint64, semaphore Semaphore, fence Fence, pImageIndex *uint32) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := /* handle */ (*C.VkSwapchainKHR)(&swapchain)
+	p2 := func(x *uint64) *C.uint64_t { /* Scalar */ g2c := C.uint64_t(*x); return &g2c }(&timeout)
+	p3 := /* handle */ (*C.VkSemaphore)(&semaphore)
+	p4 := /* handle */ (*C.VkFence)(&fence)
+	p5 := func(x **uint32) **C.uint32_t { /* Pointer */ g2c := (*C.uint32_t)(*x); return &g2c }(&pImageIndex)
+	ret := C.vkAcquireNextImageKHR(addrs, *p0, *p1, *p2, *p3, *p4, *p5)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// QueuePresentKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkQueuePresentKHR.html
+func (x QueueFacade) QueuePresentKHR(pPresentInfo *PresentInfoKHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkQueue)(&x.H)
+	p1 := func(x **PresentInfoKHR) **C.struct_VkPresentInfoKHR { /* Pointer */
+		g2c := (*C.struct_VkPresentInfoKHR)(*x)
+		return &g2c
+	}(&pPresentInfo)
+	ret := C.vkQueuePresentKHR(addrs, *p0, *p1)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// AcquireNextImage2KHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkAcquireNextImage2KHR.html
+func (x DeviceFacade) AcquireNextImage2KHR(pAcquireInfo *AcquireNextImageInfoKHR, pImageIndex *uint32) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **AcquireNextImageInfoKHR) **C.struct_VkAcquireNextImageInfoKHR { /* Pointer */
+		g2c := (*C.struct_VkAcquireNextImageInfoKHR)(*x)
+		return &g2c
+	}(&pAcquireInfo)
+	p2 := func(x **uint32) **C.uint32_t { /* Pointer */ g2c := (*C.uint32_t)(*x); return &g2c }(&pImageIndex)
+	ret := C.vkAcquireNextImage2KHR(addrs, *p0, *p1, *p2)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetPhysicalDevicePresentRectanglesKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPhysicalDevicePresentRectanglesKHR.html
+func (x PhysicalDeviceFacade) GetPhysicalDevicePresentRectanglesKHR(surface SurfaceKHR, pRectCount *uint32, pRects []Rect2D) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := /* handle */ (*C.VkSurfaceKHR)(&surface)
+	p2 := func(x **uint32) **C.uint32_t { /* Pointer */ g2c := (*C.uint32_t)(*x); return &g2c }(&pRectCount)
+	p3 := func(x *[]Rect2D) **C.struct_VkRect2D { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkRect2D)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkRect2D)(unsafe.Pointer((&ptr)))
+	}(&pRects)
+	ret := C.vkGetPhysicalDevicePresentRectanglesKHR(addrs, *p0, *p1, *p2, *p3)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetPhysicalDevicePresentRectanglesKHRInto calls GetPhysicalDevicePresentRectanglesKHR with the count query, the fill and
+// the VK_INCOMPLETE retries in a single cgo call. The elements are stored in
+// dst, reallocated only when its capacity is too small, and returned.
+func (x PhysicalDeviceFacade) GetPhysicalDevicePresentRectanglesKHRInto(surface SurfaceKHR, dst []Rect2D) ([]Rect2D, Result) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := /* handle */ (*C.VkSurfaceKHR)(&surface)
+	for {
+		dst = dst[:cap(dst)]
+		var items *C.struct_VkRect2D
+		if len(dst) > 0 {
+			items = (*C.struct_VkRect2D)(unsafe.Pointer(&dst[0]))
+		}
+		ret := C.vksEnumerate_vkGetPhysicalDevicePresentRectanglesKHR(addrs, C.uint64_t(uintptr(unsafe.Pointer(*p0))), C.uint64_t(uintptr(unsafe.Pointer(*p1))), C.uint32_t(len(dst)), items)
+		if Result(ret.result) == VK_INCOMPLETE && int(ret.count) > len(dst) {
+			dst = make([]Rect2D, ret.count)
+			continue
+		}
+		return dst[:ret.count], Result(ret.result)
+	}
+}
+
+// GetSwapchainImagesKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetSwapchainImagesKHR.html
+func (x DeviceFacade) GetSwapchainImagesKHR(swapchain SwapchainKHR, pSwapchainImageCount *uint32, pSwapchainImages []Image) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := /* handle */ (*C.VkSwapchainKHR)(&swapchain)
+	p2 := func(x **uint32) **C.uint32_t { /* Pointer */ g2c := (*C.uint32_t)(*x); return &g2c }(&pSwapchainImageCount)
+	p3 := func(x *[]Image) **C.VkImage { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkImage)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkImage)(unsafe.Pointer((&ptr)))
+	}(&pSwapchainImages)
+	ret := C.vkGetSwapchainImagesKHR(addrs, *p0, *p1, *p2, *p3)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetSwapchainImagesKHRInto calls GetSwapchainImagesKHR with the count query, the fill and
+// the VK_INCOMPLETE retries in a single cgo call. The elements are stored in
+// dst, reallocated only when its capacity is too small, and returned.
+func (x DeviceFacade) GetSwapchainImagesKHRInto(swapchain SwapchainKHR, dst []Image) ([]Image, Result) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := /* handle */ (*C.VkSwapchainKHR)(&swapchain)
+	for {
+		dst = dst[:cap(dst)]
+		var items *C.VkImage
+		if len(dst) > 0 {
+			items = (*C.VkImage)(unsafe.Pointer(&dst[0]))
+		}
+		ret := C.vksEnumerate_vkGetSwapchainImagesKHR(addrs, C.uint64_t(uintptr(unsafe.Pointer(*p0))), C.uint64_t(uintptr(unsafe.Pointer(*p1))), C.uint32_t(len(dst)), items)
+		if Result(ret.result) == VK_INCOMPLETE && int(ret.count) > len(dst) {
+			dst = make([]Image, ret.count)
+			continue
+		}
+		return dst[:ret.count], Result(ret.result)
+	}
+}
+
+// GetDeviceGroupSurfacePresentModesKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetDeviceGroupSurfacePresentModesKHR.html
+func (x DeviceFacade) GetDeviceGroupSurfacePresentModesKHR(surface SurfaceKHR, pModes *DeviceGroupPresentModeFlagsKHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := /* handle */ (*C.VkSurfaceKHR)(&surface)
+	p2 := func(x **DeviceGroupPresentModeFlagsKHR) **C.VkDeviceGroupPresentModeFlagsKHR { /* Pointer */
+		g2c := (*C.VkDeviceGroupPresentModeFlagsKHR)(*x)
+		return &g2c
+	}(&pModes)
+	ret := C.vkGetDeviceGroupSurfacePresentModesKHR(addrs, *p0, *p1, *p2)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// DestroySwapchainKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkDestroySwapchainKHR.html
+func (x DeviceFacade) DestroySwapchainKHR(swapchain SwapchainKHR, pAllocator *AllocationCallbacks) {
+	addrs := x.procs
+	if destroyHooks.Load() != nil {
+		handleDestroyed(VK_OBJECT_TYPE_SWAPCHAIN_KHR, uint64(uintptr(unsafe.Pointer(swapchain))))
+	}
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := /* handle */ (*C.VkSwapchainKHR)(&swapchain)
+	p2 := func(x **AllocationCallbacks) **C.struct_VkAllocationCallbacks { /* Pointer */
+		g2c := (*C.struct_VkAllocationCallbacks)(*x)
+		return &g2c
+	}(&pAllocator)
+	C.vkDestroySwapchainKHR(addrs, *p0, *p1, *p2)
+}
+
+// GetDeviceGroupPresentCapabilitiesKHR command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetDeviceGroupPresentCapabilitiesKHR.html
+func (x DeviceFacade) GetDeviceGroupPresentCapabilitiesKHR(pDeviceGroupPresentCapabilities *DeviceGroupPresentCapabilitiesKHR) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **DeviceGroupPresentCapabilitiesKHR) **C.struct_VkDeviceGroupPresentCapabilitiesKHR { /* Pointer */
+		g2c := (*C.struct_VkDeviceGroupPresentCapabilitiesKHR)(*x)
+		return &g2c
+	}(&pDeviceGroupPresentCapabilities)
+	ret := C.vkGetDeviceGroupPresentCapabilitiesKHR(addrs, *p0, *p1)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
@@ -0,0 +1,296 @@
+//go:build !vks_no_version_1_1
+
+// Wrappers of VK_VERSION_1_1.
+#include "vk_wrapper.h"
+#include "vk_capture.h"
+
+void vkGetPhysicalDeviceFormatProperties2(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkFormat format, VkFormatProperties2* pFormatProperties) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkGetPhysicalDeviceFormatProperties2(addrs, physicalDevice, format, pFormatProperties);
+		return;
+	}
+	(((PFN_vkGetPhysicalDeviceFormatProperties2)addrs->pvkGetPhysicalDeviceFormatProperties2)(physicalDevice, format, pFormatProperties));
+}
+void vkGetPhysicalDeviceExternalFenceProperties(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceExternalFenceInfo* pExternalFenceInfo, VkExternalFenceProperties* pExternalFenceProperties) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkGetPhysicalDeviceExternalFenceProperties(addrs, physicalDevice, pExternalFenceInfo, pExternalFenceProperties);
+		return;
+	}
+	(((PFN_vkGetPhysicalDeviceExternalFenceProperties)addrs->pvkGetPhysicalDeviceExternalFenceProperties)(physicalDevice, pExternalFenceInfo, pExternalFenceProperties));
+}
+void vkGetPhysicalDeviceExternalBufferProperties(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceExternalBufferInfo* pExternalBufferInfo, VkExternalBufferProperties* pExternalBufferProperties) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkGetPhysicalDeviceExternalBufferProperties(addrs, physicalDevice, pExternalBufferInfo, pExternalBufferProperties);
+		return;
+	}
+	(((PFN_vkGetPhysicalDeviceExternalBufferProperties)addrs->pvkGetPhysicalDeviceExternalBufferProperties)(physicalDevice, pExternalBufferInfo, pExternalBufferProperties));
+}
+void vkUpdateDescriptorSetWithTemplate(vksProcAddr* addrs, VkDevice device, VkDescriptorSet descriptorSet, VkDescriptorUpdateTemplate descriptorUpdateTemplate, void* pData) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkUpdateDescriptorSetWithTemplate(addrs, device, descriptorSet, descriptorUpdateTemplate, pData);
+		return;
+	}
+	(((PFN_vkUpdateDescriptorSetWithTemplate)addrs->pvkUpdateDescriptorSetWithTemplate)(device, descriptorSet, descriptorUpdateTemplate, pData));
+}
+void vkDestroyDescriptorUpdateTemplate(vksProcAddr* addrs, VkDevice device, VkDescriptorUpdateTemplate descriptorUpdateTemplate, VkAllocationCallbacks* pAllocator) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkDestroyDescriptorUpdateTemplate(addrs, device, descriptorUpdateTemplate, pAllocator);
+		return;
+	}
+	(((PFN_vkDestroyDescriptorUpdateTemplate)addrs->pvkDestroyDescriptorUpdateTemplate)(device, descriptorUpdateTemplate, pAllocator));
+}
+VkResult vkCreateDescriptorUpdateTemplate(vksProcAddr* addrs, VkDevice device, VkDescriptorUpdateTemplateCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkDescriptorUpdateTemplate* pDescriptorUpdateTemplate) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkCreateDescriptorUpdateTemplate(addrs, device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate);
+	}
+	VkResult ret = (((PFN_vkCreateDescriptorUpdateTemplate)addrs->pvkCreateDescriptorUpdateTemplate)(device, pCreateInfo, pAllocator, pDescriptorUpdateTemplate));
+	return ret;
+}
+void vkDestroySamplerYcbcrConversion(vksProcAddr* addrs, VkDevice device, VkSamplerYcbcrConversion ycbcrConversion, VkAllocationCallbacks* pAllocator) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkDestroySamplerYcbcrConversion(addrs, device, ycbcrConversion, pAllocator);
+		return;
+	}
+	(((PFN_vkDestroySamplerYcbcrConversion)addrs->pvkDestroySamplerYcbcrConversion)(device, ycbcrConversion, pAllocator));
+}
+VkResult vkCreateSamplerYcbcrConversion(vksProcAddr* addrs, VkDevice device, VkSamplerYcbcrConversionCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkSamplerYcbcrConversion* pYcbcrConversion) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkCreateSamplerYcbcrConversion(addrs, device, pCreateInfo, pAllocator, pYcbcrConversion);
+	}
+	VkResult ret = (((PFN_vkCreateSamplerYcbcrConversion)addrs->pvkCreateSamplerYcbcrConversion)(device, pCreateInfo, pAllocator, pYcbcrConversion));
+	return ret;
+}
+void vkGetDeviceQueue2(vksProcAddr* addrs, VkDevice device, VkDeviceQueueInfo2* pQueueInfo, VkQueue* pQueue) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkGetDeviceQueue2(addrs, device, pQueueInfo, pQueue);
+		return;
+	}
+	(((PFN_vkGetDeviceQueue2)addrs->pvkGetDeviceQueue2)(device, pQueueInfo, pQueue));
+}
+void vkTrimCommandPool(vksProcAddr* addrs, VkDevice device, VkCommandPool commandPool, VkCommandPoolTrimFlags flags) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkTrimCommandPool(addrs, device, commandPool, flags);
+		return;
+	}
+	(((PFN_vkTrimCommandPool)addrs->pvkTrimCommandPool)(device, commandPool, flags));
+}
+void vkGetPhysicalDeviceExternalSemaphoreProperties(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceExternalSemaphoreInfo* pExternalSemaphoreInfo, VkExternalSemaphoreProperties* pExternalSemaphoreProperties) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkGetPhysicalDeviceExternalSemaphoreProperties(addrs, physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties);
+		return;
+	}
+	(((PFN_vkGetPhysicalDeviceExternalSemaphoreProperties)addrs->pvkGetPhysicalDeviceExternalSemaphoreProperties)(physicalDevice, pExternalSemaphoreInfo, pExternalSemaphoreProperties));
+}
+void vkGetPhysicalDeviceSparseImageFormatProperties2(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceSparseImageFormatInfo2* pFormatInfo, uint32_t* pPropertyCount, VkSparseImageFormatProperties2* pProperties) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkGetPhysicalDeviceSparseImageFormatProperties2(addrs, physicalDevice, pFormatInfo, pPropertyCount, pProperties);
+		return;
+	}
+	(((PFN_vkGetPhysicalDeviceSparseImageFormatProperties2)addrs->pvkGetPhysicalDeviceSparseImageFormatProperties2)(physicalDevice, pFormatInfo, pPropertyCount, pProperties));
+}
+
+// Runs the two-call idiom of vkGetPhysicalDeviceSparseImageFormatProperties2 in one call. capacity is the
+// length of pProperties; when it is too small, the result is VK_INCOMPLETE
+// with the count needed.
+vksEnumerateResult vksEnumerate_vkGetPhysicalDeviceSparseImageFormatProperties2(vksProcAddr* addrs, uint64_t physicalDevice, VkPhysicalDeviceSparseImageFormatInfo2* pFormatInfo, uint32_t capacity, VkSparseImageFormatProperties2* pProperties) {
+	vksEnumerateResult r = { VK_SUCCESS, capacity };
+	for (uint32_t i = 0; i < capacity; i++) {
+		pProperties[i].sType = VK_STRUCTURE_TYPE_SPARSE_IMAGE_FORMAT_PROPERTIES_2;
+	}
+	r.count = 0;
+	vkGetPhysicalDeviceSparseImageFormatProperties2(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, pFormatInfo, &r.count, NULL);
+	if (r.count > capacity) {
+		r.result = VK_INCOMPLETE;
+		return r;
+	}
+	vkGetPhysicalDeviceSparseImageFormatProperties2(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, pFormatInfo, &r.count, pProperties);
+	return r;
+}
+void vkGetPhysicalDeviceMemoryProperties2(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceMemoryProperties2* pMemoryProperties) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkGetPhysicalDeviceMemoryProperties2(addrs, physicalDevice, pMemoryProperties);
+		return;
+	}
+	(((PFN_vkGetPhysicalDeviceMemoryProperties2)addrs->pvkGetPhysicalDeviceMemoryProperties2)(physicalDevice, pMemoryProperties));
+}
+void vkGetPhysicalDeviceQueueFamilyProperties2(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t* pQueueFamilyPropertyCount, VkQueueFamilyProperties2* pQueueFamilyProperties) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkGetPhysicalDeviceQueueFamilyProperties2(addrs, physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties);
+		return;
+	}
+	(((PFN_vkGetPhysicalDeviceQueueFamilyProperties2)addrs->pvkGetPhysicalDeviceQueueFamilyProperties2)(physicalDevice, pQueueFamilyPropertyCount, pQueueFamilyProperties));
+}
+
+// Runs the two-call idiom of vkGetPhysicalDeviceQueueFamilyProperties2 in one call. capacity is the
+// length of pQueueFamilyProperties; when it is too small, the result is VK_INCOMPLETE
+// with the count needed.
+vksEnumerateResult vksEnumerate_vkGetPhysicalDeviceQueueFamilyProperties2(vksProcAddr* addrs, uint64_t physicalDevice, uint32_t capacity, VkQueueFamilyProperties2* pQueueFamilyProperties) {
+	vksEnumerateResult r = { VK_SUCCESS, capacity };
+	for (uint32_t i = 0; i < capacity; i++) {
+		pQueueFamilyProperties[i].sType = VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2;
+	}
+	r.count = 0;
+	vkGetPhysicalDeviceQueueFamilyProperties2(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, &r.count, NULL);
+	if (r.count > capacity) {
+		r.result = VK_INCOMPLETE;
+		return r;
+	}
+	vkGetPhysicalDeviceQueueFamilyProperties2(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, &r.count, pQueueFamilyProperties);
+	return r;
+}
+VkResult vkGetPhysicalDeviceImageFormatProperties2(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceImageFormatInfo2* pImageFormatInfo, VkImageFormatProperties2* pImageFormatProperties) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetPhysicalDeviceImageFormatProperties2(addrs, physicalDevice, pImageFormatInfo, pImageFormatProperties);
+	}
+	VkResult ret = (((PFN_vkGetPhysicalDeviceImageFormatProperties2)addrs->pvkGetPhysicalDeviceImageFormatProperties2)(physicalDevice, pImageFormatInfo, pImageFormatProperties));
+	return ret;
+}
+void vkGetPhysicalDeviceProperties2(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceProperties2* pProperties) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkGetPhysicalDeviceProperties2(addrs, physicalDevice, pProperties);
+		return;
+	}
+	(((PFN_vkGetPhysicalDeviceProperties2)addrs->pvkGetPhysicalDeviceProperties2)(physicalDevice, pProperties));
+}
+void vkGetPhysicalDeviceFeatures2(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, VkPhysicalDeviceFeatures2* pFeatures) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkGetPhysicalDeviceFeatures2(addrs, physicalDevice, pFeatures);
+		return;
+	}
+	(((PFN_vkGetPhysicalDeviceFeatures2)addrs->pvkGetPhysicalDeviceFeatures2)(physicalDevice, pFeatures));
+}
+void vkGetImageSparseMemoryRequirements2(vksProcAddr* addrs, VkDevice device, VkImageSparseMemoryRequirementsInfo2* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2* pSparseMemoryRequirements) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkGetImageSparseMemoryRequirements2(addrs, device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+		return;
+	}
+	(((PFN_vkGetImageSparseMemoryRequirements2)addrs->pvkGetImageSparseMemoryRequirements2)(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements));
+}
+
+// Runs the two-call idiom of vkGetImageSparseMemoryRequirements2 in one call. capacity is the
+// length of pSparseMemoryRequirements; when it is too small, the result is VK_INCOMPLETE
+// with the count needed.
+vksEnumerateResult vksEnumerate_vkGetImageSparseMemoryRequirements2(vksProcAddr* addrs, uint64_t device, VkImageSparseMemoryRequirementsInfo2* pInfo, uint32_t capacity, VkSparseImageMemoryRequirements2* pSparseMemoryRequirements) {
+	vksEnumerateResult r = { VK_SUCCESS, capacity };
+	for (uint32_t i = 0; i < capacity; i++) {
+		pSparseMemoryRequirements[i].sType = VK_STRUCTURE_TYPE_SPARSE_IMAGE_MEMORY_REQUIREMENTS_2;
+	}
+	r.count = 0;
+	vkGetImageSparseMemoryRequirements2(addrs, (VkDevice)(uintptr_t)device, pInfo, &r.count, NULL);
+	if (r.count > capacity) {
+		r.result = VK_INCOMPLETE;
+		return r;
+	}
+	vkGetImageSparseMemoryRequirements2(addrs, (VkDevice)(uintptr_t)device, pInfo, &r.count, pSparseMemoryRequirements);
+	return r;
+}
+void vkGetBufferMemoryRequirements2(vksProcAddr* addrs, VkDevice device, VkBufferMemoryRequirementsInfo2* pInfo, VkMemoryRequirements2* pMemoryRequirements) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkGetBufferMemoryRequirements2(addrs, device, pInfo, pMemoryRequirements);
+		return;
+	}
+	(((PFN_vkGetBufferMemoryRequirements2)addrs->pvkGetBufferMemoryRequirements2)(device, pInfo, pMemoryRequirements));
+}
+void vkGetDescriptorSetLayoutSupport(vksProcAddr* addrs, VkDevice device, VkDescriptorSetLayoutCreateInfo* pCreateInfo, VkDescriptorSetLayoutSupport* pSupport) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkGetDescriptorSetLayoutSupport(addrs, device, pCreateInfo, pSupport);
+		return;
+	}
+	(((PFN_vkGetDescriptorSetLayoutSupport)addrs->pvkGetDescriptorSetLayoutSupport)(device, pCreateInfo, pSupport));
+}
+void vkGetImageMemoryRequirements2(vksProcAddr* addrs, VkDevice device, VkImageMemoryRequirementsInfo2* pInfo, VkMemoryRequirements2* pMemoryRequirements) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkGetImageMemoryRequirements2(addrs, device, pInfo, pMemoryRequirements);
+		return;
+	}
+	(((PFN_vkGetImageMemoryRequirements2)addrs->pvkGetImageMemoryRequirements2)(device, pInfo, pMemoryRequirements));
+}
+VkResult vkEnumeratePhysicalDeviceGroups(vksProcAddr* addrs, VkInstance instance, uint32_t* pPhysicalDeviceGroupCount, VkPhysicalDeviceGroupProperties* pPhysicalDeviceGroupProperties) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkEnumeratePhysicalDeviceGroups(addrs, instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties);
+	}
+	VkResult ret = (((PFN_vkEnumeratePhysicalDeviceGroups)addrs->pvkEnumeratePhysicalDeviceGroups)(instance, pPhysicalDeviceGroupCount, pPhysicalDeviceGroupProperties));
+	return ret;
+}
+
+// Runs the two-call idiom of vkEnumeratePhysicalDeviceGroups in one call. capacity is the
+// length of pPhysicalDeviceGroupProperties; when it is too small, the result is VK_INCOMPLETE
+// with the count needed.
+vksEnumerateResult vksEnumerate_vkEnumeratePhysicalDeviceGroups(vksProcAddr* addrs, uint64_t instance, uint32_t capacity, VkPhysicalDeviceGroupProperties* pPhysicalDeviceGroupProperties) {
+	vksEnumerateResult r = { VK_SUCCESS, capacity };
+	for (uint32_t i = 0; i < capacity; i++) {
+		pPhysicalDeviceGroupProperties[i].sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES;
+	}
+	if (capacity > 0) {
+		// Large enough buffers skip the count query.
+		r.result = vkEnumeratePhysicalDeviceGroups(addrs, (VkInstance)(uintptr_t)instance, &r.count, pPhysicalDeviceGroupProperties);
+		if (r.result < 0) {
+			r.count = 0;
+		}
+		if (r.result != VK_INCOMPLETE) {
+			return r;
+		}
+	}
+	for (;;) {
+		r.count = 0;
+		r.result = vkEnumeratePhysicalDeviceGroups(addrs, (VkInstance)(uintptr_t)instance, &r.count, NULL);
+		if (r.result < 0) {
+			r.count = 0;
+			return r;
+		}
+		if (r.count > capacity) {
+			r.result = VK_INCOMPLETE;
+			return r;
+		}
+		r.result = vkEnumeratePhysicalDeviceGroups(addrs, (VkInstance)(uintptr_t)instance, &r.count, pPhysicalDeviceGroupProperties);
+		if (r.result != VK_INCOMPLETE) {
+			if (r.result < 0) {
+				r.count = 0;
+			}
+			return r;
+		}
+		// The count grew between the calls.
+	}
+}
+void vkCmdDispatchBase(vksProcAddr* addrs, VkCommandBuffer commandBuffer, uint32_t baseGroupX, uint32_t baseGroupY, uint32_t baseGroupZ, uint32_t groupCountX, uint32_t groupCountY, uint32_t groupCountZ) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdDispatchBase(addrs, commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ);
+		return;
+	}
+	(((PFN_vkCmdDispatchBase)addrs->pvkCmdDispatchBase)(commandBuffer, baseGroupX, baseGroupY, baseGroupZ, groupCountX, groupCountY, groupCountZ));
+}
+void vkCmdSetDeviceMask(vksProcAddr* addrs, VkCommandBuffer commandBuffer, uint32_t deviceMask) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdSetDeviceMask(addrs, commandBuffer, deviceMask);
+		return;
+	}
+	(((PFN_vkCmdSetDeviceMask)addrs->pvkCmdSetDeviceMask)(commandBuffer, deviceMask));
+}
+void vkGetDeviceGroupPeerMemoryFeatures(vksProcAddr* addrs, VkDevice device, uint32_t heapIndex, uint32_t localDeviceIndex, uint32_t remoteDeviceIndex, VkPeerMemoryFeatureFlags* pPeerMemoryFeatures) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkGetDeviceGroupPeerMemoryFeatures(addrs, device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures);
+		return;
+	}
+	(((PFN_vkGetDeviceGroupPeerMemoryFeatures)addrs->pvkGetDeviceGroupPeerMemoryFeatures)(device, heapIndex, localDeviceIndex, remoteDeviceIndex, pPeerMemoryFeatures));
+}
+VkResult vkBindImageMemory2(vksProcAddr* addrs, VkDevice device, uint32_t bindInfoCount, VkBindImageMemoryInfo* pBindInfos) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkBindImageMemory2(addrs, device, bindInfoCount, pBindInfos);
+	}
+	VkResult ret = (((PFN_vkBindImageMemory2)addrs->pvkBindImageMemory2)(device, bindInfoCount, pBindInfos));
+	return ret;
+}
+VkResult vkBindBufferMemory2(vksProcAddr* addrs, VkDevice device, uint32_t bindInfoCount, VkBindBufferMemoryInfo* pBindInfos) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkBindBufferMemory2(addrs, device, bindInfoCount, pBindInfos);
+	}
+	VkResult ret = (((PFN_vkBindBufferMemory2)addrs->pvkBindBufferMemory2)(device, bindInfoCount, pBindInfos));
+	return ret;
+}
+VkResult vkEnumerateInstanceVersion(vksProcAddr* addrs, uint32_t* pApiVersion) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkEnumerateInstanceVersion(addrs, pApiVersion);
+	}
+	VkResult ret = (((PFN_vkEnumerateInstanceVersion)addrs->pvkEnumerateInstanceVersion)(pApiVersion));
+	return ret;
+}
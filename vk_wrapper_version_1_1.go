@@ -0,0 +1,12327 @@
+//go:build !vks_no_version_1_1
+
+package vks
+
+// Bindings of VK_VERSION_1_1, left out by the vks_no_version_1_1 build tag.
+
+//#cgo CFLAGS: -DVKS_ENABLE_VERSION_1_1
+//#include "vk_wrapper.h"
+import "C"
+import (
+	"fmt"
+	"unsafe"
+)
+
+// DescriptorUpdateTemplate is a Handle to a vulkan resource.
+// DescriptorUpdateTemplate is a child of Device.
+//
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDescriptorUpdateTemplate.html
+type DescriptorUpdateTemplate C.VkDescriptorUpdateTemplate
+
+// NullDescriptorUpdateTemplate is a typed Null value for the DescriptorUpdateTemplate type.
+var NullDescriptorUpdateTemplate DescriptorUpdateTemplate
+
+// SamplerYcbcrConversion is a Handle to a vulkan resource.
+// SamplerYcbcrConversion is a child of Device.
+//
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSamplerYcbcrConversion.html
+type SamplerYcbcrConversion C.VkSamplerYcbcrConversion
+
+// NullSamplerYcbcrConversion is a typed Null value for the SamplerYcbcrConversion type.
+var NullSamplerYcbcrConversion SamplerYcbcrConversion
+
+// ExternalSemaphoreHandleTypeFlagBits enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkExternalSemaphoreHandleTypeFlagBits.html
+type ExternalSemaphoreHandleTypeFlagBits uint32
+
+const (
+	VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_OPAQUE_FD_BIT        ExternalSemaphoreHandleTypeFlagBits = (1 << 0)
+	VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_OPAQUE_WIN32_BIT     ExternalSemaphoreHandleTypeFlagBits = (1 << 1)
+	VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_OPAQUE_WIN32_KMT_BIT ExternalSemaphoreHandleTypeFlagBits = (1 << 2)
+	VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_D3D12_FENCE_BIT      ExternalSemaphoreHandleTypeFlagBits = (1 << 3)
+	VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_D3D11_FENCE_BIT      ExternalSemaphoreHandleTypeFlagBits = VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_D3D12_FENCE_BIT
+	VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_SYNC_FD_BIT          ExternalSemaphoreHandleTypeFlagBits = (1 << 4)
+)
+
+const enumNamesExternalSemaphoreHandleTypeFlagBits = "VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_OPAQUE_FD_BIT" +
+	"VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_OPAQUE_WIN32_BIT" +
+	"VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_OPAQUE_WIN32_KMT_BIT" +
+	"VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_D3D12_FENCE_BIT" +
+	"VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_SYNC_FD_BIT"
+
+var enumTableExternalSemaphoreHandleTypeFlagBits = enumTable[ExternalSemaphoreHandleTypeFlagBits, uint16]{
+	first: VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_OPAQUE_FD_BIT,
+	dense: 8,
+	sparse: []ExternalSemaphoreHandleTypeFlagBits{
+		VK_EXTERNAL_SEMAPHORE_HANDLE_TYPE_SYNC_FD_BIT,
+	},
+	names: enumNamesExternalSemaphoreHandleTypeFlagBits,
+	index: []uint16{0, 47, 97, 97, 151, 151, 151, 151, 200, 245},
+}
+
+func (x ExternalSemaphoreHandleTypeFlagBits) String() string {
+	if s, ok := enumTableExternalSemaphoreHandleTypeFlagBits.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("ExternalSemaphoreHandleTypeFlagBits=%d", x)
+}
+
+// SamplerYcbcrRange enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSamplerYcbcrRange.html
+type SamplerYcbcrRange uint32
+
+const (
+	VK_SAMPLER_YCBCR_RANGE_ITU_FULL   SamplerYcbcrRange = 0
+	VK_SAMPLER_YCBCR_RANGE_ITU_NARROW SamplerYcbcrRange = 1
+)
+
+const enumNamesSamplerYcbcrRange = "VK_SAMPLER_YCBCR_RANGE_ITU_FULL" +
+	"VK_SAMPLER_YCBCR_RANGE_ITU_NARROW"
+
+var enumTableSamplerYcbcrRange = enumTable[SamplerYcbcrRange, uint16]{
+	sparse: []SamplerYcbcrRange{
+		VK_SAMPLER_YCBCR_RANGE_ITU_FULL,
+		VK_SAMPLER_YCBCR_RANGE_ITU_NARROW,
+	},
+	names: enumNamesSamplerYcbcrRange,
+	index: []uint16{0, 31, 64},
+}
+
+func (x SamplerYcbcrRange) String() string {
+	if s, ok := enumTableSamplerYcbcrRange.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("SamplerYcbcrRange=%d", x)
+}
+
+// PeerMemoryFeatureFlagBits enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPeerMemoryFeatureFlagBits.html
+type PeerMemoryFeatureFlagBits uint32
+
+const (
+	VK_PEER_MEMORY_FEATURE_COPY_SRC_BIT    PeerMemoryFeatureFlagBits = (1 << 0)
+	VK_PEER_MEMORY_FEATURE_COPY_DST_BIT    PeerMemoryFeatureFlagBits = (1 << 1)
+	VK_PEER_MEMORY_FEATURE_GENERIC_SRC_BIT PeerMemoryFeatureFlagBits = (1 << 2)
+	VK_PEER_MEMORY_FEATURE_GENERIC_DST_BIT PeerMemoryFeatureFlagBits = (1 << 3)
+)
+
+const enumNamesPeerMemoryFeatureFlagBits = "VK_PEER_MEMORY_FEATURE_COPY_SRC_BIT" +
+	"VK_PEER_MEMORY_FEATURE_COPY_DST_BIT" +
+	"VK_PEER_MEMORY_FEATURE_GENERIC_SRC_BIT" +
+	"VK_PEER_MEMORY_FEATURE_GENERIC_DST_BIT"
+
+var enumTablePeerMemoryFeatureFlagBits = enumTable[PeerMemoryFeatureFlagBits, uint16]{
+	first: VK_PEER_MEMORY_FEATURE_COPY_SRC_BIT,
+	dense: 8,
+	names: enumNamesPeerMemoryFeatureFlagBits,
+	index: []uint16{0, 35, 70, 70, 108, 108, 108, 108, 146},
+}
+
+func (x PeerMemoryFeatureFlagBits) String() string {
+	if s, ok := enumTablePeerMemoryFeatureFlagBits.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("PeerMemoryFeatureFlagBits=%d", x)
+}
+
+// ExternalFenceFeatureFlagBits enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkExternalFenceFeatureFlagBits.html
+type ExternalFenceFeatureFlagBits uint32
+
+const (
+	VK_EXTERNAL_FENCE_FEATURE_EXPORTABLE_BIT ExternalFenceFeatureFlagBits = (1 << 0)
+	VK_EXTERNAL_FENCE_FEATURE_IMPORTABLE_BIT ExternalFenceFeatureFlagBits = (1 << 1)
+)
+
+const enumNamesExternalFenceFeatureFlagBits = "VK_EXTERNAL_FENCE_FEATURE_EXPORTABLE_BIT" +
+	"VK_EXTERNAL_FENCE_FEATURE_IMPORTABLE_BIT"
+
+var enumTableExternalFenceFeatureFlagBits = enumTable[ExternalFenceFeatureFlagBits, uint16]{
+	sparse: []ExternalFenceFeatureFlagBits{
+		VK_EXTERNAL_FENCE_FEATURE_EXPORTABLE_BIT,
+		VK_EXTERNAL_FENCE_FEATURE_IMPORTABLE_BIT,
+	},
+	names: enumNamesExternalFenceFeatureFlagBits,
+	index: []uint16{0, 40, 80},
+}
+
+func (x ExternalFenceFeatureFlagBits) String() string {
+	if s, ok := enumTableExternalFenceFeatureFlagBits.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("ExternalFenceFeatureFlagBits=%d", x)
+}
+
+// ExternalSemaphoreFeatureFlagBits enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkExternalSemaphoreFeatureFlagBits.html
+type ExternalSemaphoreFeatureFlagBits uint32
+
+const (
+	VK_EXTERNAL_SEMAPHORE_FEATURE_EXPORTABLE_BIT ExternalSemaphoreFeatureFlagBits = (1 << 0)
+	VK_EXTERNAL_SEMAPHORE_FEATURE_IMPORTABLE_BIT ExternalSemaphoreFeatureFlagBits = (1 << 1)
+)
+
+const enumNamesExternalSemaphoreFeatureFlagBits = "VK_EXTERNAL_SEMAPHORE_FEATURE_EXPORTABLE_BIT" +
+	"VK_EXTERNAL_SEMAPHORE_FEATURE_IMPORTABLE_BIT"
+
+var enumTableExternalSemaphoreFeatureFlagBits = enumTable[ExternalSemaphoreFeatureFlagBits, uint16]{
+	sparse: []ExternalSemaphoreFeatureFlagBits{
+		VK_EXTERNAL_SEMAPHORE_FEATURE_EXPORTABLE_BIT,
+		VK_EXTERNAL_SEMAPHORE_FEATURE_IMPORTABLE_BIT,
+	},
+	names: enumNamesExternalSemaphoreFeatureFlagBits,
+	index: []uint16{0, 44, 88},
+}
+
+func (x ExternalSemaphoreFeatureFlagBits) String() string {
+	if s, ok := enumTableExternalSemaphoreFeatureFlagBits.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("ExternalSemaphoreFeatureFlagBits=%d", x)
+}
+
+// SemaphoreImportFlagBits enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSemaphoreImportFlagBits.html
+type SemaphoreImportFlagBits uint32
+
+const (
+	VK_SEMAPHORE_IMPORT_TEMPORARY_BIT SemaphoreImportFlagBits = (1 << 0)
+)
+
+const enumNamesSemaphoreImportFlagBits = "VK_SEMAPHORE_IMPORT_TEMPORARY_BIT"
+
+var enumTableSemaphoreImportFlagBits = enumTable[SemaphoreImportFlagBits, uint16]{
+	sparse: []SemaphoreImportFlagBits{
+		VK_SEMAPHORE_IMPORT_TEMPORARY_BIT,
+	},
+	names: enumNamesSemaphoreImportFlagBits,
+	index: []uint16{0, 33},
+}
+
+func (x SemaphoreImportFlagBits) String() string {
+	if s, ok := enumTableSemaphoreImportFlagBits.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("SemaphoreImportFlagBits=%d", x)
+}
+
+// PointClippingBehavior enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPointClippingBehavior.html
+type PointClippingBehavior uint32
+
+const (
+	VK_POINT_CLIPPING_BEHAVIOR_ALL_CLIP_PLANES       PointClippingBehavior = 0
+	VK_POINT_CLIPPING_BEHAVIOR_USER_CLIP_PLANES_ONLY PointClippingBehavior = 1
+)
+
+const enumNamesPointClippingBehavior = "VK_POINT_CLIPPING_BEHAVIOR_ALL_CLIP_PLANES" +
+	"VK_POINT_CLIPPING_BEHAVIOR_USER_CLIP_PLANES_ONLY"
+
+var enumTablePointClippingBehavior = enumTable[PointClippingBehavior, uint16]{
+	sparse: []PointClippingBehavior{
+		VK_POINT_CLIPPING_BEHAVIOR_ALL_CLIP_PLANES,
+		VK_POINT_CLIPPING_BEHAVIOR_USER_CLIP_PLANES_ONLY,
+	},
+	names: enumNamesPointClippingBehavior,
+	index: []uint16{0, 42, 90},
+}
+
+func (x PointClippingBehavior) String() string {
+	if s, ok := enumTablePointClippingBehavior.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("PointClippingBehavior=%d", x)
+}
+
+// SamplerYcbcrModelConversion enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSamplerYcbcrModelConversion.html
+type SamplerYcbcrModelConversion uint32
+
+const (
+	VK_SAMPLER_YCBCR_MODEL_CONVERSION_RGB_IDENTITY   SamplerYcbcrModelConversion = 0
+	VK_SAMPLER_YCBCR_MODEL_CONVERSION_YCBCR_IDENTITY SamplerYcbcrModelConversion = 1
+	VK_SAMPLER_YCBCR_MODEL_CONVERSION_YCBCR_709      SamplerYcbcrModelConversion = 2
+	VK_SAMPLER_YCBCR_MODEL_CONVERSION_YCBCR_601      SamplerYcbcrModelConversion = 3
+	VK_SAMPLER_YCBCR_MODEL_CONVERSION_YCBCR_2020     SamplerYcbcrModelConversion = 4
+)
+
+const enumNamesSamplerYcbcrModelConversion = "VK_SAMPLER_YCBCR_MODEL_CONVERSION_RGB_IDENTITY" +
+	"VK_SAMPLER_YCBCR_MODEL_CONVERSION_YCBCR_IDENTITY" +
+	"VK_SAMPLER_YCBCR_MODEL_CONVERSION_YCBCR_709" +
+	"VK_SAMPLER_YCBCR_MODEL_CONVERSION_YCBCR_601" +
+	"VK_SAMPLER_YCBCR_MODEL_CONVERSION_YCBCR_2020"
+
+var enumTableSamplerYcbcrModelConversion = enumTable[SamplerYcbcrModelConversion, uint16]{
+	first: VK_SAMPLER_YCBCR_MODEL_CONVERSION_RGB_IDENTITY,
+	dense: 5,
+	names: enumNamesSamplerYcbcrModelConversion,
+	index: []uint16{0, 46, 94, 137, 180, 224},
+}
+
+func (x SamplerYcbcrModelConversion) String() string {
+	if s, ok := enumTableSamplerYcbcrModelConversion.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("SamplerYcbcrModelConversion=%d", x)
+}
+
+// ExternalFenceHandleTypeFlagBits enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkExternalFenceHandleTypeFlagBits.html
+type ExternalFenceHandleTypeFlagBits uint32
+
+const (
+	VK_EXTERNAL_FENCE_HANDLE_TYPE_OPAQUE_FD_BIT        ExternalFenceHandleTypeFlagBits = (1 << 0)
+	VK_EXTERNAL_FENCE_HANDLE_TYPE_OPAQUE_WIN32_BIT     ExternalFenceHandleTypeFlagBits = (1 << 1)
+	VK_EXTERNAL_FENCE_HANDLE_TYPE_OPAQUE_WIN32_KMT_BIT ExternalFenceHandleTypeFlagBits = (1 << 2)
+	VK_EXTERNAL_FENCE_HANDLE_TYPE_SYNC_FD_BIT          ExternalFenceHandleTypeFlagBits = (1 << 3)
+)
+
+const enumNamesExternalFenceHandleTypeFlagBits = "VK_EXTERNAL_FENCE_HANDLE_TYPE_OPAQUE_FD_BIT" +
+	"VK_EXTERNAL_FENCE_HANDLE_TYPE_OPAQUE_WIN32_BIT" +
+	"VK_EXTERNAL_FENCE_HANDLE_TYPE_OPAQUE_WIN32_KMT_BIT" +
+	"VK_EXTERNAL_FENCE_HANDLE_TYPE_SYNC_FD_BIT"
+
+var enumTableExternalFenceHandleTypeFlagBits = enumTable[ExternalFenceHandleTypeFlagBits, uint16]{
+	first: VK_EXTERNAL_FENCE_HANDLE_TYPE_OPAQUE_FD_BIT,
+	dense: 8,
+	names: enumNamesExternalFenceHandleTypeFlagBits,
+	index: []uint16{0, 43, 89, 89, 139, 139, 139, 139, 180},
+}
+
+func (x ExternalFenceHandleTypeFlagBits) String() string {
+	if s, ok := enumTableExternalFenceHandleTypeFlagBits.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("ExternalFenceHandleTypeFlagBits=%d", x)
+}
+
+// SubgroupFeatureFlagBits enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSubgroupFeatureFlagBits.html
+type SubgroupFeatureFlagBits uint32
+
+const (
+	VK_SUBGROUP_FEATURE_BASIC_BIT            SubgroupFeatureFlagBits = (1 << 0)
+	VK_SUBGROUP_FEATURE_VOTE_BIT             SubgroupFeatureFlagBits = (1 << 1)
+	VK_SUBGROUP_FEATURE_ARITHMETIC_BIT       SubgroupFeatureFlagBits = (1 << 2)
+	VK_SUBGROUP_FEATURE_BALLOT_BIT           SubgroupFeatureFlagBits = (1 << 3)
+	VK_SUBGROUP_FEATURE_SHUFFLE_BIT          SubgroupFeatureFlagBits = (1 << 4)
+	VK_SUBGROUP_FEATURE_SHUFFLE_RELATIVE_BIT SubgroupFeatureFlagBits = (1 << 5)
+	VK_SUBGROUP_FEATURE_CLUSTERED_BIT        SubgroupFeatureFlagBits = (1 << 6)
+	VK_SUBGROUP_FEATURE_QUAD_BIT             SubgroupFeatureFlagBits = (1 << 7)
+)
+
+const enumNamesSubgroupFeatureFlagBits = "VK_SUBGROUP_FEATURE_BASIC_BIT" +
+	"VK_SUBGROUP_FEATURE_VOTE_BIT" +
+	"VK_SUBGROUP_FEATURE_ARITHMETIC_BIT" +
+	"VK_SUBGROUP_FEATURE_BALLOT_BIT" +
+	"VK_SUBGROUP_FEATURE_SHUFFLE_BIT" +
+	"VK_SUBGROUP_FEATURE_SHUFFLE_RELATIVE_BIT" +
+	"VK_SUBGROUP_FEATURE_CLUSTERED_BIT" +
+	"VK_SUBGROUP_FEATURE_QUAD_BIT"
+
+var enumTableSubgroupFeatureFlagBits = enumTable[SubgroupFeatureFlagBits, uint16]{
+	first: VK_SUBGROUP_FEATURE_BASIC_BIT,
+	dense: 8,
+	sparse: []SubgroupFeatureFlagBits{
+		VK_SUBGROUP_FEATURE_SHUFFLE_BIT,
+		VK_SUBGROUP_FEATURE_SHUFFLE_RELATIVE_BIT,
+		VK_SUBGROUP_FEATURE_CLUSTERED_BIT,
+		VK_SUBGROUP_FEATURE_QUAD_BIT,
+	},
+	names: enumNamesSubgroupFeatureFlagBits,
+	index: []uint16{0, 29, 57, 57, 91, 91, 91, 91, 121, 152, 192, 225, 253},
+}
+
+func (x SubgroupFeatureFlagBits) String() string {
+	if s, ok := enumTableSubgroupFeatureFlagBits.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("SubgroupFeatureFlagBits=%d", x)
+}
+
+// ChromaLocation enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkChromaLocation.html
+type ChromaLocation uint32
+
+const (
+	VK_CHROMA_LOCATION_COSITED_EVEN ChromaLocation = 0
+	VK_CHROMA_LOCATION_MIDPOINT     ChromaLocation = 1
+)
+
+const enumNamesChromaLocation = "VK_CHROMA_LOCATION_COSITED_EVEN" +
+	"VK_CHROMA_LOCATION_MIDPOINT"
+
+var enumTableChromaLocation = enumTable[ChromaLocation, uint16]{
+	sparse: []ChromaLocation{
+		VK_CHROMA_LOCATION_COSITED_EVEN,
+		VK_CHROMA_LOCATION_MIDPOINT,
+	},
+	names: enumNamesChromaLocation,
+	index: []uint16{0, 31, 58},
+}
+
+func (x ChromaLocation) String() string {
+	if s, ok := enumTableChromaLocation.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("ChromaLocation=%d", x)
+}
+
+// FenceImportFlagBits enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkFenceImportFlagBits.html
+type FenceImportFlagBits uint32
+
+const (
+	VK_FENCE_IMPORT_TEMPORARY_BIT FenceImportFlagBits = (1 << 0)
+)
+
+const enumNamesFenceImportFlagBits = "VK_FENCE_IMPORT_TEMPORARY_BIT"
+
+var enumTableFenceImportFlagBits = enumTable[FenceImportFlagBits, uint16]{
+	sparse: []FenceImportFlagBits{
+		VK_FENCE_IMPORT_TEMPORARY_BIT,
+	},
+	names: enumNamesFenceImportFlagBits,
+	index: []uint16{0, 29},
+}
+
+func (x FenceImportFlagBits) String() string {
+	if s, ok := enumTableFenceImportFlagBits.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("FenceImportFlagBits=%d", x)
+}
+
+// TessellationDomainOrigin enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkTessellationDomainOrigin.html
+type TessellationDomainOrigin uint32
+
+const (
+	VK_TESSELLATION_DOMAIN_ORIGIN_UPPER_LEFT TessellationDomainOrigin = 0
+	VK_TESSELLATION_DOMAIN_ORIGIN_LOWER_LEFT TessellationDomainOrigin = 1
+)
+
+const enumNamesTessellationDomainOrigin = "VK_TESSELLATION_DOMAIN_ORIGIN_UPPER_LEFT" +
+	"VK_TESSELLATION_DOMAIN_ORIGIN_LOWER_LEFT"
+
+var enumTableTessellationDomainOrigin = enumTable[TessellationDomainOrigin, uint16]{
+	sparse: []TessellationDomainOrigin{
+		VK_TESSELLATION_DOMAIN_ORIGIN_UPPER_LEFT,
+		VK_TESSELLATION_DOMAIN_ORIGIN_LOWER_LEFT,
+	},
+	names: enumNamesTessellationDomainOrigin,
+	index: []uint16{0, 40, 80},
+}
+
+func (x TessellationDomainOrigin) String() string {
+	if s, ok := enumTableTessellationDomainOrigin.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("TessellationDomainOrigin=%d", x)
+}
+
+// DescriptorUpdateTemplateType enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDescriptorUpdateTemplateType.html
+type DescriptorUpdateTemplateType uint32
+
+const (
+	VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET DescriptorUpdateTemplateType = 0
+)
+
+const enumNamesDescriptorUpdateTemplateType = "VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET"
+
+var enumTableDescriptorUpdateTemplateType = enumTable[DescriptorUpdateTemplateType, uint16]{
+	sparse: []DescriptorUpdateTemplateType{
+		VK_DESCRIPTOR_UPDATE_TEMPLATE_TYPE_DESCRIPTOR_SET,
+	},
+	names: enumNamesDescriptorUpdateTemplateType,
+	index: []uint16{0, 49},
+}
+
+func (x DescriptorUpdateTemplateType) String() string {
+	if s, ok := enumTableDescriptorUpdateTemplateType.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("DescriptorUpdateTemplateType=%d", x)
+}
+
+// ExternalMemoryHandleTypeFlagBits enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkExternalMemoryHandleTypeFlagBits.html
+type ExternalMemoryHandleTypeFlagBits uint32
+
+const (
+	VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT         ExternalMemoryHandleTypeFlagBits = (1 << 0)
+	VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_WIN32_BIT      ExternalMemoryHandleTypeFlagBits = (1 << 1)
+	VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_WIN32_KMT_BIT  ExternalMemoryHandleTypeFlagBits = (1 << 2)
+	VK_EXTERNAL_MEMORY_HANDLE_TYPE_D3D11_TEXTURE_BIT     ExternalMemoryHandleTypeFlagBits = (1 << 3)
+	VK_EXTERNAL_MEMORY_HANDLE_TYPE_D3D11_TEXTURE_KMT_BIT ExternalMemoryHandleTypeFlagBits = (1 << 4)
+	VK_EXTERNAL_MEMORY_HANDLE_TYPE_D3D12_HEAP_BIT        ExternalMemoryHandleTypeFlagBits = (1 << 5)
+	VK_EXTERNAL_MEMORY_HANDLE_TYPE_D3D12_RESOURCE_BIT    ExternalMemoryHandleTypeFlagBits = (1 << 6)
+)
+
+const enumNamesExternalMemoryHandleTypeFlagBits = "VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT" +
+	"VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_WIN32_BIT" +
+	"VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_WIN32_KMT_BIT" +
+	"VK_EXTERNAL_MEMORY_HANDLE_TYPE_D3D11_TEXTURE_BIT" +
+	"VK_EXTERNAL_MEMORY_HANDLE_TYPE_D3D11_TEXTURE_KMT_BIT" +
+	"VK_EXTERNAL_MEMORY_HANDLE_TYPE_D3D12_HEAP_BIT" +
+	"VK_EXTERNAL_MEMORY_HANDLE_TYPE_D3D12_RESOURCE_BIT"
+
+var enumTableExternalMemoryHandleTypeFlagBits = enumTable[ExternalMemoryHandleTypeFlagBits, uint16]{
+	first: VK_EXTERNAL_MEMORY_HANDLE_TYPE_OPAQUE_FD_BIT,
+	dense: 8,
+	sparse: []ExternalMemoryHandleTypeFlagBits{
+		VK_EXTERNAL_MEMORY_HANDLE_TYPE_D3D11_TEXTURE_KMT_BIT,
+		VK_EXTERNAL_MEMORY_HANDLE_TYPE_D3D12_HEAP_BIT,
+		VK_EXTERNAL_MEMORY_HANDLE_TYPE_D3D12_RESOURCE_BIT,
+	},
+	names: enumNamesExternalMemoryHandleTypeFlagBits,
+	index: []uint16{0, 44, 91, 91, 142, 142, 142, 142, 190, 242, 287, 336},
+}
+
+func (x ExternalMemoryHandleTypeFlagBits) String() string {
+	if s, ok := enumTableExternalMemoryHandleTypeFlagBits.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("ExternalMemoryHandleTypeFlagBits=%d", x)
+}
+
+// ExternalMemoryFeatureFlagBits enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkExternalMemoryFeatureFlagBits.html
+type ExternalMemoryFeatureFlagBits uint32
+
+const (
+	VK_EXTERNAL_MEMORY_FEATURE_DEDICATED_ONLY_BIT ExternalMemoryFeatureFlagBits = (1 << 0)
+	VK_EXTERNAL_MEMORY_FEATURE_EXPORTABLE_BIT     ExternalMemoryFeatureFlagBits = (1 << 1)
+	VK_EXTERNAL_MEMORY_FEATURE_IMPORTABLE_BIT     ExternalMemoryFeatureFlagBits = (1 << 2)
+)
+
+const enumNamesExternalMemoryFeatureFlagBits = "VK_EXTERNAL_MEMORY_FEATURE_DEDICATED_ONLY_BIT" +
+	"VK_EXTERNAL_MEMORY_FEATURE_EXPORTABLE_BIT" +
+	"VK_EXTERNAL_MEMORY_FEATURE_IMPORTABLE_BIT"
+
+var enumTableExternalMemoryFeatureFlagBits = enumTable[ExternalMemoryFeatureFlagBits, uint16]{
+	sparse: []ExternalMemoryFeatureFlagBits{
+		VK_EXTERNAL_MEMORY_FEATURE_DEDICATED_ONLY_BIT,
+		VK_EXTERNAL_MEMORY_FEATURE_EXPORTABLE_BIT,
+		VK_EXTERNAL_MEMORY_FEATURE_IMPORTABLE_BIT,
+	},
+	names: enumNamesExternalMemoryFeatureFlagBits,
+	index: []uint16{0, 45, 86, 127},
+}
+
+func (x ExternalMemoryFeatureFlagBits) String() string {
+	if s, ok := enumTableExternalMemoryFeatureFlagBits.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("ExternalMemoryFeatureFlagBits=%d", x)
+}
+
+// MemoryAllocateFlagBits enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkMemoryAllocateFlagBits.html
+type MemoryAllocateFlagBits uint32
+
+const (
+	VK_MEMORY_ALLOCATE_DEVICE_MASK_BIT                   MemoryAllocateFlagBits = (1 << 0)
+	VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT                MemoryAllocateFlagBits = (1 << 1)
+	VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_CAPTURE_REPLAY_BIT MemoryAllocateFlagBits = (1 << 2)
+)
+
+const enumNamesMemoryAllocateFlagBits = "VK_MEMORY_ALLOCATE_DEVICE_MASK_BIT" +
+	"VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT" +
+	"VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_CAPTURE_REPLAY_BIT"
+
+var enumTableMemoryAllocateFlagBits = enumTable[MemoryAllocateFlagBits, uint16]{
+	sparse: []MemoryAllocateFlagBits{
+		VK_MEMORY_ALLOCATE_DEVICE_MASK_BIT,
+		VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_BIT,
+		VK_MEMORY_ALLOCATE_DEVICE_ADDRESS_CAPTURE_REPLAY_BIT,
+	},
+	names: enumNamesMemoryAllocateFlagBits,
+	index: []uint16{0, 34, 71, 123},
+}
+
+func (x MemoryAllocateFlagBits) String() string {
+	if s, ok := enumTableMemoryAllocateFlagBits.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("MemoryAllocateFlagBits=%d", x)
+}
+
+// MemoryAllocateFlags bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkMemoryAllocateFlags.html
+type MemoryAllocateFlags Flags
+
+// Bits appends the MemoryAllocateFlagBits set in x to dst, lowest first.
+func (x MemoryAllocateFlags) Bits(dst []MemoryAllocateFlagBits) []MemoryAllocateFlagBits {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x MemoryAllocateFlags) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableMemoryAllocateFlagBits)
+}
+
+func (x MemoryAllocateFlags) String() string {
+	return flagsString(x, &enumTableMemoryAllocateFlagBits)
+}
+
+// ParseMemoryAllocateFlags parses the names of MemoryAllocateFlagBits values, or numbers,
+// separated by |.
+func ParseMemoryAllocateFlags(s string) (MemoryAllocateFlags, error) {
+	x, err := parseFlags(s, &enumTableMemoryAllocateFlagBits)
+	return MemoryAllocateFlags(x), err
+}
+
+// ExternalMemoryFeatureFlags bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkExternalMemoryFeatureFlags.html
+type ExternalMemoryFeatureFlags Flags
+
+// Bits appends the ExternalMemoryFeatureFlagBits set in x to dst, lowest first.
+func (x ExternalMemoryFeatureFlags) Bits(dst []ExternalMemoryFeatureFlagBits) []ExternalMemoryFeatureFlagBits {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x ExternalMemoryFeatureFlags) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableExternalMemoryFeatureFlagBits)
+}
+
+func (x ExternalMemoryFeatureFlags) String() string {
+	return flagsString(x, &enumTableExternalMemoryFeatureFlagBits)
+}
+
+// ParseExternalMemoryFeatureFlags parses the names of ExternalMemoryFeatureFlagBits values, or numbers,
+// separated by |.
+func ParseExternalMemoryFeatureFlags(s string) (ExternalMemoryFeatureFlags, error) {
+	x, err := parseFlags(s, &enumTableExternalMemoryFeatureFlagBits)
+	return ExternalMemoryFeatureFlags(x), err
+}
+
+// PeerMemoryFeatureFlags bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPeerMemoryFeatureFlags.html
+type PeerMemoryFeatureFlags Flags
+
+// Bits appends the PeerMemoryFeatureFlagBits set in x to dst, lowest first.
+func (x PeerMemoryFeatureFlags) Bits(dst []PeerMemoryFeatureFlagBits) []PeerMemoryFeatureFlagBits {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x PeerMemoryFeatureFlags) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTablePeerMemoryFeatureFlagBits)
+}
+
+func (x PeerMemoryFeatureFlags) String() string {
+	return flagsString(x, &enumTablePeerMemoryFeatureFlagBits)
+}
+
+// ParsePeerMemoryFeatureFlags parses the names of PeerMemoryFeatureFlagBits values, or numbers,
+// separated by |.
+func ParsePeerMemoryFeatureFlags(s string) (PeerMemoryFeatureFlags, error) {
+	x, err := parseFlags(s, &enumTablePeerMemoryFeatureFlagBits)
+	return PeerMemoryFeatureFlags(x), err
+}
+
+// CommandPoolTrimFlags bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkCommandPoolTrimFlags.html
+type CommandPoolTrimFlags Flags
+
+// SubgroupFeatureFlags bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSubgroupFeatureFlags.html
+type SubgroupFeatureFlags Flags
+
+// Bits appends the SubgroupFeatureFlagBits set in x to dst, lowest first.
+func (x SubgroupFeatureFlags) Bits(dst []SubgroupFeatureFlagBits) []SubgroupFeatureFlagBits {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x SubgroupFeatureFlags) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableSubgroupFeatureFlagBits)
+}
+
+func (x SubgroupFeatureFlags) String() string {
+	return flagsString(x, &enumTableSubgroupFeatureFlagBits)
+}
+
+// ParseSubgroupFeatureFlags parses the names of SubgroupFeatureFlagBits values, or numbers,
+// separated by |.
+func ParseSubgroupFeatureFlags(s string) (SubgroupFeatureFlags, error) {
+	x, err := parseFlags(s, &enumTableSubgroupFeatureFlagBits)
+	return SubgroupFeatureFlags(x), err
+}
+
+// SemaphoreImportFlags bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSemaphoreImportFlags.html
+type SemaphoreImportFlags Flags
+
+// Bits appends the SemaphoreImportFlagBits set in x to dst, lowest first.
+func (x SemaphoreImportFlags) Bits(dst []SemaphoreImportFlagBits) []SemaphoreImportFlagBits {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x SemaphoreImportFlags) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableSemaphoreImportFlagBits)
+}
+
+func (x SemaphoreImportFlags) String() string {
+	return flagsString(x, &enumTableSemaphoreImportFlagBits)
+}
+
+// ParseSemaphoreImportFlags parses the names of SemaphoreImportFlagBits values, or numbers,
+// separated by |.
+func ParseSemaphoreImportFlags(s string) (SemaphoreImportFlags, error) {
+	x, err := parseFlags(s, &enumTableSemaphoreImportFlagBits)
+	return SemaphoreImportFlags(x), err
+}
+
+// ExternalSemaphoreHandleTypeFlags bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkExternalSemaphoreHandleTypeFlags.html
+type ExternalSemaphoreHandleTypeFlags Flags
+
+// Bits appends the ExternalSemaphoreHandleTypeFlagBits set in x to dst, lowest first.
+func (x ExternalSemaphoreHandleTypeFlags) Bits(dst []ExternalSemaphoreHandleTypeFlagBits) []ExternalSemaphoreHandleTypeFlagBits {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x ExternalSemaphoreHandleTypeFlags) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableExternalSemaphoreHandleTypeFlagBits)
+}
+
+func (x ExternalSemaphoreHandleTypeFlags) String() string {
+	return flagsString(x, &enumTableExternalSemaphoreHandleTypeFlagBits)
+}
+
+// ParseExternalSemaphoreHandleTypeFlags parses the names of ExternalSemaphoreHandleTypeFlagBits values, or numbers,
+// separated by |.
+func ParseExternalSemaphoreHandleTypeFlags(s string) (ExternalSemaphoreHandleTypeFlags, error) {
+	x, err := parseFlags(s, &enumTableExternalSemaphoreHandleTypeFlagBits)
+	return ExternalSemaphoreHandleTypeFlags(x), err
+}
+
+// ExternalSemaphoreFeatureFlags bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkExternalSemaphoreFeatureFlags.html
+type ExternalSemaphoreFeatureFlags Flags
+
+// Bits appends the ExternalSemaphoreFeatureFlagBits set in x to dst, lowest first.
+func (x ExternalSemaphoreFeatureFlags) Bits(dst []ExternalSemaphoreFeatureFlagBits) []ExternalSemaphoreFeatureFlagBits {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x ExternalSemaphoreFeatureFlags) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableExternalSemaphoreFeatureFlagBits)
+}
+
+func (x ExternalSemaphoreFeatureFlags) String() string {
+	return flagsString(x, &enumTableExternalSemaphoreFeatureFlagBits)
+}
+
+// ParseExternalSemaphoreFeatureFlags parses the names of ExternalSemaphoreFeatureFlagBits values, or numbers,
+// separated by |.
+func ParseExternalSemaphoreFeatureFlags(s string) (ExternalSemaphoreFeatureFlags, error) {
+	x, err := parseFlags(s, &enumTableExternalSemaphoreFeatureFlagBits)
+	return ExternalSemaphoreFeatureFlags(x), err
+}
+
+// ExternalFenceFeatureFlags bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkExternalFenceFeatureFlags.html
+type ExternalFenceFeatureFlags Flags
+
+// Bits appends the ExternalFenceFeatureFlagBits set in x to dst, lowest first.
+func (x ExternalFenceFeatureFlags) Bits(dst []ExternalFenceFeatureFlagBits) []ExternalFenceFeatureFlagBits {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x ExternalFenceFeatureFlags) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableExternalFenceFeatureFlagBits)
+}
+
+func (x ExternalFenceFeatureFlags) String() string {
+	return flagsString(x, &enumTableExternalFenceFeatureFlagBits)
+}
+
+// ParseExternalFenceFeatureFlags parses the names of ExternalFenceFeatureFlagBits values, or numbers,
+// separated by |.
+func ParseExternalFenceFeatureFlags(s string) (ExternalFenceFeatureFlags, error) {
+	x, err := parseFlags(s, &enumTableExternalFenceFeatureFlagBits)
+	return ExternalFenceFeatureFlags(x), err
+}
+
+// ExternalFenceHandleTypeFlags bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkExternalFenceHandleTypeFlags.html
+type ExternalFenceHandleTypeFlags Flags
+
+// Bits appends the ExternalFenceHandleTypeFlagBits set in x to dst, lowest first.
+func (x ExternalFenceHandleTypeFlags) Bits(dst []ExternalFenceHandleTypeFlagBits) []ExternalFenceHandleTypeFlagBits {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x ExternalFenceHandleTypeFlags) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableExternalFenceHandleTypeFlagBits)
+}
+
+func (x ExternalFenceHandleTypeFlags) String() string {
+	return flagsString(x, &enumTableExternalFenceHandleTypeFlagBits)
+}
+
+// ParseExternalFenceHandleTypeFlags parses the names of ExternalFenceHandleTypeFlagBits values, or numbers,
+// separated by |.
+func ParseExternalFenceHandleTypeFlags(s string) (ExternalFenceHandleTypeFlags, error) {
+	x, err := parseFlags(s, &enumTableExternalFenceHandleTypeFlagBits)
+	return ExternalFenceHandleTypeFlags(x), err
+}
+
+// DescriptorUpdateTemplateCreateFlags bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDescriptorUpdateTemplateCreateFlags.html
+type DescriptorUpdateTemplateCreateFlags Flags
+
+// FenceImportFlags bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkFenceImportFlags.html
+type FenceImportFlags Flags
+
+// Bits appends the FenceImportFlagBits set in x to dst, lowest first.
+func (x FenceImportFlags) Bits(dst []FenceImportFlagBits) []FenceImportFlagBits {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x FenceImportFlags) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableFenceImportFlagBits)
+}
+
+func (x FenceImportFlags) String() string {
+	return flagsString(x, &enumTableFenceImportFlagBits)
+}
+
+// ParseFenceImportFlags parses the names of FenceImportFlagBits values, or numbers,
+// separated by |.
+func ParseFenceImportFlags(s string) (FenceImportFlags, error) {
+	x, err := parseFlags(s, &enumTableFenceImportFlagBits)
+	return FenceImportFlags(x), err
+}
+
+// ExternalMemoryHandleTypeFlags bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkExternalMemoryHandleTypeFlags.html
+type ExternalMemoryHandleTypeFlags Flags
+
+// Bits appends the ExternalMemoryHandleTypeFlagBits set in x to dst, lowest first.
+func (x ExternalMemoryHandleTypeFlags) Bits(dst []ExternalMemoryHandleTypeFlagBits) []ExternalMemoryHandleTypeFlagBits {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x ExternalMemoryHandleTypeFlags) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableExternalMemoryHandleTypeFlagBits)
+}
+
+func (x ExternalMemoryHandleTypeFlags) String() string {
+	return flagsString(x, &enumTableExternalMemoryHandleTypeFlagBits)
+}
+
+// ParseExternalMemoryHandleTypeFlags parses the names of ExternalMemoryHandleTypeFlagBits values, or numbers,
+// separated by |.
+func ParseExternalMemoryHandleTypeFlags(s string) (ExternalMemoryHandleTypeFlags, error) {
+	x, err := parseFlags(s, &enumTableExternalMemoryHandleTypeFlagBits)
+	return ExternalMemoryHandleTypeFlags(x), err
+}
+
+// SamplerYcbcrConversionImageFormatProperties provides a go interface for VkSamplerYcbcrConversionImageFormatProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSamplerYcbcrConversionImageFormatProperties.html
+type SamplerYcbcrConversionImageFormatProperties C.struct_VkSamplerYcbcrConversionImageFormatProperties
+
+// SizeofSamplerYcbcrConversionImageFormatProperties is the memory size of a SamplerYcbcrConversionImageFormatProperties
+var SizeofSamplerYcbcrConversionImageFormatProperties int = int(unsafe.Sizeof(SamplerYcbcrConversionImageFormatProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SamplerYcbcrConversionImageFormatProperties) ArpPtr(arp *AutoReleasePool) *SamplerYcbcrConversionImageFormatProperties {
+	ptr := newCBlock(cULong(SizeofSamplerYcbcrConversionImageFormatProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SamplerYcbcrConversionImageFormatProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SamplerYcbcrConversionImageFormatProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SamplerYcbcrConversionImageFormatProperties) AsCPtr() *SamplerYcbcrConversionImageFormatProperties {
+	clone := (*SamplerYcbcrConversionImageFormatProperties)(newCBlock(cULong(SizeofSamplerYcbcrConversionImageFormatProperties)))
+	*clone = x
+	return clone
+}
+
+// SamplerYcbcrConversionImageFormatPropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SamplerYcbcrConversionImageFormatPropertiesCSlice(arp *AutoReleasePool, x ...SamplerYcbcrConversionImageFormatProperties) []SamplerYcbcrConversionImageFormatProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSamplerYcbcrConversionImageFormatProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SamplerYcbcrConversionImageFormatProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SamplerYcbcrConversionImageFormatPropertiesFreeCSlice releases the memory allocated by SamplerYcbcrConversionImageFormatPropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func SamplerYcbcrConversionImageFormatPropertiesFreeCSlice(x []SamplerYcbcrConversionImageFormatProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SamplerYcbcrConversionImageFormatPropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SamplerYcbcrConversionImageFormatPropertiesFreeCSlice must be called on the returned slice.
+func SamplerYcbcrConversionImageFormatPropertiesMakeCSlice(x ...SamplerYcbcrConversionImageFormatProperties) []SamplerYcbcrConversionImageFormatProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSamplerYcbcrConversionImageFormatProperties * len(x)
+	dst := unsafe.Slice((*SamplerYcbcrConversionImageFormatProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkSamplerYcbcrConversionImageFormatProperties
+func (x SamplerYcbcrConversionImageFormatProperties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new SamplerYcbcrConversionImageFormatProperties with the value of
+// SType to the value provided in the specification.
+func (x SamplerYcbcrConversionImageFormatProperties) WithDefaultSType() SamplerYcbcrConversionImageFormatProperties {
+	return x.WithSType(VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_FORMAT_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *SamplerYcbcrConversionImageFormatProperties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_FORMAT_PROPERTIES)
+}
+
+// WithSType clones a new SamplerYcbcrConversionImageFormatProperties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SamplerYcbcrConversionImageFormatProperties) WithSType(y StructureType) SamplerYcbcrConversionImageFormatProperties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *SamplerYcbcrConversionImageFormatProperties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkSamplerYcbcrConversionImageFormatProperties
+func (x SamplerYcbcrConversionImageFormatProperties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new SamplerYcbcrConversionImageFormatProperties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SamplerYcbcrConversionImageFormatProperties) WithPNext(y unsafe.Pointer) SamplerYcbcrConversionImageFormatProperties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *SamplerYcbcrConversionImageFormatProperties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SamplerYcbcrConversionImageFormatProperties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// CombinedImageSamplerDescriptorCount returns the value of combinedImageSamplerDescriptorCount from VkSamplerYcbcrConversionImageFormatProperties
+func (x SamplerYcbcrConversionImageFormatProperties) CombinedImageSamplerDescriptorCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.combinedImageSamplerDescriptorCount)
+	return *ptr
+}
+
+// PhysicalDeviceShaderDrawParametersFeatures provides a go interface for VkPhysicalDeviceShaderDrawParametersFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceShaderDrawParametersFeatures.html
+type PhysicalDeviceShaderDrawParametersFeatures C.struct_VkPhysicalDeviceShaderDrawParametersFeatures
+
+// SizeofPhysicalDeviceShaderDrawParametersFeatures is the memory size of a PhysicalDeviceShaderDrawParametersFeatures
+var SizeofPhysicalDeviceShaderDrawParametersFeatures int = int(unsafe.Sizeof(PhysicalDeviceShaderDrawParametersFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceShaderDrawParametersFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceShaderDrawParametersFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceShaderDrawParametersFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceShaderDrawParametersFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceShaderDrawParametersFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceShaderDrawParametersFeatures) AsCPtr() *PhysicalDeviceShaderDrawParametersFeatures {
+	clone := (*PhysicalDeviceShaderDrawParametersFeatures)(newCBlock(cULong(SizeofPhysicalDeviceShaderDrawParametersFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceShaderDrawParametersFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceShaderDrawParametersFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceShaderDrawParametersFeatures) []PhysicalDeviceShaderDrawParametersFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceShaderDrawParametersFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceShaderDrawParametersFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceShaderDrawParametersFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceShaderDrawParametersFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceShaderDrawParametersFeaturesFreeCSlice(x []PhysicalDeviceShaderDrawParametersFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceShaderDrawParametersFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceShaderDrawParametersFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceShaderDrawParametersFeaturesMakeCSlice(x ...PhysicalDeviceShaderDrawParametersFeatures) []PhysicalDeviceShaderDrawParametersFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceShaderDrawParametersFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceShaderDrawParametersFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceShaderDrawParametersFeatures
+func (x PhysicalDeviceShaderDrawParametersFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceShaderDrawParametersFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceShaderDrawParametersFeatures) WithDefaultSType() PhysicalDeviceShaderDrawParametersFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceShaderDrawParametersFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceShaderDrawParametersFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderDrawParametersFeatures) WithSType(y StructureType) PhysicalDeviceShaderDrawParametersFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderDrawParametersFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceShaderDrawParametersFeatures
+func (x PhysicalDeviceShaderDrawParametersFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceShaderDrawParametersFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderDrawParametersFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceShaderDrawParametersFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderDrawParametersFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceShaderDrawParametersFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ShaderDrawParameters returns the value of shaderDrawParameters from VkPhysicalDeviceShaderDrawParametersFeatures
+func (x PhysicalDeviceShaderDrawParametersFeatures) ShaderDrawParameters() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderDrawParameters)
+	return *ptr
+}
+
+// WithShaderDrawParameters clones a new PhysicalDeviceShaderDrawParametersFeatures with the value of
+// ShaderDrawParameters updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderDrawParametersFeatures) WithShaderDrawParameters(y Bool32) PhysicalDeviceShaderDrawParametersFeatures {
+	x.shaderDrawParameters = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderDrawParametersFeatures) SetShaderDrawParameters(y Bool32) {
+	x.shaderDrawParameters = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ExternalMemoryProperties provides a go interface for VkExternalMemoryProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkExternalMemoryProperties.html
+type ExternalMemoryProperties C.struct_VkExternalMemoryProperties
+
+// SizeofExternalMemoryProperties is the memory size of a ExternalMemoryProperties
+var SizeofExternalMemoryProperties int = int(unsafe.Sizeof(ExternalMemoryProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ExternalMemoryProperties) ArpPtr(arp *AutoReleasePool) *ExternalMemoryProperties {
+	ptr := newCBlock(cULong(SizeofExternalMemoryProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ExternalMemoryProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ExternalMemoryProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ExternalMemoryProperties) AsCPtr() *ExternalMemoryProperties {
+	clone := (*ExternalMemoryProperties)(newCBlock(cULong(SizeofExternalMemoryProperties)))
+	*clone = x
+	return clone
+}
+
+// ExternalMemoryPropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ExternalMemoryPropertiesCSlice(arp *AutoReleasePool, x ...ExternalMemoryProperties) []ExternalMemoryProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofExternalMemoryProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ExternalMemoryProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ExternalMemoryPropertiesFreeCSlice releases the memory allocated by ExternalMemoryPropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func ExternalMemoryPropertiesFreeCSlice(x []ExternalMemoryProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ExternalMemoryPropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ExternalMemoryPropertiesFreeCSlice must be called on the returned slice.
+func ExternalMemoryPropertiesMakeCSlice(x ...ExternalMemoryProperties) []ExternalMemoryProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofExternalMemoryProperties * len(x)
+	dst := unsafe.Slice((*ExternalMemoryProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ExternalMemoryFeatures returns the value of externalMemoryFeatures from VkExternalMemoryProperties
+func (x ExternalMemoryProperties) ExternalMemoryFeatures() ExternalMemoryFeatureFlags {
+	ptr := /* typedef */ (*ExternalMemoryFeatureFlags)(&x.externalMemoryFeatures)
+	return *ptr
+}
+
+// ExportFromImportedHandleTypes returns the value of exportFromImportedHandleTypes from VkExternalMemoryProperties
+func (x ExternalMemoryProperties) ExportFromImportedHandleTypes() ExternalMemoryHandleTypeFlags {
+	ptr := /* typedef */ (*ExternalMemoryHandleTypeFlags)(&x.exportFromImportedHandleTypes)
+	return *ptr
+}
+
+// CompatibleHandleTypes returns the value of compatibleHandleTypes from VkExternalMemoryProperties
+func (x ExternalMemoryProperties) CompatibleHandleTypes() ExternalMemoryHandleTypeFlags {
+	ptr := /* typedef */ (*ExternalMemoryHandleTypeFlags)(&x.compatibleHandleTypes)
+	return *ptr
+}
+
+// ExternalMemoryBufferCreateInfo provides a go interface for VkExternalMemoryBufferCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkExternalMemoryBufferCreateInfo.html
+type ExternalMemoryBufferCreateInfo C.struct_VkExternalMemoryBufferCreateInfo
+
+// SizeofExternalMemoryBufferCreateInfo is the memory size of a ExternalMemoryBufferCreateInfo
+var SizeofExternalMemoryBufferCreateInfo int = int(unsafe.Sizeof(ExternalMemoryBufferCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ExternalMemoryBufferCreateInfo) ArpPtr(arp *AutoReleasePool) *ExternalMemoryBufferCreateInfo {
+	ptr := newCBlock(cULong(SizeofExternalMemoryBufferCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ExternalMemoryBufferCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ExternalMemoryBufferCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ExternalMemoryBufferCreateInfo) AsCPtr() *ExternalMemoryBufferCreateInfo {
+	clone := (*ExternalMemoryBufferCreateInfo)(newCBlock(cULong(SizeofExternalMemoryBufferCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// ExternalMemoryBufferCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ExternalMemoryBufferCreateInfoCSlice(arp *AutoReleasePool, x ...ExternalMemoryBufferCreateInfo) []ExternalMemoryBufferCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofExternalMemoryBufferCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ExternalMemoryBufferCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ExternalMemoryBufferCreateInfoFreeCSlice releases the memory allocated by ExternalMemoryBufferCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func ExternalMemoryBufferCreateInfoFreeCSlice(x []ExternalMemoryBufferCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ExternalMemoryBufferCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ExternalMemoryBufferCreateInfoFreeCSlice must be called on the returned slice.
+func ExternalMemoryBufferCreateInfoMakeCSlice(x ...ExternalMemoryBufferCreateInfo) []ExternalMemoryBufferCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofExternalMemoryBufferCreateInfo * len(x)
+	dst := unsafe.Slice((*ExternalMemoryBufferCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkExternalMemoryBufferCreateInfo
+func (x ExternalMemoryBufferCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ExternalMemoryBufferCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x ExternalMemoryBufferCreateInfo) WithDefaultSType() ExternalMemoryBufferCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ExternalMemoryBufferCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO)
+}
+
+// WithSType clones a new ExternalMemoryBufferCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExternalMemoryBufferCreateInfo) WithSType(y StructureType) ExternalMemoryBufferCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ExternalMemoryBufferCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkExternalMemoryBufferCreateInfo
+func (x ExternalMemoryBufferCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ExternalMemoryBufferCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExternalMemoryBufferCreateInfo) WithPNext(y unsafe.Pointer) ExternalMemoryBufferCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ExternalMemoryBufferCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ExternalMemoryBufferCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// HandleTypes returns the value of handleTypes from VkExternalMemoryBufferCreateInfo
+func (x ExternalMemoryBufferCreateInfo) HandleTypes() ExternalMemoryHandleTypeFlags {
+	ptr := /* typedef */ (*ExternalMemoryHandleTypeFlags)(&x.handleTypes)
+	return *ptr
+}
+
+// WithHandleTypes clones a new ExternalMemoryBufferCreateInfo with the value of
+// HandleTypes updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExternalMemoryBufferCreateInfo) WithHandleTypes(y ExternalMemoryHandleTypeFlags) ExternalMemoryBufferCreateInfo {
+	x.handleTypes = *( /* typedef */ (*C.VkExternalMemoryHandleTypeFlags)(&y))
+	return x
+}
+func (x *ExternalMemoryBufferCreateInfo) SetHandleTypes(y ExternalMemoryHandleTypeFlags) {
+	x.handleTypes = *( /* typedef */ (*C.VkExternalMemoryHandleTypeFlags)(&y))
+}
+
+// PhysicalDeviceExternalImageFormatInfo provides a go interface for VkPhysicalDeviceExternalImageFormatInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceExternalImageFormatInfo.html
+type PhysicalDeviceExternalImageFormatInfo C.struct_VkPhysicalDeviceExternalImageFormatInfo
+
+// SizeofPhysicalDeviceExternalImageFormatInfo is the memory size of a PhysicalDeviceExternalImageFormatInfo
+var SizeofPhysicalDeviceExternalImageFormatInfo int = int(unsafe.Sizeof(PhysicalDeviceExternalImageFormatInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceExternalImageFormatInfo) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceExternalImageFormatInfo {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceExternalImageFormatInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceExternalImageFormatInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceExternalImageFormatInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceExternalImageFormatInfo) AsCPtr() *PhysicalDeviceExternalImageFormatInfo {
+	clone := (*PhysicalDeviceExternalImageFormatInfo)(newCBlock(cULong(SizeofPhysicalDeviceExternalImageFormatInfo)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceExternalImageFormatInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceExternalImageFormatInfoCSlice(arp *AutoReleasePool, x ...PhysicalDeviceExternalImageFormatInfo) []PhysicalDeviceExternalImageFormatInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceExternalImageFormatInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceExternalImageFormatInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceExternalImageFormatInfoFreeCSlice releases the memory allocated by PhysicalDeviceExternalImageFormatInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceExternalImageFormatInfoFreeCSlice(x []PhysicalDeviceExternalImageFormatInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceExternalImageFormatInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceExternalImageFormatInfoFreeCSlice must be called on the returned slice.
+func PhysicalDeviceExternalImageFormatInfoMakeCSlice(x ...PhysicalDeviceExternalImageFormatInfo) []PhysicalDeviceExternalImageFormatInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceExternalImageFormatInfo * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceExternalImageFormatInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceExternalImageFormatInfo
+func (x PhysicalDeviceExternalImageFormatInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceExternalImageFormatInfo with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceExternalImageFormatInfo) WithDefaultSType() PhysicalDeviceExternalImageFormatInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceExternalImageFormatInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO)
+}
+
+// WithSType clones a new PhysicalDeviceExternalImageFormatInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceExternalImageFormatInfo) WithSType(y StructureType) PhysicalDeviceExternalImageFormatInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceExternalImageFormatInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceExternalImageFormatInfo
+func (x PhysicalDeviceExternalImageFormatInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceExternalImageFormatInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceExternalImageFormatInfo) WithPNext(y unsafe.Pointer) PhysicalDeviceExternalImageFormatInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceExternalImageFormatInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceExternalImageFormatInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// HandleType returns the value of handleType from VkPhysicalDeviceExternalImageFormatInfo
+func (x PhysicalDeviceExternalImageFormatInfo) HandleType() ExternalMemoryHandleTypeFlagBits {
+	ptr := /* typedef */ (*ExternalMemoryHandleTypeFlagBits)(&x.handleType)
+	return *ptr
+}
+
+// WithHandleType clones a new PhysicalDeviceExternalImageFormatInfo with the value of
+// HandleType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceExternalImageFormatInfo) WithHandleType(y ExternalMemoryHandleTypeFlagBits) PhysicalDeviceExternalImageFormatInfo {
+	x.handleType = *( /* typedef */ (*C.VkExternalMemoryHandleTypeFlagBits)(&y))
+	return x
+}
+func (x *PhysicalDeviceExternalImageFormatInfo) SetHandleType(y ExternalMemoryHandleTypeFlagBits) {
+	x.handleType = *( /* typedef */ (*C.VkExternalMemoryHandleTypeFlagBits)(&y))
+}
+
+// ExternalImageFormatProperties provides a go interface for VkExternalImageFormatProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkExternalImageFormatProperties.html
+type ExternalImageFormatProperties C.struct_VkExternalImageFormatProperties
+
+// SizeofExternalImageFormatProperties is the memory size of a ExternalImageFormatProperties
+var SizeofExternalImageFormatProperties int = int(unsafe.Sizeof(ExternalImageFormatProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ExternalImageFormatProperties) ArpPtr(arp *AutoReleasePool) *ExternalImageFormatProperties {
+	ptr := newCBlock(cULong(SizeofExternalImageFormatProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ExternalImageFormatProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ExternalImageFormatProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ExternalImageFormatProperties) AsCPtr() *ExternalImageFormatProperties {
+	clone := (*ExternalImageFormatProperties)(newCBlock(cULong(SizeofExternalImageFormatProperties)))
+	*clone = x
+	return clone
+}
+
+// ExternalImageFormatPropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ExternalImageFormatPropertiesCSlice(arp *AutoReleasePool, x ...ExternalImageFormatProperties) []ExternalImageFormatProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofExternalImageFormatProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ExternalImageFormatProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ExternalImageFormatPropertiesFreeCSlice releases the memory allocated by ExternalImageFormatPropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func ExternalImageFormatPropertiesFreeCSlice(x []ExternalImageFormatProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ExternalImageFormatPropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ExternalImageFormatPropertiesFreeCSlice must be called on the returned slice.
+func ExternalImageFormatPropertiesMakeCSlice(x ...ExternalImageFormatProperties) []ExternalImageFormatProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofExternalImageFormatProperties * len(x)
+	dst := unsafe.Slice((*ExternalImageFormatProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkExternalImageFormatProperties
+func (x ExternalImageFormatProperties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ExternalImageFormatProperties with the value of
+// SType to the value provided in the specification.
+func (x ExternalImageFormatProperties) WithDefaultSType() ExternalImageFormatProperties {
+	return x.WithSType(VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ExternalImageFormatProperties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES)
+}
+
+// WithSType clones a new ExternalImageFormatProperties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExternalImageFormatProperties) WithSType(y StructureType) ExternalImageFormatProperties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ExternalImageFormatProperties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkExternalImageFormatProperties
+func (x ExternalImageFormatProperties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ExternalImageFormatProperties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExternalImageFormatProperties) WithPNext(y unsafe.Pointer) ExternalImageFormatProperties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ExternalImageFormatProperties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ExternalImageFormatProperties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ExternalMemoryProperties returns the value of externalMemoryProperties from VkExternalImageFormatProperties
+func (x ExternalImageFormatProperties) ExternalMemoryProperties() ExternalMemoryProperties {
+	ptr := /* typedef */ (*ExternalMemoryProperties)(&x.externalMemoryProperties)
+	return *ptr
+}
+
+// DescriptorUpdateTemplateEntry provides a go interface for VkDescriptorUpdateTemplateEntry.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDescriptorUpdateTemplateEntry.html
+type DescriptorUpdateTemplateEntry C.struct_VkDescriptorUpdateTemplateEntry
+
+// SizeofDescriptorUpdateTemplateEntry is the memory size of a DescriptorUpdateTemplateEntry
+var SizeofDescriptorUpdateTemplateEntry int = int(unsafe.Sizeof(DescriptorUpdateTemplateEntry{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DescriptorUpdateTemplateEntry) ArpPtr(arp *AutoReleasePool) *DescriptorUpdateTemplateEntry {
+	ptr := newCBlock(cULong(SizeofDescriptorUpdateTemplateEntry))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DescriptorUpdateTemplateEntry)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DescriptorUpdateTemplateEntry) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DescriptorUpdateTemplateEntry) AsCPtr() *DescriptorUpdateTemplateEntry {
+	clone := (*DescriptorUpdateTemplateEntry)(newCBlock(cULong(SizeofDescriptorUpdateTemplateEntry)))
+	*clone = x
+	return clone
+}
+
+// DescriptorUpdateTemplateEntryCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DescriptorUpdateTemplateEntryCSlice(arp *AutoReleasePool, x ...DescriptorUpdateTemplateEntry) []DescriptorUpdateTemplateEntry {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDescriptorUpdateTemplateEntry * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DescriptorUpdateTemplateEntry)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DescriptorUpdateTemplateEntryFreeCSlice releases the memory allocated by DescriptorUpdateTemplateEntryMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DescriptorUpdateTemplateEntryFreeCSlice(x []DescriptorUpdateTemplateEntry) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DescriptorUpdateTemplateEntryMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DescriptorUpdateTemplateEntryFreeCSlice must be called on the returned slice.
+func DescriptorUpdateTemplateEntryMakeCSlice(x ...DescriptorUpdateTemplateEntry) []DescriptorUpdateTemplateEntry {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDescriptorUpdateTemplateEntry * len(x)
+	dst := unsafe.Slice((*DescriptorUpdateTemplateEntry)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DstBinding returns the value of dstBinding from VkDescriptorUpdateTemplateEntry
+func (x DescriptorUpdateTemplateEntry) DstBinding() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.dstBinding)
+	return *ptr
+}
+
+// WithDstBinding clones a new DescriptorUpdateTemplateEntry with the value of
+// DstBinding updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorUpdateTemplateEntry) WithDstBinding(y uint32) DescriptorUpdateTemplateEntry {
+	x.dstBinding = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DescriptorUpdateTemplateEntry) SetDstBinding(y uint32) {
+	x.dstBinding = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// DstArrayElement returns the value of dstArrayElement from VkDescriptorUpdateTemplateEntry
+func (x DescriptorUpdateTemplateEntry) DstArrayElement() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.dstArrayElement)
+	return *ptr
+}
+
+// WithDstArrayElement clones a new DescriptorUpdateTemplateEntry with the value of
+// DstArrayElement updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorUpdateTemplateEntry) WithDstArrayElement(y uint32) DescriptorUpdateTemplateEntry {
+	x.dstArrayElement = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DescriptorUpdateTemplateEntry) SetDstArrayElement(y uint32) {
+	x.dstArrayElement = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// DescriptorCount returns the value of descriptorCount from VkDescriptorUpdateTemplateEntry
+func (x DescriptorUpdateTemplateEntry) DescriptorCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.descriptorCount)
+	return *ptr
+}
+
+// WithDescriptorCount clones a new DescriptorUpdateTemplateEntry with the value of
+// DescriptorCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorUpdateTemplateEntry) WithDescriptorCount(y uint32) DescriptorUpdateTemplateEntry {
+	x.descriptorCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DescriptorUpdateTemplateEntry) SetDescriptorCount(y uint32) {
+	x.descriptorCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// DescriptorType returns the value of descriptorType from VkDescriptorUpdateTemplateEntry
+func (x DescriptorUpdateTemplateEntry) DescriptorType() DescriptorType {
+	ptr := /* typedef */ (*DescriptorType)(&x.descriptorType)
+	return *ptr
+}
+
+// WithDescriptorType clones a new DescriptorUpdateTemplateEntry with the value of
+// DescriptorType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorUpdateTemplateEntry) WithDescriptorType(y DescriptorType) DescriptorUpdateTemplateEntry {
+	x.descriptorType = *( /* typedef */ (*C.VkDescriptorType)(&y))
+	return x
+}
+func (x *DescriptorUpdateTemplateEntry) SetDescriptorType(y DescriptorType) {
+	x.descriptorType = *( /* typedef */ (*C.VkDescriptorType)(&y))
+}
+
+// Offset returns the value of offset from VkDescriptorUpdateTemplateEntry
+func (x DescriptorUpdateTemplateEntry) Offset() uint64 {
+	ptr := func(x *C.size_t) *uint64 { /* Scalar */ c2g := uint64(*x); return &c2g }(&x.offset)
+	return *ptr
+}
+
+// WithOffset clones a new DescriptorUpdateTemplateEntry with the value of
+// Offset updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorUpdateTemplateEntry) WithOffset(y uint64) DescriptorUpdateTemplateEntry {
+	x.offset = *(func(x *uint64) *C.size_t { /* Scalar */ g2c := C.size_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DescriptorUpdateTemplateEntry) SetOffset(y uint64) {
+	x.offset = *(func(x *uint64) *C.size_t { /* Scalar */ g2c := C.size_t(*x); return &g2c }(&y))
+}
+
+// Stride returns the value of stride from VkDescriptorUpdateTemplateEntry
+func (x DescriptorUpdateTemplateEntry) Stride() uint64 {
+	ptr := func(x *C.size_t) *uint64 { /* Scalar */ c2g := uint64(*x); return &c2g }(&x.stride)
+	return *ptr
+}
+
+// WithStride clones a new DescriptorUpdateTemplateEntry with the value of
+// Stride updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorUpdateTemplateEntry) WithStride(y uint64) DescriptorUpdateTemplateEntry {
+	x.stride = *(func(x *uint64) *C.size_t { /* Scalar */ g2c := C.size_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DescriptorUpdateTemplateEntry) SetStride(y uint64) {
+	x.stride = *(func(x *uint64) *C.size_t { /* Scalar */ g2c := C.size_t(*x); return &g2c }(&y))
+}
+
+// DescriptorUpdateTemplateCreateInfo provides a go interface for VkDescriptorUpdateTemplateCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDescriptorUpdateTemplateCreateInfo.html
+type DescriptorUpdateTemplateCreateInfo C.struct_VkDescriptorUpdateTemplateCreateInfo
+
+// SizeofDescriptorUpdateTemplateCreateInfo is the memory size of a DescriptorUpdateTemplateCreateInfo
+var SizeofDescriptorUpdateTemplateCreateInfo int = int(unsafe.Sizeof(DescriptorUpdateTemplateCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DescriptorUpdateTemplateCreateInfo) ArpPtr(arp *AutoReleasePool) *DescriptorUpdateTemplateCreateInfo {
+	ptr := newCBlock(cULong(SizeofDescriptorUpdateTemplateCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DescriptorUpdateTemplateCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DescriptorUpdateTemplateCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DescriptorUpdateTemplateCreateInfo) AsCPtr() *DescriptorUpdateTemplateCreateInfo {
+	clone := (*DescriptorUpdateTemplateCreateInfo)(newCBlock(cULong(SizeofDescriptorUpdateTemplateCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// DescriptorUpdateTemplateCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DescriptorUpdateTemplateCreateInfoCSlice(arp *AutoReleasePool, x ...DescriptorUpdateTemplateCreateInfo) []DescriptorUpdateTemplateCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDescriptorUpdateTemplateCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DescriptorUpdateTemplateCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DescriptorUpdateTemplateCreateInfoFreeCSlice releases the memory allocated by DescriptorUpdateTemplateCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DescriptorUpdateTemplateCreateInfoFreeCSlice(x []DescriptorUpdateTemplateCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DescriptorUpdateTemplateCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DescriptorUpdateTemplateCreateInfoFreeCSlice must be called on the returned slice.
+func DescriptorUpdateTemplateCreateInfoMakeCSlice(x ...DescriptorUpdateTemplateCreateInfo) []DescriptorUpdateTemplateCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDescriptorUpdateTemplateCreateInfo * len(x)
+	dst := unsafe.Slice((*DescriptorUpdateTemplateCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDescriptorUpdateTemplateCreateInfo
+func (x DescriptorUpdateTemplateCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DescriptorUpdateTemplateCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x DescriptorUpdateTemplateCreateInfo) WithDefaultSType() DescriptorUpdateTemplateCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DescriptorUpdateTemplateCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DESCRIPTOR_UPDATE_TEMPLATE_CREATE_INFO)
+}
+
+// WithSType clones a new DescriptorUpdateTemplateCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorUpdateTemplateCreateInfo) WithSType(y StructureType) DescriptorUpdateTemplateCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DescriptorUpdateTemplateCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDescriptorUpdateTemplateCreateInfo
+func (x DescriptorUpdateTemplateCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DescriptorUpdateTemplateCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorUpdateTemplateCreateInfo) WithPNext(y unsafe.Pointer) DescriptorUpdateTemplateCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DescriptorUpdateTemplateCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DescriptorUpdateTemplateCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Flags returns the value of flags from VkDescriptorUpdateTemplateCreateInfo
+func (x DescriptorUpdateTemplateCreateInfo) Flags() DescriptorUpdateTemplateCreateFlags {
+	ptr := /* typedef */ (*DescriptorUpdateTemplateCreateFlags)(&x.flags)
+	return *ptr
+}
+
+// WithFlags clones a new DescriptorUpdateTemplateCreateInfo with the value of
+// Flags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorUpdateTemplateCreateInfo) WithFlags(y DescriptorUpdateTemplateCreateFlags) DescriptorUpdateTemplateCreateInfo {
+	x.flags = *( /* typedef */ (*C.VkDescriptorUpdateTemplateCreateFlags)(&y))
+	return x
+}
+func (x *DescriptorUpdateTemplateCreateInfo) SetFlags(y DescriptorUpdateTemplateCreateFlags) {
+	x.flags = *( /* typedef */ (*C.VkDescriptorUpdateTemplateCreateFlags)(&y))
+}
+
+// DescriptorUpdateEntryCount returns the value of descriptorUpdateEntryCount from VkDescriptorUpdateTemplateCreateInfo
+func (x DescriptorUpdateTemplateCreateInfo) DescriptorUpdateEntryCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.descriptorUpdateEntryCount)
+	return *ptr
+}
+
+// WithDescriptorUpdateEntryCount clones a new DescriptorUpdateTemplateCreateInfo with the value of
+// DescriptorUpdateEntryCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorUpdateTemplateCreateInfo) WithDescriptorUpdateEntryCount(y uint32) DescriptorUpdateTemplateCreateInfo {
+	x.descriptorUpdateEntryCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DescriptorUpdateTemplateCreateInfo) SetDescriptorUpdateEntryCount(y uint32) {
+	x.descriptorUpdateEntryCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PDescriptorUpdateEntries returns the value of pDescriptorUpdateEntries from VkDescriptorUpdateTemplateCreateInfo
+func (x DescriptorUpdateTemplateCreateInfo) PDescriptorUpdateEntries() []DescriptorUpdateTemplateEntry {
+	if x.pDescriptorUpdateEntries == nil {
+		return nil
+	}
+	return unsafe.Slice((*DescriptorUpdateTemplateEntry)(unsafe.Pointer(x.pDescriptorUpdateEntries)), x.descriptorUpdateEntryCount)
+}
+
+// WithPDescriptorUpdateEntries clones a new DescriptorUpdateTemplateCreateInfo with the value of
+// PDescriptorUpdateEntries updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines DescriptorUpdateEntryCount as the length of this field.
+// DescriptorUpdateEntryCount is updated with the length of the new value.
+func (x DescriptorUpdateTemplateCreateInfo) WithPDescriptorUpdateEntries(y []DescriptorUpdateTemplateEntry) DescriptorUpdateTemplateCreateInfo {
+	x.pDescriptorUpdateEntries = *(func(x *[]DescriptorUpdateTemplateEntry) **C.struct_VkDescriptorUpdateTemplateEntry { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkDescriptorUpdateTemplateEntry)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkDescriptorUpdateTemplateEntry)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithDescriptorUpdateEntryCount(uint32(len(y)))
+}
+func (x *DescriptorUpdateTemplateCreateInfo) SetPDescriptorUpdateEntries(y []DescriptorUpdateTemplateEntry) {
+	x.pDescriptorUpdateEntries = *(func(x *[]DescriptorUpdateTemplateEntry) **C.struct_VkDescriptorUpdateTemplateEntry { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkDescriptorUpdateTemplateEntry)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkDescriptorUpdateTemplateEntry)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetDescriptorUpdateEntryCount(uint32(len(y)))
+}
+
+// PinPDescriptorUpdateEntries pins the Go memory referenced by y with the AutoReleasePool
+// and sets PDescriptorUpdateEntries, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DescriptorUpdateTemplateCreateInfo) PinPDescriptorUpdateEntries(arp *AutoReleasePool, y []DescriptorUpdateTemplateEntry) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPDescriptorUpdateEntries(y)
+}
+
+// TemplateType returns the value of templateType from VkDescriptorUpdateTemplateCreateInfo
+func (x DescriptorUpdateTemplateCreateInfo) TemplateType() DescriptorUpdateTemplateType {
+	ptr := /* typedef */ (*DescriptorUpdateTemplateType)(&x.templateType)
+	return *ptr
+}
+
+// WithTemplateType clones a new DescriptorUpdateTemplateCreateInfo with the value of
+// TemplateType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorUpdateTemplateCreateInfo) WithTemplateType(y DescriptorUpdateTemplateType) DescriptorUpdateTemplateCreateInfo {
+	x.templateType = *( /* typedef */ (*C.VkDescriptorUpdateTemplateType)(&y))
+	return x
+}
+func (x *DescriptorUpdateTemplateCreateInfo) SetTemplateType(y DescriptorUpdateTemplateType) {
+	x.templateType = *( /* typedef */ (*C.VkDescriptorUpdateTemplateType)(&y))
+}
+
+// DescriptorSetLayout returns the value of descriptorSetLayout from VkDescriptorUpdateTemplateCreateInfo
+func (x DescriptorUpdateTemplateCreateInfo) DescriptorSetLayout() DescriptorSetLayout {
+	ptr := /* handle */ (*DescriptorSetLayout)(&x.descriptorSetLayout)
+	return *ptr
+}
+
+// WithDescriptorSetLayout clones a new DescriptorUpdateTemplateCreateInfo with the value of
+// DescriptorSetLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorUpdateTemplateCreateInfo) WithDescriptorSetLayout(y DescriptorSetLayout) DescriptorUpdateTemplateCreateInfo {
+	x.descriptorSetLayout = *( /* handle */ (*C.VkDescriptorSetLayout)(&y))
+	return x
+}
+func (x *DescriptorUpdateTemplateCreateInfo) SetDescriptorSetLayout(y DescriptorSetLayout) {
+	x.descriptorSetLayout = *( /* handle */ (*C.VkDescriptorSetLayout)(&y))
+}
+
+// PipelineBindPoint returns the value of pipelineBindPoint from VkDescriptorUpdateTemplateCreateInfo
+func (x DescriptorUpdateTemplateCreateInfo) PipelineBindPoint() PipelineBindPoint {
+	ptr := /* typedef */ (*PipelineBindPoint)(&x.pipelineBindPoint)
+	return *ptr
+}
+
+// WithPipelineBindPoint clones a new DescriptorUpdateTemplateCreateInfo with the value of
+// PipelineBindPoint updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorUpdateTemplateCreateInfo) WithPipelineBindPoint(y PipelineBindPoint) DescriptorUpdateTemplateCreateInfo {
+	x.pipelineBindPoint = *( /* typedef */ (*C.VkPipelineBindPoint)(&y))
+	return x
+}
+func (x *DescriptorUpdateTemplateCreateInfo) SetPipelineBindPoint(y PipelineBindPoint) {
+	x.pipelineBindPoint = *( /* typedef */ (*C.VkPipelineBindPoint)(&y))
+}
+
+// PipelineLayout returns the value of pipelineLayout from VkDescriptorUpdateTemplateCreateInfo
+func (x DescriptorUpdateTemplateCreateInfo) PipelineLayout() PipelineLayout {
+	ptr := /* handle */ (*PipelineLayout)(&x.pipelineLayout)
+	return *ptr
+}
+
+// WithPipelineLayout clones a new DescriptorUpdateTemplateCreateInfo with the value of
+// PipelineLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorUpdateTemplateCreateInfo) WithPipelineLayout(y PipelineLayout) DescriptorUpdateTemplateCreateInfo {
+	x.pipelineLayout = *( /* handle */ (*C.VkPipelineLayout)(&y))
+	return x
+}
+func (x *DescriptorUpdateTemplateCreateInfo) SetPipelineLayout(y PipelineLayout) {
+	x.pipelineLayout = *( /* handle */ (*C.VkPipelineLayout)(&y))
+}
+
+// Set returns the value of set from VkDescriptorUpdateTemplateCreateInfo
+func (x DescriptorUpdateTemplateCreateInfo) Set() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.set)
+	return *ptr
+}
+
+// WithSet clones a new DescriptorUpdateTemplateCreateInfo with the value of
+// Set updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorUpdateTemplateCreateInfo) WithSet(y uint32) DescriptorUpdateTemplateCreateInfo {
+	x.set = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DescriptorUpdateTemplateCreateInfo) SetSet(y uint32) {
+	x.set = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// BindBufferMemoryDeviceGroupInfo provides a go interface for VkBindBufferMemoryDeviceGroupInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkBindBufferMemoryDeviceGroupInfo.html
+type BindBufferMemoryDeviceGroupInfo C.struct_VkBindBufferMemoryDeviceGroupInfo
+
+// SizeofBindBufferMemoryDeviceGroupInfo is the memory size of a BindBufferMemoryDeviceGroupInfo
+var SizeofBindBufferMemoryDeviceGroupInfo int = int(unsafe.Sizeof(BindBufferMemoryDeviceGroupInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x BindBufferMemoryDeviceGroupInfo) ArpPtr(arp *AutoReleasePool) *BindBufferMemoryDeviceGroupInfo {
+	ptr := newCBlock(cULong(SizeofBindBufferMemoryDeviceGroupInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*BindBufferMemoryDeviceGroupInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *BindBufferMemoryDeviceGroupInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x BindBufferMemoryDeviceGroupInfo) AsCPtr() *BindBufferMemoryDeviceGroupInfo {
+	clone := (*BindBufferMemoryDeviceGroupInfo)(newCBlock(cULong(SizeofBindBufferMemoryDeviceGroupInfo)))
+	*clone = x
+	return clone
+}
+
+// BindBufferMemoryDeviceGroupInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func BindBufferMemoryDeviceGroupInfoCSlice(arp *AutoReleasePool, x ...BindBufferMemoryDeviceGroupInfo) []BindBufferMemoryDeviceGroupInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBindBufferMemoryDeviceGroupInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*BindBufferMemoryDeviceGroupInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// BindBufferMemoryDeviceGroupInfoFreeCSlice releases the memory allocated by BindBufferMemoryDeviceGroupInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func BindBufferMemoryDeviceGroupInfoFreeCSlice(x []BindBufferMemoryDeviceGroupInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// BindBufferMemoryDeviceGroupInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. BindBufferMemoryDeviceGroupInfoFreeCSlice must be called on the returned slice.
+func BindBufferMemoryDeviceGroupInfoMakeCSlice(x ...BindBufferMemoryDeviceGroupInfo) []BindBufferMemoryDeviceGroupInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBindBufferMemoryDeviceGroupInfo * len(x)
+	dst := unsafe.Slice((*BindBufferMemoryDeviceGroupInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkBindBufferMemoryDeviceGroupInfo
+func (x BindBufferMemoryDeviceGroupInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new BindBufferMemoryDeviceGroupInfo with the value of
+// SType to the value provided in the specification.
+func (x BindBufferMemoryDeviceGroupInfo) WithDefaultSType() BindBufferMemoryDeviceGroupInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *BindBufferMemoryDeviceGroupInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO)
+}
+
+// WithSType clones a new BindBufferMemoryDeviceGroupInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindBufferMemoryDeviceGroupInfo) WithSType(y StructureType) BindBufferMemoryDeviceGroupInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *BindBufferMemoryDeviceGroupInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkBindBufferMemoryDeviceGroupInfo
+func (x BindBufferMemoryDeviceGroupInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new BindBufferMemoryDeviceGroupInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindBufferMemoryDeviceGroupInfo) WithPNext(y unsafe.Pointer) BindBufferMemoryDeviceGroupInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *BindBufferMemoryDeviceGroupInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *BindBufferMemoryDeviceGroupInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// DeviceIndexCount returns the value of deviceIndexCount from VkBindBufferMemoryDeviceGroupInfo
+func (x BindBufferMemoryDeviceGroupInfo) DeviceIndexCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.deviceIndexCount)
+	return *ptr
+}
+
+// WithDeviceIndexCount clones a new BindBufferMemoryDeviceGroupInfo with the value of
+// DeviceIndexCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindBufferMemoryDeviceGroupInfo) WithDeviceIndexCount(y uint32) BindBufferMemoryDeviceGroupInfo {
+	x.deviceIndexCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *BindBufferMemoryDeviceGroupInfo) SetDeviceIndexCount(y uint32) {
+	x.deviceIndexCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PDeviceIndices returns the value of pDeviceIndices from VkBindBufferMemoryDeviceGroupInfo
+func (x BindBufferMemoryDeviceGroupInfo) PDeviceIndices() []uint32 {
+	if x.pDeviceIndices == nil {
+		return nil
+	}
+	return unsafe.Slice((*uint32)(unsafe.Pointer(x.pDeviceIndices)), x.deviceIndexCount)
+}
+
+// WithPDeviceIndices clones a new BindBufferMemoryDeviceGroupInfo with the value of
+// PDeviceIndices updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines DeviceIndexCount as the length of this field.
+// DeviceIndexCount is updated with the length of the new value.
+func (x BindBufferMemoryDeviceGroupInfo) WithPDeviceIndices(y []uint32) BindBufferMemoryDeviceGroupInfo {
+	x.pDeviceIndices = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithDeviceIndexCount(uint32(len(y)))
+}
+func (x *BindBufferMemoryDeviceGroupInfo) SetPDeviceIndices(y []uint32) {
+	x.pDeviceIndices = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetDeviceIndexCount(uint32(len(y)))
+}
+
+// PinPDeviceIndices pins the Go memory referenced by y with the AutoReleasePool
+// and sets PDeviceIndices, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *BindBufferMemoryDeviceGroupInfo) PinPDeviceIndices(arp *AutoReleasePool, y []uint32) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPDeviceIndices(y)
+}
+
+// BindImageMemoryDeviceGroupInfo provides a go interface for VkBindImageMemoryDeviceGroupInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkBindImageMemoryDeviceGroupInfo.html
+type BindImageMemoryDeviceGroupInfo C.struct_VkBindImageMemoryDeviceGroupInfo
+
+// SizeofBindImageMemoryDeviceGroupInfo is the memory size of a BindImageMemoryDeviceGroupInfo
+var SizeofBindImageMemoryDeviceGroupInfo int = int(unsafe.Sizeof(BindImageMemoryDeviceGroupInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x BindImageMemoryDeviceGroupInfo) ArpPtr(arp *AutoReleasePool) *BindImageMemoryDeviceGroupInfo {
+	ptr := newCBlock(cULong(SizeofBindImageMemoryDeviceGroupInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*BindImageMemoryDeviceGroupInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *BindImageMemoryDeviceGroupInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x BindImageMemoryDeviceGroupInfo) AsCPtr() *BindImageMemoryDeviceGroupInfo {
+	clone := (*BindImageMemoryDeviceGroupInfo)(newCBlock(cULong(SizeofBindImageMemoryDeviceGroupInfo)))
+	*clone = x
+	return clone
+}
+
+// BindImageMemoryDeviceGroupInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func BindImageMemoryDeviceGroupInfoCSlice(arp *AutoReleasePool, x ...BindImageMemoryDeviceGroupInfo) []BindImageMemoryDeviceGroupInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBindImageMemoryDeviceGroupInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*BindImageMemoryDeviceGroupInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// BindImageMemoryDeviceGroupInfoFreeCSlice releases the memory allocated by BindImageMemoryDeviceGroupInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func BindImageMemoryDeviceGroupInfoFreeCSlice(x []BindImageMemoryDeviceGroupInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// BindImageMemoryDeviceGroupInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. BindImageMemoryDeviceGroupInfoFreeCSlice must be called on the returned slice.
+func BindImageMemoryDeviceGroupInfoMakeCSlice(x ...BindImageMemoryDeviceGroupInfo) []BindImageMemoryDeviceGroupInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBindImageMemoryDeviceGroupInfo * len(x)
+	dst := unsafe.Slice((*BindImageMemoryDeviceGroupInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkBindImageMemoryDeviceGroupInfo
+func (x BindImageMemoryDeviceGroupInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new BindImageMemoryDeviceGroupInfo with the value of
+// SType to the value provided in the specification.
+func (x BindImageMemoryDeviceGroupInfo) WithDefaultSType() BindImageMemoryDeviceGroupInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *BindImageMemoryDeviceGroupInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO)
+}
+
+// WithSType clones a new BindImageMemoryDeviceGroupInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindImageMemoryDeviceGroupInfo) WithSType(y StructureType) BindImageMemoryDeviceGroupInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *BindImageMemoryDeviceGroupInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkBindImageMemoryDeviceGroupInfo
+func (x BindImageMemoryDeviceGroupInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new BindImageMemoryDeviceGroupInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindImageMemoryDeviceGroupInfo) WithPNext(y unsafe.Pointer) BindImageMemoryDeviceGroupInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *BindImageMemoryDeviceGroupInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *BindImageMemoryDeviceGroupInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// DeviceIndexCount returns the value of deviceIndexCount from VkBindImageMemoryDeviceGroupInfo
+func (x BindImageMemoryDeviceGroupInfo) DeviceIndexCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.deviceIndexCount)
+	return *ptr
+}
+
+// WithDeviceIndexCount clones a new BindImageMemoryDeviceGroupInfo with the value of
+// DeviceIndexCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindImageMemoryDeviceGroupInfo) WithDeviceIndexCount(y uint32) BindImageMemoryDeviceGroupInfo {
+	x.deviceIndexCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *BindImageMemoryDeviceGroupInfo) SetDeviceIndexCount(y uint32) {
+	x.deviceIndexCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PDeviceIndices returns the value of pDeviceIndices from VkBindImageMemoryDeviceGroupInfo
+func (x BindImageMemoryDeviceGroupInfo) PDeviceIndices() []uint32 {
+	if x.pDeviceIndices == nil {
+		return nil
+	}
+	return unsafe.Slice((*uint32)(unsafe.Pointer(x.pDeviceIndices)), x.deviceIndexCount)
+}
+
+// WithPDeviceIndices clones a new BindImageMemoryDeviceGroupInfo with the value of
+// PDeviceIndices updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines DeviceIndexCount as the length of this field.
+// DeviceIndexCount is updated with the length of the new value.
+func (x BindImageMemoryDeviceGroupInfo) WithPDeviceIndices(y []uint32) BindImageMemoryDeviceGroupInfo {
+	x.pDeviceIndices = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithDeviceIndexCount(uint32(len(y)))
+}
+func (x *BindImageMemoryDeviceGroupInfo) SetPDeviceIndices(y []uint32) {
+	x.pDeviceIndices = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetDeviceIndexCount(uint32(len(y)))
+}
+
+// PinPDeviceIndices pins the Go memory referenced by y with the AutoReleasePool
+// and sets PDeviceIndices, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *BindImageMemoryDeviceGroupInfo) PinPDeviceIndices(arp *AutoReleasePool, y []uint32) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPDeviceIndices(y)
+}
+
+// SplitInstanceBindRegionCount returns the value of splitInstanceBindRegionCount from VkBindImageMemoryDeviceGroupInfo
+func (x BindImageMemoryDeviceGroupInfo) SplitInstanceBindRegionCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.splitInstanceBindRegionCount)
+	return *ptr
+}
+
+// WithSplitInstanceBindRegionCount clones a new BindImageMemoryDeviceGroupInfo with the value of
+// SplitInstanceBindRegionCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindImageMemoryDeviceGroupInfo) WithSplitInstanceBindRegionCount(y uint32) BindImageMemoryDeviceGroupInfo {
+	x.splitInstanceBindRegionCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *BindImageMemoryDeviceGroupInfo) SetSplitInstanceBindRegionCount(y uint32) {
+	x.splitInstanceBindRegionCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PSplitInstanceBindRegions returns the value of pSplitInstanceBindRegions from VkBindImageMemoryDeviceGroupInfo
+func (x BindImageMemoryDeviceGroupInfo) PSplitInstanceBindRegions() []Rect2D {
+	if x.pSplitInstanceBindRegions == nil {
+		return nil
+	}
+	return unsafe.Slice((*Rect2D)(unsafe.Pointer(x.pSplitInstanceBindRegions)), x.splitInstanceBindRegionCount)
+}
+
+// WithPSplitInstanceBindRegions clones a new BindImageMemoryDeviceGroupInfo with the value of
+// PSplitInstanceBindRegions updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines SplitInstanceBindRegionCount as the length of this field.
+// SplitInstanceBindRegionCount is updated with the length of the new value.
+func (x BindImageMemoryDeviceGroupInfo) WithPSplitInstanceBindRegions(y []Rect2D) BindImageMemoryDeviceGroupInfo {
+	x.pSplitInstanceBindRegions = *(func(x *[]Rect2D) **C.struct_VkRect2D { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkRect2D)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkRect2D)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithSplitInstanceBindRegionCount(uint32(len(y)))
+}
+func (x *BindImageMemoryDeviceGroupInfo) SetPSplitInstanceBindRegions(y []Rect2D) {
+	x.pSplitInstanceBindRegions = *(func(x *[]Rect2D) **C.struct_VkRect2D { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkRect2D)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkRect2D)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetSplitInstanceBindRegionCount(uint32(len(y)))
+}
+
+// PinPSplitInstanceBindRegions pins the Go memory referenced by y with the AutoReleasePool
+// and sets PSplitInstanceBindRegions, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *BindImageMemoryDeviceGroupInfo) PinPSplitInstanceBindRegions(arp *AutoReleasePool, y []Rect2D) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPSplitInstanceBindRegions(y)
+}
+
+// MemoryDedicatedAllocateInfo provides a go interface for VkMemoryDedicatedAllocateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkMemoryDedicatedAllocateInfo.html
+type MemoryDedicatedAllocateInfo C.struct_VkMemoryDedicatedAllocateInfo
+
+// SizeofMemoryDedicatedAllocateInfo is the memory size of a MemoryDedicatedAllocateInfo
+var SizeofMemoryDedicatedAllocateInfo int = int(unsafe.Sizeof(MemoryDedicatedAllocateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x MemoryDedicatedAllocateInfo) ArpPtr(arp *AutoReleasePool) *MemoryDedicatedAllocateInfo {
+	ptr := newCBlock(cULong(SizeofMemoryDedicatedAllocateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*MemoryDedicatedAllocateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *MemoryDedicatedAllocateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x MemoryDedicatedAllocateInfo) AsCPtr() *MemoryDedicatedAllocateInfo {
+	clone := (*MemoryDedicatedAllocateInfo)(newCBlock(cULong(SizeofMemoryDedicatedAllocateInfo)))
+	*clone = x
+	return clone
+}
+
+// MemoryDedicatedAllocateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func MemoryDedicatedAllocateInfoCSlice(arp *AutoReleasePool, x ...MemoryDedicatedAllocateInfo) []MemoryDedicatedAllocateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofMemoryDedicatedAllocateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*MemoryDedicatedAllocateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// MemoryDedicatedAllocateInfoFreeCSlice releases the memory allocated by MemoryDedicatedAllocateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func MemoryDedicatedAllocateInfoFreeCSlice(x []MemoryDedicatedAllocateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// MemoryDedicatedAllocateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. MemoryDedicatedAllocateInfoFreeCSlice must be called on the returned slice.
+func MemoryDedicatedAllocateInfoMakeCSlice(x ...MemoryDedicatedAllocateInfo) []MemoryDedicatedAllocateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofMemoryDedicatedAllocateInfo * len(x)
+	dst := unsafe.Slice((*MemoryDedicatedAllocateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkMemoryDedicatedAllocateInfo
+func (x MemoryDedicatedAllocateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new MemoryDedicatedAllocateInfo with the value of
+// SType to the value provided in the specification.
+func (x MemoryDedicatedAllocateInfo) WithDefaultSType() MemoryDedicatedAllocateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *MemoryDedicatedAllocateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO)
+}
+
+// WithSType clones a new MemoryDedicatedAllocateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryDedicatedAllocateInfo) WithSType(y StructureType) MemoryDedicatedAllocateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *MemoryDedicatedAllocateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkMemoryDedicatedAllocateInfo
+func (x MemoryDedicatedAllocateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new MemoryDedicatedAllocateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryDedicatedAllocateInfo) WithPNext(y unsafe.Pointer) MemoryDedicatedAllocateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *MemoryDedicatedAllocateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *MemoryDedicatedAllocateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Image returns the value of image from VkMemoryDedicatedAllocateInfo
+func (x MemoryDedicatedAllocateInfo) Image() Image {
+	ptr := /* handle */ (*Image)(&x.image)
+	return *ptr
+}
+
+// WithImage clones a new MemoryDedicatedAllocateInfo with the value of
+// Image updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryDedicatedAllocateInfo) WithImage(y Image) MemoryDedicatedAllocateInfo {
+	x.image = *( /* handle */ (*C.VkImage)(&y))
+	return x
+}
+func (x *MemoryDedicatedAllocateInfo) SetImage(y Image) {
+	x.image = *( /* handle */ (*C.VkImage)(&y))
+}
+
+// Buffer returns the value of buffer from VkMemoryDedicatedAllocateInfo
+func (x MemoryDedicatedAllocateInfo) Buffer() Buffer {
+	ptr := /* handle */ (*Buffer)(&x.buffer)
+	return *ptr
+}
+
+// WithBuffer clones a new MemoryDedicatedAllocateInfo with the value of
+// Buffer updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryDedicatedAllocateInfo) WithBuffer(y Buffer) MemoryDedicatedAllocateInfo {
+	x.buffer = *( /* handle */ (*C.VkBuffer)(&y))
+	return x
+}
+func (x *MemoryDedicatedAllocateInfo) SetBuffer(y Buffer) {
+	x.buffer = *( /* handle */ (*C.VkBuffer)(&y))
+}
+
+// DeviceGroupBindSparseInfo provides a go interface for VkDeviceGroupBindSparseInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDeviceGroupBindSparseInfo.html
+type DeviceGroupBindSparseInfo C.struct_VkDeviceGroupBindSparseInfo
+
+// SizeofDeviceGroupBindSparseInfo is the memory size of a DeviceGroupBindSparseInfo
+var SizeofDeviceGroupBindSparseInfo int = int(unsafe.Sizeof(DeviceGroupBindSparseInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DeviceGroupBindSparseInfo) ArpPtr(arp *AutoReleasePool) *DeviceGroupBindSparseInfo {
+	ptr := newCBlock(cULong(SizeofDeviceGroupBindSparseInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DeviceGroupBindSparseInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DeviceGroupBindSparseInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DeviceGroupBindSparseInfo) AsCPtr() *DeviceGroupBindSparseInfo {
+	clone := (*DeviceGroupBindSparseInfo)(newCBlock(cULong(SizeofDeviceGroupBindSparseInfo)))
+	*clone = x
+	return clone
+}
+
+// DeviceGroupBindSparseInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DeviceGroupBindSparseInfoCSlice(arp *AutoReleasePool, x ...DeviceGroupBindSparseInfo) []DeviceGroupBindSparseInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceGroupBindSparseInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DeviceGroupBindSparseInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DeviceGroupBindSparseInfoFreeCSlice releases the memory allocated by DeviceGroupBindSparseInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DeviceGroupBindSparseInfoFreeCSlice(x []DeviceGroupBindSparseInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DeviceGroupBindSparseInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DeviceGroupBindSparseInfoFreeCSlice must be called on the returned slice.
+func DeviceGroupBindSparseInfoMakeCSlice(x ...DeviceGroupBindSparseInfo) []DeviceGroupBindSparseInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceGroupBindSparseInfo * len(x)
+	dst := unsafe.Slice((*DeviceGroupBindSparseInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDeviceGroupBindSparseInfo
+func (x DeviceGroupBindSparseInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DeviceGroupBindSparseInfo with the value of
+// SType to the value provided in the specification.
+func (x DeviceGroupBindSparseInfo) WithDefaultSType() DeviceGroupBindSparseInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DeviceGroupBindSparseInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO)
+}
+
+// WithSType clones a new DeviceGroupBindSparseInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupBindSparseInfo) WithSType(y StructureType) DeviceGroupBindSparseInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DeviceGroupBindSparseInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDeviceGroupBindSparseInfo
+func (x DeviceGroupBindSparseInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DeviceGroupBindSparseInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupBindSparseInfo) WithPNext(y unsafe.Pointer) DeviceGroupBindSparseInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceGroupBindSparseInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DeviceGroupBindSparseInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ResourceDeviceIndex returns the value of resourceDeviceIndex from VkDeviceGroupBindSparseInfo
+func (x DeviceGroupBindSparseInfo) ResourceDeviceIndex() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.resourceDeviceIndex)
+	return *ptr
+}
+
+// WithResourceDeviceIndex clones a new DeviceGroupBindSparseInfo with the value of
+// ResourceDeviceIndex updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupBindSparseInfo) WithResourceDeviceIndex(y uint32) DeviceGroupBindSparseInfo {
+	x.resourceDeviceIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceGroupBindSparseInfo) SetResourceDeviceIndex(y uint32) {
+	x.resourceDeviceIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// MemoryDeviceIndex returns the value of memoryDeviceIndex from VkDeviceGroupBindSparseInfo
+func (x DeviceGroupBindSparseInfo) MemoryDeviceIndex() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.memoryDeviceIndex)
+	return *ptr
+}
+
+// WithMemoryDeviceIndex clones a new DeviceGroupBindSparseInfo with the value of
+// MemoryDeviceIndex updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupBindSparseInfo) WithMemoryDeviceIndex(y uint32) DeviceGroupBindSparseInfo {
+	x.memoryDeviceIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceGroupBindSparseInfo) SetMemoryDeviceIndex(y uint32) {
+	x.memoryDeviceIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// DescriptorSetLayoutSupport provides a go interface for VkDescriptorSetLayoutSupport.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDescriptorSetLayoutSupport.html
+type DescriptorSetLayoutSupport C.struct_VkDescriptorSetLayoutSupport
+
+// SizeofDescriptorSetLayoutSupport is the memory size of a DescriptorSetLayoutSupport
+var SizeofDescriptorSetLayoutSupport int = int(unsafe.Sizeof(DescriptorSetLayoutSupport{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DescriptorSetLayoutSupport) ArpPtr(arp *AutoReleasePool) *DescriptorSetLayoutSupport {
+	ptr := newCBlock(cULong(SizeofDescriptorSetLayoutSupport))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DescriptorSetLayoutSupport)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DescriptorSetLayoutSupport) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DescriptorSetLayoutSupport) AsCPtr() *DescriptorSetLayoutSupport {
+	clone := (*DescriptorSetLayoutSupport)(newCBlock(cULong(SizeofDescriptorSetLayoutSupport)))
+	*clone = x
+	return clone
+}
+
+// DescriptorSetLayoutSupportCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DescriptorSetLayoutSupportCSlice(arp *AutoReleasePool, x ...DescriptorSetLayoutSupport) []DescriptorSetLayoutSupport {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDescriptorSetLayoutSupport * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DescriptorSetLayoutSupport)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DescriptorSetLayoutSupportFreeCSlice releases the memory allocated by DescriptorSetLayoutSupportMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DescriptorSetLayoutSupportFreeCSlice(x []DescriptorSetLayoutSupport) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DescriptorSetLayoutSupportMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DescriptorSetLayoutSupportFreeCSlice must be called on the returned slice.
+func DescriptorSetLayoutSupportMakeCSlice(x ...DescriptorSetLayoutSupport) []DescriptorSetLayoutSupport {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDescriptorSetLayoutSupport * len(x)
+	dst := unsafe.Slice((*DescriptorSetLayoutSupport)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDescriptorSetLayoutSupport
+func (x DescriptorSetLayoutSupport) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DescriptorSetLayoutSupport with the value of
+// SType to the value provided in the specification.
+func (x DescriptorSetLayoutSupport) WithDefaultSType() DescriptorSetLayoutSupport {
+	return x.WithSType(VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_SUPPORT)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DescriptorSetLayoutSupport) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_SUPPORT)
+}
+
+// WithSType clones a new DescriptorSetLayoutSupport with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorSetLayoutSupport) WithSType(y StructureType) DescriptorSetLayoutSupport {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DescriptorSetLayoutSupport) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDescriptorSetLayoutSupport
+func (x DescriptorSetLayoutSupport) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DescriptorSetLayoutSupport with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorSetLayoutSupport) WithPNext(y unsafe.Pointer) DescriptorSetLayoutSupport {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DescriptorSetLayoutSupport) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DescriptorSetLayoutSupport) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Supported returns the value of supported from VkDescriptorSetLayoutSupport
+func (x DescriptorSetLayoutSupport) Supported() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.supported)
+	return *ptr
+}
+
+// PhysicalDeviceGroupProperties provides a go interface for VkPhysicalDeviceGroupProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceGroupProperties.html
+type PhysicalDeviceGroupProperties C.struct_VkPhysicalDeviceGroupProperties
+
+// SizeofPhysicalDeviceGroupProperties is the memory size of a PhysicalDeviceGroupProperties
+var SizeofPhysicalDeviceGroupProperties int = int(unsafe.Sizeof(PhysicalDeviceGroupProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceGroupProperties) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceGroupProperties {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceGroupProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceGroupProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceGroupProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceGroupProperties) AsCPtr() *PhysicalDeviceGroupProperties {
+	clone := (*PhysicalDeviceGroupProperties)(newCBlock(cULong(SizeofPhysicalDeviceGroupProperties)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceGroupPropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceGroupPropertiesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceGroupProperties) []PhysicalDeviceGroupProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceGroupProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceGroupProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceGroupPropertiesFreeCSlice releases the memory allocated by PhysicalDeviceGroupPropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceGroupPropertiesFreeCSlice(x []PhysicalDeviceGroupProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceGroupPropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceGroupPropertiesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceGroupPropertiesMakeCSlice(x ...PhysicalDeviceGroupProperties) []PhysicalDeviceGroupProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceGroupProperties * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceGroupProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceGroupProperties
+func (x *PhysicalDeviceGroupProperties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceGroupProperties with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceGroupProperties) WithDefaultSType() PhysicalDeviceGroupProperties {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceGroupProperties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_GROUP_PROPERTIES)
+}
+
+// WithSType clones a new PhysicalDeviceGroupProperties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceGroupProperties) WithSType(y StructureType) PhysicalDeviceGroupProperties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceGroupProperties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceGroupProperties
+func (x *PhysicalDeviceGroupProperties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceGroupProperties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceGroupProperties) WithPNext(y unsafe.Pointer) PhysicalDeviceGroupProperties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceGroupProperties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceGroupProperties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// PhysicalDeviceCount returns the value of physicalDeviceCount from VkPhysicalDeviceGroupProperties
+func (x *PhysicalDeviceGroupProperties) PhysicalDeviceCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.physicalDeviceCount)
+	return *ptr
+}
+
+// PhysicalDevices returns the value of physicalDevices from VkPhysicalDeviceGroupProperties
+// The slice references the array in x; it is not a copy.
+func (x *PhysicalDeviceGroupProperties) PhysicalDevices() []PhysicalDevice {
+	ptr := func(x *[VK_MAX_DEVICE_GROUP_SIZE]C.VkPhysicalDevice) *[]PhysicalDevice { /* Array for PhysicalDevice */
+		slc := unsafe.Slice((*PhysicalDevice)(unsafe.Pointer(x)), VK_MAX_DEVICE_GROUP_SIZE)
+		return &slc
+	}(&x.physicalDevices)
+	return *ptr
+}
+
+// SubsetAllocation returns the value of subsetAllocation from VkPhysicalDeviceGroupProperties
+func (x *PhysicalDeviceGroupProperties) SubsetAllocation() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.subsetAllocation)
+	return *ptr
+}
+
+// DeviceGroupDeviceCreateInfo provides a go interface for VkDeviceGroupDeviceCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDeviceGroupDeviceCreateInfo.html
+type DeviceGroupDeviceCreateInfo C.struct_VkDeviceGroupDeviceCreateInfo
+
+// SizeofDeviceGroupDeviceCreateInfo is the memory size of a DeviceGroupDeviceCreateInfo
+var SizeofDeviceGroupDeviceCreateInfo int = int(unsafe.Sizeof(DeviceGroupDeviceCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DeviceGroupDeviceCreateInfo) ArpPtr(arp *AutoReleasePool) *DeviceGroupDeviceCreateInfo {
+	ptr := newCBlock(cULong(SizeofDeviceGroupDeviceCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DeviceGroupDeviceCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DeviceGroupDeviceCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DeviceGroupDeviceCreateInfo) AsCPtr() *DeviceGroupDeviceCreateInfo {
+	clone := (*DeviceGroupDeviceCreateInfo)(newCBlock(cULong(SizeofDeviceGroupDeviceCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// DeviceGroupDeviceCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DeviceGroupDeviceCreateInfoCSlice(arp *AutoReleasePool, x ...DeviceGroupDeviceCreateInfo) []DeviceGroupDeviceCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceGroupDeviceCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DeviceGroupDeviceCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DeviceGroupDeviceCreateInfoFreeCSlice releases the memory allocated by DeviceGroupDeviceCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DeviceGroupDeviceCreateInfoFreeCSlice(x []DeviceGroupDeviceCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DeviceGroupDeviceCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DeviceGroupDeviceCreateInfoFreeCSlice must be called on the returned slice.
+func DeviceGroupDeviceCreateInfoMakeCSlice(x ...DeviceGroupDeviceCreateInfo) []DeviceGroupDeviceCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceGroupDeviceCreateInfo * len(x)
+	dst := unsafe.Slice((*DeviceGroupDeviceCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDeviceGroupDeviceCreateInfo
+func (x DeviceGroupDeviceCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DeviceGroupDeviceCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x DeviceGroupDeviceCreateInfo) WithDefaultSType() DeviceGroupDeviceCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DeviceGroupDeviceCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO)
+}
+
+// WithSType clones a new DeviceGroupDeviceCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupDeviceCreateInfo) WithSType(y StructureType) DeviceGroupDeviceCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DeviceGroupDeviceCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDeviceGroupDeviceCreateInfo
+func (x DeviceGroupDeviceCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DeviceGroupDeviceCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupDeviceCreateInfo) WithPNext(y unsafe.Pointer) DeviceGroupDeviceCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceGroupDeviceCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DeviceGroupDeviceCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// PhysicalDeviceCount returns the value of physicalDeviceCount from VkDeviceGroupDeviceCreateInfo
+func (x DeviceGroupDeviceCreateInfo) PhysicalDeviceCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.physicalDeviceCount)
+	return *ptr
+}
+
+// WithPhysicalDeviceCount clones a new DeviceGroupDeviceCreateInfo with the value of
+// PhysicalDeviceCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupDeviceCreateInfo) WithPhysicalDeviceCount(y uint32) DeviceGroupDeviceCreateInfo {
+	x.physicalDeviceCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceGroupDeviceCreateInfo) SetPhysicalDeviceCount(y uint32) {
+	x.physicalDeviceCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PPhysicalDevices returns the value of pPhysicalDevices from VkDeviceGroupDeviceCreateInfo
+func (x DeviceGroupDeviceCreateInfo) PPhysicalDevices() []PhysicalDevice {
+	if x.pPhysicalDevices == nil {
+		return nil
+	}
+	return unsafe.Slice((*PhysicalDevice)(unsafe.Pointer(x.pPhysicalDevices)), x.physicalDeviceCount)
+}
+
+// WithPPhysicalDevices clones a new DeviceGroupDeviceCreateInfo with the value of
+// PPhysicalDevices updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines PhysicalDeviceCount as the length of this field.
+// PhysicalDeviceCount is updated with the length of the new value.
+func (x DeviceGroupDeviceCreateInfo) WithPPhysicalDevices(y []PhysicalDevice) DeviceGroupDeviceCreateInfo {
+	x.pPhysicalDevices = *(func(x *[]PhysicalDevice) **C.VkPhysicalDevice { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkPhysicalDevice)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkPhysicalDevice)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithPhysicalDeviceCount(uint32(len(y)))
+}
+func (x *DeviceGroupDeviceCreateInfo) SetPPhysicalDevices(y []PhysicalDevice) {
+	x.pPhysicalDevices = *(func(x *[]PhysicalDevice) **C.VkPhysicalDevice { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkPhysicalDevice)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkPhysicalDevice)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetPhysicalDeviceCount(uint32(len(y)))
+}
+
+// PinPPhysicalDevices pins the Go memory referenced by y with the AutoReleasePool
+// and sets PPhysicalDevices, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DeviceGroupDeviceCreateInfo) PinPPhysicalDevices(arp *AutoReleasePool, y []PhysicalDevice) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPPhysicalDevices(y)
+}
+
+// MemoryDedicatedRequirements provides a go interface for VkMemoryDedicatedRequirements.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkMemoryDedicatedRequirements.html
+type MemoryDedicatedRequirements C.struct_VkMemoryDedicatedRequirements
+
+// SizeofMemoryDedicatedRequirements is the memory size of a MemoryDedicatedRequirements
+var SizeofMemoryDedicatedRequirements int = int(unsafe.Sizeof(MemoryDedicatedRequirements{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x MemoryDedicatedRequirements) ArpPtr(arp *AutoReleasePool) *MemoryDedicatedRequirements {
+	ptr := newCBlock(cULong(SizeofMemoryDedicatedRequirements))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*MemoryDedicatedRequirements)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *MemoryDedicatedRequirements) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x MemoryDedicatedRequirements) AsCPtr() *MemoryDedicatedRequirements {
+	clone := (*MemoryDedicatedRequirements)(newCBlock(cULong(SizeofMemoryDedicatedRequirements)))
+	*clone = x
+	return clone
+}
+
+// MemoryDedicatedRequirementsCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func MemoryDedicatedRequirementsCSlice(arp *AutoReleasePool, x ...MemoryDedicatedRequirements) []MemoryDedicatedRequirements {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofMemoryDedicatedRequirements * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*MemoryDedicatedRequirements)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// MemoryDedicatedRequirementsFreeCSlice releases the memory allocated by MemoryDedicatedRequirementsMakeCSlice.
+// It does not free pointers stored inside the slice.
+func MemoryDedicatedRequirementsFreeCSlice(x []MemoryDedicatedRequirements) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// MemoryDedicatedRequirementsMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. MemoryDedicatedRequirementsFreeCSlice must be called on the returned slice.
+func MemoryDedicatedRequirementsMakeCSlice(x ...MemoryDedicatedRequirements) []MemoryDedicatedRequirements {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofMemoryDedicatedRequirements * len(x)
+	dst := unsafe.Slice((*MemoryDedicatedRequirements)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkMemoryDedicatedRequirements
+func (x MemoryDedicatedRequirements) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new MemoryDedicatedRequirements with the value of
+// SType to the value provided in the specification.
+func (x MemoryDedicatedRequirements) WithDefaultSType() MemoryDedicatedRequirements {
+	return x.WithSType(VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *MemoryDedicatedRequirements) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS)
+}
+
+// WithSType clones a new MemoryDedicatedRequirements with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryDedicatedRequirements) WithSType(y StructureType) MemoryDedicatedRequirements {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *MemoryDedicatedRequirements) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkMemoryDedicatedRequirements
+func (x MemoryDedicatedRequirements) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new MemoryDedicatedRequirements with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryDedicatedRequirements) WithPNext(y unsafe.Pointer) MemoryDedicatedRequirements {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *MemoryDedicatedRequirements) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *MemoryDedicatedRequirements) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// PrefersDedicatedAllocation returns the value of prefersDedicatedAllocation from VkMemoryDedicatedRequirements
+func (x MemoryDedicatedRequirements) PrefersDedicatedAllocation() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.prefersDedicatedAllocation)
+	return *ptr
+}
+
+// RequiresDedicatedAllocation returns the value of requiresDedicatedAllocation from VkMemoryDedicatedRequirements
+func (x MemoryDedicatedRequirements) RequiresDedicatedAllocation() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.requiresDedicatedAllocation)
+	return *ptr
+}
+
+// ExportMemoryAllocateInfo provides a go interface for VkExportMemoryAllocateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkExportMemoryAllocateInfo.html
+type ExportMemoryAllocateInfo C.struct_VkExportMemoryAllocateInfo
+
+// SizeofExportMemoryAllocateInfo is the memory size of a ExportMemoryAllocateInfo
+var SizeofExportMemoryAllocateInfo int = int(unsafe.Sizeof(ExportMemoryAllocateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ExportMemoryAllocateInfo) ArpPtr(arp *AutoReleasePool) *ExportMemoryAllocateInfo {
+	ptr := newCBlock(cULong(SizeofExportMemoryAllocateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ExportMemoryAllocateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ExportMemoryAllocateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ExportMemoryAllocateInfo) AsCPtr() *ExportMemoryAllocateInfo {
+	clone := (*ExportMemoryAllocateInfo)(newCBlock(cULong(SizeofExportMemoryAllocateInfo)))
+	*clone = x
+	return clone
+}
+
+// ExportMemoryAllocateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ExportMemoryAllocateInfoCSlice(arp *AutoReleasePool, x ...ExportMemoryAllocateInfo) []ExportMemoryAllocateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofExportMemoryAllocateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ExportMemoryAllocateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ExportMemoryAllocateInfoFreeCSlice releases the memory allocated by ExportMemoryAllocateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func ExportMemoryAllocateInfoFreeCSlice(x []ExportMemoryAllocateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ExportMemoryAllocateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ExportMemoryAllocateInfoFreeCSlice must be called on the returned slice.
+func ExportMemoryAllocateInfoMakeCSlice(x ...ExportMemoryAllocateInfo) []ExportMemoryAllocateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofExportMemoryAllocateInfo * len(x)
+	dst := unsafe.Slice((*ExportMemoryAllocateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkExportMemoryAllocateInfo
+func (x ExportMemoryAllocateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ExportMemoryAllocateInfo with the value of
+// SType to the value provided in the specification.
+func (x ExportMemoryAllocateInfo) WithDefaultSType() ExportMemoryAllocateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ExportMemoryAllocateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO)
+}
+
+// WithSType clones a new ExportMemoryAllocateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExportMemoryAllocateInfo) WithSType(y StructureType) ExportMemoryAllocateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ExportMemoryAllocateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkExportMemoryAllocateInfo
+func (x ExportMemoryAllocateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ExportMemoryAllocateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExportMemoryAllocateInfo) WithPNext(y unsafe.Pointer) ExportMemoryAllocateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ExportMemoryAllocateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ExportMemoryAllocateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// HandleTypes returns the value of handleTypes from VkExportMemoryAllocateInfo
+func (x ExportMemoryAllocateInfo) HandleTypes() ExternalMemoryHandleTypeFlags {
+	ptr := /* typedef */ (*ExternalMemoryHandleTypeFlags)(&x.handleTypes)
+	return *ptr
+}
+
+// WithHandleTypes clones a new ExportMemoryAllocateInfo with the value of
+// HandleTypes updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExportMemoryAllocateInfo) WithHandleTypes(y ExternalMemoryHandleTypeFlags) ExportMemoryAllocateInfo {
+	x.handleTypes = *( /* typedef */ (*C.VkExternalMemoryHandleTypeFlags)(&y))
+	return x
+}
+func (x *ExportMemoryAllocateInfo) SetHandleTypes(y ExternalMemoryHandleTypeFlags) {
+	x.handleTypes = *( /* typedef */ (*C.VkExternalMemoryHandleTypeFlags)(&y))
+}
+
+// ExportFenceCreateInfo provides a go interface for VkExportFenceCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkExportFenceCreateInfo.html
+type ExportFenceCreateInfo C.struct_VkExportFenceCreateInfo
+
+// SizeofExportFenceCreateInfo is the memory size of a ExportFenceCreateInfo
+var SizeofExportFenceCreateInfo int = int(unsafe.Sizeof(ExportFenceCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ExportFenceCreateInfo) ArpPtr(arp *AutoReleasePool) *ExportFenceCreateInfo {
+	ptr := newCBlock(cULong(SizeofExportFenceCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ExportFenceCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ExportFenceCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ExportFenceCreateInfo) AsCPtr() *ExportFenceCreateInfo {
+	clone := (*ExportFenceCreateInfo)(newCBlock(cULong(SizeofExportFenceCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// ExportFenceCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ExportFenceCreateInfoCSlice(arp *AutoReleasePool, x ...ExportFenceCreateInfo) []ExportFenceCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofExportFenceCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ExportFenceCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ExportFenceCreateInfoFreeCSlice releases the memory allocated by ExportFenceCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func ExportFenceCreateInfoFreeCSlice(x []ExportFenceCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ExportFenceCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ExportFenceCreateInfoFreeCSlice must be called on the returned slice.
+func ExportFenceCreateInfoMakeCSlice(x ...ExportFenceCreateInfo) []ExportFenceCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofExportFenceCreateInfo * len(x)
+	dst := unsafe.Slice((*ExportFenceCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkExportFenceCreateInfo
+func (x ExportFenceCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ExportFenceCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x ExportFenceCreateInfo) WithDefaultSType() ExportFenceCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ExportFenceCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO)
+}
+
+// WithSType clones a new ExportFenceCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExportFenceCreateInfo) WithSType(y StructureType) ExportFenceCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ExportFenceCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkExportFenceCreateInfo
+func (x ExportFenceCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ExportFenceCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExportFenceCreateInfo) WithPNext(y unsafe.Pointer) ExportFenceCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ExportFenceCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ExportFenceCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// HandleTypes returns the value of handleTypes from VkExportFenceCreateInfo
+func (x ExportFenceCreateInfo) HandleTypes() ExternalFenceHandleTypeFlags {
+	ptr := /* typedef */ (*ExternalFenceHandleTypeFlags)(&x.handleTypes)
+	return *ptr
+}
+
+// WithHandleTypes clones a new ExportFenceCreateInfo with the value of
+// HandleTypes updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExportFenceCreateInfo) WithHandleTypes(y ExternalFenceHandleTypeFlags) ExportFenceCreateInfo {
+	x.handleTypes = *( /* typedef */ (*C.VkExternalFenceHandleTypeFlags)(&y))
+	return x
+}
+func (x *ExportFenceCreateInfo) SetHandleTypes(y ExternalFenceHandleTypeFlags) {
+	x.handleTypes = *( /* typedef */ (*C.VkExternalFenceHandleTypeFlags)(&y))
+}
+
+// PhysicalDevice16BitStorageFeatures provides a go interface for VkPhysicalDevice16BitStorageFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDevice16BitStorageFeatures.html
+type PhysicalDevice16BitStorageFeatures C.struct_VkPhysicalDevice16BitStorageFeatures
+
+// SizeofPhysicalDevice16BitStorageFeatures is the memory size of a PhysicalDevice16BitStorageFeatures
+var SizeofPhysicalDevice16BitStorageFeatures int = int(unsafe.Sizeof(PhysicalDevice16BitStorageFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDevice16BitStorageFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDevice16BitStorageFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDevice16BitStorageFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDevice16BitStorageFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDevice16BitStorageFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDevice16BitStorageFeatures) AsCPtr() *PhysicalDevice16BitStorageFeatures {
+	clone := (*PhysicalDevice16BitStorageFeatures)(newCBlock(cULong(SizeofPhysicalDevice16BitStorageFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDevice16BitStorageFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDevice16BitStorageFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDevice16BitStorageFeatures) []PhysicalDevice16BitStorageFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDevice16BitStorageFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDevice16BitStorageFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDevice16BitStorageFeaturesFreeCSlice releases the memory allocated by PhysicalDevice16BitStorageFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDevice16BitStorageFeaturesFreeCSlice(x []PhysicalDevice16BitStorageFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDevice16BitStorageFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDevice16BitStorageFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDevice16BitStorageFeaturesMakeCSlice(x ...PhysicalDevice16BitStorageFeatures) []PhysicalDevice16BitStorageFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDevice16BitStorageFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDevice16BitStorageFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDevice16BitStorageFeatures
+func (x PhysicalDevice16BitStorageFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDevice16BitStorageFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDevice16BitStorageFeatures) WithDefaultSType() PhysicalDevice16BitStorageFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDevice16BitStorageFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES)
+}
+
+// WithSType clones a new PhysicalDevice16BitStorageFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevice16BitStorageFeatures) WithSType(y StructureType) PhysicalDevice16BitStorageFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDevice16BitStorageFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDevice16BitStorageFeatures
+func (x PhysicalDevice16BitStorageFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDevice16BitStorageFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevice16BitStorageFeatures) WithPNext(y unsafe.Pointer) PhysicalDevice16BitStorageFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDevice16BitStorageFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDevice16BitStorageFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// StorageBuffer16BitAccess returns the value of storageBuffer16BitAccess from VkPhysicalDevice16BitStorageFeatures
+func (x PhysicalDevice16BitStorageFeatures) StorageBuffer16BitAccess() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.storageBuffer16BitAccess)
+	return *ptr
+}
+
+// WithStorageBuffer16BitAccess clones a new PhysicalDevice16BitStorageFeatures with the value of
+// StorageBuffer16BitAccess updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevice16BitStorageFeatures) WithStorageBuffer16BitAccess(y Bool32) PhysicalDevice16BitStorageFeatures {
+	x.storageBuffer16BitAccess = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevice16BitStorageFeatures) SetStorageBuffer16BitAccess(y Bool32) {
+	x.storageBuffer16BitAccess = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// UniformAndStorageBuffer16BitAccess returns the value of uniformAndStorageBuffer16BitAccess from VkPhysicalDevice16BitStorageFeatures
+func (x PhysicalDevice16BitStorageFeatures) UniformAndStorageBuffer16BitAccess() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.uniformAndStorageBuffer16BitAccess)
+	return *ptr
+}
+
+// WithUniformAndStorageBuffer16BitAccess clones a new PhysicalDevice16BitStorageFeatures with the value of
+// UniformAndStorageBuffer16BitAccess updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevice16BitStorageFeatures) WithUniformAndStorageBuffer16BitAccess(y Bool32) PhysicalDevice16BitStorageFeatures {
+	x.uniformAndStorageBuffer16BitAccess = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevice16BitStorageFeatures) SetUniformAndStorageBuffer16BitAccess(y Bool32) {
+	x.uniformAndStorageBuffer16BitAccess = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// StoragePushConstant16 returns the value of storagePushConstant16 from VkPhysicalDevice16BitStorageFeatures
+func (x PhysicalDevice16BitStorageFeatures) StoragePushConstant16() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.storagePushConstant16)
+	return *ptr
+}
+
+// WithStoragePushConstant16 clones a new PhysicalDevice16BitStorageFeatures with the value of
+// StoragePushConstant16 updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevice16BitStorageFeatures) WithStoragePushConstant16(y Bool32) PhysicalDevice16BitStorageFeatures {
+	x.storagePushConstant16 = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevice16BitStorageFeatures) SetStoragePushConstant16(y Bool32) {
+	x.storagePushConstant16 = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// StorageInputOutput16 returns the value of storageInputOutput16 from VkPhysicalDevice16BitStorageFeatures
+func (x PhysicalDevice16BitStorageFeatures) StorageInputOutput16() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.storageInputOutput16)
+	return *ptr
+}
+
+// WithStorageInputOutput16 clones a new PhysicalDevice16BitStorageFeatures with the value of
+// StorageInputOutput16 updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevice16BitStorageFeatures) WithStorageInputOutput16(y Bool32) PhysicalDevice16BitStorageFeatures {
+	x.storageInputOutput16 = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevice16BitStorageFeatures) SetStorageInputOutput16(y Bool32) {
+	x.storageInputOutput16 = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PhysicalDeviceMaintenance3Properties provides a go interface for VkPhysicalDeviceMaintenance3Properties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceMaintenance3Properties.html
+type PhysicalDeviceMaintenance3Properties C.struct_VkPhysicalDeviceMaintenance3Properties
+
+// SizeofPhysicalDeviceMaintenance3Properties is the memory size of a PhysicalDeviceMaintenance3Properties
+var SizeofPhysicalDeviceMaintenance3Properties int = int(unsafe.Sizeof(PhysicalDeviceMaintenance3Properties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceMaintenance3Properties) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceMaintenance3Properties {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceMaintenance3Properties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceMaintenance3Properties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceMaintenance3Properties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceMaintenance3Properties) AsCPtr() *PhysicalDeviceMaintenance3Properties {
+	clone := (*PhysicalDeviceMaintenance3Properties)(newCBlock(cULong(SizeofPhysicalDeviceMaintenance3Properties)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceMaintenance3PropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceMaintenance3PropertiesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceMaintenance3Properties) []PhysicalDeviceMaintenance3Properties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceMaintenance3Properties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceMaintenance3Properties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceMaintenance3PropertiesFreeCSlice releases the memory allocated by PhysicalDeviceMaintenance3PropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceMaintenance3PropertiesFreeCSlice(x []PhysicalDeviceMaintenance3Properties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceMaintenance3PropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceMaintenance3PropertiesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceMaintenance3PropertiesMakeCSlice(x ...PhysicalDeviceMaintenance3Properties) []PhysicalDeviceMaintenance3Properties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceMaintenance3Properties * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceMaintenance3Properties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceMaintenance3Properties
+func (x PhysicalDeviceMaintenance3Properties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceMaintenance3Properties with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceMaintenance3Properties) WithDefaultSType() PhysicalDeviceMaintenance3Properties {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceMaintenance3Properties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES)
+}
+
+// WithSType clones a new PhysicalDeviceMaintenance3Properties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceMaintenance3Properties) WithSType(y StructureType) PhysicalDeviceMaintenance3Properties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceMaintenance3Properties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceMaintenance3Properties
+func (x PhysicalDeviceMaintenance3Properties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceMaintenance3Properties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceMaintenance3Properties) WithPNext(y unsafe.Pointer) PhysicalDeviceMaintenance3Properties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceMaintenance3Properties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceMaintenance3Properties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// MaxPerSetDescriptors returns the value of maxPerSetDescriptors from VkPhysicalDeviceMaintenance3Properties
+func (x PhysicalDeviceMaintenance3Properties) MaxPerSetDescriptors() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxPerSetDescriptors)
+	return *ptr
+}
+
+// MaxMemoryAllocationSize returns the value of maxMemoryAllocationSize from VkPhysicalDeviceMaintenance3Properties
+func (x PhysicalDeviceMaintenance3Properties) MaxMemoryAllocationSize() DeviceSize {
+	ptr := /* typedef */ (*DeviceSize)(&x.maxMemoryAllocationSize)
+	return *ptr
+}
+
+// DeviceGroupSubmitInfo provides a go interface for VkDeviceGroupSubmitInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDeviceGroupSubmitInfo.html
+type DeviceGroupSubmitInfo C.struct_VkDeviceGroupSubmitInfo
+
+// SizeofDeviceGroupSubmitInfo is the memory size of a DeviceGroupSubmitInfo
+var SizeofDeviceGroupSubmitInfo int = int(unsafe.Sizeof(DeviceGroupSubmitInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DeviceGroupSubmitInfo) ArpPtr(arp *AutoReleasePool) *DeviceGroupSubmitInfo {
+	ptr := newCBlock(cULong(SizeofDeviceGroupSubmitInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DeviceGroupSubmitInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DeviceGroupSubmitInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DeviceGroupSubmitInfo) AsCPtr() *DeviceGroupSubmitInfo {
+	clone := (*DeviceGroupSubmitInfo)(newCBlock(cULong(SizeofDeviceGroupSubmitInfo)))
+	*clone = x
+	return clone
+}
+
+// DeviceGroupSubmitInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DeviceGroupSubmitInfoCSlice(arp *AutoReleasePool, x ...DeviceGroupSubmitInfo) []DeviceGroupSubmitInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceGroupSubmitInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DeviceGroupSubmitInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DeviceGroupSubmitInfoFreeCSlice releases the memory allocated by DeviceGroupSubmitInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DeviceGroupSubmitInfoFreeCSlice(x []DeviceGroupSubmitInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DeviceGroupSubmitInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DeviceGroupSubmitInfoFreeCSlice must be called on the returned slice.
+func DeviceGroupSubmitInfoMakeCSlice(x ...DeviceGroupSubmitInfo) []DeviceGroupSubmitInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceGroupSubmitInfo * len(x)
+	dst := unsafe.Slice((*DeviceGroupSubmitInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDeviceGroupSubmitInfo
+func (x DeviceGroupSubmitInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DeviceGroupSubmitInfo with the value of
+// SType to the value provided in the specification.
+func (x DeviceGroupSubmitInfo) WithDefaultSType() DeviceGroupSubmitInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DeviceGroupSubmitInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO)
+}
+
+// WithSType clones a new DeviceGroupSubmitInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupSubmitInfo) WithSType(y StructureType) DeviceGroupSubmitInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DeviceGroupSubmitInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDeviceGroupSubmitInfo
+func (x DeviceGroupSubmitInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DeviceGroupSubmitInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupSubmitInfo) WithPNext(y unsafe.Pointer) DeviceGroupSubmitInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceGroupSubmitInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DeviceGroupSubmitInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// WaitSemaphoreCount returns the value of waitSemaphoreCount from VkDeviceGroupSubmitInfo
+func (x DeviceGroupSubmitInfo) WaitSemaphoreCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.waitSemaphoreCount)
+	return *ptr
+}
+
+// WithWaitSemaphoreCount clones a new DeviceGroupSubmitInfo with the value of
+// WaitSemaphoreCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupSubmitInfo) WithWaitSemaphoreCount(y uint32) DeviceGroupSubmitInfo {
+	x.waitSemaphoreCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceGroupSubmitInfo) SetWaitSemaphoreCount(y uint32) {
+	x.waitSemaphoreCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PWaitSemaphoreDeviceIndices returns the value of pWaitSemaphoreDeviceIndices from VkDeviceGroupSubmitInfo
+func (x DeviceGroupSubmitInfo) PWaitSemaphoreDeviceIndices() []uint32 {
+	if x.pWaitSemaphoreDeviceIndices == nil {
+		return nil
+	}
+	return unsafe.Slice((*uint32)(unsafe.Pointer(x.pWaitSemaphoreDeviceIndices)), x.waitSemaphoreCount)
+}
+
+// WithPWaitSemaphoreDeviceIndices clones a new DeviceGroupSubmitInfo with the value of
+// PWaitSemaphoreDeviceIndices updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines WaitSemaphoreCount as the length of this field.
+// WaitSemaphoreCount is updated with the length of the new value.
+func (x DeviceGroupSubmitInfo) WithPWaitSemaphoreDeviceIndices(y []uint32) DeviceGroupSubmitInfo {
+	x.pWaitSemaphoreDeviceIndices = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithWaitSemaphoreCount(uint32(len(y)))
+}
+func (x *DeviceGroupSubmitInfo) SetPWaitSemaphoreDeviceIndices(y []uint32) {
+	x.pWaitSemaphoreDeviceIndices = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetWaitSemaphoreCount(uint32(len(y)))
+}
+
+// PinPWaitSemaphoreDeviceIndices pins the Go memory referenced by y with the AutoReleasePool
+// and sets PWaitSemaphoreDeviceIndices, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DeviceGroupSubmitInfo) PinPWaitSemaphoreDeviceIndices(arp *AutoReleasePool, y []uint32) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPWaitSemaphoreDeviceIndices(y)
+}
+
+// CommandBufferCount returns the value of commandBufferCount from VkDeviceGroupSubmitInfo
+func (x DeviceGroupSubmitInfo) CommandBufferCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.commandBufferCount)
+	return *ptr
+}
+
+// WithCommandBufferCount clones a new DeviceGroupSubmitInfo with the value of
+// CommandBufferCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupSubmitInfo) WithCommandBufferCount(y uint32) DeviceGroupSubmitInfo {
+	x.commandBufferCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceGroupSubmitInfo) SetCommandBufferCount(y uint32) {
+	x.commandBufferCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PCommandBufferDeviceMasks returns the value of pCommandBufferDeviceMasks from VkDeviceGroupSubmitInfo
+func (x DeviceGroupSubmitInfo) PCommandBufferDeviceMasks() []uint32 {
+	if x.pCommandBufferDeviceMasks == nil {
+		return nil
+	}
+	return unsafe.Slice((*uint32)(unsafe.Pointer(x.pCommandBufferDeviceMasks)), x.commandBufferCount)
+}
+
+// WithPCommandBufferDeviceMasks clones a new DeviceGroupSubmitInfo with the value of
+// PCommandBufferDeviceMasks updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines CommandBufferCount as the length of this field.
+// CommandBufferCount is updated with the length of the new value.
+func (x DeviceGroupSubmitInfo) WithPCommandBufferDeviceMasks(y []uint32) DeviceGroupSubmitInfo {
+	x.pCommandBufferDeviceMasks = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithCommandBufferCount(uint32(len(y)))
+}
+func (x *DeviceGroupSubmitInfo) SetPCommandBufferDeviceMasks(y []uint32) {
+	x.pCommandBufferDeviceMasks = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetCommandBufferCount(uint32(len(y)))
+}
+
+// PinPCommandBufferDeviceMasks pins the Go memory referenced by y with the AutoReleasePool
+// and sets PCommandBufferDeviceMasks, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DeviceGroupSubmitInfo) PinPCommandBufferDeviceMasks(arp *AutoReleasePool, y []uint32) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPCommandBufferDeviceMasks(y)
+}
+
+// SignalSemaphoreCount returns the value of signalSemaphoreCount from VkDeviceGroupSubmitInfo
+func (x DeviceGroupSubmitInfo) SignalSemaphoreCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.signalSemaphoreCount)
+	return *ptr
+}
+
+// WithSignalSemaphoreCount clones a new DeviceGroupSubmitInfo with the value of
+// SignalSemaphoreCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupSubmitInfo) WithSignalSemaphoreCount(y uint32) DeviceGroupSubmitInfo {
+	x.signalSemaphoreCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceGroupSubmitInfo) SetSignalSemaphoreCount(y uint32) {
+	x.signalSemaphoreCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PSignalSemaphoreDeviceIndices returns the value of pSignalSemaphoreDeviceIndices from VkDeviceGroupSubmitInfo
+func (x DeviceGroupSubmitInfo) PSignalSemaphoreDeviceIndices() []uint32 {
+	if x.pSignalSemaphoreDeviceIndices == nil {
+		return nil
+	}
+	return unsafe.Slice((*uint32)(unsafe.Pointer(x.pSignalSemaphoreDeviceIndices)), x.signalSemaphoreCount)
+}
+
+// WithPSignalSemaphoreDeviceIndices clones a new DeviceGroupSubmitInfo with the value of
+// PSignalSemaphoreDeviceIndices updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines SignalSemaphoreCount as the length of this field.
+// SignalSemaphoreCount is updated with the length of the new value.
+func (x DeviceGroupSubmitInfo) WithPSignalSemaphoreDeviceIndices(y []uint32) DeviceGroupSubmitInfo {
+	x.pSignalSemaphoreDeviceIndices = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithSignalSemaphoreCount(uint32(len(y)))
+}
+func (x *DeviceGroupSubmitInfo) SetPSignalSemaphoreDeviceIndices(y []uint32) {
+	x.pSignalSemaphoreDeviceIndices = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetSignalSemaphoreCount(uint32(len(y)))
+}
+
+// PinPSignalSemaphoreDeviceIndices pins the Go memory referenced by y with the AutoReleasePool
+// and sets PSignalSemaphoreDeviceIndices, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DeviceGroupSubmitInfo) PinPSignalSemaphoreDeviceIndices(arp *AutoReleasePool, y []uint32) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPSignalSemaphoreDeviceIndices(y)
+}
+
+// DeviceGroupCommandBufferBeginInfo provides a go interface for VkDeviceGroupCommandBufferBeginInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDeviceGroupCommandBufferBeginInfo.html
+type DeviceGroupCommandBufferBeginInfo C.struct_VkDeviceGroupCommandBufferBeginInfo
+
+// SizeofDeviceGroupCommandBufferBeginInfo is the memory size of a DeviceGroupCommandBufferBeginInfo
+var SizeofDeviceGroupCommandBufferBeginInfo int = int(unsafe.Sizeof(DeviceGroupCommandBufferBeginInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DeviceGroupCommandBufferBeginInfo) ArpPtr(arp *AutoReleasePool) *DeviceGroupCommandBufferBeginInfo {
+	ptr := newCBlock(cULong(SizeofDeviceGroupCommandBufferBeginInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DeviceGroupCommandBufferBeginInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DeviceGroupCommandBufferBeginInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DeviceGroupCommandBufferBeginInfo) AsCPtr() *DeviceGroupCommandBufferBeginInfo {
+	clone := (*DeviceGroupCommandBufferBeginInfo)(newCBlock(cULong(SizeofDeviceGroupCommandBufferBeginInfo)))
+	*clone = x
+	return clone
+}
+
+// DeviceGroupCommandBufferBeginInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DeviceGroupCommandBufferBeginInfoCSlice(arp *AutoReleasePool, x ...DeviceGroupCommandBufferBeginInfo) []DeviceGroupCommandBufferBeginInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceGroupCommandBufferBeginInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DeviceGroupCommandBufferBeginInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DeviceGroupCommandBufferBeginInfoFreeCSlice releases the memory allocated by DeviceGroupCommandBufferBeginInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DeviceGroupCommandBufferBeginInfoFreeCSlice(x []DeviceGroupCommandBufferBeginInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DeviceGroupCommandBufferBeginInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DeviceGroupCommandBufferBeginInfoFreeCSlice must be called on the returned slice.
+func DeviceGroupCommandBufferBeginInfoMakeCSlice(x ...DeviceGroupCommandBufferBeginInfo) []DeviceGroupCommandBufferBeginInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceGroupCommandBufferBeginInfo * len(x)
+	dst := unsafe.Slice((*DeviceGroupCommandBufferBeginInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDeviceGroupCommandBufferBeginInfo
+func (x DeviceGroupCommandBufferBeginInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DeviceGroupCommandBufferBeginInfo with the value of
+// SType to the value provided in the specification.
+func (x DeviceGroupCommandBufferBeginInfo) WithDefaultSType() DeviceGroupCommandBufferBeginInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DeviceGroupCommandBufferBeginInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO)
+}
+
+// WithSType clones a new DeviceGroupCommandBufferBeginInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupCommandBufferBeginInfo) WithSType(y StructureType) DeviceGroupCommandBufferBeginInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DeviceGroupCommandBufferBeginInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDeviceGroupCommandBufferBeginInfo
+func (x DeviceGroupCommandBufferBeginInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DeviceGroupCommandBufferBeginInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupCommandBufferBeginInfo) WithPNext(y unsafe.Pointer) DeviceGroupCommandBufferBeginInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceGroupCommandBufferBeginInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DeviceGroupCommandBufferBeginInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// DeviceMask returns the value of deviceMask from VkDeviceGroupCommandBufferBeginInfo
+func (x DeviceGroupCommandBufferBeginInfo) DeviceMask() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.deviceMask)
+	return *ptr
+}
+
+// WithDeviceMask clones a new DeviceGroupCommandBufferBeginInfo with the value of
+// DeviceMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupCommandBufferBeginInfo) WithDeviceMask(y uint32) DeviceGroupCommandBufferBeginInfo {
+	x.deviceMask = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceGroupCommandBufferBeginInfo) SetDeviceMask(y uint32) {
+	x.deviceMask = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// BufferMemoryRequirementsInfo2 provides a go interface for VkBufferMemoryRequirementsInfo2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkBufferMemoryRequirementsInfo2.html
+type BufferMemoryRequirementsInfo2 C.struct_VkBufferMemoryRequirementsInfo2
+
+// SizeofBufferMemoryRequirementsInfo2 is the memory size of a BufferMemoryRequirementsInfo2
+var SizeofBufferMemoryRequirementsInfo2 int = int(unsafe.Sizeof(BufferMemoryRequirementsInfo2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x BufferMemoryRequirementsInfo2) ArpPtr(arp *AutoReleasePool) *BufferMemoryRequirementsInfo2 {
+	ptr := newCBlock(cULong(SizeofBufferMemoryRequirementsInfo2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*BufferMemoryRequirementsInfo2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *BufferMemoryRequirementsInfo2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x BufferMemoryRequirementsInfo2) AsCPtr() *BufferMemoryRequirementsInfo2 {
+	clone := (*BufferMemoryRequirementsInfo2)(newCBlock(cULong(SizeofBufferMemoryRequirementsInfo2)))
+	*clone = x
+	return clone
+}
+
+// BufferMemoryRequirementsInfo2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func BufferMemoryRequirementsInfo2CSlice(arp *AutoReleasePool, x ...BufferMemoryRequirementsInfo2) []BufferMemoryRequirementsInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBufferMemoryRequirementsInfo2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*BufferMemoryRequirementsInfo2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// BufferMemoryRequirementsInfo2FreeCSlice releases the memory allocated by BufferMemoryRequirementsInfo2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func BufferMemoryRequirementsInfo2FreeCSlice(x []BufferMemoryRequirementsInfo2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// BufferMemoryRequirementsInfo2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. BufferMemoryRequirementsInfo2FreeCSlice must be called on the returned slice.
+func BufferMemoryRequirementsInfo2MakeCSlice(x ...BufferMemoryRequirementsInfo2) []BufferMemoryRequirementsInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBufferMemoryRequirementsInfo2 * len(x)
+	dst := unsafe.Slice((*BufferMemoryRequirementsInfo2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkBufferMemoryRequirementsInfo2
+func (x BufferMemoryRequirementsInfo2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new BufferMemoryRequirementsInfo2 with the value of
+// SType to the value provided in the specification.
+func (x BufferMemoryRequirementsInfo2) WithDefaultSType() BufferMemoryRequirementsInfo2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *BufferMemoryRequirementsInfo2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_BUFFER_MEMORY_REQUIREMENTS_INFO_2)
+}
+
+// WithSType clones a new BufferMemoryRequirementsInfo2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferMemoryRequirementsInfo2) WithSType(y StructureType) BufferMemoryRequirementsInfo2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *BufferMemoryRequirementsInfo2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkBufferMemoryRequirementsInfo2
+func (x BufferMemoryRequirementsInfo2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new BufferMemoryRequirementsInfo2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferMemoryRequirementsInfo2) WithPNext(y unsafe.Pointer) BufferMemoryRequirementsInfo2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *BufferMemoryRequirementsInfo2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *BufferMemoryRequirementsInfo2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Buffer returns the value of buffer from VkBufferMemoryRequirementsInfo2
+func (x BufferMemoryRequirementsInfo2) Buffer() Buffer {
+	ptr := /* handle */ (*Buffer)(&x.buffer)
+	return *ptr
+}
+
+// WithBuffer clones a new BufferMemoryRequirementsInfo2 with the value of
+// Buffer updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferMemoryRequirementsInfo2) WithBuffer(y Buffer) BufferMemoryRequirementsInfo2 {
+	x.buffer = *( /* handle */ (*C.VkBuffer)(&y))
+	return x
+}
+func (x *BufferMemoryRequirementsInfo2) SetBuffer(y Buffer) {
+	x.buffer = *( /* handle */ (*C.VkBuffer)(&y))
+}
+
+// ImageMemoryRequirementsInfo2 provides a go interface for VkImageMemoryRequirementsInfo2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkImageMemoryRequirementsInfo2.html
+type ImageMemoryRequirementsInfo2 C.struct_VkImageMemoryRequirementsInfo2
+
+// SizeofImageMemoryRequirementsInfo2 is the memory size of a ImageMemoryRequirementsInfo2
+var SizeofImageMemoryRequirementsInfo2 int = int(unsafe.Sizeof(ImageMemoryRequirementsInfo2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ImageMemoryRequirementsInfo2) ArpPtr(arp *AutoReleasePool) *ImageMemoryRequirementsInfo2 {
+	ptr := newCBlock(cULong(SizeofImageMemoryRequirementsInfo2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ImageMemoryRequirementsInfo2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ImageMemoryRequirementsInfo2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ImageMemoryRequirementsInfo2) AsCPtr() *ImageMemoryRequirementsInfo2 {
+	clone := (*ImageMemoryRequirementsInfo2)(newCBlock(cULong(SizeofImageMemoryRequirementsInfo2)))
+	*clone = x
+	return clone
+}
+
+// ImageMemoryRequirementsInfo2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ImageMemoryRequirementsInfo2CSlice(arp *AutoReleasePool, x ...ImageMemoryRequirementsInfo2) []ImageMemoryRequirementsInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImageMemoryRequirementsInfo2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ImageMemoryRequirementsInfo2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ImageMemoryRequirementsInfo2FreeCSlice releases the memory allocated by ImageMemoryRequirementsInfo2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func ImageMemoryRequirementsInfo2FreeCSlice(x []ImageMemoryRequirementsInfo2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ImageMemoryRequirementsInfo2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ImageMemoryRequirementsInfo2FreeCSlice must be called on the returned slice.
+func ImageMemoryRequirementsInfo2MakeCSlice(x ...ImageMemoryRequirementsInfo2) []ImageMemoryRequirementsInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImageMemoryRequirementsInfo2 * len(x)
+	dst := unsafe.Slice((*ImageMemoryRequirementsInfo2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkImageMemoryRequirementsInfo2
+func (x ImageMemoryRequirementsInfo2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ImageMemoryRequirementsInfo2 with the value of
+// SType to the value provided in the specification.
+func (x ImageMemoryRequirementsInfo2) WithDefaultSType() ImageMemoryRequirementsInfo2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ImageMemoryRequirementsInfo2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_IMAGE_MEMORY_REQUIREMENTS_INFO_2)
+}
+
+// WithSType clones a new ImageMemoryRequirementsInfo2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageMemoryRequirementsInfo2) WithSType(y StructureType) ImageMemoryRequirementsInfo2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ImageMemoryRequirementsInfo2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkImageMemoryRequirementsInfo2
+func (x ImageMemoryRequirementsInfo2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ImageMemoryRequirementsInfo2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageMemoryRequirementsInfo2) WithPNext(y unsafe.Pointer) ImageMemoryRequirementsInfo2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ImageMemoryRequirementsInfo2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ImageMemoryRequirementsInfo2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Image returns the value of image from VkImageMemoryRequirementsInfo2
+func (x ImageMemoryRequirementsInfo2) Image() Image {
+	ptr := /* handle */ (*Image)(&x.image)
+	return *ptr
+}
+
+// WithImage clones a new ImageMemoryRequirementsInfo2 with the value of
+// Image updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageMemoryRequirementsInfo2) WithImage(y Image) ImageMemoryRequirementsInfo2 {
+	x.image = *( /* handle */ (*C.VkImage)(&y))
+	return x
+}
+func (x *ImageMemoryRequirementsInfo2) SetImage(y Image) {
+	x.image = *( /* handle */ (*C.VkImage)(&y))
+}
+
+// ImageSparseMemoryRequirementsInfo2 provides a go interface for VkImageSparseMemoryRequirementsInfo2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkImageSparseMemoryRequirementsInfo2.html
+type ImageSparseMemoryRequirementsInfo2 C.struct_VkImageSparseMemoryRequirementsInfo2
+
+// SizeofImageSparseMemoryRequirementsInfo2 is the memory size of a ImageSparseMemoryRequirementsInfo2
+var SizeofImageSparseMemoryRequirementsInfo2 int = int(unsafe.Sizeof(ImageSparseMemoryRequirementsInfo2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ImageSparseMemoryRequirementsInfo2) ArpPtr(arp *AutoReleasePool) *ImageSparseMemoryRequirementsInfo2 {
+	ptr := newCBlock(cULong(SizeofImageSparseMemoryRequirementsInfo2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ImageSparseMemoryRequirementsInfo2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ImageSparseMemoryRequirementsInfo2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ImageSparseMemoryRequirementsInfo2) AsCPtr() *ImageSparseMemoryRequirementsInfo2 {
+	clone := (*ImageSparseMemoryRequirementsInfo2)(newCBlock(cULong(SizeofImageSparseMemoryRequirementsInfo2)))
+	*clone = x
+	return clone
+}
+
+// ImageSparseMemoryRequirementsInfo2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ImageSparseMemoryRequirementsInfo2CSlice(arp *AutoReleasePool, x ...ImageSparseMemoryRequirementsInfo2) []ImageSparseMemoryRequirementsInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImageSparseMemoryRequirementsInfo2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ImageSparseMemoryRequirementsInfo2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ImageSparseMemoryRequirementsInfo2FreeCSlice releases the memory allocated by ImageSparseMemoryRequirementsInfo2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func ImageSparseMemoryRequirementsInfo2FreeCSlice(x []ImageSparseMemoryRequirementsInfo2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ImageSparseMemoryRequirementsInfo2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ImageSparseMemoryRequirementsInfo2FreeCSlice must be called on the returned slice.
+func ImageSparseMemoryRequirementsInfo2MakeCSlice(x ...ImageSparseMemoryRequirementsInfo2) []ImageSparseMemoryRequirementsInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImageSparseMemoryRequirementsInfo2 * len(x)
+	dst := unsafe.Slice((*ImageSparseMemoryRequirementsInfo2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkImageSparseMemoryRequirementsInfo2
+func (x ImageSparseMemoryRequirementsInfo2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ImageSparseMemoryRequirementsInfo2 with the value of
+// SType to the value provided in the specification.
+func (x ImageSparseMemoryRequirementsInfo2) WithDefaultSType() ImageSparseMemoryRequirementsInfo2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_IMAGE_SPARSE_MEMORY_REQUIREMENTS_INFO_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ImageSparseMemoryRequirementsInfo2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_IMAGE_SPARSE_MEMORY_REQUIREMENTS_INFO_2)
+}
+
+// WithSType clones a new ImageSparseMemoryRequirementsInfo2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageSparseMemoryRequirementsInfo2) WithSType(y StructureType) ImageSparseMemoryRequirementsInfo2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ImageSparseMemoryRequirementsInfo2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkImageSparseMemoryRequirementsInfo2
+func (x ImageSparseMemoryRequirementsInfo2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ImageSparseMemoryRequirementsInfo2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageSparseMemoryRequirementsInfo2) WithPNext(y unsafe.Pointer) ImageSparseMemoryRequirementsInfo2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ImageSparseMemoryRequirementsInfo2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ImageSparseMemoryRequirementsInfo2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Image returns the value of image from VkImageSparseMemoryRequirementsInfo2
+func (x ImageSparseMemoryRequirementsInfo2) Image() Image {
+	ptr := /* handle */ (*Image)(&x.image)
+	return *ptr
+}
+
+// WithImage clones a new ImageSparseMemoryRequirementsInfo2 with the value of
+// Image updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageSparseMemoryRequirementsInfo2) WithImage(y Image) ImageSparseMemoryRequirementsInfo2 {
+	x.image = *( /* handle */ (*C.VkImage)(&y))
+	return x
+}
+func (x *ImageSparseMemoryRequirementsInfo2) SetImage(y Image) {
+	x.image = *( /* handle */ (*C.VkImage)(&y))
+}
+
+// MemoryRequirements2 provides a go interface for VkMemoryRequirements2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkMemoryRequirements2.html
+type MemoryRequirements2 C.struct_VkMemoryRequirements2
+
+// SizeofMemoryRequirements2 is the memory size of a MemoryRequirements2
+var SizeofMemoryRequirements2 int = int(unsafe.Sizeof(MemoryRequirements2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x MemoryRequirements2) ArpPtr(arp *AutoReleasePool) *MemoryRequirements2 {
+	ptr := newCBlock(cULong(SizeofMemoryRequirements2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*MemoryRequirements2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *MemoryRequirements2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x MemoryRequirements2) AsCPtr() *MemoryRequirements2 {
+	clone := (*MemoryRequirements2)(newCBlock(cULong(SizeofMemoryRequirements2)))
+	*clone = x
+	return clone
+}
+
+// MemoryRequirements2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func MemoryRequirements2CSlice(arp *AutoReleasePool, x ...MemoryRequirements2) []MemoryRequirements2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofMemoryRequirements2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*MemoryRequirements2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// MemoryRequirements2FreeCSlice releases the memory allocated by MemoryRequirements2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func MemoryRequirements2FreeCSlice(x []MemoryRequirements2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// MemoryRequirements2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. MemoryRequirements2FreeCSlice must be called on the returned slice.
+func MemoryRequirements2MakeCSlice(x ...MemoryRequirements2) []MemoryRequirements2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofMemoryRequirements2 * len(x)
+	dst := unsafe.Slice((*MemoryRequirements2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkMemoryRequirements2
+func (x MemoryRequirements2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new MemoryRequirements2 with the value of
+// SType to the value provided in the specification.
+func (x MemoryRequirements2) WithDefaultSType() MemoryRequirements2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *MemoryRequirements2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_MEMORY_REQUIREMENTS_2)
+}
+
+// WithSType clones a new MemoryRequirements2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryRequirements2) WithSType(y StructureType) MemoryRequirements2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *MemoryRequirements2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkMemoryRequirements2
+func (x MemoryRequirements2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new MemoryRequirements2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryRequirements2) WithPNext(y unsafe.Pointer) MemoryRequirements2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *MemoryRequirements2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *MemoryRequirements2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// MemoryRequirements returns the value of memoryRequirements from VkMemoryRequirements2
+func (x MemoryRequirements2) MemoryRequirements() MemoryRequirements {
+	ptr := /* typedef */ (*MemoryRequirements)(&x.memoryRequirements)
+	return *ptr
+}
+
+// SparseImageMemoryRequirements2 provides a go interface for VkSparseImageMemoryRequirements2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSparseImageMemoryRequirements2.html
+type SparseImageMemoryRequirements2 C.struct_VkSparseImageMemoryRequirements2
+
+// SizeofSparseImageMemoryRequirements2 is the memory size of a SparseImageMemoryRequirements2
+var SizeofSparseImageMemoryRequirements2 int = int(unsafe.Sizeof(SparseImageMemoryRequirements2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SparseImageMemoryRequirements2) ArpPtr(arp *AutoReleasePool) *SparseImageMemoryRequirements2 {
+	ptr := newCBlock(cULong(SizeofSparseImageMemoryRequirements2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SparseImageMemoryRequirements2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SparseImageMemoryRequirements2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SparseImageMemoryRequirements2) AsCPtr() *SparseImageMemoryRequirements2 {
+	clone := (*SparseImageMemoryRequirements2)(newCBlock(cULong(SizeofSparseImageMemoryRequirements2)))
+	*clone = x
+	return clone
+}
+
+// SparseImageMemoryRequirements2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SparseImageMemoryRequirements2CSlice(arp *AutoReleasePool, x ...SparseImageMemoryRequirements2) []SparseImageMemoryRequirements2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSparseImageMemoryRequirements2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SparseImageMemoryRequirements2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SparseImageMemoryRequirements2FreeCSlice releases the memory allocated by SparseImageMemoryRequirements2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func SparseImageMemoryRequirements2FreeCSlice(x []SparseImageMemoryRequirements2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SparseImageMemoryRequirements2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SparseImageMemoryRequirements2FreeCSlice must be called on the returned slice.
+func SparseImageMemoryRequirements2MakeCSlice(x ...SparseImageMemoryRequirements2) []SparseImageMemoryRequirements2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSparseImageMemoryRequirements2 * len(x)
+	dst := unsafe.Slice((*SparseImageMemoryRequirements2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkSparseImageMemoryRequirements2
+func (x SparseImageMemoryRequirements2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new SparseImageMemoryRequirements2 with the value of
+// SType to the value provided in the specification.
+func (x SparseImageMemoryRequirements2) WithDefaultSType() SparseImageMemoryRequirements2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_SPARSE_IMAGE_MEMORY_REQUIREMENTS_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *SparseImageMemoryRequirements2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_SPARSE_IMAGE_MEMORY_REQUIREMENTS_2)
+}
+
+// WithSType clones a new SparseImageMemoryRequirements2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SparseImageMemoryRequirements2) WithSType(y StructureType) SparseImageMemoryRequirements2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *SparseImageMemoryRequirements2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkSparseImageMemoryRequirements2
+func (x SparseImageMemoryRequirements2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new SparseImageMemoryRequirements2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SparseImageMemoryRequirements2) WithPNext(y unsafe.Pointer) SparseImageMemoryRequirements2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *SparseImageMemoryRequirements2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SparseImageMemoryRequirements2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// MemoryRequirements returns the value of memoryRequirements from VkSparseImageMemoryRequirements2
+func (x SparseImageMemoryRequirements2) MemoryRequirements() SparseImageMemoryRequirements {
+	ptr := /* typedef */ (*SparseImageMemoryRequirements)(&x.memoryRequirements)
+	return *ptr
+}
+
+// BindImageMemoryInfo provides a go interface for VkBindImageMemoryInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkBindImageMemoryInfo.html
+type BindImageMemoryInfo C.struct_VkBindImageMemoryInfo
+
+// SizeofBindImageMemoryInfo is the memory size of a BindImageMemoryInfo
+var SizeofBindImageMemoryInfo int = int(unsafe.Sizeof(BindImageMemoryInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x BindImageMemoryInfo) ArpPtr(arp *AutoReleasePool) *BindImageMemoryInfo {
+	ptr := newCBlock(cULong(SizeofBindImageMemoryInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*BindImageMemoryInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *BindImageMemoryInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x BindImageMemoryInfo) AsCPtr() *BindImageMemoryInfo {
+	clone := (*BindImageMemoryInfo)(newCBlock(cULong(SizeofBindImageMemoryInfo)))
+	*clone = x
+	return clone
+}
+
+// BindImageMemoryInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func BindImageMemoryInfoCSlice(arp *AutoReleasePool, x ...BindImageMemoryInfo) []BindImageMemoryInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBindImageMemoryInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*BindImageMemoryInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// BindImageMemoryInfoFreeCSlice releases the memory allocated by BindImageMemoryInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func BindImageMemoryInfoFreeCSlice(x []BindImageMemoryInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// BindImageMemoryInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. BindImageMemoryInfoFreeCSlice must be called on the returned slice.
+func BindImageMemoryInfoMakeCSlice(x ...BindImageMemoryInfo) []BindImageMemoryInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBindImageMemoryInfo * len(x)
+	dst := unsafe.Slice((*BindImageMemoryInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkBindImageMemoryInfo
+func (x BindImageMemoryInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new BindImageMemoryInfo with the value of
+// SType to the value provided in the specification.
+func (x BindImageMemoryInfo) WithDefaultSType() BindImageMemoryInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *BindImageMemoryInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_INFO)
+}
+
+// WithSType clones a new BindImageMemoryInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindImageMemoryInfo) WithSType(y StructureType) BindImageMemoryInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *BindImageMemoryInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkBindImageMemoryInfo
+func (x BindImageMemoryInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new BindImageMemoryInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindImageMemoryInfo) WithPNext(y unsafe.Pointer) BindImageMemoryInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *BindImageMemoryInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *BindImageMemoryInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Image returns the value of image from VkBindImageMemoryInfo
+func (x BindImageMemoryInfo) Image() Image {
+	ptr := /* handle */ (*Image)(&x.image)
+	return *ptr
+}
+
+// WithImage clones a new BindImageMemoryInfo with the value of
+// Image updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindImageMemoryInfo) WithImage(y Image) BindImageMemoryInfo {
+	x.image = *( /* handle */ (*C.VkImage)(&y))
+	return x
+}
+func (x *BindImageMemoryInfo) SetImage(y Image) {
+	x.image = *( /* handle */ (*C.VkImage)(&y))
+}
+
+// Memory returns the value of memory from VkBindImageMemoryInfo
+func (x BindImageMemoryInfo) Memory() DeviceMemory {
+	ptr := /* handle */ (*DeviceMemory)(&x.memory)
+	return *ptr
+}
+
+// WithMemory clones a new BindImageMemoryInfo with the value of
+// Memory updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindImageMemoryInfo) WithMemory(y DeviceMemory) BindImageMemoryInfo {
+	x.memory = *( /* handle */ (*C.VkDeviceMemory)(&y))
+	return x
+}
+func (x *BindImageMemoryInfo) SetMemory(y DeviceMemory) {
+	x.memory = *( /* handle */ (*C.VkDeviceMemory)(&y))
+}
+
+// MemoryOffset returns the value of memoryOffset from VkBindImageMemoryInfo
+func (x BindImageMemoryInfo) MemoryOffset() DeviceSize {
+	ptr := /* typedef */ (*DeviceSize)(&x.memoryOffset)
+	return *ptr
+}
+
+// WithMemoryOffset clones a new BindImageMemoryInfo with the value of
+// MemoryOffset updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindImageMemoryInfo) WithMemoryOffset(y DeviceSize) BindImageMemoryInfo {
+	x.memoryOffset = *( /* typedef */ (*C.VkDeviceSize)(&y))
+	return x
+}
+func (x *BindImageMemoryInfo) SetMemoryOffset(y DeviceSize) {
+	x.memoryOffset = *( /* typedef */ (*C.VkDeviceSize)(&y))
+}
+
+// PhysicalDeviceExternalBufferInfo provides a go interface for VkPhysicalDeviceExternalBufferInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceExternalBufferInfo.html
+type PhysicalDeviceExternalBufferInfo C.struct_VkPhysicalDeviceExternalBufferInfo
+
+// SizeofPhysicalDeviceExternalBufferInfo is the memory size of a PhysicalDeviceExternalBufferInfo
+var SizeofPhysicalDeviceExternalBufferInfo int = int(unsafe.Sizeof(PhysicalDeviceExternalBufferInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceExternalBufferInfo) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceExternalBufferInfo {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceExternalBufferInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceExternalBufferInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceExternalBufferInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceExternalBufferInfo) AsCPtr() *PhysicalDeviceExternalBufferInfo {
+	clone := (*PhysicalDeviceExternalBufferInfo)(newCBlock(cULong(SizeofPhysicalDeviceExternalBufferInfo)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceExternalBufferInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceExternalBufferInfoCSlice(arp *AutoReleasePool, x ...PhysicalDeviceExternalBufferInfo) []PhysicalDeviceExternalBufferInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceExternalBufferInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceExternalBufferInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceExternalBufferInfoFreeCSlice releases the memory allocated by PhysicalDeviceExternalBufferInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceExternalBufferInfoFreeCSlice(x []PhysicalDeviceExternalBufferInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceExternalBufferInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceExternalBufferInfoFreeCSlice must be called on the returned slice.
+func PhysicalDeviceExternalBufferInfoMakeCSlice(x ...PhysicalDeviceExternalBufferInfo) []PhysicalDeviceExternalBufferInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceExternalBufferInfo * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceExternalBufferInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceExternalBufferInfo
+func (x PhysicalDeviceExternalBufferInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceExternalBufferInfo with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceExternalBufferInfo) WithDefaultSType() PhysicalDeviceExternalBufferInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_BUFFER_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceExternalBufferInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_BUFFER_INFO)
+}
+
+// WithSType clones a new PhysicalDeviceExternalBufferInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceExternalBufferInfo) WithSType(y StructureType) PhysicalDeviceExternalBufferInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceExternalBufferInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceExternalBufferInfo
+func (x PhysicalDeviceExternalBufferInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceExternalBufferInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceExternalBufferInfo) WithPNext(y unsafe.Pointer) PhysicalDeviceExternalBufferInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceExternalBufferInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceExternalBufferInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Flags returns the value of flags from VkPhysicalDeviceExternalBufferInfo
+func (x PhysicalDeviceExternalBufferInfo) Flags() BufferCreateFlags {
+	ptr := /* typedef */ (*BufferCreateFlags)(&x.flags)
+	return *ptr
+}
+
+// WithFlags clones a new PhysicalDeviceExternalBufferInfo with the value of
+// Flags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceExternalBufferInfo) WithFlags(y BufferCreateFlags) PhysicalDeviceExternalBufferInfo {
+	x.flags = *( /* typedef */ (*C.VkBufferCreateFlags)(&y))
+	return x
+}
+func (x *PhysicalDeviceExternalBufferInfo) SetFlags(y BufferCreateFlags) {
+	x.flags = *( /* typedef */ (*C.VkBufferCreateFlags)(&y))
+}
+
+// Usage returns the value of usage from VkPhysicalDeviceExternalBufferInfo
+func (x PhysicalDeviceExternalBufferInfo) Usage() BufferUsageFlags {
+	ptr := /* typedef */ (*BufferUsageFlags)(&x.usage)
+	return *ptr
+}
+
+// WithUsage clones a new PhysicalDeviceExternalBufferInfo with the value of
+// Usage updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceExternalBufferInfo) WithUsage(y BufferUsageFlags) PhysicalDeviceExternalBufferInfo {
+	x.usage = *( /* typedef */ (*C.VkBufferUsageFlags)(&y))
+	return x
+}
+func (x *PhysicalDeviceExternalBufferInfo) SetUsage(y BufferUsageFlags) {
+	x.usage = *( /* typedef */ (*C.VkBufferUsageFlags)(&y))
+}
+
+// HandleType returns the value of handleType from VkPhysicalDeviceExternalBufferInfo
+func (x PhysicalDeviceExternalBufferInfo) HandleType() ExternalMemoryHandleTypeFlagBits {
+	ptr := /* typedef */ (*ExternalMemoryHandleTypeFlagBits)(&x.handleType)
+	return *ptr
+}
+
+// WithHandleType clones a new PhysicalDeviceExternalBufferInfo with the value of
+// HandleType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceExternalBufferInfo) WithHandleType(y ExternalMemoryHandleTypeFlagBits) PhysicalDeviceExternalBufferInfo {
+	x.handleType = *( /* typedef */ (*C.VkExternalMemoryHandleTypeFlagBits)(&y))
+	return x
+}
+func (x *PhysicalDeviceExternalBufferInfo) SetHandleType(y ExternalMemoryHandleTypeFlagBits) {
+	x.handleType = *( /* typedef */ (*C.VkExternalMemoryHandleTypeFlagBits)(&y))
+}
+
+// PhysicalDeviceSamplerYcbcrConversionFeatures provides a go interface for VkPhysicalDeviceSamplerYcbcrConversionFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceSamplerYcbcrConversionFeatures.html
+type PhysicalDeviceSamplerYcbcrConversionFeatures C.struct_VkPhysicalDeviceSamplerYcbcrConversionFeatures
+
+// SizeofPhysicalDeviceSamplerYcbcrConversionFeatures is the memory size of a PhysicalDeviceSamplerYcbcrConversionFeatures
+var SizeofPhysicalDeviceSamplerYcbcrConversionFeatures int = int(unsafe.Sizeof(PhysicalDeviceSamplerYcbcrConversionFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceSamplerYcbcrConversionFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceSamplerYcbcrConversionFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceSamplerYcbcrConversionFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceSamplerYcbcrConversionFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceSamplerYcbcrConversionFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceSamplerYcbcrConversionFeatures) AsCPtr() *PhysicalDeviceSamplerYcbcrConversionFeatures {
+	clone := (*PhysicalDeviceSamplerYcbcrConversionFeatures)(newCBlock(cULong(SizeofPhysicalDeviceSamplerYcbcrConversionFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceSamplerYcbcrConversionFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceSamplerYcbcrConversionFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceSamplerYcbcrConversionFeatures) []PhysicalDeviceSamplerYcbcrConversionFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceSamplerYcbcrConversionFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceSamplerYcbcrConversionFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceSamplerYcbcrConversionFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceSamplerYcbcrConversionFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceSamplerYcbcrConversionFeaturesFreeCSlice(x []PhysicalDeviceSamplerYcbcrConversionFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceSamplerYcbcrConversionFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceSamplerYcbcrConversionFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceSamplerYcbcrConversionFeaturesMakeCSlice(x ...PhysicalDeviceSamplerYcbcrConversionFeatures) []PhysicalDeviceSamplerYcbcrConversionFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceSamplerYcbcrConversionFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceSamplerYcbcrConversionFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceSamplerYcbcrConversionFeatures
+func (x PhysicalDeviceSamplerYcbcrConversionFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceSamplerYcbcrConversionFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceSamplerYcbcrConversionFeatures) WithDefaultSType() PhysicalDeviceSamplerYcbcrConversionFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceSamplerYcbcrConversionFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceSamplerYcbcrConversionFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSamplerYcbcrConversionFeatures) WithSType(y StructureType) PhysicalDeviceSamplerYcbcrConversionFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceSamplerYcbcrConversionFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceSamplerYcbcrConversionFeatures
+func (x PhysicalDeviceSamplerYcbcrConversionFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceSamplerYcbcrConversionFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSamplerYcbcrConversionFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceSamplerYcbcrConversionFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceSamplerYcbcrConversionFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceSamplerYcbcrConversionFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SamplerYcbcrConversion returns the value of samplerYcbcrConversion from VkPhysicalDeviceSamplerYcbcrConversionFeatures
+func (x PhysicalDeviceSamplerYcbcrConversionFeatures) SamplerYcbcrConversion() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.samplerYcbcrConversion)
+	return *ptr
+}
+
+// WithSamplerYcbcrConversion clones a new PhysicalDeviceSamplerYcbcrConversionFeatures with the value of
+// SamplerYcbcrConversion updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSamplerYcbcrConversionFeatures) WithSamplerYcbcrConversion(y Bool32) PhysicalDeviceSamplerYcbcrConversionFeatures {
+	x.samplerYcbcrConversion = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceSamplerYcbcrConversionFeatures) SetSamplerYcbcrConversion(y Bool32) {
+	x.samplerYcbcrConversion = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ImagePlaneMemoryRequirementsInfo provides a go interface for VkImagePlaneMemoryRequirementsInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkImagePlaneMemoryRequirementsInfo.html
+type ImagePlaneMemoryRequirementsInfo C.struct_VkImagePlaneMemoryRequirementsInfo
+
+// SizeofImagePlaneMemoryRequirementsInfo is the memory size of a ImagePlaneMemoryRequirementsInfo
+var SizeofImagePlaneMemoryRequirementsInfo int = int(unsafe.Sizeof(ImagePlaneMemoryRequirementsInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ImagePlaneMemoryRequirementsInfo) ArpPtr(arp *AutoReleasePool) *ImagePlaneMemoryRequirementsInfo {
+	ptr := newCBlock(cULong(SizeofImagePlaneMemoryRequirementsInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ImagePlaneMemoryRequirementsInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ImagePlaneMemoryRequirementsInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ImagePlaneMemoryRequirementsInfo) AsCPtr() *ImagePlaneMemoryRequirementsInfo {
+	clone := (*ImagePlaneMemoryRequirementsInfo)(newCBlock(cULong(SizeofImagePlaneMemoryRequirementsInfo)))
+	*clone = x
+	return clone
+}
+
+// ImagePlaneMemoryRequirementsInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ImagePlaneMemoryRequirementsInfoCSlice(arp *AutoReleasePool, x ...ImagePlaneMemoryRequirementsInfo) []ImagePlaneMemoryRequirementsInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImagePlaneMemoryRequirementsInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ImagePlaneMemoryRequirementsInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ImagePlaneMemoryRequirementsInfoFreeCSlice releases the memory allocated by ImagePlaneMemoryRequirementsInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func ImagePlaneMemoryRequirementsInfoFreeCSlice(x []ImagePlaneMemoryRequirementsInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ImagePlaneMemoryRequirementsInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ImagePlaneMemoryRequirementsInfoFreeCSlice must be called on the returned slice.
+func ImagePlaneMemoryRequirementsInfoMakeCSlice(x ...ImagePlaneMemoryRequirementsInfo) []ImagePlaneMemoryRequirementsInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImagePlaneMemoryRequirementsInfo * len(x)
+	dst := unsafe.Slice((*ImagePlaneMemoryRequirementsInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkImagePlaneMemoryRequirementsInfo
+func (x ImagePlaneMemoryRequirementsInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ImagePlaneMemoryRequirementsInfo with the value of
+// SType to the value provided in the specification.
+func (x ImagePlaneMemoryRequirementsInfo) WithDefaultSType() ImagePlaneMemoryRequirementsInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ImagePlaneMemoryRequirementsInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO)
+}
+
+// WithSType clones a new ImagePlaneMemoryRequirementsInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImagePlaneMemoryRequirementsInfo) WithSType(y StructureType) ImagePlaneMemoryRequirementsInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ImagePlaneMemoryRequirementsInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkImagePlaneMemoryRequirementsInfo
+func (x ImagePlaneMemoryRequirementsInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ImagePlaneMemoryRequirementsInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImagePlaneMemoryRequirementsInfo) WithPNext(y unsafe.Pointer) ImagePlaneMemoryRequirementsInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ImagePlaneMemoryRequirementsInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ImagePlaneMemoryRequirementsInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// PlaneAspect returns the value of planeAspect from VkImagePlaneMemoryRequirementsInfo
+func (x ImagePlaneMemoryRequirementsInfo) PlaneAspect() ImageAspectFlagBits {
+	ptr := /* typedef */ (*ImageAspectFlagBits)(&x.planeAspect)
+	return *ptr
+}
+
+// WithPlaneAspect clones a new ImagePlaneMemoryRequirementsInfo with the value of
+// PlaneAspect updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImagePlaneMemoryRequirementsInfo) WithPlaneAspect(y ImageAspectFlagBits) ImagePlaneMemoryRequirementsInfo {
+	x.planeAspect = *( /* typedef */ (*C.VkImageAspectFlagBits)(&y))
+	return x
+}
+func (x *ImagePlaneMemoryRequirementsInfo) SetPlaneAspect(y ImageAspectFlagBits) {
+	x.planeAspect = *( /* typedef */ (*C.VkImageAspectFlagBits)(&y))
+}
+
+// BindImagePlaneMemoryInfo provides a go interface for VkBindImagePlaneMemoryInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkBindImagePlaneMemoryInfo.html
+type BindImagePlaneMemoryInfo C.struct_VkBindImagePlaneMemoryInfo
+
+// SizeofBindImagePlaneMemoryInfo is the memory size of a BindImagePlaneMemoryInfo
+var SizeofBindImagePlaneMemoryInfo int = int(unsafe.Sizeof(BindImagePlaneMemoryInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x BindImagePlaneMemoryInfo) ArpPtr(arp *AutoReleasePool) *BindImagePlaneMemoryInfo {
+	ptr := newCBlock(cULong(SizeofBindImagePlaneMemoryInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*BindImagePlaneMemoryInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *BindImagePlaneMemoryInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x BindImagePlaneMemoryInfo) AsCPtr() *BindImagePlaneMemoryInfo {
+	clone := (*BindImagePlaneMemoryInfo)(newCBlock(cULong(SizeofBindImagePlaneMemoryInfo)))
+	*clone = x
+	return clone
+}
+
+// BindImagePlaneMemoryInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func BindImagePlaneMemoryInfoCSlice(arp *AutoReleasePool, x ...BindImagePlaneMemoryInfo) []BindImagePlaneMemoryInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBindImagePlaneMemoryInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*BindImagePlaneMemoryInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// BindImagePlaneMemoryInfoFreeCSlice releases the memory allocated by BindImagePlaneMemoryInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func BindImagePlaneMemoryInfoFreeCSlice(x []BindImagePlaneMemoryInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// BindImagePlaneMemoryInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. BindImagePlaneMemoryInfoFreeCSlice must be called on the returned slice.
+func BindImagePlaneMemoryInfoMakeCSlice(x ...BindImagePlaneMemoryInfo) []BindImagePlaneMemoryInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBindImagePlaneMemoryInfo * len(x)
+	dst := unsafe.Slice((*BindImagePlaneMemoryInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkBindImagePlaneMemoryInfo
+func (x BindImagePlaneMemoryInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new BindImagePlaneMemoryInfo with the value of
+// SType to the value provided in the specification.
+func (x BindImagePlaneMemoryInfo) WithDefaultSType() BindImagePlaneMemoryInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *BindImagePlaneMemoryInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO)
+}
+
+// WithSType clones a new BindImagePlaneMemoryInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindImagePlaneMemoryInfo) WithSType(y StructureType) BindImagePlaneMemoryInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *BindImagePlaneMemoryInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkBindImagePlaneMemoryInfo
+func (x BindImagePlaneMemoryInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new BindImagePlaneMemoryInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindImagePlaneMemoryInfo) WithPNext(y unsafe.Pointer) BindImagePlaneMemoryInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *BindImagePlaneMemoryInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *BindImagePlaneMemoryInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// PlaneAspect returns the value of planeAspect from VkBindImagePlaneMemoryInfo
+func (x BindImagePlaneMemoryInfo) PlaneAspect() ImageAspectFlagBits {
+	ptr := /* typedef */ (*ImageAspectFlagBits)(&x.planeAspect)
+	return *ptr
+}
+
+// WithPlaneAspect clones a new BindImagePlaneMemoryInfo with the value of
+// PlaneAspect updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindImagePlaneMemoryInfo) WithPlaneAspect(y ImageAspectFlagBits) BindImagePlaneMemoryInfo {
+	x.planeAspect = *( /* typedef */ (*C.VkImageAspectFlagBits)(&y))
+	return x
+}
+func (x *BindImagePlaneMemoryInfo) SetPlaneAspect(y ImageAspectFlagBits) {
+	x.planeAspect = *( /* typedef */ (*C.VkImageAspectFlagBits)(&y))
+}
+
+// ExternalSemaphoreProperties provides a go interface for VkExternalSemaphoreProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkExternalSemaphoreProperties.html
+type ExternalSemaphoreProperties C.struct_VkExternalSemaphoreProperties
+
+// SizeofExternalSemaphoreProperties is the memory size of a ExternalSemaphoreProperties
+var SizeofExternalSemaphoreProperties int = int(unsafe.Sizeof(ExternalSemaphoreProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ExternalSemaphoreProperties) ArpPtr(arp *AutoReleasePool) *ExternalSemaphoreProperties {
+	ptr := newCBlock(cULong(SizeofExternalSemaphoreProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ExternalSemaphoreProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ExternalSemaphoreProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ExternalSemaphoreProperties) AsCPtr() *ExternalSemaphoreProperties {
+	clone := (*ExternalSemaphoreProperties)(newCBlock(cULong(SizeofExternalSemaphoreProperties)))
+	*clone = x
+	return clone
+}
+
+// ExternalSemaphorePropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ExternalSemaphorePropertiesCSlice(arp *AutoReleasePool, x ...ExternalSemaphoreProperties) []ExternalSemaphoreProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofExternalSemaphoreProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ExternalSemaphoreProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ExternalSemaphorePropertiesFreeCSlice releases the memory allocated by ExternalSemaphorePropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func ExternalSemaphorePropertiesFreeCSlice(x []ExternalSemaphoreProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ExternalSemaphorePropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ExternalSemaphorePropertiesFreeCSlice must be called on the returned slice.
+func ExternalSemaphorePropertiesMakeCSlice(x ...ExternalSemaphoreProperties) []ExternalSemaphoreProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofExternalSemaphoreProperties * len(x)
+	dst := unsafe.Slice((*ExternalSemaphoreProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkExternalSemaphoreProperties
+func (x ExternalSemaphoreProperties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ExternalSemaphoreProperties with the value of
+// SType to the value provided in the specification.
+func (x ExternalSemaphoreProperties) WithDefaultSType() ExternalSemaphoreProperties {
+	return x.WithSType(VK_STRUCTURE_TYPE_EXTERNAL_SEMAPHORE_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ExternalSemaphoreProperties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_EXTERNAL_SEMAPHORE_PROPERTIES)
+}
+
+// WithSType clones a new ExternalSemaphoreProperties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExternalSemaphoreProperties) WithSType(y StructureType) ExternalSemaphoreProperties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ExternalSemaphoreProperties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkExternalSemaphoreProperties
+func (x ExternalSemaphoreProperties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ExternalSemaphoreProperties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExternalSemaphoreProperties) WithPNext(y unsafe.Pointer) ExternalSemaphoreProperties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ExternalSemaphoreProperties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ExternalSemaphoreProperties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ExportFromImportedHandleTypes returns the value of exportFromImportedHandleTypes from VkExternalSemaphoreProperties
+func (x ExternalSemaphoreProperties) ExportFromImportedHandleTypes() ExternalSemaphoreHandleTypeFlags {
+	ptr := /* typedef */ (*ExternalSemaphoreHandleTypeFlags)(&x.exportFromImportedHandleTypes)
+	return *ptr
+}
+
+// CompatibleHandleTypes returns the value of compatibleHandleTypes from VkExternalSemaphoreProperties
+func (x ExternalSemaphoreProperties) CompatibleHandleTypes() ExternalSemaphoreHandleTypeFlags {
+	ptr := /* typedef */ (*ExternalSemaphoreHandleTypeFlags)(&x.compatibleHandleTypes)
+	return *ptr
+}
+
+// ExternalSemaphoreFeatures returns the value of externalSemaphoreFeatures from VkExternalSemaphoreProperties
+func (x ExternalSemaphoreProperties) ExternalSemaphoreFeatures() ExternalSemaphoreFeatureFlags {
+	ptr := /* typedef */ (*ExternalSemaphoreFeatureFlags)(&x.externalSemaphoreFeatures)
+	return *ptr
+}
+
+// PhysicalDeviceExternalSemaphoreInfo provides a go interface for VkPhysicalDeviceExternalSemaphoreInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceExternalSemaphoreInfo.html
+type PhysicalDeviceExternalSemaphoreInfo C.struct_VkPhysicalDeviceExternalSemaphoreInfo
+
+// SizeofPhysicalDeviceExternalSemaphoreInfo is the memory size of a PhysicalDeviceExternalSemaphoreInfo
+var SizeofPhysicalDeviceExternalSemaphoreInfo int = int(unsafe.Sizeof(PhysicalDeviceExternalSemaphoreInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceExternalSemaphoreInfo) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceExternalSemaphoreInfo {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceExternalSemaphoreInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceExternalSemaphoreInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceExternalSemaphoreInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceExternalSemaphoreInfo) AsCPtr() *PhysicalDeviceExternalSemaphoreInfo {
+	clone := (*PhysicalDeviceExternalSemaphoreInfo)(newCBlock(cULong(SizeofPhysicalDeviceExternalSemaphoreInfo)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceExternalSemaphoreInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceExternalSemaphoreInfoCSlice(arp *AutoReleasePool, x ...PhysicalDeviceExternalSemaphoreInfo) []PhysicalDeviceExternalSemaphoreInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceExternalSemaphoreInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceExternalSemaphoreInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceExternalSemaphoreInfoFreeCSlice releases the memory allocated by PhysicalDeviceExternalSemaphoreInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceExternalSemaphoreInfoFreeCSlice(x []PhysicalDeviceExternalSemaphoreInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceExternalSemaphoreInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceExternalSemaphoreInfoFreeCSlice must be called on the returned slice.
+func PhysicalDeviceExternalSemaphoreInfoMakeCSlice(x ...PhysicalDeviceExternalSemaphoreInfo) []PhysicalDeviceExternalSemaphoreInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceExternalSemaphoreInfo * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceExternalSemaphoreInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceExternalSemaphoreInfo
+func (x PhysicalDeviceExternalSemaphoreInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceExternalSemaphoreInfo with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceExternalSemaphoreInfo) WithDefaultSType() PhysicalDeviceExternalSemaphoreInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_SEMAPHORE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceExternalSemaphoreInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_SEMAPHORE_INFO)
+}
+
+// WithSType clones a new PhysicalDeviceExternalSemaphoreInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceExternalSemaphoreInfo) WithSType(y StructureType) PhysicalDeviceExternalSemaphoreInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceExternalSemaphoreInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceExternalSemaphoreInfo
+func (x PhysicalDeviceExternalSemaphoreInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceExternalSemaphoreInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceExternalSemaphoreInfo) WithPNext(y unsafe.Pointer) PhysicalDeviceExternalSemaphoreInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceExternalSemaphoreInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceExternalSemaphoreInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// HandleType returns the value of handleType from VkPhysicalDeviceExternalSemaphoreInfo
+func (x PhysicalDeviceExternalSemaphoreInfo) HandleType() ExternalSemaphoreHandleTypeFlagBits {
+	ptr := /* typedef */ (*ExternalSemaphoreHandleTypeFlagBits)(&x.handleType)
+	return *ptr
+}
+
+// WithHandleType clones a new PhysicalDeviceExternalSemaphoreInfo with the value of
+// HandleType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceExternalSemaphoreInfo) WithHandleType(y ExternalSemaphoreHandleTypeFlagBits) PhysicalDeviceExternalSemaphoreInfo {
+	x.handleType = *( /* typedef */ (*C.VkExternalSemaphoreHandleTypeFlagBits)(&y))
+	return x
+}
+func (x *PhysicalDeviceExternalSemaphoreInfo) SetHandleType(y ExternalSemaphoreHandleTypeFlagBits) {
+	x.handleType = *( /* typedef */ (*C.VkExternalSemaphoreHandleTypeFlagBits)(&y))
+}
+
+// BindBufferMemoryInfo provides a go interface for VkBindBufferMemoryInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkBindBufferMemoryInfo.html
+type BindBufferMemoryInfo C.struct_VkBindBufferMemoryInfo
+
+// SizeofBindBufferMemoryInfo is the memory size of a BindBufferMemoryInfo
+var SizeofBindBufferMemoryInfo int = int(unsafe.Sizeof(BindBufferMemoryInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x BindBufferMemoryInfo) ArpPtr(arp *AutoReleasePool) *BindBufferMemoryInfo {
+	ptr := newCBlock(cULong(SizeofBindBufferMemoryInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*BindBufferMemoryInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *BindBufferMemoryInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x BindBufferMemoryInfo) AsCPtr() *BindBufferMemoryInfo {
+	clone := (*BindBufferMemoryInfo)(newCBlock(cULong(SizeofBindBufferMemoryInfo)))
+	*clone = x
+	return clone
+}
+
+// BindBufferMemoryInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func BindBufferMemoryInfoCSlice(arp *AutoReleasePool, x ...BindBufferMemoryInfo) []BindBufferMemoryInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBindBufferMemoryInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*BindBufferMemoryInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// BindBufferMemoryInfoFreeCSlice releases the memory allocated by BindBufferMemoryInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func BindBufferMemoryInfoFreeCSlice(x []BindBufferMemoryInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// BindBufferMemoryInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. BindBufferMemoryInfoFreeCSlice must be called on the returned slice.
+func BindBufferMemoryInfoMakeCSlice(x ...BindBufferMemoryInfo) []BindBufferMemoryInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBindBufferMemoryInfo * len(x)
+	dst := unsafe.Slice((*BindBufferMemoryInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkBindBufferMemoryInfo
+func (x BindBufferMemoryInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new BindBufferMemoryInfo with the value of
+// SType to the value provided in the specification.
+func (x BindBufferMemoryInfo) WithDefaultSType() BindBufferMemoryInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *BindBufferMemoryInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_INFO)
+}
+
+// WithSType clones a new BindBufferMemoryInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindBufferMemoryInfo) WithSType(y StructureType) BindBufferMemoryInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *BindBufferMemoryInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkBindBufferMemoryInfo
+func (x BindBufferMemoryInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new BindBufferMemoryInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindBufferMemoryInfo) WithPNext(y unsafe.Pointer) BindBufferMemoryInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *BindBufferMemoryInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *BindBufferMemoryInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Buffer returns the value of buffer from VkBindBufferMemoryInfo
+func (x BindBufferMemoryInfo) Buffer() Buffer {
+	ptr := /* handle */ (*Buffer)(&x.buffer)
+	return *ptr
+}
+
+// WithBuffer clones a new BindBufferMemoryInfo with the value of
+// Buffer updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindBufferMemoryInfo) WithBuffer(y Buffer) BindBufferMemoryInfo {
+	x.buffer = *( /* handle */ (*C.VkBuffer)(&y))
+	return x
+}
+func (x *BindBufferMemoryInfo) SetBuffer(y Buffer) {
+	x.buffer = *( /* handle */ (*C.VkBuffer)(&y))
+}
+
+// Memory returns the value of memory from VkBindBufferMemoryInfo
+func (x BindBufferMemoryInfo) Memory() DeviceMemory {
+	ptr := /* handle */ (*DeviceMemory)(&x.memory)
+	return *ptr
+}
+
+// WithMemory clones a new BindBufferMemoryInfo with the value of
+// Memory updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindBufferMemoryInfo) WithMemory(y DeviceMemory) BindBufferMemoryInfo {
+	x.memory = *( /* handle */ (*C.VkDeviceMemory)(&y))
+	return x
+}
+func (x *BindBufferMemoryInfo) SetMemory(y DeviceMemory) {
+	x.memory = *( /* handle */ (*C.VkDeviceMemory)(&y))
+}
+
+// MemoryOffset returns the value of memoryOffset from VkBindBufferMemoryInfo
+func (x BindBufferMemoryInfo) MemoryOffset() DeviceSize {
+	ptr := /* typedef */ (*DeviceSize)(&x.memoryOffset)
+	return *ptr
+}
+
+// WithMemoryOffset clones a new BindBufferMemoryInfo with the value of
+// MemoryOffset updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BindBufferMemoryInfo) WithMemoryOffset(y DeviceSize) BindBufferMemoryInfo {
+	x.memoryOffset = *( /* typedef */ (*C.VkDeviceSize)(&y))
+	return x
+}
+func (x *BindBufferMemoryInfo) SetMemoryOffset(y DeviceSize) {
+	x.memoryOffset = *( /* typedef */ (*C.VkDeviceSize)(&y))
+}
+
+// ExternalMemoryImageCreateInfo provides a go interface for VkExternalMemoryImageCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkExternalMemoryImageCreateInfo.html
+type ExternalMemoryImageCreateInfo C.struct_VkExternalMemoryImageCreateInfo
+
+// SizeofExternalMemoryImageCreateInfo is the memory size of a ExternalMemoryImageCreateInfo
+var SizeofExternalMemoryImageCreateInfo int = int(unsafe.Sizeof(ExternalMemoryImageCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ExternalMemoryImageCreateInfo) ArpPtr(arp *AutoReleasePool) *ExternalMemoryImageCreateInfo {
+	ptr := newCBlock(cULong(SizeofExternalMemoryImageCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ExternalMemoryImageCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ExternalMemoryImageCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ExternalMemoryImageCreateInfo) AsCPtr() *ExternalMemoryImageCreateInfo {
+	clone := (*ExternalMemoryImageCreateInfo)(newCBlock(cULong(SizeofExternalMemoryImageCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// ExternalMemoryImageCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ExternalMemoryImageCreateInfoCSlice(arp *AutoReleasePool, x ...ExternalMemoryImageCreateInfo) []ExternalMemoryImageCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofExternalMemoryImageCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ExternalMemoryImageCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ExternalMemoryImageCreateInfoFreeCSlice releases the memory allocated by ExternalMemoryImageCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func ExternalMemoryImageCreateInfoFreeCSlice(x []ExternalMemoryImageCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ExternalMemoryImageCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ExternalMemoryImageCreateInfoFreeCSlice must be called on the returned slice.
+func ExternalMemoryImageCreateInfoMakeCSlice(x ...ExternalMemoryImageCreateInfo) []ExternalMemoryImageCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofExternalMemoryImageCreateInfo * len(x)
+	dst := unsafe.Slice((*ExternalMemoryImageCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkExternalMemoryImageCreateInfo
+func (x ExternalMemoryImageCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ExternalMemoryImageCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x ExternalMemoryImageCreateInfo) WithDefaultSType() ExternalMemoryImageCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ExternalMemoryImageCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO)
+}
+
+// WithSType clones a new ExternalMemoryImageCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExternalMemoryImageCreateInfo) WithSType(y StructureType) ExternalMemoryImageCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ExternalMemoryImageCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkExternalMemoryImageCreateInfo
+func (x ExternalMemoryImageCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ExternalMemoryImageCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExternalMemoryImageCreateInfo) WithPNext(y unsafe.Pointer) ExternalMemoryImageCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ExternalMemoryImageCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ExternalMemoryImageCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// HandleTypes returns the value of handleTypes from VkExternalMemoryImageCreateInfo
+func (x ExternalMemoryImageCreateInfo) HandleTypes() ExternalMemoryHandleTypeFlags {
+	ptr := /* typedef */ (*ExternalMemoryHandleTypeFlags)(&x.handleTypes)
+	return *ptr
+}
+
+// WithHandleTypes clones a new ExternalMemoryImageCreateInfo with the value of
+// HandleTypes updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExternalMemoryImageCreateInfo) WithHandleTypes(y ExternalMemoryHandleTypeFlags) ExternalMemoryImageCreateInfo {
+	x.handleTypes = *( /* typedef */ (*C.VkExternalMemoryHandleTypeFlags)(&y))
+	return x
+}
+func (x *ExternalMemoryImageCreateInfo) SetHandleTypes(y ExternalMemoryHandleTypeFlags) {
+	x.handleTypes = *( /* typedef */ (*C.VkExternalMemoryHandleTypeFlags)(&y))
+}
+
+// DeviceGroupRenderPassBeginInfo provides a go interface for VkDeviceGroupRenderPassBeginInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDeviceGroupRenderPassBeginInfo.html
+type DeviceGroupRenderPassBeginInfo C.struct_VkDeviceGroupRenderPassBeginInfo
+
+// SizeofDeviceGroupRenderPassBeginInfo is the memory size of a DeviceGroupRenderPassBeginInfo
+var SizeofDeviceGroupRenderPassBeginInfo int = int(unsafe.Sizeof(DeviceGroupRenderPassBeginInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DeviceGroupRenderPassBeginInfo) ArpPtr(arp *AutoReleasePool) *DeviceGroupRenderPassBeginInfo {
+	ptr := newCBlock(cULong(SizeofDeviceGroupRenderPassBeginInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DeviceGroupRenderPassBeginInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DeviceGroupRenderPassBeginInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DeviceGroupRenderPassBeginInfo) AsCPtr() *DeviceGroupRenderPassBeginInfo {
+	clone := (*DeviceGroupRenderPassBeginInfo)(newCBlock(cULong(SizeofDeviceGroupRenderPassBeginInfo)))
+	*clone = x
+	return clone
+}
+
+// DeviceGroupRenderPassBeginInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DeviceGroupRenderPassBeginInfoCSlice(arp *AutoReleasePool, x ...DeviceGroupRenderPassBeginInfo) []DeviceGroupRenderPassBeginInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceGroupRenderPassBeginInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DeviceGroupRenderPassBeginInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DeviceGroupRenderPassBeginInfoFreeCSlice releases the memory allocated by DeviceGroupRenderPassBeginInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DeviceGroupRenderPassBeginInfoFreeCSlice(x []DeviceGroupRenderPassBeginInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DeviceGroupRenderPassBeginInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DeviceGroupRenderPassBeginInfoFreeCSlice must be called on the returned slice.
+func DeviceGroupRenderPassBeginInfoMakeCSlice(x ...DeviceGroupRenderPassBeginInfo) []DeviceGroupRenderPassBeginInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceGroupRenderPassBeginInfo * len(x)
+	dst := unsafe.Slice((*DeviceGroupRenderPassBeginInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDeviceGroupRenderPassBeginInfo
+func (x DeviceGroupRenderPassBeginInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DeviceGroupRenderPassBeginInfo with the value of
+// SType to the value provided in the specification.
+func (x DeviceGroupRenderPassBeginInfo) WithDefaultSType() DeviceGroupRenderPassBeginInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DeviceGroupRenderPassBeginInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO)
+}
+
+// WithSType clones a new DeviceGroupRenderPassBeginInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupRenderPassBeginInfo) WithSType(y StructureType) DeviceGroupRenderPassBeginInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DeviceGroupRenderPassBeginInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDeviceGroupRenderPassBeginInfo
+func (x DeviceGroupRenderPassBeginInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DeviceGroupRenderPassBeginInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupRenderPassBeginInfo) WithPNext(y unsafe.Pointer) DeviceGroupRenderPassBeginInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceGroupRenderPassBeginInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DeviceGroupRenderPassBeginInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// DeviceMask returns the value of deviceMask from VkDeviceGroupRenderPassBeginInfo
+func (x DeviceGroupRenderPassBeginInfo) DeviceMask() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.deviceMask)
+	return *ptr
+}
+
+// WithDeviceMask clones a new DeviceGroupRenderPassBeginInfo with the value of
+// DeviceMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupRenderPassBeginInfo) WithDeviceMask(y uint32) DeviceGroupRenderPassBeginInfo {
+	x.deviceMask = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceGroupRenderPassBeginInfo) SetDeviceMask(y uint32) {
+	x.deviceMask = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// DeviceRenderAreaCount returns the value of deviceRenderAreaCount from VkDeviceGroupRenderPassBeginInfo
+func (x DeviceGroupRenderPassBeginInfo) DeviceRenderAreaCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.deviceRenderAreaCount)
+	return *ptr
+}
+
+// WithDeviceRenderAreaCount clones a new DeviceGroupRenderPassBeginInfo with the value of
+// DeviceRenderAreaCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceGroupRenderPassBeginInfo) WithDeviceRenderAreaCount(y uint32) DeviceGroupRenderPassBeginInfo {
+	x.deviceRenderAreaCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceGroupRenderPassBeginInfo) SetDeviceRenderAreaCount(y uint32) {
+	x.deviceRenderAreaCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PDeviceRenderAreas returns the value of pDeviceRenderAreas from VkDeviceGroupRenderPassBeginInfo
+func (x DeviceGroupRenderPassBeginInfo) PDeviceRenderAreas() []Rect2D {
+	if x.pDeviceRenderAreas == nil {
+		return nil
+	}
+	return unsafe.Slice((*Rect2D)(unsafe.Pointer(x.pDeviceRenderAreas)), x.deviceRenderAreaCount)
+}
+
+// WithPDeviceRenderAreas clones a new DeviceGroupRenderPassBeginInfo with the value of
+// PDeviceRenderAreas updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines DeviceRenderAreaCount as the length of this field.
+// DeviceRenderAreaCount is updated with the length of the new value.
+func (x DeviceGroupRenderPassBeginInfo) WithPDeviceRenderAreas(y []Rect2D) DeviceGroupRenderPassBeginInfo {
+	x.pDeviceRenderAreas = *(func(x *[]Rect2D) **C.struct_VkRect2D { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkRect2D)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkRect2D)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithDeviceRenderAreaCount(uint32(len(y)))
+}
+func (x *DeviceGroupRenderPassBeginInfo) SetPDeviceRenderAreas(y []Rect2D) {
+	x.pDeviceRenderAreas = *(func(x *[]Rect2D) **C.struct_VkRect2D { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkRect2D)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkRect2D)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetDeviceRenderAreaCount(uint32(len(y)))
+}
+
+// PinPDeviceRenderAreas pins the Go memory referenced by y with the AutoReleasePool
+// and sets PDeviceRenderAreas, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DeviceGroupRenderPassBeginInfo) PinPDeviceRenderAreas(arp *AutoReleasePool, y []Rect2D) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPDeviceRenderAreas(y)
+}
+
+// PhysicalDeviceExternalFenceInfo provides a go interface for VkPhysicalDeviceExternalFenceInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceExternalFenceInfo.html
+type PhysicalDeviceExternalFenceInfo C.struct_VkPhysicalDeviceExternalFenceInfo
+
+// SizeofPhysicalDeviceExternalFenceInfo is the memory size of a PhysicalDeviceExternalFenceInfo
+var SizeofPhysicalDeviceExternalFenceInfo int = int(unsafe.Sizeof(PhysicalDeviceExternalFenceInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceExternalFenceInfo) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceExternalFenceInfo {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceExternalFenceInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceExternalFenceInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceExternalFenceInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceExternalFenceInfo) AsCPtr() *PhysicalDeviceExternalFenceInfo {
+	clone := (*PhysicalDeviceExternalFenceInfo)(newCBlock(cULong(SizeofPhysicalDeviceExternalFenceInfo)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceExternalFenceInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceExternalFenceInfoCSlice(arp *AutoReleasePool, x ...PhysicalDeviceExternalFenceInfo) []PhysicalDeviceExternalFenceInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceExternalFenceInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceExternalFenceInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceExternalFenceInfoFreeCSlice releases the memory allocated by PhysicalDeviceExternalFenceInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceExternalFenceInfoFreeCSlice(x []PhysicalDeviceExternalFenceInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceExternalFenceInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceExternalFenceInfoFreeCSlice must be called on the returned slice.
+func PhysicalDeviceExternalFenceInfoMakeCSlice(x ...PhysicalDeviceExternalFenceInfo) []PhysicalDeviceExternalFenceInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceExternalFenceInfo * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceExternalFenceInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceExternalFenceInfo
+func (x PhysicalDeviceExternalFenceInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceExternalFenceInfo with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceExternalFenceInfo) WithDefaultSType() PhysicalDeviceExternalFenceInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_FENCE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceExternalFenceInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_FENCE_INFO)
+}
+
+// WithSType clones a new PhysicalDeviceExternalFenceInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceExternalFenceInfo) WithSType(y StructureType) PhysicalDeviceExternalFenceInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceExternalFenceInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceExternalFenceInfo
+func (x PhysicalDeviceExternalFenceInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceExternalFenceInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceExternalFenceInfo) WithPNext(y unsafe.Pointer) PhysicalDeviceExternalFenceInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceExternalFenceInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceExternalFenceInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// HandleType returns the value of handleType from VkPhysicalDeviceExternalFenceInfo
+func (x PhysicalDeviceExternalFenceInfo) HandleType() ExternalFenceHandleTypeFlagBits {
+	ptr := /* typedef */ (*ExternalFenceHandleTypeFlagBits)(&x.handleType)
+	return *ptr
+}
+
+// WithHandleType clones a new PhysicalDeviceExternalFenceInfo with the value of
+// HandleType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceExternalFenceInfo) WithHandleType(y ExternalFenceHandleTypeFlagBits) PhysicalDeviceExternalFenceInfo {
+	x.handleType = *( /* typedef */ (*C.VkExternalFenceHandleTypeFlagBits)(&y))
+	return x
+}
+func (x *PhysicalDeviceExternalFenceInfo) SetHandleType(y ExternalFenceHandleTypeFlagBits) {
+	x.handleType = *( /* typedef */ (*C.VkExternalFenceHandleTypeFlagBits)(&y))
+}
+
+// MemoryAllocateFlagsInfo provides a go interface for VkMemoryAllocateFlagsInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkMemoryAllocateFlagsInfo.html
+type MemoryAllocateFlagsInfo C.struct_VkMemoryAllocateFlagsInfo
+
+// SizeofMemoryAllocateFlagsInfo is the memory size of a MemoryAllocateFlagsInfo
+var SizeofMemoryAllocateFlagsInfo int = int(unsafe.Sizeof(MemoryAllocateFlagsInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x MemoryAllocateFlagsInfo) ArpPtr(arp *AutoReleasePool) *MemoryAllocateFlagsInfo {
+	ptr := newCBlock(cULong(SizeofMemoryAllocateFlagsInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*MemoryAllocateFlagsInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *MemoryAllocateFlagsInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x MemoryAllocateFlagsInfo) AsCPtr() *MemoryAllocateFlagsInfo {
+	clone := (*MemoryAllocateFlagsInfo)(newCBlock(cULong(SizeofMemoryAllocateFlagsInfo)))
+	*clone = x
+	return clone
+}
+
+// MemoryAllocateFlagsInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func MemoryAllocateFlagsInfoCSlice(arp *AutoReleasePool, x ...MemoryAllocateFlagsInfo) []MemoryAllocateFlagsInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofMemoryAllocateFlagsInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*MemoryAllocateFlagsInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// MemoryAllocateFlagsInfoFreeCSlice releases the memory allocated by MemoryAllocateFlagsInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func MemoryAllocateFlagsInfoFreeCSlice(x []MemoryAllocateFlagsInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// MemoryAllocateFlagsInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. MemoryAllocateFlagsInfoFreeCSlice must be called on the returned slice.
+func MemoryAllocateFlagsInfoMakeCSlice(x ...MemoryAllocateFlagsInfo) []MemoryAllocateFlagsInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofMemoryAllocateFlagsInfo * len(x)
+	dst := unsafe.Slice((*MemoryAllocateFlagsInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkMemoryAllocateFlagsInfo
+func (x MemoryAllocateFlagsInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new MemoryAllocateFlagsInfo with the value of
+// SType to the value provided in the specification.
+func (x MemoryAllocateFlagsInfo) WithDefaultSType() MemoryAllocateFlagsInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *MemoryAllocateFlagsInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO)
+}
+
+// WithSType clones a new MemoryAllocateFlagsInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryAllocateFlagsInfo) WithSType(y StructureType) MemoryAllocateFlagsInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *MemoryAllocateFlagsInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkMemoryAllocateFlagsInfo
+func (x MemoryAllocateFlagsInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new MemoryAllocateFlagsInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryAllocateFlagsInfo) WithPNext(y unsafe.Pointer) MemoryAllocateFlagsInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *MemoryAllocateFlagsInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *MemoryAllocateFlagsInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Flags returns the value of flags from VkMemoryAllocateFlagsInfo
+func (x MemoryAllocateFlagsInfo) Flags() MemoryAllocateFlags {
+	ptr := /* typedef */ (*MemoryAllocateFlags)(&x.flags)
+	return *ptr
+}
+
+// WithFlags clones a new MemoryAllocateFlagsInfo with the value of
+// Flags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryAllocateFlagsInfo) WithFlags(y MemoryAllocateFlags) MemoryAllocateFlagsInfo {
+	x.flags = *( /* typedef */ (*C.VkMemoryAllocateFlags)(&y))
+	return x
+}
+func (x *MemoryAllocateFlagsInfo) SetFlags(y MemoryAllocateFlags) {
+	x.flags = *( /* typedef */ (*C.VkMemoryAllocateFlags)(&y))
+}
+
+// DeviceMask returns the value of deviceMask from VkMemoryAllocateFlagsInfo
+func (x MemoryAllocateFlagsInfo) DeviceMask() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.deviceMask)
+	return *ptr
+}
+
+// WithDeviceMask clones a new MemoryAllocateFlagsInfo with the value of
+// DeviceMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryAllocateFlagsInfo) WithDeviceMask(y uint32) MemoryAllocateFlagsInfo {
+	x.deviceMask = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *MemoryAllocateFlagsInfo) SetDeviceMask(y uint32) {
+	x.deviceMask = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PhysicalDeviceFeatures2 provides a go interface for VkPhysicalDeviceFeatures2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceFeatures2.html
+type PhysicalDeviceFeatures2 C.struct_VkPhysicalDeviceFeatures2
+
+// SizeofPhysicalDeviceFeatures2 is the memory size of a PhysicalDeviceFeatures2
+var SizeofPhysicalDeviceFeatures2 int = int(unsafe.Sizeof(PhysicalDeviceFeatures2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceFeatures2) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceFeatures2 {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceFeatures2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceFeatures2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceFeatures2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceFeatures2) AsCPtr() *PhysicalDeviceFeatures2 {
+	clone := (*PhysicalDeviceFeatures2)(newCBlock(cULong(SizeofPhysicalDeviceFeatures2)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceFeatures2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceFeatures2CSlice(arp *AutoReleasePool, x ...PhysicalDeviceFeatures2) []PhysicalDeviceFeatures2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceFeatures2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceFeatures2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceFeatures2FreeCSlice releases the memory allocated by PhysicalDeviceFeatures2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceFeatures2FreeCSlice(x []PhysicalDeviceFeatures2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceFeatures2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceFeatures2FreeCSlice must be called on the returned slice.
+func PhysicalDeviceFeatures2MakeCSlice(x ...PhysicalDeviceFeatures2) []PhysicalDeviceFeatures2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceFeatures2 * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceFeatures2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceFeatures2
+func (x *PhysicalDeviceFeatures2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceFeatures2 with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceFeatures2) WithDefaultSType() PhysicalDeviceFeatures2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceFeatures2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2)
+}
+
+// WithSType clones a new PhysicalDeviceFeatures2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceFeatures2) WithSType(y StructureType) PhysicalDeviceFeatures2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceFeatures2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceFeatures2
+func (x *PhysicalDeviceFeatures2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceFeatures2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceFeatures2) WithPNext(y unsafe.Pointer) PhysicalDeviceFeatures2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceFeatures2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceFeatures2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Features returns the value of features from VkPhysicalDeviceFeatures2
+func (x *PhysicalDeviceFeatures2) Features() PhysicalDeviceFeatures {
+	ptr := /* typedef */ (*PhysicalDeviceFeatures)(&x.features)
+	return *ptr
+}
+
+// FeaturesView returns a pointer to features in x, to read the
+// struct without copying it.
+func (x *PhysicalDeviceFeatures2) FeaturesView() *PhysicalDeviceFeatures {
+	return (*PhysicalDeviceFeatures)(&x.features)
+}
+
+// WithFeatures clones a new PhysicalDeviceFeatures2 with the value of
+// Features updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceFeatures2) WithFeatures(y PhysicalDeviceFeatures) PhysicalDeviceFeatures2 {
+	x.features = *( /* typedef */ (*C.struct_VkPhysicalDeviceFeatures)(&y))
+	return x
+}
+func (x *PhysicalDeviceFeatures2) SetFeatures(y PhysicalDeviceFeatures) {
+	x.features = *( /* typedef */ (*C.struct_VkPhysicalDeviceFeatures)(&y))
+}
+
+// PhysicalDeviceProperties2 provides a go interface for VkPhysicalDeviceProperties2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceProperties2.html
+type PhysicalDeviceProperties2 C.struct_VkPhysicalDeviceProperties2
+
+// SizeofPhysicalDeviceProperties2 is the memory size of a PhysicalDeviceProperties2
+var SizeofPhysicalDeviceProperties2 int = int(unsafe.Sizeof(PhysicalDeviceProperties2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceProperties2) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceProperties2 {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceProperties2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceProperties2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceProperties2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceProperties2) AsCPtr() *PhysicalDeviceProperties2 {
+	clone := (*PhysicalDeviceProperties2)(newCBlock(cULong(SizeofPhysicalDeviceProperties2)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceProperties2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceProperties2CSlice(arp *AutoReleasePool, x ...PhysicalDeviceProperties2) []PhysicalDeviceProperties2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceProperties2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceProperties2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceProperties2FreeCSlice releases the memory allocated by PhysicalDeviceProperties2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceProperties2FreeCSlice(x []PhysicalDeviceProperties2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceProperties2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceProperties2FreeCSlice must be called on the returned slice.
+func PhysicalDeviceProperties2MakeCSlice(x ...PhysicalDeviceProperties2) []PhysicalDeviceProperties2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceProperties2 * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceProperties2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceProperties2
+func (x *PhysicalDeviceProperties2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceProperties2 with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceProperties2) WithDefaultSType() PhysicalDeviceProperties2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceProperties2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2)
+}
+
+// WithSType clones a new PhysicalDeviceProperties2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceProperties2) WithSType(y StructureType) PhysicalDeviceProperties2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceProperties2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceProperties2
+func (x *PhysicalDeviceProperties2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceProperties2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceProperties2) WithPNext(y unsafe.Pointer) PhysicalDeviceProperties2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceProperties2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceProperties2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Properties returns the value of properties from VkPhysicalDeviceProperties2
+func (x *PhysicalDeviceProperties2) Properties() PhysicalDeviceProperties {
+	ptr := /* typedef */ (*PhysicalDeviceProperties)(&x.properties)
+	return *ptr
+}
+
+// PropertiesView returns a pointer to properties in x, to read the
+// struct without copying it.
+func (x *PhysicalDeviceProperties2) PropertiesView() *PhysicalDeviceProperties {
+	return (*PhysicalDeviceProperties)(&x.properties)
+}
+
+// FormatProperties2 provides a go interface for VkFormatProperties2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkFormatProperties2.html
+type FormatProperties2 C.struct_VkFormatProperties2
+
+// SizeofFormatProperties2 is the memory size of a FormatProperties2
+var SizeofFormatProperties2 int = int(unsafe.Sizeof(FormatProperties2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x FormatProperties2) ArpPtr(arp *AutoReleasePool) *FormatProperties2 {
+	ptr := newCBlock(cULong(SizeofFormatProperties2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*FormatProperties2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *FormatProperties2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x FormatProperties2) AsCPtr() *FormatProperties2 {
+	clone := (*FormatProperties2)(newCBlock(cULong(SizeofFormatProperties2)))
+	*clone = x
+	return clone
+}
+
+// FormatProperties2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func FormatProperties2CSlice(arp *AutoReleasePool, x ...FormatProperties2) []FormatProperties2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofFormatProperties2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*FormatProperties2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// FormatProperties2FreeCSlice releases the memory allocated by FormatProperties2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func FormatProperties2FreeCSlice(x []FormatProperties2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// FormatProperties2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. FormatProperties2FreeCSlice must be called on the returned slice.
+func FormatProperties2MakeCSlice(x ...FormatProperties2) []FormatProperties2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofFormatProperties2 * len(x)
+	dst := unsafe.Slice((*FormatProperties2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkFormatProperties2
+func (x FormatProperties2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new FormatProperties2 with the value of
+// SType to the value provided in the specification.
+func (x FormatProperties2) WithDefaultSType() FormatProperties2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *FormatProperties2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_2)
+}
+
+// WithSType clones a new FormatProperties2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x FormatProperties2) WithSType(y StructureType) FormatProperties2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *FormatProperties2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkFormatProperties2
+func (x FormatProperties2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new FormatProperties2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x FormatProperties2) WithPNext(y unsafe.Pointer) FormatProperties2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *FormatProperties2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *FormatProperties2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// FormatProperties returns the value of formatProperties from VkFormatProperties2
+func (x FormatProperties2) FormatProperties() FormatProperties {
+	ptr := /* typedef */ (*FormatProperties)(&x.formatProperties)
+	return *ptr
+}
+
+// ImageFormatProperties2 provides a go interface for VkImageFormatProperties2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkImageFormatProperties2.html
+type ImageFormatProperties2 C.struct_VkImageFormatProperties2
+
+// SizeofImageFormatProperties2 is the memory size of a ImageFormatProperties2
+var SizeofImageFormatProperties2 int = int(unsafe.Sizeof(ImageFormatProperties2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ImageFormatProperties2) ArpPtr(arp *AutoReleasePool) *ImageFormatProperties2 {
+	ptr := newCBlock(cULong(SizeofImageFormatProperties2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ImageFormatProperties2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ImageFormatProperties2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ImageFormatProperties2) AsCPtr() *ImageFormatProperties2 {
+	clone := (*ImageFormatProperties2)(newCBlock(cULong(SizeofImageFormatProperties2)))
+	*clone = x
+	return clone
+}
+
+// ImageFormatProperties2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ImageFormatProperties2CSlice(arp *AutoReleasePool, x ...ImageFormatProperties2) []ImageFormatProperties2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImageFormatProperties2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ImageFormatProperties2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ImageFormatProperties2FreeCSlice releases the memory allocated by ImageFormatProperties2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func ImageFormatProperties2FreeCSlice(x []ImageFormatProperties2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ImageFormatProperties2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ImageFormatProperties2FreeCSlice must be called on the returned slice.
+func ImageFormatProperties2MakeCSlice(x ...ImageFormatProperties2) []ImageFormatProperties2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImageFormatProperties2 * len(x)
+	dst := unsafe.Slice((*ImageFormatProperties2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkImageFormatProperties2
+func (x ImageFormatProperties2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ImageFormatProperties2 with the value of
+// SType to the value provided in the specification.
+func (x ImageFormatProperties2) WithDefaultSType() ImageFormatProperties2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ImageFormatProperties2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_IMAGE_FORMAT_PROPERTIES_2)
+}
+
+// WithSType clones a new ImageFormatProperties2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageFormatProperties2) WithSType(y StructureType) ImageFormatProperties2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ImageFormatProperties2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkImageFormatProperties2
+func (x ImageFormatProperties2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ImageFormatProperties2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageFormatProperties2) WithPNext(y unsafe.Pointer) ImageFormatProperties2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ImageFormatProperties2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ImageFormatProperties2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ImageFormatProperties returns the value of imageFormatProperties from VkImageFormatProperties2
+func (x ImageFormatProperties2) ImageFormatProperties() ImageFormatProperties {
+	ptr := /* typedef */ (*ImageFormatProperties)(&x.imageFormatProperties)
+	return *ptr
+}
+
+// PhysicalDeviceImageFormatInfo2 provides a go interface for VkPhysicalDeviceImageFormatInfo2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceImageFormatInfo2.html
+type PhysicalDeviceImageFormatInfo2 C.struct_VkPhysicalDeviceImageFormatInfo2
+
+// SizeofPhysicalDeviceImageFormatInfo2 is the memory size of a PhysicalDeviceImageFormatInfo2
+var SizeofPhysicalDeviceImageFormatInfo2 int = int(unsafe.Sizeof(PhysicalDeviceImageFormatInfo2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceImageFormatInfo2) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceImageFormatInfo2 {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceImageFormatInfo2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceImageFormatInfo2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceImageFormatInfo2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceImageFormatInfo2) AsCPtr() *PhysicalDeviceImageFormatInfo2 {
+	clone := (*PhysicalDeviceImageFormatInfo2)(newCBlock(cULong(SizeofPhysicalDeviceImageFormatInfo2)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceImageFormatInfo2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceImageFormatInfo2CSlice(arp *AutoReleasePool, x ...PhysicalDeviceImageFormatInfo2) []PhysicalDeviceImageFormatInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceImageFormatInfo2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceImageFormatInfo2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceImageFormatInfo2FreeCSlice releases the memory allocated by PhysicalDeviceImageFormatInfo2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceImageFormatInfo2FreeCSlice(x []PhysicalDeviceImageFormatInfo2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceImageFormatInfo2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceImageFormatInfo2FreeCSlice must be called on the returned slice.
+func PhysicalDeviceImageFormatInfo2MakeCSlice(x ...PhysicalDeviceImageFormatInfo2) []PhysicalDeviceImageFormatInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceImageFormatInfo2 * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceImageFormatInfo2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceImageFormatInfo2
+func (x PhysicalDeviceImageFormatInfo2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceImageFormatInfo2 with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceImageFormatInfo2) WithDefaultSType() PhysicalDeviceImageFormatInfo2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceImageFormatInfo2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_FORMAT_INFO_2)
+}
+
+// WithSType clones a new PhysicalDeviceImageFormatInfo2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceImageFormatInfo2) WithSType(y StructureType) PhysicalDeviceImageFormatInfo2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceImageFormatInfo2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceImageFormatInfo2
+func (x PhysicalDeviceImageFormatInfo2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceImageFormatInfo2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceImageFormatInfo2) WithPNext(y unsafe.Pointer) PhysicalDeviceImageFormatInfo2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceImageFormatInfo2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceImageFormatInfo2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Format returns the value of format from VkPhysicalDeviceImageFormatInfo2
+func (x PhysicalDeviceImageFormatInfo2) Format() Format {
+	ptr := /* typedef */ (*Format)(&x.format)
+	return *ptr
+}
+
+// WithFormat clones a new PhysicalDeviceImageFormatInfo2 with the value of
+// Format updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceImageFormatInfo2) WithFormat(y Format) PhysicalDeviceImageFormatInfo2 {
+	x.format = *( /* typedef */ (*C.VkFormat)(&y))
+	return x
+}
+func (x *PhysicalDeviceImageFormatInfo2) SetFormat(y Format) {
+	x.format = *( /* typedef */ (*C.VkFormat)(&y))
+}
+
+// Type_ returns the value of type from VkPhysicalDeviceImageFormatInfo2
+func (x PhysicalDeviceImageFormatInfo2) Type_() ImageType {
+	ptr := /* typedef */ (*ImageType)(&x._type)
+	return *ptr
+}
+
+// WithType_ clones a new PhysicalDeviceImageFormatInfo2 with the value of
+// Type_ updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceImageFormatInfo2) WithType_(y ImageType) PhysicalDeviceImageFormatInfo2 {
+	x._type = *( /* typedef */ (*C.VkImageType)(&y))
+	return x
+}
+func (x *PhysicalDeviceImageFormatInfo2) SetType_(y ImageType) {
+	x._type = *( /* typedef */ (*C.VkImageType)(&y))
+}
+
+// Tiling returns the value of tiling from VkPhysicalDeviceImageFormatInfo2
+func (x PhysicalDeviceImageFormatInfo2) Tiling() ImageTiling {
+	ptr := /* typedef */ (*ImageTiling)(&x.tiling)
+	return *ptr
+}
+
+// WithTiling clones a new PhysicalDeviceImageFormatInfo2 with the value of
+// Tiling updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceImageFormatInfo2) WithTiling(y ImageTiling) PhysicalDeviceImageFormatInfo2 {
+	x.tiling = *( /* typedef */ (*C.VkImageTiling)(&y))
+	return x
+}
+func (x *PhysicalDeviceImageFormatInfo2) SetTiling(y ImageTiling) {
+	x.tiling = *( /* typedef */ (*C.VkImageTiling)(&y))
+}
+
+// Usage returns the value of usage from VkPhysicalDeviceImageFormatInfo2
+func (x PhysicalDeviceImageFormatInfo2) Usage() ImageUsageFlags {
+	ptr := /* typedef */ (*ImageUsageFlags)(&x.usage)
+	return *ptr
+}
+
+// WithUsage clones a new PhysicalDeviceImageFormatInfo2 with the value of
+// Usage updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceImageFormatInfo2) WithUsage(y ImageUsageFlags) PhysicalDeviceImageFormatInfo2 {
+	x.usage = *( /* typedef */ (*C.VkImageUsageFlags)(&y))
+	return x
+}
+func (x *PhysicalDeviceImageFormatInfo2) SetUsage(y ImageUsageFlags) {
+	x.usage = *( /* typedef */ (*C.VkImageUsageFlags)(&y))
+}
+
+// Flags returns the value of flags from VkPhysicalDeviceImageFormatInfo2
+func (x PhysicalDeviceImageFormatInfo2) Flags() ImageCreateFlags {
+	ptr := /* typedef */ (*ImageCreateFlags)(&x.flags)
+	return *ptr
+}
+
+// WithFlags clones a new PhysicalDeviceImageFormatInfo2 with the value of
+// Flags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceImageFormatInfo2) WithFlags(y ImageCreateFlags) PhysicalDeviceImageFormatInfo2 {
+	x.flags = *( /* typedef */ (*C.VkImageCreateFlags)(&y))
+	return x
+}
+func (x *PhysicalDeviceImageFormatInfo2) SetFlags(y ImageCreateFlags) {
+	x.flags = *( /* typedef */ (*C.VkImageCreateFlags)(&y))
+}
+
+// QueueFamilyProperties2 provides a go interface for VkQueueFamilyProperties2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkQueueFamilyProperties2.html
+type QueueFamilyProperties2 C.struct_VkQueueFamilyProperties2
+
+// SizeofQueueFamilyProperties2 is the memory size of a QueueFamilyProperties2
+var SizeofQueueFamilyProperties2 int = int(unsafe.Sizeof(QueueFamilyProperties2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x QueueFamilyProperties2) ArpPtr(arp *AutoReleasePool) *QueueFamilyProperties2 {
+	ptr := newCBlock(cULong(SizeofQueueFamilyProperties2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*QueueFamilyProperties2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *QueueFamilyProperties2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x QueueFamilyProperties2) AsCPtr() *QueueFamilyProperties2 {
+	clone := (*QueueFamilyProperties2)(newCBlock(cULong(SizeofQueueFamilyProperties2)))
+	*clone = x
+	return clone
+}
+
+// QueueFamilyProperties2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func QueueFamilyProperties2CSlice(arp *AutoReleasePool, x ...QueueFamilyProperties2) []QueueFamilyProperties2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofQueueFamilyProperties2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*QueueFamilyProperties2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// QueueFamilyProperties2FreeCSlice releases the memory allocated by QueueFamilyProperties2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func QueueFamilyProperties2FreeCSlice(x []QueueFamilyProperties2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// QueueFamilyProperties2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. QueueFamilyProperties2FreeCSlice must be called on the returned slice.
+func QueueFamilyProperties2MakeCSlice(x ...QueueFamilyProperties2) []QueueFamilyProperties2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofQueueFamilyProperties2 * len(x)
+	dst := unsafe.Slice((*QueueFamilyProperties2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkQueueFamilyProperties2
+func (x QueueFamilyProperties2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new QueueFamilyProperties2 with the value of
+// SType to the value provided in the specification.
+func (x QueueFamilyProperties2) WithDefaultSType() QueueFamilyProperties2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *QueueFamilyProperties2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_QUEUE_FAMILY_PROPERTIES_2)
+}
+
+// WithSType clones a new QueueFamilyProperties2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x QueueFamilyProperties2) WithSType(y StructureType) QueueFamilyProperties2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *QueueFamilyProperties2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkQueueFamilyProperties2
+func (x QueueFamilyProperties2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new QueueFamilyProperties2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x QueueFamilyProperties2) WithPNext(y unsafe.Pointer) QueueFamilyProperties2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *QueueFamilyProperties2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *QueueFamilyProperties2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// QueueFamilyProperties returns the value of queueFamilyProperties from VkQueueFamilyProperties2
+func (x QueueFamilyProperties2) QueueFamilyProperties() QueueFamilyProperties {
+	ptr := /* typedef */ (*QueueFamilyProperties)(&x.queueFamilyProperties)
+	return *ptr
+}
+
+// PhysicalDeviceMemoryProperties2 provides a go interface for VkPhysicalDeviceMemoryProperties2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceMemoryProperties2.html
+type PhysicalDeviceMemoryProperties2 C.struct_VkPhysicalDeviceMemoryProperties2
+
+// SizeofPhysicalDeviceMemoryProperties2 is the memory size of a PhysicalDeviceMemoryProperties2
+var SizeofPhysicalDeviceMemoryProperties2 int = int(unsafe.Sizeof(PhysicalDeviceMemoryProperties2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceMemoryProperties2) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceMemoryProperties2 {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceMemoryProperties2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceMemoryProperties2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceMemoryProperties2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceMemoryProperties2) AsCPtr() *PhysicalDeviceMemoryProperties2 {
+	clone := (*PhysicalDeviceMemoryProperties2)(newCBlock(cULong(SizeofPhysicalDeviceMemoryProperties2)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceMemoryProperties2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceMemoryProperties2CSlice(arp *AutoReleasePool, x ...PhysicalDeviceMemoryProperties2) []PhysicalDeviceMemoryProperties2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceMemoryProperties2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceMemoryProperties2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceMemoryProperties2FreeCSlice releases the memory allocated by PhysicalDeviceMemoryProperties2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceMemoryProperties2FreeCSlice(x []PhysicalDeviceMemoryProperties2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceMemoryProperties2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceMemoryProperties2FreeCSlice must be called on the returned slice.
+func PhysicalDeviceMemoryProperties2MakeCSlice(x ...PhysicalDeviceMemoryProperties2) []PhysicalDeviceMemoryProperties2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceMemoryProperties2 * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceMemoryProperties2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceMemoryProperties2
+func (x *PhysicalDeviceMemoryProperties2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceMemoryProperties2 with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceMemoryProperties2) WithDefaultSType() PhysicalDeviceMemoryProperties2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceMemoryProperties2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PROPERTIES_2)
+}
+
+// WithSType clones a new PhysicalDeviceMemoryProperties2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceMemoryProperties2) WithSType(y StructureType) PhysicalDeviceMemoryProperties2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceMemoryProperties2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceMemoryProperties2
+func (x *PhysicalDeviceMemoryProperties2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceMemoryProperties2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceMemoryProperties2) WithPNext(y unsafe.Pointer) PhysicalDeviceMemoryProperties2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceMemoryProperties2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceMemoryProperties2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// MemoryProperties returns the value of memoryProperties from VkPhysicalDeviceMemoryProperties2
+func (x *PhysicalDeviceMemoryProperties2) MemoryProperties() PhysicalDeviceMemoryProperties {
+	ptr := /* typedef */ (*PhysicalDeviceMemoryProperties)(&x.memoryProperties)
+	return *ptr
+}
+
+// MemoryPropertiesView returns a pointer to memoryProperties in x, to read the
+// struct without copying it.
+func (x *PhysicalDeviceMemoryProperties2) MemoryPropertiesView() *PhysicalDeviceMemoryProperties {
+	return (*PhysicalDeviceMemoryProperties)(&x.memoryProperties)
+}
+
+// SparseImageFormatProperties2 provides a go interface for VkSparseImageFormatProperties2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSparseImageFormatProperties2.html
+type SparseImageFormatProperties2 C.struct_VkSparseImageFormatProperties2
+
+// SizeofSparseImageFormatProperties2 is the memory size of a SparseImageFormatProperties2
+var SizeofSparseImageFormatProperties2 int = int(unsafe.Sizeof(SparseImageFormatProperties2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SparseImageFormatProperties2) ArpPtr(arp *AutoReleasePool) *SparseImageFormatProperties2 {
+	ptr := newCBlock(cULong(SizeofSparseImageFormatProperties2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SparseImageFormatProperties2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SparseImageFormatProperties2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SparseImageFormatProperties2) AsCPtr() *SparseImageFormatProperties2 {
+	clone := (*SparseImageFormatProperties2)(newCBlock(cULong(SizeofSparseImageFormatProperties2)))
+	*clone = x
+	return clone
+}
+
+// SparseImageFormatProperties2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SparseImageFormatProperties2CSlice(arp *AutoReleasePool, x ...SparseImageFormatProperties2) []SparseImageFormatProperties2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSparseImageFormatProperties2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SparseImageFormatProperties2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SparseImageFormatProperties2FreeCSlice releases the memory allocated by SparseImageFormatProperties2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func SparseImageFormatProperties2FreeCSlice(x []SparseImageFormatProperties2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SparseImageFormatProperties2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SparseImageFormatProperties2FreeCSlice must be called on the returned slice.
+func SparseImageFormatProperties2MakeCSlice(x ...SparseImageFormatProperties2) []SparseImageFormatProperties2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSparseImageFormatProperties2 * len(x)
+	dst := unsafe.Slice((*SparseImageFormatProperties2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkSparseImageFormatProperties2
+func (x SparseImageFormatProperties2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new SparseImageFormatProperties2 with the value of
+// SType to the value provided in the specification.
+func (x SparseImageFormatProperties2) WithDefaultSType() SparseImageFormatProperties2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_SPARSE_IMAGE_FORMAT_PROPERTIES_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *SparseImageFormatProperties2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_SPARSE_IMAGE_FORMAT_PROPERTIES_2)
+}
+
+// WithSType clones a new SparseImageFormatProperties2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SparseImageFormatProperties2) WithSType(y StructureType) SparseImageFormatProperties2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *SparseImageFormatProperties2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkSparseImageFormatProperties2
+func (x SparseImageFormatProperties2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new SparseImageFormatProperties2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SparseImageFormatProperties2) WithPNext(y unsafe.Pointer) SparseImageFormatProperties2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *SparseImageFormatProperties2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SparseImageFormatProperties2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Properties returns the value of properties from VkSparseImageFormatProperties2
+func (x SparseImageFormatProperties2) Properties() SparseImageFormatProperties {
+	ptr := /* typedef */ (*SparseImageFormatProperties)(&x.properties)
+	return *ptr
+}
+
+// PhysicalDeviceSparseImageFormatInfo2 provides a go interface for VkPhysicalDeviceSparseImageFormatInfo2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceSparseImageFormatInfo2.html
+type PhysicalDeviceSparseImageFormatInfo2 C.struct_VkPhysicalDeviceSparseImageFormatInfo2
+
+// SizeofPhysicalDeviceSparseImageFormatInfo2 is the memory size of a PhysicalDeviceSparseImageFormatInfo2
+var SizeofPhysicalDeviceSparseImageFormatInfo2 int = int(unsafe.Sizeof(PhysicalDeviceSparseImageFormatInfo2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceSparseImageFormatInfo2) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceSparseImageFormatInfo2 {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceSparseImageFormatInfo2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceSparseImageFormatInfo2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceSparseImageFormatInfo2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceSparseImageFormatInfo2) AsCPtr() *PhysicalDeviceSparseImageFormatInfo2 {
+	clone := (*PhysicalDeviceSparseImageFormatInfo2)(newCBlock(cULong(SizeofPhysicalDeviceSparseImageFormatInfo2)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceSparseImageFormatInfo2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceSparseImageFormatInfo2CSlice(arp *AutoReleasePool, x ...PhysicalDeviceSparseImageFormatInfo2) []PhysicalDeviceSparseImageFormatInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceSparseImageFormatInfo2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceSparseImageFormatInfo2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceSparseImageFormatInfo2FreeCSlice releases the memory allocated by PhysicalDeviceSparseImageFormatInfo2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceSparseImageFormatInfo2FreeCSlice(x []PhysicalDeviceSparseImageFormatInfo2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceSparseImageFormatInfo2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceSparseImageFormatInfo2FreeCSlice must be called on the returned slice.
+func PhysicalDeviceSparseImageFormatInfo2MakeCSlice(x ...PhysicalDeviceSparseImageFormatInfo2) []PhysicalDeviceSparseImageFormatInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceSparseImageFormatInfo2 * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceSparseImageFormatInfo2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceSparseImageFormatInfo2
+func (x PhysicalDeviceSparseImageFormatInfo2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceSparseImageFormatInfo2 with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceSparseImageFormatInfo2) WithDefaultSType() PhysicalDeviceSparseImageFormatInfo2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SPARSE_IMAGE_FORMAT_INFO_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceSparseImageFormatInfo2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SPARSE_IMAGE_FORMAT_INFO_2)
+}
+
+// WithSType clones a new PhysicalDeviceSparseImageFormatInfo2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSparseImageFormatInfo2) WithSType(y StructureType) PhysicalDeviceSparseImageFormatInfo2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceSparseImageFormatInfo2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceSparseImageFormatInfo2
+func (x PhysicalDeviceSparseImageFormatInfo2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceSparseImageFormatInfo2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSparseImageFormatInfo2) WithPNext(y unsafe.Pointer) PhysicalDeviceSparseImageFormatInfo2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceSparseImageFormatInfo2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceSparseImageFormatInfo2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Format returns the value of format from VkPhysicalDeviceSparseImageFormatInfo2
+func (x PhysicalDeviceSparseImageFormatInfo2) Format() Format {
+	ptr := /* typedef */ (*Format)(&x.format)
+	return *ptr
+}
+
+// WithFormat clones a new PhysicalDeviceSparseImageFormatInfo2 with the value of
+// Format updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSparseImageFormatInfo2) WithFormat(y Format) PhysicalDeviceSparseImageFormatInfo2 {
+	x.format = *( /* typedef */ (*C.VkFormat)(&y))
+	return x
+}
+func (x *PhysicalDeviceSparseImageFormatInfo2) SetFormat(y Format) {
+	x.format = *( /* typedef */ (*C.VkFormat)(&y))
+}
+
+// Type_ returns the value of type from VkPhysicalDeviceSparseImageFormatInfo2
+func (x PhysicalDeviceSparseImageFormatInfo2) Type_() ImageType {
+	ptr := /* typedef */ (*ImageType)(&x._type)
+	return *ptr
+}
+
+// WithType_ clones a new PhysicalDeviceSparseImageFormatInfo2 with the value of
+// Type_ updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSparseImageFormatInfo2) WithType_(y ImageType) PhysicalDeviceSparseImageFormatInfo2 {
+	x._type = *( /* typedef */ (*C.VkImageType)(&y))
+	return x
+}
+func (x *PhysicalDeviceSparseImageFormatInfo2) SetType_(y ImageType) {
+	x._type = *( /* typedef */ (*C.VkImageType)(&y))
+}
+
+// Samples returns the value of samples from VkPhysicalDeviceSparseImageFormatInfo2
+func (x PhysicalDeviceSparseImageFormatInfo2) Samples() SampleCountFlagBits {
+	ptr := /* typedef */ (*SampleCountFlagBits)(&x.samples)
+	return *ptr
+}
+
+// WithSamples clones a new PhysicalDeviceSparseImageFormatInfo2 with the value of
+// Samples updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSparseImageFormatInfo2) WithSamples(y SampleCountFlagBits) PhysicalDeviceSparseImageFormatInfo2 {
+	x.samples = *( /* typedef */ (*C.VkSampleCountFlagBits)(&y))
+	return x
+}
+func (x *PhysicalDeviceSparseImageFormatInfo2) SetSamples(y SampleCountFlagBits) {
+	x.samples = *( /* typedef */ (*C.VkSampleCountFlagBits)(&y))
+}
+
+// Usage returns the value of usage from VkPhysicalDeviceSparseImageFormatInfo2
+func (x PhysicalDeviceSparseImageFormatInfo2) Usage() ImageUsageFlags {
+	ptr := /* typedef */ (*ImageUsageFlags)(&x.usage)
+	return *ptr
+}
+
+// WithUsage clones a new PhysicalDeviceSparseImageFormatInfo2 with the value of
+// Usage updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSparseImageFormatInfo2) WithUsage(y ImageUsageFlags) PhysicalDeviceSparseImageFormatInfo2 {
+	x.usage = *( /* typedef */ (*C.VkImageUsageFlags)(&y))
+	return x
+}
+func (x *PhysicalDeviceSparseImageFormatInfo2) SetUsage(y ImageUsageFlags) {
+	x.usage = *( /* typedef */ (*C.VkImageUsageFlags)(&y))
+}
+
+// Tiling returns the value of tiling from VkPhysicalDeviceSparseImageFormatInfo2
+func (x PhysicalDeviceSparseImageFormatInfo2) Tiling() ImageTiling {
+	ptr := /* typedef */ (*ImageTiling)(&x.tiling)
+	return *ptr
+}
+
+// WithTiling clones a new PhysicalDeviceSparseImageFormatInfo2 with the value of
+// Tiling updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSparseImageFormatInfo2) WithTiling(y ImageTiling) PhysicalDeviceSparseImageFormatInfo2 {
+	x.tiling = *( /* typedef */ (*C.VkImageTiling)(&y))
+	return x
+}
+func (x *PhysicalDeviceSparseImageFormatInfo2) SetTiling(y ImageTiling) {
+	x.tiling = *( /* typedef */ (*C.VkImageTiling)(&y))
+}
+
+// SamplerYcbcrConversionInfo provides a go interface for VkSamplerYcbcrConversionInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSamplerYcbcrConversionInfo.html
+type SamplerYcbcrConversionInfo C.struct_VkSamplerYcbcrConversionInfo
+
+// SizeofSamplerYcbcrConversionInfo is the memory size of a SamplerYcbcrConversionInfo
+var SizeofSamplerYcbcrConversionInfo int = int(unsafe.Sizeof(SamplerYcbcrConversionInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SamplerYcbcrConversionInfo) ArpPtr(arp *AutoReleasePool) *SamplerYcbcrConversionInfo {
+	ptr := newCBlock(cULong(SizeofSamplerYcbcrConversionInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SamplerYcbcrConversionInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SamplerYcbcrConversionInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SamplerYcbcrConversionInfo) AsCPtr() *SamplerYcbcrConversionInfo {
+	clone := (*SamplerYcbcrConversionInfo)(newCBlock(cULong(SizeofSamplerYcbcrConversionInfo)))
+	*clone = x
+	return clone
+}
+
+// SamplerYcbcrConversionInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SamplerYcbcrConversionInfoCSlice(arp *AutoReleasePool, x ...SamplerYcbcrConversionInfo) []SamplerYcbcrConversionInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSamplerYcbcrConversionInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SamplerYcbcrConversionInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SamplerYcbcrConversionInfoFreeCSlice releases the memory allocated by SamplerYcbcrConversionInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func SamplerYcbcrConversionInfoFreeCSlice(x []SamplerYcbcrConversionInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SamplerYcbcrConversionInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SamplerYcbcrConversionInfoFreeCSlice must be called on the returned slice.
+func SamplerYcbcrConversionInfoMakeCSlice(x ...SamplerYcbcrConversionInfo) []SamplerYcbcrConversionInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSamplerYcbcrConversionInfo * len(x)
+	dst := unsafe.Slice((*SamplerYcbcrConversionInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkSamplerYcbcrConversionInfo
+func (x SamplerYcbcrConversionInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new SamplerYcbcrConversionInfo with the value of
+// SType to the value provided in the specification.
+func (x SamplerYcbcrConversionInfo) WithDefaultSType() SamplerYcbcrConversionInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *SamplerYcbcrConversionInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO)
+}
+
+// WithSType clones a new SamplerYcbcrConversionInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SamplerYcbcrConversionInfo) WithSType(y StructureType) SamplerYcbcrConversionInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *SamplerYcbcrConversionInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkSamplerYcbcrConversionInfo
+func (x SamplerYcbcrConversionInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new SamplerYcbcrConversionInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SamplerYcbcrConversionInfo) WithPNext(y unsafe.Pointer) SamplerYcbcrConversionInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *SamplerYcbcrConversionInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SamplerYcbcrConversionInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Conversion returns the value of conversion from VkSamplerYcbcrConversionInfo
+func (x SamplerYcbcrConversionInfo) Conversion() SamplerYcbcrConversion {
+	ptr := /* handle */ (*SamplerYcbcrConversion)(&x.conversion)
+	return *ptr
+}
+
+// WithConversion clones a new SamplerYcbcrConversionInfo with the value of
+// Conversion updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SamplerYcbcrConversionInfo) WithConversion(y SamplerYcbcrConversion) SamplerYcbcrConversionInfo {
+	x.conversion = *( /* handle */ (*C.VkSamplerYcbcrConversion)(&y))
+	return x
+}
+func (x *SamplerYcbcrConversionInfo) SetConversion(y SamplerYcbcrConversion) {
+	x.conversion = *( /* handle */ (*C.VkSamplerYcbcrConversion)(&y))
+}
+
+// SamplerYcbcrConversionCreateInfo provides a go interface for VkSamplerYcbcrConversionCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSamplerYcbcrConversionCreateInfo.html
+type SamplerYcbcrConversionCreateInfo C.struct_VkSamplerYcbcrConversionCreateInfo
+
+// SizeofSamplerYcbcrConversionCreateInfo is the memory size of a SamplerYcbcrConversionCreateInfo
+var SizeofSamplerYcbcrConversionCreateInfo int = int(unsafe.Sizeof(SamplerYcbcrConversionCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SamplerYcbcrConversionCreateInfo) ArpPtr(arp *AutoReleasePool) *SamplerYcbcrConversionCreateInfo {
+	ptr := newCBlock(cULong(SizeofSamplerYcbcrConversionCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SamplerYcbcrConversionCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SamplerYcbcrConversionCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SamplerYcbcrConversionCreateInfo) AsCPtr() *SamplerYcbcrConversionCreateInfo {
+	clone := (*SamplerYcbcrConversionCreateInfo)(newCBlock(cULong(SizeofSamplerYcbcrConversionCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// SamplerYcbcrConversionCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SamplerYcbcrConversionCreateInfoCSlice(arp *AutoReleasePool, x ...SamplerYcbcrConversionCreateInfo) []SamplerYcbcrConversionCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSamplerYcbcrConversionCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SamplerYcbcrConversionCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SamplerYcbcrConversionCreateInfoFreeCSlice releases the memory allocated by SamplerYcbcrConversionCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func SamplerYcbcrConversionCreateInfoFreeCSlice(x []SamplerYcbcrConversionCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SamplerYcbcrConversionCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SamplerYcbcrConversionCreateInfoFreeCSlice must be called on the returned slice.
+func SamplerYcbcrConversionCreateInfoMakeCSlice(x ...SamplerYcbcrConversionCreateInfo) []SamplerYcbcrConversionCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSamplerYcbcrConversionCreateInfo * len(x)
+	dst := unsafe.Slice((*SamplerYcbcrConversionCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkSamplerYcbcrConversionCreateInfo
+func (x SamplerYcbcrConversionCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new SamplerYcbcrConversionCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x SamplerYcbcrConversionCreateInfo) WithDefaultSType() SamplerYcbcrConversionCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *SamplerYcbcrConversionCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_CREATE_INFO)
+}
+
+// WithSType clones a new SamplerYcbcrConversionCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SamplerYcbcrConversionCreateInfo) WithSType(y StructureType) SamplerYcbcrConversionCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *SamplerYcbcrConversionCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkSamplerYcbcrConversionCreateInfo
+func (x SamplerYcbcrConversionCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new SamplerYcbcrConversionCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SamplerYcbcrConversionCreateInfo) WithPNext(y unsafe.Pointer) SamplerYcbcrConversionCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *SamplerYcbcrConversionCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SamplerYcbcrConversionCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Format returns the value of format from VkSamplerYcbcrConversionCreateInfo
+func (x SamplerYcbcrConversionCreateInfo) Format() Format {
+	ptr := /* typedef */ (*Format)(&x.format)
+	return *ptr
+}
+
+// WithFormat clones a new SamplerYcbcrConversionCreateInfo with the value of
+// Format updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SamplerYcbcrConversionCreateInfo) WithFormat(y Format) SamplerYcbcrConversionCreateInfo {
+	x.format = *( /* typedef */ (*C.VkFormat)(&y))
+	return x
+}
+func (x *SamplerYcbcrConversionCreateInfo) SetFormat(y Format) {
+	x.format = *( /* typedef */ (*C.VkFormat)(&y))
+}
+
+// YcbcrModel returns the value of ycbcrModel from VkSamplerYcbcrConversionCreateInfo
+func (x SamplerYcbcrConversionCreateInfo) YcbcrModel() SamplerYcbcrModelConversion {
+	ptr := /* typedef */ (*SamplerYcbcrModelConversion)(&x.ycbcrModel)
+	return *ptr
+}
+
+// WithYcbcrModel clones a new SamplerYcbcrConversionCreateInfo with the value of
+// YcbcrModel updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SamplerYcbcrConversionCreateInfo) WithYcbcrModel(y SamplerYcbcrModelConversion) SamplerYcbcrConversionCreateInfo {
+	x.ycbcrModel = *( /* typedef */ (*C.VkSamplerYcbcrModelConversion)(&y))
+	return x
+}
+func (x *SamplerYcbcrConversionCreateInfo) SetYcbcrModel(y SamplerYcbcrModelConversion) {
+	x.ycbcrModel = *( /* typedef */ (*C.VkSamplerYcbcrModelConversion)(&y))
+}
+
+// YcbcrRange returns the value of ycbcrRange from VkSamplerYcbcrConversionCreateInfo
+func (x SamplerYcbcrConversionCreateInfo) YcbcrRange() SamplerYcbcrRange {
+	ptr := /* typedef */ (*SamplerYcbcrRange)(&x.ycbcrRange)
+	return *ptr
+}
+
+// WithYcbcrRange clones a new SamplerYcbcrConversionCreateInfo with the value of
+// YcbcrRange updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SamplerYcbcrConversionCreateInfo) WithYcbcrRange(y SamplerYcbcrRange) SamplerYcbcrConversionCreateInfo {
+	x.ycbcrRange = *( /* typedef */ (*C.VkSamplerYcbcrRange)(&y))
+	return x
+}
+func (x *SamplerYcbcrConversionCreateInfo) SetYcbcrRange(y SamplerYcbcrRange) {
+	x.ycbcrRange = *( /* typedef */ (*C.VkSamplerYcbcrRange)(&y))
+}
+
+// Components returns the value of components from VkSamplerYcbcrConversionCreateInfo
+func (x SamplerYcbcrConversionCreateInfo) Components() ComponentMapping {
+	ptr := /* typedef */ (*ComponentMapping)(&x.components)
+	return *ptr
+}
+
+// WithComponents clones a new SamplerYcbcrConversionCreateInfo with the value of
+// Components updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SamplerYcbcrConversionCreateInfo) WithComponents(y ComponentMapping) SamplerYcbcrConversionCreateInfo {
+	x.components = *( /* typedef */ (*C.struct_VkComponentMapping)(&y))
+	return x
+}
+func (x *SamplerYcbcrConversionCreateInfo) SetComponents(y ComponentMapping) {
+	x.components = *( /* typedef */ (*C.struct_VkComponentMapping)(&y))
+}
+
+// XChromaOffset returns the value of xChromaOffset from VkSamplerYcbcrConversionCreateInfo
+func (x SamplerYcbcrConversionCreateInfo) XChromaOffset() ChromaLocation {
+	ptr := /* typedef */ (*ChromaLocation)(&x.xChromaOffset)
+	return *ptr
+}
+
+// WithXChromaOffset clones a new SamplerYcbcrConversionCreateInfo with the value of
+// XChromaOffset updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SamplerYcbcrConversionCreateInfo) WithXChromaOffset(y ChromaLocation) SamplerYcbcrConversionCreateInfo {
+	x.xChromaOffset = *( /* typedef */ (*C.VkChromaLocation)(&y))
+	return x
+}
+func (x *SamplerYcbcrConversionCreateInfo) SetXChromaOffset(y ChromaLocation) {
+	x.xChromaOffset = *( /* typedef */ (*C.VkChromaLocation)(&y))
+}
+
+// YChromaOffset returns the value of yChromaOffset from VkSamplerYcbcrConversionCreateInfo
+func (x SamplerYcbcrConversionCreateInfo) YChromaOffset() ChromaLocation {
+	ptr := /* typedef */ (*ChromaLocation)(&x.yChromaOffset)
+	return *ptr
+}
+
+// WithYChromaOffset clones a new SamplerYcbcrConversionCreateInfo with the value of
+// YChromaOffset updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SamplerYcbcrConversionCreateInfo) WithYChromaOffset(y ChromaLocation) SamplerYcbcrConversionCreateInfo {
+	x.yChromaOffset = *( /* typedef */ (*C.VkChromaLocation)(&y))
+	return x
+}
+func (x *SamplerYcbcrConversionCreateInfo) SetYChromaOffset(y ChromaLocation) {
+	x.yChromaOffset = *( /* typedef */ (*C.VkChromaLocation)(&y))
+}
+
+// ChromaFilter returns the value of chromaFilter from VkSamplerYcbcrConversionCreateInfo
+func (x SamplerYcbcrConversionCreateInfo) ChromaFilter() Filter {
+	ptr := /* typedef */ (*Filter)(&x.chromaFilter)
+	return *ptr
+}
+
+// WithChromaFilter clones a new SamplerYcbcrConversionCreateInfo with the value of
+// ChromaFilter updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SamplerYcbcrConversionCreateInfo) WithChromaFilter(y Filter) SamplerYcbcrConversionCreateInfo {
+	x.chromaFilter = *( /* typedef */ (*C.VkFilter)(&y))
+	return x
+}
+func (x *SamplerYcbcrConversionCreateInfo) SetChromaFilter(y Filter) {
+	x.chromaFilter = *( /* typedef */ (*C.VkFilter)(&y))
+}
+
+// ForceExplicitReconstruction returns the value of forceExplicitReconstruction from VkSamplerYcbcrConversionCreateInfo
+func (x SamplerYcbcrConversionCreateInfo) ForceExplicitReconstruction() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.forceExplicitReconstruction)
+	return *ptr
+}
+
+// WithForceExplicitReconstruction clones a new SamplerYcbcrConversionCreateInfo with the value of
+// ForceExplicitReconstruction updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SamplerYcbcrConversionCreateInfo) WithForceExplicitReconstruction(y Bool32) SamplerYcbcrConversionCreateInfo {
+	x.forceExplicitReconstruction = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *SamplerYcbcrConversionCreateInfo) SetForceExplicitReconstruction(y Bool32) {
+	x.forceExplicitReconstruction = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PhysicalDeviceShaderDrawParameterFeatures is an alias to PhysicalDeviceShaderDrawParametersFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceShaderDrawParameterFeatures.html
+//
+// Deprecated: Most Aliases in the Vulkan spec are for compatibility purposes as extensions get
+// promoted to features. If possible, update code to use the promoted name: PhysicalDeviceShaderDrawParametersFeatures.
+type PhysicalDeviceShaderDrawParameterFeatures = PhysicalDeviceShaderDrawParametersFeatures
+
+// RenderPassMultiviewCreateInfo provides a go interface for VkRenderPassMultiviewCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkRenderPassMultiviewCreateInfo.html
+type RenderPassMultiviewCreateInfo C.struct_VkRenderPassMultiviewCreateInfo
+
+// SizeofRenderPassMultiviewCreateInfo is the memory size of a RenderPassMultiviewCreateInfo
+var SizeofRenderPassMultiviewCreateInfo int = int(unsafe.Sizeof(RenderPassMultiviewCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x RenderPassMultiviewCreateInfo) ArpPtr(arp *AutoReleasePool) *RenderPassMultiviewCreateInfo {
+	ptr := newCBlock(cULong(SizeofRenderPassMultiviewCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*RenderPassMultiviewCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *RenderPassMultiviewCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x RenderPassMultiviewCreateInfo) AsCPtr() *RenderPassMultiviewCreateInfo {
+	clone := (*RenderPassMultiviewCreateInfo)(newCBlock(cULong(SizeofRenderPassMultiviewCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// RenderPassMultiviewCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func RenderPassMultiviewCreateInfoCSlice(arp *AutoReleasePool, x ...RenderPassMultiviewCreateInfo) []RenderPassMultiviewCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofRenderPassMultiviewCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*RenderPassMultiviewCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// RenderPassMultiviewCreateInfoFreeCSlice releases the memory allocated by RenderPassMultiviewCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func RenderPassMultiviewCreateInfoFreeCSlice(x []RenderPassMultiviewCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// RenderPassMultiviewCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. RenderPassMultiviewCreateInfoFreeCSlice must be called on the returned slice.
+func RenderPassMultiviewCreateInfoMakeCSlice(x ...RenderPassMultiviewCreateInfo) []RenderPassMultiviewCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofRenderPassMultiviewCreateInfo * len(x)
+	dst := unsafe.Slice((*RenderPassMultiviewCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkRenderPassMultiviewCreateInfo
+func (x RenderPassMultiviewCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new RenderPassMultiviewCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x RenderPassMultiviewCreateInfo) WithDefaultSType() RenderPassMultiviewCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *RenderPassMultiviewCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO)
+}
+
+// WithSType clones a new RenderPassMultiviewCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderPassMultiviewCreateInfo) WithSType(y StructureType) RenderPassMultiviewCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *RenderPassMultiviewCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkRenderPassMultiviewCreateInfo
+func (x RenderPassMultiviewCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new RenderPassMultiviewCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderPassMultiviewCreateInfo) WithPNext(y unsafe.Pointer) RenderPassMultiviewCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *RenderPassMultiviewCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *RenderPassMultiviewCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SubpassCount returns the value of subpassCount from VkRenderPassMultiviewCreateInfo
+func (x RenderPassMultiviewCreateInfo) SubpassCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.subpassCount)
+	return *ptr
+}
+
+// WithSubpassCount clones a new RenderPassMultiviewCreateInfo with the value of
+// SubpassCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderPassMultiviewCreateInfo) WithSubpassCount(y uint32) RenderPassMultiviewCreateInfo {
+	x.subpassCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *RenderPassMultiviewCreateInfo) SetSubpassCount(y uint32) {
+	x.subpassCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PViewMasks returns the value of pViewMasks from VkRenderPassMultiviewCreateInfo
+func (x RenderPassMultiviewCreateInfo) PViewMasks() []uint32 {
+	if x.pViewMasks == nil {
+		return nil
+	}
+	return unsafe.Slice((*uint32)(unsafe.Pointer(x.pViewMasks)), x.subpassCount)
+}
+
+// WithPViewMasks clones a new RenderPassMultiviewCreateInfo with the value of
+// PViewMasks updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines SubpassCount as the length of this field.
+// SubpassCount is updated with the length of the new value.
+func (x RenderPassMultiviewCreateInfo) WithPViewMasks(y []uint32) RenderPassMultiviewCreateInfo {
+	x.pViewMasks = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithSubpassCount(uint32(len(y)))
+}
+func (x *RenderPassMultiviewCreateInfo) SetPViewMasks(y []uint32) {
+	x.pViewMasks = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetSubpassCount(uint32(len(y)))
+}
+
+// PinPViewMasks pins the Go memory referenced by y with the AutoReleasePool
+// and sets PViewMasks, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *RenderPassMultiviewCreateInfo) PinPViewMasks(arp *AutoReleasePool, y []uint32) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPViewMasks(y)
+}
+
+// DependencyCount returns the value of dependencyCount from VkRenderPassMultiviewCreateInfo
+func (x RenderPassMultiviewCreateInfo) DependencyCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.dependencyCount)
+	return *ptr
+}
+
+// WithDependencyCount clones a new RenderPassMultiviewCreateInfo with the value of
+// DependencyCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderPassMultiviewCreateInfo) WithDependencyCount(y uint32) RenderPassMultiviewCreateInfo {
+	x.dependencyCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *RenderPassMultiviewCreateInfo) SetDependencyCount(y uint32) {
+	x.dependencyCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PViewOffsets returns the value of pViewOffsets from VkRenderPassMultiviewCreateInfo
+func (x RenderPassMultiviewCreateInfo) PViewOffsets() []int32 {
+	if x.pViewOffsets == nil {
+		return nil
+	}
+	return unsafe.Slice((*int32)(unsafe.Pointer(x.pViewOffsets)), x.dependencyCount)
+}
+
+// WithPViewOffsets clones a new RenderPassMultiviewCreateInfo with the value of
+// PViewOffsets updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines DependencyCount as the length of this field.
+// DependencyCount is updated with the length of the new value.
+func (x RenderPassMultiviewCreateInfo) WithPViewOffsets(y []int32) RenderPassMultiviewCreateInfo {
+	x.pViewOffsets = *(func(x *[]int32) **C.int32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.int32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.int32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithDependencyCount(uint32(len(y)))
+}
+func (x *RenderPassMultiviewCreateInfo) SetPViewOffsets(y []int32) {
+	x.pViewOffsets = *(func(x *[]int32) **C.int32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.int32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.int32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetDependencyCount(uint32(len(y)))
+}
+
+// PinPViewOffsets pins the Go memory referenced by y with the AutoReleasePool
+// and sets PViewOffsets, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *RenderPassMultiviewCreateInfo) PinPViewOffsets(arp *AutoReleasePool, y []int32) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPViewOffsets(y)
+}
+
+// CorrelationMaskCount returns the value of correlationMaskCount from VkRenderPassMultiviewCreateInfo
+func (x RenderPassMultiviewCreateInfo) CorrelationMaskCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.correlationMaskCount)
+	return *ptr
+}
+
+// WithCorrelationMaskCount clones a new RenderPassMultiviewCreateInfo with the value of
+// CorrelationMaskCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderPassMultiviewCreateInfo) WithCorrelationMaskCount(y uint32) RenderPassMultiviewCreateInfo {
+	x.correlationMaskCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *RenderPassMultiviewCreateInfo) SetCorrelationMaskCount(y uint32) {
+	x.correlationMaskCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PCorrelationMasks returns the value of pCorrelationMasks from VkRenderPassMultiviewCreateInfo
+func (x RenderPassMultiviewCreateInfo) PCorrelationMasks() []uint32 {
+	if x.pCorrelationMasks == nil {
+		return nil
+	}
+	return unsafe.Slice((*uint32)(unsafe.Pointer(x.pCorrelationMasks)), x.correlationMaskCount)
+}
+
+// WithPCorrelationMasks clones a new RenderPassMultiviewCreateInfo with the value of
+// PCorrelationMasks updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines CorrelationMaskCount as the length of this field.
+// CorrelationMaskCount is updated with the length of the new value.
+func (x RenderPassMultiviewCreateInfo) WithPCorrelationMasks(y []uint32) RenderPassMultiviewCreateInfo {
+	x.pCorrelationMasks = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithCorrelationMaskCount(uint32(len(y)))
+}
+func (x *RenderPassMultiviewCreateInfo) SetPCorrelationMasks(y []uint32) {
+	x.pCorrelationMasks = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetCorrelationMaskCount(uint32(len(y)))
+}
+
+// PinPCorrelationMasks pins the Go memory referenced by y with the AutoReleasePool
+// and sets PCorrelationMasks, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *RenderPassMultiviewCreateInfo) PinPCorrelationMasks(arp *AutoReleasePool, y []uint32) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPCorrelationMasks(y)
+}
+
+// ProtectedSubmitInfo provides a go interface for VkProtectedSubmitInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkProtectedSubmitInfo.html
+type ProtectedSubmitInfo C.struct_VkProtectedSubmitInfo
+
+// SizeofProtectedSubmitInfo is the memory size of a ProtectedSubmitInfo
+var SizeofProtectedSubmitInfo int = int(unsafe.Sizeof(ProtectedSubmitInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ProtectedSubmitInfo) ArpPtr(arp *AutoReleasePool) *ProtectedSubmitInfo {
+	ptr := newCBlock(cULong(SizeofProtectedSubmitInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ProtectedSubmitInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ProtectedSubmitInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ProtectedSubmitInfo) AsCPtr() *ProtectedSubmitInfo {
+	clone := (*ProtectedSubmitInfo)(newCBlock(cULong(SizeofProtectedSubmitInfo)))
+	*clone = x
+	return clone
+}
+
+// ProtectedSubmitInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ProtectedSubmitInfoCSlice(arp *AutoReleasePool, x ...ProtectedSubmitInfo) []ProtectedSubmitInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofProtectedSubmitInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ProtectedSubmitInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ProtectedSubmitInfoFreeCSlice releases the memory allocated by ProtectedSubmitInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func ProtectedSubmitInfoFreeCSlice(x []ProtectedSubmitInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ProtectedSubmitInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ProtectedSubmitInfoFreeCSlice must be called on the returned slice.
+func ProtectedSubmitInfoMakeCSlice(x ...ProtectedSubmitInfo) []ProtectedSubmitInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofProtectedSubmitInfo * len(x)
+	dst := unsafe.Slice((*ProtectedSubmitInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkProtectedSubmitInfo
+func (x ProtectedSubmitInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ProtectedSubmitInfo with the value of
+// SType to the value provided in the specification.
+func (x ProtectedSubmitInfo) WithDefaultSType() ProtectedSubmitInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ProtectedSubmitInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO)
+}
+
+// WithSType clones a new ProtectedSubmitInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ProtectedSubmitInfo) WithSType(y StructureType) ProtectedSubmitInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ProtectedSubmitInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkProtectedSubmitInfo
+func (x ProtectedSubmitInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ProtectedSubmitInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ProtectedSubmitInfo) WithPNext(y unsafe.Pointer) ProtectedSubmitInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ProtectedSubmitInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ProtectedSubmitInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ProtectedSubmit returns the value of protectedSubmit from VkProtectedSubmitInfo
+func (x ProtectedSubmitInfo) ProtectedSubmit() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.protectedSubmit)
+	return *ptr
+}
+
+// WithProtectedSubmit clones a new ProtectedSubmitInfo with the value of
+// ProtectedSubmit updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ProtectedSubmitInfo) WithProtectedSubmit(y Bool32) ProtectedSubmitInfo {
+	x.protectedSubmit = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *ProtectedSubmitInfo) SetProtectedSubmit(y Bool32) {
+	x.protectedSubmit = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DeviceQueueInfo2 provides a go interface for VkDeviceQueueInfo2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDeviceQueueInfo2.html
+type DeviceQueueInfo2 C.struct_VkDeviceQueueInfo2
+
+// SizeofDeviceQueueInfo2 is the memory size of a DeviceQueueInfo2
+var SizeofDeviceQueueInfo2 int = int(unsafe.Sizeof(DeviceQueueInfo2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DeviceQueueInfo2) ArpPtr(arp *AutoReleasePool) *DeviceQueueInfo2 {
+	ptr := newCBlock(cULong(SizeofDeviceQueueInfo2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DeviceQueueInfo2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DeviceQueueInfo2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DeviceQueueInfo2) AsCPtr() *DeviceQueueInfo2 {
+	clone := (*DeviceQueueInfo2)(newCBlock(cULong(SizeofDeviceQueueInfo2)))
+	*clone = x
+	return clone
+}
+
+// DeviceQueueInfo2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DeviceQueueInfo2CSlice(arp *AutoReleasePool, x ...DeviceQueueInfo2) []DeviceQueueInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceQueueInfo2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DeviceQueueInfo2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DeviceQueueInfo2FreeCSlice releases the memory allocated by DeviceQueueInfo2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func DeviceQueueInfo2FreeCSlice(x []DeviceQueueInfo2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DeviceQueueInfo2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DeviceQueueInfo2FreeCSlice must be called on the returned slice.
+func DeviceQueueInfo2MakeCSlice(x ...DeviceQueueInfo2) []DeviceQueueInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceQueueInfo2 * len(x)
+	dst := unsafe.Slice((*DeviceQueueInfo2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDeviceQueueInfo2
+func (x DeviceQueueInfo2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DeviceQueueInfo2 with the value of
+// SType to the value provided in the specification.
+func (x DeviceQueueInfo2) WithDefaultSType() DeviceQueueInfo2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_DEVICE_QUEUE_INFO_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DeviceQueueInfo2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DEVICE_QUEUE_INFO_2)
+}
+
+// WithSType clones a new DeviceQueueInfo2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceQueueInfo2) WithSType(y StructureType) DeviceQueueInfo2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DeviceQueueInfo2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDeviceQueueInfo2
+func (x DeviceQueueInfo2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DeviceQueueInfo2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceQueueInfo2) WithPNext(y unsafe.Pointer) DeviceQueueInfo2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceQueueInfo2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DeviceQueueInfo2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Flags returns the value of flags from VkDeviceQueueInfo2
+func (x DeviceQueueInfo2) Flags() DeviceQueueCreateFlags {
+	ptr := /* typedef */ (*DeviceQueueCreateFlags)(&x.flags)
+	return *ptr
+}
+
+// WithFlags clones a new DeviceQueueInfo2 with the value of
+// Flags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceQueueInfo2) WithFlags(y DeviceQueueCreateFlags) DeviceQueueInfo2 {
+	x.flags = *( /* typedef */ (*C.VkDeviceQueueCreateFlags)(&y))
+	return x
+}
+func (x *DeviceQueueInfo2) SetFlags(y DeviceQueueCreateFlags) {
+	x.flags = *( /* typedef */ (*C.VkDeviceQueueCreateFlags)(&y))
+}
+
+// QueueFamilyIndex returns the value of queueFamilyIndex from VkDeviceQueueInfo2
+func (x DeviceQueueInfo2) QueueFamilyIndex() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.queueFamilyIndex)
+	return *ptr
+}
+
+// WithQueueFamilyIndex clones a new DeviceQueueInfo2 with the value of
+// QueueFamilyIndex updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceQueueInfo2) WithQueueFamilyIndex(y uint32) DeviceQueueInfo2 {
+	x.queueFamilyIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceQueueInfo2) SetQueueFamilyIndex(y uint32) {
+	x.queueFamilyIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// QueueIndex returns the value of queueIndex from VkDeviceQueueInfo2
+func (x DeviceQueueInfo2) QueueIndex() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.queueIndex)
+	return *ptr
+}
+
+// WithQueueIndex clones a new DeviceQueueInfo2 with the value of
+// QueueIndex updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceQueueInfo2) WithQueueIndex(y uint32) DeviceQueueInfo2 {
+	x.queueIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceQueueInfo2) SetQueueIndex(y uint32) {
+	x.queueIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PhysicalDeviceVariablePointersFeatures provides a go interface for VkPhysicalDeviceVariablePointersFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceVariablePointersFeatures.html
+type PhysicalDeviceVariablePointersFeatures C.struct_VkPhysicalDeviceVariablePointersFeatures
+
+// SizeofPhysicalDeviceVariablePointersFeatures is the memory size of a PhysicalDeviceVariablePointersFeatures
+var SizeofPhysicalDeviceVariablePointersFeatures int = int(unsafe.Sizeof(PhysicalDeviceVariablePointersFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceVariablePointersFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceVariablePointersFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceVariablePointersFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceVariablePointersFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceVariablePointersFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceVariablePointersFeatures) AsCPtr() *PhysicalDeviceVariablePointersFeatures {
+	clone := (*PhysicalDeviceVariablePointersFeatures)(newCBlock(cULong(SizeofPhysicalDeviceVariablePointersFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceVariablePointersFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceVariablePointersFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceVariablePointersFeatures) []PhysicalDeviceVariablePointersFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceVariablePointersFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceVariablePointersFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceVariablePointersFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceVariablePointersFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceVariablePointersFeaturesFreeCSlice(x []PhysicalDeviceVariablePointersFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceVariablePointersFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceVariablePointersFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceVariablePointersFeaturesMakeCSlice(x ...PhysicalDeviceVariablePointersFeatures) []PhysicalDeviceVariablePointersFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceVariablePointersFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceVariablePointersFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceVariablePointersFeatures
+func (x PhysicalDeviceVariablePointersFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceVariablePointersFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceVariablePointersFeatures) WithDefaultSType() PhysicalDeviceVariablePointersFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceVariablePointersFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceVariablePointersFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVariablePointersFeatures) WithSType(y StructureType) PhysicalDeviceVariablePointersFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceVariablePointersFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceVariablePointersFeatures
+func (x PhysicalDeviceVariablePointersFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceVariablePointersFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVariablePointersFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceVariablePointersFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceVariablePointersFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceVariablePointersFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// VariablePointersStorageBuffer returns the value of variablePointersStorageBuffer from VkPhysicalDeviceVariablePointersFeatures
+func (x PhysicalDeviceVariablePointersFeatures) VariablePointersStorageBuffer() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.variablePointersStorageBuffer)
+	return *ptr
+}
+
+// WithVariablePointersStorageBuffer clones a new PhysicalDeviceVariablePointersFeatures with the value of
+// VariablePointersStorageBuffer updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVariablePointersFeatures) WithVariablePointersStorageBuffer(y Bool32) PhysicalDeviceVariablePointersFeatures {
+	x.variablePointersStorageBuffer = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVariablePointersFeatures) SetVariablePointersStorageBuffer(y Bool32) {
+	x.variablePointersStorageBuffer = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// VariablePointers returns the value of variablePointers from VkPhysicalDeviceVariablePointersFeatures
+func (x PhysicalDeviceVariablePointersFeatures) VariablePointers() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.variablePointers)
+	return *ptr
+}
+
+// WithVariablePointers clones a new PhysicalDeviceVariablePointersFeatures with the value of
+// VariablePointers updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVariablePointersFeatures) WithVariablePointers(y Bool32) PhysicalDeviceVariablePointersFeatures {
+	x.variablePointers = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVariablePointersFeatures) SetVariablePointers(y Bool32) {
+	x.variablePointers = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PhysicalDeviceProtectedMemoryFeatures provides a go interface for VkPhysicalDeviceProtectedMemoryFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceProtectedMemoryFeatures.html
+type PhysicalDeviceProtectedMemoryFeatures C.struct_VkPhysicalDeviceProtectedMemoryFeatures
+
+// SizeofPhysicalDeviceProtectedMemoryFeatures is the memory size of a PhysicalDeviceProtectedMemoryFeatures
+var SizeofPhysicalDeviceProtectedMemoryFeatures int = int(unsafe.Sizeof(PhysicalDeviceProtectedMemoryFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceProtectedMemoryFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceProtectedMemoryFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceProtectedMemoryFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceProtectedMemoryFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceProtectedMemoryFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceProtectedMemoryFeatures) AsCPtr() *PhysicalDeviceProtectedMemoryFeatures {
+	clone := (*PhysicalDeviceProtectedMemoryFeatures)(newCBlock(cULong(SizeofPhysicalDeviceProtectedMemoryFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceProtectedMemoryFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceProtectedMemoryFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceProtectedMemoryFeatures) []PhysicalDeviceProtectedMemoryFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceProtectedMemoryFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceProtectedMemoryFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceProtectedMemoryFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceProtectedMemoryFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceProtectedMemoryFeaturesFreeCSlice(x []PhysicalDeviceProtectedMemoryFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceProtectedMemoryFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceProtectedMemoryFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceProtectedMemoryFeaturesMakeCSlice(x ...PhysicalDeviceProtectedMemoryFeatures) []PhysicalDeviceProtectedMemoryFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceProtectedMemoryFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceProtectedMemoryFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceProtectedMemoryFeatures
+func (x PhysicalDeviceProtectedMemoryFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceProtectedMemoryFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceProtectedMemoryFeatures) WithDefaultSType() PhysicalDeviceProtectedMemoryFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceProtectedMemoryFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceProtectedMemoryFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceProtectedMemoryFeatures) WithSType(y StructureType) PhysicalDeviceProtectedMemoryFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceProtectedMemoryFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceProtectedMemoryFeatures
+func (x PhysicalDeviceProtectedMemoryFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceProtectedMemoryFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceProtectedMemoryFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceProtectedMemoryFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceProtectedMemoryFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceProtectedMemoryFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ProtectedMemory returns the value of protectedMemory from VkPhysicalDeviceProtectedMemoryFeatures
+func (x PhysicalDeviceProtectedMemoryFeatures) ProtectedMemory() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.protectedMemory)
+	return *ptr
+}
+
+// WithProtectedMemory clones a new PhysicalDeviceProtectedMemoryFeatures with the value of
+// ProtectedMemory updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceProtectedMemoryFeatures) WithProtectedMemory(y Bool32) PhysicalDeviceProtectedMemoryFeatures {
+	x.protectedMemory = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceProtectedMemoryFeatures) SetProtectedMemory(y Bool32) {
+	x.protectedMemory = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ExportSemaphoreCreateInfo provides a go interface for VkExportSemaphoreCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkExportSemaphoreCreateInfo.html
+type ExportSemaphoreCreateInfo C.struct_VkExportSemaphoreCreateInfo
+
+// SizeofExportSemaphoreCreateInfo is the memory size of a ExportSemaphoreCreateInfo
+var SizeofExportSemaphoreCreateInfo int = int(unsafe.Sizeof(ExportSemaphoreCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ExportSemaphoreCreateInfo) ArpPtr(arp *AutoReleasePool) *ExportSemaphoreCreateInfo {
+	ptr := newCBlock(cULong(SizeofExportSemaphoreCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ExportSemaphoreCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ExportSemaphoreCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ExportSemaphoreCreateInfo) AsCPtr() *ExportSemaphoreCreateInfo {
+	clone := (*ExportSemaphoreCreateInfo)(newCBlock(cULong(SizeofExportSemaphoreCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// ExportSemaphoreCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ExportSemaphoreCreateInfoCSlice(arp *AutoReleasePool, x ...ExportSemaphoreCreateInfo) []ExportSemaphoreCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofExportSemaphoreCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ExportSemaphoreCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ExportSemaphoreCreateInfoFreeCSlice releases the memory allocated by ExportSemaphoreCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func ExportSemaphoreCreateInfoFreeCSlice(x []ExportSemaphoreCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ExportSemaphoreCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ExportSemaphoreCreateInfoFreeCSlice must be called on the returned slice.
+func ExportSemaphoreCreateInfoMakeCSlice(x ...ExportSemaphoreCreateInfo) []ExportSemaphoreCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofExportSemaphoreCreateInfo * len(x)
+	dst := unsafe.Slice((*ExportSemaphoreCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkExportSemaphoreCreateInfo
+func (x ExportSemaphoreCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ExportSemaphoreCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x ExportSemaphoreCreateInfo) WithDefaultSType() ExportSemaphoreCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ExportSemaphoreCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO)
+}
+
+// WithSType clones a new ExportSemaphoreCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExportSemaphoreCreateInfo) WithSType(y StructureType) ExportSemaphoreCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ExportSemaphoreCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkExportSemaphoreCreateInfo
+func (x ExportSemaphoreCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ExportSemaphoreCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExportSemaphoreCreateInfo) WithPNext(y unsafe.Pointer) ExportSemaphoreCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ExportSemaphoreCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ExportSemaphoreCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// HandleTypes returns the value of handleTypes from VkExportSemaphoreCreateInfo
+func (x ExportSemaphoreCreateInfo) HandleTypes() ExternalSemaphoreHandleTypeFlags {
+	ptr := /* typedef */ (*ExternalSemaphoreHandleTypeFlags)(&x.handleTypes)
+	return *ptr
+}
+
+// WithHandleTypes clones a new ExportSemaphoreCreateInfo with the value of
+// HandleTypes updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExportSemaphoreCreateInfo) WithHandleTypes(y ExternalSemaphoreHandleTypeFlags) ExportSemaphoreCreateInfo {
+	x.handleTypes = *( /* typedef */ (*C.VkExternalSemaphoreHandleTypeFlags)(&y))
+	return x
+}
+func (x *ExportSemaphoreCreateInfo) SetHandleTypes(y ExternalSemaphoreHandleTypeFlags) {
+	x.handleTypes = *( /* typedef */ (*C.VkExternalSemaphoreHandleTypeFlags)(&y))
+}
+
+// PhysicalDeviceIDProperties provides a go interface for VkPhysicalDeviceIDProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceIDProperties.html
+type PhysicalDeviceIDProperties C.struct_VkPhysicalDeviceIDProperties
+
+// SizeofPhysicalDeviceIDProperties is the memory size of a PhysicalDeviceIDProperties
+var SizeofPhysicalDeviceIDProperties int = int(unsafe.Sizeof(PhysicalDeviceIDProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceIDProperties) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceIDProperties {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceIDProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceIDProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceIDProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceIDProperties) AsCPtr() *PhysicalDeviceIDProperties {
+	clone := (*PhysicalDeviceIDProperties)(newCBlock(cULong(SizeofPhysicalDeviceIDProperties)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceIDPropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceIDPropertiesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceIDProperties) []PhysicalDeviceIDProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceIDProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceIDProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceIDPropertiesFreeCSlice releases the memory allocated by PhysicalDeviceIDPropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceIDPropertiesFreeCSlice(x []PhysicalDeviceIDProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceIDPropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceIDPropertiesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceIDPropertiesMakeCSlice(x ...PhysicalDeviceIDProperties) []PhysicalDeviceIDProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceIDProperties * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceIDProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceIDProperties
+func (x *PhysicalDeviceIDProperties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceIDProperties with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceIDProperties) WithDefaultSType() PhysicalDeviceIDProperties {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceIDProperties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES)
+}
+
+// WithSType clones a new PhysicalDeviceIDProperties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceIDProperties) WithSType(y StructureType) PhysicalDeviceIDProperties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceIDProperties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceIDProperties
+func (x *PhysicalDeviceIDProperties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceIDProperties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceIDProperties) WithPNext(y unsafe.Pointer) PhysicalDeviceIDProperties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceIDProperties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceIDProperties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// DeviceUUID returns the value of deviceUUID from VkPhysicalDeviceIDProperties
+// The slice references the array in x; it is not a copy.
+func (x *PhysicalDeviceIDProperties) DeviceUUID() []byte {
+	ptr := func(x *[VK_UUID_SIZE]C.uint8_t) *[]byte { /* Array for byte */
+		slc := unsafe.Slice((*byte)(unsafe.Pointer(x)), VK_UUID_SIZE)
+		return &slc
+	}(&x.deviceUUID)
+	return *ptr
+}
+
+// DriverUUID returns the value of driverUUID from VkPhysicalDeviceIDProperties
+// The slice references the array in x; it is not a copy.
+func (x *PhysicalDeviceIDProperties) DriverUUID() []byte {
+	ptr := func(x *[VK_UUID_SIZE]C.uint8_t) *[]byte { /* Array for byte */
+		slc := unsafe.Slice((*byte)(unsafe.Pointer(x)), VK_UUID_SIZE)
+		return &slc
+	}(&x.driverUUID)
+	return *ptr
+}
+
+// DeviceLUID returns the value of deviceLUID from VkPhysicalDeviceIDProperties
+// The slice references the array in x; it is not a copy.
+func (x *PhysicalDeviceIDProperties) DeviceLUID() []byte {
+	ptr := func(x *[VK_LUID_SIZE]C.uint8_t) *[]byte { /* Array for byte */
+		slc := unsafe.Slice((*byte)(unsafe.Pointer(x)), VK_LUID_SIZE)
+		return &slc
+	}(&x.deviceLUID)
+	return *ptr
+}
+
+// DeviceNodeMask returns the value of deviceNodeMask from VkPhysicalDeviceIDProperties
+func (x *PhysicalDeviceIDProperties) DeviceNodeMask() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.deviceNodeMask)
+	return *ptr
+}
+
+// DeviceLUIDValid returns the value of deviceLUIDValid from VkPhysicalDeviceIDProperties
+func (x *PhysicalDeviceIDProperties) DeviceLUIDValid() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.deviceLUIDValid)
+	return *ptr
+}
+
+// ExternalBufferProperties provides a go interface for VkExternalBufferProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkExternalBufferProperties.html
+type ExternalBufferProperties C.struct_VkExternalBufferProperties
+
+// SizeofExternalBufferProperties is the memory size of a ExternalBufferProperties
+var SizeofExternalBufferProperties int = int(unsafe.Sizeof(ExternalBufferProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ExternalBufferProperties) ArpPtr(arp *AutoReleasePool) *ExternalBufferProperties {
+	ptr := newCBlock(cULong(SizeofExternalBufferProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ExternalBufferProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ExternalBufferProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ExternalBufferProperties) AsCPtr() *ExternalBufferProperties {
+	clone := (*ExternalBufferProperties)(newCBlock(cULong(SizeofExternalBufferProperties)))
+	*clone = x
+	return clone
+}
+
+// ExternalBufferPropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ExternalBufferPropertiesCSlice(arp *AutoReleasePool, x ...ExternalBufferProperties) []ExternalBufferProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofExternalBufferProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ExternalBufferProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ExternalBufferPropertiesFreeCSlice releases the memory allocated by ExternalBufferPropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func ExternalBufferPropertiesFreeCSlice(x []ExternalBufferProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ExternalBufferPropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ExternalBufferPropertiesFreeCSlice must be called on the returned slice.
+func ExternalBufferPropertiesMakeCSlice(x ...ExternalBufferProperties) []ExternalBufferProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofExternalBufferProperties * len(x)
+	dst := unsafe.Slice((*ExternalBufferProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkExternalBufferProperties
+func (x ExternalBufferProperties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ExternalBufferProperties with the value of
+// SType to the value provided in the specification.
+func (x ExternalBufferProperties) WithDefaultSType() ExternalBufferProperties {
+	return x.WithSType(VK_STRUCTURE_TYPE_EXTERNAL_BUFFER_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ExternalBufferProperties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_EXTERNAL_BUFFER_PROPERTIES)
+}
+
+// WithSType clones a new ExternalBufferProperties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExternalBufferProperties) WithSType(y StructureType) ExternalBufferProperties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ExternalBufferProperties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkExternalBufferProperties
+func (x ExternalBufferProperties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ExternalBufferProperties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExternalBufferProperties) WithPNext(y unsafe.Pointer) ExternalBufferProperties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ExternalBufferProperties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ExternalBufferProperties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ExternalMemoryProperties returns the value of externalMemoryProperties from VkExternalBufferProperties
+func (x ExternalBufferProperties) ExternalMemoryProperties() ExternalMemoryProperties {
+	ptr := /* typedef */ (*ExternalMemoryProperties)(&x.externalMemoryProperties)
+	return *ptr
+}
+
+// PhysicalDeviceProtectedMemoryProperties provides a go interface for VkPhysicalDeviceProtectedMemoryProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceProtectedMemoryProperties.html
+type PhysicalDeviceProtectedMemoryProperties C.struct_VkPhysicalDeviceProtectedMemoryProperties
+
+// SizeofPhysicalDeviceProtectedMemoryProperties is the memory size of a PhysicalDeviceProtectedMemoryProperties
+var SizeofPhysicalDeviceProtectedMemoryProperties int = int(unsafe.Sizeof(PhysicalDeviceProtectedMemoryProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceProtectedMemoryProperties) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceProtectedMemoryProperties {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceProtectedMemoryProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceProtectedMemoryProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceProtectedMemoryProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceProtectedMemoryProperties) AsCPtr() *PhysicalDeviceProtectedMemoryProperties {
+	clone := (*PhysicalDeviceProtectedMemoryProperties)(newCBlock(cULong(SizeofPhysicalDeviceProtectedMemoryProperties)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceProtectedMemoryPropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceProtectedMemoryPropertiesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceProtectedMemoryProperties) []PhysicalDeviceProtectedMemoryProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceProtectedMemoryProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceProtectedMemoryProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceProtectedMemoryPropertiesFreeCSlice releases the memory allocated by PhysicalDeviceProtectedMemoryPropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceProtectedMemoryPropertiesFreeCSlice(x []PhysicalDeviceProtectedMemoryProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceProtectedMemoryPropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceProtectedMemoryPropertiesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceProtectedMemoryPropertiesMakeCSlice(x ...PhysicalDeviceProtectedMemoryProperties) []PhysicalDeviceProtectedMemoryProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceProtectedMemoryProperties * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceProtectedMemoryProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceProtectedMemoryProperties
+func (x PhysicalDeviceProtectedMemoryProperties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceProtectedMemoryProperties with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceProtectedMemoryProperties) WithDefaultSType() PhysicalDeviceProtectedMemoryProperties {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceProtectedMemoryProperties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES)
+}
+
+// WithSType clones a new PhysicalDeviceProtectedMemoryProperties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceProtectedMemoryProperties) WithSType(y StructureType) PhysicalDeviceProtectedMemoryProperties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceProtectedMemoryProperties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceProtectedMemoryProperties
+func (x PhysicalDeviceProtectedMemoryProperties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceProtectedMemoryProperties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceProtectedMemoryProperties) WithPNext(y unsafe.Pointer) PhysicalDeviceProtectedMemoryProperties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceProtectedMemoryProperties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceProtectedMemoryProperties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ProtectedNoFault returns the value of protectedNoFault from VkPhysicalDeviceProtectedMemoryProperties
+func (x PhysicalDeviceProtectedMemoryProperties) ProtectedNoFault() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.protectedNoFault)
+	return *ptr
+}
+
+// PhysicalDeviceVariablePointerFeatures is an alias to PhysicalDeviceVariablePointersFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceVariablePointerFeatures.html
+//
+// Deprecated: Most Aliases in the Vulkan spec are for compatibility purposes as extensions get
+// promoted to features. If possible, update code to use the promoted name: PhysicalDeviceVariablePointersFeatures.
+type PhysicalDeviceVariablePointerFeatures = PhysicalDeviceVariablePointersFeatures
+
+// PhysicalDeviceMultiviewProperties provides a go interface for VkPhysicalDeviceMultiviewProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceMultiviewProperties.html
+type PhysicalDeviceMultiviewProperties C.struct_VkPhysicalDeviceMultiviewProperties
+
+// SizeofPhysicalDeviceMultiviewProperties is the memory size of a PhysicalDeviceMultiviewProperties
+var SizeofPhysicalDeviceMultiviewProperties int = int(unsafe.Sizeof(PhysicalDeviceMultiviewProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceMultiviewProperties) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceMultiviewProperties {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceMultiviewProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceMultiviewProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceMultiviewProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceMultiviewProperties) AsCPtr() *PhysicalDeviceMultiviewProperties {
+	clone := (*PhysicalDeviceMultiviewProperties)(newCBlock(cULong(SizeofPhysicalDeviceMultiviewProperties)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceMultiviewPropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceMultiviewPropertiesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceMultiviewProperties) []PhysicalDeviceMultiviewProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceMultiviewProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceMultiviewProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceMultiviewPropertiesFreeCSlice releases the memory allocated by PhysicalDeviceMultiviewPropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceMultiviewPropertiesFreeCSlice(x []PhysicalDeviceMultiviewProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceMultiviewPropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceMultiviewPropertiesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceMultiviewPropertiesMakeCSlice(x ...PhysicalDeviceMultiviewProperties) []PhysicalDeviceMultiviewProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceMultiviewProperties * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceMultiviewProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceMultiviewProperties
+func (x PhysicalDeviceMultiviewProperties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceMultiviewProperties with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceMultiviewProperties) WithDefaultSType() PhysicalDeviceMultiviewProperties {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceMultiviewProperties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES)
+}
+
+// WithSType clones a new PhysicalDeviceMultiviewProperties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceMultiviewProperties) WithSType(y StructureType) PhysicalDeviceMultiviewProperties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceMultiviewProperties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceMultiviewProperties
+func (x PhysicalDeviceMultiviewProperties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceMultiviewProperties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceMultiviewProperties) WithPNext(y unsafe.Pointer) PhysicalDeviceMultiviewProperties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceMultiviewProperties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceMultiviewProperties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// MaxMultiviewViewCount returns the value of maxMultiviewViewCount from VkPhysicalDeviceMultiviewProperties
+func (x PhysicalDeviceMultiviewProperties) MaxMultiviewViewCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxMultiviewViewCount)
+	return *ptr
+}
+
+// MaxMultiviewInstanceIndex returns the value of maxMultiviewInstanceIndex from VkPhysicalDeviceMultiviewProperties
+func (x PhysicalDeviceMultiviewProperties) MaxMultiviewInstanceIndex() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxMultiviewInstanceIndex)
+	return *ptr
+}
+
+// PhysicalDeviceMultiviewFeatures provides a go interface for VkPhysicalDeviceMultiviewFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceMultiviewFeatures.html
+type PhysicalDeviceMultiviewFeatures C.struct_VkPhysicalDeviceMultiviewFeatures
+
+// SizeofPhysicalDeviceMultiviewFeatures is the memory size of a PhysicalDeviceMultiviewFeatures
+var SizeofPhysicalDeviceMultiviewFeatures int = int(unsafe.Sizeof(PhysicalDeviceMultiviewFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceMultiviewFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceMultiviewFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceMultiviewFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceMultiviewFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceMultiviewFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceMultiviewFeatures) AsCPtr() *PhysicalDeviceMultiviewFeatures {
+	clone := (*PhysicalDeviceMultiviewFeatures)(newCBlock(cULong(SizeofPhysicalDeviceMultiviewFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceMultiviewFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceMultiviewFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceMultiviewFeatures) []PhysicalDeviceMultiviewFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceMultiviewFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceMultiviewFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceMultiviewFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceMultiviewFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceMultiviewFeaturesFreeCSlice(x []PhysicalDeviceMultiviewFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceMultiviewFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceMultiviewFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceMultiviewFeaturesMakeCSlice(x ...PhysicalDeviceMultiviewFeatures) []PhysicalDeviceMultiviewFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceMultiviewFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceMultiviewFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceMultiviewFeatures
+func (x PhysicalDeviceMultiviewFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceMultiviewFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceMultiviewFeatures) WithDefaultSType() PhysicalDeviceMultiviewFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceMultiviewFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceMultiviewFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceMultiviewFeatures) WithSType(y StructureType) PhysicalDeviceMultiviewFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceMultiviewFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceMultiviewFeatures
+func (x PhysicalDeviceMultiviewFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceMultiviewFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceMultiviewFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceMultiviewFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceMultiviewFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceMultiviewFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Multiview returns the value of multiview from VkPhysicalDeviceMultiviewFeatures
+func (x PhysicalDeviceMultiviewFeatures) Multiview() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.multiview)
+	return *ptr
+}
+
+// WithMultiview clones a new PhysicalDeviceMultiviewFeatures with the value of
+// Multiview updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceMultiviewFeatures) WithMultiview(y Bool32) PhysicalDeviceMultiviewFeatures {
+	x.multiview = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceMultiviewFeatures) SetMultiview(y Bool32) {
+	x.multiview = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// MultiviewGeometryShader returns the value of multiviewGeometryShader from VkPhysicalDeviceMultiviewFeatures
+func (x PhysicalDeviceMultiviewFeatures) MultiviewGeometryShader() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.multiviewGeometryShader)
+	return *ptr
+}
+
+// WithMultiviewGeometryShader clones a new PhysicalDeviceMultiviewFeatures with the value of
+// MultiviewGeometryShader updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceMultiviewFeatures) WithMultiviewGeometryShader(y Bool32) PhysicalDeviceMultiviewFeatures {
+	x.multiviewGeometryShader = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceMultiviewFeatures) SetMultiviewGeometryShader(y Bool32) {
+	x.multiviewGeometryShader = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// MultiviewTessellationShader returns the value of multiviewTessellationShader from VkPhysicalDeviceMultiviewFeatures
+func (x PhysicalDeviceMultiviewFeatures) MultiviewTessellationShader() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.multiviewTessellationShader)
+	return *ptr
+}
+
+// WithMultiviewTessellationShader clones a new PhysicalDeviceMultiviewFeatures with the value of
+// MultiviewTessellationShader updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceMultiviewFeatures) WithMultiviewTessellationShader(y Bool32) PhysicalDeviceMultiviewFeatures {
+	x.multiviewTessellationShader = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceMultiviewFeatures) SetMultiviewTessellationShader(y Bool32) {
+	x.multiviewTessellationShader = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PhysicalDevicePointClippingProperties provides a go interface for VkPhysicalDevicePointClippingProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDevicePointClippingProperties.html
+type PhysicalDevicePointClippingProperties C.struct_VkPhysicalDevicePointClippingProperties
+
+// SizeofPhysicalDevicePointClippingProperties is the memory size of a PhysicalDevicePointClippingProperties
+var SizeofPhysicalDevicePointClippingProperties int = int(unsafe.Sizeof(PhysicalDevicePointClippingProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDevicePointClippingProperties) ArpPtr(arp *AutoReleasePool) *PhysicalDevicePointClippingProperties {
+	ptr := newCBlock(cULong(SizeofPhysicalDevicePointClippingProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDevicePointClippingProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDevicePointClippingProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDevicePointClippingProperties) AsCPtr() *PhysicalDevicePointClippingProperties {
+	clone := (*PhysicalDevicePointClippingProperties)(newCBlock(cULong(SizeofPhysicalDevicePointClippingProperties)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDevicePointClippingPropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDevicePointClippingPropertiesCSlice(arp *AutoReleasePool, x ...PhysicalDevicePointClippingProperties) []PhysicalDevicePointClippingProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDevicePointClippingProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDevicePointClippingProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDevicePointClippingPropertiesFreeCSlice releases the memory allocated by PhysicalDevicePointClippingPropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDevicePointClippingPropertiesFreeCSlice(x []PhysicalDevicePointClippingProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDevicePointClippingPropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDevicePointClippingPropertiesFreeCSlice must be called on the returned slice.
+func PhysicalDevicePointClippingPropertiesMakeCSlice(x ...PhysicalDevicePointClippingProperties) []PhysicalDevicePointClippingProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDevicePointClippingProperties * len(x)
+	dst := unsafe.Slice((*PhysicalDevicePointClippingProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDevicePointClippingProperties
+func (x PhysicalDevicePointClippingProperties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDevicePointClippingProperties with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDevicePointClippingProperties) WithDefaultSType() PhysicalDevicePointClippingProperties {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDevicePointClippingProperties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_PROPERTIES)
+}
+
+// WithSType clones a new PhysicalDevicePointClippingProperties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePointClippingProperties) WithSType(y StructureType) PhysicalDevicePointClippingProperties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDevicePointClippingProperties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDevicePointClippingProperties
+func (x PhysicalDevicePointClippingProperties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDevicePointClippingProperties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePointClippingProperties) WithPNext(y unsafe.Pointer) PhysicalDevicePointClippingProperties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDevicePointClippingProperties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDevicePointClippingProperties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// PointClippingBehavior returns the value of pointClippingBehavior from VkPhysicalDevicePointClippingProperties
+func (x PhysicalDevicePointClippingProperties) PointClippingBehavior() PointClippingBehavior {
+	ptr := /* typedef */ (*PointClippingBehavior)(&x.pointClippingBehavior)
+	return *ptr
+}
+
+// PhysicalDeviceSubgroupProperties provides a go interface for VkPhysicalDeviceSubgroupProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceSubgroupProperties.html
+type PhysicalDeviceSubgroupProperties C.struct_VkPhysicalDeviceSubgroupProperties
+
+// SizeofPhysicalDeviceSubgroupProperties is the memory size of a PhysicalDeviceSubgroupProperties
+var SizeofPhysicalDeviceSubgroupProperties int = int(unsafe.Sizeof(PhysicalDeviceSubgroupProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceSubgroupProperties) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceSubgroupProperties {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceSubgroupProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceSubgroupProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceSubgroupProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceSubgroupProperties) AsCPtr() *PhysicalDeviceSubgroupProperties {
+	clone := (*PhysicalDeviceSubgroupProperties)(newCBlock(cULong(SizeofPhysicalDeviceSubgroupProperties)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceSubgroupPropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceSubgroupPropertiesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceSubgroupProperties) []PhysicalDeviceSubgroupProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceSubgroupProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceSubgroupProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceSubgroupPropertiesFreeCSlice releases the memory allocated by PhysicalDeviceSubgroupPropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceSubgroupPropertiesFreeCSlice(x []PhysicalDeviceSubgroupProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceSubgroupPropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceSubgroupPropertiesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceSubgroupPropertiesMakeCSlice(x ...PhysicalDeviceSubgroupProperties) []PhysicalDeviceSubgroupProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceSubgroupProperties * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceSubgroupProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceSubgroupProperties
+func (x PhysicalDeviceSubgroupProperties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceSubgroupProperties with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceSubgroupProperties) WithDefaultSType() PhysicalDeviceSubgroupProperties {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceSubgroupProperties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES)
+}
+
+// WithSType clones a new PhysicalDeviceSubgroupProperties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSubgroupProperties) WithSType(y StructureType) PhysicalDeviceSubgroupProperties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceSubgroupProperties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceSubgroupProperties
+func (x PhysicalDeviceSubgroupProperties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceSubgroupProperties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSubgroupProperties) WithPNext(y unsafe.Pointer) PhysicalDeviceSubgroupProperties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceSubgroupProperties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceSubgroupProperties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SubgroupSize returns the value of subgroupSize from VkPhysicalDeviceSubgroupProperties
+func (x PhysicalDeviceSubgroupProperties) SubgroupSize() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.subgroupSize)
+	return *ptr
+}
+
+// SupportedStages returns the value of supportedStages from VkPhysicalDeviceSubgroupProperties
+func (x PhysicalDeviceSubgroupProperties) SupportedStages() ShaderStageFlags {
+	ptr := /* typedef */ (*ShaderStageFlags)(&x.supportedStages)
+	return *ptr
+}
+
+// SupportedOperations returns the value of supportedOperations from VkPhysicalDeviceSubgroupProperties
+func (x PhysicalDeviceSubgroupProperties) SupportedOperations() SubgroupFeatureFlags {
+	ptr := /* typedef */ (*SubgroupFeatureFlags)(&x.supportedOperations)
+	return *ptr
+}
+
+// QuadOperationsInAllStages returns the value of quadOperationsInAllStages from VkPhysicalDeviceSubgroupProperties
+func (x PhysicalDeviceSubgroupProperties) QuadOperationsInAllStages() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.quadOperationsInAllStages)
+	return *ptr
+}
+
+// InputAttachmentAspectReference provides a go interface for VkInputAttachmentAspectReference.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkInputAttachmentAspectReference.html
+type InputAttachmentAspectReference C.struct_VkInputAttachmentAspectReference
+
+// SizeofInputAttachmentAspectReference is the memory size of a InputAttachmentAspectReference
+var SizeofInputAttachmentAspectReference int = int(unsafe.Sizeof(InputAttachmentAspectReference{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x InputAttachmentAspectReference) ArpPtr(arp *AutoReleasePool) *InputAttachmentAspectReference {
+	ptr := newCBlock(cULong(SizeofInputAttachmentAspectReference))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*InputAttachmentAspectReference)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *InputAttachmentAspectReference) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x InputAttachmentAspectReference) AsCPtr() *InputAttachmentAspectReference {
+	clone := (*InputAttachmentAspectReference)(newCBlock(cULong(SizeofInputAttachmentAspectReference)))
+	*clone = x
+	return clone
+}
+
+// InputAttachmentAspectReferenceCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func InputAttachmentAspectReferenceCSlice(arp *AutoReleasePool, x ...InputAttachmentAspectReference) []InputAttachmentAspectReference {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofInputAttachmentAspectReference * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*InputAttachmentAspectReference)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// InputAttachmentAspectReferenceFreeCSlice releases the memory allocated by InputAttachmentAspectReferenceMakeCSlice.
+// It does not free pointers stored inside the slice.
+func InputAttachmentAspectReferenceFreeCSlice(x []InputAttachmentAspectReference) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// InputAttachmentAspectReferenceMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. InputAttachmentAspectReferenceFreeCSlice must be called on the returned slice.
+func InputAttachmentAspectReferenceMakeCSlice(x ...InputAttachmentAspectReference) []InputAttachmentAspectReference {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofInputAttachmentAspectReference * len(x)
+	dst := unsafe.Slice((*InputAttachmentAspectReference)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// Subpass returns the value of subpass from VkInputAttachmentAspectReference
+func (x InputAttachmentAspectReference) Subpass() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.subpass)
+	return *ptr
+}
+
+// WithSubpass clones a new InputAttachmentAspectReference with the value of
+// Subpass updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x InputAttachmentAspectReference) WithSubpass(y uint32) InputAttachmentAspectReference {
+	x.subpass = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *InputAttachmentAspectReference) SetSubpass(y uint32) {
+	x.subpass = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// InputAttachmentIndex returns the value of inputAttachmentIndex from VkInputAttachmentAspectReference
+func (x InputAttachmentAspectReference) InputAttachmentIndex() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.inputAttachmentIndex)
+	return *ptr
+}
+
+// WithInputAttachmentIndex clones a new InputAttachmentAspectReference with the value of
+// InputAttachmentIndex updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x InputAttachmentAspectReference) WithInputAttachmentIndex(y uint32) InputAttachmentAspectReference {
+	x.inputAttachmentIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *InputAttachmentAspectReference) SetInputAttachmentIndex(y uint32) {
+	x.inputAttachmentIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// AspectMask returns the value of aspectMask from VkInputAttachmentAspectReference
+func (x InputAttachmentAspectReference) AspectMask() ImageAspectFlags {
+	ptr := /* typedef */ (*ImageAspectFlags)(&x.aspectMask)
+	return *ptr
+}
+
+// WithAspectMask clones a new InputAttachmentAspectReference with the value of
+// AspectMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x InputAttachmentAspectReference) WithAspectMask(y ImageAspectFlags) InputAttachmentAspectReference {
+	x.aspectMask = *( /* typedef */ (*C.VkImageAspectFlags)(&y))
+	return x
+}
+func (x *InputAttachmentAspectReference) SetAspectMask(y ImageAspectFlags) {
+	x.aspectMask = *( /* typedef */ (*C.VkImageAspectFlags)(&y))
+}
+
+// RenderPassInputAttachmentAspectCreateInfo provides a go interface for VkRenderPassInputAttachmentAspectCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkRenderPassInputAttachmentAspectCreateInfo.html
+type RenderPassInputAttachmentAspectCreateInfo C.struct_VkRenderPassInputAttachmentAspectCreateInfo
+
+// SizeofRenderPassInputAttachmentAspectCreateInfo is the memory size of a RenderPassInputAttachmentAspectCreateInfo
+var SizeofRenderPassInputAttachmentAspectCreateInfo int = int(unsafe.Sizeof(RenderPassInputAttachmentAspectCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x RenderPassInputAttachmentAspectCreateInfo) ArpPtr(arp *AutoReleasePool) *RenderPassInputAttachmentAspectCreateInfo {
+	ptr := newCBlock(cULong(SizeofRenderPassInputAttachmentAspectCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*RenderPassInputAttachmentAspectCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *RenderPassInputAttachmentAspectCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x RenderPassInputAttachmentAspectCreateInfo) AsCPtr() *RenderPassInputAttachmentAspectCreateInfo {
+	clone := (*RenderPassInputAttachmentAspectCreateInfo)(newCBlock(cULong(SizeofRenderPassInputAttachmentAspectCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// RenderPassInputAttachmentAspectCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func RenderPassInputAttachmentAspectCreateInfoCSlice(arp *AutoReleasePool, x ...RenderPassInputAttachmentAspectCreateInfo) []RenderPassInputAttachmentAspectCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofRenderPassInputAttachmentAspectCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*RenderPassInputAttachmentAspectCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// RenderPassInputAttachmentAspectCreateInfoFreeCSlice releases the memory allocated by RenderPassInputAttachmentAspectCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func RenderPassInputAttachmentAspectCreateInfoFreeCSlice(x []RenderPassInputAttachmentAspectCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// RenderPassInputAttachmentAspectCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. RenderPassInputAttachmentAspectCreateInfoFreeCSlice must be called on the returned slice.
+func RenderPassInputAttachmentAspectCreateInfoMakeCSlice(x ...RenderPassInputAttachmentAspectCreateInfo) []RenderPassInputAttachmentAspectCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofRenderPassInputAttachmentAspectCreateInfo * len(x)
+	dst := unsafe.Slice((*RenderPassInputAttachmentAspectCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkRenderPassInputAttachmentAspectCreateInfo
+func (x RenderPassInputAttachmentAspectCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new RenderPassInputAttachmentAspectCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x RenderPassInputAttachmentAspectCreateInfo) WithDefaultSType() RenderPassInputAttachmentAspectCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *RenderPassInputAttachmentAspectCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO)
+}
+
+// WithSType clones a new RenderPassInputAttachmentAspectCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderPassInputAttachmentAspectCreateInfo) WithSType(y StructureType) RenderPassInputAttachmentAspectCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *RenderPassInputAttachmentAspectCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkRenderPassInputAttachmentAspectCreateInfo
+func (x RenderPassInputAttachmentAspectCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new RenderPassInputAttachmentAspectCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderPassInputAttachmentAspectCreateInfo) WithPNext(y unsafe.Pointer) RenderPassInputAttachmentAspectCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *RenderPassInputAttachmentAspectCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *RenderPassInputAttachmentAspectCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// AspectReferenceCount returns the value of aspectReferenceCount from VkRenderPassInputAttachmentAspectCreateInfo
+func (x RenderPassInputAttachmentAspectCreateInfo) AspectReferenceCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.aspectReferenceCount)
+	return *ptr
+}
+
+// WithAspectReferenceCount clones a new RenderPassInputAttachmentAspectCreateInfo with the value of
+// AspectReferenceCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderPassInputAttachmentAspectCreateInfo) WithAspectReferenceCount(y uint32) RenderPassInputAttachmentAspectCreateInfo {
+	x.aspectReferenceCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *RenderPassInputAttachmentAspectCreateInfo) SetAspectReferenceCount(y uint32) {
+	x.aspectReferenceCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PAspectReferences returns the value of pAspectReferences from VkRenderPassInputAttachmentAspectCreateInfo
+func (x RenderPassInputAttachmentAspectCreateInfo) PAspectReferences() []InputAttachmentAspectReference {
+	if x.pAspectReferences == nil {
+		return nil
+	}
+	return unsafe.Slice((*InputAttachmentAspectReference)(unsafe.Pointer(x.pAspectReferences)), x.aspectReferenceCount)
+}
+
+// WithPAspectReferences clones a new RenderPassInputAttachmentAspectCreateInfo with the value of
+// PAspectReferences updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines AspectReferenceCount as the length of this field.
+// AspectReferenceCount is updated with the length of the new value.
+func (x RenderPassInputAttachmentAspectCreateInfo) WithPAspectReferences(y []InputAttachmentAspectReference) RenderPassInputAttachmentAspectCreateInfo {
+	x.pAspectReferences = *(func(x *[]InputAttachmentAspectReference) **C.struct_VkInputAttachmentAspectReference { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkInputAttachmentAspectReference)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkInputAttachmentAspectReference)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithAspectReferenceCount(uint32(len(y)))
+}
+func (x *RenderPassInputAttachmentAspectCreateInfo) SetPAspectReferences(y []InputAttachmentAspectReference) {
+	x.pAspectReferences = *(func(x *[]InputAttachmentAspectReference) **C.struct_VkInputAttachmentAspectReference { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkInputAttachmentAspectReference)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkInputAttachmentAspectReference)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetAspectReferenceCount(uint32(len(y)))
+}
+
+// PinPAspectReferences pins the Go memory referenced by y with the AutoReleasePool
+// and sets PAspectReferences, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *RenderPassInputAttachmentAspectCreateInfo) PinPAspectReferences(arp *AutoReleasePool, y []InputAttachmentAspectReference) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPAspectReferences(y)
+}
+
+// ImageViewUsageCreateInfo provides a go interface for VkImageViewUsageCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkImageViewUsageCreateInfo.html
+type ImageViewUsageCreateInfo C.struct_VkImageViewUsageCreateInfo
+
+// SizeofImageViewUsageCreateInfo is the memory size of a ImageViewUsageCreateInfo
+var SizeofImageViewUsageCreateInfo int = int(unsafe.Sizeof(ImageViewUsageCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ImageViewUsageCreateInfo) ArpPtr(arp *AutoReleasePool) *ImageViewUsageCreateInfo {
+	ptr := newCBlock(cULong(SizeofImageViewUsageCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ImageViewUsageCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ImageViewUsageCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ImageViewUsageCreateInfo) AsCPtr() *ImageViewUsageCreateInfo {
+	clone := (*ImageViewUsageCreateInfo)(newCBlock(cULong(SizeofImageViewUsageCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// ImageViewUsageCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ImageViewUsageCreateInfoCSlice(arp *AutoReleasePool, x ...ImageViewUsageCreateInfo) []ImageViewUsageCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImageViewUsageCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ImageViewUsageCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ImageViewUsageCreateInfoFreeCSlice releases the memory allocated by ImageViewUsageCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func ImageViewUsageCreateInfoFreeCSlice(x []ImageViewUsageCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ImageViewUsageCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ImageViewUsageCreateInfoFreeCSlice must be called on the returned slice.
+func ImageViewUsageCreateInfoMakeCSlice(x ...ImageViewUsageCreateInfo) []ImageViewUsageCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImageViewUsageCreateInfo * len(x)
+	dst := unsafe.Slice((*ImageViewUsageCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkImageViewUsageCreateInfo
+func (x ImageViewUsageCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ImageViewUsageCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x ImageViewUsageCreateInfo) WithDefaultSType() ImageViewUsageCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ImageViewUsageCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO)
+}
+
+// WithSType clones a new ImageViewUsageCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageViewUsageCreateInfo) WithSType(y StructureType) ImageViewUsageCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ImageViewUsageCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkImageViewUsageCreateInfo
+func (x ImageViewUsageCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ImageViewUsageCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageViewUsageCreateInfo) WithPNext(y unsafe.Pointer) ImageViewUsageCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ImageViewUsageCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ImageViewUsageCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Usage returns the value of usage from VkImageViewUsageCreateInfo
+func (x ImageViewUsageCreateInfo) Usage() ImageUsageFlags {
+	ptr := /* typedef */ (*ImageUsageFlags)(&x.usage)
+	return *ptr
+}
+
+// WithUsage clones a new ImageViewUsageCreateInfo with the value of
+// Usage updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageViewUsageCreateInfo) WithUsage(y ImageUsageFlags) ImageViewUsageCreateInfo {
+	x.usage = *( /* typedef */ (*C.VkImageUsageFlags)(&y))
+	return x
+}
+func (x *ImageViewUsageCreateInfo) SetUsage(y ImageUsageFlags) {
+	x.usage = *( /* typedef */ (*C.VkImageUsageFlags)(&y))
+}
+
+// ExternalFenceProperties provides a go interface for VkExternalFenceProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkExternalFenceProperties.html
+type ExternalFenceProperties C.struct_VkExternalFenceProperties
+
+// SizeofExternalFenceProperties is the memory size of a ExternalFenceProperties
+var SizeofExternalFenceProperties int = int(unsafe.Sizeof(ExternalFenceProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ExternalFenceProperties) ArpPtr(arp *AutoReleasePool) *ExternalFenceProperties {
+	ptr := newCBlock(cULong(SizeofExternalFenceProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ExternalFenceProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ExternalFenceProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ExternalFenceProperties) AsCPtr() *ExternalFenceProperties {
+	clone := (*ExternalFenceProperties)(newCBlock(cULong(SizeofExternalFenceProperties)))
+	*clone = x
+	return clone
+}
+
+// ExternalFencePropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ExternalFencePropertiesCSlice(arp *AutoReleasePool, x ...ExternalFenceProperties) []ExternalFenceProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofExternalFenceProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ExternalFenceProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ExternalFencePropertiesFreeCSlice releases the memory allocated by ExternalFencePropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func ExternalFencePropertiesFreeCSlice(x []ExternalFenceProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ExternalFencePropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ExternalFencePropertiesFreeCSlice must be called on the returned slice.
+func ExternalFencePropertiesMakeCSlice(x ...ExternalFenceProperties) []ExternalFenceProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofExternalFenceProperties * len(x)
+	dst := unsafe.Slice((*ExternalFenceProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkExternalFenceProperties
+func (x ExternalFenceProperties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ExternalFenceProperties with the value of
+// SType to the value provided in the specification.
+func (x ExternalFenceProperties) WithDefaultSType() ExternalFenceProperties {
+	return x.WithSType(VK_STRUCTURE_TYPE_EXTERNAL_FENCE_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ExternalFenceProperties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_EXTERNAL_FENCE_PROPERTIES)
+}
+
+// WithSType clones a new ExternalFenceProperties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExternalFenceProperties) WithSType(y StructureType) ExternalFenceProperties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ExternalFenceProperties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkExternalFenceProperties
+func (x ExternalFenceProperties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ExternalFenceProperties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ExternalFenceProperties) WithPNext(y unsafe.Pointer) ExternalFenceProperties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ExternalFenceProperties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ExternalFenceProperties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ExportFromImportedHandleTypes returns the value of exportFromImportedHandleTypes from VkExternalFenceProperties
+func (x ExternalFenceProperties) ExportFromImportedHandleTypes() ExternalFenceHandleTypeFlags {
+	ptr := /* typedef */ (*ExternalFenceHandleTypeFlags)(&x.exportFromImportedHandleTypes)
+	return *ptr
+}
+
+// CompatibleHandleTypes returns the value of compatibleHandleTypes from VkExternalFenceProperties
+func (x ExternalFenceProperties) CompatibleHandleTypes() ExternalFenceHandleTypeFlags {
+	ptr := /* typedef */ (*ExternalFenceHandleTypeFlags)(&x.compatibleHandleTypes)
+	return *ptr
+}
+
+// ExternalFenceFeatures returns the value of externalFenceFeatures from VkExternalFenceProperties
+func (x ExternalFenceProperties) ExternalFenceFeatures() ExternalFenceFeatureFlags {
+	ptr := /* typedef */ (*ExternalFenceFeatureFlags)(&x.externalFenceFeatures)
+	return *ptr
+}
+
+// PipelineTessellationDomainOriginStateCreateInfo provides a go interface for VkPipelineTessellationDomainOriginStateCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPipelineTessellationDomainOriginStateCreateInfo.html
+type PipelineTessellationDomainOriginStateCreateInfo C.struct_VkPipelineTessellationDomainOriginStateCreateInfo
+
+// SizeofPipelineTessellationDomainOriginStateCreateInfo is the memory size of a PipelineTessellationDomainOriginStateCreateInfo
+var SizeofPipelineTessellationDomainOriginStateCreateInfo int = int(unsafe.Sizeof(PipelineTessellationDomainOriginStateCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PipelineTessellationDomainOriginStateCreateInfo) ArpPtr(arp *AutoReleasePool) *PipelineTessellationDomainOriginStateCreateInfo {
+	ptr := newCBlock(cULong(SizeofPipelineTessellationDomainOriginStateCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PipelineTessellationDomainOriginStateCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PipelineTessellationDomainOriginStateCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PipelineTessellationDomainOriginStateCreateInfo) AsCPtr() *PipelineTessellationDomainOriginStateCreateInfo {
+	clone := (*PipelineTessellationDomainOriginStateCreateInfo)(newCBlock(cULong(SizeofPipelineTessellationDomainOriginStateCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// PipelineTessellationDomainOriginStateCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PipelineTessellationDomainOriginStateCreateInfoCSlice(arp *AutoReleasePool, x ...PipelineTessellationDomainOriginStateCreateInfo) []PipelineTessellationDomainOriginStateCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPipelineTessellationDomainOriginStateCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PipelineTessellationDomainOriginStateCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PipelineTessellationDomainOriginStateCreateInfoFreeCSlice releases the memory allocated by PipelineTessellationDomainOriginStateCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PipelineTessellationDomainOriginStateCreateInfoFreeCSlice(x []PipelineTessellationDomainOriginStateCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PipelineTessellationDomainOriginStateCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PipelineTessellationDomainOriginStateCreateInfoFreeCSlice must be called on the returned slice.
+func PipelineTessellationDomainOriginStateCreateInfoMakeCSlice(x ...PipelineTessellationDomainOriginStateCreateInfo) []PipelineTessellationDomainOriginStateCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPipelineTessellationDomainOriginStateCreateInfo * len(x)
+	dst := unsafe.Slice((*PipelineTessellationDomainOriginStateCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPipelineTessellationDomainOriginStateCreateInfo
+func (x PipelineTessellationDomainOriginStateCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PipelineTessellationDomainOriginStateCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x PipelineTessellationDomainOriginStateCreateInfo) WithDefaultSType() PipelineTessellationDomainOriginStateCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PipelineTessellationDomainOriginStateCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO)
+}
+
+// WithSType clones a new PipelineTessellationDomainOriginStateCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PipelineTessellationDomainOriginStateCreateInfo) WithSType(y StructureType) PipelineTessellationDomainOriginStateCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PipelineTessellationDomainOriginStateCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPipelineTessellationDomainOriginStateCreateInfo
+func (x PipelineTessellationDomainOriginStateCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PipelineTessellationDomainOriginStateCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PipelineTessellationDomainOriginStateCreateInfo) WithPNext(y unsafe.Pointer) PipelineTessellationDomainOriginStateCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PipelineTessellationDomainOriginStateCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PipelineTessellationDomainOriginStateCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// DomainOrigin returns the value of domainOrigin from VkPipelineTessellationDomainOriginStateCreateInfo
+func (x PipelineTessellationDomainOriginStateCreateInfo) DomainOrigin() TessellationDomainOrigin {
+	ptr := /* typedef */ (*TessellationDomainOrigin)(&x.domainOrigin)
+	return *ptr
+}
+
+// WithDomainOrigin clones a new PipelineTessellationDomainOriginStateCreateInfo with the value of
+// DomainOrigin updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PipelineTessellationDomainOriginStateCreateInfo) WithDomainOrigin(y TessellationDomainOrigin) PipelineTessellationDomainOriginStateCreateInfo {
+	x.domainOrigin = *( /* typedef */ (*C.VkTessellationDomainOrigin)(&y))
+	return x
+}
+func (x *PipelineTessellationDomainOriginStateCreateInfo) SetDomainOrigin(y TessellationDomainOrigin) {
+	x.domainOrigin = *( /* typedef */ (*C.VkTessellationDomainOrigin)(&y))
+}
+
+// GetPhysicalDeviceFormatProperties2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPhysicalDeviceFormatProperties2.html
+func (x PhysicalDeviceFacade) GetPhysicalDeviceFormatProperties2(format Format, pFormatProperties *FormatProperties2) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := /* typedef */ (*C.VkFormat)(&format)
+	p2 := func(x **FormatProperties2) **C.struct_VkFormatProperties2 { /* Pointer */
+		g2c := (*C.struct_VkFormatProperties2)(*x)
+		return &g2c
+	}(&pFormatProperties)
+	C.vkGetPhysicalDeviceFormatProperties2(addrs, *p0, *p1, *p2)
+}
+
+// GetPhysicalDeviceExternalFenceProperties command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPhysicalDeviceExternalFenceProperties.html
+func (x PhysicalDeviceFacade) GetPhysicalDeviceExternalFenceProperties(pExternalFenceInfo *PhysicalDeviceExternalFenceInfo, pExternalFenceProperties *ExternalFenceProperties) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := func(x **PhysicalDeviceExternalFenceInfo) **C.struct_VkPhysicalDeviceExternalFenceInfo { /* Pointer */
+		g2c := (*C.struct_VkPhysicalDeviceExternalFenceInfo)(*x)
+		return &g2c
+	}(&pExternalFenceInfo)
+	p2 := func(x **ExternalFenceProperties) **C.struct_VkExternalFenceProperties { /* Pointer */
+		g2c := (*C.struct_VkExternalFenceProperties)(*x)
+		return &g2c
+	}(&pExternalFenceProperties)
+	C.vkGetPhysicalDeviceExternalFenceProperties(addrs, *p0, *p1, *p2)
+}
+
+// GetPhysicalDeviceExternalBufferProperties command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPhysicalDeviceExternalBufferProperties.html
+func (x PhysicalDeviceFacade) GetPhysicalDeviceExternalBufferProperties(pExternalBufferInfo *PhysicalDeviceExternalBufferInfo, pExternalBufferProperties *ExternalBufferProperties) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := func(x **PhysicalDeviceExternalBufferInfo) **C.struct_VkPhysicalDeviceExternalBufferInfo { /* Pointer */
+		g2c := (*C.struct_VkPhysicalDeviceExternalBufferInfo)(*x)
+		return &g2c
+	}(&pExternalBufferInfo)
+	p2 := func(x **ExternalBufferProperties) **C.struct_VkExternalBufferProperties { /* Pointer */
+		g2c := (*C.struct_VkExternalBufferProperties)(*x)
+		return &g2c
+	}(&pExternalBufferProperties)
+	C.vkGetPhysicalDeviceExternalBufferProperties(addrs, *p0, *p1, *p2)
+}
+
+// UpdateDescriptorSetWithTemplate command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkUpdateDescriptorSetWithTemplate.html
+func (x DeviceFacade) UpdateDescriptorSetWithTemplate(descriptorSet DescriptorSet, descriptorUpdateTemplate DescriptorUpdateTemplate, pData unsafe.Pointer) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := /* handle */ (*C.VkDescriptorSet)(&descriptorSet)
+	p2 := /* handle */ (*C.VkDescriptorUpdateTemplate)(&descriptorUpdateTemplate)
+	p3 := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&pData)
+	C.vkUpdateDescriptorSetWithTemplate(addrs, *p0, *p1, *p2, *p3)
+}
+
+// DestroyDescriptorUpdateTemplate command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkDestroyDescriptorUpdateTemplate.html
+func (x DeviceFacade) DestroyDescriptorUpdateTemplate(descriptorUpdateTemplate DescriptorUpdateTemplate, pAllocator *AllocationCallbacks) {
+	addrs := x.procs
+	if destroyHooks.Load() != nil {
+		handleDestroyed(VK_OBJECT_TYPE_DESCRIPTOR_UPDATE_TEMPLATE, uint64(uintptr(unsafe.Pointer(descriptorUpdateTemplate))))
+	}
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := /* handle */ (*C.VkDescriptorUpdateTemplate)(&descriptorUpdateTemplate)
+	p2 := func(x **AllocationCallbacks) **C.struct_VkAllocationCallbacks { /* Pointer */
+		g2c := (*C.struct_VkAllocationCallbacks)(*x)
+		return &g2c
+	}(&pAllocator)
+	C.vkDestroyDescriptorUpdateTemplate(addrs, *p0, *p1, *p2)
+}
+
+// CreateDescriptorUpdateTemplate command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCreateDescriptorUpdateTemplate.html
+func (x DeviceFacade) CreateDescriptorUpdateTemplate(pCreateInfo *DescriptorUpdateTemplateCreateInfo, pAllocator *AllocationCallbacks, pDescriptorUpdateTemplate *DescriptorUpdateTemplate) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **DescriptorUpdateTemplateCreateInfo) **C.struct_VkDescriptorUpdateTemplateCreateInfo { /* Pointer */
+		g2c := (*C.struct_VkDescriptorUpdateTemplateCreateInfo)(*x)
+		return &g2c
+	}(&pCreateInfo)
+	p2 := func(x **AllocationCallbacks) **C.struct_VkAllocationCallbacks { /* Pointer */
+		g2c := (*C.struct_VkAllocationCallbacks)(*x)
+		return &g2c
+	}(&pAllocator)
+	p3 := func(x **DescriptorUpdateTemplate) **C.VkDescriptorUpdateTemplate { /* Pointer */
+		g2c := (*C.VkDescriptorUpdateTemplate)(*x)
+		return &g2c
+	}(&pDescriptorUpdateTemplate)
+	ret := C.vkCreateDescriptorUpdateTemplate(addrs, *p0, *p1, *p2, *p3)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// DestroySamplerYcbcrConversion command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkDestroySamplerYcbcrConversion.html
+func (x DeviceFacade) DestroySamplerYcbcrConversion(ycbcrConversion SamplerYcbcrConversion, pAllocator *AllocationCallbacks) {
+	addrs := x.procs
+	if destroyHooks.Load() != nil {
+		handleDestroyed(VK_OBJECT_TYPE_SAMPLER_YCBCR_CONVERSION, uint64(uintptr(unsafe.Pointer(ycbcrConversion))))
+	}
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := /* handle */ (*C.VkSamplerYcbcrConversion)(&ycbcrConversion)
+	p2 := func(x **AllocationCallbacks) **C.struct_VkAllocationCallbacks { /* Pointer */
+		g2c := (*C.struct_VkAllocationCallbacks)(*x)
+		return &g2c
+	}(&pAllocator)
+	C.vkDestroySamplerYcbcrConversion(addrs, *p0, *p1, *p2)
+}
+
+// CreateSamplerYcbcrConversion command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCreateSamplerYcbcrConversion.html
+func (x DeviceFacade) CreateSamplerYcbcrConversion(pCreateInfo *SamplerYcbcrConversionCreateInfo, pAllocator *AllocationCallbacks, pYcbcrConversion *SamplerYcbcrConversion) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **SamplerYcbcrConversionCreateInfo) **C.struct_VkSamplerYcbcrConversionCreateInfo { /* Pointer */
+		g2c := (*C.struct_VkSamplerYcbcrConversionCreateInfo)(*x)
+		return &g2c
+	}(&pCreateInfo)
+	p2 := func(x **AllocationCallbacks) **C.struct_VkAllocationCallbacks { /* Pointer */
+		g2c := (*C.struct_VkAllocationCallbacks)(*x)
+		return &g2c
+	}(&pAllocator)
+	p3 := func(x **SamplerYcbcrConversion) **C.VkSamplerYcbcrConversion { /* Pointer */
+		g2c := (*C.VkSamplerYcbcrConversion)(*x)
+		return &g2c
+	}(&pYcbcrConversion)
+	ret := C.vkCreateSamplerYcbcrConversion(addrs, *p0, *p1, *p2, *p3)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetDeviceQueue2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetDeviceQueue2.html
+func (x DeviceFacade) GetDeviceQueue2(pQueueInfo *DeviceQueueInfo2, pQueue *Queue) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **DeviceQueueInfo2) **C.struct_VkDeviceQueueInfo2 { /* Pointer */
+		g2c := (*C.struct_VkDeviceQueueInfo2)(*x)
+		return &g2c
+	}(&pQueueInfo)
+	p2 := func(x **Queue) **C.VkQueue { /* Pointer */ g2c := (*C.VkQueue)(*x); return &g2c }(&pQueue)
+	C.vkGetDeviceQueue2(addrs, *p0, *p1, *p2)
+}
+
+// TrimCommandPool command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkTrimCommandPool.html
+func (x DeviceFacade) TrimCommandPool(commandPool CommandPool, flags CommandPoolTrimFlags) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := /* handle */ (*C.VkCommandPool)(&commandPool)
+	p2 := /* typedef */ (*C.VkCommandPoolTrimFlags)(&flags)
+	C.vkTrimCommandPool(addrs, *p0, *p1, *p2)
+}
+
+// GetPhysicalDeviceExternalSemaphoreProperties command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPhysicalDeviceExternalSemaphoreProperties.html
+func (x PhysicalDeviceFacade) GetPhysicalDeviceExternalSemaphoreProperties(pExternalSemaphoreInfo *PhysicalDeviceExternalSemaphoreInfo, pExternalSemaphoreProperties *ExternalSemaphoreProperties) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := func(x **PhysicalDeviceExternalSemaphoreInfo) **C.struct_VkPhysicalDeviceExternalSemaphoreInfo { /* Pointer */
+		g2c := (*C.struct_VkPhysicalDeviceExternalSemaphoreInfo)(*x)
+		return &g2c
+	}(&pExternalSemaphoreInfo)
+	p2 := func(x **ExternalSemaphoreProperties) **C.struct_VkExternalSemaphoreProperties { /* Pointer */
+		g2c := (*C.struct_VkExternalSemaphoreProperties)(*x)
+		return &g2c
+	}(&pExternalSemaphoreProperties)
+	C.vkGetPhysicalDeviceExternalSemaphoreProperties(addrs, *p0, *p1, *p2)
+}
+
+// GetPhysicalDeviceSparseImageFormatProperties2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPhysicalDeviceSparseImageFormatProperties2.html
+func (x PhysicalDeviceFacade) GetPhysicalDeviceSparseImageFormatProperties2(pFormatInfo *PhysicalDeviceSparseImageFormatInfo2, pPropertyCount *uint32, pProperties []SparseImageFormatProperties2) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := func(x **PhysicalDeviceSparseImageFormatInfo2) **C.struct_VkPhysicalDeviceSparseImageFormatInfo2 { /* Pointer */
+		g2c := (*C.struct_VkPhysicalDeviceSparseImageFormatInfo2)(*x)
+		return &g2c
+	}(&pFormatInfo)
+	p2 := func(x **uint32) **C.uint32_t { /* Pointer */ g2c := (*C.uint32_t)(*x); return &g2c }(&pPropertyCount)
+	p3 := func(x *[]SparseImageFormatProperties2) **C.struct_VkSparseImageFormatProperties2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkSparseImageFormatProperties2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkSparseImageFormatProperties2)(unsafe.Pointer((&ptr)))
+	}(&pProperties)
+	C.vkGetPhysicalDeviceSparseImageFormatProperties2(addrs, *p0, *p1, *p2, *p3)
+}
+
+// GetPhysicalDeviceSparseImageFormatProperties2Into calls GetPhysicalDeviceSparseImageFormatProperties2 with the count query, the fill and
+// the VK_INCOMPLETE retries in a single cgo call. The elements are stored in
+// dst, reallocated only when its capacity is too small, and returned.
+// The sType of every element is set; pNext is passed through.
+func (x PhysicalDeviceFacade) GetPhysicalDeviceSparseImageFormatProperties2Into(pFormatInfo *PhysicalDeviceSparseImageFormatInfo2, dst []SparseImageFormatProperties2) []SparseImageFormatProperties2 {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := func(x **PhysicalDeviceSparseImageFormatInfo2) **C.struct_VkPhysicalDeviceSparseImageFormatInfo2 { /* Pointer */
+		g2c := (*C.struct_VkPhysicalDeviceSparseImageFormatInfo2)(*x)
+		return &g2c
+	}(&pFormatInfo)
+	for {
+		dst = dst[:cap(dst)]
+		var items *C.struct_VkSparseImageFormatProperties2
+		if len(dst) > 0 {
+			items = (*C.struct_VkSparseImageFormatProperties2)(unsafe.Pointer(&dst[0]))
+		}
+		ret := C.vksEnumerate_vkGetPhysicalDeviceSparseImageFormatProperties2(addrs, C.uint64_t(uintptr(unsafe.Pointer(*p0))), *p1, C.uint32_t(len(dst)), items)
+		if Result(ret.result) == VK_INCOMPLETE && int(ret.count) > len(dst) {
+			dst = make([]SparseImageFormatProperties2, ret.count)
+			continue
+		}
+		return dst[:ret.count]
+	}
+}
+
+// GetPhysicalDeviceMemoryProperties2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPhysicalDeviceMemoryProperties2.html
+func (x PhysicalDeviceFacade) GetPhysicalDeviceMemoryProperties2(pMemoryProperties *PhysicalDeviceMemoryProperties2) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := func(x **PhysicalDeviceMemoryProperties2) **C.struct_VkPhysicalDeviceMemoryProperties2 { /* Pointer */
+		g2c := (*C.struct_VkPhysicalDeviceMemoryProperties2)(*x)
+		return &g2c
+	}(&pMemoryProperties)
+	C.vkGetPhysicalDeviceMemoryProperties2(addrs, *p0, *p1)
+}
+
+// GetPhysicalDeviceQueueFamilyProperties2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPhysicalDeviceQueueFamilyProperties2.html
+func (x PhysicalDeviceFacade) GetPhysicalDeviceQueueFamilyProperties2(pQueueFamilyPropertyCount *uint32, pQueueFamilyProperties []QueueFamilyProperties2) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := func(x **uint32) **C.uint32_t { /* Pointer */ g2c := (*C.uint32_t)(*x); return &g2c }(&pQueueFamilyPropertyCount)
+	p2 := func(x *[]QueueFamilyProperties2) **C.struct_VkQueueFamilyProperties2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkQueueFamilyProperties2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkQueueFamilyProperties2)(unsafe.Pointer((&ptr)))
+	}(&pQueueFamilyProperties)
+	C.vkGetPhysicalDeviceQueueFamilyProperties2(addrs, *p0, *p1, *p2)
+}
+
+// GetPhysicalDeviceQueueFamilyProperties2Into calls GetPhysicalDeviceQueueFamilyProperties2 with the count query, the fill and
+// the VK_INCOMPLETE retries in a single cgo call. The elements are stored in
+// dst, reallocated only when its capacity is too small, and returned.
+// The sType of every element is set; pNext is passed through.
+func (x PhysicalDeviceFacade) GetPhysicalDeviceQueueFamilyProperties2Into(dst []QueueFamilyProperties2) []QueueFamilyProperties2 {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	for {
+		dst = dst[:cap(dst)]
+		var items *C.struct_VkQueueFamilyProperties2
+		if len(dst) > 0 {
+			items = (*C.struct_VkQueueFamilyProperties2)(unsafe.Pointer(&dst[0]))
+		}
+		ret := C.vksEnumerate_vkGetPhysicalDeviceQueueFamilyProperties2(addrs, C.uint64_t(uintptr(unsafe.Pointer(*p0))), C.uint32_t(len(dst)), items)
+		if Result(ret.result) == VK_INCOMPLETE && int(ret.count) > len(dst) {
+			dst = make([]QueueFamilyProperties2, ret.count)
+			continue
+		}
+		return dst[:ret.count]
+	}
+}
+
+// GetPhysicalDeviceImageFormatProperties2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPhysicalDeviceImageFormatProperties2.html
+func (x PhysicalDeviceFacade) GetPhysicalDeviceImageFormatProperties2(pImageFormatInfo *PhysicalDeviceImageFormatInfo2, pImageFormatProperties *ImageFormatProperties2) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := func(x **PhysicalDeviceImageFormatInfo2) **C.struct_VkPhysicalDeviceImageFormatInfo2 { /* Pointer */
+		g2c := (*C.struct_VkPhysicalDeviceImageFormatInfo2)(*x)
+		return &g2c
+	}(&pImageFormatInfo)
+	p2 := func(x **ImageFormatProperties2) **C.struct_VkImageFormatProperties2 { /* Pointer */
+		g2c := (*C.struct_VkImageFormatProperties2)(*x)
+		return &g2c
+	}(&pImageFormatProperties)
+	ret := C.vkGetPhysicalDeviceImageFormatProperties2(addrs, *p0, *p1, *p2)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetPhysicalDeviceProperties2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPhysicalDeviceProperties2.html
+func (x PhysicalDeviceFacade) GetPhysicalDeviceProperties2(pProperties *PhysicalDeviceProperties2) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := func(x **PhysicalDeviceProperties2) **C.struct_VkPhysicalDeviceProperties2 { /* Pointer */
+		g2c := (*C.struct_VkPhysicalDeviceProperties2)(*x)
+		return &g2c
+	}(&pProperties)
+	C.vkGetPhysicalDeviceProperties2(addrs, *p0, *p1)
+}
+
+// GetPhysicalDeviceFeatures2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPhysicalDeviceFeatures2.html
+func (x PhysicalDeviceFacade) GetPhysicalDeviceFeatures2(pFeatures *PhysicalDeviceFeatures2) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := func(x **PhysicalDeviceFeatures2) **C.struct_VkPhysicalDeviceFeatures2 { /* Pointer */
+		g2c := (*C.struct_VkPhysicalDeviceFeatures2)(*x)
+		return &g2c
+	}(&pFeatures)
+	C.vkGetPhysicalDeviceFeatures2(addrs, *p0, *p1)
+}
+
+// GetImageSparseMemoryRequirements2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetImageSparseMemoryRequirements2.html
+func (x DeviceFacade) GetImageSparseMemoryRequirements2(pInfo *ImageSparseMemoryRequirementsInfo2, pSparseMemoryRequirementCount *uint32, pSparseMemoryRequirements []SparseImageMemoryRequirements2) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **ImageSparseMemoryRequirementsInfo2) **C.struct_VkImageSparseMemoryRequirementsInfo2 { /* Pointer */
+		g2c := (*C.struct_VkImageSparseMemoryRequirementsInfo2)(*x)
+		return &g2c
+	}(&pInfo)
+	p2 := func(x **uint32) **C.uint32_t { /* Pointer */ g2c := (*C.uint32_t)(*x); return &g2c }(&pSparseMemoryRequirementCount)
+	p3 := func(x *[]SparseImageMemoryRequirements2) **C.struct_VkSparseImageMemoryRequirements2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkSparseImageMemoryRequirements2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkSparseImageMemoryRequirements2)(unsafe.Pointer((&ptr)))
+	}(&pSparseMemoryRequirements)
+	C.vkGetImageSparseMemoryRequirements2(addrs, *p0, *p1, *p2, *p3)
+}
+
+// GetImageSparseMemoryRequirements2Into calls GetImageSparseMemoryRequirements2 with the count query, the fill and
+// the VK_INCOMPLETE retries in a single cgo call. The elements are stored in
+// dst, reallocated only when its capacity is too small, and returned.
+// The sType of every element is set; pNext is passed through.
+func (x DeviceFacade) GetImageSparseMemoryRequirements2Into(pInfo *ImageSparseMemoryRequirementsInfo2, dst []SparseImageMemoryRequirements2) []SparseImageMemoryRequirements2 {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **ImageSparseMemoryRequirementsInfo2) **C.struct_VkImageSparseMemoryRequirementsInfo2 { /* Pointer */
+		g2c := (*C.struct_VkImageSparseMemoryRequirementsInfo2)(*x)
+		return &g2c
+	}(&pInfo)
+	for {
+		dst = dst[:cap(dst)]
+		var items *C.struct_VkSparseImageMemoryRequirements2
+		if len(dst) > 0 {
+			items = (*C.struct_VkSparseImageMemoryRequirements2)(unsafe.Pointer(&dst[0]))
+		}
+		ret := C.vksEnumerate_vkGetImageSparseMemoryRequirements2(addrs, C.uint64_t(uintptr(unsafe.Pointer(*p0))), *p1, C.uint32_t(len(dst)), items)
+		if Result(ret.result) == VK_INCOMPLETE && int(ret.count) > len(dst) {
+			dst = make([]SparseImageMemoryRequirements2, ret.count)
+			continue
+		}
+		return dst[:ret.count]
+	}
+}
+
+// GetBufferMemoryRequirements2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetBufferMemoryRequirements2.html
+func (x DeviceFacade) GetBufferMemoryRequirements2(pInfo *BufferMemoryRequirementsInfo2, pMemoryRequirements *MemoryRequirements2) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **BufferMemoryRequirementsInfo2) **C.struct_VkBufferMemoryRequirementsInfo2 { /* Pointer */
+		g2c := (*C.struct_VkBufferMemoryRequirementsInfo2)(*x)
+		return &g2c
+	}(&pInfo)
+	p2 := func(x **MemoryRequirements2) **C.struct_VkMemoryRequirements2 { /* Pointer */
+		g2c := (*C.struct_VkMemoryRequirements2)(*x)
+		return &g2c
+	}(&pMemoryRequirements)
+	C.vkGetBufferMemoryRequirements2(addrs, *p0, *p1, *p2)
+}
+
+// GetDescriptorSetLayoutSupport command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetDescriptorSetLayoutSupport.html
+func (x DeviceFacade) GetDescriptorSetLayoutSupport(pCreateInfo *DescriptorSetLayoutCreateInfo, pSupport *DescriptorSetLayoutSupport) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **DescriptorSetLayoutCreateInfo) **C.struct_VkDescriptorSetLayoutCreateInfo { /* Pointer */
+		g2c := (*C.struct_VkDescriptorSetLayoutCreateInfo)(*x)
+		return &g2c
+	}(&pCreateInfo)
+	p2 := func(x **DescriptorSetLayoutSupport) **C.struct_VkDescriptorSetLayoutSupport { /* Pointer */
+		g2c := (*C.struct_VkDescriptorSetLayoutSupport)(*x)
+		return &g2c
+	}(&pSupport)
+	C.vkGetDescriptorSetLayoutSupport(addrs, *p0, *p1, *p2)
+}
+
+// GetImageMemoryRequirements2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetImageMemoryRequirements2.html
+func (x DeviceFacade) GetImageMemoryRequirements2(pInfo *ImageMemoryRequirementsInfo2, pMemoryRequirements *MemoryRequirements2) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **ImageMemoryRequirementsInfo2) **C.struct_VkImageMemoryRequirementsInfo2 { /* Pointer */
+		g2c := (*C.struct_VkImageMemoryRequirementsInfo2)(*x)
+		return &g2c
+	}(&pInfo)
+	p2 := func(x **MemoryRequirements2) **C.struct_VkMemoryRequirements2 { /* Pointer */
+		g2c := (*C.struct_VkMemoryRequirements2)(*x)
+		return &g2c
+	}(&pMemoryRequirements)
+	C.vkGetImageMemoryRequirements2(addrs, *p0, *p1, *p2)
+}
+
+// EnumeratePhysicalDeviceGroups command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkEnumeratePhysicalDeviceGroups.html
+func (x InstanceFacade) EnumeratePhysicalDeviceGroups(pPhysicalDeviceGroupCount *uint32, pPhysicalDeviceGroupProperties []PhysicalDeviceGroupProperties) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkInstance)(&x.H)
+	p1 := func(x **uint32) **C.uint32_t { /* Pointer */ g2c := (*C.uint32_t)(*x); return &g2c }(&pPhysicalDeviceGroupCount)
+	p2 := func(x *[]PhysicalDeviceGroupProperties) **C.struct_VkPhysicalDeviceGroupProperties { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkPhysicalDeviceGroupProperties)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkPhysicalDeviceGroupProperties)(unsafe.Pointer((&ptr)))
+	}(&pPhysicalDeviceGroupProperties)
+	ret := C.vkEnumeratePhysicalDeviceGroups(addrs, *p0, *p1, *p2)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// EnumeratePhysicalDeviceGroupsInto calls EnumeratePhysicalDeviceGroups with the count query, the fill and
+// the VK_INCOMPLETE retries in a single cgo call. The elements are stored in
+// dst, reallocated only when its capacity is too small, and returned.
+// The sType of every element is set; pNext is passed through.
+func (x InstanceFacade) EnumeratePhysicalDeviceGroupsInto(dst []PhysicalDeviceGroupProperties) ([]PhysicalDeviceGroupProperties, Result) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkInstance)(&x.H)
+	for {
+		dst = dst[:cap(dst)]
+		var items *C.struct_VkPhysicalDeviceGroupProperties
+		if len(dst) > 0 {
+			items = (*C.struct_VkPhysicalDeviceGroupProperties)(unsafe.Pointer(&dst[0]))
+		}
+		ret := C.vksEnumerate_vkEnumeratePhysicalDeviceGroups(addrs, C.uint64_t(uintptr(unsafe.Pointer(*p0))), C.uint32_t(len(dst)), items)
+		if Result(ret.result) == VK_INCOMPLETE && int(ret.count) > len(dst) {
+			dst = make([]PhysicalDeviceGroupProperties, ret.count)
+			continue
+		}
+		return dst[:ret.count], Result(ret.result)
+	}
+}
+
+// CmdDispatchBase command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdDispatchBase.html
+func (x CommandBufferFacade) CmdDispatchBase(baseGroupX uint32, baseGroupY uint32, baseGroupZ uint32, groupCountX uint32, groupCountY uint32, groupCountZ uint32) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&baseGroupX)
+	p2 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&baseGroupY)
+	p3 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&baseGroupZ)
+	p4 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&groupCountX)
+	p5 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&groupCountY)
+	p6 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&groupCountZ)
+	C.vkCmdDispatchBase(addrs, *p0, *p1, *p2, *p3, *p4, *p5, *p6)
+}
+
+// CmdSetDeviceMask command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdSetDeviceMask.html
+func (x CommandBufferFacade) CmdSetDeviceMask(deviceMask uint32) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&deviceMask)
+	C.vkCmdSetDeviceMask(addrs, *p0, *p1)
+}
+
+// GetDeviceGroupPeerMemoryFeatures command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetDeviceGroupPeerMemoryFeatures.html
+func (x DeviceFacade) GetDeviceGroupPeerMemoryFeatures(heapIndex uint32, localDeviceIndex uint32, remoteDeviceIndex uint32, pPeerMemoryFeatures *PeerMemoryFeatureFlags) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&heapIndex)
+	p2 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&localDeviceIndex)
+	p3 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&remoteDeviceIndex)
+	p4 := func(x **PeerMemoryFeatureFlags) **C.VkPeerMemoryFeatureFlags { /* Pointer */
+		g2c := (*C.VkPeerMemoryFeatureFlags)(*x)
+		return &g2c
+	}(&pPeerMemoryFeatures)
+	C.vkGetDeviceGroupPeerMemoryFeatures(addrs, *p0, *p1, *p2, *p3, *p4)
+}
+
+// BindImageMemory2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkBindImageMemory2.html
+func (x DeviceFacade) BindImageMemory2(bindInfoCount uint32, pBindInfos []BindImageMemoryInfo) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&bindInfoCount)
+	p2 := func(x *[]BindImageMemoryInfo) **C.struct_VkBindImageMemoryInfo { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkBindImageMemoryInfo)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkBindImageMemoryInfo)(unsafe.Pointer((&ptr)))
+	}(&pBindInfos)
+	ret := C.vkBindImageMemory2(addrs, *p0, *p1, *p2)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// BindBufferMemory2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkBindBufferMemory2.html
+func (x DeviceFacade) BindBufferMemory2(bindInfoCount uint32, pBindInfos []BindBufferMemoryInfo) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&bindInfoCount)
+	p2 := func(x *[]BindBufferMemoryInfo) **C.struct_VkBindBufferMemoryInfo { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkBindBufferMemoryInfo)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkBindBufferMemoryInfo)(unsafe.Pointer((&ptr)))
+	}(&pBindInfos)
+	ret := C.vkBindBufferMemory2(addrs, *p0, *p1, *p2)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// EnumerateInstanceVersion command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkEnumerateInstanceVersion.html
+func EnumerateInstanceVersion(pApiVersion *uint32) Result {
+	addrs := &C.vksProcAddresses
+	p0 := func(x **uint32) **C.uint32_t { /* Pointer */ g2c := (*C.uint32_t)(*x); return &g2c }(&pApiVersion)
+	ret := C.vkEnumerateInstanceVersion(addrs, *p0)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// EnumerateInstanceVersion calls EnumerateInstanceVersion of the loader.
+func (loader *Loader) EnumerateInstanceVersion(pApiVersion *uint32) Result {
+	addrs := &loader.ptr.procs
+	p0 := func(x **uint32) **C.uint32_t { /* Pointer */ g2c := (*C.uint32_t)(*x); return &g2c }(&pApiVersion)
+	ret := C.vkEnumerateInstanceVersion(addrs, *p0)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
@@ -0,0 +1,97 @@
+//go:build !vks_no_version_1_2 && !vks_no_version_1_1
+
+// Wrappers of VK_VERSION_1_2.
+#include "vk_wrapper.h"
+#include "vk_capture.h"
+
+void vkCmdBeginRenderPass2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkRenderPassBeginInfo* pRenderPassBegin, VkSubpassBeginInfo* pSubpassBeginInfo) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdBeginRenderPass2(addrs, commandBuffer, pRenderPassBegin, pSubpassBeginInfo);
+		return;
+	}
+	(((PFN_vkCmdBeginRenderPass2)addrs->pvkCmdBeginRenderPass2)(commandBuffer, pRenderPassBegin, pSubpassBeginInfo));
+}
+uint64_t vkGetBufferOpaqueCaptureAddress(vksProcAddr* addrs, VkDevice device, VkBufferDeviceAddressInfo* pInfo) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetBufferOpaqueCaptureAddress(addrs, device, pInfo);
+	}
+	uint64_t ret = (((PFN_vkGetBufferOpaqueCaptureAddress)addrs->pvkGetBufferOpaqueCaptureAddress)(device, pInfo));
+	return ret;
+}
+VkDeviceAddress vkGetBufferDeviceAddress(vksProcAddr* addrs, VkDevice device, VkBufferDeviceAddressInfo* pInfo) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetBufferDeviceAddress(addrs, device, pInfo);
+	}
+	VkDeviceAddress ret = (((PFN_vkGetBufferDeviceAddress)addrs->pvkGetBufferDeviceAddress)(device, pInfo));
+	return ret;
+}
+void vkCmdDrawIndirectCount(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdDrawIndirectCount(addrs, commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+		return;
+	}
+	(((PFN_vkCmdDrawIndirectCount)addrs->pvkCmdDrawIndirectCount)(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride));
+}
+void vkCmdDrawIndexedIndirectCount(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countBufferOffset, uint32_t maxDrawCount, uint32_t stride) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdDrawIndexedIndirectCount(addrs, commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride);
+		return;
+	}
+	(((PFN_vkCmdDrawIndexedIndirectCount)addrs->pvkCmdDrawIndexedIndirectCount)(commandBuffer, buffer, offset, countBuffer, countBufferOffset, maxDrawCount, stride));
+}
+VkResult vkCreateRenderPass2(vksProcAddr* addrs, VkDevice device, VkRenderPassCreateInfo2* pCreateInfo, VkAllocationCallbacks* pAllocator, VkRenderPass* pRenderPass) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkCreateRenderPass2(addrs, device, pCreateInfo, pAllocator, pRenderPass);
+	}
+	VkResult ret = (((PFN_vkCreateRenderPass2)addrs->pvkCreateRenderPass2)(device, pCreateInfo, pAllocator, pRenderPass));
+	return ret;
+}
+uint64_t vkGetDeviceMemoryOpaqueCaptureAddress(vksProcAddr* addrs, VkDevice device, VkDeviceMemoryOpaqueCaptureAddressInfo* pInfo) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetDeviceMemoryOpaqueCaptureAddress(addrs, device, pInfo);
+	}
+	uint64_t ret = (((PFN_vkGetDeviceMemoryOpaqueCaptureAddress)addrs->pvkGetDeviceMemoryOpaqueCaptureAddress)(device, pInfo));
+	return ret;
+}
+void vkCmdNextSubpass2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkSubpassBeginInfo* pSubpassBeginInfo, VkSubpassEndInfo* pSubpassEndInfo) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdNextSubpass2(addrs, commandBuffer, pSubpassBeginInfo, pSubpassEndInfo);
+		return;
+	}
+	(((PFN_vkCmdNextSubpass2)addrs->pvkCmdNextSubpass2)(commandBuffer, pSubpassBeginInfo, pSubpassEndInfo));
+}
+void vkCmdEndRenderPass2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkSubpassEndInfo* pSubpassEndInfo) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdEndRenderPass2(addrs, commandBuffer, pSubpassEndInfo);
+		return;
+	}
+	(((PFN_vkCmdEndRenderPass2)addrs->pvkCmdEndRenderPass2)(commandBuffer, pSubpassEndInfo));
+}
+VkResult vkSignalSemaphore(vksProcAddr* addrs, VkDevice device, VkSemaphoreSignalInfo* pSignalInfo) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkSignalSemaphore(addrs, device, pSignalInfo);
+	}
+	VkResult ret = (((PFN_vkSignalSemaphore)addrs->pvkSignalSemaphore)(device, pSignalInfo));
+	return ret;
+}
+VkResult vkWaitSemaphores(vksProcAddr* addrs, VkDevice device, VkSemaphoreWaitInfo* pWaitInfo, uint64_t timeout) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkWaitSemaphores(addrs, device, pWaitInfo, timeout);
+	}
+	VkResult ret = (((PFN_vkWaitSemaphores)addrs->pvkWaitSemaphores)(device, pWaitInfo, timeout));
+	return ret;
+}
+VkResult vkGetSemaphoreCounterValue(vksProcAddr* addrs, VkDevice device, VkSemaphore semaphore, uint64_t* pValue) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetSemaphoreCounterValue(addrs, device, semaphore, pValue);
+	}
+	VkResult ret = (((PFN_vkGetSemaphoreCounterValue)addrs->pvkGetSemaphoreCounterValue)(device, semaphore, pValue));
+	return ret;
+}
+void vkResetQueryPool(vksProcAddr* addrs, VkDevice device, VkQueryPool queryPool, uint32_t firstQuery, uint32_t queryCount) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkResetQueryPool(addrs, device, queryPool, firstQuery, queryCount);
+		return;
+	}
+	(((PFN_vkResetQueryPool)addrs->pvkResetQueryPool)(device, queryPool, firstQuery, queryCount));
+}
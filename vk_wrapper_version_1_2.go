@@ -0,0 +1,11378 @@
+//go:build !vks_no_version_1_2 && !vks_no_version_1_1
+
+package vks
+
+// Bindings of VK_VERSION_1_2, left out by the vks_no_version_1_2 build tag.
+
+//#cgo CFLAGS: -DVKS_ENABLE_VERSION_1_2
+//#include "vk_wrapper.h"
+import "C"
+import (
+	"fmt"
+	"unsafe"
+)
+
+// ResolveModeFlagBits enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkResolveModeFlagBits.html
+type ResolveModeFlagBits uint32
+
+const (
+	VK_RESOLVE_MODE_NONE            ResolveModeFlagBits = 0
+	VK_RESOLVE_MODE_SAMPLE_ZERO_BIT ResolveModeFlagBits = (1 << 0)
+	VK_RESOLVE_MODE_AVERAGE_BIT     ResolveModeFlagBits = (1 << 1)
+	VK_RESOLVE_MODE_MIN_BIT         ResolveModeFlagBits = (1 << 2)
+	VK_RESOLVE_MODE_MAX_BIT         ResolveModeFlagBits = (1 << 3)
+)
+
+const enumNamesResolveModeFlagBits = "VK_RESOLVE_MODE_NONE" +
+	"VK_RESOLVE_MODE_SAMPLE_ZERO_BIT" +
+	"VK_RESOLVE_MODE_AVERAGE_BIT" +
+	"VK_RESOLVE_MODE_MIN_BIT" +
+	"VK_RESOLVE_MODE_MAX_BIT"
+
+var enumTableResolveModeFlagBits = enumTable[ResolveModeFlagBits, uint16]{
+	first: VK_RESOLVE_MODE_NONE,
+	dense: 9,
+	names: enumNamesResolveModeFlagBits,
+	index: []uint16{0, 20, 51, 78, 78, 101, 101, 101, 101, 124},
+}
+
+func (x ResolveModeFlagBits) String() string {
+	if s, ok := enumTableResolveModeFlagBits.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("ResolveModeFlagBits=%d", x)
+}
+
+// SamplerReductionMode enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSamplerReductionMode.html
+type SamplerReductionMode uint32
+
+const (
+	VK_SAMPLER_REDUCTION_MODE_WEIGHTED_AVERAGE SamplerReductionMode = 0
+	VK_SAMPLER_REDUCTION_MODE_MIN              SamplerReductionMode = 1
+	VK_SAMPLER_REDUCTION_MODE_MAX              SamplerReductionMode = 2
+)
+
+const enumNamesSamplerReductionMode = "VK_SAMPLER_REDUCTION_MODE_WEIGHTED_AVERAGE" +
+	"VK_SAMPLER_REDUCTION_MODE_MIN" +
+	"VK_SAMPLER_REDUCTION_MODE_MAX"
+
+var enumTableSamplerReductionMode = enumTable[SamplerReductionMode, uint16]{
+	sparse: []SamplerReductionMode{
+		VK_SAMPLER_REDUCTION_MODE_WEIGHTED_AVERAGE,
+		VK_SAMPLER_REDUCTION_MODE_MIN,
+		VK_SAMPLER_REDUCTION_MODE_MAX,
+	},
+	names: enumNamesSamplerReductionMode,
+	index: []uint16{0, 42, 71, 100},
+}
+
+func (x SamplerReductionMode) String() string {
+	if s, ok := enumTableSamplerReductionMode.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("SamplerReductionMode=%d", x)
+}
+
+// DescriptorBindingFlagBits enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDescriptorBindingFlagBits.html
+type DescriptorBindingFlagBits uint32
+
+const (
+	VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT           DescriptorBindingFlagBits = (1 << 0)
+	VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT DescriptorBindingFlagBits = (1 << 1)
+	VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT             DescriptorBindingFlagBits = (1 << 2)
+	VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT   DescriptorBindingFlagBits = (1 << 3)
+)
+
+const enumNamesDescriptorBindingFlagBits = "VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT" +
+	"VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT" +
+	"VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT" +
+	"VK_DESCRIPTOR_BINDING_VARIABLE_DESCRIPTOR_COUNT_BIT"
+
+var enumTableDescriptorBindingFlagBits = enumTable[DescriptorBindingFlagBits, uint16]{
+	first: VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT,
+	dense: 8,
+	names: enumNamesDescriptorBindingFlagBits,
+	index: []uint16{0, 43, 96, 96, 137, 137, 137, 137, 188},
+}
+
+func (x DescriptorBindingFlagBits) String() string {
+	if s, ok := enumTableDescriptorBindingFlagBits.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("DescriptorBindingFlagBits=%d", x)
+}
+
+// ShaderFloatControlsIndependence enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkShaderFloatControlsIndependence.html
+type ShaderFloatControlsIndependence uint32
+
+const (
+	VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_32_BIT_ONLY ShaderFloatControlsIndependence = 0
+	VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_ALL         ShaderFloatControlsIndependence = 1
+	VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_NONE        ShaderFloatControlsIndependence = 2
+)
+
+const enumNamesShaderFloatControlsIndependence = "VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_32_BIT_ONLY" +
+	"VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_ALL" +
+	"VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_NONE"
+
+var enumTableShaderFloatControlsIndependence = enumTable[ShaderFloatControlsIndependence, uint16]{
+	sparse: []ShaderFloatControlsIndependence{
+		VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_32_BIT_ONLY,
+		VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_ALL,
+		VK_SHADER_FLOAT_CONTROLS_INDEPENDENCE_NONE,
+	},
+	names: enumNamesShaderFloatControlsIndependence,
+	index: []uint16{0, 49, 90, 132},
+}
+
+func (x ShaderFloatControlsIndependence) String() string {
+	if s, ok := enumTableShaderFloatControlsIndependence.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("ShaderFloatControlsIndependence=%d", x)
+}
+
+// DriverId enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDriverId.html
+type DriverId uint32
+
+const (
+	VK_DRIVER_ID_AMD_PROPRIETARY              DriverId = 1
+	VK_DRIVER_ID_AMD_OPEN_SOURCE              DriverId = 2
+	VK_DRIVER_ID_MESA_RADV                    DriverId = 3
+	VK_DRIVER_ID_NVIDIA_PROPRIETARY           DriverId = 4
+	VK_DRIVER_ID_INTEL_PROPRIETARY_WINDOWS    DriverId = 5
+	VK_DRIVER_ID_INTEL_OPEN_SOURCE_MESA       DriverId = 6
+	VK_DRIVER_ID_IMAGINATION_PROPRIETARY      DriverId = 7
+	VK_DRIVER_ID_QUALCOMM_PROPRIETARY         DriverId = 8
+	VK_DRIVER_ID_ARM_PROPRIETARY              DriverId = 9
+	VK_DRIVER_ID_GOOGLE_SWIFTSHADER           DriverId = 10
+	VK_DRIVER_ID_GGP_PROPRIETARY              DriverId = 11
+	VK_DRIVER_ID_BROADCOM_PROPRIETARY         DriverId = 12
+	VK_DRIVER_ID_MESA_LLVMPIPE                DriverId = 13
+	VK_DRIVER_ID_MOLTENVK                     DriverId = 14
+	VK_DRIVER_ID_COREAVI_PROPRIETARY          DriverId = 15
+	VK_DRIVER_ID_JUICE_PROPRIETARY            DriverId = 16
+	VK_DRIVER_ID_VERISILICON_PROPRIETARY      DriverId = 17
+	VK_DRIVER_ID_MESA_TURNIP                  DriverId = 18
+	VK_DRIVER_ID_MESA_V3DV                    DriverId = 19
+	VK_DRIVER_ID_MESA_PANVK                   DriverId = 20
+	VK_DRIVER_ID_SAMSUNG_PROPRIETARY          DriverId = 21
+	VK_DRIVER_ID_MESA_VENUS                   DriverId = 22
+	VK_DRIVER_ID_MESA_DOZEN                   DriverId = 23
+	VK_DRIVER_ID_MESA_NVK                     DriverId = 24
+	VK_DRIVER_ID_IMAGINATION_OPEN_SOURCE_MESA DriverId = 25
+	VK_DRIVER_ID_MESA_HONEYKRISP              DriverId = 26
+	VK_DRIVER_ID_RESERVED_27                  DriverId = 27
+)
+
+const enumNamesDriverId = "VK_DRIVER_ID_AMD_PROPRIETARY" +
+	"VK_DRIVER_ID_AMD_OPEN_SOURCE" +
+	"VK_DRIVER_ID_MESA_RADV" +
+	"VK_DRIVER_ID_NVIDIA_PROPRIETARY" +
+	"VK_DRIVER_ID_INTEL_PROPRIETARY_WINDOWS" +
+	"VK_DRIVER_ID_INTEL_OPEN_SOURCE_MESA" +
+	"VK_DRIVER_ID_IMAGINATION_PROPRIETARY" +
+	"VK_DRIVER_ID_QUALCOMM_PROPRIETARY" +
+	"VK_DRIVER_ID_ARM_PROPRIETARY" +
+	"VK_DRIVER_ID_GOOGLE_SWIFTSHADER" +
+	"VK_DRIVER_ID_GGP_PROPRIETARY" +
+	"VK_DRIVER_ID_BROADCOM_PROPRIETARY" +
+	"VK_DRIVER_ID_MESA_LLVMPIPE" +
+	"VK_DRIVER_ID_MOLTENVK" +
+	"VK_DRIVER_ID_COREAVI_PROPRIETARY" +
+	"VK_DRIVER_ID_JUICE_PROPRIETARY" +
+	"VK_DRIVER_ID_VERISILICON_PROPRIETARY" +
+	"VK_DRIVER_ID_MESA_TURNIP" +
+	"VK_DRIVER_ID_MESA_V3DV" +
+	"VK_DRIVER_ID_MESA_PANVK" +
+	"VK_DRIVER_ID_SAMSUNG_PROPRIETARY" +
+	"VK_DRIVER_ID_MESA_VENUS" +
+	"VK_DRIVER_ID_MESA_DOZEN" +
+	"VK_DRIVER_ID_MESA_NVK" +
+	"VK_DRIVER_ID_IMAGINATION_OPEN_SOURCE_MESA" +
+	"VK_DRIVER_ID_MESA_HONEYKRISP" +
+	"VK_DRIVER_ID_RESERVED_27"
+
+var enumTableDriverId = enumTable[DriverId, uint16]{
+	first: VK_DRIVER_ID_AMD_PROPRIETARY,
+	dense: 27,
+	names: enumNamesDriverId,
+	index: []uint16{0, 28, 56, 78, 109, 147, 182, 218, 251, 279, 310, 338, 371, 397, 418, 450, 480, 516, 540, 562, 585, 617, 640, 663, 684, 725, 753, 777},
+}
+
+func (x DriverId) String() string {
+	if s, ok := enumTableDriverId.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("DriverId=%d", x)
+}
+
+// SemaphoreType enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSemaphoreType.html
+type SemaphoreType uint32
+
+const (
+	VK_SEMAPHORE_TYPE_BINARY   SemaphoreType = 0
+	VK_SEMAPHORE_TYPE_TIMELINE SemaphoreType = 1
+)
+
+const enumNamesSemaphoreType = "VK_SEMAPHORE_TYPE_BINARY" +
+	"VK_SEMAPHORE_TYPE_TIMELINE"
+
+var enumTableSemaphoreType = enumTable[SemaphoreType, uint16]{
+	sparse: []SemaphoreType{
+		VK_SEMAPHORE_TYPE_BINARY,
+		VK_SEMAPHORE_TYPE_TIMELINE,
+	},
+	names: enumNamesSemaphoreType,
+	index: []uint16{0, 24, 50},
+}
+
+func (x SemaphoreType) String() string {
+	if s, ok := enumTableSemaphoreType.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("SemaphoreType=%d", x)
+}
+
+// SemaphoreWaitFlagBits enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSemaphoreWaitFlagBits.html
+type SemaphoreWaitFlagBits uint32
+
+const (
+	VK_SEMAPHORE_WAIT_ANY_BIT SemaphoreWaitFlagBits = (1 << 0)
+)
+
+const enumNamesSemaphoreWaitFlagBits = "VK_SEMAPHORE_WAIT_ANY_BIT"
+
+var enumTableSemaphoreWaitFlagBits = enumTable[SemaphoreWaitFlagBits, uint16]{
+	sparse: []SemaphoreWaitFlagBits{
+		VK_SEMAPHORE_WAIT_ANY_BIT,
+	},
+	names: enumNamesSemaphoreWaitFlagBits,
+	index: []uint16{0, 25},
+}
+
+func (x SemaphoreWaitFlagBits) String() string {
+	if s, ok := enumTableSemaphoreWaitFlagBits.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("SemaphoreWaitFlagBits=%d", x)
+}
+
+// SemaphoreWaitFlags bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSemaphoreWaitFlags.html
+type SemaphoreWaitFlags Flags
+
+// Bits appends the SemaphoreWaitFlagBits set in x to dst, lowest first.
+func (x SemaphoreWaitFlags) Bits(dst []SemaphoreWaitFlagBits) []SemaphoreWaitFlagBits {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x SemaphoreWaitFlags) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableSemaphoreWaitFlagBits)
+}
+
+func (x SemaphoreWaitFlags) String() string {
+	return flagsString(x, &enumTableSemaphoreWaitFlagBits)
+}
+
+// ParseSemaphoreWaitFlags parses the names of SemaphoreWaitFlagBits values, or numbers,
+// separated by |.
+func ParseSemaphoreWaitFlags(s string) (SemaphoreWaitFlags, error) {
+	x, err := parseFlags(s, &enumTableSemaphoreWaitFlagBits)
+	return SemaphoreWaitFlags(x), err
+}
+
+// ResolveModeFlags bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkResolveModeFlags.html
+type ResolveModeFlags Flags
+
+// Bits appends the ResolveModeFlagBits set in x to dst, lowest first.
+func (x ResolveModeFlags) Bits(dst []ResolveModeFlagBits) []ResolveModeFlagBits {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x ResolveModeFlags) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableResolveModeFlagBits)
+}
+
+func (x ResolveModeFlags) String() string {
+	return flagsString(x, &enumTableResolveModeFlagBits)
+}
+
+// ParseResolveModeFlags parses the names of ResolveModeFlagBits values, or numbers,
+// separated by |.
+func ParseResolveModeFlags(s string) (ResolveModeFlags, error) {
+	x, err := parseFlags(s, &enumTableResolveModeFlagBits)
+	return ResolveModeFlags(x), err
+}
+
+// DescriptorBindingFlags bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDescriptorBindingFlags.html
+type DescriptorBindingFlags Flags
+
+// Bits appends the DescriptorBindingFlagBits set in x to dst, lowest first.
+func (x DescriptorBindingFlags) Bits(dst []DescriptorBindingFlagBits) []DescriptorBindingFlagBits {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x DescriptorBindingFlags) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableDescriptorBindingFlagBits)
+}
+
+func (x DescriptorBindingFlags) String() string {
+	return flagsString(x, &enumTableDescriptorBindingFlagBits)
+}
+
+// ParseDescriptorBindingFlags parses the names of DescriptorBindingFlagBits values, or numbers,
+// separated by |.
+func ParseDescriptorBindingFlags(s string) (DescriptorBindingFlags, error) {
+	x, err := parseFlags(s, &enumTableDescriptorBindingFlagBits)
+	return DescriptorBindingFlags(x), err
+}
+
+// PhysicalDeviceSeparateDepthStencilLayoutsFeatures provides a go interface for VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures.html
+type PhysicalDeviceSeparateDepthStencilLayoutsFeatures C.struct_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures
+
+// SizeofPhysicalDeviceSeparateDepthStencilLayoutsFeatures is the memory size of a PhysicalDeviceSeparateDepthStencilLayoutsFeatures
+var SizeofPhysicalDeviceSeparateDepthStencilLayoutsFeatures int = int(unsafe.Sizeof(PhysicalDeviceSeparateDepthStencilLayoutsFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceSeparateDepthStencilLayoutsFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceSeparateDepthStencilLayoutsFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceSeparateDepthStencilLayoutsFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceSeparateDepthStencilLayoutsFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceSeparateDepthStencilLayoutsFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceSeparateDepthStencilLayoutsFeatures) AsCPtr() *PhysicalDeviceSeparateDepthStencilLayoutsFeatures {
+	clone := (*PhysicalDeviceSeparateDepthStencilLayoutsFeatures)(newCBlock(cULong(SizeofPhysicalDeviceSeparateDepthStencilLayoutsFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceSeparateDepthStencilLayoutsFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceSeparateDepthStencilLayoutsFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceSeparateDepthStencilLayoutsFeatures) []PhysicalDeviceSeparateDepthStencilLayoutsFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceSeparateDepthStencilLayoutsFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceSeparateDepthStencilLayoutsFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceSeparateDepthStencilLayoutsFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceSeparateDepthStencilLayoutsFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceSeparateDepthStencilLayoutsFeaturesFreeCSlice(x []PhysicalDeviceSeparateDepthStencilLayoutsFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceSeparateDepthStencilLayoutsFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceSeparateDepthStencilLayoutsFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceSeparateDepthStencilLayoutsFeaturesMakeCSlice(x ...PhysicalDeviceSeparateDepthStencilLayoutsFeatures) []PhysicalDeviceSeparateDepthStencilLayoutsFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceSeparateDepthStencilLayoutsFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceSeparateDepthStencilLayoutsFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures
+func (x PhysicalDeviceSeparateDepthStencilLayoutsFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceSeparateDepthStencilLayoutsFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceSeparateDepthStencilLayoutsFeatures) WithDefaultSType() PhysicalDeviceSeparateDepthStencilLayoutsFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SEPARATE_DEPTH_STENCIL_LAYOUTS_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceSeparateDepthStencilLayoutsFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SEPARATE_DEPTH_STENCIL_LAYOUTS_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceSeparateDepthStencilLayoutsFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSeparateDepthStencilLayoutsFeatures) WithSType(y StructureType) PhysicalDeviceSeparateDepthStencilLayoutsFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceSeparateDepthStencilLayoutsFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures
+func (x PhysicalDeviceSeparateDepthStencilLayoutsFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceSeparateDepthStencilLayoutsFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSeparateDepthStencilLayoutsFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceSeparateDepthStencilLayoutsFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceSeparateDepthStencilLayoutsFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceSeparateDepthStencilLayoutsFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SeparateDepthStencilLayouts returns the value of separateDepthStencilLayouts from VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures
+func (x PhysicalDeviceSeparateDepthStencilLayoutsFeatures) SeparateDepthStencilLayouts() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.separateDepthStencilLayouts)
+	return *ptr
+}
+
+// WithSeparateDepthStencilLayouts clones a new PhysicalDeviceSeparateDepthStencilLayoutsFeatures with the value of
+// SeparateDepthStencilLayouts updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSeparateDepthStencilLayoutsFeatures) WithSeparateDepthStencilLayouts(y Bool32) PhysicalDeviceSeparateDepthStencilLayoutsFeatures {
+	x.separateDepthStencilLayouts = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceSeparateDepthStencilLayoutsFeatures) SetSeparateDepthStencilLayouts(y Bool32) {
+	x.separateDepthStencilLayouts = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ConformanceVersion provides a go interface for VkConformanceVersion.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkConformanceVersion.html
+type ConformanceVersion C.struct_VkConformanceVersion
+
+// SizeofConformanceVersion is the memory size of a ConformanceVersion
+var SizeofConformanceVersion int = int(unsafe.Sizeof(ConformanceVersion{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ConformanceVersion) ArpPtr(arp *AutoReleasePool) *ConformanceVersion {
+	ptr := newCBlock(cULong(SizeofConformanceVersion))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ConformanceVersion)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ConformanceVersion) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ConformanceVersion) AsCPtr() *ConformanceVersion {
+	clone := (*ConformanceVersion)(newCBlock(cULong(SizeofConformanceVersion)))
+	*clone = x
+	return clone
+}
+
+// ConformanceVersionCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ConformanceVersionCSlice(arp *AutoReleasePool, x ...ConformanceVersion) []ConformanceVersion {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofConformanceVersion * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ConformanceVersion)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ConformanceVersionFreeCSlice releases the memory allocated by ConformanceVersionMakeCSlice.
+// It does not free pointers stored inside the slice.
+func ConformanceVersionFreeCSlice(x []ConformanceVersion) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ConformanceVersionMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ConformanceVersionFreeCSlice must be called on the returned slice.
+func ConformanceVersionMakeCSlice(x ...ConformanceVersion) []ConformanceVersion {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofConformanceVersion * len(x)
+	dst := unsafe.Slice((*ConformanceVersion)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// Major returns the value of major from VkConformanceVersion
+func (x ConformanceVersion) Major() byte {
+	ptr := func(x *C.uint8_t) *byte { /* Scalar */ c2g := byte(*x); return &c2g }(&x.major)
+	return *ptr
+}
+
+// WithMajor clones a new ConformanceVersion with the value of
+// Major updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ConformanceVersion) WithMajor(y byte) ConformanceVersion {
+	x.major = *(func(x *byte) *C.uint8_t { /* Scalar */ g2c := C.uint8_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *ConformanceVersion) SetMajor(y byte) {
+	x.major = *(func(x *byte) *C.uint8_t { /* Scalar */ g2c := C.uint8_t(*x); return &g2c }(&y))
+}
+
+// Minor returns the value of minor from VkConformanceVersion
+func (x ConformanceVersion) Minor() byte {
+	ptr := func(x *C.uint8_t) *byte { /* Scalar */ c2g := byte(*x); return &c2g }(&x.minor)
+	return *ptr
+}
+
+// WithMinor clones a new ConformanceVersion with the value of
+// Minor updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ConformanceVersion) WithMinor(y byte) ConformanceVersion {
+	x.minor = *(func(x *byte) *C.uint8_t { /* Scalar */ g2c := C.uint8_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *ConformanceVersion) SetMinor(y byte) {
+	x.minor = *(func(x *byte) *C.uint8_t { /* Scalar */ g2c := C.uint8_t(*x); return &g2c }(&y))
+}
+
+// Subminor returns the value of subminor from VkConformanceVersion
+func (x ConformanceVersion) Subminor() byte {
+	ptr := func(x *C.uint8_t) *byte { /* Scalar */ c2g := byte(*x); return &c2g }(&x.subminor)
+	return *ptr
+}
+
+// WithSubminor clones a new ConformanceVersion with the value of
+// Subminor updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ConformanceVersion) WithSubminor(y byte) ConformanceVersion {
+	x.subminor = *(func(x *byte) *C.uint8_t { /* Scalar */ g2c := C.uint8_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *ConformanceVersion) SetSubminor(y byte) {
+	x.subminor = *(func(x *byte) *C.uint8_t { /* Scalar */ g2c := C.uint8_t(*x); return &g2c }(&y))
+}
+
+// Patch returns the value of patch from VkConformanceVersion
+func (x ConformanceVersion) Patch() byte {
+	ptr := func(x *C.uint8_t) *byte { /* Scalar */ c2g := byte(*x); return &c2g }(&x.patch)
+	return *ptr
+}
+
+// WithPatch clones a new ConformanceVersion with the value of
+// Patch updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ConformanceVersion) WithPatch(y byte) ConformanceVersion {
+	x.patch = *(func(x *byte) *C.uint8_t { /* Scalar */ g2c := C.uint8_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *ConformanceVersion) SetPatch(y byte) {
+	x.patch = *(func(x *byte) *C.uint8_t { /* Scalar */ g2c := C.uint8_t(*x); return &g2c }(&y))
+}
+
+// PhysicalDeviceDriverProperties provides a go interface for VkPhysicalDeviceDriverProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceDriverProperties.html
+type PhysicalDeviceDriverProperties C.struct_VkPhysicalDeviceDriverProperties
+
+// SizeofPhysicalDeviceDriverProperties is the memory size of a PhysicalDeviceDriverProperties
+var SizeofPhysicalDeviceDriverProperties int = int(unsafe.Sizeof(PhysicalDeviceDriverProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceDriverProperties) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceDriverProperties {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceDriverProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceDriverProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceDriverProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceDriverProperties) AsCPtr() *PhysicalDeviceDriverProperties {
+	clone := (*PhysicalDeviceDriverProperties)(newCBlock(cULong(SizeofPhysicalDeviceDriverProperties)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceDriverPropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceDriverPropertiesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceDriverProperties) []PhysicalDeviceDriverProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceDriverProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceDriverProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceDriverPropertiesFreeCSlice releases the memory allocated by PhysicalDeviceDriverPropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceDriverPropertiesFreeCSlice(x []PhysicalDeviceDriverProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceDriverPropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceDriverPropertiesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceDriverPropertiesMakeCSlice(x ...PhysicalDeviceDriverProperties) []PhysicalDeviceDriverProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceDriverProperties * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceDriverProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceDriverProperties
+func (x *PhysicalDeviceDriverProperties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceDriverProperties with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceDriverProperties) WithDefaultSType() PhysicalDeviceDriverProperties {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceDriverProperties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTIES)
+}
+
+// WithSType clones a new PhysicalDeviceDriverProperties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDriverProperties) WithSType(y StructureType) PhysicalDeviceDriverProperties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceDriverProperties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceDriverProperties
+func (x *PhysicalDeviceDriverProperties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceDriverProperties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDriverProperties) WithPNext(y unsafe.Pointer) PhysicalDeviceDriverProperties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceDriverProperties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceDriverProperties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// DriverID returns the value of driverID from VkPhysicalDeviceDriverProperties
+func (x *PhysicalDeviceDriverProperties) DriverID() DriverId {
+	ptr := /* typedef */ (*DriverId)(&x.driverID)
+	return *ptr
+}
+
+// DriverName returns the value of driverName from VkPhysicalDeviceDriverProperties
+// The slice references the array in x; it is not a copy.
+func (x *PhysicalDeviceDriverProperties) DriverName() []byte {
+	ptr := func(x *[VK_MAX_DRIVER_NAME_SIZE]C.char) *[]byte { /* Array for byte */
+		slc := unsafe.Slice((*byte)(unsafe.Pointer(x)), VK_MAX_DRIVER_NAME_SIZE)
+		return &slc
+	}(&x.driverName)
+	return *ptr
+}
+
+// DriverInfo returns the value of driverInfo from VkPhysicalDeviceDriverProperties
+// The slice references the array in x; it is not a copy.
+func (x *PhysicalDeviceDriverProperties) DriverInfo() []byte {
+	ptr := func(x *[VK_MAX_DRIVER_INFO_SIZE]C.char) *[]byte { /* Array for byte */
+		slc := unsafe.Slice((*byte)(unsafe.Pointer(x)), VK_MAX_DRIVER_INFO_SIZE)
+		return &slc
+	}(&x.driverInfo)
+	return *ptr
+}
+
+// ConformanceVersion returns the value of conformanceVersion from VkPhysicalDeviceDriverProperties
+func (x *PhysicalDeviceDriverProperties) ConformanceVersion() ConformanceVersion {
+	ptr := /* typedef */ (*ConformanceVersion)(&x.conformanceVersion)
+	return *ptr
+}
+
+// SemaphoreSignalInfo provides a go interface for VkSemaphoreSignalInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSemaphoreSignalInfo.html
+type SemaphoreSignalInfo C.struct_VkSemaphoreSignalInfo
+
+// SizeofSemaphoreSignalInfo is the memory size of a SemaphoreSignalInfo
+var SizeofSemaphoreSignalInfo int = int(unsafe.Sizeof(SemaphoreSignalInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SemaphoreSignalInfo) ArpPtr(arp *AutoReleasePool) *SemaphoreSignalInfo {
+	ptr := newCBlock(cULong(SizeofSemaphoreSignalInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SemaphoreSignalInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SemaphoreSignalInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SemaphoreSignalInfo) AsCPtr() *SemaphoreSignalInfo {
+	clone := (*SemaphoreSignalInfo)(newCBlock(cULong(SizeofSemaphoreSignalInfo)))
+	*clone = x
+	return clone
+}
+
+// SemaphoreSignalInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SemaphoreSignalInfoCSlice(arp *AutoReleasePool, x ...SemaphoreSignalInfo) []SemaphoreSignalInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSemaphoreSignalInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SemaphoreSignalInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SemaphoreSignalInfoFreeCSlice releases the memory allocated by SemaphoreSignalInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func SemaphoreSignalInfoFreeCSlice(x []SemaphoreSignalInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SemaphoreSignalInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SemaphoreSignalInfoFreeCSlice must be called on the returned slice.
+func SemaphoreSignalInfoMakeCSlice(x ...SemaphoreSignalInfo) []SemaphoreSignalInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSemaphoreSignalInfo * len(x)
+	dst := unsafe.Slice((*SemaphoreSignalInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkSemaphoreSignalInfo
+func (x SemaphoreSignalInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new SemaphoreSignalInfo with the value of
+// SType to the value provided in the specification.
+func (x SemaphoreSignalInfo) WithDefaultSType() SemaphoreSignalInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *SemaphoreSignalInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_SEMAPHORE_SIGNAL_INFO)
+}
+
+// WithSType clones a new SemaphoreSignalInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SemaphoreSignalInfo) WithSType(y StructureType) SemaphoreSignalInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *SemaphoreSignalInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkSemaphoreSignalInfo
+func (x SemaphoreSignalInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new SemaphoreSignalInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SemaphoreSignalInfo) WithPNext(y unsafe.Pointer) SemaphoreSignalInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *SemaphoreSignalInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SemaphoreSignalInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Semaphore returns the value of semaphore from VkSemaphoreSignalInfo
+func (x SemaphoreSignalInfo) Semaphore() Semaphore {
+	ptr := /* handle */ (*Semaphore)(&x.semaphore)
+	return *ptr
+}
+
+// WithSemaphore clones a new SemaphoreSignalInfo with the value of
+// Semaphore updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SemaphoreSignalInfo) WithSemaphore(y Semaphore) SemaphoreSignalInfo {
+	x.semaphore = *( /* handle */ (*C.VkSemaphore)(&y))
+	return x
+}
+func (x *SemaphoreSignalInfo) SetSemaphore(y Semaphore) {
+	x.semaphore = *( /* handle */ (*C.VkSemaphore)(&y))
+}
+
+// Value returns the value of value from VkSemaphoreSignalInfo
+func (x SemaphoreSignalInfo) Value() uint64 {
+	ptr := func(x *C.uint64_t) *uint64 { /* Scalar */ c2g := uint64(*x); return &c2g }(&x.value)
+	return *ptr
+}
+
+// WithValue clones a new SemaphoreSignalInfo with the value of
+// Value updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SemaphoreSignalInfo) WithValue(y uint64) SemaphoreSignalInfo {
+	x.value = *(func(x *uint64) *C.uint64_t { /* Scalar */ g2c := C.uint64_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *SemaphoreSignalInfo) SetValue(y uint64) {
+	x.value = *(func(x *uint64) *C.uint64_t { /* Scalar */ g2c := C.uint64_t(*x); return &g2c }(&y))
+}
+
+// PhysicalDeviceBufferDeviceAddressFeatures provides a go interface for VkPhysicalDeviceBufferDeviceAddressFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceBufferDeviceAddressFeatures.html
+type PhysicalDeviceBufferDeviceAddressFeatures C.struct_VkPhysicalDeviceBufferDeviceAddressFeatures
+
+// SizeofPhysicalDeviceBufferDeviceAddressFeatures is the memory size of a PhysicalDeviceBufferDeviceAddressFeatures
+var SizeofPhysicalDeviceBufferDeviceAddressFeatures int = int(unsafe.Sizeof(PhysicalDeviceBufferDeviceAddressFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceBufferDeviceAddressFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceBufferDeviceAddressFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceBufferDeviceAddressFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceBufferDeviceAddressFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceBufferDeviceAddressFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceBufferDeviceAddressFeatures) AsCPtr() *PhysicalDeviceBufferDeviceAddressFeatures {
+	clone := (*PhysicalDeviceBufferDeviceAddressFeatures)(newCBlock(cULong(SizeofPhysicalDeviceBufferDeviceAddressFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceBufferDeviceAddressFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceBufferDeviceAddressFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceBufferDeviceAddressFeatures) []PhysicalDeviceBufferDeviceAddressFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceBufferDeviceAddressFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceBufferDeviceAddressFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceBufferDeviceAddressFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceBufferDeviceAddressFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceBufferDeviceAddressFeaturesFreeCSlice(x []PhysicalDeviceBufferDeviceAddressFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceBufferDeviceAddressFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceBufferDeviceAddressFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceBufferDeviceAddressFeaturesMakeCSlice(x ...PhysicalDeviceBufferDeviceAddressFeatures) []PhysicalDeviceBufferDeviceAddressFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceBufferDeviceAddressFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceBufferDeviceAddressFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceBufferDeviceAddressFeatures
+func (x PhysicalDeviceBufferDeviceAddressFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceBufferDeviceAddressFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceBufferDeviceAddressFeatures) WithDefaultSType() PhysicalDeviceBufferDeviceAddressFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceBufferDeviceAddressFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceBufferDeviceAddressFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceBufferDeviceAddressFeatures) WithSType(y StructureType) PhysicalDeviceBufferDeviceAddressFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceBufferDeviceAddressFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceBufferDeviceAddressFeatures
+func (x PhysicalDeviceBufferDeviceAddressFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceBufferDeviceAddressFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceBufferDeviceAddressFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceBufferDeviceAddressFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceBufferDeviceAddressFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceBufferDeviceAddressFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// BufferDeviceAddress returns the value of bufferDeviceAddress from VkPhysicalDeviceBufferDeviceAddressFeatures
+func (x PhysicalDeviceBufferDeviceAddressFeatures) BufferDeviceAddress() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.bufferDeviceAddress)
+	return *ptr
+}
+
+// WithBufferDeviceAddress clones a new PhysicalDeviceBufferDeviceAddressFeatures with the value of
+// BufferDeviceAddress updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceBufferDeviceAddressFeatures) WithBufferDeviceAddress(y Bool32) PhysicalDeviceBufferDeviceAddressFeatures {
+	x.bufferDeviceAddress = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceBufferDeviceAddressFeatures) SetBufferDeviceAddress(y Bool32) {
+	x.bufferDeviceAddress = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// BufferDeviceAddressCaptureReplay returns the value of bufferDeviceAddressCaptureReplay from VkPhysicalDeviceBufferDeviceAddressFeatures
+func (x PhysicalDeviceBufferDeviceAddressFeatures) BufferDeviceAddressCaptureReplay() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.bufferDeviceAddressCaptureReplay)
+	return *ptr
+}
+
+// WithBufferDeviceAddressCaptureReplay clones a new PhysicalDeviceBufferDeviceAddressFeatures with the value of
+// BufferDeviceAddressCaptureReplay updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceBufferDeviceAddressFeatures) WithBufferDeviceAddressCaptureReplay(y Bool32) PhysicalDeviceBufferDeviceAddressFeatures {
+	x.bufferDeviceAddressCaptureReplay = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceBufferDeviceAddressFeatures) SetBufferDeviceAddressCaptureReplay(y Bool32) {
+	x.bufferDeviceAddressCaptureReplay = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// BufferDeviceAddressMultiDevice returns the value of bufferDeviceAddressMultiDevice from VkPhysicalDeviceBufferDeviceAddressFeatures
+func (x PhysicalDeviceBufferDeviceAddressFeatures) BufferDeviceAddressMultiDevice() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.bufferDeviceAddressMultiDevice)
+	return *ptr
+}
+
+// WithBufferDeviceAddressMultiDevice clones a new PhysicalDeviceBufferDeviceAddressFeatures with the value of
+// BufferDeviceAddressMultiDevice updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceBufferDeviceAddressFeatures) WithBufferDeviceAddressMultiDevice(y Bool32) PhysicalDeviceBufferDeviceAddressFeatures {
+	x.bufferDeviceAddressMultiDevice = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceBufferDeviceAddressFeatures) SetBufferDeviceAddressMultiDevice(y Bool32) {
+	x.bufferDeviceAddressMultiDevice = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// TimelineSemaphoreSubmitInfo provides a go interface for VkTimelineSemaphoreSubmitInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkTimelineSemaphoreSubmitInfo.html
+type TimelineSemaphoreSubmitInfo C.struct_VkTimelineSemaphoreSubmitInfo
+
+// SizeofTimelineSemaphoreSubmitInfo is the memory size of a TimelineSemaphoreSubmitInfo
+var SizeofTimelineSemaphoreSubmitInfo int = int(unsafe.Sizeof(TimelineSemaphoreSubmitInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x TimelineSemaphoreSubmitInfo) ArpPtr(arp *AutoReleasePool) *TimelineSemaphoreSubmitInfo {
+	ptr := newCBlock(cULong(SizeofTimelineSemaphoreSubmitInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*TimelineSemaphoreSubmitInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *TimelineSemaphoreSubmitInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x TimelineSemaphoreSubmitInfo) AsCPtr() *TimelineSemaphoreSubmitInfo {
+	clone := (*TimelineSemaphoreSubmitInfo)(newCBlock(cULong(SizeofTimelineSemaphoreSubmitInfo)))
+	*clone = x
+	return clone
+}
+
+// TimelineSemaphoreSubmitInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func TimelineSemaphoreSubmitInfoCSlice(arp *AutoReleasePool, x ...TimelineSemaphoreSubmitInfo) []TimelineSemaphoreSubmitInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofTimelineSemaphoreSubmitInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*TimelineSemaphoreSubmitInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// TimelineSemaphoreSubmitInfoFreeCSlice releases the memory allocated by TimelineSemaphoreSubmitInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func TimelineSemaphoreSubmitInfoFreeCSlice(x []TimelineSemaphoreSubmitInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// TimelineSemaphoreSubmitInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. TimelineSemaphoreSubmitInfoFreeCSlice must be called on the returned slice.
+func TimelineSemaphoreSubmitInfoMakeCSlice(x ...TimelineSemaphoreSubmitInfo) []TimelineSemaphoreSubmitInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofTimelineSemaphoreSubmitInfo * len(x)
+	dst := unsafe.Slice((*TimelineSemaphoreSubmitInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkTimelineSemaphoreSubmitInfo
+func (x TimelineSemaphoreSubmitInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new TimelineSemaphoreSubmitInfo with the value of
+// SType to the value provided in the specification.
+func (x TimelineSemaphoreSubmitInfo) WithDefaultSType() TimelineSemaphoreSubmitInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *TimelineSemaphoreSubmitInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO)
+}
+
+// WithSType clones a new TimelineSemaphoreSubmitInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x TimelineSemaphoreSubmitInfo) WithSType(y StructureType) TimelineSemaphoreSubmitInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *TimelineSemaphoreSubmitInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkTimelineSemaphoreSubmitInfo
+func (x TimelineSemaphoreSubmitInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new TimelineSemaphoreSubmitInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x TimelineSemaphoreSubmitInfo) WithPNext(y unsafe.Pointer) TimelineSemaphoreSubmitInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *TimelineSemaphoreSubmitInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *TimelineSemaphoreSubmitInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// WaitSemaphoreValueCount returns the value of waitSemaphoreValueCount from VkTimelineSemaphoreSubmitInfo
+func (x TimelineSemaphoreSubmitInfo) WaitSemaphoreValueCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.waitSemaphoreValueCount)
+	return *ptr
+}
+
+// WithWaitSemaphoreValueCount clones a new TimelineSemaphoreSubmitInfo with the value of
+// WaitSemaphoreValueCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x TimelineSemaphoreSubmitInfo) WithWaitSemaphoreValueCount(y uint32) TimelineSemaphoreSubmitInfo {
+	x.waitSemaphoreValueCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *TimelineSemaphoreSubmitInfo) SetWaitSemaphoreValueCount(y uint32) {
+	x.waitSemaphoreValueCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PWaitSemaphoreValues returns the value of pWaitSemaphoreValues from VkTimelineSemaphoreSubmitInfo
+func (x TimelineSemaphoreSubmitInfo) PWaitSemaphoreValues() []uint64 {
+	if x.pWaitSemaphoreValues == nil {
+		return nil
+	}
+	return unsafe.Slice((*uint64)(unsafe.Pointer(x.pWaitSemaphoreValues)), x.waitSemaphoreValueCount)
+}
+
+// WithPWaitSemaphoreValues clones a new TimelineSemaphoreSubmitInfo with the value of
+// PWaitSemaphoreValues updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines WaitSemaphoreValueCount as the length of this field.
+// WaitSemaphoreValueCount is updated with the length of the new value.
+func (x TimelineSemaphoreSubmitInfo) WithPWaitSemaphoreValues(y []uint64) TimelineSemaphoreSubmitInfo {
+	x.pWaitSemaphoreValues = *(func(x *[]uint64) **C.uint64_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint64_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint64_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithWaitSemaphoreValueCount(uint32(len(y)))
+}
+func (x *TimelineSemaphoreSubmitInfo) SetPWaitSemaphoreValues(y []uint64) {
+	x.pWaitSemaphoreValues = *(func(x *[]uint64) **C.uint64_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint64_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint64_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetWaitSemaphoreValueCount(uint32(len(y)))
+}
+
+// PinPWaitSemaphoreValues pins the Go memory referenced by y with the AutoReleasePool
+// and sets PWaitSemaphoreValues, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *TimelineSemaphoreSubmitInfo) PinPWaitSemaphoreValues(arp *AutoReleasePool, y []uint64) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPWaitSemaphoreValues(y)
+}
+
+// SignalSemaphoreValueCount returns the value of signalSemaphoreValueCount from VkTimelineSemaphoreSubmitInfo
+func (x TimelineSemaphoreSubmitInfo) SignalSemaphoreValueCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.signalSemaphoreValueCount)
+	return *ptr
+}
+
+// WithSignalSemaphoreValueCount clones a new TimelineSemaphoreSubmitInfo with the value of
+// SignalSemaphoreValueCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x TimelineSemaphoreSubmitInfo) WithSignalSemaphoreValueCount(y uint32) TimelineSemaphoreSubmitInfo {
+	x.signalSemaphoreValueCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *TimelineSemaphoreSubmitInfo) SetSignalSemaphoreValueCount(y uint32) {
+	x.signalSemaphoreValueCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PSignalSemaphoreValues returns the value of pSignalSemaphoreValues from VkTimelineSemaphoreSubmitInfo
+func (x TimelineSemaphoreSubmitInfo) PSignalSemaphoreValues() []uint64 {
+	if x.pSignalSemaphoreValues == nil {
+		return nil
+	}
+	return unsafe.Slice((*uint64)(unsafe.Pointer(x.pSignalSemaphoreValues)), x.signalSemaphoreValueCount)
+}
+
+// WithPSignalSemaphoreValues clones a new TimelineSemaphoreSubmitInfo with the value of
+// PSignalSemaphoreValues updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines SignalSemaphoreValueCount as the length of this field.
+// SignalSemaphoreValueCount is updated with the length of the new value.
+func (x TimelineSemaphoreSubmitInfo) WithPSignalSemaphoreValues(y []uint64) TimelineSemaphoreSubmitInfo {
+	x.pSignalSemaphoreValues = *(func(x *[]uint64) **C.uint64_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint64_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint64_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithSignalSemaphoreValueCount(uint32(len(y)))
+}
+func (x *TimelineSemaphoreSubmitInfo) SetPSignalSemaphoreValues(y []uint64) {
+	x.pSignalSemaphoreValues = *(func(x *[]uint64) **C.uint64_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint64_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint64_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetSignalSemaphoreValueCount(uint32(len(y)))
+}
+
+// PinPSignalSemaphoreValues pins the Go memory referenced by y with the AutoReleasePool
+// and sets PSignalSemaphoreValues, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *TimelineSemaphoreSubmitInfo) PinPSignalSemaphoreValues(arp *AutoReleasePool, y []uint64) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPSignalSemaphoreValues(y)
+}
+
+// SemaphoreTypeCreateInfo provides a go interface for VkSemaphoreTypeCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSemaphoreTypeCreateInfo.html
+type SemaphoreTypeCreateInfo C.struct_VkSemaphoreTypeCreateInfo
+
+// SizeofSemaphoreTypeCreateInfo is the memory size of a SemaphoreTypeCreateInfo
+var SizeofSemaphoreTypeCreateInfo int = int(unsafe.Sizeof(SemaphoreTypeCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SemaphoreTypeCreateInfo) ArpPtr(arp *AutoReleasePool) *SemaphoreTypeCreateInfo {
+	ptr := newCBlock(cULong(SizeofSemaphoreTypeCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SemaphoreTypeCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SemaphoreTypeCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SemaphoreTypeCreateInfo) AsCPtr() *SemaphoreTypeCreateInfo {
+	clone := (*SemaphoreTypeCreateInfo)(newCBlock(cULong(SizeofSemaphoreTypeCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// SemaphoreTypeCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SemaphoreTypeCreateInfoCSlice(arp *AutoReleasePool, x ...SemaphoreTypeCreateInfo) []SemaphoreTypeCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSemaphoreTypeCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SemaphoreTypeCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SemaphoreTypeCreateInfoFreeCSlice releases the memory allocated by SemaphoreTypeCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func SemaphoreTypeCreateInfoFreeCSlice(x []SemaphoreTypeCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SemaphoreTypeCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SemaphoreTypeCreateInfoFreeCSlice must be called on the returned slice.
+func SemaphoreTypeCreateInfoMakeCSlice(x ...SemaphoreTypeCreateInfo) []SemaphoreTypeCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSemaphoreTypeCreateInfo * len(x)
+	dst := unsafe.Slice((*SemaphoreTypeCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkSemaphoreTypeCreateInfo
+func (x SemaphoreTypeCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new SemaphoreTypeCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x SemaphoreTypeCreateInfo) WithDefaultSType() SemaphoreTypeCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *SemaphoreTypeCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO)
+}
+
+// WithSType clones a new SemaphoreTypeCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SemaphoreTypeCreateInfo) WithSType(y StructureType) SemaphoreTypeCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *SemaphoreTypeCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkSemaphoreTypeCreateInfo
+func (x SemaphoreTypeCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new SemaphoreTypeCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SemaphoreTypeCreateInfo) WithPNext(y unsafe.Pointer) SemaphoreTypeCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *SemaphoreTypeCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SemaphoreTypeCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SemaphoreType returns the value of semaphoreType from VkSemaphoreTypeCreateInfo
+func (x SemaphoreTypeCreateInfo) SemaphoreType() SemaphoreType {
+	ptr := /* typedef */ (*SemaphoreType)(&x.semaphoreType)
+	return *ptr
+}
+
+// WithSemaphoreType clones a new SemaphoreTypeCreateInfo with the value of
+// SemaphoreType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SemaphoreTypeCreateInfo) WithSemaphoreType(y SemaphoreType) SemaphoreTypeCreateInfo {
+	x.semaphoreType = *( /* typedef */ (*C.VkSemaphoreType)(&y))
+	return x
+}
+func (x *SemaphoreTypeCreateInfo) SetSemaphoreType(y SemaphoreType) {
+	x.semaphoreType = *( /* typedef */ (*C.VkSemaphoreType)(&y))
+}
+
+// InitialValue returns the value of initialValue from VkSemaphoreTypeCreateInfo
+func (x SemaphoreTypeCreateInfo) InitialValue() uint64 {
+	ptr := func(x *C.uint64_t) *uint64 { /* Scalar */ c2g := uint64(*x); return &c2g }(&x.initialValue)
+	return *ptr
+}
+
+// WithInitialValue clones a new SemaphoreTypeCreateInfo with the value of
+// InitialValue updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SemaphoreTypeCreateInfo) WithInitialValue(y uint64) SemaphoreTypeCreateInfo {
+	x.initialValue = *(func(x *uint64) *C.uint64_t { /* Scalar */ g2c := C.uint64_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *SemaphoreTypeCreateInfo) SetInitialValue(y uint64) {
+	x.initialValue = *(func(x *uint64) *C.uint64_t { /* Scalar */ g2c := C.uint64_t(*x); return &g2c }(&y))
+}
+
+// PhysicalDeviceTimelineSemaphoreProperties provides a go interface for VkPhysicalDeviceTimelineSemaphoreProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceTimelineSemaphoreProperties.html
+type PhysicalDeviceTimelineSemaphoreProperties C.struct_VkPhysicalDeviceTimelineSemaphoreProperties
+
+// SizeofPhysicalDeviceTimelineSemaphoreProperties is the memory size of a PhysicalDeviceTimelineSemaphoreProperties
+var SizeofPhysicalDeviceTimelineSemaphoreProperties int = int(unsafe.Sizeof(PhysicalDeviceTimelineSemaphoreProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceTimelineSemaphoreProperties) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceTimelineSemaphoreProperties {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceTimelineSemaphoreProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceTimelineSemaphoreProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceTimelineSemaphoreProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceTimelineSemaphoreProperties) AsCPtr() *PhysicalDeviceTimelineSemaphoreProperties {
+	clone := (*PhysicalDeviceTimelineSemaphoreProperties)(newCBlock(cULong(SizeofPhysicalDeviceTimelineSemaphoreProperties)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceTimelineSemaphorePropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceTimelineSemaphorePropertiesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceTimelineSemaphoreProperties) []PhysicalDeviceTimelineSemaphoreProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceTimelineSemaphoreProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceTimelineSemaphoreProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceTimelineSemaphorePropertiesFreeCSlice releases the memory allocated by PhysicalDeviceTimelineSemaphorePropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceTimelineSemaphorePropertiesFreeCSlice(x []PhysicalDeviceTimelineSemaphoreProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceTimelineSemaphorePropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceTimelineSemaphorePropertiesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceTimelineSemaphorePropertiesMakeCSlice(x ...PhysicalDeviceTimelineSemaphoreProperties) []PhysicalDeviceTimelineSemaphoreProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceTimelineSemaphoreProperties * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceTimelineSemaphoreProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceTimelineSemaphoreProperties
+func (x PhysicalDeviceTimelineSemaphoreProperties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceTimelineSemaphoreProperties with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceTimelineSemaphoreProperties) WithDefaultSType() PhysicalDeviceTimelineSemaphoreProperties {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceTimelineSemaphoreProperties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES)
+}
+
+// WithSType clones a new PhysicalDeviceTimelineSemaphoreProperties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceTimelineSemaphoreProperties) WithSType(y StructureType) PhysicalDeviceTimelineSemaphoreProperties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceTimelineSemaphoreProperties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceTimelineSemaphoreProperties
+func (x PhysicalDeviceTimelineSemaphoreProperties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceTimelineSemaphoreProperties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceTimelineSemaphoreProperties) WithPNext(y unsafe.Pointer) PhysicalDeviceTimelineSemaphoreProperties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceTimelineSemaphoreProperties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceTimelineSemaphoreProperties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// MaxTimelineSemaphoreValueDifference returns the value of maxTimelineSemaphoreValueDifference from VkPhysicalDeviceTimelineSemaphoreProperties
+func (x PhysicalDeviceTimelineSemaphoreProperties) MaxTimelineSemaphoreValueDifference() uint64 {
+	ptr := func(x *C.uint64_t) *uint64 { /* Scalar */ c2g := uint64(*x); return &c2g }(&x.maxTimelineSemaphoreValueDifference)
+	return *ptr
+}
+
+// SubpassDependency2 provides a go interface for VkSubpassDependency2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSubpassDependency2.html
+type SubpassDependency2 C.struct_VkSubpassDependency2
+
+// SizeofSubpassDependency2 is the memory size of a SubpassDependency2
+var SizeofSubpassDependency2 int = int(unsafe.Sizeof(SubpassDependency2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SubpassDependency2) ArpPtr(arp *AutoReleasePool) *SubpassDependency2 {
+	ptr := newCBlock(cULong(SizeofSubpassDependency2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SubpassDependency2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SubpassDependency2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SubpassDependency2) AsCPtr() *SubpassDependency2 {
+	clone := (*SubpassDependency2)(newCBlock(cULong(SizeofSubpassDependency2)))
+	*clone = x
+	return clone
+}
+
+// SubpassDependency2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SubpassDependency2CSlice(arp *AutoReleasePool, x ...SubpassDependency2) []SubpassDependency2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSubpassDependency2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SubpassDependency2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SubpassDependency2FreeCSlice releases the memory allocated by SubpassDependency2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func SubpassDependency2FreeCSlice(x []SubpassDependency2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SubpassDependency2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SubpassDependency2FreeCSlice must be called on the returned slice.
+func SubpassDependency2MakeCSlice(x ...SubpassDependency2) []SubpassDependency2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSubpassDependency2 * len(x)
+	dst := unsafe.Slice((*SubpassDependency2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkSubpassDependency2
+func (x SubpassDependency2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new SubpassDependency2 with the value of
+// SType to the value provided in the specification.
+func (x SubpassDependency2) WithDefaultSType() SubpassDependency2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_SUBPASS_DEPENDENCY_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *SubpassDependency2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_SUBPASS_DEPENDENCY_2)
+}
+
+// WithSType clones a new SubpassDependency2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDependency2) WithSType(y StructureType) SubpassDependency2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *SubpassDependency2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkSubpassDependency2
+func (x SubpassDependency2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new SubpassDependency2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDependency2) WithPNext(y unsafe.Pointer) SubpassDependency2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *SubpassDependency2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SubpassDependency2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SrcSubpass returns the value of srcSubpass from VkSubpassDependency2
+func (x SubpassDependency2) SrcSubpass() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.srcSubpass)
+	return *ptr
+}
+
+// WithSrcSubpass clones a new SubpassDependency2 with the value of
+// SrcSubpass updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDependency2) WithSrcSubpass(y uint32) SubpassDependency2 {
+	x.srcSubpass = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *SubpassDependency2) SetSrcSubpass(y uint32) {
+	x.srcSubpass = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// DstSubpass returns the value of dstSubpass from VkSubpassDependency2
+func (x SubpassDependency2) DstSubpass() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.dstSubpass)
+	return *ptr
+}
+
+// WithDstSubpass clones a new SubpassDependency2 with the value of
+// DstSubpass updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDependency2) WithDstSubpass(y uint32) SubpassDependency2 {
+	x.dstSubpass = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *SubpassDependency2) SetDstSubpass(y uint32) {
+	x.dstSubpass = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// SrcStageMask returns the value of srcStageMask from VkSubpassDependency2
+func (x SubpassDependency2) SrcStageMask() PipelineStageFlags {
+	ptr := /* typedef */ (*PipelineStageFlags)(&x.srcStageMask)
+	return *ptr
+}
+
+// WithSrcStageMask clones a new SubpassDependency2 with the value of
+// SrcStageMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDependency2) WithSrcStageMask(y PipelineStageFlags) SubpassDependency2 {
+	x.srcStageMask = *( /* typedef */ (*C.VkPipelineStageFlags)(&y))
+	return x
+}
+func (x *SubpassDependency2) SetSrcStageMask(y PipelineStageFlags) {
+	x.srcStageMask = *( /* typedef */ (*C.VkPipelineStageFlags)(&y))
+}
+
+// DstStageMask returns the value of dstStageMask from VkSubpassDependency2
+func (x SubpassDependency2) DstStageMask() PipelineStageFlags {
+	ptr := /* typedef */ (*PipelineStageFlags)(&x.dstStageMask)
+	return *ptr
+}
+
+// WithDstStageMask clones a new SubpassDependency2 with the value of
+// DstStageMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDependency2) WithDstStageMask(y PipelineStageFlags) SubpassDependency2 {
+	x.dstStageMask = *( /* typedef */ (*C.VkPipelineStageFlags)(&y))
+	return x
+}
+func (x *SubpassDependency2) SetDstStageMask(y PipelineStageFlags) {
+	x.dstStageMask = *( /* typedef */ (*C.VkPipelineStageFlags)(&y))
+}
+
+// SrcAccessMask returns the value of srcAccessMask from VkSubpassDependency2
+func (x SubpassDependency2) SrcAccessMask() AccessFlags {
+	ptr := /* typedef */ (*AccessFlags)(&x.srcAccessMask)
+	return *ptr
+}
+
+// WithSrcAccessMask clones a new SubpassDependency2 with the value of
+// SrcAccessMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDependency2) WithSrcAccessMask(y AccessFlags) SubpassDependency2 {
+	x.srcAccessMask = *( /* typedef */ (*C.VkAccessFlags)(&y))
+	return x
+}
+func (x *SubpassDependency2) SetSrcAccessMask(y AccessFlags) {
+	x.srcAccessMask = *( /* typedef */ (*C.VkAccessFlags)(&y))
+}
+
+// DstAccessMask returns the value of dstAccessMask from VkSubpassDependency2
+func (x SubpassDependency2) DstAccessMask() AccessFlags {
+	ptr := /* typedef */ (*AccessFlags)(&x.dstAccessMask)
+	return *ptr
+}
+
+// WithDstAccessMask clones a new SubpassDependency2 with the value of
+// DstAccessMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDependency2) WithDstAccessMask(y AccessFlags) SubpassDependency2 {
+	x.dstAccessMask = *( /* typedef */ (*C.VkAccessFlags)(&y))
+	return x
+}
+func (x *SubpassDependency2) SetDstAccessMask(y AccessFlags) {
+	x.dstAccessMask = *( /* typedef */ (*C.VkAccessFlags)(&y))
+}
+
+// DependencyFlags returns the value of dependencyFlags from VkSubpassDependency2
+func (x SubpassDependency2) DependencyFlags() DependencyFlags {
+	ptr := /* typedef */ (*DependencyFlags)(&x.dependencyFlags)
+	return *ptr
+}
+
+// WithDependencyFlags clones a new SubpassDependency2 with the value of
+// DependencyFlags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDependency2) WithDependencyFlags(y DependencyFlags) SubpassDependency2 {
+	x.dependencyFlags = *( /* typedef */ (*C.VkDependencyFlags)(&y))
+	return x
+}
+func (x *SubpassDependency2) SetDependencyFlags(y DependencyFlags) {
+	x.dependencyFlags = *( /* typedef */ (*C.VkDependencyFlags)(&y))
+}
+
+// ViewOffset returns the value of viewOffset from VkSubpassDependency2
+func (x SubpassDependency2) ViewOffset() int32 {
+	ptr := func(x *C.int32_t) *int32 { /* Scalar */ c2g := int32(*x); return &c2g }(&x.viewOffset)
+	return *ptr
+}
+
+// WithViewOffset clones a new SubpassDependency2 with the value of
+// ViewOffset updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDependency2) WithViewOffset(y int32) SubpassDependency2 {
+	x.viewOffset = *(func(x *int32) *C.int32_t { /* Scalar */ g2c := C.int32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *SubpassDependency2) SetViewOffset(y int32) {
+	x.viewOffset = *(func(x *int32) *C.int32_t { /* Scalar */ g2c := C.int32_t(*x); return &g2c }(&y))
+}
+
+// AttachmentReference2 provides a go interface for VkAttachmentReference2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkAttachmentReference2.html
+type AttachmentReference2 C.struct_VkAttachmentReference2
+
+// SizeofAttachmentReference2 is the memory size of a AttachmentReference2
+var SizeofAttachmentReference2 int = int(unsafe.Sizeof(AttachmentReference2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x AttachmentReference2) ArpPtr(arp *AutoReleasePool) *AttachmentReference2 {
+	ptr := newCBlock(cULong(SizeofAttachmentReference2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*AttachmentReference2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *AttachmentReference2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x AttachmentReference2) AsCPtr() *AttachmentReference2 {
+	clone := (*AttachmentReference2)(newCBlock(cULong(SizeofAttachmentReference2)))
+	*clone = x
+	return clone
+}
+
+// AttachmentReference2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func AttachmentReference2CSlice(arp *AutoReleasePool, x ...AttachmentReference2) []AttachmentReference2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofAttachmentReference2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*AttachmentReference2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// AttachmentReference2FreeCSlice releases the memory allocated by AttachmentReference2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func AttachmentReference2FreeCSlice(x []AttachmentReference2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// AttachmentReference2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. AttachmentReference2FreeCSlice must be called on the returned slice.
+func AttachmentReference2MakeCSlice(x ...AttachmentReference2) []AttachmentReference2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofAttachmentReference2 * len(x)
+	dst := unsafe.Slice((*AttachmentReference2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkAttachmentReference2
+func (x AttachmentReference2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new AttachmentReference2 with the value of
+// SType to the value provided in the specification.
+func (x AttachmentReference2) WithDefaultSType() AttachmentReference2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *AttachmentReference2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_2)
+}
+
+// WithSType clones a new AttachmentReference2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentReference2) WithSType(y StructureType) AttachmentReference2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *AttachmentReference2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkAttachmentReference2
+func (x AttachmentReference2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new AttachmentReference2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentReference2) WithPNext(y unsafe.Pointer) AttachmentReference2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *AttachmentReference2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *AttachmentReference2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Attachment returns the value of attachment from VkAttachmentReference2
+func (x AttachmentReference2) Attachment() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.attachment)
+	return *ptr
+}
+
+// WithAttachment clones a new AttachmentReference2 with the value of
+// Attachment updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentReference2) WithAttachment(y uint32) AttachmentReference2 {
+	x.attachment = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *AttachmentReference2) SetAttachment(y uint32) {
+	x.attachment = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// Layout returns the value of layout from VkAttachmentReference2
+func (x AttachmentReference2) Layout() ImageLayout {
+	ptr := /* typedef */ (*ImageLayout)(&x.layout)
+	return *ptr
+}
+
+// WithLayout clones a new AttachmentReference2 with the value of
+// Layout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentReference2) WithLayout(y ImageLayout) AttachmentReference2 {
+	x.layout = *( /* typedef */ (*C.VkImageLayout)(&y))
+	return x
+}
+func (x *AttachmentReference2) SetLayout(y ImageLayout) {
+	x.layout = *( /* typedef */ (*C.VkImageLayout)(&y))
+}
+
+// AspectMask returns the value of aspectMask from VkAttachmentReference2
+func (x AttachmentReference2) AspectMask() ImageAspectFlags {
+	ptr := /* typedef */ (*ImageAspectFlags)(&x.aspectMask)
+	return *ptr
+}
+
+// WithAspectMask clones a new AttachmentReference2 with the value of
+// AspectMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentReference2) WithAspectMask(y ImageAspectFlags) AttachmentReference2 {
+	x.aspectMask = *( /* typedef */ (*C.VkImageAspectFlags)(&y))
+	return x
+}
+func (x *AttachmentReference2) SetAspectMask(y ImageAspectFlags) {
+	x.aspectMask = *( /* typedef */ (*C.VkImageAspectFlags)(&y))
+}
+
+// SubpassDescription2 provides a go interface for VkSubpassDescription2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSubpassDescription2.html
+type SubpassDescription2 C.struct_VkSubpassDescription2
+
+// SizeofSubpassDescription2 is the memory size of a SubpassDescription2
+var SizeofSubpassDescription2 int = int(unsafe.Sizeof(SubpassDescription2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SubpassDescription2) ArpPtr(arp *AutoReleasePool) *SubpassDescription2 {
+	ptr := newCBlock(cULong(SizeofSubpassDescription2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SubpassDescription2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SubpassDescription2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SubpassDescription2) AsCPtr() *SubpassDescription2 {
+	clone := (*SubpassDescription2)(newCBlock(cULong(SizeofSubpassDescription2)))
+	*clone = x
+	return clone
+}
+
+// SubpassDescription2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SubpassDescription2CSlice(arp *AutoReleasePool, x ...SubpassDescription2) []SubpassDescription2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSubpassDescription2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SubpassDescription2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SubpassDescription2FreeCSlice releases the memory allocated by SubpassDescription2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func SubpassDescription2FreeCSlice(x []SubpassDescription2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SubpassDescription2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SubpassDescription2FreeCSlice must be called on the returned slice.
+func SubpassDescription2MakeCSlice(x ...SubpassDescription2) []SubpassDescription2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSubpassDescription2 * len(x)
+	dst := unsafe.Slice((*SubpassDescription2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkSubpassDescription2
+func (x *SubpassDescription2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new SubpassDescription2 with the value of
+// SType to the value provided in the specification.
+func (x SubpassDescription2) WithDefaultSType() SubpassDescription2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *SubpassDescription2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_2)
+}
+
+// WithSType clones a new SubpassDescription2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDescription2) WithSType(y StructureType) SubpassDescription2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *SubpassDescription2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkSubpassDescription2
+func (x *SubpassDescription2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new SubpassDescription2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDescription2) WithPNext(y unsafe.Pointer) SubpassDescription2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *SubpassDescription2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SubpassDescription2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Flags returns the value of flags from VkSubpassDescription2
+func (x *SubpassDescription2) Flags() SubpassDescriptionFlags {
+	ptr := /* typedef */ (*SubpassDescriptionFlags)(&x.flags)
+	return *ptr
+}
+
+// WithFlags clones a new SubpassDescription2 with the value of
+// Flags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDescription2) WithFlags(y SubpassDescriptionFlags) SubpassDescription2 {
+	x.flags = *( /* typedef */ (*C.VkSubpassDescriptionFlags)(&y))
+	return x
+}
+func (x *SubpassDescription2) SetFlags(y SubpassDescriptionFlags) {
+	x.flags = *( /* typedef */ (*C.VkSubpassDescriptionFlags)(&y))
+}
+
+// PipelineBindPoint returns the value of pipelineBindPoint from VkSubpassDescription2
+func (x *SubpassDescription2) PipelineBindPoint() PipelineBindPoint {
+	ptr := /* typedef */ (*PipelineBindPoint)(&x.pipelineBindPoint)
+	return *ptr
+}
+
+// WithPipelineBindPoint clones a new SubpassDescription2 with the value of
+// PipelineBindPoint updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDescription2) WithPipelineBindPoint(y PipelineBindPoint) SubpassDescription2 {
+	x.pipelineBindPoint = *( /* typedef */ (*C.VkPipelineBindPoint)(&y))
+	return x
+}
+func (x *SubpassDescription2) SetPipelineBindPoint(y PipelineBindPoint) {
+	x.pipelineBindPoint = *( /* typedef */ (*C.VkPipelineBindPoint)(&y))
+}
+
+// ViewMask returns the value of viewMask from VkSubpassDescription2
+func (x *SubpassDescription2) ViewMask() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.viewMask)
+	return *ptr
+}
+
+// WithViewMask clones a new SubpassDescription2 with the value of
+// ViewMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDescription2) WithViewMask(y uint32) SubpassDescription2 {
+	x.viewMask = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *SubpassDescription2) SetViewMask(y uint32) {
+	x.viewMask = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// InputAttachmentCount returns the value of inputAttachmentCount from VkSubpassDescription2
+func (x *SubpassDescription2) InputAttachmentCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.inputAttachmentCount)
+	return *ptr
+}
+
+// WithInputAttachmentCount clones a new SubpassDescription2 with the value of
+// InputAttachmentCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDescription2) WithInputAttachmentCount(y uint32) SubpassDescription2 {
+	x.inputAttachmentCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *SubpassDescription2) SetInputAttachmentCount(y uint32) {
+	x.inputAttachmentCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PInputAttachments returns the value of pInputAttachments from VkSubpassDescription2
+func (x *SubpassDescription2) PInputAttachments() []AttachmentReference2 {
+	if x.pInputAttachments == nil {
+		return nil
+	}
+	return unsafe.Slice((*AttachmentReference2)(unsafe.Pointer(x.pInputAttachments)), x.inputAttachmentCount)
+}
+
+// WithPInputAttachments clones a new SubpassDescription2 with the value of
+// PInputAttachments updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines InputAttachmentCount as the length of this field.
+// InputAttachmentCount is updated with the length of the new value.
+func (x SubpassDescription2) WithPInputAttachments(y []AttachmentReference2) SubpassDescription2 {
+	x.pInputAttachments = *(func(x *[]AttachmentReference2) **C.struct_VkAttachmentReference2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkAttachmentReference2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkAttachmentReference2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithInputAttachmentCount(uint32(len(y)))
+}
+func (x *SubpassDescription2) SetPInputAttachments(y []AttachmentReference2) {
+	x.pInputAttachments = *(func(x *[]AttachmentReference2) **C.struct_VkAttachmentReference2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkAttachmentReference2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkAttachmentReference2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetInputAttachmentCount(uint32(len(y)))
+}
+
+// PinPInputAttachments pins the Go memory referenced by y with the AutoReleasePool
+// and sets PInputAttachments, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SubpassDescription2) PinPInputAttachments(arp *AutoReleasePool, y []AttachmentReference2) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPInputAttachments(y)
+}
+
+// ColorAttachmentCount returns the value of colorAttachmentCount from VkSubpassDescription2
+func (x *SubpassDescription2) ColorAttachmentCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.colorAttachmentCount)
+	return *ptr
+}
+
+// WithColorAttachmentCount clones a new SubpassDescription2 with the value of
+// ColorAttachmentCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDescription2) WithColorAttachmentCount(y uint32) SubpassDescription2 {
+	x.colorAttachmentCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *SubpassDescription2) SetColorAttachmentCount(y uint32) {
+	x.colorAttachmentCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PColorAttachments returns the value of pColorAttachments from VkSubpassDescription2
+func (x *SubpassDescription2) PColorAttachments() []AttachmentReference2 {
+	if x.pColorAttachments == nil {
+		return nil
+	}
+	return unsafe.Slice((*AttachmentReference2)(unsafe.Pointer(x.pColorAttachments)), x.colorAttachmentCount)
+}
+
+// WithPColorAttachments clones a new SubpassDescription2 with the value of
+// PColorAttachments updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines ColorAttachmentCount as the length of this field.
+// ColorAttachmentCount is updated with the length of the new value.
+func (x SubpassDescription2) WithPColorAttachments(y []AttachmentReference2) SubpassDescription2 {
+	x.pColorAttachments = *(func(x *[]AttachmentReference2) **C.struct_VkAttachmentReference2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkAttachmentReference2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkAttachmentReference2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithColorAttachmentCount(uint32(len(y)))
+}
+func (x *SubpassDescription2) SetPColorAttachments(y []AttachmentReference2) {
+	x.pColorAttachments = *(func(x *[]AttachmentReference2) **C.struct_VkAttachmentReference2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkAttachmentReference2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkAttachmentReference2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetColorAttachmentCount(uint32(len(y)))
+}
+
+// PinPColorAttachments pins the Go memory referenced by y with the AutoReleasePool
+// and sets PColorAttachments, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SubpassDescription2) PinPColorAttachments(arp *AutoReleasePool, y []AttachmentReference2) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPColorAttachments(y)
+}
+
+// PResolveAttachments returns the value of pResolveAttachments from VkSubpassDescription2
+func (x *SubpassDescription2) PResolveAttachments() []AttachmentReference2 {
+	if x.pResolveAttachments == nil {
+		return nil
+	}
+	return unsafe.Slice((*AttachmentReference2)(unsafe.Pointer(x.pResolveAttachments)), x.colorAttachmentCount)
+}
+
+// WithPResolveAttachments clones a new SubpassDescription2 with the value of
+// PResolveAttachments updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines ColorAttachmentCount as the length of this field.
+// ColorAttachmentCount is updated with the length of the new value.
+func (x SubpassDescription2) WithPResolveAttachments(y []AttachmentReference2) SubpassDescription2 {
+	x.pResolveAttachments = *(func(x *[]AttachmentReference2) **C.struct_VkAttachmentReference2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkAttachmentReference2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkAttachmentReference2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithColorAttachmentCount(uint32(len(y)))
+}
+func (x *SubpassDescription2) SetPResolveAttachments(y []AttachmentReference2) {
+	x.pResolveAttachments = *(func(x *[]AttachmentReference2) **C.struct_VkAttachmentReference2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkAttachmentReference2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkAttachmentReference2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetColorAttachmentCount(uint32(len(y)))
+}
+
+// PinPResolveAttachments pins the Go memory referenced by y with the AutoReleasePool
+// and sets PResolveAttachments, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SubpassDescription2) PinPResolveAttachments(arp *AutoReleasePool, y []AttachmentReference2) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPResolveAttachments(y)
+}
+
+// PDepthStencilAttachment returns the value of pDepthStencilAttachment from VkSubpassDescription2
+func (x *SubpassDescription2) PDepthStencilAttachment() *AttachmentReference2 {
+	ptr := func(x **C.struct_VkAttachmentReference2) **AttachmentReference2 { /* Pointer */
+		c2g := (*AttachmentReference2)(*x)
+		return &c2g
+	}(&x.pDepthStencilAttachment)
+	return *ptr
+}
+
+// WithPDepthStencilAttachment clones a new SubpassDescription2 with the value of
+// PDepthStencilAttachment updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDescription2) WithPDepthStencilAttachment(y *AttachmentReference2) SubpassDescription2 {
+	x.pDepthStencilAttachment = *(func(x **AttachmentReference2) **C.struct_VkAttachmentReference2 { /* Pointer */
+		g2c := (*C.struct_VkAttachmentReference2)(*x)
+		return &g2c
+	}(&y))
+	return x
+}
+func (x *SubpassDescription2) SetPDepthStencilAttachment(y *AttachmentReference2) {
+	x.pDepthStencilAttachment = *(func(x **AttachmentReference2) **C.struct_VkAttachmentReference2 { /* Pointer */
+		g2c := (*C.struct_VkAttachmentReference2)(*x)
+		return &g2c
+	}(&y))
+}
+
+// PinPDepthStencilAttachment pins the Go memory referenced by y with the AutoReleasePool
+// and sets PDepthStencilAttachment, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SubpassDescription2) PinPDepthStencilAttachment(arp *AutoReleasePool, y *AttachmentReference2) {
+	arp.Pin(unsafe.Pointer(y))
+	x.SetPDepthStencilAttachment(y)
+}
+
+// PreserveAttachmentCount returns the value of preserveAttachmentCount from VkSubpassDescription2
+func (x *SubpassDescription2) PreserveAttachmentCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.preserveAttachmentCount)
+	return *ptr
+}
+
+// WithPreserveAttachmentCount clones a new SubpassDescription2 with the value of
+// PreserveAttachmentCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDescription2) WithPreserveAttachmentCount(y uint32) SubpassDescription2 {
+	x.preserveAttachmentCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *SubpassDescription2) SetPreserveAttachmentCount(y uint32) {
+	x.preserveAttachmentCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PPreserveAttachments returns the value of pPreserveAttachments from VkSubpassDescription2
+func (x *SubpassDescription2) PPreserveAttachments() []uint32 {
+	if x.pPreserveAttachments == nil {
+		return nil
+	}
+	return unsafe.Slice((*uint32)(unsafe.Pointer(x.pPreserveAttachments)), x.preserveAttachmentCount)
+}
+
+// WithPPreserveAttachments clones a new SubpassDescription2 with the value of
+// PPreserveAttachments updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines PreserveAttachmentCount as the length of this field.
+// PreserveAttachmentCount is updated with the length of the new value.
+func (x SubpassDescription2) WithPPreserveAttachments(y []uint32) SubpassDescription2 {
+	x.pPreserveAttachments = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithPreserveAttachmentCount(uint32(len(y)))
+}
+func (x *SubpassDescription2) SetPPreserveAttachments(y []uint32) {
+	x.pPreserveAttachments = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetPreserveAttachmentCount(uint32(len(y)))
+}
+
+// PinPPreserveAttachments pins the Go memory referenced by y with the AutoReleasePool
+// and sets PPreserveAttachments, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SubpassDescription2) PinPPreserveAttachments(arp *AutoReleasePool, y []uint32) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPPreserveAttachments(y)
+}
+
+// AttachmentDescription2 provides a go interface for VkAttachmentDescription2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkAttachmentDescription2.html
+type AttachmentDescription2 C.struct_VkAttachmentDescription2
+
+// SizeofAttachmentDescription2 is the memory size of a AttachmentDescription2
+var SizeofAttachmentDescription2 int = int(unsafe.Sizeof(AttachmentDescription2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x AttachmentDescription2) ArpPtr(arp *AutoReleasePool) *AttachmentDescription2 {
+	ptr := newCBlock(cULong(SizeofAttachmentDescription2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*AttachmentDescription2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *AttachmentDescription2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x AttachmentDescription2) AsCPtr() *AttachmentDescription2 {
+	clone := (*AttachmentDescription2)(newCBlock(cULong(SizeofAttachmentDescription2)))
+	*clone = x
+	return clone
+}
+
+// AttachmentDescription2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func AttachmentDescription2CSlice(arp *AutoReleasePool, x ...AttachmentDescription2) []AttachmentDescription2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofAttachmentDescription2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*AttachmentDescription2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// AttachmentDescription2FreeCSlice releases the memory allocated by AttachmentDescription2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func AttachmentDescription2FreeCSlice(x []AttachmentDescription2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// AttachmentDescription2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. AttachmentDescription2FreeCSlice must be called on the returned slice.
+func AttachmentDescription2MakeCSlice(x ...AttachmentDescription2) []AttachmentDescription2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofAttachmentDescription2 * len(x)
+	dst := unsafe.Slice((*AttachmentDescription2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkAttachmentDescription2
+func (x AttachmentDescription2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new AttachmentDescription2 with the value of
+// SType to the value provided in the specification.
+func (x AttachmentDescription2) WithDefaultSType() AttachmentDescription2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *AttachmentDescription2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_2)
+}
+
+// WithSType clones a new AttachmentDescription2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentDescription2) WithSType(y StructureType) AttachmentDescription2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *AttachmentDescription2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkAttachmentDescription2
+func (x AttachmentDescription2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new AttachmentDescription2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentDescription2) WithPNext(y unsafe.Pointer) AttachmentDescription2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *AttachmentDescription2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *AttachmentDescription2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Flags returns the value of flags from VkAttachmentDescription2
+func (x AttachmentDescription2) Flags() AttachmentDescriptionFlags {
+	ptr := /* typedef */ (*AttachmentDescriptionFlags)(&x.flags)
+	return *ptr
+}
+
+// WithFlags clones a new AttachmentDescription2 with the value of
+// Flags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentDescription2) WithFlags(y AttachmentDescriptionFlags) AttachmentDescription2 {
+	x.flags = *( /* typedef */ (*C.VkAttachmentDescriptionFlags)(&y))
+	return x
+}
+func (x *AttachmentDescription2) SetFlags(y AttachmentDescriptionFlags) {
+	x.flags = *( /* typedef */ (*C.VkAttachmentDescriptionFlags)(&y))
+}
+
+// Format returns the value of format from VkAttachmentDescription2
+func (x AttachmentDescription2) Format() Format {
+	ptr := /* typedef */ (*Format)(&x.format)
+	return *ptr
+}
+
+// WithFormat clones a new AttachmentDescription2 with the value of
+// Format updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentDescription2) WithFormat(y Format) AttachmentDescription2 {
+	x.format = *( /* typedef */ (*C.VkFormat)(&y))
+	return x
+}
+func (x *AttachmentDescription2) SetFormat(y Format) {
+	x.format = *( /* typedef */ (*C.VkFormat)(&y))
+}
+
+// Samples returns the value of samples from VkAttachmentDescription2
+func (x AttachmentDescription2) Samples() SampleCountFlagBits {
+	ptr := /* typedef */ (*SampleCountFlagBits)(&x.samples)
+	return *ptr
+}
+
+// WithSamples clones a new AttachmentDescription2 with the value of
+// Samples updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentDescription2) WithSamples(y SampleCountFlagBits) AttachmentDescription2 {
+	x.samples = *( /* typedef */ (*C.VkSampleCountFlagBits)(&y))
+	return x
+}
+func (x *AttachmentDescription2) SetSamples(y SampleCountFlagBits) {
+	x.samples = *( /* typedef */ (*C.VkSampleCountFlagBits)(&y))
+}
+
+// LoadOp returns the value of loadOp from VkAttachmentDescription2
+func (x AttachmentDescription2) LoadOp() AttachmentLoadOp {
+	ptr := /* typedef */ (*AttachmentLoadOp)(&x.loadOp)
+	return *ptr
+}
+
+// WithLoadOp clones a new AttachmentDescription2 with the value of
+// LoadOp updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentDescription2) WithLoadOp(y AttachmentLoadOp) AttachmentDescription2 {
+	x.loadOp = *( /* typedef */ (*C.VkAttachmentLoadOp)(&y))
+	return x
+}
+func (x *AttachmentDescription2) SetLoadOp(y AttachmentLoadOp) {
+	x.loadOp = *( /* typedef */ (*C.VkAttachmentLoadOp)(&y))
+}
+
+// StoreOp returns the value of storeOp from VkAttachmentDescription2
+func (x AttachmentDescription2) StoreOp() AttachmentStoreOp {
+	ptr := /* typedef */ (*AttachmentStoreOp)(&x.storeOp)
+	return *ptr
+}
+
+// WithStoreOp clones a new AttachmentDescription2 with the value of
+// StoreOp updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentDescription2) WithStoreOp(y AttachmentStoreOp) AttachmentDescription2 {
+	x.storeOp = *( /* typedef */ (*C.VkAttachmentStoreOp)(&y))
+	return x
+}
+func (x *AttachmentDescription2) SetStoreOp(y AttachmentStoreOp) {
+	x.storeOp = *( /* typedef */ (*C.VkAttachmentStoreOp)(&y))
+}
+
+// StencilLoadOp returns the value of stencilLoadOp from VkAttachmentDescription2
+func (x AttachmentDescription2) StencilLoadOp() AttachmentLoadOp {
+	ptr := /* typedef */ (*AttachmentLoadOp)(&x.stencilLoadOp)
+	return *ptr
+}
+
+// WithStencilLoadOp clones a new AttachmentDescription2 with the value of
+// StencilLoadOp updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentDescription2) WithStencilLoadOp(y AttachmentLoadOp) AttachmentDescription2 {
+	x.stencilLoadOp = *( /* typedef */ (*C.VkAttachmentLoadOp)(&y))
+	return x
+}
+func (x *AttachmentDescription2) SetStencilLoadOp(y AttachmentLoadOp) {
+	x.stencilLoadOp = *( /* typedef */ (*C.VkAttachmentLoadOp)(&y))
+}
+
+// StencilStoreOp returns the value of stencilStoreOp from VkAttachmentDescription2
+func (x AttachmentDescription2) StencilStoreOp() AttachmentStoreOp {
+	ptr := /* typedef */ (*AttachmentStoreOp)(&x.stencilStoreOp)
+	return *ptr
+}
+
+// WithStencilStoreOp clones a new AttachmentDescription2 with the value of
+// StencilStoreOp updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentDescription2) WithStencilStoreOp(y AttachmentStoreOp) AttachmentDescription2 {
+	x.stencilStoreOp = *( /* typedef */ (*C.VkAttachmentStoreOp)(&y))
+	return x
+}
+func (x *AttachmentDescription2) SetStencilStoreOp(y AttachmentStoreOp) {
+	x.stencilStoreOp = *( /* typedef */ (*C.VkAttachmentStoreOp)(&y))
+}
+
+// InitialLayout returns the value of initialLayout from VkAttachmentDescription2
+func (x AttachmentDescription2) InitialLayout() ImageLayout {
+	ptr := /* typedef */ (*ImageLayout)(&x.initialLayout)
+	return *ptr
+}
+
+// WithInitialLayout clones a new AttachmentDescription2 with the value of
+// InitialLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentDescription2) WithInitialLayout(y ImageLayout) AttachmentDescription2 {
+	x.initialLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+	return x
+}
+func (x *AttachmentDescription2) SetInitialLayout(y ImageLayout) {
+	x.initialLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+}
+
+// FinalLayout returns the value of finalLayout from VkAttachmentDescription2
+func (x AttachmentDescription2) FinalLayout() ImageLayout {
+	ptr := /* typedef */ (*ImageLayout)(&x.finalLayout)
+	return *ptr
+}
+
+// WithFinalLayout clones a new AttachmentDescription2 with the value of
+// FinalLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentDescription2) WithFinalLayout(y ImageLayout) AttachmentDescription2 {
+	x.finalLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+	return x
+}
+func (x *AttachmentDescription2) SetFinalLayout(y ImageLayout) {
+	x.finalLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+}
+
+// RenderPassCreateInfo2 provides a go interface for VkRenderPassCreateInfo2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkRenderPassCreateInfo2.html
+type RenderPassCreateInfo2 C.struct_VkRenderPassCreateInfo2
+
+// SizeofRenderPassCreateInfo2 is the memory size of a RenderPassCreateInfo2
+var SizeofRenderPassCreateInfo2 int = int(unsafe.Sizeof(RenderPassCreateInfo2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x RenderPassCreateInfo2) ArpPtr(arp *AutoReleasePool) *RenderPassCreateInfo2 {
+	ptr := newCBlock(cULong(SizeofRenderPassCreateInfo2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*RenderPassCreateInfo2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *RenderPassCreateInfo2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x RenderPassCreateInfo2) AsCPtr() *RenderPassCreateInfo2 {
+	clone := (*RenderPassCreateInfo2)(newCBlock(cULong(SizeofRenderPassCreateInfo2)))
+	*clone = x
+	return clone
+}
+
+// RenderPassCreateInfo2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func RenderPassCreateInfo2CSlice(arp *AutoReleasePool, x ...RenderPassCreateInfo2) []RenderPassCreateInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofRenderPassCreateInfo2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*RenderPassCreateInfo2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// RenderPassCreateInfo2FreeCSlice releases the memory allocated by RenderPassCreateInfo2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func RenderPassCreateInfo2FreeCSlice(x []RenderPassCreateInfo2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// RenderPassCreateInfo2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. RenderPassCreateInfo2FreeCSlice must be called on the returned slice.
+func RenderPassCreateInfo2MakeCSlice(x ...RenderPassCreateInfo2) []RenderPassCreateInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofRenderPassCreateInfo2 * len(x)
+	dst := unsafe.Slice((*RenderPassCreateInfo2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkRenderPassCreateInfo2
+func (x *RenderPassCreateInfo2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new RenderPassCreateInfo2 with the value of
+// SType to the value provided in the specification.
+func (x RenderPassCreateInfo2) WithDefaultSType() RenderPassCreateInfo2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *RenderPassCreateInfo2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO_2)
+}
+
+// WithSType clones a new RenderPassCreateInfo2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderPassCreateInfo2) WithSType(y StructureType) RenderPassCreateInfo2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *RenderPassCreateInfo2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkRenderPassCreateInfo2
+func (x *RenderPassCreateInfo2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new RenderPassCreateInfo2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderPassCreateInfo2) WithPNext(y unsafe.Pointer) RenderPassCreateInfo2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *RenderPassCreateInfo2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *RenderPassCreateInfo2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Flags returns the value of flags from VkRenderPassCreateInfo2
+func (x *RenderPassCreateInfo2) Flags() RenderPassCreateFlags {
+	ptr := /* typedef */ (*RenderPassCreateFlags)(&x.flags)
+	return *ptr
+}
+
+// WithFlags clones a new RenderPassCreateInfo2 with the value of
+// Flags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderPassCreateInfo2) WithFlags(y RenderPassCreateFlags) RenderPassCreateInfo2 {
+	x.flags = *( /* typedef */ (*C.VkRenderPassCreateFlags)(&y))
+	return x
+}
+func (x *RenderPassCreateInfo2) SetFlags(y RenderPassCreateFlags) {
+	x.flags = *( /* typedef */ (*C.VkRenderPassCreateFlags)(&y))
+}
+
+// AttachmentCount returns the value of attachmentCount from VkRenderPassCreateInfo2
+func (x *RenderPassCreateInfo2) AttachmentCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.attachmentCount)
+	return *ptr
+}
+
+// WithAttachmentCount clones a new RenderPassCreateInfo2 with the value of
+// AttachmentCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderPassCreateInfo2) WithAttachmentCount(y uint32) RenderPassCreateInfo2 {
+	x.attachmentCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *RenderPassCreateInfo2) SetAttachmentCount(y uint32) {
+	x.attachmentCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PAttachments returns the value of pAttachments from VkRenderPassCreateInfo2
+func (x *RenderPassCreateInfo2) PAttachments() []AttachmentDescription2 {
+	if x.pAttachments == nil {
+		return nil
+	}
+	return unsafe.Slice((*AttachmentDescription2)(unsafe.Pointer(x.pAttachments)), x.attachmentCount)
+}
+
+// WithPAttachments clones a new RenderPassCreateInfo2 with the value of
+// PAttachments updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines AttachmentCount as the length of this field.
+// AttachmentCount is updated with the length of the new value.
+func (x RenderPassCreateInfo2) WithPAttachments(y []AttachmentDescription2) RenderPassCreateInfo2 {
+	x.pAttachments = *(func(x *[]AttachmentDescription2) **C.struct_VkAttachmentDescription2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkAttachmentDescription2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkAttachmentDescription2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithAttachmentCount(uint32(len(y)))
+}
+func (x *RenderPassCreateInfo2) SetPAttachments(y []AttachmentDescription2) {
+	x.pAttachments = *(func(x *[]AttachmentDescription2) **C.struct_VkAttachmentDescription2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkAttachmentDescription2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkAttachmentDescription2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetAttachmentCount(uint32(len(y)))
+}
+
+// PinPAttachments pins the Go memory referenced by y with the AutoReleasePool
+// and sets PAttachments, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *RenderPassCreateInfo2) PinPAttachments(arp *AutoReleasePool, y []AttachmentDescription2) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPAttachments(y)
+}
+
+// SubpassCount returns the value of subpassCount from VkRenderPassCreateInfo2
+func (x *RenderPassCreateInfo2) SubpassCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.subpassCount)
+	return *ptr
+}
+
+// WithSubpassCount clones a new RenderPassCreateInfo2 with the value of
+// SubpassCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderPassCreateInfo2) WithSubpassCount(y uint32) RenderPassCreateInfo2 {
+	x.subpassCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *RenderPassCreateInfo2) SetSubpassCount(y uint32) {
+	x.subpassCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PSubpasses returns the value of pSubpasses from VkRenderPassCreateInfo2
+func (x *RenderPassCreateInfo2) PSubpasses() []SubpassDescription2 {
+	if x.pSubpasses == nil {
+		return nil
+	}
+	return unsafe.Slice((*SubpassDescription2)(unsafe.Pointer(x.pSubpasses)), x.subpassCount)
+}
+
+// WithPSubpasses clones a new RenderPassCreateInfo2 with the value of
+// PSubpasses updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines SubpassCount as the length of this field.
+// SubpassCount is updated with the length of the new value.
+func (x RenderPassCreateInfo2) WithPSubpasses(y []SubpassDescription2) RenderPassCreateInfo2 {
+	x.pSubpasses = *(func(x *[]SubpassDescription2) **C.struct_VkSubpassDescription2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkSubpassDescription2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkSubpassDescription2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithSubpassCount(uint32(len(y)))
+}
+func (x *RenderPassCreateInfo2) SetPSubpasses(y []SubpassDescription2) {
+	x.pSubpasses = *(func(x *[]SubpassDescription2) **C.struct_VkSubpassDescription2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkSubpassDescription2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkSubpassDescription2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetSubpassCount(uint32(len(y)))
+}
+
+// PinPSubpasses pins the Go memory referenced by y with the AutoReleasePool
+// and sets PSubpasses, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *RenderPassCreateInfo2) PinPSubpasses(arp *AutoReleasePool, y []SubpassDescription2) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPSubpasses(y)
+}
+
+// DependencyCount returns the value of dependencyCount from VkRenderPassCreateInfo2
+func (x *RenderPassCreateInfo2) DependencyCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.dependencyCount)
+	return *ptr
+}
+
+// WithDependencyCount clones a new RenderPassCreateInfo2 with the value of
+// DependencyCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderPassCreateInfo2) WithDependencyCount(y uint32) RenderPassCreateInfo2 {
+	x.dependencyCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *RenderPassCreateInfo2) SetDependencyCount(y uint32) {
+	x.dependencyCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PDependencies returns the value of pDependencies from VkRenderPassCreateInfo2
+func (x *RenderPassCreateInfo2) PDependencies() []SubpassDependency2 {
+	if x.pDependencies == nil {
+		return nil
+	}
+	return unsafe.Slice((*SubpassDependency2)(unsafe.Pointer(x.pDependencies)), x.dependencyCount)
+}
+
+// WithPDependencies clones a new RenderPassCreateInfo2 with the value of
+// PDependencies updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines DependencyCount as the length of this field.
+// DependencyCount is updated with the length of the new value.
+func (x RenderPassCreateInfo2) WithPDependencies(y []SubpassDependency2) RenderPassCreateInfo2 {
+	x.pDependencies = *(func(x *[]SubpassDependency2) **C.struct_VkSubpassDependency2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkSubpassDependency2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkSubpassDependency2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithDependencyCount(uint32(len(y)))
+}
+func (x *RenderPassCreateInfo2) SetPDependencies(y []SubpassDependency2) {
+	x.pDependencies = *(func(x *[]SubpassDependency2) **C.struct_VkSubpassDependency2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkSubpassDependency2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkSubpassDependency2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetDependencyCount(uint32(len(y)))
+}
+
+// PinPDependencies pins the Go memory referenced by y with the AutoReleasePool
+// and sets PDependencies, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *RenderPassCreateInfo2) PinPDependencies(arp *AutoReleasePool, y []SubpassDependency2) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPDependencies(y)
+}
+
+// CorrelatedViewMaskCount returns the value of correlatedViewMaskCount from VkRenderPassCreateInfo2
+func (x *RenderPassCreateInfo2) CorrelatedViewMaskCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.correlatedViewMaskCount)
+	return *ptr
+}
+
+// WithCorrelatedViewMaskCount clones a new RenderPassCreateInfo2 with the value of
+// CorrelatedViewMaskCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderPassCreateInfo2) WithCorrelatedViewMaskCount(y uint32) RenderPassCreateInfo2 {
+	x.correlatedViewMaskCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *RenderPassCreateInfo2) SetCorrelatedViewMaskCount(y uint32) {
+	x.correlatedViewMaskCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PCorrelatedViewMasks returns the value of pCorrelatedViewMasks from VkRenderPassCreateInfo2
+func (x *RenderPassCreateInfo2) PCorrelatedViewMasks() []uint32 {
+	if x.pCorrelatedViewMasks == nil {
+		return nil
+	}
+	return unsafe.Slice((*uint32)(unsafe.Pointer(x.pCorrelatedViewMasks)), x.correlatedViewMaskCount)
+}
+
+// WithPCorrelatedViewMasks clones a new RenderPassCreateInfo2 with the value of
+// PCorrelatedViewMasks updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines CorrelatedViewMaskCount as the length of this field.
+// CorrelatedViewMaskCount is updated with the length of the new value.
+func (x RenderPassCreateInfo2) WithPCorrelatedViewMasks(y []uint32) RenderPassCreateInfo2 {
+	x.pCorrelatedViewMasks = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithCorrelatedViewMaskCount(uint32(len(y)))
+}
+func (x *RenderPassCreateInfo2) SetPCorrelatedViewMasks(y []uint32) {
+	x.pCorrelatedViewMasks = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetCorrelatedViewMaskCount(uint32(len(y)))
+}
+
+// PinPCorrelatedViewMasks pins the Go memory referenced by y with the AutoReleasePool
+// and sets PCorrelatedViewMasks, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *RenderPassCreateInfo2) PinPCorrelatedViewMasks(arp *AutoReleasePool, y []uint32) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPCorrelatedViewMasks(y)
+}
+
+// SubpassBeginInfo provides a go interface for VkSubpassBeginInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSubpassBeginInfo.html
+type SubpassBeginInfo C.struct_VkSubpassBeginInfo
+
+// SizeofSubpassBeginInfo is the memory size of a SubpassBeginInfo
+var SizeofSubpassBeginInfo int = int(unsafe.Sizeof(SubpassBeginInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SubpassBeginInfo) ArpPtr(arp *AutoReleasePool) *SubpassBeginInfo {
+	ptr := newCBlock(cULong(SizeofSubpassBeginInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SubpassBeginInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SubpassBeginInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SubpassBeginInfo) AsCPtr() *SubpassBeginInfo {
+	clone := (*SubpassBeginInfo)(newCBlock(cULong(SizeofSubpassBeginInfo)))
+	*clone = x
+	return clone
+}
+
+// SubpassBeginInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SubpassBeginInfoCSlice(arp *AutoReleasePool, x ...SubpassBeginInfo) []SubpassBeginInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSubpassBeginInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SubpassBeginInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SubpassBeginInfoFreeCSlice releases the memory allocated by SubpassBeginInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func SubpassBeginInfoFreeCSlice(x []SubpassBeginInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SubpassBeginInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SubpassBeginInfoFreeCSlice must be called on the returned slice.
+func SubpassBeginInfoMakeCSlice(x ...SubpassBeginInfo) []SubpassBeginInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSubpassBeginInfo * len(x)
+	dst := unsafe.Slice((*SubpassBeginInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkSubpassBeginInfo
+func (x SubpassBeginInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new SubpassBeginInfo with the value of
+// SType to the value provided in the specification.
+func (x SubpassBeginInfo) WithDefaultSType() SubpassBeginInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_SUBPASS_BEGIN_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *SubpassBeginInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_SUBPASS_BEGIN_INFO)
+}
+
+// WithSType clones a new SubpassBeginInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassBeginInfo) WithSType(y StructureType) SubpassBeginInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *SubpassBeginInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkSubpassBeginInfo
+func (x SubpassBeginInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new SubpassBeginInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassBeginInfo) WithPNext(y unsafe.Pointer) SubpassBeginInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *SubpassBeginInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SubpassBeginInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Contents returns the value of contents from VkSubpassBeginInfo
+func (x SubpassBeginInfo) Contents() SubpassContents {
+	ptr := /* typedef */ (*SubpassContents)(&x.contents)
+	return *ptr
+}
+
+// WithContents clones a new SubpassBeginInfo with the value of
+// Contents updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassBeginInfo) WithContents(y SubpassContents) SubpassBeginInfo {
+	x.contents = *( /* typedef */ (*C.VkSubpassContents)(&y))
+	return x
+}
+func (x *SubpassBeginInfo) SetContents(y SubpassContents) {
+	x.contents = *( /* typedef */ (*C.VkSubpassContents)(&y))
+}
+
+// SubpassEndInfo provides a go interface for VkSubpassEndInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSubpassEndInfo.html
+type SubpassEndInfo C.struct_VkSubpassEndInfo
+
+// SizeofSubpassEndInfo is the memory size of a SubpassEndInfo
+var SizeofSubpassEndInfo int = int(unsafe.Sizeof(SubpassEndInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SubpassEndInfo) ArpPtr(arp *AutoReleasePool) *SubpassEndInfo {
+	ptr := newCBlock(cULong(SizeofSubpassEndInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SubpassEndInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SubpassEndInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SubpassEndInfo) AsCPtr() *SubpassEndInfo {
+	clone := (*SubpassEndInfo)(newCBlock(cULong(SizeofSubpassEndInfo)))
+	*clone = x
+	return clone
+}
+
+// SubpassEndInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SubpassEndInfoCSlice(arp *AutoReleasePool, x ...SubpassEndInfo) []SubpassEndInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSubpassEndInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SubpassEndInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SubpassEndInfoFreeCSlice releases the memory allocated by SubpassEndInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func SubpassEndInfoFreeCSlice(x []SubpassEndInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SubpassEndInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SubpassEndInfoFreeCSlice must be called on the returned slice.
+func SubpassEndInfoMakeCSlice(x ...SubpassEndInfo) []SubpassEndInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSubpassEndInfo * len(x)
+	dst := unsafe.Slice((*SubpassEndInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkSubpassEndInfo
+func (x SubpassEndInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new SubpassEndInfo with the value of
+// SType to the value provided in the specification.
+func (x SubpassEndInfo) WithDefaultSType() SubpassEndInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_SUBPASS_END_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *SubpassEndInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_SUBPASS_END_INFO)
+}
+
+// WithSType clones a new SubpassEndInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassEndInfo) WithSType(y StructureType) SubpassEndInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *SubpassEndInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkSubpassEndInfo
+func (x SubpassEndInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new SubpassEndInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassEndInfo) WithPNext(y unsafe.Pointer) SubpassEndInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *SubpassEndInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SubpassEndInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// PhysicalDeviceTimelineSemaphoreFeatures provides a go interface for VkPhysicalDeviceTimelineSemaphoreFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceTimelineSemaphoreFeatures.html
+type PhysicalDeviceTimelineSemaphoreFeatures C.struct_VkPhysicalDeviceTimelineSemaphoreFeatures
+
+// SizeofPhysicalDeviceTimelineSemaphoreFeatures is the memory size of a PhysicalDeviceTimelineSemaphoreFeatures
+var SizeofPhysicalDeviceTimelineSemaphoreFeatures int = int(unsafe.Sizeof(PhysicalDeviceTimelineSemaphoreFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceTimelineSemaphoreFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceTimelineSemaphoreFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceTimelineSemaphoreFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceTimelineSemaphoreFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceTimelineSemaphoreFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceTimelineSemaphoreFeatures) AsCPtr() *PhysicalDeviceTimelineSemaphoreFeatures {
+	clone := (*PhysicalDeviceTimelineSemaphoreFeatures)(newCBlock(cULong(SizeofPhysicalDeviceTimelineSemaphoreFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceTimelineSemaphoreFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceTimelineSemaphoreFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceTimelineSemaphoreFeatures) []PhysicalDeviceTimelineSemaphoreFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceTimelineSemaphoreFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceTimelineSemaphoreFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceTimelineSemaphoreFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceTimelineSemaphoreFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceTimelineSemaphoreFeaturesFreeCSlice(x []PhysicalDeviceTimelineSemaphoreFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceTimelineSemaphoreFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceTimelineSemaphoreFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceTimelineSemaphoreFeaturesMakeCSlice(x ...PhysicalDeviceTimelineSemaphoreFeatures) []PhysicalDeviceTimelineSemaphoreFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceTimelineSemaphoreFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceTimelineSemaphoreFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceTimelineSemaphoreFeatures
+func (x PhysicalDeviceTimelineSemaphoreFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceTimelineSemaphoreFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceTimelineSemaphoreFeatures) WithDefaultSType() PhysicalDeviceTimelineSemaphoreFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceTimelineSemaphoreFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceTimelineSemaphoreFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceTimelineSemaphoreFeatures) WithSType(y StructureType) PhysicalDeviceTimelineSemaphoreFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceTimelineSemaphoreFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceTimelineSemaphoreFeatures
+func (x PhysicalDeviceTimelineSemaphoreFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceTimelineSemaphoreFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceTimelineSemaphoreFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceTimelineSemaphoreFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceTimelineSemaphoreFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceTimelineSemaphoreFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// TimelineSemaphore returns the value of timelineSemaphore from VkPhysicalDeviceTimelineSemaphoreFeatures
+func (x PhysicalDeviceTimelineSemaphoreFeatures) TimelineSemaphore() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.timelineSemaphore)
+	return *ptr
+}
+
+// WithTimelineSemaphore clones a new PhysicalDeviceTimelineSemaphoreFeatures with the value of
+// TimelineSemaphore updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceTimelineSemaphoreFeatures) WithTimelineSemaphore(y Bool32) PhysicalDeviceTimelineSemaphoreFeatures {
+	x.timelineSemaphore = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceTimelineSemaphoreFeatures) SetTimelineSemaphore(y Bool32) {
+	x.timelineSemaphore = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ImageFormatListCreateInfo provides a go interface for VkImageFormatListCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkImageFormatListCreateInfo.html
+type ImageFormatListCreateInfo C.struct_VkImageFormatListCreateInfo
+
+// SizeofImageFormatListCreateInfo is the memory size of a ImageFormatListCreateInfo
+var SizeofImageFormatListCreateInfo int = int(unsafe.Sizeof(ImageFormatListCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ImageFormatListCreateInfo) ArpPtr(arp *AutoReleasePool) *ImageFormatListCreateInfo {
+	ptr := newCBlock(cULong(SizeofImageFormatListCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ImageFormatListCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ImageFormatListCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ImageFormatListCreateInfo) AsCPtr() *ImageFormatListCreateInfo {
+	clone := (*ImageFormatListCreateInfo)(newCBlock(cULong(SizeofImageFormatListCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// ImageFormatListCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ImageFormatListCreateInfoCSlice(arp *AutoReleasePool, x ...ImageFormatListCreateInfo) []ImageFormatListCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImageFormatListCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ImageFormatListCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ImageFormatListCreateInfoFreeCSlice releases the memory allocated by ImageFormatListCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func ImageFormatListCreateInfoFreeCSlice(x []ImageFormatListCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ImageFormatListCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ImageFormatListCreateInfoFreeCSlice must be called on the returned slice.
+func ImageFormatListCreateInfoMakeCSlice(x ...ImageFormatListCreateInfo) []ImageFormatListCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImageFormatListCreateInfo * len(x)
+	dst := unsafe.Slice((*ImageFormatListCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkImageFormatListCreateInfo
+func (x ImageFormatListCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ImageFormatListCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x ImageFormatListCreateInfo) WithDefaultSType() ImageFormatListCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ImageFormatListCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO)
+}
+
+// WithSType clones a new ImageFormatListCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageFormatListCreateInfo) WithSType(y StructureType) ImageFormatListCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ImageFormatListCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkImageFormatListCreateInfo
+func (x ImageFormatListCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ImageFormatListCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageFormatListCreateInfo) WithPNext(y unsafe.Pointer) ImageFormatListCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ImageFormatListCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ImageFormatListCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ViewFormatCount returns the value of viewFormatCount from VkImageFormatListCreateInfo
+func (x ImageFormatListCreateInfo) ViewFormatCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.viewFormatCount)
+	return *ptr
+}
+
+// WithViewFormatCount clones a new ImageFormatListCreateInfo with the value of
+// ViewFormatCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageFormatListCreateInfo) WithViewFormatCount(y uint32) ImageFormatListCreateInfo {
+	x.viewFormatCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *ImageFormatListCreateInfo) SetViewFormatCount(y uint32) {
+	x.viewFormatCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PViewFormats returns the value of pViewFormats from VkImageFormatListCreateInfo
+func (x ImageFormatListCreateInfo) PViewFormats() []Format {
+	if x.pViewFormats == nil {
+		return nil
+	}
+	return unsafe.Slice((*Format)(unsafe.Pointer(x.pViewFormats)), x.viewFormatCount)
+}
+
+// WithPViewFormats clones a new ImageFormatListCreateInfo with the value of
+// PViewFormats updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines ViewFormatCount as the length of this field.
+// ViewFormatCount is updated with the length of the new value.
+func (x ImageFormatListCreateInfo) WithPViewFormats(y []Format) ImageFormatListCreateInfo {
+	x.pViewFormats = *(func(x *[]Format) **C.VkFormat { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkFormat)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkFormat)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithViewFormatCount(uint32(len(y)))
+}
+func (x *ImageFormatListCreateInfo) SetPViewFormats(y []Format) {
+	x.pViewFormats = *(func(x *[]Format) **C.VkFormat { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkFormat)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkFormat)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetViewFormatCount(uint32(len(y)))
+}
+
+// PinPViewFormats pins the Go memory referenced by y with the AutoReleasePool
+// and sets PViewFormats, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ImageFormatListCreateInfo) PinPViewFormats(arp *AutoReleasePool, y []Format) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPViewFormats(y)
+}
+
+// PhysicalDeviceHostQueryResetFeatures provides a go interface for VkPhysicalDeviceHostQueryResetFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceHostQueryResetFeatures.html
+type PhysicalDeviceHostQueryResetFeatures C.struct_VkPhysicalDeviceHostQueryResetFeatures
+
+// SizeofPhysicalDeviceHostQueryResetFeatures is the memory size of a PhysicalDeviceHostQueryResetFeatures
+var SizeofPhysicalDeviceHostQueryResetFeatures int = int(unsafe.Sizeof(PhysicalDeviceHostQueryResetFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceHostQueryResetFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceHostQueryResetFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceHostQueryResetFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceHostQueryResetFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceHostQueryResetFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceHostQueryResetFeatures) AsCPtr() *PhysicalDeviceHostQueryResetFeatures {
+	clone := (*PhysicalDeviceHostQueryResetFeatures)(newCBlock(cULong(SizeofPhysicalDeviceHostQueryResetFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceHostQueryResetFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceHostQueryResetFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceHostQueryResetFeatures) []PhysicalDeviceHostQueryResetFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceHostQueryResetFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceHostQueryResetFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceHostQueryResetFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceHostQueryResetFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceHostQueryResetFeaturesFreeCSlice(x []PhysicalDeviceHostQueryResetFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceHostQueryResetFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceHostQueryResetFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceHostQueryResetFeaturesMakeCSlice(x ...PhysicalDeviceHostQueryResetFeatures) []PhysicalDeviceHostQueryResetFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceHostQueryResetFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceHostQueryResetFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceHostQueryResetFeatures
+func (x PhysicalDeviceHostQueryResetFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceHostQueryResetFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceHostQueryResetFeatures) WithDefaultSType() PhysicalDeviceHostQueryResetFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceHostQueryResetFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceHostQueryResetFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceHostQueryResetFeatures) WithSType(y StructureType) PhysicalDeviceHostQueryResetFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceHostQueryResetFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceHostQueryResetFeatures
+func (x PhysicalDeviceHostQueryResetFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceHostQueryResetFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceHostQueryResetFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceHostQueryResetFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceHostQueryResetFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceHostQueryResetFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// HostQueryReset returns the value of hostQueryReset from VkPhysicalDeviceHostQueryResetFeatures
+func (x PhysicalDeviceHostQueryResetFeatures) HostQueryReset() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.hostQueryReset)
+	return *ptr
+}
+
+// WithHostQueryReset clones a new PhysicalDeviceHostQueryResetFeatures with the value of
+// HostQueryReset updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceHostQueryResetFeatures) WithHostQueryReset(y Bool32) PhysicalDeviceHostQueryResetFeatures {
+	x.hostQueryReset = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceHostQueryResetFeatures) SetHostQueryReset(y Bool32) {
+	x.hostQueryReset = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// AttachmentDescriptionStencilLayout provides a go interface for VkAttachmentDescriptionStencilLayout.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkAttachmentDescriptionStencilLayout.html
+type AttachmentDescriptionStencilLayout C.struct_VkAttachmentDescriptionStencilLayout
+
+// SizeofAttachmentDescriptionStencilLayout is the memory size of a AttachmentDescriptionStencilLayout
+var SizeofAttachmentDescriptionStencilLayout int = int(unsafe.Sizeof(AttachmentDescriptionStencilLayout{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x AttachmentDescriptionStencilLayout) ArpPtr(arp *AutoReleasePool) *AttachmentDescriptionStencilLayout {
+	ptr := newCBlock(cULong(SizeofAttachmentDescriptionStencilLayout))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*AttachmentDescriptionStencilLayout)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *AttachmentDescriptionStencilLayout) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x AttachmentDescriptionStencilLayout) AsCPtr() *AttachmentDescriptionStencilLayout {
+	clone := (*AttachmentDescriptionStencilLayout)(newCBlock(cULong(SizeofAttachmentDescriptionStencilLayout)))
+	*clone = x
+	return clone
+}
+
+// AttachmentDescriptionStencilLayoutCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func AttachmentDescriptionStencilLayoutCSlice(arp *AutoReleasePool, x ...AttachmentDescriptionStencilLayout) []AttachmentDescriptionStencilLayout {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofAttachmentDescriptionStencilLayout * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*AttachmentDescriptionStencilLayout)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// AttachmentDescriptionStencilLayoutFreeCSlice releases the memory allocated by AttachmentDescriptionStencilLayoutMakeCSlice.
+// It does not free pointers stored inside the slice.
+func AttachmentDescriptionStencilLayoutFreeCSlice(x []AttachmentDescriptionStencilLayout) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// AttachmentDescriptionStencilLayoutMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. AttachmentDescriptionStencilLayoutFreeCSlice must be called on the returned slice.
+func AttachmentDescriptionStencilLayoutMakeCSlice(x ...AttachmentDescriptionStencilLayout) []AttachmentDescriptionStencilLayout {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofAttachmentDescriptionStencilLayout * len(x)
+	dst := unsafe.Slice((*AttachmentDescriptionStencilLayout)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkAttachmentDescriptionStencilLayout
+func (x AttachmentDescriptionStencilLayout) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new AttachmentDescriptionStencilLayout with the value of
+// SType to the value provided in the specification.
+func (x AttachmentDescriptionStencilLayout) WithDefaultSType() AttachmentDescriptionStencilLayout {
+	return x.WithSType(VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *AttachmentDescriptionStencilLayout) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT)
+}
+
+// WithSType clones a new AttachmentDescriptionStencilLayout with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentDescriptionStencilLayout) WithSType(y StructureType) AttachmentDescriptionStencilLayout {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *AttachmentDescriptionStencilLayout) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkAttachmentDescriptionStencilLayout
+func (x AttachmentDescriptionStencilLayout) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new AttachmentDescriptionStencilLayout with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentDescriptionStencilLayout) WithPNext(y unsafe.Pointer) AttachmentDescriptionStencilLayout {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *AttachmentDescriptionStencilLayout) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *AttachmentDescriptionStencilLayout) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// StencilInitialLayout returns the value of stencilInitialLayout from VkAttachmentDescriptionStencilLayout
+func (x AttachmentDescriptionStencilLayout) StencilInitialLayout() ImageLayout {
+	ptr := /* typedef */ (*ImageLayout)(&x.stencilInitialLayout)
+	return *ptr
+}
+
+// WithStencilInitialLayout clones a new AttachmentDescriptionStencilLayout with the value of
+// StencilInitialLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentDescriptionStencilLayout) WithStencilInitialLayout(y ImageLayout) AttachmentDescriptionStencilLayout {
+	x.stencilInitialLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+	return x
+}
+func (x *AttachmentDescriptionStencilLayout) SetStencilInitialLayout(y ImageLayout) {
+	x.stencilInitialLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+}
+
+// StencilFinalLayout returns the value of stencilFinalLayout from VkAttachmentDescriptionStencilLayout
+func (x AttachmentDescriptionStencilLayout) StencilFinalLayout() ImageLayout {
+	ptr := /* typedef */ (*ImageLayout)(&x.stencilFinalLayout)
+	return *ptr
+}
+
+// WithStencilFinalLayout clones a new AttachmentDescriptionStencilLayout with the value of
+// StencilFinalLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentDescriptionStencilLayout) WithStencilFinalLayout(y ImageLayout) AttachmentDescriptionStencilLayout {
+	x.stencilFinalLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+	return x
+}
+func (x *AttachmentDescriptionStencilLayout) SetStencilFinalLayout(y ImageLayout) {
+	x.stencilFinalLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+}
+
+// AttachmentReferenceStencilLayout provides a go interface for VkAttachmentReferenceStencilLayout.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkAttachmentReferenceStencilLayout.html
+type AttachmentReferenceStencilLayout C.struct_VkAttachmentReferenceStencilLayout
+
+// SizeofAttachmentReferenceStencilLayout is the memory size of a AttachmentReferenceStencilLayout
+var SizeofAttachmentReferenceStencilLayout int = int(unsafe.Sizeof(AttachmentReferenceStencilLayout{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x AttachmentReferenceStencilLayout) ArpPtr(arp *AutoReleasePool) *AttachmentReferenceStencilLayout {
+	ptr := newCBlock(cULong(SizeofAttachmentReferenceStencilLayout))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*AttachmentReferenceStencilLayout)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *AttachmentReferenceStencilLayout) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x AttachmentReferenceStencilLayout) AsCPtr() *AttachmentReferenceStencilLayout {
+	clone := (*AttachmentReferenceStencilLayout)(newCBlock(cULong(SizeofAttachmentReferenceStencilLayout)))
+	*clone = x
+	return clone
+}
+
+// AttachmentReferenceStencilLayoutCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func AttachmentReferenceStencilLayoutCSlice(arp *AutoReleasePool, x ...AttachmentReferenceStencilLayout) []AttachmentReferenceStencilLayout {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofAttachmentReferenceStencilLayout * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*AttachmentReferenceStencilLayout)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// AttachmentReferenceStencilLayoutFreeCSlice releases the memory allocated by AttachmentReferenceStencilLayoutMakeCSlice.
+// It does not free pointers stored inside the slice.
+func AttachmentReferenceStencilLayoutFreeCSlice(x []AttachmentReferenceStencilLayout) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// AttachmentReferenceStencilLayoutMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. AttachmentReferenceStencilLayoutFreeCSlice must be called on the returned slice.
+func AttachmentReferenceStencilLayoutMakeCSlice(x ...AttachmentReferenceStencilLayout) []AttachmentReferenceStencilLayout {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofAttachmentReferenceStencilLayout * len(x)
+	dst := unsafe.Slice((*AttachmentReferenceStencilLayout)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkAttachmentReferenceStencilLayout
+func (x AttachmentReferenceStencilLayout) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new AttachmentReferenceStencilLayout with the value of
+// SType to the value provided in the specification.
+func (x AttachmentReferenceStencilLayout) WithDefaultSType() AttachmentReferenceStencilLayout {
+	return x.WithSType(VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *AttachmentReferenceStencilLayout) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT)
+}
+
+// WithSType clones a new AttachmentReferenceStencilLayout with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentReferenceStencilLayout) WithSType(y StructureType) AttachmentReferenceStencilLayout {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *AttachmentReferenceStencilLayout) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkAttachmentReferenceStencilLayout
+func (x AttachmentReferenceStencilLayout) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new AttachmentReferenceStencilLayout with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentReferenceStencilLayout) WithPNext(y unsafe.Pointer) AttachmentReferenceStencilLayout {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *AttachmentReferenceStencilLayout) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *AttachmentReferenceStencilLayout) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// StencilLayout returns the value of stencilLayout from VkAttachmentReferenceStencilLayout
+func (x AttachmentReferenceStencilLayout) StencilLayout() ImageLayout {
+	ptr := /* typedef */ (*ImageLayout)(&x.stencilLayout)
+	return *ptr
+}
+
+// WithStencilLayout clones a new AttachmentReferenceStencilLayout with the value of
+// StencilLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x AttachmentReferenceStencilLayout) WithStencilLayout(y ImageLayout) AttachmentReferenceStencilLayout {
+	x.stencilLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+	return x
+}
+func (x *AttachmentReferenceStencilLayout) SetStencilLayout(y ImageLayout) {
+	x.stencilLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+}
+
+// SubpassDescriptionDepthStencilResolve provides a go interface for VkSubpassDescriptionDepthStencilResolve.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSubpassDescriptionDepthStencilResolve.html
+type SubpassDescriptionDepthStencilResolve C.struct_VkSubpassDescriptionDepthStencilResolve
+
+// SizeofSubpassDescriptionDepthStencilResolve is the memory size of a SubpassDescriptionDepthStencilResolve
+var SizeofSubpassDescriptionDepthStencilResolve int = int(unsafe.Sizeof(SubpassDescriptionDepthStencilResolve{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SubpassDescriptionDepthStencilResolve) ArpPtr(arp *AutoReleasePool) *SubpassDescriptionDepthStencilResolve {
+	ptr := newCBlock(cULong(SizeofSubpassDescriptionDepthStencilResolve))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SubpassDescriptionDepthStencilResolve)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SubpassDescriptionDepthStencilResolve) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SubpassDescriptionDepthStencilResolve) AsCPtr() *SubpassDescriptionDepthStencilResolve {
+	clone := (*SubpassDescriptionDepthStencilResolve)(newCBlock(cULong(SizeofSubpassDescriptionDepthStencilResolve)))
+	*clone = x
+	return clone
+}
+
+// SubpassDescriptionDepthStencilResolveCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SubpassDescriptionDepthStencilResolveCSlice(arp *AutoReleasePool, x ...SubpassDescriptionDepthStencilResolve) []SubpassDescriptionDepthStencilResolve {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSubpassDescriptionDepthStencilResolve * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SubpassDescriptionDepthStencilResolve)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SubpassDescriptionDepthStencilResolveFreeCSlice releases the memory allocated by SubpassDescriptionDepthStencilResolveMakeCSlice.
+// It does not free pointers stored inside the slice.
+func SubpassDescriptionDepthStencilResolveFreeCSlice(x []SubpassDescriptionDepthStencilResolve) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SubpassDescriptionDepthStencilResolveMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SubpassDescriptionDepthStencilResolveFreeCSlice must be called on the returned slice.
+func SubpassDescriptionDepthStencilResolveMakeCSlice(x ...SubpassDescriptionDepthStencilResolve) []SubpassDescriptionDepthStencilResolve {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSubpassDescriptionDepthStencilResolve * len(x)
+	dst := unsafe.Slice((*SubpassDescriptionDepthStencilResolve)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkSubpassDescriptionDepthStencilResolve
+func (x SubpassDescriptionDepthStencilResolve) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new SubpassDescriptionDepthStencilResolve with the value of
+// SType to the value provided in the specification.
+func (x SubpassDescriptionDepthStencilResolve) WithDefaultSType() SubpassDescriptionDepthStencilResolve {
+	return x.WithSType(VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENCIL_RESOLVE)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *SubpassDescriptionDepthStencilResolve) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENCIL_RESOLVE)
+}
+
+// WithSType clones a new SubpassDescriptionDepthStencilResolve with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDescriptionDepthStencilResolve) WithSType(y StructureType) SubpassDescriptionDepthStencilResolve {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *SubpassDescriptionDepthStencilResolve) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkSubpassDescriptionDepthStencilResolve
+func (x SubpassDescriptionDepthStencilResolve) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new SubpassDescriptionDepthStencilResolve with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDescriptionDepthStencilResolve) WithPNext(y unsafe.Pointer) SubpassDescriptionDepthStencilResolve {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *SubpassDescriptionDepthStencilResolve) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SubpassDescriptionDepthStencilResolve) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// DepthResolveMode returns the value of depthResolveMode from VkSubpassDescriptionDepthStencilResolve
+func (x SubpassDescriptionDepthStencilResolve) DepthResolveMode() ResolveModeFlagBits {
+	ptr := /* typedef */ (*ResolveModeFlagBits)(&x.depthResolveMode)
+	return *ptr
+}
+
+// WithDepthResolveMode clones a new SubpassDescriptionDepthStencilResolve with the value of
+// DepthResolveMode updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDescriptionDepthStencilResolve) WithDepthResolveMode(y ResolveModeFlagBits) SubpassDescriptionDepthStencilResolve {
+	x.depthResolveMode = *( /* typedef */ (*C.VkResolveModeFlagBits)(&y))
+	return x
+}
+func (x *SubpassDescriptionDepthStencilResolve) SetDepthResolveMode(y ResolveModeFlagBits) {
+	x.depthResolveMode = *( /* typedef */ (*C.VkResolveModeFlagBits)(&y))
+}
+
+// StencilResolveMode returns the value of stencilResolveMode from VkSubpassDescriptionDepthStencilResolve
+func (x SubpassDescriptionDepthStencilResolve) StencilResolveMode() ResolveModeFlagBits {
+	ptr := /* typedef */ (*ResolveModeFlagBits)(&x.stencilResolveMode)
+	return *ptr
+}
+
+// WithStencilResolveMode clones a new SubpassDescriptionDepthStencilResolve with the value of
+// StencilResolveMode updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDescriptionDepthStencilResolve) WithStencilResolveMode(y ResolveModeFlagBits) SubpassDescriptionDepthStencilResolve {
+	x.stencilResolveMode = *( /* typedef */ (*C.VkResolveModeFlagBits)(&y))
+	return x
+}
+func (x *SubpassDescriptionDepthStencilResolve) SetStencilResolveMode(y ResolveModeFlagBits) {
+	x.stencilResolveMode = *( /* typedef */ (*C.VkResolveModeFlagBits)(&y))
+}
+
+// PDepthStencilResolveAttachment returns the value of pDepthStencilResolveAttachment from VkSubpassDescriptionDepthStencilResolve
+func (x SubpassDescriptionDepthStencilResolve) PDepthStencilResolveAttachment() *AttachmentReference2 {
+	ptr := func(x **C.struct_VkAttachmentReference2) **AttachmentReference2 { /* Pointer */
+		c2g := (*AttachmentReference2)(*x)
+		return &c2g
+	}(&x.pDepthStencilResolveAttachment)
+	return *ptr
+}
+
+// WithPDepthStencilResolveAttachment clones a new SubpassDescriptionDepthStencilResolve with the value of
+// PDepthStencilResolveAttachment updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubpassDescriptionDepthStencilResolve) WithPDepthStencilResolveAttachment(y *AttachmentReference2) SubpassDescriptionDepthStencilResolve {
+	x.pDepthStencilResolveAttachment = *(func(x **AttachmentReference2) **C.struct_VkAttachmentReference2 { /* Pointer */
+		g2c := (*C.struct_VkAttachmentReference2)(*x)
+		return &g2c
+	}(&y))
+	return x
+}
+func (x *SubpassDescriptionDepthStencilResolve) SetPDepthStencilResolveAttachment(y *AttachmentReference2) {
+	x.pDepthStencilResolveAttachment = *(func(x **AttachmentReference2) **C.struct_VkAttachmentReference2 { /* Pointer */
+		g2c := (*C.struct_VkAttachmentReference2)(*x)
+		return &g2c
+	}(&y))
+}
+
+// PinPDepthStencilResolveAttachment pins the Go memory referenced by y with the AutoReleasePool
+// and sets PDepthStencilResolveAttachment, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SubpassDescriptionDepthStencilResolve) PinPDepthStencilResolveAttachment(arp *AutoReleasePool, y *AttachmentReference2) {
+	arp.Pin(unsafe.Pointer(y))
+	x.SetPDepthStencilResolveAttachment(y)
+}
+
+// PhysicalDeviceShaderSubgroupExtendedTypesFeatures provides a go interface for VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures.html
+type PhysicalDeviceShaderSubgroupExtendedTypesFeatures C.struct_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures
+
+// SizeofPhysicalDeviceShaderSubgroupExtendedTypesFeatures is the memory size of a PhysicalDeviceShaderSubgroupExtendedTypesFeatures
+var SizeofPhysicalDeviceShaderSubgroupExtendedTypesFeatures int = int(unsafe.Sizeof(PhysicalDeviceShaderSubgroupExtendedTypesFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceShaderSubgroupExtendedTypesFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceShaderSubgroupExtendedTypesFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceShaderSubgroupExtendedTypesFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceShaderSubgroupExtendedTypesFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceShaderSubgroupExtendedTypesFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceShaderSubgroupExtendedTypesFeatures) AsCPtr() *PhysicalDeviceShaderSubgroupExtendedTypesFeatures {
+	clone := (*PhysicalDeviceShaderSubgroupExtendedTypesFeatures)(newCBlock(cULong(SizeofPhysicalDeviceShaderSubgroupExtendedTypesFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceShaderSubgroupExtendedTypesFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceShaderSubgroupExtendedTypesFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceShaderSubgroupExtendedTypesFeatures) []PhysicalDeviceShaderSubgroupExtendedTypesFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceShaderSubgroupExtendedTypesFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceShaderSubgroupExtendedTypesFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceShaderSubgroupExtendedTypesFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceShaderSubgroupExtendedTypesFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceShaderSubgroupExtendedTypesFeaturesFreeCSlice(x []PhysicalDeviceShaderSubgroupExtendedTypesFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceShaderSubgroupExtendedTypesFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceShaderSubgroupExtendedTypesFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceShaderSubgroupExtendedTypesFeaturesMakeCSlice(x ...PhysicalDeviceShaderSubgroupExtendedTypesFeatures) []PhysicalDeviceShaderSubgroupExtendedTypesFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceShaderSubgroupExtendedTypesFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceShaderSubgroupExtendedTypesFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures
+func (x PhysicalDeviceShaderSubgroupExtendedTypesFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceShaderSubgroupExtendedTypesFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceShaderSubgroupExtendedTypesFeatures) WithDefaultSType() PhysicalDeviceShaderSubgroupExtendedTypesFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_EXTENDED_TYPES_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceShaderSubgroupExtendedTypesFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_EXTENDED_TYPES_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceShaderSubgroupExtendedTypesFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderSubgroupExtendedTypesFeatures) WithSType(y StructureType) PhysicalDeviceShaderSubgroupExtendedTypesFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderSubgroupExtendedTypesFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures
+func (x PhysicalDeviceShaderSubgroupExtendedTypesFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceShaderSubgroupExtendedTypesFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderSubgroupExtendedTypesFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceShaderSubgroupExtendedTypesFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderSubgroupExtendedTypesFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceShaderSubgroupExtendedTypesFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ShaderSubgroupExtendedTypes returns the value of shaderSubgroupExtendedTypes from VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures
+func (x PhysicalDeviceShaderSubgroupExtendedTypesFeatures) ShaderSubgroupExtendedTypes() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderSubgroupExtendedTypes)
+	return *ptr
+}
+
+// WithShaderSubgroupExtendedTypes clones a new PhysicalDeviceShaderSubgroupExtendedTypesFeatures with the value of
+// ShaderSubgroupExtendedTypes updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderSubgroupExtendedTypesFeatures) WithShaderSubgroupExtendedTypes(y Bool32) PhysicalDeviceShaderSubgroupExtendedTypesFeatures {
+	x.shaderSubgroupExtendedTypes = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderSubgroupExtendedTypesFeatures) SetShaderSubgroupExtendedTypes(y Bool32) {
+	x.shaderSubgroupExtendedTypes = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PhysicalDevice8BitStorageFeatures provides a go interface for VkPhysicalDevice8BitStorageFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDevice8BitStorageFeatures.html
+type PhysicalDevice8BitStorageFeatures C.struct_VkPhysicalDevice8BitStorageFeatures
+
+// SizeofPhysicalDevice8BitStorageFeatures is the memory size of a PhysicalDevice8BitStorageFeatures
+var SizeofPhysicalDevice8BitStorageFeatures int = int(unsafe.Sizeof(PhysicalDevice8BitStorageFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDevice8BitStorageFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDevice8BitStorageFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDevice8BitStorageFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDevice8BitStorageFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDevice8BitStorageFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDevice8BitStorageFeatures) AsCPtr() *PhysicalDevice8BitStorageFeatures {
+	clone := (*PhysicalDevice8BitStorageFeatures)(newCBlock(cULong(SizeofPhysicalDevice8BitStorageFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDevice8BitStorageFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDevice8BitStorageFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDevice8BitStorageFeatures) []PhysicalDevice8BitStorageFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDevice8BitStorageFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDevice8BitStorageFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDevice8BitStorageFeaturesFreeCSlice releases the memory allocated by PhysicalDevice8BitStorageFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDevice8BitStorageFeaturesFreeCSlice(x []PhysicalDevice8BitStorageFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDevice8BitStorageFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDevice8BitStorageFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDevice8BitStorageFeaturesMakeCSlice(x ...PhysicalDevice8BitStorageFeatures) []PhysicalDevice8BitStorageFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDevice8BitStorageFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDevice8BitStorageFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDevice8BitStorageFeatures
+func (x PhysicalDevice8BitStorageFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDevice8BitStorageFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDevice8BitStorageFeatures) WithDefaultSType() PhysicalDevice8BitStorageFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDevice8BitStorageFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES)
+}
+
+// WithSType clones a new PhysicalDevice8BitStorageFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevice8BitStorageFeatures) WithSType(y StructureType) PhysicalDevice8BitStorageFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDevice8BitStorageFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDevice8BitStorageFeatures
+func (x PhysicalDevice8BitStorageFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDevice8BitStorageFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevice8BitStorageFeatures) WithPNext(y unsafe.Pointer) PhysicalDevice8BitStorageFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDevice8BitStorageFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDevice8BitStorageFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// StorageBuffer8BitAccess returns the value of storageBuffer8BitAccess from VkPhysicalDevice8BitStorageFeatures
+func (x PhysicalDevice8BitStorageFeatures) StorageBuffer8BitAccess() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.storageBuffer8BitAccess)
+	return *ptr
+}
+
+// WithStorageBuffer8BitAccess clones a new PhysicalDevice8BitStorageFeatures with the value of
+// StorageBuffer8BitAccess updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevice8BitStorageFeatures) WithStorageBuffer8BitAccess(y Bool32) PhysicalDevice8BitStorageFeatures {
+	x.storageBuffer8BitAccess = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevice8BitStorageFeatures) SetStorageBuffer8BitAccess(y Bool32) {
+	x.storageBuffer8BitAccess = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// UniformAndStorageBuffer8BitAccess returns the value of uniformAndStorageBuffer8BitAccess from VkPhysicalDevice8BitStorageFeatures
+func (x PhysicalDevice8BitStorageFeatures) UniformAndStorageBuffer8BitAccess() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.uniformAndStorageBuffer8BitAccess)
+	return *ptr
+}
+
+// WithUniformAndStorageBuffer8BitAccess clones a new PhysicalDevice8BitStorageFeatures with the value of
+// UniformAndStorageBuffer8BitAccess updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevice8BitStorageFeatures) WithUniformAndStorageBuffer8BitAccess(y Bool32) PhysicalDevice8BitStorageFeatures {
+	x.uniformAndStorageBuffer8BitAccess = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevice8BitStorageFeatures) SetUniformAndStorageBuffer8BitAccess(y Bool32) {
+	x.uniformAndStorageBuffer8BitAccess = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// StoragePushConstant8 returns the value of storagePushConstant8 from VkPhysicalDevice8BitStorageFeatures
+func (x PhysicalDevice8BitStorageFeatures) StoragePushConstant8() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.storagePushConstant8)
+	return *ptr
+}
+
+// WithStoragePushConstant8 clones a new PhysicalDevice8BitStorageFeatures with the value of
+// StoragePushConstant8 updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevice8BitStorageFeatures) WithStoragePushConstant8(y Bool32) PhysicalDevice8BitStorageFeatures {
+	x.storagePushConstant8 = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevice8BitStorageFeatures) SetStoragePushConstant8(y Bool32) {
+	x.storagePushConstant8 = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PhysicalDeviceUniformBufferStandardLayoutFeatures provides a go interface for VkPhysicalDeviceUniformBufferStandardLayoutFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceUniformBufferStandardLayoutFeatures.html
+type PhysicalDeviceUniformBufferStandardLayoutFeatures C.struct_VkPhysicalDeviceUniformBufferStandardLayoutFeatures
+
+// SizeofPhysicalDeviceUniformBufferStandardLayoutFeatures is the memory size of a PhysicalDeviceUniformBufferStandardLayoutFeatures
+var SizeofPhysicalDeviceUniformBufferStandardLayoutFeatures int = int(unsafe.Sizeof(PhysicalDeviceUniformBufferStandardLayoutFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceUniformBufferStandardLayoutFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceUniformBufferStandardLayoutFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceUniformBufferStandardLayoutFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceUniformBufferStandardLayoutFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceUniformBufferStandardLayoutFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceUniformBufferStandardLayoutFeatures) AsCPtr() *PhysicalDeviceUniformBufferStandardLayoutFeatures {
+	clone := (*PhysicalDeviceUniformBufferStandardLayoutFeatures)(newCBlock(cULong(SizeofPhysicalDeviceUniformBufferStandardLayoutFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceUniformBufferStandardLayoutFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceUniformBufferStandardLayoutFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceUniformBufferStandardLayoutFeatures) []PhysicalDeviceUniformBufferStandardLayoutFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceUniformBufferStandardLayoutFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceUniformBufferStandardLayoutFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceUniformBufferStandardLayoutFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceUniformBufferStandardLayoutFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceUniformBufferStandardLayoutFeaturesFreeCSlice(x []PhysicalDeviceUniformBufferStandardLayoutFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceUniformBufferStandardLayoutFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceUniformBufferStandardLayoutFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceUniformBufferStandardLayoutFeaturesMakeCSlice(x ...PhysicalDeviceUniformBufferStandardLayoutFeatures) []PhysicalDeviceUniformBufferStandardLayoutFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceUniformBufferStandardLayoutFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceUniformBufferStandardLayoutFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceUniformBufferStandardLayoutFeatures
+func (x PhysicalDeviceUniformBufferStandardLayoutFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceUniformBufferStandardLayoutFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceUniformBufferStandardLayoutFeatures) WithDefaultSType() PhysicalDeviceUniformBufferStandardLayoutFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFORM_BUFFER_STANDARD_LAYOUT_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceUniformBufferStandardLayoutFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFORM_BUFFER_STANDARD_LAYOUT_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceUniformBufferStandardLayoutFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceUniformBufferStandardLayoutFeatures) WithSType(y StructureType) PhysicalDeviceUniformBufferStandardLayoutFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceUniformBufferStandardLayoutFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceUniformBufferStandardLayoutFeatures
+func (x PhysicalDeviceUniformBufferStandardLayoutFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceUniformBufferStandardLayoutFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceUniformBufferStandardLayoutFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceUniformBufferStandardLayoutFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceUniformBufferStandardLayoutFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceUniformBufferStandardLayoutFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// UniformBufferStandardLayout returns the value of uniformBufferStandardLayout from VkPhysicalDeviceUniformBufferStandardLayoutFeatures
+func (x PhysicalDeviceUniformBufferStandardLayoutFeatures) UniformBufferStandardLayout() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.uniformBufferStandardLayout)
+	return *ptr
+}
+
+// WithUniformBufferStandardLayout clones a new PhysicalDeviceUniformBufferStandardLayoutFeatures with the value of
+// UniformBufferStandardLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceUniformBufferStandardLayoutFeatures) WithUniformBufferStandardLayout(y Bool32) PhysicalDeviceUniformBufferStandardLayoutFeatures {
+	x.uniformBufferStandardLayout = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceUniformBufferStandardLayoutFeatures) SetUniformBufferStandardLayout(y Bool32) {
+	x.uniformBufferStandardLayout = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// BufferDeviceAddressInfo provides a go interface for VkBufferDeviceAddressInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkBufferDeviceAddressInfo.html
+type BufferDeviceAddressInfo C.struct_VkBufferDeviceAddressInfo
+
+// SizeofBufferDeviceAddressInfo is the memory size of a BufferDeviceAddressInfo
+var SizeofBufferDeviceAddressInfo int = int(unsafe.Sizeof(BufferDeviceAddressInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x BufferDeviceAddressInfo) ArpPtr(arp *AutoReleasePool) *BufferDeviceAddressInfo {
+	ptr := newCBlock(cULong(SizeofBufferDeviceAddressInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*BufferDeviceAddressInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *BufferDeviceAddressInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x BufferDeviceAddressInfo) AsCPtr() *BufferDeviceAddressInfo {
+	clone := (*BufferDeviceAddressInfo)(newCBlock(cULong(SizeofBufferDeviceAddressInfo)))
+	*clone = x
+	return clone
+}
+
+// BufferDeviceAddressInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func BufferDeviceAddressInfoCSlice(arp *AutoReleasePool, x ...BufferDeviceAddressInfo) []BufferDeviceAddressInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBufferDeviceAddressInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*BufferDeviceAddressInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// BufferDeviceAddressInfoFreeCSlice releases the memory allocated by BufferDeviceAddressInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func BufferDeviceAddressInfoFreeCSlice(x []BufferDeviceAddressInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// BufferDeviceAddressInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. BufferDeviceAddressInfoFreeCSlice must be called on the returned slice.
+func BufferDeviceAddressInfoMakeCSlice(x ...BufferDeviceAddressInfo) []BufferDeviceAddressInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBufferDeviceAddressInfo * len(x)
+	dst := unsafe.Slice((*BufferDeviceAddressInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkBufferDeviceAddressInfo
+func (x BufferDeviceAddressInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new BufferDeviceAddressInfo with the value of
+// SType to the value provided in the specification.
+func (x BufferDeviceAddressInfo) WithDefaultSType() BufferDeviceAddressInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *BufferDeviceAddressInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_INFO)
+}
+
+// WithSType clones a new BufferDeviceAddressInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferDeviceAddressInfo) WithSType(y StructureType) BufferDeviceAddressInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *BufferDeviceAddressInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkBufferDeviceAddressInfo
+func (x BufferDeviceAddressInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new BufferDeviceAddressInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferDeviceAddressInfo) WithPNext(y unsafe.Pointer) BufferDeviceAddressInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *BufferDeviceAddressInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *BufferDeviceAddressInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Buffer returns the value of buffer from VkBufferDeviceAddressInfo
+func (x BufferDeviceAddressInfo) Buffer() Buffer {
+	ptr := /* handle */ (*Buffer)(&x.buffer)
+	return *ptr
+}
+
+// WithBuffer clones a new BufferDeviceAddressInfo with the value of
+// Buffer updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferDeviceAddressInfo) WithBuffer(y Buffer) BufferDeviceAddressInfo {
+	x.buffer = *( /* handle */ (*C.VkBuffer)(&y))
+	return x
+}
+func (x *BufferDeviceAddressInfo) SetBuffer(y Buffer) {
+	x.buffer = *( /* handle */ (*C.VkBuffer)(&y))
+}
+
+// SemaphoreWaitInfo provides a go interface for VkSemaphoreWaitInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSemaphoreWaitInfo.html
+type SemaphoreWaitInfo C.struct_VkSemaphoreWaitInfo
+
+// SizeofSemaphoreWaitInfo is the memory size of a SemaphoreWaitInfo
+var SizeofSemaphoreWaitInfo int = int(unsafe.Sizeof(SemaphoreWaitInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SemaphoreWaitInfo) ArpPtr(arp *AutoReleasePool) *SemaphoreWaitInfo {
+	ptr := newCBlock(cULong(SizeofSemaphoreWaitInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SemaphoreWaitInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SemaphoreWaitInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SemaphoreWaitInfo) AsCPtr() *SemaphoreWaitInfo {
+	clone := (*SemaphoreWaitInfo)(newCBlock(cULong(SizeofSemaphoreWaitInfo)))
+	*clone = x
+	return clone
+}
+
+// SemaphoreWaitInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SemaphoreWaitInfoCSlice(arp *AutoReleasePool, x ...SemaphoreWaitInfo) []SemaphoreWaitInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSemaphoreWaitInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SemaphoreWaitInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SemaphoreWaitInfoFreeCSlice releases the memory allocated by SemaphoreWaitInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func SemaphoreWaitInfoFreeCSlice(x []SemaphoreWaitInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SemaphoreWaitInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SemaphoreWaitInfoFreeCSlice must be called on the returned slice.
+func SemaphoreWaitInfoMakeCSlice(x ...SemaphoreWaitInfo) []SemaphoreWaitInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSemaphoreWaitInfo * len(x)
+	dst := unsafe.Slice((*SemaphoreWaitInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkSemaphoreWaitInfo
+func (x SemaphoreWaitInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new SemaphoreWaitInfo with the value of
+// SType to the value provided in the specification.
+func (x SemaphoreWaitInfo) WithDefaultSType() SemaphoreWaitInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *SemaphoreWaitInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO)
+}
+
+// WithSType clones a new SemaphoreWaitInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SemaphoreWaitInfo) WithSType(y StructureType) SemaphoreWaitInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *SemaphoreWaitInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkSemaphoreWaitInfo
+func (x SemaphoreWaitInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new SemaphoreWaitInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SemaphoreWaitInfo) WithPNext(y unsafe.Pointer) SemaphoreWaitInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *SemaphoreWaitInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SemaphoreWaitInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Flags returns the value of flags from VkSemaphoreWaitInfo
+func (x SemaphoreWaitInfo) Flags() SemaphoreWaitFlags {
+	ptr := /* typedef */ (*SemaphoreWaitFlags)(&x.flags)
+	return *ptr
+}
+
+// WithFlags clones a new SemaphoreWaitInfo with the value of
+// Flags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SemaphoreWaitInfo) WithFlags(y SemaphoreWaitFlags) SemaphoreWaitInfo {
+	x.flags = *( /* typedef */ (*C.VkSemaphoreWaitFlags)(&y))
+	return x
+}
+func (x *SemaphoreWaitInfo) SetFlags(y SemaphoreWaitFlags) {
+	x.flags = *( /* typedef */ (*C.VkSemaphoreWaitFlags)(&y))
+}
+
+// SemaphoreCount returns the value of semaphoreCount from VkSemaphoreWaitInfo
+func (x SemaphoreWaitInfo) SemaphoreCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.semaphoreCount)
+	return *ptr
+}
+
+// WithSemaphoreCount clones a new SemaphoreWaitInfo with the value of
+// SemaphoreCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SemaphoreWaitInfo) WithSemaphoreCount(y uint32) SemaphoreWaitInfo {
+	x.semaphoreCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *SemaphoreWaitInfo) SetSemaphoreCount(y uint32) {
+	x.semaphoreCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PSemaphores returns the value of pSemaphores from VkSemaphoreWaitInfo
+func (x SemaphoreWaitInfo) PSemaphores() []Semaphore {
+	if x.pSemaphores == nil {
+		return nil
+	}
+	return unsafe.Slice((*Semaphore)(unsafe.Pointer(x.pSemaphores)), x.semaphoreCount)
+}
+
+// WithPSemaphores clones a new SemaphoreWaitInfo with the value of
+// PSemaphores updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines SemaphoreCount as the length of this field.
+// SemaphoreCount is updated with the length of the new value.
+func (x SemaphoreWaitInfo) WithPSemaphores(y []Semaphore) SemaphoreWaitInfo {
+	x.pSemaphores = *(func(x *[]Semaphore) **C.VkSemaphore { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkSemaphore)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkSemaphore)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithSemaphoreCount(uint32(len(y)))
+}
+func (x *SemaphoreWaitInfo) SetPSemaphores(y []Semaphore) {
+	x.pSemaphores = *(func(x *[]Semaphore) **C.VkSemaphore { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkSemaphore)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkSemaphore)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetSemaphoreCount(uint32(len(y)))
+}
+
+// PinPSemaphores pins the Go memory referenced by y with the AutoReleasePool
+// and sets PSemaphores, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SemaphoreWaitInfo) PinPSemaphores(arp *AutoReleasePool, y []Semaphore) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPSemaphores(y)
+}
+
+// PValues returns the value of pValues from VkSemaphoreWaitInfo
+func (x SemaphoreWaitInfo) PValues() []uint64 {
+	if x.pValues == nil {
+		return nil
+	}
+	return unsafe.Slice((*uint64)(unsafe.Pointer(x.pValues)), x.semaphoreCount)
+}
+
+// WithPValues clones a new SemaphoreWaitInfo with the value of
+// PValues updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines SemaphoreCount as the length of this field.
+// SemaphoreCount is updated with the length of the new value.
+func (x SemaphoreWaitInfo) WithPValues(y []uint64) SemaphoreWaitInfo {
+	x.pValues = *(func(x *[]uint64) **C.uint64_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint64_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint64_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithSemaphoreCount(uint32(len(y)))
+}
+func (x *SemaphoreWaitInfo) SetPValues(y []uint64) {
+	x.pValues = *(func(x *[]uint64) **C.uint64_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint64_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint64_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetSemaphoreCount(uint32(len(y)))
+}
+
+// PinPValues pins the Go memory referenced by y with the AutoReleasePool
+// and sets PValues, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SemaphoreWaitInfo) PinPValues(arp *AutoReleasePool, y []uint64) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPValues(y)
+}
+
+// RenderPassAttachmentBeginInfo provides a go interface for VkRenderPassAttachmentBeginInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkRenderPassAttachmentBeginInfo.html
+type RenderPassAttachmentBeginInfo C.struct_VkRenderPassAttachmentBeginInfo
+
+// SizeofRenderPassAttachmentBeginInfo is the memory size of a RenderPassAttachmentBeginInfo
+var SizeofRenderPassAttachmentBeginInfo int = int(unsafe.Sizeof(RenderPassAttachmentBeginInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x RenderPassAttachmentBeginInfo) ArpPtr(arp *AutoReleasePool) *RenderPassAttachmentBeginInfo {
+	ptr := newCBlock(cULong(SizeofRenderPassAttachmentBeginInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*RenderPassAttachmentBeginInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *RenderPassAttachmentBeginInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x RenderPassAttachmentBeginInfo) AsCPtr() *RenderPassAttachmentBeginInfo {
+	clone := (*RenderPassAttachmentBeginInfo)(newCBlock(cULong(SizeofRenderPassAttachmentBeginInfo)))
+	*clone = x
+	return clone
+}
+
+// RenderPassAttachmentBeginInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func RenderPassAttachmentBeginInfoCSlice(arp *AutoReleasePool, x ...RenderPassAttachmentBeginInfo) []RenderPassAttachmentBeginInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofRenderPassAttachmentBeginInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*RenderPassAttachmentBeginInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// RenderPassAttachmentBeginInfoFreeCSlice releases the memory allocated by RenderPassAttachmentBeginInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func RenderPassAttachmentBeginInfoFreeCSlice(x []RenderPassAttachmentBeginInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// RenderPassAttachmentBeginInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. RenderPassAttachmentBeginInfoFreeCSlice must be called on the returned slice.
+func RenderPassAttachmentBeginInfoMakeCSlice(x ...RenderPassAttachmentBeginInfo) []RenderPassAttachmentBeginInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofRenderPassAttachmentBeginInfo * len(x)
+	dst := unsafe.Slice((*RenderPassAttachmentBeginInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkRenderPassAttachmentBeginInfo
+func (x RenderPassAttachmentBeginInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new RenderPassAttachmentBeginInfo with the value of
+// SType to the value provided in the specification.
+func (x RenderPassAttachmentBeginInfo) WithDefaultSType() RenderPassAttachmentBeginInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *RenderPassAttachmentBeginInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO)
+}
+
+// WithSType clones a new RenderPassAttachmentBeginInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderPassAttachmentBeginInfo) WithSType(y StructureType) RenderPassAttachmentBeginInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *RenderPassAttachmentBeginInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkRenderPassAttachmentBeginInfo
+func (x RenderPassAttachmentBeginInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new RenderPassAttachmentBeginInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderPassAttachmentBeginInfo) WithPNext(y unsafe.Pointer) RenderPassAttachmentBeginInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *RenderPassAttachmentBeginInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *RenderPassAttachmentBeginInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// AttachmentCount returns the value of attachmentCount from VkRenderPassAttachmentBeginInfo
+func (x RenderPassAttachmentBeginInfo) AttachmentCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.attachmentCount)
+	return *ptr
+}
+
+// WithAttachmentCount clones a new RenderPassAttachmentBeginInfo with the value of
+// AttachmentCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderPassAttachmentBeginInfo) WithAttachmentCount(y uint32) RenderPassAttachmentBeginInfo {
+	x.attachmentCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *RenderPassAttachmentBeginInfo) SetAttachmentCount(y uint32) {
+	x.attachmentCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PAttachments returns the value of pAttachments from VkRenderPassAttachmentBeginInfo
+func (x RenderPassAttachmentBeginInfo) PAttachments() []ImageView {
+	if x.pAttachments == nil {
+		return nil
+	}
+	return unsafe.Slice((*ImageView)(unsafe.Pointer(x.pAttachments)), x.attachmentCount)
+}
+
+// WithPAttachments clones a new RenderPassAttachmentBeginInfo with the value of
+// PAttachments updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines AttachmentCount as the length of this field.
+// AttachmentCount is updated with the length of the new value.
+func (x RenderPassAttachmentBeginInfo) WithPAttachments(y []ImageView) RenderPassAttachmentBeginInfo {
+	x.pAttachments = *(func(x *[]ImageView) **C.VkImageView { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkImageView)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkImageView)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithAttachmentCount(uint32(len(y)))
+}
+func (x *RenderPassAttachmentBeginInfo) SetPAttachments(y []ImageView) {
+	x.pAttachments = *(func(x *[]ImageView) **C.VkImageView { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkImageView)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkImageView)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetAttachmentCount(uint32(len(y)))
+}
+
+// PinPAttachments pins the Go memory referenced by y with the AutoReleasePool
+// and sets PAttachments, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *RenderPassAttachmentBeginInfo) PinPAttachments(arp *AutoReleasePool, y []ImageView) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPAttachments(y)
+}
+
+// FramebufferAttachmentImageInfo provides a go interface for VkFramebufferAttachmentImageInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkFramebufferAttachmentImageInfo.html
+type FramebufferAttachmentImageInfo C.struct_VkFramebufferAttachmentImageInfo
+
+// SizeofFramebufferAttachmentImageInfo is the memory size of a FramebufferAttachmentImageInfo
+var SizeofFramebufferAttachmentImageInfo int = int(unsafe.Sizeof(FramebufferAttachmentImageInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x FramebufferAttachmentImageInfo) ArpPtr(arp *AutoReleasePool) *FramebufferAttachmentImageInfo {
+	ptr := newCBlock(cULong(SizeofFramebufferAttachmentImageInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*FramebufferAttachmentImageInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *FramebufferAttachmentImageInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x FramebufferAttachmentImageInfo) AsCPtr() *FramebufferAttachmentImageInfo {
+	clone := (*FramebufferAttachmentImageInfo)(newCBlock(cULong(SizeofFramebufferAttachmentImageInfo)))
+	*clone = x
+	return clone
+}
+
+// FramebufferAttachmentImageInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func FramebufferAttachmentImageInfoCSlice(arp *AutoReleasePool, x ...FramebufferAttachmentImageInfo) []FramebufferAttachmentImageInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofFramebufferAttachmentImageInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*FramebufferAttachmentImageInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// FramebufferAttachmentImageInfoFreeCSlice releases the memory allocated by FramebufferAttachmentImageInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func FramebufferAttachmentImageInfoFreeCSlice(x []FramebufferAttachmentImageInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// FramebufferAttachmentImageInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. FramebufferAttachmentImageInfoFreeCSlice must be called on the returned slice.
+func FramebufferAttachmentImageInfoMakeCSlice(x ...FramebufferAttachmentImageInfo) []FramebufferAttachmentImageInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofFramebufferAttachmentImageInfo * len(x)
+	dst := unsafe.Slice((*FramebufferAttachmentImageInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkFramebufferAttachmentImageInfo
+func (x FramebufferAttachmentImageInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new FramebufferAttachmentImageInfo with the value of
+// SType to the value provided in the specification.
+func (x FramebufferAttachmentImageInfo) WithDefaultSType() FramebufferAttachmentImageInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENT_IMAGE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *FramebufferAttachmentImageInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENT_IMAGE_INFO)
+}
+
+// WithSType clones a new FramebufferAttachmentImageInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x FramebufferAttachmentImageInfo) WithSType(y StructureType) FramebufferAttachmentImageInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *FramebufferAttachmentImageInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkFramebufferAttachmentImageInfo
+func (x FramebufferAttachmentImageInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new FramebufferAttachmentImageInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x FramebufferAttachmentImageInfo) WithPNext(y unsafe.Pointer) FramebufferAttachmentImageInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *FramebufferAttachmentImageInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *FramebufferAttachmentImageInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Flags returns the value of flags from VkFramebufferAttachmentImageInfo
+func (x FramebufferAttachmentImageInfo) Flags() ImageCreateFlags {
+	ptr := /* typedef */ (*ImageCreateFlags)(&x.flags)
+	return *ptr
+}
+
+// WithFlags clones a new FramebufferAttachmentImageInfo with the value of
+// Flags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x FramebufferAttachmentImageInfo) WithFlags(y ImageCreateFlags) FramebufferAttachmentImageInfo {
+	x.flags = *( /* typedef */ (*C.VkImageCreateFlags)(&y))
+	return x
+}
+func (x *FramebufferAttachmentImageInfo) SetFlags(y ImageCreateFlags) {
+	x.flags = *( /* typedef */ (*C.VkImageCreateFlags)(&y))
+}
+
+// Usage returns the value of usage from VkFramebufferAttachmentImageInfo
+func (x FramebufferAttachmentImageInfo) Usage() ImageUsageFlags {
+	ptr := /* typedef */ (*ImageUsageFlags)(&x.usage)
+	return *ptr
+}
+
+// WithUsage clones a new FramebufferAttachmentImageInfo with the value of
+// Usage updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x FramebufferAttachmentImageInfo) WithUsage(y ImageUsageFlags) FramebufferAttachmentImageInfo {
+	x.usage = *( /* typedef */ (*C.VkImageUsageFlags)(&y))
+	return x
+}
+func (x *FramebufferAttachmentImageInfo) SetUsage(y ImageUsageFlags) {
+	x.usage = *( /* typedef */ (*C.VkImageUsageFlags)(&y))
+}
+
+// Width returns the value of width from VkFramebufferAttachmentImageInfo
+func (x FramebufferAttachmentImageInfo) Width() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.width)
+	return *ptr
+}
+
+// WithWidth clones a new FramebufferAttachmentImageInfo with the value of
+// Width updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x FramebufferAttachmentImageInfo) WithWidth(y uint32) FramebufferAttachmentImageInfo {
+	x.width = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *FramebufferAttachmentImageInfo) SetWidth(y uint32) {
+	x.width = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// Height returns the value of height from VkFramebufferAttachmentImageInfo
+func (x FramebufferAttachmentImageInfo) Height() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.height)
+	return *ptr
+}
+
+// WithHeight clones a new FramebufferAttachmentImageInfo with the value of
+// Height updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x FramebufferAttachmentImageInfo) WithHeight(y uint32) FramebufferAttachmentImageInfo {
+	x.height = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *FramebufferAttachmentImageInfo) SetHeight(y uint32) {
+	x.height = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// LayerCount returns the value of layerCount from VkFramebufferAttachmentImageInfo
+func (x FramebufferAttachmentImageInfo) LayerCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.layerCount)
+	return *ptr
+}
+
+// WithLayerCount clones a new FramebufferAttachmentImageInfo with the value of
+// LayerCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x FramebufferAttachmentImageInfo) WithLayerCount(y uint32) FramebufferAttachmentImageInfo {
+	x.layerCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *FramebufferAttachmentImageInfo) SetLayerCount(y uint32) {
+	x.layerCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// ViewFormatCount returns the value of viewFormatCount from VkFramebufferAttachmentImageInfo
+func (x FramebufferAttachmentImageInfo) ViewFormatCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.viewFormatCount)
+	return *ptr
+}
+
+// WithViewFormatCount clones a new FramebufferAttachmentImageInfo with the value of
+// ViewFormatCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x FramebufferAttachmentImageInfo) WithViewFormatCount(y uint32) FramebufferAttachmentImageInfo {
+	x.viewFormatCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *FramebufferAttachmentImageInfo) SetViewFormatCount(y uint32) {
+	x.viewFormatCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PViewFormats returns the value of pViewFormats from VkFramebufferAttachmentImageInfo
+func (x FramebufferAttachmentImageInfo) PViewFormats() []Format {
+	if x.pViewFormats == nil {
+		return nil
+	}
+	return unsafe.Slice((*Format)(unsafe.Pointer(x.pViewFormats)), x.viewFormatCount)
+}
+
+// WithPViewFormats clones a new FramebufferAttachmentImageInfo with the value of
+// PViewFormats updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines ViewFormatCount as the length of this field.
+// ViewFormatCount is updated with the length of the new value.
+func (x FramebufferAttachmentImageInfo) WithPViewFormats(y []Format) FramebufferAttachmentImageInfo {
+	x.pViewFormats = *(func(x *[]Format) **C.VkFormat { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkFormat)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkFormat)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithViewFormatCount(uint32(len(y)))
+}
+func (x *FramebufferAttachmentImageInfo) SetPViewFormats(y []Format) {
+	x.pViewFormats = *(func(x *[]Format) **C.VkFormat { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkFormat)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkFormat)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetViewFormatCount(uint32(len(y)))
+}
+
+// PinPViewFormats pins the Go memory referenced by y with the AutoReleasePool
+// and sets PViewFormats, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *FramebufferAttachmentImageInfo) PinPViewFormats(arp *AutoReleasePool, y []Format) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPViewFormats(y)
+}
+
+// FramebufferAttachmentsCreateInfo provides a go interface for VkFramebufferAttachmentsCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkFramebufferAttachmentsCreateInfo.html
+type FramebufferAttachmentsCreateInfo C.struct_VkFramebufferAttachmentsCreateInfo
+
+// SizeofFramebufferAttachmentsCreateInfo is the memory size of a FramebufferAttachmentsCreateInfo
+var SizeofFramebufferAttachmentsCreateInfo int = int(unsafe.Sizeof(FramebufferAttachmentsCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x FramebufferAttachmentsCreateInfo) ArpPtr(arp *AutoReleasePool) *FramebufferAttachmentsCreateInfo {
+	ptr := newCBlock(cULong(SizeofFramebufferAttachmentsCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*FramebufferAttachmentsCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *FramebufferAttachmentsCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x FramebufferAttachmentsCreateInfo) AsCPtr() *FramebufferAttachmentsCreateInfo {
+	clone := (*FramebufferAttachmentsCreateInfo)(newCBlock(cULong(SizeofFramebufferAttachmentsCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// FramebufferAttachmentsCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func FramebufferAttachmentsCreateInfoCSlice(arp *AutoReleasePool, x ...FramebufferAttachmentsCreateInfo) []FramebufferAttachmentsCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofFramebufferAttachmentsCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*FramebufferAttachmentsCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// FramebufferAttachmentsCreateInfoFreeCSlice releases the memory allocated by FramebufferAttachmentsCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func FramebufferAttachmentsCreateInfoFreeCSlice(x []FramebufferAttachmentsCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// FramebufferAttachmentsCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. FramebufferAttachmentsCreateInfoFreeCSlice must be called on the returned slice.
+func FramebufferAttachmentsCreateInfoMakeCSlice(x ...FramebufferAttachmentsCreateInfo) []FramebufferAttachmentsCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofFramebufferAttachmentsCreateInfo * len(x)
+	dst := unsafe.Slice((*FramebufferAttachmentsCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkFramebufferAttachmentsCreateInfo
+func (x FramebufferAttachmentsCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new FramebufferAttachmentsCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x FramebufferAttachmentsCreateInfo) WithDefaultSType() FramebufferAttachmentsCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *FramebufferAttachmentsCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO)
+}
+
+// WithSType clones a new FramebufferAttachmentsCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x FramebufferAttachmentsCreateInfo) WithSType(y StructureType) FramebufferAttachmentsCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *FramebufferAttachmentsCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkFramebufferAttachmentsCreateInfo
+func (x FramebufferAttachmentsCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new FramebufferAttachmentsCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x FramebufferAttachmentsCreateInfo) WithPNext(y unsafe.Pointer) FramebufferAttachmentsCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *FramebufferAttachmentsCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *FramebufferAttachmentsCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// AttachmentImageInfoCount returns the value of attachmentImageInfoCount from VkFramebufferAttachmentsCreateInfo
+func (x FramebufferAttachmentsCreateInfo) AttachmentImageInfoCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.attachmentImageInfoCount)
+	return *ptr
+}
+
+// WithAttachmentImageInfoCount clones a new FramebufferAttachmentsCreateInfo with the value of
+// AttachmentImageInfoCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x FramebufferAttachmentsCreateInfo) WithAttachmentImageInfoCount(y uint32) FramebufferAttachmentsCreateInfo {
+	x.attachmentImageInfoCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *FramebufferAttachmentsCreateInfo) SetAttachmentImageInfoCount(y uint32) {
+	x.attachmentImageInfoCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PAttachmentImageInfos returns the value of pAttachmentImageInfos from VkFramebufferAttachmentsCreateInfo
+func (x FramebufferAttachmentsCreateInfo) PAttachmentImageInfos() []FramebufferAttachmentImageInfo {
+	if x.pAttachmentImageInfos == nil {
+		return nil
+	}
+	return unsafe.Slice((*FramebufferAttachmentImageInfo)(unsafe.Pointer(x.pAttachmentImageInfos)), x.attachmentImageInfoCount)
+}
+
+// WithPAttachmentImageInfos clones a new FramebufferAttachmentsCreateInfo with the value of
+// PAttachmentImageInfos updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines AttachmentImageInfoCount as the length of this field.
+// AttachmentImageInfoCount is updated with the length of the new value.
+func (x FramebufferAttachmentsCreateInfo) WithPAttachmentImageInfos(y []FramebufferAttachmentImageInfo) FramebufferAttachmentsCreateInfo {
+	x.pAttachmentImageInfos = *(func(x *[]FramebufferAttachmentImageInfo) **C.struct_VkFramebufferAttachmentImageInfo { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkFramebufferAttachmentImageInfo)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkFramebufferAttachmentImageInfo)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithAttachmentImageInfoCount(uint32(len(y)))
+}
+func (x *FramebufferAttachmentsCreateInfo) SetPAttachmentImageInfos(y []FramebufferAttachmentImageInfo) {
+	x.pAttachmentImageInfos = *(func(x *[]FramebufferAttachmentImageInfo) **C.struct_VkFramebufferAttachmentImageInfo { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkFramebufferAttachmentImageInfo)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkFramebufferAttachmentImageInfo)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetAttachmentImageInfoCount(uint32(len(y)))
+}
+
+// PinPAttachmentImageInfos pins the Go memory referenced by y with the AutoReleasePool
+// and sets PAttachmentImageInfos, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *FramebufferAttachmentsCreateInfo) PinPAttachmentImageInfos(arp *AutoReleasePool, y []FramebufferAttachmentImageInfo) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPAttachmentImageInfos(y)
+}
+
+// PhysicalDeviceShaderAtomicInt64Features provides a go interface for VkPhysicalDeviceShaderAtomicInt64Features.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceShaderAtomicInt64Features.html
+type PhysicalDeviceShaderAtomicInt64Features C.struct_VkPhysicalDeviceShaderAtomicInt64Features
+
+// SizeofPhysicalDeviceShaderAtomicInt64Features is the memory size of a PhysicalDeviceShaderAtomicInt64Features
+var SizeofPhysicalDeviceShaderAtomicInt64Features int = int(unsafe.Sizeof(PhysicalDeviceShaderAtomicInt64Features{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceShaderAtomicInt64Features) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceShaderAtomicInt64Features {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceShaderAtomicInt64Features))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceShaderAtomicInt64Features)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceShaderAtomicInt64Features) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceShaderAtomicInt64Features) AsCPtr() *PhysicalDeviceShaderAtomicInt64Features {
+	clone := (*PhysicalDeviceShaderAtomicInt64Features)(newCBlock(cULong(SizeofPhysicalDeviceShaderAtomicInt64Features)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceShaderAtomicInt64FeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceShaderAtomicInt64FeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceShaderAtomicInt64Features) []PhysicalDeviceShaderAtomicInt64Features {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceShaderAtomicInt64Features * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceShaderAtomicInt64Features)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceShaderAtomicInt64FeaturesFreeCSlice releases the memory allocated by PhysicalDeviceShaderAtomicInt64FeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceShaderAtomicInt64FeaturesFreeCSlice(x []PhysicalDeviceShaderAtomicInt64Features) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceShaderAtomicInt64FeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceShaderAtomicInt64FeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceShaderAtomicInt64FeaturesMakeCSlice(x ...PhysicalDeviceShaderAtomicInt64Features) []PhysicalDeviceShaderAtomicInt64Features {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceShaderAtomicInt64Features * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceShaderAtomicInt64Features)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceShaderAtomicInt64Features
+func (x PhysicalDeviceShaderAtomicInt64Features) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceShaderAtomicInt64Features with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceShaderAtomicInt64Features) WithDefaultSType() PhysicalDeviceShaderAtomicInt64Features {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_INT64_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceShaderAtomicInt64Features) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_INT64_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceShaderAtomicInt64Features with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderAtomicInt64Features) WithSType(y StructureType) PhysicalDeviceShaderAtomicInt64Features {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderAtomicInt64Features) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceShaderAtomicInt64Features
+func (x PhysicalDeviceShaderAtomicInt64Features) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceShaderAtomicInt64Features with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderAtomicInt64Features) WithPNext(y unsafe.Pointer) PhysicalDeviceShaderAtomicInt64Features {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderAtomicInt64Features) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceShaderAtomicInt64Features) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ShaderBufferInt64Atomics returns the value of shaderBufferInt64Atomics from VkPhysicalDeviceShaderAtomicInt64Features
+func (x PhysicalDeviceShaderAtomicInt64Features) ShaderBufferInt64Atomics() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderBufferInt64Atomics)
+	return *ptr
+}
+
+// WithShaderBufferInt64Atomics clones a new PhysicalDeviceShaderAtomicInt64Features with the value of
+// ShaderBufferInt64Atomics updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderAtomicInt64Features) WithShaderBufferInt64Atomics(y Bool32) PhysicalDeviceShaderAtomicInt64Features {
+	x.shaderBufferInt64Atomics = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderAtomicInt64Features) SetShaderBufferInt64Atomics(y Bool32) {
+	x.shaderBufferInt64Atomics = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderSharedInt64Atomics returns the value of shaderSharedInt64Atomics from VkPhysicalDeviceShaderAtomicInt64Features
+func (x PhysicalDeviceShaderAtomicInt64Features) ShaderSharedInt64Atomics() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderSharedInt64Atomics)
+	return *ptr
+}
+
+// WithShaderSharedInt64Atomics clones a new PhysicalDeviceShaderAtomicInt64Features with the value of
+// ShaderSharedInt64Atomics updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderAtomicInt64Features) WithShaderSharedInt64Atomics(y Bool32) PhysicalDeviceShaderAtomicInt64Features {
+	x.shaderSharedInt64Atomics = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderAtomicInt64Features) SetShaderSharedInt64Atomics(y Bool32) {
+	x.shaderSharedInt64Atomics = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PhysicalDeviceImagelessFramebufferFeatures provides a go interface for VkPhysicalDeviceImagelessFramebufferFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceImagelessFramebufferFeatures.html
+type PhysicalDeviceImagelessFramebufferFeatures C.struct_VkPhysicalDeviceImagelessFramebufferFeatures
+
+// SizeofPhysicalDeviceImagelessFramebufferFeatures is the memory size of a PhysicalDeviceImagelessFramebufferFeatures
+var SizeofPhysicalDeviceImagelessFramebufferFeatures int = int(unsafe.Sizeof(PhysicalDeviceImagelessFramebufferFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceImagelessFramebufferFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceImagelessFramebufferFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceImagelessFramebufferFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceImagelessFramebufferFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceImagelessFramebufferFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceImagelessFramebufferFeatures) AsCPtr() *PhysicalDeviceImagelessFramebufferFeatures {
+	clone := (*PhysicalDeviceImagelessFramebufferFeatures)(newCBlock(cULong(SizeofPhysicalDeviceImagelessFramebufferFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceImagelessFramebufferFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceImagelessFramebufferFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceImagelessFramebufferFeatures) []PhysicalDeviceImagelessFramebufferFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceImagelessFramebufferFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceImagelessFramebufferFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceImagelessFramebufferFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceImagelessFramebufferFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceImagelessFramebufferFeaturesFreeCSlice(x []PhysicalDeviceImagelessFramebufferFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceImagelessFramebufferFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceImagelessFramebufferFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceImagelessFramebufferFeaturesMakeCSlice(x ...PhysicalDeviceImagelessFramebufferFeatures) []PhysicalDeviceImagelessFramebufferFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceImagelessFramebufferFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceImagelessFramebufferFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceImagelessFramebufferFeatures
+func (x PhysicalDeviceImagelessFramebufferFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceImagelessFramebufferFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceImagelessFramebufferFeatures) WithDefaultSType() PhysicalDeviceImagelessFramebufferFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceImagelessFramebufferFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceImagelessFramebufferFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceImagelessFramebufferFeatures) WithSType(y StructureType) PhysicalDeviceImagelessFramebufferFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceImagelessFramebufferFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceImagelessFramebufferFeatures
+func (x PhysicalDeviceImagelessFramebufferFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceImagelessFramebufferFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceImagelessFramebufferFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceImagelessFramebufferFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceImagelessFramebufferFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceImagelessFramebufferFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ImagelessFramebuffer returns the value of imagelessFramebuffer from VkPhysicalDeviceImagelessFramebufferFeatures
+func (x PhysicalDeviceImagelessFramebufferFeatures) ImagelessFramebuffer() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.imagelessFramebuffer)
+	return *ptr
+}
+
+// WithImagelessFramebuffer clones a new PhysicalDeviceImagelessFramebufferFeatures with the value of
+// ImagelessFramebuffer updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceImagelessFramebufferFeatures) WithImagelessFramebuffer(y Bool32) PhysicalDeviceImagelessFramebufferFeatures {
+	x.imagelessFramebuffer = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceImagelessFramebufferFeatures) SetImagelessFramebuffer(y Bool32) {
+	x.imagelessFramebuffer = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PhysicalDeviceShaderFloat16Int8Features provides a go interface for VkPhysicalDeviceShaderFloat16Int8Features.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceShaderFloat16Int8Features.html
+type PhysicalDeviceShaderFloat16Int8Features C.struct_VkPhysicalDeviceShaderFloat16Int8Features
+
+// SizeofPhysicalDeviceShaderFloat16Int8Features is the memory size of a PhysicalDeviceShaderFloat16Int8Features
+var SizeofPhysicalDeviceShaderFloat16Int8Features int = int(unsafe.Sizeof(PhysicalDeviceShaderFloat16Int8Features{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceShaderFloat16Int8Features) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceShaderFloat16Int8Features {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceShaderFloat16Int8Features))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceShaderFloat16Int8Features)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceShaderFloat16Int8Features) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceShaderFloat16Int8Features) AsCPtr() *PhysicalDeviceShaderFloat16Int8Features {
+	clone := (*PhysicalDeviceShaderFloat16Int8Features)(newCBlock(cULong(SizeofPhysicalDeviceShaderFloat16Int8Features)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceShaderFloat16Int8FeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceShaderFloat16Int8FeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceShaderFloat16Int8Features) []PhysicalDeviceShaderFloat16Int8Features {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceShaderFloat16Int8Features * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceShaderFloat16Int8Features)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceShaderFloat16Int8FeaturesFreeCSlice releases the memory allocated by PhysicalDeviceShaderFloat16Int8FeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceShaderFloat16Int8FeaturesFreeCSlice(x []PhysicalDeviceShaderFloat16Int8Features) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceShaderFloat16Int8FeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceShaderFloat16Int8FeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceShaderFloat16Int8FeaturesMakeCSlice(x ...PhysicalDeviceShaderFloat16Int8Features) []PhysicalDeviceShaderFloat16Int8Features {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceShaderFloat16Int8Features * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceShaderFloat16Int8Features)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceShaderFloat16Int8Features
+func (x PhysicalDeviceShaderFloat16Int8Features) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceShaderFloat16Int8Features with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceShaderFloat16Int8Features) WithDefaultSType() PhysicalDeviceShaderFloat16Int8Features {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceShaderFloat16Int8Features) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceShaderFloat16Int8Features with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderFloat16Int8Features) WithSType(y StructureType) PhysicalDeviceShaderFloat16Int8Features {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderFloat16Int8Features) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceShaderFloat16Int8Features
+func (x PhysicalDeviceShaderFloat16Int8Features) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceShaderFloat16Int8Features with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderFloat16Int8Features) WithPNext(y unsafe.Pointer) PhysicalDeviceShaderFloat16Int8Features {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderFloat16Int8Features) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceShaderFloat16Int8Features) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ShaderFloat16 returns the value of shaderFloat16 from VkPhysicalDeviceShaderFloat16Int8Features
+func (x PhysicalDeviceShaderFloat16Int8Features) ShaderFloat16() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderFloat16)
+	return *ptr
+}
+
+// WithShaderFloat16 clones a new PhysicalDeviceShaderFloat16Int8Features with the value of
+// ShaderFloat16 updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderFloat16Int8Features) WithShaderFloat16(y Bool32) PhysicalDeviceShaderFloat16Int8Features {
+	x.shaderFloat16 = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderFloat16Int8Features) SetShaderFloat16(y Bool32) {
+	x.shaderFloat16 = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderInt8 returns the value of shaderInt8 from VkPhysicalDeviceShaderFloat16Int8Features
+func (x PhysicalDeviceShaderFloat16Int8Features) ShaderInt8() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderInt8)
+	return *ptr
+}
+
+// WithShaderInt8 clones a new PhysicalDeviceShaderFloat16Int8Features with the value of
+// ShaderInt8 updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderFloat16Int8Features) WithShaderInt8(y Bool32) PhysicalDeviceShaderFloat16Int8Features {
+	x.shaderInt8 = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderFloat16Int8Features) SetShaderInt8(y Bool32) {
+	x.shaderInt8 = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PhysicalDeviceVulkanMemoryModelFeatures provides a go interface for VkPhysicalDeviceVulkanMemoryModelFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceVulkanMemoryModelFeatures.html
+type PhysicalDeviceVulkanMemoryModelFeatures C.struct_VkPhysicalDeviceVulkanMemoryModelFeatures
+
+// SizeofPhysicalDeviceVulkanMemoryModelFeatures is the memory size of a PhysicalDeviceVulkanMemoryModelFeatures
+var SizeofPhysicalDeviceVulkanMemoryModelFeatures int = int(unsafe.Sizeof(PhysicalDeviceVulkanMemoryModelFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceVulkanMemoryModelFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceVulkanMemoryModelFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceVulkanMemoryModelFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceVulkanMemoryModelFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceVulkanMemoryModelFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceVulkanMemoryModelFeatures) AsCPtr() *PhysicalDeviceVulkanMemoryModelFeatures {
+	clone := (*PhysicalDeviceVulkanMemoryModelFeatures)(newCBlock(cULong(SizeofPhysicalDeviceVulkanMemoryModelFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceVulkanMemoryModelFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceVulkanMemoryModelFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceVulkanMemoryModelFeatures) []PhysicalDeviceVulkanMemoryModelFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceVulkanMemoryModelFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceVulkanMemoryModelFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceVulkanMemoryModelFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceVulkanMemoryModelFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceVulkanMemoryModelFeaturesFreeCSlice(x []PhysicalDeviceVulkanMemoryModelFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceVulkanMemoryModelFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceVulkanMemoryModelFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceVulkanMemoryModelFeaturesMakeCSlice(x ...PhysicalDeviceVulkanMemoryModelFeatures) []PhysicalDeviceVulkanMemoryModelFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceVulkanMemoryModelFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceVulkanMemoryModelFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceVulkanMemoryModelFeatures
+func (x PhysicalDeviceVulkanMemoryModelFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceVulkanMemoryModelFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceVulkanMemoryModelFeatures) WithDefaultSType() PhysicalDeviceVulkanMemoryModelFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceVulkanMemoryModelFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceVulkanMemoryModelFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkanMemoryModelFeatures) WithSType(y StructureType) PhysicalDeviceVulkanMemoryModelFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkanMemoryModelFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceVulkanMemoryModelFeatures
+func (x PhysicalDeviceVulkanMemoryModelFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceVulkanMemoryModelFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkanMemoryModelFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceVulkanMemoryModelFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkanMemoryModelFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceVulkanMemoryModelFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// VulkanMemoryModel returns the value of vulkanMemoryModel from VkPhysicalDeviceVulkanMemoryModelFeatures
+func (x PhysicalDeviceVulkanMemoryModelFeatures) VulkanMemoryModel() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.vulkanMemoryModel)
+	return *ptr
+}
+
+// WithVulkanMemoryModel clones a new PhysicalDeviceVulkanMemoryModelFeatures with the value of
+// VulkanMemoryModel updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkanMemoryModelFeatures) WithVulkanMemoryModel(y Bool32) PhysicalDeviceVulkanMemoryModelFeatures {
+	x.vulkanMemoryModel = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkanMemoryModelFeatures) SetVulkanMemoryModel(y Bool32) {
+	x.vulkanMemoryModel = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// VulkanMemoryModelDeviceScope returns the value of vulkanMemoryModelDeviceScope from VkPhysicalDeviceVulkanMemoryModelFeatures
+func (x PhysicalDeviceVulkanMemoryModelFeatures) VulkanMemoryModelDeviceScope() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.vulkanMemoryModelDeviceScope)
+	return *ptr
+}
+
+// WithVulkanMemoryModelDeviceScope clones a new PhysicalDeviceVulkanMemoryModelFeatures with the value of
+// VulkanMemoryModelDeviceScope updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkanMemoryModelFeatures) WithVulkanMemoryModelDeviceScope(y Bool32) PhysicalDeviceVulkanMemoryModelFeatures {
+	x.vulkanMemoryModelDeviceScope = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkanMemoryModelFeatures) SetVulkanMemoryModelDeviceScope(y Bool32) {
+	x.vulkanMemoryModelDeviceScope = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// VulkanMemoryModelAvailabilityVisibilityChains returns the value of vulkanMemoryModelAvailabilityVisibilityChains from VkPhysicalDeviceVulkanMemoryModelFeatures
+func (x PhysicalDeviceVulkanMemoryModelFeatures) VulkanMemoryModelAvailabilityVisibilityChains() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.vulkanMemoryModelAvailabilityVisibilityChains)
+	return *ptr
+}
+
+// WithVulkanMemoryModelAvailabilityVisibilityChains clones a new PhysicalDeviceVulkanMemoryModelFeatures with the value of
+// VulkanMemoryModelAvailabilityVisibilityChains updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkanMemoryModelFeatures) WithVulkanMemoryModelAvailabilityVisibilityChains(y Bool32) PhysicalDeviceVulkanMemoryModelFeatures {
+	x.vulkanMemoryModelAvailabilityVisibilityChains = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkanMemoryModelFeatures) SetVulkanMemoryModelAvailabilityVisibilityChains(y Bool32) {
+	x.vulkanMemoryModelAvailabilityVisibilityChains = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PhysicalDeviceFloatControlsProperties provides a go interface for VkPhysicalDeviceFloatControlsProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceFloatControlsProperties.html
+type PhysicalDeviceFloatControlsProperties C.struct_VkPhysicalDeviceFloatControlsProperties
+
+// SizeofPhysicalDeviceFloatControlsProperties is the memory size of a PhysicalDeviceFloatControlsProperties
+var SizeofPhysicalDeviceFloatControlsProperties int = int(unsafe.Sizeof(PhysicalDeviceFloatControlsProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceFloatControlsProperties) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceFloatControlsProperties {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceFloatControlsProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceFloatControlsProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceFloatControlsProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceFloatControlsProperties) AsCPtr() *PhysicalDeviceFloatControlsProperties {
+	clone := (*PhysicalDeviceFloatControlsProperties)(newCBlock(cULong(SizeofPhysicalDeviceFloatControlsProperties)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceFloatControlsPropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceFloatControlsPropertiesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceFloatControlsProperties) []PhysicalDeviceFloatControlsProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceFloatControlsProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceFloatControlsProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceFloatControlsPropertiesFreeCSlice releases the memory allocated by PhysicalDeviceFloatControlsPropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceFloatControlsPropertiesFreeCSlice(x []PhysicalDeviceFloatControlsProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceFloatControlsPropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceFloatControlsPropertiesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceFloatControlsPropertiesMakeCSlice(x ...PhysicalDeviceFloatControlsProperties) []PhysicalDeviceFloatControlsProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceFloatControlsProperties * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceFloatControlsProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceFloatControlsProperties
+func (x *PhysicalDeviceFloatControlsProperties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceFloatControlsProperties with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceFloatControlsProperties) WithDefaultSType() PhysicalDeviceFloatControlsProperties {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceFloatControlsProperties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_PROPERTIES)
+}
+
+// WithSType clones a new PhysicalDeviceFloatControlsProperties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceFloatControlsProperties) WithSType(y StructureType) PhysicalDeviceFloatControlsProperties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceFloatControlsProperties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceFloatControlsProperties
+func (x *PhysicalDeviceFloatControlsProperties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceFloatControlsProperties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceFloatControlsProperties) WithPNext(y unsafe.Pointer) PhysicalDeviceFloatControlsProperties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceFloatControlsProperties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceFloatControlsProperties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// DenormBehaviorIndependence returns the value of denormBehaviorIndependence from VkPhysicalDeviceFloatControlsProperties
+func (x *PhysicalDeviceFloatControlsProperties) DenormBehaviorIndependence() ShaderFloatControlsIndependence {
+	ptr := /* typedef */ (*ShaderFloatControlsIndependence)(&x.denormBehaviorIndependence)
+	return *ptr
+}
+
+// RoundingModeIndependence returns the value of roundingModeIndependence from VkPhysicalDeviceFloatControlsProperties
+func (x *PhysicalDeviceFloatControlsProperties) RoundingModeIndependence() ShaderFloatControlsIndependence {
+	ptr := /* typedef */ (*ShaderFloatControlsIndependence)(&x.roundingModeIndependence)
+	return *ptr
+}
+
+// ShaderSignedZeroInfNanPreserveFloat16 returns the value of shaderSignedZeroInfNanPreserveFloat16 from VkPhysicalDeviceFloatControlsProperties
+func (x *PhysicalDeviceFloatControlsProperties) ShaderSignedZeroInfNanPreserveFloat16() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderSignedZeroInfNanPreserveFloat16)
+	return *ptr
+}
+
+// ShaderSignedZeroInfNanPreserveFloat32 returns the value of shaderSignedZeroInfNanPreserveFloat32 from VkPhysicalDeviceFloatControlsProperties
+func (x *PhysicalDeviceFloatControlsProperties) ShaderSignedZeroInfNanPreserveFloat32() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderSignedZeroInfNanPreserveFloat32)
+	return *ptr
+}
+
+// ShaderSignedZeroInfNanPreserveFloat64 returns the value of shaderSignedZeroInfNanPreserveFloat64 from VkPhysicalDeviceFloatControlsProperties
+func (x *PhysicalDeviceFloatControlsProperties) ShaderSignedZeroInfNanPreserveFloat64() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderSignedZeroInfNanPreserveFloat64)
+	return *ptr
+}
+
+// ShaderDenormPreserveFloat16 returns the value of shaderDenormPreserveFloat16 from VkPhysicalDeviceFloatControlsProperties
+func (x *PhysicalDeviceFloatControlsProperties) ShaderDenormPreserveFloat16() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderDenormPreserveFloat16)
+	return *ptr
+}
+
+// ShaderDenormPreserveFloat32 returns the value of shaderDenormPreserveFloat32 from VkPhysicalDeviceFloatControlsProperties
+func (x *PhysicalDeviceFloatControlsProperties) ShaderDenormPreserveFloat32() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderDenormPreserveFloat32)
+	return *ptr
+}
+
+// ShaderDenormPreserveFloat64 returns the value of shaderDenormPreserveFloat64 from VkPhysicalDeviceFloatControlsProperties
+func (x *PhysicalDeviceFloatControlsProperties) ShaderDenormPreserveFloat64() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderDenormPreserveFloat64)
+	return *ptr
+}
+
+// ShaderDenormFlushToZeroFloat16 returns the value of shaderDenormFlushToZeroFloat16 from VkPhysicalDeviceFloatControlsProperties
+func (x *PhysicalDeviceFloatControlsProperties) ShaderDenormFlushToZeroFloat16() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderDenormFlushToZeroFloat16)
+	return *ptr
+}
+
+// ShaderDenormFlushToZeroFloat32 returns the value of shaderDenormFlushToZeroFloat32 from VkPhysicalDeviceFloatControlsProperties
+func (x *PhysicalDeviceFloatControlsProperties) ShaderDenormFlushToZeroFloat32() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderDenormFlushToZeroFloat32)
+	return *ptr
+}
+
+// ShaderDenormFlushToZeroFloat64 returns the value of shaderDenormFlushToZeroFloat64 from VkPhysicalDeviceFloatControlsProperties
+func (x *PhysicalDeviceFloatControlsProperties) ShaderDenormFlushToZeroFloat64() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderDenormFlushToZeroFloat64)
+	return *ptr
+}
+
+// ShaderRoundingModeRTEFloat16 returns the value of shaderRoundingModeRTEFloat16 from VkPhysicalDeviceFloatControlsProperties
+func (x *PhysicalDeviceFloatControlsProperties) ShaderRoundingModeRTEFloat16() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderRoundingModeRTEFloat16)
+	return *ptr
+}
+
+// ShaderRoundingModeRTEFloat32 returns the value of shaderRoundingModeRTEFloat32 from VkPhysicalDeviceFloatControlsProperties
+func (x *PhysicalDeviceFloatControlsProperties) ShaderRoundingModeRTEFloat32() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderRoundingModeRTEFloat32)
+	return *ptr
+}
+
+// ShaderRoundingModeRTEFloat64 returns the value of shaderRoundingModeRTEFloat64 from VkPhysicalDeviceFloatControlsProperties
+func (x *PhysicalDeviceFloatControlsProperties) ShaderRoundingModeRTEFloat64() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderRoundingModeRTEFloat64)
+	return *ptr
+}
+
+// ShaderRoundingModeRTZFloat16 returns the value of shaderRoundingModeRTZFloat16 from VkPhysicalDeviceFloatControlsProperties
+func (x *PhysicalDeviceFloatControlsProperties) ShaderRoundingModeRTZFloat16() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderRoundingModeRTZFloat16)
+	return *ptr
+}
+
+// ShaderRoundingModeRTZFloat32 returns the value of shaderRoundingModeRTZFloat32 from VkPhysicalDeviceFloatControlsProperties
+func (x *PhysicalDeviceFloatControlsProperties) ShaderRoundingModeRTZFloat32() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderRoundingModeRTZFloat32)
+	return *ptr
+}
+
+// ShaderRoundingModeRTZFloat64 returns the value of shaderRoundingModeRTZFloat64 from VkPhysicalDeviceFloatControlsProperties
+func (x *PhysicalDeviceFloatControlsProperties) ShaderRoundingModeRTZFloat64() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderRoundingModeRTZFloat64)
+	return *ptr
+}
+
+// BufferOpaqueCaptureAddressCreateInfo provides a go interface for VkBufferOpaqueCaptureAddressCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkBufferOpaqueCaptureAddressCreateInfo.html
+type BufferOpaqueCaptureAddressCreateInfo C.struct_VkBufferOpaqueCaptureAddressCreateInfo
+
+// SizeofBufferOpaqueCaptureAddressCreateInfo is the memory size of a BufferOpaqueCaptureAddressCreateInfo
+var SizeofBufferOpaqueCaptureAddressCreateInfo int = int(unsafe.Sizeof(BufferOpaqueCaptureAddressCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x BufferOpaqueCaptureAddressCreateInfo) ArpPtr(arp *AutoReleasePool) *BufferOpaqueCaptureAddressCreateInfo {
+	ptr := newCBlock(cULong(SizeofBufferOpaqueCaptureAddressCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*BufferOpaqueCaptureAddressCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *BufferOpaqueCaptureAddressCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x BufferOpaqueCaptureAddressCreateInfo) AsCPtr() *BufferOpaqueCaptureAddressCreateInfo {
+	clone := (*BufferOpaqueCaptureAddressCreateInfo)(newCBlock(cULong(SizeofBufferOpaqueCaptureAddressCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// BufferOpaqueCaptureAddressCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func BufferOpaqueCaptureAddressCreateInfoCSlice(arp *AutoReleasePool, x ...BufferOpaqueCaptureAddressCreateInfo) []BufferOpaqueCaptureAddressCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBufferOpaqueCaptureAddressCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*BufferOpaqueCaptureAddressCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// BufferOpaqueCaptureAddressCreateInfoFreeCSlice releases the memory allocated by BufferOpaqueCaptureAddressCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func BufferOpaqueCaptureAddressCreateInfoFreeCSlice(x []BufferOpaqueCaptureAddressCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// BufferOpaqueCaptureAddressCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. BufferOpaqueCaptureAddressCreateInfoFreeCSlice must be called on the returned slice.
+func BufferOpaqueCaptureAddressCreateInfoMakeCSlice(x ...BufferOpaqueCaptureAddressCreateInfo) []BufferOpaqueCaptureAddressCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBufferOpaqueCaptureAddressCreateInfo * len(x)
+	dst := unsafe.Slice((*BufferOpaqueCaptureAddressCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkBufferOpaqueCaptureAddressCreateInfo
+func (x BufferOpaqueCaptureAddressCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new BufferOpaqueCaptureAddressCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x BufferOpaqueCaptureAddressCreateInfo) WithDefaultSType() BufferOpaqueCaptureAddressCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *BufferOpaqueCaptureAddressCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO)
+}
+
+// WithSType clones a new BufferOpaqueCaptureAddressCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferOpaqueCaptureAddressCreateInfo) WithSType(y StructureType) BufferOpaqueCaptureAddressCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *BufferOpaqueCaptureAddressCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkBufferOpaqueCaptureAddressCreateInfo
+func (x BufferOpaqueCaptureAddressCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new BufferOpaqueCaptureAddressCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferOpaqueCaptureAddressCreateInfo) WithPNext(y unsafe.Pointer) BufferOpaqueCaptureAddressCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *BufferOpaqueCaptureAddressCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *BufferOpaqueCaptureAddressCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// OpaqueCaptureAddress returns the value of opaqueCaptureAddress from VkBufferOpaqueCaptureAddressCreateInfo
+func (x BufferOpaqueCaptureAddressCreateInfo) OpaqueCaptureAddress() uint64 {
+	ptr := func(x *C.uint64_t) *uint64 { /* Scalar */ c2g := uint64(*x); return &c2g }(&x.opaqueCaptureAddress)
+	return *ptr
+}
+
+// WithOpaqueCaptureAddress clones a new BufferOpaqueCaptureAddressCreateInfo with the value of
+// OpaqueCaptureAddress updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferOpaqueCaptureAddressCreateInfo) WithOpaqueCaptureAddress(y uint64) BufferOpaqueCaptureAddressCreateInfo {
+	x.opaqueCaptureAddress = *(func(x *uint64) *C.uint64_t { /* Scalar */ g2c := C.uint64_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *BufferOpaqueCaptureAddressCreateInfo) SetOpaqueCaptureAddress(y uint64) {
+	x.opaqueCaptureAddress = *(func(x *uint64) *C.uint64_t { /* Scalar */ g2c := C.uint64_t(*x); return &g2c }(&y))
+}
+
+// PhysicalDeviceSamplerFilterMinmaxProperties provides a go interface for VkPhysicalDeviceSamplerFilterMinmaxProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceSamplerFilterMinmaxProperties.html
+type PhysicalDeviceSamplerFilterMinmaxProperties C.struct_VkPhysicalDeviceSamplerFilterMinmaxProperties
+
+// SizeofPhysicalDeviceSamplerFilterMinmaxProperties is the memory size of a PhysicalDeviceSamplerFilterMinmaxProperties
+var SizeofPhysicalDeviceSamplerFilterMinmaxProperties int = int(unsafe.Sizeof(PhysicalDeviceSamplerFilterMinmaxProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceSamplerFilterMinmaxProperties) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceSamplerFilterMinmaxProperties {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceSamplerFilterMinmaxProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceSamplerFilterMinmaxProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceSamplerFilterMinmaxProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceSamplerFilterMinmaxProperties) AsCPtr() *PhysicalDeviceSamplerFilterMinmaxProperties {
+	clone := (*PhysicalDeviceSamplerFilterMinmaxProperties)(newCBlock(cULong(SizeofPhysicalDeviceSamplerFilterMinmaxProperties)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceSamplerFilterMinmaxPropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceSamplerFilterMinmaxPropertiesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceSamplerFilterMinmaxProperties) []PhysicalDeviceSamplerFilterMinmaxProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceSamplerFilterMinmaxProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceSamplerFilterMinmaxProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceSamplerFilterMinmaxPropertiesFreeCSlice releases the memory allocated by PhysicalDeviceSamplerFilterMinmaxPropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceSamplerFilterMinmaxPropertiesFreeCSlice(x []PhysicalDeviceSamplerFilterMinmaxProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceSamplerFilterMinmaxPropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceSamplerFilterMinmaxPropertiesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceSamplerFilterMinmaxPropertiesMakeCSlice(x ...PhysicalDeviceSamplerFilterMinmaxProperties) []PhysicalDeviceSamplerFilterMinmaxProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceSamplerFilterMinmaxProperties * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceSamplerFilterMinmaxProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceSamplerFilterMinmaxProperties
+func (x PhysicalDeviceSamplerFilterMinmaxProperties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceSamplerFilterMinmaxProperties with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceSamplerFilterMinmaxProperties) WithDefaultSType() PhysicalDeviceSamplerFilterMinmaxProperties {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceSamplerFilterMinmaxProperties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES)
+}
+
+// WithSType clones a new PhysicalDeviceSamplerFilterMinmaxProperties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSamplerFilterMinmaxProperties) WithSType(y StructureType) PhysicalDeviceSamplerFilterMinmaxProperties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceSamplerFilterMinmaxProperties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceSamplerFilterMinmaxProperties
+func (x PhysicalDeviceSamplerFilterMinmaxProperties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceSamplerFilterMinmaxProperties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSamplerFilterMinmaxProperties) WithPNext(y unsafe.Pointer) PhysicalDeviceSamplerFilterMinmaxProperties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceSamplerFilterMinmaxProperties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceSamplerFilterMinmaxProperties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// FilterMinmaxSingleComponentFormats returns the value of filterMinmaxSingleComponentFormats from VkPhysicalDeviceSamplerFilterMinmaxProperties
+func (x PhysicalDeviceSamplerFilterMinmaxProperties) FilterMinmaxSingleComponentFormats() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.filterMinmaxSingleComponentFormats)
+	return *ptr
+}
+
+// FilterMinmaxImageComponentMapping returns the value of filterMinmaxImageComponentMapping from VkPhysicalDeviceSamplerFilterMinmaxProperties
+func (x PhysicalDeviceSamplerFilterMinmaxProperties) FilterMinmaxImageComponentMapping() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.filterMinmaxImageComponentMapping)
+	return *ptr
+}
+
+// DescriptorSetLayoutBindingFlagsCreateInfo provides a go interface for VkDescriptorSetLayoutBindingFlagsCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDescriptorSetLayoutBindingFlagsCreateInfo.html
+type DescriptorSetLayoutBindingFlagsCreateInfo C.struct_VkDescriptorSetLayoutBindingFlagsCreateInfo
+
+// SizeofDescriptorSetLayoutBindingFlagsCreateInfo is the memory size of a DescriptorSetLayoutBindingFlagsCreateInfo
+var SizeofDescriptorSetLayoutBindingFlagsCreateInfo int = int(unsafe.Sizeof(DescriptorSetLayoutBindingFlagsCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DescriptorSetLayoutBindingFlagsCreateInfo) ArpPtr(arp *AutoReleasePool) *DescriptorSetLayoutBindingFlagsCreateInfo {
+	ptr := newCBlock(cULong(SizeofDescriptorSetLayoutBindingFlagsCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DescriptorSetLayoutBindingFlagsCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DescriptorSetLayoutBindingFlagsCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DescriptorSetLayoutBindingFlagsCreateInfo) AsCPtr() *DescriptorSetLayoutBindingFlagsCreateInfo {
+	clone := (*DescriptorSetLayoutBindingFlagsCreateInfo)(newCBlock(cULong(SizeofDescriptorSetLayoutBindingFlagsCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// DescriptorSetLayoutBindingFlagsCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DescriptorSetLayoutBindingFlagsCreateInfoCSlice(arp *AutoReleasePool, x ...DescriptorSetLayoutBindingFlagsCreateInfo) []DescriptorSetLayoutBindingFlagsCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDescriptorSetLayoutBindingFlagsCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DescriptorSetLayoutBindingFlagsCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DescriptorSetLayoutBindingFlagsCreateInfoFreeCSlice releases the memory allocated by DescriptorSetLayoutBindingFlagsCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DescriptorSetLayoutBindingFlagsCreateInfoFreeCSlice(x []DescriptorSetLayoutBindingFlagsCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DescriptorSetLayoutBindingFlagsCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DescriptorSetLayoutBindingFlagsCreateInfoFreeCSlice must be called on the returned slice.
+func DescriptorSetLayoutBindingFlagsCreateInfoMakeCSlice(x ...DescriptorSetLayoutBindingFlagsCreateInfo) []DescriptorSetLayoutBindingFlagsCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDescriptorSetLayoutBindingFlagsCreateInfo * len(x)
+	dst := unsafe.Slice((*DescriptorSetLayoutBindingFlagsCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDescriptorSetLayoutBindingFlagsCreateInfo
+func (x DescriptorSetLayoutBindingFlagsCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DescriptorSetLayoutBindingFlagsCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x DescriptorSetLayoutBindingFlagsCreateInfo) WithDefaultSType() DescriptorSetLayoutBindingFlagsCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DescriptorSetLayoutBindingFlagsCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO)
+}
+
+// WithSType clones a new DescriptorSetLayoutBindingFlagsCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorSetLayoutBindingFlagsCreateInfo) WithSType(y StructureType) DescriptorSetLayoutBindingFlagsCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DescriptorSetLayoutBindingFlagsCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDescriptorSetLayoutBindingFlagsCreateInfo
+func (x DescriptorSetLayoutBindingFlagsCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DescriptorSetLayoutBindingFlagsCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorSetLayoutBindingFlagsCreateInfo) WithPNext(y unsafe.Pointer) DescriptorSetLayoutBindingFlagsCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DescriptorSetLayoutBindingFlagsCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DescriptorSetLayoutBindingFlagsCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// BindingCount returns the value of bindingCount from VkDescriptorSetLayoutBindingFlagsCreateInfo
+func (x DescriptorSetLayoutBindingFlagsCreateInfo) BindingCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.bindingCount)
+	return *ptr
+}
+
+// WithBindingCount clones a new DescriptorSetLayoutBindingFlagsCreateInfo with the value of
+// BindingCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorSetLayoutBindingFlagsCreateInfo) WithBindingCount(y uint32) DescriptorSetLayoutBindingFlagsCreateInfo {
+	x.bindingCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DescriptorSetLayoutBindingFlagsCreateInfo) SetBindingCount(y uint32) {
+	x.bindingCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PBindingFlags returns the value of pBindingFlags from VkDescriptorSetLayoutBindingFlagsCreateInfo
+func (x DescriptorSetLayoutBindingFlagsCreateInfo) PBindingFlags() []DescriptorBindingFlags {
+	if x.pBindingFlags == nil {
+		return nil
+	}
+	return unsafe.Slice((*DescriptorBindingFlags)(unsafe.Pointer(x.pBindingFlags)), x.bindingCount)
+}
+
+// WithPBindingFlags clones a new DescriptorSetLayoutBindingFlagsCreateInfo with the value of
+// PBindingFlags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines BindingCount as the length of this field.
+// BindingCount is updated with the length of the new value.
+func (x DescriptorSetLayoutBindingFlagsCreateInfo) WithPBindingFlags(y []DescriptorBindingFlags) DescriptorSetLayoutBindingFlagsCreateInfo {
+	x.pBindingFlags = *(func(x *[]DescriptorBindingFlags) **C.VkDescriptorBindingFlags { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkDescriptorBindingFlags)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkDescriptorBindingFlags)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithBindingCount(uint32(len(y)))
+}
+func (x *DescriptorSetLayoutBindingFlagsCreateInfo) SetPBindingFlags(y []DescriptorBindingFlags) {
+	x.pBindingFlags = *(func(x *[]DescriptorBindingFlags) **C.VkDescriptorBindingFlags { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkDescriptorBindingFlags)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkDescriptorBindingFlags)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetBindingCount(uint32(len(y)))
+}
+
+// PinPBindingFlags pins the Go memory referenced by y with the AutoReleasePool
+// and sets PBindingFlags, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DescriptorSetLayoutBindingFlagsCreateInfo) PinPBindingFlags(arp *AutoReleasePool, y []DescriptorBindingFlags) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPBindingFlags(y)
+}
+
+// PhysicalDeviceDescriptorIndexingFeatures provides a go interface for VkPhysicalDeviceDescriptorIndexingFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceDescriptorIndexingFeatures.html
+type PhysicalDeviceDescriptorIndexingFeatures C.struct_VkPhysicalDeviceDescriptorIndexingFeatures
+
+// SizeofPhysicalDeviceDescriptorIndexingFeatures is the memory size of a PhysicalDeviceDescriptorIndexingFeatures
+var SizeofPhysicalDeviceDescriptorIndexingFeatures int = int(unsafe.Sizeof(PhysicalDeviceDescriptorIndexingFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceDescriptorIndexingFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceDescriptorIndexingFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceDescriptorIndexingFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceDescriptorIndexingFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceDescriptorIndexingFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceDescriptorIndexingFeatures) AsCPtr() *PhysicalDeviceDescriptorIndexingFeatures {
+	clone := (*PhysicalDeviceDescriptorIndexingFeatures)(newCBlock(cULong(SizeofPhysicalDeviceDescriptorIndexingFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceDescriptorIndexingFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceDescriptorIndexingFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceDescriptorIndexingFeatures) []PhysicalDeviceDescriptorIndexingFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceDescriptorIndexingFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceDescriptorIndexingFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceDescriptorIndexingFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceDescriptorIndexingFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceDescriptorIndexingFeaturesFreeCSlice(x []PhysicalDeviceDescriptorIndexingFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceDescriptorIndexingFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceDescriptorIndexingFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceDescriptorIndexingFeaturesMakeCSlice(x ...PhysicalDeviceDescriptorIndexingFeatures) []PhysicalDeviceDescriptorIndexingFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceDescriptorIndexingFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceDescriptorIndexingFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceDescriptorIndexingFeatures
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithDefaultSType() PhysicalDeviceDescriptorIndexingFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithSType(y StructureType) PhysicalDeviceDescriptorIndexingFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceDescriptorIndexingFeatures
+func (x *PhysicalDeviceDescriptorIndexingFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceDescriptorIndexingFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceDescriptorIndexingFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ShaderInputAttachmentArrayDynamicIndexing returns the value of shaderInputAttachmentArrayDynamicIndexing from VkPhysicalDeviceDescriptorIndexingFeatures
+func (x *PhysicalDeviceDescriptorIndexingFeatures) ShaderInputAttachmentArrayDynamicIndexing() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderInputAttachmentArrayDynamicIndexing)
+	return *ptr
+}
+
+// WithShaderInputAttachmentArrayDynamicIndexing clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// ShaderInputAttachmentArrayDynamicIndexing updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithShaderInputAttachmentArrayDynamicIndexing(y Bool32) PhysicalDeviceDescriptorIndexingFeatures {
+	x.shaderInputAttachmentArrayDynamicIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetShaderInputAttachmentArrayDynamicIndexing(y Bool32) {
+	x.shaderInputAttachmentArrayDynamicIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderUniformTexelBufferArrayDynamicIndexing returns the value of shaderUniformTexelBufferArrayDynamicIndexing from VkPhysicalDeviceDescriptorIndexingFeatures
+func (x *PhysicalDeviceDescriptorIndexingFeatures) ShaderUniformTexelBufferArrayDynamicIndexing() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderUniformTexelBufferArrayDynamicIndexing)
+	return *ptr
+}
+
+// WithShaderUniformTexelBufferArrayDynamicIndexing clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// ShaderUniformTexelBufferArrayDynamicIndexing updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithShaderUniformTexelBufferArrayDynamicIndexing(y Bool32) PhysicalDeviceDescriptorIndexingFeatures {
+	x.shaderUniformTexelBufferArrayDynamicIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetShaderUniformTexelBufferArrayDynamicIndexing(y Bool32) {
+	x.shaderUniformTexelBufferArrayDynamicIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderStorageTexelBufferArrayDynamicIndexing returns the value of shaderStorageTexelBufferArrayDynamicIndexing from VkPhysicalDeviceDescriptorIndexingFeatures
+func (x *PhysicalDeviceDescriptorIndexingFeatures) ShaderStorageTexelBufferArrayDynamicIndexing() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderStorageTexelBufferArrayDynamicIndexing)
+	return *ptr
+}
+
+// WithShaderStorageTexelBufferArrayDynamicIndexing clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// ShaderStorageTexelBufferArrayDynamicIndexing updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithShaderStorageTexelBufferArrayDynamicIndexing(y Bool32) PhysicalDeviceDescriptorIndexingFeatures {
+	x.shaderStorageTexelBufferArrayDynamicIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetShaderStorageTexelBufferArrayDynamicIndexing(y Bool32) {
+	x.shaderStorageTexelBufferArrayDynamicIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderUniformBufferArrayNonUniformIndexing returns the value of shaderUniformBufferArrayNonUniformIndexing from VkPhysicalDeviceDescriptorIndexingFeatures
+func (x *PhysicalDeviceDescriptorIndexingFeatures) ShaderUniformBufferArrayNonUniformIndexing() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderUniformBufferArrayNonUniformIndexing)
+	return *ptr
+}
+
+// WithShaderUniformBufferArrayNonUniformIndexing clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// ShaderUniformBufferArrayNonUniformIndexing updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithShaderUniformBufferArrayNonUniformIndexing(y Bool32) PhysicalDeviceDescriptorIndexingFeatures {
+	x.shaderUniformBufferArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetShaderUniformBufferArrayNonUniformIndexing(y Bool32) {
+	x.shaderUniformBufferArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderSampledImageArrayNonUniformIndexing returns the value of shaderSampledImageArrayNonUniformIndexing from VkPhysicalDeviceDescriptorIndexingFeatures
+func (x *PhysicalDeviceDescriptorIndexingFeatures) ShaderSampledImageArrayNonUniformIndexing() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderSampledImageArrayNonUniformIndexing)
+	return *ptr
+}
+
+// WithShaderSampledImageArrayNonUniformIndexing clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// ShaderSampledImageArrayNonUniformIndexing updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithShaderSampledImageArrayNonUniformIndexing(y Bool32) PhysicalDeviceDescriptorIndexingFeatures {
+	x.shaderSampledImageArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetShaderSampledImageArrayNonUniformIndexing(y Bool32) {
+	x.shaderSampledImageArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderStorageBufferArrayNonUniformIndexing returns the value of shaderStorageBufferArrayNonUniformIndexing from VkPhysicalDeviceDescriptorIndexingFeatures
+func (x *PhysicalDeviceDescriptorIndexingFeatures) ShaderStorageBufferArrayNonUniformIndexing() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderStorageBufferArrayNonUniformIndexing)
+	return *ptr
+}
+
+// WithShaderStorageBufferArrayNonUniformIndexing clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// ShaderStorageBufferArrayNonUniformIndexing updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithShaderStorageBufferArrayNonUniformIndexing(y Bool32) PhysicalDeviceDescriptorIndexingFeatures {
+	x.shaderStorageBufferArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetShaderStorageBufferArrayNonUniformIndexing(y Bool32) {
+	x.shaderStorageBufferArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderStorageImageArrayNonUniformIndexing returns the value of shaderStorageImageArrayNonUniformIndexing from VkPhysicalDeviceDescriptorIndexingFeatures
+func (x *PhysicalDeviceDescriptorIndexingFeatures) ShaderStorageImageArrayNonUniformIndexing() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderStorageImageArrayNonUniformIndexing)
+	return *ptr
+}
+
+// WithShaderStorageImageArrayNonUniformIndexing clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// ShaderStorageImageArrayNonUniformIndexing updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithShaderStorageImageArrayNonUniformIndexing(y Bool32) PhysicalDeviceDescriptorIndexingFeatures {
+	x.shaderStorageImageArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetShaderStorageImageArrayNonUniformIndexing(y Bool32) {
+	x.shaderStorageImageArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderInputAttachmentArrayNonUniformIndexing returns the value of shaderInputAttachmentArrayNonUniformIndexing from VkPhysicalDeviceDescriptorIndexingFeatures
+func (x *PhysicalDeviceDescriptorIndexingFeatures) ShaderInputAttachmentArrayNonUniformIndexing() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderInputAttachmentArrayNonUniformIndexing)
+	return *ptr
+}
+
+// WithShaderInputAttachmentArrayNonUniformIndexing clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// ShaderInputAttachmentArrayNonUniformIndexing updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithShaderInputAttachmentArrayNonUniformIndexing(y Bool32) PhysicalDeviceDescriptorIndexingFeatures {
+	x.shaderInputAttachmentArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetShaderInputAttachmentArrayNonUniformIndexing(y Bool32) {
+	x.shaderInputAttachmentArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderUniformTexelBufferArrayNonUniformIndexing returns the value of shaderUniformTexelBufferArrayNonUniformIndexing from VkPhysicalDeviceDescriptorIndexingFeatures
+func (x *PhysicalDeviceDescriptorIndexingFeatures) ShaderUniformTexelBufferArrayNonUniformIndexing() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderUniformTexelBufferArrayNonUniformIndexing)
+	return *ptr
+}
+
+// WithShaderUniformTexelBufferArrayNonUniformIndexing clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// ShaderUniformTexelBufferArrayNonUniformIndexing updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithShaderUniformTexelBufferArrayNonUniformIndexing(y Bool32) PhysicalDeviceDescriptorIndexingFeatures {
+	x.shaderUniformTexelBufferArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetShaderUniformTexelBufferArrayNonUniformIndexing(y Bool32) {
+	x.shaderUniformTexelBufferArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderStorageTexelBufferArrayNonUniformIndexing returns the value of shaderStorageTexelBufferArrayNonUniformIndexing from VkPhysicalDeviceDescriptorIndexingFeatures
+func (x *PhysicalDeviceDescriptorIndexingFeatures) ShaderStorageTexelBufferArrayNonUniformIndexing() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderStorageTexelBufferArrayNonUniformIndexing)
+	return *ptr
+}
+
+// WithShaderStorageTexelBufferArrayNonUniformIndexing clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// ShaderStorageTexelBufferArrayNonUniformIndexing updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithShaderStorageTexelBufferArrayNonUniformIndexing(y Bool32) PhysicalDeviceDescriptorIndexingFeatures {
+	x.shaderStorageTexelBufferArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetShaderStorageTexelBufferArrayNonUniformIndexing(y Bool32) {
+	x.shaderStorageTexelBufferArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DescriptorBindingUniformBufferUpdateAfterBind returns the value of descriptorBindingUniformBufferUpdateAfterBind from VkPhysicalDeviceDescriptorIndexingFeatures
+func (x *PhysicalDeviceDescriptorIndexingFeatures) DescriptorBindingUniformBufferUpdateAfterBind() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.descriptorBindingUniformBufferUpdateAfterBind)
+	return *ptr
+}
+
+// WithDescriptorBindingUniformBufferUpdateAfterBind clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// DescriptorBindingUniformBufferUpdateAfterBind updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithDescriptorBindingUniformBufferUpdateAfterBind(y Bool32) PhysicalDeviceDescriptorIndexingFeatures {
+	x.descriptorBindingUniformBufferUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetDescriptorBindingUniformBufferUpdateAfterBind(y Bool32) {
+	x.descriptorBindingUniformBufferUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DescriptorBindingSampledImageUpdateAfterBind returns the value of descriptorBindingSampledImageUpdateAfterBind from VkPhysicalDeviceDescriptorIndexingFeatures
+func (x *PhysicalDeviceDescriptorIndexingFeatures) DescriptorBindingSampledImageUpdateAfterBind() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.descriptorBindingSampledImageUpdateAfterBind)
+	return *ptr
+}
+
+// WithDescriptorBindingSampledImageUpdateAfterBind clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// DescriptorBindingSampledImageUpdateAfterBind updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithDescriptorBindingSampledImageUpdateAfterBind(y Bool32) PhysicalDeviceDescriptorIndexingFeatures {
+	x.descriptorBindingSampledImageUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetDescriptorBindingSampledImageUpdateAfterBind(y Bool32) {
+	x.descriptorBindingSampledImageUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DescriptorBindingStorageImageUpdateAfterBind returns the value of descriptorBindingStorageImageUpdateAfterBind from VkPhysicalDeviceDescriptorIndexingFeatures
+func (x *PhysicalDeviceDescriptorIndexingFeatures) DescriptorBindingStorageImageUpdateAfterBind() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.descriptorBindingStorageImageUpdateAfterBind)
+	return *ptr
+}
+
+// WithDescriptorBindingStorageImageUpdateAfterBind clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// DescriptorBindingStorageImageUpdateAfterBind updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithDescriptorBindingStorageImageUpdateAfterBind(y Bool32) PhysicalDeviceDescriptorIndexingFeatures {
+	x.descriptorBindingStorageImageUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetDescriptorBindingStorageImageUpdateAfterBind(y Bool32) {
+	x.descriptorBindingStorageImageUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DescriptorBindingStorageBufferUpdateAfterBind returns the value of descriptorBindingStorageBufferUpdateAfterBind from VkPhysicalDeviceDescriptorIndexingFeatures
+func (x *PhysicalDeviceDescriptorIndexingFeatures) DescriptorBindingStorageBufferUpdateAfterBind() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.descriptorBindingStorageBufferUpdateAfterBind)
+	return *ptr
+}
+
+// WithDescriptorBindingStorageBufferUpdateAfterBind clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// DescriptorBindingStorageBufferUpdateAfterBind updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithDescriptorBindingStorageBufferUpdateAfterBind(y Bool32) PhysicalDeviceDescriptorIndexingFeatures {
+	x.descriptorBindingStorageBufferUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetDescriptorBindingStorageBufferUpdateAfterBind(y Bool32) {
+	x.descriptorBindingStorageBufferUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DescriptorBindingUniformTexelBufferUpdateAfterBind returns the value of descriptorBindingUniformTexelBufferUpdateAfterBind from VkPhysicalDeviceDescriptorIndexingFeatures
+func (x *PhysicalDeviceDescriptorIndexingFeatures) DescriptorBindingUniformTexelBufferUpdateAfterBind() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.descriptorBindingUniformTexelBufferUpdateAfterBind)
+	return *ptr
+}
+
+// WithDescriptorBindingUniformTexelBufferUpdateAfterBind clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// DescriptorBindingUniformTexelBufferUpdateAfterBind updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithDescriptorBindingUniformTexelBufferUpdateAfterBind(y Bool32) PhysicalDeviceDescriptorIndexingFeatures {
+	x.descriptorBindingUniformTexelBufferUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetDescriptorBindingUniformTexelBufferUpdateAfterBind(y Bool32) {
+	x.descriptorBindingUniformTexelBufferUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DescriptorBindingStorageTexelBufferUpdateAfterBind returns the value of descriptorBindingStorageTexelBufferUpdateAfterBind from VkPhysicalDeviceDescriptorIndexingFeatures
+func (x *PhysicalDeviceDescriptorIndexingFeatures) DescriptorBindingStorageTexelBufferUpdateAfterBind() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.descriptorBindingStorageTexelBufferUpdateAfterBind)
+	return *ptr
+}
+
+// WithDescriptorBindingStorageTexelBufferUpdateAfterBind clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// DescriptorBindingStorageTexelBufferUpdateAfterBind updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithDescriptorBindingStorageTexelBufferUpdateAfterBind(y Bool32) PhysicalDeviceDescriptorIndexingFeatures {
+	x.descriptorBindingStorageTexelBufferUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetDescriptorBindingStorageTexelBufferUpdateAfterBind(y Bool32) {
+	x.descriptorBindingStorageTexelBufferUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DescriptorBindingUpdateUnusedWhilePending returns the value of descriptorBindingUpdateUnusedWhilePending from VkPhysicalDeviceDescriptorIndexingFeatures
+func (x *PhysicalDeviceDescriptorIndexingFeatures) DescriptorBindingUpdateUnusedWhilePending() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.descriptorBindingUpdateUnusedWhilePending)
+	return *ptr
+}
+
+// WithDescriptorBindingUpdateUnusedWhilePending clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// DescriptorBindingUpdateUnusedWhilePending updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithDescriptorBindingUpdateUnusedWhilePending(y Bool32) PhysicalDeviceDescriptorIndexingFeatures {
+	x.descriptorBindingUpdateUnusedWhilePending = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetDescriptorBindingUpdateUnusedWhilePending(y Bool32) {
+	x.descriptorBindingUpdateUnusedWhilePending = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DescriptorBindingPartiallyBound returns the value of descriptorBindingPartiallyBound from VkPhysicalDeviceDescriptorIndexingFeatures
+func (x *PhysicalDeviceDescriptorIndexingFeatures) DescriptorBindingPartiallyBound() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.descriptorBindingPartiallyBound)
+	return *ptr
+}
+
+// WithDescriptorBindingPartiallyBound clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// DescriptorBindingPartiallyBound updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithDescriptorBindingPartiallyBound(y Bool32) PhysicalDeviceDescriptorIndexingFeatures {
+	x.descriptorBindingPartiallyBound = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetDescriptorBindingPartiallyBound(y Bool32) {
+	x.descriptorBindingPartiallyBound = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DescriptorBindingVariableDescriptorCount returns the value of descriptorBindingVariableDescriptorCount from VkPhysicalDeviceDescriptorIndexingFeatures
+func (x *PhysicalDeviceDescriptorIndexingFeatures) DescriptorBindingVariableDescriptorCount() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.descriptorBindingVariableDescriptorCount)
+	return *ptr
+}
+
+// WithDescriptorBindingVariableDescriptorCount clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// DescriptorBindingVariableDescriptorCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithDescriptorBindingVariableDescriptorCount(y Bool32) PhysicalDeviceDescriptorIndexingFeatures {
+	x.descriptorBindingVariableDescriptorCount = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetDescriptorBindingVariableDescriptorCount(y Bool32) {
+	x.descriptorBindingVariableDescriptorCount = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// RuntimeDescriptorArray returns the value of runtimeDescriptorArray from VkPhysicalDeviceDescriptorIndexingFeatures
+func (x *PhysicalDeviceDescriptorIndexingFeatures) RuntimeDescriptorArray() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.runtimeDescriptorArray)
+	return *ptr
+}
+
+// WithRuntimeDescriptorArray clones a new PhysicalDeviceDescriptorIndexingFeatures with the value of
+// RuntimeDescriptorArray updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingFeatures) WithRuntimeDescriptorArray(y Bool32) PhysicalDeviceDescriptorIndexingFeatures {
+	x.runtimeDescriptorArray = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingFeatures) SetRuntimeDescriptorArray(y Bool32) {
+	x.runtimeDescriptorArray = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PhysicalDeviceDescriptorIndexingProperties provides a go interface for VkPhysicalDeviceDescriptorIndexingProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceDescriptorIndexingProperties.html
+type PhysicalDeviceDescriptorIndexingProperties C.struct_VkPhysicalDeviceDescriptorIndexingProperties
+
+// SizeofPhysicalDeviceDescriptorIndexingProperties is the memory size of a PhysicalDeviceDescriptorIndexingProperties
+var SizeofPhysicalDeviceDescriptorIndexingProperties int = int(unsafe.Sizeof(PhysicalDeviceDescriptorIndexingProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceDescriptorIndexingProperties) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceDescriptorIndexingProperties {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceDescriptorIndexingProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceDescriptorIndexingProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceDescriptorIndexingProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceDescriptorIndexingProperties) AsCPtr() *PhysicalDeviceDescriptorIndexingProperties {
+	clone := (*PhysicalDeviceDescriptorIndexingProperties)(newCBlock(cULong(SizeofPhysicalDeviceDescriptorIndexingProperties)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceDescriptorIndexingPropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceDescriptorIndexingPropertiesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceDescriptorIndexingProperties) []PhysicalDeviceDescriptorIndexingProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceDescriptorIndexingProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceDescriptorIndexingProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceDescriptorIndexingPropertiesFreeCSlice releases the memory allocated by PhysicalDeviceDescriptorIndexingPropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceDescriptorIndexingPropertiesFreeCSlice(x []PhysicalDeviceDescriptorIndexingProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceDescriptorIndexingPropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceDescriptorIndexingPropertiesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceDescriptorIndexingPropertiesMakeCSlice(x ...PhysicalDeviceDescriptorIndexingProperties) []PhysicalDeviceDescriptorIndexingProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceDescriptorIndexingProperties * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceDescriptorIndexingProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceDescriptorIndexingProperties with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceDescriptorIndexingProperties) WithDefaultSType() PhysicalDeviceDescriptorIndexingProperties {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceDescriptorIndexingProperties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES)
+}
+
+// WithSType clones a new PhysicalDeviceDescriptorIndexingProperties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingProperties) WithSType(y StructureType) PhysicalDeviceDescriptorIndexingProperties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingProperties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceDescriptorIndexingProperties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDescriptorIndexingProperties) WithPNext(y unsafe.Pointer) PhysicalDeviceDescriptorIndexingProperties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceDescriptorIndexingProperties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceDescriptorIndexingProperties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// MaxUpdateAfterBindDescriptorsInAllPools returns the value of maxUpdateAfterBindDescriptorsInAllPools from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) MaxUpdateAfterBindDescriptorsInAllPools() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxUpdateAfterBindDescriptorsInAllPools)
+	return *ptr
+}
+
+// ShaderUniformBufferArrayNonUniformIndexingNative returns the value of shaderUniformBufferArrayNonUniformIndexingNative from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) ShaderUniformBufferArrayNonUniformIndexingNative() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderUniformBufferArrayNonUniformIndexingNative)
+	return *ptr
+}
+
+// ShaderSampledImageArrayNonUniformIndexingNative returns the value of shaderSampledImageArrayNonUniformIndexingNative from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) ShaderSampledImageArrayNonUniformIndexingNative() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderSampledImageArrayNonUniformIndexingNative)
+	return *ptr
+}
+
+// ShaderStorageBufferArrayNonUniformIndexingNative returns the value of shaderStorageBufferArrayNonUniformIndexingNative from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) ShaderStorageBufferArrayNonUniformIndexingNative() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderStorageBufferArrayNonUniformIndexingNative)
+	return *ptr
+}
+
+// ShaderStorageImageArrayNonUniformIndexingNative returns the value of shaderStorageImageArrayNonUniformIndexingNative from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) ShaderStorageImageArrayNonUniformIndexingNative() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderStorageImageArrayNonUniformIndexingNative)
+	return *ptr
+}
+
+// ShaderInputAttachmentArrayNonUniformIndexingNative returns the value of shaderInputAttachmentArrayNonUniformIndexingNative from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) ShaderInputAttachmentArrayNonUniformIndexingNative() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderInputAttachmentArrayNonUniformIndexingNative)
+	return *ptr
+}
+
+// RobustBufferAccessUpdateAfterBind returns the value of robustBufferAccessUpdateAfterBind from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) RobustBufferAccessUpdateAfterBind() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.robustBufferAccessUpdateAfterBind)
+	return *ptr
+}
+
+// QuadDivergentImplicitLod returns the value of quadDivergentImplicitLod from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) QuadDivergentImplicitLod() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.quadDivergentImplicitLod)
+	return *ptr
+}
+
+// MaxPerStageDescriptorUpdateAfterBindSamplers returns the value of maxPerStageDescriptorUpdateAfterBindSamplers from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) MaxPerStageDescriptorUpdateAfterBindSamplers() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxPerStageDescriptorUpdateAfterBindSamplers)
+	return *ptr
+}
+
+// MaxPerStageDescriptorUpdateAfterBindUniformBuffers returns the value of maxPerStageDescriptorUpdateAfterBindUniformBuffers from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) MaxPerStageDescriptorUpdateAfterBindUniformBuffers() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxPerStageDescriptorUpdateAfterBindUniformBuffers)
+	return *ptr
+}
+
+// MaxPerStageDescriptorUpdateAfterBindStorageBuffers returns the value of maxPerStageDescriptorUpdateAfterBindStorageBuffers from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) MaxPerStageDescriptorUpdateAfterBindStorageBuffers() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxPerStageDescriptorUpdateAfterBindStorageBuffers)
+	return *ptr
+}
+
+// MaxPerStageDescriptorUpdateAfterBindSampledImages returns the value of maxPerStageDescriptorUpdateAfterBindSampledImages from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) MaxPerStageDescriptorUpdateAfterBindSampledImages() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxPerStageDescriptorUpdateAfterBindSampledImages)
+	return *ptr
+}
+
+// MaxPerStageDescriptorUpdateAfterBindStorageImages returns the value of maxPerStageDescriptorUpdateAfterBindStorageImages from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) MaxPerStageDescriptorUpdateAfterBindStorageImages() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxPerStageDescriptorUpdateAfterBindStorageImages)
+	return *ptr
+}
+
+// MaxPerStageDescriptorUpdateAfterBindInputAttachments returns the value of maxPerStageDescriptorUpdateAfterBindInputAttachments from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) MaxPerStageDescriptorUpdateAfterBindInputAttachments() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxPerStageDescriptorUpdateAfterBindInputAttachments)
+	return *ptr
+}
+
+// MaxPerStageUpdateAfterBindResources returns the value of maxPerStageUpdateAfterBindResources from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) MaxPerStageUpdateAfterBindResources() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxPerStageUpdateAfterBindResources)
+	return *ptr
+}
+
+// MaxDescriptorSetUpdateAfterBindSamplers returns the value of maxDescriptorSetUpdateAfterBindSamplers from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) MaxDescriptorSetUpdateAfterBindSamplers() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxDescriptorSetUpdateAfterBindSamplers)
+	return *ptr
+}
+
+// MaxDescriptorSetUpdateAfterBindUniformBuffers returns the value of maxDescriptorSetUpdateAfterBindUniformBuffers from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) MaxDescriptorSetUpdateAfterBindUniformBuffers() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxDescriptorSetUpdateAfterBindUniformBuffers)
+	return *ptr
+}
+
+// MaxDescriptorSetUpdateAfterBindUniformBuffersDynamic returns the value of maxDescriptorSetUpdateAfterBindUniformBuffersDynamic from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) MaxDescriptorSetUpdateAfterBindUniformBuffersDynamic() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxDescriptorSetUpdateAfterBindUniformBuffersDynamic)
+	return *ptr
+}
+
+// MaxDescriptorSetUpdateAfterBindStorageBuffers returns the value of maxDescriptorSetUpdateAfterBindStorageBuffers from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) MaxDescriptorSetUpdateAfterBindStorageBuffers() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxDescriptorSetUpdateAfterBindStorageBuffers)
+	return *ptr
+}
+
+// MaxDescriptorSetUpdateAfterBindStorageBuffersDynamic returns the value of maxDescriptorSetUpdateAfterBindStorageBuffersDynamic from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) MaxDescriptorSetUpdateAfterBindStorageBuffersDynamic() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxDescriptorSetUpdateAfterBindStorageBuffersDynamic)
+	return *ptr
+}
+
+// MaxDescriptorSetUpdateAfterBindSampledImages returns the value of maxDescriptorSetUpdateAfterBindSampledImages from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) MaxDescriptorSetUpdateAfterBindSampledImages() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxDescriptorSetUpdateAfterBindSampledImages)
+	return *ptr
+}
+
+// MaxDescriptorSetUpdateAfterBindStorageImages returns the value of maxDescriptorSetUpdateAfterBindStorageImages from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) MaxDescriptorSetUpdateAfterBindStorageImages() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxDescriptorSetUpdateAfterBindStorageImages)
+	return *ptr
+}
+
+// MaxDescriptorSetUpdateAfterBindInputAttachments returns the value of maxDescriptorSetUpdateAfterBindInputAttachments from VkPhysicalDeviceDescriptorIndexingProperties
+func (x *PhysicalDeviceDescriptorIndexingProperties) MaxDescriptorSetUpdateAfterBindInputAttachments() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxDescriptorSetUpdateAfterBindInputAttachments)
+	return *ptr
+}
+
+// DescriptorSetVariableDescriptorCountAllocateInfo provides a go interface for VkDescriptorSetVariableDescriptorCountAllocateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDescriptorSetVariableDescriptorCountAllocateInfo.html
+type DescriptorSetVariableDescriptorCountAllocateInfo C.struct_VkDescriptorSetVariableDescriptorCountAllocateInfo
+
+// SizeofDescriptorSetVariableDescriptorCountAllocateInfo is the memory size of a DescriptorSetVariableDescriptorCountAllocateInfo
+var SizeofDescriptorSetVariableDescriptorCountAllocateInfo int = int(unsafe.Sizeof(DescriptorSetVariableDescriptorCountAllocateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DescriptorSetVariableDescriptorCountAllocateInfo) ArpPtr(arp *AutoReleasePool) *DescriptorSetVariableDescriptorCountAllocateInfo {
+	ptr := newCBlock(cULong(SizeofDescriptorSetVariableDescriptorCountAllocateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DescriptorSetVariableDescriptorCountAllocateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DescriptorSetVariableDescriptorCountAllocateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DescriptorSetVariableDescriptorCountAllocateInfo) AsCPtr() *DescriptorSetVariableDescriptorCountAllocateInfo {
+	clone := (*DescriptorSetVariableDescriptorCountAllocateInfo)(newCBlock(cULong(SizeofDescriptorSetVariableDescriptorCountAllocateInfo)))
+	*clone = x
+	return clone
+}
+
+// DescriptorSetVariableDescriptorCountAllocateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DescriptorSetVariableDescriptorCountAllocateInfoCSlice(arp *AutoReleasePool, x ...DescriptorSetVariableDescriptorCountAllocateInfo) []DescriptorSetVariableDescriptorCountAllocateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDescriptorSetVariableDescriptorCountAllocateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DescriptorSetVariableDescriptorCountAllocateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DescriptorSetVariableDescriptorCountAllocateInfoFreeCSlice releases the memory allocated by DescriptorSetVariableDescriptorCountAllocateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DescriptorSetVariableDescriptorCountAllocateInfoFreeCSlice(x []DescriptorSetVariableDescriptorCountAllocateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DescriptorSetVariableDescriptorCountAllocateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DescriptorSetVariableDescriptorCountAllocateInfoFreeCSlice must be called on the returned slice.
+func DescriptorSetVariableDescriptorCountAllocateInfoMakeCSlice(x ...DescriptorSetVariableDescriptorCountAllocateInfo) []DescriptorSetVariableDescriptorCountAllocateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDescriptorSetVariableDescriptorCountAllocateInfo * len(x)
+	dst := unsafe.Slice((*DescriptorSetVariableDescriptorCountAllocateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDescriptorSetVariableDescriptorCountAllocateInfo
+func (x DescriptorSetVariableDescriptorCountAllocateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DescriptorSetVariableDescriptorCountAllocateInfo with the value of
+// SType to the value provided in the specification.
+func (x DescriptorSetVariableDescriptorCountAllocateInfo) WithDefaultSType() DescriptorSetVariableDescriptorCountAllocateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DescriptorSetVariableDescriptorCountAllocateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO)
+}
+
+// WithSType clones a new DescriptorSetVariableDescriptorCountAllocateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorSetVariableDescriptorCountAllocateInfo) WithSType(y StructureType) DescriptorSetVariableDescriptorCountAllocateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DescriptorSetVariableDescriptorCountAllocateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDescriptorSetVariableDescriptorCountAllocateInfo
+func (x DescriptorSetVariableDescriptorCountAllocateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DescriptorSetVariableDescriptorCountAllocateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorSetVariableDescriptorCountAllocateInfo) WithPNext(y unsafe.Pointer) DescriptorSetVariableDescriptorCountAllocateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DescriptorSetVariableDescriptorCountAllocateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DescriptorSetVariableDescriptorCountAllocateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// DescriptorSetCount returns the value of descriptorSetCount from VkDescriptorSetVariableDescriptorCountAllocateInfo
+func (x DescriptorSetVariableDescriptorCountAllocateInfo) DescriptorSetCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.descriptorSetCount)
+	return *ptr
+}
+
+// WithDescriptorSetCount clones a new DescriptorSetVariableDescriptorCountAllocateInfo with the value of
+// DescriptorSetCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorSetVariableDescriptorCountAllocateInfo) WithDescriptorSetCount(y uint32) DescriptorSetVariableDescriptorCountAllocateInfo {
+	x.descriptorSetCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DescriptorSetVariableDescriptorCountAllocateInfo) SetDescriptorSetCount(y uint32) {
+	x.descriptorSetCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PDescriptorCounts returns the value of pDescriptorCounts from VkDescriptorSetVariableDescriptorCountAllocateInfo
+func (x DescriptorSetVariableDescriptorCountAllocateInfo) PDescriptorCounts() []uint32 {
+	if x.pDescriptorCounts == nil {
+		return nil
+	}
+	return unsafe.Slice((*uint32)(unsafe.Pointer(x.pDescriptorCounts)), x.descriptorSetCount)
+}
+
+// WithPDescriptorCounts clones a new DescriptorSetVariableDescriptorCountAllocateInfo with the value of
+// PDescriptorCounts updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines DescriptorSetCount as the length of this field.
+// DescriptorSetCount is updated with the length of the new value.
+func (x DescriptorSetVariableDescriptorCountAllocateInfo) WithPDescriptorCounts(y []uint32) DescriptorSetVariableDescriptorCountAllocateInfo {
+	x.pDescriptorCounts = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithDescriptorSetCount(uint32(len(y)))
+}
+func (x *DescriptorSetVariableDescriptorCountAllocateInfo) SetPDescriptorCounts(y []uint32) {
+	x.pDescriptorCounts = *(func(x *[]uint32) **C.uint32_t { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.uint32_t)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.uint32_t)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetDescriptorSetCount(uint32(len(y)))
+}
+
+// PinPDescriptorCounts pins the Go memory referenced by y with the AutoReleasePool
+// and sets PDescriptorCounts, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DescriptorSetVariableDescriptorCountAllocateInfo) PinPDescriptorCounts(arp *AutoReleasePool, y []uint32) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPDescriptorCounts(y)
+}
+
+// DescriptorSetVariableDescriptorCountLayoutSupport provides a go interface for VkDescriptorSetVariableDescriptorCountLayoutSupport.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDescriptorSetVariableDescriptorCountLayoutSupport.html
+type DescriptorSetVariableDescriptorCountLayoutSupport C.struct_VkDescriptorSetVariableDescriptorCountLayoutSupport
+
+// SizeofDescriptorSetVariableDescriptorCountLayoutSupport is the memory size of a DescriptorSetVariableDescriptorCountLayoutSupport
+var SizeofDescriptorSetVariableDescriptorCountLayoutSupport int = int(unsafe.Sizeof(DescriptorSetVariableDescriptorCountLayoutSupport{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DescriptorSetVariableDescriptorCountLayoutSupport) ArpPtr(arp *AutoReleasePool) *DescriptorSetVariableDescriptorCountLayoutSupport {
+	ptr := newCBlock(cULong(SizeofDescriptorSetVariableDescriptorCountLayoutSupport))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DescriptorSetVariableDescriptorCountLayoutSupport)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DescriptorSetVariableDescriptorCountLayoutSupport) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DescriptorSetVariableDescriptorCountLayoutSupport) AsCPtr() *DescriptorSetVariableDescriptorCountLayoutSupport {
+	clone := (*DescriptorSetVariableDescriptorCountLayoutSupport)(newCBlock(cULong(SizeofDescriptorSetVariableDescriptorCountLayoutSupport)))
+	*clone = x
+	return clone
+}
+
+// DescriptorSetVariableDescriptorCountLayoutSupportCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DescriptorSetVariableDescriptorCountLayoutSupportCSlice(arp *AutoReleasePool, x ...DescriptorSetVariableDescriptorCountLayoutSupport) []DescriptorSetVariableDescriptorCountLayoutSupport {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDescriptorSetVariableDescriptorCountLayoutSupport * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DescriptorSetVariableDescriptorCountLayoutSupport)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DescriptorSetVariableDescriptorCountLayoutSupportFreeCSlice releases the memory allocated by DescriptorSetVariableDescriptorCountLayoutSupportMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DescriptorSetVariableDescriptorCountLayoutSupportFreeCSlice(x []DescriptorSetVariableDescriptorCountLayoutSupport) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DescriptorSetVariableDescriptorCountLayoutSupportMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DescriptorSetVariableDescriptorCountLayoutSupportFreeCSlice must be called on the returned slice.
+func DescriptorSetVariableDescriptorCountLayoutSupportMakeCSlice(x ...DescriptorSetVariableDescriptorCountLayoutSupport) []DescriptorSetVariableDescriptorCountLayoutSupport {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDescriptorSetVariableDescriptorCountLayoutSupport * len(x)
+	dst := unsafe.Slice((*DescriptorSetVariableDescriptorCountLayoutSupport)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDescriptorSetVariableDescriptorCountLayoutSupport
+func (x DescriptorSetVariableDescriptorCountLayoutSupport) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DescriptorSetVariableDescriptorCountLayoutSupport with the value of
+// SType to the value provided in the specification.
+func (x DescriptorSetVariableDescriptorCountLayoutSupport) WithDefaultSType() DescriptorSetVariableDescriptorCountLayoutSupport {
+	return x.WithSType(VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DescriptorSetVariableDescriptorCountLayoutSupport) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT)
+}
+
+// WithSType clones a new DescriptorSetVariableDescriptorCountLayoutSupport with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorSetVariableDescriptorCountLayoutSupport) WithSType(y StructureType) DescriptorSetVariableDescriptorCountLayoutSupport {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DescriptorSetVariableDescriptorCountLayoutSupport) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDescriptorSetVariableDescriptorCountLayoutSupport
+func (x DescriptorSetVariableDescriptorCountLayoutSupport) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DescriptorSetVariableDescriptorCountLayoutSupport with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorSetVariableDescriptorCountLayoutSupport) WithPNext(y unsafe.Pointer) DescriptorSetVariableDescriptorCountLayoutSupport {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DescriptorSetVariableDescriptorCountLayoutSupport) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DescriptorSetVariableDescriptorCountLayoutSupport) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// MaxVariableDescriptorCount returns the value of maxVariableDescriptorCount from VkDescriptorSetVariableDescriptorCountLayoutSupport
+func (x DescriptorSetVariableDescriptorCountLayoutSupport) MaxVariableDescriptorCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxVariableDescriptorCount)
+	return *ptr
+}
+
+// MemoryOpaqueCaptureAddressAllocateInfo provides a go interface for VkMemoryOpaqueCaptureAddressAllocateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkMemoryOpaqueCaptureAddressAllocateInfo.html
+type MemoryOpaqueCaptureAddressAllocateInfo C.struct_VkMemoryOpaqueCaptureAddressAllocateInfo
+
+// SizeofMemoryOpaqueCaptureAddressAllocateInfo is the memory size of a MemoryOpaqueCaptureAddressAllocateInfo
+var SizeofMemoryOpaqueCaptureAddressAllocateInfo int = int(unsafe.Sizeof(MemoryOpaqueCaptureAddressAllocateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x MemoryOpaqueCaptureAddressAllocateInfo) ArpPtr(arp *AutoReleasePool) *MemoryOpaqueCaptureAddressAllocateInfo {
+	ptr := newCBlock(cULong(SizeofMemoryOpaqueCaptureAddressAllocateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*MemoryOpaqueCaptureAddressAllocateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *MemoryOpaqueCaptureAddressAllocateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x MemoryOpaqueCaptureAddressAllocateInfo) AsCPtr() *MemoryOpaqueCaptureAddressAllocateInfo {
+	clone := (*MemoryOpaqueCaptureAddressAllocateInfo)(newCBlock(cULong(SizeofMemoryOpaqueCaptureAddressAllocateInfo)))
+	*clone = x
+	return clone
+}
+
+// MemoryOpaqueCaptureAddressAllocateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func MemoryOpaqueCaptureAddressAllocateInfoCSlice(arp *AutoReleasePool, x ...MemoryOpaqueCaptureAddressAllocateInfo) []MemoryOpaqueCaptureAddressAllocateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofMemoryOpaqueCaptureAddressAllocateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*MemoryOpaqueCaptureAddressAllocateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// MemoryOpaqueCaptureAddressAllocateInfoFreeCSlice releases the memory allocated by MemoryOpaqueCaptureAddressAllocateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func MemoryOpaqueCaptureAddressAllocateInfoFreeCSlice(x []MemoryOpaqueCaptureAddressAllocateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// MemoryOpaqueCaptureAddressAllocateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. MemoryOpaqueCaptureAddressAllocateInfoFreeCSlice must be called on the returned slice.
+func MemoryOpaqueCaptureAddressAllocateInfoMakeCSlice(x ...MemoryOpaqueCaptureAddressAllocateInfo) []MemoryOpaqueCaptureAddressAllocateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofMemoryOpaqueCaptureAddressAllocateInfo * len(x)
+	dst := unsafe.Slice((*MemoryOpaqueCaptureAddressAllocateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkMemoryOpaqueCaptureAddressAllocateInfo
+func (x MemoryOpaqueCaptureAddressAllocateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new MemoryOpaqueCaptureAddressAllocateInfo with the value of
+// SType to the value provided in the specification.
+func (x MemoryOpaqueCaptureAddressAllocateInfo) WithDefaultSType() MemoryOpaqueCaptureAddressAllocateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *MemoryOpaqueCaptureAddressAllocateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO)
+}
+
+// WithSType clones a new MemoryOpaqueCaptureAddressAllocateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryOpaqueCaptureAddressAllocateInfo) WithSType(y StructureType) MemoryOpaqueCaptureAddressAllocateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *MemoryOpaqueCaptureAddressAllocateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkMemoryOpaqueCaptureAddressAllocateInfo
+func (x MemoryOpaqueCaptureAddressAllocateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new MemoryOpaqueCaptureAddressAllocateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryOpaqueCaptureAddressAllocateInfo) WithPNext(y unsafe.Pointer) MemoryOpaqueCaptureAddressAllocateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *MemoryOpaqueCaptureAddressAllocateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *MemoryOpaqueCaptureAddressAllocateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// OpaqueCaptureAddress returns the value of opaqueCaptureAddress from VkMemoryOpaqueCaptureAddressAllocateInfo
+func (x MemoryOpaqueCaptureAddressAllocateInfo) OpaqueCaptureAddress() uint64 {
+	ptr := func(x *C.uint64_t) *uint64 { /* Scalar */ c2g := uint64(*x); return &c2g }(&x.opaqueCaptureAddress)
+	return *ptr
+}
+
+// WithOpaqueCaptureAddress clones a new MemoryOpaqueCaptureAddressAllocateInfo with the value of
+// OpaqueCaptureAddress updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryOpaqueCaptureAddressAllocateInfo) WithOpaqueCaptureAddress(y uint64) MemoryOpaqueCaptureAddressAllocateInfo {
+	x.opaqueCaptureAddress = *(func(x *uint64) *C.uint64_t { /* Scalar */ g2c := C.uint64_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *MemoryOpaqueCaptureAddressAllocateInfo) SetOpaqueCaptureAddress(y uint64) {
+	x.opaqueCaptureAddress = *(func(x *uint64) *C.uint64_t { /* Scalar */ g2c := C.uint64_t(*x); return &g2c }(&y))
+}
+
+// DeviceMemoryOpaqueCaptureAddressInfo provides a go interface for VkDeviceMemoryOpaqueCaptureAddressInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDeviceMemoryOpaqueCaptureAddressInfo.html
+type DeviceMemoryOpaqueCaptureAddressInfo C.struct_VkDeviceMemoryOpaqueCaptureAddressInfo
+
+// SizeofDeviceMemoryOpaqueCaptureAddressInfo is the memory size of a DeviceMemoryOpaqueCaptureAddressInfo
+var SizeofDeviceMemoryOpaqueCaptureAddressInfo int = int(unsafe.Sizeof(DeviceMemoryOpaqueCaptureAddressInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DeviceMemoryOpaqueCaptureAddressInfo) ArpPtr(arp *AutoReleasePool) *DeviceMemoryOpaqueCaptureAddressInfo {
+	ptr := newCBlock(cULong(SizeofDeviceMemoryOpaqueCaptureAddressInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DeviceMemoryOpaqueCaptureAddressInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DeviceMemoryOpaqueCaptureAddressInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DeviceMemoryOpaqueCaptureAddressInfo) AsCPtr() *DeviceMemoryOpaqueCaptureAddressInfo {
+	clone := (*DeviceMemoryOpaqueCaptureAddressInfo)(newCBlock(cULong(SizeofDeviceMemoryOpaqueCaptureAddressInfo)))
+	*clone = x
+	return clone
+}
+
+// DeviceMemoryOpaqueCaptureAddressInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DeviceMemoryOpaqueCaptureAddressInfoCSlice(arp *AutoReleasePool, x ...DeviceMemoryOpaqueCaptureAddressInfo) []DeviceMemoryOpaqueCaptureAddressInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceMemoryOpaqueCaptureAddressInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DeviceMemoryOpaqueCaptureAddressInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DeviceMemoryOpaqueCaptureAddressInfoFreeCSlice releases the memory allocated by DeviceMemoryOpaqueCaptureAddressInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DeviceMemoryOpaqueCaptureAddressInfoFreeCSlice(x []DeviceMemoryOpaqueCaptureAddressInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DeviceMemoryOpaqueCaptureAddressInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DeviceMemoryOpaqueCaptureAddressInfoFreeCSlice must be called on the returned slice.
+func DeviceMemoryOpaqueCaptureAddressInfoMakeCSlice(x ...DeviceMemoryOpaqueCaptureAddressInfo) []DeviceMemoryOpaqueCaptureAddressInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceMemoryOpaqueCaptureAddressInfo * len(x)
+	dst := unsafe.Slice((*DeviceMemoryOpaqueCaptureAddressInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDeviceMemoryOpaqueCaptureAddressInfo
+func (x DeviceMemoryOpaqueCaptureAddressInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DeviceMemoryOpaqueCaptureAddressInfo with the value of
+// SType to the value provided in the specification.
+func (x DeviceMemoryOpaqueCaptureAddressInfo) WithDefaultSType() DeviceMemoryOpaqueCaptureAddressInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_DEVICE_MEMORY_OPAQUE_CAPTURE_ADDRESS_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DeviceMemoryOpaqueCaptureAddressInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DEVICE_MEMORY_OPAQUE_CAPTURE_ADDRESS_INFO)
+}
+
+// WithSType clones a new DeviceMemoryOpaqueCaptureAddressInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceMemoryOpaqueCaptureAddressInfo) WithSType(y StructureType) DeviceMemoryOpaqueCaptureAddressInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DeviceMemoryOpaqueCaptureAddressInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDeviceMemoryOpaqueCaptureAddressInfo
+func (x DeviceMemoryOpaqueCaptureAddressInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DeviceMemoryOpaqueCaptureAddressInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceMemoryOpaqueCaptureAddressInfo) WithPNext(y unsafe.Pointer) DeviceMemoryOpaqueCaptureAddressInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceMemoryOpaqueCaptureAddressInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DeviceMemoryOpaqueCaptureAddressInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Memory returns the value of memory from VkDeviceMemoryOpaqueCaptureAddressInfo
+func (x DeviceMemoryOpaqueCaptureAddressInfo) Memory() DeviceMemory {
+	ptr := /* handle */ (*DeviceMemory)(&x.memory)
+	return *ptr
+}
+
+// WithMemory clones a new DeviceMemoryOpaqueCaptureAddressInfo with the value of
+// Memory updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceMemoryOpaqueCaptureAddressInfo) WithMemory(y DeviceMemory) DeviceMemoryOpaqueCaptureAddressInfo {
+	x.memory = *( /* handle */ (*C.VkDeviceMemory)(&y))
+	return x
+}
+func (x *DeviceMemoryOpaqueCaptureAddressInfo) SetMemory(y DeviceMemory) {
+	x.memory = *( /* handle */ (*C.VkDeviceMemory)(&y))
+}
+
+// SamplerReductionModeCreateInfo provides a go interface for VkSamplerReductionModeCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSamplerReductionModeCreateInfo.html
+type SamplerReductionModeCreateInfo C.struct_VkSamplerReductionModeCreateInfo
+
+// SizeofSamplerReductionModeCreateInfo is the memory size of a SamplerReductionModeCreateInfo
+var SizeofSamplerReductionModeCreateInfo int = int(unsafe.Sizeof(SamplerReductionModeCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SamplerReductionModeCreateInfo) ArpPtr(arp *AutoReleasePool) *SamplerReductionModeCreateInfo {
+	ptr := newCBlock(cULong(SizeofSamplerReductionModeCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SamplerReductionModeCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SamplerReductionModeCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SamplerReductionModeCreateInfo) AsCPtr() *SamplerReductionModeCreateInfo {
+	clone := (*SamplerReductionModeCreateInfo)(newCBlock(cULong(SizeofSamplerReductionModeCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// SamplerReductionModeCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SamplerReductionModeCreateInfoCSlice(arp *AutoReleasePool, x ...SamplerReductionModeCreateInfo) []SamplerReductionModeCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSamplerReductionModeCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SamplerReductionModeCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SamplerReductionModeCreateInfoFreeCSlice releases the memory allocated by SamplerReductionModeCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func SamplerReductionModeCreateInfoFreeCSlice(x []SamplerReductionModeCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SamplerReductionModeCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SamplerReductionModeCreateInfoFreeCSlice must be called on the returned slice.
+func SamplerReductionModeCreateInfoMakeCSlice(x ...SamplerReductionModeCreateInfo) []SamplerReductionModeCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSamplerReductionModeCreateInfo * len(x)
+	dst := unsafe.Slice((*SamplerReductionModeCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkSamplerReductionModeCreateInfo
+func (x SamplerReductionModeCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new SamplerReductionModeCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x SamplerReductionModeCreateInfo) WithDefaultSType() SamplerReductionModeCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *SamplerReductionModeCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO)
+}
+
+// WithSType clones a new SamplerReductionModeCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SamplerReductionModeCreateInfo) WithSType(y StructureType) SamplerReductionModeCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *SamplerReductionModeCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkSamplerReductionModeCreateInfo
+func (x SamplerReductionModeCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new SamplerReductionModeCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SamplerReductionModeCreateInfo) WithPNext(y unsafe.Pointer) SamplerReductionModeCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *SamplerReductionModeCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SamplerReductionModeCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ReductionMode returns the value of reductionMode from VkSamplerReductionModeCreateInfo
+func (x SamplerReductionModeCreateInfo) ReductionMode() SamplerReductionMode {
+	ptr := /* typedef */ (*SamplerReductionMode)(&x.reductionMode)
+	return *ptr
+}
+
+// WithReductionMode clones a new SamplerReductionModeCreateInfo with the value of
+// ReductionMode updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SamplerReductionModeCreateInfo) WithReductionMode(y SamplerReductionMode) SamplerReductionModeCreateInfo {
+	x.reductionMode = *( /* typedef */ (*C.VkSamplerReductionMode)(&y))
+	return x
+}
+func (x *SamplerReductionModeCreateInfo) SetReductionMode(y SamplerReductionMode) {
+	x.reductionMode = *( /* typedef */ (*C.VkSamplerReductionMode)(&y))
+}
+
+// PhysicalDeviceVulkan12Properties provides a go interface for VkPhysicalDeviceVulkan12Properties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceVulkan12Properties.html
+type PhysicalDeviceVulkan12Properties C.struct_VkPhysicalDeviceVulkan12Properties
+
+// SizeofPhysicalDeviceVulkan12Properties is the memory size of a PhysicalDeviceVulkan12Properties
+var SizeofPhysicalDeviceVulkan12Properties int = int(unsafe.Sizeof(PhysicalDeviceVulkan12Properties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceVulkan12Properties) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceVulkan12Properties {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceVulkan12Properties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceVulkan12Properties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceVulkan12Properties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceVulkan12Properties) AsCPtr() *PhysicalDeviceVulkan12Properties {
+	clone := (*PhysicalDeviceVulkan12Properties)(newCBlock(cULong(SizeofPhysicalDeviceVulkan12Properties)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceVulkan12PropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceVulkan12PropertiesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceVulkan12Properties) []PhysicalDeviceVulkan12Properties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceVulkan12Properties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceVulkan12Properties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceVulkan12PropertiesFreeCSlice releases the memory allocated by PhysicalDeviceVulkan12PropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceVulkan12PropertiesFreeCSlice(x []PhysicalDeviceVulkan12Properties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceVulkan12PropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceVulkan12PropertiesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceVulkan12PropertiesMakeCSlice(x ...PhysicalDeviceVulkan12Properties) []PhysicalDeviceVulkan12Properties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceVulkan12Properties * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceVulkan12Properties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceVulkan12Properties with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceVulkan12Properties) WithDefaultSType() PhysicalDeviceVulkan12Properties {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceVulkan12Properties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES)
+}
+
+// WithSType clones a new PhysicalDeviceVulkan12Properties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Properties) WithSType(y StructureType) PhysicalDeviceVulkan12Properties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Properties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceVulkan12Properties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Properties) WithPNext(y unsafe.Pointer) PhysicalDeviceVulkan12Properties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Properties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceVulkan12Properties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// DriverID returns the value of driverID from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) DriverID() DriverId {
+	ptr := /* typedef */ (*DriverId)(&x.driverID)
+	return *ptr
+}
+
+// DriverName returns the value of driverName from VkPhysicalDeviceVulkan12Properties
+// The slice references the array in x; it is not a copy.
+func (x *PhysicalDeviceVulkan12Properties) DriverName() []byte {
+	ptr := func(x *[VK_MAX_DRIVER_NAME_SIZE]C.char) *[]byte { /* Array for byte */
+		slc := unsafe.Slice((*byte)(unsafe.Pointer(x)), VK_MAX_DRIVER_NAME_SIZE)
+		return &slc
+	}(&x.driverName)
+	return *ptr
+}
+
+// DriverInfo returns the value of driverInfo from VkPhysicalDeviceVulkan12Properties
+// The slice references the array in x; it is not a copy.
+func (x *PhysicalDeviceVulkan12Properties) DriverInfo() []byte {
+	ptr := func(x *[VK_MAX_DRIVER_INFO_SIZE]C.char) *[]byte { /* Array for byte */
+		slc := unsafe.Slice((*byte)(unsafe.Pointer(x)), VK_MAX_DRIVER_INFO_SIZE)
+		return &slc
+	}(&x.driverInfo)
+	return *ptr
+}
+
+// ConformanceVersion returns the value of conformanceVersion from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) ConformanceVersion() ConformanceVersion {
+	ptr := /* typedef */ (*ConformanceVersion)(&x.conformanceVersion)
+	return *ptr
+}
+
+// DenormBehaviorIndependence returns the value of denormBehaviorIndependence from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) DenormBehaviorIndependence() ShaderFloatControlsIndependence {
+	ptr := /* typedef */ (*ShaderFloatControlsIndependence)(&x.denormBehaviorIndependence)
+	return *ptr
+}
+
+// RoundingModeIndependence returns the value of roundingModeIndependence from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) RoundingModeIndependence() ShaderFloatControlsIndependence {
+	ptr := /* typedef */ (*ShaderFloatControlsIndependence)(&x.roundingModeIndependence)
+	return *ptr
+}
+
+// ShaderSignedZeroInfNanPreserveFloat16 returns the value of shaderSignedZeroInfNanPreserveFloat16 from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) ShaderSignedZeroInfNanPreserveFloat16() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderSignedZeroInfNanPreserveFloat16)
+	return *ptr
+}
+
+// ShaderSignedZeroInfNanPreserveFloat32 returns the value of shaderSignedZeroInfNanPreserveFloat32 from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) ShaderSignedZeroInfNanPreserveFloat32() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderSignedZeroInfNanPreserveFloat32)
+	return *ptr
+}
+
+// ShaderSignedZeroInfNanPreserveFloat64 returns the value of shaderSignedZeroInfNanPreserveFloat64 from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) ShaderSignedZeroInfNanPreserveFloat64() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderSignedZeroInfNanPreserveFloat64)
+	return *ptr
+}
+
+// ShaderDenormPreserveFloat16 returns the value of shaderDenormPreserveFloat16 from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) ShaderDenormPreserveFloat16() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderDenormPreserveFloat16)
+	return *ptr
+}
+
+// ShaderDenormPreserveFloat32 returns the value of shaderDenormPreserveFloat32 from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) ShaderDenormPreserveFloat32() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderDenormPreserveFloat32)
+	return *ptr
+}
+
+// ShaderDenormPreserveFloat64 returns the value of shaderDenormPreserveFloat64 from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) ShaderDenormPreserveFloat64() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderDenormPreserveFloat64)
+	return *ptr
+}
+
+// ShaderDenormFlushToZeroFloat16 returns the value of shaderDenormFlushToZeroFloat16 from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) ShaderDenormFlushToZeroFloat16() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderDenormFlushToZeroFloat16)
+	return *ptr
+}
+
+// ShaderDenormFlushToZeroFloat32 returns the value of shaderDenormFlushToZeroFloat32 from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) ShaderDenormFlushToZeroFloat32() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderDenormFlushToZeroFloat32)
+	return *ptr
+}
+
+// ShaderDenormFlushToZeroFloat64 returns the value of shaderDenormFlushToZeroFloat64 from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) ShaderDenormFlushToZeroFloat64() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderDenormFlushToZeroFloat64)
+	return *ptr
+}
+
+// ShaderRoundingModeRTEFloat16 returns the value of shaderRoundingModeRTEFloat16 from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) ShaderRoundingModeRTEFloat16() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderRoundingModeRTEFloat16)
+	return *ptr
+}
+
+// ShaderRoundingModeRTEFloat32 returns the value of shaderRoundingModeRTEFloat32 from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) ShaderRoundingModeRTEFloat32() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderRoundingModeRTEFloat32)
+	return *ptr
+}
+
+// ShaderRoundingModeRTEFloat64 returns the value of shaderRoundingModeRTEFloat64 from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) ShaderRoundingModeRTEFloat64() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderRoundingModeRTEFloat64)
+	return *ptr
+}
+
+// ShaderRoundingModeRTZFloat16 returns the value of shaderRoundingModeRTZFloat16 from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) ShaderRoundingModeRTZFloat16() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderRoundingModeRTZFloat16)
+	return *ptr
+}
+
+// ShaderRoundingModeRTZFloat32 returns the value of shaderRoundingModeRTZFloat32 from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) ShaderRoundingModeRTZFloat32() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderRoundingModeRTZFloat32)
+	return *ptr
+}
+
+// ShaderRoundingModeRTZFloat64 returns the value of shaderRoundingModeRTZFloat64 from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) ShaderRoundingModeRTZFloat64() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderRoundingModeRTZFloat64)
+	return *ptr
+}
+
+// MaxUpdateAfterBindDescriptorsInAllPools returns the value of maxUpdateAfterBindDescriptorsInAllPools from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) MaxUpdateAfterBindDescriptorsInAllPools() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxUpdateAfterBindDescriptorsInAllPools)
+	return *ptr
+}
+
+// ShaderUniformBufferArrayNonUniformIndexingNative returns the value of shaderUniformBufferArrayNonUniformIndexingNative from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) ShaderUniformBufferArrayNonUniformIndexingNative() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderUniformBufferArrayNonUniformIndexingNative)
+	return *ptr
+}
+
+// ShaderSampledImageArrayNonUniformIndexingNative returns the value of shaderSampledImageArrayNonUniformIndexingNative from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) ShaderSampledImageArrayNonUniformIndexingNative() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderSampledImageArrayNonUniformIndexingNative)
+	return *ptr
+}
+
+// ShaderStorageBufferArrayNonUniformIndexingNative returns the value of shaderStorageBufferArrayNonUniformIndexingNative from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) ShaderStorageBufferArrayNonUniformIndexingNative() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderStorageBufferArrayNonUniformIndexingNative)
+	return *ptr
+}
+
+// ShaderStorageImageArrayNonUniformIndexingNative returns the value of shaderStorageImageArrayNonUniformIndexingNative from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) ShaderStorageImageArrayNonUniformIndexingNative() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderStorageImageArrayNonUniformIndexingNative)
+	return *ptr
+}
+
+// ShaderInputAttachmentArrayNonUniformIndexingNative returns the value of shaderInputAttachmentArrayNonUniformIndexingNative from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) ShaderInputAttachmentArrayNonUniformIndexingNative() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderInputAttachmentArrayNonUniformIndexingNative)
+	return *ptr
+}
+
+// RobustBufferAccessUpdateAfterBind returns the value of robustBufferAccessUpdateAfterBind from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) RobustBufferAccessUpdateAfterBind() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.robustBufferAccessUpdateAfterBind)
+	return *ptr
+}
+
+// QuadDivergentImplicitLod returns the value of quadDivergentImplicitLod from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) QuadDivergentImplicitLod() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.quadDivergentImplicitLod)
+	return *ptr
+}
+
+// MaxPerStageDescriptorUpdateAfterBindSamplers returns the value of maxPerStageDescriptorUpdateAfterBindSamplers from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) MaxPerStageDescriptorUpdateAfterBindSamplers() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxPerStageDescriptorUpdateAfterBindSamplers)
+	return *ptr
+}
+
+// MaxPerStageDescriptorUpdateAfterBindUniformBuffers returns the value of maxPerStageDescriptorUpdateAfterBindUniformBuffers from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) MaxPerStageDescriptorUpdateAfterBindUniformBuffers() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxPerStageDescriptorUpdateAfterBindUniformBuffers)
+	return *ptr
+}
+
+// MaxPerStageDescriptorUpdateAfterBindStorageBuffers returns the value of maxPerStageDescriptorUpdateAfterBindStorageBuffers from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) MaxPerStageDescriptorUpdateAfterBindStorageBuffers() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxPerStageDescriptorUpdateAfterBindStorageBuffers)
+	return *ptr
+}
+
+// MaxPerStageDescriptorUpdateAfterBindSampledImages returns the value of maxPerStageDescriptorUpdateAfterBindSampledImages from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) MaxPerStageDescriptorUpdateAfterBindSampledImages() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxPerStageDescriptorUpdateAfterBindSampledImages)
+	return *ptr
+}
+
+// MaxPerStageDescriptorUpdateAfterBindStorageImages returns the value of maxPerStageDescriptorUpdateAfterBindStorageImages from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) MaxPerStageDescriptorUpdateAfterBindStorageImages() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxPerStageDescriptorUpdateAfterBindStorageImages)
+	return *ptr
+}
+
+// MaxPerStageDescriptorUpdateAfterBindInputAttachments returns the value of maxPerStageDescriptorUpdateAfterBindInputAttachments from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) MaxPerStageDescriptorUpdateAfterBindInputAttachments() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxPerStageDescriptorUpdateAfterBindInputAttachments)
+	return *ptr
+}
+
+// MaxPerStageUpdateAfterBindResources returns the value of maxPerStageUpdateAfterBindResources from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) MaxPerStageUpdateAfterBindResources() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxPerStageUpdateAfterBindResources)
+	return *ptr
+}
+
+// MaxDescriptorSetUpdateAfterBindSamplers returns the value of maxDescriptorSetUpdateAfterBindSamplers from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) MaxDescriptorSetUpdateAfterBindSamplers() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxDescriptorSetUpdateAfterBindSamplers)
+	return *ptr
+}
+
+// MaxDescriptorSetUpdateAfterBindUniformBuffers returns the value of maxDescriptorSetUpdateAfterBindUniformBuffers from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) MaxDescriptorSetUpdateAfterBindUniformBuffers() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxDescriptorSetUpdateAfterBindUniformBuffers)
+	return *ptr
+}
+
+// MaxDescriptorSetUpdateAfterBindUniformBuffersDynamic returns the value of maxDescriptorSetUpdateAfterBindUniformBuffersDynamic from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) MaxDescriptorSetUpdateAfterBindUniformBuffersDynamic() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxDescriptorSetUpdateAfterBindUniformBuffersDynamic)
+	return *ptr
+}
+
+// MaxDescriptorSetUpdateAfterBindStorageBuffers returns the value of maxDescriptorSetUpdateAfterBindStorageBuffers from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) MaxDescriptorSetUpdateAfterBindStorageBuffers() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxDescriptorSetUpdateAfterBindStorageBuffers)
+	return *ptr
+}
+
+// MaxDescriptorSetUpdateAfterBindStorageBuffersDynamic returns the value of maxDescriptorSetUpdateAfterBindStorageBuffersDynamic from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) MaxDescriptorSetUpdateAfterBindStorageBuffersDynamic() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxDescriptorSetUpdateAfterBindStorageBuffersDynamic)
+	return *ptr
+}
+
+// MaxDescriptorSetUpdateAfterBindSampledImages returns the value of maxDescriptorSetUpdateAfterBindSampledImages from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) MaxDescriptorSetUpdateAfterBindSampledImages() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxDescriptorSetUpdateAfterBindSampledImages)
+	return *ptr
+}
+
+// MaxDescriptorSetUpdateAfterBindStorageImages returns the value of maxDescriptorSetUpdateAfterBindStorageImages from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) MaxDescriptorSetUpdateAfterBindStorageImages() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxDescriptorSetUpdateAfterBindStorageImages)
+	return *ptr
+}
+
+// MaxDescriptorSetUpdateAfterBindInputAttachments returns the value of maxDescriptorSetUpdateAfterBindInputAttachments from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) MaxDescriptorSetUpdateAfterBindInputAttachments() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxDescriptorSetUpdateAfterBindInputAttachments)
+	return *ptr
+}
+
+// SupportedDepthResolveModes returns the value of supportedDepthResolveModes from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) SupportedDepthResolveModes() ResolveModeFlags {
+	ptr := /* typedef */ (*ResolveModeFlags)(&x.supportedDepthResolveModes)
+	return *ptr
+}
+
+// SupportedStencilResolveModes returns the value of supportedStencilResolveModes from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) SupportedStencilResolveModes() ResolveModeFlags {
+	ptr := /* typedef */ (*ResolveModeFlags)(&x.supportedStencilResolveModes)
+	return *ptr
+}
+
+// IndependentResolveNone returns the value of independentResolveNone from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) IndependentResolveNone() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.independentResolveNone)
+	return *ptr
+}
+
+// IndependentResolve returns the value of independentResolve from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) IndependentResolve() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.independentResolve)
+	return *ptr
+}
+
+// FilterMinmaxSingleComponentFormats returns the value of filterMinmaxSingleComponentFormats from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) FilterMinmaxSingleComponentFormats() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.filterMinmaxSingleComponentFormats)
+	return *ptr
+}
+
+// FilterMinmaxImageComponentMapping returns the value of filterMinmaxImageComponentMapping from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) FilterMinmaxImageComponentMapping() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.filterMinmaxImageComponentMapping)
+	return *ptr
+}
+
+// MaxTimelineSemaphoreValueDifference returns the value of maxTimelineSemaphoreValueDifference from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) MaxTimelineSemaphoreValueDifference() uint64 {
+	ptr := func(x *C.uint64_t) *uint64 { /* Scalar */ c2g := uint64(*x); return &c2g }(&x.maxTimelineSemaphoreValueDifference)
+	return *ptr
+}
+
+// FramebufferIntegerColorSampleCounts returns the value of framebufferIntegerColorSampleCounts from VkPhysicalDeviceVulkan12Properties
+func (x *PhysicalDeviceVulkan12Properties) FramebufferIntegerColorSampleCounts() SampleCountFlags {
+	ptr := /* typedef */ (*SampleCountFlags)(&x.framebufferIntegerColorSampleCounts)
+	return *ptr
+}
+
+// ImageStencilUsageCreateInfo provides a go interface for VkImageStencilUsageCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkImageStencilUsageCreateInfo.html
+type ImageStencilUsageCreateInfo C.struct_VkImageStencilUsageCreateInfo
+
+// SizeofImageStencilUsageCreateInfo is the memory size of a ImageStencilUsageCreateInfo
+var SizeofImageStencilUsageCreateInfo int = int(unsafe.Sizeof(ImageStencilUsageCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ImageStencilUsageCreateInfo) ArpPtr(arp *AutoReleasePool) *ImageStencilUsageCreateInfo {
+	ptr := newCBlock(cULong(SizeofImageStencilUsageCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ImageStencilUsageCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ImageStencilUsageCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ImageStencilUsageCreateInfo) AsCPtr() *ImageStencilUsageCreateInfo {
+	clone := (*ImageStencilUsageCreateInfo)(newCBlock(cULong(SizeofImageStencilUsageCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// ImageStencilUsageCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ImageStencilUsageCreateInfoCSlice(arp *AutoReleasePool, x ...ImageStencilUsageCreateInfo) []ImageStencilUsageCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImageStencilUsageCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ImageStencilUsageCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ImageStencilUsageCreateInfoFreeCSlice releases the memory allocated by ImageStencilUsageCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func ImageStencilUsageCreateInfoFreeCSlice(x []ImageStencilUsageCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ImageStencilUsageCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ImageStencilUsageCreateInfoFreeCSlice must be called on the returned slice.
+func ImageStencilUsageCreateInfoMakeCSlice(x ...ImageStencilUsageCreateInfo) []ImageStencilUsageCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImageStencilUsageCreateInfo * len(x)
+	dst := unsafe.Slice((*ImageStencilUsageCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkImageStencilUsageCreateInfo
+func (x ImageStencilUsageCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ImageStencilUsageCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x ImageStencilUsageCreateInfo) WithDefaultSType() ImageStencilUsageCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ImageStencilUsageCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO)
+}
+
+// WithSType clones a new ImageStencilUsageCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageStencilUsageCreateInfo) WithSType(y StructureType) ImageStencilUsageCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ImageStencilUsageCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkImageStencilUsageCreateInfo
+func (x ImageStencilUsageCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ImageStencilUsageCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageStencilUsageCreateInfo) WithPNext(y unsafe.Pointer) ImageStencilUsageCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ImageStencilUsageCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ImageStencilUsageCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// StencilUsage returns the value of stencilUsage from VkImageStencilUsageCreateInfo
+func (x ImageStencilUsageCreateInfo) StencilUsage() ImageUsageFlags {
+	ptr := /* typedef */ (*ImageUsageFlags)(&x.stencilUsage)
+	return *ptr
+}
+
+// WithStencilUsage clones a new ImageStencilUsageCreateInfo with the value of
+// StencilUsage updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageStencilUsageCreateInfo) WithStencilUsage(y ImageUsageFlags) ImageStencilUsageCreateInfo {
+	x.stencilUsage = *( /* typedef */ (*C.VkImageUsageFlags)(&y))
+	return x
+}
+func (x *ImageStencilUsageCreateInfo) SetStencilUsage(y ImageUsageFlags) {
+	x.stencilUsage = *( /* typedef */ (*C.VkImageUsageFlags)(&y))
+}
+
+// PhysicalDeviceVulkan12Features provides a go interface for VkPhysicalDeviceVulkan12Features.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceVulkan12Features.html
+type PhysicalDeviceVulkan12Features C.struct_VkPhysicalDeviceVulkan12Features
+
+// SizeofPhysicalDeviceVulkan12Features is the memory size of a PhysicalDeviceVulkan12Features
+var SizeofPhysicalDeviceVulkan12Features int = int(unsafe.Sizeof(PhysicalDeviceVulkan12Features{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceVulkan12Features) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceVulkan12Features {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceVulkan12Features))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceVulkan12Features)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceVulkan12Features) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceVulkan12Features) AsCPtr() *PhysicalDeviceVulkan12Features {
+	clone := (*PhysicalDeviceVulkan12Features)(newCBlock(cULong(SizeofPhysicalDeviceVulkan12Features)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceVulkan12FeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceVulkan12FeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceVulkan12Features) []PhysicalDeviceVulkan12Features {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceVulkan12Features * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceVulkan12Features)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceVulkan12FeaturesFreeCSlice releases the memory allocated by PhysicalDeviceVulkan12FeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceVulkan12FeaturesFreeCSlice(x []PhysicalDeviceVulkan12Features) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceVulkan12FeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceVulkan12FeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceVulkan12FeaturesMakeCSlice(x ...PhysicalDeviceVulkan12Features) []PhysicalDeviceVulkan12Features {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceVulkan12Features * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceVulkan12Features)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceVulkan12Features with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceVulkan12Features) WithDefaultSType() PhysicalDeviceVulkan12Features {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceVulkan12Features) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceVulkan12Features with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithSType(y StructureType) PhysicalDeviceVulkan12Features {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceVulkan12Features with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithPNext(y unsafe.Pointer) PhysicalDeviceVulkan12Features {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceVulkan12Features) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SamplerMirrorClampToEdge returns the value of samplerMirrorClampToEdge from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) SamplerMirrorClampToEdge() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.samplerMirrorClampToEdge)
+	return *ptr
+}
+
+// WithSamplerMirrorClampToEdge clones a new PhysicalDeviceVulkan12Features with the value of
+// SamplerMirrorClampToEdge updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithSamplerMirrorClampToEdge(y Bool32) PhysicalDeviceVulkan12Features {
+	x.samplerMirrorClampToEdge = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetSamplerMirrorClampToEdge(y Bool32) {
+	x.samplerMirrorClampToEdge = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DrawIndirectCount returns the value of drawIndirectCount from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) DrawIndirectCount() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.drawIndirectCount)
+	return *ptr
+}
+
+// WithDrawIndirectCount clones a new PhysicalDeviceVulkan12Features with the value of
+// DrawIndirectCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithDrawIndirectCount(y Bool32) PhysicalDeviceVulkan12Features {
+	x.drawIndirectCount = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetDrawIndirectCount(y Bool32) {
+	x.drawIndirectCount = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// StorageBuffer8BitAccess returns the value of storageBuffer8BitAccess from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) StorageBuffer8BitAccess() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.storageBuffer8BitAccess)
+	return *ptr
+}
+
+// WithStorageBuffer8BitAccess clones a new PhysicalDeviceVulkan12Features with the value of
+// StorageBuffer8BitAccess updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithStorageBuffer8BitAccess(y Bool32) PhysicalDeviceVulkan12Features {
+	x.storageBuffer8BitAccess = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetStorageBuffer8BitAccess(y Bool32) {
+	x.storageBuffer8BitAccess = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// UniformAndStorageBuffer8BitAccess returns the value of uniformAndStorageBuffer8BitAccess from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) UniformAndStorageBuffer8BitAccess() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.uniformAndStorageBuffer8BitAccess)
+	return *ptr
+}
+
+// WithUniformAndStorageBuffer8BitAccess clones a new PhysicalDeviceVulkan12Features with the value of
+// UniformAndStorageBuffer8BitAccess updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithUniformAndStorageBuffer8BitAccess(y Bool32) PhysicalDeviceVulkan12Features {
+	x.uniformAndStorageBuffer8BitAccess = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetUniformAndStorageBuffer8BitAccess(y Bool32) {
+	x.uniformAndStorageBuffer8BitAccess = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// StoragePushConstant8 returns the value of storagePushConstant8 from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) StoragePushConstant8() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.storagePushConstant8)
+	return *ptr
+}
+
+// WithStoragePushConstant8 clones a new PhysicalDeviceVulkan12Features with the value of
+// StoragePushConstant8 updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithStoragePushConstant8(y Bool32) PhysicalDeviceVulkan12Features {
+	x.storagePushConstant8 = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetStoragePushConstant8(y Bool32) {
+	x.storagePushConstant8 = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderBufferInt64Atomics returns the value of shaderBufferInt64Atomics from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) ShaderBufferInt64Atomics() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderBufferInt64Atomics)
+	return *ptr
+}
+
+// WithShaderBufferInt64Atomics clones a new PhysicalDeviceVulkan12Features with the value of
+// ShaderBufferInt64Atomics updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithShaderBufferInt64Atomics(y Bool32) PhysicalDeviceVulkan12Features {
+	x.shaderBufferInt64Atomics = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetShaderBufferInt64Atomics(y Bool32) {
+	x.shaderBufferInt64Atomics = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderSharedInt64Atomics returns the value of shaderSharedInt64Atomics from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) ShaderSharedInt64Atomics() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderSharedInt64Atomics)
+	return *ptr
+}
+
+// WithShaderSharedInt64Atomics clones a new PhysicalDeviceVulkan12Features with the value of
+// ShaderSharedInt64Atomics updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithShaderSharedInt64Atomics(y Bool32) PhysicalDeviceVulkan12Features {
+	x.shaderSharedInt64Atomics = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetShaderSharedInt64Atomics(y Bool32) {
+	x.shaderSharedInt64Atomics = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderFloat16 returns the value of shaderFloat16 from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) ShaderFloat16() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderFloat16)
+	return *ptr
+}
+
+// WithShaderFloat16 clones a new PhysicalDeviceVulkan12Features with the value of
+// ShaderFloat16 updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithShaderFloat16(y Bool32) PhysicalDeviceVulkan12Features {
+	x.shaderFloat16 = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetShaderFloat16(y Bool32) {
+	x.shaderFloat16 = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderInt8 returns the value of shaderInt8 from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) ShaderInt8() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderInt8)
+	return *ptr
+}
+
+// WithShaderInt8 clones a new PhysicalDeviceVulkan12Features with the value of
+// ShaderInt8 updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithShaderInt8(y Bool32) PhysicalDeviceVulkan12Features {
+	x.shaderInt8 = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetShaderInt8(y Bool32) {
+	x.shaderInt8 = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DescriptorIndexing returns the value of descriptorIndexing from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) DescriptorIndexing() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.descriptorIndexing)
+	return *ptr
+}
+
+// WithDescriptorIndexing clones a new PhysicalDeviceVulkan12Features with the value of
+// DescriptorIndexing updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithDescriptorIndexing(y Bool32) PhysicalDeviceVulkan12Features {
+	x.descriptorIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetDescriptorIndexing(y Bool32) {
+	x.descriptorIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderInputAttachmentArrayDynamicIndexing returns the value of shaderInputAttachmentArrayDynamicIndexing from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) ShaderInputAttachmentArrayDynamicIndexing() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderInputAttachmentArrayDynamicIndexing)
+	return *ptr
+}
+
+// WithShaderInputAttachmentArrayDynamicIndexing clones a new PhysicalDeviceVulkan12Features with the value of
+// ShaderInputAttachmentArrayDynamicIndexing updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithShaderInputAttachmentArrayDynamicIndexing(y Bool32) PhysicalDeviceVulkan12Features {
+	x.shaderInputAttachmentArrayDynamicIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetShaderInputAttachmentArrayDynamicIndexing(y Bool32) {
+	x.shaderInputAttachmentArrayDynamicIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderUniformTexelBufferArrayDynamicIndexing returns the value of shaderUniformTexelBufferArrayDynamicIndexing from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) ShaderUniformTexelBufferArrayDynamicIndexing() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderUniformTexelBufferArrayDynamicIndexing)
+	return *ptr
+}
+
+// WithShaderUniformTexelBufferArrayDynamicIndexing clones a new PhysicalDeviceVulkan12Features with the value of
+// ShaderUniformTexelBufferArrayDynamicIndexing updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithShaderUniformTexelBufferArrayDynamicIndexing(y Bool32) PhysicalDeviceVulkan12Features {
+	x.shaderUniformTexelBufferArrayDynamicIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetShaderUniformTexelBufferArrayDynamicIndexing(y Bool32) {
+	x.shaderUniformTexelBufferArrayDynamicIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderStorageTexelBufferArrayDynamicIndexing returns the value of shaderStorageTexelBufferArrayDynamicIndexing from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) ShaderStorageTexelBufferArrayDynamicIndexing() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderStorageTexelBufferArrayDynamicIndexing)
+	return *ptr
+}
+
+// WithShaderStorageTexelBufferArrayDynamicIndexing clones a new PhysicalDeviceVulkan12Features with the value of
+// ShaderStorageTexelBufferArrayDynamicIndexing updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithShaderStorageTexelBufferArrayDynamicIndexing(y Bool32) PhysicalDeviceVulkan12Features {
+	x.shaderStorageTexelBufferArrayDynamicIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetShaderStorageTexelBufferArrayDynamicIndexing(y Bool32) {
+	x.shaderStorageTexelBufferArrayDynamicIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderUniformBufferArrayNonUniformIndexing returns the value of shaderUniformBufferArrayNonUniformIndexing from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) ShaderUniformBufferArrayNonUniformIndexing() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderUniformBufferArrayNonUniformIndexing)
+	return *ptr
+}
+
+// WithShaderUniformBufferArrayNonUniformIndexing clones a new PhysicalDeviceVulkan12Features with the value of
+// ShaderUniformBufferArrayNonUniformIndexing updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithShaderUniformBufferArrayNonUniformIndexing(y Bool32) PhysicalDeviceVulkan12Features {
+	x.shaderUniformBufferArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetShaderUniformBufferArrayNonUniformIndexing(y Bool32) {
+	x.shaderUniformBufferArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderSampledImageArrayNonUniformIndexing returns the value of shaderSampledImageArrayNonUniformIndexing from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) ShaderSampledImageArrayNonUniformIndexing() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderSampledImageArrayNonUniformIndexing)
+	return *ptr
+}
+
+// WithShaderSampledImageArrayNonUniformIndexing clones a new PhysicalDeviceVulkan12Features with the value of
+// ShaderSampledImageArrayNonUniformIndexing updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithShaderSampledImageArrayNonUniformIndexing(y Bool32) PhysicalDeviceVulkan12Features {
+	x.shaderSampledImageArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetShaderSampledImageArrayNonUniformIndexing(y Bool32) {
+	x.shaderSampledImageArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderStorageBufferArrayNonUniformIndexing returns the value of shaderStorageBufferArrayNonUniformIndexing from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) ShaderStorageBufferArrayNonUniformIndexing() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderStorageBufferArrayNonUniformIndexing)
+	return *ptr
+}
+
+// WithShaderStorageBufferArrayNonUniformIndexing clones a new PhysicalDeviceVulkan12Features with the value of
+// ShaderStorageBufferArrayNonUniformIndexing updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithShaderStorageBufferArrayNonUniformIndexing(y Bool32) PhysicalDeviceVulkan12Features {
+	x.shaderStorageBufferArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetShaderStorageBufferArrayNonUniformIndexing(y Bool32) {
+	x.shaderStorageBufferArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderStorageImageArrayNonUniformIndexing returns the value of shaderStorageImageArrayNonUniformIndexing from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) ShaderStorageImageArrayNonUniformIndexing() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderStorageImageArrayNonUniformIndexing)
+	return *ptr
+}
+
+// WithShaderStorageImageArrayNonUniformIndexing clones a new PhysicalDeviceVulkan12Features with the value of
+// ShaderStorageImageArrayNonUniformIndexing updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithShaderStorageImageArrayNonUniformIndexing(y Bool32) PhysicalDeviceVulkan12Features {
+	x.shaderStorageImageArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetShaderStorageImageArrayNonUniformIndexing(y Bool32) {
+	x.shaderStorageImageArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderInputAttachmentArrayNonUniformIndexing returns the value of shaderInputAttachmentArrayNonUniformIndexing from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) ShaderInputAttachmentArrayNonUniformIndexing() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderInputAttachmentArrayNonUniformIndexing)
+	return *ptr
+}
+
+// WithShaderInputAttachmentArrayNonUniformIndexing clones a new PhysicalDeviceVulkan12Features with the value of
+// ShaderInputAttachmentArrayNonUniformIndexing updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithShaderInputAttachmentArrayNonUniformIndexing(y Bool32) PhysicalDeviceVulkan12Features {
+	x.shaderInputAttachmentArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetShaderInputAttachmentArrayNonUniformIndexing(y Bool32) {
+	x.shaderInputAttachmentArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderUniformTexelBufferArrayNonUniformIndexing returns the value of shaderUniformTexelBufferArrayNonUniformIndexing from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) ShaderUniformTexelBufferArrayNonUniformIndexing() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderUniformTexelBufferArrayNonUniformIndexing)
+	return *ptr
+}
+
+// WithShaderUniformTexelBufferArrayNonUniformIndexing clones a new PhysicalDeviceVulkan12Features with the value of
+// ShaderUniformTexelBufferArrayNonUniformIndexing updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithShaderUniformTexelBufferArrayNonUniformIndexing(y Bool32) PhysicalDeviceVulkan12Features {
+	x.shaderUniformTexelBufferArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetShaderUniformTexelBufferArrayNonUniformIndexing(y Bool32) {
+	x.shaderUniformTexelBufferArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderStorageTexelBufferArrayNonUniformIndexing returns the value of shaderStorageTexelBufferArrayNonUniformIndexing from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) ShaderStorageTexelBufferArrayNonUniformIndexing() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderStorageTexelBufferArrayNonUniformIndexing)
+	return *ptr
+}
+
+// WithShaderStorageTexelBufferArrayNonUniformIndexing clones a new PhysicalDeviceVulkan12Features with the value of
+// ShaderStorageTexelBufferArrayNonUniformIndexing updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithShaderStorageTexelBufferArrayNonUniformIndexing(y Bool32) PhysicalDeviceVulkan12Features {
+	x.shaderStorageTexelBufferArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetShaderStorageTexelBufferArrayNonUniformIndexing(y Bool32) {
+	x.shaderStorageTexelBufferArrayNonUniformIndexing = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DescriptorBindingUniformBufferUpdateAfterBind returns the value of descriptorBindingUniformBufferUpdateAfterBind from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) DescriptorBindingUniformBufferUpdateAfterBind() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.descriptorBindingUniformBufferUpdateAfterBind)
+	return *ptr
+}
+
+// WithDescriptorBindingUniformBufferUpdateAfterBind clones a new PhysicalDeviceVulkan12Features with the value of
+// DescriptorBindingUniformBufferUpdateAfterBind updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithDescriptorBindingUniformBufferUpdateAfterBind(y Bool32) PhysicalDeviceVulkan12Features {
+	x.descriptorBindingUniformBufferUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetDescriptorBindingUniformBufferUpdateAfterBind(y Bool32) {
+	x.descriptorBindingUniformBufferUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DescriptorBindingSampledImageUpdateAfterBind returns the value of descriptorBindingSampledImageUpdateAfterBind from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) DescriptorBindingSampledImageUpdateAfterBind() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.descriptorBindingSampledImageUpdateAfterBind)
+	return *ptr
+}
+
+// WithDescriptorBindingSampledImageUpdateAfterBind clones a new PhysicalDeviceVulkan12Features with the value of
+// DescriptorBindingSampledImageUpdateAfterBind updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithDescriptorBindingSampledImageUpdateAfterBind(y Bool32) PhysicalDeviceVulkan12Features {
+	x.descriptorBindingSampledImageUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetDescriptorBindingSampledImageUpdateAfterBind(y Bool32) {
+	x.descriptorBindingSampledImageUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DescriptorBindingStorageImageUpdateAfterBind returns the value of descriptorBindingStorageImageUpdateAfterBind from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) DescriptorBindingStorageImageUpdateAfterBind() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.descriptorBindingStorageImageUpdateAfterBind)
+	return *ptr
+}
+
+// WithDescriptorBindingStorageImageUpdateAfterBind clones a new PhysicalDeviceVulkan12Features with the value of
+// DescriptorBindingStorageImageUpdateAfterBind updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithDescriptorBindingStorageImageUpdateAfterBind(y Bool32) PhysicalDeviceVulkan12Features {
+	x.descriptorBindingStorageImageUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetDescriptorBindingStorageImageUpdateAfterBind(y Bool32) {
+	x.descriptorBindingStorageImageUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DescriptorBindingStorageBufferUpdateAfterBind returns the value of descriptorBindingStorageBufferUpdateAfterBind from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) DescriptorBindingStorageBufferUpdateAfterBind() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.descriptorBindingStorageBufferUpdateAfterBind)
+	return *ptr
+}
+
+// WithDescriptorBindingStorageBufferUpdateAfterBind clones a new PhysicalDeviceVulkan12Features with the value of
+// DescriptorBindingStorageBufferUpdateAfterBind updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithDescriptorBindingStorageBufferUpdateAfterBind(y Bool32) PhysicalDeviceVulkan12Features {
+	x.descriptorBindingStorageBufferUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetDescriptorBindingStorageBufferUpdateAfterBind(y Bool32) {
+	x.descriptorBindingStorageBufferUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DescriptorBindingUniformTexelBufferUpdateAfterBind returns the value of descriptorBindingUniformTexelBufferUpdateAfterBind from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) DescriptorBindingUniformTexelBufferUpdateAfterBind() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.descriptorBindingUniformTexelBufferUpdateAfterBind)
+	return *ptr
+}
+
+// WithDescriptorBindingUniformTexelBufferUpdateAfterBind clones a new PhysicalDeviceVulkan12Features with the value of
+// DescriptorBindingUniformTexelBufferUpdateAfterBind updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithDescriptorBindingUniformTexelBufferUpdateAfterBind(y Bool32) PhysicalDeviceVulkan12Features {
+	x.descriptorBindingUniformTexelBufferUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetDescriptorBindingUniformTexelBufferUpdateAfterBind(y Bool32) {
+	x.descriptorBindingUniformTexelBufferUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DescriptorBindingStorageTexelBufferUpdateAfterBind returns the value of descriptorBindingStorageTexelBufferUpdateAfterBind from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) DescriptorBindingStorageTexelBufferUpdateAfterBind() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.descriptorBindingStorageTexelBufferUpdateAfterBind)
+	return *ptr
+}
+
+// WithDescriptorBindingStorageTexelBufferUpdateAfterBind clones a new PhysicalDeviceVulkan12Features with the value of
+// DescriptorBindingStorageTexelBufferUpdateAfterBind updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithDescriptorBindingStorageTexelBufferUpdateAfterBind(y Bool32) PhysicalDeviceVulkan12Features {
+	x.descriptorBindingStorageTexelBufferUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetDescriptorBindingStorageTexelBufferUpdateAfterBind(y Bool32) {
+	x.descriptorBindingStorageTexelBufferUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DescriptorBindingUpdateUnusedWhilePending returns the value of descriptorBindingUpdateUnusedWhilePending from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) DescriptorBindingUpdateUnusedWhilePending() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.descriptorBindingUpdateUnusedWhilePending)
+	return *ptr
+}
+
+// WithDescriptorBindingUpdateUnusedWhilePending clones a new PhysicalDeviceVulkan12Features with the value of
+// DescriptorBindingUpdateUnusedWhilePending updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithDescriptorBindingUpdateUnusedWhilePending(y Bool32) PhysicalDeviceVulkan12Features {
+	x.descriptorBindingUpdateUnusedWhilePending = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetDescriptorBindingUpdateUnusedWhilePending(y Bool32) {
+	x.descriptorBindingUpdateUnusedWhilePending = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DescriptorBindingPartiallyBound returns the value of descriptorBindingPartiallyBound from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) DescriptorBindingPartiallyBound() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.descriptorBindingPartiallyBound)
+	return *ptr
+}
+
+// WithDescriptorBindingPartiallyBound clones a new PhysicalDeviceVulkan12Features with the value of
+// DescriptorBindingPartiallyBound updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithDescriptorBindingPartiallyBound(y Bool32) PhysicalDeviceVulkan12Features {
+	x.descriptorBindingPartiallyBound = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetDescriptorBindingPartiallyBound(y Bool32) {
+	x.descriptorBindingPartiallyBound = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DescriptorBindingVariableDescriptorCount returns the value of descriptorBindingVariableDescriptorCount from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) DescriptorBindingVariableDescriptorCount() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.descriptorBindingVariableDescriptorCount)
+	return *ptr
+}
+
+// WithDescriptorBindingVariableDescriptorCount clones a new PhysicalDeviceVulkan12Features with the value of
+// DescriptorBindingVariableDescriptorCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithDescriptorBindingVariableDescriptorCount(y Bool32) PhysicalDeviceVulkan12Features {
+	x.descriptorBindingVariableDescriptorCount = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetDescriptorBindingVariableDescriptorCount(y Bool32) {
+	x.descriptorBindingVariableDescriptorCount = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// RuntimeDescriptorArray returns the value of runtimeDescriptorArray from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) RuntimeDescriptorArray() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.runtimeDescriptorArray)
+	return *ptr
+}
+
+// WithRuntimeDescriptorArray clones a new PhysicalDeviceVulkan12Features with the value of
+// RuntimeDescriptorArray updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithRuntimeDescriptorArray(y Bool32) PhysicalDeviceVulkan12Features {
+	x.runtimeDescriptorArray = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetRuntimeDescriptorArray(y Bool32) {
+	x.runtimeDescriptorArray = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// SamplerFilterMinmax returns the value of samplerFilterMinmax from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) SamplerFilterMinmax() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.samplerFilterMinmax)
+	return *ptr
+}
+
+// WithSamplerFilterMinmax clones a new PhysicalDeviceVulkan12Features with the value of
+// SamplerFilterMinmax updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithSamplerFilterMinmax(y Bool32) PhysicalDeviceVulkan12Features {
+	x.samplerFilterMinmax = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetSamplerFilterMinmax(y Bool32) {
+	x.samplerFilterMinmax = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ScalarBlockLayout returns the value of scalarBlockLayout from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) ScalarBlockLayout() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.scalarBlockLayout)
+	return *ptr
+}
+
+// WithScalarBlockLayout clones a new PhysicalDeviceVulkan12Features with the value of
+// ScalarBlockLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithScalarBlockLayout(y Bool32) PhysicalDeviceVulkan12Features {
+	x.scalarBlockLayout = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetScalarBlockLayout(y Bool32) {
+	x.scalarBlockLayout = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ImagelessFramebuffer returns the value of imagelessFramebuffer from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) ImagelessFramebuffer() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.imagelessFramebuffer)
+	return *ptr
+}
+
+// WithImagelessFramebuffer clones a new PhysicalDeviceVulkan12Features with the value of
+// ImagelessFramebuffer updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithImagelessFramebuffer(y Bool32) PhysicalDeviceVulkan12Features {
+	x.imagelessFramebuffer = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetImagelessFramebuffer(y Bool32) {
+	x.imagelessFramebuffer = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// UniformBufferStandardLayout returns the value of uniformBufferStandardLayout from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) UniformBufferStandardLayout() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.uniformBufferStandardLayout)
+	return *ptr
+}
+
+// WithUniformBufferStandardLayout clones a new PhysicalDeviceVulkan12Features with the value of
+// UniformBufferStandardLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithUniformBufferStandardLayout(y Bool32) PhysicalDeviceVulkan12Features {
+	x.uniformBufferStandardLayout = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetUniformBufferStandardLayout(y Bool32) {
+	x.uniformBufferStandardLayout = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderSubgroupExtendedTypes returns the value of shaderSubgroupExtendedTypes from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) ShaderSubgroupExtendedTypes() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderSubgroupExtendedTypes)
+	return *ptr
+}
+
+// WithShaderSubgroupExtendedTypes clones a new PhysicalDeviceVulkan12Features with the value of
+// ShaderSubgroupExtendedTypes updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithShaderSubgroupExtendedTypes(y Bool32) PhysicalDeviceVulkan12Features {
+	x.shaderSubgroupExtendedTypes = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetShaderSubgroupExtendedTypes(y Bool32) {
+	x.shaderSubgroupExtendedTypes = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// SeparateDepthStencilLayouts returns the value of separateDepthStencilLayouts from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) SeparateDepthStencilLayouts() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.separateDepthStencilLayouts)
+	return *ptr
+}
+
+// WithSeparateDepthStencilLayouts clones a new PhysicalDeviceVulkan12Features with the value of
+// SeparateDepthStencilLayouts updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithSeparateDepthStencilLayouts(y Bool32) PhysicalDeviceVulkan12Features {
+	x.separateDepthStencilLayouts = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetSeparateDepthStencilLayouts(y Bool32) {
+	x.separateDepthStencilLayouts = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// HostQueryReset returns the value of hostQueryReset from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) HostQueryReset() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.hostQueryReset)
+	return *ptr
+}
+
+// WithHostQueryReset clones a new PhysicalDeviceVulkan12Features with the value of
+// HostQueryReset updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithHostQueryReset(y Bool32) PhysicalDeviceVulkan12Features {
+	x.hostQueryReset = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetHostQueryReset(y Bool32) {
+	x.hostQueryReset = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// TimelineSemaphore returns the value of timelineSemaphore from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) TimelineSemaphore() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.timelineSemaphore)
+	return *ptr
+}
+
+// WithTimelineSemaphore clones a new PhysicalDeviceVulkan12Features with the value of
+// TimelineSemaphore updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithTimelineSemaphore(y Bool32) PhysicalDeviceVulkan12Features {
+	x.timelineSemaphore = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetTimelineSemaphore(y Bool32) {
+	x.timelineSemaphore = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// BufferDeviceAddress returns the value of bufferDeviceAddress from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) BufferDeviceAddress() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.bufferDeviceAddress)
+	return *ptr
+}
+
+// WithBufferDeviceAddress clones a new PhysicalDeviceVulkan12Features with the value of
+// BufferDeviceAddress updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithBufferDeviceAddress(y Bool32) PhysicalDeviceVulkan12Features {
+	x.bufferDeviceAddress = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetBufferDeviceAddress(y Bool32) {
+	x.bufferDeviceAddress = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// BufferDeviceAddressCaptureReplay returns the value of bufferDeviceAddressCaptureReplay from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) BufferDeviceAddressCaptureReplay() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.bufferDeviceAddressCaptureReplay)
+	return *ptr
+}
+
+// WithBufferDeviceAddressCaptureReplay clones a new PhysicalDeviceVulkan12Features with the value of
+// BufferDeviceAddressCaptureReplay updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithBufferDeviceAddressCaptureReplay(y Bool32) PhysicalDeviceVulkan12Features {
+	x.bufferDeviceAddressCaptureReplay = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetBufferDeviceAddressCaptureReplay(y Bool32) {
+	x.bufferDeviceAddressCaptureReplay = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// BufferDeviceAddressMultiDevice returns the value of bufferDeviceAddressMultiDevice from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) BufferDeviceAddressMultiDevice() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.bufferDeviceAddressMultiDevice)
+	return *ptr
+}
+
+// WithBufferDeviceAddressMultiDevice clones a new PhysicalDeviceVulkan12Features with the value of
+// BufferDeviceAddressMultiDevice updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithBufferDeviceAddressMultiDevice(y Bool32) PhysicalDeviceVulkan12Features {
+	x.bufferDeviceAddressMultiDevice = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetBufferDeviceAddressMultiDevice(y Bool32) {
+	x.bufferDeviceAddressMultiDevice = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// VulkanMemoryModel returns the value of vulkanMemoryModel from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) VulkanMemoryModel() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.vulkanMemoryModel)
+	return *ptr
+}
+
+// WithVulkanMemoryModel clones a new PhysicalDeviceVulkan12Features with the value of
+// VulkanMemoryModel updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithVulkanMemoryModel(y Bool32) PhysicalDeviceVulkan12Features {
+	x.vulkanMemoryModel = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetVulkanMemoryModel(y Bool32) {
+	x.vulkanMemoryModel = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// VulkanMemoryModelDeviceScope returns the value of vulkanMemoryModelDeviceScope from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) VulkanMemoryModelDeviceScope() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.vulkanMemoryModelDeviceScope)
+	return *ptr
+}
+
+// WithVulkanMemoryModelDeviceScope clones a new PhysicalDeviceVulkan12Features with the value of
+// VulkanMemoryModelDeviceScope updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithVulkanMemoryModelDeviceScope(y Bool32) PhysicalDeviceVulkan12Features {
+	x.vulkanMemoryModelDeviceScope = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetVulkanMemoryModelDeviceScope(y Bool32) {
+	x.vulkanMemoryModelDeviceScope = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// VulkanMemoryModelAvailabilityVisibilityChains returns the value of vulkanMemoryModelAvailabilityVisibilityChains from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) VulkanMemoryModelAvailabilityVisibilityChains() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.vulkanMemoryModelAvailabilityVisibilityChains)
+	return *ptr
+}
+
+// WithVulkanMemoryModelAvailabilityVisibilityChains clones a new PhysicalDeviceVulkan12Features with the value of
+// VulkanMemoryModelAvailabilityVisibilityChains updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithVulkanMemoryModelAvailabilityVisibilityChains(y Bool32) PhysicalDeviceVulkan12Features {
+	x.vulkanMemoryModelAvailabilityVisibilityChains = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetVulkanMemoryModelAvailabilityVisibilityChains(y Bool32) {
+	x.vulkanMemoryModelAvailabilityVisibilityChains = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderOutputViewportIndex returns the value of shaderOutputViewportIndex from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) ShaderOutputViewportIndex() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderOutputViewportIndex)
+	return *ptr
+}
+
+// WithShaderOutputViewportIndex clones a new PhysicalDeviceVulkan12Features with the value of
+// ShaderOutputViewportIndex updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithShaderOutputViewportIndex(y Bool32) PhysicalDeviceVulkan12Features {
+	x.shaderOutputViewportIndex = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetShaderOutputViewportIndex(y Bool32) {
+	x.shaderOutputViewportIndex = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderOutputLayer returns the value of shaderOutputLayer from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) ShaderOutputLayer() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderOutputLayer)
+	return *ptr
+}
+
+// WithShaderOutputLayer clones a new PhysicalDeviceVulkan12Features with the value of
+// ShaderOutputLayer updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithShaderOutputLayer(y Bool32) PhysicalDeviceVulkan12Features {
+	x.shaderOutputLayer = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetShaderOutputLayer(y Bool32) {
+	x.shaderOutputLayer = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// SubgroupBroadcastDynamicId returns the value of subgroupBroadcastDynamicId from VkPhysicalDeviceVulkan12Features
+func (x *PhysicalDeviceVulkan12Features) SubgroupBroadcastDynamicId() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.subgroupBroadcastDynamicId)
+	return *ptr
+}
+
+// WithSubgroupBroadcastDynamicId clones a new PhysicalDeviceVulkan12Features with the value of
+// SubgroupBroadcastDynamicId updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan12Features) WithSubgroupBroadcastDynamicId(y Bool32) PhysicalDeviceVulkan12Features {
+	x.subgroupBroadcastDynamicId = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan12Features) SetSubgroupBroadcastDynamicId(y Bool32) {
+	x.subgroupBroadcastDynamicId = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PhysicalDeviceScalarBlockLayoutFeatures provides a go interface for VkPhysicalDeviceScalarBlockLayoutFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceScalarBlockLayoutFeatures.html
+type PhysicalDeviceScalarBlockLayoutFeatures C.struct_VkPhysicalDeviceScalarBlockLayoutFeatures
+
+// SizeofPhysicalDeviceScalarBlockLayoutFeatures is the memory size of a PhysicalDeviceScalarBlockLayoutFeatures
+var SizeofPhysicalDeviceScalarBlockLayoutFeatures int = int(unsafe.Sizeof(PhysicalDeviceScalarBlockLayoutFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceScalarBlockLayoutFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceScalarBlockLayoutFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceScalarBlockLayoutFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceScalarBlockLayoutFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceScalarBlockLayoutFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceScalarBlockLayoutFeatures) AsCPtr() *PhysicalDeviceScalarBlockLayoutFeatures {
+	clone := (*PhysicalDeviceScalarBlockLayoutFeatures)(newCBlock(cULong(SizeofPhysicalDeviceScalarBlockLayoutFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceScalarBlockLayoutFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceScalarBlockLayoutFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceScalarBlockLayoutFeatures) []PhysicalDeviceScalarBlockLayoutFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceScalarBlockLayoutFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceScalarBlockLayoutFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceScalarBlockLayoutFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceScalarBlockLayoutFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceScalarBlockLayoutFeaturesFreeCSlice(x []PhysicalDeviceScalarBlockLayoutFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceScalarBlockLayoutFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceScalarBlockLayoutFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceScalarBlockLayoutFeaturesMakeCSlice(x ...PhysicalDeviceScalarBlockLayoutFeatures) []PhysicalDeviceScalarBlockLayoutFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceScalarBlockLayoutFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceScalarBlockLayoutFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceScalarBlockLayoutFeatures
+func (x PhysicalDeviceScalarBlockLayoutFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceScalarBlockLayoutFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceScalarBlockLayoutFeatures) WithDefaultSType() PhysicalDeviceScalarBlockLayoutFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceScalarBlockLayoutFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceScalarBlockLayoutFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceScalarBlockLayoutFeatures) WithSType(y StructureType) PhysicalDeviceScalarBlockLayoutFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceScalarBlockLayoutFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceScalarBlockLayoutFeatures
+func (x PhysicalDeviceScalarBlockLayoutFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceScalarBlockLayoutFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceScalarBlockLayoutFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceScalarBlockLayoutFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceScalarBlockLayoutFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceScalarBlockLayoutFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ScalarBlockLayout returns the value of scalarBlockLayout from VkPhysicalDeviceScalarBlockLayoutFeatures
+func (x PhysicalDeviceScalarBlockLayoutFeatures) ScalarBlockLayout() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.scalarBlockLayout)
+	return *ptr
+}
+
+// WithScalarBlockLayout clones a new PhysicalDeviceScalarBlockLayoutFeatures with the value of
+// ScalarBlockLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceScalarBlockLayoutFeatures) WithScalarBlockLayout(y Bool32) PhysicalDeviceScalarBlockLayoutFeatures {
+	x.scalarBlockLayout = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceScalarBlockLayoutFeatures) SetScalarBlockLayout(y Bool32) {
+	x.scalarBlockLayout = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PhysicalDeviceVulkan11Properties provides a go interface for VkPhysicalDeviceVulkan11Properties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceVulkan11Properties.html
+type PhysicalDeviceVulkan11Properties C.struct_VkPhysicalDeviceVulkan11Properties
+
+// SizeofPhysicalDeviceVulkan11Properties is the memory size of a PhysicalDeviceVulkan11Properties
+var SizeofPhysicalDeviceVulkan11Properties int = int(unsafe.Sizeof(PhysicalDeviceVulkan11Properties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceVulkan11Properties) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceVulkan11Properties {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceVulkan11Properties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceVulkan11Properties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceVulkan11Properties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceVulkan11Properties) AsCPtr() *PhysicalDeviceVulkan11Properties {
+	clone := (*PhysicalDeviceVulkan11Properties)(newCBlock(cULong(SizeofPhysicalDeviceVulkan11Properties)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceVulkan11PropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceVulkan11PropertiesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceVulkan11Properties) []PhysicalDeviceVulkan11Properties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceVulkan11Properties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceVulkan11Properties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceVulkan11PropertiesFreeCSlice releases the memory allocated by PhysicalDeviceVulkan11PropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceVulkan11PropertiesFreeCSlice(x []PhysicalDeviceVulkan11Properties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceVulkan11PropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceVulkan11PropertiesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceVulkan11PropertiesMakeCSlice(x ...PhysicalDeviceVulkan11Properties) []PhysicalDeviceVulkan11Properties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceVulkan11Properties * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceVulkan11Properties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceVulkan11Properties
+func (x *PhysicalDeviceVulkan11Properties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceVulkan11Properties with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceVulkan11Properties) WithDefaultSType() PhysicalDeviceVulkan11Properties {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceVulkan11Properties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES)
+}
+
+// WithSType clones a new PhysicalDeviceVulkan11Properties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan11Properties) WithSType(y StructureType) PhysicalDeviceVulkan11Properties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan11Properties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceVulkan11Properties
+func (x *PhysicalDeviceVulkan11Properties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceVulkan11Properties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan11Properties) WithPNext(y unsafe.Pointer) PhysicalDeviceVulkan11Properties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan11Properties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceVulkan11Properties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// DeviceUUID returns the value of deviceUUID from VkPhysicalDeviceVulkan11Properties
+// The slice references the array in x; it is not a copy.
+func (x *PhysicalDeviceVulkan11Properties) DeviceUUID() []byte {
+	ptr := func(x *[VK_UUID_SIZE]C.uint8_t) *[]byte { /* Array for byte */
+		slc := unsafe.Slice((*byte)(unsafe.Pointer(x)), VK_UUID_SIZE)
+		return &slc
+	}(&x.deviceUUID)
+	return *ptr
+}
+
+// DriverUUID returns the value of driverUUID from VkPhysicalDeviceVulkan11Properties
+// The slice references the array in x; it is not a copy.
+func (x *PhysicalDeviceVulkan11Properties) DriverUUID() []byte {
+	ptr := func(x *[VK_UUID_SIZE]C.uint8_t) *[]byte { /* Array for byte */
+		slc := unsafe.Slice((*byte)(unsafe.Pointer(x)), VK_UUID_SIZE)
+		return &slc
+	}(&x.driverUUID)
+	return *ptr
+}
+
+// DeviceLUID returns the value of deviceLUID from VkPhysicalDeviceVulkan11Properties
+// The slice references the array in x; it is not a copy.
+func (x *PhysicalDeviceVulkan11Properties) DeviceLUID() []byte {
+	ptr := func(x *[VK_LUID_SIZE]C.uint8_t) *[]byte { /* Array for byte */
+		slc := unsafe.Slice((*byte)(unsafe.Pointer(x)), VK_LUID_SIZE)
+		return &slc
+	}(&x.deviceLUID)
+	return *ptr
+}
+
+// DeviceNodeMask returns the value of deviceNodeMask from VkPhysicalDeviceVulkan11Properties
+func (x *PhysicalDeviceVulkan11Properties) DeviceNodeMask() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.deviceNodeMask)
+	return *ptr
+}
+
+// DeviceLUIDValid returns the value of deviceLUIDValid from VkPhysicalDeviceVulkan11Properties
+func (x *PhysicalDeviceVulkan11Properties) DeviceLUIDValid() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.deviceLUIDValid)
+	return *ptr
+}
+
+// SubgroupSize returns the value of subgroupSize from VkPhysicalDeviceVulkan11Properties
+func (x *PhysicalDeviceVulkan11Properties) SubgroupSize() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.subgroupSize)
+	return *ptr
+}
+
+// SubgroupSupportedStages returns the value of subgroupSupportedStages from VkPhysicalDeviceVulkan11Properties
+func (x *PhysicalDeviceVulkan11Properties) SubgroupSupportedStages() ShaderStageFlags {
+	ptr := /* typedef */ (*ShaderStageFlags)(&x.subgroupSupportedStages)
+	return *ptr
+}
+
+// SubgroupSupportedOperations returns the value of subgroupSupportedOperations from VkPhysicalDeviceVulkan11Properties
+func (x *PhysicalDeviceVulkan11Properties) SubgroupSupportedOperations() SubgroupFeatureFlags {
+	ptr := /* typedef */ (*SubgroupFeatureFlags)(&x.subgroupSupportedOperations)
+	return *ptr
+}
+
+// SubgroupQuadOperationsInAllStages returns the value of subgroupQuadOperationsInAllStages from VkPhysicalDeviceVulkan11Properties
+func (x *PhysicalDeviceVulkan11Properties) SubgroupQuadOperationsInAllStages() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.subgroupQuadOperationsInAllStages)
+	return *ptr
+}
+
+// PointClippingBehavior returns the value of pointClippingBehavior from VkPhysicalDeviceVulkan11Properties
+func (x *PhysicalDeviceVulkan11Properties) PointClippingBehavior() PointClippingBehavior {
+	ptr := /* typedef */ (*PointClippingBehavior)(&x.pointClippingBehavior)
+	return *ptr
+}
+
+// MaxMultiviewViewCount returns the value of maxMultiviewViewCount from VkPhysicalDeviceVulkan11Properties
+func (x *PhysicalDeviceVulkan11Properties) MaxMultiviewViewCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxMultiviewViewCount)
+	return *ptr
+}
+
+// MaxMultiviewInstanceIndex returns the value of maxMultiviewInstanceIndex from VkPhysicalDeviceVulkan11Properties
+func (x *PhysicalDeviceVulkan11Properties) MaxMultiviewInstanceIndex() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxMultiviewInstanceIndex)
+	return *ptr
+}
+
+// ProtectedNoFault returns the value of protectedNoFault from VkPhysicalDeviceVulkan11Properties
+func (x *PhysicalDeviceVulkan11Properties) ProtectedNoFault() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.protectedNoFault)
+	return *ptr
+}
+
+// MaxPerSetDescriptors returns the value of maxPerSetDescriptors from VkPhysicalDeviceVulkan11Properties
+func (x *PhysicalDeviceVulkan11Properties) MaxPerSetDescriptors() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxPerSetDescriptors)
+	return *ptr
+}
+
+// MaxMemoryAllocationSize returns the value of maxMemoryAllocationSize from VkPhysicalDeviceVulkan11Properties
+func (x *PhysicalDeviceVulkan11Properties) MaxMemoryAllocationSize() DeviceSize {
+	ptr := /* typedef */ (*DeviceSize)(&x.maxMemoryAllocationSize)
+	return *ptr
+}
+
+// PhysicalDeviceVulkan11Features provides a go interface for VkPhysicalDeviceVulkan11Features.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceVulkan11Features.html
+type PhysicalDeviceVulkan11Features C.struct_VkPhysicalDeviceVulkan11Features
+
+// SizeofPhysicalDeviceVulkan11Features is the memory size of a PhysicalDeviceVulkan11Features
+var SizeofPhysicalDeviceVulkan11Features int = int(unsafe.Sizeof(PhysicalDeviceVulkan11Features{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceVulkan11Features) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceVulkan11Features {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceVulkan11Features))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceVulkan11Features)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceVulkan11Features) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceVulkan11Features) AsCPtr() *PhysicalDeviceVulkan11Features {
+	clone := (*PhysicalDeviceVulkan11Features)(newCBlock(cULong(SizeofPhysicalDeviceVulkan11Features)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceVulkan11FeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceVulkan11FeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceVulkan11Features) []PhysicalDeviceVulkan11Features {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceVulkan11Features * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceVulkan11Features)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceVulkan11FeaturesFreeCSlice releases the memory allocated by PhysicalDeviceVulkan11FeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceVulkan11FeaturesFreeCSlice(x []PhysicalDeviceVulkan11Features) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceVulkan11FeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceVulkan11FeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceVulkan11FeaturesMakeCSlice(x ...PhysicalDeviceVulkan11Features) []PhysicalDeviceVulkan11Features {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceVulkan11Features * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceVulkan11Features)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceVulkan11Features
+func (x PhysicalDeviceVulkan11Features) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceVulkan11Features with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceVulkan11Features) WithDefaultSType() PhysicalDeviceVulkan11Features {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceVulkan11Features) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceVulkan11Features with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan11Features) WithSType(y StructureType) PhysicalDeviceVulkan11Features {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan11Features) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceVulkan11Features
+func (x PhysicalDeviceVulkan11Features) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceVulkan11Features with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan11Features) WithPNext(y unsafe.Pointer) PhysicalDeviceVulkan11Features {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan11Features) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceVulkan11Features) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// StorageBuffer16BitAccess returns the value of storageBuffer16BitAccess from VkPhysicalDeviceVulkan11Features
+func (x PhysicalDeviceVulkan11Features) StorageBuffer16BitAccess() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.storageBuffer16BitAccess)
+	return *ptr
+}
+
+// WithStorageBuffer16BitAccess clones a new PhysicalDeviceVulkan11Features with the value of
+// StorageBuffer16BitAccess updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan11Features) WithStorageBuffer16BitAccess(y Bool32) PhysicalDeviceVulkan11Features {
+	x.storageBuffer16BitAccess = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan11Features) SetStorageBuffer16BitAccess(y Bool32) {
+	x.storageBuffer16BitAccess = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// UniformAndStorageBuffer16BitAccess returns the value of uniformAndStorageBuffer16BitAccess from VkPhysicalDeviceVulkan11Features
+func (x PhysicalDeviceVulkan11Features) UniformAndStorageBuffer16BitAccess() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.uniformAndStorageBuffer16BitAccess)
+	return *ptr
+}
+
+// WithUniformAndStorageBuffer16BitAccess clones a new PhysicalDeviceVulkan11Features with the value of
+// UniformAndStorageBuffer16BitAccess updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan11Features) WithUniformAndStorageBuffer16BitAccess(y Bool32) PhysicalDeviceVulkan11Features {
+	x.uniformAndStorageBuffer16BitAccess = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan11Features) SetUniformAndStorageBuffer16BitAccess(y Bool32) {
+	x.uniformAndStorageBuffer16BitAccess = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// StoragePushConstant16 returns the value of storagePushConstant16 from VkPhysicalDeviceVulkan11Features
+func (x PhysicalDeviceVulkan11Features) StoragePushConstant16() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.storagePushConstant16)
+	return *ptr
+}
+
+// WithStoragePushConstant16 clones a new PhysicalDeviceVulkan11Features with the value of
+// StoragePushConstant16 updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan11Features) WithStoragePushConstant16(y Bool32) PhysicalDeviceVulkan11Features {
+	x.storagePushConstant16 = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan11Features) SetStoragePushConstant16(y Bool32) {
+	x.storagePushConstant16 = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// StorageInputOutput16 returns the value of storageInputOutput16 from VkPhysicalDeviceVulkan11Features
+func (x PhysicalDeviceVulkan11Features) StorageInputOutput16() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.storageInputOutput16)
+	return *ptr
+}
+
+// WithStorageInputOutput16 clones a new PhysicalDeviceVulkan11Features with the value of
+// StorageInputOutput16 updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan11Features) WithStorageInputOutput16(y Bool32) PhysicalDeviceVulkan11Features {
+	x.storageInputOutput16 = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan11Features) SetStorageInputOutput16(y Bool32) {
+	x.storageInputOutput16 = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// Multiview returns the value of multiview from VkPhysicalDeviceVulkan11Features
+func (x PhysicalDeviceVulkan11Features) Multiview() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.multiview)
+	return *ptr
+}
+
+// WithMultiview clones a new PhysicalDeviceVulkan11Features with the value of
+// Multiview updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan11Features) WithMultiview(y Bool32) PhysicalDeviceVulkan11Features {
+	x.multiview = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan11Features) SetMultiview(y Bool32) {
+	x.multiview = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// MultiviewGeometryShader returns the value of multiviewGeometryShader from VkPhysicalDeviceVulkan11Features
+func (x PhysicalDeviceVulkan11Features) MultiviewGeometryShader() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.multiviewGeometryShader)
+	return *ptr
+}
+
+// WithMultiviewGeometryShader clones a new PhysicalDeviceVulkan11Features with the value of
+// MultiviewGeometryShader updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan11Features) WithMultiviewGeometryShader(y Bool32) PhysicalDeviceVulkan11Features {
+	x.multiviewGeometryShader = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan11Features) SetMultiviewGeometryShader(y Bool32) {
+	x.multiviewGeometryShader = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// MultiviewTessellationShader returns the value of multiviewTessellationShader from VkPhysicalDeviceVulkan11Features
+func (x PhysicalDeviceVulkan11Features) MultiviewTessellationShader() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.multiviewTessellationShader)
+	return *ptr
+}
+
+// WithMultiviewTessellationShader clones a new PhysicalDeviceVulkan11Features with the value of
+// MultiviewTessellationShader updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan11Features) WithMultiviewTessellationShader(y Bool32) PhysicalDeviceVulkan11Features {
+	x.multiviewTessellationShader = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan11Features) SetMultiviewTessellationShader(y Bool32) {
+	x.multiviewTessellationShader = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// VariablePointersStorageBuffer returns the value of variablePointersStorageBuffer from VkPhysicalDeviceVulkan11Features
+func (x PhysicalDeviceVulkan11Features) VariablePointersStorageBuffer() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.variablePointersStorageBuffer)
+	return *ptr
+}
+
+// WithVariablePointersStorageBuffer clones a new PhysicalDeviceVulkan11Features with the value of
+// VariablePointersStorageBuffer updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan11Features) WithVariablePointersStorageBuffer(y Bool32) PhysicalDeviceVulkan11Features {
+	x.variablePointersStorageBuffer = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan11Features) SetVariablePointersStorageBuffer(y Bool32) {
+	x.variablePointersStorageBuffer = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// VariablePointers returns the value of variablePointers from VkPhysicalDeviceVulkan11Features
+func (x PhysicalDeviceVulkan11Features) VariablePointers() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.variablePointers)
+	return *ptr
+}
+
+// WithVariablePointers clones a new PhysicalDeviceVulkan11Features with the value of
+// VariablePointers updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan11Features) WithVariablePointers(y Bool32) PhysicalDeviceVulkan11Features {
+	x.variablePointers = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan11Features) SetVariablePointers(y Bool32) {
+	x.variablePointers = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ProtectedMemory returns the value of protectedMemory from VkPhysicalDeviceVulkan11Features
+func (x PhysicalDeviceVulkan11Features) ProtectedMemory() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.protectedMemory)
+	return *ptr
+}
+
+// WithProtectedMemory clones a new PhysicalDeviceVulkan11Features with the value of
+// ProtectedMemory updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan11Features) WithProtectedMemory(y Bool32) PhysicalDeviceVulkan11Features {
+	x.protectedMemory = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan11Features) SetProtectedMemory(y Bool32) {
+	x.protectedMemory = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// SamplerYcbcrConversion returns the value of samplerYcbcrConversion from VkPhysicalDeviceVulkan11Features
+func (x PhysicalDeviceVulkan11Features) SamplerYcbcrConversion() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.samplerYcbcrConversion)
+	return *ptr
+}
+
+// WithSamplerYcbcrConversion clones a new PhysicalDeviceVulkan11Features with the value of
+// SamplerYcbcrConversion updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan11Features) WithSamplerYcbcrConversion(y Bool32) PhysicalDeviceVulkan11Features {
+	x.samplerYcbcrConversion = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan11Features) SetSamplerYcbcrConversion(y Bool32) {
+	x.samplerYcbcrConversion = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderDrawParameters returns the value of shaderDrawParameters from VkPhysicalDeviceVulkan11Features
+func (x PhysicalDeviceVulkan11Features) ShaderDrawParameters() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderDrawParameters)
+	return *ptr
+}
+
+// WithShaderDrawParameters clones a new PhysicalDeviceVulkan11Features with the value of
+// ShaderDrawParameters updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan11Features) WithShaderDrawParameters(y Bool32) PhysicalDeviceVulkan11Features {
+	x.shaderDrawParameters = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan11Features) SetShaderDrawParameters(y Bool32) {
+	x.shaderDrawParameters = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PhysicalDeviceDepthStencilResolveProperties provides a go interface for VkPhysicalDeviceDepthStencilResolveProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceDepthStencilResolveProperties.html
+type PhysicalDeviceDepthStencilResolveProperties C.struct_VkPhysicalDeviceDepthStencilResolveProperties
+
+// SizeofPhysicalDeviceDepthStencilResolveProperties is the memory size of a PhysicalDeviceDepthStencilResolveProperties
+var SizeofPhysicalDeviceDepthStencilResolveProperties int = int(unsafe.Sizeof(PhysicalDeviceDepthStencilResolveProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceDepthStencilResolveProperties) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceDepthStencilResolveProperties {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceDepthStencilResolveProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceDepthStencilResolveProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceDepthStencilResolveProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceDepthStencilResolveProperties) AsCPtr() *PhysicalDeviceDepthStencilResolveProperties {
+	clone := (*PhysicalDeviceDepthStencilResolveProperties)(newCBlock(cULong(SizeofPhysicalDeviceDepthStencilResolveProperties)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceDepthStencilResolvePropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceDepthStencilResolvePropertiesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceDepthStencilResolveProperties) []PhysicalDeviceDepthStencilResolveProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceDepthStencilResolveProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceDepthStencilResolveProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceDepthStencilResolvePropertiesFreeCSlice releases the memory allocated by PhysicalDeviceDepthStencilResolvePropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceDepthStencilResolvePropertiesFreeCSlice(x []PhysicalDeviceDepthStencilResolveProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceDepthStencilResolvePropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceDepthStencilResolvePropertiesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceDepthStencilResolvePropertiesMakeCSlice(x ...PhysicalDeviceDepthStencilResolveProperties) []PhysicalDeviceDepthStencilResolveProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceDepthStencilResolveProperties * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceDepthStencilResolveProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceDepthStencilResolveProperties
+func (x PhysicalDeviceDepthStencilResolveProperties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceDepthStencilResolveProperties with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceDepthStencilResolveProperties) WithDefaultSType() PhysicalDeviceDepthStencilResolveProperties {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_STENCIL_RESOLVE_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceDepthStencilResolveProperties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_STENCIL_RESOLVE_PROPERTIES)
+}
+
+// WithSType clones a new PhysicalDeviceDepthStencilResolveProperties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDepthStencilResolveProperties) WithSType(y StructureType) PhysicalDeviceDepthStencilResolveProperties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceDepthStencilResolveProperties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceDepthStencilResolveProperties
+func (x PhysicalDeviceDepthStencilResolveProperties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceDepthStencilResolveProperties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDepthStencilResolveProperties) WithPNext(y unsafe.Pointer) PhysicalDeviceDepthStencilResolveProperties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceDepthStencilResolveProperties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceDepthStencilResolveProperties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SupportedDepthResolveModes returns the value of supportedDepthResolveModes from VkPhysicalDeviceDepthStencilResolveProperties
+func (x PhysicalDeviceDepthStencilResolveProperties) SupportedDepthResolveModes() ResolveModeFlags {
+	ptr := /* typedef */ (*ResolveModeFlags)(&x.supportedDepthResolveModes)
+	return *ptr
+}
+
+// SupportedStencilResolveModes returns the value of supportedStencilResolveModes from VkPhysicalDeviceDepthStencilResolveProperties
+func (x PhysicalDeviceDepthStencilResolveProperties) SupportedStencilResolveModes() ResolveModeFlags {
+	ptr := /* typedef */ (*ResolveModeFlags)(&x.supportedStencilResolveModes)
+	return *ptr
+}
+
+// IndependentResolveNone returns the value of independentResolveNone from VkPhysicalDeviceDepthStencilResolveProperties
+func (x PhysicalDeviceDepthStencilResolveProperties) IndependentResolveNone() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.independentResolveNone)
+	return *ptr
+}
+
+// IndependentResolve returns the value of independentResolve from VkPhysicalDeviceDepthStencilResolveProperties
+func (x PhysicalDeviceDepthStencilResolveProperties) IndependentResolve() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.independentResolve)
+	return *ptr
+}
+
+// CmdBeginRenderPass2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdBeginRenderPass2.html
+func (x CommandBufferFacade) CmdBeginRenderPass2(pRenderPassBegin *RenderPassBeginInfo, pSubpassBeginInfo *SubpassBeginInfo) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := func(x **RenderPassBeginInfo) **C.struct_VkRenderPassBeginInfo { /* Pointer */
+		g2c := (*C.struct_VkRenderPassBeginInfo)(*x)
+		return &g2c
+	}(&pRenderPassBegin)
+	p2 := func(x **SubpassBeginInfo) **C.struct_VkSubpassBeginInfo { /* Pointer */
+		g2c := (*C.struct_VkSubpassBeginInfo)(*x)
+		return &g2c
+	}(&pSubpassBeginInfo)
+	C.vkCmdBeginRenderPass2(addrs, *p0, *p1, *p2)
+}
+
+// GetBufferOpaqueCaptureAddress command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetBufferOpaqueCaptureAddress.html
+func (x DeviceFacade) GetBufferOpaqueCaptureAddress(pInfo *BufferDeviceAddressInfo) uint64 {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **BufferDeviceAddressInfo) **C.struct_VkBufferDeviceAddressInfo { /* Pointer */
+		g2c := (*C.struct_VkBufferDeviceAddressInfo)(*x)
+		return &g2c
+	}(&pInfo)
+	ret := C.vkGetBufferOpaqueCaptureAddress(addrs, *p0, *p1)
+	retPtr := func(x *C.uint64_t) *uint64 { /* Scalar */ c2g := uint64(*x); return &c2g }(&ret)
+	return *retPtr
+}
+
+// GetBufferDeviceAddress command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetBufferDeviceAddress.html
+func (x DeviceFacade) GetBufferDeviceAddress(pInfo *BufferDeviceAddressInfo) DeviceAddress {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **BufferDeviceAddressInfo) **C.struct_VkBufferDeviceAddressInfo { /* Pointer */
+		g2c := (*C.struct_VkBufferDeviceAddressInfo)(*x)
+		return &g2c
+	}(&pInfo)
+	ret := C.vkGetBufferDeviceAddress(addrs, *p0, *p1)
+	retPtr := /* typedef */ (*DeviceAddress)(&ret)
+	return *retPtr
+}
+
+// CmdDrawIndirectCount command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdDrawIndirectCount.html
+func (x CommandBufferFacade) CmdDrawIndirectCount(buffer Buffer, offset DeviceSize, countBuffer Buffer, countBufferOffset DeviceSize, maxDrawCount uint32, stride uint32) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := /* handle */ (*C.VkBuffer)(&buffer)
+	p2 := /* typedef */ (*C.VkDeviceSize)(&offset)
+	p3 := /* handle */ (*C.VkBuffer)(&countBuffer)
+	p4 := /* typedef */ (*C.VkDeviceSize)(&countBufferOffset)
+	p5 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&maxDrawCount)
+	p6 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&stride)
+	C.vkCmdDrawIndirectCount(addrs, *p0, *p1, *p2, *p3, *p4, *p5, *p6)
+}
+
+// CmdDrawIndexedIndirectCount command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdDrawIndexedIndirectCount.html
+func (x CommandBufferFacade) CmdDrawIndexedIndirectCount(buffer Buffer, offset DeviceSize, countBuffer Buffer, countBufferOffset DeviceSize, maxDrawCount uint32, stride uint32) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := /* handle */ (*C.VkBuffer)(&buffer)
+	p2 := /* typedef */ (*C.VkDeviceSize)(&offset)
+	p3 := /* handle */ (*C.VkBuffer)(&countBuffer)
+	p4 := /* typedef */ (*C.VkDeviceSize)(&countBufferOffset)
+	p5 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&maxDrawCount)
+	p6 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&stride)
+	C.vkCmdDrawIndexedIndirectCount(addrs, *p0, *p1, *p2, *p3, *p4, *p5, *p6)
+}
+
+// CreateRenderPass2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCreateRenderPass2.html
+func (x DeviceFacade) CreateRenderPass2(pCreateInfo *RenderPassCreateInfo2, pAllocator *AllocationCallbacks, pRenderPass *RenderPass) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **RenderPassCreateInfo2) **C.struct_VkRenderPassCreateInfo2 { /* Pointer */
+		g2c := (*C.struct_VkRenderPassCreateInfo2)(*x)
+		return &g2c
+	}(&pCreateInfo)
+	p2 := func(x **AllocationCallbacks) **C.struct_VkAllocationCallbacks { /* Pointer */
+		g2c := (*C.struct_VkAllocationCallbacks)(*x)
+		return &g2c
+	}(&pAllocator)
+	p3 := func(x **RenderPass) **C.VkRenderPass { /* Pointer */ g2c := (*C.VkRenderPass)(*x); return &g2c }(&pRenderPass)
+	ret := C.vkCreateRenderPass2(addrs, *p0, *p1, *p2, *p3)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetDeviceMemoryOpaqueCaptureAddress command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetDeviceMemoryOpaqueCaptureAddress.html
+func (x DeviceFacade) GetDeviceMemoryOpaqueCaptureAddress(pInfo *DeviceMemoryOpaqueCaptureAddressInfo) uint64 {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **DeviceMemoryOpaqueCaptureAddressInfo) **C.struct_VkDeviceMemoryOpaqueCaptureAddressInfo { /* Pointer */
+		g2c := (*C.struct_VkDeviceMemoryOpaqueCaptureAddressInfo)(*x)
+		return &g2c
+	}(&pInfo)
+	ret := C.vkGetDeviceMemoryOpaqueCaptureAddress(addrs, *p0, *p1)
+	retPtr := func(x *C.uint64_t) *uint64 { /* Scalar */ c2g := uint64(*x); return &c2g }(&ret)
+	return *retPtr
+}
+
+// CmdNextSubpass2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdNextSubpass2.html
+func (x CommandBufferFacade) CmdNextSubpass2(pSubpassBeginInfo *SubpassBeginInfo, pSubpassEndInfo *SubpassEndInfo) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := func(x **SubpassBeginInfo) **C.struct_VkSubpassBeginInfo { /* Pointer */
+		g2c := (*C.struct_VkSubpassBeginInfo)(*x)
+		return &g2c
+	}(&pSubpassBeginInfo)
+	p2 := func(x **SubpassEndInfo) **C.struct_VkSubpassEndInfo { /* Pointer */
+		g2c := (*C.struct_VkSubpassEndInfo)(*x)
+		return &g2c
+	}(&pSubpassEndInfo)
+	C.vkCmdNextSubpass2(addrs, *p0, *p1, *p2)
+}
+
+// CmdEndRenderPass2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdEndRenderPass2.html
+func (x CommandBufferFacade) CmdEndRenderPass2(pSubpassEndInfo *SubpassEndInfo) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := func(x **SubpassEndInfo) **C.struct_VkSubpassEndInfo { /* Pointer */
+		g2c := (*C.struct_VkSubpassEndInfo)(*x)
+		return &g2c
+	}(&pSubpassEndInfo)
+	C.vkCmdEndRenderPass2(addrs, *p0, *p1)
+}
+
+// SignalSemaphore command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkSignalSemaphore.html
+func (x DeviceFacade) SignalSemaphore(pSignalInfo *SemaphoreSignalInfo) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **SemaphoreSignalInfo) **C.struct_VkSemaphoreSignalInfo { /* Pointer */
+		g2c := (*C.struct_VkSemaphoreSignalInfo)(*x)
+		return &g2c
+	}(&pSignalInfo)
+	ret := C.vkSignalSemaphore(addrs, *p0, *p1)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// WaitSemaphores command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkWaitSemaphores.html
+func (x DeviceFacade) WaitSemaphores(pWaitInfo *SemaphoreWaitInfo, timeout uint64) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **SemaphoreWaitInfo) **C.struct_VkSemaphoreWaitInfo { /* Pointer */
+		g2c := (*C.struct_VkSemaphoreWaitInfo)(*x)
+		return &g2c
+	}(&pWaitInfo)
+	p2 := func(x *uint64) *C.uint64_t { /* Scalar */ g2c := C.uint64_t(*x); return &g2c }(&timeout)
+	ret := C.vkWaitSemaphores(addrs, *p0, *p1, *p2)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetSemaphoreCounterValue command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetSemaphoreCounterValue.html
+func (x DeviceFacade) GetSemaphoreCounterValue(semaphore Semaphore, pValue *uint64) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := /* handle */ (*C.VkSemaphore)(&semaphore)
+	p2 := func(x **uint64) **C.uint64_t { /* Pointer */ g2c := (*C.uint64_t)(*x); return &g2c }(&pValue)
+	ret := C.vkGetSemaphoreCounterValue(addrs, *p0, *p1, *p2)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// ResetQueryPool command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkResetQueryPool.html
+func (x DeviceFacade) ResetQueryPool(queryPool QueryPool, firstQuery uint32, queryCount uint32) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := /* handle */ (*C.VkQueryPool)(&queryPool)
+	p2 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&firstQuery)
+	p3 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&queryCount)
+	C.vkResetQueryPool(addrs, *p0, *p1, *p2, *p3)
+}
@@ -0,0 +1,323 @@
+//go:build !vks_no_version_1_3 && !vks_no_version_1_1 && !vks_no_version_1_2
+
+// Wrappers of VK_VERSION_1_3.
+#include "vk_wrapper.h"
+#include "vk_capture.h"
+
+void vkCmdWriteTimestamp2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkPipelineStageFlags2 stage, VkQueryPool queryPool, uint32_t query) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdWriteTimestamp2(addrs, commandBuffer, stage, queryPool, query);
+		return;
+	}
+	(((PFN_vkCmdWriteTimestamp2)addrs->pvkCmdWriteTimestamp2)(commandBuffer, stage, queryPool, query));
+}
+void vkCmdCopyImage2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkCopyImageInfo2* pCopyImageInfo) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdCopyImage2(addrs, commandBuffer, pCopyImageInfo);
+		return;
+	}
+	(((PFN_vkCmdCopyImage2)addrs->pvkCmdCopyImage2)(commandBuffer, pCopyImageInfo));
+}
+void vkCmdSetDepthBoundsTestEnable(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBool32 depthBoundsTestEnable) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdSetDepthBoundsTestEnable(addrs, commandBuffer, depthBoundsTestEnable);
+		return;
+	}
+	(((PFN_vkCmdSetDepthBoundsTestEnable)addrs->pvkCmdSetDepthBoundsTestEnable)(commandBuffer, depthBoundsTestEnable));
+}
+void vkCmdSetStencilOp(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkStencilFaceFlags faceMask, VkStencilOp failOp, VkStencilOp passOp, VkStencilOp depthFailOp, VkCompareOp compareOp) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdSetStencilOp(addrs, commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp);
+		return;
+	}
+	(((PFN_vkCmdSetStencilOp)addrs->pvkCmdSetStencilOp)(commandBuffer, faceMask, failOp, passOp, depthFailOp, compareOp));
+}
+void vkCmdSetDepthWriteEnable(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBool32 depthWriteEnable) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdSetDepthWriteEnable(addrs, commandBuffer, depthWriteEnable);
+		return;
+	}
+	(((PFN_vkCmdSetDepthWriteEnable)addrs->pvkCmdSetDepthWriteEnable)(commandBuffer, depthWriteEnable));
+}
+void vkCmdSetDepthTestEnable(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBool32 depthTestEnable) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdSetDepthTestEnable(addrs, commandBuffer, depthTestEnable);
+		return;
+	}
+	(((PFN_vkCmdSetDepthTestEnable)addrs->pvkCmdSetDepthTestEnable)(commandBuffer, depthTestEnable));
+}
+void vkCmdBindVertexBuffers2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, uint32_t firstBinding, uint32_t bindingCount, VkBuffer* pBuffers, VkDeviceSize* pOffsets, VkDeviceSize* pSizes, VkDeviceSize* pStrides) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdBindVertexBuffers2(addrs, commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides);
+		return;
+	}
+	(((PFN_vkCmdBindVertexBuffers2)addrs->pvkCmdBindVertexBuffers2)(commandBuffer, firstBinding, bindingCount, pBuffers, pOffsets, pSizes, pStrides));
+}
+void vkCmdSetScissorWithCount(vksProcAddr* addrs, VkCommandBuffer commandBuffer, uint32_t scissorCount, VkRect2D* pScissors) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdSetScissorWithCount(addrs, commandBuffer, scissorCount, pScissors);
+		return;
+	}
+	(((PFN_vkCmdSetScissorWithCount)addrs->pvkCmdSetScissorWithCount)(commandBuffer, scissorCount, pScissors));
+}
+void vkCmdSetViewportWithCount(vksProcAddr* addrs, VkCommandBuffer commandBuffer, uint32_t viewportCount, VkViewport* pViewports) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdSetViewportWithCount(addrs, commandBuffer, viewportCount, pViewports);
+		return;
+	}
+	(((PFN_vkCmdSetViewportWithCount)addrs->pvkCmdSetViewportWithCount)(commandBuffer, viewportCount, pViewports));
+}
+void vkCmdSetPrimitiveTopology(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkPrimitiveTopology primitiveTopology) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdSetPrimitiveTopology(addrs, commandBuffer, primitiveTopology);
+		return;
+	}
+	(((PFN_vkCmdSetPrimitiveTopology)addrs->pvkCmdSetPrimitiveTopology)(commandBuffer, primitiveTopology));
+}
+void vkCmdSetFrontFace(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkFrontFace frontFace) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdSetFrontFace(addrs, commandBuffer, frontFace);
+		return;
+	}
+	(((PFN_vkCmdSetFrontFace)addrs->pvkCmdSetFrontFace)(commandBuffer, frontFace));
+}
+void vkCmdSetCullMode(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkCullModeFlags cullMode) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdSetCullMode(addrs, commandBuffer, cullMode);
+		return;
+	}
+	(((PFN_vkCmdSetCullMode)addrs->pvkCmdSetCullMode)(commandBuffer, cullMode));
+}
+void vkCmdSetEvent2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkEvent event, VkDependencyInfo* pDependencyInfo) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdSetEvent2(addrs, commandBuffer, event, pDependencyInfo);
+		return;
+	}
+	(((PFN_vkCmdSetEvent2)addrs->pvkCmdSetEvent2)(commandBuffer, event, pDependencyInfo));
+}
+void vkCmdEndRendering(vksProcAddr* addrs, VkCommandBuffer commandBuffer) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdEndRendering(addrs, commandBuffer);
+		return;
+	}
+	(((PFN_vkCmdEndRendering)addrs->pvkCmdEndRendering)(commandBuffer));
+}
+void vkCmdBeginRendering(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkRenderingInfo* pRenderingInfo) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdBeginRendering(addrs, commandBuffer, pRenderingInfo);
+		return;
+	}
+	(((PFN_vkCmdBeginRendering)addrs->pvkCmdBeginRendering)(commandBuffer, pRenderingInfo));
+}
+void vkCmdResetEvent2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkEvent event, VkPipelineStageFlags2 stageMask) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdResetEvent2(addrs, commandBuffer, event, stageMask);
+		return;
+	}
+	(((PFN_vkCmdResetEvent2)addrs->pvkCmdResetEvent2)(commandBuffer, event, stageMask));
+}
+void vkCmdWaitEvents2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, uint32_t eventCount, VkEvent* pEvents, VkDependencyInfo* pDependencyInfos) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdWaitEvents2(addrs, commandBuffer, eventCount, pEvents, pDependencyInfos);
+		return;
+	}
+	(((PFN_vkCmdWaitEvents2)addrs->pvkCmdWaitEvents2)(commandBuffer, eventCount, pEvents, pDependencyInfos));
+}
+void vkCmdPipelineBarrier2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkDependencyInfo* pDependencyInfo) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdPipelineBarrier2(addrs, commandBuffer, pDependencyInfo);
+		return;
+	}
+	(((PFN_vkCmdPipelineBarrier2)addrs->pvkCmdPipelineBarrier2)(commandBuffer, pDependencyInfo));
+}
+void vkCmdSetDepthCompareOp(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkCompareOp depthCompareOp) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdSetDepthCompareOp(addrs, commandBuffer, depthCompareOp);
+		return;
+	}
+	(((PFN_vkCmdSetDepthCompareOp)addrs->pvkCmdSetDepthCompareOp)(commandBuffer, depthCompareOp));
+}
+void vkCmdSetStencilTestEnable(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBool32 stencilTestEnable) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdSetStencilTestEnable(addrs, commandBuffer, stencilTestEnable);
+		return;
+	}
+	(((PFN_vkCmdSetStencilTestEnable)addrs->pvkCmdSetStencilTestEnable)(commandBuffer, stencilTestEnable));
+}
+void vkCmdSetPrimitiveRestartEnable(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBool32 primitiveRestartEnable) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdSetPrimitiveRestartEnable(addrs, commandBuffer, primitiveRestartEnable);
+		return;
+	}
+	(((PFN_vkCmdSetPrimitiveRestartEnable)addrs->pvkCmdSetPrimitiveRestartEnable)(commandBuffer, primitiveRestartEnable));
+}
+void vkCmdSetDepthBiasEnable(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBool32 depthBiasEnable) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdSetDepthBiasEnable(addrs, commandBuffer, depthBiasEnable);
+		return;
+	}
+	(((PFN_vkCmdSetDepthBiasEnable)addrs->pvkCmdSetDepthBiasEnable)(commandBuffer, depthBiasEnable));
+}
+VkResult vkQueueSubmit2(vksProcAddr* addrs, VkQueue queue, uint32_t submitCount, VkSubmitInfo2* pSubmits, VkFence fence) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkQueueSubmit2(addrs, queue, submitCount, pSubmits, fence);
+	}
+	VkResult ret = (((PFN_vkQueueSubmit2)addrs->pvkQueueSubmit2)(queue, submitCount, pSubmits, fence));
+	return ret;
+}
+VkResult vkGetPhysicalDeviceToolProperties(vksProcAddr* addrs, VkPhysicalDevice physicalDevice, uint32_t* pToolCount, VkPhysicalDeviceToolProperties* pToolProperties) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkGetPhysicalDeviceToolProperties(addrs, physicalDevice, pToolCount, pToolProperties);
+	}
+	VkResult ret = (((PFN_vkGetPhysicalDeviceToolProperties)addrs->pvkGetPhysicalDeviceToolProperties)(physicalDevice, pToolCount, pToolProperties));
+	return ret;
+}
+
+// Runs the two-call idiom of vkGetPhysicalDeviceToolProperties in one call. capacity is the
+// length of pToolProperties; when it is too small, the result is VK_INCOMPLETE
+// with the count needed.
+vksEnumerateResult vksEnumerate_vkGetPhysicalDeviceToolProperties(vksProcAddr* addrs, uint64_t physicalDevice, uint32_t capacity, VkPhysicalDeviceToolProperties* pToolProperties) {
+	vksEnumerateResult r = { VK_SUCCESS, capacity };
+	for (uint32_t i = 0; i < capacity; i++) {
+		pToolProperties[i].sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TOOL_PROPERTIES;
+	}
+	if (capacity > 0) {
+		// Large enough buffers skip the count query.
+		r.result = vkGetPhysicalDeviceToolProperties(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, &r.count, pToolProperties);
+		if (r.result < 0) {
+			r.count = 0;
+		}
+		if (r.result != VK_INCOMPLETE) {
+			return r;
+		}
+	}
+	for (;;) {
+		r.count = 0;
+		r.result = vkGetPhysicalDeviceToolProperties(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, &r.count, NULL);
+		if (r.result < 0) {
+			r.count = 0;
+			return r;
+		}
+		if (r.count > capacity) {
+			r.result = VK_INCOMPLETE;
+			return r;
+		}
+		r.result = vkGetPhysicalDeviceToolProperties(addrs, (VkPhysicalDevice)(uintptr_t)physicalDevice, &r.count, pToolProperties);
+		if (r.result != VK_INCOMPLETE) {
+			if (r.result < 0) {
+				r.count = 0;
+			}
+			return r;
+		}
+		// The count grew between the calls.
+	}
+}
+void vkCmdResolveImage2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkResolveImageInfo2* pResolveImageInfo) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdResolveImage2(addrs, commandBuffer, pResolveImageInfo);
+		return;
+	}
+	(((PFN_vkCmdResolveImage2)addrs->pvkCmdResolveImage2)(commandBuffer, pResolveImageInfo));
+}
+void vkGetDeviceBufferMemoryRequirements(vksProcAddr* addrs, VkDevice device, VkDeviceBufferMemoryRequirements* pInfo, VkMemoryRequirements2* pMemoryRequirements) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkGetDeviceBufferMemoryRequirements(addrs, device, pInfo, pMemoryRequirements);
+		return;
+	}
+	(((PFN_vkGetDeviceBufferMemoryRequirements)addrs->pvkGetDeviceBufferMemoryRequirements)(device, pInfo, pMemoryRequirements));
+}
+void vkGetDeviceImageMemoryRequirements(vksProcAddr* addrs, VkDevice device, VkDeviceImageMemoryRequirements* pInfo, VkMemoryRequirements2* pMemoryRequirements) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkGetDeviceImageMemoryRequirements(addrs, device, pInfo, pMemoryRequirements);
+		return;
+	}
+	(((PFN_vkGetDeviceImageMemoryRequirements)addrs->pvkGetDeviceImageMemoryRequirements)(device, pInfo, pMemoryRequirements));
+}
+void vkGetDeviceImageSparseMemoryRequirements(vksProcAddr* addrs, VkDevice device, VkDeviceImageMemoryRequirements* pInfo, uint32_t* pSparseMemoryRequirementCount, VkSparseImageMemoryRequirements2* pSparseMemoryRequirements) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkGetDeviceImageSparseMemoryRequirements(addrs, device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements);
+		return;
+	}
+	(((PFN_vkGetDeviceImageSparseMemoryRequirements)addrs->pvkGetDeviceImageSparseMemoryRequirements)(device, pInfo, pSparseMemoryRequirementCount, pSparseMemoryRequirements));
+}
+
+// Runs the two-call idiom of vkGetDeviceImageSparseMemoryRequirements in one call. capacity is the
+// length of pSparseMemoryRequirements; when it is too small, the result is VK_INCOMPLETE
+// with the count needed.
+vksEnumerateResult vksEnumerate_vkGetDeviceImageSparseMemoryRequirements(vksProcAddr* addrs, uint64_t device, VkDeviceImageMemoryRequirements* pInfo, uint32_t capacity, VkSparseImageMemoryRequirements2* pSparseMemoryRequirements) {
+	vksEnumerateResult r = { VK_SUCCESS, capacity };
+	for (uint32_t i = 0; i < capacity; i++) {
+		pSparseMemoryRequirements[i].sType = VK_STRUCTURE_TYPE_SPARSE_IMAGE_MEMORY_REQUIREMENTS_2;
+	}
+	r.count = 0;
+	vkGetDeviceImageSparseMemoryRequirements(addrs, (VkDevice)(uintptr_t)device, pInfo, &r.count, NULL);
+	if (r.count > capacity) {
+		r.result = VK_INCOMPLETE;
+		return r;
+	}
+	vkGetDeviceImageSparseMemoryRequirements(addrs, (VkDevice)(uintptr_t)device, pInfo, &r.count, pSparseMemoryRequirements);
+	return r;
+}
+void vkGetPrivateData(vksProcAddr* addrs, VkDevice device, VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlot privateDataSlot, uint64_t* pData) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkGetPrivateData(addrs, device, objectType, objectHandle, privateDataSlot, pData);
+		return;
+	}
+	(((PFN_vkGetPrivateData)addrs->pvkGetPrivateData)(device, objectType, objectHandle, privateDataSlot, pData));
+}
+VkResult vkSetPrivateData(vksProcAddr* addrs, VkDevice device, VkObjectType objectType, uint64_t objectHandle, VkPrivateDataSlot privateDataSlot, uint64_t data) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkSetPrivateData(addrs, device, objectType, objectHandle, privateDataSlot, data);
+	}
+	VkResult ret = (((PFN_vkSetPrivateData)addrs->pvkSetPrivateData)(device, objectType, objectHandle, privateDataSlot, data));
+	return ret;
+}
+void vkDestroyPrivateDataSlot(vksProcAddr* addrs, VkDevice device, VkPrivateDataSlot privateDataSlot, VkAllocationCallbacks* pAllocator) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkDestroyPrivateDataSlot(addrs, device, privateDataSlot, pAllocator);
+		return;
+	}
+	(((PFN_vkDestroyPrivateDataSlot)addrs->pvkDestroyPrivateDataSlot)(device, privateDataSlot, pAllocator));
+}
+VkResult vkCreatePrivateDataSlot(vksProcAddr* addrs, VkDevice device, VkPrivateDataSlotCreateInfo* pCreateInfo, VkAllocationCallbacks* pAllocator, VkPrivateDataSlot* pPrivateDataSlot) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		return vksCaptured_vkCreatePrivateDataSlot(addrs, device, pCreateInfo, pAllocator, pPrivateDataSlot);
+	}
+	VkResult ret = (((PFN_vkCreatePrivateDataSlot)addrs->pvkCreatePrivateDataSlot)(device, pCreateInfo, pAllocator, pPrivateDataSlot));
+	return ret;
+}
+void vkCmdBlitImage2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBlitImageInfo2* pBlitImageInfo) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdBlitImage2(addrs, commandBuffer, pBlitImageInfo);
+		return;
+	}
+	(((PFN_vkCmdBlitImage2)addrs->pvkCmdBlitImage2)(commandBuffer, pBlitImageInfo));
+}
+void vkCmdCopyImageToBuffer2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkCopyImageToBufferInfo2* pCopyImageToBufferInfo) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdCopyImageToBuffer2(addrs, commandBuffer, pCopyImageToBufferInfo);
+		return;
+	}
+	(((PFN_vkCmdCopyImageToBuffer2)addrs->pvkCmdCopyImageToBuffer2)(commandBuffer, pCopyImageToBufferInfo));
+}
+void vkCmdCopyBufferToImage2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkCopyBufferToImageInfo2* pCopyBufferToImageInfo) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdCopyBufferToImage2(addrs, commandBuffer, pCopyBufferToImageInfo);
+		return;
+	}
+	(((PFN_vkCmdCopyBufferToImage2)addrs->pvkCmdCopyBufferToImage2)(commandBuffer, pCopyBufferToImageInfo));
+}
+void vkCmdSetRasterizerDiscardEnable(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkBool32 rasterizerDiscardEnable) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdSetRasterizerDiscardEnable(addrs, commandBuffer, rasterizerDiscardEnable);
+		return;
+	}
+	(((PFN_vkCmdSetRasterizerDiscardEnable)addrs->pvkCmdSetRasterizerDiscardEnable)(commandBuffer, rasterizerDiscardEnable));
+}
+void vkCmdCopyBuffer2(vksProcAddr* addrs, VkCommandBuffer commandBuffer, VkCopyBufferInfo2* pCopyBufferInfo) { 
+	if (__builtin_expect(vksCaptureActive, 0)) {
+		vksCaptured_vkCmdCopyBuffer2(addrs, commandBuffer, pCopyBufferInfo);
+		return;
+	}
+	(((PFN_vkCmdCopyBuffer2)addrs->pvkCmdCopyBuffer2)(commandBuffer, pCopyBufferInfo));
+}
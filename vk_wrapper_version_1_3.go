@@ -0,0 +1,11976 @@
+//go:build !vks_no_version_1_3 && !vks_no_version_1_1 && !vks_no_version_1_2
+
+package vks
+
+// Bindings of VK_VERSION_1_3, left out by the vks_no_version_1_3 build tag.
+
+//#cgo CFLAGS: -DVKS_ENABLE_VERSION_1_3
+//#include "vk_wrapper.h"
+import "C"
+import (
+	"fmt"
+	"unsafe"
+)
+
+// Flags64 basetype
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkFlags64.html
+type Flags64 uint64
+
+// PrivateDataSlot is a Handle to a vulkan resource.
+// PrivateDataSlot is a child of Device.
+//
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPrivateDataSlot.html
+type PrivateDataSlot C.VkPrivateDataSlot
+
+// NullPrivateDataSlot is a typed Null value for the PrivateDataSlot type.
+var NullPrivateDataSlot PrivateDataSlot
+
+// RenderingFlagBits enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkRenderingFlagBits.html
+type RenderingFlagBits uint32
+
+const (
+	VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT     RenderingFlagBits = (1 << 0)
+	VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT_KHR RenderingFlagBits = VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT
+	VK_RENDERING_SUSPENDING_BIT                             RenderingFlagBits = (1 << 1)
+	VK_RENDERING_SUSPENDING_BIT_KHR                         RenderingFlagBits = VK_RENDERING_SUSPENDING_BIT
+	VK_RENDERING_RESUMING_BIT                               RenderingFlagBits = (1 << 2)
+	VK_RENDERING_RESUMING_BIT_KHR                           RenderingFlagBits = VK_RENDERING_RESUMING_BIT
+)
+
+const enumNamesRenderingFlagBits = "VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT" +
+	"VK_RENDERING_SUSPENDING_BIT" +
+	"VK_RENDERING_RESUMING_BIT"
+
+var enumTableRenderingFlagBits = enumTable[RenderingFlagBits, uint16]{
+	sparse: []RenderingFlagBits{
+		VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT,
+		VK_RENDERING_SUSPENDING_BIT,
+		VK_RENDERING_RESUMING_BIT,
+	},
+	names: enumNamesRenderingFlagBits,
+	index: []uint16{0, 51, 78, 103},
+}
+
+func (x RenderingFlagBits) String() string {
+	if s, ok := enumTableRenderingFlagBits.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("RenderingFlagBits=%d", x)
+}
+
+// PipelineStageFlagBits2 enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPipelineStageFlagBits2.html
+type PipelineStageFlagBits2 uint64
+
+const (
+	VK_PIPELINE_STAGE_2_NONE                                   PipelineStageFlagBits2 = 0
+	VK_PIPELINE_STAGE_2_NONE_KHR                               PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_NONE
+	VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT                        PipelineStageFlagBits2 = (1 << 0)
+	VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT_KHR                    PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT
+	VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT                      PipelineStageFlagBits2 = (1 << 1)
+	VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT_KHR                  PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT
+	VK_PIPELINE_STAGE_2_VERTEX_INPUT_BIT                       PipelineStageFlagBits2 = (1 << 2)
+	VK_PIPELINE_STAGE_2_VERTEX_INPUT_BIT_KHR                   PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_VERTEX_INPUT_BIT
+	VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT                      PipelineStageFlagBits2 = (1 << 3)
+	VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT_KHR                  PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT
+	VK_PIPELINE_STAGE_2_TESSELLATION_CONTROL_SHADER_BIT        PipelineStageFlagBits2 = (1 << 4)
+	VK_PIPELINE_STAGE_2_TESSELLATION_CONTROL_SHADER_BIT_KHR    PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_TESSELLATION_CONTROL_SHADER_BIT
+	VK_PIPELINE_STAGE_2_TESSELLATION_EVALUATION_SHADER_BIT     PipelineStageFlagBits2 = (1 << 5)
+	VK_PIPELINE_STAGE_2_TESSELLATION_EVALUATION_SHADER_BIT_KHR PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_TESSELLATION_EVALUATION_SHADER_BIT
+	VK_PIPELINE_STAGE_2_GEOMETRY_SHADER_BIT                    PipelineStageFlagBits2 = (1 << 6)
+	VK_PIPELINE_STAGE_2_GEOMETRY_SHADER_BIT_KHR                PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_GEOMETRY_SHADER_BIT
+	VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT                    PipelineStageFlagBits2 = (1 << 7)
+	VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT_KHR                PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT
+	VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT               PipelineStageFlagBits2 = (1 << 8)
+	VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT_KHR           PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT
+	VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT                PipelineStageFlagBits2 = (1 << 9)
+	VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT_KHR            PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT
+	VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT            PipelineStageFlagBits2 = (1 << 10)
+	VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT_KHR        PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT
+	VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT                     PipelineStageFlagBits2 = (1 << 11)
+	VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT_KHR                 PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT
+	VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT                       PipelineStageFlagBits2 = (1 << 12)
+	VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT_KHR                   PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT
+	VK_PIPELINE_STAGE_2_TRANSFER_BIT                           PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT_KHR
+	VK_PIPELINE_STAGE_2_TRANSFER_BIT_KHR                       PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT
+	VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT                     PipelineStageFlagBits2 = (1 << 13)
+	VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT_KHR                 PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT
+	VK_PIPELINE_STAGE_2_HOST_BIT                               PipelineStageFlagBits2 = (1 << 14)
+	VK_PIPELINE_STAGE_2_HOST_BIT_KHR                           PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_HOST_BIT
+	VK_PIPELINE_STAGE_2_ALL_GRAPHICS_BIT                       PipelineStageFlagBits2 = (1 << 15)
+	VK_PIPELINE_STAGE_2_ALL_GRAPHICS_BIT_KHR                   PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_ALL_GRAPHICS_BIT
+	VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT                       PipelineStageFlagBits2 = (1 << 16)
+	VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT_KHR                   PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT
+	VK_PIPELINE_STAGE_2_COPY_BIT                               PipelineStageFlagBits2 = (1 << 32)
+	VK_PIPELINE_STAGE_2_COPY_BIT_KHR                           PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_COPY_BIT
+	VK_PIPELINE_STAGE_2_RESOLVE_BIT                            PipelineStageFlagBits2 = (1 << 33)
+	VK_PIPELINE_STAGE_2_RESOLVE_BIT_KHR                        PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_RESOLVE_BIT
+	VK_PIPELINE_STAGE_2_BLIT_BIT                               PipelineStageFlagBits2 = (1 << 34)
+	VK_PIPELINE_STAGE_2_BLIT_BIT_KHR                           PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_BLIT_BIT
+	VK_PIPELINE_STAGE_2_CLEAR_BIT                              PipelineStageFlagBits2 = (1 << 35)
+	VK_PIPELINE_STAGE_2_CLEAR_BIT_KHR                          PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_CLEAR_BIT
+	VK_PIPELINE_STAGE_2_INDEX_INPUT_BIT                        PipelineStageFlagBits2 = (1 << 36)
+	VK_PIPELINE_STAGE_2_INDEX_INPUT_BIT_KHR                    PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_INDEX_INPUT_BIT
+	VK_PIPELINE_STAGE_2_VERTEX_ATTRIBUTE_INPUT_BIT             PipelineStageFlagBits2 = (1 << 37)
+	VK_PIPELINE_STAGE_2_VERTEX_ATTRIBUTE_INPUT_BIT_KHR         PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_VERTEX_ATTRIBUTE_INPUT_BIT
+	VK_PIPELINE_STAGE_2_PRE_RASTERIZATION_SHADERS_BIT          PipelineStageFlagBits2 = (1 << 38)
+	VK_PIPELINE_STAGE_2_PRE_RASTERIZATION_SHADERS_BIT_KHR      PipelineStageFlagBits2 = VK_PIPELINE_STAGE_2_PRE_RASTERIZATION_SHADERS_BIT
+)
+
+const enumNamesPipelineStageFlagBits2 = "VK_PIPELINE_STAGE_2_NONE" +
+	"VK_PIPELINE_STAGE_2_TOP_OF_PIPE_BIT" +
+	"VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT" +
+	"VK_PIPELINE_STAGE_2_VERTEX_INPUT_BIT" +
+	"VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT" +
+	"VK_PIPELINE_STAGE_2_TESSELLATION_CONTROL_SHADER_BIT" +
+	"VK_PIPELINE_STAGE_2_TESSELLATION_EVALUATION_SHADER_BIT" +
+	"VK_PIPELINE_STAGE_2_GEOMETRY_SHADER_BIT" +
+	"VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT" +
+	"VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT" +
+	"VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT" +
+	"VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT" +
+	"VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT" +
+	"VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT" +
+	"VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT" +
+	"VK_PIPELINE_STAGE_2_HOST_BIT" +
+	"VK_PIPELINE_STAGE_2_ALL_GRAPHICS_BIT" +
+	"VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT" +
+	"VK_PIPELINE_STAGE_2_COPY_BIT" +
+	"VK_PIPELINE_STAGE_2_RESOLVE_BIT" +
+	"VK_PIPELINE_STAGE_2_BLIT_BIT" +
+	"VK_PIPELINE_STAGE_2_CLEAR_BIT" +
+	"VK_PIPELINE_STAGE_2_INDEX_INPUT_BIT" +
+	"VK_PIPELINE_STAGE_2_VERTEX_ATTRIBUTE_INPUT_BIT" +
+	"VK_PIPELINE_STAGE_2_PRE_RASTERIZATION_SHADERS_BIT"
+
+var enumTablePipelineStageFlagBits2 = enumTable[PipelineStageFlagBits2, uint16]{
+	first: VK_PIPELINE_STAGE_2_NONE,
+	dense: 9,
+	sparse: []PipelineStageFlagBits2{
+		VK_PIPELINE_STAGE_2_TESSELLATION_CONTROL_SHADER_BIT,
+		VK_PIPELINE_STAGE_2_TESSELLATION_EVALUATION_SHADER_BIT,
+		VK_PIPELINE_STAGE_2_GEOMETRY_SHADER_BIT,
+		VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT,
+		VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT,
+		VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT,
+		VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
+		VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT,
+		VK_PIPELINE_STAGE_2_ALL_TRANSFER_BIT,
+		VK_PIPELINE_STAGE_2_BOTTOM_OF_PIPE_BIT,
+		VK_PIPELINE_STAGE_2_HOST_BIT,
+		VK_PIPELINE_STAGE_2_ALL_GRAPHICS_BIT,
+		VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT,
+		VK_PIPELINE_STAGE_2_COPY_BIT,
+		VK_PIPELINE_STAGE_2_RESOLVE_BIT,
+		VK_PIPELINE_STAGE_2_BLIT_BIT,
+		VK_PIPELINE_STAGE_2_CLEAR_BIT,
+		VK_PIPELINE_STAGE_2_INDEX_INPUT_BIT,
+		VK_PIPELINE_STAGE_2_VERTEX_ATTRIBUTE_INPUT_BIT,
+		VK_PIPELINE_STAGE_2_PRE_RASTERIZATION_SHADERS_BIT,
+	},
+	names: enumNamesPipelineStageFlagBits2,
+	index: []uint16{0, 24, 59, 96, 96, 132, 132, 132, 132, 169, 220, 274, 313, 352, 396, 439, 486, 524, 560, 598, 626, 662, 698, 726, 757, 785, 814, 849, 895, 944},
+}
+
+func (x PipelineStageFlagBits2) String() string {
+	if s, ok := enumTablePipelineStageFlagBits2.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("PipelineStageFlagBits2=%d", x)
+}
+
+// ToolPurposeFlagBits enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkToolPurposeFlagBits.html
+type ToolPurposeFlagBits uint32
+
+const (
+	VK_TOOL_PURPOSE_VALIDATION_BIT              ToolPurposeFlagBits = (1 << 0)
+	VK_TOOL_PURPOSE_VALIDATION_BIT_EXT          ToolPurposeFlagBits = VK_TOOL_PURPOSE_VALIDATION_BIT
+	VK_TOOL_PURPOSE_PROFILING_BIT               ToolPurposeFlagBits = (1 << 1)
+	VK_TOOL_PURPOSE_PROFILING_BIT_EXT           ToolPurposeFlagBits = VK_TOOL_PURPOSE_PROFILING_BIT
+	VK_TOOL_PURPOSE_TRACING_BIT                 ToolPurposeFlagBits = (1 << 2)
+	VK_TOOL_PURPOSE_TRACING_BIT_EXT             ToolPurposeFlagBits = VK_TOOL_PURPOSE_TRACING_BIT
+	VK_TOOL_PURPOSE_ADDITIONAL_FEATURES_BIT     ToolPurposeFlagBits = (1 << 3)
+	VK_TOOL_PURPOSE_ADDITIONAL_FEATURES_BIT_EXT ToolPurposeFlagBits = VK_TOOL_PURPOSE_ADDITIONAL_FEATURES_BIT
+	VK_TOOL_PURPOSE_MODIFYING_FEATURES_BIT      ToolPurposeFlagBits = (1 << 4)
+	VK_TOOL_PURPOSE_MODIFYING_FEATURES_BIT_EXT  ToolPurposeFlagBits = VK_TOOL_PURPOSE_MODIFYING_FEATURES_BIT
+)
+
+const enumNamesToolPurposeFlagBits = "VK_TOOL_PURPOSE_VALIDATION_BIT" +
+	"VK_TOOL_PURPOSE_PROFILING_BIT" +
+	"VK_TOOL_PURPOSE_TRACING_BIT" +
+	"VK_TOOL_PURPOSE_ADDITIONAL_FEATURES_BIT" +
+	"VK_TOOL_PURPOSE_MODIFYING_FEATURES_BIT"
+
+var enumTableToolPurposeFlagBits = enumTable[ToolPurposeFlagBits, uint16]{
+	first: VK_TOOL_PURPOSE_VALIDATION_BIT,
+	dense: 8,
+	sparse: []ToolPurposeFlagBits{
+		VK_TOOL_PURPOSE_MODIFYING_FEATURES_BIT,
+	},
+	names: enumNamesToolPurposeFlagBits,
+	index: []uint16{0, 30, 59, 59, 86, 86, 86, 86, 125, 163},
+}
+
+func (x ToolPurposeFlagBits) String() string {
+	if s, ok := enumTableToolPurposeFlagBits.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("ToolPurposeFlagBits=%d", x)
+}
+
+// PipelineCreationFeedbackFlagBits enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPipelineCreationFeedbackFlagBits.html
+type PipelineCreationFeedbackFlagBits uint32
+
+const (
+	VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT                              PipelineCreationFeedbackFlagBits = (1 << 0)
+	VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT_EXT                          PipelineCreationFeedbackFlagBits = VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT
+	VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT     PipelineCreationFeedbackFlagBits = (1 << 1)
+	VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT_EXT PipelineCreationFeedbackFlagBits = VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT
+	VK_PIPELINE_CREATION_FEEDBACK_BASE_PIPELINE_ACCELERATION_BIT         PipelineCreationFeedbackFlagBits = (1 << 2)
+	VK_PIPELINE_CREATION_FEEDBACK_BASE_PIPELINE_ACCELERATION_BIT_EXT     PipelineCreationFeedbackFlagBits = VK_PIPELINE_CREATION_FEEDBACK_BASE_PIPELINE_ACCELERATION_BIT
+)
+
+const enumNamesPipelineCreationFeedbackFlagBits = "VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT" +
+	"VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT" +
+	"VK_PIPELINE_CREATION_FEEDBACK_BASE_PIPELINE_ACCELERATION_BIT"
+
+var enumTablePipelineCreationFeedbackFlagBits = enumTable[PipelineCreationFeedbackFlagBits, uint16]{
+	sparse: []PipelineCreationFeedbackFlagBits{
+		VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT,
+		VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT,
+		VK_PIPELINE_CREATION_FEEDBACK_BASE_PIPELINE_ACCELERATION_BIT,
+	},
+	names: enumNamesPipelineCreationFeedbackFlagBits,
+	index: []uint16{0, 39, 103, 163},
+}
+
+func (x PipelineCreationFeedbackFlagBits) String() string {
+	if s, ok := enumTablePipelineCreationFeedbackFlagBits.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("PipelineCreationFeedbackFlagBits=%d", x)
+}
+
+// AccessFlagBits2 enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkAccessFlagBits2.html
+type AccessFlagBits2 uint64
+
+const (
+	VK_ACCESS_2_NONE                                   AccessFlagBits2 = 0
+	VK_ACCESS_2_NONE_KHR                               AccessFlagBits2 = VK_ACCESS_2_NONE
+	VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT              AccessFlagBits2 = (1 << 0)
+	VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT_KHR          AccessFlagBits2 = VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT
+	VK_ACCESS_2_INDEX_READ_BIT                         AccessFlagBits2 = (1 << 1)
+	VK_ACCESS_2_INDEX_READ_BIT_KHR                     AccessFlagBits2 = VK_ACCESS_2_INDEX_READ_BIT
+	VK_ACCESS_2_VERTEX_ATTRIBUTE_READ_BIT              AccessFlagBits2 = (1 << 2)
+	VK_ACCESS_2_VERTEX_ATTRIBUTE_READ_BIT_KHR          AccessFlagBits2 = VK_ACCESS_2_VERTEX_ATTRIBUTE_READ_BIT
+	VK_ACCESS_2_UNIFORM_READ_BIT                       AccessFlagBits2 = (1 << 3)
+	VK_ACCESS_2_UNIFORM_READ_BIT_KHR                   AccessFlagBits2 = VK_ACCESS_2_UNIFORM_READ_BIT
+	VK_ACCESS_2_INPUT_ATTACHMENT_READ_BIT              AccessFlagBits2 = (1 << 4)
+	VK_ACCESS_2_INPUT_ATTACHMENT_READ_BIT_KHR          AccessFlagBits2 = VK_ACCESS_2_INPUT_ATTACHMENT_READ_BIT
+	VK_ACCESS_2_SHADER_READ_BIT                        AccessFlagBits2 = (1 << 5)
+	VK_ACCESS_2_SHADER_READ_BIT_KHR                    AccessFlagBits2 = VK_ACCESS_2_SHADER_READ_BIT
+	VK_ACCESS_2_SHADER_WRITE_BIT                       AccessFlagBits2 = (1 << 6)
+	VK_ACCESS_2_SHADER_WRITE_BIT_KHR                   AccessFlagBits2 = VK_ACCESS_2_SHADER_WRITE_BIT
+	VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT              AccessFlagBits2 = (1 << 7)
+	VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT_KHR          AccessFlagBits2 = VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT
+	VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT             AccessFlagBits2 = (1 << 8)
+	VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT_KHR         AccessFlagBits2 = VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT
+	VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT      AccessFlagBits2 = (1 << 9)
+	VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT_KHR  AccessFlagBits2 = VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT
+	VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT     AccessFlagBits2 = (1 << 10)
+	VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT_KHR AccessFlagBits2 = VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT
+	VK_ACCESS_2_TRANSFER_READ_BIT                      AccessFlagBits2 = (1 << 11)
+	VK_ACCESS_2_TRANSFER_READ_BIT_KHR                  AccessFlagBits2 = VK_ACCESS_2_TRANSFER_READ_BIT
+	VK_ACCESS_2_TRANSFER_WRITE_BIT                     AccessFlagBits2 = (1 << 12)
+	VK_ACCESS_2_TRANSFER_WRITE_BIT_KHR                 AccessFlagBits2 = VK_ACCESS_2_TRANSFER_WRITE_BIT
+	VK_ACCESS_2_HOST_READ_BIT                          AccessFlagBits2 = (1 << 13)
+	VK_ACCESS_2_HOST_READ_BIT_KHR                      AccessFlagBits2 = VK_ACCESS_2_HOST_READ_BIT
+	VK_ACCESS_2_HOST_WRITE_BIT                         AccessFlagBits2 = (1 << 14)
+	VK_ACCESS_2_HOST_WRITE_BIT_KHR                     AccessFlagBits2 = VK_ACCESS_2_HOST_WRITE_BIT
+	VK_ACCESS_2_MEMORY_READ_BIT                        AccessFlagBits2 = (1 << 15)
+	VK_ACCESS_2_MEMORY_READ_BIT_KHR                    AccessFlagBits2 = VK_ACCESS_2_MEMORY_READ_BIT
+	VK_ACCESS_2_MEMORY_WRITE_BIT                       AccessFlagBits2 = (1 << 16)
+	VK_ACCESS_2_MEMORY_WRITE_BIT_KHR                   AccessFlagBits2 = VK_ACCESS_2_MEMORY_WRITE_BIT
+	VK_ACCESS_2_SHADER_SAMPLED_READ_BIT                AccessFlagBits2 = (1 << 32)
+	VK_ACCESS_2_SHADER_SAMPLED_READ_BIT_KHR            AccessFlagBits2 = VK_ACCESS_2_SHADER_SAMPLED_READ_BIT
+	VK_ACCESS_2_SHADER_STORAGE_READ_BIT                AccessFlagBits2 = (1 << 33)
+	VK_ACCESS_2_SHADER_STORAGE_READ_BIT_KHR            AccessFlagBits2 = VK_ACCESS_2_SHADER_STORAGE_READ_BIT
+	VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT               AccessFlagBits2 = (1 << 34)
+	VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT_KHR           AccessFlagBits2 = VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT
+)
+
+const enumNamesAccessFlagBits2 = "VK_ACCESS_2_NONE" +
+	"VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT" +
+	"VK_ACCESS_2_INDEX_READ_BIT" +
+	"VK_ACCESS_2_VERTEX_ATTRIBUTE_READ_BIT" +
+	"VK_ACCESS_2_UNIFORM_READ_BIT" +
+	"VK_ACCESS_2_INPUT_ATTACHMENT_READ_BIT" +
+	"VK_ACCESS_2_SHADER_READ_BIT" +
+	"VK_ACCESS_2_SHADER_WRITE_BIT" +
+	"VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT" +
+	"VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT" +
+	"VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT" +
+	"VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT" +
+	"VK_ACCESS_2_TRANSFER_READ_BIT" +
+	"VK_ACCESS_2_TRANSFER_WRITE_BIT" +
+	"VK_ACCESS_2_HOST_READ_BIT" +
+	"VK_ACCESS_2_HOST_WRITE_BIT" +
+	"VK_ACCESS_2_MEMORY_READ_BIT" +
+	"VK_ACCESS_2_MEMORY_WRITE_BIT" +
+	"VK_ACCESS_2_SHADER_SAMPLED_READ_BIT" +
+	"VK_ACCESS_2_SHADER_STORAGE_READ_BIT" +
+	"VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT"
+
+var enumTableAccessFlagBits2 = enumTable[AccessFlagBits2, uint16]{
+	first: VK_ACCESS_2_NONE,
+	dense: 9,
+	sparse: []AccessFlagBits2{
+		VK_ACCESS_2_INPUT_ATTACHMENT_READ_BIT,
+		VK_ACCESS_2_SHADER_READ_BIT,
+		VK_ACCESS_2_SHADER_WRITE_BIT,
+		VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT,
+		VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT,
+		VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT,
+		VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT,
+		VK_ACCESS_2_TRANSFER_READ_BIT,
+		VK_ACCESS_2_TRANSFER_WRITE_BIT,
+		VK_ACCESS_2_HOST_READ_BIT,
+		VK_ACCESS_2_HOST_WRITE_BIT,
+		VK_ACCESS_2_MEMORY_READ_BIT,
+		VK_ACCESS_2_MEMORY_WRITE_BIT,
+		VK_ACCESS_2_SHADER_SAMPLED_READ_BIT,
+		VK_ACCESS_2_SHADER_STORAGE_READ_BIT,
+		VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT,
+	},
+	names: enumNamesAccessFlagBits2,
+	index: []uint16{0, 16, 53, 79, 79, 116, 116, 116, 116, 144, 181, 208, 236, 273, 311, 356, 402, 431, 461, 486, 512, 539, 567, 602, 637, 673},
+}
+
+func (x AccessFlagBits2) String() string {
+	if s, ok := enumTableAccessFlagBits2.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("AccessFlagBits2=%d", x)
+}
+
+// FormatFeatureFlagBits2 enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkFormatFeatureFlagBits2.html
+type FormatFeatureFlagBits2 uint64
+
+const (
+	VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_BIT                                                               FormatFeatureFlagBits2 = (1 << 0)
+	VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_BIT_KHR                                                           FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_BIT
+	VK_FORMAT_FEATURE_2_STORAGE_IMAGE_BIT                                                               FormatFeatureFlagBits2 = (1 << 1)
+	VK_FORMAT_FEATURE_2_STORAGE_IMAGE_BIT_KHR                                                           FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_STORAGE_IMAGE_BIT
+	VK_FORMAT_FEATURE_2_STORAGE_IMAGE_ATOMIC_BIT                                                        FormatFeatureFlagBits2 = (1 << 2)
+	VK_FORMAT_FEATURE_2_STORAGE_IMAGE_ATOMIC_BIT_KHR                                                    FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_STORAGE_IMAGE_ATOMIC_BIT
+	VK_FORMAT_FEATURE_2_UNIFORM_TEXEL_BUFFER_BIT                                                        FormatFeatureFlagBits2 = (1 << 3)
+	VK_FORMAT_FEATURE_2_UNIFORM_TEXEL_BUFFER_BIT_KHR                                                    FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_UNIFORM_TEXEL_BUFFER_BIT
+	VK_FORMAT_FEATURE_2_STORAGE_TEXEL_BUFFER_BIT                                                        FormatFeatureFlagBits2 = (1 << 4)
+	VK_FORMAT_FEATURE_2_STORAGE_TEXEL_BUFFER_BIT_KHR                                                    FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_STORAGE_TEXEL_BUFFER_BIT
+	VK_FORMAT_FEATURE_2_STORAGE_TEXEL_BUFFER_ATOMIC_BIT                                                 FormatFeatureFlagBits2 = (1 << 5)
+	VK_FORMAT_FEATURE_2_STORAGE_TEXEL_BUFFER_ATOMIC_BIT_KHR                                             FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_STORAGE_TEXEL_BUFFER_ATOMIC_BIT
+	VK_FORMAT_FEATURE_2_VERTEX_BUFFER_BIT                                                               FormatFeatureFlagBits2 = (1 << 6)
+	VK_FORMAT_FEATURE_2_VERTEX_BUFFER_BIT_KHR                                                           FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_VERTEX_BUFFER_BIT
+	VK_FORMAT_FEATURE_2_COLOR_ATTACHMENT_BIT                                                            FormatFeatureFlagBits2 = (1 << 7)
+	VK_FORMAT_FEATURE_2_COLOR_ATTACHMENT_BIT_KHR                                                        FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_COLOR_ATTACHMENT_BIT
+	VK_FORMAT_FEATURE_2_COLOR_ATTACHMENT_BLEND_BIT                                                      FormatFeatureFlagBits2 = (1 << 8)
+	VK_FORMAT_FEATURE_2_COLOR_ATTACHMENT_BLEND_BIT_KHR                                                  FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_COLOR_ATTACHMENT_BLEND_BIT
+	VK_FORMAT_FEATURE_2_DEPTH_STENCIL_ATTACHMENT_BIT                                                    FormatFeatureFlagBits2 = (1 << 9)
+	VK_FORMAT_FEATURE_2_DEPTH_STENCIL_ATTACHMENT_BIT_KHR                                                FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_DEPTH_STENCIL_ATTACHMENT_BIT
+	VK_FORMAT_FEATURE_2_BLIT_SRC_BIT                                                                    FormatFeatureFlagBits2 = (1 << 10)
+	VK_FORMAT_FEATURE_2_BLIT_SRC_BIT_KHR                                                                FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_BLIT_SRC_BIT
+	VK_FORMAT_FEATURE_2_BLIT_DST_BIT                                                                    FormatFeatureFlagBits2 = (1 << 11)
+	VK_FORMAT_FEATURE_2_BLIT_DST_BIT_KHR                                                                FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_BLIT_DST_BIT
+	VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_FILTER_LINEAR_BIT                                                 FormatFeatureFlagBits2 = (1 << 12)
+	VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_FILTER_LINEAR_BIT_KHR                                             FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_FILTER_LINEAR_BIT
+	VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_FILTER_CUBIC_BIT                                                  FormatFeatureFlagBits2 = (1 << 13)
+	VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_FILTER_CUBIC_BIT_EXT                                              FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_FILTER_CUBIC_BIT
+	VK_FORMAT_FEATURE_2_TRANSFER_SRC_BIT                                                                FormatFeatureFlagBits2 = (1 << 14)
+	VK_FORMAT_FEATURE_2_TRANSFER_SRC_BIT_KHR                                                            FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_TRANSFER_SRC_BIT
+	VK_FORMAT_FEATURE_2_TRANSFER_DST_BIT                                                                FormatFeatureFlagBits2 = (1 << 15)
+	VK_FORMAT_FEATURE_2_TRANSFER_DST_BIT_KHR                                                            FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_TRANSFER_DST_BIT
+	VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_FILTER_MINMAX_BIT                                                 FormatFeatureFlagBits2 = (1 << 16)
+	VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_FILTER_MINMAX_BIT_KHR                                             FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_FILTER_MINMAX_BIT
+	VK_FORMAT_FEATURE_2_MIDPOINT_CHROMA_SAMPLES_BIT                                                     FormatFeatureFlagBits2 = (1 << 17)
+	VK_FORMAT_FEATURE_2_MIDPOINT_CHROMA_SAMPLES_BIT_KHR                                                 FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_MIDPOINT_CHROMA_SAMPLES_BIT
+	VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_YCBCR_CONVERSION_LINEAR_FILTER_BIT                                FormatFeatureFlagBits2 = (1 << 18)
+	VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_YCBCR_CONVERSION_LINEAR_FILTER_BIT_KHR                            FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_YCBCR_CONVERSION_LINEAR_FILTER_BIT
+	VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_YCBCR_CONVERSION_SEPARATE_RECONSTRUCTION_FILTER_BIT               FormatFeatureFlagBits2 = (1 << 19)
+	VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_YCBCR_CONVERSION_SEPARATE_RECONSTRUCTION_FILTER_BIT_KHR           FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_YCBCR_CONVERSION_SEPARATE_RECONSTRUCTION_FILTER_BIT
+	VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_YCBCR_CONVERSION_CHROMA_RECONSTRUCTION_EXPLICIT_BIT               FormatFeatureFlagBits2 = (1 << 20)
+	VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_YCBCR_CONVERSION_CHROMA_RECONSTRUCTION_EXPLICIT_BIT_KHR           FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_YCBCR_CONVERSION_CHROMA_RECONSTRUCTION_EXPLICIT_BIT
+	VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_YCBCR_CONVERSION_CHROMA_RECONSTRUCTION_EXPLICIT_FORCEABLE_BIT     FormatFeatureFlagBits2 = (1 << 21)
+	VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_YCBCR_CONVERSION_CHROMA_RECONSTRUCTION_EXPLICIT_FORCEABLE_BIT_KHR FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_YCBCR_CONVERSION_CHROMA_RECONSTRUCTION_EXPLICIT_FORCEABLE_BIT
+	VK_FORMAT_FEATURE_2_DISJOINT_BIT                                                                    FormatFeatureFlagBits2 = (1 << 22)
+	VK_FORMAT_FEATURE_2_DISJOINT_BIT_KHR                                                                FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_DISJOINT_BIT
+	VK_FORMAT_FEATURE_2_COSITED_CHROMA_SAMPLES_BIT                                                      FormatFeatureFlagBits2 = (1 << 23)
+	VK_FORMAT_FEATURE_2_COSITED_CHROMA_SAMPLES_BIT_KHR                                                  FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_COSITED_CHROMA_SAMPLES_BIT
+	VK_FORMAT_FEATURE_2_STORAGE_READ_WITHOUT_FORMAT_BIT                                                 FormatFeatureFlagBits2 = (1 << 31)
+	VK_FORMAT_FEATURE_2_STORAGE_READ_WITHOUT_FORMAT_BIT_KHR                                             FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_STORAGE_READ_WITHOUT_FORMAT_BIT
+	VK_FORMAT_FEATURE_2_STORAGE_WRITE_WITHOUT_FORMAT_BIT                                                FormatFeatureFlagBits2 = (1 << 32)
+	VK_FORMAT_FEATURE_2_STORAGE_WRITE_WITHOUT_FORMAT_BIT_KHR                                            FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_STORAGE_WRITE_WITHOUT_FORMAT_BIT
+	VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_DEPTH_COMPARISON_BIT                                              FormatFeatureFlagBits2 = (1 << 33)
+	VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_DEPTH_COMPARISON_BIT_KHR                                          FormatFeatureFlagBits2 = VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_DEPTH_COMPARISON_BIT
+)
+
+const enumNamesFormatFeatureFlagBits2 = "VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_BIT" +
+	"VK_FORMAT_FEATURE_2_STORAGE_IMAGE_BIT" +
+	"VK_FORMAT_FEATURE_2_STORAGE_IMAGE_ATOMIC_BIT" +
+	"VK_FORMAT_FEATURE_2_UNIFORM_TEXEL_BUFFER_BIT" +
+	"VK_FORMAT_FEATURE_2_STORAGE_TEXEL_BUFFER_BIT" +
+	"VK_FORMAT_FEATURE_2_STORAGE_TEXEL_BUFFER_ATOMIC_BIT" +
+	"VK_FORMAT_FEATURE_2_VERTEX_BUFFER_BIT" +
+	"VK_FORMAT_FEATURE_2_COLOR_ATTACHMENT_BIT" +
+	"VK_FORMAT_FEATURE_2_COLOR_ATTACHMENT_BLEND_BIT" +
+	"VK_FORMAT_FEATURE_2_DEPTH_STENCIL_ATTACHMENT_BIT" +
+	"VK_FORMAT_FEATURE_2_BLIT_SRC_BIT" +
+	"VK_FORMAT_FEATURE_2_BLIT_DST_BIT" +
+	"VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_FILTER_LINEAR_BIT" +
+	"VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_FILTER_CUBIC_BIT" +
+	"VK_FORMAT_FEATURE_2_TRANSFER_SRC_BIT" +
+	"VK_FORMAT_FEATURE_2_TRANSFER_DST_BIT" +
+	"VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_FILTER_MINMAX_BIT" +
+	"VK_FORMAT_FEATURE_2_MIDPOINT_CHROMA_SAMPLES_BIT" +
+	"VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_YCBCR_CONVERSION_LINEAR_FILTER_BIT" +
+	"VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_YCBCR_CONVERSION_SEPARATE_RECONSTRUCTION_FILTER_BIT" +
+	"VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_YCBCR_CONVERSION_CHROMA_RECONSTRUCTION_EXPLICIT_BIT" +
+	"VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_YCBCR_CONVERSION_CHROMA_RECONSTRUCTION_EXPLICIT_FORCEABLE_BIT" +
+	"VK_FORMAT_FEATURE_2_DISJOINT_BIT" +
+	"VK_FORMAT_FEATURE_2_COSITED_CHROMA_SAMPLES_BIT" +
+	"VK_FORMAT_FEATURE_2_STORAGE_READ_WITHOUT_FORMAT_BIT" +
+	"VK_FORMAT_FEATURE_2_STORAGE_WRITE_WITHOUT_FORMAT_BIT" +
+	"VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_DEPTH_COMPARISON_BIT"
+
+var enumTableFormatFeatureFlagBits2 = enumTable[FormatFeatureFlagBits2, uint16]{
+	first: VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_BIT,
+	dense: 8,
+	sparse: []FormatFeatureFlagBits2{
+		VK_FORMAT_FEATURE_2_STORAGE_TEXEL_BUFFER_BIT,
+		VK_FORMAT_FEATURE_2_STORAGE_TEXEL_BUFFER_ATOMIC_BIT,
+		VK_FORMAT_FEATURE_2_VERTEX_BUFFER_BIT,
+		VK_FORMAT_FEATURE_2_COLOR_ATTACHMENT_BIT,
+		VK_FORMAT_FEATURE_2_COLOR_ATTACHMENT_BLEND_BIT,
+		VK_FORMAT_FEATURE_2_DEPTH_STENCIL_ATTACHMENT_BIT,
+		VK_FORMAT_FEATURE_2_BLIT_SRC_BIT,
+		VK_FORMAT_FEATURE_2_BLIT_DST_BIT,
+		VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_FILTER_LINEAR_BIT,
+		VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_FILTER_CUBIC_BIT,
+		VK_FORMAT_FEATURE_2_TRANSFER_SRC_BIT,
+		VK_FORMAT_FEATURE_2_TRANSFER_DST_BIT,
+		VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_FILTER_MINMAX_BIT,
+		VK_FORMAT_FEATURE_2_MIDPOINT_CHROMA_SAMPLES_BIT,
+		VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_YCBCR_CONVERSION_LINEAR_FILTER_BIT,
+		VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_YCBCR_CONVERSION_SEPARATE_RECONSTRUCTION_FILTER_BIT,
+		VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_YCBCR_CONVERSION_CHROMA_RECONSTRUCTION_EXPLICIT_BIT,
+		VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_YCBCR_CONVERSION_CHROMA_RECONSTRUCTION_EXPLICIT_FORCEABLE_BIT,
+		VK_FORMAT_FEATURE_2_DISJOINT_BIT,
+		VK_FORMAT_FEATURE_2_COSITED_CHROMA_SAMPLES_BIT,
+		VK_FORMAT_FEATURE_2_STORAGE_READ_WITHOUT_FORMAT_BIT,
+		VK_FORMAT_FEATURE_2_STORAGE_WRITE_WITHOUT_FORMAT_BIT,
+		VK_FORMAT_FEATURE_2_SAMPLED_IMAGE_DEPTH_COMPARISON_BIT,
+	},
+	names: enumNamesFormatFeatureFlagBits2,
+	index: []uint16{0, 37, 74, 74, 118, 118, 118, 118, 162, 206, 257, 294, 334, 380, 428, 460, 492, 543, 593, 629, 665, 716, 763, 831, 916, 1001, 1096, 1128, 1174, 1225, 1277, 1331},
+}
+
+func (x FormatFeatureFlagBits2) String() string {
+	if s, ok := enumTableFormatFeatureFlagBits2.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("FormatFeatureFlagBits2=%d", x)
+}
+
+// SubmitFlagBits enum/enums
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSubmitFlagBits.html
+type SubmitFlagBits uint32
+
+const (
+	VK_SUBMIT_PROTECTED_BIT     SubmitFlagBits = (1 << 0)
+	VK_SUBMIT_PROTECTED_BIT_KHR SubmitFlagBits = VK_SUBMIT_PROTECTED_BIT
+)
+
+const enumNamesSubmitFlagBits = "VK_SUBMIT_PROTECTED_BIT"
+
+var enumTableSubmitFlagBits = enumTable[SubmitFlagBits, uint16]{
+	sparse: []SubmitFlagBits{
+		VK_SUBMIT_PROTECTED_BIT,
+	},
+	names: enumNamesSubmitFlagBits,
+	index: []uint16{0, 23},
+}
+
+func (x SubmitFlagBits) String() string {
+	if s, ok := enumTableSubmitFlagBits.name(x); ok {
+		return s
+	}
+	return fmt.Sprintf("SubmitFlagBits=%d", x)
+}
+
+// SubmitFlags bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSubmitFlags.html
+type SubmitFlags Flags
+
+// Bits appends the SubmitFlagBits set in x to dst, lowest first.
+func (x SubmitFlags) Bits(dst []SubmitFlagBits) []SubmitFlagBits {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x SubmitFlags) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableSubmitFlagBits)
+}
+
+func (x SubmitFlags) String() string {
+	return flagsString(x, &enumTableSubmitFlagBits)
+}
+
+// ParseSubmitFlags parses the names of SubmitFlagBits values, or numbers,
+// separated by |.
+func ParseSubmitFlags(s string) (SubmitFlags, error) {
+	x, err := parseFlags(s, &enumTableSubmitFlagBits)
+	return SubmitFlags(x), err
+}
+
+// PipelineCreationFeedbackFlags bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPipelineCreationFeedbackFlags.html
+type PipelineCreationFeedbackFlags Flags
+
+// Bits appends the PipelineCreationFeedbackFlagBits set in x to dst, lowest first.
+func (x PipelineCreationFeedbackFlags) Bits(dst []PipelineCreationFeedbackFlagBits) []PipelineCreationFeedbackFlagBits {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x PipelineCreationFeedbackFlags) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTablePipelineCreationFeedbackFlagBits)
+}
+
+func (x PipelineCreationFeedbackFlags) String() string {
+	return flagsString(x, &enumTablePipelineCreationFeedbackFlagBits)
+}
+
+// ParsePipelineCreationFeedbackFlags parses the names of PipelineCreationFeedbackFlagBits values, or numbers,
+// separated by |.
+func ParsePipelineCreationFeedbackFlags(s string) (PipelineCreationFeedbackFlags, error) {
+	x, err := parseFlags(s, &enumTablePipelineCreationFeedbackFlagBits)
+	return PipelineCreationFeedbackFlags(x), err
+}
+
+// AccessFlags2 bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkAccessFlags2.html
+type AccessFlags2 Flags64
+
+// Bits appends the AccessFlagBits2 set in x to dst, lowest first.
+func (x AccessFlags2) Bits(dst []AccessFlagBits2) []AccessFlagBits2 {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x AccessFlags2) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableAccessFlagBits2)
+}
+
+func (x AccessFlags2) String() string {
+	return flagsString(x, &enumTableAccessFlagBits2)
+}
+
+// ParseAccessFlags2 parses the names of AccessFlagBits2 values, or numbers,
+// separated by |.
+func ParseAccessFlags2(s string) (AccessFlags2, error) {
+	x, err := parseFlags(s, &enumTableAccessFlagBits2)
+	return AccessFlags2(x), err
+}
+
+// FormatFeatureFlags2 bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkFormatFeatureFlags2.html
+type FormatFeatureFlags2 Flags64
+
+// Bits appends the FormatFeatureFlagBits2 set in x to dst, lowest first.
+func (x FormatFeatureFlags2) Bits(dst []FormatFeatureFlagBits2) []FormatFeatureFlagBits2 {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x FormatFeatureFlags2) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableFormatFeatureFlagBits2)
+}
+
+func (x FormatFeatureFlags2) String() string {
+	return flagsString(x, &enumTableFormatFeatureFlagBits2)
+}
+
+// ParseFormatFeatureFlags2 parses the names of FormatFeatureFlagBits2 values, or numbers,
+// separated by |.
+func ParseFormatFeatureFlags2(s string) (FormatFeatureFlags2, error) {
+	x, err := parseFlags(s, &enumTableFormatFeatureFlagBits2)
+	return FormatFeatureFlags2(x), err
+}
+
+// RenderingFlags bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkRenderingFlags.html
+type RenderingFlags Flags
+
+// Bits appends the RenderingFlagBits set in x to dst, lowest first.
+func (x RenderingFlags) Bits(dst []RenderingFlagBits) []RenderingFlagBits {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x RenderingFlags) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableRenderingFlagBits)
+}
+
+func (x RenderingFlags) String() string {
+	return flagsString(x, &enumTableRenderingFlagBits)
+}
+
+// ParseRenderingFlags parses the names of RenderingFlagBits values, or numbers,
+// separated by |.
+func ParseRenderingFlags(s string) (RenderingFlags, error) {
+	x, err := parseFlags(s, &enumTableRenderingFlagBits)
+	return RenderingFlags(x), err
+}
+
+// ToolPurposeFlags bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkToolPurposeFlags.html
+type ToolPurposeFlags Flags
+
+// Bits appends the ToolPurposeFlagBits set in x to dst, lowest first.
+func (x ToolPurposeFlags) Bits(dst []ToolPurposeFlagBits) []ToolPurposeFlagBits {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x ToolPurposeFlags) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTableToolPurposeFlagBits)
+}
+
+func (x ToolPurposeFlags) String() string {
+	return flagsString(x, &enumTableToolPurposeFlagBits)
+}
+
+// ParseToolPurposeFlags parses the names of ToolPurposeFlagBits values, or numbers,
+// separated by |.
+func ParseToolPurposeFlags(s string) (ToolPurposeFlags, error) {
+	x, err := parseFlags(s, &enumTableToolPurposeFlagBits)
+	return ToolPurposeFlags(x), err
+}
+
+// PipelineStageFlags2 bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPipelineStageFlags2.html
+type PipelineStageFlags2 Flags64
+
+// Bits appends the PipelineStageFlagBits2 set in x to dst, lowest first.
+func (x PipelineStageFlags2) Bits(dst []PipelineStageFlagBits2) []PipelineStageFlagBits2 {
+	return appendFlagBits(dst, x)
+}
+
+// AppendString appends the names of the bits set in x to dst, separated by |.
+func (x PipelineStageFlags2) AppendString(dst []byte) []byte {
+	return appendFlagNames(dst, x, &enumTablePipelineStageFlagBits2)
+}
+
+func (x PipelineStageFlags2) String() string {
+	return flagsString(x, &enumTablePipelineStageFlagBits2)
+}
+
+// ParsePipelineStageFlags2 parses the names of PipelineStageFlagBits2 values, or numbers,
+// separated by |.
+func ParsePipelineStageFlags2(s string) (PipelineStageFlags2, error) {
+	x, err := parseFlags(s, &enumTablePipelineStageFlagBits2)
+	return PipelineStageFlags2(x), err
+}
+
+// PrivateDataSlotCreateFlags bitmask
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPrivateDataSlotCreateFlags.html
+type PrivateDataSlotCreateFlags Flags
+
+// PhysicalDeviceSubgroupSizeControlProperties provides a go interface for VkPhysicalDeviceSubgroupSizeControlProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceSubgroupSizeControlProperties.html
+type PhysicalDeviceSubgroupSizeControlProperties C.struct_VkPhysicalDeviceSubgroupSizeControlProperties
+
+// SizeofPhysicalDeviceSubgroupSizeControlProperties is the memory size of a PhysicalDeviceSubgroupSizeControlProperties
+var SizeofPhysicalDeviceSubgroupSizeControlProperties int = int(unsafe.Sizeof(PhysicalDeviceSubgroupSizeControlProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceSubgroupSizeControlProperties) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceSubgroupSizeControlProperties {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceSubgroupSizeControlProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceSubgroupSizeControlProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceSubgroupSizeControlProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceSubgroupSizeControlProperties) AsCPtr() *PhysicalDeviceSubgroupSizeControlProperties {
+	clone := (*PhysicalDeviceSubgroupSizeControlProperties)(newCBlock(cULong(SizeofPhysicalDeviceSubgroupSizeControlProperties)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceSubgroupSizeControlPropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceSubgroupSizeControlPropertiesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceSubgroupSizeControlProperties) []PhysicalDeviceSubgroupSizeControlProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceSubgroupSizeControlProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceSubgroupSizeControlProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceSubgroupSizeControlPropertiesFreeCSlice releases the memory allocated by PhysicalDeviceSubgroupSizeControlPropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceSubgroupSizeControlPropertiesFreeCSlice(x []PhysicalDeviceSubgroupSizeControlProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceSubgroupSizeControlPropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceSubgroupSizeControlPropertiesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceSubgroupSizeControlPropertiesMakeCSlice(x ...PhysicalDeviceSubgroupSizeControlProperties) []PhysicalDeviceSubgroupSizeControlProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceSubgroupSizeControlProperties * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceSubgroupSizeControlProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceSubgroupSizeControlProperties
+func (x PhysicalDeviceSubgroupSizeControlProperties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceSubgroupSizeControlProperties with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceSubgroupSizeControlProperties) WithDefaultSType() PhysicalDeviceSubgroupSizeControlProperties {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceSubgroupSizeControlProperties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES)
+}
+
+// WithSType clones a new PhysicalDeviceSubgroupSizeControlProperties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSubgroupSizeControlProperties) WithSType(y StructureType) PhysicalDeviceSubgroupSizeControlProperties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceSubgroupSizeControlProperties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceSubgroupSizeControlProperties
+func (x PhysicalDeviceSubgroupSizeControlProperties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceSubgroupSizeControlProperties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSubgroupSizeControlProperties) WithPNext(y unsafe.Pointer) PhysicalDeviceSubgroupSizeControlProperties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceSubgroupSizeControlProperties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceSubgroupSizeControlProperties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// MinSubgroupSize returns the value of minSubgroupSize from VkPhysicalDeviceSubgroupSizeControlProperties
+func (x PhysicalDeviceSubgroupSizeControlProperties) MinSubgroupSize() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.minSubgroupSize)
+	return *ptr
+}
+
+// MaxSubgroupSize returns the value of maxSubgroupSize from VkPhysicalDeviceSubgroupSizeControlProperties
+func (x PhysicalDeviceSubgroupSizeControlProperties) MaxSubgroupSize() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxSubgroupSize)
+	return *ptr
+}
+
+// MaxComputeWorkgroupSubgroups returns the value of maxComputeWorkgroupSubgroups from VkPhysicalDeviceSubgroupSizeControlProperties
+func (x PhysicalDeviceSubgroupSizeControlProperties) MaxComputeWorkgroupSubgroups() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxComputeWorkgroupSubgroups)
+	return *ptr
+}
+
+// RequiredSubgroupSizeStages returns the value of requiredSubgroupSizeStages from VkPhysicalDeviceSubgroupSizeControlProperties
+func (x PhysicalDeviceSubgroupSizeControlProperties) RequiredSubgroupSizeStages() ShaderStageFlags {
+	ptr := /* typedef */ (*ShaderStageFlags)(&x.requiredSubgroupSizeStages)
+	return *ptr
+}
+
+// PhysicalDeviceInlineUniformBlockFeatures provides a go interface for VkPhysicalDeviceInlineUniformBlockFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceInlineUniformBlockFeatures.html
+type PhysicalDeviceInlineUniformBlockFeatures C.struct_VkPhysicalDeviceInlineUniformBlockFeatures
+
+// SizeofPhysicalDeviceInlineUniformBlockFeatures is the memory size of a PhysicalDeviceInlineUniformBlockFeatures
+var SizeofPhysicalDeviceInlineUniformBlockFeatures int = int(unsafe.Sizeof(PhysicalDeviceInlineUniformBlockFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceInlineUniformBlockFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceInlineUniformBlockFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceInlineUniformBlockFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceInlineUniformBlockFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceInlineUniformBlockFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceInlineUniformBlockFeatures) AsCPtr() *PhysicalDeviceInlineUniformBlockFeatures {
+	clone := (*PhysicalDeviceInlineUniformBlockFeatures)(newCBlock(cULong(SizeofPhysicalDeviceInlineUniformBlockFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceInlineUniformBlockFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceInlineUniformBlockFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceInlineUniformBlockFeatures) []PhysicalDeviceInlineUniformBlockFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceInlineUniformBlockFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceInlineUniformBlockFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceInlineUniformBlockFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceInlineUniformBlockFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceInlineUniformBlockFeaturesFreeCSlice(x []PhysicalDeviceInlineUniformBlockFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceInlineUniformBlockFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceInlineUniformBlockFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceInlineUniformBlockFeaturesMakeCSlice(x ...PhysicalDeviceInlineUniformBlockFeatures) []PhysicalDeviceInlineUniformBlockFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceInlineUniformBlockFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceInlineUniformBlockFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceInlineUniformBlockFeatures
+func (x PhysicalDeviceInlineUniformBlockFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceInlineUniformBlockFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceInlineUniformBlockFeatures) WithDefaultSType() PhysicalDeviceInlineUniformBlockFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceInlineUniformBlockFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceInlineUniformBlockFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceInlineUniformBlockFeatures) WithSType(y StructureType) PhysicalDeviceInlineUniformBlockFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceInlineUniformBlockFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceInlineUniformBlockFeatures
+func (x PhysicalDeviceInlineUniformBlockFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceInlineUniformBlockFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceInlineUniformBlockFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceInlineUniformBlockFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceInlineUniformBlockFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceInlineUniformBlockFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// InlineUniformBlock returns the value of inlineUniformBlock from VkPhysicalDeviceInlineUniformBlockFeatures
+func (x PhysicalDeviceInlineUniformBlockFeatures) InlineUniformBlock() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.inlineUniformBlock)
+	return *ptr
+}
+
+// WithInlineUniformBlock clones a new PhysicalDeviceInlineUniformBlockFeatures with the value of
+// InlineUniformBlock updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceInlineUniformBlockFeatures) WithInlineUniformBlock(y Bool32) PhysicalDeviceInlineUniformBlockFeatures {
+	x.inlineUniformBlock = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceInlineUniformBlockFeatures) SetInlineUniformBlock(y Bool32) {
+	x.inlineUniformBlock = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DescriptorBindingInlineUniformBlockUpdateAfterBind returns the value of descriptorBindingInlineUniformBlockUpdateAfterBind from VkPhysicalDeviceInlineUniformBlockFeatures
+func (x PhysicalDeviceInlineUniformBlockFeatures) DescriptorBindingInlineUniformBlockUpdateAfterBind() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.descriptorBindingInlineUniformBlockUpdateAfterBind)
+	return *ptr
+}
+
+// WithDescriptorBindingInlineUniformBlockUpdateAfterBind clones a new PhysicalDeviceInlineUniformBlockFeatures with the value of
+// DescriptorBindingInlineUniformBlockUpdateAfterBind updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceInlineUniformBlockFeatures) WithDescriptorBindingInlineUniformBlockUpdateAfterBind(y Bool32) PhysicalDeviceInlineUniformBlockFeatures {
+	x.descriptorBindingInlineUniformBlockUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceInlineUniformBlockFeatures) SetDescriptorBindingInlineUniformBlockUpdateAfterBind(y Bool32) {
+	x.descriptorBindingInlineUniformBlockUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// WriteDescriptorSetInlineUniformBlock provides a go interface for VkWriteDescriptorSetInlineUniformBlock.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkWriteDescriptorSetInlineUniformBlock.html
+type WriteDescriptorSetInlineUniformBlock C.struct_VkWriteDescriptorSetInlineUniformBlock
+
+// SizeofWriteDescriptorSetInlineUniformBlock is the memory size of a WriteDescriptorSetInlineUniformBlock
+var SizeofWriteDescriptorSetInlineUniformBlock int = int(unsafe.Sizeof(WriteDescriptorSetInlineUniformBlock{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x WriteDescriptorSetInlineUniformBlock) ArpPtr(arp *AutoReleasePool) *WriteDescriptorSetInlineUniformBlock {
+	ptr := newCBlock(cULong(SizeofWriteDescriptorSetInlineUniformBlock))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*WriteDescriptorSetInlineUniformBlock)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *WriteDescriptorSetInlineUniformBlock) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x WriteDescriptorSetInlineUniformBlock) AsCPtr() *WriteDescriptorSetInlineUniformBlock {
+	clone := (*WriteDescriptorSetInlineUniformBlock)(newCBlock(cULong(SizeofWriteDescriptorSetInlineUniformBlock)))
+	*clone = x
+	return clone
+}
+
+// WriteDescriptorSetInlineUniformBlockCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func WriteDescriptorSetInlineUniformBlockCSlice(arp *AutoReleasePool, x ...WriteDescriptorSetInlineUniformBlock) []WriteDescriptorSetInlineUniformBlock {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofWriteDescriptorSetInlineUniformBlock * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*WriteDescriptorSetInlineUniformBlock)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// WriteDescriptorSetInlineUniformBlockFreeCSlice releases the memory allocated by WriteDescriptorSetInlineUniformBlockMakeCSlice.
+// It does not free pointers stored inside the slice.
+func WriteDescriptorSetInlineUniformBlockFreeCSlice(x []WriteDescriptorSetInlineUniformBlock) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// WriteDescriptorSetInlineUniformBlockMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. WriteDescriptorSetInlineUniformBlockFreeCSlice must be called on the returned slice.
+func WriteDescriptorSetInlineUniformBlockMakeCSlice(x ...WriteDescriptorSetInlineUniformBlock) []WriteDescriptorSetInlineUniformBlock {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofWriteDescriptorSetInlineUniformBlock * len(x)
+	dst := unsafe.Slice((*WriteDescriptorSetInlineUniformBlock)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkWriteDescriptorSetInlineUniformBlock
+func (x WriteDescriptorSetInlineUniformBlock) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new WriteDescriptorSetInlineUniformBlock with the value of
+// SType to the value provided in the specification.
+func (x WriteDescriptorSetInlineUniformBlock) WithDefaultSType() WriteDescriptorSetInlineUniformBlock {
+	return x.WithSType(VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *WriteDescriptorSetInlineUniformBlock) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK)
+}
+
+// WithSType clones a new WriteDescriptorSetInlineUniformBlock with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x WriteDescriptorSetInlineUniformBlock) WithSType(y StructureType) WriteDescriptorSetInlineUniformBlock {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *WriteDescriptorSetInlineUniformBlock) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkWriteDescriptorSetInlineUniformBlock
+func (x WriteDescriptorSetInlineUniformBlock) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new WriteDescriptorSetInlineUniformBlock with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x WriteDescriptorSetInlineUniformBlock) WithPNext(y unsafe.Pointer) WriteDescriptorSetInlineUniformBlock {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *WriteDescriptorSetInlineUniformBlock) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *WriteDescriptorSetInlineUniformBlock) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// DataSize returns the value of dataSize from VkWriteDescriptorSetInlineUniformBlock
+func (x WriteDescriptorSetInlineUniformBlock) DataSize() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.dataSize)
+	return *ptr
+}
+
+// WithDataSize clones a new WriteDescriptorSetInlineUniformBlock with the value of
+// DataSize updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x WriteDescriptorSetInlineUniformBlock) WithDataSize(y uint32) WriteDescriptorSetInlineUniformBlock {
+	x.dataSize = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *WriteDescriptorSetInlineUniformBlock) SetDataSize(y uint32) {
+	x.dataSize = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PData returns the value of pData from VkWriteDescriptorSetInlineUniformBlock
+func (x WriteDescriptorSetInlineUniformBlock) PData() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pData)
+	return *ptr
+}
+
+// WithPData clones a new WriteDescriptorSetInlineUniformBlock with the value of
+// PData updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x WriteDescriptorSetInlineUniformBlock) WithPData(y unsafe.Pointer) WriteDescriptorSetInlineUniformBlock {
+	x.pData = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *WriteDescriptorSetInlineUniformBlock) SetPData(y unsafe.Pointer) {
+	x.pData = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPData pins the Go memory referenced by y with the AutoReleasePool
+// and sets PData, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *WriteDescriptorSetInlineUniformBlock) PinPData(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPData(y)
+}
+
+// DeviceBufferMemoryRequirements provides a go interface for VkDeviceBufferMemoryRequirements.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDeviceBufferMemoryRequirements.html
+type DeviceBufferMemoryRequirements C.struct_VkDeviceBufferMemoryRequirements
+
+// SizeofDeviceBufferMemoryRequirements is the memory size of a DeviceBufferMemoryRequirements
+var SizeofDeviceBufferMemoryRequirements int = int(unsafe.Sizeof(DeviceBufferMemoryRequirements{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DeviceBufferMemoryRequirements) ArpPtr(arp *AutoReleasePool) *DeviceBufferMemoryRequirements {
+	ptr := newCBlock(cULong(SizeofDeviceBufferMemoryRequirements))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DeviceBufferMemoryRequirements)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DeviceBufferMemoryRequirements) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DeviceBufferMemoryRequirements) AsCPtr() *DeviceBufferMemoryRequirements {
+	clone := (*DeviceBufferMemoryRequirements)(newCBlock(cULong(SizeofDeviceBufferMemoryRequirements)))
+	*clone = x
+	return clone
+}
+
+// DeviceBufferMemoryRequirementsCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DeviceBufferMemoryRequirementsCSlice(arp *AutoReleasePool, x ...DeviceBufferMemoryRequirements) []DeviceBufferMemoryRequirements {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceBufferMemoryRequirements * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DeviceBufferMemoryRequirements)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DeviceBufferMemoryRequirementsFreeCSlice releases the memory allocated by DeviceBufferMemoryRequirementsMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DeviceBufferMemoryRequirementsFreeCSlice(x []DeviceBufferMemoryRequirements) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DeviceBufferMemoryRequirementsMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DeviceBufferMemoryRequirementsFreeCSlice must be called on the returned slice.
+func DeviceBufferMemoryRequirementsMakeCSlice(x ...DeviceBufferMemoryRequirements) []DeviceBufferMemoryRequirements {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceBufferMemoryRequirements * len(x)
+	dst := unsafe.Slice((*DeviceBufferMemoryRequirements)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDeviceBufferMemoryRequirements
+func (x DeviceBufferMemoryRequirements) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DeviceBufferMemoryRequirements with the value of
+// SType to the value provided in the specification.
+func (x DeviceBufferMemoryRequirements) WithDefaultSType() DeviceBufferMemoryRequirements {
+	return x.WithSType(VK_STRUCTURE_TYPE_DEVICE_BUFFER_MEMORY_REQUIREMENTS)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DeviceBufferMemoryRequirements) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DEVICE_BUFFER_MEMORY_REQUIREMENTS)
+}
+
+// WithSType clones a new DeviceBufferMemoryRequirements with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceBufferMemoryRequirements) WithSType(y StructureType) DeviceBufferMemoryRequirements {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DeviceBufferMemoryRequirements) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDeviceBufferMemoryRequirements
+func (x DeviceBufferMemoryRequirements) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DeviceBufferMemoryRequirements with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceBufferMemoryRequirements) WithPNext(y unsafe.Pointer) DeviceBufferMemoryRequirements {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceBufferMemoryRequirements) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DeviceBufferMemoryRequirements) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// PCreateInfo returns the value of pCreateInfo from VkDeviceBufferMemoryRequirements
+func (x DeviceBufferMemoryRequirements) PCreateInfo() *BufferCreateInfo {
+	ptr := func(x **C.struct_VkBufferCreateInfo) **BufferCreateInfo { /* Pointer */
+		c2g := (*BufferCreateInfo)(*x)
+		return &c2g
+	}(&x.pCreateInfo)
+	return *ptr
+}
+
+// WithPCreateInfo clones a new DeviceBufferMemoryRequirements with the value of
+// PCreateInfo updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceBufferMemoryRequirements) WithPCreateInfo(y *BufferCreateInfo) DeviceBufferMemoryRequirements {
+	x.pCreateInfo = *(func(x **BufferCreateInfo) **C.struct_VkBufferCreateInfo { /* Pointer */
+		g2c := (*C.struct_VkBufferCreateInfo)(*x)
+		return &g2c
+	}(&y))
+	return x
+}
+func (x *DeviceBufferMemoryRequirements) SetPCreateInfo(y *BufferCreateInfo) {
+	x.pCreateInfo = *(func(x **BufferCreateInfo) **C.struct_VkBufferCreateInfo { /* Pointer */
+		g2c := (*C.struct_VkBufferCreateInfo)(*x)
+		return &g2c
+	}(&y))
+}
+
+// PinPCreateInfo pins the Go memory referenced by y with the AutoReleasePool
+// and sets PCreateInfo, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DeviceBufferMemoryRequirements) PinPCreateInfo(arp *AutoReleasePool, y *BufferCreateInfo) {
+	arp.Pin(unsafe.Pointer(y))
+	x.SetPCreateInfo(y)
+}
+
+// PhysicalDeviceMaintenance4Properties provides a go interface for VkPhysicalDeviceMaintenance4Properties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceMaintenance4Properties.html
+type PhysicalDeviceMaintenance4Properties C.struct_VkPhysicalDeviceMaintenance4Properties
+
+// SizeofPhysicalDeviceMaintenance4Properties is the memory size of a PhysicalDeviceMaintenance4Properties
+var SizeofPhysicalDeviceMaintenance4Properties int = int(unsafe.Sizeof(PhysicalDeviceMaintenance4Properties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceMaintenance4Properties) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceMaintenance4Properties {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceMaintenance4Properties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceMaintenance4Properties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceMaintenance4Properties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceMaintenance4Properties) AsCPtr() *PhysicalDeviceMaintenance4Properties {
+	clone := (*PhysicalDeviceMaintenance4Properties)(newCBlock(cULong(SizeofPhysicalDeviceMaintenance4Properties)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceMaintenance4PropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceMaintenance4PropertiesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceMaintenance4Properties) []PhysicalDeviceMaintenance4Properties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceMaintenance4Properties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceMaintenance4Properties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceMaintenance4PropertiesFreeCSlice releases the memory allocated by PhysicalDeviceMaintenance4PropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceMaintenance4PropertiesFreeCSlice(x []PhysicalDeviceMaintenance4Properties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceMaintenance4PropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceMaintenance4PropertiesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceMaintenance4PropertiesMakeCSlice(x ...PhysicalDeviceMaintenance4Properties) []PhysicalDeviceMaintenance4Properties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceMaintenance4Properties * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceMaintenance4Properties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceMaintenance4Properties
+func (x PhysicalDeviceMaintenance4Properties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceMaintenance4Properties with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceMaintenance4Properties) WithDefaultSType() PhysicalDeviceMaintenance4Properties {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceMaintenance4Properties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_PROPERTIES)
+}
+
+// WithSType clones a new PhysicalDeviceMaintenance4Properties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceMaintenance4Properties) WithSType(y StructureType) PhysicalDeviceMaintenance4Properties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceMaintenance4Properties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceMaintenance4Properties
+func (x PhysicalDeviceMaintenance4Properties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceMaintenance4Properties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceMaintenance4Properties) WithPNext(y unsafe.Pointer) PhysicalDeviceMaintenance4Properties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceMaintenance4Properties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceMaintenance4Properties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// MaxBufferSize returns the value of maxBufferSize from VkPhysicalDeviceMaintenance4Properties
+func (x PhysicalDeviceMaintenance4Properties) MaxBufferSize() DeviceSize {
+	ptr := /* typedef */ (*DeviceSize)(&x.maxBufferSize)
+	return *ptr
+}
+
+// PhysicalDeviceMaintenance4Features provides a go interface for VkPhysicalDeviceMaintenance4Features.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceMaintenance4Features.html
+type PhysicalDeviceMaintenance4Features C.struct_VkPhysicalDeviceMaintenance4Features
+
+// SizeofPhysicalDeviceMaintenance4Features is the memory size of a PhysicalDeviceMaintenance4Features
+var SizeofPhysicalDeviceMaintenance4Features int = int(unsafe.Sizeof(PhysicalDeviceMaintenance4Features{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceMaintenance4Features) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceMaintenance4Features {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceMaintenance4Features))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceMaintenance4Features)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceMaintenance4Features) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceMaintenance4Features) AsCPtr() *PhysicalDeviceMaintenance4Features {
+	clone := (*PhysicalDeviceMaintenance4Features)(newCBlock(cULong(SizeofPhysicalDeviceMaintenance4Features)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceMaintenance4FeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceMaintenance4FeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceMaintenance4Features) []PhysicalDeviceMaintenance4Features {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceMaintenance4Features * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceMaintenance4Features)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceMaintenance4FeaturesFreeCSlice releases the memory allocated by PhysicalDeviceMaintenance4FeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceMaintenance4FeaturesFreeCSlice(x []PhysicalDeviceMaintenance4Features) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceMaintenance4FeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceMaintenance4FeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceMaintenance4FeaturesMakeCSlice(x ...PhysicalDeviceMaintenance4Features) []PhysicalDeviceMaintenance4Features {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceMaintenance4Features * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceMaintenance4Features)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceMaintenance4Features
+func (x PhysicalDeviceMaintenance4Features) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceMaintenance4Features with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceMaintenance4Features) WithDefaultSType() PhysicalDeviceMaintenance4Features {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceMaintenance4Features) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_4_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceMaintenance4Features with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceMaintenance4Features) WithSType(y StructureType) PhysicalDeviceMaintenance4Features {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceMaintenance4Features) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceMaintenance4Features
+func (x PhysicalDeviceMaintenance4Features) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceMaintenance4Features with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceMaintenance4Features) WithPNext(y unsafe.Pointer) PhysicalDeviceMaintenance4Features {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceMaintenance4Features) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceMaintenance4Features) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Maintenance4 returns the value of maintenance4 from VkPhysicalDeviceMaintenance4Features
+func (x PhysicalDeviceMaintenance4Features) Maintenance4() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.maintenance4)
+	return *ptr
+}
+
+// WithMaintenance4 clones a new PhysicalDeviceMaintenance4Features with the value of
+// Maintenance4 updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceMaintenance4Features) WithMaintenance4(y Bool32) PhysicalDeviceMaintenance4Features {
+	x.maintenance4 = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceMaintenance4Features) SetMaintenance4(y Bool32) {
+	x.maintenance4 = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PhysicalDevicePrivateDataFeatures provides a go interface for VkPhysicalDevicePrivateDataFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDevicePrivateDataFeatures.html
+type PhysicalDevicePrivateDataFeatures C.struct_VkPhysicalDevicePrivateDataFeatures
+
+// SizeofPhysicalDevicePrivateDataFeatures is the memory size of a PhysicalDevicePrivateDataFeatures
+var SizeofPhysicalDevicePrivateDataFeatures int = int(unsafe.Sizeof(PhysicalDevicePrivateDataFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDevicePrivateDataFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDevicePrivateDataFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDevicePrivateDataFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDevicePrivateDataFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDevicePrivateDataFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDevicePrivateDataFeatures) AsCPtr() *PhysicalDevicePrivateDataFeatures {
+	clone := (*PhysicalDevicePrivateDataFeatures)(newCBlock(cULong(SizeofPhysicalDevicePrivateDataFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDevicePrivateDataFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDevicePrivateDataFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDevicePrivateDataFeatures) []PhysicalDevicePrivateDataFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDevicePrivateDataFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDevicePrivateDataFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDevicePrivateDataFeaturesFreeCSlice releases the memory allocated by PhysicalDevicePrivateDataFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDevicePrivateDataFeaturesFreeCSlice(x []PhysicalDevicePrivateDataFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDevicePrivateDataFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDevicePrivateDataFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDevicePrivateDataFeaturesMakeCSlice(x ...PhysicalDevicePrivateDataFeatures) []PhysicalDevicePrivateDataFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDevicePrivateDataFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDevicePrivateDataFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDevicePrivateDataFeatures
+func (x PhysicalDevicePrivateDataFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDevicePrivateDataFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDevicePrivateDataFeatures) WithDefaultSType() PhysicalDevicePrivateDataFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIVATE_DATA_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDevicePrivateDataFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIVATE_DATA_FEATURES)
+}
+
+// WithSType clones a new PhysicalDevicePrivateDataFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePrivateDataFeatures) WithSType(y StructureType) PhysicalDevicePrivateDataFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDevicePrivateDataFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDevicePrivateDataFeatures
+func (x PhysicalDevicePrivateDataFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDevicePrivateDataFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePrivateDataFeatures) WithPNext(y unsafe.Pointer) PhysicalDevicePrivateDataFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDevicePrivateDataFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDevicePrivateDataFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// PrivateData returns the value of privateData from VkPhysicalDevicePrivateDataFeatures
+func (x PhysicalDevicePrivateDataFeatures) PrivateData() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.privateData)
+	return *ptr
+}
+
+// WithPrivateData clones a new PhysicalDevicePrivateDataFeatures with the value of
+// PrivateData updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePrivateDataFeatures) WithPrivateData(y Bool32) PhysicalDevicePrivateDataFeatures {
+	x.privateData = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevicePrivateDataFeatures) SetPrivateData(y Bool32) {
+	x.privateData = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DevicePrivateDataCreateInfo provides a go interface for VkDevicePrivateDataCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDevicePrivateDataCreateInfo.html
+type DevicePrivateDataCreateInfo C.struct_VkDevicePrivateDataCreateInfo
+
+// SizeofDevicePrivateDataCreateInfo is the memory size of a DevicePrivateDataCreateInfo
+var SizeofDevicePrivateDataCreateInfo int = int(unsafe.Sizeof(DevicePrivateDataCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DevicePrivateDataCreateInfo) ArpPtr(arp *AutoReleasePool) *DevicePrivateDataCreateInfo {
+	ptr := newCBlock(cULong(SizeofDevicePrivateDataCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DevicePrivateDataCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DevicePrivateDataCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DevicePrivateDataCreateInfo) AsCPtr() *DevicePrivateDataCreateInfo {
+	clone := (*DevicePrivateDataCreateInfo)(newCBlock(cULong(SizeofDevicePrivateDataCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// DevicePrivateDataCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DevicePrivateDataCreateInfoCSlice(arp *AutoReleasePool, x ...DevicePrivateDataCreateInfo) []DevicePrivateDataCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDevicePrivateDataCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DevicePrivateDataCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DevicePrivateDataCreateInfoFreeCSlice releases the memory allocated by DevicePrivateDataCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DevicePrivateDataCreateInfoFreeCSlice(x []DevicePrivateDataCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DevicePrivateDataCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DevicePrivateDataCreateInfoFreeCSlice must be called on the returned slice.
+func DevicePrivateDataCreateInfoMakeCSlice(x ...DevicePrivateDataCreateInfo) []DevicePrivateDataCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDevicePrivateDataCreateInfo * len(x)
+	dst := unsafe.Slice((*DevicePrivateDataCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDevicePrivateDataCreateInfo
+func (x DevicePrivateDataCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DevicePrivateDataCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x DevicePrivateDataCreateInfo) WithDefaultSType() DevicePrivateDataCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DevicePrivateDataCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO)
+}
+
+// WithSType clones a new DevicePrivateDataCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DevicePrivateDataCreateInfo) WithSType(y StructureType) DevicePrivateDataCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DevicePrivateDataCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDevicePrivateDataCreateInfo
+func (x DevicePrivateDataCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DevicePrivateDataCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DevicePrivateDataCreateInfo) WithPNext(y unsafe.Pointer) DevicePrivateDataCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DevicePrivateDataCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DevicePrivateDataCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// PrivateDataSlotRequestCount returns the value of privateDataSlotRequestCount from VkDevicePrivateDataCreateInfo
+func (x DevicePrivateDataCreateInfo) PrivateDataSlotRequestCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.privateDataSlotRequestCount)
+	return *ptr
+}
+
+// WithPrivateDataSlotRequestCount clones a new DevicePrivateDataCreateInfo with the value of
+// PrivateDataSlotRequestCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DevicePrivateDataCreateInfo) WithPrivateDataSlotRequestCount(y uint32) DevicePrivateDataCreateInfo {
+	x.privateDataSlotRequestCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DevicePrivateDataCreateInfo) SetPrivateDataSlotRequestCount(y uint32) {
+	x.privateDataSlotRequestCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PrivateDataSlotCreateInfo provides a go interface for VkPrivateDataSlotCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPrivateDataSlotCreateInfo.html
+type PrivateDataSlotCreateInfo C.struct_VkPrivateDataSlotCreateInfo
+
+// SizeofPrivateDataSlotCreateInfo is the memory size of a PrivateDataSlotCreateInfo
+var SizeofPrivateDataSlotCreateInfo int = int(unsafe.Sizeof(PrivateDataSlotCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PrivateDataSlotCreateInfo) ArpPtr(arp *AutoReleasePool) *PrivateDataSlotCreateInfo {
+	ptr := newCBlock(cULong(SizeofPrivateDataSlotCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PrivateDataSlotCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PrivateDataSlotCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PrivateDataSlotCreateInfo) AsCPtr() *PrivateDataSlotCreateInfo {
+	clone := (*PrivateDataSlotCreateInfo)(newCBlock(cULong(SizeofPrivateDataSlotCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// PrivateDataSlotCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PrivateDataSlotCreateInfoCSlice(arp *AutoReleasePool, x ...PrivateDataSlotCreateInfo) []PrivateDataSlotCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPrivateDataSlotCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PrivateDataSlotCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PrivateDataSlotCreateInfoFreeCSlice releases the memory allocated by PrivateDataSlotCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PrivateDataSlotCreateInfoFreeCSlice(x []PrivateDataSlotCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PrivateDataSlotCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PrivateDataSlotCreateInfoFreeCSlice must be called on the returned slice.
+func PrivateDataSlotCreateInfoMakeCSlice(x ...PrivateDataSlotCreateInfo) []PrivateDataSlotCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPrivateDataSlotCreateInfo * len(x)
+	dst := unsafe.Slice((*PrivateDataSlotCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPrivateDataSlotCreateInfo
+func (x PrivateDataSlotCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PrivateDataSlotCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x PrivateDataSlotCreateInfo) WithDefaultSType() PrivateDataSlotCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_PRIVATE_DATA_SLOT_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PrivateDataSlotCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PRIVATE_DATA_SLOT_CREATE_INFO)
+}
+
+// WithSType clones a new PrivateDataSlotCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PrivateDataSlotCreateInfo) WithSType(y StructureType) PrivateDataSlotCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PrivateDataSlotCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPrivateDataSlotCreateInfo
+func (x PrivateDataSlotCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PrivateDataSlotCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PrivateDataSlotCreateInfo) WithPNext(y unsafe.Pointer) PrivateDataSlotCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PrivateDataSlotCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PrivateDataSlotCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Flags returns the value of flags from VkPrivateDataSlotCreateInfo
+func (x PrivateDataSlotCreateInfo) Flags() PrivateDataSlotCreateFlags {
+	ptr := /* typedef */ (*PrivateDataSlotCreateFlags)(&x.flags)
+	return *ptr
+}
+
+// WithFlags clones a new PrivateDataSlotCreateInfo with the value of
+// Flags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PrivateDataSlotCreateInfo) WithFlags(y PrivateDataSlotCreateFlags) PrivateDataSlotCreateInfo {
+	x.flags = *( /* typedef */ (*C.VkPrivateDataSlotCreateFlags)(&y))
+	return x
+}
+func (x *PrivateDataSlotCreateInfo) SetFlags(y PrivateDataSlotCreateFlags) {
+	x.flags = *( /* typedef */ (*C.VkPrivateDataSlotCreateFlags)(&y))
+}
+
+// PhysicalDeviceShaderDemoteToHelperInvocationFeatures provides a go interface for VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures.html
+type PhysicalDeviceShaderDemoteToHelperInvocationFeatures C.struct_VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures
+
+// SizeofPhysicalDeviceShaderDemoteToHelperInvocationFeatures is the memory size of a PhysicalDeviceShaderDemoteToHelperInvocationFeatures
+var SizeofPhysicalDeviceShaderDemoteToHelperInvocationFeatures int = int(unsafe.Sizeof(PhysicalDeviceShaderDemoteToHelperInvocationFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceShaderDemoteToHelperInvocationFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceShaderDemoteToHelperInvocationFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceShaderDemoteToHelperInvocationFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceShaderDemoteToHelperInvocationFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceShaderDemoteToHelperInvocationFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceShaderDemoteToHelperInvocationFeatures) AsCPtr() *PhysicalDeviceShaderDemoteToHelperInvocationFeatures {
+	clone := (*PhysicalDeviceShaderDemoteToHelperInvocationFeatures)(newCBlock(cULong(SizeofPhysicalDeviceShaderDemoteToHelperInvocationFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceShaderDemoteToHelperInvocationFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceShaderDemoteToHelperInvocationFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceShaderDemoteToHelperInvocationFeatures) []PhysicalDeviceShaderDemoteToHelperInvocationFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceShaderDemoteToHelperInvocationFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceShaderDemoteToHelperInvocationFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceShaderDemoteToHelperInvocationFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceShaderDemoteToHelperInvocationFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceShaderDemoteToHelperInvocationFeaturesFreeCSlice(x []PhysicalDeviceShaderDemoteToHelperInvocationFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceShaderDemoteToHelperInvocationFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceShaderDemoteToHelperInvocationFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceShaderDemoteToHelperInvocationFeaturesMakeCSlice(x ...PhysicalDeviceShaderDemoteToHelperInvocationFeatures) []PhysicalDeviceShaderDemoteToHelperInvocationFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceShaderDemoteToHelperInvocationFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceShaderDemoteToHelperInvocationFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures
+func (x PhysicalDeviceShaderDemoteToHelperInvocationFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceShaderDemoteToHelperInvocationFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceShaderDemoteToHelperInvocationFeatures) WithDefaultSType() PhysicalDeviceShaderDemoteToHelperInvocationFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DEMOTE_TO_HELPER_INVOCATION_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceShaderDemoteToHelperInvocationFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DEMOTE_TO_HELPER_INVOCATION_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceShaderDemoteToHelperInvocationFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderDemoteToHelperInvocationFeatures) WithSType(y StructureType) PhysicalDeviceShaderDemoteToHelperInvocationFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderDemoteToHelperInvocationFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures
+func (x PhysicalDeviceShaderDemoteToHelperInvocationFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceShaderDemoteToHelperInvocationFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderDemoteToHelperInvocationFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceShaderDemoteToHelperInvocationFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderDemoteToHelperInvocationFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceShaderDemoteToHelperInvocationFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ShaderDemoteToHelperInvocation returns the value of shaderDemoteToHelperInvocation from VkPhysicalDeviceShaderDemoteToHelperInvocationFeatures
+func (x PhysicalDeviceShaderDemoteToHelperInvocationFeatures) ShaderDemoteToHelperInvocation() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderDemoteToHelperInvocation)
+	return *ptr
+}
+
+// WithShaderDemoteToHelperInvocation clones a new PhysicalDeviceShaderDemoteToHelperInvocationFeatures with the value of
+// ShaderDemoteToHelperInvocation updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderDemoteToHelperInvocationFeatures) WithShaderDemoteToHelperInvocation(y Bool32) PhysicalDeviceShaderDemoteToHelperInvocationFeatures {
+	x.shaderDemoteToHelperInvocation = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderDemoteToHelperInvocationFeatures) SetShaderDemoteToHelperInvocation(y Bool32) {
+	x.shaderDemoteToHelperInvocation = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// FormatProperties3 provides a go interface for VkFormatProperties3.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkFormatProperties3.html
+type FormatProperties3 C.struct_VkFormatProperties3
+
+// SizeofFormatProperties3 is the memory size of a FormatProperties3
+var SizeofFormatProperties3 int = int(unsafe.Sizeof(FormatProperties3{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x FormatProperties3) ArpPtr(arp *AutoReleasePool) *FormatProperties3 {
+	ptr := newCBlock(cULong(SizeofFormatProperties3))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*FormatProperties3)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *FormatProperties3) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x FormatProperties3) AsCPtr() *FormatProperties3 {
+	clone := (*FormatProperties3)(newCBlock(cULong(SizeofFormatProperties3)))
+	*clone = x
+	return clone
+}
+
+// FormatProperties3CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func FormatProperties3CSlice(arp *AutoReleasePool, x ...FormatProperties3) []FormatProperties3 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofFormatProperties3 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*FormatProperties3)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// FormatProperties3FreeCSlice releases the memory allocated by FormatProperties3MakeCSlice.
+// It does not free pointers stored inside the slice.
+func FormatProperties3FreeCSlice(x []FormatProperties3) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// FormatProperties3MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. FormatProperties3FreeCSlice must be called on the returned slice.
+func FormatProperties3MakeCSlice(x ...FormatProperties3) []FormatProperties3 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofFormatProperties3 * len(x)
+	dst := unsafe.Slice((*FormatProperties3)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkFormatProperties3
+func (x FormatProperties3) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new FormatProperties3 with the value of
+// SType to the value provided in the specification.
+func (x FormatProperties3) WithDefaultSType() FormatProperties3 {
+	return x.WithSType(VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *FormatProperties3) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_FORMAT_PROPERTIES_3)
+}
+
+// WithSType clones a new FormatProperties3 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x FormatProperties3) WithSType(y StructureType) FormatProperties3 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *FormatProperties3) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkFormatProperties3
+func (x FormatProperties3) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new FormatProperties3 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x FormatProperties3) WithPNext(y unsafe.Pointer) FormatProperties3 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *FormatProperties3) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *FormatProperties3) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// LinearTilingFeatures returns the value of linearTilingFeatures from VkFormatProperties3
+func (x FormatProperties3) LinearTilingFeatures() FormatFeatureFlags2 {
+	ptr := /* typedef */ (*FormatFeatureFlags2)(&x.linearTilingFeatures)
+	return *ptr
+}
+
+// OptimalTilingFeatures returns the value of optimalTilingFeatures from VkFormatProperties3
+func (x FormatProperties3) OptimalTilingFeatures() FormatFeatureFlags2 {
+	ptr := /* typedef */ (*FormatFeatureFlags2)(&x.optimalTilingFeatures)
+	return *ptr
+}
+
+// BufferFeatures returns the value of bufferFeatures from VkFormatProperties3
+func (x FormatProperties3) BufferFeatures() FormatFeatureFlags2 {
+	ptr := /* typedef */ (*FormatFeatureFlags2)(&x.bufferFeatures)
+	return *ptr
+}
+
+// PhysicalDeviceVulkan13Features provides a go interface for VkPhysicalDeviceVulkan13Features.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceVulkan13Features.html
+type PhysicalDeviceVulkan13Features C.struct_VkPhysicalDeviceVulkan13Features
+
+// SizeofPhysicalDeviceVulkan13Features is the memory size of a PhysicalDeviceVulkan13Features
+var SizeofPhysicalDeviceVulkan13Features int = int(unsafe.Sizeof(PhysicalDeviceVulkan13Features{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceVulkan13Features) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceVulkan13Features {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceVulkan13Features))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceVulkan13Features)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceVulkan13Features) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceVulkan13Features) AsCPtr() *PhysicalDeviceVulkan13Features {
+	clone := (*PhysicalDeviceVulkan13Features)(newCBlock(cULong(SizeofPhysicalDeviceVulkan13Features)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceVulkan13FeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceVulkan13FeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceVulkan13Features) []PhysicalDeviceVulkan13Features {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceVulkan13Features * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceVulkan13Features)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceVulkan13FeaturesFreeCSlice releases the memory allocated by PhysicalDeviceVulkan13FeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceVulkan13FeaturesFreeCSlice(x []PhysicalDeviceVulkan13Features) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceVulkan13FeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceVulkan13FeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceVulkan13FeaturesMakeCSlice(x ...PhysicalDeviceVulkan13Features) []PhysicalDeviceVulkan13Features {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceVulkan13Features * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceVulkan13Features)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceVulkan13Features
+func (x *PhysicalDeviceVulkan13Features) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceVulkan13Features with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceVulkan13Features) WithDefaultSType() PhysicalDeviceVulkan13Features {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceVulkan13Features) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceVulkan13Features with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan13Features) WithSType(y StructureType) PhysicalDeviceVulkan13Features {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan13Features) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceVulkan13Features
+func (x *PhysicalDeviceVulkan13Features) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceVulkan13Features with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan13Features) WithPNext(y unsafe.Pointer) PhysicalDeviceVulkan13Features {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan13Features) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceVulkan13Features) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// RobustImageAccess returns the value of robustImageAccess from VkPhysicalDeviceVulkan13Features
+func (x *PhysicalDeviceVulkan13Features) RobustImageAccess() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.robustImageAccess)
+	return *ptr
+}
+
+// WithRobustImageAccess clones a new PhysicalDeviceVulkan13Features with the value of
+// RobustImageAccess updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan13Features) WithRobustImageAccess(y Bool32) PhysicalDeviceVulkan13Features {
+	x.robustImageAccess = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan13Features) SetRobustImageAccess(y Bool32) {
+	x.robustImageAccess = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// InlineUniformBlock returns the value of inlineUniformBlock from VkPhysicalDeviceVulkan13Features
+func (x *PhysicalDeviceVulkan13Features) InlineUniformBlock() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.inlineUniformBlock)
+	return *ptr
+}
+
+// WithInlineUniformBlock clones a new PhysicalDeviceVulkan13Features with the value of
+// InlineUniformBlock updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan13Features) WithInlineUniformBlock(y Bool32) PhysicalDeviceVulkan13Features {
+	x.inlineUniformBlock = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan13Features) SetInlineUniformBlock(y Bool32) {
+	x.inlineUniformBlock = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DescriptorBindingInlineUniformBlockUpdateAfterBind returns the value of descriptorBindingInlineUniformBlockUpdateAfterBind from VkPhysicalDeviceVulkan13Features
+func (x *PhysicalDeviceVulkan13Features) DescriptorBindingInlineUniformBlockUpdateAfterBind() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.descriptorBindingInlineUniformBlockUpdateAfterBind)
+	return *ptr
+}
+
+// WithDescriptorBindingInlineUniformBlockUpdateAfterBind clones a new PhysicalDeviceVulkan13Features with the value of
+// DescriptorBindingInlineUniformBlockUpdateAfterBind updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan13Features) WithDescriptorBindingInlineUniformBlockUpdateAfterBind(y Bool32) PhysicalDeviceVulkan13Features {
+	x.descriptorBindingInlineUniformBlockUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan13Features) SetDescriptorBindingInlineUniformBlockUpdateAfterBind(y Bool32) {
+	x.descriptorBindingInlineUniformBlockUpdateAfterBind = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PipelineCreationCacheControl returns the value of pipelineCreationCacheControl from VkPhysicalDeviceVulkan13Features
+func (x *PhysicalDeviceVulkan13Features) PipelineCreationCacheControl() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.pipelineCreationCacheControl)
+	return *ptr
+}
+
+// WithPipelineCreationCacheControl clones a new PhysicalDeviceVulkan13Features with the value of
+// PipelineCreationCacheControl updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan13Features) WithPipelineCreationCacheControl(y Bool32) PhysicalDeviceVulkan13Features {
+	x.pipelineCreationCacheControl = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan13Features) SetPipelineCreationCacheControl(y Bool32) {
+	x.pipelineCreationCacheControl = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PrivateData returns the value of privateData from VkPhysicalDeviceVulkan13Features
+func (x *PhysicalDeviceVulkan13Features) PrivateData() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.privateData)
+	return *ptr
+}
+
+// WithPrivateData clones a new PhysicalDeviceVulkan13Features with the value of
+// PrivateData updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan13Features) WithPrivateData(y Bool32) PhysicalDeviceVulkan13Features {
+	x.privateData = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan13Features) SetPrivateData(y Bool32) {
+	x.privateData = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderDemoteToHelperInvocation returns the value of shaderDemoteToHelperInvocation from VkPhysicalDeviceVulkan13Features
+func (x *PhysicalDeviceVulkan13Features) ShaderDemoteToHelperInvocation() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderDemoteToHelperInvocation)
+	return *ptr
+}
+
+// WithShaderDemoteToHelperInvocation clones a new PhysicalDeviceVulkan13Features with the value of
+// ShaderDemoteToHelperInvocation updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan13Features) WithShaderDemoteToHelperInvocation(y Bool32) PhysicalDeviceVulkan13Features {
+	x.shaderDemoteToHelperInvocation = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan13Features) SetShaderDemoteToHelperInvocation(y Bool32) {
+	x.shaderDemoteToHelperInvocation = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderTerminateInvocation returns the value of shaderTerminateInvocation from VkPhysicalDeviceVulkan13Features
+func (x *PhysicalDeviceVulkan13Features) ShaderTerminateInvocation() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderTerminateInvocation)
+	return *ptr
+}
+
+// WithShaderTerminateInvocation clones a new PhysicalDeviceVulkan13Features with the value of
+// ShaderTerminateInvocation updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan13Features) WithShaderTerminateInvocation(y Bool32) PhysicalDeviceVulkan13Features {
+	x.shaderTerminateInvocation = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan13Features) SetShaderTerminateInvocation(y Bool32) {
+	x.shaderTerminateInvocation = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// SubgroupSizeControl returns the value of subgroupSizeControl from VkPhysicalDeviceVulkan13Features
+func (x *PhysicalDeviceVulkan13Features) SubgroupSizeControl() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.subgroupSizeControl)
+	return *ptr
+}
+
+// WithSubgroupSizeControl clones a new PhysicalDeviceVulkan13Features with the value of
+// SubgroupSizeControl updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan13Features) WithSubgroupSizeControl(y Bool32) PhysicalDeviceVulkan13Features {
+	x.subgroupSizeControl = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan13Features) SetSubgroupSizeControl(y Bool32) {
+	x.subgroupSizeControl = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ComputeFullSubgroups returns the value of computeFullSubgroups from VkPhysicalDeviceVulkan13Features
+func (x *PhysicalDeviceVulkan13Features) ComputeFullSubgroups() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.computeFullSubgroups)
+	return *ptr
+}
+
+// WithComputeFullSubgroups clones a new PhysicalDeviceVulkan13Features with the value of
+// ComputeFullSubgroups updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan13Features) WithComputeFullSubgroups(y Bool32) PhysicalDeviceVulkan13Features {
+	x.computeFullSubgroups = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan13Features) SetComputeFullSubgroups(y Bool32) {
+	x.computeFullSubgroups = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// Synchronization2 returns the value of synchronization2 from VkPhysicalDeviceVulkan13Features
+func (x *PhysicalDeviceVulkan13Features) Synchronization2() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.synchronization2)
+	return *ptr
+}
+
+// WithSynchronization2 clones a new PhysicalDeviceVulkan13Features with the value of
+// Synchronization2 updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan13Features) WithSynchronization2(y Bool32) PhysicalDeviceVulkan13Features {
+	x.synchronization2 = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan13Features) SetSynchronization2(y Bool32) {
+	x.synchronization2 = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// TextureCompressionASTC_HDR returns the value of textureCompressionASTC_HDR from VkPhysicalDeviceVulkan13Features
+func (x *PhysicalDeviceVulkan13Features) TextureCompressionASTC_HDR() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.textureCompressionASTC_HDR)
+	return *ptr
+}
+
+// WithTextureCompressionASTC_HDR clones a new PhysicalDeviceVulkan13Features with the value of
+// TextureCompressionASTC_HDR updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan13Features) WithTextureCompressionASTC_HDR(y Bool32) PhysicalDeviceVulkan13Features {
+	x.textureCompressionASTC_HDR = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan13Features) SetTextureCompressionASTC_HDR(y Bool32) {
+	x.textureCompressionASTC_HDR = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderZeroInitializeWorkgroupMemory returns the value of shaderZeroInitializeWorkgroupMemory from VkPhysicalDeviceVulkan13Features
+func (x *PhysicalDeviceVulkan13Features) ShaderZeroInitializeWorkgroupMemory() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderZeroInitializeWorkgroupMemory)
+	return *ptr
+}
+
+// WithShaderZeroInitializeWorkgroupMemory clones a new PhysicalDeviceVulkan13Features with the value of
+// ShaderZeroInitializeWorkgroupMemory updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan13Features) WithShaderZeroInitializeWorkgroupMemory(y Bool32) PhysicalDeviceVulkan13Features {
+	x.shaderZeroInitializeWorkgroupMemory = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan13Features) SetShaderZeroInitializeWorkgroupMemory(y Bool32) {
+	x.shaderZeroInitializeWorkgroupMemory = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// DynamicRendering returns the value of dynamicRendering from VkPhysicalDeviceVulkan13Features
+func (x *PhysicalDeviceVulkan13Features) DynamicRendering() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.dynamicRendering)
+	return *ptr
+}
+
+// WithDynamicRendering clones a new PhysicalDeviceVulkan13Features with the value of
+// DynamicRendering updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan13Features) WithDynamicRendering(y Bool32) PhysicalDeviceVulkan13Features {
+	x.dynamicRendering = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan13Features) SetDynamicRendering(y Bool32) {
+	x.dynamicRendering = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ShaderIntegerDotProduct returns the value of shaderIntegerDotProduct from VkPhysicalDeviceVulkan13Features
+func (x *PhysicalDeviceVulkan13Features) ShaderIntegerDotProduct() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderIntegerDotProduct)
+	return *ptr
+}
+
+// WithShaderIntegerDotProduct clones a new PhysicalDeviceVulkan13Features with the value of
+// ShaderIntegerDotProduct updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan13Features) WithShaderIntegerDotProduct(y Bool32) PhysicalDeviceVulkan13Features {
+	x.shaderIntegerDotProduct = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan13Features) SetShaderIntegerDotProduct(y Bool32) {
+	x.shaderIntegerDotProduct = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// Maintenance4 returns the value of maintenance4 from VkPhysicalDeviceVulkan13Features
+func (x *PhysicalDeviceVulkan13Features) Maintenance4() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.maintenance4)
+	return *ptr
+}
+
+// WithMaintenance4 clones a new PhysicalDeviceVulkan13Features with the value of
+// Maintenance4 updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan13Features) WithMaintenance4(y Bool32) PhysicalDeviceVulkan13Features {
+	x.maintenance4 = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan13Features) SetMaintenance4(y Bool32) {
+	x.maintenance4 = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PhysicalDeviceVulkan13Properties provides a go interface for VkPhysicalDeviceVulkan13Properties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceVulkan13Properties.html
+type PhysicalDeviceVulkan13Properties C.struct_VkPhysicalDeviceVulkan13Properties
+
+// SizeofPhysicalDeviceVulkan13Properties is the memory size of a PhysicalDeviceVulkan13Properties
+var SizeofPhysicalDeviceVulkan13Properties int = int(unsafe.Sizeof(PhysicalDeviceVulkan13Properties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceVulkan13Properties) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceVulkan13Properties {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceVulkan13Properties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceVulkan13Properties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceVulkan13Properties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceVulkan13Properties) AsCPtr() *PhysicalDeviceVulkan13Properties {
+	clone := (*PhysicalDeviceVulkan13Properties)(newCBlock(cULong(SizeofPhysicalDeviceVulkan13Properties)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceVulkan13PropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceVulkan13PropertiesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceVulkan13Properties) []PhysicalDeviceVulkan13Properties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceVulkan13Properties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceVulkan13Properties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceVulkan13PropertiesFreeCSlice releases the memory allocated by PhysicalDeviceVulkan13PropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceVulkan13PropertiesFreeCSlice(x []PhysicalDeviceVulkan13Properties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceVulkan13PropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceVulkan13PropertiesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceVulkan13PropertiesMakeCSlice(x ...PhysicalDeviceVulkan13Properties) []PhysicalDeviceVulkan13Properties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceVulkan13Properties * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceVulkan13Properties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceVulkan13Properties with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceVulkan13Properties) WithDefaultSType() PhysicalDeviceVulkan13Properties {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceVulkan13Properties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_PROPERTIES)
+}
+
+// WithSType clones a new PhysicalDeviceVulkan13Properties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan13Properties) WithSType(y StructureType) PhysicalDeviceVulkan13Properties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan13Properties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceVulkan13Properties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceVulkan13Properties) WithPNext(y unsafe.Pointer) PhysicalDeviceVulkan13Properties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceVulkan13Properties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceVulkan13Properties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// MinSubgroupSize returns the value of minSubgroupSize from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) MinSubgroupSize() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.minSubgroupSize)
+	return *ptr
+}
+
+// MaxSubgroupSize returns the value of maxSubgroupSize from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) MaxSubgroupSize() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxSubgroupSize)
+	return *ptr
+}
+
+// MaxComputeWorkgroupSubgroups returns the value of maxComputeWorkgroupSubgroups from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) MaxComputeWorkgroupSubgroups() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxComputeWorkgroupSubgroups)
+	return *ptr
+}
+
+// RequiredSubgroupSizeStages returns the value of requiredSubgroupSizeStages from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) RequiredSubgroupSizeStages() ShaderStageFlags {
+	ptr := /* typedef */ (*ShaderStageFlags)(&x.requiredSubgroupSizeStages)
+	return *ptr
+}
+
+// MaxInlineUniformBlockSize returns the value of maxInlineUniformBlockSize from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) MaxInlineUniformBlockSize() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxInlineUniformBlockSize)
+	return *ptr
+}
+
+// MaxPerStageDescriptorInlineUniformBlocks returns the value of maxPerStageDescriptorInlineUniformBlocks from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) MaxPerStageDescriptorInlineUniformBlocks() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxPerStageDescriptorInlineUniformBlocks)
+	return *ptr
+}
+
+// MaxPerStageDescriptorUpdateAfterBindInlineUniformBlocks returns the value of maxPerStageDescriptorUpdateAfterBindInlineUniformBlocks from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) MaxPerStageDescriptorUpdateAfterBindInlineUniformBlocks() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxPerStageDescriptorUpdateAfterBindInlineUniformBlocks)
+	return *ptr
+}
+
+// MaxDescriptorSetInlineUniformBlocks returns the value of maxDescriptorSetInlineUniformBlocks from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) MaxDescriptorSetInlineUniformBlocks() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxDescriptorSetInlineUniformBlocks)
+	return *ptr
+}
+
+// MaxDescriptorSetUpdateAfterBindInlineUniformBlocks returns the value of maxDescriptorSetUpdateAfterBindInlineUniformBlocks from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) MaxDescriptorSetUpdateAfterBindInlineUniformBlocks() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxDescriptorSetUpdateAfterBindInlineUniformBlocks)
+	return *ptr
+}
+
+// MaxInlineUniformTotalSize returns the value of maxInlineUniformTotalSize from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) MaxInlineUniformTotalSize() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxInlineUniformTotalSize)
+	return *ptr
+}
+
+// IntegerDotProduct8BitUnsignedAccelerated returns the value of integerDotProduct8BitUnsignedAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProduct8BitUnsignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct8BitUnsignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct8BitSignedAccelerated returns the value of integerDotProduct8BitSignedAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProduct8BitSignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct8BitSignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct8BitMixedSignednessAccelerated returns the value of integerDotProduct8BitMixedSignednessAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProduct8BitMixedSignednessAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct8BitMixedSignednessAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct4x8BitPackedUnsignedAccelerated returns the value of integerDotProduct4x8BitPackedUnsignedAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProduct4x8BitPackedUnsignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct4x8BitPackedUnsignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct4x8BitPackedSignedAccelerated returns the value of integerDotProduct4x8BitPackedSignedAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProduct4x8BitPackedSignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct4x8BitPackedSignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct4x8BitPackedMixedSignednessAccelerated returns the value of integerDotProduct4x8BitPackedMixedSignednessAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProduct4x8BitPackedMixedSignednessAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct4x8BitPackedMixedSignednessAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct16BitUnsignedAccelerated returns the value of integerDotProduct16BitUnsignedAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProduct16BitUnsignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct16BitUnsignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct16BitSignedAccelerated returns the value of integerDotProduct16BitSignedAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProduct16BitSignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct16BitSignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct16BitMixedSignednessAccelerated returns the value of integerDotProduct16BitMixedSignednessAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProduct16BitMixedSignednessAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct16BitMixedSignednessAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct32BitUnsignedAccelerated returns the value of integerDotProduct32BitUnsignedAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProduct32BitUnsignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct32BitUnsignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct32BitSignedAccelerated returns the value of integerDotProduct32BitSignedAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProduct32BitSignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct32BitSignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct32BitMixedSignednessAccelerated returns the value of integerDotProduct32BitMixedSignednessAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProduct32BitMixedSignednessAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct32BitMixedSignednessAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct64BitUnsignedAccelerated returns the value of integerDotProduct64BitUnsignedAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProduct64BitUnsignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct64BitUnsignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct64BitSignedAccelerated returns the value of integerDotProduct64BitSignedAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProduct64BitSignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct64BitSignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct64BitMixedSignednessAccelerated returns the value of integerDotProduct64BitMixedSignednessAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProduct64BitMixedSignednessAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct64BitMixedSignednessAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating8BitUnsignedAccelerated returns the value of integerDotProductAccumulatingSaturating8BitUnsignedAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProductAccumulatingSaturating8BitUnsignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating8BitUnsignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating8BitSignedAccelerated returns the value of integerDotProductAccumulatingSaturating8BitSignedAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProductAccumulatingSaturating8BitSignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating8BitSignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating8BitMixedSignednessAccelerated returns the value of integerDotProductAccumulatingSaturating8BitMixedSignednessAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProductAccumulatingSaturating8BitMixedSignednessAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating8BitMixedSignednessAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating4x8BitPackedUnsignedAccelerated returns the value of integerDotProductAccumulatingSaturating4x8BitPackedUnsignedAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProductAccumulatingSaturating4x8BitPackedUnsignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating4x8BitPackedUnsignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating4x8BitPackedSignedAccelerated returns the value of integerDotProductAccumulatingSaturating4x8BitPackedSignedAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProductAccumulatingSaturating4x8BitPackedSignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating4x8BitPackedSignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating4x8BitPackedMixedSignednessAccelerated returns the value of integerDotProductAccumulatingSaturating4x8BitPackedMixedSignednessAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProductAccumulatingSaturating4x8BitPackedMixedSignednessAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating4x8BitPackedMixedSignednessAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating16BitUnsignedAccelerated returns the value of integerDotProductAccumulatingSaturating16BitUnsignedAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProductAccumulatingSaturating16BitUnsignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating16BitUnsignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating16BitSignedAccelerated returns the value of integerDotProductAccumulatingSaturating16BitSignedAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProductAccumulatingSaturating16BitSignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating16BitSignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating16BitMixedSignednessAccelerated returns the value of integerDotProductAccumulatingSaturating16BitMixedSignednessAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProductAccumulatingSaturating16BitMixedSignednessAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating16BitMixedSignednessAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating32BitUnsignedAccelerated returns the value of integerDotProductAccumulatingSaturating32BitUnsignedAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProductAccumulatingSaturating32BitUnsignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating32BitUnsignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating32BitSignedAccelerated returns the value of integerDotProductAccumulatingSaturating32BitSignedAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProductAccumulatingSaturating32BitSignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating32BitSignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating32BitMixedSignednessAccelerated returns the value of integerDotProductAccumulatingSaturating32BitMixedSignednessAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProductAccumulatingSaturating32BitMixedSignednessAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating32BitMixedSignednessAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating64BitUnsignedAccelerated returns the value of integerDotProductAccumulatingSaturating64BitUnsignedAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProductAccumulatingSaturating64BitUnsignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating64BitUnsignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating64BitSignedAccelerated returns the value of integerDotProductAccumulatingSaturating64BitSignedAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProductAccumulatingSaturating64BitSignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating64BitSignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating64BitMixedSignednessAccelerated returns the value of integerDotProductAccumulatingSaturating64BitMixedSignednessAccelerated from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) IntegerDotProductAccumulatingSaturating64BitMixedSignednessAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating64BitMixedSignednessAccelerated)
+	return *ptr
+}
+
+// StorageTexelBufferOffsetAlignmentBytes returns the value of storageTexelBufferOffsetAlignmentBytes from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) StorageTexelBufferOffsetAlignmentBytes() DeviceSize {
+	ptr := /* typedef */ (*DeviceSize)(&x.storageTexelBufferOffsetAlignmentBytes)
+	return *ptr
+}
+
+// StorageTexelBufferOffsetSingleTexelAlignment returns the value of storageTexelBufferOffsetSingleTexelAlignment from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) StorageTexelBufferOffsetSingleTexelAlignment() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.storageTexelBufferOffsetSingleTexelAlignment)
+	return *ptr
+}
+
+// UniformTexelBufferOffsetAlignmentBytes returns the value of uniformTexelBufferOffsetAlignmentBytes from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) UniformTexelBufferOffsetAlignmentBytes() DeviceSize {
+	ptr := /* typedef */ (*DeviceSize)(&x.uniformTexelBufferOffsetAlignmentBytes)
+	return *ptr
+}
+
+// UniformTexelBufferOffsetSingleTexelAlignment returns the value of uniformTexelBufferOffsetSingleTexelAlignment from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) UniformTexelBufferOffsetSingleTexelAlignment() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.uniformTexelBufferOffsetSingleTexelAlignment)
+	return *ptr
+}
+
+// MaxBufferSize returns the value of maxBufferSize from VkPhysicalDeviceVulkan13Properties
+func (x *PhysicalDeviceVulkan13Properties) MaxBufferSize() DeviceSize {
+	ptr := /* typedef */ (*DeviceSize)(&x.maxBufferSize)
+	return *ptr
+}
+
+// PhysicalDeviceTexelBufferAlignmentProperties provides a go interface for VkPhysicalDeviceTexelBufferAlignmentProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceTexelBufferAlignmentProperties.html
+type PhysicalDeviceTexelBufferAlignmentProperties C.struct_VkPhysicalDeviceTexelBufferAlignmentProperties
+
+// SizeofPhysicalDeviceTexelBufferAlignmentProperties is the memory size of a PhysicalDeviceTexelBufferAlignmentProperties
+var SizeofPhysicalDeviceTexelBufferAlignmentProperties int = int(unsafe.Sizeof(PhysicalDeviceTexelBufferAlignmentProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceTexelBufferAlignmentProperties) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceTexelBufferAlignmentProperties {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceTexelBufferAlignmentProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceTexelBufferAlignmentProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceTexelBufferAlignmentProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceTexelBufferAlignmentProperties) AsCPtr() *PhysicalDeviceTexelBufferAlignmentProperties {
+	clone := (*PhysicalDeviceTexelBufferAlignmentProperties)(newCBlock(cULong(SizeofPhysicalDeviceTexelBufferAlignmentProperties)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceTexelBufferAlignmentPropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceTexelBufferAlignmentPropertiesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceTexelBufferAlignmentProperties) []PhysicalDeviceTexelBufferAlignmentProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceTexelBufferAlignmentProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceTexelBufferAlignmentProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceTexelBufferAlignmentPropertiesFreeCSlice releases the memory allocated by PhysicalDeviceTexelBufferAlignmentPropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceTexelBufferAlignmentPropertiesFreeCSlice(x []PhysicalDeviceTexelBufferAlignmentProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceTexelBufferAlignmentPropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceTexelBufferAlignmentPropertiesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceTexelBufferAlignmentPropertiesMakeCSlice(x ...PhysicalDeviceTexelBufferAlignmentProperties) []PhysicalDeviceTexelBufferAlignmentProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceTexelBufferAlignmentProperties * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceTexelBufferAlignmentProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceTexelBufferAlignmentProperties
+func (x PhysicalDeviceTexelBufferAlignmentProperties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceTexelBufferAlignmentProperties with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceTexelBufferAlignmentProperties) WithDefaultSType() PhysicalDeviceTexelBufferAlignmentProperties {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceTexelBufferAlignmentProperties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_PROPERTIES)
+}
+
+// WithSType clones a new PhysicalDeviceTexelBufferAlignmentProperties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceTexelBufferAlignmentProperties) WithSType(y StructureType) PhysicalDeviceTexelBufferAlignmentProperties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceTexelBufferAlignmentProperties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceTexelBufferAlignmentProperties
+func (x PhysicalDeviceTexelBufferAlignmentProperties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceTexelBufferAlignmentProperties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceTexelBufferAlignmentProperties) WithPNext(y unsafe.Pointer) PhysicalDeviceTexelBufferAlignmentProperties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceTexelBufferAlignmentProperties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceTexelBufferAlignmentProperties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// StorageTexelBufferOffsetAlignmentBytes returns the value of storageTexelBufferOffsetAlignmentBytes from VkPhysicalDeviceTexelBufferAlignmentProperties
+func (x PhysicalDeviceTexelBufferAlignmentProperties) StorageTexelBufferOffsetAlignmentBytes() DeviceSize {
+	ptr := /* typedef */ (*DeviceSize)(&x.storageTexelBufferOffsetAlignmentBytes)
+	return *ptr
+}
+
+// StorageTexelBufferOffsetSingleTexelAlignment returns the value of storageTexelBufferOffsetSingleTexelAlignment from VkPhysicalDeviceTexelBufferAlignmentProperties
+func (x PhysicalDeviceTexelBufferAlignmentProperties) StorageTexelBufferOffsetSingleTexelAlignment() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.storageTexelBufferOffsetSingleTexelAlignment)
+	return *ptr
+}
+
+// UniformTexelBufferOffsetAlignmentBytes returns the value of uniformTexelBufferOffsetAlignmentBytes from VkPhysicalDeviceTexelBufferAlignmentProperties
+func (x PhysicalDeviceTexelBufferAlignmentProperties) UniformTexelBufferOffsetAlignmentBytes() DeviceSize {
+	ptr := /* typedef */ (*DeviceSize)(&x.uniformTexelBufferOffsetAlignmentBytes)
+	return *ptr
+}
+
+// UniformTexelBufferOffsetSingleTexelAlignment returns the value of uniformTexelBufferOffsetSingleTexelAlignment from VkPhysicalDeviceTexelBufferAlignmentProperties
+func (x PhysicalDeviceTexelBufferAlignmentProperties) UniformTexelBufferOffsetSingleTexelAlignment() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.uniformTexelBufferOffsetSingleTexelAlignment)
+	return *ptr
+}
+
+// PhysicalDeviceShaderIntegerDotProductProperties provides a go interface for VkPhysicalDeviceShaderIntegerDotProductProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceShaderIntegerDotProductProperties.html
+type PhysicalDeviceShaderIntegerDotProductProperties C.struct_VkPhysicalDeviceShaderIntegerDotProductProperties
+
+// SizeofPhysicalDeviceShaderIntegerDotProductProperties is the memory size of a PhysicalDeviceShaderIntegerDotProductProperties
+var SizeofPhysicalDeviceShaderIntegerDotProductProperties int = int(unsafe.Sizeof(PhysicalDeviceShaderIntegerDotProductProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceShaderIntegerDotProductProperties) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceShaderIntegerDotProductProperties {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceShaderIntegerDotProductProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceShaderIntegerDotProductProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceShaderIntegerDotProductProperties) AsCPtr() *PhysicalDeviceShaderIntegerDotProductProperties {
+	clone := (*PhysicalDeviceShaderIntegerDotProductProperties)(newCBlock(cULong(SizeofPhysicalDeviceShaderIntegerDotProductProperties)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceShaderIntegerDotProductPropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceShaderIntegerDotProductPropertiesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceShaderIntegerDotProductProperties) []PhysicalDeviceShaderIntegerDotProductProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceShaderIntegerDotProductProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceShaderIntegerDotProductProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceShaderIntegerDotProductPropertiesFreeCSlice releases the memory allocated by PhysicalDeviceShaderIntegerDotProductPropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceShaderIntegerDotProductPropertiesFreeCSlice(x []PhysicalDeviceShaderIntegerDotProductProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceShaderIntegerDotProductPropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceShaderIntegerDotProductPropertiesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceShaderIntegerDotProductPropertiesMakeCSlice(x ...PhysicalDeviceShaderIntegerDotProductProperties) []PhysicalDeviceShaderIntegerDotProductProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceShaderIntegerDotProductProperties * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceShaderIntegerDotProductProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceShaderIntegerDotProductProperties with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceShaderIntegerDotProductProperties) WithDefaultSType() PhysicalDeviceShaderIntegerDotProductProperties {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_PROPERTIES)
+}
+
+// WithSType clones a new PhysicalDeviceShaderIntegerDotProductProperties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderIntegerDotProductProperties) WithSType(y StructureType) PhysicalDeviceShaderIntegerDotProductProperties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceShaderIntegerDotProductProperties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderIntegerDotProductProperties) WithPNext(y unsafe.Pointer) PhysicalDeviceShaderIntegerDotProductProperties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// IntegerDotProduct8BitUnsignedAccelerated returns the value of integerDotProduct8BitUnsignedAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProduct8BitUnsignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct8BitUnsignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct8BitSignedAccelerated returns the value of integerDotProduct8BitSignedAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProduct8BitSignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct8BitSignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct8BitMixedSignednessAccelerated returns the value of integerDotProduct8BitMixedSignednessAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProduct8BitMixedSignednessAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct8BitMixedSignednessAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct4x8BitPackedUnsignedAccelerated returns the value of integerDotProduct4x8BitPackedUnsignedAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProduct4x8BitPackedUnsignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct4x8BitPackedUnsignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct4x8BitPackedSignedAccelerated returns the value of integerDotProduct4x8BitPackedSignedAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProduct4x8BitPackedSignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct4x8BitPackedSignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct4x8BitPackedMixedSignednessAccelerated returns the value of integerDotProduct4x8BitPackedMixedSignednessAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProduct4x8BitPackedMixedSignednessAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct4x8BitPackedMixedSignednessAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct16BitUnsignedAccelerated returns the value of integerDotProduct16BitUnsignedAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProduct16BitUnsignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct16BitUnsignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct16BitSignedAccelerated returns the value of integerDotProduct16BitSignedAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProduct16BitSignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct16BitSignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct16BitMixedSignednessAccelerated returns the value of integerDotProduct16BitMixedSignednessAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProduct16BitMixedSignednessAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct16BitMixedSignednessAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct32BitUnsignedAccelerated returns the value of integerDotProduct32BitUnsignedAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProduct32BitUnsignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct32BitUnsignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct32BitSignedAccelerated returns the value of integerDotProduct32BitSignedAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProduct32BitSignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct32BitSignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct32BitMixedSignednessAccelerated returns the value of integerDotProduct32BitMixedSignednessAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProduct32BitMixedSignednessAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct32BitMixedSignednessAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct64BitUnsignedAccelerated returns the value of integerDotProduct64BitUnsignedAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProduct64BitUnsignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct64BitUnsignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct64BitSignedAccelerated returns the value of integerDotProduct64BitSignedAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProduct64BitSignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct64BitSignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProduct64BitMixedSignednessAccelerated returns the value of integerDotProduct64BitMixedSignednessAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProduct64BitMixedSignednessAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProduct64BitMixedSignednessAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating8BitUnsignedAccelerated returns the value of integerDotProductAccumulatingSaturating8BitUnsignedAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProductAccumulatingSaturating8BitUnsignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating8BitUnsignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating8BitSignedAccelerated returns the value of integerDotProductAccumulatingSaturating8BitSignedAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProductAccumulatingSaturating8BitSignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating8BitSignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating8BitMixedSignednessAccelerated returns the value of integerDotProductAccumulatingSaturating8BitMixedSignednessAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProductAccumulatingSaturating8BitMixedSignednessAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating8BitMixedSignednessAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating4x8BitPackedUnsignedAccelerated returns the value of integerDotProductAccumulatingSaturating4x8BitPackedUnsignedAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProductAccumulatingSaturating4x8BitPackedUnsignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating4x8BitPackedUnsignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating4x8BitPackedSignedAccelerated returns the value of integerDotProductAccumulatingSaturating4x8BitPackedSignedAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProductAccumulatingSaturating4x8BitPackedSignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating4x8BitPackedSignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating4x8BitPackedMixedSignednessAccelerated returns the value of integerDotProductAccumulatingSaturating4x8BitPackedMixedSignednessAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProductAccumulatingSaturating4x8BitPackedMixedSignednessAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating4x8BitPackedMixedSignednessAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating16BitUnsignedAccelerated returns the value of integerDotProductAccumulatingSaturating16BitUnsignedAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProductAccumulatingSaturating16BitUnsignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating16BitUnsignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating16BitSignedAccelerated returns the value of integerDotProductAccumulatingSaturating16BitSignedAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProductAccumulatingSaturating16BitSignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating16BitSignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating16BitMixedSignednessAccelerated returns the value of integerDotProductAccumulatingSaturating16BitMixedSignednessAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProductAccumulatingSaturating16BitMixedSignednessAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating16BitMixedSignednessAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating32BitUnsignedAccelerated returns the value of integerDotProductAccumulatingSaturating32BitUnsignedAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProductAccumulatingSaturating32BitUnsignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating32BitUnsignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating32BitSignedAccelerated returns the value of integerDotProductAccumulatingSaturating32BitSignedAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProductAccumulatingSaturating32BitSignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating32BitSignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating32BitMixedSignednessAccelerated returns the value of integerDotProductAccumulatingSaturating32BitMixedSignednessAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProductAccumulatingSaturating32BitMixedSignednessAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating32BitMixedSignednessAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating64BitUnsignedAccelerated returns the value of integerDotProductAccumulatingSaturating64BitUnsignedAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProductAccumulatingSaturating64BitUnsignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating64BitUnsignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating64BitSignedAccelerated returns the value of integerDotProductAccumulatingSaturating64BitSignedAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProductAccumulatingSaturating64BitSignedAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating64BitSignedAccelerated)
+	return *ptr
+}
+
+// IntegerDotProductAccumulatingSaturating64BitMixedSignednessAccelerated returns the value of integerDotProductAccumulatingSaturating64BitMixedSignednessAccelerated from VkPhysicalDeviceShaderIntegerDotProductProperties
+func (x *PhysicalDeviceShaderIntegerDotProductProperties) IntegerDotProductAccumulatingSaturating64BitMixedSignednessAccelerated() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.integerDotProductAccumulatingSaturating64BitMixedSignednessAccelerated)
+	return *ptr
+}
+
+// PhysicalDevicePipelineCreationCacheControlFeatures provides a go interface for VkPhysicalDevicePipelineCreationCacheControlFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDevicePipelineCreationCacheControlFeatures.html
+type PhysicalDevicePipelineCreationCacheControlFeatures C.struct_VkPhysicalDevicePipelineCreationCacheControlFeatures
+
+// SizeofPhysicalDevicePipelineCreationCacheControlFeatures is the memory size of a PhysicalDevicePipelineCreationCacheControlFeatures
+var SizeofPhysicalDevicePipelineCreationCacheControlFeatures int = int(unsafe.Sizeof(PhysicalDevicePipelineCreationCacheControlFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDevicePipelineCreationCacheControlFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDevicePipelineCreationCacheControlFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDevicePipelineCreationCacheControlFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDevicePipelineCreationCacheControlFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDevicePipelineCreationCacheControlFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDevicePipelineCreationCacheControlFeatures) AsCPtr() *PhysicalDevicePipelineCreationCacheControlFeatures {
+	clone := (*PhysicalDevicePipelineCreationCacheControlFeatures)(newCBlock(cULong(SizeofPhysicalDevicePipelineCreationCacheControlFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDevicePipelineCreationCacheControlFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDevicePipelineCreationCacheControlFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDevicePipelineCreationCacheControlFeatures) []PhysicalDevicePipelineCreationCacheControlFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDevicePipelineCreationCacheControlFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDevicePipelineCreationCacheControlFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDevicePipelineCreationCacheControlFeaturesFreeCSlice releases the memory allocated by PhysicalDevicePipelineCreationCacheControlFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDevicePipelineCreationCacheControlFeaturesFreeCSlice(x []PhysicalDevicePipelineCreationCacheControlFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDevicePipelineCreationCacheControlFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDevicePipelineCreationCacheControlFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDevicePipelineCreationCacheControlFeaturesMakeCSlice(x ...PhysicalDevicePipelineCreationCacheControlFeatures) []PhysicalDevicePipelineCreationCacheControlFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDevicePipelineCreationCacheControlFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDevicePipelineCreationCacheControlFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDevicePipelineCreationCacheControlFeatures
+func (x PhysicalDevicePipelineCreationCacheControlFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDevicePipelineCreationCacheControlFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDevicePipelineCreationCacheControlFeatures) WithDefaultSType() PhysicalDevicePipelineCreationCacheControlFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CREATION_CACHE_CONTROL_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDevicePipelineCreationCacheControlFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CREATION_CACHE_CONTROL_FEATURES)
+}
+
+// WithSType clones a new PhysicalDevicePipelineCreationCacheControlFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePipelineCreationCacheControlFeatures) WithSType(y StructureType) PhysicalDevicePipelineCreationCacheControlFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDevicePipelineCreationCacheControlFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDevicePipelineCreationCacheControlFeatures
+func (x PhysicalDevicePipelineCreationCacheControlFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDevicePipelineCreationCacheControlFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePipelineCreationCacheControlFeatures) WithPNext(y unsafe.Pointer) PhysicalDevicePipelineCreationCacheControlFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDevicePipelineCreationCacheControlFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDevicePipelineCreationCacheControlFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// PipelineCreationCacheControl returns the value of pipelineCreationCacheControl from VkPhysicalDevicePipelineCreationCacheControlFeatures
+func (x PhysicalDevicePipelineCreationCacheControlFeatures) PipelineCreationCacheControl() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.pipelineCreationCacheControl)
+	return *ptr
+}
+
+// WithPipelineCreationCacheControl clones a new PhysicalDevicePipelineCreationCacheControlFeatures with the value of
+// PipelineCreationCacheControl updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDevicePipelineCreationCacheControlFeatures) WithPipelineCreationCacheControl(y Bool32) PhysicalDevicePipelineCreationCacheControlFeatures {
+	x.pipelineCreationCacheControl = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDevicePipelineCreationCacheControlFeatures) SetPipelineCreationCacheControl(y Bool32) {
+	x.pipelineCreationCacheControl = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PhysicalDeviceShaderIntegerDotProductFeatures provides a go interface for VkPhysicalDeviceShaderIntegerDotProductFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceShaderIntegerDotProductFeatures.html
+type PhysicalDeviceShaderIntegerDotProductFeatures C.struct_VkPhysicalDeviceShaderIntegerDotProductFeatures
+
+// SizeofPhysicalDeviceShaderIntegerDotProductFeatures is the memory size of a PhysicalDeviceShaderIntegerDotProductFeatures
+var SizeofPhysicalDeviceShaderIntegerDotProductFeatures int = int(unsafe.Sizeof(PhysicalDeviceShaderIntegerDotProductFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceShaderIntegerDotProductFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceShaderIntegerDotProductFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceShaderIntegerDotProductFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceShaderIntegerDotProductFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceShaderIntegerDotProductFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceShaderIntegerDotProductFeatures) AsCPtr() *PhysicalDeviceShaderIntegerDotProductFeatures {
+	clone := (*PhysicalDeviceShaderIntegerDotProductFeatures)(newCBlock(cULong(SizeofPhysicalDeviceShaderIntegerDotProductFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceShaderIntegerDotProductFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceShaderIntegerDotProductFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceShaderIntegerDotProductFeatures) []PhysicalDeviceShaderIntegerDotProductFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceShaderIntegerDotProductFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceShaderIntegerDotProductFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceShaderIntegerDotProductFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceShaderIntegerDotProductFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceShaderIntegerDotProductFeaturesFreeCSlice(x []PhysicalDeviceShaderIntegerDotProductFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceShaderIntegerDotProductFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceShaderIntegerDotProductFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceShaderIntegerDotProductFeaturesMakeCSlice(x ...PhysicalDeviceShaderIntegerDotProductFeatures) []PhysicalDeviceShaderIntegerDotProductFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceShaderIntegerDotProductFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceShaderIntegerDotProductFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceShaderIntegerDotProductFeatures
+func (x PhysicalDeviceShaderIntegerDotProductFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceShaderIntegerDotProductFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceShaderIntegerDotProductFeatures) WithDefaultSType() PhysicalDeviceShaderIntegerDotProductFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceShaderIntegerDotProductFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_DOT_PRODUCT_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceShaderIntegerDotProductFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderIntegerDotProductFeatures) WithSType(y StructureType) PhysicalDeviceShaderIntegerDotProductFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderIntegerDotProductFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceShaderIntegerDotProductFeatures
+func (x PhysicalDeviceShaderIntegerDotProductFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceShaderIntegerDotProductFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderIntegerDotProductFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceShaderIntegerDotProductFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderIntegerDotProductFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceShaderIntegerDotProductFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ShaderIntegerDotProduct returns the value of shaderIntegerDotProduct from VkPhysicalDeviceShaderIntegerDotProductFeatures
+func (x PhysicalDeviceShaderIntegerDotProductFeatures) ShaderIntegerDotProduct() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderIntegerDotProduct)
+	return *ptr
+}
+
+// WithShaderIntegerDotProduct clones a new PhysicalDeviceShaderIntegerDotProductFeatures with the value of
+// ShaderIntegerDotProduct updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderIntegerDotProductFeatures) WithShaderIntegerDotProduct(y Bool32) PhysicalDeviceShaderIntegerDotProductFeatures {
+	x.shaderIntegerDotProduct = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderIntegerDotProductFeatures) SetShaderIntegerDotProduct(y Bool32) {
+	x.shaderIntegerDotProduct = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// CommandBufferInheritanceRenderingInfo provides a go interface for VkCommandBufferInheritanceRenderingInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkCommandBufferInheritanceRenderingInfo.html
+type CommandBufferInheritanceRenderingInfo C.struct_VkCommandBufferInheritanceRenderingInfo
+
+// SizeofCommandBufferInheritanceRenderingInfo is the memory size of a CommandBufferInheritanceRenderingInfo
+var SizeofCommandBufferInheritanceRenderingInfo int = int(unsafe.Sizeof(CommandBufferInheritanceRenderingInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x CommandBufferInheritanceRenderingInfo) ArpPtr(arp *AutoReleasePool) *CommandBufferInheritanceRenderingInfo {
+	ptr := newCBlock(cULong(SizeofCommandBufferInheritanceRenderingInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*CommandBufferInheritanceRenderingInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *CommandBufferInheritanceRenderingInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x CommandBufferInheritanceRenderingInfo) AsCPtr() *CommandBufferInheritanceRenderingInfo {
+	clone := (*CommandBufferInheritanceRenderingInfo)(newCBlock(cULong(SizeofCommandBufferInheritanceRenderingInfo)))
+	*clone = x
+	return clone
+}
+
+// CommandBufferInheritanceRenderingInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func CommandBufferInheritanceRenderingInfoCSlice(arp *AutoReleasePool, x ...CommandBufferInheritanceRenderingInfo) []CommandBufferInheritanceRenderingInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofCommandBufferInheritanceRenderingInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*CommandBufferInheritanceRenderingInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// CommandBufferInheritanceRenderingInfoFreeCSlice releases the memory allocated by CommandBufferInheritanceRenderingInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func CommandBufferInheritanceRenderingInfoFreeCSlice(x []CommandBufferInheritanceRenderingInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// CommandBufferInheritanceRenderingInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. CommandBufferInheritanceRenderingInfoFreeCSlice must be called on the returned slice.
+func CommandBufferInheritanceRenderingInfoMakeCSlice(x ...CommandBufferInheritanceRenderingInfo) []CommandBufferInheritanceRenderingInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofCommandBufferInheritanceRenderingInfo * len(x)
+	dst := unsafe.Slice((*CommandBufferInheritanceRenderingInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkCommandBufferInheritanceRenderingInfo
+func (x CommandBufferInheritanceRenderingInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new CommandBufferInheritanceRenderingInfo with the value of
+// SType to the value provided in the specification.
+func (x CommandBufferInheritanceRenderingInfo) WithDefaultSType() CommandBufferInheritanceRenderingInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *CommandBufferInheritanceRenderingInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO)
+}
+
+// WithSType clones a new CommandBufferInheritanceRenderingInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CommandBufferInheritanceRenderingInfo) WithSType(y StructureType) CommandBufferInheritanceRenderingInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *CommandBufferInheritanceRenderingInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkCommandBufferInheritanceRenderingInfo
+func (x CommandBufferInheritanceRenderingInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new CommandBufferInheritanceRenderingInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CommandBufferInheritanceRenderingInfo) WithPNext(y unsafe.Pointer) CommandBufferInheritanceRenderingInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *CommandBufferInheritanceRenderingInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *CommandBufferInheritanceRenderingInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Flags returns the value of flags from VkCommandBufferInheritanceRenderingInfo
+func (x CommandBufferInheritanceRenderingInfo) Flags() RenderingFlags {
+	ptr := /* typedef */ (*RenderingFlags)(&x.flags)
+	return *ptr
+}
+
+// WithFlags clones a new CommandBufferInheritanceRenderingInfo with the value of
+// Flags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CommandBufferInheritanceRenderingInfo) WithFlags(y RenderingFlags) CommandBufferInheritanceRenderingInfo {
+	x.flags = *( /* typedef */ (*C.VkRenderingFlags)(&y))
+	return x
+}
+func (x *CommandBufferInheritanceRenderingInfo) SetFlags(y RenderingFlags) {
+	x.flags = *( /* typedef */ (*C.VkRenderingFlags)(&y))
+}
+
+// ViewMask returns the value of viewMask from VkCommandBufferInheritanceRenderingInfo
+func (x CommandBufferInheritanceRenderingInfo) ViewMask() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.viewMask)
+	return *ptr
+}
+
+// WithViewMask clones a new CommandBufferInheritanceRenderingInfo with the value of
+// ViewMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CommandBufferInheritanceRenderingInfo) WithViewMask(y uint32) CommandBufferInheritanceRenderingInfo {
+	x.viewMask = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *CommandBufferInheritanceRenderingInfo) SetViewMask(y uint32) {
+	x.viewMask = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// ColorAttachmentCount returns the value of colorAttachmentCount from VkCommandBufferInheritanceRenderingInfo
+func (x CommandBufferInheritanceRenderingInfo) ColorAttachmentCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.colorAttachmentCount)
+	return *ptr
+}
+
+// WithColorAttachmentCount clones a new CommandBufferInheritanceRenderingInfo with the value of
+// ColorAttachmentCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CommandBufferInheritanceRenderingInfo) WithColorAttachmentCount(y uint32) CommandBufferInheritanceRenderingInfo {
+	x.colorAttachmentCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *CommandBufferInheritanceRenderingInfo) SetColorAttachmentCount(y uint32) {
+	x.colorAttachmentCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PColorAttachmentFormats returns the value of pColorAttachmentFormats from VkCommandBufferInheritanceRenderingInfo
+func (x CommandBufferInheritanceRenderingInfo) PColorAttachmentFormats() []Format {
+	if x.pColorAttachmentFormats == nil {
+		return nil
+	}
+	return unsafe.Slice((*Format)(unsafe.Pointer(x.pColorAttachmentFormats)), x.colorAttachmentCount)
+}
+
+// WithPColorAttachmentFormats clones a new CommandBufferInheritanceRenderingInfo with the value of
+// PColorAttachmentFormats updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines ColorAttachmentCount as the length of this field.
+// ColorAttachmentCount is updated with the length of the new value.
+func (x CommandBufferInheritanceRenderingInfo) WithPColorAttachmentFormats(y []Format) CommandBufferInheritanceRenderingInfo {
+	x.pColorAttachmentFormats = *(func(x *[]Format) **C.VkFormat { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkFormat)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkFormat)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithColorAttachmentCount(uint32(len(y)))
+}
+func (x *CommandBufferInheritanceRenderingInfo) SetPColorAttachmentFormats(y []Format) {
+	x.pColorAttachmentFormats = *(func(x *[]Format) **C.VkFormat { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkFormat)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkFormat)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetColorAttachmentCount(uint32(len(y)))
+}
+
+// PinPColorAttachmentFormats pins the Go memory referenced by y with the AutoReleasePool
+// and sets PColorAttachmentFormats, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *CommandBufferInheritanceRenderingInfo) PinPColorAttachmentFormats(arp *AutoReleasePool, y []Format) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPColorAttachmentFormats(y)
+}
+
+// DepthAttachmentFormat returns the value of depthAttachmentFormat from VkCommandBufferInheritanceRenderingInfo
+func (x CommandBufferInheritanceRenderingInfo) DepthAttachmentFormat() Format {
+	ptr := /* typedef */ (*Format)(&x.depthAttachmentFormat)
+	return *ptr
+}
+
+// WithDepthAttachmentFormat clones a new CommandBufferInheritanceRenderingInfo with the value of
+// DepthAttachmentFormat updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CommandBufferInheritanceRenderingInfo) WithDepthAttachmentFormat(y Format) CommandBufferInheritanceRenderingInfo {
+	x.depthAttachmentFormat = *( /* typedef */ (*C.VkFormat)(&y))
+	return x
+}
+func (x *CommandBufferInheritanceRenderingInfo) SetDepthAttachmentFormat(y Format) {
+	x.depthAttachmentFormat = *( /* typedef */ (*C.VkFormat)(&y))
+}
+
+// StencilAttachmentFormat returns the value of stencilAttachmentFormat from VkCommandBufferInheritanceRenderingInfo
+func (x CommandBufferInheritanceRenderingInfo) StencilAttachmentFormat() Format {
+	ptr := /* typedef */ (*Format)(&x.stencilAttachmentFormat)
+	return *ptr
+}
+
+// WithStencilAttachmentFormat clones a new CommandBufferInheritanceRenderingInfo with the value of
+// StencilAttachmentFormat updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CommandBufferInheritanceRenderingInfo) WithStencilAttachmentFormat(y Format) CommandBufferInheritanceRenderingInfo {
+	x.stencilAttachmentFormat = *( /* typedef */ (*C.VkFormat)(&y))
+	return x
+}
+func (x *CommandBufferInheritanceRenderingInfo) SetStencilAttachmentFormat(y Format) {
+	x.stencilAttachmentFormat = *( /* typedef */ (*C.VkFormat)(&y))
+}
+
+// RasterizationSamples returns the value of rasterizationSamples from VkCommandBufferInheritanceRenderingInfo
+func (x CommandBufferInheritanceRenderingInfo) RasterizationSamples() SampleCountFlagBits {
+	ptr := /* typedef */ (*SampleCountFlagBits)(&x.rasterizationSamples)
+	return *ptr
+}
+
+// WithRasterizationSamples clones a new CommandBufferInheritanceRenderingInfo with the value of
+// RasterizationSamples updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CommandBufferInheritanceRenderingInfo) WithRasterizationSamples(y SampleCountFlagBits) CommandBufferInheritanceRenderingInfo {
+	x.rasterizationSamples = *( /* typedef */ (*C.VkSampleCountFlagBits)(&y))
+	return x
+}
+func (x *CommandBufferInheritanceRenderingInfo) SetRasterizationSamples(y SampleCountFlagBits) {
+	x.rasterizationSamples = *( /* typedef */ (*C.VkSampleCountFlagBits)(&y))
+}
+
+// PhysicalDeviceDynamicRenderingFeatures provides a go interface for VkPhysicalDeviceDynamicRenderingFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceDynamicRenderingFeatures.html
+type PhysicalDeviceDynamicRenderingFeatures C.struct_VkPhysicalDeviceDynamicRenderingFeatures
+
+// SizeofPhysicalDeviceDynamicRenderingFeatures is the memory size of a PhysicalDeviceDynamicRenderingFeatures
+var SizeofPhysicalDeviceDynamicRenderingFeatures int = int(unsafe.Sizeof(PhysicalDeviceDynamicRenderingFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceDynamicRenderingFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceDynamicRenderingFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceDynamicRenderingFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceDynamicRenderingFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceDynamicRenderingFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceDynamicRenderingFeatures) AsCPtr() *PhysicalDeviceDynamicRenderingFeatures {
+	clone := (*PhysicalDeviceDynamicRenderingFeatures)(newCBlock(cULong(SizeofPhysicalDeviceDynamicRenderingFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceDynamicRenderingFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceDynamicRenderingFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceDynamicRenderingFeatures) []PhysicalDeviceDynamicRenderingFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceDynamicRenderingFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceDynamicRenderingFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceDynamicRenderingFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceDynamicRenderingFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceDynamicRenderingFeaturesFreeCSlice(x []PhysicalDeviceDynamicRenderingFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceDynamicRenderingFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceDynamicRenderingFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceDynamicRenderingFeaturesMakeCSlice(x ...PhysicalDeviceDynamicRenderingFeatures) []PhysicalDeviceDynamicRenderingFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceDynamicRenderingFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceDynamicRenderingFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceDynamicRenderingFeatures
+func (x PhysicalDeviceDynamicRenderingFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceDynamicRenderingFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceDynamicRenderingFeatures) WithDefaultSType() PhysicalDeviceDynamicRenderingFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceDynamicRenderingFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DYNAMIC_RENDERING_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceDynamicRenderingFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDynamicRenderingFeatures) WithSType(y StructureType) PhysicalDeviceDynamicRenderingFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceDynamicRenderingFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceDynamicRenderingFeatures
+func (x PhysicalDeviceDynamicRenderingFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceDynamicRenderingFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDynamicRenderingFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceDynamicRenderingFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceDynamicRenderingFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceDynamicRenderingFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// DynamicRendering returns the value of dynamicRendering from VkPhysicalDeviceDynamicRenderingFeatures
+func (x PhysicalDeviceDynamicRenderingFeatures) DynamicRendering() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.dynamicRendering)
+	return *ptr
+}
+
+// WithDynamicRendering clones a new PhysicalDeviceDynamicRenderingFeatures with the value of
+// DynamicRendering updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceDynamicRenderingFeatures) WithDynamicRendering(y Bool32) PhysicalDeviceDynamicRenderingFeatures {
+	x.dynamicRendering = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceDynamicRenderingFeatures) SetDynamicRendering(y Bool32) {
+	x.dynamicRendering = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PipelineRenderingCreateInfo provides a go interface for VkPipelineRenderingCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPipelineRenderingCreateInfo.html
+type PipelineRenderingCreateInfo C.struct_VkPipelineRenderingCreateInfo
+
+// SizeofPipelineRenderingCreateInfo is the memory size of a PipelineRenderingCreateInfo
+var SizeofPipelineRenderingCreateInfo int = int(unsafe.Sizeof(PipelineRenderingCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PipelineRenderingCreateInfo) ArpPtr(arp *AutoReleasePool) *PipelineRenderingCreateInfo {
+	ptr := newCBlock(cULong(SizeofPipelineRenderingCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PipelineRenderingCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PipelineRenderingCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PipelineRenderingCreateInfo) AsCPtr() *PipelineRenderingCreateInfo {
+	clone := (*PipelineRenderingCreateInfo)(newCBlock(cULong(SizeofPipelineRenderingCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// PipelineRenderingCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PipelineRenderingCreateInfoCSlice(arp *AutoReleasePool, x ...PipelineRenderingCreateInfo) []PipelineRenderingCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPipelineRenderingCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PipelineRenderingCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PipelineRenderingCreateInfoFreeCSlice releases the memory allocated by PipelineRenderingCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PipelineRenderingCreateInfoFreeCSlice(x []PipelineRenderingCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PipelineRenderingCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PipelineRenderingCreateInfoFreeCSlice must be called on the returned slice.
+func PipelineRenderingCreateInfoMakeCSlice(x ...PipelineRenderingCreateInfo) []PipelineRenderingCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPipelineRenderingCreateInfo * len(x)
+	dst := unsafe.Slice((*PipelineRenderingCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPipelineRenderingCreateInfo
+func (x PipelineRenderingCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PipelineRenderingCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x PipelineRenderingCreateInfo) WithDefaultSType() PipelineRenderingCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PipelineRenderingCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PIPELINE_RENDERING_CREATE_INFO)
+}
+
+// WithSType clones a new PipelineRenderingCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PipelineRenderingCreateInfo) WithSType(y StructureType) PipelineRenderingCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PipelineRenderingCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPipelineRenderingCreateInfo
+func (x PipelineRenderingCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PipelineRenderingCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PipelineRenderingCreateInfo) WithPNext(y unsafe.Pointer) PipelineRenderingCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PipelineRenderingCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PipelineRenderingCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ViewMask returns the value of viewMask from VkPipelineRenderingCreateInfo
+func (x PipelineRenderingCreateInfo) ViewMask() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.viewMask)
+	return *ptr
+}
+
+// WithViewMask clones a new PipelineRenderingCreateInfo with the value of
+// ViewMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PipelineRenderingCreateInfo) WithViewMask(y uint32) PipelineRenderingCreateInfo {
+	x.viewMask = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *PipelineRenderingCreateInfo) SetViewMask(y uint32) {
+	x.viewMask = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// ColorAttachmentCount returns the value of colorAttachmentCount from VkPipelineRenderingCreateInfo
+func (x PipelineRenderingCreateInfo) ColorAttachmentCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.colorAttachmentCount)
+	return *ptr
+}
+
+// WithColorAttachmentCount clones a new PipelineRenderingCreateInfo with the value of
+// ColorAttachmentCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PipelineRenderingCreateInfo) WithColorAttachmentCount(y uint32) PipelineRenderingCreateInfo {
+	x.colorAttachmentCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *PipelineRenderingCreateInfo) SetColorAttachmentCount(y uint32) {
+	x.colorAttachmentCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PColorAttachmentFormats returns the value of pColorAttachmentFormats from VkPipelineRenderingCreateInfo
+func (x PipelineRenderingCreateInfo) PColorAttachmentFormats() []Format {
+	if x.pColorAttachmentFormats == nil {
+		return nil
+	}
+	return unsafe.Slice((*Format)(unsafe.Pointer(x.pColorAttachmentFormats)), x.colorAttachmentCount)
+}
+
+// WithPColorAttachmentFormats clones a new PipelineRenderingCreateInfo with the value of
+// PColorAttachmentFormats updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines ColorAttachmentCount as the length of this field.
+// ColorAttachmentCount is updated with the length of the new value.
+func (x PipelineRenderingCreateInfo) WithPColorAttachmentFormats(y []Format) PipelineRenderingCreateInfo {
+	x.pColorAttachmentFormats = *(func(x *[]Format) **C.VkFormat { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkFormat)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkFormat)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithColorAttachmentCount(uint32(len(y)))
+}
+func (x *PipelineRenderingCreateInfo) SetPColorAttachmentFormats(y []Format) {
+	x.pColorAttachmentFormats = *(func(x *[]Format) **C.VkFormat { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkFormat)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkFormat)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetColorAttachmentCount(uint32(len(y)))
+}
+
+// PinPColorAttachmentFormats pins the Go memory referenced by y with the AutoReleasePool
+// and sets PColorAttachmentFormats, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PipelineRenderingCreateInfo) PinPColorAttachmentFormats(arp *AutoReleasePool, y []Format) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPColorAttachmentFormats(y)
+}
+
+// DepthAttachmentFormat returns the value of depthAttachmentFormat from VkPipelineRenderingCreateInfo
+func (x PipelineRenderingCreateInfo) DepthAttachmentFormat() Format {
+	ptr := /* typedef */ (*Format)(&x.depthAttachmentFormat)
+	return *ptr
+}
+
+// WithDepthAttachmentFormat clones a new PipelineRenderingCreateInfo with the value of
+// DepthAttachmentFormat updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PipelineRenderingCreateInfo) WithDepthAttachmentFormat(y Format) PipelineRenderingCreateInfo {
+	x.depthAttachmentFormat = *( /* typedef */ (*C.VkFormat)(&y))
+	return x
+}
+func (x *PipelineRenderingCreateInfo) SetDepthAttachmentFormat(y Format) {
+	x.depthAttachmentFormat = *( /* typedef */ (*C.VkFormat)(&y))
+}
+
+// StencilAttachmentFormat returns the value of stencilAttachmentFormat from VkPipelineRenderingCreateInfo
+func (x PipelineRenderingCreateInfo) StencilAttachmentFormat() Format {
+	ptr := /* typedef */ (*Format)(&x.stencilAttachmentFormat)
+	return *ptr
+}
+
+// WithStencilAttachmentFormat clones a new PipelineRenderingCreateInfo with the value of
+// StencilAttachmentFormat updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PipelineRenderingCreateInfo) WithStencilAttachmentFormat(y Format) PipelineRenderingCreateInfo {
+	x.stencilAttachmentFormat = *( /* typedef */ (*C.VkFormat)(&y))
+	return x
+}
+func (x *PipelineRenderingCreateInfo) SetStencilAttachmentFormat(y Format) {
+	x.stencilAttachmentFormat = *( /* typedef */ (*C.VkFormat)(&y))
+}
+
+// RenderingAttachmentInfo provides a go interface for VkRenderingAttachmentInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkRenderingAttachmentInfo.html
+type RenderingAttachmentInfo C.struct_VkRenderingAttachmentInfo
+
+// SizeofRenderingAttachmentInfo is the memory size of a RenderingAttachmentInfo
+var SizeofRenderingAttachmentInfo int = int(unsafe.Sizeof(RenderingAttachmentInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x RenderingAttachmentInfo) ArpPtr(arp *AutoReleasePool) *RenderingAttachmentInfo {
+	ptr := newCBlock(cULong(SizeofRenderingAttachmentInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*RenderingAttachmentInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *RenderingAttachmentInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x RenderingAttachmentInfo) AsCPtr() *RenderingAttachmentInfo {
+	clone := (*RenderingAttachmentInfo)(newCBlock(cULong(SizeofRenderingAttachmentInfo)))
+	*clone = x
+	return clone
+}
+
+// RenderingAttachmentInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func RenderingAttachmentInfoCSlice(arp *AutoReleasePool, x ...RenderingAttachmentInfo) []RenderingAttachmentInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofRenderingAttachmentInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*RenderingAttachmentInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// RenderingAttachmentInfoFreeCSlice releases the memory allocated by RenderingAttachmentInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func RenderingAttachmentInfoFreeCSlice(x []RenderingAttachmentInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// RenderingAttachmentInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. RenderingAttachmentInfoFreeCSlice must be called on the returned slice.
+func RenderingAttachmentInfoMakeCSlice(x ...RenderingAttachmentInfo) []RenderingAttachmentInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofRenderingAttachmentInfo * len(x)
+	dst := unsafe.Slice((*RenderingAttachmentInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkRenderingAttachmentInfo
+func (x *RenderingAttachmentInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new RenderingAttachmentInfo with the value of
+// SType to the value provided in the specification.
+func (x RenderingAttachmentInfo) WithDefaultSType() RenderingAttachmentInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *RenderingAttachmentInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO)
+}
+
+// WithSType clones a new RenderingAttachmentInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderingAttachmentInfo) WithSType(y StructureType) RenderingAttachmentInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *RenderingAttachmentInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkRenderingAttachmentInfo
+func (x *RenderingAttachmentInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new RenderingAttachmentInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderingAttachmentInfo) WithPNext(y unsafe.Pointer) RenderingAttachmentInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *RenderingAttachmentInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *RenderingAttachmentInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ImageView returns the value of imageView from VkRenderingAttachmentInfo
+func (x *RenderingAttachmentInfo) ImageView() ImageView {
+	ptr := /* handle */ (*ImageView)(&x.imageView)
+	return *ptr
+}
+
+// WithImageView clones a new RenderingAttachmentInfo with the value of
+// ImageView updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderingAttachmentInfo) WithImageView(y ImageView) RenderingAttachmentInfo {
+	x.imageView = *( /* handle */ (*C.VkImageView)(&y))
+	return x
+}
+func (x *RenderingAttachmentInfo) SetImageView(y ImageView) {
+	x.imageView = *( /* handle */ (*C.VkImageView)(&y))
+}
+
+// ImageLayout returns the value of imageLayout from VkRenderingAttachmentInfo
+func (x *RenderingAttachmentInfo) ImageLayout() ImageLayout {
+	ptr := /* typedef */ (*ImageLayout)(&x.imageLayout)
+	return *ptr
+}
+
+// WithImageLayout clones a new RenderingAttachmentInfo with the value of
+// ImageLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderingAttachmentInfo) WithImageLayout(y ImageLayout) RenderingAttachmentInfo {
+	x.imageLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+	return x
+}
+func (x *RenderingAttachmentInfo) SetImageLayout(y ImageLayout) {
+	x.imageLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+}
+
+// ResolveMode returns the value of resolveMode from VkRenderingAttachmentInfo
+func (x *RenderingAttachmentInfo) ResolveMode() ResolveModeFlagBits {
+	ptr := /* typedef */ (*ResolveModeFlagBits)(&x.resolveMode)
+	return *ptr
+}
+
+// WithResolveMode clones a new RenderingAttachmentInfo with the value of
+// ResolveMode updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderingAttachmentInfo) WithResolveMode(y ResolveModeFlagBits) RenderingAttachmentInfo {
+	x.resolveMode = *( /* typedef */ (*C.VkResolveModeFlagBits)(&y))
+	return x
+}
+func (x *RenderingAttachmentInfo) SetResolveMode(y ResolveModeFlagBits) {
+	x.resolveMode = *( /* typedef */ (*C.VkResolveModeFlagBits)(&y))
+}
+
+// ResolveImageView returns the value of resolveImageView from VkRenderingAttachmentInfo
+func (x *RenderingAttachmentInfo) ResolveImageView() ImageView {
+	ptr := /* handle */ (*ImageView)(&x.resolveImageView)
+	return *ptr
+}
+
+// WithResolveImageView clones a new RenderingAttachmentInfo with the value of
+// ResolveImageView updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderingAttachmentInfo) WithResolveImageView(y ImageView) RenderingAttachmentInfo {
+	x.resolveImageView = *( /* handle */ (*C.VkImageView)(&y))
+	return x
+}
+func (x *RenderingAttachmentInfo) SetResolveImageView(y ImageView) {
+	x.resolveImageView = *( /* handle */ (*C.VkImageView)(&y))
+}
+
+// ResolveImageLayout returns the value of resolveImageLayout from VkRenderingAttachmentInfo
+func (x *RenderingAttachmentInfo) ResolveImageLayout() ImageLayout {
+	ptr := /* typedef */ (*ImageLayout)(&x.resolveImageLayout)
+	return *ptr
+}
+
+// WithResolveImageLayout clones a new RenderingAttachmentInfo with the value of
+// ResolveImageLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderingAttachmentInfo) WithResolveImageLayout(y ImageLayout) RenderingAttachmentInfo {
+	x.resolveImageLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+	return x
+}
+func (x *RenderingAttachmentInfo) SetResolveImageLayout(y ImageLayout) {
+	x.resolveImageLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+}
+
+// LoadOp returns the value of loadOp from VkRenderingAttachmentInfo
+func (x *RenderingAttachmentInfo) LoadOp() AttachmentLoadOp {
+	ptr := /* typedef */ (*AttachmentLoadOp)(&x.loadOp)
+	return *ptr
+}
+
+// WithLoadOp clones a new RenderingAttachmentInfo with the value of
+// LoadOp updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderingAttachmentInfo) WithLoadOp(y AttachmentLoadOp) RenderingAttachmentInfo {
+	x.loadOp = *( /* typedef */ (*C.VkAttachmentLoadOp)(&y))
+	return x
+}
+func (x *RenderingAttachmentInfo) SetLoadOp(y AttachmentLoadOp) {
+	x.loadOp = *( /* typedef */ (*C.VkAttachmentLoadOp)(&y))
+}
+
+// StoreOp returns the value of storeOp from VkRenderingAttachmentInfo
+func (x *RenderingAttachmentInfo) StoreOp() AttachmentStoreOp {
+	ptr := /* typedef */ (*AttachmentStoreOp)(&x.storeOp)
+	return *ptr
+}
+
+// WithStoreOp clones a new RenderingAttachmentInfo with the value of
+// StoreOp updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderingAttachmentInfo) WithStoreOp(y AttachmentStoreOp) RenderingAttachmentInfo {
+	x.storeOp = *( /* typedef */ (*C.VkAttachmentStoreOp)(&y))
+	return x
+}
+func (x *RenderingAttachmentInfo) SetStoreOp(y AttachmentStoreOp) {
+	x.storeOp = *( /* typedef */ (*C.VkAttachmentStoreOp)(&y))
+}
+
+// ClearValue returns the value of clearValue from VkRenderingAttachmentInfo
+func (x *RenderingAttachmentInfo) ClearValue() ClearValue {
+	ptr := /* typedef */ (*ClearValue)(&x.clearValue)
+	return *ptr
+}
+
+// WithClearValue clones a new RenderingAttachmentInfo with the value of
+// ClearValue updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderingAttachmentInfo) WithClearValue(y ClearValue) RenderingAttachmentInfo {
+	x.clearValue = *( /* typedef */ (*C.VkClearValue)(&y))
+	return x
+}
+func (x *RenderingAttachmentInfo) SetClearValue(y ClearValue) {
+	x.clearValue = *( /* typedef */ (*C.VkClearValue)(&y))
+}
+
+// RenderingInfo provides a go interface for VkRenderingInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkRenderingInfo.html
+type RenderingInfo C.struct_VkRenderingInfo
+
+// SizeofRenderingInfo is the memory size of a RenderingInfo
+var SizeofRenderingInfo int = int(unsafe.Sizeof(RenderingInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x RenderingInfo) ArpPtr(arp *AutoReleasePool) *RenderingInfo {
+	ptr := newCBlock(cULong(SizeofRenderingInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*RenderingInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *RenderingInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x RenderingInfo) AsCPtr() *RenderingInfo {
+	clone := (*RenderingInfo)(newCBlock(cULong(SizeofRenderingInfo)))
+	*clone = x
+	return clone
+}
+
+// RenderingInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func RenderingInfoCSlice(arp *AutoReleasePool, x ...RenderingInfo) []RenderingInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofRenderingInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*RenderingInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// RenderingInfoFreeCSlice releases the memory allocated by RenderingInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func RenderingInfoFreeCSlice(x []RenderingInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// RenderingInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. RenderingInfoFreeCSlice must be called on the returned slice.
+func RenderingInfoMakeCSlice(x ...RenderingInfo) []RenderingInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofRenderingInfo * len(x)
+	dst := unsafe.Slice((*RenderingInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkRenderingInfo
+func (x *RenderingInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new RenderingInfo with the value of
+// SType to the value provided in the specification.
+func (x RenderingInfo) WithDefaultSType() RenderingInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_RENDERING_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *RenderingInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_RENDERING_INFO)
+}
+
+// WithSType clones a new RenderingInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderingInfo) WithSType(y StructureType) RenderingInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *RenderingInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkRenderingInfo
+func (x *RenderingInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new RenderingInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderingInfo) WithPNext(y unsafe.Pointer) RenderingInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *RenderingInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *RenderingInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Flags returns the value of flags from VkRenderingInfo
+func (x *RenderingInfo) Flags() RenderingFlags {
+	ptr := /* typedef */ (*RenderingFlags)(&x.flags)
+	return *ptr
+}
+
+// WithFlags clones a new RenderingInfo with the value of
+// Flags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderingInfo) WithFlags(y RenderingFlags) RenderingInfo {
+	x.flags = *( /* typedef */ (*C.VkRenderingFlags)(&y))
+	return x
+}
+func (x *RenderingInfo) SetFlags(y RenderingFlags) {
+	x.flags = *( /* typedef */ (*C.VkRenderingFlags)(&y))
+}
+
+// RenderArea returns the value of renderArea from VkRenderingInfo
+func (x *RenderingInfo) RenderArea() Rect2D {
+	ptr := /* typedef */ (*Rect2D)(&x.renderArea)
+	return *ptr
+}
+
+// WithRenderArea clones a new RenderingInfo with the value of
+// RenderArea updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderingInfo) WithRenderArea(y Rect2D) RenderingInfo {
+	x.renderArea = *( /* typedef */ (*C.struct_VkRect2D)(&y))
+	return x
+}
+func (x *RenderingInfo) SetRenderArea(y Rect2D) {
+	x.renderArea = *( /* typedef */ (*C.struct_VkRect2D)(&y))
+}
+
+// LayerCount returns the value of layerCount from VkRenderingInfo
+func (x *RenderingInfo) LayerCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.layerCount)
+	return *ptr
+}
+
+// WithLayerCount clones a new RenderingInfo with the value of
+// LayerCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderingInfo) WithLayerCount(y uint32) RenderingInfo {
+	x.layerCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *RenderingInfo) SetLayerCount(y uint32) {
+	x.layerCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// ViewMask returns the value of viewMask from VkRenderingInfo
+func (x *RenderingInfo) ViewMask() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.viewMask)
+	return *ptr
+}
+
+// WithViewMask clones a new RenderingInfo with the value of
+// ViewMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderingInfo) WithViewMask(y uint32) RenderingInfo {
+	x.viewMask = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *RenderingInfo) SetViewMask(y uint32) {
+	x.viewMask = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// ColorAttachmentCount returns the value of colorAttachmentCount from VkRenderingInfo
+func (x *RenderingInfo) ColorAttachmentCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.colorAttachmentCount)
+	return *ptr
+}
+
+// WithColorAttachmentCount clones a new RenderingInfo with the value of
+// ColorAttachmentCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderingInfo) WithColorAttachmentCount(y uint32) RenderingInfo {
+	x.colorAttachmentCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *RenderingInfo) SetColorAttachmentCount(y uint32) {
+	x.colorAttachmentCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PColorAttachments returns the value of pColorAttachments from VkRenderingInfo
+func (x *RenderingInfo) PColorAttachments() []RenderingAttachmentInfo {
+	if x.pColorAttachments == nil {
+		return nil
+	}
+	return unsafe.Slice((*RenderingAttachmentInfo)(unsafe.Pointer(x.pColorAttachments)), x.colorAttachmentCount)
+}
+
+// WithPColorAttachments clones a new RenderingInfo with the value of
+// PColorAttachments updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines ColorAttachmentCount as the length of this field.
+// ColorAttachmentCount is updated with the length of the new value.
+func (x RenderingInfo) WithPColorAttachments(y []RenderingAttachmentInfo) RenderingInfo {
+	x.pColorAttachments = *(func(x *[]RenderingAttachmentInfo) **C.struct_VkRenderingAttachmentInfo { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkRenderingAttachmentInfo)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkRenderingAttachmentInfo)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithColorAttachmentCount(uint32(len(y)))
+}
+func (x *RenderingInfo) SetPColorAttachments(y []RenderingAttachmentInfo) {
+	x.pColorAttachments = *(func(x *[]RenderingAttachmentInfo) **C.struct_VkRenderingAttachmentInfo { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkRenderingAttachmentInfo)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkRenderingAttachmentInfo)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetColorAttachmentCount(uint32(len(y)))
+}
+
+// PinPColorAttachments pins the Go memory referenced by y with the AutoReleasePool
+// and sets PColorAttachments, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *RenderingInfo) PinPColorAttachments(arp *AutoReleasePool, y []RenderingAttachmentInfo) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPColorAttachments(y)
+}
+
+// PDepthAttachment returns the value of pDepthAttachment from VkRenderingInfo
+func (x *RenderingInfo) PDepthAttachment() *RenderingAttachmentInfo {
+	ptr := func(x **C.struct_VkRenderingAttachmentInfo) **RenderingAttachmentInfo { /* Pointer */
+		c2g := (*RenderingAttachmentInfo)(*x)
+		return &c2g
+	}(&x.pDepthAttachment)
+	return *ptr
+}
+
+// WithPDepthAttachment clones a new RenderingInfo with the value of
+// PDepthAttachment updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderingInfo) WithPDepthAttachment(y *RenderingAttachmentInfo) RenderingInfo {
+	x.pDepthAttachment = *(func(x **RenderingAttachmentInfo) **C.struct_VkRenderingAttachmentInfo { /* Pointer */
+		g2c := (*C.struct_VkRenderingAttachmentInfo)(*x)
+		return &g2c
+	}(&y))
+	return x
+}
+func (x *RenderingInfo) SetPDepthAttachment(y *RenderingAttachmentInfo) {
+	x.pDepthAttachment = *(func(x **RenderingAttachmentInfo) **C.struct_VkRenderingAttachmentInfo { /* Pointer */
+		g2c := (*C.struct_VkRenderingAttachmentInfo)(*x)
+		return &g2c
+	}(&y))
+}
+
+// PinPDepthAttachment pins the Go memory referenced by y with the AutoReleasePool
+// and sets PDepthAttachment, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *RenderingInfo) PinPDepthAttachment(arp *AutoReleasePool, y *RenderingAttachmentInfo) {
+	arp.Pin(unsafe.Pointer(y))
+	x.SetPDepthAttachment(y)
+}
+
+// PStencilAttachment returns the value of pStencilAttachment from VkRenderingInfo
+func (x *RenderingInfo) PStencilAttachment() *RenderingAttachmentInfo {
+	ptr := func(x **C.struct_VkRenderingAttachmentInfo) **RenderingAttachmentInfo { /* Pointer */
+		c2g := (*RenderingAttachmentInfo)(*x)
+		return &c2g
+	}(&x.pStencilAttachment)
+	return *ptr
+}
+
+// WithPStencilAttachment clones a new RenderingInfo with the value of
+// PStencilAttachment updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x RenderingInfo) WithPStencilAttachment(y *RenderingAttachmentInfo) RenderingInfo {
+	x.pStencilAttachment = *(func(x **RenderingAttachmentInfo) **C.struct_VkRenderingAttachmentInfo { /* Pointer */
+		g2c := (*C.struct_VkRenderingAttachmentInfo)(*x)
+		return &g2c
+	}(&y))
+	return x
+}
+func (x *RenderingInfo) SetPStencilAttachment(y *RenderingAttachmentInfo) {
+	x.pStencilAttachment = *(func(x **RenderingAttachmentInfo) **C.struct_VkRenderingAttachmentInfo { /* Pointer */
+		g2c := (*C.struct_VkRenderingAttachmentInfo)(*x)
+		return &g2c
+	}(&y))
+}
+
+// PinPStencilAttachment pins the Go memory referenced by y with the AutoReleasePool
+// and sets PStencilAttachment, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *RenderingInfo) PinPStencilAttachment(arp *AutoReleasePool, y *RenderingAttachmentInfo) {
+	arp.Pin(unsafe.Pointer(y))
+	x.SetPStencilAttachment(y)
+}
+
+// PhysicalDeviceTextureCompressionASTCHDRFeatures provides a go interface for VkPhysicalDeviceTextureCompressionASTCHDRFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceTextureCompressionASTCHDRFeatures.html
+type PhysicalDeviceTextureCompressionASTCHDRFeatures C.struct_VkPhysicalDeviceTextureCompressionASTCHDRFeatures
+
+// SizeofPhysicalDeviceTextureCompressionASTCHDRFeatures is the memory size of a PhysicalDeviceTextureCompressionASTCHDRFeatures
+var SizeofPhysicalDeviceTextureCompressionASTCHDRFeatures int = int(unsafe.Sizeof(PhysicalDeviceTextureCompressionASTCHDRFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceTextureCompressionASTCHDRFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceTextureCompressionASTCHDRFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceTextureCompressionASTCHDRFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceTextureCompressionASTCHDRFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceTextureCompressionASTCHDRFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceTextureCompressionASTCHDRFeatures) AsCPtr() *PhysicalDeviceTextureCompressionASTCHDRFeatures {
+	clone := (*PhysicalDeviceTextureCompressionASTCHDRFeatures)(newCBlock(cULong(SizeofPhysicalDeviceTextureCompressionASTCHDRFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceTextureCompressionASTCHDRFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceTextureCompressionASTCHDRFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceTextureCompressionASTCHDRFeatures) []PhysicalDeviceTextureCompressionASTCHDRFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceTextureCompressionASTCHDRFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceTextureCompressionASTCHDRFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceTextureCompressionASTCHDRFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceTextureCompressionASTCHDRFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceTextureCompressionASTCHDRFeaturesFreeCSlice(x []PhysicalDeviceTextureCompressionASTCHDRFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceTextureCompressionASTCHDRFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceTextureCompressionASTCHDRFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceTextureCompressionASTCHDRFeaturesMakeCSlice(x ...PhysicalDeviceTextureCompressionASTCHDRFeatures) []PhysicalDeviceTextureCompressionASTCHDRFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceTextureCompressionASTCHDRFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceTextureCompressionASTCHDRFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceTextureCompressionASTCHDRFeatures
+func (x PhysicalDeviceTextureCompressionASTCHDRFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceTextureCompressionASTCHDRFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceTextureCompressionASTCHDRFeatures) WithDefaultSType() PhysicalDeviceTextureCompressionASTCHDRFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_HDR_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceTextureCompressionASTCHDRFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_HDR_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceTextureCompressionASTCHDRFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceTextureCompressionASTCHDRFeatures) WithSType(y StructureType) PhysicalDeviceTextureCompressionASTCHDRFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceTextureCompressionASTCHDRFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceTextureCompressionASTCHDRFeatures
+func (x PhysicalDeviceTextureCompressionASTCHDRFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceTextureCompressionASTCHDRFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceTextureCompressionASTCHDRFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceTextureCompressionASTCHDRFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceTextureCompressionASTCHDRFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceTextureCompressionASTCHDRFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// TextureCompressionASTC_HDR returns the value of textureCompressionASTC_HDR from VkPhysicalDeviceTextureCompressionASTCHDRFeatures
+func (x PhysicalDeviceTextureCompressionASTCHDRFeatures) TextureCompressionASTC_HDR() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.textureCompressionASTC_HDR)
+	return *ptr
+}
+
+// WithTextureCompressionASTC_HDR clones a new PhysicalDeviceTextureCompressionASTCHDRFeatures with the value of
+// TextureCompressionASTC_HDR updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceTextureCompressionASTCHDRFeatures) WithTextureCompressionASTC_HDR(y Bool32) PhysicalDeviceTextureCompressionASTCHDRFeatures {
+	x.textureCompressionASTC_HDR = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceTextureCompressionASTCHDRFeatures) SetTextureCompressionASTC_HDR(y Bool32) {
+	x.textureCompressionASTC_HDR = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PhysicalDeviceInlineUniformBlockProperties provides a go interface for VkPhysicalDeviceInlineUniformBlockProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceInlineUniformBlockProperties.html
+type PhysicalDeviceInlineUniformBlockProperties C.struct_VkPhysicalDeviceInlineUniformBlockProperties
+
+// SizeofPhysicalDeviceInlineUniformBlockProperties is the memory size of a PhysicalDeviceInlineUniformBlockProperties
+var SizeofPhysicalDeviceInlineUniformBlockProperties int = int(unsafe.Sizeof(PhysicalDeviceInlineUniformBlockProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceInlineUniformBlockProperties) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceInlineUniformBlockProperties {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceInlineUniformBlockProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceInlineUniformBlockProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceInlineUniformBlockProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceInlineUniformBlockProperties) AsCPtr() *PhysicalDeviceInlineUniformBlockProperties {
+	clone := (*PhysicalDeviceInlineUniformBlockProperties)(newCBlock(cULong(SizeofPhysicalDeviceInlineUniformBlockProperties)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceInlineUniformBlockPropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceInlineUniformBlockPropertiesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceInlineUniformBlockProperties) []PhysicalDeviceInlineUniformBlockProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceInlineUniformBlockProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceInlineUniformBlockProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceInlineUniformBlockPropertiesFreeCSlice releases the memory allocated by PhysicalDeviceInlineUniformBlockPropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceInlineUniformBlockPropertiesFreeCSlice(x []PhysicalDeviceInlineUniformBlockProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceInlineUniformBlockPropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceInlineUniformBlockPropertiesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceInlineUniformBlockPropertiesMakeCSlice(x ...PhysicalDeviceInlineUniformBlockProperties) []PhysicalDeviceInlineUniformBlockProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceInlineUniformBlockProperties * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceInlineUniformBlockProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceInlineUniformBlockProperties
+func (x PhysicalDeviceInlineUniformBlockProperties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceInlineUniformBlockProperties with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceInlineUniformBlockProperties) WithDefaultSType() PhysicalDeviceInlineUniformBlockProperties {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceInlineUniformBlockProperties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_PROPERTIES)
+}
+
+// WithSType clones a new PhysicalDeviceInlineUniformBlockProperties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceInlineUniformBlockProperties) WithSType(y StructureType) PhysicalDeviceInlineUniformBlockProperties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceInlineUniformBlockProperties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceInlineUniformBlockProperties
+func (x PhysicalDeviceInlineUniformBlockProperties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceInlineUniformBlockProperties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceInlineUniformBlockProperties) WithPNext(y unsafe.Pointer) PhysicalDeviceInlineUniformBlockProperties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceInlineUniformBlockProperties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceInlineUniformBlockProperties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// MaxInlineUniformBlockSize returns the value of maxInlineUniformBlockSize from VkPhysicalDeviceInlineUniformBlockProperties
+func (x PhysicalDeviceInlineUniformBlockProperties) MaxInlineUniformBlockSize() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxInlineUniformBlockSize)
+	return *ptr
+}
+
+// MaxPerStageDescriptorInlineUniformBlocks returns the value of maxPerStageDescriptorInlineUniformBlocks from VkPhysicalDeviceInlineUniformBlockProperties
+func (x PhysicalDeviceInlineUniformBlockProperties) MaxPerStageDescriptorInlineUniformBlocks() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxPerStageDescriptorInlineUniformBlocks)
+	return *ptr
+}
+
+// MaxPerStageDescriptorUpdateAfterBindInlineUniformBlocks returns the value of maxPerStageDescriptorUpdateAfterBindInlineUniformBlocks from VkPhysicalDeviceInlineUniformBlockProperties
+func (x PhysicalDeviceInlineUniformBlockProperties) MaxPerStageDescriptorUpdateAfterBindInlineUniformBlocks() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxPerStageDescriptorUpdateAfterBindInlineUniformBlocks)
+	return *ptr
+}
+
+// MaxDescriptorSetInlineUniformBlocks returns the value of maxDescriptorSetInlineUniformBlocks from VkPhysicalDeviceInlineUniformBlockProperties
+func (x PhysicalDeviceInlineUniformBlockProperties) MaxDescriptorSetInlineUniformBlocks() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxDescriptorSetInlineUniformBlocks)
+	return *ptr
+}
+
+// MaxDescriptorSetUpdateAfterBindInlineUniformBlocks returns the value of maxDescriptorSetUpdateAfterBindInlineUniformBlocks from VkPhysicalDeviceInlineUniformBlockProperties
+func (x PhysicalDeviceInlineUniformBlockProperties) MaxDescriptorSetUpdateAfterBindInlineUniformBlocks() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxDescriptorSetUpdateAfterBindInlineUniformBlocks)
+	return *ptr
+}
+
+// DescriptorPoolInlineUniformBlockCreateInfo provides a go interface for VkDescriptorPoolInlineUniformBlockCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDescriptorPoolInlineUniformBlockCreateInfo.html
+type DescriptorPoolInlineUniformBlockCreateInfo C.struct_VkDescriptorPoolInlineUniformBlockCreateInfo
+
+// SizeofDescriptorPoolInlineUniformBlockCreateInfo is the memory size of a DescriptorPoolInlineUniformBlockCreateInfo
+var SizeofDescriptorPoolInlineUniformBlockCreateInfo int = int(unsafe.Sizeof(DescriptorPoolInlineUniformBlockCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DescriptorPoolInlineUniformBlockCreateInfo) ArpPtr(arp *AutoReleasePool) *DescriptorPoolInlineUniformBlockCreateInfo {
+	ptr := newCBlock(cULong(SizeofDescriptorPoolInlineUniformBlockCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DescriptorPoolInlineUniformBlockCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DescriptorPoolInlineUniformBlockCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DescriptorPoolInlineUniformBlockCreateInfo) AsCPtr() *DescriptorPoolInlineUniformBlockCreateInfo {
+	clone := (*DescriptorPoolInlineUniformBlockCreateInfo)(newCBlock(cULong(SizeofDescriptorPoolInlineUniformBlockCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// DescriptorPoolInlineUniformBlockCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DescriptorPoolInlineUniformBlockCreateInfoCSlice(arp *AutoReleasePool, x ...DescriptorPoolInlineUniformBlockCreateInfo) []DescriptorPoolInlineUniformBlockCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDescriptorPoolInlineUniformBlockCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DescriptorPoolInlineUniformBlockCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DescriptorPoolInlineUniformBlockCreateInfoFreeCSlice releases the memory allocated by DescriptorPoolInlineUniformBlockCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DescriptorPoolInlineUniformBlockCreateInfoFreeCSlice(x []DescriptorPoolInlineUniformBlockCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DescriptorPoolInlineUniformBlockCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DescriptorPoolInlineUniformBlockCreateInfoFreeCSlice must be called on the returned slice.
+func DescriptorPoolInlineUniformBlockCreateInfoMakeCSlice(x ...DescriptorPoolInlineUniformBlockCreateInfo) []DescriptorPoolInlineUniformBlockCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDescriptorPoolInlineUniformBlockCreateInfo * len(x)
+	dst := unsafe.Slice((*DescriptorPoolInlineUniformBlockCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDescriptorPoolInlineUniformBlockCreateInfo
+func (x DescriptorPoolInlineUniformBlockCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DescriptorPoolInlineUniformBlockCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x DescriptorPoolInlineUniformBlockCreateInfo) WithDefaultSType() DescriptorPoolInlineUniformBlockCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DescriptorPoolInlineUniformBlockCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO)
+}
+
+// WithSType clones a new DescriptorPoolInlineUniformBlockCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorPoolInlineUniformBlockCreateInfo) WithSType(y StructureType) DescriptorPoolInlineUniformBlockCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DescriptorPoolInlineUniformBlockCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDescriptorPoolInlineUniformBlockCreateInfo
+func (x DescriptorPoolInlineUniformBlockCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DescriptorPoolInlineUniformBlockCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorPoolInlineUniformBlockCreateInfo) WithPNext(y unsafe.Pointer) DescriptorPoolInlineUniformBlockCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DescriptorPoolInlineUniformBlockCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DescriptorPoolInlineUniformBlockCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// MaxInlineUniformBlockBindings returns the value of maxInlineUniformBlockBindings from VkDescriptorPoolInlineUniformBlockCreateInfo
+func (x DescriptorPoolInlineUniformBlockCreateInfo) MaxInlineUniformBlockBindings() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.maxInlineUniformBlockBindings)
+	return *ptr
+}
+
+// WithMaxInlineUniformBlockBindings clones a new DescriptorPoolInlineUniformBlockCreateInfo with the value of
+// MaxInlineUniformBlockBindings updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DescriptorPoolInlineUniformBlockCreateInfo) WithMaxInlineUniformBlockBindings(y uint32) DescriptorPoolInlineUniformBlockCreateInfo {
+	x.maxInlineUniformBlockBindings = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DescriptorPoolInlineUniformBlockCreateInfo) SetMaxInlineUniformBlockBindings(y uint32) {
+	x.maxInlineUniformBlockBindings = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// DeviceImageMemoryRequirements provides a go interface for VkDeviceImageMemoryRequirements.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDeviceImageMemoryRequirements.html
+type DeviceImageMemoryRequirements C.struct_VkDeviceImageMemoryRequirements
+
+// SizeofDeviceImageMemoryRequirements is the memory size of a DeviceImageMemoryRequirements
+var SizeofDeviceImageMemoryRequirements int = int(unsafe.Sizeof(DeviceImageMemoryRequirements{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DeviceImageMemoryRequirements) ArpPtr(arp *AutoReleasePool) *DeviceImageMemoryRequirements {
+	ptr := newCBlock(cULong(SizeofDeviceImageMemoryRequirements))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DeviceImageMemoryRequirements)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DeviceImageMemoryRequirements) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DeviceImageMemoryRequirements) AsCPtr() *DeviceImageMemoryRequirements {
+	clone := (*DeviceImageMemoryRequirements)(newCBlock(cULong(SizeofDeviceImageMemoryRequirements)))
+	*clone = x
+	return clone
+}
+
+// DeviceImageMemoryRequirementsCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DeviceImageMemoryRequirementsCSlice(arp *AutoReleasePool, x ...DeviceImageMemoryRequirements) []DeviceImageMemoryRequirements {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceImageMemoryRequirements * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DeviceImageMemoryRequirements)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DeviceImageMemoryRequirementsFreeCSlice releases the memory allocated by DeviceImageMemoryRequirementsMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DeviceImageMemoryRequirementsFreeCSlice(x []DeviceImageMemoryRequirements) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DeviceImageMemoryRequirementsMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DeviceImageMemoryRequirementsFreeCSlice must be called on the returned slice.
+func DeviceImageMemoryRequirementsMakeCSlice(x ...DeviceImageMemoryRequirements) []DeviceImageMemoryRequirements {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDeviceImageMemoryRequirements * len(x)
+	dst := unsafe.Slice((*DeviceImageMemoryRequirements)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDeviceImageMemoryRequirements
+func (x DeviceImageMemoryRequirements) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DeviceImageMemoryRequirements with the value of
+// SType to the value provided in the specification.
+func (x DeviceImageMemoryRequirements) WithDefaultSType() DeviceImageMemoryRequirements {
+	return x.WithSType(VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DeviceImageMemoryRequirements) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DEVICE_IMAGE_MEMORY_REQUIREMENTS)
+}
+
+// WithSType clones a new DeviceImageMemoryRequirements with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceImageMemoryRequirements) WithSType(y StructureType) DeviceImageMemoryRequirements {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DeviceImageMemoryRequirements) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDeviceImageMemoryRequirements
+func (x DeviceImageMemoryRequirements) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DeviceImageMemoryRequirements with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceImageMemoryRequirements) WithPNext(y unsafe.Pointer) DeviceImageMemoryRequirements {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DeviceImageMemoryRequirements) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DeviceImageMemoryRequirements) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// PCreateInfo returns the value of pCreateInfo from VkDeviceImageMemoryRequirements
+func (x DeviceImageMemoryRequirements) PCreateInfo() *ImageCreateInfo {
+	ptr := func(x **C.struct_VkImageCreateInfo) **ImageCreateInfo { /* Pointer */
+		c2g := (*ImageCreateInfo)(*x)
+		return &c2g
+	}(&x.pCreateInfo)
+	return *ptr
+}
+
+// WithPCreateInfo clones a new DeviceImageMemoryRequirements with the value of
+// PCreateInfo updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceImageMemoryRequirements) WithPCreateInfo(y *ImageCreateInfo) DeviceImageMemoryRequirements {
+	x.pCreateInfo = *(func(x **ImageCreateInfo) **C.struct_VkImageCreateInfo { /* Pointer */
+		g2c := (*C.struct_VkImageCreateInfo)(*x)
+		return &g2c
+	}(&y))
+	return x
+}
+func (x *DeviceImageMemoryRequirements) SetPCreateInfo(y *ImageCreateInfo) {
+	x.pCreateInfo = *(func(x **ImageCreateInfo) **C.struct_VkImageCreateInfo { /* Pointer */
+		g2c := (*C.struct_VkImageCreateInfo)(*x)
+		return &g2c
+	}(&y))
+}
+
+// PinPCreateInfo pins the Go memory referenced by y with the AutoReleasePool
+// and sets PCreateInfo, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DeviceImageMemoryRequirements) PinPCreateInfo(arp *AutoReleasePool, y *ImageCreateInfo) {
+	arp.Pin(unsafe.Pointer(y))
+	x.SetPCreateInfo(y)
+}
+
+// PlaneAspect returns the value of planeAspect from VkDeviceImageMemoryRequirements
+func (x DeviceImageMemoryRequirements) PlaneAspect() ImageAspectFlagBits {
+	ptr := /* typedef */ (*ImageAspectFlagBits)(&x.planeAspect)
+	return *ptr
+}
+
+// WithPlaneAspect clones a new DeviceImageMemoryRequirements with the value of
+// PlaneAspect updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DeviceImageMemoryRequirements) WithPlaneAspect(y ImageAspectFlagBits) DeviceImageMemoryRequirements {
+	x.planeAspect = *( /* typedef */ (*C.VkImageAspectFlagBits)(&y))
+	return x
+}
+func (x *DeviceImageMemoryRequirements) SetPlaneAspect(y ImageAspectFlagBits) {
+	x.planeAspect = *( /* typedef */ (*C.VkImageAspectFlagBits)(&y))
+}
+
+// PipelineShaderStageRequiredSubgroupSizeCreateInfo provides a go interface for VkPipelineShaderStageRequiredSubgroupSizeCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPipelineShaderStageRequiredSubgroupSizeCreateInfo.html
+type PipelineShaderStageRequiredSubgroupSizeCreateInfo C.struct_VkPipelineShaderStageRequiredSubgroupSizeCreateInfo
+
+// SizeofPipelineShaderStageRequiredSubgroupSizeCreateInfo is the memory size of a PipelineShaderStageRequiredSubgroupSizeCreateInfo
+var SizeofPipelineShaderStageRequiredSubgroupSizeCreateInfo int = int(unsafe.Sizeof(PipelineShaderStageRequiredSubgroupSizeCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PipelineShaderStageRequiredSubgroupSizeCreateInfo) ArpPtr(arp *AutoReleasePool) *PipelineShaderStageRequiredSubgroupSizeCreateInfo {
+	ptr := newCBlock(cULong(SizeofPipelineShaderStageRequiredSubgroupSizeCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PipelineShaderStageRequiredSubgroupSizeCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PipelineShaderStageRequiredSubgroupSizeCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PipelineShaderStageRequiredSubgroupSizeCreateInfo) AsCPtr() *PipelineShaderStageRequiredSubgroupSizeCreateInfo {
+	clone := (*PipelineShaderStageRequiredSubgroupSizeCreateInfo)(newCBlock(cULong(SizeofPipelineShaderStageRequiredSubgroupSizeCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// PipelineShaderStageRequiredSubgroupSizeCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PipelineShaderStageRequiredSubgroupSizeCreateInfoCSlice(arp *AutoReleasePool, x ...PipelineShaderStageRequiredSubgroupSizeCreateInfo) []PipelineShaderStageRequiredSubgroupSizeCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPipelineShaderStageRequiredSubgroupSizeCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PipelineShaderStageRequiredSubgroupSizeCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PipelineShaderStageRequiredSubgroupSizeCreateInfoFreeCSlice releases the memory allocated by PipelineShaderStageRequiredSubgroupSizeCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PipelineShaderStageRequiredSubgroupSizeCreateInfoFreeCSlice(x []PipelineShaderStageRequiredSubgroupSizeCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PipelineShaderStageRequiredSubgroupSizeCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PipelineShaderStageRequiredSubgroupSizeCreateInfoFreeCSlice must be called on the returned slice.
+func PipelineShaderStageRequiredSubgroupSizeCreateInfoMakeCSlice(x ...PipelineShaderStageRequiredSubgroupSizeCreateInfo) []PipelineShaderStageRequiredSubgroupSizeCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPipelineShaderStageRequiredSubgroupSizeCreateInfo * len(x)
+	dst := unsafe.Slice((*PipelineShaderStageRequiredSubgroupSizeCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPipelineShaderStageRequiredSubgroupSizeCreateInfo
+func (x PipelineShaderStageRequiredSubgroupSizeCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PipelineShaderStageRequiredSubgroupSizeCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x PipelineShaderStageRequiredSubgroupSizeCreateInfo) WithDefaultSType() PipelineShaderStageRequiredSubgroupSizeCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PipelineShaderStageRequiredSubgroupSizeCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO)
+}
+
+// WithSType clones a new PipelineShaderStageRequiredSubgroupSizeCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PipelineShaderStageRequiredSubgroupSizeCreateInfo) WithSType(y StructureType) PipelineShaderStageRequiredSubgroupSizeCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PipelineShaderStageRequiredSubgroupSizeCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPipelineShaderStageRequiredSubgroupSizeCreateInfo
+func (x PipelineShaderStageRequiredSubgroupSizeCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PipelineShaderStageRequiredSubgroupSizeCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PipelineShaderStageRequiredSubgroupSizeCreateInfo) WithPNext(y unsafe.Pointer) PipelineShaderStageRequiredSubgroupSizeCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PipelineShaderStageRequiredSubgroupSizeCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PipelineShaderStageRequiredSubgroupSizeCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// RequiredSubgroupSize returns the value of requiredSubgroupSize from VkPipelineShaderStageRequiredSubgroupSizeCreateInfo
+func (x PipelineShaderStageRequiredSubgroupSizeCreateInfo) RequiredSubgroupSize() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.requiredSubgroupSize)
+	return *ptr
+}
+
+// PhysicalDeviceToolProperties provides a go interface for VkPhysicalDeviceToolProperties.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceToolProperties.html
+type PhysicalDeviceToolProperties C.struct_VkPhysicalDeviceToolProperties
+
+// SizeofPhysicalDeviceToolProperties is the memory size of a PhysicalDeviceToolProperties
+var SizeofPhysicalDeviceToolProperties int = int(unsafe.Sizeof(PhysicalDeviceToolProperties{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceToolProperties) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceToolProperties {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceToolProperties))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceToolProperties)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceToolProperties) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceToolProperties) AsCPtr() *PhysicalDeviceToolProperties {
+	clone := (*PhysicalDeviceToolProperties)(newCBlock(cULong(SizeofPhysicalDeviceToolProperties)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceToolPropertiesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceToolPropertiesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceToolProperties) []PhysicalDeviceToolProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceToolProperties * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceToolProperties)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceToolPropertiesFreeCSlice releases the memory allocated by PhysicalDeviceToolPropertiesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceToolPropertiesFreeCSlice(x []PhysicalDeviceToolProperties) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceToolPropertiesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceToolPropertiesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceToolPropertiesMakeCSlice(x ...PhysicalDeviceToolProperties) []PhysicalDeviceToolProperties {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceToolProperties * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceToolProperties)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceToolProperties
+func (x *PhysicalDeviceToolProperties) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceToolProperties with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceToolProperties) WithDefaultSType() PhysicalDeviceToolProperties {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TOOL_PROPERTIES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceToolProperties) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TOOL_PROPERTIES)
+}
+
+// WithSType clones a new PhysicalDeviceToolProperties with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceToolProperties) WithSType(y StructureType) PhysicalDeviceToolProperties {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceToolProperties) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceToolProperties
+func (x *PhysicalDeviceToolProperties) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceToolProperties with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceToolProperties) WithPNext(y unsafe.Pointer) PhysicalDeviceToolProperties {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceToolProperties) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceToolProperties) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Name returns the value of name from VkPhysicalDeviceToolProperties
+// The slice references the array in x; it is not a copy.
+func (x *PhysicalDeviceToolProperties) Name() []byte {
+	ptr := func(x *[VK_MAX_EXTENSION_NAME_SIZE]C.char) *[]byte { /* Array for byte */
+		slc := unsafe.Slice((*byte)(unsafe.Pointer(x)), VK_MAX_EXTENSION_NAME_SIZE)
+		return &slc
+	}(&x.name)
+	return *ptr
+}
+
+// Version returns the value of version from VkPhysicalDeviceToolProperties
+// The slice references the array in x; it is not a copy.
+func (x *PhysicalDeviceToolProperties) Version() []byte {
+	ptr := func(x *[VK_MAX_EXTENSION_NAME_SIZE]C.char) *[]byte { /* Array for byte */
+		slc := unsafe.Slice((*byte)(unsafe.Pointer(x)), VK_MAX_EXTENSION_NAME_SIZE)
+		return &slc
+	}(&x.version)
+	return *ptr
+}
+
+// Purposes returns the value of purposes from VkPhysicalDeviceToolProperties
+func (x *PhysicalDeviceToolProperties) Purposes() ToolPurposeFlags {
+	ptr := /* typedef */ (*ToolPurposeFlags)(&x.purposes)
+	return *ptr
+}
+
+// Description returns the value of description from VkPhysicalDeviceToolProperties
+// The slice references the array in x; it is not a copy.
+func (x *PhysicalDeviceToolProperties) Description() []byte {
+	ptr := func(x *[VK_MAX_DESCRIPTION_SIZE]C.char) *[]byte { /* Array for byte */
+		slc := unsafe.Slice((*byte)(unsafe.Pointer(x)), VK_MAX_DESCRIPTION_SIZE)
+		return &slc
+	}(&x.description)
+	return *ptr
+}
+
+// Layer returns the value of layer from VkPhysicalDeviceToolProperties
+// The slice references the array in x; it is not a copy.
+func (x *PhysicalDeviceToolProperties) Layer() []byte {
+	ptr := func(x *[VK_MAX_EXTENSION_NAME_SIZE]C.char) *[]byte { /* Array for byte */
+		slc := unsafe.Slice((*byte)(unsafe.Pointer(x)), VK_MAX_EXTENSION_NAME_SIZE)
+		return &slc
+	}(&x.layer)
+	return *ptr
+}
+
+// PipelineCreationFeedback provides a go interface for VkPipelineCreationFeedback.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPipelineCreationFeedback.html
+type PipelineCreationFeedback C.struct_VkPipelineCreationFeedback
+
+// SizeofPipelineCreationFeedback is the memory size of a PipelineCreationFeedback
+var SizeofPipelineCreationFeedback int = int(unsafe.Sizeof(PipelineCreationFeedback{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PipelineCreationFeedback) ArpPtr(arp *AutoReleasePool) *PipelineCreationFeedback {
+	ptr := newCBlock(cULong(SizeofPipelineCreationFeedback))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PipelineCreationFeedback)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PipelineCreationFeedback) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PipelineCreationFeedback) AsCPtr() *PipelineCreationFeedback {
+	clone := (*PipelineCreationFeedback)(newCBlock(cULong(SizeofPipelineCreationFeedback)))
+	*clone = x
+	return clone
+}
+
+// PipelineCreationFeedbackCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PipelineCreationFeedbackCSlice(arp *AutoReleasePool, x ...PipelineCreationFeedback) []PipelineCreationFeedback {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPipelineCreationFeedback * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PipelineCreationFeedback)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PipelineCreationFeedbackFreeCSlice releases the memory allocated by PipelineCreationFeedbackMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PipelineCreationFeedbackFreeCSlice(x []PipelineCreationFeedback) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PipelineCreationFeedbackMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PipelineCreationFeedbackFreeCSlice must be called on the returned slice.
+func PipelineCreationFeedbackMakeCSlice(x ...PipelineCreationFeedback) []PipelineCreationFeedback {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPipelineCreationFeedback * len(x)
+	dst := unsafe.Slice((*PipelineCreationFeedback)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// Flags returns the value of flags from VkPipelineCreationFeedback
+func (x PipelineCreationFeedback) Flags() PipelineCreationFeedbackFlags {
+	ptr := /* typedef */ (*PipelineCreationFeedbackFlags)(&x.flags)
+	return *ptr
+}
+
+// Duration returns the value of duration from VkPipelineCreationFeedback
+func (x PipelineCreationFeedback) Duration() uint64 {
+	ptr := func(x *C.uint64_t) *uint64 { /* Scalar */ c2g := uint64(*x); return &c2g }(&x.duration)
+	return *ptr
+}
+
+// PipelineCreationFeedbackCreateInfo provides a go interface for VkPipelineCreationFeedbackCreateInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPipelineCreationFeedbackCreateInfo.html
+type PipelineCreationFeedbackCreateInfo C.struct_VkPipelineCreationFeedbackCreateInfo
+
+// SizeofPipelineCreationFeedbackCreateInfo is the memory size of a PipelineCreationFeedbackCreateInfo
+var SizeofPipelineCreationFeedbackCreateInfo int = int(unsafe.Sizeof(PipelineCreationFeedbackCreateInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PipelineCreationFeedbackCreateInfo) ArpPtr(arp *AutoReleasePool) *PipelineCreationFeedbackCreateInfo {
+	ptr := newCBlock(cULong(SizeofPipelineCreationFeedbackCreateInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PipelineCreationFeedbackCreateInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PipelineCreationFeedbackCreateInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PipelineCreationFeedbackCreateInfo) AsCPtr() *PipelineCreationFeedbackCreateInfo {
+	clone := (*PipelineCreationFeedbackCreateInfo)(newCBlock(cULong(SizeofPipelineCreationFeedbackCreateInfo)))
+	*clone = x
+	return clone
+}
+
+// PipelineCreationFeedbackCreateInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PipelineCreationFeedbackCreateInfoCSlice(arp *AutoReleasePool, x ...PipelineCreationFeedbackCreateInfo) []PipelineCreationFeedbackCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPipelineCreationFeedbackCreateInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PipelineCreationFeedbackCreateInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PipelineCreationFeedbackCreateInfoFreeCSlice releases the memory allocated by PipelineCreationFeedbackCreateInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PipelineCreationFeedbackCreateInfoFreeCSlice(x []PipelineCreationFeedbackCreateInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PipelineCreationFeedbackCreateInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PipelineCreationFeedbackCreateInfoFreeCSlice must be called on the returned slice.
+func PipelineCreationFeedbackCreateInfoMakeCSlice(x ...PipelineCreationFeedbackCreateInfo) []PipelineCreationFeedbackCreateInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPipelineCreationFeedbackCreateInfo * len(x)
+	dst := unsafe.Slice((*PipelineCreationFeedbackCreateInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPipelineCreationFeedbackCreateInfo
+func (x PipelineCreationFeedbackCreateInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PipelineCreationFeedbackCreateInfo with the value of
+// SType to the value provided in the specification.
+func (x PipelineCreationFeedbackCreateInfo) WithDefaultSType() PipelineCreationFeedbackCreateInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PipelineCreationFeedbackCreateInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO)
+}
+
+// WithSType clones a new PipelineCreationFeedbackCreateInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PipelineCreationFeedbackCreateInfo) WithSType(y StructureType) PipelineCreationFeedbackCreateInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PipelineCreationFeedbackCreateInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPipelineCreationFeedbackCreateInfo
+func (x PipelineCreationFeedbackCreateInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PipelineCreationFeedbackCreateInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PipelineCreationFeedbackCreateInfo) WithPNext(y unsafe.Pointer) PipelineCreationFeedbackCreateInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PipelineCreationFeedbackCreateInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PipelineCreationFeedbackCreateInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// PPipelineCreationFeedback returns the value of pPipelineCreationFeedback from VkPipelineCreationFeedbackCreateInfo
+func (x PipelineCreationFeedbackCreateInfo) PPipelineCreationFeedback() *PipelineCreationFeedback {
+	ptr := func(x **C.struct_VkPipelineCreationFeedback) **PipelineCreationFeedback { /* Pointer */
+		c2g := (*PipelineCreationFeedback)(*x)
+		return &c2g
+	}(&x.pPipelineCreationFeedback)
+	return *ptr
+}
+
+// WithPPipelineCreationFeedback clones a new PipelineCreationFeedbackCreateInfo with the value of
+// PPipelineCreationFeedback updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PipelineCreationFeedbackCreateInfo) WithPPipelineCreationFeedback(y *PipelineCreationFeedback) PipelineCreationFeedbackCreateInfo {
+	x.pPipelineCreationFeedback = *(func(x **PipelineCreationFeedback) **C.struct_VkPipelineCreationFeedback { /* Pointer */
+		g2c := (*C.struct_VkPipelineCreationFeedback)(*x)
+		return &g2c
+	}(&y))
+	return x
+}
+func (x *PipelineCreationFeedbackCreateInfo) SetPPipelineCreationFeedback(y *PipelineCreationFeedback) {
+	x.pPipelineCreationFeedback = *(func(x **PipelineCreationFeedback) **C.struct_VkPipelineCreationFeedback { /* Pointer */
+		g2c := (*C.struct_VkPipelineCreationFeedback)(*x)
+		return &g2c
+	}(&y))
+}
+
+// PinPPipelineCreationFeedback pins the Go memory referenced by y with the AutoReleasePool
+// and sets PPipelineCreationFeedback, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PipelineCreationFeedbackCreateInfo) PinPPipelineCreationFeedback(arp *AutoReleasePool, y *PipelineCreationFeedback) {
+	arp.Pin(unsafe.Pointer(y))
+	x.SetPPipelineCreationFeedback(y)
+}
+
+// PipelineStageCreationFeedbackCount returns the value of pipelineStageCreationFeedbackCount from VkPipelineCreationFeedbackCreateInfo
+func (x PipelineCreationFeedbackCreateInfo) PipelineStageCreationFeedbackCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.pipelineStageCreationFeedbackCount)
+	return *ptr
+}
+
+// WithPipelineStageCreationFeedbackCount clones a new PipelineCreationFeedbackCreateInfo with the value of
+// PipelineStageCreationFeedbackCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PipelineCreationFeedbackCreateInfo) WithPipelineStageCreationFeedbackCount(y uint32) PipelineCreationFeedbackCreateInfo {
+	x.pipelineStageCreationFeedbackCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *PipelineCreationFeedbackCreateInfo) SetPipelineStageCreationFeedbackCount(y uint32) {
+	x.pipelineStageCreationFeedbackCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PPipelineStageCreationFeedbacks returns the value of pPipelineStageCreationFeedbacks from VkPipelineCreationFeedbackCreateInfo
+func (x PipelineCreationFeedbackCreateInfo) PPipelineStageCreationFeedbacks() []PipelineCreationFeedback {
+	if x.pPipelineStageCreationFeedbacks == nil {
+		return nil
+	}
+	return unsafe.Slice((*PipelineCreationFeedback)(unsafe.Pointer(x.pPipelineStageCreationFeedbacks)), x.pipelineStageCreationFeedbackCount)
+}
+
+// WithPPipelineStageCreationFeedbacks clones a new PipelineCreationFeedbackCreateInfo with the value of
+// PPipelineStageCreationFeedbacks updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines PipelineStageCreationFeedbackCount as the length of this field.
+// PipelineStageCreationFeedbackCount is updated with the length of the new value.
+func (x PipelineCreationFeedbackCreateInfo) WithPPipelineStageCreationFeedbacks(y []PipelineCreationFeedback) PipelineCreationFeedbackCreateInfo {
+	x.pPipelineStageCreationFeedbacks = *(func(x *[]PipelineCreationFeedback) **C.struct_VkPipelineCreationFeedback { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkPipelineCreationFeedback)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkPipelineCreationFeedback)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithPipelineStageCreationFeedbackCount(uint32(len(y)))
+}
+func (x *PipelineCreationFeedbackCreateInfo) SetPPipelineStageCreationFeedbacks(y []PipelineCreationFeedback) {
+	x.pPipelineStageCreationFeedbacks = *(func(x *[]PipelineCreationFeedback) **C.struct_VkPipelineCreationFeedback { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkPipelineCreationFeedback)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkPipelineCreationFeedback)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetPipelineStageCreationFeedbackCount(uint32(len(y)))
+}
+
+// PinPPipelineStageCreationFeedbacks pins the Go memory referenced by y with the AutoReleasePool
+// and sets PPipelineStageCreationFeedbacks, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PipelineCreationFeedbackCreateInfo) PinPPipelineStageCreationFeedbacks(arp *AutoReleasePool, y []PipelineCreationFeedback) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPPipelineStageCreationFeedbacks(y)
+}
+
+// PhysicalDeviceSubgroupSizeControlFeatures provides a go interface for VkPhysicalDeviceSubgroupSizeControlFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceSubgroupSizeControlFeatures.html
+type PhysicalDeviceSubgroupSizeControlFeatures C.struct_VkPhysicalDeviceSubgroupSizeControlFeatures
+
+// SizeofPhysicalDeviceSubgroupSizeControlFeatures is the memory size of a PhysicalDeviceSubgroupSizeControlFeatures
+var SizeofPhysicalDeviceSubgroupSizeControlFeatures int = int(unsafe.Sizeof(PhysicalDeviceSubgroupSizeControlFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceSubgroupSizeControlFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceSubgroupSizeControlFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceSubgroupSizeControlFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceSubgroupSizeControlFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceSubgroupSizeControlFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceSubgroupSizeControlFeatures) AsCPtr() *PhysicalDeviceSubgroupSizeControlFeatures {
+	clone := (*PhysicalDeviceSubgroupSizeControlFeatures)(newCBlock(cULong(SizeofPhysicalDeviceSubgroupSizeControlFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceSubgroupSizeControlFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceSubgroupSizeControlFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceSubgroupSizeControlFeatures) []PhysicalDeviceSubgroupSizeControlFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceSubgroupSizeControlFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceSubgroupSizeControlFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceSubgroupSizeControlFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceSubgroupSizeControlFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceSubgroupSizeControlFeaturesFreeCSlice(x []PhysicalDeviceSubgroupSizeControlFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceSubgroupSizeControlFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceSubgroupSizeControlFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceSubgroupSizeControlFeaturesMakeCSlice(x ...PhysicalDeviceSubgroupSizeControlFeatures) []PhysicalDeviceSubgroupSizeControlFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceSubgroupSizeControlFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceSubgroupSizeControlFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceSubgroupSizeControlFeatures
+func (x PhysicalDeviceSubgroupSizeControlFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceSubgroupSizeControlFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceSubgroupSizeControlFeatures) WithDefaultSType() PhysicalDeviceSubgroupSizeControlFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceSubgroupSizeControlFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceSubgroupSizeControlFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSubgroupSizeControlFeatures) WithSType(y StructureType) PhysicalDeviceSubgroupSizeControlFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceSubgroupSizeControlFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceSubgroupSizeControlFeatures
+func (x PhysicalDeviceSubgroupSizeControlFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceSubgroupSizeControlFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSubgroupSizeControlFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceSubgroupSizeControlFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceSubgroupSizeControlFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceSubgroupSizeControlFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SubgroupSizeControl returns the value of subgroupSizeControl from VkPhysicalDeviceSubgroupSizeControlFeatures
+func (x PhysicalDeviceSubgroupSizeControlFeatures) SubgroupSizeControl() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.subgroupSizeControl)
+	return *ptr
+}
+
+// WithSubgroupSizeControl clones a new PhysicalDeviceSubgroupSizeControlFeatures with the value of
+// SubgroupSizeControl updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSubgroupSizeControlFeatures) WithSubgroupSizeControl(y Bool32) PhysicalDeviceSubgroupSizeControlFeatures {
+	x.subgroupSizeControl = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceSubgroupSizeControlFeatures) SetSubgroupSizeControl(y Bool32) {
+	x.subgroupSizeControl = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// ComputeFullSubgroups returns the value of computeFullSubgroups from VkPhysicalDeviceSubgroupSizeControlFeatures
+func (x PhysicalDeviceSubgroupSizeControlFeatures) ComputeFullSubgroups() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.computeFullSubgroups)
+	return *ptr
+}
+
+// WithComputeFullSubgroups clones a new PhysicalDeviceSubgroupSizeControlFeatures with the value of
+// ComputeFullSubgroups updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSubgroupSizeControlFeatures) WithComputeFullSubgroups(y Bool32) PhysicalDeviceSubgroupSizeControlFeatures {
+	x.computeFullSubgroups = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceSubgroupSizeControlFeatures) SetComputeFullSubgroups(y Bool32) {
+	x.computeFullSubgroups = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PhysicalDeviceShaderTerminateInvocationFeatures provides a go interface for VkPhysicalDeviceShaderTerminateInvocationFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceShaderTerminateInvocationFeatures.html
+type PhysicalDeviceShaderTerminateInvocationFeatures C.struct_VkPhysicalDeviceShaderTerminateInvocationFeatures
+
+// SizeofPhysicalDeviceShaderTerminateInvocationFeatures is the memory size of a PhysicalDeviceShaderTerminateInvocationFeatures
+var SizeofPhysicalDeviceShaderTerminateInvocationFeatures int = int(unsafe.Sizeof(PhysicalDeviceShaderTerminateInvocationFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceShaderTerminateInvocationFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceShaderTerminateInvocationFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceShaderTerminateInvocationFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceShaderTerminateInvocationFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceShaderTerminateInvocationFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceShaderTerminateInvocationFeatures) AsCPtr() *PhysicalDeviceShaderTerminateInvocationFeatures {
+	clone := (*PhysicalDeviceShaderTerminateInvocationFeatures)(newCBlock(cULong(SizeofPhysicalDeviceShaderTerminateInvocationFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceShaderTerminateInvocationFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceShaderTerminateInvocationFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceShaderTerminateInvocationFeatures) []PhysicalDeviceShaderTerminateInvocationFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceShaderTerminateInvocationFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceShaderTerminateInvocationFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceShaderTerminateInvocationFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceShaderTerminateInvocationFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceShaderTerminateInvocationFeaturesFreeCSlice(x []PhysicalDeviceShaderTerminateInvocationFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceShaderTerminateInvocationFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceShaderTerminateInvocationFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceShaderTerminateInvocationFeaturesMakeCSlice(x ...PhysicalDeviceShaderTerminateInvocationFeatures) []PhysicalDeviceShaderTerminateInvocationFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceShaderTerminateInvocationFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceShaderTerminateInvocationFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceShaderTerminateInvocationFeatures
+func (x PhysicalDeviceShaderTerminateInvocationFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceShaderTerminateInvocationFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceShaderTerminateInvocationFeatures) WithDefaultSType() PhysicalDeviceShaderTerminateInvocationFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TERMINATE_INVOCATION_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceShaderTerminateInvocationFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TERMINATE_INVOCATION_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceShaderTerminateInvocationFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderTerminateInvocationFeatures) WithSType(y StructureType) PhysicalDeviceShaderTerminateInvocationFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderTerminateInvocationFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceShaderTerminateInvocationFeatures
+func (x PhysicalDeviceShaderTerminateInvocationFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceShaderTerminateInvocationFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderTerminateInvocationFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceShaderTerminateInvocationFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderTerminateInvocationFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceShaderTerminateInvocationFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ShaderTerminateInvocation returns the value of shaderTerminateInvocation from VkPhysicalDeviceShaderTerminateInvocationFeatures
+func (x PhysicalDeviceShaderTerminateInvocationFeatures) ShaderTerminateInvocation() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderTerminateInvocation)
+	return *ptr
+}
+
+// WithShaderTerminateInvocation clones a new PhysicalDeviceShaderTerminateInvocationFeatures with the value of
+// ShaderTerminateInvocation updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceShaderTerminateInvocationFeatures) WithShaderTerminateInvocation(y Bool32) PhysicalDeviceShaderTerminateInvocationFeatures {
+	x.shaderTerminateInvocation = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceShaderTerminateInvocationFeatures) SetShaderTerminateInvocation(y Bool32) {
+	x.shaderTerminateInvocation = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// MemoryBarrier2 provides a go interface for VkMemoryBarrier2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkMemoryBarrier2.html
+type MemoryBarrier2 C.struct_VkMemoryBarrier2
+
+// SizeofMemoryBarrier2 is the memory size of a MemoryBarrier2
+var SizeofMemoryBarrier2 int = int(unsafe.Sizeof(MemoryBarrier2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x MemoryBarrier2) ArpPtr(arp *AutoReleasePool) *MemoryBarrier2 {
+	ptr := newCBlock(cULong(SizeofMemoryBarrier2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*MemoryBarrier2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *MemoryBarrier2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x MemoryBarrier2) AsCPtr() *MemoryBarrier2 {
+	clone := (*MemoryBarrier2)(newCBlock(cULong(SizeofMemoryBarrier2)))
+	*clone = x
+	return clone
+}
+
+// MemoryBarrier2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func MemoryBarrier2CSlice(arp *AutoReleasePool, x ...MemoryBarrier2) []MemoryBarrier2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofMemoryBarrier2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*MemoryBarrier2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// MemoryBarrier2FreeCSlice releases the memory allocated by MemoryBarrier2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func MemoryBarrier2FreeCSlice(x []MemoryBarrier2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// MemoryBarrier2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. MemoryBarrier2FreeCSlice must be called on the returned slice.
+func MemoryBarrier2MakeCSlice(x ...MemoryBarrier2) []MemoryBarrier2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofMemoryBarrier2 * len(x)
+	dst := unsafe.Slice((*MemoryBarrier2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkMemoryBarrier2
+func (x MemoryBarrier2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new MemoryBarrier2 with the value of
+// SType to the value provided in the specification.
+func (x MemoryBarrier2) WithDefaultSType() MemoryBarrier2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_MEMORY_BARRIER_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *MemoryBarrier2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_MEMORY_BARRIER_2)
+}
+
+// WithSType clones a new MemoryBarrier2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryBarrier2) WithSType(y StructureType) MemoryBarrier2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *MemoryBarrier2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkMemoryBarrier2
+func (x MemoryBarrier2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new MemoryBarrier2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryBarrier2) WithPNext(y unsafe.Pointer) MemoryBarrier2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *MemoryBarrier2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *MemoryBarrier2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SrcStageMask returns the value of srcStageMask from VkMemoryBarrier2
+func (x MemoryBarrier2) SrcStageMask() PipelineStageFlags2 {
+	ptr := /* typedef */ (*PipelineStageFlags2)(&x.srcStageMask)
+	return *ptr
+}
+
+// WithSrcStageMask clones a new MemoryBarrier2 with the value of
+// SrcStageMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryBarrier2) WithSrcStageMask(y PipelineStageFlags2) MemoryBarrier2 {
+	x.srcStageMask = *( /* typedef */ (*C.VkPipelineStageFlags2)(&y))
+	return x
+}
+func (x *MemoryBarrier2) SetSrcStageMask(y PipelineStageFlags2) {
+	x.srcStageMask = *( /* typedef */ (*C.VkPipelineStageFlags2)(&y))
+}
+
+// SrcAccessMask returns the value of srcAccessMask from VkMemoryBarrier2
+func (x MemoryBarrier2) SrcAccessMask() AccessFlags2 {
+	ptr := /* typedef */ (*AccessFlags2)(&x.srcAccessMask)
+	return *ptr
+}
+
+// WithSrcAccessMask clones a new MemoryBarrier2 with the value of
+// SrcAccessMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryBarrier2) WithSrcAccessMask(y AccessFlags2) MemoryBarrier2 {
+	x.srcAccessMask = *( /* typedef */ (*C.VkAccessFlags2)(&y))
+	return x
+}
+func (x *MemoryBarrier2) SetSrcAccessMask(y AccessFlags2) {
+	x.srcAccessMask = *( /* typedef */ (*C.VkAccessFlags2)(&y))
+}
+
+// DstStageMask returns the value of dstStageMask from VkMemoryBarrier2
+func (x MemoryBarrier2) DstStageMask() PipelineStageFlags2 {
+	ptr := /* typedef */ (*PipelineStageFlags2)(&x.dstStageMask)
+	return *ptr
+}
+
+// WithDstStageMask clones a new MemoryBarrier2 with the value of
+// DstStageMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryBarrier2) WithDstStageMask(y PipelineStageFlags2) MemoryBarrier2 {
+	x.dstStageMask = *( /* typedef */ (*C.VkPipelineStageFlags2)(&y))
+	return x
+}
+func (x *MemoryBarrier2) SetDstStageMask(y PipelineStageFlags2) {
+	x.dstStageMask = *( /* typedef */ (*C.VkPipelineStageFlags2)(&y))
+}
+
+// DstAccessMask returns the value of dstAccessMask from VkMemoryBarrier2
+func (x MemoryBarrier2) DstAccessMask() AccessFlags2 {
+	ptr := /* typedef */ (*AccessFlags2)(&x.dstAccessMask)
+	return *ptr
+}
+
+// WithDstAccessMask clones a new MemoryBarrier2 with the value of
+// DstAccessMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x MemoryBarrier2) WithDstAccessMask(y AccessFlags2) MemoryBarrier2 {
+	x.dstAccessMask = *( /* typedef */ (*C.VkAccessFlags2)(&y))
+	return x
+}
+func (x *MemoryBarrier2) SetDstAccessMask(y AccessFlags2) {
+	x.dstAccessMask = *( /* typedef */ (*C.VkAccessFlags2)(&y))
+}
+
+// BufferMemoryBarrier2 provides a go interface for VkBufferMemoryBarrier2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkBufferMemoryBarrier2.html
+type BufferMemoryBarrier2 C.struct_VkBufferMemoryBarrier2
+
+// SizeofBufferMemoryBarrier2 is the memory size of a BufferMemoryBarrier2
+var SizeofBufferMemoryBarrier2 int = int(unsafe.Sizeof(BufferMemoryBarrier2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x BufferMemoryBarrier2) ArpPtr(arp *AutoReleasePool) *BufferMemoryBarrier2 {
+	ptr := newCBlock(cULong(SizeofBufferMemoryBarrier2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*BufferMemoryBarrier2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *BufferMemoryBarrier2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x BufferMemoryBarrier2) AsCPtr() *BufferMemoryBarrier2 {
+	clone := (*BufferMemoryBarrier2)(newCBlock(cULong(SizeofBufferMemoryBarrier2)))
+	*clone = x
+	return clone
+}
+
+// BufferMemoryBarrier2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func BufferMemoryBarrier2CSlice(arp *AutoReleasePool, x ...BufferMemoryBarrier2) []BufferMemoryBarrier2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBufferMemoryBarrier2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*BufferMemoryBarrier2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// BufferMemoryBarrier2FreeCSlice releases the memory allocated by BufferMemoryBarrier2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func BufferMemoryBarrier2FreeCSlice(x []BufferMemoryBarrier2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// BufferMemoryBarrier2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. BufferMemoryBarrier2FreeCSlice must be called on the returned slice.
+func BufferMemoryBarrier2MakeCSlice(x ...BufferMemoryBarrier2) []BufferMemoryBarrier2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBufferMemoryBarrier2 * len(x)
+	dst := unsafe.Slice((*BufferMemoryBarrier2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkBufferMemoryBarrier2
+func (x *BufferMemoryBarrier2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new BufferMemoryBarrier2 with the value of
+// SType to the value provided in the specification.
+func (x BufferMemoryBarrier2) WithDefaultSType() BufferMemoryBarrier2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *BufferMemoryBarrier2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2)
+}
+
+// WithSType clones a new BufferMemoryBarrier2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferMemoryBarrier2) WithSType(y StructureType) BufferMemoryBarrier2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *BufferMemoryBarrier2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkBufferMemoryBarrier2
+func (x *BufferMemoryBarrier2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new BufferMemoryBarrier2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferMemoryBarrier2) WithPNext(y unsafe.Pointer) BufferMemoryBarrier2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *BufferMemoryBarrier2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *BufferMemoryBarrier2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SrcStageMask returns the value of srcStageMask from VkBufferMemoryBarrier2
+func (x *BufferMemoryBarrier2) SrcStageMask() PipelineStageFlags2 {
+	ptr := /* typedef */ (*PipelineStageFlags2)(&x.srcStageMask)
+	return *ptr
+}
+
+// WithSrcStageMask clones a new BufferMemoryBarrier2 with the value of
+// SrcStageMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferMemoryBarrier2) WithSrcStageMask(y PipelineStageFlags2) BufferMemoryBarrier2 {
+	x.srcStageMask = *( /* typedef */ (*C.VkPipelineStageFlags2)(&y))
+	return x
+}
+func (x *BufferMemoryBarrier2) SetSrcStageMask(y PipelineStageFlags2) {
+	x.srcStageMask = *( /* typedef */ (*C.VkPipelineStageFlags2)(&y))
+}
+
+// SrcAccessMask returns the value of srcAccessMask from VkBufferMemoryBarrier2
+func (x *BufferMemoryBarrier2) SrcAccessMask() AccessFlags2 {
+	ptr := /* typedef */ (*AccessFlags2)(&x.srcAccessMask)
+	return *ptr
+}
+
+// WithSrcAccessMask clones a new BufferMemoryBarrier2 with the value of
+// SrcAccessMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferMemoryBarrier2) WithSrcAccessMask(y AccessFlags2) BufferMemoryBarrier2 {
+	x.srcAccessMask = *( /* typedef */ (*C.VkAccessFlags2)(&y))
+	return x
+}
+func (x *BufferMemoryBarrier2) SetSrcAccessMask(y AccessFlags2) {
+	x.srcAccessMask = *( /* typedef */ (*C.VkAccessFlags2)(&y))
+}
+
+// DstStageMask returns the value of dstStageMask from VkBufferMemoryBarrier2
+func (x *BufferMemoryBarrier2) DstStageMask() PipelineStageFlags2 {
+	ptr := /* typedef */ (*PipelineStageFlags2)(&x.dstStageMask)
+	return *ptr
+}
+
+// WithDstStageMask clones a new BufferMemoryBarrier2 with the value of
+// DstStageMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferMemoryBarrier2) WithDstStageMask(y PipelineStageFlags2) BufferMemoryBarrier2 {
+	x.dstStageMask = *( /* typedef */ (*C.VkPipelineStageFlags2)(&y))
+	return x
+}
+func (x *BufferMemoryBarrier2) SetDstStageMask(y PipelineStageFlags2) {
+	x.dstStageMask = *( /* typedef */ (*C.VkPipelineStageFlags2)(&y))
+}
+
+// DstAccessMask returns the value of dstAccessMask from VkBufferMemoryBarrier2
+func (x *BufferMemoryBarrier2) DstAccessMask() AccessFlags2 {
+	ptr := /* typedef */ (*AccessFlags2)(&x.dstAccessMask)
+	return *ptr
+}
+
+// WithDstAccessMask clones a new BufferMemoryBarrier2 with the value of
+// DstAccessMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferMemoryBarrier2) WithDstAccessMask(y AccessFlags2) BufferMemoryBarrier2 {
+	x.dstAccessMask = *( /* typedef */ (*C.VkAccessFlags2)(&y))
+	return x
+}
+func (x *BufferMemoryBarrier2) SetDstAccessMask(y AccessFlags2) {
+	x.dstAccessMask = *( /* typedef */ (*C.VkAccessFlags2)(&y))
+}
+
+// SrcQueueFamilyIndex returns the value of srcQueueFamilyIndex from VkBufferMemoryBarrier2
+func (x *BufferMemoryBarrier2) SrcQueueFamilyIndex() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.srcQueueFamilyIndex)
+	return *ptr
+}
+
+// WithSrcQueueFamilyIndex clones a new BufferMemoryBarrier2 with the value of
+// SrcQueueFamilyIndex updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferMemoryBarrier2) WithSrcQueueFamilyIndex(y uint32) BufferMemoryBarrier2 {
+	x.srcQueueFamilyIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *BufferMemoryBarrier2) SetSrcQueueFamilyIndex(y uint32) {
+	x.srcQueueFamilyIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// DstQueueFamilyIndex returns the value of dstQueueFamilyIndex from VkBufferMemoryBarrier2
+func (x *BufferMemoryBarrier2) DstQueueFamilyIndex() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.dstQueueFamilyIndex)
+	return *ptr
+}
+
+// WithDstQueueFamilyIndex clones a new BufferMemoryBarrier2 with the value of
+// DstQueueFamilyIndex updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferMemoryBarrier2) WithDstQueueFamilyIndex(y uint32) BufferMemoryBarrier2 {
+	x.dstQueueFamilyIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *BufferMemoryBarrier2) SetDstQueueFamilyIndex(y uint32) {
+	x.dstQueueFamilyIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// Buffer returns the value of buffer from VkBufferMemoryBarrier2
+func (x *BufferMemoryBarrier2) Buffer() Buffer {
+	ptr := /* handle */ (*Buffer)(&x.buffer)
+	return *ptr
+}
+
+// WithBuffer clones a new BufferMemoryBarrier2 with the value of
+// Buffer updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferMemoryBarrier2) WithBuffer(y Buffer) BufferMemoryBarrier2 {
+	x.buffer = *( /* handle */ (*C.VkBuffer)(&y))
+	return x
+}
+func (x *BufferMemoryBarrier2) SetBuffer(y Buffer) {
+	x.buffer = *( /* handle */ (*C.VkBuffer)(&y))
+}
+
+// Offset returns the value of offset from VkBufferMemoryBarrier2
+func (x *BufferMemoryBarrier2) Offset() DeviceSize {
+	ptr := /* typedef */ (*DeviceSize)(&x.offset)
+	return *ptr
+}
+
+// WithOffset clones a new BufferMemoryBarrier2 with the value of
+// Offset updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferMemoryBarrier2) WithOffset(y DeviceSize) BufferMemoryBarrier2 {
+	x.offset = *( /* typedef */ (*C.VkDeviceSize)(&y))
+	return x
+}
+func (x *BufferMemoryBarrier2) SetOffset(y DeviceSize) {
+	x.offset = *( /* typedef */ (*C.VkDeviceSize)(&y))
+}
+
+// Size returns the value of size from VkBufferMemoryBarrier2
+func (x *BufferMemoryBarrier2) Size() DeviceSize {
+	ptr := /* typedef */ (*DeviceSize)(&x.size)
+	return *ptr
+}
+
+// WithSize clones a new BufferMemoryBarrier2 with the value of
+// Size updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferMemoryBarrier2) WithSize(y DeviceSize) BufferMemoryBarrier2 {
+	x.size = *( /* typedef */ (*C.VkDeviceSize)(&y))
+	return x
+}
+func (x *BufferMemoryBarrier2) SetSize(y DeviceSize) {
+	x.size = *( /* typedef */ (*C.VkDeviceSize)(&y))
+}
+
+// ImageMemoryBarrier2 provides a go interface for VkImageMemoryBarrier2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkImageMemoryBarrier2.html
+type ImageMemoryBarrier2 C.struct_VkImageMemoryBarrier2
+
+// SizeofImageMemoryBarrier2 is the memory size of a ImageMemoryBarrier2
+var SizeofImageMemoryBarrier2 int = int(unsafe.Sizeof(ImageMemoryBarrier2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ImageMemoryBarrier2) ArpPtr(arp *AutoReleasePool) *ImageMemoryBarrier2 {
+	ptr := newCBlock(cULong(SizeofImageMemoryBarrier2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ImageMemoryBarrier2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ImageMemoryBarrier2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ImageMemoryBarrier2) AsCPtr() *ImageMemoryBarrier2 {
+	clone := (*ImageMemoryBarrier2)(newCBlock(cULong(SizeofImageMemoryBarrier2)))
+	*clone = x
+	return clone
+}
+
+// ImageMemoryBarrier2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ImageMemoryBarrier2CSlice(arp *AutoReleasePool, x ...ImageMemoryBarrier2) []ImageMemoryBarrier2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImageMemoryBarrier2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ImageMemoryBarrier2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ImageMemoryBarrier2FreeCSlice releases the memory allocated by ImageMemoryBarrier2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func ImageMemoryBarrier2FreeCSlice(x []ImageMemoryBarrier2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ImageMemoryBarrier2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ImageMemoryBarrier2FreeCSlice must be called on the returned slice.
+func ImageMemoryBarrier2MakeCSlice(x ...ImageMemoryBarrier2) []ImageMemoryBarrier2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImageMemoryBarrier2 * len(x)
+	dst := unsafe.Slice((*ImageMemoryBarrier2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkImageMemoryBarrier2
+func (x *ImageMemoryBarrier2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ImageMemoryBarrier2 with the value of
+// SType to the value provided in the specification.
+func (x ImageMemoryBarrier2) WithDefaultSType() ImageMemoryBarrier2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ImageMemoryBarrier2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2)
+}
+
+// WithSType clones a new ImageMemoryBarrier2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageMemoryBarrier2) WithSType(y StructureType) ImageMemoryBarrier2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ImageMemoryBarrier2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkImageMemoryBarrier2
+func (x *ImageMemoryBarrier2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ImageMemoryBarrier2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageMemoryBarrier2) WithPNext(y unsafe.Pointer) ImageMemoryBarrier2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ImageMemoryBarrier2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ImageMemoryBarrier2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SrcStageMask returns the value of srcStageMask from VkImageMemoryBarrier2
+func (x *ImageMemoryBarrier2) SrcStageMask() PipelineStageFlags2 {
+	ptr := /* typedef */ (*PipelineStageFlags2)(&x.srcStageMask)
+	return *ptr
+}
+
+// WithSrcStageMask clones a new ImageMemoryBarrier2 with the value of
+// SrcStageMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageMemoryBarrier2) WithSrcStageMask(y PipelineStageFlags2) ImageMemoryBarrier2 {
+	x.srcStageMask = *( /* typedef */ (*C.VkPipelineStageFlags2)(&y))
+	return x
+}
+func (x *ImageMemoryBarrier2) SetSrcStageMask(y PipelineStageFlags2) {
+	x.srcStageMask = *( /* typedef */ (*C.VkPipelineStageFlags2)(&y))
+}
+
+// SrcAccessMask returns the value of srcAccessMask from VkImageMemoryBarrier2
+func (x *ImageMemoryBarrier2) SrcAccessMask() AccessFlags2 {
+	ptr := /* typedef */ (*AccessFlags2)(&x.srcAccessMask)
+	return *ptr
+}
+
+// WithSrcAccessMask clones a new ImageMemoryBarrier2 with the value of
+// SrcAccessMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageMemoryBarrier2) WithSrcAccessMask(y AccessFlags2) ImageMemoryBarrier2 {
+	x.srcAccessMask = *( /* typedef */ (*C.VkAccessFlags2)(&y))
+	return x
+}
+func (x *ImageMemoryBarrier2) SetSrcAccessMask(y AccessFlags2) {
+	x.srcAccessMask = *( /* typedef */ (*C.VkAccessFlags2)(&y))
+}
+
+// DstStageMask returns the value of dstStageMask from VkImageMemoryBarrier2
+func (x *ImageMemoryBarrier2) DstStageMask() PipelineStageFlags2 {
+	ptr := /* typedef */ (*PipelineStageFlags2)(&x.dstStageMask)
+	return *ptr
+}
+
+// WithDstStageMask clones a new ImageMemoryBarrier2 with the value of
+// DstStageMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageMemoryBarrier2) WithDstStageMask(y PipelineStageFlags2) ImageMemoryBarrier2 {
+	x.dstStageMask = *( /* typedef */ (*C.VkPipelineStageFlags2)(&y))
+	return x
+}
+func (x *ImageMemoryBarrier2) SetDstStageMask(y PipelineStageFlags2) {
+	x.dstStageMask = *( /* typedef */ (*C.VkPipelineStageFlags2)(&y))
+}
+
+// DstAccessMask returns the value of dstAccessMask from VkImageMemoryBarrier2
+func (x *ImageMemoryBarrier2) DstAccessMask() AccessFlags2 {
+	ptr := /* typedef */ (*AccessFlags2)(&x.dstAccessMask)
+	return *ptr
+}
+
+// WithDstAccessMask clones a new ImageMemoryBarrier2 with the value of
+// DstAccessMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageMemoryBarrier2) WithDstAccessMask(y AccessFlags2) ImageMemoryBarrier2 {
+	x.dstAccessMask = *( /* typedef */ (*C.VkAccessFlags2)(&y))
+	return x
+}
+func (x *ImageMemoryBarrier2) SetDstAccessMask(y AccessFlags2) {
+	x.dstAccessMask = *( /* typedef */ (*C.VkAccessFlags2)(&y))
+}
+
+// OldLayout returns the value of oldLayout from VkImageMemoryBarrier2
+func (x *ImageMemoryBarrier2) OldLayout() ImageLayout {
+	ptr := /* typedef */ (*ImageLayout)(&x.oldLayout)
+	return *ptr
+}
+
+// WithOldLayout clones a new ImageMemoryBarrier2 with the value of
+// OldLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageMemoryBarrier2) WithOldLayout(y ImageLayout) ImageMemoryBarrier2 {
+	x.oldLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+	return x
+}
+func (x *ImageMemoryBarrier2) SetOldLayout(y ImageLayout) {
+	x.oldLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+}
+
+// NewLayout returns the value of newLayout from VkImageMemoryBarrier2
+func (x *ImageMemoryBarrier2) NewLayout() ImageLayout {
+	ptr := /* typedef */ (*ImageLayout)(&x.newLayout)
+	return *ptr
+}
+
+// WithNewLayout clones a new ImageMemoryBarrier2 with the value of
+// NewLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageMemoryBarrier2) WithNewLayout(y ImageLayout) ImageMemoryBarrier2 {
+	x.newLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+	return x
+}
+func (x *ImageMemoryBarrier2) SetNewLayout(y ImageLayout) {
+	x.newLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+}
+
+// SrcQueueFamilyIndex returns the value of srcQueueFamilyIndex from VkImageMemoryBarrier2
+func (x *ImageMemoryBarrier2) SrcQueueFamilyIndex() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.srcQueueFamilyIndex)
+	return *ptr
+}
+
+// WithSrcQueueFamilyIndex clones a new ImageMemoryBarrier2 with the value of
+// SrcQueueFamilyIndex updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageMemoryBarrier2) WithSrcQueueFamilyIndex(y uint32) ImageMemoryBarrier2 {
+	x.srcQueueFamilyIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *ImageMemoryBarrier2) SetSrcQueueFamilyIndex(y uint32) {
+	x.srcQueueFamilyIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// DstQueueFamilyIndex returns the value of dstQueueFamilyIndex from VkImageMemoryBarrier2
+func (x *ImageMemoryBarrier2) DstQueueFamilyIndex() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.dstQueueFamilyIndex)
+	return *ptr
+}
+
+// WithDstQueueFamilyIndex clones a new ImageMemoryBarrier2 with the value of
+// DstQueueFamilyIndex updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageMemoryBarrier2) WithDstQueueFamilyIndex(y uint32) ImageMemoryBarrier2 {
+	x.dstQueueFamilyIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *ImageMemoryBarrier2) SetDstQueueFamilyIndex(y uint32) {
+	x.dstQueueFamilyIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// Image returns the value of image from VkImageMemoryBarrier2
+func (x *ImageMemoryBarrier2) Image() Image {
+	ptr := /* handle */ (*Image)(&x.image)
+	return *ptr
+}
+
+// WithImage clones a new ImageMemoryBarrier2 with the value of
+// Image updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageMemoryBarrier2) WithImage(y Image) ImageMemoryBarrier2 {
+	x.image = *( /* handle */ (*C.VkImage)(&y))
+	return x
+}
+func (x *ImageMemoryBarrier2) SetImage(y Image) {
+	x.image = *( /* handle */ (*C.VkImage)(&y))
+}
+
+// SubresourceRange returns the value of subresourceRange from VkImageMemoryBarrier2
+func (x *ImageMemoryBarrier2) SubresourceRange() ImageSubresourceRange {
+	ptr := /* typedef */ (*ImageSubresourceRange)(&x.subresourceRange)
+	return *ptr
+}
+
+// WithSubresourceRange clones a new ImageMemoryBarrier2 with the value of
+// SubresourceRange updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageMemoryBarrier2) WithSubresourceRange(y ImageSubresourceRange) ImageMemoryBarrier2 {
+	x.subresourceRange = *( /* typedef */ (*C.struct_VkImageSubresourceRange)(&y))
+	return x
+}
+func (x *ImageMemoryBarrier2) SetSubresourceRange(y ImageSubresourceRange) {
+	x.subresourceRange = *( /* typedef */ (*C.struct_VkImageSubresourceRange)(&y))
+}
+
+// DependencyInfo provides a go interface for VkDependencyInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkDependencyInfo.html
+type DependencyInfo C.struct_VkDependencyInfo
+
+// SizeofDependencyInfo is the memory size of a DependencyInfo
+var SizeofDependencyInfo int = int(unsafe.Sizeof(DependencyInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x DependencyInfo) ArpPtr(arp *AutoReleasePool) *DependencyInfo {
+	ptr := newCBlock(cULong(SizeofDependencyInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*DependencyInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *DependencyInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x DependencyInfo) AsCPtr() *DependencyInfo {
+	clone := (*DependencyInfo)(newCBlock(cULong(SizeofDependencyInfo)))
+	*clone = x
+	return clone
+}
+
+// DependencyInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func DependencyInfoCSlice(arp *AutoReleasePool, x ...DependencyInfo) []DependencyInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDependencyInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*DependencyInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// DependencyInfoFreeCSlice releases the memory allocated by DependencyInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func DependencyInfoFreeCSlice(x []DependencyInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// DependencyInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. DependencyInfoFreeCSlice must be called on the returned slice.
+func DependencyInfoMakeCSlice(x ...DependencyInfo) []DependencyInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofDependencyInfo * len(x)
+	dst := unsafe.Slice((*DependencyInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkDependencyInfo
+func (x DependencyInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new DependencyInfo with the value of
+// SType to the value provided in the specification.
+func (x DependencyInfo) WithDefaultSType() DependencyInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_DEPENDENCY_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *DependencyInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_DEPENDENCY_INFO)
+}
+
+// WithSType clones a new DependencyInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DependencyInfo) WithSType(y StructureType) DependencyInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *DependencyInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkDependencyInfo
+func (x DependencyInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new DependencyInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DependencyInfo) WithPNext(y unsafe.Pointer) DependencyInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *DependencyInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DependencyInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// DependencyFlags returns the value of dependencyFlags from VkDependencyInfo
+func (x DependencyInfo) DependencyFlags() DependencyFlags {
+	ptr := /* typedef */ (*DependencyFlags)(&x.dependencyFlags)
+	return *ptr
+}
+
+// WithDependencyFlags clones a new DependencyInfo with the value of
+// DependencyFlags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DependencyInfo) WithDependencyFlags(y DependencyFlags) DependencyInfo {
+	x.dependencyFlags = *( /* typedef */ (*C.VkDependencyFlags)(&y))
+	return x
+}
+func (x *DependencyInfo) SetDependencyFlags(y DependencyFlags) {
+	x.dependencyFlags = *( /* typedef */ (*C.VkDependencyFlags)(&y))
+}
+
+// MemoryBarrierCount returns the value of memoryBarrierCount from VkDependencyInfo
+func (x DependencyInfo) MemoryBarrierCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.memoryBarrierCount)
+	return *ptr
+}
+
+// WithMemoryBarrierCount clones a new DependencyInfo with the value of
+// MemoryBarrierCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DependencyInfo) WithMemoryBarrierCount(y uint32) DependencyInfo {
+	x.memoryBarrierCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DependencyInfo) SetMemoryBarrierCount(y uint32) {
+	x.memoryBarrierCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PMemoryBarriers returns the value of pMemoryBarriers from VkDependencyInfo
+func (x DependencyInfo) PMemoryBarriers() []MemoryBarrier2 {
+	if x.pMemoryBarriers == nil {
+		return nil
+	}
+	return unsafe.Slice((*MemoryBarrier2)(unsafe.Pointer(x.pMemoryBarriers)), x.memoryBarrierCount)
+}
+
+// WithPMemoryBarriers clones a new DependencyInfo with the value of
+// PMemoryBarriers updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines MemoryBarrierCount as the length of this field.
+// MemoryBarrierCount is updated with the length of the new value.
+func (x DependencyInfo) WithPMemoryBarriers(y []MemoryBarrier2) DependencyInfo {
+	x.pMemoryBarriers = *(func(x *[]MemoryBarrier2) **C.struct_VkMemoryBarrier2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkMemoryBarrier2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkMemoryBarrier2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithMemoryBarrierCount(uint32(len(y)))
+}
+func (x *DependencyInfo) SetPMemoryBarriers(y []MemoryBarrier2) {
+	x.pMemoryBarriers = *(func(x *[]MemoryBarrier2) **C.struct_VkMemoryBarrier2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkMemoryBarrier2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkMemoryBarrier2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetMemoryBarrierCount(uint32(len(y)))
+}
+
+// PinPMemoryBarriers pins the Go memory referenced by y with the AutoReleasePool
+// and sets PMemoryBarriers, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DependencyInfo) PinPMemoryBarriers(arp *AutoReleasePool, y []MemoryBarrier2) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPMemoryBarriers(y)
+}
+
+// BufferMemoryBarrierCount returns the value of bufferMemoryBarrierCount from VkDependencyInfo
+func (x DependencyInfo) BufferMemoryBarrierCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.bufferMemoryBarrierCount)
+	return *ptr
+}
+
+// WithBufferMemoryBarrierCount clones a new DependencyInfo with the value of
+// BufferMemoryBarrierCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DependencyInfo) WithBufferMemoryBarrierCount(y uint32) DependencyInfo {
+	x.bufferMemoryBarrierCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DependencyInfo) SetBufferMemoryBarrierCount(y uint32) {
+	x.bufferMemoryBarrierCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PBufferMemoryBarriers returns the value of pBufferMemoryBarriers from VkDependencyInfo
+func (x DependencyInfo) PBufferMemoryBarriers() []BufferMemoryBarrier2 {
+	if x.pBufferMemoryBarriers == nil {
+		return nil
+	}
+	return unsafe.Slice((*BufferMemoryBarrier2)(unsafe.Pointer(x.pBufferMemoryBarriers)), x.bufferMemoryBarrierCount)
+}
+
+// WithPBufferMemoryBarriers clones a new DependencyInfo with the value of
+// PBufferMemoryBarriers updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines BufferMemoryBarrierCount as the length of this field.
+// BufferMemoryBarrierCount is updated with the length of the new value.
+func (x DependencyInfo) WithPBufferMemoryBarriers(y []BufferMemoryBarrier2) DependencyInfo {
+	x.pBufferMemoryBarriers = *(func(x *[]BufferMemoryBarrier2) **C.struct_VkBufferMemoryBarrier2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkBufferMemoryBarrier2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkBufferMemoryBarrier2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithBufferMemoryBarrierCount(uint32(len(y)))
+}
+func (x *DependencyInfo) SetPBufferMemoryBarriers(y []BufferMemoryBarrier2) {
+	x.pBufferMemoryBarriers = *(func(x *[]BufferMemoryBarrier2) **C.struct_VkBufferMemoryBarrier2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkBufferMemoryBarrier2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkBufferMemoryBarrier2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetBufferMemoryBarrierCount(uint32(len(y)))
+}
+
+// PinPBufferMemoryBarriers pins the Go memory referenced by y with the AutoReleasePool
+// and sets PBufferMemoryBarriers, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DependencyInfo) PinPBufferMemoryBarriers(arp *AutoReleasePool, y []BufferMemoryBarrier2) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPBufferMemoryBarriers(y)
+}
+
+// ImageMemoryBarrierCount returns the value of imageMemoryBarrierCount from VkDependencyInfo
+func (x DependencyInfo) ImageMemoryBarrierCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.imageMemoryBarrierCount)
+	return *ptr
+}
+
+// WithImageMemoryBarrierCount clones a new DependencyInfo with the value of
+// ImageMemoryBarrierCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x DependencyInfo) WithImageMemoryBarrierCount(y uint32) DependencyInfo {
+	x.imageMemoryBarrierCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *DependencyInfo) SetImageMemoryBarrierCount(y uint32) {
+	x.imageMemoryBarrierCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PImageMemoryBarriers returns the value of pImageMemoryBarriers from VkDependencyInfo
+func (x DependencyInfo) PImageMemoryBarriers() []ImageMemoryBarrier2 {
+	if x.pImageMemoryBarriers == nil {
+		return nil
+	}
+	return unsafe.Slice((*ImageMemoryBarrier2)(unsafe.Pointer(x.pImageMemoryBarriers)), x.imageMemoryBarrierCount)
+}
+
+// WithPImageMemoryBarriers clones a new DependencyInfo with the value of
+// PImageMemoryBarriers updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines ImageMemoryBarrierCount as the length of this field.
+// ImageMemoryBarrierCount is updated with the length of the new value.
+func (x DependencyInfo) WithPImageMemoryBarriers(y []ImageMemoryBarrier2) DependencyInfo {
+	x.pImageMemoryBarriers = *(func(x *[]ImageMemoryBarrier2) **C.struct_VkImageMemoryBarrier2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkImageMemoryBarrier2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkImageMemoryBarrier2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithImageMemoryBarrierCount(uint32(len(y)))
+}
+func (x *DependencyInfo) SetPImageMemoryBarriers(y []ImageMemoryBarrier2) {
+	x.pImageMemoryBarriers = *(func(x *[]ImageMemoryBarrier2) **C.struct_VkImageMemoryBarrier2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkImageMemoryBarrier2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkImageMemoryBarrier2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetImageMemoryBarrierCount(uint32(len(y)))
+}
+
+// PinPImageMemoryBarriers pins the Go memory referenced by y with the AutoReleasePool
+// and sets PImageMemoryBarriers, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *DependencyInfo) PinPImageMemoryBarriers(arp *AutoReleasePool, y []ImageMemoryBarrier2) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPImageMemoryBarriers(y)
+}
+
+// SemaphoreSubmitInfo provides a go interface for VkSemaphoreSubmitInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSemaphoreSubmitInfo.html
+type SemaphoreSubmitInfo C.struct_VkSemaphoreSubmitInfo
+
+// SizeofSemaphoreSubmitInfo is the memory size of a SemaphoreSubmitInfo
+var SizeofSemaphoreSubmitInfo int = int(unsafe.Sizeof(SemaphoreSubmitInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SemaphoreSubmitInfo) ArpPtr(arp *AutoReleasePool) *SemaphoreSubmitInfo {
+	ptr := newCBlock(cULong(SizeofSemaphoreSubmitInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SemaphoreSubmitInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SemaphoreSubmitInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SemaphoreSubmitInfo) AsCPtr() *SemaphoreSubmitInfo {
+	clone := (*SemaphoreSubmitInfo)(newCBlock(cULong(SizeofSemaphoreSubmitInfo)))
+	*clone = x
+	return clone
+}
+
+// SemaphoreSubmitInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SemaphoreSubmitInfoCSlice(arp *AutoReleasePool, x ...SemaphoreSubmitInfo) []SemaphoreSubmitInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSemaphoreSubmitInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SemaphoreSubmitInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SemaphoreSubmitInfoFreeCSlice releases the memory allocated by SemaphoreSubmitInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func SemaphoreSubmitInfoFreeCSlice(x []SemaphoreSubmitInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SemaphoreSubmitInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SemaphoreSubmitInfoFreeCSlice must be called on the returned slice.
+func SemaphoreSubmitInfoMakeCSlice(x ...SemaphoreSubmitInfo) []SemaphoreSubmitInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSemaphoreSubmitInfo * len(x)
+	dst := unsafe.Slice((*SemaphoreSubmitInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkSemaphoreSubmitInfo
+func (x SemaphoreSubmitInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new SemaphoreSubmitInfo with the value of
+// SType to the value provided in the specification.
+func (x SemaphoreSubmitInfo) WithDefaultSType() SemaphoreSubmitInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *SemaphoreSubmitInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO)
+}
+
+// WithSType clones a new SemaphoreSubmitInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SemaphoreSubmitInfo) WithSType(y StructureType) SemaphoreSubmitInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *SemaphoreSubmitInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkSemaphoreSubmitInfo
+func (x SemaphoreSubmitInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new SemaphoreSubmitInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SemaphoreSubmitInfo) WithPNext(y unsafe.Pointer) SemaphoreSubmitInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *SemaphoreSubmitInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SemaphoreSubmitInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Semaphore returns the value of semaphore from VkSemaphoreSubmitInfo
+func (x SemaphoreSubmitInfo) Semaphore() Semaphore {
+	ptr := /* handle */ (*Semaphore)(&x.semaphore)
+	return *ptr
+}
+
+// WithSemaphore clones a new SemaphoreSubmitInfo with the value of
+// Semaphore updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SemaphoreSubmitInfo) WithSemaphore(y Semaphore) SemaphoreSubmitInfo {
+	x.semaphore = *( /* handle */ (*C.VkSemaphore)(&y))
+	return x
+}
+func (x *SemaphoreSubmitInfo) SetSemaphore(y Semaphore) {
+	x.semaphore = *( /* handle */ (*C.VkSemaphore)(&y))
+}
+
+// Value returns the value of value from VkSemaphoreSubmitInfo
+func (x SemaphoreSubmitInfo) Value() uint64 {
+	ptr := func(x *C.uint64_t) *uint64 { /* Scalar */ c2g := uint64(*x); return &c2g }(&x.value)
+	return *ptr
+}
+
+// WithValue clones a new SemaphoreSubmitInfo with the value of
+// Value updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SemaphoreSubmitInfo) WithValue(y uint64) SemaphoreSubmitInfo {
+	x.value = *(func(x *uint64) *C.uint64_t { /* Scalar */ g2c := C.uint64_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *SemaphoreSubmitInfo) SetValue(y uint64) {
+	x.value = *(func(x *uint64) *C.uint64_t { /* Scalar */ g2c := C.uint64_t(*x); return &g2c }(&y))
+}
+
+// StageMask returns the value of stageMask from VkSemaphoreSubmitInfo
+func (x SemaphoreSubmitInfo) StageMask() PipelineStageFlags2 {
+	ptr := /* typedef */ (*PipelineStageFlags2)(&x.stageMask)
+	return *ptr
+}
+
+// WithStageMask clones a new SemaphoreSubmitInfo with the value of
+// StageMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SemaphoreSubmitInfo) WithStageMask(y PipelineStageFlags2) SemaphoreSubmitInfo {
+	x.stageMask = *( /* typedef */ (*C.VkPipelineStageFlags2)(&y))
+	return x
+}
+func (x *SemaphoreSubmitInfo) SetStageMask(y PipelineStageFlags2) {
+	x.stageMask = *( /* typedef */ (*C.VkPipelineStageFlags2)(&y))
+}
+
+// DeviceIndex returns the value of deviceIndex from VkSemaphoreSubmitInfo
+func (x SemaphoreSubmitInfo) DeviceIndex() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.deviceIndex)
+	return *ptr
+}
+
+// WithDeviceIndex clones a new SemaphoreSubmitInfo with the value of
+// DeviceIndex updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SemaphoreSubmitInfo) WithDeviceIndex(y uint32) SemaphoreSubmitInfo {
+	x.deviceIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *SemaphoreSubmitInfo) SetDeviceIndex(y uint32) {
+	x.deviceIndex = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// CommandBufferSubmitInfo provides a go interface for VkCommandBufferSubmitInfo.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkCommandBufferSubmitInfo.html
+type CommandBufferSubmitInfo C.struct_VkCommandBufferSubmitInfo
+
+// SizeofCommandBufferSubmitInfo is the memory size of a CommandBufferSubmitInfo
+var SizeofCommandBufferSubmitInfo int = int(unsafe.Sizeof(CommandBufferSubmitInfo{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x CommandBufferSubmitInfo) ArpPtr(arp *AutoReleasePool) *CommandBufferSubmitInfo {
+	ptr := newCBlock(cULong(SizeofCommandBufferSubmitInfo))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*CommandBufferSubmitInfo)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *CommandBufferSubmitInfo) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x CommandBufferSubmitInfo) AsCPtr() *CommandBufferSubmitInfo {
+	clone := (*CommandBufferSubmitInfo)(newCBlock(cULong(SizeofCommandBufferSubmitInfo)))
+	*clone = x
+	return clone
+}
+
+// CommandBufferSubmitInfoCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func CommandBufferSubmitInfoCSlice(arp *AutoReleasePool, x ...CommandBufferSubmitInfo) []CommandBufferSubmitInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofCommandBufferSubmitInfo * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*CommandBufferSubmitInfo)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// CommandBufferSubmitInfoFreeCSlice releases the memory allocated by CommandBufferSubmitInfoMakeCSlice.
+// It does not free pointers stored inside the slice.
+func CommandBufferSubmitInfoFreeCSlice(x []CommandBufferSubmitInfo) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// CommandBufferSubmitInfoMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. CommandBufferSubmitInfoFreeCSlice must be called on the returned slice.
+func CommandBufferSubmitInfoMakeCSlice(x ...CommandBufferSubmitInfo) []CommandBufferSubmitInfo {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofCommandBufferSubmitInfo * len(x)
+	dst := unsafe.Slice((*CommandBufferSubmitInfo)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkCommandBufferSubmitInfo
+func (x CommandBufferSubmitInfo) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new CommandBufferSubmitInfo with the value of
+// SType to the value provided in the specification.
+func (x CommandBufferSubmitInfo) WithDefaultSType() CommandBufferSubmitInfo {
+	return x.WithSType(VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *CommandBufferSubmitInfo) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO)
+}
+
+// WithSType clones a new CommandBufferSubmitInfo with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CommandBufferSubmitInfo) WithSType(y StructureType) CommandBufferSubmitInfo {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *CommandBufferSubmitInfo) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkCommandBufferSubmitInfo
+func (x CommandBufferSubmitInfo) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new CommandBufferSubmitInfo with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CommandBufferSubmitInfo) WithPNext(y unsafe.Pointer) CommandBufferSubmitInfo {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *CommandBufferSubmitInfo) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *CommandBufferSubmitInfo) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// CommandBuffer returns the value of commandBuffer from VkCommandBufferSubmitInfo
+func (x CommandBufferSubmitInfo) CommandBuffer() CommandBuffer {
+	ptr := /* handle */ (*CommandBuffer)(&x.commandBuffer)
+	return *ptr
+}
+
+// WithCommandBuffer clones a new CommandBufferSubmitInfo with the value of
+// CommandBuffer updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CommandBufferSubmitInfo) WithCommandBuffer(y CommandBuffer) CommandBufferSubmitInfo {
+	x.commandBuffer = *( /* handle */ (*C.VkCommandBuffer)(&y))
+	return x
+}
+func (x *CommandBufferSubmitInfo) SetCommandBuffer(y CommandBuffer) {
+	x.commandBuffer = *( /* handle */ (*C.VkCommandBuffer)(&y))
+}
+
+// DeviceMask returns the value of deviceMask from VkCommandBufferSubmitInfo
+func (x CommandBufferSubmitInfo) DeviceMask() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.deviceMask)
+	return *ptr
+}
+
+// WithDeviceMask clones a new CommandBufferSubmitInfo with the value of
+// DeviceMask updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CommandBufferSubmitInfo) WithDeviceMask(y uint32) CommandBufferSubmitInfo {
+	x.deviceMask = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *CommandBufferSubmitInfo) SetDeviceMask(y uint32) {
+	x.deviceMask = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// SubmitInfo2 provides a go interface for VkSubmitInfo2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkSubmitInfo2.html
+type SubmitInfo2 C.struct_VkSubmitInfo2
+
+// SizeofSubmitInfo2 is the memory size of a SubmitInfo2
+var SizeofSubmitInfo2 int = int(unsafe.Sizeof(SubmitInfo2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x SubmitInfo2) ArpPtr(arp *AutoReleasePool) *SubmitInfo2 {
+	ptr := newCBlock(cULong(SizeofSubmitInfo2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*SubmitInfo2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *SubmitInfo2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x SubmitInfo2) AsCPtr() *SubmitInfo2 {
+	clone := (*SubmitInfo2)(newCBlock(cULong(SizeofSubmitInfo2)))
+	*clone = x
+	return clone
+}
+
+// SubmitInfo2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func SubmitInfo2CSlice(arp *AutoReleasePool, x ...SubmitInfo2) []SubmitInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSubmitInfo2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*SubmitInfo2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SubmitInfo2FreeCSlice releases the memory allocated by SubmitInfo2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func SubmitInfo2FreeCSlice(x []SubmitInfo2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// SubmitInfo2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. SubmitInfo2FreeCSlice must be called on the returned slice.
+func SubmitInfo2MakeCSlice(x ...SubmitInfo2) []SubmitInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofSubmitInfo2 * len(x)
+	dst := unsafe.Slice((*SubmitInfo2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkSubmitInfo2
+func (x SubmitInfo2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new SubmitInfo2 with the value of
+// SType to the value provided in the specification.
+func (x SubmitInfo2) WithDefaultSType() SubmitInfo2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_SUBMIT_INFO_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *SubmitInfo2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_SUBMIT_INFO_2)
+}
+
+// WithSType clones a new SubmitInfo2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubmitInfo2) WithSType(y StructureType) SubmitInfo2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *SubmitInfo2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkSubmitInfo2
+func (x SubmitInfo2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new SubmitInfo2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubmitInfo2) WithPNext(y unsafe.Pointer) SubmitInfo2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *SubmitInfo2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SubmitInfo2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Flags returns the value of flags from VkSubmitInfo2
+func (x SubmitInfo2) Flags() SubmitFlags {
+	ptr := /* typedef */ (*SubmitFlags)(&x.flags)
+	return *ptr
+}
+
+// WithFlags clones a new SubmitInfo2 with the value of
+// Flags updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubmitInfo2) WithFlags(y SubmitFlags) SubmitInfo2 {
+	x.flags = *( /* typedef */ (*C.VkSubmitFlags)(&y))
+	return x
+}
+func (x *SubmitInfo2) SetFlags(y SubmitFlags) {
+	x.flags = *( /* typedef */ (*C.VkSubmitFlags)(&y))
+}
+
+// WaitSemaphoreInfoCount returns the value of waitSemaphoreInfoCount from VkSubmitInfo2
+func (x SubmitInfo2) WaitSemaphoreInfoCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.waitSemaphoreInfoCount)
+	return *ptr
+}
+
+// WithWaitSemaphoreInfoCount clones a new SubmitInfo2 with the value of
+// WaitSemaphoreInfoCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubmitInfo2) WithWaitSemaphoreInfoCount(y uint32) SubmitInfo2 {
+	x.waitSemaphoreInfoCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *SubmitInfo2) SetWaitSemaphoreInfoCount(y uint32) {
+	x.waitSemaphoreInfoCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PWaitSemaphoreInfos returns the value of pWaitSemaphoreInfos from VkSubmitInfo2
+func (x SubmitInfo2) PWaitSemaphoreInfos() []SemaphoreSubmitInfo {
+	if x.pWaitSemaphoreInfos == nil {
+		return nil
+	}
+	return unsafe.Slice((*SemaphoreSubmitInfo)(unsafe.Pointer(x.pWaitSemaphoreInfos)), x.waitSemaphoreInfoCount)
+}
+
+// WithPWaitSemaphoreInfos clones a new SubmitInfo2 with the value of
+// PWaitSemaphoreInfos updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines WaitSemaphoreInfoCount as the length of this field.
+// WaitSemaphoreInfoCount is updated with the length of the new value.
+func (x SubmitInfo2) WithPWaitSemaphoreInfos(y []SemaphoreSubmitInfo) SubmitInfo2 {
+	x.pWaitSemaphoreInfos = *(func(x *[]SemaphoreSubmitInfo) **C.struct_VkSemaphoreSubmitInfo { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkSemaphoreSubmitInfo)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkSemaphoreSubmitInfo)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithWaitSemaphoreInfoCount(uint32(len(y)))
+}
+func (x *SubmitInfo2) SetPWaitSemaphoreInfos(y []SemaphoreSubmitInfo) {
+	x.pWaitSemaphoreInfos = *(func(x *[]SemaphoreSubmitInfo) **C.struct_VkSemaphoreSubmitInfo { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkSemaphoreSubmitInfo)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkSemaphoreSubmitInfo)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetWaitSemaphoreInfoCount(uint32(len(y)))
+}
+
+// PinPWaitSemaphoreInfos pins the Go memory referenced by y with the AutoReleasePool
+// and sets PWaitSemaphoreInfos, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SubmitInfo2) PinPWaitSemaphoreInfos(arp *AutoReleasePool, y []SemaphoreSubmitInfo) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPWaitSemaphoreInfos(y)
+}
+
+// CommandBufferInfoCount returns the value of commandBufferInfoCount from VkSubmitInfo2
+func (x SubmitInfo2) CommandBufferInfoCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.commandBufferInfoCount)
+	return *ptr
+}
+
+// WithCommandBufferInfoCount clones a new SubmitInfo2 with the value of
+// CommandBufferInfoCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubmitInfo2) WithCommandBufferInfoCount(y uint32) SubmitInfo2 {
+	x.commandBufferInfoCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *SubmitInfo2) SetCommandBufferInfoCount(y uint32) {
+	x.commandBufferInfoCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PCommandBufferInfos returns the value of pCommandBufferInfos from VkSubmitInfo2
+func (x SubmitInfo2) PCommandBufferInfos() []CommandBufferSubmitInfo {
+	if x.pCommandBufferInfos == nil {
+		return nil
+	}
+	return unsafe.Slice((*CommandBufferSubmitInfo)(unsafe.Pointer(x.pCommandBufferInfos)), x.commandBufferInfoCount)
+}
+
+// WithPCommandBufferInfos clones a new SubmitInfo2 with the value of
+// PCommandBufferInfos updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines CommandBufferInfoCount as the length of this field.
+// CommandBufferInfoCount is updated with the length of the new value.
+func (x SubmitInfo2) WithPCommandBufferInfos(y []CommandBufferSubmitInfo) SubmitInfo2 {
+	x.pCommandBufferInfos = *(func(x *[]CommandBufferSubmitInfo) **C.struct_VkCommandBufferSubmitInfo { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkCommandBufferSubmitInfo)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkCommandBufferSubmitInfo)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithCommandBufferInfoCount(uint32(len(y)))
+}
+func (x *SubmitInfo2) SetPCommandBufferInfos(y []CommandBufferSubmitInfo) {
+	x.pCommandBufferInfos = *(func(x *[]CommandBufferSubmitInfo) **C.struct_VkCommandBufferSubmitInfo { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkCommandBufferSubmitInfo)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkCommandBufferSubmitInfo)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetCommandBufferInfoCount(uint32(len(y)))
+}
+
+// PinPCommandBufferInfos pins the Go memory referenced by y with the AutoReleasePool
+// and sets PCommandBufferInfos, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SubmitInfo2) PinPCommandBufferInfos(arp *AutoReleasePool, y []CommandBufferSubmitInfo) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPCommandBufferInfos(y)
+}
+
+// SignalSemaphoreInfoCount returns the value of signalSemaphoreInfoCount from VkSubmitInfo2
+func (x SubmitInfo2) SignalSemaphoreInfoCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.signalSemaphoreInfoCount)
+	return *ptr
+}
+
+// WithSignalSemaphoreInfoCount clones a new SubmitInfo2 with the value of
+// SignalSemaphoreInfoCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x SubmitInfo2) WithSignalSemaphoreInfoCount(y uint32) SubmitInfo2 {
+	x.signalSemaphoreInfoCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *SubmitInfo2) SetSignalSemaphoreInfoCount(y uint32) {
+	x.signalSemaphoreInfoCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PSignalSemaphoreInfos returns the value of pSignalSemaphoreInfos from VkSubmitInfo2
+func (x SubmitInfo2) PSignalSemaphoreInfos() []SemaphoreSubmitInfo {
+	if x.pSignalSemaphoreInfos == nil {
+		return nil
+	}
+	return unsafe.Slice((*SemaphoreSubmitInfo)(unsafe.Pointer(x.pSignalSemaphoreInfos)), x.signalSemaphoreInfoCount)
+}
+
+// WithPSignalSemaphoreInfos clones a new SubmitInfo2 with the value of
+// PSignalSemaphoreInfos updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines SignalSemaphoreInfoCount as the length of this field.
+// SignalSemaphoreInfoCount is updated with the length of the new value.
+func (x SubmitInfo2) WithPSignalSemaphoreInfos(y []SemaphoreSubmitInfo) SubmitInfo2 {
+	x.pSignalSemaphoreInfos = *(func(x *[]SemaphoreSubmitInfo) **C.struct_VkSemaphoreSubmitInfo { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkSemaphoreSubmitInfo)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkSemaphoreSubmitInfo)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithSignalSemaphoreInfoCount(uint32(len(y)))
+}
+func (x *SubmitInfo2) SetPSignalSemaphoreInfos(y []SemaphoreSubmitInfo) {
+	x.pSignalSemaphoreInfos = *(func(x *[]SemaphoreSubmitInfo) **C.struct_VkSemaphoreSubmitInfo { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkSemaphoreSubmitInfo)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkSemaphoreSubmitInfo)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetSignalSemaphoreInfoCount(uint32(len(y)))
+}
+
+// PinPSignalSemaphoreInfos pins the Go memory referenced by y with the AutoReleasePool
+// and sets PSignalSemaphoreInfos, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *SubmitInfo2) PinPSignalSemaphoreInfos(arp *AutoReleasePool, y []SemaphoreSubmitInfo) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPSignalSemaphoreInfos(y)
+}
+
+// ImageResolve2 provides a go interface for VkImageResolve2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkImageResolve2.html
+type ImageResolve2 C.struct_VkImageResolve2
+
+// SizeofImageResolve2 is the memory size of a ImageResolve2
+var SizeofImageResolve2 int = int(unsafe.Sizeof(ImageResolve2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ImageResolve2) ArpPtr(arp *AutoReleasePool) *ImageResolve2 {
+	ptr := newCBlock(cULong(SizeofImageResolve2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ImageResolve2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ImageResolve2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ImageResolve2) AsCPtr() *ImageResolve2 {
+	clone := (*ImageResolve2)(newCBlock(cULong(SizeofImageResolve2)))
+	*clone = x
+	return clone
+}
+
+// ImageResolve2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ImageResolve2CSlice(arp *AutoReleasePool, x ...ImageResolve2) []ImageResolve2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImageResolve2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ImageResolve2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ImageResolve2FreeCSlice releases the memory allocated by ImageResolve2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func ImageResolve2FreeCSlice(x []ImageResolve2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ImageResolve2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ImageResolve2FreeCSlice must be called on the returned slice.
+func ImageResolve2MakeCSlice(x ...ImageResolve2) []ImageResolve2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImageResolve2 * len(x)
+	dst := unsafe.Slice((*ImageResolve2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkImageResolve2
+func (x *ImageResolve2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ImageResolve2 with the value of
+// SType to the value provided in the specification.
+func (x ImageResolve2) WithDefaultSType() ImageResolve2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_IMAGE_RESOLVE_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ImageResolve2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_IMAGE_RESOLVE_2)
+}
+
+// WithSType clones a new ImageResolve2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageResolve2) WithSType(y StructureType) ImageResolve2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ImageResolve2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkImageResolve2
+func (x *ImageResolve2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ImageResolve2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageResolve2) WithPNext(y unsafe.Pointer) ImageResolve2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ImageResolve2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ImageResolve2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SrcSubresource returns the value of srcSubresource from VkImageResolve2
+func (x *ImageResolve2) SrcSubresource() ImageSubresourceLayers {
+	ptr := /* typedef */ (*ImageSubresourceLayers)(&x.srcSubresource)
+	return *ptr
+}
+
+// WithSrcSubresource clones a new ImageResolve2 with the value of
+// SrcSubresource updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageResolve2) WithSrcSubresource(y ImageSubresourceLayers) ImageResolve2 {
+	x.srcSubresource = *( /* typedef */ (*C.struct_VkImageSubresourceLayers)(&y))
+	return x
+}
+func (x *ImageResolve2) SetSrcSubresource(y ImageSubresourceLayers) {
+	x.srcSubresource = *( /* typedef */ (*C.struct_VkImageSubresourceLayers)(&y))
+}
+
+// SrcOffset returns the value of srcOffset from VkImageResolve2
+func (x *ImageResolve2) SrcOffset() Offset3D {
+	ptr := /* typedef */ (*Offset3D)(&x.srcOffset)
+	return *ptr
+}
+
+// WithSrcOffset clones a new ImageResolve2 with the value of
+// SrcOffset updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageResolve2) WithSrcOffset(y Offset3D) ImageResolve2 {
+	x.srcOffset = *( /* typedef */ (*C.struct_VkOffset3D)(&y))
+	return x
+}
+func (x *ImageResolve2) SetSrcOffset(y Offset3D) {
+	x.srcOffset = *( /* typedef */ (*C.struct_VkOffset3D)(&y))
+}
+
+// DstSubresource returns the value of dstSubresource from VkImageResolve2
+func (x *ImageResolve2) DstSubresource() ImageSubresourceLayers {
+	ptr := /* typedef */ (*ImageSubresourceLayers)(&x.dstSubresource)
+	return *ptr
+}
+
+// WithDstSubresource clones a new ImageResolve2 with the value of
+// DstSubresource updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageResolve2) WithDstSubresource(y ImageSubresourceLayers) ImageResolve2 {
+	x.dstSubresource = *( /* typedef */ (*C.struct_VkImageSubresourceLayers)(&y))
+	return x
+}
+func (x *ImageResolve2) SetDstSubresource(y ImageSubresourceLayers) {
+	x.dstSubresource = *( /* typedef */ (*C.struct_VkImageSubresourceLayers)(&y))
+}
+
+// DstOffset returns the value of dstOffset from VkImageResolve2
+func (x *ImageResolve2) DstOffset() Offset3D {
+	ptr := /* typedef */ (*Offset3D)(&x.dstOffset)
+	return *ptr
+}
+
+// WithDstOffset clones a new ImageResolve2 with the value of
+// DstOffset updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageResolve2) WithDstOffset(y Offset3D) ImageResolve2 {
+	x.dstOffset = *( /* typedef */ (*C.struct_VkOffset3D)(&y))
+	return x
+}
+func (x *ImageResolve2) SetDstOffset(y Offset3D) {
+	x.dstOffset = *( /* typedef */ (*C.struct_VkOffset3D)(&y))
+}
+
+// Extent returns the value of extent from VkImageResolve2
+func (x *ImageResolve2) Extent() Extent3D {
+	ptr := /* typedef */ (*Extent3D)(&x.extent)
+	return *ptr
+}
+
+// WithExtent clones a new ImageResolve2 with the value of
+// Extent updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageResolve2) WithExtent(y Extent3D) ImageResolve2 {
+	x.extent = *( /* typedef */ (*C.struct_VkExtent3D)(&y))
+	return x
+}
+func (x *ImageResolve2) SetExtent(y Extent3D) {
+	x.extent = *( /* typedef */ (*C.struct_VkExtent3D)(&y))
+}
+
+// PhysicalDeviceSynchronization2Features provides a go interface for VkPhysicalDeviceSynchronization2Features.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceSynchronization2Features.html
+type PhysicalDeviceSynchronization2Features C.struct_VkPhysicalDeviceSynchronization2Features
+
+// SizeofPhysicalDeviceSynchronization2Features is the memory size of a PhysicalDeviceSynchronization2Features
+var SizeofPhysicalDeviceSynchronization2Features int = int(unsafe.Sizeof(PhysicalDeviceSynchronization2Features{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceSynchronization2Features) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceSynchronization2Features {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceSynchronization2Features))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceSynchronization2Features)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceSynchronization2Features) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceSynchronization2Features) AsCPtr() *PhysicalDeviceSynchronization2Features {
+	clone := (*PhysicalDeviceSynchronization2Features)(newCBlock(cULong(SizeofPhysicalDeviceSynchronization2Features)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceSynchronization2FeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceSynchronization2FeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceSynchronization2Features) []PhysicalDeviceSynchronization2Features {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceSynchronization2Features * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceSynchronization2Features)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceSynchronization2FeaturesFreeCSlice releases the memory allocated by PhysicalDeviceSynchronization2FeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceSynchronization2FeaturesFreeCSlice(x []PhysicalDeviceSynchronization2Features) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceSynchronization2FeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceSynchronization2FeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceSynchronization2FeaturesMakeCSlice(x ...PhysicalDeviceSynchronization2Features) []PhysicalDeviceSynchronization2Features {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceSynchronization2Features * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceSynchronization2Features)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceSynchronization2Features
+func (x PhysicalDeviceSynchronization2Features) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceSynchronization2Features with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceSynchronization2Features) WithDefaultSType() PhysicalDeviceSynchronization2Features {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceSynchronization2Features) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SYNCHRONIZATION_2_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceSynchronization2Features with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSynchronization2Features) WithSType(y StructureType) PhysicalDeviceSynchronization2Features {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceSynchronization2Features) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceSynchronization2Features
+func (x PhysicalDeviceSynchronization2Features) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceSynchronization2Features with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSynchronization2Features) WithPNext(y unsafe.Pointer) PhysicalDeviceSynchronization2Features {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceSynchronization2Features) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceSynchronization2Features) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// Synchronization2 returns the value of synchronization2 from VkPhysicalDeviceSynchronization2Features
+func (x PhysicalDeviceSynchronization2Features) Synchronization2() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.synchronization2)
+	return *ptr
+}
+
+// WithSynchronization2 clones a new PhysicalDeviceSynchronization2Features with the value of
+// Synchronization2 updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceSynchronization2Features) WithSynchronization2(y Bool32) PhysicalDeviceSynchronization2Features {
+	x.synchronization2 = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceSynchronization2Features) SetSynchronization2(y Bool32) {
+	x.synchronization2 = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// BufferImageCopy2 provides a go interface for VkBufferImageCopy2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkBufferImageCopy2.html
+type BufferImageCopy2 C.struct_VkBufferImageCopy2
+
+// SizeofBufferImageCopy2 is the memory size of a BufferImageCopy2
+var SizeofBufferImageCopy2 int = int(unsafe.Sizeof(BufferImageCopy2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x BufferImageCopy2) ArpPtr(arp *AutoReleasePool) *BufferImageCopy2 {
+	ptr := newCBlock(cULong(SizeofBufferImageCopy2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*BufferImageCopy2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *BufferImageCopy2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x BufferImageCopy2) AsCPtr() *BufferImageCopy2 {
+	clone := (*BufferImageCopy2)(newCBlock(cULong(SizeofBufferImageCopy2)))
+	*clone = x
+	return clone
+}
+
+// BufferImageCopy2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func BufferImageCopy2CSlice(arp *AutoReleasePool, x ...BufferImageCopy2) []BufferImageCopy2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBufferImageCopy2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*BufferImageCopy2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// BufferImageCopy2FreeCSlice releases the memory allocated by BufferImageCopy2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func BufferImageCopy2FreeCSlice(x []BufferImageCopy2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// BufferImageCopy2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. BufferImageCopy2FreeCSlice must be called on the returned slice.
+func BufferImageCopy2MakeCSlice(x ...BufferImageCopy2) []BufferImageCopy2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBufferImageCopy2 * len(x)
+	dst := unsafe.Slice((*BufferImageCopy2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkBufferImageCopy2
+func (x *BufferImageCopy2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new BufferImageCopy2 with the value of
+// SType to the value provided in the specification.
+func (x BufferImageCopy2) WithDefaultSType() BufferImageCopy2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *BufferImageCopy2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2)
+}
+
+// WithSType clones a new BufferImageCopy2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferImageCopy2) WithSType(y StructureType) BufferImageCopy2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *BufferImageCopy2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkBufferImageCopy2
+func (x *BufferImageCopy2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new BufferImageCopy2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferImageCopy2) WithPNext(y unsafe.Pointer) BufferImageCopy2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *BufferImageCopy2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *BufferImageCopy2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// BufferOffset returns the value of bufferOffset from VkBufferImageCopy2
+func (x *BufferImageCopy2) BufferOffset() DeviceSize {
+	ptr := /* typedef */ (*DeviceSize)(&x.bufferOffset)
+	return *ptr
+}
+
+// WithBufferOffset clones a new BufferImageCopy2 with the value of
+// BufferOffset updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferImageCopy2) WithBufferOffset(y DeviceSize) BufferImageCopy2 {
+	x.bufferOffset = *( /* typedef */ (*C.VkDeviceSize)(&y))
+	return x
+}
+func (x *BufferImageCopy2) SetBufferOffset(y DeviceSize) {
+	x.bufferOffset = *( /* typedef */ (*C.VkDeviceSize)(&y))
+}
+
+// BufferRowLength returns the value of bufferRowLength from VkBufferImageCopy2
+func (x *BufferImageCopy2) BufferRowLength() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.bufferRowLength)
+	return *ptr
+}
+
+// WithBufferRowLength clones a new BufferImageCopy2 with the value of
+// BufferRowLength updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferImageCopy2) WithBufferRowLength(y uint32) BufferImageCopy2 {
+	x.bufferRowLength = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *BufferImageCopy2) SetBufferRowLength(y uint32) {
+	x.bufferRowLength = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// BufferImageHeight returns the value of bufferImageHeight from VkBufferImageCopy2
+func (x *BufferImageCopy2) BufferImageHeight() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.bufferImageHeight)
+	return *ptr
+}
+
+// WithBufferImageHeight clones a new BufferImageCopy2 with the value of
+// BufferImageHeight updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferImageCopy2) WithBufferImageHeight(y uint32) BufferImageCopy2 {
+	x.bufferImageHeight = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *BufferImageCopy2) SetBufferImageHeight(y uint32) {
+	x.bufferImageHeight = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// ImageSubresource returns the value of imageSubresource from VkBufferImageCopy2
+func (x *BufferImageCopy2) ImageSubresource() ImageSubresourceLayers {
+	ptr := /* typedef */ (*ImageSubresourceLayers)(&x.imageSubresource)
+	return *ptr
+}
+
+// WithImageSubresource clones a new BufferImageCopy2 with the value of
+// ImageSubresource updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferImageCopy2) WithImageSubresource(y ImageSubresourceLayers) BufferImageCopy2 {
+	x.imageSubresource = *( /* typedef */ (*C.struct_VkImageSubresourceLayers)(&y))
+	return x
+}
+func (x *BufferImageCopy2) SetImageSubresource(y ImageSubresourceLayers) {
+	x.imageSubresource = *( /* typedef */ (*C.struct_VkImageSubresourceLayers)(&y))
+}
+
+// ImageOffset returns the value of imageOffset from VkBufferImageCopy2
+func (x *BufferImageCopy2) ImageOffset() Offset3D {
+	ptr := /* typedef */ (*Offset3D)(&x.imageOffset)
+	return *ptr
+}
+
+// WithImageOffset clones a new BufferImageCopy2 with the value of
+// ImageOffset updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferImageCopy2) WithImageOffset(y Offset3D) BufferImageCopy2 {
+	x.imageOffset = *( /* typedef */ (*C.struct_VkOffset3D)(&y))
+	return x
+}
+func (x *BufferImageCopy2) SetImageOffset(y Offset3D) {
+	x.imageOffset = *( /* typedef */ (*C.struct_VkOffset3D)(&y))
+}
+
+// ImageExtent returns the value of imageExtent from VkBufferImageCopy2
+func (x *BufferImageCopy2) ImageExtent() Extent3D {
+	ptr := /* typedef */ (*Extent3D)(&x.imageExtent)
+	return *ptr
+}
+
+// WithImageExtent clones a new BufferImageCopy2 with the value of
+// ImageExtent updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferImageCopy2) WithImageExtent(y Extent3D) BufferImageCopy2 {
+	x.imageExtent = *( /* typedef */ (*C.struct_VkExtent3D)(&y))
+	return x
+}
+func (x *BufferImageCopy2) SetImageExtent(y Extent3D) {
+	x.imageExtent = *( /* typedef */ (*C.struct_VkExtent3D)(&y))
+}
+
+// ImageBlit2 provides a go interface for VkImageBlit2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkImageBlit2.html
+type ImageBlit2 C.struct_VkImageBlit2
+
+// SizeofImageBlit2 is the memory size of a ImageBlit2
+var SizeofImageBlit2 int = int(unsafe.Sizeof(ImageBlit2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ImageBlit2) ArpPtr(arp *AutoReleasePool) *ImageBlit2 {
+	ptr := newCBlock(cULong(SizeofImageBlit2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ImageBlit2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ImageBlit2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ImageBlit2) AsCPtr() *ImageBlit2 {
+	clone := (*ImageBlit2)(newCBlock(cULong(SizeofImageBlit2)))
+	*clone = x
+	return clone
+}
+
+// ImageBlit2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ImageBlit2CSlice(arp *AutoReleasePool, x ...ImageBlit2) []ImageBlit2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImageBlit2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ImageBlit2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ImageBlit2FreeCSlice releases the memory allocated by ImageBlit2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func ImageBlit2FreeCSlice(x []ImageBlit2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ImageBlit2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ImageBlit2FreeCSlice must be called on the returned slice.
+func ImageBlit2MakeCSlice(x ...ImageBlit2) []ImageBlit2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImageBlit2 * len(x)
+	dst := unsafe.Slice((*ImageBlit2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkImageBlit2
+func (x *ImageBlit2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ImageBlit2 with the value of
+// SType to the value provided in the specification.
+func (x ImageBlit2) WithDefaultSType() ImageBlit2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_IMAGE_BLIT_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ImageBlit2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_IMAGE_BLIT_2)
+}
+
+// WithSType clones a new ImageBlit2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageBlit2) WithSType(y StructureType) ImageBlit2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ImageBlit2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkImageBlit2
+func (x *ImageBlit2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ImageBlit2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageBlit2) WithPNext(y unsafe.Pointer) ImageBlit2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ImageBlit2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ImageBlit2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SrcSubresource returns the value of srcSubresource from VkImageBlit2
+func (x *ImageBlit2) SrcSubresource() ImageSubresourceLayers {
+	ptr := /* typedef */ (*ImageSubresourceLayers)(&x.srcSubresource)
+	return *ptr
+}
+
+// WithSrcSubresource clones a new ImageBlit2 with the value of
+// SrcSubresource updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageBlit2) WithSrcSubresource(y ImageSubresourceLayers) ImageBlit2 {
+	x.srcSubresource = *( /* typedef */ (*C.struct_VkImageSubresourceLayers)(&y))
+	return x
+}
+func (x *ImageBlit2) SetSrcSubresource(y ImageSubresourceLayers) {
+	x.srcSubresource = *( /* typedef */ (*C.struct_VkImageSubresourceLayers)(&y))
+}
+
+// SrcOffsets returns the value of srcOffsets from VkImageBlit2
+// The slice references the array in x; it is not a copy.
+func (x *ImageBlit2) SrcOffsets() []Offset3D {
+	ptr := func(x *[2]C.struct_VkOffset3D) *[]Offset3D { /* Array for Offset3D */
+		slc := unsafe.Slice((*Offset3D)(unsafe.Pointer(x)), 2)
+		return &slc
+	}(&x.srcOffsets)
+	return *ptr
+}
+
+// WithSrcOffsets clones a new ImageBlit2 with the value of
+// SrcOffsets updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageBlit2) WithSrcOffsets(y []Offset3D) ImageBlit2 {
+	ptr := func(x *[]Offset3D) **C.struct_VkOffset3D { /* Array */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkOffset3D)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkOffset3D)(unsafe.Pointer((&ptr)))
+	}(&y)
+	copy(x.srcOffsets[:], unsafe.Slice(*ptr, len(y)))
+	return x
+}
+func (x *ImageBlit2) SetSrcOffsets(y []Offset3D) {
+	ptr := func(x *[]Offset3D) **C.struct_VkOffset3D { /* Array */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkOffset3D)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkOffset3D)(unsafe.Pointer((&ptr)))
+	}(&y)
+	copy(x.srcOffsets[:], unsafe.Slice(*ptr, len(y)))
+}
+
+// DstSubresource returns the value of dstSubresource from VkImageBlit2
+func (x *ImageBlit2) DstSubresource() ImageSubresourceLayers {
+	ptr := /* typedef */ (*ImageSubresourceLayers)(&x.dstSubresource)
+	return *ptr
+}
+
+// WithDstSubresource clones a new ImageBlit2 with the value of
+// DstSubresource updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageBlit2) WithDstSubresource(y ImageSubresourceLayers) ImageBlit2 {
+	x.dstSubresource = *( /* typedef */ (*C.struct_VkImageSubresourceLayers)(&y))
+	return x
+}
+func (x *ImageBlit2) SetDstSubresource(y ImageSubresourceLayers) {
+	x.dstSubresource = *( /* typedef */ (*C.struct_VkImageSubresourceLayers)(&y))
+}
+
+// DstOffsets returns the value of dstOffsets from VkImageBlit2
+// The slice references the array in x; it is not a copy.
+func (x *ImageBlit2) DstOffsets() []Offset3D {
+	ptr := func(x *[2]C.struct_VkOffset3D) *[]Offset3D { /* Array for Offset3D */
+		slc := unsafe.Slice((*Offset3D)(unsafe.Pointer(x)), 2)
+		return &slc
+	}(&x.dstOffsets)
+	return *ptr
+}
+
+// WithDstOffsets clones a new ImageBlit2 with the value of
+// DstOffsets updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageBlit2) WithDstOffsets(y []Offset3D) ImageBlit2 {
+	ptr := func(x *[]Offset3D) **C.struct_VkOffset3D { /* Array */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkOffset3D)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkOffset3D)(unsafe.Pointer((&ptr)))
+	}(&y)
+	copy(x.dstOffsets[:], unsafe.Slice(*ptr, len(y)))
+	return x
+}
+func (x *ImageBlit2) SetDstOffsets(y []Offset3D) {
+	ptr := func(x *[]Offset3D) **C.struct_VkOffset3D { /* Array */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkOffset3D)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkOffset3D)(unsafe.Pointer((&ptr)))
+	}(&y)
+	copy(x.dstOffsets[:], unsafe.Slice(*ptr, len(y)))
+}
+
+// ImageCopy2 provides a go interface for VkImageCopy2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkImageCopy2.html
+type ImageCopy2 C.struct_VkImageCopy2
+
+// SizeofImageCopy2 is the memory size of a ImageCopy2
+var SizeofImageCopy2 int = int(unsafe.Sizeof(ImageCopy2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ImageCopy2) ArpPtr(arp *AutoReleasePool) *ImageCopy2 {
+	ptr := newCBlock(cULong(SizeofImageCopy2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ImageCopy2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ImageCopy2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ImageCopy2) AsCPtr() *ImageCopy2 {
+	clone := (*ImageCopy2)(newCBlock(cULong(SizeofImageCopy2)))
+	*clone = x
+	return clone
+}
+
+// ImageCopy2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ImageCopy2CSlice(arp *AutoReleasePool, x ...ImageCopy2) []ImageCopy2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImageCopy2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ImageCopy2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ImageCopy2FreeCSlice releases the memory allocated by ImageCopy2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func ImageCopy2FreeCSlice(x []ImageCopy2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ImageCopy2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ImageCopy2FreeCSlice must be called on the returned slice.
+func ImageCopy2MakeCSlice(x ...ImageCopy2) []ImageCopy2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofImageCopy2 * len(x)
+	dst := unsafe.Slice((*ImageCopy2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkImageCopy2
+func (x *ImageCopy2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ImageCopy2 with the value of
+// SType to the value provided in the specification.
+func (x ImageCopy2) WithDefaultSType() ImageCopy2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_IMAGE_COPY_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ImageCopy2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_IMAGE_COPY_2)
+}
+
+// WithSType clones a new ImageCopy2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageCopy2) WithSType(y StructureType) ImageCopy2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ImageCopy2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkImageCopy2
+func (x *ImageCopy2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ImageCopy2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageCopy2) WithPNext(y unsafe.Pointer) ImageCopy2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ImageCopy2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ImageCopy2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SrcSubresource returns the value of srcSubresource from VkImageCopy2
+func (x *ImageCopy2) SrcSubresource() ImageSubresourceLayers {
+	ptr := /* typedef */ (*ImageSubresourceLayers)(&x.srcSubresource)
+	return *ptr
+}
+
+// WithSrcSubresource clones a new ImageCopy2 with the value of
+// SrcSubresource updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageCopy2) WithSrcSubresource(y ImageSubresourceLayers) ImageCopy2 {
+	x.srcSubresource = *( /* typedef */ (*C.struct_VkImageSubresourceLayers)(&y))
+	return x
+}
+func (x *ImageCopy2) SetSrcSubresource(y ImageSubresourceLayers) {
+	x.srcSubresource = *( /* typedef */ (*C.struct_VkImageSubresourceLayers)(&y))
+}
+
+// SrcOffset returns the value of srcOffset from VkImageCopy2
+func (x *ImageCopy2) SrcOffset() Offset3D {
+	ptr := /* typedef */ (*Offset3D)(&x.srcOffset)
+	return *ptr
+}
+
+// WithSrcOffset clones a new ImageCopy2 with the value of
+// SrcOffset updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageCopy2) WithSrcOffset(y Offset3D) ImageCopy2 {
+	x.srcOffset = *( /* typedef */ (*C.struct_VkOffset3D)(&y))
+	return x
+}
+func (x *ImageCopy2) SetSrcOffset(y Offset3D) {
+	x.srcOffset = *( /* typedef */ (*C.struct_VkOffset3D)(&y))
+}
+
+// DstSubresource returns the value of dstSubresource from VkImageCopy2
+func (x *ImageCopy2) DstSubresource() ImageSubresourceLayers {
+	ptr := /* typedef */ (*ImageSubresourceLayers)(&x.dstSubresource)
+	return *ptr
+}
+
+// WithDstSubresource clones a new ImageCopy2 with the value of
+// DstSubresource updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageCopy2) WithDstSubresource(y ImageSubresourceLayers) ImageCopy2 {
+	x.dstSubresource = *( /* typedef */ (*C.struct_VkImageSubresourceLayers)(&y))
+	return x
+}
+func (x *ImageCopy2) SetDstSubresource(y ImageSubresourceLayers) {
+	x.dstSubresource = *( /* typedef */ (*C.struct_VkImageSubresourceLayers)(&y))
+}
+
+// DstOffset returns the value of dstOffset from VkImageCopy2
+func (x *ImageCopy2) DstOffset() Offset3D {
+	ptr := /* typedef */ (*Offset3D)(&x.dstOffset)
+	return *ptr
+}
+
+// WithDstOffset clones a new ImageCopy2 with the value of
+// DstOffset updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageCopy2) WithDstOffset(y Offset3D) ImageCopy2 {
+	x.dstOffset = *( /* typedef */ (*C.struct_VkOffset3D)(&y))
+	return x
+}
+func (x *ImageCopy2) SetDstOffset(y Offset3D) {
+	x.dstOffset = *( /* typedef */ (*C.struct_VkOffset3D)(&y))
+}
+
+// Extent returns the value of extent from VkImageCopy2
+func (x *ImageCopy2) Extent() Extent3D {
+	ptr := /* typedef */ (*Extent3D)(&x.extent)
+	return *ptr
+}
+
+// WithExtent clones a new ImageCopy2 with the value of
+// Extent updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ImageCopy2) WithExtent(y Extent3D) ImageCopy2 {
+	x.extent = *( /* typedef */ (*C.struct_VkExtent3D)(&y))
+	return x
+}
+func (x *ImageCopy2) SetExtent(y Extent3D) {
+	x.extent = *( /* typedef */ (*C.struct_VkExtent3D)(&y))
+}
+
+// BufferCopy2 provides a go interface for VkBufferCopy2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkBufferCopy2.html
+type BufferCopy2 C.struct_VkBufferCopy2
+
+// SizeofBufferCopy2 is the memory size of a BufferCopy2
+var SizeofBufferCopy2 int = int(unsafe.Sizeof(BufferCopy2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x BufferCopy2) ArpPtr(arp *AutoReleasePool) *BufferCopy2 {
+	ptr := newCBlock(cULong(SizeofBufferCopy2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*BufferCopy2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *BufferCopy2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x BufferCopy2) AsCPtr() *BufferCopy2 {
+	clone := (*BufferCopy2)(newCBlock(cULong(SizeofBufferCopy2)))
+	*clone = x
+	return clone
+}
+
+// BufferCopy2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func BufferCopy2CSlice(arp *AutoReleasePool, x ...BufferCopy2) []BufferCopy2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBufferCopy2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*BufferCopy2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// BufferCopy2FreeCSlice releases the memory allocated by BufferCopy2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func BufferCopy2FreeCSlice(x []BufferCopy2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// BufferCopy2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. BufferCopy2FreeCSlice must be called on the returned slice.
+func BufferCopy2MakeCSlice(x ...BufferCopy2) []BufferCopy2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBufferCopy2 * len(x)
+	dst := unsafe.Slice((*BufferCopy2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkBufferCopy2
+func (x BufferCopy2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new BufferCopy2 with the value of
+// SType to the value provided in the specification.
+func (x BufferCopy2) WithDefaultSType() BufferCopy2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_BUFFER_COPY_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *BufferCopy2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_BUFFER_COPY_2)
+}
+
+// WithSType clones a new BufferCopy2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferCopy2) WithSType(y StructureType) BufferCopy2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *BufferCopy2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkBufferCopy2
+func (x BufferCopy2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new BufferCopy2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferCopy2) WithPNext(y unsafe.Pointer) BufferCopy2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *BufferCopy2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *BufferCopy2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SrcOffset returns the value of srcOffset from VkBufferCopy2
+func (x BufferCopy2) SrcOffset() DeviceSize {
+	ptr := /* typedef */ (*DeviceSize)(&x.srcOffset)
+	return *ptr
+}
+
+// WithSrcOffset clones a new BufferCopy2 with the value of
+// SrcOffset updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferCopy2) WithSrcOffset(y DeviceSize) BufferCopy2 {
+	x.srcOffset = *( /* typedef */ (*C.VkDeviceSize)(&y))
+	return x
+}
+func (x *BufferCopy2) SetSrcOffset(y DeviceSize) {
+	x.srcOffset = *( /* typedef */ (*C.VkDeviceSize)(&y))
+}
+
+// DstOffset returns the value of dstOffset from VkBufferCopy2
+func (x BufferCopy2) DstOffset() DeviceSize {
+	ptr := /* typedef */ (*DeviceSize)(&x.dstOffset)
+	return *ptr
+}
+
+// WithDstOffset clones a new BufferCopy2 with the value of
+// DstOffset updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferCopy2) WithDstOffset(y DeviceSize) BufferCopy2 {
+	x.dstOffset = *( /* typedef */ (*C.VkDeviceSize)(&y))
+	return x
+}
+func (x *BufferCopy2) SetDstOffset(y DeviceSize) {
+	x.dstOffset = *( /* typedef */ (*C.VkDeviceSize)(&y))
+}
+
+// Size returns the value of size from VkBufferCopy2
+func (x BufferCopy2) Size() DeviceSize {
+	ptr := /* typedef */ (*DeviceSize)(&x.size)
+	return *ptr
+}
+
+// WithSize clones a new BufferCopy2 with the value of
+// Size updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BufferCopy2) WithSize(y DeviceSize) BufferCopy2 {
+	x.size = *( /* typedef */ (*C.VkDeviceSize)(&y))
+	return x
+}
+func (x *BufferCopy2) SetSize(y DeviceSize) {
+	x.size = *( /* typedef */ (*C.VkDeviceSize)(&y))
+}
+
+// ResolveImageInfo2 provides a go interface for VkResolveImageInfo2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkResolveImageInfo2.html
+type ResolveImageInfo2 C.struct_VkResolveImageInfo2
+
+// SizeofResolveImageInfo2 is the memory size of a ResolveImageInfo2
+var SizeofResolveImageInfo2 int = int(unsafe.Sizeof(ResolveImageInfo2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x ResolveImageInfo2) ArpPtr(arp *AutoReleasePool) *ResolveImageInfo2 {
+	ptr := newCBlock(cULong(SizeofResolveImageInfo2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*ResolveImageInfo2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *ResolveImageInfo2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x ResolveImageInfo2) AsCPtr() *ResolveImageInfo2 {
+	clone := (*ResolveImageInfo2)(newCBlock(cULong(SizeofResolveImageInfo2)))
+	*clone = x
+	return clone
+}
+
+// ResolveImageInfo2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func ResolveImageInfo2CSlice(arp *AutoReleasePool, x ...ResolveImageInfo2) []ResolveImageInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofResolveImageInfo2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*ResolveImageInfo2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// ResolveImageInfo2FreeCSlice releases the memory allocated by ResolveImageInfo2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func ResolveImageInfo2FreeCSlice(x []ResolveImageInfo2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// ResolveImageInfo2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. ResolveImageInfo2FreeCSlice must be called on the returned slice.
+func ResolveImageInfo2MakeCSlice(x ...ResolveImageInfo2) []ResolveImageInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofResolveImageInfo2 * len(x)
+	dst := unsafe.Slice((*ResolveImageInfo2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkResolveImageInfo2
+func (x ResolveImageInfo2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new ResolveImageInfo2 with the value of
+// SType to the value provided in the specification.
+func (x ResolveImageInfo2) WithDefaultSType() ResolveImageInfo2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_RESOLVE_IMAGE_INFO_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *ResolveImageInfo2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_RESOLVE_IMAGE_INFO_2)
+}
+
+// WithSType clones a new ResolveImageInfo2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ResolveImageInfo2) WithSType(y StructureType) ResolveImageInfo2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *ResolveImageInfo2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkResolveImageInfo2
+func (x ResolveImageInfo2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new ResolveImageInfo2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ResolveImageInfo2) WithPNext(y unsafe.Pointer) ResolveImageInfo2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *ResolveImageInfo2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ResolveImageInfo2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SrcImage returns the value of srcImage from VkResolveImageInfo2
+func (x ResolveImageInfo2) SrcImage() Image {
+	ptr := /* handle */ (*Image)(&x.srcImage)
+	return *ptr
+}
+
+// WithSrcImage clones a new ResolveImageInfo2 with the value of
+// SrcImage updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ResolveImageInfo2) WithSrcImage(y Image) ResolveImageInfo2 {
+	x.srcImage = *( /* handle */ (*C.VkImage)(&y))
+	return x
+}
+func (x *ResolveImageInfo2) SetSrcImage(y Image) {
+	x.srcImage = *( /* handle */ (*C.VkImage)(&y))
+}
+
+// SrcImageLayout returns the value of srcImageLayout from VkResolveImageInfo2
+func (x ResolveImageInfo2) SrcImageLayout() ImageLayout {
+	ptr := /* typedef */ (*ImageLayout)(&x.srcImageLayout)
+	return *ptr
+}
+
+// WithSrcImageLayout clones a new ResolveImageInfo2 with the value of
+// SrcImageLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ResolveImageInfo2) WithSrcImageLayout(y ImageLayout) ResolveImageInfo2 {
+	x.srcImageLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+	return x
+}
+func (x *ResolveImageInfo2) SetSrcImageLayout(y ImageLayout) {
+	x.srcImageLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+}
+
+// DstImage returns the value of dstImage from VkResolveImageInfo2
+func (x ResolveImageInfo2) DstImage() Image {
+	ptr := /* handle */ (*Image)(&x.dstImage)
+	return *ptr
+}
+
+// WithDstImage clones a new ResolveImageInfo2 with the value of
+// DstImage updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ResolveImageInfo2) WithDstImage(y Image) ResolveImageInfo2 {
+	x.dstImage = *( /* handle */ (*C.VkImage)(&y))
+	return x
+}
+func (x *ResolveImageInfo2) SetDstImage(y Image) {
+	x.dstImage = *( /* handle */ (*C.VkImage)(&y))
+}
+
+// DstImageLayout returns the value of dstImageLayout from VkResolveImageInfo2
+func (x ResolveImageInfo2) DstImageLayout() ImageLayout {
+	ptr := /* typedef */ (*ImageLayout)(&x.dstImageLayout)
+	return *ptr
+}
+
+// WithDstImageLayout clones a new ResolveImageInfo2 with the value of
+// DstImageLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ResolveImageInfo2) WithDstImageLayout(y ImageLayout) ResolveImageInfo2 {
+	x.dstImageLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+	return x
+}
+func (x *ResolveImageInfo2) SetDstImageLayout(y ImageLayout) {
+	x.dstImageLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+}
+
+// RegionCount returns the value of regionCount from VkResolveImageInfo2
+func (x ResolveImageInfo2) RegionCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.regionCount)
+	return *ptr
+}
+
+// WithRegionCount clones a new ResolveImageInfo2 with the value of
+// RegionCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x ResolveImageInfo2) WithRegionCount(y uint32) ResolveImageInfo2 {
+	x.regionCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *ResolveImageInfo2) SetRegionCount(y uint32) {
+	x.regionCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PRegions returns the value of pRegions from VkResolveImageInfo2
+func (x ResolveImageInfo2) PRegions() []ImageResolve2 {
+	if x.pRegions == nil {
+		return nil
+	}
+	return unsafe.Slice((*ImageResolve2)(unsafe.Pointer(x.pRegions)), x.regionCount)
+}
+
+// WithPRegions clones a new ResolveImageInfo2 with the value of
+// PRegions updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines RegionCount as the length of this field.
+// RegionCount is updated with the length of the new value.
+func (x ResolveImageInfo2) WithPRegions(y []ImageResolve2) ResolveImageInfo2 {
+	x.pRegions = *(func(x *[]ImageResolve2) **C.struct_VkImageResolve2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkImageResolve2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkImageResolve2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithRegionCount(uint32(len(y)))
+}
+func (x *ResolveImageInfo2) SetPRegions(y []ImageResolve2) {
+	x.pRegions = *(func(x *[]ImageResolve2) **C.struct_VkImageResolve2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkImageResolve2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkImageResolve2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetRegionCount(uint32(len(y)))
+}
+
+// PinPRegions pins the Go memory referenced by y with the AutoReleasePool
+// and sets PRegions, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *ResolveImageInfo2) PinPRegions(arp *AutoReleasePool, y []ImageResolve2) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPRegions(y)
+}
+
+// BlitImageInfo2 provides a go interface for VkBlitImageInfo2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkBlitImageInfo2.html
+type BlitImageInfo2 C.struct_VkBlitImageInfo2
+
+// SizeofBlitImageInfo2 is the memory size of a BlitImageInfo2
+var SizeofBlitImageInfo2 int = int(unsafe.Sizeof(BlitImageInfo2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x BlitImageInfo2) ArpPtr(arp *AutoReleasePool) *BlitImageInfo2 {
+	ptr := newCBlock(cULong(SizeofBlitImageInfo2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*BlitImageInfo2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *BlitImageInfo2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x BlitImageInfo2) AsCPtr() *BlitImageInfo2 {
+	clone := (*BlitImageInfo2)(newCBlock(cULong(SizeofBlitImageInfo2)))
+	*clone = x
+	return clone
+}
+
+// BlitImageInfo2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func BlitImageInfo2CSlice(arp *AutoReleasePool, x ...BlitImageInfo2) []BlitImageInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBlitImageInfo2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*BlitImageInfo2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// BlitImageInfo2FreeCSlice releases the memory allocated by BlitImageInfo2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func BlitImageInfo2FreeCSlice(x []BlitImageInfo2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// BlitImageInfo2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. BlitImageInfo2FreeCSlice must be called on the returned slice.
+func BlitImageInfo2MakeCSlice(x ...BlitImageInfo2) []BlitImageInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofBlitImageInfo2 * len(x)
+	dst := unsafe.Slice((*BlitImageInfo2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkBlitImageInfo2
+func (x BlitImageInfo2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new BlitImageInfo2 with the value of
+// SType to the value provided in the specification.
+func (x BlitImageInfo2) WithDefaultSType() BlitImageInfo2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_BLIT_IMAGE_INFO_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *BlitImageInfo2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_BLIT_IMAGE_INFO_2)
+}
+
+// WithSType clones a new BlitImageInfo2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BlitImageInfo2) WithSType(y StructureType) BlitImageInfo2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *BlitImageInfo2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkBlitImageInfo2
+func (x BlitImageInfo2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new BlitImageInfo2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BlitImageInfo2) WithPNext(y unsafe.Pointer) BlitImageInfo2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *BlitImageInfo2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *BlitImageInfo2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SrcImage returns the value of srcImage from VkBlitImageInfo2
+func (x BlitImageInfo2) SrcImage() Image {
+	ptr := /* handle */ (*Image)(&x.srcImage)
+	return *ptr
+}
+
+// WithSrcImage clones a new BlitImageInfo2 with the value of
+// SrcImage updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BlitImageInfo2) WithSrcImage(y Image) BlitImageInfo2 {
+	x.srcImage = *( /* handle */ (*C.VkImage)(&y))
+	return x
+}
+func (x *BlitImageInfo2) SetSrcImage(y Image) {
+	x.srcImage = *( /* handle */ (*C.VkImage)(&y))
+}
+
+// SrcImageLayout returns the value of srcImageLayout from VkBlitImageInfo2
+func (x BlitImageInfo2) SrcImageLayout() ImageLayout {
+	ptr := /* typedef */ (*ImageLayout)(&x.srcImageLayout)
+	return *ptr
+}
+
+// WithSrcImageLayout clones a new BlitImageInfo2 with the value of
+// SrcImageLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BlitImageInfo2) WithSrcImageLayout(y ImageLayout) BlitImageInfo2 {
+	x.srcImageLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+	return x
+}
+func (x *BlitImageInfo2) SetSrcImageLayout(y ImageLayout) {
+	x.srcImageLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+}
+
+// DstImage returns the value of dstImage from VkBlitImageInfo2
+func (x BlitImageInfo2) DstImage() Image {
+	ptr := /* handle */ (*Image)(&x.dstImage)
+	return *ptr
+}
+
+// WithDstImage clones a new BlitImageInfo2 with the value of
+// DstImage updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BlitImageInfo2) WithDstImage(y Image) BlitImageInfo2 {
+	x.dstImage = *( /* handle */ (*C.VkImage)(&y))
+	return x
+}
+func (x *BlitImageInfo2) SetDstImage(y Image) {
+	x.dstImage = *( /* handle */ (*C.VkImage)(&y))
+}
+
+// DstImageLayout returns the value of dstImageLayout from VkBlitImageInfo2
+func (x BlitImageInfo2) DstImageLayout() ImageLayout {
+	ptr := /* typedef */ (*ImageLayout)(&x.dstImageLayout)
+	return *ptr
+}
+
+// WithDstImageLayout clones a new BlitImageInfo2 with the value of
+// DstImageLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BlitImageInfo2) WithDstImageLayout(y ImageLayout) BlitImageInfo2 {
+	x.dstImageLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+	return x
+}
+func (x *BlitImageInfo2) SetDstImageLayout(y ImageLayout) {
+	x.dstImageLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+}
+
+// RegionCount returns the value of regionCount from VkBlitImageInfo2
+func (x BlitImageInfo2) RegionCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.regionCount)
+	return *ptr
+}
+
+// WithRegionCount clones a new BlitImageInfo2 with the value of
+// RegionCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BlitImageInfo2) WithRegionCount(y uint32) BlitImageInfo2 {
+	x.regionCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *BlitImageInfo2) SetRegionCount(y uint32) {
+	x.regionCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PRegions returns the value of pRegions from VkBlitImageInfo2
+func (x BlitImageInfo2) PRegions() []ImageBlit2 {
+	if x.pRegions == nil {
+		return nil
+	}
+	return unsafe.Slice((*ImageBlit2)(unsafe.Pointer(x.pRegions)), x.regionCount)
+}
+
+// WithPRegions clones a new BlitImageInfo2 with the value of
+// PRegions updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines RegionCount as the length of this field.
+// RegionCount is updated with the length of the new value.
+func (x BlitImageInfo2) WithPRegions(y []ImageBlit2) BlitImageInfo2 {
+	x.pRegions = *(func(x *[]ImageBlit2) **C.struct_VkImageBlit2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkImageBlit2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkImageBlit2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithRegionCount(uint32(len(y)))
+}
+func (x *BlitImageInfo2) SetPRegions(y []ImageBlit2) {
+	x.pRegions = *(func(x *[]ImageBlit2) **C.struct_VkImageBlit2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkImageBlit2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkImageBlit2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetRegionCount(uint32(len(y)))
+}
+
+// PinPRegions pins the Go memory referenced by y with the AutoReleasePool
+// and sets PRegions, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *BlitImageInfo2) PinPRegions(arp *AutoReleasePool, y []ImageBlit2) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPRegions(y)
+}
+
+// Filter returns the value of filter from VkBlitImageInfo2
+func (x BlitImageInfo2) Filter() Filter {
+	ptr := /* typedef */ (*Filter)(&x.filter)
+	return *ptr
+}
+
+// WithFilter clones a new BlitImageInfo2 with the value of
+// Filter updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x BlitImageInfo2) WithFilter(y Filter) BlitImageInfo2 {
+	x.filter = *( /* typedef */ (*C.VkFilter)(&y))
+	return x
+}
+func (x *BlitImageInfo2) SetFilter(y Filter) {
+	x.filter = *( /* typedef */ (*C.VkFilter)(&y))
+}
+
+// CopyImageToBufferInfo2 provides a go interface for VkCopyImageToBufferInfo2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkCopyImageToBufferInfo2.html
+type CopyImageToBufferInfo2 C.struct_VkCopyImageToBufferInfo2
+
+// SizeofCopyImageToBufferInfo2 is the memory size of a CopyImageToBufferInfo2
+var SizeofCopyImageToBufferInfo2 int = int(unsafe.Sizeof(CopyImageToBufferInfo2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x CopyImageToBufferInfo2) ArpPtr(arp *AutoReleasePool) *CopyImageToBufferInfo2 {
+	ptr := newCBlock(cULong(SizeofCopyImageToBufferInfo2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*CopyImageToBufferInfo2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *CopyImageToBufferInfo2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x CopyImageToBufferInfo2) AsCPtr() *CopyImageToBufferInfo2 {
+	clone := (*CopyImageToBufferInfo2)(newCBlock(cULong(SizeofCopyImageToBufferInfo2)))
+	*clone = x
+	return clone
+}
+
+// CopyImageToBufferInfo2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func CopyImageToBufferInfo2CSlice(arp *AutoReleasePool, x ...CopyImageToBufferInfo2) []CopyImageToBufferInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofCopyImageToBufferInfo2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*CopyImageToBufferInfo2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// CopyImageToBufferInfo2FreeCSlice releases the memory allocated by CopyImageToBufferInfo2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func CopyImageToBufferInfo2FreeCSlice(x []CopyImageToBufferInfo2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// CopyImageToBufferInfo2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. CopyImageToBufferInfo2FreeCSlice must be called on the returned slice.
+func CopyImageToBufferInfo2MakeCSlice(x ...CopyImageToBufferInfo2) []CopyImageToBufferInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofCopyImageToBufferInfo2 * len(x)
+	dst := unsafe.Slice((*CopyImageToBufferInfo2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkCopyImageToBufferInfo2
+func (x CopyImageToBufferInfo2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new CopyImageToBufferInfo2 with the value of
+// SType to the value provided in the specification.
+func (x CopyImageToBufferInfo2) WithDefaultSType() CopyImageToBufferInfo2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_COPY_IMAGE_TO_BUFFER_INFO_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *CopyImageToBufferInfo2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_COPY_IMAGE_TO_BUFFER_INFO_2)
+}
+
+// WithSType clones a new CopyImageToBufferInfo2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyImageToBufferInfo2) WithSType(y StructureType) CopyImageToBufferInfo2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *CopyImageToBufferInfo2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkCopyImageToBufferInfo2
+func (x CopyImageToBufferInfo2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new CopyImageToBufferInfo2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyImageToBufferInfo2) WithPNext(y unsafe.Pointer) CopyImageToBufferInfo2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *CopyImageToBufferInfo2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *CopyImageToBufferInfo2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SrcImage returns the value of srcImage from VkCopyImageToBufferInfo2
+func (x CopyImageToBufferInfo2) SrcImage() Image {
+	ptr := /* handle */ (*Image)(&x.srcImage)
+	return *ptr
+}
+
+// WithSrcImage clones a new CopyImageToBufferInfo2 with the value of
+// SrcImage updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyImageToBufferInfo2) WithSrcImage(y Image) CopyImageToBufferInfo2 {
+	x.srcImage = *( /* handle */ (*C.VkImage)(&y))
+	return x
+}
+func (x *CopyImageToBufferInfo2) SetSrcImage(y Image) {
+	x.srcImage = *( /* handle */ (*C.VkImage)(&y))
+}
+
+// SrcImageLayout returns the value of srcImageLayout from VkCopyImageToBufferInfo2
+func (x CopyImageToBufferInfo2) SrcImageLayout() ImageLayout {
+	ptr := /* typedef */ (*ImageLayout)(&x.srcImageLayout)
+	return *ptr
+}
+
+// WithSrcImageLayout clones a new CopyImageToBufferInfo2 with the value of
+// SrcImageLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyImageToBufferInfo2) WithSrcImageLayout(y ImageLayout) CopyImageToBufferInfo2 {
+	x.srcImageLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+	return x
+}
+func (x *CopyImageToBufferInfo2) SetSrcImageLayout(y ImageLayout) {
+	x.srcImageLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+}
+
+// DstBuffer returns the value of dstBuffer from VkCopyImageToBufferInfo2
+func (x CopyImageToBufferInfo2) DstBuffer() Buffer {
+	ptr := /* handle */ (*Buffer)(&x.dstBuffer)
+	return *ptr
+}
+
+// WithDstBuffer clones a new CopyImageToBufferInfo2 with the value of
+// DstBuffer updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyImageToBufferInfo2) WithDstBuffer(y Buffer) CopyImageToBufferInfo2 {
+	x.dstBuffer = *( /* handle */ (*C.VkBuffer)(&y))
+	return x
+}
+func (x *CopyImageToBufferInfo2) SetDstBuffer(y Buffer) {
+	x.dstBuffer = *( /* handle */ (*C.VkBuffer)(&y))
+}
+
+// RegionCount returns the value of regionCount from VkCopyImageToBufferInfo2
+func (x CopyImageToBufferInfo2) RegionCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.regionCount)
+	return *ptr
+}
+
+// WithRegionCount clones a new CopyImageToBufferInfo2 with the value of
+// RegionCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyImageToBufferInfo2) WithRegionCount(y uint32) CopyImageToBufferInfo2 {
+	x.regionCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *CopyImageToBufferInfo2) SetRegionCount(y uint32) {
+	x.regionCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PRegions returns the value of pRegions from VkCopyImageToBufferInfo2
+func (x CopyImageToBufferInfo2) PRegions() []BufferImageCopy2 {
+	if x.pRegions == nil {
+		return nil
+	}
+	return unsafe.Slice((*BufferImageCopy2)(unsafe.Pointer(x.pRegions)), x.regionCount)
+}
+
+// WithPRegions clones a new CopyImageToBufferInfo2 with the value of
+// PRegions updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines RegionCount as the length of this field.
+// RegionCount is updated with the length of the new value.
+func (x CopyImageToBufferInfo2) WithPRegions(y []BufferImageCopy2) CopyImageToBufferInfo2 {
+	x.pRegions = *(func(x *[]BufferImageCopy2) **C.struct_VkBufferImageCopy2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkBufferImageCopy2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkBufferImageCopy2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithRegionCount(uint32(len(y)))
+}
+func (x *CopyImageToBufferInfo2) SetPRegions(y []BufferImageCopy2) {
+	x.pRegions = *(func(x *[]BufferImageCopy2) **C.struct_VkBufferImageCopy2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkBufferImageCopy2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkBufferImageCopy2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetRegionCount(uint32(len(y)))
+}
+
+// PinPRegions pins the Go memory referenced by y with the AutoReleasePool
+// and sets PRegions, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *CopyImageToBufferInfo2) PinPRegions(arp *AutoReleasePool, y []BufferImageCopy2) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPRegions(y)
+}
+
+// CopyBufferToImageInfo2 provides a go interface for VkCopyBufferToImageInfo2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkCopyBufferToImageInfo2.html
+type CopyBufferToImageInfo2 C.struct_VkCopyBufferToImageInfo2
+
+// SizeofCopyBufferToImageInfo2 is the memory size of a CopyBufferToImageInfo2
+var SizeofCopyBufferToImageInfo2 int = int(unsafe.Sizeof(CopyBufferToImageInfo2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x CopyBufferToImageInfo2) ArpPtr(arp *AutoReleasePool) *CopyBufferToImageInfo2 {
+	ptr := newCBlock(cULong(SizeofCopyBufferToImageInfo2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*CopyBufferToImageInfo2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *CopyBufferToImageInfo2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x CopyBufferToImageInfo2) AsCPtr() *CopyBufferToImageInfo2 {
+	clone := (*CopyBufferToImageInfo2)(newCBlock(cULong(SizeofCopyBufferToImageInfo2)))
+	*clone = x
+	return clone
+}
+
+// CopyBufferToImageInfo2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func CopyBufferToImageInfo2CSlice(arp *AutoReleasePool, x ...CopyBufferToImageInfo2) []CopyBufferToImageInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofCopyBufferToImageInfo2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*CopyBufferToImageInfo2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// CopyBufferToImageInfo2FreeCSlice releases the memory allocated by CopyBufferToImageInfo2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func CopyBufferToImageInfo2FreeCSlice(x []CopyBufferToImageInfo2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// CopyBufferToImageInfo2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. CopyBufferToImageInfo2FreeCSlice must be called on the returned slice.
+func CopyBufferToImageInfo2MakeCSlice(x ...CopyBufferToImageInfo2) []CopyBufferToImageInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofCopyBufferToImageInfo2 * len(x)
+	dst := unsafe.Slice((*CopyBufferToImageInfo2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkCopyBufferToImageInfo2
+func (x CopyBufferToImageInfo2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new CopyBufferToImageInfo2 with the value of
+// SType to the value provided in the specification.
+func (x CopyBufferToImageInfo2) WithDefaultSType() CopyBufferToImageInfo2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_COPY_BUFFER_TO_IMAGE_INFO_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *CopyBufferToImageInfo2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_COPY_BUFFER_TO_IMAGE_INFO_2)
+}
+
+// WithSType clones a new CopyBufferToImageInfo2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyBufferToImageInfo2) WithSType(y StructureType) CopyBufferToImageInfo2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *CopyBufferToImageInfo2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkCopyBufferToImageInfo2
+func (x CopyBufferToImageInfo2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new CopyBufferToImageInfo2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyBufferToImageInfo2) WithPNext(y unsafe.Pointer) CopyBufferToImageInfo2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *CopyBufferToImageInfo2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *CopyBufferToImageInfo2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SrcBuffer returns the value of srcBuffer from VkCopyBufferToImageInfo2
+func (x CopyBufferToImageInfo2) SrcBuffer() Buffer {
+	ptr := /* handle */ (*Buffer)(&x.srcBuffer)
+	return *ptr
+}
+
+// WithSrcBuffer clones a new CopyBufferToImageInfo2 with the value of
+// SrcBuffer updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyBufferToImageInfo2) WithSrcBuffer(y Buffer) CopyBufferToImageInfo2 {
+	x.srcBuffer = *( /* handle */ (*C.VkBuffer)(&y))
+	return x
+}
+func (x *CopyBufferToImageInfo2) SetSrcBuffer(y Buffer) {
+	x.srcBuffer = *( /* handle */ (*C.VkBuffer)(&y))
+}
+
+// DstImage returns the value of dstImage from VkCopyBufferToImageInfo2
+func (x CopyBufferToImageInfo2) DstImage() Image {
+	ptr := /* handle */ (*Image)(&x.dstImage)
+	return *ptr
+}
+
+// WithDstImage clones a new CopyBufferToImageInfo2 with the value of
+// DstImage updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyBufferToImageInfo2) WithDstImage(y Image) CopyBufferToImageInfo2 {
+	x.dstImage = *( /* handle */ (*C.VkImage)(&y))
+	return x
+}
+func (x *CopyBufferToImageInfo2) SetDstImage(y Image) {
+	x.dstImage = *( /* handle */ (*C.VkImage)(&y))
+}
+
+// DstImageLayout returns the value of dstImageLayout from VkCopyBufferToImageInfo2
+func (x CopyBufferToImageInfo2) DstImageLayout() ImageLayout {
+	ptr := /* typedef */ (*ImageLayout)(&x.dstImageLayout)
+	return *ptr
+}
+
+// WithDstImageLayout clones a new CopyBufferToImageInfo2 with the value of
+// DstImageLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyBufferToImageInfo2) WithDstImageLayout(y ImageLayout) CopyBufferToImageInfo2 {
+	x.dstImageLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+	return x
+}
+func (x *CopyBufferToImageInfo2) SetDstImageLayout(y ImageLayout) {
+	x.dstImageLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+}
+
+// RegionCount returns the value of regionCount from VkCopyBufferToImageInfo2
+func (x CopyBufferToImageInfo2) RegionCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.regionCount)
+	return *ptr
+}
+
+// WithRegionCount clones a new CopyBufferToImageInfo2 with the value of
+// RegionCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyBufferToImageInfo2) WithRegionCount(y uint32) CopyBufferToImageInfo2 {
+	x.regionCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *CopyBufferToImageInfo2) SetRegionCount(y uint32) {
+	x.regionCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PRegions returns the value of pRegions from VkCopyBufferToImageInfo2
+func (x CopyBufferToImageInfo2) PRegions() []BufferImageCopy2 {
+	if x.pRegions == nil {
+		return nil
+	}
+	return unsafe.Slice((*BufferImageCopy2)(unsafe.Pointer(x.pRegions)), x.regionCount)
+}
+
+// WithPRegions clones a new CopyBufferToImageInfo2 with the value of
+// PRegions updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines RegionCount as the length of this field.
+// RegionCount is updated with the length of the new value.
+func (x CopyBufferToImageInfo2) WithPRegions(y []BufferImageCopy2) CopyBufferToImageInfo2 {
+	x.pRegions = *(func(x *[]BufferImageCopy2) **C.struct_VkBufferImageCopy2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkBufferImageCopy2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkBufferImageCopy2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithRegionCount(uint32(len(y)))
+}
+func (x *CopyBufferToImageInfo2) SetPRegions(y []BufferImageCopy2) {
+	x.pRegions = *(func(x *[]BufferImageCopy2) **C.struct_VkBufferImageCopy2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkBufferImageCopy2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkBufferImageCopy2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetRegionCount(uint32(len(y)))
+}
+
+// PinPRegions pins the Go memory referenced by y with the AutoReleasePool
+// and sets PRegions, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *CopyBufferToImageInfo2) PinPRegions(arp *AutoReleasePool, y []BufferImageCopy2) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPRegions(y)
+}
+
+// CopyImageInfo2 provides a go interface for VkCopyImageInfo2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkCopyImageInfo2.html
+type CopyImageInfo2 C.struct_VkCopyImageInfo2
+
+// SizeofCopyImageInfo2 is the memory size of a CopyImageInfo2
+var SizeofCopyImageInfo2 int = int(unsafe.Sizeof(CopyImageInfo2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x CopyImageInfo2) ArpPtr(arp *AutoReleasePool) *CopyImageInfo2 {
+	ptr := newCBlock(cULong(SizeofCopyImageInfo2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*CopyImageInfo2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *CopyImageInfo2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x CopyImageInfo2) AsCPtr() *CopyImageInfo2 {
+	clone := (*CopyImageInfo2)(newCBlock(cULong(SizeofCopyImageInfo2)))
+	*clone = x
+	return clone
+}
+
+// CopyImageInfo2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func CopyImageInfo2CSlice(arp *AutoReleasePool, x ...CopyImageInfo2) []CopyImageInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofCopyImageInfo2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*CopyImageInfo2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// CopyImageInfo2FreeCSlice releases the memory allocated by CopyImageInfo2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func CopyImageInfo2FreeCSlice(x []CopyImageInfo2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// CopyImageInfo2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. CopyImageInfo2FreeCSlice must be called on the returned slice.
+func CopyImageInfo2MakeCSlice(x ...CopyImageInfo2) []CopyImageInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofCopyImageInfo2 * len(x)
+	dst := unsafe.Slice((*CopyImageInfo2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkCopyImageInfo2
+func (x CopyImageInfo2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new CopyImageInfo2 with the value of
+// SType to the value provided in the specification.
+func (x CopyImageInfo2) WithDefaultSType() CopyImageInfo2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_COPY_IMAGE_INFO_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *CopyImageInfo2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_COPY_IMAGE_INFO_2)
+}
+
+// WithSType clones a new CopyImageInfo2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyImageInfo2) WithSType(y StructureType) CopyImageInfo2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *CopyImageInfo2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkCopyImageInfo2
+func (x CopyImageInfo2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new CopyImageInfo2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyImageInfo2) WithPNext(y unsafe.Pointer) CopyImageInfo2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *CopyImageInfo2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *CopyImageInfo2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SrcImage returns the value of srcImage from VkCopyImageInfo2
+func (x CopyImageInfo2) SrcImage() Image {
+	ptr := /* handle */ (*Image)(&x.srcImage)
+	return *ptr
+}
+
+// WithSrcImage clones a new CopyImageInfo2 with the value of
+// SrcImage updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyImageInfo2) WithSrcImage(y Image) CopyImageInfo2 {
+	x.srcImage = *( /* handle */ (*C.VkImage)(&y))
+	return x
+}
+func (x *CopyImageInfo2) SetSrcImage(y Image) {
+	x.srcImage = *( /* handle */ (*C.VkImage)(&y))
+}
+
+// SrcImageLayout returns the value of srcImageLayout from VkCopyImageInfo2
+func (x CopyImageInfo2) SrcImageLayout() ImageLayout {
+	ptr := /* typedef */ (*ImageLayout)(&x.srcImageLayout)
+	return *ptr
+}
+
+// WithSrcImageLayout clones a new CopyImageInfo2 with the value of
+// SrcImageLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyImageInfo2) WithSrcImageLayout(y ImageLayout) CopyImageInfo2 {
+	x.srcImageLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+	return x
+}
+func (x *CopyImageInfo2) SetSrcImageLayout(y ImageLayout) {
+	x.srcImageLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+}
+
+// DstImage returns the value of dstImage from VkCopyImageInfo2
+func (x CopyImageInfo2) DstImage() Image {
+	ptr := /* handle */ (*Image)(&x.dstImage)
+	return *ptr
+}
+
+// WithDstImage clones a new CopyImageInfo2 with the value of
+// DstImage updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyImageInfo2) WithDstImage(y Image) CopyImageInfo2 {
+	x.dstImage = *( /* handle */ (*C.VkImage)(&y))
+	return x
+}
+func (x *CopyImageInfo2) SetDstImage(y Image) {
+	x.dstImage = *( /* handle */ (*C.VkImage)(&y))
+}
+
+// DstImageLayout returns the value of dstImageLayout from VkCopyImageInfo2
+func (x CopyImageInfo2) DstImageLayout() ImageLayout {
+	ptr := /* typedef */ (*ImageLayout)(&x.dstImageLayout)
+	return *ptr
+}
+
+// WithDstImageLayout clones a new CopyImageInfo2 with the value of
+// DstImageLayout updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyImageInfo2) WithDstImageLayout(y ImageLayout) CopyImageInfo2 {
+	x.dstImageLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+	return x
+}
+func (x *CopyImageInfo2) SetDstImageLayout(y ImageLayout) {
+	x.dstImageLayout = *( /* typedef */ (*C.VkImageLayout)(&y))
+}
+
+// RegionCount returns the value of regionCount from VkCopyImageInfo2
+func (x CopyImageInfo2) RegionCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.regionCount)
+	return *ptr
+}
+
+// WithRegionCount clones a new CopyImageInfo2 with the value of
+// RegionCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyImageInfo2) WithRegionCount(y uint32) CopyImageInfo2 {
+	x.regionCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *CopyImageInfo2) SetRegionCount(y uint32) {
+	x.regionCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PRegions returns the value of pRegions from VkCopyImageInfo2
+func (x CopyImageInfo2) PRegions() []ImageCopy2 {
+	if x.pRegions == nil {
+		return nil
+	}
+	return unsafe.Slice((*ImageCopy2)(unsafe.Pointer(x.pRegions)), x.regionCount)
+}
+
+// WithPRegions clones a new CopyImageInfo2 with the value of
+// PRegions updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines RegionCount as the length of this field.
+// RegionCount is updated with the length of the new value.
+func (x CopyImageInfo2) WithPRegions(y []ImageCopy2) CopyImageInfo2 {
+	x.pRegions = *(func(x *[]ImageCopy2) **C.struct_VkImageCopy2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkImageCopy2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkImageCopy2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithRegionCount(uint32(len(y)))
+}
+func (x *CopyImageInfo2) SetPRegions(y []ImageCopy2) {
+	x.pRegions = *(func(x *[]ImageCopy2) **C.struct_VkImageCopy2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkImageCopy2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkImageCopy2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetRegionCount(uint32(len(y)))
+}
+
+// PinPRegions pins the Go memory referenced by y with the AutoReleasePool
+// and sets PRegions, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *CopyImageInfo2) PinPRegions(arp *AutoReleasePool, y []ImageCopy2) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPRegions(y)
+}
+
+// CopyBufferInfo2 provides a go interface for VkCopyBufferInfo2.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkCopyBufferInfo2.html
+type CopyBufferInfo2 C.struct_VkCopyBufferInfo2
+
+// SizeofCopyBufferInfo2 is the memory size of a CopyBufferInfo2
+var SizeofCopyBufferInfo2 int = int(unsafe.Sizeof(CopyBufferInfo2{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x CopyBufferInfo2) ArpPtr(arp *AutoReleasePool) *CopyBufferInfo2 {
+	ptr := newCBlock(cULong(SizeofCopyBufferInfo2))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*CopyBufferInfo2)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *CopyBufferInfo2) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x CopyBufferInfo2) AsCPtr() *CopyBufferInfo2 {
+	clone := (*CopyBufferInfo2)(newCBlock(cULong(SizeofCopyBufferInfo2)))
+	*clone = x
+	return clone
+}
+
+// CopyBufferInfo2CSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func CopyBufferInfo2CSlice(arp *AutoReleasePool, x ...CopyBufferInfo2) []CopyBufferInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofCopyBufferInfo2 * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*CopyBufferInfo2)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// CopyBufferInfo2FreeCSlice releases the memory allocated by CopyBufferInfo2MakeCSlice.
+// It does not free pointers stored inside the slice.
+func CopyBufferInfo2FreeCSlice(x []CopyBufferInfo2) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// CopyBufferInfo2MakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. CopyBufferInfo2FreeCSlice must be called on the returned slice.
+func CopyBufferInfo2MakeCSlice(x ...CopyBufferInfo2) []CopyBufferInfo2 {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofCopyBufferInfo2 * len(x)
+	dst := unsafe.Slice((*CopyBufferInfo2)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkCopyBufferInfo2
+func (x CopyBufferInfo2) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new CopyBufferInfo2 with the value of
+// SType to the value provided in the specification.
+func (x CopyBufferInfo2) WithDefaultSType() CopyBufferInfo2 {
+	return x.WithSType(VK_STRUCTURE_TYPE_COPY_BUFFER_INFO_2)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *CopyBufferInfo2) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_COPY_BUFFER_INFO_2)
+}
+
+// WithSType clones a new CopyBufferInfo2 with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyBufferInfo2) WithSType(y StructureType) CopyBufferInfo2 {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *CopyBufferInfo2) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkCopyBufferInfo2
+func (x CopyBufferInfo2) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new CopyBufferInfo2 with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyBufferInfo2) WithPNext(y unsafe.Pointer) CopyBufferInfo2 {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *CopyBufferInfo2) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *CopyBufferInfo2) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// SrcBuffer returns the value of srcBuffer from VkCopyBufferInfo2
+func (x CopyBufferInfo2) SrcBuffer() Buffer {
+	ptr := /* handle */ (*Buffer)(&x.srcBuffer)
+	return *ptr
+}
+
+// WithSrcBuffer clones a new CopyBufferInfo2 with the value of
+// SrcBuffer updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyBufferInfo2) WithSrcBuffer(y Buffer) CopyBufferInfo2 {
+	x.srcBuffer = *( /* handle */ (*C.VkBuffer)(&y))
+	return x
+}
+func (x *CopyBufferInfo2) SetSrcBuffer(y Buffer) {
+	x.srcBuffer = *( /* handle */ (*C.VkBuffer)(&y))
+}
+
+// DstBuffer returns the value of dstBuffer from VkCopyBufferInfo2
+func (x CopyBufferInfo2) DstBuffer() Buffer {
+	ptr := /* handle */ (*Buffer)(&x.dstBuffer)
+	return *ptr
+}
+
+// WithDstBuffer clones a new CopyBufferInfo2 with the value of
+// DstBuffer updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyBufferInfo2) WithDstBuffer(y Buffer) CopyBufferInfo2 {
+	x.dstBuffer = *( /* handle */ (*C.VkBuffer)(&y))
+	return x
+}
+func (x *CopyBufferInfo2) SetDstBuffer(y Buffer) {
+	x.dstBuffer = *( /* handle */ (*C.VkBuffer)(&y))
+}
+
+// RegionCount returns the value of regionCount from VkCopyBufferInfo2
+func (x CopyBufferInfo2) RegionCount() uint32 {
+	ptr := func(x *C.uint32_t) *uint32 { /* Scalar */ c2g := uint32(*x); return &c2g }(&x.regionCount)
+	return *ptr
+}
+
+// WithRegionCount clones a new CopyBufferInfo2 with the value of
+// RegionCount updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x CopyBufferInfo2) WithRegionCount(y uint32) CopyBufferInfo2 {
+	x.regionCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+	return x
+}
+func (x *CopyBufferInfo2) SetRegionCount(y uint32) {
+	x.regionCount = *(func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&y))
+}
+
+// PRegions returns the value of pRegions from VkCopyBufferInfo2
+func (x CopyBufferInfo2) PRegions() []BufferCopy2 {
+	if x.pRegions == nil {
+		return nil
+	}
+	return unsafe.Slice((*BufferCopy2)(unsafe.Pointer(x.pRegions)), x.regionCount)
+}
+
+// WithPRegions clones a new CopyBufferInfo2 with the value of
+// PRegions updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+//
+// The specification defines RegionCount as the length of this field.
+// RegionCount is updated with the length of the new value.
+func (x CopyBufferInfo2) WithPRegions(y []BufferCopy2) CopyBufferInfo2 {
+	x.pRegions = *(func(x *[]BufferCopy2) **C.struct_VkBufferCopy2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkBufferCopy2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkBufferCopy2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	return x.WithRegionCount(uint32(len(y)))
+}
+func (x *CopyBufferInfo2) SetPRegions(y []BufferCopy2) {
+	x.pRegions = *(func(x *[]BufferCopy2) **C.struct_VkBufferCopy2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkBufferCopy2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkBufferCopy2)(unsafe.Pointer((&ptr)))
+	}(&y))
+	x.SetRegionCount(uint32(len(y)))
+}
+
+// PinPRegions pins the Go memory referenced by y with the AutoReleasePool
+// and sets PRegions, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *CopyBufferInfo2) PinPRegions(arp *AutoReleasePool, y []BufferCopy2) {
+	if len(y) > 0 {
+		arp.Pin(unsafe.Pointer(&y[0]))
+	}
+	x.SetPRegions(y)
+}
+
+// PhysicalDeviceImageRobustnessFeatures provides a go interface for VkPhysicalDeviceImageRobustnessFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceImageRobustnessFeatures.html
+type PhysicalDeviceImageRobustnessFeatures C.struct_VkPhysicalDeviceImageRobustnessFeatures
+
+// SizeofPhysicalDeviceImageRobustnessFeatures is the memory size of a PhysicalDeviceImageRobustnessFeatures
+var SizeofPhysicalDeviceImageRobustnessFeatures int = int(unsafe.Sizeof(PhysicalDeviceImageRobustnessFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceImageRobustnessFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceImageRobustnessFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceImageRobustnessFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceImageRobustnessFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceImageRobustnessFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceImageRobustnessFeatures) AsCPtr() *PhysicalDeviceImageRobustnessFeatures {
+	clone := (*PhysicalDeviceImageRobustnessFeatures)(newCBlock(cULong(SizeofPhysicalDeviceImageRobustnessFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceImageRobustnessFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceImageRobustnessFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceImageRobustnessFeatures) []PhysicalDeviceImageRobustnessFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceImageRobustnessFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceImageRobustnessFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceImageRobustnessFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceImageRobustnessFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceImageRobustnessFeaturesFreeCSlice(x []PhysicalDeviceImageRobustnessFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceImageRobustnessFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceImageRobustnessFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceImageRobustnessFeaturesMakeCSlice(x ...PhysicalDeviceImageRobustnessFeatures) []PhysicalDeviceImageRobustnessFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceImageRobustnessFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceImageRobustnessFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceImageRobustnessFeatures
+func (x PhysicalDeviceImageRobustnessFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceImageRobustnessFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceImageRobustnessFeatures) WithDefaultSType() PhysicalDeviceImageRobustnessFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ROBUSTNESS_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceImageRobustnessFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ROBUSTNESS_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceImageRobustnessFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceImageRobustnessFeatures) WithSType(y StructureType) PhysicalDeviceImageRobustnessFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceImageRobustnessFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceImageRobustnessFeatures
+func (x PhysicalDeviceImageRobustnessFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceImageRobustnessFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceImageRobustnessFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceImageRobustnessFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceImageRobustnessFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceImageRobustnessFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// RobustImageAccess returns the value of robustImageAccess from VkPhysicalDeviceImageRobustnessFeatures
+func (x PhysicalDeviceImageRobustnessFeatures) RobustImageAccess() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.robustImageAccess)
+	return *ptr
+}
+
+// WithRobustImageAccess clones a new PhysicalDeviceImageRobustnessFeatures with the value of
+// RobustImageAccess updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceImageRobustnessFeatures) WithRobustImageAccess(y Bool32) PhysicalDeviceImageRobustnessFeatures {
+	x.robustImageAccess = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceImageRobustnessFeatures) SetRobustImageAccess(y Bool32) {
+	x.robustImageAccess = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures provides a go interface for VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures.
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures.html
+type PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures C.struct_VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures
+
+// SizeofPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures is the memory size of a PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures
+var SizeofPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures int = int(unsafe.Sizeof(PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures{}))
+
+// ArpPtr copies the object to the C heap and returns the pointer.  The
+// AutoReleasePool is responsible for releasing the C memory.
+func (x PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures) ArpPtr(arp *AutoReleasePool) *PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures {
+	ptr := newCBlock(cULong(SizeofPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	clone := (*PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures)(ptr)
+	*clone = x
+	return clone
+}
+
+// Free releases the memory allocated by AsCPtr.
+// It does not free pointers stored in the structure.
+func (x *PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures) Free() {
+	C.free(unsafe.Pointer(x))
+}
+
+// AsCPtr copies the object to the C heap and returns the pointer.
+// Free must be explicitly called on the returned pointer.
+func (x PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures) AsCPtr() *PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures {
+	clone := (*PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures)(newCBlock(cULong(SizeofPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures)))
+	*clone = x
+	return clone
+}
+
+// PhysicalDeviceZeroInitializeWorkgroupMemoryFeaturesCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. The AutoReleasePool is responsible for releasing the C memory.
+func PhysicalDeviceZeroInitializeWorkgroupMemoryFeaturesCSlice(arp *AutoReleasePool, x ...PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures) []PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures * len(x)
+	ptr := newCBlock(cULong(sz))
+	if arp != nil {
+		arp.Add(cFreer(uintptr(ptr)))
+	}
+	dst := unsafe.Slice((*PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures)(ptr), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// PhysicalDeviceZeroInitializeWorkgroupMemoryFeaturesFreeCSlice releases the memory allocated by PhysicalDeviceZeroInitializeWorkgroupMemoryFeaturesMakeCSlice.
+// It does not free pointers stored inside the slice.
+func PhysicalDeviceZeroInitializeWorkgroupMemoryFeaturesFreeCSlice(x []PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures) {
+	if len(x) > 0 {
+		C.free(unsafe.Pointer(&x[0]))
+	}
+}
+
+// PhysicalDeviceZeroInitializeWorkgroupMemoryFeaturesMakeCSlice allocates memory for the passed arguments on the C heap,
+// copies their values to the allocated memory, and creates a slice around the
+// C memory. PhysicalDeviceZeroInitializeWorkgroupMemoryFeaturesFreeCSlice must be called on the returned slice.
+func PhysicalDeviceZeroInitializeWorkgroupMemoryFeaturesMakeCSlice(x ...PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures) []PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures {
+	if len(x) == 0 {
+		return nil
+	}
+	sz := SizeofPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures * len(x)
+	dst := unsafe.Slice((*PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures)(newCBlock(cULong(sz))), len(x))
+	copy(dst, x)
+	return dst
+}
+
+// SType returns the value of sType from VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures
+func (x PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures) SType() StructureType {
+	ptr := /* typedef */ (*StructureType)(&x.sType)
+	return *ptr
+}
+
+// WithDefaultSType clones a new PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures with the value of
+// SType to the value provided in the specification.
+func (x PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures) WithDefaultSType() PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures {
+	return x.WithSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ZERO_INITIALIZE_WORKGROUP_MEMORY_FEATURES)
+}
+
+// SetDefaultSType sets the value of SType to the value provided in the
+// specification.
+func (x *PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures) SetDefaultSType() {
+	x.SetSType(VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ZERO_INITIALIZE_WORKGROUP_MEMORY_FEATURES)
+}
+
+// WithSType clones a new PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures with the value of
+// SType updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures) WithSType(y StructureType) PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+	return x
+}
+func (x *PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures) SetSType(y StructureType) {
+	x.sType = *( /* typedef */ (*C.VkStructureType)(&y))
+}
+
+// PNext returns the value of pNext from VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures
+func (x PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures) PNext() unsafe.Pointer {
+	ptr := func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ c2g := unsafe.Pointer(*x); return &c2g }(&x.pNext)
+	return *ptr
+}
+
+// WithPNext clones a new PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures with the value of
+// PNext updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures) WithPNext(y unsafe.Pointer) PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+	return x
+}
+func (x *PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures) SetPNext(y unsafe.Pointer) {
+	x.pNext = *(func(x *unsafe.Pointer) *unsafe.Pointer { /* Scalar */ g2c := unsafe.Pointer(*x); return &g2c }(&y))
+}
+
+// PinPNext pins the Go memory referenced by y with the AutoReleasePool
+// and sets PNext, so the structure can be passed to C without copying
+// y to the C heap. Only the memory y references directly is pinned; it must
+// not be C memory.
+func (x *PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures) PinPNext(arp *AutoReleasePool, y unsafe.Pointer) {
+	arp.Pin(y)
+	x.SetPNext(y)
+}
+
+// ShaderZeroInitializeWorkgroupMemory returns the value of shaderZeroInitializeWorkgroupMemory from VkPhysicalDeviceZeroInitializeWorkgroupMemoryFeatures
+func (x PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures) ShaderZeroInitializeWorkgroupMemory() Bool32 {
+	ptr := /* typedef */ (*Bool32)(&x.shaderZeroInitializeWorkgroupMemory)
+	return *ptr
+}
+
+// WithShaderZeroInitializeWorkgroupMemory clones a new PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures with the value of
+// ShaderZeroInitializeWorkgroupMemory updated on the underlying C structure.
+// It performs whatever conversions are necessary to match the C API.
+func (x PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures) WithShaderZeroInitializeWorkgroupMemory(y Bool32) PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures {
+	x.shaderZeroInitializeWorkgroupMemory = *( /* typedef */ (*C.VkBool32)(&y))
+	return x
+}
+func (x *PhysicalDeviceZeroInitializeWorkgroupMemoryFeatures) SetShaderZeroInitializeWorkgroupMemory(y Bool32) {
+	x.shaderZeroInitializeWorkgroupMemory = *( /* typedef */ (*C.VkBool32)(&y))
+}
+
+// CmdWriteTimestamp2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdWriteTimestamp2.html
+func (x CommandBufferFacade) CmdWriteTimestamp2(stage PipelineStageFlags2, queryPool QueryPool, query uint32) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := /* typedef */ (*C.VkPipelineStageFlags2)(&stage)
+	p2 := /* handle */ (*C.VkQueryPool)(&queryPool)
+	p3 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&query)
+	C.vkCmdWriteTimestamp2(addrs, *p0, *p1, *p2, *p3)
+}
+
+// CmdCopyImage2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdCopyImage2.html
+func (x CommandBufferFacade) CmdCopyImage2(pCopyImageInfo *CopyImageInfo2) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := func(x **CopyImageInfo2) **C.struct_VkCopyImageInfo2 { /* Pointer */
+		g2c := (*C.struct_VkCopyImageInfo2)(*x)
+		return &g2c
+	}(&pCopyImageInfo)
+	C.vkCmdCopyImage2(addrs, *p0, *p1)
+}
+
+// CmdSetDepthBoundsTestEnable command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdSetDepthBoundsTestEnable.html
+func (x CommandBufferFacade) CmdSetDepthBoundsTestEnable(depthBoundsTestEnable Bool32) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := /* typedef */ (*C.VkBool32)(&depthBoundsTestEnable)
+	C.vkCmdSetDepthBoundsTestEnable(addrs, *p0, *p1)
+}
+
+// CmdSetStencilOp command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdSetStencilOp.html
+func (x CommandBufferFacade) CmdSetStencilOp(faceMask StencilFaceFlags, failOp StencilOp, passOp StencilOp, depthFailOp StencilOp, compareOp CompareOp) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := /* typedef */ (*C.VkStencilFaceFlags)(&faceMask)
+	p2 := /* typedef */ (*C.VkStencilOp)(&failOp)
+	p3 := /* typedef */ (*C.VkStencilOp)(&passOp)
+	p4 := /* typedef */ (*C.VkStencilOp)(&depthFailOp)
+	p5 := /* typedef */ (*C.VkCompareOp)(&compareOp)
+	C.vkCmdSetStencilOp(addrs, *p0, *p1, *p2, *p3, *p4, *p5)
+}
+
+// CmdSetDepthWriteEnable command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdSetDepthWriteEnable.html
+func (x CommandBufferFacade) CmdSetDepthWriteEnable(depthWriteEnable Bool32) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := /* typedef */ (*C.VkBool32)(&depthWriteEnable)
+	C.vkCmdSetDepthWriteEnable(addrs, *p0, *p1)
+}
+
+// CmdSetDepthTestEnable command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdSetDepthTestEnable.html
+func (x CommandBufferFacade) CmdSetDepthTestEnable(depthTestEnable Bool32) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := /* typedef */ (*C.VkBool32)(&depthTestEnable)
+	C.vkCmdSetDepthTestEnable(addrs, *p0, *p1)
+}
+
+// CmdBindVertexBuffers2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdBindVertexBuffers2.html
+func (x CommandBufferFacade) CmdBindVertexBuffers2(firstBinding uint32, bindingCount uint32, pBuffers []Buffer, pOffsets []DeviceSize, pSizes []DeviceSize, pStrides []DeviceSize) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&firstBinding)
+	p2 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&bindingCount)
+	p3 := func(x *[]Buffer) **C.VkBuffer { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkBuffer)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkBuffer)(unsafe.Pointer((&ptr)))
+	}(&pBuffers)
+	p4 := func(x *[]DeviceSize) **C.VkDeviceSize { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkDeviceSize)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkDeviceSize)(unsafe.Pointer((&ptr)))
+	}(&pOffsets)
+	p5 := func(x *[]DeviceSize) **C.VkDeviceSize { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkDeviceSize)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkDeviceSize)(unsafe.Pointer((&ptr)))
+	}(&pSizes)
+	p6 := func(x *[]DeviceSize) **C.VkDeviceSize { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkDeviceSize)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkDeviceSize)(unsafe.Pointer((&ptr)))
+	}(&pStrides)
+	C.vkCmdBindVertexBuffers2(addrs, *p0, *p1, *p2, *p3, *p4, *p5, *p6)
+}
+
+// CmdSetScissorWithCount command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdSetScissorWithCount.html
+func (x CommandBufferFacade) CmdSetScissorWithCount(scissorCount uint32, pScissors []Rect2D) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&scissorCount)
+	p2 := func(x *[]Rect2D) **C.struct_VkRect2D { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkRect2D)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkRect2D)(unsafe.Pointer((&ptr)))
+	}(&pScissors)
+	C.vkCmdSetScissorWithCount(addrs, *p0, *p1, *p2)
+}
+
+// CmdSetViewportWithCount command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdSetViewportWithCount.html
+func (x CommandBufferFacade) CmdSetViewportWithCount(viewportCount uint32, pViewports []Viewport) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&viewportCount)
+	p2 := func(x *[]Viewport) **C.struct_VkViewport { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkViewport)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkViewport)(unsafe.Pointer((&ptr)))
+	}(&pViewports)
+	C.vkCmdSetViewportWithCount(addrs, *p0, *p1, *p2)
+}
+
+// CmdSetPrimitiveTopology command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdSetPrimitiveTopology.html
+func (x CommandBufferFacade) CmdSetPrimitiveTopology(primitiveTopology PrimitiveTopology) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := /* typedef */ (*C.VkPrimitiveTopology)(&primitiveTopology)
+	C.vkCmdSetPrimitiveTopology(addrs, *p0, *p1)
+}
+
+// CmdSetFrontFace command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdSetFrontFace.html
+func (x CommandBufferFacade) CmdSetFrontFace(frontFace FrontFace) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := /* typedef */ (*C.VkFrontFace)(&frontFace)
+	C.vkCmdSetFrontFace(addrs, *p0, *p1)
+}
+
+// CmdSetCullMode command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdSetCullMode.html
+func (x CommandBufferFacade) CmdSetCullMode(cullMode CullModeFlags) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := /* typedef */ (*C.VkCullModeFlags)(&cullMode)
+	C.vkCmdSetCullMode(addrs, *p0, *p1)
+}
+
+// CmdSetEvent2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdSetEvent2.html
+func (x CommandBufferFacade) CmdSetEvent2(event Event, pDependencyInfo *DependencyInfo) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := /* handle */ (*C.VkEvent)(&event)
+	p2 := func(x **DependencyInfo) **C.struct_VkDependencyInfo { /* Pointer */
+		g2c := (*C.struct_VkDependencyInfo)(*x)
+		return &g2c
+	}(&pDependencyInfo)
+	C.vkCmdSetEvent2(addrs, *p0, *p1, *p2)
+}
+
+// CmdEndRendering command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdEndRendering.html
+func (x CommandBufferFacade) CmdEndRendering() {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	C.vkCmdEndRendering(addrs, *p0)
+}
+
+// CmdBeginRendering command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdBeginRendering.html
+func (x CommandBufferFacade) CmdBeginRendering(pRenderingInfo *RenderingInfo) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := func(x **RenderingInfo) **C.struct_VkRenderingInfo { /* Pointer */
+		g2c := (*C.struct_VkRenderingInfo)(*x)
+		return &g2c
+	}(&pRenderingInfo)
+	C.vkCmdBeginRendering(addrs, *p0, *p1)
+}
+
+// CmdResetEvent2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdResetEvent2.html
+func (x CommandBufferFacade) CmdResetEvent2(event Event, stageMask PipelineStageFlags2) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := /* handle */ (*C.VkEvent)(&event)
+	p2 := /* typedef */ (*C.VkPipelineStageFlags2)(&stageMask)
+	C.vkCmdResetEvent2(addrs, *p0, *p1, *p2)
+}
+
+// CmdWaitEvents2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdWaitEvents2.html
+func (x CommandBufferFacade) CmdWaitEvents2(eventCount uint32, pEvents []Event, pDependencyInfos []DependencyInfo) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&eventCount)
+	p2 := func(x *[]Event) **C.VkEvent { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.VkEvent)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.VkEvent)(unsafe.Pointer((&ptr)))
+	}(&pEvents)
+	p3 := func(x *[]DependencyInfo) **C.struct_VkDependencyInfo { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkDependencyInfo)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkDependencyInfo)(unsafe.Pointer((&ptr)))
+	}(&pDependencyInfos)
+	C.vkCmdWaitEvents2(addrs, *p0, *p1, *p2, *p3)
+}
+
+// CmdPipelineBarrier2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdPipelineBarrier2.html
+func (x CommandBufferFacade) CmdPipelineBarrier2(pDependencyInfo *DependencyInfo) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := func(x **DependencyInfo) **C.struct_VkDependencyInfo { /* Pointer */
+		g2c := (*C.struct_VkDependencyInfo)(*x)
+		return &g2c
+	}(&pDependencyInfo)
+	C.vkCmdPipelineBarrier2(addrs, *p0, *p1)
+}
+
+// CmdSetDepthCompareOp command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdSetDepthCompareOp.html
+func (x CommandBufferFacade) CmdSetDepthCompareOp(depthCompareOp CompareOp) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := /* typedef */ (*C.VkCompareOp)(&depthCompareOp)
+	C.vkCmdSetDepthCompareOp(addrs, *p0, *p1)
+}
+
+// CmdSetStencilTestEnable command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdSetStencilTestEnable.html
+func (x CommandBufferFacade) CmdSetStencilTestEnable(stencilTestEnable Bool32) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := /* typedef */ (*C.VkBool32)(&stencilTestEnable)
+	C.vkCmdSetStencilTestEnable(addrs, *p0, *p1)
+}
+
+// CmdSetPrimitiveRestartEnable command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdSetPrimitiveRestartEnable.html
+func (x CommandBufferFacade) CmdSetPrimitiveRestartEnable(primitiveRestartEnable Bool32) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := /* typedef */ (*C.VkBool32)(&primitiveRestartEnable)
+	C.vkCmdSetPrimitiveRestartEnable(addrs, *p0, *p1)
+}
+
+// CmdSetDepthBiasEnable command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdSetDepthBiasEnable.html
+func (x CommandBufferFacade) CmdSetDepthBiasEnable(depthBiasEnable Bool32) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := /* typedef */ (*C.VkBool32)(&depthBiasEnable)
+	C.vkCmdSetDepthBiasEnable(addrs, *p0, *p1)
+}
+
+// QueueSubmit2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkQueueSubmit2.html
+func (x QueueFacade) QueueSubmit2(submitCount uint32, pSubmits []SubmitInfo2, fence Fence) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkQueue)(&x.H)
+	p1 := func(x *uint32) *C.uint32_t { /* Scalar */ g2c := C.uint32_t(*x); return &g2c }(&submitCount)
+	p2 := func(x *[]SubmitInfo2) **C.struct_VkSubmitInfo2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkSubmitInfo2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkSubmitInfo2)(unsafe.Pointer((&ptr)))
+	}(&pSubmits)
+	p3 := /* handle */ (*C.VkFence)(&fence)
+	ret := C.vkQueueSubmit2(addrs, *p0, *p1, *p2, *p3)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetPhysicalDeviceToolProperties command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPhysicalDeviceToolProperties.html
+func (x PhysicalDeviceFacade) GetPhysicalDeviceToolProperties(pToolCount *uint32, pToolProperties []PhysicalDeviceToolProperties) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	p1 := func(x **uint32) **C.uint32_t { /* Pointer */ g2c := (*C.uint32_t)(*x); return &g2c }(&pToolCount)
+	p2 := func(x *[]PhysicalDeviceToolProperties) **C.struct_VkPhysicalDeviceToolProperties { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkPhysicalDeviceToolProperties)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkPhysicalDeviceToolProperties)(unsafe.Pointer((&ptr)))
+	}(&pToolProperties)
+	ret := C.vkGetPhysicalDeviceToolProperties(addrs, *p0, *p1, *p2)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// GetPhysicalDeviceToolPropertiesInto calls GetPhysicalDeviceToolProperties with the count query, the fill and
+// the VK_INCOMPLETE retries in a single cgo call. The elements are stored in
+// dst, reallocated only when its capacity is too small, and returned.
+// The sType of every element is set; pNext is passed through.
+func (x PhysicalDeviceFacade) GetPhysicalDeviceToolPropertiesInto(dst []PhysicalDeviceToolProperties) ([]PhysicalDeviceToolProperties, Result) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkPhysicalDevice)(&x.H)
+	for {
+		dst = dst[:cap(dst)]
+		var items *C.struct_VkPhysicalDeviceToolProperties
+		if len(dst) > 0 {
+			items = (*C.struct_VkPhysicalDeviceToolProperties)(unsafe.Pointer(&dst[0]))
+		}
+		ret := C.vksEnumerate_vkGetPhysicalDeviceToolProperties(addrs, C.uint64_t(uintptr(unsafe.Pointer(*p0))), C.uint32_t(len(dst)), items)
+		if Result(ret.result) == VK_INCOMPLETE && int(ret.count) > len(dst) {
+			dst = make([]PhysicalDeviceToolProperties, ret.count)
+			continue
+		}
+		return dst[:ret.count], Result(ret.result)
+	}
+}
+
+// CmdResolveImage2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdResolveImage2.html
+func (x CommandBufferFacade) CmdResolveImage2(pResolveImageInfo *ResolveImageInfo2) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := func(x **ResolveImageInfo2) **C.struct_VkResolveImageInfo2 { /* Pointer */
+		g2c := (*C.struct_VkResolveImageInfo2)(*x)
+		return &g2c
+	}(&pResolveImageInfo)
+	C.vkCmdResolveImage2(addrs, *p0, *p1)
+}
+
+// GetDeviceBufferMemoryRequirements command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetDeviceBufferMemoryRequirements.html
+func (x DeviceFacade) GetDeviceBufferMemoryRequirements(pInfo *DeviceBufferMemoryRequirements, pMemoryRequirements *MemoryRequirements2) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **DeviceBufferMemoryRequirements) **C.struct_VkDeviceBufferMemoryRequirements { /* Pointer */
+		g2c := (*C.struct_VkDeviceBufferMemoryRequirements)(*x)
+		return &g2c
+	}(&pInfo)
+	p2 := func(x **MemoryRequirements2) **C.struct_VkMemoryRequirements2 { /* Pointer */
+		g2c := (*C.struct_VkMemoryRequirements2)(*x)
+		return &g2c
+	}(&pMemoryRequirements)
+	C.vkGetDeviceBufferMemoryRequirements(addrs, *p0, *p1, *p2)
+}
+
+// GetDeviceImageMemoryRequirements command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetDeviceImageMemoryRequirements.html
+func (x DeviceFacade) GetDeviceImageMemoryRequirements(pInfo *DeviceImageMemoryRequirements, pMemoryRequirements *MemoryRequirements2) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **DeviceImageMemoryRequirements) **C.struct_VkDeviceImageMemoryRequirements { /* Pointer */
+		g2c := (*C.struct_VkDeviceImageMemoryRequirements)(*x)
+		return &g2c
+	}(&pInfo)
+	p2 := func(x **MemoryRequirements2) **C.struct_VkMemoryRequirements2 { /* Pointer */
+		g2c := (*C.struct_VkMemoryRequirements2)(*x)
+		return &g2c
+	}(&pMemoryRequirements)
+	C.vkGetDeviceImageMemoryRequirements(addrs, *p0, *p1, *p2)
+}
+
+// GetDeviceImageSparseMemoryRequirements command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetDeviceImageSparseMemoryRequirements.html
+func (x DeviceFacade) GetDeviceImageSparseMemoryRequirements(pInfo *DeviceImageMemoryRequirements, pSparseMemoryRequirementCount *uint32, pSparseMemoryRequirements []SparseImageMemoryRequirements2) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **DeviceImageMemoryRequirements) **C.struct_VkDeviceImageMemoryRequirements { /* Pointer */
+		g2c := (*C.struct_VkDeviceImageMemoryRequirements)(*x)
+		return &g2c
+	}(&pInfo)
+	p2 := func(x **uint32) **C.uint32_t { /* Pointer */ g2c := (*C.uint32_t)(*x); return &g2c }(&pSparseMemoryRequirementCount)
+	p3 := func(x *[]SparseImageMemoryRequirements2) **C.struct_VkSparseImageMemoryRequirements2 { /* Slice */
+		if len(*x) > 0 {
+			slc := (*C.struct_VkSparseImageMemoryRequirements2)(unsafe.Pointer(&((*x)[0])))
+			return &slc
+		}
+		var ptr unsafe.Pointer
+		return (**C.struct_VkSparseImageMemoryRequirements2)(unsafe.Pointer((&ptr)))
+	}(&pSparseMemoryRequirements)
+	C.vkGetDeviceImageSparseMemoryRequirements(addrs, *p0, *p1, *p2, *p3)
+}
+
+// GetDeviceImageSparseMemoryRequirementsInto calls GetDeviceImageSparseMemoryRequirements with the count query, the fill and
+// the VK_INCOMPLETE retries in a single cgo call. The elements are stored in
+// dst, reallocated only when its capacity is too small, and returned.
+// The sType of every element is set; pNext is passed through.
+func (x DeviceFacade) GetDeviceImageSparseMemoryRequirementsInto(pInfo *DeviceImageMemoryRequirements, dst []SparseImageMemoryRequirements2) []SparseImageMemoryRequirements2 {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **DeviceImageMemoryRequirements) **C.struct_VkDeviceImageMemoryRequirements { /* Pointer */
+		g2c := (*C.struct_VkDeviceImageMemoryRequirements)(*x)
+		return &g2c
+	}(&pInfo)
+	for {
+		dst = dst[:cap(dst)]
+		var items *C.struct_VkSparseImageMemoryRequirements2
+		if len(dst) > 0 {
+			items = (*C.struct_VkSparseImageMemoryRequirements2)(unsafe.Pointer(&dst[0]))
+		}
+		ret := C.vksEnumerate_vkGetDeviceImageSparseMemoryRequirements(addrs, C.uint64_t(uintptr(unsafe.Pointer(*p0))), *p1, C.uint32_t(len(dst)), items)
+		if Result(ret.result) == VK_INCOMPLETE && int(ret.count) > len(dst) {
+			dst = make([]SparseImageMemoryRequirements2, ret.count)
+			continue
+		}
+		return dst[:ret.count]
+	}
+}
+
+// GetPrivateData command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkGetPrivateData.html
+func (x DeviceFacade) GetPrivateData(objectType ObjectType, objectHandle uint64, privateDataSlot PrivateDataSlot, pData *uint64) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := /* typedef */ (*C.VkObjectType)(&objectType)
+	p2 := func(x *uint64) *C.uint64_t { /* Scalar */ g2c := C.uint64_t(*x); return &g2c }(&objectHandle)
+	p3 := /* handle */ (*C.VkPrivateDataSlot)(&privateDataSlot)
+	p4 := func(x **uint64) **C.uint64_t { /* Pointer */ g2c := (*C.uint64_t)(*x); return &g2c }(&pData)
+	C.vkGetPrivateData(addrs, *p0, *p1, *p2, *p3, *p4)
+}
+
+// SetPrivateData command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkSetPrivateData.html
+func (x DeviceFacade) SetPrivateData(objectType ObjectType, objectHandle uint64, privateDataSlot PrivateDataSlot, data uint64) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := /* typedef */ (*C.VkObjectType)(&objectType)
+	p2 := func(x *uint64) *C.uint64_t { /* Scalar */ g2c := C.uint64_t(*x); return &g2c }(&objectHandle)
+	p3 := /* handle */ (*C.VkPrivateDataSlot)(&privateDataSlot)
+	p4 := func(x *uint64) *C.uint64_t { /* Scalar */ g2c := C.uint64_t(*x); return &g2c }(&data)
+	ret := C.vkSetPrivateData(addrs, *p0, *p1, *p2, *p3, *p4)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// DestroyPrivateDataSlot command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkDestroyPrivateDataSlot.html
+func (x DeviceFacade) DestroyPrivateDataSlot(privateDataSlot PrivateDataSlot, pAllocator *AllocationCallbacks) {
+	addrs := x.procs
+	if destroyHooks.Load() != nil {
+		handleDestroyed(VK_OBJECT_TYPE_PRIVATE_DATA_SLOT, uint64(uintptr(unsafe.Pointer(privateDataSlot))))
+	}
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := /* handle */ (*C.VkPrivateDataSlot)(&privateDataSlot)
+	p2 := func(x **AllocationCallbacks) **C.struct_VkAllocationCallbacks { /* Pointer */
+		g2c := (*C.struct_VkAllocationCallbacks)(*x)
+		return &g2c
+	}(&pAllocator)
+	C.vkDestroyPrivateDataSlot(addrs, *p0, *p1, *p2)
+}
+
+// CreatePrivateDataSlot command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCreatePrivateDataSlot.html
+func (x DeviceFacade) CreatePrivateDataSlot(pCreateInfo *PrivateDataSlotCreateInfo, pAllocator *AllocationCallbacks, pPrivateDataSlot *PrivateDataSlot) Result {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkDevice)(&x.H)
+	p1 := func(x **PrivateDataSlotCreateInfo) **C.struct_VkPrivateDataSlotCreateInfo { /* Pointer */
+		g2c := (*C.struct_VkPrivateDataSlotCreateInfo)(*x)
+		return &g2c
+	}(&pCreateInfo)
+	p2 := func(x **AllocationCallbacks) **C.struct_VkAllocationCallbacks { /* Pointer */
+		g2c := (*C.struct_VkAllocationCallbacks)(*x)
+		return &g2c
+	}(&pAllocator)
+	p3 := func(x **PrivateDataSlot) **C.VkPrivateDataSlot { /* Pointer */
+		g2c := (*C.VkPrivateDataSlot)(*x)
+		return &g2c
+	}(&pPrivateDataSlot)
+	ret := C.vkCreatePrivateDataSlot(addrs, *p0, *p1, *p2, *p3)
+	retPtr := /* typedef */ (*Result)(&ret)
+	return *retPtr
+}
+
+// CmdBlitImage2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdBlitImage2.html
+func (x CommandBufferFacade) CmdBlitImage2(pBlitImageInfo *BlitImageInfo2) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := func(x **BlitImageInfo2) **C.struct_VkBlitImageInfo2 { /* Pointer */
+		g2c := (*C.struct_VkBlitImageInfo2)(*x)
+		return &g2c
+	}(&pBlitImageInfo)
+	C.vkCmdBlitImage2(addrs, *p0, *p1)
+}
+
+// CmdCopyImageToBuffer2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdCopyImageToBuffer2.html
+func (x CommandBufferFacade) CmdCopyImageToBuffer2(pCopyImageToBufferInfo *CopyImageToBufferInfo2) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := func(x **CopyImageToBufferInfo2) **C.struct_VkCopyImageToBufferInfo2 { /* Pointer */
+		g2c := (*C.struct_VkCopyImageToBufferInfo2)(*x)
+		return &g2c
+	}(&pCopyImageToBufferInfo)
+	C.vkCmdCopyImageToBuffer2(addrs, *p0, *p1)
+}
+
+// CmdCopyBufferToImage2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdCopyBufferToImage2.html
+func (x CommandBufferFacade) CmdCopyBufferToImage2(pCopyBufferToImageInfo *CopyBufferToImageInfo2) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := func(x **CopyBufferToImageInfo2) **C.struct_VkCopyBufferToImageInfo2 { /* Pointer */
+		g2c := (*C.struct_VkCopyBufferToImageInfo2)(*x)
+		return &g2c
+	}(&pCopyBufferToImageInfo)
+	C.vkCmdCopyBufferToImage2(addrs, *p0, *p1)
+}
+
+// CmdSetRasterizerDiscardEnable command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdSetRasterizerDiscardEnable.html
+func (x CommandBufferFacade) CmdSetRasterizerDiscardEnable(rasterizerDiscardEnable Bool32) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := /* typedef */ (*C.VkBool32)(&rasterizerDiscardEnable)
+	C.vkCmdSetRasterizerDiscardEnable(addrs, *p0, *p1)
+}
+
+// CmdCopyBuffer2 command
+// https://www.khronos.org/registry/vulkan/specs/1.3-extensions/man/html/vkCmdCopyBuffer2.html
+func (x CommandBufferFacade) CmdCopyBuffer2(pCopyBufferInfo *CopyBufferInfo2) {
+	addrs := x.procs
+	p0 := /* handle */ (*C.VkCommandBuffer)(&x.H)
+	p1 := func(x **CopyBufferInfo2) **C.struct_VkCopyBufferInfo2 { /* Pointer */
+		g2c := (*C.struct_VkCopyBufferInfo2)(*x)
+		return &g2c
+	}(&pCopyBufferInfo)
+	C.vkCmdCopyBuffer2(addrs, *p0, *p1)
+}